@@ -30,6 +30,7 @@
 #include "service/kernel/service_data_utils.h"
 #include "externals/service_memory.h"
 #include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/decision_tree/decision_tree_blocked_forest_impl.i"
 
 namespace daal
 {
@@ -43,6 +44,7 @@ namespace internal
 {
 using namespace daal::internal;
 using namespace daal::services::internal;
+using decision_tree::internal::BlockedForest;
 
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status AdaBoostPredictKernel<method, algorithmFPType, cpu>::computeTwoClassSamme(const NumericTablePtr & xTable, const Model * boostModel,
@@ -304,6 +306,60 @@ services::Status AdaBoostPredictKernel<method, algorithmFPType, cpu>::processBlo
     return services::Status();
 }
 
+/* Computes SAMME prediction by the weak learners compiled into the blocked forest, all weak learners are applied in one pass over the data */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSammeByTrees(const BlockedForest<algorithmFPType, cpu> & forest, const NumericTable & xTable, const algorithmFPType * alpha,
+                                     algorithmFPType * r, const size_t nClasses)
+{
+    const size_t nVectors      = xTable.getNumberOfRows();
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    services::Status s;
+
+    if (nClasses == 2)
+    {
+        service_memset<algorithmFPType, cpu>(r, zero, nVectors);
+        DAAL_CHECK_STATUS(s, forest.predict(xTable, [&](size_t iRow, size_t nRows, size_t iTree, const int * leaves) {
+            for (size_t j = 0; j < nRows; j++) r[iRow + j] += ((forest.getLeafValue(iTree, leaves[j]) > 0) ? one : -one) * alpha[iTree];
+        }));
+
+        for (size_t j = 0; j < nVectors; j++)
+        {
+            r[j] = ((r[j] >= zero) ? one : -one);
+        }
+        return s;
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, nClasses);
+    TArrayCalloc<algorithmFPType, cpu> classScore(nVectors * nClasses);
+    DAAL_CHECK_MALLOC(classScore.get());
+    algorithmFPType * const score = classScore.get();
+
+    DAAL_CHECK_STATUS(s, forest.predict(xTable, [&](size_t iRow, size_t nRows, size_t iTree, const int * leaves) {
+        for (size_t j = 0; j < nRows; j++)
+        {
+            const size_t k = size_t(forest.getLeafValue(iTree, leaves[j]));
+            if (k < nClasses) score[(iRow + j) * nClasses + k] += alpha[iTree];
+        }
+    }));
+
+    /* The class with the largest positive score is chosen, the first one on ties as in the class by class computation */
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        algorithmFPType maxClassScore = zero;
+        r[i]                          = zero;
+        for (size_t k = 0; k < nClasses; k++)
+        {
+            if (score[i * nClasses + k] > maxClassScore)
+            {
+                r[i]          = k;
+                maxClassScore = score[i * nClasses + k];
+            }
+        }
+    }
+    return s;
+}
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status AdaBoostPredictKernel<method, algorithmFPType, cpu>::compute(const NumericTablePtr & xTable, const Model * boostModel,
                                                                               const NumericTablePtr & rTable, const Parameter * par)
@@ -329,7 +385,22 @@ services::Status AdaBoostPredictKernel<method, algorithmFPType, cpu>::compute(co
         ReadColumns<algorithmFPType, cpu> mtAlpha(*boostModel->getAlpha(), 0, 0, nWeakLearners);
         DAAL_CHECK_BLOCK_STATUS(mtAlpha);
         DAAL_ASSERT(mtAlpha.get());
-        if (method == samme && nClasses == 2)
+
+        /* Decision trees and stumps are compiled into the blocked forest and predict all together */
+        bool bTrees = false;
+        BlockedForest<algorithmFPType, cpu> forest;
+        if (method == samme && !BlockedForest<algorithmFPType, cpu>::hasUnorderedFeatures(*xTable))
+        {
+            typedef decision_tree::classification::Model TreeModel;
+            typedef decision_tree::classification::DecisionTreeNode TreeNode;
+            DAAL_CHECK_STATUS(s, (forest.template convertWeakLearners<TreeModel, TreeNode>(*boostModel, nWeakLearners, bTrees)));
+        }
+
+        if (bTrees)
+        {
+            DAAL_CHECK_STATUS(s, (computeSammeByTrees<algorithmFPType, cpu>(forest, *xTable, mtAlpha.get(), r, nClasses)));
+        }
+        else if (method == samme && nClasses == 2)
         {
             DAAL_CHECK_STATUS(s, this->computeTwoClassSamme(xTable, boostModel, nWeakLearners, mtAlpha.get(), r, par));
         }
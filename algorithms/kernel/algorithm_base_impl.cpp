@@ -24,8 +24,12 @@
 #include "algorithms/algorithm_base.h"
 #include "algorithms/algorithm_base_mode_impl.h"
 #include "algorithms/kernel/argument_storage.h"
+#include "data_management/data/factory.h"
 #include "service/kernel/service_algo_utils.h"
 
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_threading.h"
+#include "externals/service_memory.h"
 #include "algorithms/threading/service_thread_pinner.h"
 #include "service/kernel/service_topo.h"
 
@@ -49,10 +53,41 @@ public:
 };
 #endif
 
-algorithms::Argument::Argument(const size_t n) : _storage(new internal::ArgumentStorage(n)), idx(0) {}
+/* Runs the computations of the container in the thread arena of the algorithm if it is set. Otherwise the computations run
+ * in the arena of the NUMA node the calling thread is bound to or in the arena of pinned threads if thread pinning is enabled */
+template <typename ContainerType>
+static services::Status computeContainer(ContainerType * ac, services::ThreadArena * arena)
+{
+    /* Temporaries the kernels allocate from the scratch arena of the calling thread are released in bulk at the end of the call */
+    services::internal::ScratchArenaScope scratchScope;
+    services::internal::MemoryAccountingScope memoryScope;
+
+    if (arena)
+    {
+        services::Status s;
+        daal::threader_execute_in_arena(services::internal::ThreadArenaAccessor::getArena(*arena), [&](int) { s = ac->compute(); });
+        return s;
+    }
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+    TaskWrapper<ContainerType> task(ac);
+
+    /* The arena of the NUMA node the calling thread is bound to takes precedence over the arena of all the cpus */
+    if (daal::services::internal::executeOnNumaNode(task)) return task.getStatus();
+
+    if (pinner != NULL)
+    {
+        pinner->execute(task);
+        return task.getStatus();
+    }
+#endif
+    return ac->compute();
+}
+
+algorithms::Argument::Argument(const size_t n) : _storage(internal::ArgumentStorage::create(n)), idx(0) {}
 
 algorithms::Argument::Argument(const algorithms::Argument & other)
-    : _storage(new internal::ArgumentStorage(*(internal::ArgumentStorage *)other._storage.get())), idx(0)
+    : _storage(internal::ArgumentStorage::create(*(internal::ArgumentStorage *)other._storage.get())), idx(0)
 {}
 
 const data_management::SerializationIfacePtr & algorithms::Argument::get(size_t index) const
@@ -80,24 +115,18 @@ const data_management::DataCollectionPtr & algorithms::Argument::getStorage(cons
     return a._storage;
 }
 
-services::SharedPtr<Base> internal::ArgumentStorage::getExtension(Extension type)
+services::SharedPtr<internal::ArgumentStorage> internal::ArgumentStorage::create(const size_t n)
 {
-    services::SharedPtr<Base> ptr;
-    if (int(type) < _extensions.size()) ptr = _extensions[type];
-    return ptr;
+    services::InplaceRefCounter<ArgumentStorage> * refCount = new services::InplaceRefCounter<ArgumentStorage>();
+    if (!refCount) return services::SharedPtr<ArgumentStorage>();
+    return refCount->share(new (refCount->storage()) ArgumentStorage(n));
 }
 
-void internal::ArgumentStorage::setExtension(Extension type, const services::SharedPtr<Base> & ptr)
+services::SharedPtr<internal::ArgumentStorage> internal::ArgumentStorage::create(const ArgumentStorage & o)
 {
-    if (int(type) >= _extensions.size())
-    {
-        for (auto i = _extensions.size(); i < type; ++i) _extensions.push_back(services::SharedPtr<Base>());
-        _extensions.push_back(ptr);
-    }
-    else
-    {
-        _extensions[type] = ptr;
-    }
+    services::InplaceRefCounter<ArgumentStorage> * refCount = new services::InplaceRefCounter<ArgumentStorage>();
+    if (!refCount) return services::SharedPtr<ArgumentStorage>();
+    return refCount->share(new (refCount->storage()) ArgumentStorage(o));
 }
 } // namespace algorithms
 
@@ -107,9 +136,7 @@ namespace internal
 {
 services::HostAppIfacePtr getHostApp(algorithms::internal::ArgumentStorage & s)
 {
-    auto ext = s.getExtension(algorithms::internal::ArgumentStorage::hostApp);
-    DAAL_ASSERT(!ext.get() || dynamic_cast<services::HostAppIface *>(ext.get()));
-    return services::dynamicPointerCast<services::HostAppIface>(ext);
+    return s.getHostApp();
 }
 
 //service class that makes possible to access Input's storage
@@ -118,8 +145,11 @@ class StorageAccessor : public daal::algorithms::Input
 public:
     static daal::algorithms::internal::ArgumentStorage * get(daal::algorithms::Input & inp)
     {
-        return dynamic_cast<daal::algorithms::internal::ArgumentStorage *>(getStorage(inp).get());
+        return daal::algorithms::internal::ArgumentStorage::cast(getStorage(inp).get());
     }
+
+    /* Makes the argument share the elements of another argument */
+    static void share(daal::algorithms::Argument & dst, const daal::algorithms::Argument & src) { getStorage(dst) = getStorage(src); }
 };
 
 services::HostAppIfacePtr getHostApp(daal::algorithms::Input & inp)
@@ -132,13 +162,44 @@ services::HostAppIfacePtr getHostApp(daal::algorithms::Input & inp)
 services::HostAppIface * hostApp(daal::algorithms::Input & inp)
 {
     auto storage = StorageAccessor::get(inp);
-    return storage ? getHostApp(*storage).get() : nullptr;
+    return storage ? storage->getHostApp().get() : nullptr;
+}
+
+services::ThreadArenaPtr getThreadArena(daal::algorithms::Input & inp)
+{
+    auto storage = StorageAccessor::get(inp);
+    if (!storage) return services::ThreadArenaPtr();
+    return storage->getThreadArena();
+}
+
+services::ThreadArena * threadArena(daal::algorithms::Input & inp)
+{
+    auto storage = StorageAccessor::get(inp);
+    return storage ? storage->getThreadArena().get() : nullptr;
+}
+
+void setThreadArena(const services::ThreadArenaPtr & pArena, daal::algorithms::Input & inp)
+{
+    auto ptr = StorageAccessor::get(inp);
+    if (ptr) ptr->setThreadArena(pArena);
 }
 
 void setHostApp(const services::SharedPtr<services::HostAppIface> & pHostApp, daal::algorithms::Input & inp)
 {
     auto ptr = StorageAccessor::get(inp);
-    if (ptr) ptr->setExtension(algorithms::internal::ArgumentStorage::hostApp, pHostApp);
+    if (ptr) ptr->setHostApp(pHostApp);
+}
+
+bool reusesCachedData(daal::algorithms::Input & inp)
+{
+    auto storage = StorageAccessor::get(inp);
+    return storage ? storage->getReuseCachedData() : false;
+}
+
+void setCachedDataReuse(bool reuse, daal::algorithms::Input & inp)
+{
+    auto ptr = StorageAccessor::get(inp);
+    if (ptr) ptr->setReuseCachedData(reuse);
 }
 
 } //namespace internal
@@ -178,20 +239,9 @@ services::Status AlgorithmImpl<mode>::computeNoThrow()
     s = setupCompute();
     if (s)
     {
-#if !(defined DAAL_THREAD_PINNING_DISABLED)
-        daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
-
-        if (pinner != NULL)
-        {
-            TaskWrapper<AlgorithmContainerImpl<mode> > task(this->_ac);
-            pinner->execute(task);
-            s |= task.getStatus();
-        }
-        else
-#endif
-        {
-            s = this->_ac->compute();
-        }
+        s |= computeContainer(this->_ac, this->_in ? services::internal::threadArena(*this->_in) : NULL);
+        /* Kernels of the algorithm could be scheduled asynchronously, results are available only after the wait */
+        services::Environment::getInstance()->getDefaultExecutionContext().wait(&s);
     }
 
     s |= resetCompute();
@@ -210,11 +260,25 @@ void AlgorithmImpl<mode>::setHostApp(const services::HostAppIfacePtr & pHost)
     if (this->_in) services::internal::setHostApp(pHost, *this->_in);
 }
 
+template <ComputeMode mode>
+services::ThreadArenaPtr AlgorithmImpl<mode>::threadArena()
+{
+    return this->_in ? services::internal::getThreadArena(*this->_in) : services::ThreadArenaPtr();
+}
+
+template <ComputeMode mode>
+void AlgorithmImpl<mode>::setThreadArena(const services::ThreadArenaPtr & pArena)
+{
+    if (this->_in) services::internal::setThreadArena(pArena, *this->_in);
+}
+
 /**
  * Computes final results of the algorithm in the %batch mode without possibility of throwing an exception.
  */
 services::Status AlgorithmImpl<batch>::computeNoThrow()
 {
+    if (isPrepared()) return computePrepared();
+
     this->setParameter();
 
     if (this->isChecksEnabled())
@@ -226,38 +290,236 @@ services::Status AlgorithmImpl<batch>::computeNoThrow()
     services::Status s = this->allocateResultMemory();
     DAAL_CHECK_MALLOC(s);
 
-    this->_ac->setArguments(this->_in, this->_res, this->_par);
+    if (isResultReuseEnabled() && !this->checkResult())
+    {
+        /* The results of the previous call do not fit the current input */
+        s = this->allocateResult();
+        if (!s) return s;
+    }
 
     if (this->isChecksEnabled())
     {
         s = this->checkResult();
         if (!s) return s;
     }
+
+    this->_ac->setArguments(this->_in, this->_res, this->_par);
+
     s = setupCompute();
 
     if (s)
     {
-#if !(defined DAAL_THREAD_PINNING_DISABLED)
-        daal::services::internal::thread_pinner_t * pinner = daal::services::internal::getThreadPinner(false, read_topology, delete_topology);
+        s |= computeContainer(this->_ac, this->_in ? services::internal::threadArena(*this->_in) : NULL);
+        services::Environment::getInstance()->getDefaultExecutionContext().wait(&s);
+    }
 
-        if (pinner != NULL)
-        {
-            TaskWrapper<AlgorithmContainerImpl<batch> > task(_ac);
-            pinner->execute(task);
-            s |= task.getStatus();
-        }
-        else
-#endif
+    if (resetFlag) s |= resetCompute();
+    _res = this->_ac->getResult();
+    return s;
+}
+
+/**
+ * Enables the reuse of the results between the calls of the compute method
+ */
+void AlgorithmImpl<batch>::enableResultReuse(bool flag)
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    if (storage) storage->setReuseResult(flag);
+}
+
+bool AlgorithmImpl<batch>::isResultReuseEnabled()
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    return storage && storage->getReuseResult();
+}
+
+/* Computation started by computeAsync(), runs as the only task of its task group.
+   It owns the copy of the algorithm it computes on and the copy of the result object that shares the tables of the result */
+class AsyncComputeTask : public internal::AsyncCompute
+{
+public:
+    DAAL_NEW_DELETE();
+
+    AsyncComputeTask(AlgorithmImpl<batch> * algorithm, const data_management::SerializationIfacePtr & result)
+        : _algorithm(algorithm), _result(result), _waited(false)
+    {}
+
+    virtual ~AsyncComputeTask()
+    {
+        wait();
+        delete _algorithm;
+    }
+
+    void run()
+    {
+        AlgorithmImpl<batch> * algorithm = _algorithm;
+        services::Status * status        = &_status;
+        auto computeTask                 = [=]() { *status = algorithm->computeNoThrow(); };
+        _group.run(computeTask);
+    }
+
+    services::Status wait() DAAL_C11_OVERRIDE
+    {
+        if (!_waited)
         {
-            s |= this->_ac->compute();
+            _group.wait();
+            _waited = true;
         }
+        return _status;
     }
 
-    if (resetFlag) s |= resetCompute();
+private:
+    daal::task_group _group;
+    AlgorithmImpl<batch> * _algorithm;
+    data_management::SerializationIfacePtr _result;
+    services::Status _status;
+    bool _waited;
+};
+
+/**
+ * Starts the computation of the final results in the %batch mode as a task of the thread pool of the library
+ */
+services::Status AlgorithmImpl<batch>::computeAsync()
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    if (!storage) return computeNoThrow();
+
+    waitComputeNoThrow();
+
+    this->setParameter();
+    services::Status s = this->allocateResultMemory();
+    if (!s) return s;
+    DAAL_CHECK(_res, services::ErrorNullResult);
+
+    if (isResultReuseEnabled() && !this->checkResult())
+    {
+        s = this->allocateResult();
+        if (!s) return s;
+    }
+
+    /* The result object of the copy is created by its serialization tag and shares the tables of the result,
+       so the task does not refer to the members of this object that can be destroyed before the task ends */
+    data_management::SerializationIfacePtr resultCopy(data_management::Factory::instance().createObject(_res->getSerializationTag()));
+    Result * result = dynamic_cast<Result *>(resultCopy.get());
+    if (!result) return computeNoThrow();
+    services::internal::StorageAccessor::share(*result, *_res);
+
+    AlgorithmImpl<batch> * algorithm = static_cast<AlgorithmImpl<batch> *>(this->cloneImpl());
+    DAAL_CHECK_MALLOC(algorithm);
+    algorithm->_res = result;
+    algorithm->enableChecks(this->isChecksEnabled());
+
+    AsyncComputeTask * task = new AsyncComputeTask(algorithm, resultCopy);
+    if (!task)
+    {
+        delete algorithm;
+        return services::Status(services::ErrorMemoryAllocationFailed);
+    }
+    storage->setAsyncCompute(services::SharedPtr<internal::AsyncCompute>(task));
+    task->run();
+    return s;
+}
+
+/**
+ * Waits for the end of the computation started by computeAsync()
+ */
+services::Status AlgorithmImpl<batch>::waitComputeNoThrow()
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    if (!storage || !storage->getAsyncCompute()) return services::Status();
+
+    services::Status s = storage->getAsyncCompute()->wait();
+    storage->setAsyncCompute(services::SharedPtr<internal::AsyncCompute>());
+    return s;
+}
+
+/**
+ * Returns true if the computation started by computeAsync() is not waited for yet
+ */
+bool AlgorithmImpl<batch>::isComputeAsyncStarted() const
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    return storage && storage->getAsyncCompute();
+}
+
+/**
+ * Validates the parameters and the input, allocates the results and sets up the container once for the repeated computations
+ */
+services::Status AlgorithmImpl<batch>::prepareCompute()
+{
+    setPrepared(false);
+    this->setParameter();
+
+    services::Status s = this->checkComputeParams();
+    if (!s) return s;
+
+    s = this->allocateResultMemory();
+    DAAL_CHECK_MALLOC(s);
+
+    if (!this->checkResult())
+    {
+        s = this->allocateResult();
+        if (!s) return s;
+        s = this->checkResult();
+        if (!s) return s;
+    }
+
+    this->_ac->setArguments(this->_in, this->_res, this->_par);
+
+    s = resetCompute();
+    s |= setupCompute();
+    if (s) setPrepared(true);
+    return s;
+}
+
+/**
+ * Computes the results of the algorithm prepared by prepareCompute(). Only the shapes of the results are validated,
+ * the results that do not fit the current input are allocated again
+ */
+services::Status AlgorithmImpl<batch>::computePrepared()
+{
+    services::Status s;
+    if (!this->checkResult())
+    {
+        s = this->allocateResult();
+        if (!s) return s;
+        s = this->checkResult();
+        if (!s) return s;
+    }
+
+    this->_ac->setArguments(this->_in, this->_res, this->_par);
+
+    s |= computeContainer(this->_ac, this->_in ? services::internal::threadArena(*this->_in) : NULL);
+    services::Environment::getInstance()->getDefaultExecutionContext().wait(&s);
+
     _res = this->_ac->getResult();
     return s;
 }
 
+/**
+ * Cancels the preparation made by prepareCompute()
+ */
+services::Status AlgorithmImpl<batch>::resetPreparedCompute()
+{
+    setPrepared(false);
+    return resetCompute();
+}
+
+/**
+ * Returns true if the algorithm is prepared for the repeated computations by prepareCompute()
+ */
+bool AlgorithmImpl<batch>::isPrepared() const
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    return storage && storage->isPrepared();
+}
+
+void AlgorithmImpl<batch>::setPrepared(bool flag)
+{
+    internal::ArgumentStorage * storage = this->_in ? services::internal::StorageAccessor::get(*this->_in) : NULL;
+    if (storage) storage->setPrepared(flag);
+}
+
 services::HostAppIfacePtr AlgorithmImpl<batch>::hostApp()
 {
     return this->_in ? services::internal::getHostApp(*this->_in) : services::HostAppIfacePtr();
@@ -268,6 +530,16 @@ void AlgorithmImpl<batch>::setHostApp(const services::HostAppIfacePtr & pHost)
     if (this->_in) services::internal::setHostApp(pHost, *this->_in);
 }
 
+services::ThreadArenaPtr AlgorithmImpl<batch>::threadArena()
+{
+    return this->_in ? services::internal::getThreadArena(*this->_in) : services::ThreadArenaPtr();
+}
+
+void AlgorithmImpl<batch>::setThreadArena(const services::ThreadArenaPtr & pArena)
+{
+    if (this->_in) services::internal::setThreadArena(pArena, *this->_in);
+}
+
 template class interface1::AlgorithmImpl<online>;
 template class interface1::AlgorithmImpl<distributed>;
 } // namespace algorithms
@@ -22,8 +22,12 @@
 */
 #ifndef __ARGUMENT_STORAGE_H__
 #define __ARGUMENT_STORAGE_H__
+#include <typeinfo>
 #include "data_management/data/data_collection.h"
+#include "services/host_app.h"
+#include "services/thread_arena.h"
 #include "service/kernel/service_defines.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -31,25 +35,118 @@ namespace algorithms
 {
 namespace internal
 {
+/* Computation started by AlgorithmImpl<batch>::computeAsync(), the destructor waits for its end */
+class AsyncCompute
+{
+public:
+    virtual ~AsyncCompute() {}
+    virtual services::Status wait() = 0;
+};
+
+/* Storage of the elements of an algorithm argument. The host application and the thread arena
+   are kept in typed members, so their lookups on every computation neither allocate nor cast.
+   The storage of the input also keeps the computation started asynchronously on the algorithm,
+   it is not copied with the input and is waited for when the input is destroyed.
+   The flag of the reuse of the data cached by the kernels across computations is set by the algorithms
+   that own the lifetime of this algorithm and call it internally, it is not copied with the input either.
+   The flags of the reuse of the results between the computations and of the preparation by prepareCompute()
+   are kept here instead of the exported algorithm class to keep its layout, they are not copied with the input.
+   The storage of the basic statistics of a numeric table also keeps the counter of the bytes copied by the block access
+   methods of the table and the finiteness of its values known since the last modification to keep the layout
+   of the exported table class, they are not copied with the table */
 class ArgumentStorage : public data_management::DataCollection
 {
 public:
-    enum Extension
-    {
-        hostApp = 0
-    };
     DAAL_CAST_OPERATOR(ArgumentStorage);
-    ArgumentStorage(const size_t n) : data_management::DataCollection(n) {}
-    ArgumentStorage(const ArgumentStorage & o) : data_management::DataCollection(o), _extensions(o._extensions) {}
-    virtual ~ArgumentStorage() {}
+    ArgumentStorage(const size_t n)
+        : data_management::DataCollection(n),
+          _reuseCachedData(false),
+          _reuseResult(false),
+          _prepared(false),
+          _copiedBytes(0),
+          _finitenessFlags(0),
+          _dataExposed(0),
+          _tracksFiniteness(false)
+    {}
+    ArgumentStorage(const ArgumentStorage & o)
+        : data_management::DataCollection(o),
+          _hostApp(o._hostApp),
+          _threadArena(o._threadArena),
+          _reuseCachedData(false),
+          _reuseResult(false),
+          _prepared(false),
+          _copiedBytes(0),
+          _finitenessFlags(0),
+          _dataExposed(0),
+          _tracksFiniteness(false)
+    {}
+    virtual ~ArgumentStorage() { _asyncCompute.reset(); }
+
+    /* Creates the storage and its reference counter in a single memory block */
+    static services::SharedPtr<ArgumentStorage> create(const size_t n);
+    static services::SharedPtr<ArgumentStorage> create(const ArgumentStorage & o);
+
+    /* Returns the storage if the collection was created by the library and not set by the user */
+    static ArgumentStorage * cast(data_management::DataCollection * collection)
+    {
+        return (collection && typeid(*collection) == typeid(ArgumentStorage)) ? static_cast<ArgumentStorage *>(collection) : NULL;
+    }
+
+    const services::HostAppIfacePtr & getHostApp() const { return _hostApp; }
+    void setHostApp(const services::HostAppIfacePtr & ptr) { _hostApp = ptr; }
+
+    const services::ThreadArenaPtr & getThreadArena() const { return _threadArena; }
+    void setThreadArena(const services::ThreadArenaPtr & ptr) { _threadArena = ptr; }
 
-    services::SharedPtr<Base> getExtension(Extension type);
-    void setExtension(Extension type, const services::SharedPtr<Base> & ptr);
+    const services::SharedPtr<AsyncCompute> & getAsyncCompute() const { return _asyncCompute; }
+    void setAsyncCompute(const services::SharedPtr<AsyncCompute> & ptr) { _asyncCompute = ptr; }
+
+    bool getReuseCachedData() const { return _reuseCachedData; }
+    void setReuseCachedData(bool reuse) { _reuseCachedData = reuse; }
+
+    bool getReuseResult() const { return _reuseResult; }
+    void setReuseResult(bool reuse) { _reuseResult = reuse; }
+
+    bool isPrepared() const { return _prepared; }
+    void setPrepared(bool prepared) { _prepared = prepared; }
+
+    size_t getCopiedBytes() const { return _copiedBytes; }
+    void addCopiedBytes(size_t nBytes) { daal::atomic_add(&_copiedBytes, nBytes); }
+    void resetCopiedBytes() { _copiedBytes = 0; }
+
+    bool tracksFiniteness() const { return _tracksFiniteness; }
+    void enableFinitenessTracking() { _tracksFiniteness = true; }
+
+    int getFinitenessFlags() const { return _finitenessFlags; }
+    void resetFinitenessFlags() { update(&_finitenessFlags, 0, 0); }
+    void addFinitenessFlags(int flags) { update(&_finitenessFlags, flags, ~0); }
+
+    bool isDataExposed() const { return _dataExposed != 0; }
+    void setDataExposed(bool exposed) { update(&_dataExposed, exposed ? 1 : 0, 0); }
 
 protected:
-    typedef services::SharedPtr<Base> BasePtr;
-    typedef services::Collection<BasePtr> BasePtrCollection;
-    BasePtrCollection _extensions;
+    services::HostAppIfacePtr _hostApp;
+    services::ThreadArenaPtr _threadArena;
+    services::SharedPtr<AsyncCompute> _asyncCompute;
+    bool _reuseCachedData;
+    bool _reuseResult;
+    bool _prepared;
+    size_t _copiedBytes;
+    int _finitenessFlags;
+    int _dataExposed;
+    bool _tracksFiniteness;
+
+    /* Atomically replaces the value pointed by ptr with (value | (*ptr & keepMask)) */
+    static void update(int * ptr, int value, int keepMask)
+    {
+        int expected = *ptr;
+        for (;;)
+        {
+            const int previous = daal::atomic_compare_exchange(ptr, expected, value | (expected & keepMask));
+            if (previous == expected) return;
+            expected = previous;
+        }
+    }
 };
 
 } // namespace internal
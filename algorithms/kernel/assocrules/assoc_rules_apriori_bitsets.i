@@ -0,0 +1,123 @@
+/* file: assoc_rules_apriori_bitsets.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the vertical bitset representation of transactions
+//  that is used in Apriori algorithm to compute supports of candidate itemsets
+//--
+*/
+
+#ifndef __ASSOC_RULES_APRIORI_BITSETS_I__
+#define __ASSOC_RULES_APRIORI_BITSETS_I__
+
+#include "algorithms/threading/threading.h"
+#include "service/kernel/service_defines.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_types.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/** \brief Number of bits set in the word */
+template <CpuType cpu>
+inline uint64_t assocrules_popcount(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (x * 0x0101010101010101ULL) >> 56;
+}
+
+/**
+ *  \brief Vertical representation of the "large" transactions: bit j of the bitset of the unique item
+ *         is set if j-th "large" transaction contains the item
+ */
+template <CpuType cpu>
+struct assocrules_bitsets
+{
+    DAAL_NEW_DELETE();
+
+    assocrules_bitsets() : nWords(0) {}
+
+    /**
+     *  \brief Builds the bitsets of the unique items of the data set
+     *
+     *  \param data[in]     input data set
+     *  \param maxSize[in]  maximum size of the bitsets in bytes
+     *  \return false if the bitsets exceed the maximum size or memory allocation failed, true otherwise
+     */
+    bool init(const assocrules_dataset<cpu> & data, size_t maxSize)
+    {
+        const size_t nTransactions = data.numOfLargeTransactions;
+        const size_t nItems        = data.numOfUniqueItems;
+        if (!nTransactions || !nItems) return false;
+
+        nWords = (nTransactions + wordSize - 1) / wordSize;
+        if (nWords > maxSize / sizeof(uint64_t) / nItems) return false;
+
+        const size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+        if (!_bits.reset(nItems * nWords) || !_indexOfItem.reset(maxItemID + 1)) return false;
+
+        size_t * indexOfItem = _indexOfItem.get();
+        for (size_t i = 0; i < nItems; i++) indexOfItem[data.uniq_items[i].itemID] = i;
+
+        /* Each thread fills the bits of wordSize transactions, so no two threads write the same word */
+        uint64_t * bits                                    = _bits.get();
+        const size_t nWordsLocal                           = nWords;
+        assocrules_transaction<cpu> * const * transactions = data.large_tran;
+        daal::threader_for(nWords, nWords, [=](size_t iWord) {
+            for (size_t i = 0; i < nItems; i++) bits[i * nWordsLocal + iWord] = 0;
+
+            const size_t first = iWord * wordSize;
+            const size_t last  = (first + wordSize < nTransactions ? first + wordSize : nTransactions);
+            for (size_t t = first; t < last; t++)
+            {
+                const assocrules_transaction<cpu> * tran = transactions[t];
+                const uint64_t mask                      = uint64_t(1) << (t - first);
+                for (size_t j = 0; j < tran->size; j++) bits[indexOfItem[tran->items[j]] * nWordsLocal + iWord] |= mask;
+            }
+        });
+        return true;
+    }
+
+    /** \brief Bitset of the unique item with the given ID */
+    const uint64_t * get(size_t itemID) const { return _bits.get() + _indexOfItem[itemID] * nWords; }
+
+    size_t nWords; /*<! Number of 64-bit words in the bitset of one item */
+
+    static const size_t wordSize = 64;
+
+protected:
+    daal::services::internal::TArray<uint64_t, cpu> _bits;      /*<! Bitsets of the unique items */
+    daal::services::internal::TArray<size_t, cpu> _indexOfItem; /*<! Indices of the unique items by their IDs */
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
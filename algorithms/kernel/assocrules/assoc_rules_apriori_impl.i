@@ -52,10 +52,6 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
     const daal::algorithms::association_rules::Parameter * parameter =
         static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
     const double minSupport = parameter->minSupport;
-    size_t minItemsetSize   = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
-
-    NumericTable * largeItemsetsTable        = r[0];
-    NumericTable * largeItemsetsSupportTable = r[1];
 
     /* Create association rules data set from input numeric table */
     assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
@@ -76,16 +72,28 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
     DAAL_CHECK_STATUS_OK(statLargeItemset.ok(), statLargeItemset);
     DAAL_ASSERT(L_size > 0);
 
+    return writeResults(L.get(), L_size, parameter, r);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::writeResults(ItemSetList<cpu> * L, size_t L_size, const Parameter * parameter,
+                                                                           NumericTable * r[])
+{
+    size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
+
+    NumericTable * largeItemsetsTable        = r[0];
+    NumericTable * largeItemsetsSupportTable = r[1];
+
     /* Allocate memory to store "large" itemsets */
     size_t nLargeItemSets       = 0;
     size_t nItemInLargeItemSets = 0;
     Status s;
-    DAAL_CHECK_STATUS(s, allocateItemsetsTableData(L.get(), L_size, minItemsetSize, largeItemsetsTable, largeItemsetsSupportTable, nLargeItemSets,
+    DAAL_CHECK_STATUS(s, allocateItemsetsTableData(L, L_size, minItemsetSize, largeItemsetsTable, largeItemsetsSupportTable, nLargeItemSets,
                                                    nItemInLargeItemSets));
 
     /* Write "large" itemsets into resulting tables */
     DAAL_CHECK_STATUS(
-        s, writeItemsetsTableData(L.get(), L_size, minItemsetSize, parameter->itemsetsOrder, *largeItemsetsTable, *largeItemsetsSupportTable));
+        s, writeItemsetsTableData(L, L_size, minItemsetSize, parameter->itemsetsOrder, *largeItemsetsTable, *largeItemsetsSupportTable));
 
     if (parameter->discoverRules)
     {
@@ -107,7 +115,7 @@ Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::compute(const Nume
         size_t nLeft                  = 0; /*<! Number of items in left parts of the rules */
         size_t nRight                 = 0; /*<! Number of items in right parts of the rules */
         double minConfidence          = parameter->minConfidence;
-        services::Status statGenRules = generateRules(minConfidence, minItemsetSize, L_size, L.get(), R.get(), nRules, nLeft, nRight);
+        services::Status statGenRules = generateRules(minConfidence, minItemsetSize, L_size, L, R.get(), nRules, nLeft, nRight);
         DAAL_CHECK_STATUS_OK(statGenRules.ok() && !!nRules, statGenRules);
 
         NumericTable * leftItemsTable  = r[2];
@@ -134,6 +142,11 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::findLarg
     DAAL_CHECK_STATUS_OK(statFirstPass.ok(), statFirstPass);
 
     L_size = 1;
+
+    /* Supports of the candidates are computed from the vertical representation of transactions if it fits into memory */
+    assocrules_bitsets<cpu> bitsets;
+    const bool useBitsets = bitsets.init(data, _maxBitsetsSize);
+
     /* Find "large" item sets of size k+1 from itemsets of size k */
     size_t k                = 1;
     bool bFound             = false;
@@ -141,8 +154,12 @@ services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::findLarg
     do
     {
         services::Status s;
-        C_tree = nextPass(minSupport, k++, data, L, L_size, bFound, C_tree, s);
-        DAAL_CHECK_STATUS_OK(s.ok(), s);
+        C_tree = nextPass(minSupport, k++, data, L, L_size, bFound, C_tree, useBitsets ? &bitsets : nullptr, s);
+        if (!s.ok())
+        {
+            delete C_tree;
+            return s;
+        }
     } while (bFound && k < maxItemsetSize);
 
     delete C_tree;
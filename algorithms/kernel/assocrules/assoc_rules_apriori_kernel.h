@@ -29,6 +29,7 @@
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_itemset.i"
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_types.i"
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_tree.i"
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_bitsets.i"
 
 namespace daal
 {
@@ -49,6 +50,9 @@ public:
     services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
 
 protected:
+    /** Write "large" item sets and, if requested, discovered association rules into the resulting tables */
+    services::Status writeResults(ItemSetList<cpu> * L, size_t L_size, const Parameter * parameter, NumericTable * r[]);
+
     services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
                                        size_t & L_size);
 
@@ -73,7 +77,7 @@ protected:
 
     /** Generate "large" item sets of size k+1 from "large" item sets of size k */
     hash_tree<cpu> * nextPass(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L, size_t & L_size, bool & bFound,
-                              hash_tree<cpu> * C_tree, services::Status & s);
+                              hash_tree<cpu> * C_tree, const assocrules_bitsets<cpu> * bitsets, services::Status & s);
 
     /** Test that all {n-1}-item subsets of {n}-item set are "large" item sets */
     bool pruneCandidate(size_t iset_size, const size_t * cadidate, size_t * subset, hash_tree<cpu> & C_tree);
@@ -94,7 +98,11 @@ protected:
 
     /** Remove candidate itemsets which support is less then minimum support
         from array of "large" item sets */
-    void prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L, hash_tree<cpu> * C_tree);
+    services::Status prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L, hash_tree<cpu> * C_tree,
+                           const assocrules_bitsets<cpu> * bitsets);
+
+    /** Compute supports of the candidate itemsets of size iset_size as the number of bits set in the intersections of their items bitsets */
+    services::Status countSupports(size_t iset_size, ItemSetList<cpu> & candidates, const assocrules_bitsets<cpu> & bitsets);
 
     /*
      *  Auxiliary methods for association rules discovery
@@ -121,6 +129,9 @@ protected:
 
     /** Store association rules into continuous memory */
     void setRules(AssocRule<cpu> ** R, size_t numRules, int * rleft, int * rright, algorithmFPType * rconf);
+
+    static const size_t _maxBitsetsSize     = (size_t)1 << 28; /* maximum size in bytes of the vertical representation of transactions */
+    static const size_t _candidatesPerBlock = 64;              /* number of candidate itemsets whose supports are computed by one task */
 };
 
 } // namespace internal
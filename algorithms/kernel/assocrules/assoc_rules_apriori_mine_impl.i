@@ -28,10 +28,12 @@
 #include "externals/service_memory.h"
 #include "externals/service_math.h"
 #include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
 
 #include "algorithms/threading/threading.h"
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_types.i"
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_tree.i"
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_bitsets.i"
 
 using namespace daal::algorithms::internal;
 
@@ -228,7 +230,8 @@ bool AssociationRulesKernel<apriori, algorithmFPType, cpu>::genCandidates(size_t
         {
             auto first_items     = first_it->itemSet()->items;
             size_t last_item     = first_items[iset_size - 1];
-            size_t start_item_id = binarySearch(nUniqueItems, uniqueItems, last_item);
+            /* Candidates are extended with the items greater than the last item only, so that no item is repeated */
+            size_t start_item_id = binarySearch(nUniqueItems, uniqueItems, last_item) + 1;
             for (size_t k = start_item_id; k < nUniqueItems; k++)
             {
                 services::Status s;
@@ -341,12 +344,29 @@ void removeNodesWithSmallSupport(ItemSetList<cpu> & l, size_t support)
  *  \param iset_size[in] size (number of items) of the candidate itemsets
  *  \param data[in]      input data set
  *  \param L[in]         structure containing "large" item sets
- *
+ *  \param C_tree[in]    hash tree formed from candidates
+ *  \param bitsets[in]   vertical representation of the "large" transactions, NULL if supports are counted with the hash tree
+ *  \return Status object
  */
 template <typename algorithmFPType, CpuType cpu>
-void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data,
-                                                                  ItemSetList<cpu> * L, hash_tree<cpu> * C_tree)
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data,
+                                                                              ItemSetList<cpu> * L, hash_tree<cpu> * C_tree,
+                                                                              const assocrules_bitsets<cpu> * bitsets)
 {
+    if (bitsets)
+    {
+        services::Status s = countSupports(iset_size + 1, L[iset_size], *bitsets);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        /* Remove candidates that has support less than mininmum support from hash tree */
+        for (size_t i = 0; i < C_tree->n_leaves; i++)
+        {
+            removeNodesWithSmallSupport<cpu>(C_tree->leaves[i].iset_list, imin_s);
+        }
+        removeNodesWithSmallSupport<cpu>(L[iset_size], imin_s);
+        return s;
+    }
+
     size_t new_iset_size = iset_size + 1;
     daal::tls<size_t *> tls([&]() -> size_t * // The functor to initialize a memory buffer
                             { return daal::services::internal::service_calloc<size_t, cpu>(2 * new_iset_size); });
@@ -410,6 +430,76 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s,
         iNotLarge--;
     }
     data.numOfLargeTransactions = iLarge;
+    return services::Status();
+}
+
+/**
+ *  \brief Compute supports of the candidate itemsets as the number of bits set in the intersection of the bitsets of their items.
+ *         Candidates are processed by blocks in parallel, the intersection of the bitsets of the first iset_size-1 items
+ *         is reused by the consecutive candidates that have the same first items
+ *
+ *  \param iset_size[in]    size (number of items) of the candidate itemsets
+ *  \param candidates[in]   list of the candidate itemsets
+ *  \param bitsets[in]      vertical representation of the "large" transactions
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<apriori, algorithmFPType, cpu>::countSupports(size_t iset_size, ItemSetList<cpu> & candidates,
+                                                                                      const assocrules_bitsets<cpu> & bitsets)
+{
+    const size_t nCandidates = candidates.size;
+    if (!nCandidates) return services::Status();
+
+    TArray<assocrules_itemset<cpu> *, cpu> candidatesArray(nCandidates);
+    assocrules_itemset<cpu> ** candidatesPtr = candidatesArray.get();
+    DAAL_CHECK_MALLOC(candidatesPtr);
+    size_t i = 0;
+    for (auto current = candidates.start; current; current = current->next()) candidatesPtr[i++] = current->itemSet();
+
+    const size_t nWords = bitsets.nWords;
+    daal::tls<uint64_t *> tls([=]() -> uint64_t * { return daal::services::internal::service_calloc<uint64_t, cpu>(nWords); });
+
+    SafeStatus safeStat;
+    const size_t nBlocks = (nCandidates + _candidatesPerBlock - 1) / _candidatesPerBlock;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        uint64_t * prefix = tls.local();
+        DAAL_CHECK_MALLOC_THR(prefix);
+
+        const size_t first         = iBlock * _candidatesPerBlock;
+        const size_t last          = (first + _candidatesPerBlock < nCandidates ? first + _candidatesPerBlock : nCandidates);
+        const size_t * prefixItems = nullptr;
+        for (size_t iCandidate = first; iCandidate < last; iCandidate++)
+        {
+            assocrules_itemset<cpu> * candidate = candidatesPtr[iCandidate];
+            const size_t * items                = candidate->items;
+
+            if (!prefixItems || assocrules_memcmp<cpu>(items, prefixItems, iset_size - 1))
+            {
+                const uint64_t * bits = bitsets.get(items[0]);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t w = 0; w < nWords; w++) prefix[w] = bits[w];
+
+                for (size_t j = 1; j < iset_size - 1; j++)
+                {
+                    bits = bitsets.get(items[j]);
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t w = 0; w < nWords; w++) prefix[w] &= bits[w];
+                }
+                prefixItems = items;
+            }
+
+            const uint64_t * bits = bitsets.get(items[iset_size - 1]);
+            uint64_t support      = 0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t w = 0; w < nWords; w++) support += assocrules_popcount<cpu>(prefix[w] & bits[w]);
+            candidate->support.set(support);
+        }
+    });
+
+    tls.reduce([](uint64_t * prefix) { daal::services::daal_free(prefix); });
+    return safeStat.detach();
 }
 
 /**
@@ -422,12 +512,15 @@ void AssociationRulesKernel<apriori, algorithmFPType, cpu>::prune(size_t imin_s,
  *  \param L_size[out]     size of the array L
  *  \param bFound[out]  flag. true,  if at least 2 "large" item sets of size k+1 were found;
  *                               false, otherwise
+ *  \param C_tree[in]     hash tree formed from the "large" item sets of size k
+ *  \param bitsets[in]    vertical representation of the "large" transactions, NULL if supports are counted with the hash tree
  *  \param s[out]       Status object that indicates the result of memory allocation
  */
 template <typename algorithmFPType, CpuType cpu>
 hash_tree<cpu> * AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass(size_t imin_s, size_t iset_size, assocrules_dataset<cpu> & data,
                                                                                  ItemSetList<cpu> * L, size_t & L_size, bool & bFound,
-                                                                                 hash_tree<cpu> * C_tree, services::Status & s)
+                                                                                 hash_tree<cpu> * C_tree, const assocrules_bitsets<cpu> * bitsets,
+                                                                                 services::Status & s)
 {
     s      = services::Status();
     bFound = genCandidates(iset_size, L, C_tree, data.numOfUniqueItems, data.uniq_items, s);
@@ -453,7 +546,12 @@ hash_tree<cpu> * AssociationRulesKernel<apriori, algorithmFPType, cpu>::nextPass
         return nullptr;
     }
 
-    prune(imin_s, iset_size, data, L, C_tree_new);
+    s = prune(imin_s, iset_size, data, L, C_tree_new, bitsets);
+    if (!s.ok())
+    {
+        bFound = false;
+        return C_tree_new;
+    }
     if (L[iset_size].size > 0)
     {
         ++L_size;
@@ -24,6 +24,7 @@
 #include "algorithms/association_rules/apriori.h"
 #include "algorithms/kernel/assocrules/assoc_rules_kernel.h"
 #include "algorithms/kernel/assocrules/assoc_rules_apriori_kernel.h"
+#include "algorithms/kernel/assocrules/assoc_rules_fpgrowth_kernel.h"
 
 namespace daal
 {
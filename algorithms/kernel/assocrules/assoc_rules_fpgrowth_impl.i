@@ -0,0 +1,340 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for association rules
+//  FP-growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_impl.i"
+
+using namespace daal::algorithms::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::compute(const NumericTable * a, NumericTable * r[],
+                                                                       const daal::algorithms::Parameter * algParameter)
+{
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter * parameter =
+        static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    const double minSupport = parameter->minSupport;
+
+    /* Create association rules data set from input numeric table */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+    DAAL_CHECK_STATUS_OK(data.ok(), data.getLastStatus());
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, data.numOfUniqueItems, sizeof(ItemSetList<cpu>));
+
+    TArray<ItemSetList<cpu>, cpu> L(data.numOfUniqueItems);
+    DAAL_CHECK(L.get(), ErrorMemoryAllocationFailed);
+    for (size_t i = 0, n = L.size(); i < n; ++i) L[i].setDataOwner(true);
+
+    /* Find "large" itemsets */
+    size_t L_size         = 0;
+    size_t maxItemsetSize = ((parameter->maxItemsetSize == 0) ? (size_t)-1 : parameter->maxItemsetSize);
+    double ceil           = daal::internal::Math<double, cpu>::sCeil(minSupport * data.numOfTransactions);
+    DAAL_ASSERT(ceil >= 0)
+    services::Status statLargeItemset = findLargeItemsets((size_t)ceil, maxItemsetSize, data, L.get(), L_size);
+    DAAL_CHECK_STATUS_OK(statLargeItemset.ok(), statLargeItemset);
+    DAAL_ASSERT(L_size > 0);
+
+    return super::writeResults(L.get(), L_size, parameter, r);
+}
+
+/**
+ *  \brief Find "large" itemsets. Itemsets of size 1 are the unique items of the data set,
+ *         larger itemsets are mined from the conditional trees of the items in parallel.
+ *         Items of the stored itemsets are sorted in increasing order of their IDs as in Apriori method
+ *
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in "large" itemsets
+ *  \param data[in]             input data set
+ *  \param L[out]               structure containing "large" itemsets
+ *  \param L_size[out]          maximum size of the found "large" itemsets
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                                           assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                                                                           size_t & L_size)
+{
+    services::Status s = this->firstPass(minSupport, data, *L);
+    DAAL_CHECK_STATUS_VAR(s);
+    L_size = 1;
+
+    const size_t nItems = data.numOfUniqueItems;
+    if (maxItemsetSize < 2 || nItems < 2) return s;
+
+    /* Rank the items in the order of decreasing supports, the items with equal supports are ordered by their IDs */
+    const assocRulesUniqueItem<cpu> * uniqueItems = data.uniq_items;
+    TArray<size_t, cpu> itemOfRankArray(nItems);
+    TArray<size_t, cpu> rankOfItemArray(nItems);
+    size_t * itemOfRank = itemOfRankArray.get();
+    size_t * rankOfItem = rankOfItemArray.get();
+    DAAL_CHECK_MALLOC(itemOfRank && rankOfItem);
+
+    for (size_t i = 0; i < nItems; i++) itemOfRank[i] = i;
+    algorithms::internal::introSort<cpu>(itemOfRank, itemOfRank + nItems, [=](size_t i, size_t j) {
+        return (uniqueItems[i].support > uniqueItems[j].support) || (uniqueItems[i].support == uniqueItems[j].support && i < j);
+    });
+    for (size_t i = 0; i < nItems; i++) rankOfItem[itemOfRank[i]] = i;
+
+    FPTree<cpu> tree;
+    DAAL_CHECK_STATUS(s, tree.init(nItems, data.numOfLargeTransactions + 1));
+    DAAL_CHECK_STATUS(s, buildTree(data, rankOfItem, tree));
+
+    /* Conditional trees are needed at the depths 0 .. min(maxItemsetSize, nItems) - 2 */
+    const size_t maxDepth = (maxItemsetSize < nItems ? maxItemsetSize : nItems) - 1;
+
+    TArray<ItemSetList<cpu>, cpu> itemsets(nItems);
+    DAAL_CHECK_MALLOC(itemsets.get());
+    for (size_t i = 0; i < nItems; i++) itemsets[i].setDataOwner(true);
+
+    SafeStatus safeStat;
+    daal::tls<FPGrowthScratch<cpu> *> tls([=, &safeStat]() -> FPGrowthScratch<cpu> * {
+        FPGrowthScratch<cpu> * scratch = new FPGrowthScratch<cpu>();
+        if (!scratch || !scratch->init(nItems, maxDepth))
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete scratch;
+            return nullptr;
+        }
+        return scratch;
+    });
+
+    /* Itemsets that end with the item of rank i contain only the items of smaller ranks */
+    daal::threader_for(nItems, nItems, [&](size_t item) {
+        if (item == 0 || tree.itemCount(item) < minSupport) return;
+
+        FPGrowthScratch<cpu> * scratch = tls.local();
+        DAAL_CHECK_MALLOC_THR(scratch);
+
+        FPTree<cpu> & conditionalTree = scratch->trees[0];
+        services::Status localStatus  = buildConditionalTree(tree, item, minSupport, *scratch, conditionalTree);
+        DAAL_CHECK_STATUS_THR(localStatus);
+        if (conditionalTree.empty()) return;
+
+        scratch->suffix[0] = item;
+        localStatus        = mineTree(conditionalTree, 1, minSupport, maxItemsetSize, uniqueItems, itemOfRank, *scratch, itemsets[item]);
+        DAAL_CHECK_STATUS_THR(localStatus);
+    });
+
+    tls.reduce([](FPGrowthScratch<cpu> * scratch) -> void { delete scratch; });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* Distribute the found itemsets over the lists of itemsets of the same size */
+    for (size_t item = 0; item < nItems; item++)
+    {
+        ItemSetList<cpu> & list = itemsets[item];
+        list.setDataOwner(false);
+        for (auto current = list.start; current; current = current->next())
+        {
+            assocrules_itemset<cpu> * itemset = current->itemSet();
+            if (!L[itemset->size - 1].insert(itemset))
+            {
+                for (; current; current = current->next()) delete current->itemSet();
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            }
+            if (L_size < itemset->size) L_size = itemset->size;
+        }
+    }
+    return s;
+}
+
+/**
+ *  \brief Build the frequent-pattern tree of the "large" transactions,
+ *         the items of each transaction are inserted in increasing order of their ranks
+ *
+ *  \param data[in]         input data set
+ *  \param rankOfItem[in]   ranks of the unique items
+ *  \param tree[out]        frequent-pattern tree
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildTree(assocrules_dataset<cpu> & data, const size_t * rankOfItem,
+                                                                                   FPTree<cpu> & tree)
+{
+    size_t maxTransactionSize = 0;
+    for (size_t i = 0; i < data.numOfLargeTransactions; i++)
+    {
+        if (maxTransactionSize < data.large_tran[i]->size) maxTransactionSize = data.large_tran[i]->size;
+    }
+
+    TArray<size_t, cpu> pathArray(maxTransactionSize);
+    size_t * path = pathArray.get();
+    DAAL_CHECK_MALLOC(path || !maxTransactionSize);
+
+    services::Status s;
+    for (size_t i = 0; i < data.numOfLargeTransactions; i++)
+    {
+        const assocrules_transaction<cpu> * tran = data.large_tran[i];
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            path[j] = rankOfItem[this->binarySearch(data.numOfUniqueItems, data.uniq_items, tran->items[j])];
+        }
+        qSort<size_t, cpu>(tran->size, path);
+
+        /* Skip the items repeated in the transaction */
+        size_t n = 0;
+        for (size_t j = 0; j < tran->size; j++)
+        {
+            if (!n || path[n - 1] != path[j]) path[n++] = path[j];
+        }
+        DAAL_CHECK_STATUS(s, tree.insert(path, n, 1));
+    }
+    return s;
+}
+
+/**
+ *  \brief Build the conditional tree of the item: the paths from the nodes of the item to the root
+ *         are inserted without the items which support in those paths is less than minimum support
+ *
+ *  \param tree[in]             frequent-pattern tree
+ *  \param item[in]             rank of the item
+ *  \param minSupport[in]       minimum support
+ *  \param scratch[in]          per-thread buffers
+ *  \param conditionalTree[out] conditional tree that contains the items of ranks less than item
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::buildConditionalTree(const FPTree<cpu> & tree, size_t item,
+                                                                                              size_t minSupport, FPGrowthScratch<cpu> & scratch,
+                                                                                              FPTree<cpu> & conditionalTree)
+{
+    services::Status s;
+    if (!conditionalTree.isInitialized())
+    {
+        DAAL_CHECK_STATUS(s, conditionalTree.init(scratch.counts.size(), _conditionalTreeCapacity));
+    }
+
+    size_t * counts = scratch.counts.get();
+    size_t * path   = scratch.path.get();
+    for (size_t i = 0; i < item; i++) counts[i] = 0;
+
+    for (size_t node = tree.head(item); node; node = tree.node(node).next)
+    {
+        const size_t count = tree.node(node).count;
+        for (size_t p = tree.node(node).parent; p; p = tree.node(p).parent) counts[tree.node(p).item] += count;
+    }
+
+    conditionalTree.reset(item);
+    for (size_t node = tree.head(item); node; node = tree.node(node).next)
+    {
+        size_t n = 0;
+        for (size_t p = tree.node(node).parent; p; p = tree.node(p).parent)
+        {
+            const size_t pathItem = tree.node(p).item;
+            if (counts[pathItem] >= minSupport) path[n++] = pathItem;
+        }
+        if (!n) continue;
+
+        /* Ranks decrease on the way to the root */
+        for (size_t i = 0; i < n / 2; i++)
+        {
+            const size_t tmp = path[i];
+            path[i]          = path[n - 1 - i];
+            path[n - 1 - i]  = tmp;
+        }
+        DAAL_CHECK_STATUS(s, conditionalTree.insert(path, n, tree.node(node).count));
+    }
+    return s;
+}
+
+/**
+ *  \brief Store the "large" itemsets that consist of an item of the conditional tree and the suffix items,
+ *         and recursively mine the conditional trees of those itemsets
+ *
+ *  \param tree[in]             conditional tree of the suffix
+ *  \param suffixSize[in]       number of items in the suffix stored in scratch.suffix
+ *  \param minSupport[in]       minimum support
+ *  \param maxItemsetSize[in]   maximum number of items in "large" itemsets
+ *  \param uniqueItems[in]      unique items of the data set
+ *  \param itemOfRank[in]       indices of the unique items in the order of their ranks
+ *  \param scratch[in]          per-thread buffers
+ *  \param itemsets[out]        list of the found "large" itemsets
+ *  \return Status object
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status AssociationRulesKernel<fpGrowth, algorithmFPType, cpu>::mineTree(const FPTree<cpu> & tree, size_t suffixSize, size_t minSupport,
+                                                                                  size_t maxItemsetSize,
+                                                                                  const assocRulesUniqueItem<cpu> * uniqueItems,
+                                                                                  const size_t * itemOfRank, FPGrowthScratch<cpu> & scratch,
+                                                                                  ItemSetList<cpu> & itemsets)
+{
+    services::Status s;
+    size_t * suffix          = scratch.suffix.get();
+    size_t * items           = scratch.items.get();
+    const size_t itemsetSize = suffixSize + 1;
+
+    for (size_t item = 0; item < tree.nItems(); item++)
+    {
+        const size_t support = tree.itemCount(item);
+        if (support < minSupport) continue;
+
+        suffix[suffixSize] = item;
+        for (size_t i = 0; i < itemsetSize; i++) items[i] = uniqueItems[itemOfRank[suffix[i]]].itemID;
+        qSort<size_t, cpu>(itemsetSize, items);
+
+        assocrules_itemset<cpu> * itemset = new assocrules_itemset<cpu>(itemsetSize, items, items[itemsetSize - 1], support);
+        DAAL_CHECK_MALLOC(itemset);
+        if (!itemset->ok() || !itemsets.insert(itemset))
+        {
+            s = (itemset->ok() ? services::Status(services::ErrorMemoryAllocationFailed) : itemset->getLastStatus());
+            delete itemset;
+            return s;
+        }
+
+        if (item == 0 || itemsetSize >= maxItemsetSize) continue;
+
+        FPTree<cpu> & conditionalTree = scratch.trees[suffixSize];
+        DAAL_CHECK_STATUS(s, buildConditionalTree(tree, item, minSupport, scratch, conditionalTree));
+        if (!conditionalTree.empty())
+        {
+            DAAL_CHECK_STATUS(s,
+                              mineTree(conditionalTree, itemsetSize, minSupport, maxItemsetSize, uniqueItems, itemOfRank, scratch, itemsets));
+        }
+    }
+    return s;
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,105 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  with FP-growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_kernel.h"
+#include "algorithms/kernel/assocrules/assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  \brief Per-thread buffers of the conditional trees mining
+ */
+template <CpuType cpu>
+struct FPGrowthScratch
+{
+    DAAL_NEW_DELETE();
+
+    FPGrowthScratch() : trees(nullptr) {}
+    ~FPGrowthScratch() { delete[] trees; }
+
+    bool init(size_t nItems, size_t maxDepth)
+    {
+        trees = new FPTree<cpu>[maxDepth];
+        return trees && counts.reset(nItems) && path.reset(nItems) && suffix.reset(nItems) && items.reset(nItems);
+    }
+
+    FPTree<cpu> * trees;                                   /*<! Conditional trees, one per recursion depth */
+    daal::services::internal::TArray<size_t, cpu> counts; /*<! Supports of the items in the conditional pattern base */
+    daal::services::internal::TArray<size_t, cpu> path;   /*<! Items of the path in the conditional pattern base */
+    daal::services::internal::TArray<size_t, cpu> suffix; /*<! Item ranks of the currently mined itemset */
+    daal::services::internal::TArray<size_t, cpu> items;  /*<! Item IDs of the itemset being stored */
+};
+
+/**
+ *  Structure that contains kernels for FP-growth association rules mining.
+ *  "Large" itemsets are mined from the conditional frequent-pattern trees instead of the candidate generation,
+ *  association rules are discovered from the "large" itemsets in the same way as in Apriori method
+ */
+template <typename algorithmFPType, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, algorithmFPType, cpu> : public AssociationRulesKernel<apriori, algorithmFPType, cpu>
+{
+    typedef AssociationRulesKernel<apriori, algorithmFPType, cpu> super;
+
+public:
+    /** Find "large" item sets and build association rules */
+    services::Status compute(const NumericTable * a, NumericTable * r[], const daal::algorithms::Parameter * parameter);
+
+protected:
+    /** Find "large" itemsets of size 2 and more by mining the frequent-pattern tree of the data set */
+    services::Status findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> & data, ItemSetList<cpu> * L,
+                                       size_t & L_size);
+
+    /** Build the frequent-pattern tree of the "large" transactions */
+    services::Status buildTree(assocrules_dataset<cpu> & data, const size_t * rankOfItem, FPTree<cpu> & tree);
+
+    /** Build the conditional tree of the item from the paths of the tree that end at the item */
+    services::Status buildConditionalTree(const FPTree<cpu> & tree, size_t item, size_t minSupport, FPGrowthScratch<cpu> & scratch,
+                                          FPTree<cpu> & conditionalTree);
+
+    /** Store "large" itemsets found in the conditional tree of the items suffix[0..suffixSize-1] and mine their conditional trees */
+    services::Status mineTree(const FPTree<cpu> & tree, size_t suffixSize, size_t minSupport, size_t maxItemsetSize,
+                              const assocRulesUniqueItem<cpu> * uniqueItems, const size_t * itemOfRank, FPGrowthScratch<cpu> & scratch,
+                              ItemSetList<cpu> & itemsets);
+
+    static const size_t _conditionalTreeCapacity = 1024; /* initial number of nodes of the conditional trees */
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
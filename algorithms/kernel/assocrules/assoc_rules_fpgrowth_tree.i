@@ -0,0 +1,183 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declarations of frequent-pattern tree structure that is used in FP-growth algorithm
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "externals/service_memory.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/assocrules/assoc_rules_apriori_itemset.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  \brief Node of the frequent-pattern tree.
+ *         Nodes are addressed by their indices, the root has index 0 that also denotes the absent node
+ */
+template <CpuType cpu>
+struct FPTreeNode
+{
+    size_t item;    /*<! Rank of the item in the order of decreasing supports */
+    size_t count;   /*<! Number of transactions that share the path from the root to the node */
+    size_t parent;  /*<! Parent node */
+    size_t child;   /*<! First child node */
+    size_t sibling; /*<! Next child node of the parent */
+    size_t next;    /*<! Next node with the same item */
+};
+
+/**
+ *  \brief Frequent-pattern tree that stores the transactions as the paths of item ranks in increasing order.
+ *         The nodes of each item are linked into the list that starts in the header table
+ */
+template <CpuType cpu>
+class FPTree
+{
+public:
+    DAAL_NEW_DELETE();
+
+    FPTree() : _nodes(nullptr), _size(0), _capacity(0), _nItems(0) {}
+
+    ~FPTree() { daal::services::daal_free(_nodes); }
+
+    /** \brief Allocates the header table for maxItems items and the nodes buffer, the tree is empty after the call */
+    services::Status init(size_t maxItems, size_t capacity)
+    {
+        DAAL_CHECK_MALLOC(_head.reset(maxItems) && _itemCount.reset(maxItems));
+        services::Status s = reserve(capacity > 0 ? capacity : 1);
+        if (s) reset(maxItems);
+        return s;
+    }
+
+    bool isInitialized() const { return _capacity > 0; }
+
+    /** \brief Removes all the nodes, the tree contains items with ranks less than nItems after the call */
+    void reset(size_t nItems)
+    {
+        DAAL_ASSERT(nItems <= _head.size());
+        _nItems = nItems;
+        for (size_t i = 0; i < nItems; i++)
+        {
+            _head[i]      = 0;
+            _itemCount[i] = 0;
+        }
+        FPTreeNode<cpu> & root = _nodes[0];
+        root.item              = 0;
+        root.count             = 0;
+        root.parent            = 0;
+        root.child             = 0;
+        root.sibling           = 0;
+        root.next              = 0;
+        _size                  = 1;
+    }
+
+    /** \brief Adds the path of n item ranks sorted in increasing order shared by count transactions */
+    services::Status insert(const size_t * items, size_t n, size_t count)
+    {
+        size_t node = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            const size_t item = items[i];
+            DAAL_ASSERT(item < _nItems);
+            size_t child = _nodes[node].child;
+            while (child && _nodes[child].item != item) child = _nodes[child].sibling;
+
+            if (!child)
+            {
+                if (_size == _capacity)
+                {
+                    services::Status s = reserve(2 * _capacity);
+                    DAAL_CHECK_STATUS_VAR(s);
+                }
+                child                     = _size++;
+                FPTreeNode<cpu> & newNode = _nodes[child];
+                newNode.item              = item;
+                newNode.count             = 0;
+                newNode.parent            = node;
+                newNode.child             = 0;
+                newNode.sibling           = _nodes[node].child;
+                newNode.next              = _head[item];
+                _nodes[node].child        = child;
+                _head[item]               = child;
+            }
+            _nodes[child].count += count;
+            _itemCount[item] += count;
+            node = child;
+        }
+        return services::Status();
+    }
+
+    bool empty() const { return _size < 2; }
+    size_t nItems() const { return _nItems; }
+    size_t head(size_t item) const { return _head[item]; }
+    size_t itemCount(size_t item) const { return _itemCount[item]; }
+    const FPTreeNode<cpu> & node(size_t i) const { return _nodes[i]; }
+
+private:
+    services::Status reserve(size_t capacity)
+    {
+        if (capacity <= _capacity) return services::Status();
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, capacity, sizeof(FPTreeNode<cpu>));
+        FPTreeNode<cpu> * nodes = (FPTreeNode<cpu> *)daal::services::daal_malloc(capacity * sizeof(FPTreeNode<cpu>));
+        DAAL_CHECK_MALLOC(nodes);
+        if (_size)
+        {
+            int result = daal::services::internal::daal_memcpy_s(nodes, capacity * sizeof(FPTreeNode<cpu>), _nodes, _size * sizeof(FPTreeNode<cpu>));
+            if (result)
+            {
+                daal::services::daal_free(nodes);
+                return services::Status(services::ErrorMemoryCopyFailedInternal);
+            }
+        }
+        daal::services::daal_free(_nodes);
+        _nodes    = nodes;
+        _capacity = capacity;
+        return services::Status();
+    }
+
+    FPTreeNode<cpu> * _nodes;
+    size_t _size;
+    size_t _capacity;
+    size_t _nItems;
+    daal::services::internal::TArray<size_t, cpu> _head;      /*<! First node of each item */
+    daal::services::internal::TArray<size_t, cpu> _itemCount; /*<! Number of transactions that contain each item */
+
+    FPTree(const FPTree &);
+    FPTree & operator=(const FPTree &);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -27,6 +27,7 @@
 #include "externals/service_math.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_memory.h"
+#include "algorithms/kernel/decision_tree/decision_tree_blocked_forest_impl.i"
 
 namespace daal
 {
@@ -40,6 +41,7 @@ namespace internal
 {
 using namespace daal::internal;
 using namespace daal::services::internal;
+using decision_tree::internal::BlockedForest;
 
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status BrownBoostPredictKernel<method, algorithmFPType, cpu>::computeImpl(const NumericTablePtr & xTable, const Model * m,
@@ -50,7 +52,28 @@ services::Status BrownBoostPredictKernel<method, algorithmFPType, cpu>::computeI
     const Model * boostModel    = const_cast<Model *>(m);
     const Parameter * parameter = const_cast<Parameter *>(par);
 
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+
     services::Status s;
+
+    /* Decision trees and stumps are compiled into the blocked forest and predict all together */
+    if (!BlockedForest<algorithmFPType, cpu>::hasUnorderedFeatures(*xTable))
+    {
+        bool bTrees = false;
+        BlockedForest<algorithmFPType, cpu> forest;
+        typedef decision_tree::classification::Model TreeModel;
+        typedef decision_tree::classification::DecisionTreeNode TreeNode;
+        DAAL_CHECK_STATUS(s, (forest.template convertWeakLearners<TreeModel, TreeNode>(*boostModel, nWeakLearners, bTrees)));
+        if (bTrees)
+        {
+            service_memset<algorithmFPType, cpu>(r, zero, nVectors);
+            return forest.predict(*xTable, [&](size_t iRow, size_t nRows, size_t iTree, const int * leaves) {
+                for (size_t j = 0; j < nRows; j++) r[iRow + j] += ((forest.getLeafValue(iTree, leaves[j]) > 0) ? one : -one) * alpha[iTree];
+            });
+        }
+    }
+
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > rWeakTable =
         daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, nVectors, &s);
     DAAL_CHECK_STATUS_VAR(s);
@@ -66,9 +89,6 @@ services::Status BrownBoostPredictKernel<method, algorithmFPType, cpu>::computeI
     predictionRes->set(classifier::prediction::prediction, rWeakTable);
     DAAL_CHECK_STATUS(s, learnerPredict->setResult(predictionRes));
 
-    const algorithmFPType zero = (algorithmFPType)0.0;
-    const algorithmFPType one  = (algorithmFPType)1.0;
-
     /* Initialize array of prediction results */
     service_memset<algorithmFPType, cpu>(r, zero, nVectors);
 
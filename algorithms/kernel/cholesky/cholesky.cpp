@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/cholesky/cholesky_types.h"
+#include "algorithms/kernel/cholesky/cholesky_batch.h"
 #include "service/kernel/serialization_utils.h"
 
 using namespace daal::data_management;
@@ -74,6 +75,13 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
 
     NumericTableIface::StorageLayout iLayout = inTable->getDataLayout();
 
+    if (method == batchedDense)
+    {
+        DAAL_CHECK(!((int)iLayout & data_management::packed_mask), ErrorIncorrectTypeOfInputNumericTable);
+        DAAL_CHECK(internal::getBatchedMatrixDim(inTable->getNumberOfColumns()), ErrorIncorrectSizeOfInputNumericTable);
+        return Status();
+    }
+
     DAAL_CHECK(inTable->getNumberOfColumns() == inTable->getNumberOfRows(), ErrorIncorrectSizeOfInputNumericTable);
 
     int iLayoutInt = (int)iLayout;
@@ -125,6 +133,15 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
 
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
 
+    if (method == batchedDense)
+    {
+        DAAL_CHECK(!((int)rLayout & data_management::packed_mask), ErrorIncorrectTypeOfOutputNumericTable);
+        DAAL_CHECK((resTable->getNumberOfColumns() == algInput->get(data)->getNumberOfColumns())
+                       && (resTable->getNumberOfRows() == algInput->get(data)->getNumberOfRows()),
+                   ErrorIncorrectSizeOfOutputNumericTable);
+        return Status();
+    }
+
     DAAL_CHECK((resTable->getNumberOfColumns() == algInput->get(data)->getNumberOfColumns())
                    && (resTable->getNumberOfColumns() == resTable->getNumberOfRows()),
                ErrorIncorrectSizeOfOutputNumericTable);
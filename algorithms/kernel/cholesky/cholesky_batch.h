@@ -24,6 +24,7 @@
 #define __CHOLESKY_BATCH__
 
 #include "algorithms/cholesky/cholesky_types.h"
+#include "data_management/data/symmetric_matrix.h"
 
 using namespace daal::data_management;
 namespace daal
@@ -32,6 +33,20 @@ namespace algorithms
 {
 namespace cholesky
 {
+namespace internal
+{
+/**
+ * Returns the dimension of the matrices stored in the rows of the table with nCols columns by the batchedDense method,
+ * 0 if nCols is not a square of an integer
+ */
+inline size_t getBatchedMatrixDim(size_t nCols)
+{
+    size_t dim = 0;
+    while ((dim + 1) * (dim + 1) <= nCols) dim++;
+    return (dim * dim == nCols) ? dim : 0;
+}
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -45,8 +60,20 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+    size_t nRows     = (method == batchedDense) ? algInput->get(data)->getNumberOfRows() : nFeatures;
     services::Status status;
-    set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &status));
+
+    /* The factor of the packed symmetric matrix is returned in the packed form, so that the matrix is never unpacked to the full storage */
+    const NumericTableIface::StorageLayout iLayout = algInput->get(data)->getDataLayout();
+    if (method == defaultDense
+        && (iLayout == NumericTableIface::lowerPackedSymmetricMatrix || iLayout == NumericTableIface::upperPackedSymmetricMatrix))
+    {
+        set(choleskyFactor,
+            PackedTriangularMatrix<NumericTableIface::lowerPackedTriangularMatrix, algFPType>::create(nFeatures, NumericTable::doAllocate, &status));
+        return status;
+    }
+
+    set(choleskyFactor, HomogenNumericTable<algFPType>::create(nFeatures, nRows, NumericTable::doAllocate, &status));
     return status;
 }
 
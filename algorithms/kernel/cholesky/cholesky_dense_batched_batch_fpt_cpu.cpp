@@ -0,0 +1,44 @@
+/* file: cholesky_dense_batched_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of cholesky calculation functions for the batched method.
+//--
+
+#include "algorithms/kernel/cholesky/cholesky_batch_container.h"
+#include "algorithms/kernel/cholesky/cholesky_kernel.h"
+#include "algorithms/kernel/cholesky/cholesky_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cholesky
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, batchedDense, DAAL_CPU>;
+} // namespace interface1
+
+namespace internal
+{
+template class CholeskyKernel<DAAL_FPTYPE, batchedDense, DAAL_CPU>;
+}
+
+} // namespace cholesky
+} // namespace algorithms
+} // namespace daal
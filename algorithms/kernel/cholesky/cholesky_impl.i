@@ -23,6 +23,8 @@
 
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_lapack.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/cholesky/cholesky_batch.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -44,6 +46,8 @@ bool isFull(NumericTableIface::StorageLayout rLayout);
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable * aTable, NumericTable * r, const daal::algorithms::Parameter * par)
 {
+    if (method == batchedDense) return computeBatched(aTable, r);
+
     const size_t dim = aTable->getNumberOfColumns(); /* Dimension of input feature vectors */
 
     const NumericTableIface::StorageLayout iLayout = aTable->getDataLayout();
@@ -82,6 +86,75 @@ Status CholeskyKernel<algorithmFPType, method, cpu>::compute(NumericTable * aTab
     return s.ok() ? performCholesky(rLayout, L, dim) : s;
 }
 
+/**
+ *  \brief Cholesky decomposition of the small matrices stored in the rows of the table.
+ *         Blocks of matrices are processed in parallel, each matrix is decomposed by the sequential LAPACK
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status CholeskyKernel<algorithmFPType, method, cpu>::computeBatched(NumericTable * aTable, NumericTable * r)
+{
+    const size_t nMatrices = aTable->getNumberOfRows();
+    const size_t nCols     = aTable->getNumberOfColumns();
+    const size_t dim       = getBatchedMatrixDim(nCols);
+    DAAL_CHECK(dim, ErrorIncorrectSizeOfInputNumericTable);
+
+    const size_t blockSizeDefault = (nCols < (1 << 14)) ? (1 << 14) / nCols : 1;
+    const size_t nBlocks          = nMatrices / blockSizeDefault + !!(nMatrices % blockSizeDefault);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSizeDefault;
+        const size_t nRows    = (startRow + blockSizeDefault > nMatrices) ? nMatrices - startRow : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> rowsA(*aTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(rowsA);
+        WriteOnlyRows<algorithmFPType, cpu> rowsR(*r, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(rowsR);
+        const algorithmFPType * A = rowsA.get();
+        algorithmFPType * L       = rowsR.get();
+
+        DAAL_INT info;
+        DAAL_INT dims = static_cast<DAAL_INT>(dim);
+        char uplo     = 'U';
+
+        for (size_t k = 0; k < nRows; k++)
+        {
+            const algorithmFPType * pA = A + k * nCols;
+            algorithmFPType * pL       = L + k * nCols;
+            for (size_t i = 0; i < dim; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j <= i; j++)
+                {
+                    pL[i * dim + j] = pA[i * dim + j];
+                }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = i + 1; j < dim; j++)
+                {
+                    pL[i * dim + j] = algorithmFPType(0);
+                }
+            }
+
+            Lapack<algorithmFPType, cpu>::xxpotrf(&uplo, &dims, pL, &dims, &info);
+            if (info > 0)
+            {
+                ErrorPtr e = Error::create(services::ErrorInputMatrixHasNonPositiveMinor, services::Minor, (int)info);
+                e->addIntDetail(services::Row, (int)(startRow + k));
+                safeStat.add(e);
+                return;
+            }
+            if (info < 0)
+            {
+                safeStat.add(services::ErrorCholeskyInternal);
+                return;
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status CholeskyKernel<algorithmFPType, method, cpu>::copyMatrix(NumericTableIface::StorageLayout iLayout, const algorithmFPType * pA,
                                                                 NumericTableIface::StorageLayout rLayout, algorithmFPType * pL, size_t dim) const
@@ -49,6 +49,7 @@ public:
     services::Status compute(NumericTable * a, NumericTable * r, const daal::algorithms::Parameter * par);
 
 private:
+    services::Status computeBatched(NumericTable * a, NumericTable * r);
     services::Status copyMatrix(NumericTableIface::StorageLayout iLayout, const algorithmFPType * pA, NumericTableIface::StorageLayout rLayout,
                                 algorithmFPType * pL, size_t dim) const;
     services::Status performCholesky(NumericTableIface::StorageLayout rLayout, algorithmFPType * pL, size_t dim);
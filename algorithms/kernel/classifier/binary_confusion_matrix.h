@@ -48,6 +48,11 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     services::Status st;
     set(confusionMatrix, data_management::HomogenNumericTable<algorithmFPType>::create(2, 2, data_management::NumericTableIface::doAllocate, &st));
     set(binaryMetrics, data_management::HomogenNumericTable<algorithmFPType>::create(6, 1, data_management::NumericTableIface::doAllocate, &st));
+    if (static_cast<const Input *>(input)->get(predictedScores))
+    {
+        set(rankingMetrics, data_management::HomogenNumericTable<algorithmFPType>::create(lastRankingMetricsId + 1, 1,
+                                                                                          data_management::NumericTableIface::doAllocate, &st));
+    }
     return st;
 }
 
@@ -57,13 +57,15 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter * parameter                 = static_cast<Parameter *>(_par);
     NumericTable * predictedLabelsTable   = static_cast<NumericTable *>(input->get(predictedLabels).get());
     NumericTable * groundTruthLabelsTable = static_cast<NumericTable *>(input->get(groundTruthLabels).get());
+    NumericTable * predictedScoresTable   = static_cast<NumericTable *>(input->get(predictedScores).get());
 
     NumericTable * confusionMatrixTable  = static_cast<NumericTable *>(result->get(confusionMatrix).get());
     NumericTable * accuracyMeasuresTable = static_cast<NumericTable *>(result->get(binaryMetrics).get());
+    NumericTable * rankingMeasuresTable  = static_cast<NumericTable *>(result->get(rankingMetrics).get());
 
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::BinaryConfusionMatrixKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, predictedLabelsTable,
-                       groundTruthLabelsTable, confusionMatrixTable, accuracyMeasuresTable, parameter);
+                       groundTruthLabelsTable, predictedScoresTable, confusionMatrixTable, accuracyMeasuresTable, rankingMeasuresTable, parameter);
 }
 
 } // namespace binary_confusion_matrix
@@ -26,6 +26,10 @@
 
 #include "externals/service_memory.h"
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -44,14 +48,12 @@ using namespace daal::services;
 using namespace daal::services::internal;
 
 template <Method method, typename algorithmFPType, CpuType cpu>
-services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(const NumericTable * predictedLabelsTable,
-                                                                                    const NumericTable * groundTruthLabelsTable,
-                                                                                    NumericTable * confusionMatrixTable,
-                                                                                    NumericTable * accuracyMeasuresTable,
-                                                                                    const binary_confusion_matrix::Parameter * parameter)
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::compute(
+    const NumericTable * predictedLabelsTable, const NumericTable * groundTruthLabelsTable, const NumericTable * predictedScoresTable,
+    NumericTable * confusionMatrixTable, NumericTable * accuracyMeasuresTable, NumericTable * rankingMeasuresTable,
+    const binary_confusion_matrix::Parameter * parameter)
 {
-    const algorithmFPType zero = 0.0;
-    const size_t nVectors      = predictedLabelsTable->getNumberOfRows();
+    const size_t nVectors = predictedLabelsTable->getNumberOfRows();
 
     /* Get input data */
     ReadColumns<algorithmFPType, cpu> mtPredictedLabels(*const_cast<NumericTable *>(predictedLabelsTable), 0, 0, nVectors);
@@ -73,17 +75,10 @@ services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::comp
 
     algorithmFPType beta  = parameter->beta;
     algorithmFPType beta2 = beta * beta;
-    service_memset<int, cpu>(confusionMatrixData, 0, nClasses * nClasses);
 
     /* Compute confusion matrix for two-class classifier */
-
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < nVectors; i++)
-    {
-        const int predictedLabel   = ((predictedLabelsData[i] > zero) ? 0 : 1);
-        const int groundTruthLabel = ((groundTruthLabelsData[i] > zero) ? 0 : 1);
-        ++confusionMatrixData[groundTruthLabel * 2 + predictedLabel];
-    }
+    Status s;
+    DAAL_CHECK_STATUS(s, computeConfusionMatrix(nVectors, predictedLabelsData, groundTruthLabelsData, confusionMatrixData));
 
     const algorithmFPType tp(confusionMatrixData[0]);
     const algorithmFPType fn(confusionMatrixData[1]);
@@ -103,6 +98,193 @@ services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::comp
     accuracyMeasuresData[4] = tn / (fp + tn);
     /* AUC (ability to avoid false classification) */
     accuracyMeasuresData[5] = 0.5 * (accuracyMeasuresData[2] + accuracyMeasuresData[4]);
+
+    if (predictedScoresTable && rankingMeasuresTable)
+    {
+        ReadColumns<algorithmFPType, cpu> mtPredictedScores(*const_cast<NumericTable *>(predictedScoresTable), 0, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS(mtPredictedScores);
+        WriteOnlyRows<algorithmFPType, cpu> mtRankingMeasures(rankingMeasuresTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtRankingMeasures);
+
+        DAAL_CHECK_STATUS(s, computeRankingMeasures(nVectors, groundTruthLabelsData, mtPredictedScores.get(), mtRankingMeasures.get()));
+    }
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::computeConfusionMatrix(size_t nVectors,
+                                                                                                   const algorithmFPType * predictedLabels,
+                                                                                                   const algorithmFPType * groundTruthLabels,
+                                                                                                   int * confusionMatrix)
+{
+    const algorithmFPType zero = 0.0;
+    const size_t nCells        = 4;
+    const size_t nBlocks       = nVectors / blockSize + !!(nVectors % blockSize);
+
+    SafeStatus safeStat;
+    daal::tls<int *> tlsCounts([=, &safeStat]() {
+        int * counts = service_scalable_calloc<int, cpu>(nCells);
+        if (!counts)
+        {
+            safeStat.add(ErrorMemoryAllocationFailed);
+        }
+        return counts;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+        int * counts = tlsCounts.local();
+        if (!counts) return;
+
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (begin + blockSize < nVectors) ? begin + blockSize : nVectors;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            const int predictedLabel   = ((predictedLabels[i] > zero) ? 0 : 1);
+            const int groundTruthLabel = ((groundTruthLabels[i] > zero) ? 0 : 1);
+            ++counts[groundTruthLabel * 2 + predictedLabel];
+        }
+    });
+
+    service_memset<int, cpu>(confusionMatrix, 0, nCells);
+    tlsCounts.reduce([=](int * counts) {
+        if (!counts) return;
+        for (size_t k = 0; k < nCells; k++)
+        {
+            confusionMatrix[k] += counts[k];
+        }
+        service_scalable_free<int, cpu>(counts);
+    });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::computeRankingMeasures(size_t nVectors,
+                                                                                                   const algorithmFPType * groundTruthLabels,
+                                                                                                   const algorithmFPType * predictedScores,
+                                                                                                   algorithmFPType * rankingMeasures)
+{
+    const algorithmFPType zero = 0.0;
+    const size_t nBlocks       = nVectors / blockSize + !!(nVectors % blockSize);
+
+    TArray<algorithmFPType, cpu> scoresArray(nVectors);
+    TArray<int, cpu> labelsArray(nVectors);
+    DAAL_CHECK_MALLOC(scoresArray.get() && labelsArray.get());
+    algorithmFPType * scores = scoresArray.get();
+    int * labels             = labelsArray.get();
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (begin + blockSize < nVectors) ? begin + blockSize : nVectors;
+
+        for (size_t i = begin; i < end; i++)
+        {
+            scores[i] = predictedScores[i];
+            labels[i] = ((groundTruthLabels[i] > zero) ? 1 : 0);
+        }
+    });
+
+    Status s;
+    DAAL_CHECK_STATUS(s, sortScores(nVectors, scores, labels));
+
+    /* Sweep the thresholds from the highest score down, the observations with equal scores form one step of both curves */
+    algorithmFPType tp       = zero;
+    algorithmFPType fp       = zero;
+    algorithmFPType rocArea  = zero;
+    algorithmFPType precArea = zero;
+    for (size_t i = nVectors; i > 0;)
+    {
+        const algorithmFPType threshold = scores[i - 1];
+        algorithmFPType stepTp          = zero;
+        algorithmFPType stepFp          = zero;
+        do
+        {
+            --i;
+            if (labels[i])
+            {
+                stepTp += 1.0;
+            }
+            else
+            {
+                stepFp += 1.0;
+            }
+        } while (i > 0 && scores[i - 1] == threshold);
+
+        /* Trapezoid under the ROC curve, the diagonal step accounts for the ties */
+        rocArea += stepFp * (tp + 0.5 * stepTp);
+        tp += stepTp;
+        fp += stepFp;
+        /* Precision at the threshold weighted by the increase of the recall */
+        precArea += stepTp * tp / (tp + fp);
+    }
+
+    rankingMeasures[rocAUC] = rocArea / (tp * fp);
+    rankingMeasures[prAUC]  = precArea / tp;
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status BinaryConfusionMatrixKernel<method, algorithmFPType, cpu>::sortScores(size_t nVectors, algorithmFPType * scores, int * labels)
+{
+    const size_t nBlocks = nVectors / blockSize + !!(nVectors % blockSize);
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (begin + blockSize < nVectors) ? begin + blockSize : nVectors;
+        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(end - begin, scores + begin, labels + begin);
+    });
+    if (nBlocks < 2) return Status();
+
+    TArray<algorithmFPType, cpu> scoresBuffer(nVectors);
+    TArray<int, cpu> labelsBuffer(nVectors);
+    DAAL_CHECK_MALLOC(scoresBuffer.get() && labelsBuffer.get());
+
+    algorithmFPType * srcScores = scores;
+    int * srcLabels             = labels;
+    algorithmFPType * dstScores = scoresBuffer.get();
+    int * dstLabels             = labelsBuffer.get();
+
+    for (size_t width = blockSize; width < nVectors; width *= 2)
+    {
+        const size_t nPairs = nVectors / (2 * width) + !!(nVectors % (2 * width));
+
+        daal::threader_for(nPairs, nPairs, [&](int iPair) {
+            const size_t begin  = iPair * 2 * width;
+            const size_t middle = (begin + width < nVectors) ? begin + width : nVectors;
+            const size_t end    = (middle + width < nVectors) ? middle + width : nVectors;
+
+            size_t left = begin, right = middle, k = begin;
+            for (; left < middle && right < end; k++)
+            {
+                const size_t from = (srcScores[right] < srcScores[left]) ? right++ : left++;
+                dstScores[k]      = srcScores[from];
+                dstLabels[k]      = srcLabels[from];
+            }
+            for (; left < middle; left++, k++)
+            {
+                dstScores[k] = srcScores[left];
+                dstLabels[k] = srcLabels[left];
+            }
+            for (; right < end; right++, k++)
+            {
+                dstScores[k] = srcScores[right];
+                dstLabels[k] = srcLabels[right];
+            }
+        });
+
+        algorithmFPType * tmpScores = srcScores;
+        int * tmpLabels             = srcLabels;
+        srcScores                   = dstScores;
+        srcLabels                   = dstLabels;
+        dstScores                   = tmpScores;
+        dstLabels                   = tmpLabels;
+    }
+
+    if (srcScores != scores)
+    {
+        daal::services::internal::daal_memcpy_s(scores, nVectors * sizeof(algorithmFPType), srcScores, nVectors * sizeof(algorithmFPType));
+        daal::services::internal::daal_memcpy_s(labels, nVectors * sizeof(int), srcLabels, nVectors * sizeof(int));
+    }
     return Status();
 }
 
@@ -48,8 +48,23 @@ class BinaryConfusionMatrixKernel : public Kernel
 public:
     virtual ~BinaryConfusionMatrixKernel() {}
 
-    services::Status compute(const NumericTable * predictedLabels, const NumericTable * groundTruthLabels, NumericTable * confusionMatrix,
-                             NumericTable * accuracyMeasures, const binary_confusion_matrix::Parameter * parameter);
+    services::Status compute(const NumericTable * predictedLabels, const NumericTable * groundTruthLabels, const NumericTable * predictedScores,
+                             NumericTable * confusionMatrix, NumericTable * accuracyMeasures, NumericTable * rankingMeasures,
+                             const binary_confusion_matrix::Parameter * parameter);
+
+private:
+    /* Number of observations processed by one thread at a time */
+    static const size_t blockSize = 1024;
+
+    services::Status computeConfusionMatrix(size_t nVectors, const algorithmFPType * predictedLabels, const algorithmFPType * groundTruthLabels,
+                                            int * confusionMatrix);
+
+    /* Computes the areas under the ROC and precision-recall curves in the same pass over the scores sorted in parallel */
+    services::Status computeRankingMeasures(size_t nVectors, const algorithmFPType * groundTruthLabels, const algorithmFPType * predictedScores,
+                                            algorithmFPType * rankingMeasures);
+
+    /* Sorts the scores in ascending order together with the labels: the blocks are sorted in parallel and then merged pairwise */
+    services::Status sortScores(size_t nVectors, algorithmFPType * scores, int * labels);
 };
 
 } // namespace internal
@@ -86,7 +86,14 @@ Status Input::check(const daal::algorithms::Parameter * parameter, int method) c
     DAAL_CHECK_STATUS(s, checkNumericTable(predictedLabelsTable.get(), predictedLabelsStr(), unexpectedLayouts, 0, 1));
 
     const size_t nRows = predictedLabelsTable->getNumberOfRows();
-    return checkNumericTable(groundTruthLabelsTable.get(), groundTruthLabelsStr(), unexpectedLayouts, 0, 1, nRows);
+    DAAL_CHECK_STATUS(s, checkNumericTable(groundTruthLabelsTable.get(), groundTruthLabelsStr(), unexpectedLayouts, 0, 1, nRows));
+
+    NumericTablePtr predictedScoresTable = get(predictedScores);
+    if (predictedScoresTable)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(predictedScoresTable.get(), predictedScoresStr(), unexpectedLayouts, 0, 1, nRows));
+    }
+    return s;
 }
 
 Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
@@ -124,7 +131,14 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     NumericTablePtr binaryMetricsTable   = get(binaryMetrics);
     const int unexpectedLayouts          = (int)packed_mask;
     DAAL_CHECK_STATUS(s, checkNumericTable(confusionMatrixTable.get(), confusionMatrixStr(), unexpectedLayouts, 0, 2, 2));
-    return checkNumericTable(binaryMetricsTable.get(), binaryMetricsStr(), unexpectedLayouts, 0, 6, 1);
+    DAAL_CHECK_STATUS(s, checkNumericTable(binaryMetricsTable.get(), binaryMetricsStr(), unexpectedLayouts, 0, 6, 1));
+
+    const Input * in = static_cast<const Input *>(input);
+    if (in->get(predictedScores))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(rankingMetrics).get(), rankingMetricsStr(), unexpectedLayouts, 0, lastRankingMetricsId + 1, 1));
+    }
+    return s;
 }
 
 } // namespace interface1
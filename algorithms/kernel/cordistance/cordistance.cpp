@@ -37,6 +37,19 @@ namespace correlation_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_CORRELATION_DISTANCE_RESULT_ID);
+Parameter::Parameter(ResultFormat resultFormat, double maxDistance, size_t k)
+    : daal::algorithms::Parameter(), resultFormat(resultFormat), maxDistance(maxDistance), k(k)
+{}
+
+/**
+ * Checks the parameters of the correlation distance algorithm
+ */
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(maxDistance >= 0.0, ErrorIncorrectParameter, ParameterName, maxDistanceStr());
+    return services::Status();
+}
+
 Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 
 /**
@@ -66,6 +79,12 @@ void Input::set(InputId id, const data_management::NumericTablePtr & ptr)
 */
 services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
 {
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    if (method == fastCSR)
+    {
+        return data_management::checkNumericTable(get(data).get(), dataStr(), 0, (int)data_management::NumericTableIface::csrArray);
+    }
+    DAAL_CHECK(!algParameter || algParameter->resultFormat == denseResult, ErrorMethodNotSupported);
     return data_management::checkNumericTable(get(data).get(), dataStr());
 }
 
@@ -101,7 +120,16 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 {
     const Input * algInput = static_cast<const Input *>(input);
 
-    size_t nVectors       = algInput->get(data)->getNumberOfRows();
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+
+    size_t nVectors = algInput->get(data)->getNumberOfRows();
+    if (algParameter && algParameter->resultFormat == sparseResult)
+    {
+        /* Memory for the sparse result is allocated by the kernel when the number of the stored distances is known */
+        return data_management::checkNumericTable(get(correlationDistance).get(), correlationDistanceStr(), 0,
+                                                  (int)data_management::NumericTableIface::csrArray, nVectors, nVectors, false);
+    }
+
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray | (int)data_management::NumericTableIface::upperPackedTriangularMatrix
                             | (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
 
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/distance/correlation_distance_types.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -42,6 +43,20 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t dim       = algInput->get(data)->getNumberOfRows();
+
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    if (algParameter && algParameter->resultFormat == sparseResult)
+    {
+        /* Memory for the values is allocated by the kernel when the number of the stored distances is known */
+        services::Status s;
+        data_management::CSRNumericTablePtr distances = data_management::CSRNumericTable::create<algorithmFPType>(
+            services::SharedPtr<algorithmFPType>(), services::SharedPtr<size_t>(), services::SharedPtr<size_t>(), dim, dim,
+            data_management::CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        Argument::set(correlationDistance, distances);
+        return s;
+    }
+
     Argument::set(correlationDistance,
                   data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
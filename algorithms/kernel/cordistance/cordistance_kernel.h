@@ -46,6 +46,14 @@ public:
                              const daal::algorithms::Parameter * par);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class DistanceKernel<algorithmFPType, fastCSR, cpu> : public Kernel
+{
+public:
+    services::Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[],
+                             const daal::algorithms::Parameter * par);
+};
+
 } // namespace internal
 
 } // namespace correlation_distance
@@ -58,8 +58,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     size_t na = input->size();
     size_t nr = result->size();
 
-    NumericTable * a0                      = static_cast<NumericTable *>(input->get(data).get());
-    NumericTable ** a                      = &a0;
+    NumericTable * a[lastInputId + 1]      = { input->get(data).get(), input->get(referenceData).get() };
     NumericTable * r0                      = static_cast<NumericTable *>(result->get(cosineDistance).get());
     NumericTable ** r                      = &r0;
     daal::algorithms::Parameter * par      = _par;
@@ -32,6 +32,7 @@ static const int blockSizeDefault = 128;
 #include "algorithms/kernel/cosdistance/cosdistance_full_impl.i"
 #include "algorithms/kernel/cosdistance/cosdistance_up_impl.i"
 #include "algorithms/kernel/cosdistance/cosdistance_lp_impl.i"
+#include "algorithms/kernel/cosdistance/cosdistance_reference_impl.i"
 
 using namespace daal::internal;
 
@@ -61,6 +62,11 @@ services::Status DistanceKernel<algorithmFPType, method, cpu>::compute(const siz
     NumericTable * rTable                          = const_cast<NumericTable *>(r[0]); /* Output data */
     const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
 
+    if (na > 1 && a[1])
+    {
+        return cosDistanceWithReference<algorithmFPType, cpu>(xTable, a[1], rTable);
+    }
+
     if (isFull<algorithmFPType, cpu>(rLayout))
     {
         return cosDistanceFull<algorithmFPType, cpu>(xTable, rTable);
@@ -0,0 +1,57 @@
+/* file: cosdistance_csr_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cosine distance for the data in the CSR format.
+//--
+*/
+
+#include "algorithms/kernel/service_csr_distance.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cosine_distance
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+services::Status DistanceKernel<algorithmFPType, fastCSR, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                       NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    DAAL_CHECK(na < 2 || !a[1], services::ErrorMethodNotSupported);
+
+    Parameter defaultParameter;
+    const Parameter * distancePar = par ? static_cast<const Parameter *>(par) : &defaultParameter;
+
+    daal::algorithms::internal::CSRDistances<algorithmFPType, cpu> distances(false);
+    services::Status s = distances.init(a[0]);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    if (distancePar->resultFormat == sparseResult)
+    {
+        return distances.computeSparse(r[0], algorithmFPType(distancePar->maxDistance), distancePar->k);
+    }
+    return distances.computeDense(r[0]);
+}
+
+} // namespace internal
+} // namespace cosine_distance
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,49 @@
+/* file: cosdistance_fast_csr_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cosine distance calculation functions.
+//--
+*/
+
+#include "algorithms/kernel/cosdistance/cosdistance_batch_container.h"
+#include "algorithms/kernel/cosdistance/cosdistance_kernel.h"
+#include "algorithms/kernel/cosdistance/cosdistance_csr_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cosine_distance
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, fastCSR, DAAL_CPU>;
+
+}
+namespace internal
+{
+template class DistanceKernel<DAAL_FPTYPE, fastCSR, DAAL_CPU>;
+
+} // namespace internal
+
+} // namespace cosine_distance
+
+} // namespace algorithms
+
+} // namespace daal
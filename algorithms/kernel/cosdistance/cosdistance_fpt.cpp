@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/distance/cosine_distance_types.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -42,6 +43,30 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
 {
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t dim       = algInput->get(data)->getNumberOfRows();
+
+    services::Status s;
+
+    data_management::NumericTablePtr referenceTable = algInput->get(referenceData);
+    if (referenceTable)
+    {
+        /* Row i of the result contains the distances from the i-th vector of data to all reference vectors */
+        Argument::set(cosineDistance, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                          referenceTable->getNumberOfRows(), dim, data_management::NumericTable::doAllocate, &s));
+        return s;
+    }
+
+    const Parameter * algParameter = static_cast<const Parameter *>(par);
+    if (algParameter && algParameter->resultFormat == sparseResult)
+    {
+        /* Memory for the values is allocated by the kernel when the number of the stored distances is known */
+        data_management::CSRNumericTablePtr distances = data_management::CSRNumericTable::create<algorithmFPType>(
+            services::SharedPtr<algorithmFPType>(), services::SharedPtr<size_t>(), services::SharedPtr<size_t>(), dim, dim,
+            data_management::CSRNumericTableIface::oneBased, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        Argument::set(cosineDistance, distances);
+        return s;
+    }
+
     Argument::set(cosineDistance,
                   data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
@@ -0,0 +1,154 @@
+/* file: cosdistance_reference_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cosine distance between the query and the reference vectors.
+//--
+*/
+#include "service/kernel/service_defines.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cosine_distance
+{
+namespace internal
+{
+/* Computes the inverse norms of the rows of the table, zero rows get zero inverse norms */
+template <typename algorithmFPType, CpuType cpu>
+services::Status cosDistanceInverseNorms(const NumericTable * xTable, algorithmFPType * invNorms)
+{
+    const size_t p = xTable->getNumberOfColumns();
+    const size_t n = xTable->getNumberOfRows();
+
+    size_t nBlocks = n / blockSizeDefault;
+    nBlocks += (nBlocks * blockSizeDefault != n);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](size_t k1) {
+        const size_t shift1     = k1 * blockSizeDefault;
+        const size_t blockSize1 = (k1 == nBlocks - 1) ? n - shift1 : blockSizeDefault;
+
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType * x = xBlock.get();
+
+        for (size_t i = 0; i < blockSize1; i++)
+        {
+            algorithmFPType s = (algorithmFPType)0.0;
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                s += x[i * p + j] * x[i * p + j];
+            }
+            invNorms[shift1 + i] = (s > (algorithmFPType)0.0) ? (algorithmFPType)1.0 / daal::internal::Math<algorithmFPType, cpu>::sSqrt(s) :
+                                                                (algorithmFPType)0.0;
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  \brief Computes the distances between the rows of xTable and the rows of yTable into the rows of rTable.
+ *         The norms of all rows are computed once, the products are computed by GEMM on the tiles of blockSizeDefault query rows
+ *         and blockSizeDefault reference rows. The result is written block by block of the query rows
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status cosDistanceWithReference(const NumericTable * xTable, const NumericTable * yTable, NumericTable * rTable)
+{
+    const size_t p  = xTable->getNumberOfColumns(); /* Dimension of input feature vector */
+    const size_t nx = xTable->getNumberOfRows();    /* Number of query feature vectors     */
+    const size_t ny = yTable->getNumberOfRows();    /* Number of reference feature vectors */
+
+    DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, nx, ny);
+    TArray<algorithmFPType, cpu> invNormsArr(nx + ny);
+    algorithmFPType * invNormsX = invNormsArr.get();
+    DAAL_CHECK_MALLOC(invNormsX);
+    algorithmFPType * invNormsY = invNormsX + nx;
+
+    services::Status s = cosDistanceInverseNorms<algorithmFPType, cpu>(xTable, invNormsX);
+    DAAL_CHECK_STATUS_VAR(s);
+    s = cosDistanceInverseNorms<algorithmFPType, cpu>(yTable, invNormsY);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    size_t nBlocksX = nx / blockSizeDefault;
+    nBlocksX += (nBlocksX * blockSizeDefault != nx);
+    size_t nBlocksY = ny / blockSizeDefault;
+    nBlocksY += (nBlocksY * blockSizeDefault != ny);
+
+    SafeStatus safeStat;
+
+    daal::threader_for(nBlocksX, nBlocksX, [=, &safeStat](size_t k1) {
+        const size_t shift1       = k1 * blockSizeDefault;
+        const DAAL_INT blockSize1 = (k1 == nBlocksX - 1) ? nx - shift1 : blockSizeDefault;
+
+        /* read access to blockSize1 query rows at shift1 row */
+        ReadRows<algorithmFPType, cpu> xBlock(*const_cast<NumericTable *>(xTable), shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBlock)
+        const algorithmFPType * x = xBlock.get();
+
+        /* write access to blockSize1 rows in output dataset at shift1 row */
+        WriteOnlyRows<algorithmFPType, cpu> rBlock(rTable, shift1, blockSize1);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock)
+        algorithmFPType * r = rBlock.get();
+
+        daal::threader_for(nBlocksY, nBlocksY, [=, &safeStat](size_t k2) {
+            const size_t shift2       = k2 * blockSizeDefault;
+            const DAAL_INT blockSize2 = (k2 == nBlocksY - 1) ? ny - shift2 : blockSizeDefault;
+
+            /* read access to blockSize2 reference rows at shift2 row */
+            ReadRows<algorithmFPType, cpu> yBlock(*const_cast<NumericTable *>(yTable), shift2, blockSize2);
+            DAAL_CHECK_BLOCK_STATUS_THR(yBlock)
+            const algorithmFPType * y = yBlock.get();
+
+            /* buf[i * blockSize2 + j] = x_i * y_j^T */
+            algorithmFPType buf[blockSizeDefault * blockSizeDefault];
+            algorithmFPType alpha = 1.0, beta = 0.0;
+            char transa = 'T', transb = 'N';
+            DAAL_INT m = blockSize2, k = p, nn = blockSize1;
+            DAAL_INT lda = k, ldb = p, ldc = m;
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, y, &lda, x, &ldb, &beta, buf, &ldc);
+
+            const algorithmFPType * invX = invNormsX + shift1;
+            const algorithmFPType * invY = invNormsY + shift2;
+            for (size_t i = 0; i < blockSize1; i++)
+            {
+                algorithmFPType * rr = r + i * ny + shift2;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < blockSize2; j++)
+                {
+                    rr[j] = 1.0 - buf[i * blockSize2 + j] * invX[i] * invY[j];
+                }
+            }
+        });
+    });
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+
+} // namespace cosine_distance
+
+} // namespace algorithms
+
+} // namespace daal
@@ -186,6 +186,9 @@
         NumericTable * crossProductTable = partialResult->get(crossProduct).get();                                                            \
         NumericTable * sumTable          = partialResult->get(sum).get();                                                                     \
                                                                                                                                               \
+        NumericTable * coalescedRowsTable  = partialResult->get(coalescedRows).get();                                                         \
+        NumericTable * nCoalescedRowsTable = partialResult->get(nCoalescedRows).get();                                                        \
+                                                                                                                                              \
         Parameter * parameter                  = static_cast<Parameter *>(_par);                                                              \
         daal::services::Environment::env & env = *_env;                                                                                       \
                                                                                                                                               \
@@ -195,10 +198,14 @@
         if (deviceInfo.isCpu)                                                                                                                 \
         {                                                                                                                                     \
             __DAAL_CALL_KERNEL(env, KernelClass, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod), compute, dataTable, nObsTable,      \
-                               crossProductTable, sumTable, parameter);                                                                       \
+                               crossProductTable, sumTable, parameter, coalescedRowsTable, nCoalescedRowsTable);                              \
         }                                                                                                                                     \
         else                                                                                                                                  \
         {                                                                                                                                     \
+            if (static_cast<OnlineParameter *>(parameter)->forgettingFactor < 1.0)                                                            \
+            {                                                                                                                                 \
+                return services::Status(services::ErrorMethodNotImplemented);                                                                 \
+            }                                                                                                                                 \
             __DAAL_CALL_KERNEL_SYCL(env, oneapi::__DAAL_CONCAT(KernelClass, OneAPI), __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod), \
                                     compute, dataTable, nObsTable, crossProductTable, sumTable, parameter);                                   \
         }                                                                                                                                     \
@@ -238,6 +245,9 @@
         NumericTable * crossProductTable = partialResult->get(crossProduct).get();                                                            \
         NumericTable * sumTable          = partialResult->get(sum).get();                                                                     \
                                                                                                                                               \
+        NumericTable * coalescedRowsTable  = partialResult->get(coalescedRows).get();                                                         \
+        NumericTable * nCoalescedRowsTable = partialResult->get(nCoalescedRows).get();                                                        \
+                                                                                                                                              \
         NumericTable * covTable  = result->get(covariance).get();                                                                             \
         NumericTable * meanTable = result->get(mean).get();                                                                                   \
                                                                                                                                               \
@@ -250,7 +260,7 @@
         if (deviceInfo.isCpu)                                                                                                                 \
         {                                                                                                                                     \
             __DAAL_CALL_KERNEL(env, KernelClass, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod), finalizeCompute, nObsTable,         \
-                               crossProductTable, sumTable, covTable, meanTable, parameter);                                                  \
+                               crossProductTable, sumTable, covTable, meanTable, parameter, coalescedRowsTable, nCoalescedRowsTable);         \
         }                                                                                                                                     \
         else                                                                                                                                  \
         {                                                                                                                                     \
@@ -268,9 +278,9 @@ namespace covariance
 __DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR_ONEAPI(defaultDense, internal::CovarianceDenseBatchKernel)
 __DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR(singlePassDense, internal::CovarianceDenseBatchKernel)
 __DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR(sumDense, internal::CovarianceDenseBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR(fastCSR, internal::CovarianceCSRBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR(singlePassCSR, internal::CovarianceCSRBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR(sumCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR_ONEAPI(fastCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR_ONEAPI(singlePassCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_CONSTRUCTOR_ONEAPI(sumCSR, internal::CovarianceCSRBatchKernel)
 
 __DAAL_COVARIANCE_BATCH_CONTAINER_DESTRUCTOR(defaultDense)
 __DAAL_COVARIANCE_BATCH_CONTAINER_DESTRUCTOR(singlePassDense)
@@ -282,9 +292,9 @@ __DAAL_COVARIANCE_BATCH_CONTAINER_DESTRUCTOR(sumCSR)
 __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE_ONEAPI(defaultDense, internal::CovarianceDenseBatchKernel)
 __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(singlePassDense, internal::CovarianceDenseBatchKernel)
 __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(sumDense, internal::CovarianceDenseBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(fastCSR, internal::CovarianceCSRBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(singlePassCSR, internal::CovarianceCSRBatchKernel)
-__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(sumCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE_ONEAPI(fastCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE_ONEAPI(singlePassCSR, internal::CovarianceCSRBatchKernel)
+__DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE_ONEAPI(sumCSR, internal::CovarianceCSRBatchKernel)
 
 __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR_ONEAPI(defaultDense, internal::CovarianceDenseOnlineKernel)
 __DAAL_COVARIANCE_ONLINE_CONTAINER_CONSTRUCTOR(singlePassDense, internal::CovarianceDenseOnlineKernel)
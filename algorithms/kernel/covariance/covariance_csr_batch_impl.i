@@ -45,7 +45,7 @@ services::Status CovarianceCSRBatchKernel<algorithmFPType, method, cpu>::compute
     const size_t nVectors               = dataTable->getNumberOfRows();
     CSRNumericTableIface * csrDataTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
 
-    DEFINE_TABLE_BLOCK_EX(ReadRowsCSR, dataBlock, csrDataTable, 0, nVectors);
+    DEFINE_TABLE_BLOCK_EX(ReadRowsCSRNative, dataBlock, csrDataTable, 0, nVectors);
     DEFINE_TABLE_BLOCK(WriteOnlyRows, sumBlock, meanTable);
     DEFINE_TABLE_BLOCK(WriteOnlyRows, crossProductBlock, covTable);
 
@@ -64,7 +64,7 @@ services::Status CovarianceCSRBatchKernel<algorithmFPType, method, cpu>::compute
     DAAL_CHECK_STATUS_VAR(status);
 
     status |= updateCSRCrossProductAndSums<algorithmFPType, method, cpu>(nFeatures, nVectors, data, colIndices, rowOffsets, crossProduct, sums,
-                                                                         &nObservations);
+                                                                         &nObservations, dataBlock.indexBase());
     DAAL_CHECK_STATUS_VAR(status);
 
     const algorithmFPType invNRows = 1.0 / (algorithmFPType)nVectors;
@@ -38,7 +38,7 @@ namespace internal
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status computeSumCSR(size_t nFeatures, size_t nVectors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                algorithmFPType * crossProduct, algorithmFPType * partialCrossProduct, algorithmFPType * sums,
-                               algorithmFPType * nObservations)
+                               algorithmFPType * nObservations, size_t indexBase)
 {
     algorithmFPType invNObservations = 1.0;
     if (nObservations[0] > 0.5)
@@ -54,7 +54,7 @@ services::Status computeSumCSR(size_t nFeatures, size_t nVectors, algorithmFPTyp
     }
 
     services::Status status = updateCSRCrossProductAndSums<algorithmFPType, method, cpu>(nFeatures, nVectors, data, colIndices, rowOffsets,
-                                                                                         partialCrossProduct, sums, nObservations);
+                                                                                         partialCrossProduct, sums, nObservations, indexBase);
     DAAL_CHECK_STATUS_VAR(status);
 
     invNObservations = 1.0 / nObservations[0];
@@ -76,12 +76,13 @@ services::Status computeSumCSR(size_t nFeatures, size_t nVectors, algorithmFPTyp
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status computeOtherMethods(size_t nFeatures, size_t nVectors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * crossProduct, algorithmFPType * partialCrossProduct, algorithmFPType * sums,
-                                     algorithmFPType * partialSums, algorithmFPType * nObservations)
+                                     algorithmFPType * partialSums, algorithmFPType * nObservations, size_t indexBase)
 {
     algorithmFPType partialNObservations = 0.0;
 
     services::Status status = updateCSRCrossProductAndSums<algorithmFPType, method, cpu>(nFeatures, nVectors, data, colIndices, rowOffsets,
-                                                                                         partialCrossProduct, partialSums, &partialNObservations);
+                                                                                         partialCrossProduct, partialSums, &partialNObservations,
+                                                                                         indexBase);
     DAAL_CHECK_STATUS_VAR(status);
 
     algorithmFPType invPartialNObservations = 1.0 / partialNObservations;
@@ -106,11 +107,18 @@ services::Status CovarianceCSROnlineKernel<algorithmFPType, method, cpu>::comput
                                                                                   NumericTable * crossProductTable, NumericTable * sumTable,
                                                                                   const Parameter * parameter)
 {
+    const OnlineParameter * onlineParameter = static_cast<const OnlineParameter *>(parameter);
+    if (onlineParameter->forgettingFactor < 1.0)
+    {
+        return updateDecayedCrossProductAndSums<algorithmFPType, cpu>(dataTable, (algorithmFPType)onlineParameter->forgettingFactor,
+                                                                      nObservationsTable, crossProductTable, sumTable);
+    }
+
     const size_t nFeatures              = dataTable->getNumberOfColumns();
     const size_t nVectors               = dataTable->getNumberOfRows();
     CSRNumericTableIface * csrDataTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
 
-    DEFINE_TABLE_BLOCK_EX(ReadRowsCSR, dataBlock, csrDataTable, 0, nVectors);
+    DEFINE_TABLE_BLOCK_EX(ReadRowsCSRNative, dataBlock, csrDataTable, 0, nVectors);
     DEFINE_TABLE_BLOCK(WriteRows, sumBlock, sumTable);
     DEFINE_TABLE_BLOCK(WriteRows, crossProductBlock, crossProductTable);
     DEFINE_TABLE_BLOCK(WriteRows, nObservationsBlock, nObservationsTable);
@@ -132,7 +140,7 @@ services::Status CovarianceCSROnlineKernel<algorithmFPType, method, cpu>::comput
     if (method != sumCSR)
     {
         return computeSumCSR<algorithmFPType, method, cpu>(nFeatures, nVectors, data, colIndices, rowOffsets, crossProduct, partialCrossProduct, sums,
-                                                           nObservations);
+                                                           nObservations, dataBlock.indexBase());
     }
     else
     {
@@ -141,7 +149,7 @@ services::Status CovarianceCSROnlineKernel<algorithmFPType, method, cpu>::comput
         algorithmFPType * partialSums = const_cast<algorithmFPType *>(userSumsBlock.get());
 
         return computeOtherMethods<algorithmFPType, method, cpu>(nFeatures, nVectors, data, colIndices, rowOffsets, crossProduct, partialCrossProduct,
-                                                                 sums, partialSums, nObservations);
+                                                                 sums, partialSums, nObservations, dataBlock.indexBase());
     }
 }
 
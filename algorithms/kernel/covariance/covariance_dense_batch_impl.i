@@ -63,8 +63,19 @@ services::Status CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compu
     status |= prepareCrossProduct<algorithmFPType, cpu>(nFeatures, crossProduct);
     DAAL_CHECK_STATUS_VAR(status);
 
-    status |= updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, dataTable, crossProduct, sums,
-                                                                           &nObservations);
+    /* The double accumulation applies to the single precision data of the methods based on syrk */
+    const bool accumulateInDouble = (parameter->accumulationPrecision == doublePrecision) && (sizeof(algorithmFPType) < sizeof(double))
+                                    && (isNormalized || method == defaultDense || method == sumDense);
+    if (accumulateInDouble)
+    {
+        status |= updateDenseCrossProductAndSumsInDouble<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, dataTable, crossProduct,
+                                                                                       sums, &nObservations);
+    }
+    else
+    {
+        status |= updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, dataTable, crossProduct, sums,
+                                                                               &nObservations);
+    }
     DAAL_CHECK_STATUS_VAR(status);
 
     status |= finalizeCovariance<algorithmFPType, cpu>(nFeatures, nObservations, crossProduct, sums, crossProduct, sums, parameter);
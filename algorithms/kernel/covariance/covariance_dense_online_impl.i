@@ -58,15 +58,75 @@ services::Status prepareSums(NumericTable * dataTable, const bool isNormalized,
     return services::Status();
 }
 
+/* Copies the rows of the small data block into the coalescing buffer of the partial results,
+ * the rows already in the buffer are merged into the cross-product and sums first if the block does not fit */
+template <typename algorithmFPType, CpuType cpu>
+services::Status coalesceBlock(NumericTable * dataTable, NumericTable * coalescedRowsTable, NumericTable * nCoalescedRowsTable,
+                               NumericTable * nObservationsTable, NumericTable * crossProductTable, NumericTable * sumTable)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    DAAL_CHECK(coalescedRowsTable->getNumberOfColumns() == nFeatures, services::ErrorIncorrectNumberOfFeatures);
+
+    services::Status status;
+    size_t nBufferedRows = 0;
+    {
+        ReadRows<algorithmFPType, cpu> nCoalescedRowsBlock(nCoalescedRowsTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(nCoalescedRowsBlock);
+        nBufferedRows = (size_t)nCoalescedRowsBlock.get()[0];
+    }
+
+    if (nBufferedRows + nVectors > coalescedRowsTable->getNumberOfRows())
+    {
+        DEFINE_TABLE_BLOCK(WriteRows, sumBlock, sumTable);
+        DEFINE_TABLE_BLOCK(WriteRows, crossProductBlock, crossProductTable);
+        DEFINE_TABLE_BLOCK(WriteRows, nObservationsBlock, nObservationsTable);
+
+        DAAL_CHECK_STATUS(status, (mergeCoalescedRows<algorithmFPType, cpu>(coalescedRowsTable, nBufferedRows, crossProductBlock.get(),
+                                                                            sumBlock.get(), nObservationsBlock.get())));
+        nBufferedRows = 0;
+    }
+
+    ReadRows<algorithmFPType, cpu> dataRows(dataTable, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+    WriteOnlyRows<algorithmFPType, cpu> bufferRows(coalescedRowsTable, nBufferedRows, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(bufferRows);
+
+    const size_t blockSize = nVectors * nFeatures * sizeof(algorithmFPType);
+    const int result       = daal::services::internal::daal_memcpy_s(bufferRows.get(), blockSize, dataRows.get(), blockSize);
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    WriteOnlyRows<algorithmFPType, cpu> nCoalescedRowsBlock(nCoalescedRowsTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nCoalescedRowsBlock);
+    nCoalescedRowsBlock.get()[0] = (algorithmFPType)(nBufferedRows + nVectors);
+    return status;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataTable, NumericTable * nObservationsTable,
                                                                                     NumericTable * crossProductTable, NumericTable * sumTable,
-                                                                                    const Parameter * parameter)
+                                                                                    const Parameter * parameter, NumericTable * coalescedRowsTable,
+                                                                                    NumericTable * nCoalescedRowsTable)
 {
     const size_t nFeatures  = dataTable->getNumberOfColumns();
     const size_t nVectors   = dataTable->getNumberOfRows();
     const bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
 
+    const OnlineParameter * onlineParameter = static_cast<const OnlineParameter *>(parameter);
+    if (onlineParameter->forgettingFactor < 1.0)
+    {
+        return updateDecayedCrossProductAndSums<algorithmFPType, cpu>(dataTable, (algorithmFPType)onlineParameter->forgettingFactor,
+                                                                      nObservationsTable, crossProductTable, sumTable);
+    }
+
+    /* The coalescing buffer is a part of the partial results, so every block is accounted in them when compute() returns */
+    const bool hasCoalescingBuffer = (method == defaultDense && coalescedRowsTable && nCoalescedRowsTable);
+    if (hasCoalescingBuffer && !isNormalized && onlineParameter->coalescingBlockSize > 0 && nVectors < coalescedRowsTable->getNumberOfRows())
+    {
+        return coalesceBlock<algorithmFPType, cpu>(dataTable, coalescedRowsTable, nCoalescedRowsTable, nObservationsTable, crossProductTable,
+                                                   sumTable);
+    }
+
     DEFINE_TABLE_BLOCK(WriteRows, sumBlock, sumTable);
     DEFINE_TABLE_BLOCK(WriteRows, crossProductBlock, crossProductTable);
     DEFINE_TABLE_BLOCK(WriteRows, nObservationsBlock, nObservationsTable);
@@ -79,6 +139,12 @@ services::Status CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::comp
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures * nFeatures, sizeof(algorithmFPType));
 
     services::Status status;
+    if (hasCoalescingBuffer && onlineParameter->coalescingBlockSize == 0)
+    {
+        /* The coalescing was switched off after the buffer was allocated */
+        DAAL_CHECK_STATUS(status, (flushCoalescedRows<algorithmFPType, cpu>(coalescedRowsTable, nCoalescedRowsTable, crossProduct, sums,
+                                                                            nObservations)));
+    }
     if (method == singlePassDense)
     {
         status |= updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors, dataTable, crossProduct, sums,
@@ -115,8 +181,21 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable * nObservationsTable,
                                                                                             NumericTable * crossProductTable, NumericTable * sumTable,
                                                                                             NumericTable * covTable, NumericTable * meanTable,
-                                                                                            const Parameter * parameter)
+                                                                                            const Parameter * parameter,
+                                                                                            NumericTable * coalescedRowsTable,
+                                                                                            NumericTable * nCoalescedRowsTable)
 {
+    if (method == defaultDense && coalescedRowsTable && nCoalescedRowsTable)
+    {
+        DEFINE_TABLE_BLOCK(WriteRows, sumBlock, sumTable);
+        DEFINE_TABLE_BLOCK(WriteRows, crossProductBlock, crossProductTable);
+        DEFINE_TABLE_BLOCK(WriteRows, nObservationsBlock, nObservationsTable);
+
+        services::Status status = flushCoalescedRows<algorithmFPType, cpu>(coalescedRowsTable, nCoalescedRowsTable, crossProductBlock.get(),
+                                                                           sumBlock.get(), nObservationsBlock.get());
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
     return finalizeCovariance<algorithmFPType, cpu>(nObservationsTable, crossProductTable, sumTable, covTable, meanTable, parameter);
 }
 
@@ -70,6 +70,19 @@ services::Status CovarianceDistributedKernel<algorithmFPType, method, cpu>::comp
 
         mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProductBlock.get(), partialSumsBlock.get(),
                                                        partialNObservationsBlock.get(), crossProduct, sums, nObservations);
+
+        /* Rows coalesced on the local node and not merged into its partial result yet */
+        NumericTable * partialCoalescedRowsTable  = patrialResult->get(covariance::coalescedRows).get();
+        NumericTable * partialNCoalescedRowsTable = patrialResult->get(covariance::nCoalescedRows).get();
+        if (partialCoalescedRowsTable && partialNCoalescedRowsTable)
+        {
+            DEFINE_TABLE_BLOCK(ReadRows, partialNCoalescedRowsBlock, partialNCoalescedRowsTable);
+            const size_t nCoalescedRows = (size_t)partialNCoalescedRowsBlock.get()[0];
+
+            services::Status status =
+                mergeCoalescedRows<algorithmFPType, cpu>(partialCoalescedRowsTable, nCoalescedRows, crossProduct, sums, nObservations);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
     }
 
     return services::Status();
@@ -128,6 +128,37 @@ private:
     TArrayScalableCalloc<algorithmFPType, cpu> crossProductArray;
 };
 
+/* Adds the cross-product and the sums of src to the ones of dst and releases src, used to combine the thread-local data by pairs */
+template <typename algorithmFPType, CpuType cpu>
+void combineTlsData(tls_data_t<algorithmFPType, cpu> *& dst, tls_data_t<algorithmFPType, cpu> *& src, size_t nFeatures, bool addSums)
+{
+    if (!src) return;
+    if (!dst)
+    {
+        dst = src;
+        src = nullptr;
+        return;
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nFeatures * nFeatures; i++)
+    {
+        dst->crossProduct[i] += src->crossProduct[i];
+    }
+    if (addSums)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            dst->sums[i] += src->sums[i];
+        }
+    }
+    delete src;
+    src = nullptr;
+}
+
 /* Optimal block size for AVX512 low dimensions case (1024) and other CPU's and cases (140) */
 template <CpuType cpu>
 static inline size_t getBlockSize(size_t nrows)
@@ -219,36 +250,41 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
         });
         DAAL_CHECK_SAFE_STATUS();
 
-        /* TLS reduction: sum all partial cross products and sums */
-        tls_data.reduce([=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
-            DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
-            /* Sum all cross products */
-            if (tls_data_local->crossProduct)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < (nFeatures * nFeatures); i++)
+        /* TLS reduction: sum all partial cross products and sums, the thread-local data are combined by pairs in parallel first */
+        const bool addSums = !isNormalized && (method == defaultDense);
+        tls_data.tree_reduce(
+            [=](tls_data_t<algorithmFPType, cpu> *& dst, tls_data_t<algorithmFPType, cpu> *& src) {
+                combineTlsData<algorithmFPType, cpu>(dst, src, nFeatures, addSums);
+            },
+            [=](tls_data_t<algorithmFPType, cpu> * tls_data_local) {
+                DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
+                /* Sum all cross products */
+                if (tls_data_local->crossProduct)
                 {
-                    crossProduct[i] += tls_data_local->crossProduct[i];
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < (nFeatures * nFeatures); i++)
+                    {
+                        crossProduct[i] += tls_data_local->crossProduct[i];
+                    }
                 }
-            }
 
-            /* Update sums vector in case of non-normalized data */
-            if (!isNormalized && (method == defaultDense))
-            {
-                if (tls_data_local->sums)
+                /* Update sums vector in case of non-normalized data */
+                if (!isNormalized && (method == defaultDense))
                 {
-                    PRAGMA_IVDEP
-                    PRAGMA_VECTOR_ALWAYS
-                    for (size_t i = 0; i < nFeatures; i++)
+                    if (tls_data_local->sums)
                     {
-                        sums[i] += tls_data_local->sums[i];
+                        PRAGMA_IVDEP
+                        PRAGMA_VECTOR_ALWAYS
+                        for (size_t i = 0; i < nFeatures; i++)
+                        {
+                            sums[i] += tls_data_local->sums[i];
+                        }
                     }
                 }
-            }
 
-            delete tls_data_local;
-        });
+                delete tls_data_local;
+            });
 
         /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n */
         if (!isNormalized)
@@ -288,12 +324,226 @@ services::Status updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatu
     return services::Status();
 }
 
+/********************* updateDenseCrossProductAndSumsInDouble ************************************/
+/* Same as updateDenseCrossProductAndSums for the methods based on syrk, the blocks of the data are converted to double
+ * and the cross-product and the sums are accumulated in double, the results are converted to the precision of the algorithm at the end */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status updateDenseCrossProductAndSumsInDouble(bool isNormalized, size_t nFeatures, size_t nVectors, NumericTable * dataTable,
+                                                        algorithmFPType * crossProduct, algorithmFPType * sums, algorithmFPType * nObservations)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateDenseCrossProductAndSumsInDouble);
+
+    const bool computeSums = !isNormalized && (method == defaultDense);
+    const size_t nCells    = nFeatures * nFeatures;
+
+    TArray<double, cpu> totalCrossProductArray(nCells);
+    TArray<double, cpu> totalSumsArray(nFeatures);
+    DAAL_CHECK_MALLOC(totalCrossProductArray.get() && totalSumsArray.get());
+    double * totalCrossProduct = totalCrossProductArray.get();
+    double * totalSums         = totalSumsArray.get();
+
+    service_memset<double, cpu>(totalCrossProduct, 0.0, nCells);
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        totalSums[i] = (isNormalized ? 0.0 : (double)sums[i]);
+    }
+
+    /* Split rows by blocks */
+    const size_t numRowsInBlock = getBlockSize<cpu>(nVectors);
+    const size_t numBlocks      = nVectors / numRowsInBlock + !!(nVectors % numRowsInBlock);
+
+    /* TLS data initialization, every thread also keeps the buffer for the converted block */
+    SafeStatus safeStat;
+    daal::tls<tls_data_t<double, cpu> *> tls_data([=, &safeStat]() {
+        auto tlsData = tls_data_t<double, cpu>::create(isNormalized, nFeatures);
+        if (!tlsData)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        }
+        return tlsData;
+    });
+    daal::tls<double *> tls_block([=, &safeStat]() {
+        double * block = service_scalable_malloc<double, cpu>(numRowsInBlock * nFeatures);
+        if (!block)
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+        }
+        return block;
+    });
+
+    daal::threader_for(numBlocks, numBlocks, [&](int iBlock) {
+        tls_data_t<double, cpu> * tls_data_local = tls_data.local();
+        double * block                           = tls_block.local();
+        if (!tls_data_local || !block)
+        {
+            return;
+        }
+
+        const size_t startRow = iBlock * numRowsInBlock;
+        const size_t nRows    = (startRow + numRowsInBlock < nVectors) ? numRowsInBlock : nVectors - startRow;
+
+        ReadRows<algorithmFPType, cpu, NumericTable> dataTableBD(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataTableBD);
+        const algorithmFPType * dataBlock_local = dataTableBD.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows * nFeatures; i++)
+        {
+            block[i] = dataBlock_local[i];
+        }
+
+        char uplo       = 'U';
+        char trans      = 'N';
+        double alpha    = 1.0;
+        double beta     = 1.0;
+        DAAL_INT nCols  = nFeatures;
+        DAAL_INT nBlock = nRows;
+
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(gemmData);
+            Blas<double, cpu>::xxsyrk(&uplo, &trans, &nCols, &nBlock, &alpha, block, &nCols, &beta, tls_data_local->crossProduct, &nCols);
+        }
+
+        if (computeSums)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(cumputeSums.local);
+            double * sums_local = tls_data_local->sums;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sums_local[j] += block[i * nFeatures + j];
+                }
+            }
+        }
+    });
+
+    tls_block.reduce([](double * block) { service_scalable_free<double, cpu>(block); });
+
+    tls_data.tree_reduce(
+        [=](tls_data_t<double, cpu> *& dst, tls_data_t<double, cpu> *& src) { combineTlsData<double, cpu>(dst, src, nFeatures, computeSums); },
+        [=](tls_data_t<double, cpu> * tls_data_local) {
+            DAAL_ITTNOTIFY_SCOPED_TASK(computeSums.reduce);
+            if (tls_data_local->crossProduct)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nCells; i++)
+                {
+                    totalCrossProduct[i] += tls_data_local->crossProduct[i];
+                }
+            }
+            if (computeSums && tls_data_local->sums)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nFeatures; i++)
+                {
+                    totalSums[i] += tls_data_local->sums[i];
+                }
+            }
+            delete tls_data_local;
+        });
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* If data is not normalized, perform subtractions of(sums[i]*sums[j])/n in double as well */
+    const double nVectorsInv = 1.0 / (double)nVectors;
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const double correction         = isNormalized ? 0.0 : nVectorsInv * totalSums[i] * totalSums[j];
+            crossProduct[i * nFeatures + j] = (algorithmFPType)(totalCrossProduct[i * nFeatures + j] - correction);
+        }
+    }
+    if (computeSums)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            sums[i] = (algorithmFPType)totalSums[i];
+        }
+    }
+
+    *nObservations += (algorithmFPType)nVectors;
+    return services::Status();
+}
+
+/********************** updateCSRCrossProductAndSumsZeroBased ************************************/
+/* Computes the cross product and updates the sums for the CSR data with 0-based indexing by blocks of rows in parallel,
+ * the 1-based Sparse BLAS routines are not applicable to these index arrays */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status updateCSRCrossProductAndSumsZeroBased(size_t nFeatures, size_t nVectors, const algorithmFPType * dataBlock,
+                                                       const size_t * colIndices, const size_t * rowOffsets, algorithmFPType * crossProduct,
+                                                       algorithmFPType * sums)
+{
+    const bool updateSums  = (method != sumCSR);
+    const size_t blockSize = 256;
+    const size_t localSize = nFeatures * nFeatures + (updateSums ? nFeatures : 0);
+
+    /* Balance the blocks by the numbers of non-zero values */
+    CSRRowBlocks<cpu> blocks;
+    services::Status s = blocks.init(rowOffsets, nVectors, nVectors / blockSize + !!(nVectors % blockSize), blockSize);
+    DAAL_CHECK_STATUS_VAR(s);
+    const size_t nBlocks = blocks.nBlocks();
+
+    daal::tls<algorithmFPType *> tlsData([=]() -> algorithmFPType * { return service_scalable_calloc<algorithmFPType, cpu>(localSize); });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * localCrossProduct = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(localCrossProduct);
+        algorithmFPType * localSums = localCrossProduct + nFeatures * nFeatures;
+
+        const size_t iEnd = blocks.blockStart(iBlock) + blocks.blockSize(iBlock);
+        for (size_t i = blocks.blockStart(iBlock); i < iEnd; i++)
+        {
+            for (size_t k = rowOffsets[i]; k < rowOffsets[i + 1]; k++)
+            {
+                const algorithmFPType value = dataBlock[k];
+                algorithmFPType * cpRow     = localCrossProduct + colIndices[k] * nFeatures;
+                PRAGMA_IVDEP
+                for (size_t l = rowOffsets[i]; l < rowOffsets[i + 1]; l++)
+                {
+                    cpRow[colIndices[l]] += value * dataBlock[l];
+                }
+                if (updateSums) localSums[colIndices[k]] += value;
+            }
+        }
+    });
+
+    service_memset<algorithmFPType, cpu>(crossProduct, algorithmFPType(0), nFeatures * nFeatures);
+    tlsData.reduce([=](algorithmFPType * localCrossProduct) {
+        if (!localCrossProduct) return;
+        for (size_t i = 0; i < nFeatures * nFeatures; i++) crossProduct[i] += localCrossProduct[i];
+        if (updateSums)
+        {
+            for (size_t i = 0; i < nFeatures; i++) sums[i] += localCrossProduct[nFeatures * nFeatures + i];
+        }
+        service_scalable_free<algorithmFPType, cpu>(localCrossProduct);
+    });
+    return safeStat.detach();
+}
+
 /********************** updateCSRCrossProductAndSums *********************************************/
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status updateCSRCrossProductAndSums(size_t nFeatures, size_t nVectors, algorithmFPType * dataBlock, size_t * colIndices,
                                               size_t * rowOffsets, algorithmFPType * crossProduct, algorithmFPType * sums,
-                                              algorithmFPType * nObservations)
+                                              algorithmFPType * nObservations, size_t indexBase)
 {
+    if (indexBase == 0)
+    {
+        services::Status s = updateCSRCrossProductAndSumsZeroBased<algorithmFPType, method, cpu>(nFeatures, nVectors, dataBlock, colIndices,
+                                                                                                 rowOffsets, crossProduct, sums);
+        DAAL_CHECK_STATUS_VAR(s);
+        nObservations[0] += (algorithmFPType)nVectors;
+        return s;
+    }
+
     char transa = 'T';
     SpBlas<algorithmFPType, cpu>::xcsrmultd(&transa, (DAAL_INT *)&nVectors, (DAAL_INT *)&nFeatures, (DAAL_INT *)&nFeatures, dataBlock,
                                             (DAAL_INT *)colIndices, (DAAL_INT *)rowOffsets, dataBlock, (DAAL_INT *)colIndices, (DAAL_INT *)rowOffsets,
@@ -382,6 +632,136 @@ void mergeCrossProductAndSums(size_t nFeatures, const algorithmFPType * partialC
     }
 }
 
+/*********************** mergeCoalescedRows ******************************************************/
+/* Merges the first nRows rows coalesced by the defaultDense online method into the cross-product and sums,
+ * the rows are centered by their own mean and merged as one data block */
+template <typename algorithmFPType, CpuType cpu>
+services::Status mergeCoalescedRows(NumericTable * coalescedRowsTable, size_t nRows, algorithmFPType * crossProduct, algorithmFPType * sums,
+                                    algorithmFPType * nObservations)
+{
+    if (!nRows)
+    {
+        return services::Status();
+    }
+    DAAL_CHECK(nRows <= coalescedRowsTable->getNumberOfRows(), services::ErrorIncorrectNumberOfObservations);
+
+    const size_t nFeatures = coalescedRowsTable->getNumberOfColumns();
+    TArrayCalloc<algorithmFPType, cpu> partialCrossProductArray(nFeatures * nFeatures);
+    TArrayCalloc<algorithmFPType, cpu> partialSumsArray(nFeatures);
+    DAAL_CHECK_MALLOC(partialCrossProductArray.get() && partialSumsArray.get());
+    algorithmFPType partialNObservations = 0.0;
+
+    services::Status status = updateDenseCrossProductAndSums<algorithmFPType, defaultDense, cpu>(
+        false, nFeatures, nRows, coalescedRowsTable, partialCrossProductArray.get(), partialSumsArray.get(), &partialNObservations);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProductArray.get(), partialSumsArray.get(), &partialNObservations,
+                                                   crossProduct, sums, nObservations);
+    return status;
+}
+
+/*********************** flushCoalescedRows ******************************************************/
+/* Merges all the rows coalesced in the partial result into its cross-product and sums and empties the buffer */
+template <typename algorithmFPType, CpuType cpu>
+services::Status flushCoalescedRows(NumericTable * coalescedRowsTable, NumericTable * nCoalescedRowsTable, algorithmFPType * crossProduct,
+                                    algorithmFPType * sums, algorithmFPType * nObservations)
+{
+    DEFINE_TABLE_BLOCK(WriteRows, nCoalescedRowsBlock, nCoalescedRowsTable);
+    services::Status status =
+        mergeCoalescedRows<algorithmFPType, cpu>(coalescedRowsTable, (size_t)nCoalescedRowsBlock.get()[0], crossProduct, sums, nObservations);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    nCoalescedRowsBlock.get()[0] = 0;
+    return status;
+}
+
+/*********************** updateDecayedCrossProductAndSums ****************************************/
+/* Merges the data block into the partial results with exponential forgetting. The weight of a row is forgettingFactor^k,
+ * where k is the number of rows that follow it, so the partial results are scaled by forgettingFactor^nVectors
+ * and merged with the weighted cross-product and sums of the block */
+template <typename algorithmFPType, CpuType cpu>
+services::Status updateDecayedCrossProductAndSums(NumericTable * dataTable, algorithmFPType forgettingFactor, NumericTable * nObservationsTable,
+                                                  NumericTable * crossProductTable, NumericTable * sumTable)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateDecayedCrossProductAndSums);
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    DEFINE_TABLE_BLOCK(ReadRows, dataBlock, dataTable);
+    DEFINE_TABLE_BLOCK(WriteRows, sumBlock, sumTable);
+    DEFINE_TABLE_BLOCK(WriteRows, crossProductBlock, crossProductTable);
+    DEFINE_TABLE_BLOCK(WriteRows, nObservationsBlock, nObservationsTable);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+    TArray<algorithmFPType, cpu> weightedDataArray(nVectors * nFeatures);
+    TArray<algorithmFPType, cpu> weightsArray(nVectors);
+    TArrayCalloc<algorithmFPType, cpu> partialCrossProductArray(nFeatures * nFeatures);
+    TArrayCalloc<algorithmFPType, cpu> partialSumsArray(nFeatures);
+    DAAL_CHECK_MALLOC(weightedDataArray.get() && weightsArray.get() && partialCrossProductArray.get() && partialSumsArray.get());
+
+    const algorithmFPType * data          = dataBlock.get();
+    algorithmFPType * weightedData        = weightedDataArray.get();
+    algorithmFPType * weights             = weightsArray.get();
+    algorithmFPType * partialCrossProduct = partialCrossProductArray.get();
+    algorithmFPType * partialSums         = partialSumsArray.get();
+
+    algorithmFPType weight               = 1.0;
+    algorithmFPType partialNObservations = 0.0;
+    for (size_t i = nVectors; i > 0; i--)
+    {
+        weights[i - 1] = weight;
+        partialNObservations += weight;
+        weight *= forgettingFactor;
+    }
+    const algorithmFPType decay = weight; /* forgettingFactor^nVectors */
+
+    /* The rows are scaled by the square roots of the weights, so that syrk gives the weighted cross-product */
+    daal::threader_for(nVectors, nVectors, [=](size_t i) {
+        const algorithmFPType sqrtWeight = daal::internal::Math<algorithmFPType, cpu>::sSqrt(weights[i]);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++) weightedData[i * nFeatures + j] = sqrtWeight * data[i * nFeatures + j];
+    });
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++) partialSums[j] += weights[i] * data[i * nFeatures + j];
+    }
+
+    char uplo             = 'U';
+    char trans            = 'N';
+    algorithmFPType alpha = 1.0;
+    algorithmFPType beta  = 0.0;
+    DAAL_INT nRows        = nVectors;
+    DAAL_INT nFeaturesInt = nFeatures;
+    Blas<algorithmFPType, cpu>::xsyrk(&uplo, &trans, &nFeaturesInt, &nRows, &alpha, weightedData, &nFeaturesInt, &beta, partialCrossProduct,
+                                      &nFeaturesInt);
+
+    const algorithmFPType invPartialNObservations = 1.0 / partialNObservations;
+    daal::threader_for(nFeatures, nFeatures, [=](size_t i) {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j <= i; j++)
+        {
+            partialCrossProduct[i * nFeatures + j] -= invPartialNObservations * partialSums[i] * partialSums[j];
+        }
+    });
+
+    algorithmFPType * crossProduct  = crossProductBlock.get();
+    algorithmFPType * sums          = sumBlock.get();
+    algorithmFPType * nObservations = nObservationsBlock.get();
+    for (size_t i = 0; i < nFeatures * nFeatures; i++) crossProduct[i] *= decay;
+    for (size_t i = 0; i < nFeatures; i++) sums[i] *= decay;
+    nObservations[0] *= decay;
+
+    mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct, partialSums, &partialNObservations, crossProduct, sums,
+                                                   nObservations);
+    return services::Status();
+}
+
 /*********************** finalizeCovariance ******************************************************/
 template <typename algorithmFPType, CpuType cpu>
 services::Status finalizeCovariance(size_t nFeatures, algorithmFPType nObservations, algorithmFPType * crossProduct, algorithmFPType * sums,
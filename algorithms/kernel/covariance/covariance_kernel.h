@@ -27,6 +27,7 @@
 #include "data_management/data/numeric_table.h"
 #include "algorithms/algorithm_base_common.h"
 #include "algorithms/covariance/covariance_types.h"
+#include "service/kernel/service_arrays.h"
 
 using namespace daal::services;
 using namespace daal::data_management;
@@ -58,10 +59,11 @@ class CovarianceDenseOnlineKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(NumericTable * dataTable, NumericTable * nObsTable, NumericTable * crossProductTable, NumericTable * sumTable,
-                             const Parameter * parameter);
+                             const Parameter * parameter, NumericTable * coalescedRowsTable = nullptr, NumericTable * nCoalescedRowsTable = nullptr);
 
     services::Status finalizeCompute(NumericTable * nObsTable, NumericTable * crossProductTable, NumericTable * sumTable, NumericTable * covTable,
-                                     NumericTable * meanTable, const Parameter * parameter);
+                                     NumericTable * meanTable, const Parameter * parameter, NumericTable * coalescedRowsTable = nullptr,
+                                     NumericTable * nCoalescedRowsTable = nullptr);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
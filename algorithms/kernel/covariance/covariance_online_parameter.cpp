@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/covariance/covariance_types.h"
+#include "service/kernel/daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -35,19 +36,23 @@ namespace covariance
 namespace interface1
 {
 /** Default constructor */
-OnlineParameter::OnlineParameter() : Parameter() {}
+OnlineParameter::OnlineParameter() : Parameter(), coalescingBlockSize(0), forgettingFactor(1.0) {}
 
 /**
 *  Constructs parameters of the Covariance Online algorithm by copying another parameters of the Covariance Online algorithm
 *  \param[in] other    Parameters of the Covariance Online algorithm
 */
-OnlineParameter::OnlineParameter(const OnlineParameter & other) : Parameter(other) {}
+OnlineParameter::OnlineParameter(const OnlineParameter & other)
+    : Parameter(other), coalescingBlockSize(other.coalescingBlockSize), forgettingFactor(other.forgettingFactor)
+{}
 
 /**
  * Check the correctness of the %OnlineParameter object
  */
 services::Status OnlineParameter::check() const
 {
+    DAAL_CHECK_EX(forgettingFactor > 0.0 && forgettingFactor <= 1.0, services::ErrorIncorrectParameter, services::ParameterName,
+                  forgettingFactorStr());
     return services::Status();
 }
 
@@ -60,6 +60,8 @@ size_t PartialResult::getNumberOfFeatures() const
  */
 NumericTablePtr PartialResult::get(PartialResultId id) const
 {
+    /* Partial results serialized before the coalescing buffer was added have fewer entries */
+    if ((size_t)id >= Argument::size()) return NumericTablePtr();
     return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
 }
 
@@ -112,6 +114,17 @@ services::Status PartialResult::checkImpl(size_t nFeatures) const
 
     unexpectedLayouts |= (int)NumericTableIface::upperPackedSymmetricMatrix | (int)NumericTableIface::lowerPackedSymmetricMatrix;
     s |= checkNumericTable(get(sum).get(), sumStr(), unexpectedLayouts, 0, nFeatures, 1);
+    if (!s) return s;
+
+    NumericTable * coalescedRowsTable  = get(coalescedRows).get();
+    NumericTable * nCoalescedRowsTable = get(nCoalescedRows).get();
+    if (coalescedRowsTable || nCoalescedRowsTable)
+    {
+        DAAL_CHECK(coalescedRowsTable && nCoalescedRowsTable, services::ErrorNullPartialResult);
+        s |= checkNumericTable(coalescedRowsTable, coalescedRowsStr(), unexpectedLayouts, 0, nFeatures);
+        if (!s) return s;
+        s |= checkNumericTable(nCoalescedRowsTable, nCoalescedRowsStr(), unexpectedLayouts, 0, 1, 1);
+    }
     return s;
 }
 
@@ -53,9 +53,22 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
 
     if (deviceInfo.isCpu)
     {
-        set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &status));
+        /* With forgetting the number of observations is the sum of their weights, it is not integer */
+        const OnlineParameter * onlinePar = dynamic_cast<const OnlineParameter *>(parameter);
+        if (onlinePar && onlinePar->forgettingFactor < 1.0)
+            set(nObservations, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &status));
+        else
+            set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &status));
         set(crossProduct, HomogenNumericTable<algorithmFPType>::create(nColumns, nColumns, NumericTable::doAllocate, &status));
         set(sum, HomogenNumericTable<algorithmFPType>::create(nColumns, 1, NumericTable::doAllocate, &status));
+
+        /* The rows of the small blocks are kept in the partial result, so it stays complete when it is read or serialized */
+        if (method == defaultDense && onlinePar && onlinePar->forgettingFactor >= 1.0 && onlinePar->coalescingBlockSize > 0)
+        {
+            set(coalescedRows,
+                HomogenNumericTable<algorithmFPType>::create(nColumns, onlinePar->coalescingBlockSize, NumericTable::doAllocate, &status));
+            set(nCoalescedRows, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &status));
+        }
     }
     else
     {
@@ -73,6 +86,11 @@ DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::I
     get(nObservations)->assign((algorithmFPType)0.0);
     get(crossProduct)->assign((algorithmFPType)0.0);
     get(sum)->assign((algorithmFPType)0.0);
+    if (get(coalescedRows) && get(nCoalescedRows))
+    {
+        get(coalescedRows)->assign((algorithmFPType)0.0);
+        get(nCoalescedRows)->assign((algorithmFPType)0.0);
+    }
     return services::Status();
 }
 
@@ -0,0 +1,124 @@
+/* file: covariance_csr_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Covariance matrix computation algorithm implementation for CSR data in batch mode
+//--
+*/
+
+#ifndef __COVARIANCE_CSR_BATCH_ONEAPI_IMPL_I__
+#define __COVARIANCE_CSR_BATCH_ONEAPI_IMPL_I__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "algorithms/kernel/covariance/oneapi/covariance_kernel_oneapi.h"
+#include "algorithms/kernel/covariance/oneapi/covariance_oneapi_impl.i"
+#include "service/kernel/oneapi/sparse_reducer.h"
+
+using namespace daal::oneapi::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace covariance
+{
+namespace oneapi
+{
+namespace internal
+{
+template <typename algorithmFPType, Method method>
+services::Status CovarianceCSRBatchKernelOneAPI<algorithmFPType, method>::compute(NumericTable * dataTable, NumericTable * covTable,
+                                                                                  NumericTable * meanTable, const Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCSRBatch);
+
+    services::Status status;
+
+    const size_t nFeatures              = dataTable->getNumberOfColumns();
+    const size_t nVectors               = dataTable->getNumberOfRows();
+    const algorithmFPType nObservations = static_cast<algorithmFPType>(nVectors);
+
+    if (nFeatures > services::internal::MaxVal<uint32_t>::get() || nVectors > services::internal::MaxVal<uint32_t>::get())
+    {
+        return services::Status(daal::services::ErrorCovarianceInternal);
+    }
+
+    CSRNumericTableIface * csrDataTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
+    DAAL_CHECK(csrDataTable, services::ErrorIncorrectTypeOfInputNumericTable);
+
+    math::SparseReducer::ColumnMajorMatrix matrix;
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(computeCSRBatch.toColumnMajor);
+
+        CSRBlockDescriptor<algorithmFPType> dataBlock;
+        DAAL_CHECK_STATUS(status, csrDataTable->getSparseBlock(0, nVectors, readOnly, dataBlock));
+
+        matrix = math::SparseReducer::toColumnMajor<algorithmFPType>(dataBlock.getBlockValuesPtr(), dataBlock.getBlockColumnIndicesPtr(),
+                                                                     dataBlock.getBlockRowIndicesPtr(), nVectors, nFeatures, &status);
+        csrDataTable->releaseSparseBlock(dataBlock);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    BlockDescriptor<algorithmFPType> sumBlock;
+    BlockDescriptor<algorithmFPType> crossProductBlock;
+
+    DAAL_CHECK_STATUS(status, meanTable->getBlockOfRows(0, meanTable->getNumberOfRows(), writeOnly, sumBlock));
+    DAAL_CHECK_STATUS(status, covTable->getBlockOfRows(0, covTable->getNumberOfRows(), writeOnly, crossProductBlock));
+
+    const services::Buffer<algorithmFPType> sums         = sumBlock.getBuffer();
+    const services::Buffer<algorithmFPType> crossProduct = crossProductBlock.getBuffer();
+
+    if (method == sumCSR)
+    {
+        status |= prepareSums<algorithmFPType, method>(dataTable, sums);
+    }
+    else
+    {
+        auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        math::SparseReducer::Result columnStatistics =
+            math::SparseReducer::reduceColumns(matrix, TypeIds::id<algorithmFPType>(), nVectors, nFeatures, &status);
+        if (status)
+        {
+            context.copy(sums, 0, columnStatistics.sum, 0, nFeatures, &status);
+        }
+    }
+
+    if (status)
+    {
+        math::SparseReducer::crossProduct(matrix, TypeIds::id<algorithmFPType>(), nVectors, nFeatures, sums, crossProduct, &status);
+    }
+
+    if (status)
+    {
+        status |= finalizeCovariance<algorithmFPType, method>(nFeatures, nObservations, crossProduct, sums, crossProduct, sums, parameter);
+    }
+
+    status |= meanTable->releaseBlockOfRows(sumBlock);
+    status |= covTable->releaseBlockOfRows(crossProductBlock);
+
+    return status;
+}
+
+} // namespace internal
+} // namespace oneapi
+} // namespace covariance
+} // namespace algorithms
+} // namespace daal
+
+#endif
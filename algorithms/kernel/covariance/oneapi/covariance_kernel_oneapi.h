@@ -48,6 +48,13 @@ public:
     services::Status compute(NumericTable * dataTable, NumericTable * covTable, NumericTable * meanTable, const Parameter * parameter);
 };
 
+template <typename algorithmFPType, Method method>
+class CovarianceCSRBatchKernelOneAPI : public Kernel
+{
+public:
+    services::Status compute(NumericTable * dataTable, NumericTable * covTable, NumericTable * meanTable, const Parameter * parameter);
+};
+
 template <typename algorithmFPType, Method method>
 class CovarianceDenseOnlineKernelOneAPI : public Kernel
 {
@@ -29,6 +29,8 @@
 #include "algorithms/dbscan/dbscan_batch.h"
 #include "algorithms/dbscan/dbscan_distributed.h"
 #include "algorithms/kernel/dbscan/dbscan_kernel.h"
+#include "algorithms/kernel/dbscan/oneapi/dbscan_kernel_ucapi.h"
+#include "oneapi/internal/execution_context.h"
 #include "service/kernel/service_algo_utils.h"
 
 namespace daal
@@ -40,7 +42,17 @@ namespace dbscan
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::DBSCANBatchKernel, algorithmFPType, method);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu || method != defaultDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::DBSCANBatchKernel, algorithmFPType, method);
+    }
+    else
+    {
+        _kernel = new internal::DBSCANBatchKernelUCAPI<algorithmFPType>();
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -52,6 +64,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
 
@@ -66,7 +81,12 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter * par                        = static_cast<Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
-    if (par->memorySavingMode == false)
+    if (!deviceInfo.isCpu && method == defaultDense)
+    {
+        return ((internal::DBSCANBatchKernelUCAPI<algorithmFPType> *)(_kernel))
+            ->compute(ntData.get(), ntWeights.get(), ntAssignments.get(), ntNClusters.get(), ntCoreIndices.get(), ntCoreObservations.get(), par);
+    }
+    else if (par->memorySavingMode == false)
     {
         __DAAL_CALL_KERNEL(env, internal::DBSCANBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeNoMemSave, ntData.get(),
                            ntWeights.get(), ntAssignments.get(), ntNClusters.get(), ntCoreIndices.get(), ntCoreObservations.get(), par);
@@ -163,50 +163,90 @@ Status DBSCANBatchKernel<algorithmFPType, method, cpu>::computeNoMemSave(const N
     DAAL_CHECK_BLOCK_STATUS(assignRows);
     int * const assignments = assignRows.get();
 
-    service_memset<int, cpu>(assignments, undefined, nRows);
-
     TArray<int, cpu> isCoreArray(nRows);
     DAAL_CHECK_MALLOC(isCoreArray.get());
     int * const isCore = isCoreArray.get();
 
-    service_memset<int, cpu>(isCore, 0, nRows);
-
-    size_t nClusters = 0;
-    Queue<size_t, cpu> qu;
+    TArray<int, cpu> parentArray(nRows);
+    DAAL_CHECK_MALLOC(parentArray.get());
+    int * const parent = parentArray.get();
 
-    for (size_t i = 0; i < nRows; i++)
-    {
-        if (assignments[i] != undefined) continue;
+    const size_t blockSize = 256;
+    const size_t nBlocks   = nRows / blockSize + (nRows % blockSize > 0);
 
-        Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
-        if (curNeigh.weight() < minObservations)
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i1 = iBlock * blockSize;
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : i1 + blockSize);
+        for (size_t i = i1; i < i2; i++)
         {
-            assignments[i] = noise;
-            continue;
+            isCore[i] = (neighs[i].weight() >= minObservations);
+            parent[i] = i;
         }
+    });
 
-        nClusters++;
-        isCore[i]      = 1;
-        assignments[i] = nClusters - 1;
+    /* Core observations from the neighborhoods of each other are merged into one cluster */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i1 = iBlock * blockSize;
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : i1 + blockSize);
+        for (size_t i = i1; i < i2; i++)
+        {
+            if (!isCore[i]) continue;
 
-        qu.reset();
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (isCore[nextObs] && nextObs != i)
+                {
+                    UnionFind<cpu>::unite(parent, (int)i, (int)nextObs);
+                }
+            }
+        }
+    });
 
-        DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+    UnionFind<cpu>::compress(parent, nRows);
 
-        while (!qu.empty())
+    /* Clusters are numbered in the ascending order of their first core observations, as in the sequential expansion */
+    size_t nClusters = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        if (isCore[i] && parent[i] == i)
         {
-            const size_t curObs = qu.pop();
-
-            Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[curObs];
+            assignments[i] = nClusters;
+            nClusters++;
+        }
+    }
 
-            assignments[curObs] = nClusters - 1;
-            if (curNeigh.weight() < minObservations) continue;
+    /* The parent entries point to the roots after the compression and are only read here,
+       a border observation goes to the first cluster that reaches it in the sequential expansion */
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t i1 = iBlock * blockSize;
+        const size_t i2 = (iBlock + 1 == nBlocks ? nRows : i1 + blockSize);
+        for (size_t i = i1; i < i2; i++)
+        {
+            if (isCore[i])
+            {
+                const int root = parent[i];
+                if (root != (int)i)
+                {
+                    assignments[i] = assignments[root];
+                }
+                continue;
+            }
 
-            isCore[curObs] = 1;
+            int clusterId                                       = noise;
+            const Neighborhood<algorithmFPType, cpu> & curNeigh = neighs[i];
+            for (size_t j = 0; j < curNeigh.size(); j++)
+            {
+                const size_t nextObs = curNeigh.get(j);
+                if (!isCore[nextObs]) continue;
 
-            DAAL_CHECK_STATUS_VAR(processNeighborhood(nClusters - 1, assignments, curNeigh, qu));
+                const int nextClusterId = assignments[parent[nextObs]];
+                clusterId               = (clusterId == noise || nextClusterId < clusterId ? nextClusterId : clusterId);
+            }
+            assignments[i] = clusterId;
         }
-    }
+    });
 
     WriteRows<int, cpu> nClustersRows(ntNClusters, 0, 1);
     DAAL_CHECK_BLOCK_STATUS(nClustersRows);
@@ -25,6 +25,8 @@
 #define __DBSCAN_RESULT__
 
 #include "algorithms/dbscan/dbscan_types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table_sycl_homogen.h"
 
 using namespace daal::data_management;
 
@@ -49,18 +51,39 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     const size_t nRows     = algInput->get(data)->getNumberOfRows();
     const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
 
-    services::Status status;
-    set(assignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status));
-    set(nClusters, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &status));
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
 
-    if (par->resultsToCompute & computeCoreIndices)
+    services::Status status;
+    if (deviceInfo.isCpu || method != defaultDense)
     {
-        set(coreIndices, HomogenNumericTable<int>::create(1, 0, NumericTable::notAllocate, &status));
-    }
+        set(assignments, HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status));
+        set(nClusters, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &status));
+
+        if (par->resultsToCompute & computeCoreIndices)
+        {
+            set(coreIndices, HomogenNumericTable<int>::create(1, 0, NumericTable::notAllocate, &status));
+        }
 
-    if (par->resultsToCompute & computeCoreObservations)
+        if (par->resultsToCompute & computeCoreObservations)
+        {
+            set(coreObservations, HomogenNumericTable<algorithmFPType>::create(nFeatures, 0, NumericTable::notAllocate, &status));
+        }
+    }
+    else
     {
-        set(coreObservations, HomogenNumericTable<algorithmFPType>::create(nFeatures, 0, NumericTable::notAllocate, &status));
+        set(assignments, SyclHomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status));
+        set(nClusters, SyclHomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, &status));
+
+        if (par->resultsToCompute & computeCoreIndices)
+        {
+            set(coreIndices, SyclHomogenNumericTable<int>::create(1, 0, NumericTable::notAllocate, &status));
+        }
+
+        if (par->resultsToCompute & computeCoreObservations)
+        {
+            set(coreObservations, SyclHomogenNumericTable<algorithmFPType>::create(nFeatures, 0, NumericTable::notAllocate, &status));
+        }
     }
 
     return status;
@@ -33,6 +33,7 @@
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_math.h"
 #include "algorithms/kernel/service_kernel_math.h"
+#include "algorithms/kernel/service_sort.h"
 #include "algorithms/kernel/service_error_handling.h"
 
 using namespace daal::internal;
@@ -188,6 +189,8 @@ public:
 
     T * ptr() { return _data; }
 
+    const T * ptr() const { return _data; }
+
 private:
     services::Status grow()
     {
@@ -423,6 +426,11 @@ public:
             DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
             const FPType * const inData = inDataRows.get();
 
+            PairwiseSquaredDistances<FPType, cpu> distances(iSize, outBlockSize, dim);
+            DAAL_CHECK_MALLOC_THR(distances.isValid());
+            TArray<FPType, cpu> distBlock(iSize * outBlockSize);
+            DAAL_CHECK_MALLOC_THR(distBlock.get());
+
             if (doReset)
             {
                 for (size_t i = 0; i < iSize; i++)
@@ -449,12 +457,14 @@ public:
                 }
                 const FPType * const weights = weightsRows.get();
 
+                distances.compute(inData, iSize, dim, outData, jSize, outDim, distBlock.get());
+
                 for (size_t i = 0; i < iSize; i++)
                 {
+                    const FPType * const distRow = distBlock.get() + i * jSize;
                     for (size_t j = 0; j < jSize; j++)
                     {
-                        FPType dist = distancePow2<FPType, cpu>(&inData[i * dim], &outData[j * outDim], dim);
-                        if (dist <= epsP)
+                        if (distances.isWithin(distRow[j], epsP, i, j, &inData[i * dim], &outData[j * outDim]))
                         {
                             DAAL_CHECK_STATUS_THR(neighs[i + i1].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
                         }
@@ -486,13 +496,19 @@ public:
         services::SharedPtr<NTask<FPType, cpu> > nTask = NTask<FPType, cpu>::create(n);
         DAAL_CHECK_MALLOC(nTask.get());
 
-        TArray<ReadRows<FPType, cpu>, cpu> queryRows(n);
-        DAAL_CHECK_MALLOC(queryRows.get());
+        /* Query rows are gathered into a dense matrix to compute the distances by tiles */
+        TArray<FPType, cpu> queryData(n * dim);
+        DAAL_CHECK_MALLOC(queryData.get());
 
         for (size_t i = 0; i < n; i++)
         {
-            queryRows[i].set(const_cast<NumericTable *>(_inTable), indices[i], 1);
-            DAAL_CHECK_BLOCK_STATUS(queryRows[i]);
+            ReadRows<FPType, cpu> queryRow(const_cast<NumericTable *>(_inTable), indices[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(queryRow);
+            const FPType * const row = queryRow.get();
+            for (size_t k = 0; k < dim; k++)
+            {
+                queryData[i * dim + k] = row[k];
+            }
         }
 
         if (doReset)
@@ -531,14 +547,26 @@ public:
             }
             const FPType * const weights = weightsRows.get();
 
-            for (size_t i = 0; i < n; i++)
+            const size_t queryBlockSize = (n < 256 ? n : 256);
+            PairwiseSquaredDistances<FPType, cpu> distances(queryBlockSize, jSize, dim);
+            DAAL_CHECK_MALLOC_THR(distances.isValid());
+            TArray<FPType, cpu> distBlock(queryBlockSize * jSize);
+            DAAL_CHECK_MALLOC_THR(distBlock.get());
+
+            for (size_t i1 = 0; i1 < n; i1 += queryBlockSize)
             {
-                for (size_t j = 0; j < jSize; j++)
+                const size_t iSize = (i1 + queryBlockSize < n ? queryBlockSize : n - i1);
+                distances.compute(queryData.get() + i1 * dim, iSize, dim, outData, jSize, outDim, distBlock.get());
+
+                for (size_t i = 0; i < iSize; i++)
                 {
-                    FPType dist = distancePow2<FPType, cpu>(queryRows[i].get(), &outData[j * outDim], dim);
-                    if (dist <= epsP)
+                    const FPType * const distRow = distBlock.get() + i * jSize;
+                    for (size_t j = 0; j < jSize; j++)
                     {
-                        DAAL_CHECK_STATUS_THR(localNeighs[i].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
+                        if (distances.isWithin(distRow[j], epsP, i, j, queryData.get() + (i1 + i) * dim, &outData[j * outDim]))
+                        {
+                            DAAL_CHECK_STATUS_THR(localNeighs[i1 + i].add(j + j1, (weights ? weights[j] : (FPType)1.0)));
+                        }
                     }
                 }
             }
@@ -575,6 +603,633 @@ private:
     FPType _p;
 };
 
+/* Cell and tree boundaries are widened by this relative factor so that the rounding errors
+   of the coordinates do not drop the observations lying exactly at the distance epsilon */
+#define __DBSCAN_INDEX_RADIUS_FACTOR 1.001
+
+/* Uniform grid over the rows of the out table. The side of a cell is not less than epsilon,
+   so the neighbors of an observation lie in the cell of the observation or in the adjacent cells.
+   Only non-empty cells are stored: the rows are sorted by the linear index of their cell */
+template <typename FPType, CpuType cpu>
+class GridIndex
+{
+public:
+    GridIndex() : _dim(0), _nNonEmptyCells(0) {}
+
+    services::Status build(const FPType * data, size_t nRows, size_t stride, size_t dim, FPType eps, size_t * order)
+    {
+        _dim = dim;
+        _origin.reset(dim);
+        _cellWidth.reset(dim);
+        _nCells.reset(dim);
+        _cellStrides.reset(dim);
+        DAAL_CHECK_MALLOC(_origin.get() && _cellWidth.get() && _nCells.get() && _cellStrides.get());
+
+        TArray<FPType, cpu> upper(dim);
+        TArray<size_t, cpu> keys(nRows);
+        DAAL_CHECK_MALLOC(upper.get() && keys.get());
+
+        for (size_t k = 0; k < dim; k++)
+        {
+            _origin[k] = upper[k] = data[k];
+        }
+        for (size_t i = 1; i < nRows; i++)
+        {
+            const FPType * const row = data + i * stride;
+            for (size_t k = 0; k < dim; k++)
+            {
+                _origin[k] = (row[k] < _origin[k] ? row[k] : _origin[k]);
+                upper[k]   = (row[k] > upper[k] ? row[k] : upper[k]);
+            }
+        }
+
+        /* The number of cells along a dimension is limited so that the linear index of a cell fits into 62 bits,
+           the cells are widened along the dimensions with the larger range */
+        const FPType maxCells = Math<FPType, cpu>::sPowx((FPType)2.0, (FPType)62.0 / (FPType)dim);
+        size_t stride0        = 1;
+        for (size_t k = 0; k < dim; k++)
+        {
+            const FPType range = upper[k] - _origin[k];
+            FPType width       = eps * (FPType)__DBSCAN_INDEX_RADIUS_FACTOR;
+            if (maxCells > (FPType)1.0 && range / (maxCells - (FPType)1.0) > width)
+            {
+                width = range / (maxCells - (FPType)1.0);
+            }
+            _cellWidth[k] = (width > (FPType)0.0 ? width : (FPType)1.0);
+
+            const FPType nCells = range / _cellWidth[k] + (FPType)1.0;
+            _nCells[k]          = (nCells < maxCells ? (size_t)nCells : (size_t)maxCells);
+            _nCells[k]          = (_nCells[k] ? _nCells[k] : 1);
+            _cellStrides[k]     = stride0;
+            stride0 *= _nCells[k];
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const FPType * const row = data + i * stride;
+            size_t key               = 0;
+            for (size_t k = 0; k < dim; k++)
+            {
+                size_t cell = (size_t)((row[k] - _origin[k]) / _cellWidth[k]);
+                cell        = (cell < _nCells[k] ? cell : _nCells[k] - 1);
+                key += cell * _cellStrides[k];
+            }
+            keys[i]  = key;
+            order[i] = i;
+        }
+        qSort<size_t, size_t, cpu>(nRows, keys.get(), order);
+
+        _nNonEmptyCells = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            _nNonEmptyCells += (i == 0 || keys[i] != keys[i - 1]);
+        }
+
+        _cellKeys.reset(_nNonEmptyCells);
+        _cellStart.reset(_nNonEmptyCells + 1);
+        DAAL_CHECK_MALLOC(_cellKeys.get() && _cellStart.get());
+
+        size_t iCell = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            if (i == 0 || keys[i] != keys[i - 1])
+            {
+                _cellKeys[iCell]  = keys[i];
+                _cellStart[iCell] = i;
+                iCell++;
+            }
+        }
+        _cellStart[_nNonEmptyCells] = nRows;
+
+        return services::Status();
+    }
+
+    size_t bufferSize() const { return 3 * _dim; }
+
+    /* Calls rangeFunc(begin, end) for the ranges of the sorted rows that may contain the neighbors of x.
+       The adjacent cells along the first dimension have consecutive linear indices, so they form one range */
+    template <typename RangeFunc>
+    services::Status forEachCandidateRange(const FPType * x, size_t * buffer, const RangeFunc & rangeFunc) const
+    {
+        size_t * const lo  = buffer;
+        size_t * const hi  = buffer + _dim;
+        size_t * const cur = buffer + 2 * _dim;
+
+        for (size_t k = 0; k < _dim; k++)
+        {
+            const FPType t = (x[k] - _origin[k]) / _cellWidth[k];
+            if (t < (FPType)-1.0)
+            {
+                return services::Status();
+            }
+            if (t < (FPType)0.0)
+            {
+                lo[k] = hi[k] = 0;
+            }
+            else
+            {
+                const size_t cell = (t < (FPType)_nCells[k] ? (size_t)t : _nCells[k]);
+                lo[k]             = (cell ? cell - 1 : 0);
+                lo[k]             = (lo[k] < _nCells[k] ? lo[k] : _nCells[k] - 1);
+                hi[k]             = (cell + 1 < _nCells[k] ? cell + 1 : _nCells[k] - 1);
+            }
+            cur[k] = lo[k];
+        }
+
+        while (true)
+        {
+            size_t base = 0;
+            for (size_t k = 1; k < _dim; k++)
+            {
+                base += cur[k] * _cellStrides[k];
+            }
+
+            const size_t first = lowerBound(base + lo[0]);
+            size_t last        = first;
+            while (last < _nNonEmptyCells && _cellKeys[last] <= base + hi[0])
+            {
+                last++;
+            }
+            if (first < last)
+            {
+                services::Status s = rangeFunc(_cellStart[first], _cellStart[last]);
+                DAAL_CHECK_STATUS_VAR(s);
+            }
+
+            size_t k = 1;
+            for (; k < _dim && cur[k] == hi[k]; k++)
+            {
+                cur[k] = lo[k];
+            }
+            if (k >= _dim)
+            {
+                break;
+            }
+            cur[k]++;
+        }
+        return services::Status();
+    }
+
+private:
+    size_t lowerBound(size_t key) const
+    {
+        size_t l = 0;
+        size_t r = _nNonEmptyCells;
+        while (l < r)
+        {
+            const size_t m = l + (r - l) / 2;
+            if (_cellKeys[m] < key)
+            {
+                l = m + 1;
+            }
+            else
+            {
+                r = m;
+            }
+        }
+        return l;
+    }
+
+    size_t _dim;
+    size_t _nNonEmptyCells;
+    TArray<FPType, cpu> _origin;
+    TArray<FPType, cpu> _cellWidth;
+    TArray<size_t, cpu> _nCells;
+    TArray<size_t, cpu> _cellStrides;
+    TArray<size_t, cpu> _cellKeys;
+    TArray<size_t, cpu> _cellStart;
+};
+
+/* Reorders the indices so that the row order[k] has the k-th smallest value in the given column */
+template <typename FPType, CpuType cpu>
+void selectByColumn(size_t * order, size_t n, size_t k, const FPType * data, size_t stride, size_t column)
+{
+    long long l = 0;
+    long long r = (long long)n - 1;
+    while (l < r)
+    {
+        const FPType med = data[order[k] * stride + column];
+        long long i      = l;
+        long long j      = r;
+        while (i <= j)
+        {
+            while (data[order[i] * stride + column] < med)
+            {
+                i++;
+            }
+            while (med < data[order[j] * stride + column])
+            {
+                j--;
+            }
+            if (i <= j)
+            {
+                swap<cpu, size_t>(order[i], order[j]);
+                i++;
+                j--;
+            }
+        }
+        if (j < (long long)k)
+        {
+            l = i;
+        }
+        if ((long long)k < i)
+        {
+            r = j;
+        }
+    }
+}
+
+/* Kd-tree over the rows of the out table. A node is split at the median of the dimension with the widest range,
+   so the depth of the tree is logarithmic. The rows of a leaf are consecutive in the order of the index */
+template <typename FPType, CpuType cpu>
+class KdTreeIndex
+{
+    static const size_t leafSize = 32;
+
+    struct Node
+    {
+        size_t begin;
+        size_t end;
+        size_t left; /* The right child follows the left one, 0 for leaves */
+        size_t splitDim;
+        FPType splitValue;
+    };
+
+public:
+    KdTreeIndex() : _depth(0), _radius(0) {}
+
+    services::Status build(const FPType * data, size_t nRows, size_t stride, size_t dim, FPType eps, size_t * order)
+    {
+        _radius = eps * (FPType)__DBSCAN_INDEX_RADIUS_FACTOR;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            order[i] = i;
+        }
+
+        TArray<FPType, cpu> lower(dim);
+        TArray<FPType, cpu> upper(dim);
+        DAAL_CHECK_MALLOC(lower.get() && upper.get());
+
+        services::Status s;
+        Vector<size_t, cpu> depths;
+        const Node root = { 0, nRows, 0, 0, (FPType)0.0 };
+        DAAL_CHECK_STATUS(s, _nodes.push_back(root));
+        DAAL_CHECK_STATUS(s, depths.push_back(1));
+        _depth = 1;
+
+        /* Nodes are split in the breadth-first order, the children are appended to the end of the array */
+        for (size_t id = 0; id < _nodes.size(); id++)
+        {
+            const size_t begin = _nodes[id].begin;
+            const size_t end   = _nodes[id].end;
+            if (end - begin <= leafSize)
+            {
+                continue;
+            }
+
+            for (size_t k = 0; k < dim; k++)
+            {
+                lower[k] = upper[k] = data[order[begin] * stride + k];
+            }
+            for (size_t i = begin + 1; i < end; i++)
+            {
+                const FPType * const row = data + order[i] * stride;
+                for (size_t k = 0; k < dim; k++)
+                {
+                    lower[k] = (row[k] < lower[k] ? row[k] : lower[k]);
+                    upper[k] = (row[k] > upper[k] ? row[k] : upper[k]);
+                }
+            }
+
+            size_t splitDim = 0;
+            for (size_t k = 1; k < dim; k++)
+            {
+                splitDim = (upper[k] - lower[k] > upper[splitDim] - lower[splitDim] ? k : splitDim);
+            }
+            if (!(upper[splitDim] > lower[splitDim]))
+            {
+                continue;
+            }
+
+            const size_t mid = begin + (end - begin) / 2;
+            selectByColumn<FPType, cpu>(order + begin, end - begin, mid - begin, data, stride, splitDim);
+
+            _nodes[id].left       = _nodes.size();
+            _nodes[id].splitDim   = splitDim;
+            _nodes[id].splitValue = data[order[mid] * stride + splitDim];
+
+            const size_t childDepth = depths[id] + 1;
+            const Node left         = { begin, mid, 0, 0, (FPType)0.0 };
+            const Node right        = { mid, end, 0, 0, (FPType)0.0 };
+            DAAL_CHECK_STATUS(s, _nodes.push_back(left));
+            DAAL_CHECK_STATUS(s, _nodes.push_back(right));
+            DAAL_CHECK_STATUS(s, depths.push_back(childDepth));
+            DAAL_CHECK_STATUS(s, depths.push_back(childDepth));
+            _depth = (childDepth > _depth ? childDepth : _depth);
+        }
+        return s;
+    }
+
+    size_t bufferSize() const { return _depth + 1; }
+
+    /* Calls rangeFunc(begin, end) for the leaves that intersect the epsilon-box around x.
+       The left subtree contains the values not greater than the split value, the right one - not less than it */
+    template <typename RangeFunc>
+    services::Status forEachCandidateRange(const FPType * x, size_t * buffer, const RangeFunc & rangeFunc) const
+    {
+        const Node * const nodes = _nodes.ptr();
+        size_t top               = 0;
+        buffer[top++]            = 0;
+        while (top)
+        {
+            const Node & node = nodes[buffer[--top]];
+            if (!node.left)
+            {
+                services::Status s = rangeFunc(node.begin, node.end);
+                DAAL_CHECK_STATUS_VAR(s);
+                continue;
+            }
+            const FPType diff = x[node.splitDim] - node.splitValue;
+            if (diff >= -_radius)
+            {
+                buffer[top++] = node.left + 1;
+            }
+            if (diff <= _radius)
+            {
+                buffer[top++] = node.left;
+            }
+        }
+        return services::Status();
+    }
+
+private:
+    Vector<Node, cpu> _nodes;
+    size_t _depth;
+    FPType _radius;
+};
+
+/* Common part of the spatial index backed engines. The index is built over the rows of the out table on the first query.
+   The rows are copied in the order of the index, so the candidate rows are scanned contiguously in memory */
+template <typename Index, typename FPType, CpuType cpu>
+class IndexedNeighborhoodEngine
+{
+    DAAL_NEW_DELETE();
+
+public:
+    IndexedNeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : _inTable(inTable), _outTable(outTable), _weights(weights), _eps(eps), _p(p), _epsP(0), _dim(0), _nOutRows(0), _isBuilt(false)
+    {}
+
+    IndexedNeighborhoodEngine(const IndexedNeighborhoodEngine &) = delete;
+    IndexedNeighborhoodEngine & operator=(const IndexedNeighborhoodEngine &) = delete;
+
+    services::Status queryFull(Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        services::Status s = build();
+        DAAL_CHECK_STATUS_VAR(s);
+
+        SafeStatus safeStat;
+        const size_t inRows = _inTable->getNumberOfRows();
+        const size_t inDim  = _inTable->getNumberOfColumns();
+
+        const size_t inBlockSize = 256;
+        const size_t nInBlocks   = inRows / inBlockSize + (inRows % inBlockSize > 0);
+
+        daal::threader_for(nInBlocks, nInBlocks, [&](size_t inBlock) {
+            const size_t i1    = inBlock * inBlockSize;
+            const size_t i2    = (inBlock + 1 == nInBlocks ? inRows : i1 + inBlockSize);
+            const size_t iSize = i2 - i1;
+
+            ReadRows<FPType, cpu> inDataRows(const_cast<NumericTable *>(_inTable), i1, iSize);
+            DAAL_CHECK_BLOCK_STATUS_THR(inDataRows);
+            const FPType * const inData = inDataRows.get();
+
+            TArray<size_t, cpu> buffer(_index.bufferSize());
+            DAAL_CHECK_MALLOC_THR(buffer.get());
+
+            for (size_t i = 0; i < iSize; i++)
+            {
+                if (doReset)
+                {
+                    neighs[i1 + i].reset();
+                }
+                const services::Status localStatus = searchRow(inData + i * inDim, buffer.get(), neighs[i1 + i]);
+                DAAL_CHECK_STATUS_THR(localStatus);
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+    services::Status query(size_t * indices, size_t n, Neighborhood<FPType, cpu> * neighs, bool doReset = false)
+    {
+        services::Status s = build();
+        DAAL_CHECK_STATUS_VAR(s);
+
+        SafeStatus safeStat;
+        const size_t blockSize = 64;
+        const size_t nBlocks   = n / blockSize + (n % blockSize > 0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t i1 = iBlock * blockSize;
+            const size_t i2 = (iBlock + 1 == nBlocks ? n : i1 + blockSize);
+
+            TArray<size_t, cpu> buffer(_index.bufferSize());
+            DAAL_CHECK_MALLOC_THR(buffer.get());
+
+            for (size_t i = i1; i < i2; i++)
+            {
+                ReadRows<FPType, cpu> queryRow(const_cast<NumericTable *>(_inTable), indices[i], 1);
+                DAAL_CHECK_BLOCK_STATUS_THR(queryRow);
+
+                if (doReset)
+                {
+                    neighs[i].reset();
+                }
+                const services::Status localStatus = searchRow(queryRow.get(), buffer.get(), neighs[i]);
+                DAAL_CHECK_STATUS_THR(localStatus);
+            }
+        });
+
+        return safeStat.detach();
+    }
+
+private:
+    services::Status build()
+    {
+        if (_isBuilt)
+        {
+            return services::Status();
+        }
+
+        const size_t outRows = _outTable->getNumberOfRows();
+        const size_t outDim  = _outTable->getNumberOfColumns();
+        _dim                 = _inTable->getNumberOfColumns();
+        DAAL_ASSERT(outDim >= _dim);
+        _epsP = Math<FPType, cpu>::sPowx(_eps, _p);
+
+        _sortedData.reset(outRows * _dim);
+        _sortedIndices.reset(outRows);
+        DAAL_CHECK_MALLOC((_sortedData.get() && _sortedIndices.get()) || !outRows);
+
+        if (outRows)
+        {
+            ReadRows<FPType, cpu> outDataRows(const_cast<NumericTable *>(_outTable), 0, outRows);
+            DAAL_CHECK_BLOCK_STATUS(outDataRows);
+            const FPType * const outData = outDataRows.get();
+
+            services::Status s = _index.build(outData, outRows, outDim, _dim, _eps, _sortedIndices.get());
+            DAAL_CHECK_STATUS_VAR(s);
+
+            /* The sorted rows are stored by columns, so the distances to the consecutive candidates are vectorized */
+            for (size_t i = 0; i < outRows; i++)
+            {
+                const FPType * const row = outData + _sortedIndices[i] * outDim;
+                for (size_t k = 0; k < _dim; k++)
+                {
+                    _sortedData[k * outRows + i] = row[k];
+                }
+            }
+
+            if (_weights)
+            {
+                ReadRows<FPType, cpu> weightsRows(const_cast<NumericTable *>(_weights), 0, outRows);
+                DAAL_CHECK_BLOCK_STATUS(weightsRows);
+                const FPType * const weights = weightsRows.get();
+
+                _sortedWeights.reset(outRows);
+                DAAL_CHECK_MALLOC(_sortedWeights.get());
+                for (size_t i = 0; i < outRows; i++)
+                {
+                    _sortedWeights[i] = weights[_sortedIndices[i]];
+                }
+            }
+        }
+
+        _nOutRows = outRows;
+        _isBuilt  = true;
+        return services::Status();
+    }
+
+    services::Status searchRow(const FPType * x, size_t * buffer, Neighborhood<FPType, cpu> & neigh) const
+    {
+        if (!_nOutRows)
+        {
+            return services::Status();
+        }
+
+        const size_t dim            = _dim;
+        const size_t nOutRows       = _nOutRows;
+        const FPType epsP           = _epsP;
+        const FPType * const data   = _sortedData.get();
+        const size_t * const idx    = _sortedIndices.get();
+        const FPType * const weight = _sortedWeights.get();
+
+        return _index.forEachCandidateRange(x, buffer, [&](size_t begin, size_t end) -> services::Status {
+            const size_t chunkSize = 64;
+            FPType dist[chunkSize];
+            for (size_t i1 = begin; i1 < end; i1 += chunkSize)
+            {
+                const size_t i2 = (i1 + chunkSize < end ? i1 + chunkSize : end);
+                squaredDistancesSoA<FPType, cpu>(x, data + i1, nOutRows, i2 - i1, dim, dist);
+                for (size_t i = i1; i < i2; i++)
+                {
+                    if (dist[i - i1] <= epsP)
+                    {
+                        services::Status s = neigh.add(idx[i], (weight ? weight[i] : (FPType)1.0));
+                        DAAL_CHECK_STATUS_VAR(s);
+                    }
+                }
+            }
+            return services::Status();
+        });
+    }
+
+    const NumericTable * _inTable;
+    const NumericTable * _outTable;
+    const NumericTable * _weights;
+
+    FPType _eps;
+    FPType _p;
+    FPType _epsP;
+
+    size_t _dim;
+    size_t _nOutRows;
+    bool _isBuilt;
+
+    Index _index;
+    TArray<FPType, cpu> _sortedData; /* Rows of the out table in the order of the index, stored by columns */
+    TArray<size_t, cpu> _sortedIndices;
+    TArray<FPType, cpu> _sortedWeights;
+};
+
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<gridDense, FPType, cpu> : public IndexedNeighborhoodEngine<GridIndex<FPType, cpu>, FPType, cpu>
+{
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : IndexedNeighborhoodEngine<GridIndex<FPType, cpu>, FPType, cpu>(inTable, outTable, weights, eps, p)
+    {}
+};
+
+template <typename FPType, CpuType cpu>
+class NeighborhoodEngine<kdTreeDense, FPType, cpu> : public IndexedNeighborhoodEngine<KdTreeIndex<FPType, cpu>, FPType, cpu>
+{
+public:
+    NeighborhoodEngine(const NumericTable * inTable, const NumericTable * outTable, const NumericTable * weights, FPType eps, FPType p)
+        : IndexedNeighborhoodEngine<KdTreeIndex<FPType, cpu>, FPType, cpu>(inTable, outTable, weights, eps, p)
+    {}
+};
+
+/* Lock-free disjoint sets over the indices of the observations. A root is linked only by the compare-and-swap
+   of its own parent entry and always under the smaller root, so the root of a set is the smallest index in it
+   and every parent index is not greater than the index of the entry. The concurrent unite() calls write nothing
+   but these compare-and-swaps, the paths are compressed by compress() once the sets are merged */
+template <CpuType cpu>
+class UnionFind
+{
+public:
+    static int find(const int * parent, int x)
+    {
+        while (parent[x] != x)
+        {
+            x = parent[x];
+        }
+        return x;
+    }
+
+    /* Serial pass that points every entry to its root. The parents precede their children, so the parent
+       of an entry already points to the root when the entry is visited */
+    static void compress(int * parent, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            parent[i] = parent[parent[i]];
+        }
+    }
+
+    static void unite(int * parent, int a, int b)
+    {
+        while (true)
+        {
+            a = find(parent, a);
+            b = find(parent, b);
+            if (a == b)
+            {
+                return;
+            }
+            if (a < b)
+            {
+                swap<cpu, int>(a, b);
+            }
+            if (daal::atomic_compare_exchange(&parent[a], a, b) == a)
+            {
+                return;
+            }
+        }
+    }
+};
+
 template <typename FPType, CpuType cpu>
 FPType findKthStatistic(FPType * values, size_t nElements, size_t k)
 {
@@ -0,0 +1,260 @@
+/* file: dbscan_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of DBSCAN OpenCL kernels.
+//--
+*/
+
+#ifndef __DBSCAN_CL_KERNELS_CL__
+#define __DBSCAN_CL_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    dbscan_cl_kernels,
+
+    __kernel void computeSquares(const __global algorithmFPType * x, uint nFeatures, __global algorithmFPType * sqNorms) {
+        const uint i                        = get_global_id(0);
+        const __global algorithmFPType * xi = x + (ulong)i * nFeatures;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint j = 0; j < nFeatures; j++)
+        {
+            sum += xi[j] * xi[j];
+        }
+        sqNorms[i] = sum;
+    }
+
+    __kernel void initLabels(__global int * labels) {
+        const int i = get_global_id(0);
+        labels[i]   = i;
+    }
+
+    /* Squared distance between the row of the tile and the observation j computed from the row of the Gram matrix of the tile */
+    algorithmFPType tileDistance(const __global algorithmFPType * gramRow, const __global algorithmFPType * sqNorms, uint row, uint j) {
+        return sqNorms[row] + sqNorms[j] - (algorithmFPType)2 * gramRow[j];
+    }
+
+    /* The rows of the tile are processed by the work-groups, the observations are split between the work-items of the group */
+    __kernel void countNeighbors(const __global algorithmFPType * gram, const __global algorithmFPType * sqNorms,
+                                 const __global algorithmFPType * weights, uint n, uint rowOffset, algorithmFPType eps2,
+                                 algorithmFPType minObservations, __global int * nNeighbors, __global int * isCore) {
+        __local algorithmFPType localWeights[LOCAL_SIZE];
+        __local int localCounts[LOCAL_SIZE];
+
+        const uint i       = get_group_id(0);
+        const uint localId = get_local_id(0);
+        const uint row     = rowOffset + i;
+
+        const __global algorithmFPType * gramRow = gram + (ulong)i * n;
+
+        algorithmFPType weight = (algorithmFPType)0;
+        int count              = 0;
+        for (uint j = localId; j < n; j += LOCAL_SIZE)
+        {
+            if (tileDistance(gramRow, sqNorms, row, j) <= eps2)
+            {
+                weight += weights[j];
+                count++;
+            }
+        }
+        localWeights[localId] = weight;
+        localCounts[localId]  = count;
+
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride)
+            {
+                localWeights[localId] += localWeights[localId + stride];
+                localCounts[localId] += localCounts[localId + stride];
+            }
+        }
+
+        if (localId == 0)
+        {
+            nNeighbors[row] = localCounts[0];
+            isCore[row]     = (localWeights[0] >= minObservations) ? 1 : 0;
+        }
+    }
+
+    /* Writes the indices of the neighbors of the rows of the tile into the adjacency lists, the order within the list is arbitrary */
+    __kernel void writeNeighbors(const __global algorithmFPType * gram, const __global algorithmFPType * sqNorms, uint n, uint rowOffset,
+                                 algorithmFPType eps2, const __global int * offsets, __global int * neighbors) {
+        __local int position;
+
+        const uint i       = get_group_id(0);
+        const uint localId = get_local_id(0);
+        const uint row     = rowOffset + i;
+
+        const __global algorithmFPType * gramRow = gram + (ulong)i * n;
+        __global int * rowNeighbors              = neighbors + offsets[row];
+
+        if (localId == 0)
+        {
+            position = 0;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint j = localId; j < n; j += LOCAL_SIZE)
+        {
+            if (tileDistance(gramRow, sqNorms, row, j) <= eps2)
+            {
+                rowNeighbors[atomic_inc(&position)] = j;
+            }
+        }
+    }
+
+    /* Hooks the core observation and the root of its component to the smallest label of its core neighbors */
+    void hookLabel(__global int * labels, uint row, int label, __global int * changed) {
+        const int current = labels[row];
+        if (label < current)
+        {
+            atomic_min(labels + current, label);
+            atomic_min(labels + row, label);
+            changed[0] = 1;
+        }
+    }
+
+    __kernel void propagateLabels(const __global int * offsets, const __global int * neighbors, const __global int * isCore, __global int * labels,
+                                  __global int * changed) {
+        const uint i = get_global_id(0);
+        if (!isCore[i]) return;
+
+        int label = labels[i];
+        for (int k = offsets[i]; k < offsets[i + 1]; k++)
+        {
+            const int j = neighbors[k];
+            if (isCore[j] && labels[j] < label) label = labels[j];
+        }
+        hookLabel(labels, i, label, changed);
+    }
+
+    /* Same as propagateLabels for the rows of the tile with the neighbors found in the Gram matrix of the tile */
+    __kernel void propagateLabelsTile(const __global algorithmFPType * gram, const __global algorithmFPType * sqNorms, uint n, uint rowOffset,
+                                      algorithmFPType eps2, const __global int * isCore, __global int * labels, __global int * changed) {
+        __local int localLabels[LOCAL_SIZE];
+
+        const uint i       = get_group_id(0);
+        const uint localId = get_local_id(0);
+        const uint row     = rowOffset + i;
+        if (!isCore[row]) return;
+
+        const __global algorithmFPType * gramRow = gram + (ulong)i * n;
+
+        int label = labels[row];
+        for (uint j = localId; j < n; j += LOCAL_SIZE)
+        {
+            if (isCore[j] && labels[j] < label && tileDistance(gramRow, sqNorms, row, j) <= eps2) label = labels[j];
+        }
+        localLabels[localId] = label;
+
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride && localLabels[localId + stride] < localLabels[localId])
+            {
+                localLabels[localId] = localLabels[localId + stride];
+            }
+        }
+
+        if (localId == 0)
+        {
+            hookLabel(labels, row, localLabels[0], changed);
+        }
+    }
+
+    /* Replaces the labels of the core observations by the roots of their components */
+    __kernel void compressLabels(const __global int * isCore, __global int * labels) {
+        const uint i = get_global_id(0);
+        if (!isCore[i]) return;
+
+        int label = labels[i];
+        while (labels[label] != label)
+        {
+            label = labels[label];
+        }
+        labels[i] = label;
+    }
+
+    /* The border observation joins the component of its core neighbor with the smallest label, -1 marks the noise */
+    __kernel void assignBorders(const __global int * offsets, const __global int * neighbors, const __global int * isCore, __global int * labels) {
+        const uint i = get_global_id(0);
+        if (isCore[i]) return;
+
+        int label = -1;
+        for (int k = offsets[i]; k < offsets[i + 1]; k++)
+        {
+            const int j = neighbors[k];
+            if (isCore[j] && (label < 0 || labels[j] < label)) label = labels[j];
+        }
+        labels[i] = label;
+    }
+
+    __kernel void assignBordersTile(const __global algorithmFPType * gram, const __global algorithmFPType * sqNorms, uint n, uint rowOffset,
+                                    algorithmFPType eps2, const __global int * isCore, __global int * labels) {
+        __local int localLabels[LOCAL_SIZE];
+
+        const uint i       = get_group_id(0);
+        const uint localId = get_local_id(0);
+        const uint row     = rowOffset + i;
+        if (isCore[row]) return;
+
+        const __global algorithmFPType * gramRow = gram + (ulong)i * n;
+
+        int label = -1;
+        for (uint j = localId; j < n; j += LOCAL_SIZE)
+        {
+            if (isCore[j] && (label < 0 || labels[j] < label) && tileDistance(gramRow, sqNorms, row, j) <= eps2) label = labels[j];
+        }
+        localLabels[localId] = label;
+
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            const int other = (localId < stride) ? localLabels[localId + stride] : -1;
+            if (other >= 0 && (localLabels[localId] < 0 || other < localLabels[localId]))
+            {
+                localLabels[localId] = other;
+            }
+        }
+
+        if (localId == 0)
+        {
+            labels[row] = localLabels[0];
+        }
+    }
+
+    /* Maps the roots of the components to the numbers of the clusters */
+    __kernel void makeAssignments(const __global int * labels, const __global int * clusterIds, __global int * assignments) {
+        const uint i   = get_global_id(0);
+        const int root = labels[i];
+        assignments[i] = (root < 0) ? -1 : clusterIds[root];
+    }
+
+    __kernel void gatherRows(const __global algorithmFPType * x, const __global int * indices, uint nFeatures, __global algorithmFPType * xSubset) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        xSubset[i * nFeatures + j] = x[(ulong)indices[i] * nFeatures + j];
+    }
+
+);
+
+#endif
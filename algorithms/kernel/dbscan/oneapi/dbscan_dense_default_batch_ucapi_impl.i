@@ -0,0 +1,448 @@
+/* file: dbscan_dense_default_batch_ucapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of DBSCAN on GPU. The epsilon-neighborhoods are found in the tiles of the Gram matrix computed by GEMM,
+//  the clusters are the connected components of the core observations labeled by the parallel hooking of the minimal labels.
+//--
+*/
+
+#ifndef __DBSCAN_DENSE_DEFAULT_BATCH_UCAPI_IMPL_I__
+#define __DBSCAN_DENSE_DEFAULT_BATCH_UCAPI_IMPL_I__
+
+#include "algorithms/kernel/dbscan/oneapi/cl_kernels/dbscan_cl_kernels.cl"
+#include "service/kernel/oneapi/blas_gpu.h"
+#include "service/kernel/service_data_utils.h"
+#include "externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(dbscan.dense.default.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services;
+
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    Status status;
+    services::String options = getKeyFPType<algorithmFPType>();
+    options.add(" -D LOCAL_SIZE=256 "); // should be equal to localSize
+
+    services::String cachekey("__daal_algorithms_dbscan_dense_batch_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), dbscan_cl_kernels, options.c_str(), &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::computeGramTile(uint32_t rowOffset, uint32_t nTileRows)
+{
+    return BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, nTileRows, _nRows, _nFeatures,
+                                           algorithmFPType(1.0), _data, _nFeatures, rowOffset * _nFeatures, _data, _nFeatures, 0,
+                                           algorithmFPType(0.0), _gram, _nRows, 0);
+}
+
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::runTileKernel(const char * name, uint32_t rowOffset, uint32_t nTileRows, KernelArguments & args)
+{
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    KernelPtr kernel = ctx.getClKernelFactory().getKernel(name, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelRange localRange(localSize);
+    KernelRange globalRange(nTileRows * localSize);
+    KernelNDRange range(1);
+    range.global(globalRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::compute(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments,
+                                                        NumericTable * ntNClusters, NumericTable * ntCoreIndices, NumericTable * ntCoreObservations,
+                                                        const Parameter * par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    const size_t nRows     = ntData->getNumberOfRows();
+    const size_t nFeatures = ntData->getNumberOfColumns();
+    DAAL_CHECK(nRows < size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_CHECK(nFeatures <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+
+    _nRows     = uint32_t(nRows);
+    _nFeatures = uint32_t(nFeatures);
+    _tileRows  = uint32_t(maxTileSize / _nRows ? maxTileSize / _nRows : 1);
+    _tileRows  = (_tileRows < _nRows) ? _tileRows : _nRows;
+    _eps2      = algorithmFPType(par->epsilon * par->epsilon);
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    DAAL_CHECK_STATUS(status, buildProgram(ctx.getClKernelFactory()));
+
+    NumericTable * dataTable    = const_cast<NumericTable *>(ntData);
+    NumericTable * weightsTable = const_cast<NumericTable *>(ntWeights);
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, dataTable->getBlockOfRows(0, nRows, ReadWriteMode::readOnly, dataBlock));
+    _data = dataBlock.getBuffer();
+
+    const TypeId idType = TypeIds::id<algorithmFPType>();
+    _sqNorms            = ctx.allocate(idType, _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _gram = ctx.allocate(idType, size_t(_tileRows) * _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _isCore = ctx.allocate(TypeIds::id<int>(), _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _labels = ctx.allocate(TypeIds::id<int>(), _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _offsets = ctx.allocate(TypeIds::id<int>(), _nRows + 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        KernelPtr kernel = ctx.getClKernelFactory().getKernel("computeSquares", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        KernelArguments args(3);
+        args.set(0, _data, AccessModeIds::read);
+        args.set(1, _nFeatures);
+        args.set(2, _sqNorms, AccessModeIds::write);
+        KernelRange range(_nRows);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    bool memorySavingMode = par->memorySavingMode;
+    {
+        BlockDescriptor<algorithmFPType> weightsBlock;
+        UniversalBuffer weights;
+        if (weightsTable)
+        {
+            DAAL_CHECK_STATUS(status, weightsTable->getBlockOfRows(0, nRows, ReadWriteMode::readOnly, weightsBlock));
+            weights = weightsBlock.getBuffer();
+        }
+        else
+        {
+            weights = ctx.allocate(idType, _nRows, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            ctx.fill(weights, 1.0, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
+        DAAL_CHECK_STATUS(status, findNeighbors(weights, algorithmFPType(par->minObservations), memorySavingMode));
+        if (weightsTable)
+        {
+            DAAL_CHECK_STATUS(status, weightsTable->releaseBlockOfRows(weightsBlock));
+        }
+    }
+
+    DAAL_CHECK_STATUS(status, labelComponents(memorySavingMode));
+    DAAL_CHECK_STATUS(status, processResults(ntAssignments, ntNClusters, ntCoreIndices, ntCoreObservations, par->resultsToCompute));
+    return dataTable->releaseBlockOfRows(dataBlock);
+}
+
+/* The neighbors are counted in the first pass over the tiles. Unless the memory saving mode is on, the second pass writes
+ * the adjacency lists, the mode is turned on if the total size of the lists does not fit into int */
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::findNeighbors(const UniversalBuffer & weights, algorithmFPType minObservations,
+                                                              bool & memorySavingMode)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.findNeighbors);
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    for (uint32_t rowOffset = 0; rowOffset < _nRows; rowOffset += _tileRows)
+    {
+        const uint32_t nTileRows = (_nRows - rowOffset < _tileRows) ? _nRows - rowOffset : _tileRows;
+        DAAL_CHECK_STATUS(status, computeGramTile(rowOffset, nTileRows));
+
+        KernelArguments args(9);
+        args.set(0, _gram, AccessModeIds::read);
+        args.set(1, _sqNorms, AccessModeIds::read);
+        args.set(2, weights, AccessModeIds::read);
+        args.set(3, _nRows);
+        args.set(4, rowOffset);
+        args.set(5, _eps2);
+        args.set(6, minObservations);
+        args.set(7, _offsets, AccessModeIds::write);
+        args.set(8, _isCore, AccessModeIds::write);
+        DAAL_CHECK_STATUS(status, runTileKernel("countNeighbors", rowOffset, nTileRows, args));
+    }
+    if (memorySavingMode) return status;
+
+    size_t nNeighbors = 0;
+    {
+        /* Exclusive prefix sum of the numbers of the neighbors */
+        auto offsetsHost = _offsets.template get<int>().toHost(ReadWriteMode::readWrite, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        int * offsets = offsetsHost.get();
+        for (uint32_t i = 0; i < _nRows; i++)
+        {
+            const size_t count = size_t(offsets[i]);
+            offsets[i]         = int(nNeighbors < size_t(services::internal::MaxVal<int>::get()) ? nNeighbors : 0);
+            nNeighbors += count;
+        }
+        offsets[_nRows] = int(nNeighbors < size_t(services::internal::MaxVal<int>::get()) ? nNeighbors : 0);
+    }
+    if (nNeighbors >= size_t(services::internal::MaxVal<int>::get()))
+    {
+        memorySavingMode = true;
+        return status;
+    }
+
+    _neighbors = ctx.allocate(TypeIds::id<int>(), nNeighbors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    for (uint32_t rowOffset = 0; rowOffset < _nRows; rowOffset += _tileRows)
+    {
+        const uint32_t nTileRows = (_nRows - rowOffset < _tileRows) ? _nRows - rowOffset : _tileRows;
+        DAAL_CHECK_STATUS(status, computeGramTile(rowOffset, nTileRows));
+
+        KernelArguments args(7);
+        args.set(0, _gram, AccessModeIds::read);
+        args.set(1, _sqNorms, AccessModeIds::read);
+        args.set(2, _nRows);
+        args.set(3, rowOffset);
+        args.set(4, _eps2);
+        args.set(5, _offsets, AccessModeIds::read);
+        args.set(6, _neighbors, AccessModeIds::write);
+        DAAL_CHECK_STATUS(status, runTileKernel("writeNeighbors", rowOffset, nTileRows, args));
+    }
+    return status;
+}
+
+/* Each iteration hooks the core observations to the smallest labels of their core neighbors and compresses the paths to the roots,
+ * until no label changes. In the memory saving mode the neighbors are found again in the tiles of the Gram matrix at each iteration */
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::labelComponents(bool memorySavingMode)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.labelComponents);
+    Status status;
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    const KernelRange range(_nRows);
+
+    {
+        KernelPtr kernel = factory.getKernel("initLabels", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        KernelArguments args(1);
+        args.set(0, _labels, AccessModeIds::write);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    UniversalBuffer changed = ctx.allocate(TypeIds::id<int>(), 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    KernelPtr compressKernel = factory.getKernel("compressLabels", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    bool isChanged = true;
+    while (isChanged)
+    {
+        ctx.fill(changed, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        if (memorySavingMode)
+        {
+            for (uint32_t rowOffset = 0; rowOffset < _nRows; rowOffset += _tileRows)
+            {
+                const uint32_t nTileRows = (_nRows - rowOffset < _tileRows) ? _nRows - rowOffset : _tileRows;
+                DAAL_CHECK_STATUS(status, computeGramTile(rowOffset, nTileRows));
+
+                KernelArguments args(8);
+                args.set(0, _gram, AccessModeIds::read);
+                args.set(1, _sqNorms, AccessModeIds::read);
+                args.set(2, _nRows);
+                args.set(3, rowOffset);
+                args.set(4, _eps2);
+                args.set(5, _isCore, AccessModeIds::read);
+                args.set(6, _labels, AccessModeIds::readwrite);
+                args.set(7, changed, AccessModeIds::write);
+                DAAL_CHECK_STATUS(status, runTileKernel("propagateLabelsTile", rowOffset, nTileRows, args));
+            }
+        }
+        else
+        {
+            KernelPtr kernel = factory.getKernel("propagateLabels", &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            KernelArguments args(5);
+            args.set(0, _offsets, AccessModeIds::read);
+            args.set(1, _neighbors, AccessModeIds::read);
+            args.set(2, _isCore, AccessModeIds::read);
+            args.set(3, _labels, AccessModeIds::readwrite);
+            args.set(4, changed, AccessModeIds::write);
+            ctx.run(range, kernel, args, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+        }
+
+        KernelArguments compressArgs(2);
+        compressArgs.set(0, _isCore, AccessModeIds::read);
+        compressArgs.set(1, _labels, AccessModeIds::readwrite);
+        ctx.run(range, compressKernel, compressArgs, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        auto changedHost = changed.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        isChanged = (changedHost.get()[0] != 0);
+    }
+
+    /* The border observations take the labels of the roots, so they are assigned after the labels of the core observations converge */
+    if (memorySavingMode)
+    {
+        for (uint32_t rowOffset = 0; rowOffset < _nRows; rowOffset += _tileRows)
+        {
+            const uint32_t nTileRows = (_nRows - rowOffset < _tileRows) ? _nRows - rowOffset : _tileRows;
+            DAAL_CHECK_STATUS(status, computeGramTile(rowOffset, nTileRows));
+
+            KernelArguments args(7);
+            args.set(0, _gram, AccessModeIds::read);
+            args.set(1, _sqNorms, AccessModeIds::read);
+            args.set(2, _nRows);
+            args.set(3, rowOffset);
+            args.set(4, _eps2);
+            args.set(5, _isCore, AccessModeIds::read);
+            args.set(6, _labels, AccessModeIds::readwrite);
+            DAAL_CHECK_STATUS(status, runTileKernel("assignBordersTile", rowOffset, nTileRows, args));
+        }
+        return status;
+    }
+
+    KernelPtr kernel = factory.getKernel("assignBorders", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    KernelArguments args(4);
+    args.set(0, _offsets, AccessModeIds::read);
+    args.set(1, _neighbors, AccessModeIds::read);
+    args.set(2, _isCore, AccessModeIds::read);
+    args.set(3, _labels, AccessModeIds::readwrite);
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+/* The roots are numbered in the order of the observations, which gives the same numbering of the clusters as the CPU kernel */
+template <typename algorithmFPType>
+Status DBSCANBatchKernelUCAPI<algorithmFPType>::processResults(NumericTable * ntAssignments, NumericTable * ntNClusters, NumericTable * ntCoreIndices,
+                                                               NumericTable * ntCoreObservations, DAAL_UINT64 resultsToCompute)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.processResults);
+    Status status;
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    UniversalBuffer clusterIds = ctx.allocate(TypeIds::id<int>(), _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    size_t nClusters = 0;
+    size_t nCore     = 0;
+    {
+        auto labelsHost = _labels.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto isCoreHost = _isCore.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto clusterIdsHost = clusterIds.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        const int * labels = labelsHost.get();
+        const int * isCore = isCoreHost.get();
+        int * ids          = clusterIdsHost.get();
+        for (uint32_t i = 0; i < _nRows; i++)
+        {
+            ids[i] = (isCore[i] && labels[i] == int(i)) ? int(nClusters++) : -1;
+            nCore += size_t(isCore[i] != 0);
+        }
+    }
+
+    {
+        BlockDescriptor<int> assignmentsBlock;
+        DAAL_CHECK_STATUS(status, ntAssignments->getBlockOfRows(0, _nRows, ReadWriteMode::writeOnly, assignmentsBlock));
+        KernelPtr kernel = factory.getKernel("makeAssignments", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        KernelArguments args(3);
+        args.set(0, _labels, AccessModeIds::read);
+        args.set(1, clusterIds, AccessModeIds::read);
+        args.set(2, assignmentsBlock.getBuffer(), AccessModeIds::write);
+        KernelRange range(_nRows);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, ntAssignments->releaseBlockOfRows(assignmentsBlock));
+    }
+    {
+        BlockDescriptor<int> nClustersBlock;
+        DAAL_CHECK_STATUS(status, ntNClusters->getBlockOfRows(0, 1, ReadWriteMode::writeOnly, nClustersBlock));
+        ctx.fill(nClustersBlock.getBuffer(), double(nClusters), &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, ntNClusters->releaseBlockOfRows(nClustersBlock));
+    }
+
+    if (nCore == 0 || !(resultsToCompute & (computeCoreIndices | computeCoreObservations))) return status;
+
+    /* The indices of the core observations are collected in place of the cluster numbers, they are not needed anymore */
+    UniversalBuffer & coreIndices = clusterIds;
+    {
+        auto isCoreHost = _isCore.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        auto coreIndicesHost = coreIndices.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        for (uint32_t i = 0, pos = 0; i < _nRows; i++)
+        {
+            if (isCoreHost.get()[i]) coreIndicesHost.get()[pos++] = int(i);
+        }
+    }
+
+    if (resultsToCompute & computeCoreIndices)
+    {
+        DAAL_CHECK_STATUS(status, ntCoreIndices->resize(nCore));
+        BlockDescriptor<int> block;
+        DAAL_CHECK_STATUS(status, ntCoreIndices->getBlockOfRows(0, nCore, ReadWriteMode::writeOnly, block));
+        ctx.copy(block.getBuffer(), 0, coreIndices, 0, nCore, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, ntCoreIndices->releaseBlockOfRows(block));
+    }
+
+    if (resultsToCompute & computeCoreObservations)
+    {
+        DAAL_CHECK_STATUS(status, ntCoreObservations->resize(nCore));
+        BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(status, ntCoreObservations->getBlockOfRows(0, nCore, ReadWriteMode::writeOnly, block));
+        KernelPtr kernel = factory.getKernel("gatherRows", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        KernelArguments args(4);
+        args.set(0, _data, AccessModeIds::read);
+        args.set(1, coreIndices, AccessModeIds::read);
+        args.set(2, _nFeatures);
+        args.set(3, block.getBuffer(), AccessModeIds::write);
+        KernelRange range(nCore, _nFeatures);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, ntCoreObservations->releaseBlockOfRows(block));
+    }
+    return status;
+}
+
+} // namespace internal
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,89 @@
+/* file: dbscan_kernel_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class that computes DBSCAN on GPU.
+//--
+*/
+
+#ifndef __DBSCAN_KERNEL_UCAPI_H__
+#define __DBSCAN_KERNEL_UCAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "algorithms/dbscan/dbscan_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType>
+class DBSCANBatchKernelUCAPI : public Kernel
+{
+public:
+    services::Status compute(const NumericTable * ntData, const NumericTable * ntWeights, NumericTable * ntAssignments, NumericTable * ntNClusters,
+                             NumericTable * ntCoreIndices, NumericTable * ntCoreObservations, const Parameter * par);
+
+private:
+    /* Number of work-items in the work-group that processes one row of the tile */
+    static const uint32_t localSize = 256;
+
+    /* Maximal number of elements in the (rows x observations) tile of the Gram matrix */
+    static const uint32_t maxTileSize = 16 * 1024 * 1024;
+
+    services::Status buildProgram(oneapi::internal::ClKernelFactoryIface & factory);
+
+    /* Computes the rows [rowOffset, rowOffset + nTileRows) of the Gram matrix of the data */
+    services::Status computeGramTile(uint32_t rowOffset, uint32_t nTileRows);
+
+    services::Status runTileKernel(const char * name, uint32_t rowOffset, uint32_t nTileRows, oneapi::internal::KernelArguments & args);
+
+    services::Status findNeighbors(const oneapi::internal::UniversalBuffer & weights, algorithmFPType minObservations, bool & memorySavingMode);
+
+    services::Status labelComponents(bool memorySavingMode);
+
+    services::Status processResults(NumericTable * ntAssignments, NumericTable * ntNClusters, NumericTable * ntCoreIndices,
+                                    NumericTable * ntCoreObservations, DAAL_UINT64 resultsToCompute);
+
+    oneapi::internal::UniversalBuffer _data;
+    oneapi::internal::UniversalBuffer _sqNorms;
+    oneapi::internal::UniversalBuffer _gram;
+    oneapi::internal::UniversalBuffer _isCore;
+    oneapi::internal::UniversalBuffer _labels;
+    oneapi::internal::UniversalBuffer _offsets;   /* Offsets of the adjacency lists, nRows + 1 elements */
+    oneapi::internal::UniversalBuffer _neighbors; /* Adjacency lists of the observations, not used in the memory saving mode */
+    uint32_t _nRows;
+    uint32_t _nFeatures;
+    uint32_t _tileRows;
+    algorithmFPType _eps2;
+};
+
+} // namespace internal
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,261 @@
+/* file: decision_tree_blocked_forest_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Decision trees compiled into the structure of arrays and traversed
+//  by blocks of rows, the same format as used by the decision forest prediction
+//--
+*/
+
+#ifndef __DECISION_TREE_BLOCKED_FOREST_IMPL_I__
+#define __DECISION_TREE_BLOCKED_FOREST_IMPL_I__
+
+#include "algorithms/threading/threading.h"
+#include "data_management/data/numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_utils.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/decision_tree/decision_tree_classification_model_impl.h"
+#include "algorithms/kernel/decision_tree/decision_tree_regression_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_tree
+{
+namespace internal
+{
+using namespace daal::internal;
+
+/* Access to the fields of the nodes of the classification and regression trees, the value of the classification leaf is the class label */
+struct BlockedNodeHelper
+{
+    static size_t dimension(const classification::DecisionTreeNode & n) { return n.dimension; }
+    static size_t leftIndex(const classification::DecisionTreeNode & n) { return n.leftIndexOrClass; }
+    static double value(const classification::DecisionTreeNode & n)
+    {
+        return (n.dimension != static_cast<size_t>(-1)) ? n.cutPoint : double(n.leftIndexOrClass);
+    }
+
+    static size_t dimension(const regression::DecisionTreeNode & n) { return n.dimension; }
+    static size_t leftIndex(const regression::DecisionTreeNode & n) { return n.leftIndex; }
+    static double value(const regression::DecisionTreeNode & n) { return n.cutPointOrDependantVariable; }
+};
+
+/* Set of decision trees stored as the arrays of the split features, the left children and the split values or the leaf values.
+   The nodes keep their indices in the tree table, the right child follows the left one */
+template <typename algorithmFPType, CpuType cpu>
+class BlockedForest
+{
+public:
+    static const size_t s_cVectorBlockSize = 32;
+    static const size_t s_cRowsInBlock     = 512;
+
+    /* The block traversal supports ordered splits only, the trees with categorical splits are traversed node by node */
+    static bool hasUnorderedFeatures(const data_management::NumericTable & x)
+    {
+        const size_t nCols = x.getNumberOfColumns();
+        for (size_t i = 0; i < nCols; ++i)
+        {
+            if (x.getFeatureType(i) == data_management::features::DAAL_CATEGORICAL) return true;
+        }
+        return false;
+    }
+
+    /* Converts the trees given by the tables of the nodes of type NodeType */
+    template <typename NodeType, typename TreeTable>
+    services::Status convert(const TreeTable * const * aTree, size_t nTrees);
+
+    /* Converts the weak learners of the boosting model, bConverted is set to false if one of them is not a tree of type TreeModel */
+    template <typename TreeModel, typename NodeType, typename BoostModel>
+    services::Status convertWeakLearners(const BoostModel & boostModel, size_t nWeakLearners, bool & bConverted);
+
+    size_t getNumberOfTrees() const { return _nTrees; }
+
+    /* Value of the leaf iNode of the tree iTree: class label for the classification tree, response for the regression one */
+    double getLeafValue(size_t iTree, int iNode) const { return _tFV.get()[_treeOffsets.get()[iTree] + iNode]; }
+
+    /* Returns the index of the leaf of the tree iTree reached by the row x */
+    int predictByTree(size_t iTree, const algorithmFPType * x) const;
+
+    /* Passes s_cVectorBlockSize rows through the trees, all rows descend one level per pass.
+       onLeaves(iTree, leaves) receives the indices of the leaves reached by the rows */
+    template <typename OnLeaves>
+    void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nCols, const OnLeaves & onLeaves) const;
+
+    /* Passes all rows of x through all trees in one pass over the data. onLeaves(iRow, nRows, iTree, leaves) is called for each tree
+       in the order of the trees with the leaves reached by the rows [iRow, iRow + nRows), different rows are processed in parallel */
+    template <typename OnLeaves>
+    services::Status predict(const data_management::NumericTable & x, const OnLeaves & onLeaves) const;
+
+private:
+    TArray<int, cpu> _tFI;    /* split: feature index, leaf: -1 */
+    TArray<int, cpu> _tLC;    /* split: index of the left child in the tree */
+    TArray<double, cpu> _tFV; /* split: feature value, leaf: class label or response */
+    TArray<size_t, cpu> _treeOffsets;
+    size_t _nTrees = 0;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename NodeType, typename TreeTable>
+services::Status BlockedForest<algorithmFPType, cpu>::convert(const TreeTable * const * aTree, size_t nTrees)
+{
+    _nTrees = nTrees;
+    _treeOffsets.reset(nTrees + 1);
+    DAAL_CHECK_MALLOC(_treeOffsets.get());
+    size_t * const offsets = _treeOffsets.get();
+    offsets[0]             = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree) offsets[iTree + 1] = offsets[iTree] + aTree[iTree]->getNumberOfRows();
+
+    const size_t nNodesTotal = offsets[nTrees];
+    _tFI.reset(nNodesTotal);
+    _tLC.reset(nNodesTotal);
+    _tFV.reset(nNodesTotal);
+    DAAL_CHECK_MALLOC(_tFI.get() && _tLC.get() && _tFV.get());
+
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree) {
+        const NodeType * const aNode = static_cast<const NodeType *>(aTree[iTree]->getArray());
+        const size_t treeSize        = offsets[iTree + 1] - offsets[iTree];
+        int * const fi               = _tFI.get() + offsets[iTree];
+        int * const lc               = _tLC.get() + offsets[iTree];
+        double * const fv            = _tFV.get() + offsets[iTree];
+
+        for (size_t i = 0; i < treeSize; ++i)
+        {
+            const bool isSplit = (BlockedNodeHelper::dimension(aNode[i]) != static_cast<size_t>(-1));
+            fi[i]              = isSplit ? int(BlockedNodeHelper::dimension(aNode[i])) : -1;
+            lc[i]              = isSplit ? int(BlockedNodeHelper::leftIndex(aNode[i])) : 0;
+            fv[i]              = BlockedNodeHelper::value(aNode[i]);
+        }
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename TreeModel, typename NodeType, typename BoostModel>
+services::Status BlockedForest<algorithmFPType, cpu>::convertWeakLearners(const BoostModel & boostModel, size_t nWeakLearners, bool & bConverted)
+{
+    bConverted = false;
+    if (!nWeakLearners) return services::Status();
+
+    TArray<const data_management::AOSNumericTable *, cpu> aTree(nWeakLearners);
+    DAAL_CHECK_MALLOC(aTree.get());
+    for (size_t i = 0; i < nWeakLearners; ++i)
+    {
+        /* The weak learner models are kept by the boosting model, the pointers to their tables stay valid */
+        const TreeModel * const treeModel = dynamic_cast<const TreeModel *>(boostModel.getWeakLearnerModel(i).get());
+        if (!treeModel || !treeModel->impl()) return services::Status();
+        aTree[i] = treeModel->impl()->getTreeTable().get();
+        if (!aTree[i] || !aTree[i]->getNumberOfRows()) return services::Status();
+    }
+
+    const services::Status s = convert<NodeType>(aTree.get(), nWeakLearners);
+    DAAL_CHECK_STATUS_VAR(s);
+    bConverted = true;
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+int BlockedForest<algorithmFPType, cpu>::predictByTree(size_t iTree, const algorithmFPType * x) const
+{
+    const int * const fi    = _tFI.get() + _treeOffsets.get()[iTree];
+    const int * const lc    = _tLC.get() + _treeOffsets.get()[iTree];
+    const double * const fv = _tFV.get() + _treeOffsets.get()[iTree];
+
+    int cn = 0;
+    while (fi[cn] != -1) cn = lc[cn] + (x[fi[cn]] > fv[cn]);
+    return cn;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename OnLeaves>
+void BlockedForest<algorithmFPType, cpu>::predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nCols,
+                                                               const OnLeaves & onLeaves) const
+{
+    int nodes[s_cVectorBlockSize];
+    for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        const int * const fi    = _tFI.get() + _treeOffsets.get()[iTree];
+        const int * const lc    = _tLC.get() + _treeOffsets.get()[iTree];
+        const double * const fv = _tFV.get() + _treeOffsets.get()[iTree];
+        services::internal::service_memset_seq<int, cpu>(nodes, 0, s_cVectorBlockSize);
+
+        /* The rows that reached a leaf stay there, the search stops when no row is left in a split node */
+        for (size_t check = (fi[0] != -1); check > 0;)
+        {
+            check = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < s_cVectorBlockSize; ++i)
+            {
+                const int cn      = nodes[i];
+                const int isSplit = (fi[cn] != -1);
+                const int idx     = isSplit * fi[cn];
+                const int sn      = (x[i * nCols + idx] > fv[cn]);
+                nodes[i]          = isSplit ? lc[cn] + sn : cn;
+                check += isSplit;
+            }
+        }
+        onLeaves(iTree, nodes);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <typename OnLeaves>
+services::Status BlockedForest<algorithmFPType, cpu>::predict(const data_management::NumericTable & x, const OnLeaves & onLeaves) const
+{
+    const size_t nRows     = x.getNumberOfRows();
+    const size_t nCols     = x.getNumberOfColumns();
+    const size_t nBlocks   = (nRows + s_cRowsInBlock - 1) / s_cRowsInBlock;
+    const bool bVectorPath = (cpu != __avx512_mic__);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStartRow      = iBlock * s_cRowsInBlock;
+        const size_t nRowsToProcess = (iBlock == nBlocks - 1) ? nRows - iStartRow : s_cRowsInBlock;
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<data_management::NumericTable *>(&x), iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType * const dx = xBD.get();
+
+        const size_t nVectorBlocks = bVectorPath ? nRowsToProcess / s_cVectorBlockSize : 0;
+        for (size_t iVectorBlock = 0; iVectorBlock < nVectorBlocks; ++iVectorBlock)
+        {
+            const size_t iRow = iVectorBlock * s_cVectorBlockSize;
+            predictByTreesVector(0, _nTrees, dx + iRow * nCols, nCols,
+                                 [&](size_t iTree, const int * leaves) { onLeaves(iStartRow + iRow, s_cVectorBlockSize, iTree, leaves); });
+        }
+        for (size_t iRow = nVectorBlocks * s_cVectorBlockSize; iRow < nRowsToProcess; ++iRow)
+        {
+            for (size_t iTree = 0; iTree < _nTrees; ++iTree)
+            {
+                const int leaf = predictByTree(iTree, dx + iRow * nCols);
+                onLeaves(iStartRow + iRow, 1, iTree, &leaf);
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace decision_tree
+} // namespace algorithms
+} // namespace daal
+
+#endif
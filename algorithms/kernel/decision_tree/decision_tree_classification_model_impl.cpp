@@ -118,6 +118,8 @@ services::Status Parameter::check() const
 
     DAAL_CHECK_EX(minObservationsInLeafNodes >= 1, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafNodesStr());
     DAAL_CHECK_EX(nBins == 1, services::ErrorIncorrectParameter, services::ParameterName, nBinsStr());
+    DAAL_CHECK_EX(maxBins >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
+    DAAL_CHECK_EX(minBinSize >= 1, services::ErrorIncorrectParameter, services::ParameterName, minBinSizeStr());
     return s;
 }
 
@@ -29,6 +29,7 @@
 #include "externals/service_memory.h"
 #include "service/kernel/service_utils.h"
 #include "data_management/data/numeric_table.h"
+#include "algorithms/kernel/decision_tree/decision_tree_presorted_features.h"
 
 namespace daal
 {
@@ -694,6 +695,14 @@ private:
     ValueType * _tempLg;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+struct HistogramCutPointFinder<cpu, GiniWeighted<algorithmFPType, cpu> > : public ClassHistogramCutPointFinder<cpu>
+{};
+
+template <typename algorithmFPType, CpuType cpu>
+struct HistogramCutPointFinder<cpu, InfoGainWeighted<algorithmFPType, cpu> > : public ClassHistogramCutPointFinder<cpu>
+{};
+
 } // namespace internal
 } // namespace decision_tree
 } // namespace algorithms
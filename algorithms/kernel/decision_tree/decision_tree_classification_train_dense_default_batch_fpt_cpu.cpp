@@ -17,7 +17,7 @@
 
 /*
 //++
-//  Implementation of Decision tree training functions for the defaultDense method.
+//  Implementation of Decision tree training functions for the defaultDense and hist methods.
 //--
 */
 
@@ -37,11 +37,13 @@ namespace training
 namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
 } // namespace interface2
 
 namespace internal
 {
 template class DecisionTreeTrainBatchKernel<DAAL_FPTYPE, decision_tree::classification::Parameter, defaultDense, DAAL_CPU>;
+template class DecisionTreeTrainBatchKernel<DAAL_FPTYPE, decision_tree::classification::Parameter, hist, DAAL_CPU>;
 
 } // namespace internal
 } // namespace training
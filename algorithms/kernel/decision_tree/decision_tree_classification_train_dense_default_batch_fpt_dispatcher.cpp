@@ -29,6 +29,8 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_tree::classification::training::BatchContainer, batch, DAAL_FPTYPE,
                                       decision_tree::classification::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_tree::classification::training::BatchContainer, batch, DAAL_FPTYPE,
+                                      decision_tree::classification::training::hist)
 
 } // namespace algorithms
 } // namespace daal
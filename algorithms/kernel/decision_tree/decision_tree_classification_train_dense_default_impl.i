@@ -331,8 +331,19 @@ static services::Status pruneAndConvertTree(const NumericTable * px, const Numer
     return status;
 }
 
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, training::defaultDense, cpu>::compute(
+/* Parameters of the version 1 interface have no binning settings, the hist method is not available for them */
+inline dtrees::internal::BinParams getBinParams(const decision_tree::classification::interface1::Parameter & parameter)
+{
+    return dtrees::internal::BinParams(256, 5);
+}
+
+inline dtrees::internal::BinParams getBinParams(const decision_tree::classification::interface2::Parameter & parameter)
+{
+    return dtrees::internal::BinParams(parameter.maxBins, parameter.minBinSize);
+}
+
+template <typename algorithmFPType, typename ParameterType, training::Method method, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, method, cpu>::compute(
     const NumericTable * x, const NumericTable * y, const NumericTable * w, const NumericTable * px, const NumericTable * py,
     decision_tree::classification::Model * r, const ParameterType * parameter)
 {
@@ -343,6 +354,9 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
 
     r->setNFeatures(x->getNumberOfColumns());
 
+    const dtrees::internal::BinParams binParams         = getBinParams(*parameter);
+    const dtrees::internal::BinParams * const pBinParams = (method == training::hist) ? &binParams : nullptr;
+
     services::Status status;
     Tree<cpu, algorithmFPType, int> tree;
     if (w == nullptr)
@@ -352,7 +366,7 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             Gini<algorithmFPType, cpu> splitCriterion;
             status = tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
-                                parameter->minObservationsInLeafNodes);
+                                parameter->minObservationsInLeafNodes, 2, pBinParams, &_presortedFeatures);
             DAAL_CHECK_STATUS_VAR(status)
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
             DAAL_CHECK_STATUS_VAR(status)
@@ -361,7 +375,7 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             InfoGain<algorithmFPType, cpu> splitCriterion;
             status = tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
-                                parameter->minObservationsInLeafNodes);
+                                parameter->minObservationsInLeafNodes, 2, pBinParams, &_presortedFeatures);
             DAAL_CHECK_STATUS_VAR(status)
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
             DAAL_CHECK_STATUS_VAR(status)
@@ -374,7 +388,7 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             GiniWeighted<algorithmFPType, cpu> splitCriterion;
             status = tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
-                                parameter->minObservationsInLeafNodes);
+                                parameter->minObservationsInLeafNodes, 2, pBinParams, &_presortedFeatures);
             DAAL_CHECK_STATUS_VAR(status)
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
             DAAL_CHECK_STATUS_VAR(status)
@@ -383,7 +397,7 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, ParameterType, tr
         {
             InfoGainWeighted<algorithmFPType, cpu> splitCriterion;
             status = tree.train(splitCriterion, leavesData, *x, *y, w, parameter->nClasses, parameter->maxTreeDepth,
-                                parameter->minObservationsInLeafNodes);
+                                parameter->minObservationsInLeafNodes, 2, pBinParams, &_presortedFeatures);
             DAAL_CHECK_STATUS_VAR(status)
             status = pruneAndConvertTree<>(px, py, *r, *parameter, tree, leavesData);
             DAAL_CHECK_STATUS_VAR(status)
@@ -0,0 +1,250 @@
+/* file: decision_tree_presorted_features.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Cache of the feature values order and bins that are reused by the successive
+//  trainings of decision stumps on the same data set, e.g. in boosting.
+//--
+*/
+
+#ifndef __DECISION_TREE_PRESORTED_FEATURES_H__
+#define __DECISION_TREE_PRESORTED_FEATURES_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+#include "service/kernel/service_arrays.h"
+#include "data_management/features/defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_tree
+{
+namespace internal
+{
+/**
+ *  \brief Indices of the observations sorted by the values of each feature.
+ *         The order of a feature is kept while the data set keeps its dimensions,
+ *         the user of the cache checks that the order is still valid for the current values.
+ *         The features with few distinct values are also mapped to the bins, one bin per value,
+ *         so that the following trainings only compute the histograms of the bins.
+ */
+template <CpuType cpu>
+class PresortedFeatures
+{
+public:
+    typedef unsigned char BinIndexType;
+
+    /* Maximal number of distinct values of the binned feature */
+    static const size_t maxBinCount = 256;
+
+    PresortedFeatures() : _nRows(0), _nFeatures(0) {}
+
+    services::Status reset(size_t nRows, size_t nFeatures)
+    {
+        if (nRows == _nRows && nFeatures == _nFeatures) return services::Status();
+
+        _nRows     = 0;
+        _nFeatures = 0;
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxBinCount, nFeatures);
+        DAAL_CHECK_MALLOC(_indices.reset(nRows * nFeatures));
+        DAAL_CHECK_MALLOC(_bins.reset(nRows * nFeatures));
+        DAAL_CHECK_MALLOC(_binEnds.reset(maxBinCount * nFeatures));
+        DAAL_CHECK_MALLOC(_binCounts.reset(nFeatures));
+        DAAL_CHECK_MALLOC(_isInitialized.reset(nFeatures));
+        for (size_t i = 0; i < nFeatures; ++i)
+        {
+            _isInitialized[i] = false;
+            _binCounts[i]     = 0;
+        }
+        _nRows     = nRows;
+        _nFeatures = nFeatures;
+        return services::Status();
+    }
+
+    size_t * indices(size_t featureIndex) { return _indices.get() + featureIndex * _nRows; }
+
+    const size_t * indices(size_t featureIndex) const { return _indices.get() + featureIndex * _nRows; }
+
+    bool isInitialized(size_t featureIndex) const { return _isInitialized[featureIndex]; }
+
+    void setInitialized(size_t featureIndex) { _isInitialized[featureIndex] = true; }
+
+    bool isBinned(size_t featureIndex) const { return _binCounts[featureIndex] > 0; }
+
+    size_t binCount(size_t featureIndex) const { return _binCounts[featureIndex]; }
+
+    /* Bin of every observation in the original order */
+    const BinIndexType * bins(size_t featureIndex) const { return _bins.get() + featureIndex * _nRows; }
+
+    /* Number of the observations in the bins up to and including the given one */
+    const size_t * binEnds(size_t featureIndex) const { return _binEnds.get() + featureIndex * maxBinCount; }
+
+    /* Index of an observation that has the value of the bin */
+    size_t binRow(size_t featureIndex, size_t bin) const { return indices(featureIndex)[binEnds(featureIndex)[bin] - 1]; }
+
+    /* Maps the values of the feature to the bins using the order of the feature, the feature is left unbinned if it has too many values */
+    template <typename IndependentVariable>
+    void buildBins(size_t featureIndex, const IndependentVariable * column)
+    {
+        const size_t * const order = indices(featureIndex);
+        BinIndexType * const bins  = _bins.get() + featureIndex * _nRows;
+        size_t * const binEnds     = _binEnds.get() + featureIndex * maxBinCount;
+
+        _binCounts[featureIndex] = 0;
+        size_t binCount          = 0;
+        for (size_t i = 0; i < _nRows; ++i)
+        {
+            if (i == 0 || column[order[i - 1]] < column[order[i]])
+            {
+                if (binCount == maxBinCount) return;
+                ++binCount;
+            }
+            bins[order[i]]        = static_cast<BinIndexType>(binCount - 1);
+            binEnds[binCount - 1] = i + 1;
+        }
+        _binCounts[featureIndex] = binCount;
+    }
+
+    /* Checks that the bins of the feature still hold the distinct values in the ascending order */
+    template <typename IndependentVariable>
+    bool checkBins(size_t featureIndex, const IndependentVariable * column) const
+    {
+        const size_t binCount           = _binCounts[featureIndex];
+        const BinIndexType * const bins = this->bins(featureIndex);
+        for (size_t bin = 1; bin < binCount; ++bin)
+        {
+            if (!(column[binRow(featureIndex, bin - 1)] < column[binRow(featureIndex, bin)])) return false;
+        }
+        for (size_t i = 0; i < _nRows; ++i)
+        {
+            if (column[i] != column[binRow(featureIndex, bins[i])]) return false;
+        }
+        return true;
+    }
+
+private:
+    size_t _nRows;
+    size_t _nFeatures;
+    services::internal::TArray<size_t, cpu> _indices;
+    services::internal::TArray<BinIndexType, cpu> _bins;
+    services::internal::TArray<size_t, cpu> _binEnds;
+    services::internal::TArray<size_t, cpu> _binCounts;
+    services::internal::TArray<bool, cpu> _isInitialized;
+};
+
+/**
+ *  \brief Finds the cut point of a binned feature on the histograms of the bins.
+ *         Available for the split criteria that depend only on the weighted class counters of the parts,
+ *         for other criteria the cut point is found on the sorted values of the feature
+ */
+template <CpuType cpu, typename SplitCriterion>
+struct HistogramCutPointFinder
+{
+    static const bool isAvailable = false;
+
+    /* Number of elements in the histograms of the binned feature */
+    static size_t histogramSize(const typename SplitCriterion::DataStatistics & totalDataStatistics) { return 0; }
+
+    template <typename DependentVariable, typename IndependentVariable>
+    static bool find(SplitCriterion & splitCriterion, const PresortedFeatures<cpu> & presortedFeatures, size_t featureIndex, size_t nRows,
+                     const DependentVariable * dy, const IndependentVariable * dw, data_management::features::FeatureType featureType,
+                     const typename SplitCriterion::DataStatistics & totalDataStatistics, typename SplitCriterion::DataStatistics & dataStatistics,
+                     IndependentVariable * histogram, size_t & winnerBin, typename SplitCriterion::ValueType & winnerSplitCriterionValue,
+                     typename SplitCriterion::DataStatistics & winnerDataStatistics)
+    {
+        return false;
+    }
+};
+
+template <CpuType cpu>
+struct ClassHistogramCutPointFinder
+{
+    static const bool isAvailable = true;
+
+    template <typename DataStatistics>
+    static size_t histogramSize(const DataStatistics & totalDataStatistics)
+    {
+        return PresortedFeatures<cpu>::maxBinCount * totalDataStatistics.size();
+    }
+
+    template <typename SplitCriterion, typename DependentVariable, typename IndependentVariable>
+    static bool find(SplitCriterion & splitCriterion, const PresortedFeatures<cpu> & presortedFeatures, size_t featureIndex, size_t nRows,
+                     const DependentVariable * dy, const IndependentVariable * dw, data_management::features::FeatureType featureType,
+                     const typename SplitCriterion::DataStatistics & totalDataStatistics, typename SplitCriterion::DataStatistics & dataStatistics,
+                     IndependentVariable * histogram, size_t & winnerBin, typename SplitCriterion::ValueType & winnerSplitCriterionValue,
+                     typename SplitCriterion::DataStatistics & winnerDataStatistics)
+    {
+        typedef typename PresortedFeatures<cpu>::BinIndexType BinIndexType;
+
+        const size_t nClasses           = totalDataStatistics.size();
+        const size_t binCount           = presortedFeatures.binCount(featureIndex);
+        const BinIndexType * const bins = presortedFeatures.bins(featureIndex);
+        const size_t * const binEnds    = presortedFeatures.binEnds(featureIndex);
+
+        for (size_t k = 0; k < binCount * nClasses; ++k)
+        {
+            histogram[k] = 0;
+        }
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            DAAL_ASSERT(static_cast<size_t>(dy[i]) < nClasses);
+            histogram[bins[i] * nClasses + static_cast<size_t>(dy[i])] += dw[i];
+        }
+
+        double totalWeight = 0.0;
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            totalWeight += totalDataStatistics[k];
+        }
+
+        /* The bins play the role of the groups of equal values of the sorted feature */
+        bool isFound = false;
+        dataStatistics.reset(totalDataStatistics);
+        for (size_t bin = 0; bin + 1 < binCount; ++bin)
+        {
+            double leftWeight = 0.0;
+            for (size_t k = 0; k < nClasses; ++k)
+            {
+                dataStatistics.update(k, histogram[bin * nClasses + k]);
+                leftWeight += dataStatistics[k];
+            }
+            const double rightWeight = totalWeight - leftWeight;
+
+            const auto splitCriterionValue = splitCriterion(binEnds, binEnds + binCount, binEnds + bin, binEnds + bin + 1, dataStatistics,
+                                                            totalDataStatistics, featureType, leftWeight, rightWeight, totalWeight);
+            if (!isFound || splitCriterionValue < winnerSplitCriterionValue)
+            {
+                isFound                   = true;
+                winnerBin                 = bin;
+                winnerSplitCriterionValue = splitCriterionValue;
+                winnerDataStatistics      = dataStatistics;
+            }
+        }
+        return isFound;
+    }
+};
+
+} // namespace internal
+} // namespace decision_tree
+} // namespace algorithms
+} // namespace daal
+
+#endif
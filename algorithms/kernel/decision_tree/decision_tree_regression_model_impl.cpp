@@ -103,6 +103,8 @@ services::Status Parameter::check() const
     DAAL_CHECK_STATUS(s, daal::algorithms::Parameter::check());
 
     DAAL_CHECK_EX(minObservationsInLeafNodes >= 1, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafNodesStr());
+    DAAL_CHECK_EX(maxBins >= 2, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
+    DAAL_CHECK_EX(minBinSize >= 1, services::ErrorIncorrectParameter, services::ParameterName, minBinSizeStr());
     return s;
 }
 
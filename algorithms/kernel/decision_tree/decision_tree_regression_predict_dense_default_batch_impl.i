@@ -33,6 +33,7 @@
 #include "algorithms/kernel/decision_tree/decision_tree_regression_predict_dense_default_batch.h"
 #include "algorithms/kernel/decision_tree/decision_tree_regression_model_impl.h"
 #include "algorithms/kernel/decision_tree/decision_tree_impl.i"
+#include "algorithms/kernel/decision_tree/decision_tree_blocked_forest_impl.i"
 
 namespace daal
 {
@@ -55,6 +56,7 @@ services::Status DecisionTreePredictKernel<algorithmFPType, defaultDense, cpu>::
                                                                                         NumericTable * y, const daal::algorithms::Parameter * par)
 {
     typedef daal::services::internal::SignBit<algorithmFPType, cpu> SignBitType;
+    typedef BlockedForest<algorithmFPType, cpu> BlockedForestType;
 
     DAAL_ASSERT(x);
     DAAL_ASSERT(y);
@@ -74,9 +76,19 @@ services::Status DecisionTreePredictKernel<algorithmFPType, defaultDense, cpu>::
     const size_t yColumnCount = y->getNumberOfColumns();
     DAAL_ASSERT(xRowCount == y->getNumberOfRows());
 
-    const auto rowsPerBlock = 512;
-    const auto blockCount   = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
-    daal::threader_for(blockCount, blockCount, [=, &featureTypesCache, &treeTable](int iBlock) {
+    /* The rows are passed through the tree by blocks of BlockedForestType::s_cVectorBlockSize when all splits are ordered */
+    const bool bVectorPath = !BlockedForestType::hasUnorderedFeatures(*x) && cpu != __avx512_mic__;
+    BlockedForestType forest;
+    if (bVectorPath)
+    {
+        const DecisionTreeTable * const aTree[] = { &treeTable };
+        const services::Status s                = forest.template convert<DecisionTreeNode>(aTree, 1);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    const size_t rowsPerBlock = BlockedForestType::s_cRowsInBlock;
+    const size_t blockCount   = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    daal::threader_for(blockCount, blockCount, [=, &featureTypesCache, &forest, &treeTable](int iBlock) {
         const size_t first = iBlock * rowsPerBlock;
         const size_t last  = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
 
@@ -86,12 +98,20 @@ services::Status DecisionTreePredictKernel<algorithmFPType, defaultDense, cpu>::
         BlockDescriptor<algorithmFPType> yBD;
         y->getBlockOfRows(first, last - first, writeOnly, yBD);
         auto * const dy = yBD.getBlockPtr();
+        int leaves[rowsPerBlock];
+        const size_t nVectorRows = bVectorPath ? (last - first) / BlockedForestType::s_cVectorBlockSize * BlockedForestType::s_cVectorBlockSize : 0;
+        for (size_t iRow = 0; iRow < nVectorRows; iRow += BlockedForestType::s_cVectorBlockSize)
+        {
+            forest.predictByTreesVector(0, 1, &dx[iRow * xColumnCount], xColumnCount, [&](size_t, const int * nodes) {
+                for (size_t i = 0; i < BlockedForestType::s_cVectorBlockSize; ++i) leaves[iRow + i] = nodes[i];
+            });
+        }
         for (size_t i = 0; i < last - first; ++i)
         {
             const algorithmFPType * const xRow = &dx[i * xColumnCount];
-            size_t nodeIndex                   = 0;
+            size_t nodeIndex                   = (i < nVectorRows) ? leaves[i] : 0;
             DAAL_ASSERT(nodeIndex < treeTable.getNumberOfRows());
-            while (nodes[nodeIndex].dimension != static_cast<size_t>(-1))
+            while (i >= nVectorRows && nodes[nodeIndex].dimension != static_cast<size_t>(-1))
             {
                 switch (featureTypesCache[nodes[nodeIndex].dimension])
                 {
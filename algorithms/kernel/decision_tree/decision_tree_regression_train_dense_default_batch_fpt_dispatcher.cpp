@@ -29,6 +29,8 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_tree::regression::training::BatchContainer, batch, DAAL_FPTYPE,
                                       decision_tree::regression::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_tree::regression::training::BatchContainer, batch, DAAL_FPTYPE,
+                                      decision_tree::regression::training::hist)
 
 } // namespace algorithms
 } // namespace daal
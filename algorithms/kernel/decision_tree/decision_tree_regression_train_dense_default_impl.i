@@ -169,12 +169,11 @@ static void copyNode(size_t srcNodeIdx, size_t destNodeIdx, const decision_tree:
     }
 }
 
-template <typename algorithmFPType, CpuType cpu>
-services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu>::compute(const NumericTable * x, const NumericTable * y,
-                                                                                                     const NumericTable * w, const NumericTable * px,
-                                                                                                     const NumericTable * py,
-                                                                                                     decision_tree::regression::Model * r,
-                                                                                                     const daal::algorithms::Parameter * par)
+template <typename algorithmFPType, training::Method method, CpuType cpu>
+services::Status DecisionTreeTrainBatchKernel<algorithmFPType, method, cpu>::compute(const NumericTable * x, const NumericTable * y,
+                                                                                     const NumericTable * w, const NumericTable * px,
+                                                                                     const NumericTable * py, decision_tree::regression::Model * r,
+                                                                                     const daal::algorithms::Parameter * par)
 {
     DAAL_ASSERT(x);
     DAAL_ASSERT(y);
@@ -186,16 +185,21 @@ services::Status DecisionTreeTrainBatchKernel<algorithmFPType, training::default
     DAAL_ASSERT(r->impl());
     r->impl()->setNumberOfFeatures(x->getNumberOfColumns());
 
+    const dtrees::internal::BinParams binParams(parameter->maxBins, parameter->minBinSize);
+    const dtrees::internal::BinParams * const pBinParams = (method == training::hist) ? &binParams : nullptr;
+
     Tree<cpu, algorithmFPType, algorithmFPType> tree;
     if (w == nullptr)
     {
         MSE<algorithmFPType, cpu> splitCriterion;
-        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams,
+                            &_presortedFeatures);
     }
     else
     {
         MSEWeighted<algorithmFPType, cpu> splitCriterion;
-        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes);
+        status = tree.train(splitCriterion, *x, *y, w, 0, parameter->maxTreeDepth, parameter->minObservationsInLeafNodes, 2, pBinParams,
+                            &_presortedFeatures);
     }
     if (parameter->pruning == reducedErrorPruning)
     {
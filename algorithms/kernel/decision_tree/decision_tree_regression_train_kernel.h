@@ -27,6 +27,7 @@
 #include "data_management/data/numeric_table.h"
 #include "algorithms/algorithm_base_common.h"
 #include "algorithms/decision_tree/decision_tree_regression_training_types.h"
+#include "algorithms/kernel/decision_tree/decision_tree_presorted_features.h"
 
 namespace daal
 {
@@ -44,15 +45,15 @@ using namespace daal::data_management;
 using namespace daal::services;
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
-class DecisionTreeTrainBatchKernel
-{};
-
-template <typename algorithmFPType, CpuType cpu>
-class DecisionTreeTrainBatchKernel<algorithmFPType, training::defaultDense, cpu> : public daal::algorithms::Kernel
+class DecisionTreeTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(const NumericTable * x, const NumericTable * y, const NumericTable * w, const NumericTable * px, const NumericTable * py,
                              decision_tree::regression::Model * r, const daal::algorithms::Parameter * par);
+
+private:
+    /* Order of the features reused by the successive trainings of stumps on the same data set */
+    decision_tree::internal::PresortedFeatures<cpu> _presortedFeatures;
 };
 
 } // namespace internal
@@ -34,6 +34,9 @@
 #include "algorithms/kernel/service_threading.h"
 #include "data_management/features/defines.h"
 #include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/dtrees/dtrees_feature_type_helper.i"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/decision_tree/decision_tree_presorted_features.h"
 
 namespace daal
 {
@@ -574,6 +577,128 @@ public:
     void putProbabilities(LeavesDataIndex index, double * probs, size_t numProbs) const {}
 };
 
+/**
+ *  \brief Features of the training data mapped to bins once before the training of the tree.
+ *         For every bin the minimal and the maximal values of the feature in it are stored,
+ *         so that the cut points found on the bin indices are placed between the values of the training data
+ */
+template <CpuType cpu, typename IndependentVariable>
+class BinnedFeatures
+{
+public:
+    typedef dtrees::internal::IndexedFeatures::IndexType IndexType;
+
+    BinnedFeatures() : _binOffsets(nullptr), _binMin(nullptr), _binMax(nullptr), _featureCount(0) {}
+
+    BinnedFeatures(const BinnedFeatures &) = delete;
+    BinnedFeatures & operator=(const BinnedFeatures &) = delete;
+
+    ~BinnedFeatures()
+    {
+        daal_free(_binOffsets);
+        daal_free(_binMin);
+        daal_free(_binMax);
+        _binOffsets = nullptr;
+        _binMin     = nullptr;
+        _binMax     = nullptr;
+    }
+
+    services::Status init(const NumericTable & x, const IndependentVariable * const * dx, const dtrees::internal::BinParams & binParams)
+    {
+        services::Status status = _indexedFeatures.init<IndependentVariable, cpu>(x, nullptr, &binParams);
+        DAAL_CHECK_STATUS_VAR(status)
+
+        _featureCount      = x.getNumberOfColumns();
+        const size_t nRows = x.getNumberOfRows();
+
+        _binOffsets = daal_alloc<size_t>(_featureCount + 1);
+        DAAL_CHECK_MALLOC(_binOffsets)
+        _binOffsets[0] = 0;
+        for (size_t i = 0; i < _featureCount; ++i)
+        {
+            _binOffsets[i + 1] = _binOffsets[i] + _indexedFeatures.numIndices(i);
+        }
+
+        _binMin = daal_alloc<IndependentVariable>(_binOffsets[_featureCount]);
+        _binMax = daal_alloc<IndependentVariable>(_binOffsets[_featureCount]);
+        DAAL_CHECK_MALLOC(_binMin && _binMax)
+
+        daal::threader_for(_featureCount, _featureCount, [=](size_t featureIndex) {
+            IndependentVariable * const binMin = _binMin + _binOffsets[featureIndex];
+            IndependentVariable * const binMax = _binMax + _binOffsets[featureIndex];
+            const size_t binCount              = _indexedFeatures.numIndices(featureIndex);
+            for (size_t i = 0; i < binCount; ++i)
+            {
+                binMin[i] = MaxVal<IndependentVariable>::get();
+                binMax[i] = -MaxVal<IndependentVariable>::get();
+            }
+
+            const IndexType * const featureBins      = _indexedFeatures.data(featureIndex);
+            const IndependentVariable * const values = dx[featureIndex];
+            for (size_t i = 0; i < nRows; ++i)
+            {
+                const IndexType bin = featureBins[i];
+                binMin[bin]         = min<cpu>(binMin[bin], values[i]);
+                binMax[bin]         = max<cpu>(binMax[bin], values[i]);
+            }
+        });
+        return status;
+    }
+
+    const IndexType * bins(size_t featureIndex) const { return _indexedFeatures.data(featureIndex); }
+
+    size_t binCount(size_t featureIndex) const { return _indexedFeatures.numIndices(featureIndex); }
+
+    IndependentVariable binMin(size_t featureIndex, size_t bin) const { return _binMin[_binOffsets[featureIndex] + bin]; }
+
+    IndependentVariable binMax(size_t featureIndex, size_t bin) const { return _binMax[_binOffsets[featureIndex] + bin]; }
+
+    /* Sorts the items by the bin indices stored in their x field with the counting sort */
+    template <typename Item>
+    bool sort(Item * first, Item * last, size_t featureIndex) const
+    {
+        const size_t count    = last - first;
+        const size_t binCount = this->binCount(featureIndex);
+        if (count < binCount)
+        {
+            introSort<cpu>(first, last, [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+            return true;
+        }
+
+        TArray<Item, cpu> buffer(count);
+        TArrayCalloc<size_t, cpu> offsets(binCount + 1);
+        if (!buffer.get() || !offsets.get())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            ++offsets[static_cast<size_t>(first[i].x) + 1];
+        }
+        for (size_t i = 0; i < binCount; ++i)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            buffer[offsets[static_cast<size_t>(first[i].x)]++] = first[i];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            first[i] = buffer[i];
+        }
+        return true;
+    }
+
+private:
+    dtrees::internal::IndexedFeatures _indexedFeatures;
+    size_t * _binOffsets;
+    IndependentVariable * _binMin;
+    IndependentVariable * _binMax;
+    size_t _featureCount;
+};
+
 template <CpuType cpu, typename IndependentVariable, typename DependentVariable>
 class Tree
 {
@@ -581,8 +706,11 @@ public:
     typedef IndependentVariable IndependentVariableType;
     typedef DependentVariable DependentVariableType;
     typedef TreeNode<cpu, IndependentVariableType, DependentVariableType> TreeNodeType;
+    typedef BinnedFeatures<cpu, IndependentVariableType> BinnedFeaturesType;
+    typedef typename BinnedFeaturesType::IndexType BinIndexType;
+    typedef PresortedFeatures<cpu> PresortedFeaturesType;
 
-    Tree() : _nodes(nullptr), _nodeCount(0), _nodeCapacity(0) {}
+    Tree() : _nodes(nullptr), _nodeCount(0), _nodeCapacity(0), _binnedFeatures(nullptr) {}
 
     Tree(const Tree &) = delete;
     Tree & operator=(const Tree &) = delete;
@@ -629,7 +757,8 @@ public:
 
     template <typename SplitCriterion, typename LeavesData>
     services::Status trainStump(SplitCriterion & splitCriterion, LeavesData & leavesData, const NumericTable & x, const NumericTable & y,
-                                const NumericTable * w, size_t numberOfClasses = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
+                                const NumericTable * w, size_t numberOfClasses = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2,
+                                PresortedFeaturesType * presortedFeatures = nullptr)
     {
         const size_t xRowCount    = x.getNumberOfRows();
         const size_t xColumnCount = x.getNumberOfColumns();
@@ -641,6 +770,11 @@ public:
 
         typename SplitCriterion::DataStatistics totalDataStatistics(numberOfClasses, x, y, w), dataStatistics(numberOfClasses, w);
 
+        if (presortedFeatures)
+        {
+            DAAL_CHECK_STATUS_VAR(presortedFeatures->reset(xRowCount, xColumnCount))
+        }
+
         size_t * indexes = prepareIndexes(xRowCount);
         DAAL_CHECK_MALLOC(indexes)
 
@@ -713,21 +847,34 @@ public:
             bool winnerIsLeaf;
             SplitCriterion splitCriterion;
             Item * items;
+            IndependentVariableType * histogram;
 
-            Local(const SplitCriterion & criterion, const size_t nRows) : winnerIsLeaf(true), splitCriterion(criterion)
+            Local(const SplitCriterion & criterion, const size_t nRows, const size_t histogramSize)
+                : winnerIsLeaf(true), splitCriterion(criterion), histogram(nullptr)
             {
                 items = daal_alloc<Item>(nRows);
+                if (histogramSize)
+                {
+                    histogram = daal_alloc<IndependentVariableType>(histogramSize);
+                }
             }
 
             ~Local()
             {
                 daal_free(items);
-                items = nullptr;
+                daal_free(histogram);
+                items     = nullptr;
+                histogram = nullptr;
             }
         };
 
+        /* In boosting the stumps after the first one are trained on the histograms of the binned features if the criterion allows it */
+        typedef HistogramCutPointFinder<cpu, SplitCriterion> HistogramFinder;
+        const bool useHistograms   = HistogramFinder::isAvailable && presortedFeatures && context.dw;
+        const size_t histogramSize = useHistograms ? HistogramFinder::histogramSize(totalDataStatistics) : 0;
+
         daal::tls<Local *> localTLS([=, &context]() -> Local * {
-            Local * const ptr = new Local(context.splitCriterion, xRowCount);
+            Local * const ptr = new Local(context.splitCriterion, xRowCount, histogramSize);
             return ptr;
         });
 
@@ -746,8 +893,41 @@ public:
             Item * const items = local->items;
             DAAL_CHECK_MALLOC_THR(items)
 
-            const size_t rowsPerBlock = 512;
-            const size_t blockCount   = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+            const IndependentVariableType * const column             = context.dx[featureIndex];
+            const data_management::features::FeatureType featureType = context.featureTypesCache[featureIndex];
+
+            auto updateWinner = [&](IndependentVariableType left, IndependentVariableType right, size_t pointsAtLeft) {
+                if (local->winnerIsLeaf || local->splitCriterionValue < local->winnerSplitCriterionValue
+                    || (SplitCriterionMath::sFabs(local->splitCriterionValue - local->winnerSplitCriterionValue) <= epsilon
+                        && local->winnerFeatureIndex > featureIndex))
+                {
+                    local->winnerIsLeaf              = false;
+                    local->winnerFeatureIndex        = featureIndex;
+                    local->winnerSplitCriterionValue = local->splitCriterionValue;
+                    local->winnerCutPoint            = cutPoint(featureType, featureIndex, left, right);
+                    local->winnerPointsAtLeft        = pointsAtLeft;
+                    local->winnerDataStatistics      = local->bestCutPointDataStatistics;
+                }
+            };
+
+            if (useHistograms && presortedFeatures->isBinned(featureIndex) && presortedFeatures->checkBins(featureIndex, column))
+            {
+                DAAL_CHECK_MALLOC_THR(local->histogram)
+                size_t bin = 0;
+                if (HistogramFinder::find(local->splitCriterion, *presortedFeatures, featureIndex, xRowCount, context.dy, context.dw, featureType,
+                                          totalDataStatistics, local->dataStatistics, local->histogram, bin, local->splitCriterionValue,
+                                          local->bestCutPointDataStatistics))
+                {
+                    updateWinner(column[presortedFeatures->binRow(featureIndex, bin)], column[presortedFeatures->binRow(featureIndex, bin + 1)],
+                                 presortedFeatures->binEnds(featureIndex)[bin]);
+                }
+                return;
+            }
+
+            const bool isPresorted     = presortedFeatures && presortedFeatures->isInitialized(featureIndex);
+            const size_t * const order = isPresorted ? presortedFeatures->indices(featureIndex) : indexes;
+            const size_t rowsPerBlock  = 512;
+            const size_t blockCount    = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
             for (size_t iBlock = 0; iBlock < blockCount; iBlock++)
             {
                 const size_t first = iBlock * rowsPerBlock;
@@ -755,45 +935,65 @@ public:
 
                 for (size_t i = first; i < last; ++i)
                 {
-                    items[i].x = context.dx[featureIndex][indexes[i]];
-                    items[i].y = context.dy[indexes[i]];
+                    items[i].x = column[order[i]];
+                    items[i].y = context.dy[order[i]];
                 }
                 if (context.dw)
                 {
                     for (size_t i = first; i < last; ++i)
                     {
-                        items[i].w = context.dw[indexes[i]];
+                        items[i].w = context.dw[order[i]];
                     }
                 }
             }
 
-            introSort<cpu>(items, &items[xRowCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+            if (!presortedFeatures)
+            {
+                introSort<cpu>(items, &items[xRowCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+            }
+            else if (!isPresorted || !isSorted<cpu>(items, &items[xRowCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; }))
+            {
+                /* The order is computed on the first training or recomputed if the values of the feature changed since then */
+                size_t * const sortedIndexes = presortedFeatures->indices(featureIndex);
+                for (size_t i = 0; i < xRowCount; ++i)
+                {
+                    sortedIndexes[i] = i;
+                }
+                introSort<cpu>(sortedIndexes, sortedIndexes + xRowCount, [=](size_t i1, size_t i2) -> bool { return column[i1] < column[i2]; });
+                presortedFeatures->setInitialized(featureIndex);
+
+                for (size_t i = 0; i < xRowCount; ++i)
+                {
+                    items[i].x = column[sortedIndexes[i]];
+                    items[i].y = context.dy[sortedIndexes[i]];
+                }
+                if (context.dw)
+                {
+                    for (size_t i = 0; i < xRowCount; ++i)
+                    {
+                        items[i].w = context.dw[sortedIndexes[i]];
+                    }
+                }
+            }
             DAAL_ASSERT(isSorted<cpu>(items, &items[xRowCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; }));
 
+            /* The bins are built on the first training and rebuilt if the values of the binned feature changed since then */
+            if (useHistograms && featureType != data_management::features::DAAL_CATEGORICAL
+                && (!isPresorted || presortedFeatures->isBinned(featureIndex)))
+            {
+                presortedFeatures->buildBins(featureIndex, column);
+            }
+
             Item * next  = nullptr;
             const auto i = CutPointFinder<cpu, IndependentVariableType, SplitCriterion>::find(
-                local->splitCriterion, items, &items[xRowCount], local->dataStatistics, totalDataStatistics, context.featureTypesCache[featureIndex],
-                next, local->splitCriterionValue, local->bestCutPointDataStatistics, [](const Item & v) -> IndependentVariableType { return v.x; },
+                local->splitCriterion, items, &items[xRowCount], local->dataStatistics, totalDataStatistics, featureType, next,
+                local->splitCriterionValue, local->bestCutPointDataStatistics, [](const Item & v) -> IndependentVariableType { return v.x; },
                 [](const Item & v) -> DependentVariable { return v.y; }, [](const Item & v) -> IndependentVariableType { return v.w; },
                 [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
 
-            if (i != &items[xRowCount]
-                && (local->winnerIsLeaf || local->splitCriterionValue < local->winnerSplitCriterionValue
-                    || (SplitCriterionMath::sFabs(local->splitCriterionValue - local->winnerSplitCriterionValue) <= epsilon
-                        && local->winnerFeatureIndex > featureIndex)))
+            if (i != &items[xRowCount])
             {
-                local->winnerIsLeaf              = false;
-                local->winnerFeatureIndex        = featureIndex;
-                local->winnerSplitCriterionValue = local->splitCriterionValue;
-                switch (context.featureTypesCache[featureIndex])
-                {
-                case data_management::features::DAAL_CATEGORICAL: local->winnerCutPoint = i->x; break;
-                case data_management::features::DAAL_ORDINAL: local->winnerCutPoint = next->x; break;
-                case data_management::features::DAAL_CONTINUOUS: local->winnerCutPoint = (i->x + next->x) / 2; break;
-                default: DAAL_ASSERT(false); break;
-                }
-                local->winnerPointsAtLeft   = next - items; // distance.
-                local->winnerDataStatistics = local->bestCutPointDataStatistics;
+                updateWinner(i->x, next->x, next - items);
             }
         });
 
@@ -870,11 +1070,12 @@ public:
     template <typename SplitCriterion, typename LeavesData>
     services::Status train(SplitCriterion & splitCriterion, LeavesData & leavesData, const NumericTable & x, const NumericTable & y,
                            const NumericTable * w, size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1,
-                           size_t minSplitObservations = 2)
+                           size_t minSplitObservations = 2, const dtrees::internal::BinParams * binParams = nullptr,
+                           PresortedFeaturesType * presortedFeatures = nullptr)
     {
-        if (maxTreeDepth == 2) // stump with weights
+        if (maxTreeDepth == 2 && !binParams) // stump with weights
         {
-            return trainStump(splitCriterion, leavesData, x, y, w, numberOfClasses, minLeafObservations, minSplitObservations);
+            return trainStump(splitCriterion, leavesData, x, y, w, numberOfClasses, minLeafObservations, minSplitObservations, presortedFeatures);
         }
         const size_t xRowCount    = x.getNumberOfRows();
         const size_t xColumnCount = x.getNumberOfColumns();
@@ -918,6 +1119,15 @@ public:
             const_cast<NumericTable *>(w)->getBlockOfColumnValues(0, 0, xRowCount, readOnly, wBD);
         }
 
+        /* Features are mapped to bins once, the split of every node is searched among the bin borders */
+        BinnedFeaturesType binnedFeatures;
+        if (binParams)
+        {
+            services::Status statBins = binnedFeatures.init(x, dx, *binParams);
+            DAAL_CHECK_STATUS_VAR(statBins)
+            _binnedFeatures = &binnedFeatures;
+        }
+
         const size_t depthLimit = (maxTreeDepth != 0) ? maxTreeDepth : static_cast<size_t>(-1);
         const TrainigContext<SplitCriterion, LeavesData> context {
             splitCriterion,    leavesData,       x, y, w, featureTypesCache, dataStatistics, minLeafObservations, minSplitObservations, dx,
@@ -929,6 +1139,7 @@ public:
         services::Status stat = (xColumnCount < threader_get_threads_number()) ?
                                     internalTrainFewFeatures(context, indexes, xRowCount, tni, totalDataStatistics, depthLimit) :
                                     internalTrainManyFeatures(context, indexes, xRowCount, tni, totalDataStatistics, depthLimit);
+        _binnedFeatures = nullptr;
         DAAL_CHECK_STATUS_VAR(stat)
 
         if (w)
@@ -953,10 +1164,12 @@ public:
 
     template <typename SplitCriterion>
     services::Status train(SplitCriterion & splitCriterion, const NumericTable & x, const NumericTable & y, const NumericTable * w,
-                           size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2)
+                           size_t numberOfClasses = 0, size_t maxTreeDepth = 0, size_t minLeafObservations = 1, size_t minSplitObservations = 2,
+                           const dtrees::internal::BinParams * binParams = nullptr, PresortedFeaturesType * presortedFeatures = nullptr)
     {
         LeavesData<cpu, void> leavesData;
-        return train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations);
+        return train(splitCriterion, leavesData, x, y, w, numberOfClasses, maxTreeDepth, minLeafObservations, minSplitObservations, binParams,
+                     presortedFeatures);
     }
 
     template <typename Data>
@@ -1049,6 +1262,36 @@ protected:
 
     void clear() { _nodeCount = 0; }
 
+    /* Returns the cut point between the groups of equal values of the feature. In case of the binned features
+       the groups are the bins and the cut point is placed between the values of the training data in the bins */
+    IndependentVariableType cutPoint(data_management::features::FeatureType featureType, size_t featureIndex, IndependentVariableType left,
+                                     IndependentVariableType right) const
+    {
+        if (_binnedFeatures)
+        {
+            const size_t leftBin  = static_cast<size_t>(left);
+            const size_t rightBin = static_cast<size_t>(right);
+            switch (featureType)
+            {
+            case data_management::features::DAAL_CATEGORICAL: return _binnedFeatures->binMin(featureIndex, leftBin);
+            case data_management::features::DAAL_ORDINAL: return _binnedFeatures->binMin(featureIndex, rightBin);
+            case data_management::features::DAAL_CONTINUOUS:
+                return (_binnedFeatures->binMax(featureIndex, leftBin) + _binnedFeatures->binMin(featureIndex, rightBin)) / 2;
+            default: DAAL_ASSERT(false); break;
+            }
+            return left;
+        }
+
+        switch (featureType)
+        {
+        case data_management::features::DAAL_CATEGORICAL: return left;
+        case data_management::features::DAAL_ORDINAL: return right;
+        case data_management::features::DAAL_CONTINUOUS: return (left + right) / 2;
+        default: DAAL_ASSERT(false); break;
+        }
+        return left;
+    }
+
     bool empty() const { return (_nodeCount == 0); }
 
     size_t * prepareIndexes(size_t size)
@@ -1178,10 +1421,22 @@ protected:
                 const size_t first = iBlock * rowsPerBlock;
                 const size_t last  = min<cpu>(first + rowsPerBlock, indexCount);
 
-                for (size_t i = first; i < last; ++i)
+                if (_binnedFeatures)
                 {
-                    items[i].x = context.dx[featureIndex][indexes[i]];
-                    items[i].y = context.dy[indexes[i]];
+                    const BinIndexType * const bins = _binnedFeatures->bins(featureIndex);
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        items[i].x = bins[indexes[i]];
+                        items[i].y = context.dy[indexes[i]];
+                    }
+                }
+                else
+                {
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        items[i].x = context.dx[featureIndex][indexes[i]];
+                        items[i].y = context.dy[indexes[i]];
+                    }
                 }
                 if (context.dw)
                 {
@@ -1192,7 +1447,19 @@ protected:
                 }
             }
 
-            introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+            if (_binnedFeatures)
+            {
+                if (!_binnedFeatures->sort(items, &items[indexCount], featureIndex))
+                {
+                    daal_free(items);
+                    safeStat.add(services::ErrorMemoryAllocationFailed);
+                    return;
+                }
+            }
+            else
+            {
+                introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+            }
             DAAL_ASSERT(isSorted<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; }));
 
             Item * next  = nullptr;
@@ -1210,13 +1477,7 @@ protected:
                 local->winnerIsLeaf              = false;
                 local->winnerFeatureIndex        = featureIndex;
                 local->winnerSplitCriterionValue = local->splitCriterionValue;
-                switch (context.featureTypesCache[featureIndex])
-                {
-                case data_management::features::DAAL_CATEGORICAL: local->winnerCutPoint = i->x; break;
-                case data_management::features::DAAL_ORDINAL: local->winnerCutPoint = next->x; break;
-                case data_management::features::DAAL_CONTINUOUS: local->winnerCutPoint = (i->x + next->x) / 2; break;
-                default: DAAL_ASSERT(false); break;
-                }
+                local->winnerCutPoint = cutPoint(context.featureTypesCache[featureIndex], featureIndex, i->x, next->x);
                 local->winnerPointsAtLeft   = next - items; // distance.
                 local->winnerDataStatistics = local->bestCutPointDataStatistics;
             }
@@ -1845,10 +2106,22 @@ protected:
                     const size_t first = iBlock * rowsPerBlock;
                     const size_t last  = min<cpu>(first + rowsPerBlock, indexCount);
 
-                    for (size_t i = first; i < last; ++i)
+                    if (_binnedFeatures)
                     {
-                        items[i].x = dx[featureIndex][firstIndex[i]];
-                        items[i].y = dy[firstIndex[i]];
+                        const BinIndexType * const bins = _binnedFeatures->bins(featureIndex);
+                        for (size_t i = first; i < last; ++i)
+                        {
+                            items[i].x = bins[firstIndex[i]];
+                            items[i].y = dy[firstIndex[i]];
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = first; i < last; ++i)
+                        {
+                            items[i].x = dx[featureIndex][firstIndex[i]];
+                            items[i].y = dy[firstIndex[i]];
+                        }
                     }
                     if (dw)
                     {
@@ -1859,7 +2132,19 @@ protected:
                     }
                 }
 
-                introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+                if (_binnedFeatures)
+                {
+                    if (!_binnedFeatures->sort(items, &items[indexCount], featureIndex))
+                    {
+                        daal_free(items);
+                        safeStat.add(services::ErrorMemoryAllocationFailed);
+                        return;
+                    }
+                }
+                else
+                {
+                    introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+                }
                 DAAL_ASSERT(isSorted<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; }));
 
                 Item * next  = nullptr;
@@ -1878,13 +2163,7 @@ protected:
                     local->winnerIsLeaf              = false;
                     local->winnerFeatureIndex        = featureIndex;
                     local->winnerSplitCriterionValue = local->splitCriterionValue;
-                    switch (featureTypesCache[featureIndex])
-                    {
-                    case data_management::features::DAAL_CATEGORICAL: local->winnerCutPoint = i->x; break;
-                    case data_management::features::DAAL_ORDINAL: local->winnerCutPoint = next->x; break;
-                    case data_management::features::DAAL_CONTINUOUS: local->winnerCutPoint = (i->x + next->x) / 2; break;
-                    default: DAAL_ASSERT(false); break;
-                    }
+                    local->winnerCutPoint = cutPoint(featureTypesCache[featureIndex], featureIndex, i->x, next->x);
                     local->winnerPointsAtLeft   = next - items; // distance.
                     local->winnerDataStatistics = local->bestCutPointDataStatistics;
                 }
@@ -1973,10 +2252,22 @@ protected:
                 Item * items = daal_alloc<Item>(indexCount);
                 DAAL_CHECK_MALLOC_THR(items)
 
-                for (size_t i = 0; i < indexCount; ++i)
+                if (_binnedFeatures)
                 {
-                    items[i].x = dx[featureIndex][firstIndex[i]];
-                    items[i].y = dy[firstIndex[i]];
+                    const BinIndexType * const bins = _binnedFeatures->bins(featureIndex);
+                    for (size_t i = 0; i < indexCount; ++i)
+                    {
+                        items[i].x = bins[firstIndex[i]];
+                        items[i].y = dy[firstIndex[i]];
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < indexCount; ++i)
+                    {
+                        items[i].x = dx[featureIndex][firstIndex[i]];
+                        items[i].y = dy[firstIndex[i]];
+                    }
                 }
                 if (dw)
                 {
@@ -1985,7 +2276,19 @@ protected:
                         items[i].w = dw[firstIndex[i]];
                     }
                 }
-                introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+                if (_binnedFeatures)
+                {
+                    if (!_binnedFeatures->sort(items, &items[indexCount], featureIndex))
+                    {
+                        daal_free(items);
+                        safeStat.add(services::ErrorMemoryAllocationFailed);
+                        return;
+                    }
+                }
+                else
+                {
+                    introSort<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; });
+                }
                 DAAL_ASSERT(isSorted<cpu>(items, &items[indexCount], [](const Item & v1, const Item & v2) -> bool { return v1.x < v2.x; }));
 
                 Item * next  = nullptr;
@@ -2004,13 +2307,7 @@ protected:
                     local->winnerIsLeaf              = false;
                     local->winnerFeatureIndex        = featureIndex;
                     local->winnerSplitCriterionValue = local->splitCriterionValue;
-                    switch (featureTypesCache[featureIndex])
-                    {
-                    case data_management::features::DAAL_CATEGORICAL: local->winnerCutPoint = i->x; break;
-                    case data_management::features::DAAL_ORDINAL: local->winnerCutPoint = next->x; break;
-                    case data_management::features::DAAL_CONTINUOUS: local->winnerCutPoint = (i->x + next->x) / 2; break;
-                    default: DAAL_ASSERT(false); break;
-                    }
+                    local->winnerCutPoint = cutPoint(featureTypesCache[featureIndex], featureIndex, i->x, next->x);
                     local->winnerPointsAtLeft   = next - items; // distance.
                     local->winnerDataStatistics = local->bestCutPointDataStatistics;
                 }
@@ -2073,6 +2370,7 @@ private:
     TreeNodeType * _nodes;
     size_t _nodeCount;
     size_t _nodeCapacity;
+    const BinnedFeaturesType * _binnedFeatures;
 };
 
 template <CpuType cpu, typename DependentVariable>
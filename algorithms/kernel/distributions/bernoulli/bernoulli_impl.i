@@ -139,7 +139,7 @@ Status BernoulliKernel<algorithmFPType, method, cpu>::compute(algorithmFPType p,
 {
     NumericTableDictionary * resultDict = resultTable->getDictionary();
     if (resultDict->getFeaturesEqual() == DictionaryIface::equal && resultTable->getDataLayout() == NumericTableIface::aos
-        && (*resultDict)[0].indexType == features::DAAL_INT32_S) /* if table is HomogenNT<int> */
+        && resultDict->getFeature(0).indexType == features::DAAL_INT32_S) /* if table is HomogenNT<int> */
     {
         size_t n          = resultTable->getNumberOfRows() * resultTable->getNumberOfColumns();
         int * resultArray = ((HomogenNumericTable<int> *)resultTable)->getArray();
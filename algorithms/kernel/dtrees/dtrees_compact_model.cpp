@@ -0,0 +1,228 @@
+/* file: dtrees_compact_model.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the compact representation of the trees of the decision forest model
+//--
+*/
+
+#include "algorithms/kernel/dtrees/dtrees_compact_model.h"
+#include "algorithms/kernel/service_sort.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+/* Maximal number of distinct split values of a feature referenced by the 16-bit index */
+static const size_t maxThresholdsPerFeature = 1 << 16;
+
+static const DecisionTreeNode * getTreeNodes(const DataCollection & trees, size_t iTree, size_t & nNodes)
+{
+    const DecisionTreeTable * const table = static_cast<const DecisionTreeTable *>(trees[iTree].get());
+    nNodes                                = table ? table->getNumberOfRows() : 0;
+    return table ? (const DecisionTreeNode *)table->getArray() : nullptr;
+}
+
+/* Returns the index of the value in the sorted array of distinct values */
+static size_t findThreshold(const ModelFPType * thresholds, size_t n, ModelFPType value)
+{
+    size_t first = 0;
+    while (n > 0)
+    {
+        const size_t half = n / 2;
+        if (thresholds[first + half] < value)
+        {
+            first += half + 1;
+            n -= half + 1;
+        }
+        else
+        {
+            n = half;
+        }
+    }
+    return first;
+}
+
+Status CompactForest::build(const DataCollection & trees, size_t nTrees, bool isRegression)
+{
+    _isRegression = isRegression;
+
+    /* Number of the nodes and the features, numbers of the splits by the features */
+    size_t nNodesTotal = 0;
+    size_t nLeaves     = 0;
+    _nFeatures         = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        size_t nNodes                        = 0;
+        const DecisionTreeNode * const aNode = getTreeNodes(trees, iTree, nNodes);
+        DAAL_CHECK(aNode || !nNodes, ErrorNullPtr);
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            DAAL_CHECK(aNode[i].featureIndex >= -1, ErrorIncorrectParameter);
+            DAAL_CHECK(aNode[i].featureIndex < int(CompactTreeNode::leafFeatureIndex), ErrorIncorrectNumberOfFeatures);
+            if (aNode[i].isSplit())
+            {
+                DAAL_CHECK(aNode[i].leftIndexOrClass > i && aNode[i].leftIndexOrClass + 1 < nNodes, ErrorIncorrectParameter);
+                if (size_t(aNode[i].featureIndex) >= _nFeatures) _nFeatures = aNode[i].featureIndex + 1;
+            }
+            else
+            {
+                ++nLeaves;
+            }
+        }
+        nNodesTotal += nNodes;
+    }
+    DAAL_CHECK(nNodesTotal <= size_t(uint32_t(-1)), ErrorIncorrectParameter);
+
+    Collection<size_t> nSplits(_nFeatures + 1);
+    DAAL_CHECK_MALLOC(nSplits.data() || !_nFeatures);
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        size_t nNodes                        = 0;
+        const DecisionTreeNode * const aNode = getTreeNodes(trees, iTree, nNodes);
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            if (aNode[i].isSplit()) ++nSplits[aNode[i].featureIndex + 1];
+        }
+    }
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature) nSplits[iFeature + 1] += nSplits[iFeature];
+
+    /* Split values grouped by the features, sorted and deduplicated within every feature */
+    Collection<ModelFPType> values(nSplits[_nFeatures]);
+    Collection<size_t> positions(nSplits);
+    DAAL_CHECK_MALLOC((values.data() && positions.data()) || !nSplits[_nFeatures]);
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        size_t nNodes                        = 0;
+        const DecisionTreeNode * const aNode = getTreeNodes(trees, iTree, nNodes);
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            if (aNode[i].isSplit()) values[positions[aNode[i].featureIndex]++] = aNode[i].featureValue();
+        }
+    }
+
+    DAAL_CHECK_MALLOC(_thresholdOffsets.resize(_nFeatures + 1));
+    _thresholdOffsets.push_back(0);
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        ModelFPType * const featureValues = values.data() + nSplits[iFeature];
+        const size_t nFeatureValues       = nSplits[iFeature + 1] - nSplits[iFeature];
+        daal::algorithms::internal::qSort<ModelFPType, sse2>(nFeatureValues, featureValues);
+        size_t nDistinct = 0;
+        for (size_t i = 0; i < nFeatureValues; ++i)
+        {
+            if (!nDistinct || featureValues[nDistinct - 1] != featureValues[i]) featureValues[nDistinct++] = featureValues[i];
+        }
+        DAAL_CHECK(nDistinct <= maxThresholdsPerFeature, ErrorIncorrectParameter);
+        _thresholdOffsets.push_back(_thresholdOffsets[iFeature] + nDistinct);
+    }
+
+    DAAL_CHECK_MALLOC(_thresholds.resize(_thresholdOffsets[_nFeatures]));
+    for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+    {
+        const size_t nDistinct = _thresholdOffsets[iFeature + 1] - _thresholdOffsets[iFeature];
+        for (size_t i = 0; i < nDistinct; ++i) _thresholds.push_back(values[nSplits[iFeature] + i]);
+    }
+
+    /* Nodes of the trees in the order of the tables */
+    DAAL_CHECK_MALLOC(_nodes.resize(nNodesTotal) && _treeOffsets.resize(nTrees + 1));
+    if (_isRegression) DAAL_CHECK_MALLOC(_responses.resize(nLeaves));
+    _treeOffsets.push_back(0);
+    for (size_t iTree = 0; iTree < nTrees; ++iTree)
+    {
+        size_t nNodes                        = 0;
+        const DecisionTreeNode * const aNode = getTreeNodes(trees, iTree, nNodes);
+        for (size_t i = 0; i < nNodes; ++i)
+        {
+            CompactTreeNode node;
+            if (aNode[i].isSplit())
+            {
+                const size_t iFeature = aNode[i].featureIndex;
+                const size_t first    = _thresholdOffsets[iFeature];
+                node.featureIndex     = uint16_t(iFeature);
+                node.thresholdIndex =
+                    uint16_t(findThreshold(_thresholds.data() + first, _thresholdOffsets[iFeature + 1] - first, aNode[i].featureValue()));
+                node.leftOffsetOrValue = uint32_t(aNode[i].leftIndexOrClass - i);
+            }
+            else
+            {
+                node.featureIndex   = CompactTreeNode::leafFeatureIndex;
+                node.thresholdIndex = 0;
+                if (_isRegression)
+                {
+                    node.leftOffsetOrValue = uint32_t(_responses.size());
+                    _responses.push_back(aNode[i].featureValueOrResponse);
+                }
+                else
+                {
+                    DAAL_CHECK(aNode[i].leftIndexOrClass <= size_t(uint32_t(-1)), ErrorIncorrectParameter);
+                    node.leftOffsetOrValue = uint32_t(aNode[i].leftIndexOrClass);
+                }
+            }
+            _nodes.push_back(node);
+        }
+        _treeOffsets.push_back(_treeOffsets[iTree] + nNodes);
+    }
+    return Status();
+}
+
+Status CompactForest::expandTree(size_t iTree, DecisionTreeTablePtr & table) const
+{
+    const size_t nNodes = getNumberOfNodes(iTree);
+    table.reset(new DecisionTreeTable(nNodes));
+    DAAL_CHECK_MALLOC(table.get() && (table->getArray() || !nNodes));
+
+    const CompactTreeNode * const aNode = getNodes(iTree);
+    DecisionTreeNode * const aRow       = (DecisionTreeNode *)table->getArray();
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        if (aNode[i].isSplit())
+        {
+            aRow[i].featureIndex           = aNode[i].featureIndex;
+            aRow[i].leftIndexOrClass       = i + aNode[i].leftOffsetOrValue;
+            aRow[i].featureValueOrResponse = getThreshold(aNode[i]);
+        }
+        else if (_isRegression)
+        {
+            setNode(aRow[i], -1, double(getResponse(aNode[i])));
+        }
+        else
+        {
+            setNode(aRow[i], -1, size_t(aNode[i].leftOffsetOrValue));
+        }
+    }
+    return Status();
+}
+
+size_t CompactForest::getSize() const
+{
+    return _nodes.size() * sizeof(CompactTreeNode) + (_treeOffsets.size() + _thresholdOffsets.size()) * sizeof(size_t)
+           + (_thresholds.size() + _responses.size()) * sizeof(ModelFPType);
+}
+
+} // namespace internal
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
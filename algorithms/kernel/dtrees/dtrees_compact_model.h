@@ -0,0 +1,101 @@
+/* file: dtrees_compact_model.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Compact representation of the trees of the decision forest model
+//--
+*/
+
+#ifndef __DTREES_COMPACT_MODEL_H__
+#define __DTREES_COMPACT_MODEL_H__
+
+#include "algorithms/kernel/dtrees/dtrees_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace internal
+{
+/* Node of the tree in the compact representation, 8 bytes instead of 24 bytes of DecisionTreeNode.
+   The nodes keep the indices of DecisionTreeTable, so the tables indexed by the nodes (e.g. probabilities) stay valid.
+   The left child of the split is at the offset from the split, the right child follows the left one */
+struct CompactTreeNode
+{
+    static const uint16_t leafFeatureIndex = 0xFFFF;
+
+    uint16_t featureIndex;      //split: index of the feature, leaf: leafFeatureIndex
+    uint16_t thresholdIndex;    //split: index of the split value in the table of the distinct split values of the feature
+    uint32_t leftOffsetOrValue; //split: offset of the left child, classification leaf: class index, regression leaf: index of the response
+
+    DAAL_FORCEINLINE bool isSplit() const { return featureIndex != leafFeatureIndex; }
+};
+
+/* Trees of the decision forest in the compact representation. The split values of every feature are kept once in the sorted table
+   of the distinct split values of the feature used by the trees, the splits refer to them by 16-bit indices.
+   For the models trained with the histogram method the table of a feature holds the borders of the training bins used by the splits */
+class CompactForest : public Base
+{
+public:
+    CompactForest() : _nFeatures(0), _isRegression(false) {}
+
+    /* Builds the compact representation of the tables of the trees. Fails with ErrorIncorrectNumberOfFeatures if a split uses
+       a feature index not fitting 16 bits and with ErrorIncorrectParameter if a feature has more than 65536 distinct split values
+       or the tree has nodes not completed by the model builder */
+    services::Status build(const data_management::DataCollection & trees, size_t nTrees, bool isRegression);
+
+    /* Restores the table of the tree */
+    services::Status expandTree(size_t iTree, DecisionTreeTablePtr & table) const;
+
+    size_t getNumberOfTrees() const { return _treeOffsets.size() ? _treeOffsets.size() - 1 : 0; }
+    size_t getNumberOfNodes(size_t iTree) const { return _treeOffsets[iTree + 1] - _treeOffsets[iTree]; }
+    bool isRegression() const { return _isRegression; }
+
+    const CompactTreeNode * getNodes(size_t iTree) const { return _nodes.data() + _treeOffsets[iTree]; }
+
+    /* Returns the split value of the split node */
+    DAAL_FORCEINLINE ModelFPType getThreshold(const CompactTreeNode & node) const
+    {
+        return _thresholds[_thresholdOffsets[node.featureIndex] + node.thresholdIndex];
+    }
+
+    /* Returns the response of the leaf of the regression tree */
+    DAAL_FORCEINLINE ModelFPType getResponse(const CompactTreeNode & node) const { return _responses[node.leftOffsetOrValue]; }
+
+    /* Returns the number of bytes taken by the representation */
+    size_t getSize() const;
+
+private:
+    size_t _nFeatures;
+    bool _isRegression;
+    services::Collection<CompactTreeNode> _nodes;
+    services::Collection<size_t> _treeOffsets;      /* Index of the first node of every tree and the total number of nodes */
+    services::Collection<ModelFPType> _thresholds;  /* Sorted distinct split values of every feature */
+    services::Collection<size_t> _thresholdOffsets; /* Index of the first split value of every feature and the total number of values */
+    services::Collection<ModelFPType> _responses;   /* Responses of the leaves of the regression trees */
+};
+typedef services::SharedPtr<CompactForest> CompactForestPtr;
+
+} // namespace internal
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -107,6 +107,8 @@ IndexedFeatures::FeatureEntry::~FeatureEntry()
 {
     if (binBorders) daal::services::daal_free(binBorders);
     binBorders = nullptr;
+    if (categories) daal::services::daal_free(categories);
+    categories = nullptr;
 }
 
 services::Status IndexedFeatures::FeatureEntry::allocBorders()
@@ -120,9 +122,21 @@ services::Status IndexedFeatures::FeatureEntry::allocBorders()
     return binBorders ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed);
 }
 
+services::Status IndexedFeatures::FeatureEntry::allocCategories()
+{
+    if (categories)
+    {
+        daal::services::daal_free(categories);
+        categories = nullptr;
+    }
+    categories = (int *)services::daal_calloc(sizeof(int) * numIndices);
+    return categories ? services::Status() : services::Status(services::ErrorMemoryAllocationFailed);
+}
+
 services::Status IndexedFeatures::alloc(size_t nC, size_t nR)
 {
     const size_t newCapacity = nC * nR;
+    _sizeOfIndex             = sizeof(IndexType);
     if (_data)
     {
         if (newCapacity > _capacity)
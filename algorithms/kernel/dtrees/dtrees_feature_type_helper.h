@@ -81,7 +81,8 @@ struct BinParams
 //////////////////////////////////////////////////////////////////////////////////////////
 // IndexedFeatures. Creates and stores index of every feature
 // Sorts every feature and creates the mapping: features value -> index of the value
-// in the sorted array of unique values of the feature in increasing order
+// in the sorted array of unique values of the feature in increasing order.
+// Missing (NaN) values of an ordered feature are mapped to index 0 preceding the indices of the other values
 //////////////////////////////////////////////////////////////////////////////////////////
 class IndexedFeatures
 {
@@ -93,8 +94,11 @@ public:
         DAAL_NEW_DELETE();
         IndexType numIndices     = 0;       //number of indices or bins
         ModelFPType * binBorders = nullptr; //right bin borders
+        bool hasMissing          = false;   //index 0 is reserved for the missing values
+        int * categories         = nullptr; //category values of the indices of an unordered feature
 
         services::Status allocBorders();
+        services::Status allocCategories();
         ~FeatureEntry();
     };
 
@@ -111,6 +115,9 @@ public:
     //get max number of indices among all features
     IndexType maxNumIndices() const { return _maxNumIndices; }
 
+    //returns true if index 0 of the feature is reserved for the missing values
+    bool hasMissing(size_t iCol) const { return _entries[iCol].hasMissing; }
+
     //returns true if the feature is mapped to bins
     bool isBinned(size_t iCol) const
     {
@@ -126,8 +133,38 @@ public:
         return _entries[iCol].binBorders[iBin];
     }
 
-    //for low-level optimization
-    const IndexType * data(size_t iFeature) const { return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex); }
+    //returns true if the category values of the indices of the unordered feature are known
+    bool hasCategories(size_t iCol) const { return !!_entries[iCol].categories; }
+
+    //returns the category value of the index of the unordered feature, negative for the missing values
+    int category(size_t iCol, size_t idx) const
+    {
+        DAAL_ASSERT(hasCategories(iCol));
+        DAAL_ASSERT(idx < numIndices(iCol));
+        return _entries[iCol].categories[idx];
+    }
+
+    //for low-level optimization, the indices must not be compressed
+    const IndexType * data(size_t iFeature) const
+    {
+        DAAL_ASSERT(_sizeOfIndex == sizeof(IndexType));
+        return (IndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex);
+    }
+
+    //for low-level optimization, BinIndexType must be of the size of the stored indices
+    template <typename BinIndexType>
+    const BinIndexType * dataAs(size_t iFeature) const
+    {
+        DAAL_ASSERT(_sizeOfIndex == sizeof(BinIndexType));
+        return (const BinIndexType *)(((char *)_data) + _nRows * iFeature * _sizeOfIndex);
+    }
+
+    //size of the stored index in bytes: 1 or 2 if the indices are compressed, sizeof(IndexType) otherwise
+    size_t sizeOfIndex() const { return _sizeOfIndex; }
+
+    //stores the indices in 1 or 2 bytes if the number of indices of every feature allows it
+    template <CpuType cpu>
+    services::Status compress();
 
     size_t nRows() const { return _nRows; }
     size_t nCols() const { return _nCols; }
@@ -145,6 +182,29 @@ protected:
     size_t _maxNumIndices;
 };
 
+//runs the statement with BinIndexType defined as the type of the indices stored by the indexed features
+#define DAAL_DISPATCH_BIN_INDEX_TYPE(indexedFeatures, ...)                 \
+    switch ((indexedFeatures).sizeOfIndex())                               \
+    {                                                                      \
+    case sizeof(uint8_t):                                                  \
+    {                                                                      \
+        typedef uint8_t BinIndexType;                                      \
+        __VA_ARGS__;                                                       \
+    }                                                                      \
+    break;                                                                 \
+    case sizeof(uint16_t):                                                 \
+    {                                                                      \
+        typedef uint16_t BinIndexType;                                     \
+        __VA_ARGS__;                                                       \
+    }                                                                      \
+    break;                                                                 \
+    default:                                                               \
+    {                                                                      \
+        typedef dtrees::internal::IndexedFeatures::IndexType BinIndexType; \
+        __VA_ARGS__;                                                       \
+    }                                                                      \
+    }
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
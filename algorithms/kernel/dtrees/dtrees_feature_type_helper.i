@@ -25,6 +25,7 @@
 #include "algorithms/kernel/service_error_handling.h"
 #include "algorithms/kernel/service_sort.h"
 #include "algorithms/kernel/dtrees/service_array.h"
+#include "service/kernel/service_data_utils.h"
 #include "externals/service_memory.h"
 
 namespace daal
@@ -39,8 +40,8 @@ template <typename IndexType, typename algorithmFPType, CpuType cpu>
 struct ColIndexTask
 {
     DAAL_NEW_DELETE();
-    ColIndexTask(size_t nRows) : _index(nRows), maxNumDiffValues(1) {}
-    bool isValid() const { return _index.get(); }
+    ColIndexTask(size_t nRows) : _index(nRows), _sortBuffer(nRows), maxNumDiffValues(1), _nMissing(0) {}
+    bool isValid() const { return _index.get() && _sortBuffer.get(); }
 
     struct FeatureIdx
     {
@@ -63,19 +64,21 @@ struct ColIndexTask
     services::Status makeIndexDefault(NumericTable & nt, IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t iCol, size_t nRows,
                                       bool bUnorderedFeature)
     {
-        Status s = this->getSorted(nt, iCol, nRows);
+        services::Status s = this->getSorted(nt, iCol, nRows);
         if (!s) return s;
         const FeatureIdx * index = _index.get();
-        if (index[0].key == index[nRows - 1].key)
+        const size_t nValues     = nRows - _nMissing;
+        if (!nValues || (!_nMissing && (index[0].key == index[nRows - 1].key)))
         {
             entry.numIndices = 1;
             for (size_t i = 0; i < nRows; ++i) aRes[i] = 0;
             return s;
         }
-        IndexType iUnique    = 0;
+        setMissingIndex(entry, aRes, nRows);
+        IndexType iUnique    = (_nMissing ? 1 : 0);
         aRes[index[0].val]   = iUnique;
         algorithmFPType prev = index[0].key;
-        for (size_t i = 1; i < nRows; ++i)
+        for (size_t i = 1; i < nValues; ++i)
         {
             const IndexType idx = index[i].val;
             if (index[i].key == prev)
@@ -89,30 +92,64 @@ struct ColIndexTask
         ++iUnique;
         entry.numIndices = iUnique;
         if (maxNumDiffValues < iUnique) maxNumDiffValues = iUnique;
-        return services::Status();
+        return bUnorderedFeature ? setCategories(entry, aRes, nValues) : services::Status();
     }
 
 public:
     size_t maxNumDiffValues;
 
 protected:
-    Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
+    //sorts the values of the feature, the rows with missing (NaN) values are placed after the sorted ones
+    services::Status getSorted(NumericTable & nt, size_t iCol, size_t nRows)
     {
         const algorithmFPType * pBlock = _block.set(&nt, iCol, 0, nRows);
         DAAL_CHECK_BLOCK_STATUS(_block);
         FeatureIdx * index = _index.get();
+        size_t nValues     = 0;
+        _nMissing          = 0;
         for (size_t i = 0; i < nRows; ++i)
         {
-            index[i].key = pBlock[i];
-            index[i].val = i;
+            if (services::internal::IsNaN<algorithmFPType, cpu>::get(pBlock[i]))
+            {
+                ++_nMissing;
+                FeatureIdx & missing = index[nRows - _nMissing];
+                missing.key          = pBlock[i];
+                missing.val          = i;
+            }
+            else
+            {
+                index[nValues].key = pBlock[i];
+                index[nValues].val = i;
+                ++nValues;
+            }
         }
-        daal::algorithms::internal::qSortByKey<FeatureIdx, cpu>(nRows, index);
-        return Status();
+        return daal::algorithms::internal::radixSortByKey<cpu, algorithmFPType>(index, _sortBuffer.get(), nValues);
+    }
+
+    //the missing values of the feature are mapped to index 0, the first one in the increasing order
+    void setMissingIndex(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows) const
+    {
+        entry.hasMissing         = (_nMissing > 0);
+        const FeatureIdx * index = _index.get();
+        for (size_t i = nRows - _nMissing; i < nRows; ++i) aRes[index[i].val] = 0;
+    }
+
+    //keeps the category value of every index of the unordered feature, the index of the missing values gets a negative one
+    services::Status setCategories(IndexedFeatures::FeatureEntry & entry, const IndexType * aRes, size_t nValues) const
+    {
+        services::Status s = entry.allocCategories();
+        if (!s) return s;
+        const FeatureIdx * index = _index.get();
+        if (entry.hasMissing) entry.categories[0] = -1;
+        for (size_t i = 0; i < nValues; ++i) entry.categories[aRes[index[i].val]] = int(index[i].key);
+        return s;
     }
 
 protected:
     daal::internal::ReadColumns<algorithmFPType, cpu> _block;
     TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _index;
+    TVector<FeatureIdx, cpu, DefaultAllocator<cpu> > _sortBuffer;
+    size_t _nMissing; //number of rows with missing values of the last sorted feature
 };
 
 template <typename IndexType, typename algorithmFPType, CpuType cpu>
@@ -124,6 +161,8 @@ struct ColIndexTaskBins : public ColIndexTask<IndexType, algorithmFPType, cpu>
                                        bool bUnorderedFeature) DAAL_C11_OVERRIDE;
 
 private:
+    services::Status makeIndexWithMissing(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows);
+    services::Status makeBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows, size_t nValues, size_t maxBins);
     services::Status assignIndexAccordingToBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nBins, size_t nRows);
 
 private:
@@ -163,27 +202,32 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::assignIndexA
                                                                                                IndexType * aRes, size_t nBins, size_t nRows)
 {
     const typename super::FeatureIdx * index = this->_index.get();
+    const size_t nValues                     = nRows - this->_nMissing;
 
-    if (nBins == 1)
+    if (nBins == 1 && !this->_nMissing)
     {
         entry.numIndices   = 1;
         services::Status s = entry.allocBorders();
         DAAL_CHECK(s, s);
         services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
 
-        entry.binBorders[0] = index[nRows - 1].key;
+        entry.binBorders[0] = index[nValues - 1].key;
         _bins[0]            = nRows;
-        return Status();
+        return services::Status();
     }
-    entry.numIndices   = nBins;
-    services::Status s = entry.allocBorders();
+    //the bin of the missing values has the lowest border, so that all the other values are greater than it
+    const size_t iFirstBin = (this->_nMissing ? 1 : 0);
+    entry.numIndices       = nBins + iFirstBin;
+    services::Status s     = entry.allocBorders();
     if (!s) return s;
+    this->setMissingIndex(entry, aRes, nRows);
+    if (iFirstBin) entry.binBorders[0] = -services::internal::MaxVal<ModelFPType>::get();
 
     size_t i = 0;
     for (size_t iBin = 0; iBin < nBins; ++iBin)
     {
-        for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin;
-        entry.binBorders[iBin] = index[i - 1].key;
+        for (size_t n = i + _bins[iBin]; i < n; ++i) aRes[index[i].val] = iBin + iFirstBin;
+        entry.binBorders[iBin + iFirstBin] = index[i - 1].key;
     }
     if (this->maxNumDiffValues < entry.numIndices) this->maxNumDiffValues = entry.numIndices;
     return s;
@@ -195,10 +239,11 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
 {
     if (bUnorderedFeature || nRows <= _prm.maxBins) return this->makeIndexDefault(nt, entry, aRes, iCol, nRows, bUnorderedFeature);
 
-    Status s = this->getSorted(nt, iCol, nRows);
+    services::Status s = this->getSorted(nt, iCol, nRows);
     if (!s) return s;
 
     const typename super::FeatureIdx * index = this->_index.get();
+    if (this->_nMissing) return makeIndexWithMissing(entry, aRes, nRows);
     if (index[0].key == index[nRows - 1].key)
     {
         _bins[0] = nRows;
@@ -210,11 +255,57 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         entry.binBorders[0] = index[nRows - 1].key;
         return s;
     }
+    return makeBins(entry, aRes, nRows, nRows, _prm.maxBins);
+}
+
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndexWithMissing(IndexedFeatures::FeatureEntry & entry, IndexType * aRes,
+                                                                                         size_t nRows)
+{
+    const typename super::FeatureIdx * index = this->_index.get();
+    const size_t nValues                     = nRows - this->_nMissing;
+    if (!nValues)
+    {
+        //no values but the missing ones
+        services::internal::service_memset_seq<IndexType, cpu>(aRes, 0, nRows);
+        entry.numIndices   = 1;
+        services::Status s = entry.allocBorders();
+        DAAL_CHECK(s, s);
+        entry.binBorders[0] = -services::internal::MaxVal<ModelFPType>::get();
+        return s;
+    }
+    if (index[0].key == index[nValues - 1].key)
+    {
+        _bins[0] = nValues;
+        return assignIndexAccordingToBins(entry, aRes, 1, nRows);
+    }
+    //one of the bins is occupied by the missing values
+    const size_t maxBins = (_prm.maxBins > 2 ? _prm.maxBins - 1 : 1);
+    if (nValues > maxBins) return makeBins(entry, aRes, nRows, nValues, maxBins);
+
+    //few values, every one of them gets its own bin
+    size_t nBins = 0;
+    size_t iPrev = 0;
+    for (size_t i = 1; i < nValues; ++i)
+    {
+        if (index[i].key == index[iPrev].key) continue;
+        append(_bins, nBins, i - iPrev);
+        iPrev = i;
+    }
+    append(_bins, nBins, nValues - iPrev);
+    return assignIndexAccordingToBins(entry, aRes, nBins, nRows);
+}
+
+template <typename IndexType, typename algorithmFPType, CpuType cpu>
+services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeBins(IndexedFeatures::FeatureEntry & entry, IndexType * aRes, size_t nRows,
+                                                                             size_t nValues, size_t maxBins)
+{
+    const typename super::FeatureIdx * index = this->_index.get();
 
     size_t nBins         = 0;
-    const size_t binSize = nRows / _prm.maxBins;
+    const size_t binSize = nValues / maxBins;
     size_t i             = 0;
-    for (; (i + binSize < nRows) && (nBins < _prm.maxBins);)
+    for (; (i + binSize < nValues) && (nBins < maxBins);)
     {
         //trying to make a bin of size binSize
         size_t newBinSize                     = binSize;
@@ -227,10 +318,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
             ++iRight;
             size_t r = iRight + binSize;
             //at first, roughly locate the value bigger than iRight, jumping by binSize to the right
-            for (; (r < nRows) && (index[r].key == ri.key); r += binSize)
+            for (; (r < nValues) && (index[r].key == ri.key); r += binSize)
             {
             }
-            if (r > nRows) r = nRows;
+            if (r > nValues) r = nValues;
             //then locate a new border as the upper_bound between this rough value and iRight
             iRight = upper_bound<typename super::FeatureIdx>(index + iRight + 1, index + r, ri) - index;
             //this is the size of the bin
@@ -264,10 +355,10 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
         append(_bins, nBins, newBinSize);
         i += newBinSize;
     }
-    if (i < nRows)
+    if (i < nValues)
     {
-        size_t newBinSize = nRows - i;
-        if (((nBins < _prm.maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
+        size_t newBinSize = nValues - i;
+        if (((nBins < maxBins) && (newBinSize >= _prm.minBinSize)) || nBins == 0)
         {
             append(_bins, nBins, newBinSize);
         }
@@ -281,7 +372,7 @@ services::Status ColIndexTaskBins<IndexType, algorithmFPType, cpu>::makeIndex(Nu
     //run-time check for bins correctness
     size_t nTotal = 0;
     for(size_t i = 0; i < nBins; nTotal += _bins[i], ++i);
-    DAAL_ASSERT(nTotal == nRows);
+    DAAL_ASSERT(nTotal == nValues);
     size_t iBorder = 0;
     for(size_t i = 1; i < nBins; ++i)
     {
@@ -338,6 +429,39 @@ services::Status IndexedFeatures::init(const NumericTable & nt, const FeatureTyp
     return safeStat.detach();
 }
 
+template <typename BinIndexType, CpuType cpu>
+static void copyIndices(BinIndexType * dst, const IndexedFeatures::IndexType * src, size_t nRows, size_t nCols)
+{
+    daal::threader_for(nCols, nCols, [&](size_t iCol) {
+        BinIndexType * pDst                     = dst + iCol * nRows;
+        const IndexedFeatures::IndexType * pSrc = src + iCol * nRows;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i) pDst[i] = BinIndexType(pSrc[i]);
+    });
+}
+
+template <CpuType cpu>
+services::Status IndexedFeatures::compress()
+{
+    if (_sizeOfIndex != sizeof(IndexType) || _maxNumIndices > (1 << 16)) return services::Status();
+
+    const size_t sizeOfIndex = (_maxNumIndices > (1 << 8)) ? sizeof(uint16_t) : sizeof(uint8_t);
+    void * data              = services::daal_malloc(sizeOfIndex * _nRows * _nCols);
+    DAAL_CHECK_MALLOC(data);
+
+    if (sizeOfIndex == sizeof(uint8_t))
+        copyIndices<uint8_t, cpu>((uint8_t *)data, _data, _nRows, _nCols);
+    else
+        copyIndices<uint16_t, cpu>((uint16_t *)data, _data, _nRows, _nCols);
+
+    services::daal_free(_data);
+    _data        = (IndexType *)data;
+    _sizeOfIndex = sizeOfIndex;
+    _capacity    = 0; //the buffer is reallocated by the next init
+    return services::Status();
+}
+
 } /* namespace internal */
 } /* namespace dtrees */
 } /* namespace algorithms */
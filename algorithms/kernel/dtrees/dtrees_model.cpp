@@ -22,6 +22,10 @@
 */
 
 #include "algorithms/kernel/dtrees/dtrees_model_impl.h"
+#include "algorithms/kernel/dtrees/dtrees_compact_model.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "service/kernel/service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -36,7 +40,7 @@ namespace internal
 {
 Tree::~Tree() {}
 
-ModelImpl::ModelImpl() : _nTree(0) {}
+ModelImpl::ModelImpl() : _nTree(0), _isRestored(0) {}
 
 ModelImpl::~ModelImpl()
 {
@@ -49,6 +53,8 @@ void ModelImpl::destroy()
     _impurityTables.reset();
     _nNodeSampleTables.reset();
     _probTbl.reset();
+    _compactForest.reset();
+    resetRestoredTrees();
 }
 
 bool ModelImpl::reserve(const size_t nTrees)
@@ -91,9 +97,112 @@ void ModelImpl::clear()
 
     if (_probTbl.get()) _probTbl.reset();
 
+    _compactForest.reset();
+    resetRestoredTrees();
     _nTree.set(0);
 }
 
+static DataCollectionPtr appendCollection(const DataCollectionPtr & dst, size_t nDst, const DataCollectionPtr & src, size_t nSrc)
+{
+    DataCollectionPtr res(new DataCollection(nDst + nSrc));
+    if (!res.get()) return res;
+    for (size_t i = 0; i < nDst; ++i)
+    {
+        if (dst.get()) (*res)[i] = (*dst)[i];
+    }
+    for (size_t i = 0; i < nSrc; ++i)
+    {
+        if (src.get()) (*res)[nDst + i] = (*src)[i];
+    }
+    return res;
+}
+
+bool ModelImpl::append(const ModelImpl & other)
+{
+    if (!expand()) return false;
+    if (other._compactForest.get() && !other.restoreTrees()) return false;
+    const size_t n      = size();
+    const size_t nOther = other.size();
+
+    /* The tables of the trees are not modified after the training, so they are shared with the other model */
+    const DataCollectionPtr & otherTrees = other._compactForest.get() ? other._restoredTrees : other._serializationData;
+    DataCollectionPtr serializationData  = appendCollection(_serializationData, n, otherTrees, nOther);
+    DataCollectionPtr impurityTables    = appendCollection(_impurityTables, n, other._impurityTables, nOther);
+    DataCollectionPtr nNodeSampleTables = appendCollection(_nNodeSampleTables, n, other._nNodeSampleTables, nOther);
+    DataCollectionPtr probTbl           = appendCollection(_probTbl, n, other._probTbl, nOther);
+    if (!serializationData.get() || !impurityTables.get() || !nNodeSampleTables.get() || !probTbl.get()) return false;
+
+    _serializationData = serializationData;
+    _impurityTables    = impurityTables;
+    _nNodeSampleTables = nNodeSampleTables;
+    _probTbl           = probTbl;
+    _nTree.set(n + nOther);
+    return true;
+}
+
+Status ModelImpl::compact(bool isRegression)
+{
+    if (_compactForest.get()) return Status();
+    DAAL_CHECK(_serializationData.get(), ErrorNullModel);
+
+    CompactForestPtr forest(new CompactForest());
+    DAAL_CHECK_MALLOC(forest.get());
+    Status s = forest->build(*_serializationData, size(), isRegression);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    resetRestoredTrees();
+    _compactForest = forest;
+    _serializationData.reset();
+    _impurityTables.reset();
+    _nNodeSampleTables.reset();
+    return s;
+}
+
+/* Guards the restoring of the tables by the concurrent readers of the compact models */
+static daal::Mutex restoreMutex;
+
+Status ModelImpl::restoreTrees() const
+{
+    if (_isRestored.get()) return Status();
+    AUTOLOCK(restoreMutex);
+    if (_isRestored.get()) return Status();
+
+    const size_t nTrees = _compactForest->getNumberOfTrees();
+    DataCollectionPtr trees(new DataCollection(nTrees));
+    DAAL_CHECK_MALLOC(trees.get());
+    Status s;
+    for (size_t iTree = 0; s && iTree < nTrees; ++iTree)
+    {
+        DecisionTreeTablePtr table;
+        s = _compactForest->expandTree(iTree, table);
+        (*trees)[iTree] = table;
+    }
+    DAAL_CHECK_STATUS_VAR(s);
+
+    /* The readers that see the flag set see the filled cache */
+    _restoredTrees = trees;
+    _isRestored.set(1);
+    return s;
+}
+
+void ModelImpl::resetRestoredTrees()
+{
+    _restoredTrees.reset();
+    _isRestored.set(0);
+}
+
+Status ModelImpl::expand()
+{
+    if (!_compactForest.get()) return Status();
+    Status s = restoreTrees();
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _serializationData = _restoredTrees;
+    _compactForest.reset();
+    resetRestoredTrees();
+    return s;
+}
+
 void MemoryManager::destroy()
 {
     for (size_t i = 0; i < _aChunk.size(); ++i)
@@ -338,6 +447,126 @@ services::Status addSplitNodeInternal(data_management::DataCollectionPtr & seria
     return s;
 }
 
+services::Status findEmptyTreeIds(const data_management::DataCollectionPtr & serializationData, const size_t nTrees, const size_t * const groups,
+                                  const size_t nGroups, const size_t groupSize, size_t * const treeIds)
+{
+    const size_t nSlots = (*serializationData).size();
+    DAAL_CHECK(nGroups * groupSize <= nSlots, services::ErrorID::ErrorIncorrectParameter);
+
+    services::internal::TArray<size_t, sse2> nextSlot(nGroups);
+    DAAL_CHECK_MALLOC(nextSlot.get());
+    for (size_t g = 0; g < nGroups; ++g) nextSlot[g] = g * groupSize;
+
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        const size_t g = groups ? groups[i] : 0;
+        DAAL_CHECK(g < nGroups, services::ErrorID::ErrorIncorrectParameter);
+        const size_t last = (g + 1) * groupSize;
+        size_t & slot     = nextSlot[g];
+        while (slot < last && (*serializationData)[slot].get()) slot++;
+        DAAL_CHECK(slot < last, services::ErrorID::ErrorIncorrectParameter);
+        treeIds[i] = slot++;
+    }
+    return services::Status();
+}
+
+/* Writes the tree in the layout of addSplitNodeInternal and addLeafNodeInternal: the nodes are stored in breadth-first order
+   and the children of a split node occupy two adjacent rows */
+static services::Status buildTreeFromArrays(DecisionTreeNode * const aNode, const size_t nNodes, const int * const featureIndices,
+                                            const double * const featureValues, const size_t * const leftChildren,
+                                            const size_t * const rightChildren, const bool isClassification, double * const prob,
+                                            const size_t nClasses)
+{
+    services::internal::TArray<size_t, sse2> order(nNodes);
+    services::internal::TArray<char, sse2> isVisited(nNodes);
+    DAAL_CHECK_MALLOC(order.get() && isVisited.get());
+    for (size_t i = 0; i < nNodes; ++i) isVisited[i] = 0;
+
+    order[0]     = 0;
+    isVisited[0] = 1;
+    size_t nRows = 1;
+    for (size_t row = 0; row < nRows; ++row)
+    {
+        const size_t src = order[row];
+        if (featureIndices[src] >= 0)
+        {
+            const size_t left  = leftChildren[src];
+            const size_t right = rightChildren[src];
+            /* Reject the out of range children and the nodes reachable twice, the latter also prevents cycles */
+            DAAL_CHECK(left < nNodes && right < nNodes && left != right && !isVisited[left] && !isVisited[right],
+                       services::ErrorID::ErrorIncorrectParameter);
+            isVisited[left]  = 1;
+            isVisited[right] = 1;
+
+            aNode[row].featureIndex           = featureIndices[src];
+            aNode[row].leftIndexOrClass       = nRows;
+            aNode[row].featureValueOrResponse = featureValues[src];
+            order[nRows++]                    = left;
+            order[nRows++]                    = right;
+        }
+        else if (isClassification)
+        {
+            const size_t classLabel = size_t(featureValues[src]);
+            DAAL_CHECK(featureValues[src] >= 0 && (!prob || classLabel < nClasses), services::ErrorID::ErrorIncorrectParameter);
+            setNode(aNode[row], -1, classLabel);
+            if (prob)
+            {
+                double * const probOfNode = prob + row * nClasses;
+                for (size_t classIndex = 0; classIndex < nClasses; ++classIndex) probOfNode[classIndex] = 0.0;
+                probOfNode[classLabel] = 1.0;
+            }
+        }
+        else
+        {
+            setNode(aNode[row], -1, featureValues[src]);
+        }
+    }
+    /* Every node has to be reachable from the root */
+    DAAL_CHECK(nRows == nNodes, services::ErrorID::ErrorIncorrectParameter);
+    return services::Status();
+}
+
+services::Status addTreesInternal(const data_management::DataCollectionPtr & serializationData, const size_t nTrees, const size_t * const treeIds,
+                                  const size_t * const treeOffsets, const int * const featureIndices, const double * const featureValues,
+                                  const size_t * const leftChildren, const size_t * const rightChildren, const bool isClassification,
+                                  const data_management::DataCollectionPtr probTbl, const size_t nClasses)
+{
+    DAAL_CHECK(treeIds && treeOffsets && featureIndices && featureValues && leftChildren && rightChildren, services::ErrorID::ErrorNullPtr);
+    const size_t nSlots = (*serializationData).size();
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        DAAL_CHECK(treeIds[i] < nSlots && !(*serializationData)[treeIds[i]].get(), services::ErrorID::ErrorIncorrectParameter);
+        DAAL_CHECK(treeOffsets[i] < treeOffsets[i + 1], services::ErrorID::ErrorIncorrectParameter);
+    }
+
+    SafeStatus safeStat;
+    daal::threader_for(nTrees, nTrees, [&](size_t i) {
+        const size_t first  = treeOffsets[i];
+        const size_t nNodes = treeOffsets[i + 1] - first;
+
+        services::SharedPtr<DecisionTreeTable> treeTablePtr(new DecisionTreeTable(nNodes));
+        DAAL_CHECK_MALLOC_THR(treeTablePtr.get());
+        DecisionTreeNode * const aNode = (DecisionTreeNode *)treeTablePtr->getArray();
+        DAAL_CHECK_MALLOC_THR(aNode);
+
+        services::SharedPtr<HomogenNumericTable<double> > probTablePtr;
+        if (probTbl.get())
+        {
+            probTablePtr.reset(new HomogenNumericTable<double>(nNodes, nClasses, NumericTable::doAllocate));
+            DAAL_CHECK_MALLOC_THR(probTablePtr.get() && probTablePtr->getArray());
+        }
+
+        const services::Status s = buildTreeFromArrays(aNode, nNodes, featureIndices + first, featureValues + first, leftChildren + first,
+                                                       rightChildren + first, isClassification,
+                                                       probTablePtr.get() ? probTablePtr->getArray() : nullptr, nClasses);
+        DAAL_CHECK_STATUS_THR(s);
+
+        (*serializationData)[treeIds[i]] = treeTablePtr;
+        if (probTbl.get()) (*probTbl)[treeIds[i]] = probTablePtr;
+    });
+    return safeStat.detach();
+}
+
 } // namespace internal
 } // namespace dtrees
 } // namespace algorithms
@@ -103,27 +103,53 @@ struct TreeNodeBase
     double impurity;
 };
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Category set of a many-vs-many split of an unordered feature: the categories going to the left child.
+// Stored as the number of words of the bitset of the category values followed by the bitset itself
+//////////////////////////////////////////////////////////////////////////////////////////
+typedef unsigned int CategorySetWord;
+
+enum CategorySetLimits
+{
+    maxCategoriesInSet = 32,     //maximal number of the categories going to the left child of the split
+    maxCategoryInSet   = 1 << 16 //categories with greater values always go to the right child of the split
+};
+
+//number of words of the category set including its size
+inline size_t categorySetSize(const CategorySetWord * aSet)
+{
+    return aSet[0] + 1;
+}
+
+inline bool isInCategorySet(const CategorySetWord * aSet, int category)
+{
+    return (CategorySetWord(category) < (aSet[0] << 5)) && ((aSet[1 + (category >> 5)] >> (category & 31)) & 1);
+}
+
 template <typename algorithmFPType>
 struct TreeNodeSplit : public TreeNodeBase
 {
     typedef algorithmFPType FeatureType;
     FeatureType featureValue;
     TreeNodeBase * kid[2];
+    const CategorySetWord * categorySet; //categories going to the left child of the many-vs-many split, nullptr otherwise
     int featureIdx;
     bool featureUnordered;
+    bool defaultLeft; //missing values of the feature go to the left child
 
-    TreeNodeSplit() { kid[0] = kid[1] = nullptr; }
+    TreeNodeSplit() : categorySet(nullptr), defaultLeft(true) { kid[0] = kid[1] = nullptr; }
     const TreeNodeBase * left() const { return kid[0]; }
     const TreeNodeBase * right() const { return kid[1]; }
     TreeNodeBase * left() { return kid[0]; }
     TreeNodeBase * right() { return kid[1]; }
 
-    void set(int featIdx, algorithmFPType featValue, bool bUnordered)
+    void set(int featIdx, algorithmFPType featValue, bool bUnordered, bool bDefaultLeft = true)
     {
         DAAL_ASSERT(featIdx >= 0);
         featureValue     = featValue;
         featureIdx       = featIdx;
         featureUnordered = bUnordered;
+        defaultLeft      = bDefaultLeft;
     }
     virtual bool isSplit() const DAAL_C11_OVERRIDE { return true; }
     virtual size_t numChildren() const DAAL_C11_OVERRIDE
@@ -233,6 +259,7 @@ public:
     typename NodeType::Leaf * allocLeaf(size_t nClasses);
     typename NodeType::Leaf * allocLeaf();
     typename NodeType::Split * allocSplit();
+    CategorySetWord * allocCategorySet(size_t nWords);
     void free(typename NodeType::Base * n);
     void reset() { _man.reset(); }
     bool deleteRecursive() const { return false; }
@@ -259,6 +286,12 @@ typename NodeType::Split * ChunkAllocator<NodeType>::allocSplit()
     return new (_man.alloc(sizeof(typename NodeType::Split))) typename NodeType::Split();
 }
 
+template <typename NodeType>
+CategorySetWord * ChunkAllocator<NodeType>::allocCategorySet(size_t nWords)
+{
+    return static_cast<CategorySetWord *>(_man.alloc(nWords * sizeof(CategorySetWord)));
+}
+
 template <typename NodeType>
 void ChunkAllocator<NodeType>::free(typename NodeType::Base * n)
 {}
@@ -347,6 +380,20 @@ services::Status addSplitNodeInternal(data_management::DataCollectionPtr & seria
 void setProbabilities(const size_t treeId, const size_t nodeId, const size_t response, const data_management::DataCollectionPtr probTbl,
                       const double * const prob);
 
+/* Assigns the first empty slots of the collection to the trees, the trees of group g (groups[i] == g, or g == 0 if groups == nullptr)
+   take the slots from g * groupSize to (g + 1) * groupSize - 1 */
+services::Status findEmptyTreeIds(const data_management::DataCollectionPtr & serializationData, const size_t nTrees, const size_t * const groups,
+                                  const size_t nGroups, const size_t groupSize, size_t * const treeIds);
+
+/* Builds the trees given by the flat arrays of their nodes into the slots treeIds in parallel.
+   The nodes of the i-th tree are stored from treeOffsets[i] to treeOffsets[i + 1] - 1, the first of them is the root,
+   the children indices are relative to the first node of the tree, the leaf nodes have negative feature indices.
+   The leaf values are class labels if isClassification is true and responses otherwise */
+services::Status addTreesInternal(const data_management::DataCollectionPtr & serializationData, const size_t nTrees, const size_t * const treeIds,
+                                  const size_t * const treeOffsets, const int * const featureIndices, const double * const featureValues,
+                                  const size_t * const leftChildren, const size_t * const rightChildren, const bool isClassification,
+                                  const data_management::DataCollectionPtr probTbl = data_management::DataCollectionPtr(), const size_t nClasses = 0);
+
 template <typename ClassOrResponseType>
 static services::Status addLeafNodeInternal(const data_management::DataCollectionPtr & serializationData, const size_t treeId, const size_t parentId,
                                             const size_t position, ClassOrResponseType response, size_t & res,
@@ -465,6 +512,8 @@ static services::Status addLeafNodeInternal(const data_management::DataCollectio
     return s;
 }
 
+class CompactForest;
+
 class ModelImpl
 {
 public:
@@ -475,10 +524,31 @@ public:
     bool reserve(const size_t nTrees);
     bool resize(const size_t nTrees);
     void clear();
+    bool append(const ModelImpl & other);
 
     const data_management::DataCollection * serializationData() const { return _serializationData.get(); }
 
-    const DecisionTreeTable * at(const size_t i) const { return (const DecisionTreeTable *)(*_serializationData)[i].get(); }
+    /* The trees of the compact model are read from the tables restored from it once on the first access,
+       the compact representation is kept, so the prediction on it can run concurrently */
+    const DecisionTreeTable * at(const size_t i) const
+    {
+        const data_management::DataCollection * trees = _serializationData.get();
+        if (_compactForest.get())
+        {
+            if (!restoreTrees()) return nullptr;
+            trees = _restoredTrees.get();
+        }
+        return (const DecisionTreeTable *)(*trees)[i].get();
+    }
+
+    /* Replaces the tables of the trees by the compact representation and releases the impurities and the numbers of samples of the nodes */
+    services::Status compact(bool isRegression);
+
+    /* Replaces the compact representation by the tables of the trees */
+    services::Status expand();
+
+    bool isCompact() const { return _compactForest.get() != nullptr; }
+    services::SharedPtr<CompactForest> compactForest() const { return _compactForest; }
 
     const double * getImpVals(size_t i) const
     {
@@ -506,10 +576,29 @@ public:
 
 protected:
     void destroy();
+
+    /* Restores the tables of the trees of the compact model into a cache once, the cache is published after it is filled */
+    services::Status restoreTrees() const;
+    void resetRestoredTrees();
+
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
-        arch->setSharedPtrObj(_serializationData);
+        /* The compact representation is not serialized, the trees are written as the tables restored from it */
+        data_management::DataCollectionPtr trees = _serializationData;
+        if (onDeserialize)
+        {
+            _compactForest.reset();
+            resetRestoredTrees();
+        }
+        else if (_compactForest.get())
+        {
+            services::Status s = restoreTrees();
+            if (!s) return s;
+            trees = _restoredTrees;
+        }
+        arch->setSharedPtrObj(trees);
+        if (onDeserialize) _serializationData = trees;
 
         if ((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
         {
@@ -533,6 +622,9 @@ protected:
     data_management::DataCollectionPtr _impurityTables;
     data_management::DataCollectionPtr _nNodeSampleTables;
     data_management::DataCollectionPtr _probTbl;
+    services::SharedPtr<CompactForest> _compactForest;
+    mutable data_management::DataCollectionPtr _restoredTrees; /* Tables of the trees of the compact model */
+    mutable daal::services::Atomic<int> _isRestored;
 };
 
 template <typename NodeType, typename Allocator>
@@ -26,6 +26,7 @@
 #define __DTREES_PREDICT_DENSE_DEFAULT_IMPL_I__
 
 #include "algorithms/kernel/dtrees/dtrees_model_impl.h"
+#include "algorithms/kernel/dtrees/dtrees_compact_model.h"
 #include "service/kernel/service_data_utils.h"
 #include "algorithms/kernel/dtrees/dtrees_feature_type_helper.h"
 #include "service/kernel/service_environment.h"
@@ -47,6 +48,28 @@ using namespace dtrees::internal;
 //////////////////////////////////////////////////////////////////////////////////////////
 // Common service function. Finds node corresponding to the given observation
 //////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Returns the child of the ordered split the value goes to,
+// missing values go to the default child of the split
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename SplitType, CpuType cpu>
+DAAL_FORCEINLINE int orderedSplitChild(const SplitType * pSplit, algorithmFPType value)
+{
+    const int isMissing = daal::services::internal::IsNaN<algorithmFPType, cpu>::get(value);
+    const int isGreater = daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - value);
+    return (isGreater & !isMissing) | (isMissing & !pSplit->defaultLeft);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Returns the child of the split of an unordered feature the value goes to:
+// the left one for the categories of the category set or for the category of the one-vs-rest split
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, typename SplitType>
+DAAL_FORCEINLINE int unorderedSplitChild(const SplitType * pSplit, algorithmFPType value)
+{
+    return pSplit->categorySet ? !isInCategorySet(pSplit->categorySet, int(value)) : (int(value) != int(pSplit->featureValue));
+}
+
 template <typename algorithmFPType, typename TreeType, CpuType cpu>
 const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree & t, const algorithmFPType * x)
 {
@@ -57,9 +80,10 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = (pSplit->featureUnordered ?
-                                (int(x[pSplit->featureIdx]) != int(pSplit->featureValue)) :
-                                daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]));
+            const int sn = (pSplit->featureUnordered ? unorderedSplitChild<algorithmFPType, typename TreeType::NodeType::Split>(
+                                                           pSplit, x[pSplit->featureIdx]) :
+                                                       orderedSplitChild<algorithmFPType, typename TreeType::NodeType::Split, cpu>(
+                                                           pSplit, x[pSplit->featureIdx]));
             pNode        = pSplit->kid[sn];
         }
     }
@@ -68,7 +92,7 @@ const typename TreeType::NodeType::Base * findNode(const dtrees::internal::Tree
         for (; pNode && pNode->isSplit();)
         {
             auto pSplit  = TreeType::NodeType::castSplit(pNode);
-            const int sn = daal::services::internal::SignBit<algorithmFPType, cpu>::get(pSplit->featureValue - x[pSplit->featureIdx]);
+            const int sn = orderedSplitChild<algorithmFPType, typename TreeType::NodeType::Split, cpu>(pSplit, x[pSplit->featureIdx]);
             pNode        = pSplit->kid[sn];
         }
     }
@@ -110,6 +134,38 @@ const DecisionTreeNode * findNode(const dtrees::internal::DecisionTreeTable & t,
     return pNode;
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// Common service function. Finds the index of the leaf of the compact tree corresponding to the given observation
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+size_t findNode(const dtrees::internal::CompactForest & forest, size_t iTree, const FeatureTypes & featTypes, const algorithmFPType * x)
+{
+    DAAL_ASSERT(forest.getNumberOfNodes(iTree));
+    const CompactTreeNode * const aNode = forest.getNodes(iTree);
+    size_t i                            = 0;
+    if (featTypes.hasUnorderedFeatures())
+    {
+        for (; aNode[i].isSplit();)
+        {
+            const CompactTreeNode & node = aNode[i];
+            const ModelFPType threshold  = forest.getThreshold(node);
+            const algorithmFPType value  = x[node.featureIndex];
+            const int sn                 = (featTypes.isUnordered(node.featureIndex) ? (int(value) != int(threshold)) : (value > threshold));
+            i += node.leftOffsetOrValue + sn;
+        }
+    }
+    else
+    {
+        for (; aNode[i].isSplit();)
+        {
+            const CompactTreeNode & node = aNode[i];
+            const int sn                 = x[node.featureIndex] > forest.getThreshold(node);
+            i += node.leftOffsetOrValue + sn;
+        }
+    }
+    return i;
+}
+
 template <typename algorithmFPType>
 struct TileDimensions
 {
@@ -34,6 +34,7 @@
 #include "algorithms/kernel/service_sort.h"
 #include "externals/service_math.h"
 #include "algorithms/kernel/dtrees/dtrees_feature_type_helper.i"
+#include "algorithms/kernel/dtrees/dtrees_model_impl.h"
 
 typedef int IndexType;
 
@@ -110,8 +111,14 @@ struct SplitData
     size_t nLeft;
     size_t iStart;
     bool featureUnordered;
-    SplitData() : impurityDecrease(-daal::services::internal::MaxVal<algorithmFPType>::get()) {}
-    SplitData(algorithmFPType impDecr, bool bFeatureUnordered) : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered) {}
+    bool defaultLeft;    //missing values of the feature go to the left child
+    size_t nLeftIndices; //number of the indices going to the left child of the many-vs-many split, 0 otherwise
+    //indices of the categories going to the left child of the many-vs-many split
+    IndexType aLeftIndices[dtrees::internal::maxCategoriesInSet];
+    SplitData() : impurityDecrease(-daal::services::internal::MaxVal<algorithmFPType>::get()), defaultLeft(true), nLeftIndices(0) {}
+    SplitData(algorithmFPType impDecr, bool bFeatureUnordered)
+        : impurityDecrease(impDecr), featureUnordered(bFeatureUnordered), defaultLeft(true), nLeftIndices(0)
+    {}
     SplitData(const SplitData & o) = delete;
     void copyTo(SplitData & o) const
     {
@@ -120,7 +127,10 @@ struct SplitData
         o.iStart           = iStart;
         o.left             = left;
         o.featureUnordered = featureUnordered;
+        o.defaultLeft      = defaultLeft;
         o.impurityDecrease = impurityDecrease;
+        o.nLeftIndices     = nLeftIndices;
+        for (size_t i = 0; i < nLeftIndices; ++i) o.aLeftIndices[i] = aLeftIndices[i];
     }
 };
 
@@ -165,6 +175,17 @@ public:
         return val;
     }
 
+    //returns the cut value of the split found on the indexed feature: the right border of the bin if the feature is binned,
+    //the value of the feature in the given row otherwise.
+    //The cut value of the split separating the missing values is less than all the other values
+    algorithmFPType getSplitValue(size_t iCol, size_t iRow, size_t idxFeatureValue) const
+    {
+        if (_indexedFeatures && _indexedFeatures->isBinned(iCol)) return algorithmFPType(_indexedFeatures->binRightBorder(iCol, idxFeatureValue));
+        if (_indexedFeatures && _indexedFeatures->hasMissing(iCol) && !idxFeatureValue)
+            return -daal::services::internal::MaxVal<algorithmFPType>::get();
+        return getValue(iCol, iRow);
+    }
+
 protected:
     const dtrees::internal::IndexedFeatures * _indexedFeatures;
     const algorithmFPType * _dataDirect = nullptr;
@@ -281,20 +302,28 @@ public:
     bool hasDiffFeatureValues(IndexType iFeature, const int * aIdx, size_t n) const
     {
         if (this->indexedFeatures().numIndices(iFeature) == 1) return false; //single value only
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
-        const IndexedFeatures::IndexType idx0             = indexedFeature[aResponse[aIdx[0]].idx];
-        size_t i                                          = 1;
+        bool bDiff = false;
+        DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                     bDiff = hasDiffIndices<BinIndexType>(this->indexedFeatures().template dataAs<BinIndexType>(iFeature), aIdx, n));
+        return bDiff;
+    }
+
+protected:
+    template <typename BinIndexType>
+    bool hasDiffIndices(const BinIndexType * indexedFeature, const int * aIdx, size_t n) const
+    {
+        const auto aResponse    = this->_aResponse.get();
+        const BinIndexType idx0 = indexedFeature[aResponse[aIdx[0]].idx];
+        size_t i                = 1;
         for (; i < n; ++i)
         {
-            const Response & r                   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
+            const Response & r     = aResponse[aIdx[i]];
+            const BinIndexType idx = indexedFeature[r.idx];
             if (idx != idx0) break;
         }
         return (i != n);
     }
 
-protected:
     IndexType getObsIdx(size_t i) const
     {
         DAAL_ASSERT(i < _aResponse.size());
@@ -326,6 +326,16 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses)
     return true;
 }
 
+services::Status ModelImpl::addTrees(const decision_forest::classification::Model & other)
+{
+    const ModelImpl * otherImpl = dynamic_cast<const ModelImpl *>(&other);
+    DAAL_CHECK(otherImpl, services::ErrorIncorrectTypeOfModel);
+    DAAL_CHECK(otherImpl->getNumberOfFeatures() == getNumberOfFeatures(), services::ErrorIncorrectNumberOfFeatures);
+    DAAL_CHECK(!size() || !otherImpl->size() || otherImpl->getNumClasses() == getNumClasses(), services::ErrorIncorrectNumberOfClasses);
+    DAAL_CHECK_MALLOC(append(*otherImpl));
+    return services::Status();
+}
+
 } // namespace internal
 } // namespace classification
 } // namespace decision_forest
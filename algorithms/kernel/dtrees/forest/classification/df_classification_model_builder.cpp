@@ -25,6 +25,7 @@
 #include "algorithms/decision_forest/decision_forest_classification_model.h"
 #include "algorithms/kernel/dtrees/dtrees_model_impl.h"
 #include "algorithms/kernel/dtrees/forest/classification/df_classification_model_impl.h"
+#include "service/kernel/service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -122,6 +123,24 @@ services::Status ModelBuilder::addSplitNodeInternal(const TreeId treeId, const N
                                                                     featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(const size_t nTrees, const size_t * const treeOffsets, const int * const featureIndices,
+                                                const double * const featureValues, const size_t * const leftChildren,
+                                                const size_t * const rightChildren)
+{
+    if (nTrees == 0) return services::Status();
+    decision_forest::classification::internal::ModelImpl & modelImplRef =
+        daal::algorithms::dtrees::internal::getModelRef<decision_forest::classification::internal::ModelImpl, ModelPtr>(_model);
+
+    services::internal::TArray<TreeId, sse2> treeIds(nTrees);
+    DAAL_CHECK_MALLOC(treeIds.get());
+    services::Status s = daal::algorithms::dtrees::internal::findEmptyTreeIds(modelImplRef._serializationData, nTrees, nullptr, 1,
+                                                                              modelImplRef._serializationData->size(), treeIds.get());
+    DAAL_CHECK_STATUS_VAR(s);
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, nTrees, treeIds.get(), treeOffsets, featureIndices,
+                                                                featureValues, leftChildren, rightChildren, true, modelImplRef._probTbl,
+                                                                _nClasses);
+}
+
 } // namespace interface2
 } // namespace classification
 } // namespace decision_forest
@@ -72,6 +72,11 @@ public:
 
     bool add(const TreeType & tree, size_t nClasses);
 
+    virtual services::Status addTrees(const decision_forest::classification::Model & other) DAAL_C11_OVERRIDE;
+
+    virtual services::Status compact() DAAL_C11_OVERRIDE { return ImplType::compact(false); }
+    virtual bool isCompact() const DAAL_C11_OVERRIDE { return ImplType::isCompact(); }
+
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
 
     virtual void traverseDFS(size_t iTree, tree_utils::classification::TreeNodeVisitor & visitor) const DAAL_C11_OVERRIDE;
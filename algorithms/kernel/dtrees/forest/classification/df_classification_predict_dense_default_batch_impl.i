@@ -149,6 +149,9 @@ protected:
     void predictByTreesWithoutConversion(const size_t iFirstTree, const size_t nTrees, const algorithmFPType * const x, double * const prob,
                                          const size_t nTreesTotal);
 
+    void predictByCompactTrees(const size_t iFirstTree, const size_t nTrees, const algorithmFPType * const x, algorithmFPType * const resPtr,
+                               const size_t nTreesTotal);
+
     void predictByTree(const algorithmFPType * const x, const size_t sizeOfBlock, const size_t nCols, const featureIndexType * const tFI,
                        const leftOrClassType * const tLC, const algorithmFPType * const tFV, algorithmFPType * const prob, const size_t iTree);
 
@@ -207,6 +210,7 @@ protected:
     NumericTable * _res;
     NumericTable * _prob;
     const dtrees::internal::ModelImpl * _model;
+    dtrees::internal::CompactForestPtr _compactForest; /* keeps the compact trees alive while the task traverses them */
     const dtrees::internal::ModelImpl * _cachedModel;
     size_t _nClasses;
     size_t _cachedNClasses;
@@ -247,6 +251,11 @@ template <typename algorithmFPType, CpuType cpu>
 void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(const size_t iFirstTree, const size_t nTrees, const algorithmFPType * const x,
                                                                      algorithmFPType * const resPtr, const size_t nTreesTotal)
 {
+    if (_compactForest)
+    {
+        predictByCompactTrees(iFirstTree, nTrees, x, resPtr, nTreesTotal);
+        return;
+    }
     const algorithmFPType inverseTreesCount = 1.0 / algorithmFPType(nTreesTotal);
     const size_t iLastTree                  = iFirstTree + nTrees;
     for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
@@ -275,6 +284,34 @@ void PredictClassificationTask<algorithmFPType, cpu>::predictByTrees(const size_
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictClassificationTask<algorithmFPType, cpu>::predictByCompactTrees(const size_t iFirstTree, const size_t nTrees,
+                                                                            const algorithmFPType * const x, algorithmFPType * const resPtr,
+                                                                            const size_t nTreesTotal)
+{
+    const algorithmFPType inverseTreesCount = 1.0 / algorithmFPType(nTreesTotal);
+    const size_t iLastTree                  = iFirstTree + nTrees;
+    for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+    {
+        const size_t idx            = dtrees::prediction::internal::findNode<algorithmFPType, cpu>(*_compactForest, iTree, _featHelper, x);
+        const double * const probas = _model->getProbas(iTree);
+
+        if (_votingMethod == VotingMethod::unweighted || probas == nullptr)
+        {
+            resPtr[_compactForest->getNodes(iTree)[idx].leftOffsetOrValue] += inverseTreesCount;
+        }
+        else if (_votingMethod == VotingMethod::weighted)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < _nClasses; ++i)
+            {
+                resPtr[i] += probas[idx * _nClasses + i] * inverseTreesCount;
+            }
+        }
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void PredictClassificationTask<algorithmFPType, cpu>::predictByTreesWithoutConversion(const size_t iFirstTree, const size_t nTrees,
                                                                                       const algorithmFPType * const x, double * const resPtr,
@@ -1021,11 +1058,16 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         _cachedData = const_cast<NumericTable *>(_data);
     }
     const bool hasUnorderedFeatures = _featHelper.hasUnorderedFeatures();
-    if (_data->getNumberOfRows() == 1 && !(hasUnorderedFeatures))
+
+    /* The compact trees are traversed node by node, the arrays of the vectorized paths would restore the size of the model */
+    _compactForest = _model->compactForest();
+    if (_compactForest) _cachedModel = nullptr;
+
+    if (_data->getNumberOfRows() == 1 && !(hasUnorderedFeatures) && !_compactForest)
     {
         return predictOneRowByAllTrees(nTreesTotal);
     }
-    if (_cachedModel != _model)
+    if (!_compactForest && _cachedModel != _model)
     {
         _cachedModel = _model;
         _aTree.reset(nTreesTotal);
@@ -1040,11 +1082,12 @@ Status PredictClassificationTask<algorithmFPType, cpu>::run(services::HostAppIfa
         _sumTreeSize     = 0;
     }
 
-    if (hasUnorderedFeatures
+    if (_compactForest || hasUnorderedFeatures
         || (_data->getNumberOfRows() < _averageTreeSize * _SCALE_FACTOR_FOR_VECT_PARALLEL_COMPUTE && daal::threader_get_threads_number() > 1)
         || (_data->getNumberOfRows() < _MIN_NUMBER_OF_ROWS_FOR_VECT_SEQ_COMPUTE && daal::threader_get_threads_number() == 1))
     {
-        const auto treeSize = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+        const auto treeSize = _compactForest ? _compactForest->getNumberOfNodes(0) * sizeof(dtrees::internal::CompactTreeNode) :
+                                               _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
         DimType dim(*_data, nTreesTotal, treeSize, _nClasses);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses, dim.nRowsTotal);
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nClasses * dim.nRowsTotal, sizeof(ClassIndexType));
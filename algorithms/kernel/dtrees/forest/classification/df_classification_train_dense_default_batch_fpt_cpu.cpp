@@ -37,11 +37,13 @@ namespace training
 namespace interface2
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
 }
 
 namespace internal
 {
 template class ClassificationTrainBatchKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class ClassificationTrainBatchKernel<DAAL_FPTYPE, hist, DAAL_CPU>;
 }
 } // namespace training
 } // namespace classification
@@ -30,6 +30,8 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_forest::classification::training::BatchContainer, batch, DAAL_FPTYPE,
                                       decision_forest::classification::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_forest::classification::training::BatchContainer, batch, DAAL_FPTYPE,
+                                      decision_forest::classification::training::hist)
 namespace decision_forest
 {
 namespace classification
@@ -38,17 +40,30 @@ namespace training
 {
 namespace interface2
 {
-template <>
-DAAL_EXPORT services::Status Batch<DAAL_FPTYPE, decision_forest::classification::training::defaultDense>::checkComputeParams()
+static services::Status checkForestComputeParams(const classifier::training::Input & input, const Parameter & parameter)
 {
-    services::Status s = classifier::training::Batch::checkComputeParams();
-    if (!s) return s;
     const auto x         = input.get(classifier::training::data);
     const auto nFeatures = x->getNumberOfColumns();
     DAAL_CHECK_EX(parameter.featuresPerNode <= nFeatures, services::ErrorIncorrectParameter, services::ParameterName, featuresPerNodeStr());
     const size_t nSamplesPerTree(parameter.observationsPerTreeFraction * x->getNumberOfRows());
     DAAL_CHECK_EX(nSamplesPerTree > 0, services::ErrorIncorrectParameter, services::ParameterName, observationsPerTreeFractionStr());
-    return s;
+    return services::Status();
+}
+
+template <>
+DAAL_EXPORT services::Status Batch<DAAL_FPTYPE, decision_forest::classification::training::defaultDense>::checkComputeParams()
+{
+    services::Status s = classifier::training::Batch::checkComputeParams();
+    if (!s) return s;
+    return checkForestComputeParams(input, parameter);
+}
+
+template <>
+DAAL_EXPORT services::Status Batch<DAAL_FPTYPE, decision_forest::classification::training::hist>::checkComputeParams()
+{
+    services::Status s = classifier::training::Batch::checkComputeParams();
+    if (!s) return s;
+    return checkForestComputeParams(input, parameter);
 }
 } // namespace interface2
 } // namespace training
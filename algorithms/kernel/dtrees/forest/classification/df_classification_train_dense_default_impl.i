@@ -437,7 +437,6 @@ bool UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitCategoricalFeature(
     return bFound;
 }
 
-#ifdef OPT_SKX
 //count number of responses in each class for each index of feature value
 template <typename ResponseType, typename IndexType, typename FeatureIndexType, typename SizeType, CpuType cpu>
 void countResponses(SizeType nClasses, SizeType n, const IndexType * aIdx, const ResponseType * aResponse, const FeatureIndexType * indexedFeature,
@@ -446,16 +445,17 @@ void countResponses(SizeType nClasses, SizeType n, const IndexType * aIdx, const
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < n; ++i)
     {
-        const IndexType iSample              = aIdx[i];
-        const auto & r                       = aResponse[iSample];
-        const IndexType iRow                 = r.idx;
-        const IndexedFeatures::IndexType idx = indexedFeature[iRow];
+        const IndexType iSample    = aIdx[i];
+        const auto & r             = aResponse[iSample];
+        const IndexType iRow       = r.idx;
+        const FeatureIndexType idx = indexedFeature[iRow];
         ++nFeatIdx[idx];
         const ClassIndexType iClass = r.val;
         ++nSamplesPerClass[idx * nClasses + iClass];
     }
 }
 
+#ifdef OPT_SKX
 template <typename algorithmFPType, CpuType cpu>
 int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algorithmFPType * featureBuf, IndexType iFeature, const IndexType * aIdx,
                                                                              size_t n, size_t nMinSplitPart, const ImpurityData & curImpurity,
@@ -467,8 +467,10 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
     auto nFeatIdx         = _idxFeatureBuf.get();
     auto nSamplesPerClass = _samplesPerClassBuf.get();
 
-    countResponses<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(
-        _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().data(iFeature), nFeatIdx, nSamplesPerClass);
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 countResponses<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+                                     _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().template dataAs<BinIndexType>(iFeature),
+                                     nFeatIdx, nSamplesPerClass));
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
@@ -538,13 +540,15 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
     const algorithmFPType divL    = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
     bestSplit.left.var            = 1. - bestSplit.left.var * divL * divL;
     IndexType * bestSplitIdxRight = bestSplitIdx + bestSplit.nLeft;
-    const int iRowSplitVal        = doPartition<typename super::Response, IndexType, typename IndexedFeatures::IndexType, size_t, cpu>(
-        n, aIdx, this->_aResponse.get(), this->indexedFeatures().data(iFeature), bestSplit.featureUnordered, idxFeatureValueBestSplit,
-        bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft);
+    int iRowSplitVal              = -1;
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 iRowSplitVal = doPartition<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+                                     n, aIdx, this->_aResponse.get(), this->indexedFeatures().template dataAs<BinIndexType>(iFeature),
+                                     bestSplit.featureUnordered, idxFeatureValueBestSplit, bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft));
 
     DAAL_ASSERT(iRowSplitVal >= 0);
     bestSplit.iStart       = 0;
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #else
 template <typename algorithmFPType, CpuType cpu>
@@ -560,21 +564,11 @@ int UnorderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(alg
 
     algorithmFPType bestImpDecrease =
         split.impurityDecrease < 0 ? split.impurityDecrease : algorithmFPType(n) * (split.impurityDecrease + algorithmFPType(1.) - curImpurity.var);
-    {
-        //direct access to sorted features data in order to facilitate vectorization
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        const auto aResponse                              = this->_aResponse.get();
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t i = 0; i < n; ++i)
-        {
-            const IndexType iSample              = aIdx[i];
-            const auto & r                       = aResponse[iSample];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
-            ++nFeatIdx[idx];
-            const ClassIndexType iClass = r.val;
-            ++nSamplesPerClass[idx * _nClasses + iClass];
-        }
-    }
+    //direct access to sorted features data in order to facilitate vectorization
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 countResponses<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+                                     _nClasses, n, aIdx, this->_aResponse.get(), this->indexedFeatures().template dataAs<BinIndexType>(iFeature),
+                                     nFeatIdx, nSamplesPerClass));
     //init histogram for the left part
     _histLeft.setAll(0);
     auto histLeft           = _histLeft.get();
@@ -638,35 +632,17 @@ void UnorderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexTyp
                                                                   IndexType * bestSplitIdx) const
 {
     DAAL_ASSERT(bestSplit.nLeft > 0);
-    const algorithmFPType divL                        = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
-    bestSplit.left.var                                = 1. - bestSplit.left.var * divL * divL;
-    IndexType * bestSplitIdxRight                     = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                      = 0;
-    size_t iRight                                     = 0;
-    int iRowSplitVal                                  = -1;
-    const auto aResponse                              = this->_aResponse.get();
-    const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-    for (size_t i = 0; i < n; ++i)
-    {
-        const IndexType iSample              = aIdx[i];
-        const IndexedFeatures::IndexType idx = indexedFeature[aResponse[iSample].idx];
-        if ((bestSplit.featureUnordered && (idx != idxFeatureValueBestSplit)) || ((!bestSplit.featureUnordered) && (idx > idxFeatureValueBestSplit)))
-        {
-            DAAL_ASSERT(iRight < n - bestSplit.nLeft);
-            bestSplitIdxRight[iRight++] = iSample;
-        }
-        else
-        {
-            if (idx == idxFeatureValueBestSplit) iRowSplitVal = aResponse[iSample].idx;
-            DAAL_ASSERT(iLeft < bestSplit.nLeft);
-            bestSplitIdx[iLeft++] = iSample;
-        }
-    }
-    DAAL_ASSERT(iRight == n - bestSplit.nLeft);
-    DAAL_ASSERT(iLeft == bestSplit.nLeft);
+    const algorithmFPType divL    = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
+    bestSplit.left.var            = 1. - bestSplit.left.var * divL * divL;
+    IndexType * bestSplitIdxRight = bestSplitIdx + bestSplit.nLeft;
+    int iRowSplitVal              = -1;
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 iRowSplitVal = doPartition<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+                                     n, aIdx, this->_aResponse.get(), this->indexedFeatures().template dataAs<BinIndexType>(iFeature),
+                                     bestSplit.featureUnordered, idxFeatureValueBestSplit, bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft));
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
 }
 #endif
 
@@ -794,6 +770,8 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.resultsToCompute            = par.resultsToCompute;
     tmpPar.memorySavingMode            = par.memorySavingMode;
     tmpPar.bootstrap                   = par.bootstrap;
+    tmpPar.maxBins                     = par.maxBins;
+    tmpPar.minBinSize                  = par.minBinSize;
     return compute(pHostApp, x, y, m, res, tmpPar);
 }
 
@@ -803,9 +781,11 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     const decision_forest::classification::training::Parameter & par)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
+    const dtrees::internal::BinParams binPrm(par.maxBins, par.minBinSize);
     services::Status s = computeImpl<algorithmFPType, cpu, daal::algorithms::decision_forest::classification::internal::ModelImpl,
                                      TrainBatchTask<algorithmFPType, method, cpu> >(
-        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl *>(&m), rd, par, par.nClasses);
+        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::classification::internal::ModelImpl *>(&m), rd, par, par.nClasses,
+        (method == hist ? &binPrm : nullptr));
     if (s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -0,0 +1,74 @@
+/* file: df_classification_predict_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest classification prediction on GPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __DF_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/forest/classification/oneapi/df_classification_predict_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/forest/classification/df_classification_model_impl.h"
+#include "algorithms/kernel/dtrees/oneapi/dtrees_predict_dense_default_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services;
+
+template <typename algorithmFPType, decision_forest::classification::prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::compute(services::HostAppIface * pHostApp, const NumericTable * a,
+                                                                       const decision_forest::classification::Model * m, NumericTable * r,
+                                                                       NumericTable * prob, size_t nClasses, VotingMethod votingMethod)
+{
+    typedef dtrees::prediction::internal::TreeEnsemblePredictOneAPI<algorithmFPType> Predictor;
+
+    const decision_forest::classification::internal::ModelImpl * const pModel =
+        static_cast<const decision_forest::classification::internal::ModelImpl *>(m);
+
+    const size_t nTrees = pModel->size();
+    DAAL_CHECK(nTrees, ErrorNullModel);
+
+    Predictor predictor;
+    services::Status status = predictor.initFromDecisionTrees(*pModel, nTrees, (votingMethod == weighted) ? nClasses : 0);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const typename Predictor::ResponseType responseType =
+        predictor.hasLeafProbabilities() ? Predictor::leafClassProbabilities : Predictor::leafClassVote;
+    return predictor.predict(*a, responseType, nClasses, Predictor::scaledProbabilities, algorithmFPType(1) / algorithmFPType(nTrees), r, prob);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
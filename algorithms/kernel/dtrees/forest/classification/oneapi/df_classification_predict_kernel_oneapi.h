@@ -0,0 +1,64 @@
+/* file: df_classification_predict_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that computes decision forest classification prediction results on GPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_PREDICT_KERNEL_ONEAPI_H__
+#define __DF_CLASSIFICATION_PREDICT_KERNEL_ONEAPI_H__
+
+#include "algorithms/decision_forest/decision_forest_classification_predict.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+/**
+ * Computes the class labels and probabilities on GPU. Weighted voting averages the class probabilities of the leaves
+ * if they are stored in the model, otherwise each tree votes for the class of its leaf
+ */
+template <typename algorithmFPType, decision_forest::classification::prediction::Method method>
+class PredictKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const decision_forest::classification::Model * m,
+                             NumericTable * r, NumericTable * prob, size_t nClasses, VotingMethod votingMethod);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
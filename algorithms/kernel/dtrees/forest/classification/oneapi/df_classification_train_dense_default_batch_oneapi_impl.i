@@ -0,0 +1,67 @@
+/* file: df_classification_train_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of decision forest classification training on GPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_TRAIN_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __DF_CLASSIFICATION_TRAIN_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/forest/classification/oneapi/df_classification_train_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/forest/classification/df_classification_model_impl.h"
+#include "algorithms/kernel/dtrees/forest/classification/df_classification_training_types_result.h"
+#include "algorithms/kernel/dtrees/forest/oneapi/df_train_dense_default_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, Method method>
+services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, method>::compute(
+    HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, decision_forest::classification::Model & m, Result & res,
+    const decision_forest::classification::training::Parameter & par)
+{
+    DAAL_CHECK(method == hist, ErrorMethodNotImplemented);
+
+    decision_forest::classification::internal::ModelImpl & model = static_cast<decision_forest::classification::internal::ModelImpl &>(m);
+
+    decision_forest::training::internal::TrainBatchTaskOneAPI<algorithmFPType, decision_forest::classification::internal::ModelImpl> task;
+    services::Status status = task.compute(pHostApp, x, y, model, par, par.nClasses, res.get(variableImportance).get(), res.get(outOfBagError).get(),
+                                           res.get(outOfBagErrorPerObservation).get());
+    if (status.ok()) res.impl()->setEngine(par.engine);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
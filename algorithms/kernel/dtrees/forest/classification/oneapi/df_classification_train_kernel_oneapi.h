@@ -0,0 +1,64 @@
+/* file: df_classification_train_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that trains the decision forest classification model on GPU.
+//--
+*/
+
+#ifndef __DF_CLASSIFICATION_TRAIN_KERNEL_ONEAPI_H__
+#define __DF_CLASSIFICATION_TRAIN_KERNEL_ONEAPI_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/algorithm_base_common.h"
+#include "algorithms/decision_forest/decision_forest_classification_training_types.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Trains the model on GPU, only the hist method is supported
+ */
+template <typename algorithmFPType, Method method>
+class ClassificationTrainBatchKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, decision_forest::classification::Model & m,
+                             Result & res, const decision_forest::classification::training::Parameter & par);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
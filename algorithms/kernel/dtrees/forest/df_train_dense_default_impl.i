@@ -211,6 +211,14 @@ Ctx * createTlsContext(const NumericTable * x, const Parameter & par, size_t nCl
     return ctx;
 }
 
+//number of buffers for the parallel evaluation of the features of a node, 1 if the nodes are split by the thread of the tree only
+inline size_t numberOfSplitBuffers(size_t nThreads, size_t nTrees, size_t nFeaturesPerNode)
+{
+    if (nThreads <= nTrees || nFeaturesPerNode < 2) return 1;
+    const size_t nBufs = (nThreads + nTrees - 1) / nTrees;
+    return nBufs < nFeaturesPerNode ? nBufs : nFeaturesPerNode;
+}
+
 template <CpuType cpu>
 services::Status selectParallelizationTechnique(const Parameter & par, engines::internal::ParallelizationTechnique & technique)
 {
@@ -235,7 +243,7 @@ services::Status selectParallelizationTechnique(const Parameter & par, engines::
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename ModelType, typename TaskType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, ModelType & md, ResultData & res,
-                             const Parameter & par, size_t nClasses)
+                             const Parameter & par, size_t nClasses, const dtrees::internal::BinParams * binPrm = nullptr)
 {
     DAAL_CHECK(md.resize(par.nTrees), ErrorMemoryAllocationFailed);
     dtrees::internal::FeatureTypes featTypes;
@@ -244,7 +252,11 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     services::Status s;
     if (!par.memorySavingMode)
     {
-        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes);
+        //features are indexed (and binned if binPrm is given) once and shared by all trees of the forest
+        s = indexedFeatures.init<algorithmFPType, cpu>(*x, &featTypes, binPrm);
+        DAAL_CHECK_STATUS_VAR(s);
+        //the split search and partitioning read a column of indices per node, narrower indices cut the memory traffic
+        s = indexedFeatures.compress<cpu>();
         DAAL_CHECK_STATUS_VAR(s);
     }
 
@@ -263,6 +275,9 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
 
     //use tls in case of multiple threads
     const bool bThreaded = (threader_get_max_threads_number() > 1) && (par.nTrees > 1);
+    //intra-tree parallelism: if there are fewer trees than threads, the features of the large nodes of a tree are evaluated
+    //in parallel by the idle threads, the number of buffers is such that all the threads are loaded
+    const size_t nSplitBufs = numberOfSplitBuffers(threader_get_max_threads_number(), par.nTrees, par.featuresPerNode);
     daal::tls<Ctx *> tlsCtx([&]() -> Ctx * {
         //in case of single thread no need to allocate
         return (bThreaded ? createTlsContext<algorithmFPType, cpu, Ctx>(x, par, nClasses) : &mainCtx);
@@ -270,7 +285,10 @@ services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, co
     daal::tls<TaskType *> tlsTask([&]() -> TaskType * {
         //in case of single thread no need to allocate
         Ctx * ctx = tlsCtx.local();
-        return ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses) : nullptr;
+        TaskType * task =
+            ctx ? new TaskType(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, *ctx, nClasses) : nullptr;
+        if (task) task->setNumberOfFeatureBufs(nSplitBufs);
+        return task;
     });
 
     engines::internal::ParallelizationTechnique technique = engines::internal::family;
@@ -349,6 +367,8 @@ class TrainBatchTaskBase
 public:
     typedef TreeThreadCtxBase<algorithmFPType, cpu> ThreadCtxType;
     services::Status run(engines::internal::BatchBaseImpl * engineImpl, dtrees::internal::Tree *& pTree, size_t & numElems);
+    //sets the number of buffers used to evaluate the features of the large nodes in parallel, 1 for the sequential evaluation
+    void setNumberOfFeatureBufs(size_t nBufs) { _nFeatureBufs = (nBufs ? nBufs : 1); }
 
 protected:
     typedef dtrees::internal::TVector<algorithmFPType, cpu> algorithmFPTypeArray;
@@ -364,6 +384,7 @@ protected:
           _nSamples(par.observationsPerTreeFraction * x->getNumberOfRows()),
           _nFeaturesPerNode(par.featuresPerNode),
           _helper(indexedFeatures, nClasses),
+          _indexedFeatures(indexedFeatures),
           _impurityThreshold(_par.impurityThreshold),
           _nFeatureBufs(1), //for sequential processing
           _featHelper(featTypes),
@@ -372,6 +393,7 @@ protected:
     {
         if (_impurityThreshold < _accuracy) _impurityThreshold = _accuracy;
     }
+    ~TrainBatchTaskBase() { destroySplitHelpers(); }
 
     size_t nFeatures() const { return _data->getNumberOfColumns(); }
     typename DataHelper::NodeType::Base * build(services::Status & s, size_t iStart, size_t n, size_t level,
@@ -386,6 +408,14 @@ protected:
         DAAL_ASSERT(iBuf < _nFeatureBufs);
         return _aFeatureIndexBuf[iBuf].get();
     }
+    //helper with its own work buffers used by the buffer in the parallel evaluation of the features
+    const DataHelper & splitHelper(size_t iBuf) const
+    {
+        DAAL_ASSERT(iBuf < _nFeatureBufs);
+        return iBuf ? *_aSplitHelper[iBuf] : _helper;
+    }
+    bool initSplitHelpers(const IndexType * aSample);
+    void destroySplitHelpers();
     bool terminateCriteria(size_t nSamples, size_t level, typename DataHelper::ImpurityData & imp) const
     {
         return (nSamples < 2 * _par.minObservationsInLeafNode || _helper.terminateCriteria(imp, _impurityThreshold, nSamples)
@@ -437,8 +467,20 @@ protected:
 
     algorithmFPType computeOOBError(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd);
 
-    algorithmFPType computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t n, const IndexType * aInd, const IndexType * aPerm,
-                                        size_t iPermutedFeature);
+    services::Status computeMDA(const dtrees::internal::Tree & t, size_t nOOB, const IndexType * aInd, algorithmFPType oobError);
+
+    services::Status computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t nOOB, const IndexType * aInd, const algorithmFPType * aResp,
+                                         const IndexType * aFeature, const algorithmFPType * aPermutedVal, size_t nPermutedFeatures,
+                                         algorithmFPType * aPermError);
+
+    void updateMDA(size_t iFeature, algorithmFPType diff)
+    {
+        //_threadCtx.varImp[i] is a mean of diff among all the trees
+        const algorithmFPType div1  = algorithmFPType(1) / algorithmFPType(_threadCtx.nTrees);
+        const algorithmFPType delta = diff - _threadCtx.varImp[iFeature]; //old mean
+        _threadCtx.varImp[iFeature] += div1 * delta;
+        if (_threadCtx.varImpVariance) _threadCtx.varImpVariance[iFeature] += delta * (diff - _threadCtx.varImp[iFeature]); //new mean
+    }
 
     void setupHostApp()
     {
@@ -455,13 +497,21 @@ protected:
     mutable TVector<IndexType, cpu> _aSample;
     mutable TArray<algorithmFPTypeArray, cpu> _aFeatureBuf;
     mutable TArray<IndexTypeArray, cpu> _aFeatureIndexBuf;
+    mutable TArray<IndexTypeArray, cpu> _aSplitIdxBuf; //indices of the node sorted by the feature values, parallel evaluation only
+    TArray<DataHelper *, cpu> _aSplitHelper;           //helpers with the responses of the tree and own work buffers, parallel evaluation only
+    const dtrees::internal::IndexedFeatures * _indexedFeatures;
     engines::internal::BatchBaseImpl * _engineImpl;
     const NumericTable * _data;
     const NumericTable * _resp;
     const Parameter & _par;
     const size_t _nSamples;
     const size_t _nFeaturesPerNode;
-    const size_t _nFeatureBufs; //number of buffers to get feature values (to process features independently in parallel)
+    size_t _nFeatureBufs; //number of buffers to get feature values (to process features independently in parallel)
+    //nodes smaller than that are split by the thread of the tree, their features are not worth the parallel evaluation
+    static const size_t _nMinThreadedSplitSize = 4096;
+    //number of permuted features evaluated in one pass over the OOB rows and the number of OOB rows processed by one thread in it
+    static const size_t _nMDAFeaturesInBlock = 16;
+    static const size_t _nMDARowsInBlock     = 256;
 
     const FeatureTypes & _featHelper;
     algorithmFPType _accuracy;
@@ -497,6 +547,16 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
         _aFeatureIndexBuf[i].reset(_nSamples);
         DAAL_CHECK_MALLOC(_aFeatureIndexBuf[i].get());
     }
+    if (_nFeatureBufs > 1)
+    {
+        _aSplitIdxBuf.reset(_nFeatureBufs);
+        DAAL_CHECK_MALLOC(_aSplitIdxBuf.get());
+        for (size_t i = 0; i < _nFeatureBufs; ++i)
+        {
+            _aSplitIdxBuf[i].reset(_nSamples);
+            DAAL_CHECK_MALLOC(_aSplitIdxBuf[i].get());
+        }
+    }
 
     if (_par.bootstrap)
     {
@@ -514,6 +574,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
     }
     //init responses buffer, keep _aSample values in it
     DAAL_CHECK_MALLOC(_helper.init(_data, _resp, _aSample.get()));
+    DAAL_CHECK_MALLOC(initSplitHelpers(_aSample.get()));
 
     //use _aSample as an array of response indices stored by helper from now on
     PRAGMA_IVDEP
@@ -540,6 +601,39 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::run(engin
     return s;
 }
 
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::initSplitHelpers(const IndexType * aSample)
+{
+    if (_nFeatureBufs == 1) return true;
+    //the buffer 0 uses _helper, the others use the helpers created once and initialized by the samples of every tree
+    if (!_aSplitHelper.get())
+    {
+        _aSplitHelper.reset(_nFeatureBufs);
+        if (!_aSplitHelper.get()) return false;
+        for (size_t i = 0; i < _nFeatureBufs; ++i) _aSplitHelper[i] = nullptr;
+        for (size_t i = 1; i < _nFeatureBufs; ++i)
+        {
+            _aSplitHelper[i] = new DataHelper(_indexedFeatures, _nClasses);
+            if (!_aSplitHelper[i]) return false;
+        }
+    }
+    for (size_t i = 1; i < _nFeatureBufs; ++i)
+    {
+        if (!_aSplitHelper[i]->reset(_nSamples) || !_aSplitHelper[i]->init(_data, _resp, aSample)) return false;
+    }
+    return true;
+}
+
+template <typename algorithmFPType, typename DataHelper, CpuType cpu>
+void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::destroySplitHelpers()
+{
+    for (size_t i = 0; i < _aSplitHelper.size(); ++i)
+    {
+        delete _aSplitHelper[i];
+        _aSplitHelper[i] = nullptr;
+    }
+}
+
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 typename DataHelper::NodeType::Split * TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::makeSplit(size_t iFeature, algorithmFPType featureValue,
                                                                                                        bool bUnordered,
@@ -639,7 +733,7 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplit(size_t
 #endif
         return simpleSplit(iStart, curImpurity, iFeatureBest, split);
     }
-    if (_nFeatureBufs == 1) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
+    if (_nFeatureBufs == 1 || n < _nMinThreadedSplitSize) return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
     return findBestSplitThreaded(iStart, n, curImpurity, iFeatureBest, split);
 }
 
@@ -734,9 +828,93 @@ bool TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::findBestSplitThreaded
                                                                                  IndexType & iFeatureBest, typename DataHelper::TSplitData & split)
 {
     chooseFeatures();
-    TArray<typename DataHelper::TSplitData, cpu> aFeatureSplit(_nFeaturesPerNode);
-    //TODO, if parallel for features
-    return false;
+    const float qMax   = 0.02; //min fracture of observations to be handled as indexed feature values
+    IndexType * aIdx   = _aSample.get() + iStart;
+    const float fact   = float(n);
+    const size_t nBufs = (_nFeaturesPerNode < _nFeatureBufs ? _nFeaturesPerNode : _nFeatureBufs);
+
+    //the features are distributed over the buffers statically, every buffer keeps the best split of its features
+    TArray<typename DataHelper::TSplitData, cpu> aBufSplit(nBufs);
+    TArray<int, cpu> aBufBestSplit(nBufs);
+    TArray<int, cpu> aBufIdxFeatureValue(nBufs);
+    if (!aBufSplit.get() || !aBufBestSplit.get() || !aBufIdxFeatureValue.get())
+        return findBestSplitSerial(iStart, n, curImpurity, iFeatureBest, split);
+
+    daal::threader_for(nBufs, nBufs, [&](size_t iBuf) {
+        const DataHelper & helper                   = splitHelper(iBuf);
+        algorithmFPType * featBuf                   = featureBuf(iBuf);
+        IndexType * idx                             = _aSplitIdxBuf[iBuf].get();
+        IndexType * bestSplitIdx                    = featureIndexBuf(iBuf);
+        typename DataHelper::TSplitData & bestSplit = aBufSplit[iBuf];
+        typename DataHelper::TSplitData curSplit;
+        int iBestSplit               = -1;
+        int idxFeatureValueBestSplit = -1;
+        for (size_t i = iBuf; i < _nFeaturesPerNode; i += nBufs)
+        {
+            const auto iFeature            = _aFeatureIdx[i];
+            const bool bUseIndexedFeatures = (!_par.memorySavingMode) && (fact > qMax * float(helper.indexedFeatures().numIndices(iFeature)));
+            curSplit.featureUnordered      = _featHelper.isUnordered(iFeature);
+            if (bUseIndexedFeatures)
+            {
+                if (!helper.hasDiffFeatureValues(iFeature, aIdx, n)) continue; //all values of the feature are the same
+                const int idxFeatureValue =
+                    helper.findBestSplitForFeatureSorted(featBuf, iFeature, aIdx, n, _par.minObservationsInLeafNode, curImpurity, curSplit);
+                if (idxFeatureValue < 0) continue;
+                iBestSplit               = i;
+                idxFeatureValueBestSplit = idxFeatureValue;
+                curSplit.copyTo(bestSplit);
+            }
+            else
+            {
+                //the indices of the node are shared by the buffers, every buffer sorts its own copy
+                services::internal::tmemcpy<IndexType, cpu>(idx, aIdx, n);
+                helper.getColumnValues(iFeature, idx, n, featBuf);
+                daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, featBuf, idx);
+                if (featBuf[n - 1] - featBuf[0] <= _accuracy) continue; //all values of the feature are the same
+                if (!helper.findBestSplitForFeature(featBuf, idx, n, _par.minObservationsInLeafNode, _accuracy, curImpurity, curSplit)) continue;
+                iBestSplit               = i;
+                idxFeatureValueBestSplit = -1;
+                curSplit.copyTo(bestSplit);
+                services::internal::tmemcpy<IndexType, cpu>(bestSplitIdx, idx, n);
+            }
+        }
+        aBufBestSplit[iBuf]       = iBestSplit;
+        aBufIdxFeatureValue[iBuf] = idxFeatureValueBestSplit;
+    });
+
+    //the same choice as in the sequential search: the largest impurity decrease, the last of the features with equal ones
+    int iBestBuf = -1;
+    for (size_t iBuf = 0; iBuf < nBufs; ++iBuf)
+    {
+        if (aBufBestSplit[iBuf] < 0) continue;
+        if ((iBestBuf < 0) || (aBufSplit[iBestBuf].impurityDecrease < aBufSplit[iBuf].impurityDecrease)
+            || (!(aBufSplit[iBuf].impurityDecrease < aBufSplit[iBestBuf].impurityDecrease) && (aBufBestSplit[iBestBuf] < aBufBestSplit[iBuf])))
+            iBestBuf = iBuf;
+    }
+    if (iBestBuf < 0) return false; //not found
+
+    aBufSplit[iBestBuf].copyTo(split);
+    iFeatureBest             = _aFeatureIdx[aBufBestSplit[iBestBuf]];
+    IndexType * bestSplitIdx = featureIndexBuf(iBestBuf);
+    if (aBufIdxFeatureValue[iBestBuf] >= 0)
+    {
+        //indexed feature was used, calculate impurity and get split to bestSplitIdx
+        _helper.finalizeBestSplit(aIdx, n, iFeatureBest, aBufIdxFeatureValue[iBestBuf], split, bestSplitIdx);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+    }
+    else if (split.featureUnordered && split.iStart)
+    {
+        //the left part of the split is in the middle of the indices sorted by the categorical feature
+        DAAL_ASSERT(split.iStart + split.nLeft <= n);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx + split.iStart, split.nLeft);
+        services::internal::tmemcpy<IndexType, cpu>(aIdx + split.nLeft, bestSplitIdx, split.iStart);
+        if (n > (split.iStart + split.nLeft))
+            services::internal::tmemcpy<IndexType, cpu>(aIdx + split.iStart + split.nLeft, bestSplitIdx + split.iStart + split.nLeft,
+                                                        n - split.iStart - split.nLeft);
+    }
+    else
+        services::internal::tmemcpy<IndexType, cpu>(aIdx, bestSplitIdx, n);
+    return true;
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
@@ -748,6 +926,16 @@ void TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::addImpurityDecrease(I
     if (!isZero<algorithmFPType, cpu>(split.impurityDecrease)) _threadCtx.varImp[iFeature] += split.impurityDecrease;
 }
 
+template <typename NodeType>
+void markSplitFeatures(const typename NodeType::Base * pNode, bool * aUsed)
+{
+    if (!pNode || !pNode->isSplit()) return;
+    const typename NodeType::Split * pSplit = NodeType::castSplit(pNode);
+    aUsed[pSplit->featureIdx]               = true;
+    markSplitFeatures<NodeType>(pSplit->kid[0], aUsed);
+    markSplitFeatures<NodeType>(pSplit->kid[1], aUsed);
+}
+
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
 services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeResults(const dtrees::internal::Tree & t)
 {
@@ -760,63 +948,124 @@ services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeRe
     if (_par.resultsToCompute & (computeOutOfBagError | computeOutOfBagErrorPerObservation) || bMDA)
     {
         const algorithmFPType oobError = computeOOBError(t, nOOB, oobIndices.get());
-        if (bMDA)
-        {
-            TArray<IndexType, cpu> permutation(nOOB);
-            DAAL_CHECK_MALLOC(permutation.get());
-            for (size_t i = 0; i < nOOB; permutation[i] = i, ++i)
-                ;
-            const size_t nTrees        = _threadCtx.nTrees;
-            const algorithmFPType div1 = algorithmFPType(1) / algorithmFPType(nTrees);
-            for (size_t i = 0, n = nFeatures(); i < n; ++i)
-            {
-                shuffle<cpu>(_engineImpl->getState(), nOOB, permutation.get());
-                const algorithmFPType permOOBError = computeOOBErrorPerm(t, nOOB, oobIndices.get(), permutation.get(), i);
-                const algorithmFPType diff         = (permOOBError - oobError);
-                //_threadCtx.varImp[i] is a mean of diff among all the trees
-                const algorithmFPType delta = diff - _threadCtx.varImp[i]; //old mean
-                _threadCtx.varImp[i] += div1 * delta;
-                if (_threadCtx.varImpVariance) _threadCtx.varImpVariance[i] += delta * (diff - _threadCtx.varImp[i]); //new mean
-            }
-        }
+        if (bMDA) return computeMDA(t, nOOB, oobIndices.get(), oobError);
     }
     return services::Status();
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType predictionError(const DataHelper & h, const dtrees::internal::Tree & t, const algorithmFPType * x, const NumericTable * resp,
-                                size_t iRow)
+services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeMDA(const dtrees::internal::Tree & t, size_t nOOB,
+                                                                                  const IndexType * aInd, algorithmFPType oobError)
 {
-    ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable *>(resp), iRow, 1);
-    return h.predictionError(h.predict(t, x), *y.get());
+    const size_t dim = nFeatures();
+
+    //permutation of a feature not used in the splits of the tree does not change its predictions
+    TArray<bool, cpu> aUsed(dim);
+    DAAL_CHECK_MALLOC(aUsed.get());
+    services::internal::service_memset<bool, cpu>(aUsed.get(), false, dim);
+    markSplitFeatures<typename DataHelper::TreeType::NodeType>(static_cast<const typename DataHelper::TreeType &>(t).top(), aUsed.get());
+
+    TArray<algorithmFPType, cpu> aResp(nOOB);
+    DAAL_CHECK_MALLOC(aResp.get());
+    {
+        ReadRows<algorithmFPType, cpu> y(const_cast<NumericTable *>(_resp), aInd[0], 1);
+        DAAL_CHECK_BLOCK_STATUS(y);
+        aResp[0] = *y.get();
+        for (size_t i = 1; i < nOOB; ++i)
+        {
+            aResp[i] = *y.set(const_cast<NumericTable *>(_resp), aInd[i], 1);
+            DAAL_CHECK_BLOCK_STATUS(y);
+        }
+    }
+
+    const size_t nFeaturesInBlock = (dim < _nMDAFeaturesInBlock ? dim : _nMDAFeaturesInBlock);
+    TArray<IndexType, cpu> permutation(nOOB);
+    TArray<IndexType, cpu> aFeature(nFeaturesInBlock);
+    TArray<algorithmFPType, cpu> aPermutedVal(nFeaturesInBlock * nOOB);
+    TArray<algorithmFPType, cpu> aPermError(nFeaturesInBlock);
+    DAAL_CHECK_MALLOC(permutation.get() && aFeature.get() && aPermutedVal.get() && aPermError.get());
+    for (size_t i = 0; i < nOOB; permutation[i] = i, ++i)
+        ;
+
+    //the features are shuffled one after another as the random stream requires,
+    //the permuted values of the used ones are collected and evaluated by the block
+    services::Status s;
+    size_t nInBlock = 0;
+    for (size_t i = 0; i < dim; ++i)
+    {
+        shuffle<cpu>(_engineImpl->getState(), nOOB, permutation.get());
+        if (!aUsed[i])
+        {
+            updateMDA(i, 0);
+            continue;
+        }
+        ReadColumns<algorithmFPType, cpu> col(const_cast<NumericTable *>(_data), i, 0, _data->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(col);
+        const algorithmFPType * pCol = col.get();
+        algorithmFPType * pVal       = aPermutedVal.get() + nInBlock * nOOB;
+        for (size_t j = 0; j < nOOB; ++j) pVal[j] = pCol[aInd[permutation[j]]];
+        aFeature[nInBlock++] = i;
+
+        if ((nInBlock == nFeaturesInBlock) || (i + 1 == dim))
+        {
+            DAAL_CHECK_STATUS(s, computeOOBErrorPerm(t, nOOB, aInd, aResp.get(), aFeature.get(), aPermutedVal.get(), nInBlock, aPermError.get()));
+            for (size_t k = 0; k < nInBlock; ++k) updateMDA(aFeature[k], aPermError[k] - oobError);
+            nInBlock = 0;
+        }
+    }
+    return s;
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
-algorithmFPType TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t n,
-                                                                                          const IndexType * aInd, const IndexType * aPerm,
-                                                                                          size_t iPermutedFeature)
+services::Status TrainBatchTaskBase<algorithmFPType, DataHelper, cpu>::computeOOBErrorPerm(const dtrees::internal::Tree & t, size_t nOOB,
+                                                                                           const IndexType * aInd, const algorithmFPType * aResp,
+                                                                                           const IndexType * aFeature,
+                                                                                           const algorithmFPType * aPermutedVal,
+                                                                                           size_t nPermutedFeatures, algorithmFPType * aPermError)
 {
-    DAAL_ASSERT(n);
-
-    const auto dim = nFeatures();
-
-    //compute prediction error on each OOB row and get its mean using online formulae (Welford)
-    //TODO: can be threader_for() block
-    TArray<algorithmFPType, cpu> buf(dim);
-    ReadRows<algorithmFPType, cpu> x(const_cast<NumericTable *>(_data), aInd[0], 1);
-    services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.get(), dim);
-    ReadRows<algorithmFPType, cpu> p(const_cast<NumericTable *>(_data), aInd[aPerm[0]], 1);
-    buf[iPermutedFeature] = p.get()[iPermutedFeature];
-    algorithmFPType mean  = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[0]);
+    DAAL_ASSERT(nOOB);
+    const size_t dim     = nFeatures();
+    const size_t nBlocks = nOOB / _nMDARowsInBlock + !!(nOOB % _nMDARowsInBlock);
+
+    //each OOB row is read once and predicted with every feature of the block permuted in turn,
+    //errors are summed per block of rows to get the mean in the same order whatever the number of threads
+    TArray<algorithmFPType, cpu> aBlockError(nBlocks * nPermutedFeatures);
+    DAAL_CHECK_MALLOC(aBlockError.get());
+    services::internal::service_memset<algorithmFPType, cpu>(aBlockError.get(), 0, nBlocks * nPermutedFeatures);
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart      = iBlock * _nMDARowsInBlock;
+        const size_t iEnd        = (iStart + _nMDARowsInBlock < nOOB ? iStart + _nMDARowsInBlock : nOOB);
+        algorithmFPType * pError = aBlockError.get() + iBlock * nPermutedFeatures;
+
+        TArray<algorithmFPType, cpu> buf(dim);
+        DAAL_CHECK_THR(buf.get(), services::ErrorMemoryAllocationFailed);
+        ReadRows<algorithmFPType, cpu> x;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const algorithmFPType * pRow = x.set(const_cast<NumericTable *>(_data), aInd[i], 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(x);
+            services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), pRow, dim);
+            for (size_t k = 0; k < nPermutedFeatures; ++k)
+            {
+                const IndexType iFeature = aFeature[k];
+                buf[iFeature]            = aPermutedVal[k * nOOB + i];
+                pError[k] += _helper.predictionError(_helper.predict(t, buf.get()), aResp[i]);
+                buf[iFeature] = pRow[iFeature];
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
 
-    for (size_t i = 1; i < n; ++i)
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nOOB);
+    for (size_t k = 0; k < nPermutedFeatures; ++k)
     {
-        services::internal::tmemcpy<algorithmFPType, cpu>(buf.get(), x.set(const_cast<NumericTable *>(_data), aInd[i], 1), dim);
-        buf[iPermutedFeature] = p.set(const_cast<NumericTable *>(_data), aInd[aPerm[i]], 1)[iPermutedFeature];
-        algorithmFPType val   = predictionError<algorithmFPType, DataHelper, cpu>(_helper, t, buf.get(), _resp, aInd[i]);
-        mean += (val - mean) / algorithmFPType(i + 1);
+        algorithmFPType sum = 0;
+        for (size_t iBlock = 0; iBlock < nBlocks; ++iBlock) sum += aBlockError[iBlock * nPermutedFeatures + k];
+        aPermError[k] = sum * div;
     }
-    return mean;
+    return services::Status();
 }
 
 template <typename algorithmFPType, typename DataHelper, CpuType cpu>
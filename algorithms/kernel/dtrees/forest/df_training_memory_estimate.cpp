@@ -0,0 +1,84 @@
+/* file: df_training_memory_estimate.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Estimate of the memory allocated by the decision forest training in the batch processing mode
+//--
+*/
+
+#include "algorithms/decision_forest/decision_forest_training_parameter.h"
+#include "algorithms/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace training
+{
+namespace internal
+{
+/* Approximate size of a node of the tree under construction and of the model */
+const size_t nodeSize = 48;
+
+size_t estimateMemorySize(size_t nRows, size_t nFeatures, size_t nClasses, const Parameter & parameter, size_t fpSize)
+{
+    const size_t nThreads   = daal::threader_get_threads_number();
+    const size_t nTasks     = (parameter.nTrees < nThreads) ? parameter.nTrees : nThreads;
+    const size_t nSamples   = (size_t)(nRows * parameter.observationsPerTreeFraction);
+    const size_t minLeafObs = parameter.minObservationsInLeafNode ? parameter.minObservationsInLeafNode : 1;
+
+    /* Indexed features shared by all the trees, the number of unique values of a feature is bounded by the number of rows */
+    size_t size = parameter.memorySavingMode ? 0 : nRows * nFeatures * (sizeof(int) + fpSize);
+
+    /* Per-thread samples, responses and two buffers of feature values with their indices */
+    size += nTasks * (nSamples * (3 * sizeof(int) + 3 * fpSize) + 2 * parameter.featuresPerNode * sizeof(int));
+
+    /* Buffers of the parallel evaluation of the features of large nodes used when there are fewer trees than threads:
+       samples, responses and feature values with their indices per buffer */
+    if (nThreads > parameter.nTrees && parameter.featuresPerNode > 1)
+    {
+        size_t nSplitBufs = (nThreads + parameter.nTrees - 1) / parameter.nTrees;
+        if (nSplitBufs > parameter.featuresPerNode) nSplitBufs = parameter.featuresPerNode;
+        size += nTasks * (nSplitBufs - 1) * nSamples * (4 * sizeof(int) + 2 * fpSize);
+    }
+
+    /* Per-thread variable importance and class histograms */
+    size += nTasks * (nFeatures + nClasses) * fpSize;
+
+    /* Nodes of the trees, bounded both by the depth and by the minimal number of observations in a leaf */
+    size_t nNodes = 2 * nSamples / minLeafObs + 1;
+    if (parameter.maxTreeDepth && parameter.maxTreeDepth < 8 * sizeof(size_t) - 1)
+    {
+        const size_t nNodesByDepth = ((size_t)1 << (parameter.maxTreeDepth + 1)) - 1;
+        if (nNodesByDepth < nNodes) nNodes = nNodesByDepth;
+    }
+    size += parameter.nTrees * nNodes * (nodeSize + nClasses * sizeof(double));
+
+    /* Out-of-bag predictions */
+    if (parameter.resultsToCompute) size += nRows * (nClasses ? nClasses : 1) * fpSize;
+
+    return size;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
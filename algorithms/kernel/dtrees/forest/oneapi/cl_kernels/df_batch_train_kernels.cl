@@ -0,0 +1,418 @@
+/* file: df_batch_train_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of OpenCL kernels of the decision forest training.
+//  The nodes of one level of several trees are processed by each kernel call.
+//  nodeList[node * 5 + k] describes the node: k = 0 - offset of the rows of the node in treeOrder,
+//  1 - number of the rows, 2 - split feature or -1 if the split is not found, 3 - split bin,
+//  4 - number of the rows of the left child.
+//  Statistics of the rows are the class counts if nClasses > 0, otherwise the count, sum and sum of squares of the responses.
+//--
+*/
+
+#ifndef __DF_BATCH_TRAIN_KERNELS_CL__
+#define __DF_BATCH_TRAIN_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    df_batch_train_kernels,
+
+    algorithmFPType sumReduce(__local algorithmFPType * localSum, int localId, int localSize) {
+        for (int stride = localSize / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride)
+            {
+                localSum[localId] += localSum[localId + stride];
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        const algorithmFPType result = localSum[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        return result;
+    }
+
+    int sumReduceInt(__local int * localSum, int localId, int localSize) {
+        for (int stride = localSize / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride)
+            {
+                localSum[localId] += localSum[localId + stride];
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        const int result = localSum[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        return result;
+    }
+
+    /* Statistics of the left part or of the right part given by the difference of the total and left ones */
+    algorithmFPType getStat(const __global algorithmFPType * total, const __global algorithmFPType * left, int k, int isRight) {
+        return isRight ? total[k] - left[k] : left[k];
+    }
+
+    /* Gini index of the class counts or the variance of the responses */
+    algorithmFPType computeImpurity(const __global algorithmFPType * total, const __global algorithmFPType * left, int isRight, int nClasses,
+                                    algorithmFPType * count) {
+        if (nClasses > 0)
+        {
+            algorithmFPType n     = (algorithmFPType)0;
+            algorithmFPType sumSq = (algorithmFPType)0;
+            for (int k = 0; k < nClasses; k++)
+            {
+                const algorithmFPType h = getStat(total, left, k, isRight);
+                n += h;
+                sumSq += h * h;
+            }
+            *count = n;
+            return (n > (algorithmFPType)0) ? (algorithmFPType)1 - sumSq / (n * n) : (algorithmFPType)0;
+        }
+
+        const algorithmFPType n = getStat(total, left, 0, isRight);
+        *count                  = n;
+        if (!(n > (algorithmFPType)0)) return (algorithmFPType)0;
+
+        const algorithmFPType mean = getStat(total, left, 1, isRight) / n;
+        const algorithmFPType var  = getStat(total, left, 2, isRight) / n - mean * mean;
+        return (var > (algorithmFPType)0) ? var : (algorithmFPType)0;
+    }
+
+    /* Marks the rows sampled for the tree get_global_id(1) */
+    __kernel void markPresentRows(const __global int * treeOrder, __global int * inBag, int nSamples, int nRows) {
+        const int i = get_global_id(0);
+        const int t = get_global_id(1);
+
+        inBag[t * nRows + treeOrder[t * nSamples + i]] = 1;
+    }
+
+    /* Each work-item computes the histograms of the selected features of the node over the rows i % nPartials == partialId */
+    __kernel void computePartialHistograms(const __global int * data, int nFeatures, const __global int * treeOrder, const __global int * nodeList,
+                                           const __global int * selectedFeatures, int nSelectedFeatures, const __global algorithmFPType * response,
+                                           int nClasses, int maxBins, int nStats, __global algorithmFPType * partialHistograms) {
+        const int partialId = get_global_id(0);
+        const int nPartials = get_global_size(0);
+        const int nodeId    = get_global_id(1);
+
+        const int rowOffset = nodeList[nodeId * 5 + 0];
+        const int nNodeRows = nodeList[nodeId * 5 + 1];
+        const int histSize  = nSelectedFeatures * maxBins * nStats;
+
+        const __global int * features        = selectedFeatures + nodeId * nSelectedFeatures;
+        __global algorithmFPType * histogram = partialHistograms + (nodeId * nPartials + partialId) * histSize;
+
+        for (int i = 0; i < histSize; i++)
+        {
+            histogram[i] = (algorithmFPType)0;
+        }
+
+        for (int i = partialId; i < nNodeRows; i += nPartials)
+        {
+            const int id            = treeOrder[rowOffset + i];
+            const algorithmFPType y = response[id];
+            for (int f = 0; f < nSelectedFeatures; f++)
+            {
+                __global algorithmFPType * stats = histogram + (f * maxBins + data[id * nFeatures + features[f]]) * nStats;
+                if (nClasses > 0)
+                {
+                    stats[(int)y] += (algorithmFPType)1;
+                }
+                else
+                {
+                    stats[0] += (algorithmFPType)1;
+                    stats[1] += y;
+                    stats[2] += y * y;
+                }
+            }
+        }
+    }
+
+    __kernel void reducePartialHistograms(const __global algorithmFPType * partialHistograms, __global algorithmFPType * histograms, int nPartials,
+                                          int histSize) {
+        const int id     = get_global_id(0);
+        const int nodeId = get_global_id(1);
+
+        const __global algorithmFPType * partial = partialHistograms + nodeId * nPartials * histSize + id;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (int p = 0; p < nPartials; p++)
+        {
+            sum += partial[p * histSize];
+        }
+        histograms[nodeId * histSize + id] = sum;
+    }
+
+    /* Bins of the histogram are replaced with the statistics of the rows to the left of the right bin border,
+       the split with the largest impurity decrease that leaves at least minObservationsInLeafNode rows in both children is chosen */
+    __kernel void computeBestSplitForFeatures(__global algorithmFPType * histograms, const __global int * selectedFeatures, int nSelectedFeatures,
+                                              const __global int * binOffsets, int maxBins, int nStats, int nClasses, int minObservationsInLeafNode,
+                                              __global algorithmFPType * featureImpDecrease, __global int * featureSplitBin) {
+        const int f      = get_global_id(0);
+        const int nodeId = get_global_id(1);
+
+        const int feature = selectedFeatures[nodeId * nSelectedFeatures + f];
+        const int nBins   = binOffsets[feature + 1] - binOffsets[feature];
+
+        __global algorithmFPType * histogram = histograms + (nodeId * nSelectedFeatures + f) * maxBins * nStats;
+
+        for (int b = 1; b < nBins; b++)
+        {
+            for (int k = 0; k < nStats; k++)
+            {
+                histogram[b * nStats + k] += histogram[(b - 1) * nStats + k];
+            }
+        }
+
+        const __global algorithmFPType * total = histogram + (nBins - 1) * nStats;
+
+        algorithmFPType n;
+        const algorithmFPType imp = computeImpurity(total, total, 0, nClasses, &n);
+
+        algorithmFPType bestDecrease = (algorithmFPType)-1;
+        int bestBin                  = -1;
+        for (int b = 0; b + 1 < nBins; b++)
+        {
+            algorithmFPType nLeft;
+            algorithmFPType nRight;
+            const algorithmFPType impLeft  = computeImpurity(total, histogram + b * nStats, 0, nClasses, &nLeft);
+            const algorithmFPType impRight = computeImpurity(total, histogram + b * nStats, 1, nClasses, &nRight);
+            if (nLeft < (algorithmFPType)minObservationsInLeafNode || nRight < (algorithmFPType)minObservationsInLeafNode) continue;
+
+            const algorithmFPType decrease = imp - (nLeft * impLeft + nRight * impRight) / n;
+            if (decrease > bestDecrease)
+            {
+                bestDecrease = decrease;
+                bestBin      = b;
+            }
+        }
+
+        featureImpDecrease[nodeId * nSelectedFeatures + f] = bestDecrease;
+        featureSplitBin[nodeId * nSelectedFeatures + f]    = bestBin;
+    }
+
+    /* Chooses the best split of the node among the selected features,
+       nodeStats[node * 3 * nStats] holds the statistics of the node, its left and right children */
+    __kernel void chooseBestSplit(const __global algorithmFPType * histograms, const __global algorithmFPType * featureImpDecrease,
+                                  const __global int * featureSplitBin, const __global int * selectedFeatures, int nSelectedFeatures,
+                                  const __global int * binOffsets, int maxBins, int nStats, algorithmFPType accuracy, __global int * nodeList,
+                                  __global algorithmFPType * nodeStats, __global algorithmFPType * nodeImpDecrease) {
+        const int nodeId = get_global_id(0);
+
+        int bestFeature              = -1;
+        algorithmFPType bestDecrease = accuracy;
+        for (int f = 0; f < nSelectedFeatures; f++)
+        {
+            const algorithmFPType decrease = featureImpDecrease[nodeId * nSelectedFeatures + f];
+            if (featureSplitBin[nodeId * nSelectedFeatures + f] >= 0 && decrease > bestDecrease)
+            {
+                bestDecrease = decrease;
+                bestFeature  = f;
+            }
+        }
+
+        const int f       = (bestFeature < 0) ? 0 : bestFeature;
+        const int feature = selectedFeatures[nodeId * nSelectedFeatures + f];
+        const int nBins   = binOffsets[feature + 1] - binOffsets[feature];
+        const int bin     = (bestFeature < 0) ? 0 : featureSplitBin[nodeId * nSelectedFeatures + f];
+
+        const __global algorithmFPType * histogram = histograms + (nodeId * nSelectedFeatures + f) * maxBins * nStats;
+        const __global algorithmFPType * total     = histogram + (nBins - 1) * nStats;
+        const __global algorithmFPType * left      = histogram + bin * nStats;
+
+        __global algorithmFPType * stats = nodeStats + nodeId * 3 * nStats;
+        for (int k = 0; k < nStats; k++)
+        {
+            stats[k]              = total[k];
+            stats[nStats + k]     = left[k];
+            stats[2 * nStats + k] = total[k] - left[k];
+        }
+
+        nodeList[nodeId * 5 + 2] = (bestFeature < 0) ? -1 : feature;
+        nodeList[nodeId * 5 + 3] = bin;
+        nodeImpDecrease[nodeId]  = (bestFeature < 0) ? (algorithmFPType)0 : bestDecrease;
+    }
+
+    /* Each work-group stably reorders the rows of one split node into treeOrderBuf: the rows of the left child go first.
+       The exact number of the rows of the left child is stored in the node as the histograms may be computed in single precision */
+    __kernel void partitionNodes(const __global int * data, int nFeatures, const __global int * treeOrder, __global int * treeOrderBuf,
+                                 __global int * nodeList) {
+        const int nodeId  = get_group_id(0);
+        const int localId = get_local_id(0);
+
+        __local int localSum[LOCAL_SIZE];
+
+        const int rowOffset = nodeList[nodeId * 5 + 0];
+        const int nNodeRows = nodeList[nodeId * 5 + 1];
+        const int feature   = nodeList[nodeId * 5 + 2];
+        const int splitBin  = nodeList[nodeId * 5 + 3];
+
+        if (feature < 0) return;
+
+        int nLeft = 0;
+        for (int i = localId; i < nNodeRows; i += LOCAL_SIZE)
+        {
+            nLeft += (data[treeOrder[rowOffset + i] * nFeatures + feature] <= splitBin);
+        }
+        localSum[localId] = nLeft;
+        nLeft             = sumReduceInt(localSum, localId, LOCAL_SIZE);
+        if (localId == 0) nodeList[nodeId * 5 + 4] = nLeft;
+
+        int leftOffset  = 0;
+        int rightOffset = nLeft;
+        for (int base = 0; base < nNodeRows; base += LOCAL_SIZE)
+        {
+            const int i = base + localId;
+            int id      = 0;
+            int isLeft  = 0;
+            if (i < nNodeRows)
+            {
+                id     = treeOrder[rowOffset + i];
+                isLeft = (data[id * nFeatures + feature] <= splitBin);
+            }
+
+            /* Inclusive scan of the left flags of the chunk */
+            localSum[localId] = isLeft;
+            for (int stride = 1; stride < LOCAL_SIZE; stride <<= 1)
+            {
+                barrier(CLK_LOCAL_MEM_FENCE);
+                const int value = (localId >= stride) ? localSum[localId - stride] : 0;
+                barrier(CLK_LOCAL_MEM_FENCE);
+                localSum[localId] += value;
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            const int leftBefore = localSum[localId] - isLeft;
+            const int nChunkLeft = localSum[LOCAL_SIZE - 1];
+            const int nChunkRows = (nNodeRows - base < LOCAL_SIZE) ? nNodeRows - base : LOCAL_SIZE;
+            if (i < nNodeRows && isLeft)
+            {
+                treeOrderBuf[rowOffset + leftOffset + leftBefore] = id;
+            }
+            else if (i < nNodeRows)
+            {
+                treeOrderBuf[rowOffset + rightOffset + localId - leftBefore] = id;
+            }
+            leftOffset += nChunkLeft;
+            rightOffset += nChunkRows - nChunkLeft;
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+    }
+
+    /* Trees are stored in the flattened layout: featureIndexes[i] is the split feature of the node i or -1 for a leaf,
+       leftIndexes[i] is the index of the left child in the tree (the right child follows it) or the class of the leaf,
+       values[i] is the split value or the response of the leaf */
+    __kernel void computeOOBPredictions(const __global algorithmFPType * data, int nFeatures, const __global int * inBag, int nRows, int nTrees,
+                                        const __global int * featureIndexes, const __global int * leftIndexes,
+                                        const __global algorithmFPType * values, const __global int * treeOffsets, int nClasses,
+                                        __global algorithmFPType * oobBuf) {
+        const int row = get_global_id(0);
+
+        const __global algorithmFPType * x = data + row * nFeatures;
+
+        for (int t = 0; t < nTrees; t++)
+        {
+            if (inBag[t * nRows + row]) continue;
+
+            int node = treeOffsets[t];
+            for (int feature = featureIndexes[node]; feature >= 0; feature = featureIndexes[node])
+            {
+                node = treeOffsets[t] + leftIndexes[node] + (x[feature] > values[node]);
+            }
+
+            if (nClasses > 0)
+            {
+                oobBuf[row * nClasses + leftIndexes[node]] += (algorithmFPType)1;
+            }
+            else
+            {
+                oobBuf[row * 2 + 0] += values[node];
+                oobBuf[row * 2 + 1] += (algorithmFPType)1;
+            }
+        }
+    }
+
+    /* Error of the OOB prediction of the row or -1 if the row was in-bag for all the trees */
+    __kernel void computeOOBError(const __global algorithmFPType * response, const __global algorithmFPType * oobBuf, int nClasses,
+                                  __global algorithmFPType * oobErrorPerObs) {
+        const int row = get_global_id(0);
+
+        if (nClasses > 0)
+        {
+            const __global algorithmFPType * votes = oobBuf + row * nClasses;
+
+            int maxClass             = 0;
+            algorithmFPType maxVotes = votes[0];
+            for (int k = 1; k < nClasses; k++)
+            {
+                if (maxVotes < votes[k])
+                {
+                    maxVotes = votes[k];
+                    maxClass = k;
+                }
+            }
+            oobErrorPerObs[row] = (maxVotes > (algorithmFPType)0) ? (algorithmFPType)(maxClass != (int)response[row]) : (algorithmFPType)-1;
+        }
+        else
+        {
+            const algorithmFPType count = oobBuf[row * 2 + 1];
+            if (count > (algorithmFPType)0)
+            {
+                const algorithmFPType diff = oobBuf[row * 2 + 0] / count - response[row];
+                oobErrorPerObs[row]        = diff * diff;
+            }
+            else
+            {
+                oobErrorPerObs[row] = (algorithmFPType)-1;
+            }
+        }
+    }
+
+    /* Single work-group averages the errors of the predicted rows */
+    __kernel void reduceOOBError(const __global algorithmFPType * oobErrorPerObs, int nRows, __global algorithmFPType * oobError) {
+        const int localId = get_local_id(0);
+
+        __local algorithmFPType localSum[LOCAL_SIZE];
+
+        algorithmFPType sum   = (algorithmFPType)0;
+        algorithmFPType count = (algorithmFPType)0;
+        for (int i = localId; i < nRows; i += LOCAL_SIZE)
+        {
+            const algorithmFPType error = oobErrorPerObs[i];
+            if (error >= (algorithmFPType)0)
+            {
+                sum += error;
+                count += (algorithmFPType)1;
+            }
+        }
+
+        localSum[localId] = sum;
+        sum               = sumReduce(localSum, localId, LOCAL_SIZE);
+        localSum[localId] = count;
+        count             = sumReduce(localSum, localId, LOCAL_SIZE);
+
+        if (localId == 0)
+        {
+            oobError[0] = (count > (algorithmFPType)0) ? sum / count : (algorithmFPType)0;
+        }
+    }
+
+);
+
+#endif
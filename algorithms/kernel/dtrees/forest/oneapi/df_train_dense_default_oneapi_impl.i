@@ -0,0 +1,901 @@
+/* file: df_train_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the decision forest training on GPU.
+//--
+*/
+
+#ifndef __DF_TRAIN_DENSE_DEFAULT_ONEAPI_IMPL_I__
+#define __DF_TRAIN_DENSE_DEFAULT_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/forest/oneapi/cl_kernels/df_batch_train_kernels.cl"
+
+#include "algorithms/kernel/dtrees/forest/oneapi/df_train_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.i"
+#include "algorithms/kernel/distributions/uniform/uniform_kernel.h"
+#include "algorithms/kernel/distributions/uniform/uniform_impl.i"
+
+#include "externals/service_ittnotify.h"
+#include "externals/service_math.h"
+#include "services/buffer.h"
+#include "services/env_detect.h"
+#include "services/error_indexes.h"
+#include "service/kernel/service_algo_utils.h"
+#include "service/kernel/service_data_utils.h"
+#include "oneapi/internal/types.h"
+
+using namespace daal::data_management;
+using namespace daal::oneapi::internal;
+using namespace daal::algorithms::distributions::uniform::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType>
+static void __buildProgram(ClKernelFactoryIface & factory)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+    {
+        auto fptype_name   = getKeyFPType<algorithmFPType>();
+        auto build_options = fptype_name;
+        build_options.add("-cl-std=CL1.2 -D LOCAL_SIZE=256"); // should be equal to _partitionLocalSize
+
+        services::String cachekey("__daal_algorithms_df_batch_train_");
+        cachekey.add(build_options);
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), df_batch_train_kernels, build_options.c_str());
+    }
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::init(const NumericTable * x, const Parameter & par, size_t nClasses)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.init);
+
+    services::Status status;
+
+    auto & context        = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    __buildProgram<algorithmFPType>(kernel_factory);
+
+    kernelMarkPresentRows             = kernel_factory.getKernel("markPresentRows", &status);
+    kernelComputePartialHistograms    = kernel_factory.getKernel("computePartialHistograms", &status);
+    kernelReducePartialHistograms     = kernel_factory.getKernel("reducePartialHistograms", &status);
+    kernelComputeBestSplitForFeatures = kernel_factory.getKernel("computeBestSplitForFeatures", &status);
+    kernelChooseBestSplit             = kernel_factory.getKernel("chooseBestSplit", &status);
+    kernelPartitionNodes              = kernel_factory.getKernel("partitionNodes", &status);
+    kernelComputeOOBPredictions       = kernel_factory.getKernel("computeOOBPredictions", &status);
+    kernelComputeOOBError             = kernel_factory.getKernel("computeOOBError", &status);
+    kernelReduceOOBError              = kernel_factory.getKernel("reduceOOBError", &status);
+
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _par       = &par;
+    _nClasses  = nClasses;
+    _nStats    = nClasses ? nClasses : 3;
+    _nRows     = x->getNumberOfRows();
+    _nFeatures = x->getNumberOfColumns();
+    _nSamples  = size_t(par.observationsPerTreeFraction * _nRows);
+
+    /* sqrt(p) features are tried per node for classification and p/3 for regression by default */
+    _nSelectedFeatures = par.featuresPerNode;
+    if (!_nSelectedFeatures)
+    {
+        _nSelectedFeatures = nClasses ? size_t(daal::internal::Math<double, sse2>::sSqrt(double(_nFeatures))) : _nFeatures / 3;
+        if (!_nSelectedFeatures) _nSelectedFeatures = 1;
+    }
+    DAAL_CHECK(_nSelectedFeatures <= _nFeatures, ErrorIncorrectParameter);
+    DAAL_CHECK(_nSamples > 0, ErrorIncorrectParameter);
+
+    const algorithmFPType accuracy = services::internal::EpsilonVal<algorithmFPType>::get();
+    _impurityThreshold             = (par.impurityThreshold < accuracy) ? accuracy : algorithmFPType(par.impurityThreshold);
+
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(*x));
+    DAAL_CHECK(!featTypes.hasUnorderedFeatures(), ErrorMethodNotImplemented);
+
+    dtrees::internal::BinParams prm(par.maxBins, par.minBinSize);
+    DAAL_CHECK_STATUS(status, (_indexedFeatures.init(*const_cast<NumericTable *>(x), &featTypes, &prm)));
+
+    /* Bin borders are the same for all the trees, so they are copied to the host once */
+    _maxBins = 0;
+    for (size_t i = 0; i < _nFeatures; i++)
+    {
+        const size_t nBins = _indexedFeatures.numIndices(i);
+        if (nBins > _maxBins) _maxBins = nBins;
+
+        auto binValuesHost = _indexedFeatures.binBorders(i).template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_MALLOC(_binValuesHost.safe_push_back(binValuesHost));
+        DAAL_CHECK_MALLOC(_featureIndices.safe_push_back(int(i)));
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::sampleRows(UniversalBuffer & treeOrder, size_t nTrees,
+                                                                              engines::internal::BatchBaseImpl & engine)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.sampleRows);
+
+    services::Status status;
+
+    auto treeOrderHost = treeOrder.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    for (size_t t = 0; t < nTrees; t++)
+    {
+        int * rows = treeOrderHost.get() + t * _nSamples;
+        if (_par->bootstrap)
+        {
+            DAAL_CHECK_STATUS(status, (UniformKernelDefault<int, sse2>::compute(0, int(_nRows), engine, _nSamples, rows)));
+        }
+        else
+        {
+            /* The first nSamples rows are used by all the trees as on CPU */
+            for (size_t i = 0; i < _nSamples; i++)
+            {
+                rows[i] = int(i);
+            }
+        }
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::markPresentRows(const UniversalBuffer & treeOrder, UniversalBuffer & inBag,
+                                                                                   size_t nTrees)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.markPresentRows);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelMarkPresentRows;
+
+    context.fill(inBag, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        KernelArguments args(4);
+        args.set(0, treeOrder, AccessModeIds::read);
+        args.set(1, inBag, AccessModeIds::write);
+        args.set(2, int(_nSamples));
+        args.set(3, int(_nRows));
+
+        KernelRange global_range(_nSamples, nTrees);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::selectFeatures(int * features, engines::internal::BatchBaseImpl & engine)
+{
+    services::Status status;
+
+    /* Partial Fisher-Yates shuffle of the indices of the features */
+    int * indices = _featureIndices.data();
+    for (size_t i = 0; i < _nSelectedFeatures; i++)
+    {
+        if (_nSelectedFeatures < _nFeatures)
+        {
+            int j = 0;
+            DAAL_CHECK_STATUS(status, (UniformKernelDefault<int, sse2>::compute(int(i), int(_nFeatures), engine, 1, &j)));
+            const int tmp = indices[i];
+            indices[i]    = indices[j];
+            indices[j]    = tmp;
+        }
+        features[i] = indices[i];
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::computeHistograms(const UniversalBuffer & treeOrder,
+                                                                                     const UniversalBuffer & nodeList,
+                                                                                     const UniversalBuffer & selectedFeatures,
+                                                                                     const UniversalBuffer & response, UniversalBuffer & histograms,
+                                                                                     size_t nNodes, size_t nPartials)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeHistograms);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    const size_t histSize = _nSelectedFeatures * _maxBins * _nStats;
+
+    auto partialHistograms = context.allocate(TypeIds::id<algorithmFPType>(), nNodes * nPartials * histSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        auto & kernel = kernelComputePartialHistograms;
+
+        KernelArguments args(11);
+        args.set(0, _indexedFeatures.getFullData(), AccessModeIds::read);
+        args.set(1, int(_nFeatures));
+        args.set(2, treeOrder, AccessModeIds::read);
+        args.set(3, nodeList, AccessModeIds::read);
+        args.set(4, selectedFeatures, AccessModeIds::read);
+        args.set(5, int(_nSelectedFeatures));
+        args.set(6, response, AccessModeIds::read);
+        args.set(7, int(_nClasses));
+        args.set(8, int(_maxBins));
+        args.set(9, int(_nStats));
+        args.set(10, partialHistograms, AccessModeIds::write);
+
+        KernelRange global_range(nPartials, nNodes);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    {
+        auto & kernel = kernelReducePartialHistograms;
+
+        KernelArguments args(4);
+        args.set(0, partialHistograms, AccessModeIds::read);
+        args.set(1, histograms, AccessModeIds::write);
+        args.set(2, int(nPartials));
+        args.set(3, int(histSize));
+
+        KernelRange global_range(histSize, nNodes);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::computeBestSplit(UniversalBuffer & histograms, UniversalBuffer & nodeList,
+                                                                                    const UniversalBuffer & selectedFeatures,
+                                                                                    UniversalBuffer & nodeStats, UniversalBuffer & nodeImpDecrease,
+                                                                                    size_t nNodes)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeBestSplit);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto featureImpDecrease = context.allocate(TypeIds::id<algorithmFPType>(), nNodes * _nSelectedFeatures, &status);
+    auto featureSplitBin    = context.allocate(TypeIds::id<int>(), nNodes * _nSelectedFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        auto & kernel = kernelComputeBestSplitForFeatures;
+
+        KernelArguments args(10);
+        args.set(0, histograms, AccessModeIds::readwrite);
+        args.set(1, selectedFeatures, AccessModeIds::read);
+        args.set(2, int(_nSelectedFeatures));
+        args.set(3, _indexedFeatures.binOffsets(), AccessModeIds::read);
+        args.set(4, int(_maxBins));
+        args.set(5, int(_nStats));
+        args.set(6, int(_nClasses));
+        args.set(7, int(_par->minObservationsInLeafNode));
+        args.set(8, featureImpDecrease, AccessModeIds::write);
+        args.set(9, featureSplitBin, AccessModeIds::write);
+
+        KernelRange global_range(_nSelectedFeatures, nNodes);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    {
+        auto & kernel = kernelChooseBestSplit;
+
+        KernelArguments args(12);
+        args.set(0, histograms, AccessModeIds::read);
+        args.set(1, featureImpDecrease, AccessModeIds::read);
+        args.set(2, featureSplitBin, AccessModeIds::read);
+        args.set(3, selectedFeatures, AccessModeIds::read);
+        args.set(4, int(_nSelectedFeatures));
+        args.set(5, _indexedFeatures.binOffsets(), AccessModeIds::read);
+        args.set(6, int(_maxBins));
+        args.set(7, int(_nStats));
+        args.set(8, services::internal::EpsilonVal<algorithmFPType>::get());
+        args.set(9, nodeList, AccessModeIds::readwrite);
+        args.set(10, nodeStats, AccessModeIds::write);
+        args.set(11, nodeImpDecrease, AccessModeIds::write);
+
+        KernelRange global_range(nNodes);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::partitionNodes(const UniversalBuffer & treeOrder, UniversalBuffer & treeOrderBuf,
+                                                                                  const UniversalBuffer & nodeList, size_t nNodes)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.partitionNodes);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelPartitionNodes;
+
+    {
+        KernelArguments args(5);
+        args.set(0, _indexedFeatures.getFullData(), AccessModeIds::read);
+        args.set(1, int(_nFeatures));
+        args.set(2, treeOrder, AccessModeIds::read);
+        args.set(3, treeOrderBuf, AccessModeIds::write);
+        args.set(4, nodeList, AccessModeIds::readwrite);
+
+        KernelRange local_range(_partitionLocalSize);
+        KernelRange global_range(nNodes * _partitionLocalSize);
+
+        KernelNDRange range(1);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::processLevel(services::Collection<ActiveNode> & level,
+                                                                                services::Collection<ActiveNode> & nextLevel, size_t iLevel,
+                                                                                const UniversalBuffer & response, UniversalBuffer & treeOrder,
+                                                                                UniversalBuffer & treeOrderBuf,
+                                                                                services::Collection<TreeTypePtr> & trees, size_t nTrees,
+                                                                                engines::internal::BatchBaseImpl & engine, algorithmFPType * varImp)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.processLevel);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    const size_t nLevelNodes = level.size();
+    const size_t histSize    = _nSelectedFeatures * _maxBins * _nStats;
+
+    int maxNodeRows = 0;
+    for (size_t i = 0; i < nLevelNodes; i++)
+    {
+        if (level[i].nRows > maxNodeRows) maxNodeRows = level[i].nRows;
+    }
+
+    size_t nPartials = size_t(maxNodeRows) / _minRowsPerPartial;
+    if (nPartials > _maxPartials) nPartials = _maxPartials;
+    if (nPartials < 1) nPartials = 1;
+
+    /* Nodes are processed in blocks to bound the size of the partial histograms */
+    size_t maxNodesInBlock = _maxHistogramsSize / (histSize * (nPartials + 1));
+    if (maxNodesInBlock < 1) maxNodesInBlock = 1;
+
+    for (size_t iStart = 0; iStart < nLevelNodes; iStart += maxNodesInBlock)
+    {
+        const size_t nNodes = (nLevelNodes - iStart < maxNodesInBlock) ? nLevelNodes - iStart : maxNodesInBlock;
+
+        auto nodeList         = context.allocate(TypeIds::id<int>(), nNodes * 5, &status);
+        auto selectedFeatures = context.allocate(TypeIds::id<int>(), nNodes * _nSelectedFeatures, &status);
+        auto histograms       = context.allocate(TypeIds::id<algorithmFPType>(), nNodes * histSize, &status);
+        auto nodeStats        = context.allocate(TypeIds::id<algorithmFPType>(), nNodes * 3 * _nStats, &status);
+        auto nodeImpDecrease  = context.allocate(TypeIds::id<algorithmFPType>(), nNodes, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        {
+            auto nodeListHost         = nodeList.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+            auto selectedFeaturesHost = selectedFeatures.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            for (size_t i = 0; i < nNodes; i++)
+            {
+                int * node = nodeListHost.get() + i * 5;
+                node[0]    = level[iStart + i].rowOffset;
+                node[1]    = level[iStart + i].nRows;
+                node[2]    = -1;
+                node[3]    = 0;
+                node[4]    = 0;
+                DAAL_CHECK_STATUS(status, selectFeatures(selectedFeaturesHost.get() + i * _nSelectedFeatures, engine));
+            }
+        }
+
+        DAAL_CHECK_STATUS(status, computeHistograms(treeOrder, nodeList, selectedFeatures, response, histograms, nNodes, nPartials));
+        DAAL_CHECK_STATUS(status, computeBestSplit(histograms, nodeList, selectedFeatures, nodeStats, nodeImpDecrease, nNodes));
+        DAAL_CHECK_STATUS(status, partitionNodes(treeOrder, treeOrderBuf, nodeList, nNodes));
+
+        auto nodeListHost        = nodeList.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+        auto nodeStatsHost       = nodeStats.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        auto nodeImpDecreaseHost = nodeImpDecrease.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            const ActiveNode & node       = level[iStart + i];
+            const int * split             = nodeListHost.get() + i * 5;
+            const algorithmFPType * stats = nodeStatsHost.get() + i * 3 * _nStats;
+            TreeType & tree               = *trees[node.treeId];
+
+            algorithmFPType count;
+            const algorithmFPType impurity = computeImpurity(stats, count);
+            if (split[2] < 0 || terminateCriteria(count, iLevel, impurity))
+            {
+                *node.slot = makeLeaf(tree, stats, count, impurity);
+                DAAL_CHECK_MALLOC(*node.slot);
+                continue;
+            }
+
+            const int feature                          = split[2];
+            typename NodeType::Split * const splitNode = tree.allocator().allocSplit();
+            DAAL_CHECK_MALLOC(splitNode);
+            splitNode->set(feature, _binValuesHost[feature].get()[split[3]], false);
+            splitNode->count    = node.nRows;
+            splitNode->impurity = impurity;
+            *node.slot          = splitNode;
+
+            if (varImp) varImp[feature] += nodeImpDecreaseHost.get()[i];
+
+            const int nChildRows[2] = { split[4], node.nRows - split[4] };
+            int childOffset         = node.rowOffset;
+            for (size_t side = 0; side < 2; side++)
+            {
+                const algorithmFPType * childStats = stats + (side + 1) * _nStats;
+
+                algorithmFPType childCount;
+                const algorithmFPType childImpurity = computeImpurity(childStats, childCount);
+                if (terminateCriteria(algorithmFPType(nChildRows[side]), iLevel + 1, childImpurity))
+                {
+                    splitNode->kid[side] = makeLeaf(tree, childStats, algorithmFPType(nChildRows[side]), childImpurity);
+                    DAAL_CHECK_MALLOC(splitNode->kid[side]);
+                }
+                else
+                {
+                    ActiveNode child;
+                    child.treeId    = node.treeId;
+                    child.rowOffset = childOffset;
+                    child.nRows     = nChildRows[side];
+                    child.slot      = &splitNode->kid[side];
+                    DAAL_CHECK_MALLOC(nextLevel.safe_push_back(child));
+                }
+                childOffset += nChildRows[side];
+            }
+        }
+    }
+
+    /* The rows of the split nodes are reordered in treeOrderBuf, the rows of the new leaves are not used anymore */
+    context.copy(treeOrder, 0, treeOrderBuf, 0, nTrees * _nSamples, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::computeOOBPredictions(const services::Buffer<algorithmFPType> & data,
+                                                                                         const UniversalBuffer & inBag,
+                                                                                         const services::Collection<TreeTypePtr> & trees,
+                                                                                         size_t nTrees, UniversalBuffer & oobBuf)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeOOBPredictions);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeOOBPredictions;
+
+    size_t nNodes = 0;
+    for (size_t t = 0; t < nTrees; t++)
+    {
+        nNodes += trees[t]->getNumberOfNodes();
+    }
+
+    auto featureIndexes = context.allocate(TypeIds::id<int>(), nNodes, &status);
+    auto leftIndexes    = context.allocate(TypeIds::id<int>(), nNodes, &status);
+    auto values         = context.allocate(TypeIds::id<algorithmFPType>(), nNodes, &status);
+    auto treeOffsets    = context.allocate(TypeIds::id<int>(), nTrees, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* Trees are flattened in the breadth-first order, the children of a split node are adjacent */
+    {
+        auto featureIndexesHost = featureIndexes.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+        auto leftIndexesHost    = leftIndexes.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+        auto valuesHost         = values.template get<algorithmFPType>().toHost(ReadWriteMode::writeOnly, &status);
+        auto treeOffsetsHost    = treeOffsets.template get<int>().toHost(ReadWriteMode::writeOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        services::Collection<const typename NodeType::Base *> queue;
+        size_t offset = 0;
+        for (size_t t = 0; t < nTrees; t++)
+        {
+            treeOffsetsHost.get()[t] = int(offset);
+
+            queue.clear();
+            DAAL_CHECK_MALLOC(queue.safe_push_back(trees[t]->top()));
+            for (size_t i = 0; i < queue.size(); i++)
+            {
+                const typename NodeType::Base * node = queue[i];
+                const size_t pos                     = offset + i;
+                if (node->isSplit())
+                {
+                    const typename NodeType::Split * split = NodeType::castSplit(node);
+                    featureIndexesHost.get()[pos]          = split->featureIdx;
+                    leftIndexesHost.get()[pos]             = int(queue.size());
+                    valuesHost.get()[pos]                  = algorithmFPType(split->featureValue);
+                    DAAL_CHECK_MALLOC(queue.safe_push_back(split->left()));
+                    DAAL_CHECK_MALLOC(queue.safe_push_back(split->right()));
+                }
+                else
+                {
+                    featureIndexesHost.get()[pos] = -1;
+                    getLeafResponse(*NodeType::castLeaf(node), leftIndexesHost.get()[pos], valuesHost.get()[pos]);
+                }
+            }
+            offset += queue.size();
+        }
+    }
+
+    {
+        KernelArguments args(11);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, int(_nFeatures));
+        args.set(2, inBag, AccessModeIds::read);
+        args.set(3, int(_nRows));
+        args.set(4, int(nTrees));
+        args.set(5, featureIndexes, AccessModeIds::read);
+        args.set(6, leftIndexes, AccessModeIds::read);
+        args.set(7, values, AccessModeIds::read);
+        args.set(8, treeOffsets, AccessModeIds::read);
+        args.set(9, int(_nClasses));
+        args.set(10, oobBuf, AccessModeIds::readwrite);
+
+        KernelRange global_range(_nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::finalizeOOBError(const services::Buffer<algorithmFPType> & response,
+                                                                                    const UniversalBuffer & oobBuf, NumericTable * oobError,
+                                                                                    NumericTable * oobErrorPerObs)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.finalizeOOBError);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto oobErrorPerObsBuf = context.allocate(TypeIds::id<algorithmFPType>(), _nRows, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    {
+        auto & kernel = kernelComputeOOBError;
+
+        KernelArguments args(4);
+        args.set(0, response, AccessModeIds::read);
+        args.set(1, oobBuf, AccessModeIds::read);
+        args.set(2, int(_nClasses));
+        args.set(3, oobErrorPerObsBuf, AccessModeIds::write);
+
+        KernelRange global_range(_nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    if (oobErrorPerObs)
+    {
+        BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(status, oobErrorPerObs->getBlockOfRows(0, _nRows, writeOnly, block));
+        context.copy(block.getBuffer(), 0, oobErrorPerObsBuf, 0, _nRows, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, oobErrorPerObs->releaseBlockOfRows(block));
+    }
+
+    if (oobError)
+    {
+        auto & kernel = kernelReduceOOBError;
+
+        BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(status, oobError->getBlockOfRows(0, 1, writeOnly, block));
+        auto oobErrorBuf = block.getBuffer();
+
+        KernelArguments args(3);
+        args.set(0, oobErrorPerObsBuf, AccessModeIds::read);
+        args.set(1, int(_nRows));
+        args.set(2, oobErrorBuf, AccessModeIds::write);
+
+        KernelRange local_range(_partitionLocalSize);
+        KernelRange global_range(_partitionLocalSize);
+
+        KernelNDRange range(1);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        DAAL_CHECK_STATUS(status, oobError->releaseBlockOfRows(block));
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType, typename ModelType>
+algorithmFPType TrainBatchTaskOneAPI<algorithmFPType, ModelType>::computeImpurity(const algorithmFPType * stats, algorithmFPType & count) const
+{
+    if (_nClasses)
+    {
+        algorithmFPType sumSq = 0;
+        count                 = 0;
+        for (size_t k = 0; k < _nClasses; k++)
+        {
+            count += stats[k];
+            sumSq += stats[k] * stats[k];
+        }
+        return (count > 0) ? algorithmFPType(1) - sumSq / (count * count) : algorithmFPType(0);
+    }
+
+    count = stats[0];
+    if (!(count > 0)) return algorithmFPType(0);
+
+    const algorithmFPType mean = stats[1] / count;
+    const algorithmFPType var  = stats[2] / count - mean * mean;
+    return (var > 0) ? var : algorithmFPType(0);
+}
+
+template <typename algorithmFPType, typename ModelType>
+bool TrainBatchTaskOneAPI<algorithmFPType, ModelType>::terminateCriteria(algorithmFPType count, size_t level, algorithmFPType impurity) const
+{
+    return (count < algorithmFPType(2 * _par->minObservationsInLeafNode) || impurity < _impurityThreshold
+            || ((_par->maxTreeDepth > 0) && (level >= _par->maxTreeDepth)));
+}
+
+template <typename algorithmFPType, typename ModelType>
+typename TrainBatchTaskOneAPI<algorithmFPType, ModelType>::NodeType::Base * TrainBatchTaskOneAPI<algorithmFPType, ModelType>::makeLeaf(
+    TreeType & tree, const algorithmFPType * stats, algorithmFPType count, algorithmFPType impurity) const
+{
+    typename NodeType::Leaf * const leaf = tree.allocator().allocLeaf(_nClasses);
+    if (!leaf) return nullptr;
+
+    leaf->count    = size_t(count);
+    leaf->impurity = impurity;
+    setLeafData(*leaf, stats, _nClasses);
+    return leaf;
+}
+
+template <typename algorithmFPType, typename ModelType>
+void TrainBatchTaskOneAPI<algorithmFPType, ModelType>::setLeafData(
+    dtrees::internal::TreeNodeLeaf<dtrees::internal::ClassifierResponse<ClassIndexType, size_t> > & leaf, const algorithmFPType * stats,
+    size_t nClasses)
+{
+    ClassIndexType maxClass = 0;
+    for (size_t k = 0; k < nClasses; k++)
+    {
+        leaf.hist[k] = stats[k];
+        if (stats[maxClass] < stats[k]) maxClass = k;
+    }
+    leaf.response.value = maxClass;
+}
+
+template <typename algorithmFPType, typename ModelType>
+void TrainBatchTaskOneAPI<algorithmFPType, ModelType>::setLeafData(dtrees::internal::TreeNodeLeaf<RegressionFPType> & leaf,
+                                                                   const algorithmFPType * stats, size_t nClasses)
+{
+    leaf.response = stats[1] / stats[0];
+}
+
+template <typename algorithmFPType, typename ModelType>
+void TrainBatchTaskOneAPI<algorithmFPType, ModelType>::getLeafResponse(
+    const dtrees::internal::TreeNodeLeaf<dtrees::internal::ClassifierResponse<ClassIndexType, size_t> > & leaf, int & leftIndex,
+    algorithmFPType & value)
+{
+    leftIndex = int(leaf.response.value);
+    value     = algorithmFPType(0);
+}
+
+template <typename algorithmFPType, typename ModelType>
+void TrainBatchTaskOneAPI<algorithmFPType, ModelType>::getLeafResponse(const dtrees::internal::TreeNodeLeaf<RegressionFPType> & leaf, int & leftIndex,
+                                                                       algorithmFPType & value)
+{
+    leftIndex = 0;
+    value     = algorithmFPType(leaf.response);
+}
+
+template <typename algorithmFPType, typename ModelType>
+services::Status TrainBatchTaskOneAPI<algorithmFPType, ModelType>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
+                                                                           const NumericTable * y, ModelType & model, const Parameter & par,
+                                                                           size_t nClasses, NumericTable * varImp, NumericTable * oobError,
+                                                                           NumericTable * oobErrorPerObs)
+{
+    services::Status status;
+
+    DAAL_CHECK(!par.memorySavingMode, ErrorMethodNotImplemented);
+    DAAL_CHECK(par.varImportance == decision_forest::training::none || par.varImportance == decision_forest::training::MDI,
+               ErrorMethodNotImplemented);
+
+    if (par.varImportance == decision_forest::training::none) varImp = nullptr;
+    if (!(par.resultsToCompute & decision_forest::training::computeOutOfBagError)) oobError = nullptr;
+    if (!(par.resultsToCompute & decision_forest::training::computeOutOfBagErrorPerObservation)) oobErrorPerObs = nullptr;
+    const bool computeOOB = oobError || oobErrorPerObs;
+
+    engines::internal::BatchBaseImpl * engineImpl = dynamic_cast<engines::internal::BatchBaseImpl *>(par.engine.get());
+    DAAL_CHECK(engineImpl, ErrorEngineNotSupported);
+
+    DAAL_CHECK_STATUS(status, init(x, par, nClasses));
+    DAAL_CHECK_MALLOC(model.resize(par.nTrees));
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    services::internal::HostAppHelper host(pHostApp, 1);
+
+    /* Trees are built in blocks to bound the size of the sampled rows and in-bag flags */
+    const size_t maxRowsPerTree = (_nSamples > _nRows) ? _nSamples : _nRows;
+    size_t nTreesInBlock        = _maxRowsInBlock / maxRowsPerTree;
+    if (nTreesInBlock > par.nTrees) nTreesInBlock = par.nTrees;
+    if (nTreesInBlock < 1) nTreesInBlock = 1;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nTreesInBlock, maxRowsPerTree);
+
+    auto treeOrder    = context.allocate(TypeIds::id<int>(), nTreesInBlock * _nSamples, &status);
+    auto treeOrderBuf = context.allocate(TypeIds::id<int>(), nTreesInBlock * _nSamples, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    UniversalBuffer inBag;
+    UniversalBuffer oobBuf;
+    if (computeOOB)
+    {
+        inBag  = context.allocate(TypeIds::id<int>(), nTreesInBlock * _nRows, &status);
+        oobBuf = context.allocate(TypeIds::id<algorithmFPType>(), _nRows * (nClasses ? nClasses : 2), &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        context.fill(oobBuf, 0.0, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    services::Collection<algorithmFPType> varImpHost;
+    if (varImp)
+    {
+        for (size_t i = 0; i < _nFeatures; i++)
+        {
+            DAAL_CHECK_MALLOC(varImpHost.safe_push_back(algorithmFPType(0)));
+        }
+    }
+
+    BlockDescriptor<algorithmFPType> yBlock;
+    DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(y)->getBlockOfRows(0, _nRows, readOnly, yBlock));
+    const UniversalBuffer response = yBlock.getBuffer();
+
+    BlockDescriptor<algorithmFPType> xBlock;
+    if (computeOOB)
+    {
+        DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(x)->getBlockOfRows(0, _nRows, readOnly, xBlock));
+    }
+
+    for (size_t iTree = 0; iTree < par.nTrees; iTree += nTreesInBlock)
+    {
+        if (host.isCancelled(status, 1)) return status;
+
+        const size_t nTrees = (par.nTrees - iTree < nTreesInBlock) ? par.nTrees - iTree : nTreesInBlock;
+
+        DAAL_CHECK_STATUS(status, sampleRows(treeOrder, nTrees, *engineImpl));
+        if (computeOOB)
+        {
+            DAAL_CHECK_STATUS(status, markPresentRows(treeOrder, inBag, nTrees));
+        }
+
+        services::Collection<TreeTypePtr> trees;
+        services::Collection<typename NodeType::Base *> roots(nTrees);
+        DAAL_CHECK_MALLOC(roots.data());
+
+        services::Collection<ActiveNode> level;
+        for (size_t t = 0; t < nTrees; t++)
+        {
+            TreeTypePtr tree(new TreeType());
+            DAAL_CHECK_MALLOC(tree.get() && trees.safe_push_back(tree));
+
+            roots[t] = nullptr;
+
+            ActiveNode root;
+            root.treeId    = t;
+            root.rowOffset = int(t * _nSamples);
+            root.nRows     = int(_nSamples);
+            root.slot      = &roots[t];
+            DAAL_CHECK_MALLOC(level.safe_push_back(root));
+        }
+
+        for (size_t iLevel = 0; level.size() > 0; iLevel++)
+        {
+            services::Collection<ActiveNode> nextLevel;
+            DAAL_CHECK_STATUS(status, processLevel(level, nextLevel, iLevel, response, treeOrder, treeOrderBuf, trees, nTrees, *engineImpl,
+                                                   varImp ? varImpHost.data() : nullptr));
+            level = nextLevel;
+        }
+
+        for (size_t t = 0; t < nTrees; t++)
+        {
+            trees[t]->reset(roots[t], false);
+            DAAL_CHECK_MALLOC(model.add(*trees[t], nClasses));
+        }
+
+        if (computeOOB)
+        {
+            DAAL_CHECK_STATUS(status, computeOOBPredictions(xBlock.getBuffer(), inBag, trees, nTrees, oobBuf));
+        }
+    }
+
+    if (computeOOB)
+    {
+        DAAL_CHECK_STATUS(status, finalizeOOBError(yBlock.getBuffer(), oobBuf, oobError, oobErrorPerObs));
+        DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(x)->releaseBlockOfRows(xBlock));
+    }
+    DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(y)->releaseBlockOfRows(yBlock));
+
+    if (varImp)
+    {
+        /* Mean decrease of impurity is averaged over all the trees */
+        BlockDescriptor<algorithmFPType> varImpBlock;
+        DAAL_CHECK_STATUS(status, varImp->getBlockOfRows(0, 1, writeOnly, varImpBlock));
+        {
+            auto varImpBlockHost = varImpBlock.getBuffer().toHost(ReadWriteMode::writeOnly, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            const algorithmFPType div = algorithmFPType(1) / algorithmFPType(par.nTrees);
+            for (size_t i = 0; i < _nFeatures; i++)
+            {
+                varImpBlockHost.get()[i] = varImpHost[i] * div;
+            }
+        }
+        DAAL_CHECK_STATUS(status, varImp->releaseBlockOfRows(varImpBlock));
+    }
+
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
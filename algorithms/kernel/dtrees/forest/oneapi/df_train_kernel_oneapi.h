@@ -0,0 +1,171 @@
+/* file: df_train_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that trains the decision forest classification
+//  and regression models on GPU.
+//--
+*/
+
+#ifndef __DF_TRAIN_KERNEL_ONEAPI_H__
+#define __DF_TRAIN_KERNEL_ONEAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table.h"
+#include "services/host_app.h"
+#include "algorithms/decision_forest/decision_forest_training_parameter.h"
+#include "algorithms/kernel/engines/engine_batch_impl.h"
+#include "algorithms/kernel/dtrees/dtrees_model_impl.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Builds the trees of the forest on GPU. The features are binned once with the binning of gradient boosted trees,
+ * the trees are built in blocks: all the nodes of one level of the trees of the block are processed by each kernel call.
+ * Out-of-bag error is computed on GPU from the in-bag flags of the rows and the flattened trees.
+ * nClasses is 0 for regression.
+ */
+template <typename algorithmFPType, typename ModelType>
+class TrainBatchTaskOneAPI
+{
+public:
+    typedef typename ModelType::TreeType TreeType;
+    typedef typename TreeType::NodeType NodeType;
+    typedef services::SharedPtr<TreeType> TreeTypePtr;
+
+    TrainBatchTaskOneAPI()
+        : _par(nullptr),
+          _nClasses(0),
+          _nStats(0),
+          _nRows(0),
+          _nFeatures(0),
+          _nSelectedFeatures(0),
+          _maxBins(0),
+          _nSamples(0),
+          _impurityThreshold(0)
+    {}
+
+    services::Status compute(services::HostAppIface * pHostApp, const data_management::NumericTable * x, const data_management::NumericTable * y,
+                             ModelType & model, const Parameter & par, size_t nClasses, data_management::NumericTable * varImp,
+                             data_management::NumericTable * oobError, data_management::NumericTable * oobErrorPerObs);
+
+private:
+    /* Node of the current level to be split, slot is the place where the pointer to the node is stored in its parent */
+    struct ActiveNode
+    {
+        size_t treeId;
+        int rowOffset;
+        int nRows;
+        typename NodeType::Base ** slot;
+    };
+
+    services::Status init(const data_management::NumericTable * x, const Parameter & par, size_t nClasses);
+
+    services::Status sampleRows(oneapi::internal::UniversalBuffer & treeOrder, size_t nTrees, engines::internal::BatchBaseImpl & engine);
+
+    services::Status markPresentRows(const oneapi::internal::UniversalBuffer & treeOrder, oneapi::internal::UniversalBuffer & inBag, size_t nTrees);
+
+    services::Status selectFeatures(int * features, engines::internal::BatchBaseImpl & engine);
+
+    services::Status computeHistograms(const oneapi::internal::UniversalBuffer & treeOrder, const oneapi::internal::UniversalBuffer & nodeList,
+                                       const oneapi::internal::UniversalBuffer & selectedFeatures, const oneapi::internal::UniversalBuffer & response,
+                                       oneapi::internal::UniversalBuffer & histograms, size_t nNodes, size_t nPartials);
+
+    services::Status computeBestSplit(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & nodeList,
+                                      const oneapi::internal::UniversalBuffer & selectedFeatures, oneapi::internal::UniversalBuffer & nodeStats,
+                                      oneapi::internal::UniversalBuffer & nodeImpDecrease, size_t nNodes);
+
+    services::Status partitionNodes(const oneapi::internal::UniversalBuffer & treeOrder, oneapi::internal::UniversalBuffer & treeOrderBuf,
+                                    const oneapi::internal::UniversalBuffer & nodeList, size_t nNodes);
+
+    /* Processes the nodes of one level of the block of nTrees trees, the nodes to be split at the next level are added to nextLevel */
+    services::Status processLevel(services::Collection<ActiveNode> & level, services::Collection<ActiveNode> & nextLevel, size_t iLevel,
+                                  const oneapi::internal::UniversalBuffer & response, oneapi::internal::UniversalBuffer & treeOrder,
+                                  oneapi::internal::UniversalBuffer & treeOrderBuf, services::Collection<TreeTypePtr> & trees, size_t nTrees,
+                                  engines::internal::BatchBaseImpl & engine, algorithmFPType * varImp);
+
+    services::Status computeOOBPredictions(const services::Buffer<algorithmFPType> & data, const oneapi::internal::UniversalBuffer & inBag,
+                                           const services::Collection<TreeTypePtr> & trees, size_t nTrees,
+                                           oneapi::internal::UniversalBuffer & oobBuf);
+
+    services::Status finalizeOOBError(const services::Buffer<algorithmFPType> & response, const oneapi::internal::UniversalBuffer & oobBuf,
+                                      data_management::NumericTable * oobError, data_management::NumericTable * oobErrorPerObs);
+
+    /* Gini index of the class counts or the variance of the responses given by the count, sum and sum of squares */
+    algorithmFPType computeImpurity(const algorithmFPType * stats, algorithmFPType & count) const;
+
+    bool terminateCriteria(algorithmFPType count, size_t level, algorithmFPType impurity) const;
+
+    typename NodeType::Base * makeLeaf(TreeType & tree, const algorithmFPType * stats, algorithmFPType count, algorithmFPType impurity) const;
+
+    static void setLeafData(dtrees::internal::TreeNodeLeaf<dtrees::internal::ClassifierResponse<ClassIndexType, size_t> > & leaf,
+                            const algorithmFPType * stats, size_t nClasses);
+    static void setLeafData(dtrees::internal::TreeNodeLeaf<RegressionFPType> & leaf, const algorithmFPType * stats, size_t nClasses);
+
+    static void getLeafResponse(const dtrees::internal::TreeNodeLeaf<dtrees::internal::ClassifierResponse<ClassIndexType, size_t> > & leaf,
+                                int & leftIndex, algorithmFPType & value);
+    static void getLeafResponse(const dtrees::internal::TreeNodeLeaf<RegressionFPType> & leaf, int & leftIndex, algorithmFPType & value);
+
+    oneapi::internal::KernelPtr kernelMarkPresentRows;
+    oneapi::internal::KernelPtr kernelComputePartialHistograms;
+    oneapi::internal::KernelPtr kernelReducePartialHistograms;
+    oneapi::internal::KernelPtr kernelComputeBestSplitForFeatures;
+    oneapi::internal::KernelPtr kernelChooseBestSplit;
+    oneapi::internal::KernelPtr kernelPartitionNodes;
+    oneapi::internal::KernelPtr kernelComputeOOBPredictions;
+    oneapi::internal::KernelPtr kernelComputeOOBError;
+    oneapi::internal::KernelPtr kernelReduceOOBError;
+
+    gbt::internal::IndexedFeaturesOneAPI<algorithmFPType> _indexedFeatures;
+    const Parameter * _par;
+    size_t _nClasses;
+    size_t _nStats;
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _nSelectedFeatures;
+    size_t _maxBins;
+    size_t _nSamples;
+    algorithmFPType _impurityThreshold;
+
+    services::Collection<services::SharedPtr<algorithmFPType> > _binValuesHost;
+    services::Collection<int> _featureIndices;
+
+    static const uint32_t _partitionLocalSize = 256; // should be equal to LOCAL_SIZE of the kernels
+    static const uint32_t _maxPartials        = 64;
+    static const uint32_t _minRowsPerPartial  = 256;
+    static const uint32_t _maxHistogramsSize  = 1 << 24; // maximal number of elements of the partial histograms of one block of nodes
+    static const uint32_t _maxRowsInBlock     = 1 << 26; // maximal number of sampled rows of one block of trees
+};
+
+} // namespace internal
+} // namespace training
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -191,6 +191,15 @@ bool ModelImpl::add(const TreeType & tree, size_t nClasses)
     return true;
 }
 
+services::Status ModelImpl::addTrees(const decision_forest::regression::Model & other)
+{
+    const ModelImpl * otherImpl = dynamic_cast<const ModelImpl *>(&other);
+    DAAL_CHECK(otherImpl, services::ErrorIncorrectTypeOfModel);
+    DAAL_CHECK(otherImpl->getNumberOfFeatures() == getNumberOfFeatures(), services::ErrorIncorrectNumberOfFeatures);
+    DAAL_CHECK_MALLOC(append(*otherImpl));
+    return services::Status();
+}
+
 } // namespace internal
 } // namespace regression
 } // namespace decision_forest
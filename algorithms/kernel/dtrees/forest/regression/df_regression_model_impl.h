@@ -66,6 +66,11 @@ public:
 
     bool add(const TreeType & tree, size_t nClasses);
 
+    virtual services::Status addTrees(const decision_forest::regression::Model & other) DAAL_C11_OVERRIDE;
+
+    virtual services::Status compact() DAAL_C11_OVERRIDE { return ImplType::compact(true); }
+    virtual bool isCompact() const DAAL_C11_OVERRIDE { return ImplType::isCompact(); }
+
     virtual size_t getNumberOfTrees() const DAAL_C11_OVERRIDE;
 };
 
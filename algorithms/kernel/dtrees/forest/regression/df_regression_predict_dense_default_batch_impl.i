@@ -85,7 +85,9 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const decision
     const auto nTreesTotal = m->size();
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
-    for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    /* The trees of a compact model are traversed directly, ModelImpl::at() would restore the tables */
+    this->_compactForest = m->compactForest();
+    for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = this->_compactForest ? nullptr : m->at(i);
     const algorithmFPType div = algorithmFPType(1) / algorithmFPType(nTreesTotal);
     return super::run(pHostApp, div);
 }
@@ -37,10 +37,12 @@ namespace training
 namespace interface1
 {
 template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class BatchContainer<DAAL_FPTYPE, hist, DAAL_CPU>;
 }
 namespace internal
 {
 template class RegressionTrainBatchKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+template class RegressionTrainBatchKernel<DAAL_FPTYPE, hist, DAAL_CPU>;
 }
 
 } // namespace training
@@ -29,5 +29,7 @@ namespace algorithms
 {
 __DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_forest::regression::training::BatchContainer, batch, DAAL_FPTYPE,
                                       decision_forest::regression::training::defaultDense)
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(decision_forest::regression::training::BatchContainer, batch, DAAL_FPTYPE,
+                                      decision_forest::regression::training::hist)
 }
 } // namespace daal
@@ -275,37 +275,41 @@ void OrderedRespHelper<algorithmFPType, cpu>::finalizeBestSplit(const IndexType
     DAAL_ASSERT(bestSplit.nLeft > 0);
     const algorithmFPType divL = algorithmFPType(1.) / algorithmFPType(bestSplit.nLeft);
     bestSplit.left.mean *= divL;
-    bestSplit.left.var                                = 0;
-    IndexType * bestSplitIdxRight                     = bestSplitIdx + bestSplit.nLeft;
-    size_t iLeft                                      = 0;
-    size_t iRight                                     = 0;
-    int iRowSplitVal                                  = -1;
-    const auto aResponse                              = this->_aResponse.get();
-    const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-    for (size_t i = 0; i < n; ++i)
+    bestSplit.left.var            = 0;
+    IndexType * bestSplitIdxRight = bestSplitIdx + bestSplit.nLeft;
+    int iRowSplitVal              = -1;
+    const auto aResponse          = this->_aResponse.get();
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 iRowSplitVal = doPartition<typename super::Response, IndexType, BinIndexType, size_t, cpu>(
+                                     n, aIdx, aResponse, this->indexedFeatures().template dataAs<BinIndexType>(iFeature), bestSplit.featureUnordered,
+                                     idxFeatureValueBestSplit, bestSplitIdxRight, bestSplitIdx, bestSplit.nLeft));
+    for (size_t i = 0; i < bestSplit.nLeft; ++i)
     {
-        const auto iSample = aIdx[i];
-        const auto idx     = indexedFeature[aResponse[iSample].idx];
-        if ((bestSplit.featureUnordered && (idx != idxFeatureValueBestSplit)) || ((!bestSplit.featureUnordered) && (idx > idxFeatureValueBestSplit)))
-        {
-            DAAL_ASSERT(iRight < n - bestSplit.nLeft);
-            bestSplitIdxRight[iRight++] = iSample;
-        }
-        else
-        {
-            if (idx == idxFeatureValueBestSplit) iRowSplitVal = aResponse[iSample].idx;
-            DAAL_ASSERT(iLeft < bestSplit.nLeft);
-            bestSplitIdx[iLeft++]   = iSample;
-            const algorithmFPType y = aResponse[iSample].val;
-            bestSplit.left.var += (y - bestSplit.left.mean) * (y - bestSplit.left.mean);
-        }
+        const algorithmFPType y = aResponse[bestSplitIdx[i]].val;
+        bestSplit.left.var += (y - bestSplit.left.mean) * (y - bestSplit.left.mean);
     }
-    DAAL_ASSERT(iRight == n - bestSplit.nLeft);
-    DAAL_ASSERT(iLeft == bestSplit.nLeft);
     bestSplit.left.var *= divL;
     bestSplit.iStart = 0;
     DAAL_ASSERT(iRowSplitVal >= 0);
-    bestSplit.featureValue = this->getValue(iFeature, iRowSplitVal);
+    bestSplit.featureValue = this->getSplitValue(iFeature, iRowSplitVal, idxFeatureValueBestSplit);
+}
+
+//count the number of responses and sum the responses for each index of feature value, returns the sum of all the responses
+template <typename ResponseType, typename IndexType, typename FeatureIndexType, typename intermSummFPType, typename algorithmFPType, CpuType cpu>
+intermSummFPType sumResponses(size_t n, const IndexType * aIdx, const ResponseType * aResponse, const FeatureIndexType * indexedFeature,
+                              IndexType * nFeatIdx, algorithmFPType * buf)
+{
+    intermSummFPType sumTotal = 0;
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; ++i)
+    {
+        const ResponseType & r     = aResponse[aIdx[i]];
+        const FeatureIndexType idx = indexedFeature[r.idx];
+        ++nFeatIdx[idx];
+        buf[idx] += r.val;
+        sumTotal += r.val;
+    }
+    return sumTotal;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -326,20 +330,10 @@ int OrderedRespHelper<algorithmFPType, cpu>::findBestSplitForFeatureSorted(algor
 
     auto nFeatIdx             = _idxFeatureBuf.get(); //number of indexed feature values, array
     intermSummFPType sumTotal = 0;                    //total sum of responses in the set being split
-    {
-        const IndexedFeatures::IndexType * indexedFeature = this->indexedFeatures().data(iFeature);
-        auto aResponse                                    = this->_aResponse.get();
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t i = 0; i < n; ++i)
-        {
-            const IndexType iSample              = aIdx[i];
-            const typename super::Response & r   = aResponse[aIdx[i]];
-            const IndexedFeatures::IndexType idx = indexedFeature[r.idx];
-            ++nFeatIdx[idx];
-            buf[idx] += aResponse[iSample].val;
-            sumTotal += aResponse[iSample].val;
-        }
-    }
+    DAAL_DISPATCH_BIN_INDEX_TYPE(this->indexedFeatures(),
+                                 sumTotal = sumResponses<typename super::Response, IndexType, BinIndexType, intermSummFPType, algorithmFPType, cpu>(
+                                     n, aIdx, this->_aResponse.get(), this->indexedFeatures().template dataAs<BinIndexType>(iFeature), nFeatIdx,
+                                     buf));
     size_t nLeft             = 0;
     intermSummFPType sumLeft = 0;
     int idxFeatureBestSplit  = -1; //index of best feature value in the array of sorted feature values
@@ -574,9 +568,11 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
                                                                                    Result & res, const Parameter & par)
 {
     ResultData rd(par, res.get(variableImportance).get(), res.get(outOfBagError).get(), res.get(outOfBagErrorPerObservation).get());
+    const dtrees::internal::BinParams binPrm(par.maxBins, par.minBinSize);
     services::Status s = computeImpl<algorithmFPType, cpu, daal::algorithms::decision_forest::regression::internal::ModelImpl,
                                      TrainBatchTask<algorithmFPType, method, cpu> >(
-        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0);
+        pHostApp, x, y, *static_cast<daal::algorithms::decision_forest::regression::internal::ModelImpl *>(&m), rd, par, 0,
+        (method == hist ? &binPrm : nullptr));
     if (s.ok()) res.impl()->setEngine(rd.updatedEngine);
     return s;
 }
@@ -26,6 +26,7 @@
 #include "algorithms/kernel/dtrees/dtrees_model_impl.h"
 #include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
 #include "algorithms/kernel/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "service/kernel/service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -136,6 +137,32 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
                                                                     featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t * treeOffsets, const int * featureIndices, const double * featureValues,
+                                                const size_t * leftChildren, const size_t * rightChildren, const size_t * classLabels)
+{
+    if (nTrees == 0) return Status();
+    gbt::classification::internal::ModelImpl & modelImplRef =
+        daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::classification::internal::ModelImpl, ModelPtr>(_model);
+    DAAL_CHECK(_nClasses == 1 || classLabels, ErrorID::ErrorNullPtr);
+
+    services::internal::TArray<TreeId, sse2> treeIds(nTrees);
+    DAAL_CHECK_MALLOC(treeIds.get());
+    Status s;
+    if (_nClasses == 1)
+    {
+        s = daal::algorithms::dtrees::internal::findEmptyTreeIds(modelImplRef._serializationData, nTrees, nullptr, 1,
+                                                                 modelImplRef._serializationData->size(), treeIds.get());
+    }
+    else
+    {
+        s = daal::algorithms::dtrees::internal::findEmptyTreeIds(modelImplRef._serializationData, nTrees, classLabels, _nClasses, _nIterations,
+                                                                 treeIds.get());
+    }
+    DAAL_CHECK_STATUS_VAR(s);
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, nTrees, treeIds.get(), treeOffsets, featureIndices,
+                                                                featureValues, leftChildren, rightChildren, false);
+}
+
 } // namespace interface1
 } // namespace classification
 } // namespace gbt
@@ -25,6 +25,7 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_classification_predict.h"
 #include "algorithms/kernel/dtrees/gbt/classification/gbt_classification_predict_kernel.h"
+#include "algorithms/kernel/dtrees/gbt/classification/oneapi/gbt_classification_predict_kernel_oneapi.h"
 #include "service/kernel/service_algo_utils.h"
 
 namespace daal
@@ -42,7 +43,17 @@ namespace interface2
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::PredictKernelOneAPI, algorithmFPType, method);
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -54,6 +65,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     Input * input                           = static_cast<Input *>(_in);
     classifier::prediction::Result * result = static_cast<classifier::prediction::Result *>(_res);
 
@@ -70,8 +84,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
                                result->get(classifier::prediction::probabilities).get() :
                                nullptr);
 
-    __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                           daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations, par->earlyExitInterval,
+                           par->earlyExitMargin);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::PredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                                daal::services::internal::hostApp(*input), a, m, r, prob, par->nClasses, par->nIterations);
+    }
 }
 
 } // namespace interface2
@@ -38,6 +38,7 @@
 #include "algorithms/kernel/dtrees/gbt/gbt_predict_dense_default_impl.i"
 #include "algorithms/kernel/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "service/kernel/service_algo_utils.h"
+#include "service/kernel/service_data_utils.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -56,6 +57,99 @@ namespace internal
 {
 using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
 
+//////////////////////////////////////////////////////////////////////////////////////////
+// EarlyExit
+// Bounds of the contributions of the remaining iterations to the raw boosted values of every class.
+// The evaluation of a row stops when the bounds show that its predicted class can no longer change,
+// or when the raw boosted value of the predicted class exceeds the others by more than the margin
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class EarlyExit
+{
+public:
+    typedef gbt::internal::GbtDecisionTree TreeType;
+    EarlyExit(size_t interval, double margin) : _interval(interval), _margin(margin), _nGroups(0) {}
+
+    bool isEnabled() const { return _interval > 0; }
+    size_t getInterval() const { return _interval; }
+
+    /* The trees are ordered by iterations, every iteration has one tree per group, i.e. per class or one tree for two classes */
+    services::Status init(const TreeType * const * aTree, size_t nTrees, size_t nGroups)
+    {
+        if (!isEnabled()) return services::Status();
+        const size_t nIterations = nTrees / nGroups;
+        _nGroups                 = nGroups;
+        _lower.reset((nIterations + 1) * nGroups);
+        _upper.reset((nIterations + 1) * nGroups);
+        DAAL_CHECK_MALLOC(_lower.get() && _upper.get());
+        algorithmFPType * const lower = _lower.get();
+        algorithmFPType * const upper = _upper.get();
+        for (size_t g = 0; g < nGroups; ++g) lower[nIterations * nGroups + g] = upper[nIterations * nGroups + g] = 0;
+
+        for (size_t it = nIterations; it-- > 0;)
+        {
+            for (size_t g = 0; g < nGroups; ++g)
+            {
+                /* The leaves of the complete tree of maxLvl levels are stored at its last level */
+                const TreeType & t                                    = *aTree[it * nGroups + g];
+                const size_t nLeaves                                  = size_t(1) << t.getMaxLvl();
+                const gbt::prediction::internal::ModelFPType * leaves = t.getSplitPoints() + nLeaves - 1;
+                algorithmFPType minVal                                = leaves[0];
+                algorithmFPType maxVal                                = leaves[0];
+                for (size_t i = 1; i < nLeaves; ++i)
+                {
+                    const algorithmFPType v = leaves[i];
+                    minVal                  = services::internal::min<cpu, algorithmFPType>(minVal, v);
+                    maxVal                  = services::internal::max<cpu, algorithmFPType>(maxVal, v);
+                }
+                lower[it * nGroups + g] = lower[(it + 1) * nGroups + g] + minVal;
+                upper[it * nGroups + g] = upper[(it + 1) * nGroups + g] + maxVal;
+            }
+        }
+        return services::Status();
+    }
+
+    /* Checks the raw boosted values of nRows rows of two classes after nIterationsDone iterations */
+    bool isSettledBinary(const algorithmFPType * f, size_t nRows, size_t nIterationsDone) const
+    {
+        const algorithmFPType lower = _lower[nIterationsDone];
+        const algorithmFPType upper = _upper[nIterationsDone];
+        size_t nSettled             = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const algorithmFPType absF = f[i] < 0 ? -f[i] : f[i];
+            nSettled += ((f[i] + lower >= 0) || (f[i] + upper < 0) || (_margin > 0 && absF > _margin));
+        }
+        return nSettled == nRows;
+    }
+
+    /* Checks the raw boosted values of nClasses classes of one row after nIterationsDone iterations */
+    bool isSettled(const algorithmFPType * val, size_t nClasses, size_t nIterationsDone) const
+    {
+        const algorithmFPType * const lower = _lower.get() + nIterationsDone * _nGroups;
+        const algorithmFPType * const upper = _upper.get() + nIterationsDone * _nGroups;
+        const size_t best                   = services::internal::getMaxElementIndex<algorithmFPType, cpu>(val, nClasses);
+        bool bExact                         = true;
+        algorithmFPType second              = -services::internal::MaxVal<algorithmFPType>::get();
+        for (size_t c = 0; c < nClasses; ++c)
+        {
+            if (c == best) continue;
+            bExact = bExact && (val[best] + lower[best] > val[c] + upper[c]);
+            second = services::internal::max<cpu, algorithmFPType>(second, val[c]);
+        }
+        return bExact || (_margin > 0 && val[best] - second > _margin);
+    }
+
+protected:
+    size_t _interval;
+    algorithmFPType _margin;
+    size_t _nGroups;
+    TArray<algorithmFPType, cpu> _lower;
+    TArray<algorithmFPType, cpu> _upper;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictBinaryClassificationTask
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -64,7 +158,9 @@ class PredictBinaryClassificationTask : public gbt::regression::prediction::inte
 {
 public:
     typedef gbt::regression::prediction::internal::PredictRegressionTask<algorithmFPType, cpu> super;
-    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : super(x, y), _prob(prob) {}
+    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, size_t earlyExitInterval, double earlyExitMargin)
+        : super(x, y), _prob(prob), _earlyExit(earlyExitInterval, earlyExitMargin)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp)
     {
         DAAL_ASSERT(!nIterations || nIterations <= m->size());
@@ -72,7 +168,9 @@ public:
         const auto nTreesTotal = (nIterations ? nIterations : m->size());
         this->_aTree.reset(nTreesTotal);
         DAAL_CHECK_MALLOC(this->_aTree.get());
+        DAAL_CHECK_STATUS_VAR(m->loadTrees(nTreesTotal));
         for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+        DAAL_CHECK_STATUS_VAR(_earlyExit.init(this->_aTree.get(), nTreesTotal, 1));
         const auto nRows = this->_data->getNumberOfRows();
         services::Status s;
         DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, sizeof(algorithmFPType));
@@ -89,7 +187,7 @@ public:
             TArray<algorithmFPType, cpu> expValPtr(nRows);
             algorithmFPType * expVal = expValPtr.get();
             DAAL_CHECK_MALLOC(expVal);
-            s = super::runInternal(pHostApp, this->_res);
+            s = runRawBoostedValues(pHostApp, this->_res);
             if (!s) return s;
 
             auto nBlocks           = daal::threader_get_threads_number();
@@ -121,7 +219,7 @@ public:
             algorithmFPType * expVal = expValPtr.get();
             NumericTablePtr expNT    = HomogenNumericTableCPU<algorithmFPType, cpu>::create(expVal, 1, nRows, &s);
             DAAL_CHECK_MALLOC(expVal);
-            s = super::runInternal(pHostApp, expNT.get());
+            s = runRawBoostedValues(pHostApp, expNT.get());
             if (!s) return s;
 
             auto nBlocks           = daal::threader_get_threads_number();
@@ -144,7 +242,7 @@ public:
             DAAL_CHECK_BLOCK_STATUS(resBD);
             const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
             algorithmFPType * res          = resBD.get();
-            s                              = super::runInternal(pHostApp, this->_res);
+            s                              = runRawBoostedValues(pHostApp, this->_res);
             if (!s) return s;
 
             for (size_t iRow = 0; iRow < nRows; ++iRow)
@@ -156,8 +254,60 @@ public:
         return s;
     }
 
+protected:
+    services::Status runRawBoostedValues(services::HostAppIface * pHostApp, NumericTable * result)
+    {
+        return _earlyExit.isEnabled() ? runWithEarlyExit(pHostApp, result) : super::runInternal(pHostApp, result);
+    }
+
+    /* Computes the raw boosted values by the chunks of earlyExitInterval trees, the rows of a vector block are checked after every chunk */
+    services::Status runWithEarlyExit(services::HostAppIface * pHostApp, NumericTable * result)
+    {
+        const size_t nTreesTotal = this->_aTree.size();
+        const size_t nChunk      = _earlyExit.getInterval();
+
+        gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTreesTotal);
+        WriteOnlyRows<algorithmFPType, cpu> resBD(result, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(resBD);
+        services::internal::service_memset<algorithmFPType, cpu>(resBD.get(), 0, dim.nRowsTotal);
+        services::Status s;
+        HostAppHelper host(pHostApp, 100);
+        if (host.isCancelled(s, 1)) return s;
+
+        SafeStatus safeStat;
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+            algorithmFPType * res = resBD.get() + iStartRow;
+
+            size_t iRow;
+            for (iRow = 0; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
+            {
+                for (size_t iTree = 0; iTree < nTreesTotal; iTree += nChunk)
+                {
+                    const size_t nTreesToUse = (iTree + nChunk < nTreesTotal ? nChunk : nTreesTotal - iTree);
+                    this->predictByTreesVector(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols, res + iRow);
+                    if (_earlyExit.isSettledBinary(res + iRow, VECTOR_BLOCK_SIZE, iTree + nTreesToUse)) break;
+                }
+            }
+            for (; iRow < nRowsToProcess; ++iRow)
+            {
+                for (size_t iTree = 0; iTree < nTreesTotal; iTree += nChunk)
+                {
+                    const size_t nTreesToUse = (iTree + nChunk < nTreesTotal ? nChunk : nTreesTotal - iTree);
+                    res[iRow] += this->predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
+                    if (_earlyExit.isSettledBinary(res + iRow, 1, iTree + nTreesToUse)) break;
+                }
+            }
+        });
+        return safeStat.detach();
+    }
+
 protected:
     NumericTable * _prob;
+    EarlyExit<algorithmFPType, cpu> _earlyExit;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -172,7 +322,9 @@ public:
     typedef daal::tls<algorithmFPType *> ClassesRawBoostedTlsBase;
     typedef daal::TlsMem<algorithmFPType, cpu> ClassesRawBoostedTls;
 
-    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob) : _data(x), _res(y), _prob(prob) {}
+    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, size_t earlyExitInterval, double earlyExitMargin)
+        : _data(x), _res(y), _prob(prob), _earlyExit(earlyExitInterval, earlyExitMargin)
+    {}
     services::Status run(const gbt::classification::internal::ModelImpl * m, size_t nClasses, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
@@ -180,6 +332,8 @@ protected:
 
     void predictByTrees(algorithmFPType * res, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
     void predictByTreesVector(algorithmFPType * val, size_t iFirstTree, size_t nTrees, size_t nClasses, const algorithmFPType * x);
+    void predictByAllTreesWithEarlyExit(algorithmFPType * val, size_t nTreesTotal, size_t nClasses, const algorithmFPType * x);
+    void predictByAllTreesVectorWithEarlyExit(algorithmFPType * val, size_t nTreesTotal, size_t nClasses, const algorithmFPType * x);
     void softmax(algorithmFPType * Input, algorithmFPType * Output, size_t nRows, size_t nCols);
 
     size_t getMaxClass(const algorithmFPType * val, size_t nClasses) const
@@ -193,6 +347,7 @@ protected:
     NumericTable * _prob;
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const TreeType *, cpu> _aTree;
+    EarlyExit<algorithmFPType, cpu> _earlyExit;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -201,16 +356,17 @@ protected:
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
-                                                                      size_t nClasses, size_t nIterations)
+                                                                      size_t nClasses, size_t nIterations, size_t earlyExitInterval,
+                                                                      double earlyExitMargin)
 {
     const daal::algorithms::gbt::classification::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::classification::internal::ModelImpl *>(m);
     if (nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, r, prob, earlyExitInterval, earlyExitMargin);
         return task.run(pModel, nIterations, pHostApp);
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, r, prob, earlyExitInterval, earlyExitMargin);
     return task.run(pModel, nClasses, nIterations, pHostApp);
 }
 
@@ -223,7 +379,9 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const gbt::cla
     DAAL_CHECK_MALLOC(this->_featHelper.init(*this->_data));
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
+    DAAL_CHECK_STATUS_VAR(m->loadTrees(nTreesTotal));
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
+    DAAL_CHECK_STATUS_VAR(_earlyExit.init(this->_aTree.get(), nTreesTotal, nClasses));
 
     DimType dim(*_data, nTreesTotal);
 
@@ -256,6 +414,40 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictByTreesVector(algorithm
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTreesWithEarlyExit(algorithmFPType * val, size_t nTreesTotal, size_t nClasses,
+                                                                                 const algorithmFPType * x)
+{
+    if (!_earlyExit.isEnabled()) return predictByTrees(val, 0, nTreesTotal, nClasses, x);
+
+    /* The chunks consist of the whole iterations, i.e. of nClasses trees each */
+    const size_t nChunk = _earlyExit.getInterval() * nClasses;
+    for (size_t iTree = 0; iTree < nTreesTotal; iTree += nChunk)
+    {
+        const size_t nTreesToUse = (iTree + nChunk < nTreesTotal ? nChunk : nTreesTotal - iTree);
+        predictByTrees(val, iTree, nTreesToUse, nClasses, x);
+        if (_earlyExit.isSettled(val, nClasses, (iTree + nTreesToUse) / nClasses)) break;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTreesVectorWithEarlyExit(algorithmFPType * val, size_t nTreesTotal, size_t nClasses,
+                                                                                       const algorithmFPType * x)
+{
+    if (!_earlyExit.isEnabled()) return predictByTreesVector(val, 0, nTreesTotal, nClasses, x);
+
+    const size_t nChunk = _earlyExit.getInterval() * nClasses;
+    for (size_t iTree = 0; iTree < nTreesTotal; iTree += nChunk)
+    {
+        const size_t nTreesToUse = (iTree + nChunk < nTreesTotal ? nChunk : nTreesTotal - iTree);
+        predictByTreesVector(val, iTree, nTreesToUse, nClasses, x);
+        const size_t nIterationsDone = (iTree + nTreesToUse) / nClasses;
+        bool bSettled                = true;
+        for (size_t i = 0; bSettled && i < VECTOR_BLOCK_SIZE; ++i) bSettled = _earlyExit.isSettled(val + i * nClasses, nClasses, nIterationsDone);
+        if (bSettled) break;
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(size_t nTreesTotal, size_t nClasses, const DimType & dim)
 {
@@ -288,7 +480,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 val = valL + iRow * nClasses;
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                predictByAllTreesVectorWithEarlyExit(val, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
                 if (res)
                 {
                     for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
@@ -300,7 +492,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow < nRowsToProcess; ++iRow)
             {
                 val = valL + iRow * nClasses;
-                predictByTrees(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                predictByAllTreesWithEarlyExit(val, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
                 if (res)
                 {
                     res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
@@ -327,7 +519,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow + VECTOR_BLOCK_SIZE <= nRowsToProcess; iRow += VECTOR_BLOCK_SIZE)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses * VECTOR_BLOCK_SIZE);
-                predictByTreesVector(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                predictByAllTreesVectorWithEarlyExit(val, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
 
                 for (size_t i = 0; i < gbt::prediction::internal::VECTOR_BLOCK_SIZE; ++i)
                 {
@@ -337,7 +529,7 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictByAllTrees(
             for (; iRow < nRowsToProcess; ++iRow)
             {
                 services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), nClasses);
-                predictByTrees(val, 0, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
+                predictByAllTreesWithEarlyExit(val, nTreesTotal, nClasses, xBD.get() + iRow * nCols);
                 res[iRow] = algorithmFPType(getMaxClass(val, nClasses));
             }
         });
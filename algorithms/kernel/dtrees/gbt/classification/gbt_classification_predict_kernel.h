@@ -56,9 +56,11 @@ public:
      *  \param r[out]   Prediction results
      *  \param nClasses[in]     Number of classes in gradient boosted trees algorithm parameter
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param earlyExitInterval[in]  Number of iterations between the checks of the early exit, 0 disables the early exit
+     *  \param earlyExitMargin[in]    Margin of the raw boosted values that stops the evaluation of a row, 0 if not used
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
-                             NumericTable * prob, size_t nClasses, size_t nIterations);
+                             NumericTable * prob, size_t nClasses, size_t nIterations, size_t earlyExitInterval = 0, double earlyExitMargin = 0);
 };
 
 } // namespace internal
@@ -110,6 +110,7 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
         {
             nClasses    = pPrm2->nClasses;
             nIterations = pPrm2->nIterations;
+            DAAL_CHECK_EX(pPrm2->earlyExitMargin >= 0, ErrorIncorrectParameter, ParameterName, earlyExitMarginStr());
         }
         else
             return services::ErrorNullParameterNotSupported;
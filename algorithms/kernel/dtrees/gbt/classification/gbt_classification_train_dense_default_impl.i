@@ -256,6 +256,14 @@ protected:
                                         HomogenNumericTable<int> ** aTblSmplCnt,
                                         GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF) DAAL_C11_OVERRIDE
     {
+        if (this->_nTrees > 1 && GH_SUMS_BUF.newFI) //all the trees of the iteration are grown by rows from the same root sample
+        {
+            services::Status s = hist::computeRootGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>(
+                GH_SUMS_BUF, (const algorithmFPType *)this->grad(0), this->_data->getNumberOfRows(), this->_nTrees, this->aSampleToF(),
+                this->nSamples());
+            if (!s) GH_SUMS_BUF.nRootGHSums = 0; //not enough memory, the roots are computed one by one
+        }
+
         if (this->isParallelTrees())
         {
             this->_nParallelNodes.set(this->_nTrees); //highest level parallelization first
@@ -325,6 +333,11 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     tmpPar.maxBins                     = par.maxBins;
     tmpPar.minBinSize                  = par.minBinSize;
     tmpPar.internalOptions             = par.internalOptions;
+    tmpPar.growthPolicy                = par.growthPolicy;
+    tmpPar.maxLeaves                   = par.maxLeaves;
+    tmpPar.samplingMethod              = par.samplingMethod;
+    tmpPar.gossTopFraction             = par.gossTopFraction;
+    tmpPar.gossOtherFraction           = par.gossOtherFraction;
     tmpPar.loss                        = par.loss;
     return compute(pHost, x, y, m, res, tmpPar, engine);
 }
@@ -332,7 +345,8 @@ template <typename algorithmFPType, gbt::classification::training::Method method
 services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHost, const NumericTable * x,
                                                                                        const NumericTable * y, gbt::classification::Model & m,
                                                                                        Result & res, const Parameter & par,
-                                                                                       engines::internal::BatchBaseImpl & engine)
+                                                                                       engines::internal::BatchBaseImpl & engine,
+                                                                                       const gbt::classification::Model * initialModel)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
@@ -384,25 +398,29 @@ services::Status ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::c
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
+    typedef daal::algorithms::gbt::classification::internal::ModelImpl ModelImplType;
+    ModelImplType & mImpl                             = *static_cast<ModelImplType *>(&m);
+    const gbt::internal::ModelImpl * initialModelImpl = initialModel ? static_cast<const ModelImplType *>(initialModel) : nullptr;
+
     if (inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, mImpl, initialModelImpl, par, engine, par.nClasses, indexedFeatures,
+                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, mImpl, initialModelImpl, par, engine, par.nClasses, indexedFeatures,
+                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses,
-                indexedFeatures, featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
+                pHost, x, y, mImpl, initialModelImpl, par, engine, par.nClasses, indexedFeatures,
+                featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHost, x, y, *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m), par, engine, par.nClasses, indexedFeatures,
+            pHost, x, y, mImpl, initialModelImpl, par, engine, par.nClasses, indexedFeatures,
             featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
@@ -53,7 +53,8 @@ public:
                              const interface1::Parameter & par,
                              engines::internal::BatchBaseImpl & engine); // remove this function when interface1::Parameter becomes deprecated
     services::Status compute(HostAppIface * pHost, const NumericTable * x, const NumericTable * y, gbt::classification::Model & m, Result & res,
-                             const interface2::Parameter & par, engines::internal::BatchBaseImpl & engine);
+                             const interface2::Parameter & par, engines::internal::BatchBaseImpl & engine,
+                             const gbt::classification::Model * initialModel = nullptr);
 };
 
 } // namespace internal
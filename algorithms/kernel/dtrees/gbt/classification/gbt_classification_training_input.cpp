@@ -0,0 +1,93 @@
+/* file: gbt_classification_training_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees algorithm classes.
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace interface1
+{
+/** Default constructor */
+Input::Input() : classifier::training::Input(lastModelInputId + 1) {}
+
+/**
+ * Returns an input model for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input model
+ * \return          %Input model that corresponds to the given identifier
+ */
+gbt::classification::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::classification::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input model for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input model
+ * \param[in] value   Pointer to the model
+ */
+void Input::set(ModelInputId id, const gbt::classification::ModelPtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+* Checks an input object for the gradient boosted trees algorithm
+* \param[in] par     Algorithm parameter
+* \param[in] method  Computation method
+*/
+Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::training::Input::check(par, method));
+
+    const gbt::classification::ModelPtr initialModel = get(inputModel);
+    if (!initialModel.get() || !initialModel->getNumberOfTrees()) return s;
+
+    const size_t nFeatures = get(classifier::training::data)->getNumberOfColumns();
+    DAAL_CHECK_EX(initialModel->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
+
+    /* The trees of one boosting iteration are built for every class, or one tree for the binary classification */
+    const size_t nClasses           = static_cast<const classifier::Parameter *>(par)->nClasses;
+    const size_t nTreesPerIteration = nClasses > 2 ? nClasses : 1;
+    DAAL_CHECK_EX(initialModel->getNumberOfTrees() % nTreesPerIteration == 0, ErrorIncorrectSizeOfModel, ArgumentName, inputModelStr());
+    return s;
+}
+
+} // namespace interface1
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
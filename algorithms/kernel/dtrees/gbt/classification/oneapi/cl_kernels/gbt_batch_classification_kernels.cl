@@ -0,0 +1,66 @@
+/* file: gbt_batch_classification_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification OpenCL kernels
+//  computing the gradients and hessians of the loss function.
+//--
+*/
+
+#ifndef __GBT_BATCH_CLASSIFICATION_KERNELS_CL__
+#define __GBT_BATCH_CLASSIFICATION_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    gbt_batch_classification_kernels,
+
+    /* Logistic loss, the labels are 0 and 1 */
+    __kernel void computeOptCoeffsLogistic(const __global algorithmFPType * labels, const __global algorithmFPType * response,
+                                           __global algorithmFPType * optCoeffs) {
+        const int id               = get_global_id(0);
+        const algorithmFPType sigm = (algorithmFPType)1 / ((algorithmFPType)1 + exp(-response[id]));
+        optCoeffs[2 * id + 0]      = sigm - labels[id];
+        optCoeffs[2 * id + 1]      = sigm * ((algorithmFPType)1 - sigm);
+    }
+
+    /* Cross entropy loss for the class classIdx, response[k * nRows + i] is the response of the class k for the row i */
+    __kernel void computeOptCoeffsSoftmax(const __global algorithmFPType * labels, const __global algorithmFPType * response,
+                                          __global algorithmFPType * optCoeffs, int nRows, int nClasses, int classIdx) {
+        const int id = get_global_id(0);
+
+        algorithmFPType maxResponse = response[id];
+        for (int k = 1; k < nClasses; k++)
+        {
+            maxResponse = fmax(maxResponse, response[k * nRows + id]);
+        }
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (int k = 0; k < nClasses; k++)
+        {
+            sum += exp(response[k * nRows + id] - maxResponse);
+        }
+
+        const algorithmFPType p = exp(response[classIdx * nRows + id] - maxResponse) / sum;
+        optCoeffs[2 * id + 0]   = ((int)labels[id] == classIdx) ? p - (algorithmFPType)1 : p;
+        optCoeffs[2 * id + 1]   = (algorithmFPType)2 * p * ((algorithmFPType)1 - p);
+    }
+
+);
+
+#endif
@@ -0,0 +1,80 @@
+/* file: gbt_classification_predict_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification prediction on GPU.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __GBT_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/gbt/classification/oneapi/gbt_classification_predict_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "algorithms/kernel/dtrees/oneapi/dtrees_predict_dense_default_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services;
+
+template <typename algorithmFPType, gbt::classification::prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::compute(services::HostAppIface * pHostApp, const NumericTable * a,
+                                                                       const classification::Model * m, NumericTable * r, NumericTable * prob,
+                                                                       size_t nClasses, size_t nIterations)
+{
+    typedef dtrees::prediction::internal::TreeEnsemblePredictOneAPI<algorithmFPType> Predictor;
+
+    const gbt::classification::internal::ModelImpl * const pModel = static_cast<const gbt::classification::internal::ModelImpl *>(m);
+
+    /* Multiclass model contains nClasses trees per iteration */
+    const bool isBinary = (nClasses == 2);
+    const size_t nTrees = nIterations ? (isBinary ? nIterations : nIterations * nClasses) : pModel->size();
+    DAAL_CHECK(nTrees <= pModel->size(), ErrorGbtPredictIncorrectNumberOfIterations);
+
+    services::Collection<const gbt::internal::GbtDecisionTree *> trees(nTrees);
+    DAAL_CHECK_MALLOC(trees.size() == nTrees);
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        trees[i] = pModel->at(i);
+    }
+
+    Predictor predictor;
+    services::Status status = predictor.initFromGbtTrees(trees.data(), nTrees);
+    DAAL_CHECK_STATUS_VAR(status);
+    return predictor.predict(*a, Predictor::treeResponse, isBinary ? 1 : nClasses, isBinary ? Predictor::sigmoid : Predictor::softmax,
+                             algorithmFPType(1), r, prob);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
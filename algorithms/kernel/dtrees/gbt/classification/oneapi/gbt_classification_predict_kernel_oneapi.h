@@ -0,0 +1,64 @@
+/* file: gbt_classification_predict_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that computes gradient boosted trees classification prediction results on GPU.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_KERNEL_ONEAPI_H__
+#define __GBT_CLASSIFICATION_PREDICT_KERNEL_ONEAPI_H__
+
+#include "algorithms/gradient_boosted_trees/gbt_classification_predict.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+/**
+ * Computes the class labels and probabilities on GPU. Binary classification applies the sigmoid to the sum of the responses
+ * of the trees, multiclass classification applies the softmax to the per-class sums
+ */
+template <typename algorithmFPType, gbt::classification::prediction::Method method>
+class PredictKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const classification::Model * m, NumericTable * r,
+                             NumericTable * prob, size_t nClasses, size_t nIterations);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,244 @@
+/* file: gbt_classification_train_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions for gradient boosted trees classification
+//  (defaultDense) method.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_DENSE_DEFAULT_ONEAPI_IMPL_I__
+#define __GBT_CLASSIFICATION_TRAIN_DENSE_DEFAULT_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/gbt/classification/oneapi/cl_kernels/gbt_batch_classification_kernels.cl"
+
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_tree_builder_oneapi.i"
+#include "algorithms/kernel/dtrees/gbt/classification/gbt_classification_model_impl.h"
+#include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
+
+#include "externals/service_ittnotify.h"
+#include "services/buffer.h"
+#include "data_management/data/numeric_table.h"
+#include "services/env_detect.h"
+#include "services/error_indexes.h"
+#include "service/kernel/service_algo_utils.h"
+#include "oneapi/internal/types.h"
+
+using namespace daal::algorithms::dtrees::training::internal;
+using namespace daal::algorithms::gbt::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType>
+static void __buildProgram(ClKernelFactoryIface & factory)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+    {
+        auto fptype_name   = getKeyFPType<algorithmFPType>();
+        auto build_options = fptype_name;
+        build_options.add("-cl-std=CL1.2");
+
+        services::String cachekey("__daal_algorithms_gbt_batch_classification_");
+        cachekey.add(fptype_name);
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), gbt_batch_classification_kernels, build_options.c_str());
+    }
+}
+
+template <typename algorithmFPType, gbt::classification::training::Method method>
+services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, method>::computeOptCoeffsLogistic(NumericTable & y,
+                                                                                                       UniversalBuffer & response,
+                                                                                                       UniversalBuffer & optCoeffs)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeOptCoeffsLogistic);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeOptCoeffsLogistic;
+
+    const size_t nRows = y.getNumberOfRows();
+
+    BlockDescriptor<algorithmFPType> yBlock;
+    DAAL_CHECK_STATUS(status, y.getBlockOfRows(0, nRows, readOnly, yBlock));
+    auto yBuffer = yBlock.getBuffer();
+
+    {
+        KernelArguments args(3);
+        args.set(0, yBuffer, AccessModeIds::read);
+        args.set(1, response, AccessModeIds::read);
+        args.set(2, optCoeffs, AccessModeIds::write);
+
+        KernelRange global_range(nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    DAAL_CHECK_STATUS(status, y.releaseBlockOfRows(yBlock));
+
+    return status;
+}
+
+template <typename algorithmFPType, gbt::classification::training::Method method>
+services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, method>::computeOptCoeffsSoftmax(NumericTable & y, UniversalBuffer & response,
+                                                                                                      UniversalBuffer & optCoeffs, size_t nClasses,
+                                                                                                      size_t classIdx)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeOptCoeffsSoftmax);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeOptCoeffsSoftmax;
+
+    const size_t nRows = y.getNumberOfRows();
+
+    BlockDescriptor<algorithmFPType> yBlock;
+    DAAL_CHECK_STATUS(status, y.getBlockOfRows(0, nRows, readOnly, yBlock));
+    auto yBuffer = yBlock.getBuffer();
+
+    {
+        KernelArguments args(6);
+        args.set(0, yBuffer, AccessModeIds::read);
+        args.set(1, response, AccessModeIds::read);
+        args.set(2, optCoeffs, AccessModeIds::write);
+        args.set(3, static_cast<int32_t>(nRows));
+        args.set(4, static_cast<int32_t>(nClasses));
+        args.set(5, static_cast<int32_t>(classIdx));
+
+        KernelRange global_range(nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    DAAL_CHECK_STATUS(status, y.releaseBlockOfRows(yBlock));
+
+    return status;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// ClassificationTrainBatchKernelOneAPI
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, gbt::classification::training::Method method>
+services::Status ClassificationTrainBatchKernelOneAPI<algorithmFPType, method>::compute(HostAppIface * pHost, const NumericTable * x,
+                                                                                       const NumericTable * y, gbt::classification::Model & m,
+                                                                                       Result & res, const Parameter & par,
+                                                                                       engines::internal::BatchBaseImpl & engine)
+{
+    const size_t nRows            = x->getNumberOfRows();
+    const size_t nFeatures        = x->getNumberOfColumns();
+    const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : nFeatures;
+    const bool inexactWithHistMethod =
+        !par.memorySavingMode && par.splitMethod == gbt::training::inexact && x->getNumberOfColumns() == nFeaturesPerNode;
+
+    DAAL_ASSERT(inexactWithHistMethod);
+    DAAL_CHECK(par.loss == crossEntropy, ErrorMethodNotImplemented);
+
+    /* One tree per iteration is enough for two classes, its response is the logit of the class 1 */
+    const size_t nClasses = par.nClasses;
+    const size_t nTrees   = (nClasses == 2) ? 1 : nClasses;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, par.maxIterations, nTrees);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nTrees);
+
+    gbt::internal::ModelImpl & modelImpl = *static_cast<daal::algorithms::gbt::classification::internal::ModelImpl *>(&m);
+    DAAL_CHECK_MALLOC(modelImpl.reserve(par.maxIterations * nTrees));
+
+    services::Status status;
+
+    auto & context        = Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    __buildProgram<algorithmFPType>(kernel_factory);
+
+    kernelComputeOptCoeffsLogistic = kernel_factory.getKernel("computeOptCoeffsLogistic", &status);
+    kernelComputeOptCoeffsSoftmax  = kernel_factory.getKernel("computeOptCoeffsSoftmax", &status);
+
+    DAAL_CHECK_STATUS_VAR(status);
+
+    gbt::internal::IndexedFeaturesOneAPI<algorithmFPType> indexedFeatures;
+    dtrees::internal::FeatureTypes featTypes;
+    DAAL_CHECK_MALLOC(featTypes.init(*x));
+
+    BinParams prm(par.maxBins, par.minBinSize);
+    DAAL_CHECK_STATUS(status, (indexedFeatures.init(*const_cast<NumericTable *>(x), &featTypes, &prm)));
+
+    gbt::training::internal::TreeBuilderOneAPI<algorithmFPType> treeBuilder;
+    DAAL_CHECK_STATUS(status, treeBuilder.init(indexedFeatures, nRows, par));
+
+    /* response[k * nRows + i] is the response of the tree k for the row i, the initial response is zero as on CPU */
+    auto response = context.allocate(TypeIds::id<algorithmFPType>(), nRows * nTrees, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    context.fill(response, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* The gradients of all the classes are computed before the trees of the iteration change the response */
+    services::Collection<UniversalBuffer> optCoeffs;
+    for (size_t k = 0; k < nTrees; k++)
+    {
+        DAAL_CHECK_MALLOC(optCoeffs.safe_push_back(context.allocate(TypeIds::id<algorithmFPType>(), nRows * 2, &status)));
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    NumericTable & yTable = *const_cast<NumericTable *>(y);
+
+    for (size_t iter = 0; (iter < par.maxIterations) && !algorithms::internal::isCancelled(status, pHost); ++iter)
+    {
+        if (nTrees == 1)
+        {
+            DAAL_CHECK_STATUS(status, computeOptCoeffsLogistic(yTable, response, optCoeffs[0]));
+        }
+        else
+        {
+            for (size_t k = 0; k < nTrees; k++)
+            {
+                DAAL_CHECK_STATUS(status, computeOptCoeffsSoftmax(yTable, response, optCoeffs[k], nClasses, k));
+            }
+        }
+
+        for (size_t k = 0; k < nTrees; k++)
+        {
+            DAAL_CHECK_STATUS(status, treeBuilder.buildTree(optCoeffs[k], response, k * nRows, 0.0, modelImpl));
+        }
+    }
+
+    return status;
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace classification */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
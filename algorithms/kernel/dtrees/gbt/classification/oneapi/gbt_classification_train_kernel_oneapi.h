@@ -0,0 +1,83 @@
+/* file: gbt_classification_train_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for gradient boosted trees
+//  classification training for GPU.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_KERNEL_ONEAPI_H__
+#define __GBT_CLASSIFICATION_TRAIN_KERNEL_ONEAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/algorithm_base_common.h"
+#include "algorithms/gradient_boosted_trees/gbt_classification_training_types.h"
+#include "algorithms/kernel/engines/engine_batch_impl.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_tree_builder_oneapi.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Trains the model on GPU. One tree per iteration is built for two classes with the logistic loss,
+ * nClasses trees per iteration are built otherwise with the cross entropy loss.
+ */
+template <typename algorithmFPType, Method method>
+class ClassificationTrainBatchKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(HostAppIface * pHost, const NumericTable * x, const NumericTable * y, gbt::classification::Model & m, Result & res,
+                             const Parameter & par, engines::internal::BatchBaseImpl & engine);
+
+private:
+    /* Computes the gradients and hessians of the logistic loss */
+    services::Status computeOptCoeffsLogistic(NumericTable & y, oneapi::internal::UniversalBuffer & response,
+                                              oneapi::internal::UniversalBuffer & optCoeffs);
+
+    /* Computes the gradients and hessians of the cross entropy loss for the class classIdx */
+    services::Status computeOptCoeffsSoftmax(NumericTable & y, oneapi::internal::UniversalBuffer & response,
+                                             oneapi::internal::UniversalBuffer & optCoeffs, size_t nClasses, size_t classIdx);
+
+    oneapi::internal::KernelPtr kernelComputeOptCoeffsLogistic;
+    oneapi::internal::KernelPtr kernelComputeOptCoeffsSoftmax;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -24,6 +24,7 @@
 #include "services/daal_defines.h"
 #include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
 #include "algorithms/kernel/dtrees/dtrees_model_impl_common.h"
+#include "algorithms/kernel/service_error_handling.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -67,7 +68,7 @@ void ModelImpl::traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor
     const gbt::prediction::internal::FeatureIndexType * splitFeatures = gbtTree.getFeatureIndexesForSplit();
 
     auto onSplitNodeFunc = [&splitPoints, &splitFeatures, &visitor](size_t iRowInTable, size_t level) -> bool {
-        return visitor.onSplitNode(level, splitFeatures[iRowInTable], splitPoints[iRowInTable]);
+        return visitor.onSplitNode(level, gbt::prediction::internal::getSplitFeature(splitFeatures[iRowInTable]), splitPoints[iRowInTable]);
     };
 
     auto onLeafNodeFunc = [&splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -87,7 +88,7 @@ void ModelImpl::traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor
     const gbt::prediction::internal::FeatureIndexType * splitFeatures = gbtTree.getFeatureIndexesForSplit();
 
     auto onSplitNodeFunc = [&splitFeatures, &splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
-        return visitor.onSplitNode(level, splitFeatures[iRowInTable], splitPoints[iRowInTable]);
+        return visitor.onSplitNode(level, gbt::prediction::internal::getSplitFeature(splitFeatures[iRowInTable]), splitPoints[iRowInTable]);
     };
 
     auto onLeafNodeFunc = [&splitPoints, &visitor](size_t iRowInTable, size_t level) -> bool {
@@ -117,7 +118,7 @@ void ModelImpl::traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisito
         tree_utils::SplitNodeDescriptor descSplit;
         descSplit.impurity         = imp[iRowInTable];
         descSplit.nNodeSampleCount = (size_t)(nodeSamplesCount[iRowInTable]);
-        descSplit.featureIndex     = splitFeatures[iRowInTable];
+        descSplit.featureIndex     = gbt::prediction::internal::getSplitFeature(splitFeatures[iRowInTable]);
         descSplit.featureValue     = splitPoints[iRowInTable];
         descSplit.level            = level;
         return visitor.onSplitNode(descSplit);
@@ -156,7 +157,7 @@ void ModelImpl::traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisito
         tree_utils::SplitNodeDescriptor descSplit;
         descSplit.impurity         = imp[iRowInTable];
         descSplit.nNodeSampleCount = (size_t)(nodeSamplesCount[iRowInTable]);
-        descSplit.featureIndex     = splitFeatures[iRowInTable];
+        descSplit.featureIndex     = gbt::prediction::internal::getSplitFeature(splitFeatures[iRowInTable]);
         descSplit.featureValue     = splitPoints[iRowInTable];
         descSplit.level            = level;
         return visitor.onSplitNode(descSplit);
@@ -194,6 +195,35 @@ void ModelImpl::add(gbt::internal::GbtDecisionTree * pTbl, HomogenNumericTable<d
     _nNodeSampleTables->push_back(SerializationIfacePtr(pTblSmplCnt));
 }
 
+bool ModelImpl::append(const ModelImpl & other)
+{
+    const size_t nOther = other.size();
+    for (size_t i = 0; i < nOther; ++i)
+    {
+        const GbtDecisionTree * tree = other.at(i);
+        DAAL_ASSERT(tree);
+        const size_t nNodes = tree->getNumberOfNodes();
+
+        /* The models created by the model builder have no impurities and numbers of samples of the nodes */
+        SerializationIfacePtr imp, smplCnt;
+        if (other._impurityTables.get())
+            imp = (*other._impurityTables)[i];
+        else
+            imp.reset(new HomogenNumericTable<double>(1, nNodes, NumericTable::doAllocate, 0.0));
+        if (other._nNodeSampleTables.get())
+            smplCnt = (*other._nNodeSampleTables)[i];
+        else
+            smplCnt.reset(new HomogenNumericTable<int>(1, nNodes, NumericTable::doAllocate, 0));
+        if (!imp.get() || !smplCnt.get()) return false;
+
+        _serializationData->push_back((*other._serializationData)[i]);
+        _impurityTables->push_back(imp);
+        _nNodeSampleTables->push_back(smplCnt);
+        _nTree.inc();
+    }
+    return true;
+}
+
 ModelImpl::~ModelImpl()
 {
     destroy();
@@ -211,16 +241,19 @@ bool ModelImpl::reserve(const size_t nTrees)
 
 bool ModelImpl::resize(const size_t nTrees)
 {
+    _lazyTrees.reset();
     return super::resize(nTrees);
 }
 
 void ModelImpl::clear()
 {
+    _lazyTrees.reset();
     super::clear();
 }
 
 void ModelImpl::destroy()
 {
+    _lazyTrees.reset();
     super::destroy();
 }
 
@@ -346,7 +379,139 @@ void ModelImpl::getMaxLvl(const dtrees::internal::DecisionTreeNode * const arr,
 
 const GbtDecisionTree * ModelImpl::at(const size_t idx) const
 {
-    return (const GbtDecisionTree *)(*super::_serializationData)[idx].get();
+    if (!_lazyTrees) return (const GbtDecisionTree *)(*super::_serializationData)[idx].get();
+
+    const GbtDecisionTree * tree = nullptr;
+    loadTree(idx, tree);
+    return tree;
+}
+
+services::Status ModelImpl::loadTree(const size_t idx, const GbtDecisionTree *& tree) const
+{
+    LazyTrees & lazy = *_lazyTrees;
+    SharedPtr<byte> treeArchive;
+    size_t treeArchiveSize = 0;
+    {
+        AUTOLOCK(lazy.mutex);
+        tree = (const GbtDecisionTree *)(*_serializationData)[idx].get();
+        if (tree || !lazy.archives[idx]) return Status();
+        treeArchive     = lazy.archives[idx];
+        treeArchiveSize = lazy.sizes[idx];
+    }
+
+    /* The tree is decoded out of the lock, several threads may decode the same tree and the first decoded copy is kept */
+    OutputDataArchive arch(treeArchive.get(), treeArchiveSize);
+    SerializationIfacePtr treePtr;
+    arch.setSharedPtrObj(treePtr);
+    DAAL_CHECK(arch.getErrors()->size() == 0, ErrorObjectDoesNotSupportSerialization);
+
+    GbtDecisionTree * decodedTree = (GbtDecisionTree *)treePtr.get();
+    if (decodedTree && lazy.categorySets && idx < lazy.categorySets->size())
+        decodedTree->setCategorySetsTable(staticPointerCast<GbtDecisionTree::CategorySetsType, SerializationIface>((*lazy.categorySets)[idx]));
+
+    AUTOLOCK(lazy.mutex);
+    if (!(*_serializationData)[idx])
+    {
+        (*_serializationData)[idx] = treePtr;
+        lazy.archives[idx].reset();
+    }
+    tree = (const GbtDecisionTree *)(*_serializationData)[idx].get();
+    return Status();
+}
+
+services::Status ModelImpl::loadTrees(size_t nTrees) const
+{
+    if (!_lazyTrees) return Status();
+    if (nTrees > size()) nTrees = size();
+
+    SafeStatus safeStat;
+    daal::threader_for(nTrees, nTrees, [&](size_t iTree) {
+        const GbtDecisionTree * tree = nullptr;
+        safeStat |= loadTree(iTree, tree);
+    });
+    return safeStat.detach();
+}
+
+services::Status ModelImpl::serialTrees(InputDataArchive * arch)
+{
+    size_t nTrees = size();
+    Status s      = loadTrees(nTrees);
+    if (!s) return s;
+
+    arch->set(nTrees);
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        InputDataArchive treeArch;
+        SerializationIfacePtr treePtr = (*_serializationData)[i];
+        treeArch.setSharedPtrObj(treePtr);
+        DAAL_CHECK(treeArch.getErrors()->size() == 0, ErrorObjectDoesNotSupportSerialization);
+
+        size_t treeArchiveSize            = treeArch.getSizeOfArchive();
+        const SharedPtr<byte> treeArchive = treeArch.getArchiveAsArraySharedPtr();
+        DAAL_CHECK_MALLOC(treeArchive.get() || !treeArchiveSize);
+        arch->set(treeArchiveSize);
+        arch->set(treeArchive.get(), treeArchiveSize);
+    }
+    return s;
+}
+
+services::Status ModelImpl::serialTrees(const OutputDataArchive * arch)
+{
+    size_t nTrees = 0;
+    arch->set(nTrees);
+
+    _serializationData.reset(new DataCollection(nTrees));
+    _lazyTrees.reset(new LazyTrees());
+    DAAL_CHECK_MALLOC(_serializationData.get() && _serializationData->size() == nTrees && _lazyTrees.get());
+
+    for (size_t i = 0; i < nTrees; ++i)
+    {
+        size_t treeArchiveSize = 0;
+        arch->set(treeArchiveSize);
+
+        /* The archive of the tree refers to the data of the model archive when it is possible */
+        SharedPtr<byte> treeArchive;
+        if (!arch->setArrayInPlace(treeArchive, treeArchiveSize))
+        {
+            treeArchive = SharedPtr<byte>((byte *)daal_malloc(treeArchiveSize), ServiceDeleter());
+            DAAL_CHECK_MALLOC(treeArchive.get() || !treeArchiveSize);
+            arch->set(treeArchive.get(), treeArchiveSize);
+        }
+        _lazyTrees->archives.push_back(treeArchive);
+        _lazyTrees->sizes.push_back(treeArchiveSize);
+    }
+    return Status();
+}
+
+const int * ModelImpl::nodeSampleCount(const size_t idx) const
+{
+    if (!_nNodeSampleTables.get() || idx >= _nNodeSampleTables->size()) return nullptr;
+    const HomogenNumericTable<int> * const pTbl = static_cast<const HomogenNumericTable<int> *>((*_nNodeSampleTables)[idx].get());
+    return pTbl ? pTbl->getArray() : nullptr;
+}
+
+data_management::DataCollectionPtr ModelImpl::getCategorySets() const
+{
+    data_management::DataCollectionPtr categorySets(new data_management::DataCollection());
+    if (!categorySets.get() || !_serializationData) return categorySets;
+    for (size_t i = 0; i < _serializationData->size(); ++i)
+    {
+        const GbtDecisionTree * tree = (const GbtDecisionTree *)(*_serializationData)[i].get();
+        categorySets->push_back(tree ? SerializationIfacePtr(tree->getCategorySetsTable()) : SerializationIfacePtr());
+    }
+    return categorySets;
+}
+
+void ModelImpl::setCategorySets(const data_management::DataCollectionPtr & categorySets)
+{
+    if (!categorySets || !_serializationData || categorySets->size() != _serializationData->size()) return;
+    /* The trees that are not decoded yet get their category sets on decoding */
+    if (_lazyTrees) _lazyTrees->categorySets = categorySets;
+    for (size_t i = 0; i < _serializationData->size(); ++i)
+    {
+        GbtDecisionTree * tree = (GbtDecisionTree *)(*_serializationData)[i].get();
+        if (tree) tree->setCategorySetsTable(services::staticPointerCast<GbtDecisionTree::CategorySetsType, SerializationIface>((*categorySets)[i]));
+    }
 }
 
 } // namespace internal
@@ -30,6 +30,7 @@
 #include "algorithms/tree_utils/tree_utils_regression.h"
 #include "algorithms/kernel/dtrees/dtrees_model_impl_common.h"
 #include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_threading.h"
 
 using namespace daal::data_management;
 
@@ -63,6 +64,7 @@ public:
     DECLARE_SERIALIZABLE();
     using SplitPointType             = HomogenNumericTable<gbt::prediction::internal::ModelFPType>;
     using FeatureIndexesForSplitType = HomogenNumericTable<gbt::prediction::internal::FeatureIndexType>;
+    using CategorySetsType           = HomogenNumericTable<gbt::prediction::internal::FeatureIndexType>;
 
     GbtDecisionTree(const size_t nNodes, const size_t maxLvl, const size_t sourceNumOfNodes)
         : _nNodes(nNodes),
@@ -83,6 +85,13 @@ public:
 
     const gbt::prediction::internal::FeatureIndexType * getFeatureIndexesForSplit() const { return _featureIndexes->getArray(); }
 
+    //category sets of the many-vs-many splits of the tree, nullptr if the tree has no such splits
+    const gbt::prediction::internal::FeatureIndexType * getCategorySets() const { return _categorySets ? _categorySets->getArray() : nullptr; }
+
+    const services::SharedPtr<CategorySetsType> & getCategorySetsTable() const { return _categorySets; }
+
+    void setCategorySetsTable(const services::SharedPtr<CategorySetsType> & categorySets) { _categorySets = categorySets; }
+
     size_t getNumberOfNodes() const { return _nNodes; }
 
     size_t * getArrayNumSplitFeature() { return nNodeSplitFeature.data(); }
@@ -110,6 +119,18 @@ public:
         gbt::prediction::internal::ModelFPType * const spitPoints          = tree->getSplitPoints();
         gbt::prediction::internal::FeatureIndexType * const featureIndexes = tree->getFeatureIndexesForSplit();
 
+        //the category sets of the many-vs-many splits are stored one after another, the split point of the split is the offset of its set
+        const size_t nCategorySetWords = getCategorySetsSize<NodeType, NodeBase>(root);
+        gbt::prediction::internal::FeatureIndexType * categorySets = nullptr;
+        size_t categorySetOffset                                   = 0;
+        if (nCategorySetWords)
+        {
+            services::Status s;
+            tree->_categorySets = CategorySetsType::create(1, nCategorySetWords, NumericTableIface::doAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            categorySets = tree->_categorySets->getArray();
+        }
+
         for (size_t i = 0; i < nNodes; ++i)
         {
             sons[i]    = nullptr;
@@ -147,6 +168,7 @@ public:
                     sons[nSons++]              = NodeType::castSplit(p->left());
                     sons[nSons++]              = NodeType::castSplit(p->right());
                     featureIndexes[idxInTable] = p->featureIdx;
+                    if (!p->defaultLeft && !p->featureUnordered) featureIndexes[idxInTable] |= gbt::prediction::internal::DEFAULT_RIGHT_FLAG;
                 }
                 else
                 {
@@ -159,6 +181,15 @@ public:
                 impVals[idxInTable]          = p->impurity;
                 spitPoints[idxInTable]       = p->featureValue;
 
+                if (p->isSplit() && p->categorySet)
+                {
+                    const size_t setSize = dtrees::internal::categorySetSize(p->categorySet);
+                    for (size_t i = 0; i < setSize; ++i) categorySets[categorySetOffset + i] = p->categorySet[i];
+                    featureIndexes[idxInTable] |= gbt::prediction::internal::CATEGORY_SET_FLAG;
+                    spitPoints[idxInTable] = gbt::prediction::internal::ModelFPType(categorySetOffset);
+                    categorySetOffset += setSize;
+                }
+
                 idxInTable++;
             }
 
@@ -171,6 +202,16 @@ public:
         return (!result) ? services::Status() : services::Status(services::ErrorMemoryCopyFailedInternal);
     }
 
+    //total size in words of the category sets of the many-vs-many splits of the tree
+    template <typename NodeType, typename NodeBase>
+    static size_t getCategorySetsSize(const NodeBase & node)
+    {
+        if (!node.isSplit()) return 0;
+        const typename NodeType::Split * p = NodeType::castSplit(&node);
+        return (p->categorySet ? dtrees::internal::categorySetSize(p->categorySet) : 0) + getCategorySetsSize<NodeType, NodeBase>(*p->left())
+               + getCategorySetsSize<NodeType, NodeBase>(*p->right());
+    }
+
 protected:
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch)
@@ -191,6 +232,8 @@ protected:
     size_t _sourceNumOfNodes;
     services::SharedPtr<SplitPointType> _splitPoints;
     services::SharedPtr<FeatureIndexesForSplitType> _featureIndexes;
+    //not serialized with the tree, the model keeps the category sets of its trees to read the archives of the older versions
+    services::SharedPtr<CategorySetsType> _categorySets;
     services::Collection<size_t> nNodeSplitFeature;
     services::Collection<size_t> CoverFeature;
     services::Collection<double> GainFeature;
@@ -271,6 +314,12 @@ public:
 
     const GbtDecisionTree * at(const size_t idx) const;
 
+    /* Decodes the first nTrees trees of the lazily deserialized model in parallel, does nothing for the decoded models */
+    services::Status loadTrees(size_t nTrees) const;
+
+    /* Numbers of the training observations in the nodes of the tree, nullptr if the model does not keep them (e.g. built by the model builder) */
+    const int * nodeSampleCount(const size_t idx) const;
+
     static void decisionTreeToGbtTree(const DecisionTreeTable & tree, GbtDecisionTree & gbtTree);
     static services::Status convertDecisionTreesToGbtTrees(data_management::DataCollectionPtr & serializationData);
 
@@ -279,6 +328,8 @@ public:
     void traverseDF(size_t iTree, algorithms::regression::TreeNodeVisitor & visitor) const;
     void traverseBF(size_t iTree, algorithms::regression::TreeNodeVisitor & visitor) const;
     void add(gbt::internal::GbtDecisionTree * pTbl, HomogenNumericTable<double> * pTblImp, HomogenNumericTable<int> * pTblSmplCnt);
+    /* Appends the trees of the other model, the trees are shared by the models */
+    bool append(const ModelImpl & other);
     void traverseDFS(size_t iTree, tree_utils::regression::TreeNodeVisitor & visitor) const;
     void traverseBFS(size_t iTree, tree_utils::regression::TreeNodeVisitor & visitor) const;
     static services::Status treeToTable(TreeType & t, gbt::internal::GbtDecisionTree ** pTbl, HomogenNumericTable<double> ** pTblImp,
@@ -349,7 +400,15 @@ protected:
     template <typename Archive, bool onDeserialize>
     services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
-        if ((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
+        /* The archives written by 2021.1.7 and later keep every tree in a separate archive, the trees are decoded on the first access */
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 7))
+        {
+            services::Status s = serialTrees(arch);
+            if (!s) return s;
+            arch->setSharedPtrObj(_impurityTables);
+            arch->setSharedPtrObj(_nNodeSampleTables);
+        }
+        else if ((daalVersion >= COMPUTE_DAAL_VERSION(2019, 0, 0)))
         {
             arch->setSharedPtrObj(_serializationData);
             arch->setSharedPtrObj(_impurityTables);
@@ -361,10 +420,37 @@ protected:
             convertDecisionTreesToGbtTrees(_serializationData);
         }
 
+        /* The category sets of the splits are written after the trees since 2021.1.7 */
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 7))
+        {
+            data_management::DataCollectionPtr categorySets;
+            if (!onDeserialize) categorySets = getCategorySets();
+            arch->setSharedPtrObj(categorySets);
+            if (onDeserialize) setCategorySets(categorySets);
+        }
+
         if (onDeserialize) _nTree.set(_serializationData->size());
 
         return services::Status();
     }
+
+    /* Archives of the trees of the deserialized model that are not decoded yet */
+    struct LazyTrees
+    {
+        services::Collection<services::SharedPtr<byte> > archives; //Archive of the tree, empty after the tree is decoded
+        services::Collection<size_t> sizes;                       //Sizes of the archives in bytes
+        data_management::DataCollectionPtr categorySets;          //Category sets of the trees set on deserialization
+        Mutex mutex;                                              //Guards the decoding of the trees
+    };
+
+    services::Status serialTrees(data_management::InputDataArchive * arch);
+    services::Status serialTrees(const data_management::OutputDataArchive * arch);
+    services::Status loadTree(const size_t idx, const GbtDecisionTree *& tree) const;
+
+    data_management::DataCollectionPtr getCategorySets() const;
+    void setCategorySets(const data_management::DataCollectionPtr & categorySets);
+
+    services::SharedPtr<LazyTrees> _lazyTrees;
 };
 
 } // namespace internal
@@ -45,11 +45,43 @@ typedef float ModelFPType;
 typedef uint32_t FeatureIndexType;
 const FeatureIndexType VECTOR_BLOCK_SIZE = 64;
 
+//the highest bit of the feature index of a split node is set if the missing values of the feature go to the right child
+const FeatureIndexType DEFAULT_RIGHT_FLAG  = FeatureIndexType(1) << 31;
+const FeatureIndexType DEFAULT_RIGHT_SHIFT = 31;
+//the next bit is set for the many-vs-many split of an unordered feature, its split point is the offset of the category set of the split
+const FeatureIndexType CATEGORY_SET_FLAG  = FeatureIndexType(1) << 30;
+const FeatureIndexType FEATURE_INDEX_MASK = ~(DEFAULT_RIGHT_FLAG | CATEGORY_SET_FLAG);
+
+inline FeatureIndexType getSplitFeature(FeatureIndexType splitFeatureAndFlag)
+{
+    return splitFeatureAndFlag & FEATURE_INDEX_MASK;
+}
+
+//returns 1 if the observation goes to the right child of the ordered split: the value is greater than the split point,
+//or it is missing and the missing values go to the right. Both conditions are computed without branches
+template <typename algorithmFPType, CpuType cpu>
+inline FeatureIndexType goesRight(algorithmFPType value, ModelFPType splitPoint, FeatureIndexType splitFeatureAndFlag)
+{
+    return FeatureIndexType(value > splitPoint)
+           | ((splitFeatureAndFlag >> DEFAULT_RIGHT_SHIFT) & FeatureIndexType(services::internal::IsNaN<algorithmFPType, cpu>::get(value)));
+}
+
+//returns 1 if the observation goes to the right child of the split of an unordered feature: the category is not in the category set
+//of the many-vs-many split or differs from the split point of the one-vs-rest split
+template <typename algorithmFPType>
+inline FeatureIndexType categoryGoesRight(algorithmFPType value, ModelFPType splitPoint, FeatureIndexType splitFeatureAndFlag,
+                                          const FeatureIndexType * categorySets)
+{
+    if (splitFeatureAndFlag & CATEGORY_SET_FLAG) return !dtrees::internal::isInCategorySet(categorySets + size_t(splitPoint), int(value));
+    return int(value) != int(splitPoint);
+}
+
 template <typename algorithmFPType, typename DecisionTreeType, CpuType cpu>
 inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes & featTypes, const algorithmFPType * x, algorithmFPType v[])
 {
     const ModelFPType * const values        = t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+    const FeatureIndexType * const aSets    = t.getCategorySets();
     const FeatureIndexType nFeat            = featTypes.getNumberOfFeatures();
 
     FeatureIndexType i[VECTOR_BLOCK_SIZE];
@@ -66,11 +98,13 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
             for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
             {
                 const FeatureIndexType idx          = i[k];
-                const FeatureIndexType splitFeature = fIndexes[idx];
+                const FeatureIndexType splitFeature = getSplitFeature(fIndexes[idx]);
                 const ModelFPType valueFromDataSet  = x[splitFeature + k * nFeat];
                 const ModelFPType splitPoint        = values[idx];
 
-                i[k] = idx * 2 + (featTypes.isUnordered(splitFeature) ? valueFromDataSet != splitPoint : valueFromDataSet > splitPoint);
+                i[k] = idx * 2
+                       + (featTypes.isUnordered(splitFeature) ? categoryGoesRight<ModelFPType>(valueFromDataSet, splitPoint, fIndexes[idx], aSets) :
+                                                                goesRight<ModelFPType, cpu>(valueFromDataSet, splitPoint, fIndexes[idx]));
             }
         }
     }
@@ -82,8 +116,9 @@ inline void predictForTreeVector(const DecisionTreeType & t, const FeatureTypes
             PRAGMA_VECTOR_ALWAYS
             for (FeatureIndexType k = 0; k < VECTOR_BLOCK_SIZE; k++)
             {
-                const FeatureIndexType idx = i[k];
-                i[k]                       = idx * 2 + (x[fIndexes[idx] + k * nFeat] > values[idx]);
+                const FeatureIndexType idx          = i[k];
+                const FeatureIndexType splitFeature = fIndexes[idx];
+                i[k] = idx * 2 + goesRight<algorithmFPType, cpu>(x[getSplitFeature(splitFeature) + k * nFeat], values[idx], splitFeature);
             }
         }
     }
@@ -101,6 +136,7 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
 {
     const ModelFPType * const values        = (const ModelFPType *)t.getSplitPoints() - 1;
     const FeatureIndexType * const fIndexes = t.getFeatureIndexesForSplit() - 1;
+    const FeatureIndexType * const aSets    = t.getCategorySets();
 
     const FeatureIndexType maxLvl = t.getMaxLvl();
 
@@ -110,14 +146,17 @@ inline algorithmFPType predictForTree(const DecisionTreeType & t, const FeatureT
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
-            i = i * 2 + (featTypes.isUnordered(fIndexes[i]) ? int(x[fIndexes[i]]) != int(values[i]) : x[fIndexes[i]] > values[i]);
+            const FeatureIndexType splitFeature = getSplitFeature(fIndexes[i]);
+            i = i * 2
+                + (featTypes.isUnordered(splitFeature) ? categoryGoesRight<algorithmFPType>(x[splitFeature], values[i], fIndexes[i], aSets) :
+                                                         goesRight<algorithmFPType, cpu>(x[splitFeature], values[i], fIndexes[i]));
         }
     }
     else
     {
         for (FeatureIndexType itr = 0; itr < maxLvl; itr++)
         {
-            i = i * 2 + (x[fIndexes[i]] > values[i]);
+            i = i * 2 + goesRight<algorithmFPType, cpu>(x[getSplitFeature(fIndexes[i])], values[i], fIndexes[i]);
         }
     }
 
@@ -0,0 +1,271 @@
+/* file: gbt_predict_shap_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of TreeSHAP for the trees of gradient boosted trees model.
+//  The contributions of the features are computed with the polynomial time algorithm
+//  from "Consistent Individualized Feature Attribution for Tree Ensembles" by S. Lundberg et al.
+//  that keeps the unique features of the path from the root with the weights of their subsets.
+//--
+*/
+
+#ifndef __GBT_PREDICT_SHAP_IMPL_I__
+#define __GBT_PREDICT_SHAP_IMPL_I__
+
+#include "algorithms/kernel/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+template <typename algorithmFPType>
+struct ShapPathElement
+{
+    int featureIndex;             //Feature of the split, -1 for the element of the root
+    algorithmFPType zeroFraction; //Fraction of the training observations that go through the path if the feature is absent
+    algorithmFPType oneFraction;  //1 if the observation goes through the path if the feature is present, 0 otherwise
+    algorithmFPType pWeight;      //Weight of the subsets of the features of the path
+};
+
+//size of the buffer for the paths of TreeSHAP, every level of the recursion keeps its own copy of the path
+inline size_t getShapPathBufferSize(size_t maxLvl)
+{
+    return (maxLvl + 2) * (maxLvl + 3) / 2;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+class TreeShap
+{
+public:
+    typedef ShapPathElement<algorithmFPType> PathElement;
+
+    //cover is the array of the numbers of the training observations in the nodes of the tree
+    TreeShap(const gbt::internal::GbtDecisionTree & t, const int * cover, const FeatureTypes & featTypes)
+        : _values(t.getSplitPoints() - 1),
+          _fIndexes(t.getFeatureIndexesForSplit() - 1),
+          _aSets(t.getCategorySets()),
+          _cover(cover - 1),
+          _maxLvl(t.getMaxLvl()),
+          _featTypes(featTypes)
+    {}
+
+    //mean response of the tree weighted by the numbers of the training observations in the leaves
+    algorithmFPType expectedValue() const { return subtreeMean(1, 0); }
+
+    //sets the flags of the features used in the splits of the tree
+    void markSplitFeatures(char * isUsed) const { markSplitFeatures(1, 0, isUsed); }
+
+    //adds the contributions of the features of the observation x to phi. condition is 0 for the contributions,
+    //1 or -1 to compute them with the feature conditionFeature always present or always absent for the interaction values
+    void addContributions(const algorithmFPType * x, algorithmFPType * phi, PathElement * pathBuffer, int condition = 0,
+                          int conditionFeature = 0) const
+    {
+        recurse(x, phi, 1, 0, pathBuffer, 0, algorithmFPType(1), algorithmFPType(1), -1, condition, conditionFeature, algorithmFPType(1));
+    }
+
+protected:
+    bool isLeaf(FeatureIndexType i, FeatureIndexType lvl) const
+    {
+        return (lvl == _maxLvl) || (_values[2 * i] == _values[i] && _fIndexes[2 * i] == _fIndexes[i]);
+    }
+
+    FeatureIndexType goesRightForNode(const algorithmFPType * x, FeatureIndexType i) const
+    {
+        const FeatureIndexType splitFeature = getSplitFeature(_fIndexes[i]);
+        return _featTypes.isUnordered(splitFeature) ? categoryGoesRight<algorithmFPType>(x[splitFeature], _values[i], _fIndexes[i], _aSets) :
+                                                      goesRight<algorithmFPType, cpu>(x[splitFeature], _values[i], _fIndexes[i]);
+    }
+
+    algorithmFPType subtreeMean(FeatureIndexType i, FeatureIndexType lvl) const
+    {
+        if (isLeaf(i, lvl)) return _values[i];
+        if (_cover[i] <= 0) return algorithmFPType(0);
+        return (_cover[2 * i] * subtreeMean(2 * i, lvl + 1) + _cover[2 * i + 1] * subtreeMean(2 * i + 1, lvl + 1)) / _cover[i];
+    }
+
+    void markSplitFeatures(FeatureIndexType i, FeatureIndexType lvl, char * isUsed) const
+    {
+        if (isLeaf(i, lvl)) return;
+        isUsed[getSplitFeature(_fIndexes[i])] = 1;
+        markSplitFeatures(2 * i, lvl + 1, isUsed);
+        markSplitFeatures(2 * i + 1, lvl + 1, isUsed);
+    }
+
+    static void extendPath(PathElement * path, int uniqueDepth, algorithmFPType zeroFraction, algorithmFPType oneFraction, int featureIndex)
+    {
+        path[uniqueDepth].featureIndex = featureIndex;
+        path[uniqueDepth].zeroFraction = zeroFraction;
+        path[uniqueDepth].oneFraction  = oneFraction;
+        path[uniqueDepth].pWeight      = (uniqueDepth == 0 ? algorithmFPType(1) : algorithmFPType(0));
+
+        const algorithmFPType denom = algorithmFPType(uniqueDepth + 1);
+        for (int k = uniqueDepth - 1; k >= 0; --k)
+        {
+            path[k + 1].pWeight += oneFraction * path[k].pWeight * (k + 1) / denom;
+            path[k].pWeight = zeroFraction * path[k].pWeight * (uniqueDepth - k) / denom;
+        }
+    }
+
+    //removes the element pathIndex from the path, the inverse of extendPath
+    static void unwindPath(PathElement * path, int uniqueDepth, int pathIndex)
+    {
+        const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+        const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+        const algorithmFPType denom        = algorithmFPType(uniqueDepth + 1);
+
+        algorithmFPType nextOnePortion = path[uniqueDepth].pWeight;
+        for (int k = uniqueDepth - 1; k >= 0; --k)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType tmp = path[k].pWeight;
+                path[k].pWeight           = nextOnePortion * denom / ((k + 1) * oneFraction);
+                nextOnePortion            = tmp - path[k].pWeight * zeroFraction * (uniqueDepth - k) / denom;
+            }
+            else
+            {
+                path[k].pWeight = path[k].pWeight * denom / (zeroFraction * (uniqueDepth - k));
+            }
+        }
+
+        for (int k = pathIndex; k < uniqueDepth; ++k)
+        {
+            path[k].featureIndex = path[k + 1].featureIndex;
+            path[k].zeroFraction = path[k + 1].zeroFraction;
+            path[k].oneFraction  = path[k + 1].oneFraction;
+        }
+    }
+
+    //total weight of the path with the element pathIndex removed, the path is not changed
+    static algorithmFPType unwoundPathSum(const PathElement * path, int uniqueDepth, int pathIndex)
+    {
+        const algorithmFPType oneFraction  = path[pathIndex].oneFraction;
+        const algorithmFPType zeroFraction = path[pathIndex].zeroFraction;
+        const algorithmFPType denom        = algorithmFPType(uniqueDepth + 1);
+
+        algorithmFPType nextOnePortion = path[uniqueDepth].pWeight;
+        algorithmFPType total          = 0;
+        for (int k = uniqueDepth - 1; k >= 0; --k)
+        {
+            if (oneFraction != 0)
+            {
+                const algorithmFPType tmp = nextOnePortion * denom / ((k + 1) * oneFraction);
+                total += tmp;
+                nextOnePortion = path[k].pWeight - tmp * zeroFraction * (uniqueDepth - k) / denom;
+            }
+            else if (zeroFraction != 0)
+            {
+                total += path[k].pWeight * denom / (zeroFraction * (uniqueDepth - k));
+            }
+        }
+        return total;
+    }
+
+    void recurse(const algorithmFPType * x, algorithmFPType * phi, FeatureIndexType i, FeatureIndexType lvl, PathElement * parentPath,
+                 int uniqueDepth, algorithmFPType parentZeroFraction, algorithmFPType parentOneFraction, int parentFeature, int condition,
+                 int conditionFeature, algorithmFPType conditionFraction) const
+    {
+        if (conditionFraction == 0) return;
+
+        PathElement * const path = parentPath + uniqueDepth + 1;
+        for (int k = 0; k <= uniqueDepth; ++k) path[k] = parentPath[k];
+
+        //the condition feature is not a part of the path, it is always present or always absent
+        if (condition == 0 || conditionFeature != parentFeature) extendPath(path, uniqueDepth, parentZeroFraction, parentOneFraction, parentFeature);
+
+        if (isLeaf(i, lvl))
+        {
+            const algorithmFPType leafValue = _values[i] * conditionFraction;
+            for (int k = 1; k <= uniqueDepth; ++k)
+            {
+                const PathElement & el  = path[k];
+                const algorithmFPType w = unwoundPathSum(path, uniqueDepth, k);
+                phi[el.featureIndex] += w * (el.oneFraction - el.zeroFraction) * leafValue;
+            }
+            return;
+        }
+
+        const int splitFeature                 = int(getSplitFeature(_fIndexes[i]));
+        const FeatureIndexType hot             = 2 * i + goesRightForNode(x, i);
+        const FeatureIndexType cold            = hot ^ 1;
+        const algorithmFPType cover            = algorithmFPType(_cover[i]);
+        const algorithmFPType hotZeroFraction  = cover > 0 ? _cover[hot] / cover : algorithmFPType(0);
+        const algorithmFPType coldZeroFraction = cover > 0 ? _cover[cold] / cover : algorithmFPType(0);
+
+        //the feature already split on the path is replaced by the new element for it
+        algorithmFPType incomingZeroFraction = 1;
+        algorithmFPType incomingOneFraction  = 1;
+        int pathIndex                        = 0;
+        while (pathIndex <= uniqueDepth && path[pathIndex].featureIndex != splitFeature) ++pathIndex;
+        if (pathIndex <= uniqueDepth)
+        {
+            incomingZeroFraction = path[pathIndex].zeroFraction;
+            incomingOneFraction  = path[pathIndex].oneFraction;
+            unwindPath(path, uniqueDepth, pathIndex);
+            --uniqueDepth;
+        }
+
+        algorithmFPType hotConditionFraction  = conditionFraction;
+        algorithmFPType coldConditionFraction = conditionFraction;
+        if (condition != 0 && splitFeature == conditionFeature)
+        {
+            if (condition > 0)
+            {
+                coldConditionFraction = 0;
+            }
+            else
+            {
+                hotConditionFraction *= hotZeroFraction;
+                coldConditionFraction *= coldZeroFraction;
+            }
+            --uniqueDepth;
+        }
+
+        recurse(x, phi, hot, lvl + 1, path, uniqueDepth + 1, hotZeroFraction * incomingZeroFraction, incomingOneFraction, splitFeature, condition,
+                conditionFeature, hotConditionFraction);
+        //the cold child without the training observations has zero weights of all subsets
+        if (coldZeroFraction * incomingZeroFraction != 0)
+        {
+            recurse(x, phi, cold, lvl + 1, path, uniqueDepth + 1, coldZeroFraction * incomingZeroFraction, algorithmFPType(0), splitFeature,
+                    condition, conditionFeature, coldConditionFraction);
+        }
+    }
+
+protected:
+    const ModelFPType * const _values;
+    const FeatureIndexType * const _fIndexes;
+    const FeatureIndexType * const _aSets;
+    const int * const _cover;
+    const FeatureIndexType _maxLvl;
+    const FeatureTypes & _featTypes;
+};
+
+} /* namespace internal */
+} /* namespace prediction */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
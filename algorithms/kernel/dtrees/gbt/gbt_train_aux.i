@@ -459,6 +459,11 @@ public:
     virtual GbtTask * execute() = 0;
     virtual void operator()() { execute(); };
     virtual void getNextTasks(GbtTask ** newTasks, size_t & nTasks) {};
+    //leaf-wise growth executes the task in two steps: the split is found first and applied only if the node is chosen to be split,
+    //otherwise it is cancelled and the node becomes a leaf
+    virtual bool findNodeSplit(double & gain) { return false; }
+    virtual void applyNodeSplit() {}
+    virtual void cancelNodeSplit() {}
     virtual ~GbtTask() {};
 };
 
@@ -733,13 +738,28 @@ struct GlobalStorages
     using TlsType   = TlsGHSumMerge<GHSumForTLS<GHSumType, cpu>, algorithmFPType, cpu>;
 
     GlobalStorages(size_t nFeatures, size_t nStor, size_t nUniq, size_t nGlobal)
-        : singleGHSums(nStor), GHForCols(nUniq, nGlobal), nUniquesArr(nFeatures)
+        : singleGHSums(nStor),
+          GHForCols(nUniq, nGlobal),
+          nUniquesArr(nFeatures),
+          featureStart(nFeatures),
+          defaultBin(nFeatures),
+          nCols(nFeatures),
+          nRootGHSums(0),
+          newFI(nullptr)
     {}
 
+    //precomputed histogram of the root of the tree iTree of the current iteration, nullptr if it is not precomputed
+    algorithmFPType * rootGHSum(size_t iTree) { return (iTree < nRootGHSums) ? rootGHSums.get() + 4 * nDiffFeatMax * iTree : nullptr; }
+
     GroupOfStorages<GHSumType, cpu> singleGHSums;
     GHSumsStorage<TlsType, cpu> GHForCols;
-    TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;
+    TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr;  //offsets of the columns of newFI in the histogram
+    TVector<size_t, cpu, ScalableAllocator<cpu> > featureStart; //offsets of the features in the histogram
+    TVector<int, cpu, ScalableAllocator<cpu> > defaultBin;      //bin not counted by rows for the bundled features, -1 for the rest
     size_t nDiffFeatMax;
+    size_t nCols; //number of columns of newFI, less than the number of features if some of them are bundled
+    TVector<algorithmFPType, cpu, ScalableAllocator<cpu> > rootGHSums; //histograms of the roots of the trees of the current iteration
+    size_t nRootGHSums;                                                 //number of the trees with the precomputed root histogram
 
     BinIndexType * newFI;
 };
@@ -0,0 +1,270 @@
+/* file: gbt_train_bundling.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the exclusive feature bundling for gradient boosted trees training
+//  (defaultDense) method.
+//--
+*/
+
+#ifndef __GBT_TRAIN_BUNDLING_I__
+#define __GBT_TRAIN_BUNDLING_I__
+
+#include "algorithms/kernel/dtrees/dtrees_feature_type_helper.h"
+#include "algorithms/kernel/dtrees/gbt/gbt_train_aux.i"
+#include "algorithms/kernel/service_sort.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+//////////////////////////////////////////////////////////////////////////////////////////
+// Exclusive feature bundling: the sparse features that never take a value other than their most frequent one
+// in the same row share a column of the row-wise binned data and a range of the histogram.
+// The most frequent (default) bin of a bundled feature is not counted, it is restored from the totals of the node
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename BinIndexType, CpuType cpu>
+class ExclusiveFeatureBundles
+{
+public:
+    typedef dtrees::internal::IndexedFeatures::IndexType IndexType;
+
+    ExclusiveFeatureBundles() : _nRows(0), _nFeatures(0), _nCols(0) {}
+
+    //finds the bundles of the features
+    services::Status build(const dtrees::internal::IndexedFeatures & indexedFeatures);
+
+    //number of columns of the row-wise binned data
+    size_t nColumns() const { return _nCols; }
+
+    //fills the offsets of the columns and of the features in the histogram and the default bins of the features,
+    //-1 for the features that are not bundled, returns the size of the histogram
+    size_t getOffsets(const dtrees::internal::IndexedFeatures & indexedFeatures, size_t * colStart, size_t * featureStart, int * defaultBin) const;
+
+    //fills the row-wise binned data, nRows x nColumns()
+    void getBinnedRows(const dtrees::internal::IndexedFeatures & indexedFeatures, BinIndexType * binned) const;
+
+protected:
+    bool isBundled(size_t iFeature) const { return _aDefaultBin[iFeature] >= 0; }
+    services::Status findDefaultBins(const dtrees::internal::IndexedFeatures & indexedFeatures, int * aDefault, IndexType * aNonDefault) const;
+
+protected:
+    enum
+    {
+        _maxBundles           = 64,  //bundles a feature is checked against, bounds the memory for the row masks
+        _nonDefaultPercentage = 10,  //features with more rows having a non-default value are not bundled
+        _nRowsInBlock         = 4096
+    };
+
+    size_t _nRows;
+    size_t _nFeatures;
+    size_t _nCols;
+    TVector<int, cpu> _aDefaultBin;  //most frequent bin of the bundled features, -1 for the rest
+    TVector<size_t, cpu> _aCol;      //column of the feature in the row-wise binned data
+    TVector<size_t, cpu> _aOffset;   //offset of the bins of the feature in its column, 0 for the features that are not bundled
+    TVector<size_t, cpu> _aColSize;  //number of histogram bins of the column
+};
+
+template <typename BinIndexType, CpuType cpu>
+services::Status ExclusiveFeatureBundles<BinIndexType, cpu>::findDefaultBins(const dtrees::internal::IndexedFeatures & indexedFeatures,
+                                                                              int * aDefault, IndexType * aNonDefault) const
+{
+    SafeStatus safeStat;
+    daal::threader_for(_nFeatures, _nFeatures, [&](size_t iFeature) {
+        const size_t nBins = indexedFeatures.numIndices(iFeature);
+        TArray<size_t, cpu> aCount(nBins);
+        DAAL_CHECK_THR(aCount.get(), services::ErrorMemoryAllocationFailed);
+        services::internal::service_memset_seq<size_t, cpu>(aCount.get(), 0, nBins);
+        const IndexType * bins = indexedFeatures.data(iFeature);
+        for (size_t i = 0; i < _nRows; ++i) ++aCount[bins[i]];
+        size_t iMax = 0;
+        for (size_t iBin = 1; iBin < nBins; ++iBin)
+            if (aCount[iBin] > aCount[iMax]) iMax = iBin;
+        aDefault[iFeature]    = int(iMax);
+        aNonDefault[iFeature] = IndexType(_nRows - aCount[iMax]);
+    });
+    return safeStat.detach();
+}
+
+template <typename BinIndexType, CpuType cpu>
+services::Status ExclusiveFeatureBundles<BinIndexType, cpu>::build(const dtrees::internal::IndexedFeatures & indexedFeatures)
+{
+    _nRows     = indexedFeatures.nRows();
+    _nFeatures = indexedFeatures.nCols();
+    _nCols     = _nFeatures;
+    _aDefaultBin.reset(_nFeatures);
+    _aCol.reset(_nFeatures);
+    _aOffset.reset(_nFeatures);
+    _aColSize.reset(_nFeatures);
+    DAAL_CHECK_MALLOC(_aDefaultBin.get() && _aCol.get() && _aOffset.get() && _aColSize.get());
+    for (size_t i = 0; i < _nFeatures; ++i)
+    {
+        _aCol[i]     = i;
+        _aOffset[i]  = 0;
+        _aColSize[i] = indexedFeatures.numIndices(i);
+    }
+
+    TArray<int, cpu> aDefault(_nFeatures);
+    TArray<IndexType, cpu> aNonDefault(_nFeatures);
+    TArray<IndexType, cpu> aCandidate(_nFeatures);
+    DAAL_CHECK_MALLOC(aDefault.get() && aNonDefault.get() && aCandidate.get());
+    services::Status s;
+    DAAL_CHECK_STATUS(s, findDefaultBins(indexedFeatures, aDefault.get(), aNonDefault.get()));
+
+    //bundled columns keep 0 for the rows with all the features at their default bins
+    const size_t maxColSize = size_t(BinIndexType(-1)) + 1;
+    size_t nCandidates      = 0;
+    for (size_t i = 0; i < _nFeatures; ++i)
+    {
+        _aDefaultBin[i] = -1;
+        if ((size_t(aNonDefault[i]) * 100 <= _nRows * _nonDefaultPercentage) && (size_t(indexedFeatures.numIndices(i)) < maxColSize))
+        {
+            aNonDefault[nCandidates]  = aNonDefault[i];
+            aCandidate[nCandidates++] = IndexType(i);
+        }
+    }
+    if (nCandidates < 2) return s;
+    //the features with more non-default values are bundled first
+    daal::algorithms::internal::qSort<IndexType, IndexType, cpu>(nCandidates, aNonDefault.get(), aCandidate.get());
+
+    const size_t nWords = _nRows / 64 + !!(_nRows % 64);
+    TArray<DAAL_UINT64, cpu> aMask(_maxBundles * nWords); //rows with a non-default value of a feature of the bundle
+    TArray<size_t, cpu> aBundleSize(_maxBundles);
+    TArray<size_t, cpu> aBundleCol(_maxBundles);
+    TArray<size_t, cpu> aBundleFeatures(_maxBundles);
+    TArray<IndexType, cpu> aRows(_nRows);
+    TArray<int, cpu> aBundleOf(_nFeatures);
+    DAAL_CHECK_MALLOC(aMask.get() && aBundleSize.get() && aBundleCol.get() && aBundleFeatures.get() && aRows.get() && aBundleOf.get());
+    services::internal::service_memset<DAAL_UINT64, cpu>(aMask.get(), 0, _maxBundles * nWords);
+    for (size_t i = 0; i < _nFeatures; ++i) aBundleOf[i] = -1;
+
+    size_t nBundles = 0;
+    for (size_t k = nCandidates; k-- > 0;)
+    {
+        const size_t iFeature  = aCandidate[k];
+        const size_t nBins     = indexedFeatures.numIndices(iFeature);
+        const IndexType * bins = indexedFeatures.data(iFeature);
+        size_t nRowsNonDefault = 0;
+        for (size_t i = 0; i < _nRows; ++i)
+            if (bins[i] != aDefault[iFeature]) aRows[nRowsNonDefault++] = IndexType(i);
+
+        size_t iBundle = 0;
+        for (; iBundle < nBundles; ++iBundle)
+        {
+            if (aBundleSize[iBundle] + nBins > maxColSize) continue;
+            const DAAL_UINT64 * mask = aMask.get() + iBundle * nWords;
+            size_t i                 = 0;
+            while ((i < nRowsNonDefault) && !((mask[aRows[i] / 64] >> (aRows[i] % 64)) & 1)) ++i;
+            if (i == nRowsNonDefault) break; //no conflicts with the features of the bundle
+        }
+        if (iBundle == nBundles)
+        {
+            if (nBundles == _maxBundles) continue;
+            aBundleSize[nBundles]     = 1;
+            aBundleFeatures[nBundles] = 0;
+            ++nBundles;
+        }
+        DAAL_UINT64 * mask = aMask.get() + iBundle * nWords;
+        for (size_t i = 0; i < nRowsNonDefault; ++i) mask[aRows[i] / 64] |= (((DAAL_UINT64)1) << (aRows[i] % 64));
+        _aOffset[iFeature] = aBundleSize[iBundle];
+        aBundleSize[iBundle] += nBins;
+        ++aBundleFeatures[iBundle];
+        aBundleOf[iFeature] = int(iBundle);
+    }
+
+    //bundles of one feature are not worth it, the columns are numbered in the order of the first features of the bundles
+    for (size_t iBundle = 0; iBundle < nBundles; ++iBundle) aBundleCol[iBundle] = _nFeatures;
+    _nCols = 0;
+    for (size_t i = 0; i < _nFeatures; ++i)
+    {
+        const int iBundle = aBundleOf[i];
+        if (iBundle < 0 || aBundleFeatures[iBundle] < 2)
+        {
+            _aOffset[i]       = 0;
+            _aColSize[_nCols] = indexedFeatures.numIndices(i);
+            _aCol[i]          = _nCols++;
+            continue;
+        }
+        if (aBundleCol[iBundle] == _nFeatures)
+        {
+            aBundleCol[iBundle] = _nCols;
+            _aColSize[_nCols++] = aBundleSize[iBundle];
+        }
+        _aCol[i]        = aBundleCol[iBundle];
+        _aDefaultBin[i] = aDefault[i];
+    }
+    return s;
+}
+
+template <typename BinIndexType, CpuType cpu>
+size_t ExclusiveFeatureBundles<BinIndexType, cpu>::getOffsets(const dtrees::internal::IndexedFeatures & indexedFeatures, size_t * colStart,
+                                                              size_t * featureStart, int * defaultBin) const
+{
+    size_t size = 0;
+    for (size_t iCol = 0; iCol < _nCols; ++iCol)
+    {
+        colStart[iCol] = size;
+        size += _aColSize[iCol];
+    }
+    for (size_t i = 0; i < _nFeatures; ++i)
+    {
+        featureStart[i] = colStart[_aCol[i]] + _aOffset[i];
+        defaultBin[i]   = _aDefaultBin[i];
+    }
+    return size;
+}
+
+template <typename BinIndexType, CpuType cpu>
+void ExclusiveFeatureBundles<BinIndexType, cpu>::getBinnedRows(const dtrees::internal::IndexedFeatures & indexedFeatures, BinIndexType * binned) const
+{
+    const size_t nBlocks = _nRows / _nRowsInBlock + !!(_nRows % _nRowsInBlock);
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart = iBlock * _nRowsInBlock;
+        const size_t iEnd   = (iStart + _nRowsInBlock < _nRows ? iStart + _nRowsInBlock : _nRows);
+        if (_nCols < _nFeatures)
+            services::internal::service_memset_seq<BinIndexType, cpu>(binned + iStart * _nCols, 0, (iEnd - iStart) * _nCols);
+        for (size_t iFeature = 0; iFeature < _nFeatures; ++iFeature)
+        {
+            const IndexType * bins = indexedFeatures.data(iFeature);
+            BinIndexType * dst     = binned + _aCol[iFeature];
+            if (!isBundled(iFeature))
+            {
+                for (size_t i = iStart; i < iEnd; ++i) dst[i * _nCols] = BinIndexType(bins[i]);
+                continue;
+            }
+            const IndexType defaultBin = _aDefaultBin[iFeature];
+            const size_t offset        = _aOffset[iFeature];
+            for (size_t i = iStart; i < iEnd; ++i)
+                if (bins[i] != defaultBin) dst[i * _nCols] = BinIndexType(offset + bins[i]);
+        }
+    });
+}
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -30,6 +30,9 @@
 #include "algorithms/kernel/dtrees/dtrees_predict_dense_default_impl.i"
 #include "algorithms/kernel/dtrees/gbt/gbt_internal.h"
 #include "algorithms/kernel/dtrees/gbt/gbt_train_aux.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_train_goss.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_train_bundling.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_predict_dense_default_impl.i"
 
 namespace daal
 {
@@ -78,6 +81,8 @@ public:
     bool isParallelTrees() const { return _bParallelTrees; }
     RowIndexType nSamples() const { return _nSamples; }
     bool isBagging() const { return !!_aSampleToF.get(); }
+    //gradient-based sampling, the sample is chosen after the gradients of all the rows are computed
+    bool isGoss() const { return isBagging() && (_par.samplingMethod == gbt::training::goss); }
     const RowIndexType * aSampleToF() const { return _aSampleToF.get(); }
     bool isThreaded() const { return _bThreaded; }
     bool isIndexedMode() const { return !par().memorySavingMode; }
@@ -93,6 +98,7 @@ public:
     services::Status run(gbt::internal::GbtDecisionTree ** aTbl, HomogenNumericTable<double> ** aTblImp, HomogenNumericTable<int> ** aTblSmplCnt,
                          size_t iIteration, GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF);
     virtual services::Status init();
+    services::Status initializeFromModel(const gbt::internal::ModelImpl & md);
     bool isIndirect() const { return _bIndirect; }
     double computeLeafWeightUpdateF(const int * idx, size_t n, const ImpurityType & imp, size_t iTree);
     void updateOOB(size_t iTree, TreeType & t);
@@ -135,7 +141,7 @@ protected:
           _par(par),
           _engine(engine),
           _nClasses(nClasses),
-          _nSamples(par.observationsPerTreeFraction * x->getNumberOfRows()),
+          _nSamples(nSamplesPerTree(par, x->getNumberOfRows())),
           _nFeaturesPerNode(par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns()),
           _dataHelper(indexedFeatures),
           _featHelper(featTypes),
@@ -154,6 +160,11 @@ protected:
             _bParallelTrees    = !!(internalOptions & parallelTrees);
         }
     }
+    static RowIndexType nSamplesPerTree(const Parameter & par, size_t nRows)
+    {
+        if (par.samplingMethod == gbt::training::goss) return RowIndexType(par.gossTopFraction * nRows) + RowIndexType(par.gossOtherFraction * nRows);
+        return par.observationsPerTreeFraction * nRows;
+    }
     ~TrainBatchTaskBase()
     {
         delete _loss;
@@ -213,6 +224,7 @@ protected:
     bool _bParallelNodes    = false;
     bool _bParallelTrees    = false;
     bool _bIndirect         = true;
+    bool _bWarmStart        = false; //f is initialized by the predictions of the model trained before
 };
 
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
@@ -236,6 +248,52 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::init()
     return _dataHelper.init(_data, _resp, isIndirect() ? _aSampleToF.get() : (const int *)nullptr);
 }
 
+template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
+services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::initializeFromModel(const gbt::internal::ModelImpl & md)
+{
+    using gbt::prediction::internal::VECTOR_BLOCK_SIZE;
+    const size_t nModelTrees = md.size();
+    const size_t nRows       = _data->getNumberOfRows();
+    const size_t nCols       = _data->getNumberOfColumns();
+    const size_t nBlocks     = nRows / VECTOR_BLOCK_SIZE + !!(nRows % VECTOR_BLOCK_SIZE);
+    DAAL_ASSERT(nModelTrees % _nTrees == 0);
+
+    algorithmFPType * pf = f();
+    services::internal::service_memset<algorithmFPType, cpu>(pf, algorithmFPType(0), nRows * _nTrees);
+
+    //the trees of an iteration go in the order of the classes, so the tree i contributes to f of the class i % _nTrees
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart       = iBlock * VECTOR_BLOCK_SIZE;
+        const size_t nRowsInBlock = services::internal::min<cpu, size_t>(VECTOR_BLOCK_SIZE, nRows - iStart);
+        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStart, nRowsInBlock);
+        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+        const algorithmFPType * x = xBD.get();
+
+        algorithmFPType v[VECTOR_BLOCK_SIZE];
+        for (size_t iTree = 0; iTree < nModelTrees; ++iTree)
+        {
+            const gbt::internal::GbtDecisionTree & t = *md.at(iTree);
+            algorithmFPType * pfTree                 = pf + iStart * _nTrees + iTree % _nTrees;
+            if (nRowsInBlock == VECTOR_BLOCK_SIZE)
+            {
+                gbt::prediction::internal::predictForTreeVector<algorithmFPType, gbt::internal::GbtDecisionTree, cpu>(t, _featHelper, x, v);
+                for (size_t i = 0; i < VECTOR_BLOCK_SIZE; ++i) pfTree[i * _nTrees] += v[i];
+            }
+            else
+            {
+                for (size_t i = 0; i < nRowsInBlock; ++i)
+                {
+                    using gbt::prediction::internal::predictForTree;
+                    pfTree[i * _nTrees] += predictForTree<algorithmFPType, gbt::internal::GbtDecisionTree, cpu>(t, _featHelper, x + i * nCols);
+                }
+            }
+        }
+    });
+    _bWarmStart = true;
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, typename BinIndexType, CpuType cpu>
 double TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::computeLeafWeightUpdateF(const int * idx, size_t n, const ImpurityType & imp,
                                                                                         size_t iTree)
@@ -276,7 +334,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
         aTblSmplCnt[i] = nullptr;
     }
 
-    if (iIteration)
+    if (iIteration || _bWarmStart)
     {
         _initialF = 0;
     }
@@ -287,7 +345,7 @@ services::Status TrainBatchTaskBase<algorithmFPType, BinIndexType, cpu>::run(gbt
     }
 
     const size_t nRows = _data->getNumberOfRows();
-    if (isBagging())
+    if (isBagging() && !isGoss())
     {
         auto aSampleToF = _aSampleToF.get();
         for (size_t i = 0; i < nRows; ++i) aSampleToF[i] = i;
@@ -342,8 +400,16 @@ public:
     ghType * grad(size_t iTree) { return _aGH.get() + iTree * this->_data->getNumberOfRows(); }
     void step(const algorithmFPType * y) DAAL_C11_OVERRIDE
     {
-        this->lossFunc()->getGradients(this->_nSamples, this->_data->getNumberOfRows(), y, this->f(), this->aSampleToF(),
-                                       (algorithmFPType *)_aGH.get());
+        const size_t nRows = this->_data->getNumberOfRows();
+        if (this->isGoss())
+        {
+            this->lossFunc()->getGradients(nRows, nRows, y, this->f(), nullptr, (algorithmFPType *)_aGH.get());
+            const size_t nTop = size_t(this->_par.gossTopFraction * nRows);
+            //no need to lock mutex here
+            _goss.sample(_aGH.get(), this->_nTrees, nRows, nTop, this->_nSamples - nTop, this->_engine.getState(), this->_aSampleToF.get());
+        }
+        else
+            this->lossFunc()->getGradients(this->_nSamples, nRows, y, this->f(), this->aSampleToF(), (algorithmFPType *)_aGH.get());
     }
     virtual services::Status init() DAAL_C11_OVERRIDE
     {
@@ -352,19 +418,22 @@ public:
         {
             _aGH.reset(this->_data->getNumberOfRows() * this->_nTrees);
             DAAL_CHECK_MALLOC(_aGH.get());
+            if (this->isGoss()) DAAL_CHECK_MALLOC(_goss.init(this->_data->getNumberOfRows()));
         }
         return s;
     }
 
 protected:
     TVector<ghType, cpu> _aGH; //loss function first and second order derivatives
+    GossSampler<algorithmFPType, cpu> _goss;
     HostAppIface * _hostApp;
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu, typename TaskType, typename ResultType>
 services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
-                                 const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
-                                 dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
+                                 const gbt::internal::ModelImpl * initialModel, const gbt::training::Parameter & par,
+                                 engines::internal::BatchBaseImpl & engine, size_t nClasses, dtrees::internal::IndexedFeatures & indexedFeatures,
+                                 dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                                  algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                                  algorithmFPType * ptrTotalGain)
 {
@@ -377,8 +446,15 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
     TaskType task(pHostApp, x, y, par, featTypes, par.memorySavingMode ? nullptr : &indexedFeatures, engine, nClasses);
     DAAL_CHECK_STATUS(s, task.init());
 
-    const size_t nTrees = task.nTrees();
-    DAAL_CHECK_MALLOC(md.reserve(par.maxIterations * nTrees));
+    const size_t nTrees        = task.nTrees();
+    const size_t nInitialTrees = initialModel ? initialModel->size() : 0;
+    DAAL_CHECK_MALLOC(md.reserve(par.maxIterations * nTrees + nInitialTrees));
+    if (nInitialTrees)
+    {
+        //boosting continues from the predictions of the model trained before, whose trees precede the new ones
+        DAAL_CHECK_MALLOC(md.append(*initialModel));
+        DAAL_CHECK_STATUS(s, task.initializeFromModel(*initialModel));
+    }
 
     TVector<gbt::internal::GbtDecisionTree *, cpu> aTables;
     TVector<HomogenNumericTable<double> *, cpu> impTables;
@@ -409,31 +485,51 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, x->getNumberOfColumns(), sizeof(size_t));
 
-    TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr(x->getNumberOfColumns());
+    const size_t nFeatures = x->getNumberOfColumns();
+    TVector<size_t, cpu, ScalableAllocator<cpu> > nUniquesArr(nFeatures);
+    TVector<size_t, cpu, ScalableAllocator<cpu> > featureStart(nFeatures);
+    TVector<int, cpu, ScalableAllocator<cpu> > defaultBin(nFeatures);
     size_t * UniquesArr = nUniquesArr.get();
-    DAAL_CHECK_MALLOC(UniquesArr);
-    size_t nDiffFeatMax;
-    if (!par.memorySavingMode)
+    DAAL_CHECK_MALLOC(UniquesArr && featureStart.get() && defaultBin.get());
+    size_t nDiffFeatMax = 0;
+    size_t nCols        = nFeatures;
+
+    ExclusiveFeatureBundles<BinIndexType, cpu> bundles;
+    if (inexactWithHistMethod)
+    {
+        DAAL_CHECK_STATUS(s, bundles.build(indexedFeatures));
+        nCols        = bundles.nColumns();
+        nDiffFeatMax = bundles.getOffsets(indexedFeatures, UniquesArr, featureStart.get(), defaultBin.get());
+    }
+    else if (!par.memorySavingMode)
     {
         nUniquesArr[0] = 0;
         nDiffFeatMax   = indexedFeatures.numIndices(0);
-        for (size_t i = 1; i < x->getNumberOfColumns(); ++i)
+        for (size_t i = 1; i < nFeatures; ++i)
         {
             nUniquesArr[i] = nUniquesArr[i - 1] + indexedFeatures.numIndices(i - 1);
             nDiffFeatMax += indexedFeatures.numIndices(i);
         }
+        for (size_t i = 0; i < nFeatures; ++i)
+        {
+            featureStart[i] = nUniquesArr[i];
+            defaultBin[i]   = -1;
+        }
     }
 
     const size_t initValue = (inexactWithHistMethod) ? 2 : 0;
-    const size_t nStor     = x->getNumberOfColumns();
+    const size_t nStor     = nFeatures;
 
-    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(x->getNumberOfColumns(), nStor, nDiffFeatMax, initValue);
+    GlobalStorages<algorithmFPType, BinIndexType, cpu> storage(nFeatures, nStor, nDiffFeatMax, initValue);
     storage.nUniquesArr  = nUniquesArr;
+    storage.featureStart = featureStart;
+    storage.defaultBin   = defaultBin;
     storage.nDiffFeatMax = nDiffFeatMax;
+    storage.nCols        = nCols;
 
     if (!par.memorySavingMode)
     {
-        for (size_t i = 0; i < x->getNumberOfColumns(); ++i)
+        for (size_t i = 0; i < nFeatures; ++i)
         {
             storage.singleGHSums.add(i, indexedFeatures.numIndices(i), 2);
         }
@@ -443,32 +539,13 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
     if (inexactWithHistMethod)
     {
-        size_t nThreads    = threader_get_threads_number();
-        size_t nRows       = x->getNumberOfRows();
-        size_t nCols       = x->getNumberOfColumns();
-        size_t nBlocks     = ((nThreads < nRows) ? nThreads : 1);
-        size_t sizeOfBlock = nRows / nBlocks + !!(nRows % nBlocks);
-
+        const size_t nRows = x->getNumberOfRows();
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nCols);
         newFIArr.resize(nRows * nCols);
         BinIndexType * newFI = newFIArr.get();
         DAAL_CHECK_MALLOC(newFI);
 
-        const dtrees::internal::IndexedFeatures::IndexType * fi = indexedFeatures.data(0);
-
-        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
-            const size_t iStart = iBlock * sizeOfBlock;
-            const size_t iEnd   = (((iBlock + 1) * sizeOfBlock > nRows) ? nRows : iStart + sizeOfBlock);
-
-            for (size_t i = iStart; i < iEnd; ++i)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nCols; ++j)
-                {
-                    newFI[nCols * i + j] = fi[nRows * j + i];
-                }
-            }
-        });
+        bundles.getBinnedRows(indexedFeatures, newFI);
         storage.newFI = newFI;
     }
 
@@ -536,6 +613,7 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 
             md.add(aTbl[iTree], aTblImp[iTree], aTblSmplCnt[iTree]);
         }
+        services::internal::reportProgress(pHostApp, i + 1);
 
         if ((i + 1 < par.maxIterations) && task.done()) break;
     }
@@ -556,15 +634,16 @@ services::Status computeTypeDisp(HostAppIface * pHostApp, const NumericTable * x
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, CpuType cpu, typename BinIndexType, typename TaskType, typename ResultType>
 services::Status computeImpl(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::internal::ModelImpl & md,
-                             const gbt::training::Parameter & par, engines::internal::BatchBaseImpl & engine, size_t nClasses,
-                             dtrees::internal::IndexedFeatures & indexedFeatures, dtrees::internal::FeatureTypes & featTypes, ResultType * res,
+                             const gbt::internal::ModelImpl * initialModel, const gbt::training::Parameter & par,
+                             engines::internal::BatchBaseImpl & engine, size_t nClasses, dtrees::internal::IndexedFeatures & indexedFeatures,
+                             dtrees::internal::FeatureTypes & featTypes, ResultType * res,
                              algorithmFPType * ptrWeight, algorithmFPType * ptrCover, algorithmFPType * ptrTotalCover, algorithmFPType * ptrGain,
                              algorithmFPType * ptrTotalGain)
 
 {
-    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, par, engine, nClasses, indexedFeatures, featTypes,
-                                                                              res, ptrWeight, ptrCover, ptrTotalCover, ptrGain,
-                                                                              ptrTotalGain); // TODO: remove int
+    return computeTypeDisp<algorithmFPType, int, BinIndexType, cpu, TaskType>(pHostApp, x, y, md, initialModel, par, engine, nClasses,
+                                                                              indexedFeatures, featTypes, res, ptrWeight, ptrCover, ptrTotalCover,
+                                                                              ptrGain, ptrTotalGain); // TODO: remove int
 }
 
 } /* namespace internal */
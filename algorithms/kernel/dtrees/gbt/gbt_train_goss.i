@@ -0,0 +1,229 @@
+/* file: gbt_train_goss.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient-based one-side sampling for gradient boosted trees training
+//  (defaultDense) method.
+//--
+*/
+
+#ifndef __GBT_TRAIN_GOSS_I__
+#define __GBT_TRAIN_GOSS_I__
+
+#include "algorithms/kernel/dtrees/dtrees_train_data_helper.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_train_aux.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+//unsigned integer with the same ordering as the non-negative floating point values of the same size
+template <typename algorithmFPType>
+struct GossKey;
+
+template <>
+struct GossKey<float>
+{
+    typedef unsigned int Type;
+};
+
+template <>
+struct GossKey<double>
+{
+    typedef DAAL_UINT64 Type;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Gradient-based one-side sampling: keeps the rows with the largest absolute gradients,
+// samples the rest uniformly and scales their gradients and hessians to keep the sums unbiased
+//////////////////////////////////////////////////////////////////////////////////////////
+template <typename algorithmFPType, CpuType cpu>
+class GossSampler
+{
+public:
+    typedef gh<algorithmFPType, cpu> ghType;
+    typedef typename GossKey<algorithmFPType>::Type KeyType;
+
+    bool init(size_t nRows)
+    {
+        _aKey.reset(nRows);
+        _aMark.reset(nRows);
+        _aRest.reset(nRows);
+        _aAux.reset(nRows);
+        _aHist.reset(nBlocks(nRows) * _nDigits);
+        return _aKey.get() && _aMark.get() && _aRest.get() && _aAux.get() && _aHist.get();
+    }
+
+    //fills aSampleToF with the rows of the sample in ascending order followed by the rest of the rows,
+    //the sample consists of nTop rows with the largest sums of absolute gradients of the trees and nOther rows sampled from the rest
+    void sample(ghType * aGH, size_t nTrees, size_t nRows, size_t nTop, size_t nOther, void * engineState, int * aSampleToF)
+    {
+        computeKeys(aGH, nTrees, nRows);
+
+        size_t nTies       = 0;
+        const KeyType edge = (nTop ? findKthLargest(nRows, nTop, nTies) : KeyType(0));
+
+        const KeyType * aKey = _aKey.get();
+        char * aMark         = _aMark.get();
+        int * aRest          = _aRest.get();
+        size_t nRest         = 0;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            //the rows with the key equal to the k-th largest one are taken in the order of the rows
+            bool bTop = false;
+            if (nTop)
+            {
+                if (aKey[i] > edge)
+                    bTop = true;
+                else if ((aKey[i] == edge) && nTies)
+                {
+                    bTop = true;
+                    --nTies;
+                }
+            }
+            aMark[i] = char(bTop ? _topMark : _notSampledMark);
+            if (!bTop) aRest[nRest++] = i;
+        }
+        DAAL_ASSERT(nRest + nTop == nRows);
+
+        if (nOther)
+        {
+            dtrees::training::internal::shuffle<cpu>(engineState, nRest, aRest, _aAux.get());
+            for (size_t i = 0; i < nOther; ++i) aMark[aRest[i]] = _otherMark;
+        }
+
+        const algorithmFPType scale = nOther ? algorithmFPType(nRest) / algorithmFPType(nOther) : algorithmFPType(1);
+        size_t iSample              = 0;
+        size_t iNotSampled          = nTop + nOther;
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            if (aMark[i] == _notSampledMark)
+            {
+                aSampleToF[iNotSampled++] = i;
+                continue;
+            }
+            aSampleToF[iSample++] = i;
+            if (aMark[i] == _otherMark)
+            {
+                for (size_t k = 0; k < nTrees; ++k)
+                {
+                    aGH[k * nRows + i].g *= scale;
+                    aGH[k * nRows + i].h *= scale;
+                }
+            }
+        }
+        DAAL_ASSERT(iSample == nTop + nOther);
+    }
+
+private:
+    void computeKeys(const ghType * aGH, size_t nTrees, size_t nRows)
+    {
+        KeyType * aKey       = _aKey.get();
+        const size_t nBlocks = this->nBlocks(nRows);
+        LoopHelper<cpu>::run(nBlocks > 1, nBlocks, [&](size_t iBlock) {
+            const size_t iStart = iBlock * _nRowsInBlock;
+            const size_t iEnd   = (iStart + _nRowsInBlock < nRows ? iStart + _nRowsInBlock : nRows);
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                algorithmFPType sum = 0;
+                for (size_t k = 0; k < nTrees; ++k)
+                {
+                    const algorithmFPType g = aGH[k * nRows + i].g;
+                    sum += (g < 0 ? -g : g);
+                }
+                union
+                {
+                    algorithmFPType val;
+                    KeyType key;
+                } u;
+                u.val   = sum;
+                aKey[i] = u.key;
+            }
+        });
+    }
+
+    //radix select of the k-th largest key, nTies is set to the number of rows with this key belonging to the k largest ones
+    KeyType findKthLargest(size_t nRows, size_t k, size_t & nTies)
+    {
+        DAAL_ASSERT(k && k <= nRows);
+        const KeyType * aKey = _aKey.get();
+        const size_t nBlocks = this->nBlocks(nRows);
+        size_t * aHist       = _aHist.get();
+        KeyType prefix       = 0;
+        KeyType mask         = 0;
+        size_t nLeft         = k;
+        for (int shift = int(sizeof(KeyType) * 8 - _nDigitBits); shift >= 0; shift -= int(_nDigitBits))
+        {
+            services::internal::service_memset<size_t, cpu>(aHist, 0, nBlocks * _nDigits);
+            LoopHelper<cpu>::run(nBlocks > 1, nBlocks, [&](size_t iBlock) {
+                const size_t iStart = iBlock * _nRowsInBlock;
+                const size_t iEnd   = (iStart + _nRowsInBlock < nRows ? iStart + _nRowsInBlock : nRows);
+                size_t * hist       = aHist + iBlock * _nDigits;
+                for (size_t i = iStart; i < iEnd; ++i)
+                {
+                    if ((aKey[i] & mask) == prefix) ++hist[(aKey[i] >> shift) & (_nDigits - 1)];
+                }
+            });
+            size_t * hist = aHist;
+            for (size_t iBlock = 1; iBlock < nBlocks; ++iBlock)
+            {
+                const size_t * blockHist = aHist + iBlock * _nDigits;
+                for (size_t d = 0; d < _nDigits; ++d) hist[d] += blockHist[d];
+            }
+            size_t d = _nDigits - 1;
+            for (; d > 0 && hist[d] < nLeft; --d) nLeft -= hist[d];
+            prefix |= KeyType(d) << shift;
+            mask |= KeyType(_nDigits - 1) << shift;
+        }
+        nTies = nLeft;
+        return prefix;
+    }
+
+    static size_t nBlocks(size_t nRows) { return nRows / _nRowsInBlock + !!(nRows % _nRowsInBlock); }
+
+private:
+    static const size_t _nRowsInBlock = 65536;
+    static const size_t _nDigitBits   = 8;
+    static const size_t _nDigits      = 1 << _nDigitBits;
+    enum
+    {
+        _notSampledMark = 0,
+        _topMark        = 1,
+        _otherMark      = 2
+    };
+
+    TVector<KeyType, cpu> _aKey;
+    TVector<char, cpu> _aMark;
+    TVector<int, cpu> _aRest;
+    TVector<int, cpu> _aAux;
+    TVector<size_t, cpu> _aHist; //histograms of the digits of the keys per block of rows
+};
+
+} /* namespace internal */
+} /* namespace training */
+} /* namespace gbt */
+} /* namespace algorithms */
+} /* namespace daal */
+
+#endif
@@ -74,7 +74,7 @@ public:
                      SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data, size_t iFeature)
     {
         if (featureUnordered)
-            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit);
+            findCategorical(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, data, iFeature);
         else
             findOrdered(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, data, iFeature);
     }
@@ -85,14 +85,26 @@ public:
     {
         const size_t nUnique = res.nUnique;
         auto * aGHSum        = res.ghSums;
-        size_t nLeft         = 0;
 
         ImpurityType imp(res.gTotal, res.hTotal);
+        algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
+
+        //the missing values are in bin 0, so they go to the left child of every split at first
+        scanOrdered(n, minObservationsInLeafNode, lambda, split, imp, aGHSum, 0, nUnique, true, idxFeatureBestSplit, bestImpDecrease);
+        //then the splits sending them to the right child are checked
+        if (data.ctx.dataHelper().indexedFeatures().hasMissing(iFeature) && aGHSum[0].n)
+            scanOrdered(n, minObservationsInLeafNode, lambda, split, imp, aGHSum, 1, nUnique, false, idxFeatureBestSplit, bestImpDecrease);
+        split.impurityDecrease = bestImpDecrease;
+    }
 
+    static void scanOrdered(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ImpurityType & imp,
+                            const GHSumType * aGHSum, size_t iStart, size_t nUnique, bool defaultLeft, DAAL_INT & idxFeatureBestSplit,
+                            algorithmFPType & bestImpDecrease)
+    {
+        size_t nLeft = 0;
         ImpurityType left;
-        algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
 
-        for (size_t i = 0; i < nUnique; ++i)
+        for (size_t i = iStart; i < nUnique; ++i)
         {
             if (!aGHSum[i].n) continue;
             nLeft += aGHSum[i].n;
@@ -107,15 +119,16 @@ public:
             {
                 split.left          = left;
                 split.nLeft         = nLeft;
+                split.defaultLeft   = defaultLeft;
                 idxFeatureBestSplit = i;
                 bestImpDecrease     = impDecrease;
             }
         }
-        split.impurityDecrease = bestImpDecrease;
     }
 
     static void findCategorical(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
-                                DAAL_INT & idxFeatureBestSplit)
+                                DAAL_INT & idxFeatureBestSplit, SharedDataForTree<algorithmFPType, RowIndexType, BinIndexType, cpu> & data,
+                                size_t iFeature)
     {
         const size_t nUnique = res.nUnique;
         auto * aGHSum        = res.ghSums;
@@ -124,7 +137,9 @@ public:
 
         algorithmFPType bestImpDecrease = -services::internal::MaxVal<algorithmFPType>::get();
 
-        for (size_t i = 0; i < nUnique; ++i)
+        const dtrees::internal::IndexedFeatures & indexedFeatures = data.ctx.dataHelper().indexedFeatures();
+        //the missing values are not a category of their own
+        for (size_t i = (indexedFeatures.hasMissing(iFeature) ? 1 : 0); i < nUnique; ++i)
         {
             if ((aGHSum[i].n < minObservationsInLeafNode) || ((n - aGHSum[i].n) < minObservationsInLeafNode)) continue;
             const ImpurityType & left = aGHSum[i];
@@ -142,9 +157,87 @@ public:
             split.left  = (const GHSumType &)aGHSum[idxFeatureBestSplit];
             split.nLeft = aGHSum[idxFeatureBestSplit].n;
         }
+        split.nLeftIndices = 0;
+
+        if (indexedFeatures.hasCategories(iFeature))
+            findCategorySet(n, minObservationsInLeafNode, lambda, split, res, idxFeatureBestSplit, indexedFeatures, iFeature, bestImpDecrease);
 
         split.impurityDecrease = bestImpDecrease;
     }
+
+    //Many-vs-many split of the unordered feature. The categories are sorted by the ratio of their gradient and hessian sums,
+    //the best split sends a prefix of the sorted categories to the left child (both directions of the sorting are checked).
+    //The missing values and the categories not representable in the category set of the model always go to the right child
+    static void findCategorySet(size_t n, size_t minObservationsInLeafNode, algorithmFPType lambda, SplitType & split, const ResultType & res,
+                                DAAL_INT & idxFeatureBestSplit, const dtrees::internal::IndexedFeatures & indexedFeatures, size_t iFeature,
+                                algorithmFPType & bestImpDecrease)
+    {
+        const size_t nUnique = res.nUnique;
+        auto * aGHSum        = res.ghSums;
+
+        TArray<algorithmFPType, cpu> aRatioArr(nUnique);
+        TArray<IndexType, cpu> aIdxArr(nUnique);
+        algorithmFPType * aRatio = aRatioArr.get();
+        IndexType * aIdx         = aIdxArr.get();
+        if (!aRatio || !aIdx) return; //the one-vs-rest split is used then
+
+        size_t nCategories = 0;
+        for (size_t i = 0; i < nUnique; ++i)
+        {
+            if (!aGHSum[i].n) continue;
+            const int category = indexedFeatures.category(iFeature, i);
+            if ((category < 0) || (category >= dtrees::internal::maxCategoryInSet)) continue;
+            aRatio[nCategories] = aGHSum[i].g / (aGHSum[i].h + lambda);
+            aIdx[nCategories]   = IndexType(i);
+            ++nCategories;
+        }
+        //a split of a few categories is found among the one-vs-rest ones
+        if (nCategories <= _maxOneVsRestCategories) return;
+
+        daal::algorithms::internal::qSort<algorithmFPType, IndexType, cpu>(nCategories, aRatio, aIdx);
+
+        ImpurityType imp(res.gTotal, res.hTotal);
+        const size_t nMaxLeft = (nCategories - 1 < size_t(dtrees::internal::maxCategoriesInSet) ? nCategories - 1 :
+                                                                                                size_t(dtrees::internal::maxCategoriesInSet));
+        size_t nBestLeft      = 0;
+        bool bBestReversed    = false;
+        for (size_t iDir = 0; iDir < 2; ++iDir)
+        {
+            size_t nLeft = 0;
+            ImpurityType left;
+            for (size_t k = 0; k < nMaxLeft; ++k)
+            {
+                const IndexType idx = aIdx[iDir ? nCategories - 1 - k : k];
+                nLeft += aGHSum[idx].n;
+                if ((n - nLeft) < minObservationsInLeafNode) break;
+                left.add(aGHSum[idx]);
+                if (nLeft < minObservationsInLeafNode) continue;
+
+                ImpurityType right(imp, left);
+                //the part of the impurity decrease dependent on split itself
+                const algorithmFPType impDecrease = left.value(lambda) + right.value(lambda);
+                if (impDecrease > bestImpDecrease)
+                {
+                    split.left      = left;
+                    split.nLeft     = nLeft;
+                    nBestLeft       = k + 1;
+                    bBestReversed   = (iDir != 0);
+                    bestImpDecrease = impDecrease;
+                }
+            }
+        }
+        //a single category is stored as the one-vs-rest split
+        if (!nBestLeft) return;
+        for (size_t k = 0; k < nBestLeft; ++k) split.aLeftIndices[k] = aIdx[bBestReversed ? nCategories - 1 - k : k];
+        split.nLeftIndices  = (nBestLeft > 1 ? nBestLeft : 0);
+        idxFeatureBestSplit = split.aLeftIndices[0];
+    }
+
+private:
+    enum
+    {
+        _maxOneVsRestCategories = 4 //number of the categories the one-vs-rest splits are enough for
+    };
 };
 
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename GHSumType, CpuType cpu>
@@ -216,6 +309,25 @@ public:
         }
     }
 
+    //the most frequent bin of a bundled feature is not counted by rows, it gets the rest of the totals of the node
+    static void restoreDefaultBin(const size_t nUnique, const size_t iDefault, const algorithmFPType gTotal, const algorithmFPType hTotal,
+                                  const size_t nTotal, GHSumType * const aGHSum)
+    {
+        algorithmFPType g = gTotal;
+        algorithmFPType h = hTotal;
+        algorithmFPType n = algorithmFPType(nTotal);
+        for (size_t i = 0; i < nUnique; ++i)
+        {
+            if (i == iDefault) continue;
+            g -= aGHSum[i].g;
+            h -= aGHSum[i].h;
+            n -= aGHSum[i].n;
+        }
+        aGHSum[iDefault].g = g;
+        aGHSum[iDefault].h = h;
+        aGHSum[iDefault].n = n;
+    }
+
     static void fillByZero(const size_t nUnique, GHSumType * const aGHSum)
     {
         services::internal::service_memset_seq<algorithmFPType, cpu>((algorithmFPType *)aGHSum, algorithmFPType(0), nUnique * 4);
@@ -273,6 +385,58 @@ struct ComputeGHSumByRows
     }
 };
 
+// Histograms of several trees built on the same rows, e.g. the roots of the per-class trees of one iteration.
+// The bins of the columns [iColStart, iColEnd) are accumulated in one pass over the rows into aBuf, where the sums of all the trees
+// are interleaved per bin (g0, h0, ..., g[nTrees-1], h[nTrees-1], n), and are then scattered to the histograms of the trees
+template <typename RowIndexType, typename BinIndexType, typename algorithmFPType, CpuType cpu>
+struct ComputeGHSumsForTrees
+{
+    static void run(algorithmFPType * aGHSums, algorithmFPType * aBuf, algorithmFPType * aRowGH, const BinIndexType * indexedFeature,
+                    const RowIndexType * aIdx, const algorithmFPType * pgh, size_t nRowsGH, size_t nTrees, size_t nRows, size_t nCols,
+                    size_t iColStart, size_t iColEnd, const size_t * UniquesArr, size_t nUnique)
+    {
+        const size_t nGH      = 2 * nTrees;
+        const size_t stride   = nGH + 1;
+        const size_t binStart = UniquesArr[iColStart];
+        const size_t binEnd   = (iColEnd < nCols) ? UniquesArr[iColEnd] : nUnique;
+
+        services::internal::service_memset_seq<algorithmFPType, cpu>(aBuf, algorithmFPType(0), (binEnd - binStart) * stride);
+
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            const size_t iRow = aIdx ? aIdx[i] : i;
+            for (size_t k = 0; k < nTrees; ++k)
+            {
+                aRowGH[2 * k]     = pgh[2 * (k * nRowsGH + iRow)];
+                aRowGH[2 * k + 1] = pgh[2 * (k * nRowsGH + iRow) + 1];
+            }
+
+            const BinIndexType * featIdx = indexedFeature + iRow * nCols;
+            for (size_t j = iColStart; j < iColEnd; ++j)
+            {
+                algorithmFPType * bin = aBuf + stride * (UniquesArr[j] - binStart + (size_t)featIdx[j]);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k < nGH; ++k) bin[k] += aRowGH[k];
+                bin[nGH] += algorithmFPType(1);
+            }
+        }
+
+        for (size_t b = binStart; b < binEnd; ++b)
+        {
+            const algorithmFPType * bin = aBuf + stride * (b - binStart);
+            for (size_t k = 0; k < nTrees; ++k)
+            {
+                algorithmFPType * dst = aGHSums + 4 * (k * nUnique + b);
+                dst[0]                = bin[2 * k];
+                dst[1]                = bin[2 * k + 1];
+                dst[2]                = bin[nGH];
+                dst[3]                = algorithmFPType(0);
+            }
+        }
+    }
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 struct MergeGHSums
 {
@@ -63,7 +63,7 @@ public:
     {
         if (iFeature >= 0)
         {
-            typename NodeType::Split * res = makeSplit(iFeature, _split.featureValue, _split.featureUnordered);
+            typename NodeType::Split * res = makeSplit(iFeature, _split.featureValue, _split.featureUnordered, _split.defaultLeft);
             _node.res                      = res;
             res->kid[0]                    = buildLeaf(_node.iStart, _split.nLeft, _node.level + 1, _split.left);
 
@@ -160,21 +160,58 @@ protected:
         return pNode;
     }
 
-    typename NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered)
+    typename NodeType::Split * makeSplit(size_t iFeature, algorithmFPType featureValue, bool bUnordered, bool bDefaultLeft)
     {
-        typename NodeType::Split * pNode = nullptr;
+        typename NodeType::Split * pNode          = nullptr;
+        dtrees::internal::CategorySetWord * aSet = nullptr;
+        const size_t nSetWords                   = (_split.nLeftIndices ? categorySetSize(iFeature) : 0);
         if (_data.ctx.isThreaded())
         {
             _data.mtAlloc.lock();
             pNode = _data.tree.allocator().allocSplit();
+            if (nSetWords) aSet = _data.tree.allocator().allocCategorySet(nSetWords);
             _data.mtAlloc.unlock();
         }
         else
+        {
             pNode = _data.tree.allocator().allocSplit();
-        pNode->set(iFeature, featureValue, bUnordered);
+            if (nSetWords) aSet = _data.tree.allocator().allocCategorySet(nSetWords);
+        }
+        pNode->set(iFeature, featureValue, bUnordered, bDefaultLeft);
+        if (nSetWords)
+        {
+            DAAL_ASSERT(aSet);
+            if (aSet) pNode->categorySet = fillCategorySet(iFeature, aSet, nSetWords);
+        }
         return pNode;
     }
 
+    //size of the category set of the many-vs-many split in words, the bitset covers the category values up to the maximal one going left
+    size_t categorySetSize(size_t iFeature) const
+    {
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        int maxCategory                                          = 0;
+        for (size_t i = 0; i < _split.nLeftIndices; ++i)
+        {
+            const int category = indexedFeatures.category(iFeature, _split.aLeftIndices[i]);
+            if (maxCategory < category) maxCategory = category;
+        }
+        return (size_t(maxCategory) >> 5) + 2;
+    }
+
+    const dtrees::internal::CategorySetWord * fillCategorySet(size_t iFeature, dtrees::internal::CategorySetWord * aSet, size_t nSetWords) const
+    {
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _data.ctx.dataHelper().indexedFeatures();
+        services::internal::service_memset_seq<dtrees::internal::CategorySetWord, cpu>(aSet, 0, nSetWords);
+        aSet[0] = dtrees::internal::CategorySetWord(nSetWords - 1);
+        for (size_t i = 0; i < _split.nLeftIndices; ++i)
+        {
+            const int category = indexedFeatures.category(iFeature, _split.aLeftIndices[i]);
+            aSet[1 + (category >> 5)] |= (1u << (category & 31));
+        }
+        return aSet;
+    }
+
     DataType & _data;
     SplitDataType & _split;
     NodeInfoType & _node;
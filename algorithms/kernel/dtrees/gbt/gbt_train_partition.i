@@ -141,22 +141,36 @@ protected:
         DAAL_ASSERT(_bestSplit.nLeft > 0);
         const DAAL_INT iRowSplitVal = doPartition(n, iStart, _bestSplit, _iFeature, _idxFeatureValueBestSplit);
         DAAL_ASSERT(iRowSplitVal >= 0);
-        _bestSplit.iStart = 0;
-        if (_sharedData.ctx.dataHelper().indexedFeatures().isBinned(_iFeature))
-            _bestSplit.featureValue =
-                (algorithmFPType)_sharedData.ctx.dataHelper().indexedFeatures().binRightBorder(_iFeature, _idxFeatureValueBestSplit);
-        else
-            _bestSplit.featureValue = _sharedData.ctx.dataHelper().getValue(_iFeature, iRowSplitVal);
+        _bestSplit.iStart       = 0;
+        _bestSplit.featureValue = _sharedData.ctx.dataHelper().getSplitValue(_iFeature, iRowSplitVal, _idxFeatureValueBestSplit);
     }
 
     DAAL_INT doPartition(size_t n, size_t iStart, SplitDataType & split, DAAL_INT iFeature, size_t idxFeatureValueBestSplit)
     {
-        return doPartitionIdx(n, _sharedData.aIdx + iStart, _sharedData.ctx.dataHelper().indexedFeatures().data(iFeature), split.featureUnordered,
-                              idxFeatureValueBestSplit, _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
+        //the missing values are in bin 0, they go to the right child only if the split learned so
+        const RowIndexType missingRight = !split.featureUnordered && !split.defaultLeft;
+        const dtrees::internal::IndexedFeatures & indexedFeatures = _sharedData.ctx.dataHelper().indexedFeatures();
+
+        //the indices of the categories going to the left child of the many-vs-many split are looked up in a bitset
+        TArrayCalloc<dtrees::internal::CategorySetWord, cpu> leftIndices;
+        if (split.nLeftIndices)
+        {
+            const size_t nWords = (size_t(indexedFeatures.numIndices(iFeature)) >> 5) + 1;
+            leftIndices.reset(nWords + 1);
+            if (leftIndices.get())
+            {
+                dtrees::internal::CategorySetWord * aSet = leftIndices.get();
+                aSet[0]                                  = dtrees::internal::CategorySetWord(nWords);
+                for (size_t i = 0; i < split.nLeftIndices; ++i) aSet[1 + (split.aLeftIndices[i] >> 5)] |= (1u << (split.aLeftIndices[i] & 31));
+            }
+        }
+        return doPartitionIdx(n, _sharedData.aIdx + iStart, indexedFeatures.data(iFeature), split.featureUnordered, idxFeatureValueBestSplit,
+                              missingRight, split, leftIndices.get(), _sharedData.bestSplitIdxBuf + (2 * iStart), split.nLeft);
     }
 
     DAAL_INT doPartitionIdx(IndexType n, RowIndexType * aIdx, const RowIndexType * indexedFeature, bool featureUnordered,
-                            RowIndexType idxFeatureValueBestSplit, RowIndexType * buffer, RowIndexType nLeft)
+                            RowIndexType idxFeatureValueBestSplit, RowIndexType missingRight, const SplitDataType & split,
+                            const dtrees::internal::CategorySetWord * leftIndices, RowIndexType * buffer, RowIndexType nLeft)
     {
         DAAL_INT iRowSplitVal = -1;
 
@@ -183,7 +197,31 @@ protected:
             RowIndexType * bestSplitIdx      = buffer + 2 * iStart;
             RowIndexType * bestSplitIdxRight = bestSplitIdx + iEnd - iStart;
 
-            if (featureUnordered)
+            if (leftIndices)
+            {
+                for (IndexType i = iStart; i < iEnd; ++i)
+                {
+                    if (!dtrees::internal::isInCategorySet(leftIndices, indexedFeature[aIdx[i]]))
+                        bestSplitIdxRight[iRight++] = aIdx[i];
+                    else
+                        bestSplitIdx[iLeft++] = aIdx[i];
+                }
+            }
+            else if (split.nLeftIndices)
+            {
+                //the bitset is not allocated, the indices are looked up in the list
+                for (IndexType i = iStart; i < iEnd; ++i)
+                {
+                    const RowIndexType idx = indexedFeature[aIdx[i]];
+                    bool bLeft             = false;
+                    for (size_t k = 0; k < split.nLeftIndices; ++k) bLeft |= (idx == split.aLeftIndices[k]);
+                    if (!bLeft)
+                        bestSplitIdxRight[iRight++] = aIdx[i];
+                    else
+                        bestSplitIdx[iLeft++] = aIdx[i];
+                }
+            }
+            else if (featureUnordered)
             {
                 PRAGMA_IVDEP
                 PRAGMA_VECTOR_ALWAYS
@@ -201,7 +239,8 @@ protected:
                 PRAGMA_VECTOR_ALWAYS
                 for (IndexType i = iStart; i < iEnd; ++i)
                 {
-                    if (indexedFeature[aIdx[i]] > idxFeatureValueBestSplit)
+                    const RowIndexType idx = indexedFeature[aIdx[i]];
+                    if ((idx > idxFeatureValueBestSplit) | ((idx == 0) & missingRight))
                         bestSplitIdxRight[iRight++] = aIdx[i];
                     else
                         bestSplitIdx[iLeft++] = aIdx[i];
@@ -179,11 +179,19 @@ public:
         _res1.iFeature = _iFeature;
         _res1.nUnique  = nUnique;
 
-        const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
+        const size_t iStart = _data.GH_SUMS_BUF->featureStart[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
 
+        const int iDefault = _data.GH_SUMS_BUF->defaultBin[_iFeature];
+        if (iDefault >= 0)
+        {
+            GHSums::restoreDefaultBin(nUnique, iDefault, _node1.imp.g, _node1.imp.h, _node1.n, _res1.ghSums);
+            _res1.gTotal = _node1.imp.g;
+            _res1.hTotal = _node1.imp.h;
+        }
+
         daal::threader_for(2, 2, [&](size_t iBlock) {
             if (iBlock == 0)
             {
@@ -299,11 +307,19 @@ public:
         _res1.iFeature = _iFeature;
         _res1.nUnique  = nUnique;
 
-        const size_t iStart = _data.GH_SUMS_BUF->nUniquesArr[_iFeature];
+        const size_t iStart = _data.GH_SUMS_BUF->featureStart[_iFeature];
         const size_t iEnd   = iStart + nUnique;
 
         MergeGHSums<algorithmFPType, RowIndexType, BinIndexType, cpu>::run(nUnique, iStart, iEnd, _results, _size, _res1);
 
+        const int iDefault = _data.GH_SUMS_BUF->defaultBin[_iFeature];
+        if (iDefault >= 0)
+        {
+            GHSums::restoreDefaultBin(nUnique, iDefault, _node1.imp.g, _node1.imp.h, _node1.n, _res1.ghSums);
+            _res1.gTotal = _node1.imp.g;
+            _res1.hTotal = _node1.imp.h;
+        }
+
         // TODO: check for hasDiffFeatureValues()
 
         const bool featureUnordered = _data.ctx.featTypes().isUnordered(_iFeature);
@@ -356,7 +372,7 @@ public:
     {
         const BinIndexType * indexedFeature = _data.GH_SUMS_BUF->newFI;
         int * aIdx                          = _data.aIdx;
-        const RowIndexType nFeatures        = _data.ctx.nFeatures();
+        const RowIndexType nCols            = _data.GH_SUMS_BUF->nCols;
 
         const size_t iStart = _iBlock * _blockSize + _node.iStart;
         const size_t iEnd   = (((_iBlock + 1) * _blockSize > _node.n) ? _node.iStart + _node.n : iStart + _blockSize);
@@ -372,7 +388,7 @@ public:
         }
 
         algorithmFPType * pgh = (algorithmFPType *)_data.ctx.grad(_data.iTree);
-        ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nFeatures, iStart, iEnd,
+        ComputeGHSumByRows<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(aGHSumFP, indexedFeature, aIdx, pgh, nCols, iStart, iEnd,
                                                                                   _node.iStart + _node.n, _data.GH_SUMS_BUF->nUniquesArr.get());
         return nullptr;
     }
@@ -385,6 +401,48 @@ protected:
     TlsType * _res;
 };
 
+// Computes the root histograms of nTrees trees grown on the same rows with one pass over the binned data.
+// The columns are split into blocks processed in parallel, so the histograms need no reduction
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+services::Status computeRootGHSums(GlobalStorages<algorithmFPType, BinIndexType, cpu> & GH_SUMS_BUF, const algorithmFPType * pgh, size_t nRowsGH,
+                                   size_t nTrees, const RowIndexType * aIdx, size_t nRows)
+{
+    GH_SUMS_BUF.nRootGHSums  = 0;
+    const size_t nUnique     = GH_SUMS_BUF.nDiffFeatMax;
+    const size_t nCols       = GH_SUMS_BUF.nCols;
+    const size_t * aUniques  = GH_SUMS_BUF.nUniquesArr.get();
+    const size_t colsInLine  = 64 / sizeof(BinIndexType);
+    const size_t nThreads    = threader_get_threads_number();
+    const size_t blockSize   = services::internal::max<cpu, size_t>(colsInLine, nCols / nThreads + !!(nCols % nThreads));
+    const size_t nBlocks     = nCols / blockSize + !!(nCols % blockSize);
+    const size_t sizeOfBlock = 4 * nUnique * nTrees;
+
+    if (GH_SUMS_BUF.rootGHSums.size() < sizeOfBlock)
+    {
+        GH_SUMS_BUF.rootGHSums.reset(sizeOfBlock);
+        DAAL_CHECK_MALLOC(GH_SUMS_BUF.rootGHSums.get());
+    }
+
+    daal::SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iColStart = iBlock * blockSize;
+        const size_t iColEnd   = services::internal::min<cpu, size_t>(nCols, iColStart + blockSize);
+        const size_t binEnd    = (iColEnd < nCols) ? aUniques[iColEnd] : nUnique;
+
+        TArray<algorithmFPType, cpu> aBuf((binEnd - aUniques[iColStart]) * (2 * nTrees + 1));
+        TArray<algorithmFPType, cpu> aRowGH(2 * nTrees);
+        DAAL_CHECK_MALLOC_THR(aBuf.get() && aRowGH.get());
+
+        ComputeGHSumsForTrees<RowIndexType, BinIndexType, algorithmFPType, cpu>::run(GH_SUMS_BUF.rootGHSums.get(), aBuf.get(), aRowGH.get(),
+                                                                                    GH_SUMS_BUF.newFI, aIdx, pgh, nRowsGH, nTrees, nRows, nCols,
+                                                                                    iColStart, iColEnd, aUniques, nUnique);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    GH_SUMS_BUF.nRootGHSums = nTrees;
+    return services::Status();
+}
+
 } /* namespace hist */
 } /* namespace internal */
 } /* namespace training */
@@ -34,6 +34,7 @@
 #include "algorithms/kernel/dtrees/gbt/gbt_train_split_sorting.i"
 #include "algorithms/kernel/dtrees/gbt/gbt_train_node_creator.i"
 #include "algorithms/kernel/dtrees/gbt/gbt_train_updater.i"
+#include "algorithms/kernel/service_heap.h"
 
 namespace daal
 {
@@ -232,13 +233,19 @@ protected:
         {
             using Mode    = MemorySafetySplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else if (_ctx.par().splitMethod == gbt::training::exact || _ctx.nFeatures() != _ctx.nFeaturesPerNode())
         {
             using Mode    = ExactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
             using Updater = UpdaterByColumns<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
-            buildSplit(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+            buildTree(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
+        }
+        else if (isLeafWise())
+        {
+            using Mode    = InexactLeafWiseSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+            using Updater = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, Mode, cpu>;
+            buildLeafWise(new (service_scalable_calloc<Updater, cpu>(1)) Updater(data, job));
         }
         else
         {
@@ -327,6 +334,30 @@ protected:
     }
     void buildSplit(GbtTask * task);
 
+    bool isLeafWise() const { return _ctx.par().growthPolicy == gbt::training::leafWise; }
+    void buildTree(GbtTask * root)
+    {
+        if (isLeafWise())
+            buildLeafWise(root);
+        else
+            buildSplit(root);
+    }
+
+    //node waiting for its split in the leaf-wise growth
+    struct LeafCandidate
+    {
+        GbtTask * task;
+        double gain;
+        size_t order; //makes the order of the splits with equal gains deterministic
+    };
+    static bool isLessPromising(const LeafCandidate & a, const LeafCandidate & b)
+    {
+        return (a.gain < b.gain) || ((a.gain == b.gain) && (a.order > b.order));
+    }
+    void buildLeafWise(GbtTask * root);
+    void addLeafCandidate(GbtTask * task, LeafCandidate * aCandidate, size_t & nCandidates, size_t & order, bool bSplitAllowed);
+    void finalizeLeaf(GbtTask * task);
+
 protected:
     CommonCtx & _ctx;
     size_t _iTree = 0;
@@ -378,7 +409,7 @@ services::Status TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::
     typename NodeType::Base * nd = buildRoot(iTree, GH_SUMS_BUF);
     DAAL_CHECK_MALLOC(nd);
 
-    _tree.reset(nd, false);
+    _tree.reset(nd, _ctx.featTypes().hasUnorderedFeatures());
     services::Status status = gbt::internal::ModelImpl::treeToTable(_tree, &pRes, &pTblImp, &pTblSmplCnt, _ctx.nFeatures());
     DAAL_CHECK_STATUS_VAR(status)
 
@@ -417,6 +448,76 @@ void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildSplit(G
     }
 }
 
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::buildLeafWise(GbtTask * root)
+{
+    const size_t maxLeaves = _ctx.par().maxLeaves;
+    //the candidates are not split nodes having disjoint sets of at least 2*minObservationsInLeafNode observations
+    size_t maxCandidates = _ctx.nSamples() / (2 * _ctx.par().minObservationsInLeafNode) + 1;
+    if (maxLeaves && maxLeaves < maxCandidates) maxCandidates = maxLeaves;
+
+    TArray<LeafCandidate, cpu> aCandidate(maxCandidates);
+    if (!aCandidate.get())
+    {
+        //no memory for the queue, the tree is grown depth-wise
+        buildSplit(root);
+        return;
+    }
+
+    size_t nCandidates = 0;
+    size_t order       = 0;
+    size_t nLeaves     = 1;
+    addLeafCandidate(root, aCandidate.get(), nCandidates, order, !maxLeaves || nLeaves < maxLeaves);
+    while (nCandidates)
+    {
+        daal::algorithms::internal::popMaxHeap<cpu>(aCandidate.get(), aCandidate.get() + nCandidates, isLessPromising);
+        GbtTask * task = aCandidate[--nCandidates].task;
+        if (maxLeaves && nLeaves >= maxLeaves)
+        {
+            task->cancelNodeSplit();
+            finalizeLeaf(task);
+            continue;
+        }
+        task->applyNodeSplit();
+        ++nLeaves;
+
+        GbtTask * newTasks[2];
+        size_t nTasks = 0;
+        task->getNextTasks(newTasks, nTasks); // returns 0, 1 or 2 tasks
+        task->~GbtTask();
+        service_scalable_free<GbtTask, cpu>(task);
+
+        for (size_t i = 0; i < nTasks; ++i)
+            addLeafCandidate(newTasks[i], aCandidate.get(), nCandidates, order, !maxLeaves || nLeaves < maxLeaves);
+    }
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::addLeafCandidate(GbtTask * task, LeafCandidate * aCandidate, size_t & nCandidates,
+                                                                                    size_t & order, bool bSplitAllowed)
+{
+    double gain = 0;
+    if (bSplitAllowed && task->findNodeSplit(gain))
+    {
+        aCandidate[nCandidates++] = { task, gain, order++ };
+        daal::algorithms::internal::pushMaxHeap<cpu>(aCandidate, aCandidate + nCandidates, isLessPromising);
+        return;
+    }
+    task->cancelNodeSplit();
+    finalizeLeaf(task);
+}
+
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+void TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::finalizeLeaf(GbtTask * task)
+{
+    GbtTask * newTasks[2];
+    size_t nTasks = 0;
+    task->getNextTasks(newTasks, nTasks); // makes the leaf, no tasks
+    DAAL_ASSERT(!nTasks);
+    task->~GbtTask();
+    service_scalable_free<GbtTask, cpu>(task);
+}
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
 TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu> * TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::create(CommonCtx & ctx)
 {
@@ -90,6 +90,19 @@ public:
     using NodesCreatorType  = MergedNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, MergedUpdaterType, cpu>;
 };
 
+//inexact split mode of the leaf-wise growth: the kids of a node are not processed together
+//as they are not necessarily split one after another
+template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, CpuType cpu>
+struct InexactLeafWiseSplitMode : public InexactSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>
+{
+protected:
+    using ThisType    = InexactLeafWiseSplitMode<algorithmFPType, RowIndexType, BinIndexType, cpu>;
+    using UpdaterType = UpdaterByRows<algorithmFPType, RowIndexType, BinIndexType, ThisType, cpu>;
+
+public:
+    using NodesCreatorType = DefaultNodesCreator<algorithmFPType, RowIndexType, BinIndexType, UpdaterType, cpu>;
+};
+
 template <typename algorithmFPType, typename RowIndexType, typename BinIndexType, typename SplitMode, CpuType cpu>
 class UpdaterBase : public GbtTask
 {
@@ -105,24 +118,35 @@ public:
     using SplitDataType     = SplitData<algorithmFPType, ImpurityType>;
     using BestSplitType     = typename TreeBuilder<algorithmFPType, RowIndexType, BinIndexType, cpu>::BestSplit;
 
-    UpdaterBase(DataType & data, NodeInfoType & node) : _data(data), _node(node), _iFeature(-1) {}
+    UpdaterBase(DataType & data, NodeInfoType & node) : _data(data), _node(node), _iFeature(-1), _idxFeatureValueBestSplit(-1), _result(nullptr)
+    {}
 
     virtual ~UpdaterBase() {}
 
     virtual GbtTask * execute() DAAL_C11_OVERRIDE
     {
-        DAAL_INT idxFeatureValueBestSplit = -1; //when sorted feature is used
-        findBestSplit(_bestSplit, _iFeature, idxFeatureValueBestSplit);
+        double gain;
+        if (findNodeSplit(gain)) // best split has been found
+            applyNodeSplit();
+        return nullptr;
+    }
 
-        if (_iFeature >= 0) // best split has been found
-        {
-            PartitionTaskType partion(_iFeature, idxFeatureValueBestSplit, _data, _node, _bestSplit);
-            partion.execute();
-        }
+    virtual bool findNodeSplit(double & gain) DAAL_C11_OVERRIDE
+    {
+        _idxFeatureValueBestSplit = -1; //when sorted feature is used
+        findBestSplit(_bestSplit, _iFeature, _idxFeatureValueBestSplit);
+        gain = _bestSplit.impurityDecrease;
+        return _iFeature >= 0;
+    }
 
-        return nullptr;
+    virtual void applyNodeSplit() DAAL_C11_OVERRIDE
+    {
+        PartitionTaskType partion(_iFeature, _idxFeatureValueBestSplit, _data, _node, _bestSplit);
+        partion.execute();
     }
 
+    virtual void cancelNodeSplit() DAAL_C11_OVERRIDE { _iFeature = -1; }
+
     virtual void getNextTasks(GbtTask ** newTasks, size_t & nTasks) DAAL_C11_OVERRIDE
     {
         NodesCreatorType kidsCreator(_data, _bestSplit, _node, _result);
@@ -171,6 +195,7 @@ protected:
     DataType & _data;
     NodeInfoType _node;
     DAAL_INT _iFeature;
+    DAAL_INT _idxFeatureValueBestSplit;
     SplitDataType _bestSplit;
     MergedResultType * _result;
 };
@@ -206,6 +231,18 @@ public:
 protected:
     virtual void findSplit(const RowIndexType * featureSample, typename super::BestSplitType & bestSplit) DAAL_C11_OVERRIDE
     {
+        algorithmFPType * rootGHSum = this->_node.level ? nullptr : this->_data.GH_SUMS_BUF->rootGHSum(this->_data.iTree);
+        if (rootGHSum) // histogram of the root is computed together with the ones of the other trees of the iteration
+        {
+            LoopHelper<cpu>::run(true, this->_data.ctx.nFeaturesPerNode(), [&](size_t i) {
+                const DAAL_INT iFeature = featureSample ? featureSample[i] : i;
+                DAAL_TYPENAME SplitMode::FindBestSplitTask task(iFeature, 1, this->_data, this->_node, bestSplit, this->_result->res[i], &rootGHSum,
+                                                                1);
+                task.execute();
+            });
+            return;
+        }
+
         const size_t nRows       = this->_node.n;
         const size_t sizeOfBlock = 2048;
         size_t nBlocks           = nRows / sizeOfBlock;
@@ -0,0 +1,82 @@
+/* file: gbt_training_memory_estimate.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Estimate of the memory allocated by the gradient boosted trees training in the batch processing mode
+//--
+*/
+
+#include "algorithms/gradient_boosted_trees/gbt_training_parameter.h"
+#include "algorithms/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+/* Approximate size of a node of the tree under construction and of the model */
+const size_t nodeSize = 32;
+
+size_t estimateMemorySize(size_t nRows, size_t nFeatures, size_t nClasses, const Parameter & parameter, size_t fpSize)
+{
+    const size_t nThreads   = daal::threader_get_threads_number();
+    const size_t nTrees     = (nClasses > 2) ? nClasses : 1; /* Trees built per iteration */
+    const bool bGoss        = (parameter.samplingMethod == goss);
+    const size_t nSamples   = bGoss ? (size_t)(nRows * parameter.gossTopFraction) + (size_t)(nRows * parameter.gossOtherFraction) :
+                                    (size_t)(nRows * parameter.observationsPerTreeFraction);
+    const size_t minLeafObs = parameter.minObservationsInLeafNode ? parameter.minObservationsInLeafNode : 1;
+    const size_t nBins      = (parameter.splitMethod == inexact && parameter.maxBins && parameter.maxBins < nRows) ? parameter.maxBins : nRows;
+
+    /* Indexed or binned features and the boundaries of the bins */
+    size_t size = parameter.memorySavingMode ? 0 : nRows * nFeatures * sizeof(int) + nFeatures * nBins * fpSize;
+
+    /* Responses, current predictions, gradients and hessians of all the trees of an iteration and the sample mapping */
+    size += nRows * (fpSize + 3 * nTrees * fpSize) + (nSamples < nRows ? nRows * sizeof(int) : 0);
+
+    /* Keys, marks and row lists of the gradient-based sampling */
+    if (bGoss && nSamples < nRows) size += nRows * (fpSize + 1 + 2 * sizeof(int));
+
+    /* Samples and split buffers of the tree builders */
+    size += nTrees * nSamples * 3 * sizeof(int);
+
+    /* Per-thread histograms of the gradients and hessians or the sorted feature values for the exact split method */
+    if (parameter.splitMethod == inexact) size += nThreads * nFeatures * nBins * 2 * fpSize;
+    else size += nThreads * nSamples * 2 * (fpSize + sizeof(int));
+
+    /* Nodes of the trees, bounded both by the depth and by the minimal number of observations in a leaf */
+    size_t nNodes = 2 * nSamples / minLeafObs + 1;
+    if (parameter.maxTreeDepth && parameter.maxTreeDepth < 8 * sizeof(size_t) - 1)
+    {
+        const size_t nNodesByDepth = ((size_t)1 << (parameter.maxTreeDepth + 1)) - 1;
+        if (nNodesByDepth < nNodes) nNodes = nNodesByDepth;
+    }
+    size += parameter.maxIterations * nTrees * nNodes * nodeSize;
+
+    return size;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
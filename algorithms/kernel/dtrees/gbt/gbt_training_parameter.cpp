@@ -54,7 +54,12 @@ Parameter::Parameter()
       engine(engines::mt19937::Batch<>::create()),
       minBinSize(5),
       maxBins(256),
-      internalOptions(gbt::internal::parallelAll)
+      internalOptions(gbt::internal::parallelAll),
+      growthPolicy(defaultGrowthPolicy),
+      maxLeaves(0),
+      samplingMethod(defaultSampling),
+      gossTopFraction(0.2),
+      gossOtherFraction(0.1)
 {}
 
 Status checkImpl(const gbt::training::Parameter & prm)
@@ -71,6 +76,16 @@ Status checkImpl(const gbt::training::Parameter & prm)
         DAAL_CHECK_EX((prm.maxBins >= 2), ErrorIncorrectParameter, ParameterName, maxBinsStr());
         DAAL_CHECK_EX((prm.minBinSize >= 1), ErrorIncorrectParameter, ParameterName, minBinSizeStr());
     }
+    if (prm.growthPolicy == leafWise)
+    {
+        DAAL_CHECK_EX((prm.maxLeaves != 1), ErrorIncorrectParameter, ParameterName, maxLeavesStr());
+    }
+    if (prm.samplingMethod == goss)
+    {
+        DAAL_CHECK_EX((prm.gossTopFraction >= 0) && (prm.gossTopFraction < 1), ErrorIncorrectParameter, ParameterName, gossTopFractionStr());
+        DAAL_CHECK_EX((prm.gossOtherFraction > 0) && (prm.gossTopFraction + prm.gossOtherFraction <= 1), ErrorIncorrectParameter, ParameterName,
+                      gossOtherFractionStr());
+    }
     return Status();
 }
 
@@ -0,0 +1,166 @@
+/* file: gbt_tree_builder_oneapi.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that builds the trees of gradient boosted trees
+//  on GPU for the given gradients and hessians of the loss function.
+//--
+*/
+
+#ifndef __GBT_TREE_BUILDER_ONEAPI_H__
+#define __GBT_TREE_BUILDER_ONEAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/gradient_boosted_trees/gbt_training_parameter.h"
+#include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
+#include "algorithms/kernel/dtrees/gbt/regression/gbt_regression_tree_impl.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Builds one tree per call for the gradients and hessians of the loss function stored in optCoeffs.
+ * The histogram of a node is computed only for the smaller of the two children of the split,
+ * the histogram of its sibling is obtained by the subtraction from the histogram of the parent.
+ */
+template <typename algorithmFPType>
+class TreeBuilderOneAPI
+{
+public:
+    typedef gbt::regression::internal::TreeTableConnector<algorithmFPType> ConnectorType;
+    typedef gbt::regression::internal::TableRecord<algorithmFPType> TableRecordType;
+    typedef gbt::regression::internal::SplitRecord<algorithmFPType> SplitRecordType;
+
+    TreeBuilderOneAPI() : _indexedFeatures(nullptr), _par(nullptr), _nRows(0) {}
+
+    services::Status init(gbt::internal::IndexedFeaturesOneAPI<algorithmFPType> & indexedFeatures, size_t nRows,
+                          const gbt::training::Parameter & par);
+
+    /* Builds the tree and adds it to the model, responses of the leaves multiplied by the shrinkage are added
+       to response[responseOffset + i] for the rows of the leaves */
+    services::Status buildTree(oneapi::internal::UniversalBuffer & optCoeffs, oneapi::internal::UniversalBuffer & response, size_t responseOffset,
+                               algorithmFPType initResponse, gbt::internal::ModelImpl & model);
+
+private:
+    services::Status initializeTreeOrder(size_t nRows, oneapi::internal::UniversalBuffer & treeOrder);
+
+    services::Status computePartialHistograms(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
+                                              oneapi::internal::UniversalBuffer & optCoeffs, oneapi::internal::UniversalBuffer & partialHistograms,
+                                              size_t iStart, size_t nRows, oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins,
+                                              size_t nFeatures, size_t localSize, size_t nPartialHistograms);
+
+    services::Status reducePartialHistograms(oneapi::internal::UniversalBuffer & partialHistograms, oneapi::internal::UniversalBuffer & histograms,
+                                             size_t nTotalBins, size_t reduceLocalSize, size_t nPartialHistograms);
+
+    services::Status computeHistogram(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
+                                      oneapi::internal::UniversalBuffer & optCoeffs, oneapi::internal::UniversalBuffer & partialHistograms,
+                                      oneapi::internal::UniversalBuffer & histograms, size_t iStart, size_t nRows,
+                                      oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures);
+
+    services::Status computeHistogramDiff(oneapi::internal::UniversalBuffer & histogramSrc, oneapi::internal::UniversalBuffer & histogramTotal,
+                                          oneapi::internal::UniversalBuffer & histogramDst, size_t nBins);
+
+    services::Status computeTotalOptCoeffs(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & totalOptCoeffs,
+                                           oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures, size_t localSize);
+
+    services::Status computeBestSplitForFeatures(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & totalOptCoeffs,
+                                                 oneapi::internal::UniversalBuffer & splitInfo, oneapi::internal::UniversalBuffer & splitValue,
+                                                 oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures,
+                                                 algorithmFPType lambda, size_t localSize);
+
+    services::Status computeBestSplit(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & binOffsets,
+                                      size_t nTotalBins, size_t nFeatures, algorithmFPType lambda,
+                                      gbt::internal::BestSplitOneAPI<algorithmFPType> & bestSplit, algorithmFPType * gTotal = nullptr,
+                                      algorithmFPType * hTotal = nullptr);
+
+    services::Status partitionScan(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
+                                   oneapi::internal::UniversalBuffer & partialSums, int splitValue, size_t iStart, size_t nRows, size_t localSize,
+                                   size_t nLocalSums);
+
+    services::Status partitionSumScan(oneapi::internal::UniversalBuffer & partialSums, oneapi::internal::UniversalBuffer & partialPrefixSums,
+                                      oneapi::internal::UniversalBuffer & totalSum, size_t localSize, size_t nSubgroupSums);
+
+    services::Status partitionReorder(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
+                                      oneapi::internal::UniversalBuffer & treeOrderBuf, oneapi::internal::UniversalBuffer & partialPrefixSums,
+                                      int spliteValue, size_t iStart, size_t nRows, size_t localSize, size_t nLocalSums);
+
+    services::Status partitionCopy(oneapi::internal::UniversalBuffer & treeOrderBuf, oneapi::internal::UniversalBuffer & treeOrder, size_t iStart,
+                                   size_t nRows);
+
+    services::Status doPartition(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
+                                 oneapi::internal::UniversalBuffer & treeOrderBuf, int splitValue, size_t iStart, size_t nRows, size_t & nLeft,
+                                 size_t & nRight);
+
+    services::Status updateResponse(oneapi::internal::UniversalBuffer & treeOrder, oneapi::internal::UniversalBuffer & response,
+                                    size_t responseOffset, size_t iStart, size_t nRows, algorithmFPType inc);
+
+    services::Status computeSiblingHistograms(oneapi::internal::UniversalBuffer & optCoeffs, TableRecordType * smallerChild,
+                                              TableRecordType * largerChild, size_t parentId);
+
+    services::Status splitNode(ConnectorType & connector, TableRecordType * record, services::Collection<SplitRecordType> & splits);
+
+    oneapi::internal::KernelPtr kernelInitializeTreeOrder;
+    oneapi::internal::KernelPtr kernelComputePartialHistograms;
+    oneapi::internal::KernelPtr kernelReducePartialHistograms;
+    oneapi::internal::KernelPtr kernelComputeHistogramDiff;
+    oneapi::internal::KernelPtr kernelComputeTotalOptCoeffs;
+    oneapi::internal::KernelPtr kernelComputeBestSplitForFeatures;
+    oneapi::internal::KernelPtr kernelPartitionScan;
+    oneapi::internal::KernelPtr kernelPartitionSumScan;
+    oneapi::internal::KernelPtr kernelPartitionReorder;
+    oneapi::internal::KernelPtr kernelPartitionCopy;
+    oneapi::internal::KernelPtr kernelUpdateResponse;
+
+    gbt::internal::IndexedFeaturesOneAPI<algorithmFPType> * _indexedFeatures;
+    const gbt::training::Parameter * _par;
+    size_t _nRows;
+
+    oneapi::internal::UniversalBuffer _treeOrder;
+    oneapi::internal::UniversalBuffer _treeOrderBuf;
+    oneapi::internal::UniversalBuffer _partialHistograms;
+
+    data_management::AOSNumericTablePtr _treeStructure;
+    services::Collection<gbt::internal::TreeNodeStorage> _treeNodeStorages;
+
+    services::Collection<services::SharedPtr<algorithmFPType> > _binValuesHost;
+    services::Collection<algorithmFPType *> _binValues;
+
+    const uint32_t _preferableSubGroup  = 16; // preferable maximal sub-group size
+    const uint32_t _maxLocalSize        = 128;
+    const uint32_t _maxLocalSums        = 256;
+    const uint32_t _maxLocalHistograms  = 256;
+    const uint32_t _preferableGroupSize = 256;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,827 @@
+/* file: gbt_tree_builder_oneapi.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the tree builder of gradient boosted trees on GPU.
+//--
+*/
+
+#ifndef __GBT_TREE_BUILDER_ONEAPI_I__
+#define __GBT_TREE_BUILDER_ONEAPI_I__
+
+#include "algorithms/kernel/dtrees/gbt/oneapi/cl_kernels/gbt_tree_builder_kernels.cl"
+
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_tree_builder_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.i"
+
+#include "externals/service_ittnotify.h"
+#include "services/buffer.h"
+#include "services/env_detect.h"
+#include "services/error_indexes.h"
+#include "service/kernel/service_data_utils.h"
+#include "oneapi/internal/types.h"
+
+using namespace daal::data_management;
+using namespace daal::algorithms::gbt::internal;
+using namespace daal::algorithms::gbt::regression::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType>
+static void __buildProgram(ClKernelFactoryIface & factory)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+    {
+        auto fptype_name   = getKeyFPType<algorithmFPType>();
+        auto build_options = fptype_name;
+        build_options.add("-cl-std=CL1.2");
+
+        services::String cachekey("__daal_algorithms_gbt_tree_builder_");
+        cachekey.add(fptype_name);
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), gbt_tree_builder_kernels, build_options.c_str());
+    }
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::initializeTreeOrder(size_t nRows, UniversalBuffer & treeOrder)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.initializeTreeOrder);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelInitializeTreeOrder;
+
+    {
+        KernelArguments args(1);
+        args.set(0, treeOrder, AccessModeIds::write);
+
+        KernelRange global_range(nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computePartialHistograms(
+    const UniversalBuffer & data, UniversalBuffer & treeOrder, UniversalBuffer & optCoeffs, UniversalBuffer & partialHistograms, size_t iStart,
+    size_t nRows, UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures, size_t localSize, size_t nPartialHistograms)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computePartialHistograms);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputePartialHistograms;
+
+    {
+        KernelArguments args(9);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, treeOrder, AccessModeIds::read);
+        args.set(2, optCoeffs, AccessModeIds::read);
+        args.set(3, partialHistograms, AccessModeIds::write);
+        args.set(4, (int)iStart);
+        args.set(5, (int)nRows);
+        args.set(6, binOffsets, AccessModeIds::read);
+        args.set(7, (int)nTotalBins);
+        args.set(8, (int)nFeatures);
+
+        size_t localSize = nFeatures < _maxLocalSize ? nFeatures : _maxLocalSize;
+
+        KernelRange local_range(1, localSize);
+        KernelRange global_range(nPartialHistograms, localSize);
+
+        KernelNDRange range(2);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::reducePartialHistograms(UniversalBuffer & partialHistograms, UniversalBuffer & histograms,
+                                                                             size_t nTotalBins, size_t reduceLocalSize, size_t nPartialHistograms)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.reducePartialHistograms);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelReducePartialHistograms;
+
+    {
+        KernelArguments args(4);
+        args.set(0, partialHistograms, AccessModeIds::read);
+        args.set(1, histograms, AccessModeIds::write);
+        args.set(2, (int)nPartialHistograms);
+        args.set(3, (int)nTotalBins);
+
+        KernelRange local_range(1, reduceLocalSize);
+        KernelRange global_range(nTotalBins, reduceLocalSize);
+
+        KernelNDRange range(2);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeHistogram(
+    const UniversalBuffer & data, UniversalBuffer & treeOrder, UniversalBuffer & optCoeffs, UniversalBuffer & partialHistograms,
+    UniversalBuffer & histograms, size_t iStart, size_t nRows, UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeHistogram);
+
+    services::Status status;
+
+    const int localSize = _preferableSubGroup;
+    const int nPartialHistograms =
+        (nRows < _preferableGroupSize * _maxLocalHistograms) ? nRows / _preferableGroupSize + !!(nRows % _preferableGroupSize) : _maxLocalHistograms;
+
+    int reduceLocalSize = 1;
+    while (reduceLocalSize * 2 <= nPartialHistograms)
+    {
+        reduceLocalSize *= 2;
+    }
+
+    DAAL_CHECK_STATUS_VAR(computePartialHistograms(data, treeOrder, optCoeffs, partialHistograms, iStart, nRows, binOffsets, nTotalBins, nFeatures,
+                                                   localSize, nPartialHistograms));
+    DAAL_CHECK_STATUS_VAR(reducePartialHistograms(partialHistograms, histograms, nTotalBins, reduceLocalSize, nPartialHistograms));
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeHistogramDiff(UniversalBuffer & histogramSrc, UniversalBuffer & histogramTotal,
+                                                                          UniversalBuffer & histogramDst, size_t nTotalBins)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeHistogramDiff);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeHistogramDiff;
+
+    {
+        KernelArguments args(3);
+        args.set(0, histogramSrc, AccessModeIds::read);
+        args.set(1, histogramTotal, AccessModeIds::read);
+        args.set(2, histogramDst, AccessModeIds::write);
+
+        KernelRange global_range(nTotalBins);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeTotalOptCoeffs(UniversalBuffer & histogram, UniversalBuffer & totalOptCoeffs,
+                                                                           UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures,
+                                                                           size_t localSize)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeTotalOptCoeffs);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeTotalOptCoeffs;
+
+    {
+        KernelArguments args(4);
+        args.set(0, histogram, AccessModeIds::read);
+        args.set(1, totalOptCoeffs, AccessModeIds::write);
+        args.set(2, binOffsets, AccessModeIds::read);
+        args.set(3, (int)nTotalBins);
+
+        KernelRange global_range(localSize, nFeatures);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeBestSplitForFeatures(
+    UniversalBuffer & histogram, UniversalBuffer & totalOptCoeffs, UniversalBuffer & splitInfo, UniversalBuffer & splitValue,
+    UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures, algorithmFPType lambda, size_t localSize)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeBestSplitForFeatures);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelComputeBestSplitForFeatures;
+
+    {
+        KernelArguments args(7);
+        args.set(0, histogram, AccessModeIds::read);
+        args.set(1, totalOptCoeffs, AccessModeIds::read);
+        args.set(2, splitInfo, AccessModeIds::write);
+        args.set(3, splitValue, AccessModeIds::write);
+        args.set(4, binOffsets, AccessModeIds::read);
+        args.set(5, (int)nTotalBins);
+        args.set(6, lambda);
+
+        KernelRange local_range(localSize, 1);
+        KernelRange global_range(localSize, nFeatures);
+
+        KernelNDRange range(2);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeBestSplit(
+    UniversalBuffer & histograms, UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures, algorithmFPType lambda,
+    BestSplitOneAPI<algorithmFPType> & bestSplit, algorithmFPType * gTotal, algorithmFPType * hTotal)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeBestSplit);
+
+    services::Status status;
+
+    auto & context      = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto totalOptCoeffs = context.allocate(TypeIds::id<algorithmFPType>(), 2, &status);
+    auto splitInfo      = context.allocate(TypeIds::id<algorithmFPType>(), nFeatures * 5, &status);
+    auto splitValue     = context.allocate(TypeIds::id<int>(), nFeatures * 1, &status);
+
+    const int localSize = _preferableSubGroup;
+
+    DAAL_CHECK_STATUS_VAR(computeTotalOptCoeffs(histograms, totalOptCoeffs, binOffsets, nTotalBins, nFeatures, localSize));
+    DAAL_CHECK_STATUS_VAR(
+        computeBestSplitForFeatures(histograms, totalOptCoeffs, splitInfo, splitValue, binOffsets, nTotalBins, nFeatures, lambda, localSize));
+
+    if (gTotal && hTotal)
+    {
+        auto totalOptCoeffsHost = totalOptCoeffs.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly);
+        *gTotal                 = totalOptCoeffsHost.get()[0];
+        *hTotal                 = totalOptCoeffsHost.get()[1];
+    }
+    {
+        auto splitInfoHost  = splitInfo.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly);
+        auto splitValueHost = splitValue.template get<int>().toHost(ReadWriteMode::readOnly);
+        for (size_t featId = 0; featId < nFeatures; featId++)
+        {
+            algorithmFPType impurityDecrease = splitInfoHost.get()[featId * 5 + 0];
+            int featureValue                 = splitValueHost.get()[featId];
+            if (featureValue != -1)
+            {
+                if (impurityDecrease > bestSplit._impurityDecrease
+                    || (impurityDecrease == bestSplit._impurityDecrease && featId < bestSplit._featureIndex))
+                {
+                    bestSplit._impurityDecrease = impurityDecrease;
+                    bestSplit._featureIndex     = featId;
+                    bestSplit._featureValue     = featureValue;
+                    bestSplit._leftGTotal       = splitInfoHost.get()[featId * 5 + 1];
+                    bestSplit._leftHTotal       = splitInfoHost.get()[featId * 5 + 2];
+                    bestSplit._rightGTotal      = splitInfoHost.get()[featId * 5 + 3];
+                    bestSplit._rightHTotal      = splitInfoHost.get()[featId * 5 + 4];
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::partitionScan(const UniversalBuffer & data, UniversalBuffer & treeOrder,
+                                                                   UniversalBuffer & partialSums, int splitValue, size_t iStart, size_t nRows,
+                                                                   size_t localSize, size_t nLocalSums)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.partitionScan);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelPartitionScan;
+
+    {
+        KernelArguments args(6);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, treeOrder, AccessModeIds::read);
+        args.set(2, partialSums, AccessModeIds::write);
+        args.set(3, splitValue);
+        args.set(4, (int)iStart);
+        args.set(5, (int)nRows);
+
+        KernelRange local_range(localSize);
+        KernelRange global_range(localSize * nLocalSums);
+
+        KernelNDRange range(1);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::partitionSumScan(UniversalBuffer & partialSums, UniversalBuffer & partialPrefixSums,
+                                                                      UniversalBuffer & totalSum, size_t localSize, size_t nSubgroupSums)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.partitionSumScan);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelPartitionSumScan;
+
+    {
+        KernelArguments args(4);
+        args.set(0, partialSums, AccessModeIds::read);
+        args.set(1, partialPrefixSums, AccessModeIds::write);
+        args.set(2, totalSum, AccessModeIds::write);
+        args.set(3, (int)nSubgroupSums);
+
+        KernelRange local_range(localSize);
+        KernelRange global_range(localSize);
+
+        KernelNDRange range(1);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::partitionReorder(
+    const UniversalBuffer & data, UniversalBuffer & treeOrder, UniversalBuffer & treeOrderBuf, UniversalBuffer & partialPrefixSums, int splitValue,
+    size_t iStart, size_t nRows, size_t localSize, size_t nLocalSums)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.partitionReorder);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelPartitionReorder;
+
+    {
+        KernelArguments args(7);
+        args.set(0, data, AccessModeIds::read);
+        args.set(1, treeOrder, AccessModeIds::read);
+        args.set(2, treeOrderBuf, AccessModeIds::write);
+        args.set(3, partialPrefixSums, AccessModeIds::read);
+        args.set(4, splitValue);
+        args.set(5, (int)iStart);
+        args.set(6, (int)nRows);
+
+        KernelRange local_range(localSize);
+        KernelRange global_range(localSize * nLocalSums);
+
+        KernelNDRange range(1);
+        range.global(global_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(local_range, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::partitionCopy(UniversalBuffer & treeOrderBuf, UniversalBuffer & treeOrder, size_t iStart,
+                                                                   size_t nRows)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.partitionCopy);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelPartitionCopy;
+
+    {
+        KernelArguments args(3);
+        args.set(0, treeOrderBuf, AccessModeIds::read);
+        args.set(1, treeOrder, AccessModeIds::write);
+        args.set(2, (int)iStart);
+
+        KernelRange global_range(nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::doPartition(const UniversalBuffer & data, UniversalBuffer & treeOrder,
+                                                                 UniversalBuffer & treeOrderBuf, int splitValue, size_t iStart, size_t nRows,
+                                                                 size_t & nLeft, size_t & nRight)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.doPartition);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    const int subSize       = _preferableSubGroup;
+    const int localSize     = _preferableSubGroup;
+    const int nLocalSums    = _maxLocalSums * localSize < nRows ? _maxLocalSums : (nRows / localSize) + !!(nRows % localSize);
+    const int nSubgroupSums = nLocalSums * (localSize / subSize);
+
+    auto partialSums       = context.allocate(TypeIds::id<int>(), nSubgroupSums + 1, &status);
+    auto partialPrefixSums = context.allocate(TypeIds::id<int>(), nSubgroupSums + 1, &status);
+    auto totalSum          = context.allocate(TypeIds::id<int>(), 1, &status);
+
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DAAL_CHECK_STATUS_VAR(partitionScan(data, treeOrder, partialSums, splitValue, iStart, nRows, localSize, nLocalSums));
+    DAAL_CHECK_STATUS_VAR(partitionSumScan(partialSums, partialPrefixSums, totalSum, localSize, nSubgroupSums));
+    DAAL_CHECK_STATUS_VAR(partitionReorder(data, treeOrder, treeOrderBuf, partialPrefixSums, splitValue, iStart, nRows, localSize, nLocalSums));
+    DAAL_CHECK_STATUS_VAR(partitionCopy(treeOrderBuf, treeOrder, iStart, nRows));
+
+    {
+        auto totalSumHost = totalSum.template get<int>().toHost(ReadWriteMode::readOnly);
+        nRight            = totalSumHost.get()[0];
+        nLeft             = nRows - totalSumHost.get()[0];
+        if (nLeft == 0 || nRight == 0)
+        {
+            return status;
+        }
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::updateResponse(UniversalBuffer & treeOrder, UniversalBuffer & response, size_t responseOffset,
+                                                                    size_t iStart, size_t nRows, algorithmFPType inc)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.updateResponse);
+
+    services::Status status;
+
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    auto & kernel = kernelUpdateResponse;
+
+    {
+        KernelArguments args(6);
+        args.set(0, treeOrder, AccessModeIds::read);
+        args.set(1, response, AccessModeIds::write);
+        args.set(2, (int)responseOffset);
+        args.set(3, (int)iStart);
+        args.set(4, (int)nRows);
+        args.set(5, inc);
+
+        KernelRange global_range(nRows);
+
+        context.run(global_range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::computeSiblingHistograms(UniversalBuffer & optCoeffs, TableRecordType * smallerChild,
+                                                                              TableRecordType * largerChild, size_t parentId)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.computeSiblingHistograms);
+
+    services::Status status;
+
+    IndexedFeaturesOneAPI<algorithmFPType> & indexedFeatures = *_indexedFeatures;
+
+    TreeNodeStorage & smallerStorage = _treeNodeStorages[smallerChild->nid];
+    TreeNodeStorage & largerStorage  = _treeNodeStorages[largerChild->nid];
+    DAAL_CHECK_STATUS_VAR(smallerStorage.allocate(indexedFeatures));
+    DAAL_CHECK_STATUS_VAR(largerStorage.allocate(indexedFeatures));
+
+    /* Only the rows of the smaller child are scanned, the histogram of the larger one is parent - smaller */
+    DAAL_CHECK_STATUS_VAR(computeHistogram(indexedFeatures.getFullData(), _treeOrder, optCoeffs, _partialHistograms, smallerStorage.getHistograms(),
+                                           smallerChild->iStart, smallerChild->n, indexedFeatures.binOffsets(), indexedFeatures.totalBins(),
+                                           indexedFeatures.nCols()));
+    DAAL_CHECK_STATUS_VAR(computeHistogramDiff(smallerStorage.getHistograms(), _treeNodeStorages[parentId].getHistograms(),
+                                               largerStorage.getHistograms(), indexedFeatures.totalBins()));
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::splitNode(ConnectorType & connector, TableRecordType * record,
+                                                               services::Collection<SplitRecordType> & splits)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.splitNode);
+
+    const gbt::training::Parameter & par                     = *_par;
+    IndexedFeaturesOneAPI<algorithmFPType> & indexedFeatures = *_indexedFeatures;
+    TreeNodeStorage & storage                                = _treeNodeStorages[record->nid];
+    const size_t nSplits                                     = splits.size();
+
+    BestSplitOneAPI<algorithmFPType> bestSplit;
+    if (record->nid == 0)
+    {
+        algorithmFPType gTotal = 0.0;
+        algorithmFPType hTotal = 0.0;
+        DAAL_CHECK_STATUS_VAR(computeBestSplit(storage.getHistograms(), indexedFeatures.binOffsets(), indexedFeatures.totalBins(),
+                                               indexedFeatures.nCols(), par.lambda, bestSplit, &gTotal, &hTotal));
+        record->gTotal = gTotal;
+        record->hTotal = hTotal;
+        record->nTotal = record->n;
+    }
+    else
+    {
+        DAAL_CHECK_STATUS_VAR(computeBestSplit(storage.getHistograms(), indexedFeatures.binOffsets(), indexedFeatures.totalBins(),
+                                               indexedFeatures.nCols(), par.lambda, bestSplit));
+    }
+
+    record->isFinalized = true;
+    record->nodeState   = ConnectorType::badSplit;
+
+    bestSplit._impurityDecrease -= (record->gTotal / (record->hTotal + par.lambda)) * record->gTotal;
+    if (bestSplit._impurityDecrease >= par.minSplitLoss && bestSplit._featureIndex >= 0 && bestSplit._featureValue >= 0)
+    {
+        size_t nLeft  = 0;
+        size_t nRight = 0;
+        DAAL_CHECK_STATUS_VAR(doPartition(indexedFeatures.getFeature(bestSplit._featureIndex), _treeOrder, _treeOrderBuf, bestSplit._featureValue,
+                                          record->iStart, record->n, nLeft, nRight));
+        if (nLeft > 0 && nRight > 0)
+        {
+            record->nodeState    = ConnectorType::split;
+            record->featureValue = bestSplit._featureValue;
+            record->featureIdx   = bestSplit._featureIndex;
+            connector.createNode(record->level + 1, record->nid * 2 + 1, nLeft, record->iStart, bestSplit._leftGTotal, bestSplit._leftHTotal, nLeft,
+                                 par);
+            connector.createNode(record->level + 1, record->nid * 2 + 2, record->n - nLeft, record->iStart + nLeft, bestSplit._rightGTotal,
+                                 bestSplit._rightHTotal, nRight, par);
+            connector.setSplitLevel(record->level + 1);
+            connector.getSplitNodesMerged(record->nid, splits, false);
+        }
+    }
+
+    /* The histogram is kept only while it may be needed for the subtraction in the children */
+    if (splits.size() == nSplits)
+    {
+        storage.clear();
+    }
+
+    return services::Status();
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::init(IndexedFeaturesOneAPI<algorithmFPType> & indexedFeatures, size_t nRows,
+                                                          const gbt::training::Parameter & par)
+{
+    services::Status status;
+
+    _indexedFeatures = &indexedFeatures;
+    _par             = &par;
+    _nRows           = nRows;
+
+    auto & context        = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    __buildProgram<algorithmFPType>(kernel_factory);
+
+    kernelInitializeTreeOrder         = kernel_factory.getKernel("initializeTreeOrder", &status);
+    kernelComputePartialHistograms    = kernel_factory.getKernel("computePartialHistograms", &status);
+    kernelReducePartialHistograms     = kernel_factory.getKernel("reducePartialHistograms", &status);
+    kernelComputeHistogramDiff        = kernel_factory.getKernel("computeHistogramDiff", &status);
+    kernelComputeTotalOptCoeffs       = kernel_factory.getKernel("computeTotalOptCoeffs", &status);
+    kernelComputeBestSplitForFeatures = kernel_factory.getKernel("computeBestSplitForFeatures", &status);
+    kernelPartitionScan               = kernel_factory.getKernel("partitionScan", &status);
+    kernelPartitionSumScan            = kernel_factory.getKernel("partitionSumScan", &status);
+    kernelPartitionReorder            = kernel_factory.getKernel("partitionReorder", &status);
+    kernelPartitionCopy               = kernel_factory.getKernel("partitionCopy", &status);
+    kernelUpdateResponse              = kernel_factory.getKernel("updateResponse", &status);
+
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _treeOrder         = context.allocate(TypeIds::id<int>(), nRows, &status);
+    _treeOrderBuf      = context.allocate(TypeIds::id<int>(), nRows, &status);
+    _partialHistograms = context.allocate(TypeIds::id<algorithmFPType>(), _maxLocalHistograms * indexedFeatures.totalBins() * 2, &status);
+
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _treeStructure = ConnectorType::createGBTree(par.maxTreeDepth, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const size_t maxNodes = _treeStructure->getNumberOfRows();
+    for (size_t i = 0; i < maxNodes; i++)
+    {
+        DAAL_CHECK_MALLOC(_treeNodeStorages.safe_push_back(TreeNodeStorage()));
+    }
+
+    /* Bin borders are the same for all the trees, so they are copied to the host once */
+    const size_t nFeatures = indexedFeatures.nCols();
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        auto binValuesHost = indexedFeatures.binBorders(i).template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_MALLOC(_binValuesHost.safe_push_back(binValuesHost));
+        DAAL_CHECK_MALLOC(_binValues.safe_push_back(_binValuesHost[i].get()));
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status TreeBuilderOneAPI<algorithmFPType>::buildTree(UniversalBuffer & optCoeffs, UniversalBuffer & response, size_t responseOffset,
+                                                               algorithmFPType initResponse, gbt::internal::ModelImpl & model)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildTree);
+
+    const gbt::training::Parameter & par                     = *_par;
+    IndexedFeaturesOneAPI<algorithmFPType> & indexedFeatures = *_indexedFeatures;
+
+    ConnectorType connector(_treeStructure.get());
+
+    DAAL_CHECK_STATUS_VAR(initializeTreeOrder(_nRows, _treeOrder));
+
+    TableRecordType * root = connector.get(0);
+
+    root->level       = 0;
+    root->nid         = 0;
+    root->iStart      = 0;
+    root->n           = _nRows;
+    root->nodeState   = ConnectorType::split;
+    root->isFinalized = false;
+
+    services::Collection<SplitRecordType> splits;
+    splits.push_back(SplitRecordType(root));
+
+    for (size_t splitId = 0; splitId < splits.size(); splitId++)
+    {
+        /* splits grow while the nodes are processed, so the records are copied */
+        TableRecordType * leftRecord  = splits[splitId].first;
+        TableRecordType * rightRecord = splits[splitId].second;
+
+        if (leftRecord && rightRecord)
+        {
+            const size_t parentId = (leftRecord->nid - 1) / 2;
+            if (leftRecord->n < rightRecord->n)
+            {
+                DAAL_CHECK_STATUS_VAR(computeSiblingHistograms(optCoeffs, leftRecord, rightRecord, parentId));
+            }
+            else
+            {
+                DAAL_CHECK_STATUS_VAR(computeSiblingHistograms(optCoeffs, rightRecord, leftRecord, parentId));
+            }
+            _treeNodeStorages[parentId].clear();
+
+            DAAL_CHECK_STATUS_VAR(splitNode(connector, leftRecord, splits));
+            DAAL_CHECK_STATUS_VAR(splitNode(connector, rightRecord, splits));
+        }
+        else
+        {
+            TableRecordType * record = (leftRecord ? leftRecord : rightRecord);
+            if (record->nid == 0)
+            {
+                TreeNodeStorage & storage = _treeNodeStorages[0];
+                DAAL_CHECK_STATUS_VAR(storage.allocate(indexedFeatures));
+                DAAL_CHECK_STATUS_VAR(computeHistogram(indexedFeatures.getFullData(), _treeOrder, optCoeffs, _partialHistograms,
+                                                       storage.getHistograms(), record->iStart, record->n, indexedFeatures.binOffsets(),
+                                                       indexedFeatures.totalBins(), indexedFeatures.nCols()));
+            }
+            else
+            {
+                /* The sibling is a leaf, it is still cheaper to compute its histogram if it has fewer rows */
+                const size_t parentId     = (record->nid - 1) / 2;
+                TableRecordType * sibling = connector.get((record->nid % 2) ? record->nid + 1 : record->nid - 1);
+                if (sibling->n < record->n)
+                {
+                    DAAL_CHECK_STATUS_VAR(computeSiblingHistograms(optCoeffs, sibling, record, parentId));
+                    _treeNodeStorages[sibling->nid].clear();
+                }
+                else
+                {
+                    TreeNodeStorage & storage = _treeNodeStorages[record->nid];
+                    DAAL_CHECK_STATUS_VAR(storage.allocate(indexedFeatures));
+                    DAAL_CHECK_STATUS_VAR(computeHistogram(indexedFeatures.getFullData(), _treeOrder, optCoeffs, _partialHistograms,
+                                                           storage.getHistograms(), record->iStart, record->n, indexedFeatures.binOffsets(),
+                                                           indexedFeatures.totalBins(), indexedFeatures.nCols()));
+                }
+                _treeNodeStorages[parentId].clear();
+            }
+
+            DAAL_CHECK_STATUS_VAR(splitNode(connector, record, splits));
+        }
+    }
+
+    services::Collection<TableRecordType *> leaves;
+    connector.getLeafNodes(0, leaves);
+    const size_t nLeaves = leaves.size();
+
+    for (size_t leafId = 0; leafId < nLeaves; leafId++)
+    {
+        TableRecordType * node = leaves[leafId];
+
+        algorithmFPType resp = 0;
+
+        algorithmFPType val = node->hTotal + par.lambda;
+        if (val != 0.0)
+        {
+            val                       = -node->gTotal / val;
+            const algorithmFPType inc = val * par.shrinkage;
+
+            resp = inc;
+
+            DAAL_CHECK_STATUS_VAR(updateResponse(_treeOrder, response, responseOffset, node->iStart, node->n, inc));
+        }
+
+        node->response    = resp;
+        node->isFinalized = 1;
+    }
+
+    size_t maxLevel = 0;
+    connector.getMaxLevel(0, maxLevel);
+    const size_t nNodes        = (1 << (maxLevel + 1)) - 1;
+    const size_t nNodesPresent = connector.getNNodes(0);
+
+    gbt::internal::GbtDecisionTree * pTbl = new gbt::internal::GbtDecisionTree(nNodes, maxLevel, nNodesPresent);
+
+    HomogenNumericTable<double> * pTblImp  = new HomogenNumericTable<double>(1, nNodes, NumericTable::doAllocate);
+    HomogenNumericTable<int> * pTblSmplCnt = new HomogenNumericTable<int>(1, nNodes, NumericTable::doAllocate);
+
+    connector.template convertToGbtDecisionTree<sse2>(_binValues.data(), nNodes, maxLevel, pTbl, pTblImp->getArray(), pTblSmplCnt->getArray(),
+                                                      initResponse, par);
+    model.add(pTbl, pTblImp, pTblSmplCnt);
+
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
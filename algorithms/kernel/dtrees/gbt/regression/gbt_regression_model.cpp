@@ -96,7 +96,8 @@ services::Status ModelImpl::deserializeImpl(const data_management::OutputDataArc
 {
     auto s = algorithms::regression::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
     s.add(algorithms::regression::internal::ModelInternal::serialImpl<const data_management::OutputDataArchive, true>(arch));
-    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(arch));
+    return s.add(ImplType::serialImpl<const data_management::OutputDataArchive, true>(
+        arch, COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion())));
 }
 
 } // namespace internal
@@ -26,6 +26,7 @@
 #include "algorithms/kernel/dtrees/dtrees_model_impl.h"
 #include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
 #include "algorithms/kernel/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "service/kernel/service_arrays.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -86,6 +87,22 @@ services::Status ModelBuilder::addSplitNodeInternal(TreeId treeId, NodeId parent
                                                                     featureValue, res);
 }
 
+services::Status ModelBuilder::addTreesInternal(size_t nTrees, const size_t * treeOffsets, const int * featureIndices, const double * featureValues,
+                                                const size_t * leftChildren, const size_t * rightChildren)
+{
+    if (nTrees == 0) return services::Status();
+    gbt::regression::internal::ModelImpl & modelImplRef =
+        daal::algorithms::dtrees::internal::getModelRef<daal::algorithms::gbt::regression::internal::ModelImpl, ModelPtr>(_model);
+
+    services::internal::TArray<TreeId, sse2> treeIds(nTrees);
+    DAAL_CHECK_MALLOC(treeIds.get());
+    services::Status s = daal::algorithms::dtrees::internal::findEmptyTreeIds(modelImplRef._serializationData, nTrees, nullptr, 1,
+                                                                              modelImplRef._serializationData->size(), treeIds.get());
+    DAAL_CHECK_STATUS_VAR(s);
+    return daal::algorithms::dtrees::internal::addTreesInternal(modelImplRef._serializationData, nTrees, treeIds.get(), treeOffsets, featureIndices,
+                                                                featureValues, leftChildren, rightChildren, false);
+}
+
 } // namespace interface1
 } // namespace regression
 } // namespace gbt
@@ -25,6 +25,7 @@
 
 #include "algorithms/gradient_boosted_trees/gbt_regression_predict.h"
 #include "algorithms/kernel/dtrees/gbt/regression/gbt_regression_predict_kernel.h"
+#include "algorithms/kernel/dtrees/gbt/regression/oneapi/gbt_regression_predict_kernel_oneapi.h"
 #include "service/kernel/service_algo_utils.h"
 
 namespace daal
@@ -40,7 +41,17 @@ namespace prediction
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::PredictKernel, algorithmFPType, method);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::PredictKernelOneAPI, algorithmFPType, method);
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -52,6 +63,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
 
@@ -59,10 +73,21 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::gbt::regression::Model * m       = static_cast<daal::algorithms::gbt::regression::Model *>(input->get(model).get());
     NumericTable * r                                   = static_cast<NumericTable *>(result->get(prediction).get());
     const gbt::regression::prediction::Parameter * par = static_cast<gbt::regression::prediction::Parameter *>(_par);
+    NumericTable * contributions = (par->resultsToCompute & computeShapContributions) ? result->get(shapContributions).get() : nullptr;
+    NumericTable * interactions  = (par->resultsToCompute & computeShapInteractions) ? result->get(shapInteractions).get() : nullptr;
 
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                       daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                           daal::services::internal::hostApp(*input), a, m, r, par->nIterations, contributions, interactions);
+    }
+    else
+    {
+        if (contributions || interactions) return services::Status(services::ErrorMethodNotImplemented);
+        __DAAL_CALL_KERNEL_SYCL(env, internal::PredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                                daal::services::internal::hostApp(*input), a, m, r, par->nIterations);
+    }
 }
 
 } // namespace prediction
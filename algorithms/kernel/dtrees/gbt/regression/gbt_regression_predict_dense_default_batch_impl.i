@@ -35,6 +35,7 @@
 #include "externals/service_memory.h"
 #include "algorithms/kernel/dtrees/regression/dtrees_regression_predict_dense_default_impl.i"
 #include "algorithms/kernel/dtrees/gbt/gbt_predict_dense_default_impl.i"
+#include "algorithms/kernel/dtrees/gbt/gbt_predict_shap_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -61,11 +62,18 @@ class PredictRegressionTask
 {
 public:
     typedef gbt::internal::GbtDecisionTree TreeType;
-    PredictRegressionTask(const NumericTable * x, NumericTable * y) : _data(x), _res(y) {}
+    typedef gbt::prediction::internal::TreeShap<algorithmFPType, cpu> TreeShapType;
+    PredictRegressionTask(const NumericTable * x, NumericTable * y, NumericTable * contributions = nullptr, NumericTable * interactions = nullptr)
+        : _data(x), _res(y), _contributions(contributions), _interactions(interactions)
+    {}
     services::Status run(const gbt::regression::internal::ModelImpl * m, size_t nIterations, services::HostAppIface * pHostApp);
 
 protected:
     services::Status runInternal(services::HostAppIface * pHostApp, NumericTable * result);
+    services::Status runShap(const gbt::regression::internal::ModelImpl * m);
+    void computeShapInteractions(const TArray<TreeShapType *, cpu> & aShap, const char * isUsed, const algorithmFPType * x,
+                                 const algorithmFPType * contributions, algorithmFPType * interactions, algorithmFPType * phiOn,
+                                 algorithmFPType * phiOff, typename TreeShapType::PathElement * pathBuffer);
     algorithmFPType predictByTrees(size_t iFirstTree, size_t nTrees, const algorithmFPType * x);
     void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, algorithmFPType * res);
 
@@ -74,6 +82,8 @@ protected:
     TArray<const TreeType *, cpu> _aTree;
     const NumericTable * _data;
     NumericTable * _res;
+    NumericTable * _contributions;
+    NumericTable * _interactions;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -81,11 +91,12 @@ protected:
 //////////////////////////////////////////////////////////////////////////////////////////
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
-                                                                      const regression::Model * m, NumericTable * r, size_t nIterations)
+                                                                      const regression::Model * m, NumericTable * r, size_t nIterations,
+                                                                      NumericTable * shapContributions, NumericTable * shapInteractions)
 {
     const daal::algorithms::gbt::regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::gbt::regression::internal::ModelImpl *>(m);
-    PredictRegressionTask<algorithmFPType, cpu> task(x, r);
+    PredictRegressionTask<algorithmFPType, cpu> task(x, r, shapContributions, shapInteractions);
     return task.run(pModel, nIterations, pHostApp);
 }
 
@@ -98,8 +109,12 @@ services::Status PredictRegressionTask<algorithmFPType, cpu>::run(const gbt::reg
     const auto nTreesTotal = (nIterations ? nIterations : m->size());
     this->_aTree.reset(nTreesTotal);
     DAAL_CHECK_MALLOC(this->_aTree.get());
+    /* The trees of the lazily deserialized model are decoded in parallel */
+    DAAL_CHECK_STATUS_VAR(m->loadTrees(nTreesTotal));
     for (size_t i = 0; i < nTreesTotal; ++i) this->_aTree[i] = m->at(i);
-    return runInternal(pHostApp, this->_res);
+    services::Status s = runInternal(pHostApp, this->_res);
+    if (s && (_contributions || _interactions)) s = runShap(m);
+    return s;
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -167,6 +182,128 @@ void PredictRegressionTask<algorithmFPType, cpu>::predictByTreesVector(size_t iF
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTask<algorithmFPType, cpu>::runShap(const gbt::regression::internal::ModelImpl * m)
+{
+    typedef typename TreeShapType::PathElement PathElement;
+    const size_t nTrees    = this->_aTree.size();
+    const size_t nFeatures = this->_data->getNumberOfColumns();
+    const size_t nCols     = nFeatures + 1;
+
+    /* TreeSHAP weights the subtrees by the numbers of the training observations in their nodes */
+    TArray<TreeShapType *, cpu> aShap(nTrees);
+    TArrayCalloc<char, cpu> isUsed(nFeatures);
+    DAAL_CHECK_MALLOC(aShap.get() && isUsed.get());
+    services::Status s;
+    size_t maxLvl        = 0;
+    algorithmFPType bias = 0;
+    for (size_t iTree = 0; iTree < nTrees; ++iTree) aShap[iTree] = nullptr;
+    for (size_t iTree = 0; iTree < nTrees && s; ++iTree)
+    {
+        const int * const cover = m->nodeSampleCount(iTree);
+        if (!cover)
+        {
+            s = services::Status(services::ErrorModelNotFullInitialized);
+            break;
+        }
+        aShap[iTree] = new TreeShapType(*this->_aTree[iTree], cover, this->_featHelper);
+        if (!aShap[iTree])
+        {
+            s = services::Status(services::ErrorMemoryAllocationFailed);
+            break;
+        }
+        bias += aShap[iTree]->expectedValue();
+        aShap[iTree]->markSplitFeatures(isUsed.get());
+        if (this->_aTree[iTree]->getMaxLvl() > maxLvl) maxLvl = this->_aTree[iTree]->getMaxLvl();
+    }
+
+    if (s)
+    {
+        gbt::prediction::internal::TileDimensions<algorithmFPType> dim(*this->_data, nTrees);
+        const size_t pathBufferSize = gbt::prediction::internal::getShapPathBufferSize(maxLvl);
+
+        /* The rows are blocked across the threads, every block keeps its own path buffer */
+        SafeStatus safeStat;
+        daal::threader_for(dim.nDataBlocks, dim.nDataBlocks, [&](size_t iBlock) {
+            const size_t iStartRow      = iBlock * dim.nRowsInBlock;
+            const size_t nRowsToProcess = (iBlock == dim.nDataBlocks - 1) ? dim.nRowsTotal - iBlock * dim.nRowsInBlock : dim.nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(this->_data), iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(xBD);
+
+            TArray<PathElement, cpu> pathBuffer(pathBufferSize);
+            TArray<algorithmFPType, cpu> phi(_interactions ? 3 * nCols : nCols);
+            DAAL_CHECK_MALLOC_THR(pathBuffer.get() && phi.get());
+
+            WriteOnlyRows<algorithmFPType, cpu> contributionsBD(_contributions, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(contributionsBD);
+            WriteOnlyRows<algorithmFPType, cpu> interactionsBD(_interactions, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(interactionsBD);
+
+            for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+            {
+                const algorithmFPType * const x       = xBD.get() + iRow * nFeatures;
+                algorithmFPType * const contributions = _contributions ? contributionsBD.get() + iRow * nCols : phi.get();
+
+                services::internal::service_memset_seq<algorithmFPType, cpu>(contributions, algorithmFPType(0), nFeatures);
+                for (size_t iTree = 0; iTree < nTrees; ++iTree) aShap[iTree]->addContributions(x, contributions, pathBuffer.get());
+                contributions[nFeatures] = bias;
+
+                if (_interactions)
+                {
+                    computeShapInteractions(aShap, isUsed.get(), x, contributions, interactionsBD.get() + iRow * nCols * nCols, phi.get() + nCols,
+                                            phi.get() + 2 * nCols, pathBuffer.get());
+                }
+            }
+        });
+        s = safeStat.detach();
+    }
+
+    for (size_t iTree = 0; iTree < nTrees; ++iTree) delete aShap[iTree];
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTask<algorithmFPType, cpu>::computeShapInteractions(const TArray<TreeShapType *, cpu> & aShap, const char * isUsed,
+                                                                          const algorithmFPType * x, const algorithmFPType * contributions,
+                                                                          algorithmFPType * interactions, algorithmFPType * phiOn,
+                                                                          algorithmFPType * phiOff, typename TreeShapType::PathElement * pathBuffer)
+{
+    const size_t nTrees    = aShap.size();
+    const size_t nFeatures = this->_data->getNumberOfColumns();
+    const size_t nCols     = nFeatures + 1;
+
+    services::internal::service_memset_seq<algorithmFPType, cpu>(interactions, algorithmFPType(0), nCols * nCols);
+    for (size_t i = 0; i < nFeatures; ++i)
+    {
+        algorithmFPType * const row = interactions + i * nCols;
+        /* The contributions of the other features do not depend on the presence of the feature that is not used by the trees */
+        if (!isUsed[i])
+        {
+            row[i] = contributions[i];
+            continue;
+        }
+
+        services::internal::service_memset_seq<algorithmFPType, cpu>(phiOn, algorithmFPType(0), nCols);
+        services::internal::service_memset_seq<algorithmFPType, cpu>(phiOff, algorithmFPType(0), nCols);
+        for (size_t iTree = 0; iTree < nTrees; ++iTree)
+        {
+            aShap[iTree]->addContributions(x, phiOn, pathBuffer, 1, int(i));
+            aShap[iTree]->addContributions(x, phiOff, pathBuffer, -1, int(i));
+        }
+
+        /* The interaction of the pair is split evenly between its features, the main effect is the rest of the contribution */
+        algorithmFPType sum = 0;
+        for (size_t j = 0; j < nCols; ++j)
+        {
+            if (j == i) continue;
+            row[j] = (phiOn[j] - phiOff[j]) / 2;
+            sum += row[j];
+        }
+        row[i] = contributions[i] - sum;
+    }
+    interactions[nFeatures * nCols + nFeatures] = contributions[nFeatures];
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace regression */
@@ -55,9 +55,11 @@ public:
      *  \param m[in]    gradient boosted trees model obtained on training stage
      *  \param r[out]   Prediction results
      *  \param nIterations[in]  Number of iterations to predict in gradient boosted trees algorithm parameter
+     *  \param shapContributions[out]  SHAP contributions of the features, nullptr if they are not computed
+     *  \param shapInteractions[out]   SHAP interaction values of the pairs of features, nullptr if they are not computed
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const regression::Model * m, NumericTable * r,
-                             size_t nIterations);
+                             size_t nIterations, NumericTable * shapContributions, NumericTable * shapInteractions);
 };
 
 } // namespace internal
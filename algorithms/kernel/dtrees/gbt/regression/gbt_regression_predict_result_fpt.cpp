@@ -47,6 +47,22 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     const size_t nVectors = dataPtr->getNumberOfRows();
     Argument::set(prediction,
                   data_management::HomogenNumericTable<algorithmFPType>::create(1, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const Parameter * pPrm = static_cast<const Parameter *>(par);
+    const size_t nCols     = dataPtr->getNumberOfColumns() + 1;
+    if (pPrm->resultsToCompute & computeShapContributions)
+    {
+        Argument::set(shapContributions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                             nCols, nVectors, data_management::NumericTableIface::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+    if (pPrm->resultsToCompute & computeShapInteractions)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nCols, nCols);
+        Argument::set(shapInteractions, data_management::HomogenNumericTable<algorithmFPType>::create(
+                                            nCols * nCols, nVectors, data_management::NumericTableIface::doAllocate, &s));
+    }
     return s;
 }
 
@@ -143,6 +143,19 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     Status s;
     DAAL_CHECK_STATUS(s, algorithms::regression::prediction::Result::check(input, par, method));
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == 1, ErrorIncorrectNumberOfColumns, ArgumentName, predictionStr());
+
+    const Parameter * pPrm = static_cast<const Parameter *>(par);
+    const Input * algInput = static_cast<const Input *>(input);
+    const size_t nRows     = algInput->get(data)->getNumberOfRows();
+    const size_t nCols     = algInput->get(data)->getNumberOfColumns() + 1;
+    if (pPrm->resultsToCompute & computeShapContributions)
+    {
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(shapContributions).get(), shapContributionsStr(), 0, 0, nCols, nRows));
+    }
+    if (pPrm->resultsToCompute & computeShapInteractions)
+    {
+        DAAL_CHECK_STATUS(s, data_management::checkNumericTable(get(shapInteractions).get(), shapInteractionsStr(), 0, 0, nCols * nCols, nRows));
+    }
     return s;
 }
 
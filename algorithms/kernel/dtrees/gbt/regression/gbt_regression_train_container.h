@@ -88,7 +88,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     const NumericTable * x = input->get(data).get();
     const NumericTable * y = input->get(dependentVariable).get();
 
-    gbt::regression::Model * m = result->get(model).get();
+    gbt::regression::Model * m                  = result->get(model).get();
+    const gbt::regression::Model * initialModel = input->get(inputModel).get();
 
     const Parameter * par                  = static_cast<gbt::regression::training::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
@@ -98,10 +99,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::RegressionTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
+                           daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine, initialModel);
     }
     else
     {
+        if (initialModel && initialModel->getNumberOfTrees()) return services::Status(services::ErrorMethodNotImplemented);
         __DAAL_CALL_KERNEL_SYCL(env, internal::RegressionTrainBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 daal::services::internal::hostApp(*input), x, y, *m, *result, *par, *engine);
     }
@@ -167,7 +167,8 @@ protected:
 template <typename algorithmFPType, gbt::regression::training::Method method, CpuType cpu>
 services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(HostAppIface * pHostApp, const NumericTable * x,
                                                                                    const NumericTable * y, gbt::regression::Model & m, Result & res,
-                                                                                   const Parameter & par, engines::internal::BatchBaseImpl & engine)
+                                                                                   const Parameter & par, engines::internal::BatchBaseImpl & engine,
+                                                                                   const gbt::regression::Model * initialModel)
 {
     const size_t nFeaturesPerNode = par.featuresPerNode ? par.featuresPerNode : x->getNumberOfColumns();
     const bool inexactWithHistMethod =
@@ -214,25 +215,29 @@ services::Status RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compu
     algorithmFPType * ptrTotalGain  = totalGainRows.get();
     algorithmFPType * ptrGain       = gainRows.get();
 
+    typedef daal::algorithms::gbt::regression::internal::ModelImpl ModelImplType;
+    ModelImplType & mImpl                             = *static_cast<ModelImplType *>(&m);
+    const gbt::internal::ModelImpl * initialModelImpl = initialModel ? static_cast<const ModelImplType *>(initialModel) : nullptr;
+
     if (inexactWithHistMethod)
     {
         if (indexedFeatures.maxNumIndices() <= 256)
             return computeImpl<algorithmFPType, cpu, uint8_t, TrainBatchTask<algorithmFPType, uint8_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, mImpl, initialModelImpl, par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else if (indexedFeatures.maxNumIndices() <= 65536)
             return computeImpl<algorithmFPType, cpu, uint16_t, TrainBatchTask<algorithmFPType, uint16_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, mImpl, initialModelImpl, par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
         else
             return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-                pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures,
+                pHostApp, x, y, mImpl, initialModelImpl, par, engine, 1, indexedFeatures,
                 featTypes, &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
     else
     {
         return computeImpl<algorithmFPType, cpu, uint32_t, TrainBatchTask<algorithmFPType, uint32_t, method, cpu>, Result>(
-            pHostApp, x, y, *static_cast<daal::algorithms::gbt::regression::internal::ModelImpl *>(&m), par, engine, 1, indexedFeatures, featTypes,
+            pHostApp, x, y, mImpl, initialModelImpl, par, engine, 1, indexedFeatures, featTypes,
             &res, ptrWeight, ptrCover, ptrTotalCover, ptrGain, ptrTotalGain);
     }
 }
@@ -50,7 +50,7 @@ class RegressionTrainBatchKernel : public daal::algorithms::Kernel
 {
 public:
     services::Status compute(HostAppIface * pHostApp, const NumericTable * x, const NumericTable * y, gbt::regression::Model & m, Result & res,
-                             const Parameter & par, engines::internal::BatchBaseImpl & engine);
+                             const Parameter & par, engines::internal::BatchBaseImpl & engine, const gbt::regression::Model * initialModel = nullptr);
 };
 
 } // namespace internal
@@ -51,7 +51,7 @@ Status Parameter::check() const
 }
 
 /** Default constructor */
-Input::Input() : algorithms::regression::training::Input(lastInputId + 1) {}
+Input::Input() : algorithms::regression::training::Input(lastModelInputId + 1) {}
 
 /**
  * Returns an input object for gradient boosted trees model-based training
@@ -73,6 +73,26 @@ void Input::set(InputId id, const NumericTablePtr & value)
     algorithms::regression::training::Input::set(algorithms::regression::training::InputId(id), value);
 }
 
+/**
+ * Returns an input model for gradient boosted trees model-based training
+ * \param[in] id    Identifier of the input model
+ * \return          %Input model that corresponds to the given identifier
+ */
+gbt::regression::ModelPtr Input::get(ModelInputId id) const
+{
+    return staticPointerCast<gbt::regression::Model, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input model for gradient boosted trees model-based training
+ * \param[in] id      Identifier of the input model
+ * \param[in] value   Pointer to the model
+ */
+void Input::set(ModelInputId id, const gbt::regression::ModelPtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
 * Checks an input object for the gradient boosted trees algorithm
 * \param[in] par     Algorithm parameter
@@ -94,6 +114,10 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     DAAL_CHECK_EX(nSamplesPerTree > 0, ErrorIncorrectParameter, ParameterName, observationsPerTreeFractionStr());
     const auto nFeatures = dataTable->getNumberOfColumns();
     DAAL_CHECK_EX(parameter->featuresPerNode <= nFeatures, ErrorIncorrectParameter, ParameterName, featuresPerNodeStr());
+
+    const gbt::regression::ModelPtr initialModel = get(inputModel);
+    if (initialModel.get() && initialModel->getNumberOfTrees())
+        DAAL_CHECK_EX(initialModel->getNumberOfFeatures() == nFeatures, ErrorIncorrectNumberOfFeatures, ArgumentName, inputModelStr());
     return s;
 }
 
@@ -25,6 +25,7 @@
 #define __GBT_REGRESSION_TREE_IMPL__
 
 #include "data_management/data/aos_numeric_table.h"
+#include "algorithms/gradient_boosted_trees/gbt_training_parameter.h"
 #include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
 
 namespace daal
@@ -257,7 +258,7 @@ public:
     TableRecordType * get(size_t nid) { return &(_records[nid]); }
 
     void createNode(size_t level, size_t nid, size_t n, size_t iStart, algorithmFPType gTotal, algorithmFPType hTotal, size_t nTotal,
-                    const training::Parameter & par)
+                    const gbt::training::Parameter & par)
     {
         DAAL_ASSERT(nid < _table->getNumberOfRows());
 
@@ -312,7 +313,7 @@ public:
 
     template <CpuType cpu>
     void convertToGbtDecisionTree(algorithmFPType ** binValues, const size_t nNodes, const size_t maxLevel, gbt::internal::GbtDecisionTree * tree,
-                                  double * impVals, int * nNodeSamplesVals, const algorithmFPType initialF, const training::Parameter & par)
+                                  double * impVals, int * nNodeSamplesVals, const algorithmFPType initialF, const gbt::training::Parameter & par)
     {
         services::Collection<TableRecordType *> sonsArr(nNodes + 1);
         services::Collection<TableRecordType *> parentsArr(nNodes + 1);
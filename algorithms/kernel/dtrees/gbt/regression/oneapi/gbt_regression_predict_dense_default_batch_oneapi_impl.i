@@ -0,0 +1,77 @@
+/* file: gbt_regression_predict_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression prediction on GPU.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __GBT_REGRESSION_PREDICT_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/gbt/regression/oneapi/gbt_regression_predict_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/regression/gbt_regression_model_impl.h"
+#include "algorithms/kernel/dtrees/oneapi/dtrees_predict_dense_default_oneapi_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services;
+
+template <typename algorithmFPType, gbt::regression::prediction::Method method>
+services::Status PredictKernelOneAPI<algorithmFPType, method>::compute(services::HostAppIface * pHostApp, const NumericTable * a,
+                                                                       const regression::Model * m, NumericTable * r, size_t nIterations)
+{
+    typedef dtrees::prediction::internal::TreeEnsemblePredictOneAPI<algorithmFPType> Predictor;
+
+    const gbt::regression::internal::ModelImpl * const pModel = static_cast<const gbt::regression::internal::ModelImpl *>(m);
+
+    const size_t nTrees = nIterations ? nIterations : pModel->size();
+    DAAL_CHECK(nTrees <= pModel->size(), ErrorGbtPredictIncorrectNumberOfIterations);
+
+    services::Collection<const gbt::internal::GbtDecisionTree *> trees(nTrees);
+    DAAL_CHECK_MALLOC(trees.size() == nTrees);
+    DAAL_CHECK_STATUS_VAR(pModel->loadTrees(nTrees));
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        trees[i] = pModel->at(i);
+    }
+
+    Predictor predictor;
+    services::Status status = predictor.initFromGbtTrees(trees.data(), nTrees);
+    DAAL_CHECK_STATUS_VAR(status);
+    return predictor.predict(*a, Predictor::treeResponse, 1, Predictor::scaledResponse, algorithmFPType(1), r, nullptr);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
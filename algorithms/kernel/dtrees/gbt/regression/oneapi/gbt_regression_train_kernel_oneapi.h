@@ -32,6 +32,7 @@
 #include "algorithms/gradient_boosted_trees/gbt_regression_training_types.h"
 #include "algorithms/kernel/engines/engine_batch_impl.h"
 #include "algorithms/kernel/dtrees/gbt/oneapi/gbt_feature_type_helper_oneapi.h"
+#include "algorithms/kernel/dtrees/gbt/oneapi/gbt_tree_builder_oneapi.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -66,80 +67,11 @@ private:
 
     services::Status computeOptCoeffs(NumericTable & y, oneapi::internal::UniversalBuffer & response, oneapi::internal::UniversalBuffer & optCoeffs);
 
-    services::Status initializeTreeOrder(size_t nRows, oneapi::internal::UniversalBuffer & treeOrder);
-
-    services::Status computePartialHistograms(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
-                                              oneapi::internal::UniversalBuffer & optCoeffs, oneapi::internal::UniversalBuffer & partialHistograms,
-                                              size_t iStart, size_t nRows, oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins,
-                                              size_t nFeatures, size_t localSize, size_t nPartialHistograms);
-
-    services::Status reducePartialHistograms(oneapi::internal::UniversalBuffer & partialHistograms, oneapi::internal::UniversalBuffer & histograms,
-                                             size_t nTotalBins, size_t reduceLocalSize, size_t nPartialHistograms);
-
-    services::Status computeHistogram(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
-                                      oneapi::internal::UniversalBuffer & optCoeffs, oneapi::internal::UniversalBuffer & partialHistograms,
-                                      oneapi::internal::UniversalBuffer & histograms, size_t iStart, size_t nRows,
-                                      oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures);
-
-    services::Status computeHistogramDiff(oneapi::internal::UniversalBuffer & histogramSrc, oneapi::internal::UniversalBuffer & histogramTotal,
-                                          oneapi::internal::UniversalBuffer & histogramDst, size_t nBins);
-
-    services::Status computeTotalOptCoeffs(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & totalOptCoeffs,
-                                           oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures, size_t localSize);
-
-    services::Status computeBestSplitForFeatures(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & totalOptCoeffs,
-                                                 oneapi::internal::UniversalBuffer & splitInfo, oneapi::internal::UniversalBuffer & splitValue,
-                                                 oneapi::internal::UniversalBuffer & binOffsets, size_t nTotalBins, size_t nFeatures,
-                                                 algorithmFPType lambda, size_t localSize);
-
-    services::Status computeBestSplit(oneapi::internal::UniversalBuffer & histograms, oneapi::internal::UniversalBuffer & binOffsets,
-                                      size_t nTotalBins, size_t nFeatures, algorithmFPType lambda,
-                                      gbt::internal::BestSplitOneAPI<algorithmFPType> & bestSplit, algorithmFPType * gTotal = nullptr,
-                                      algorithmFPType * hTotal = nullptr);
-
-    services::Status partitionScan(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
-                                   oneapi::internal::UniversalBuffer & partialSums, int splitValue, size_t iStart, size_t nRows, size_t localSize,
-                                   size_t nLocalSums);
-
-    services::Status partitionSumScan(oneapi::internal::UniversalBuffer & partialSums, oneapi::internal::UniversalBuffer & partialPrefixSums,
-                                      oneapi::internal::UniversalBuffer & totalSum, size_t localSize, size_t nSubgroupSums);
-
-    services::Status partitionReorder(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
-                                      oneapi::internal::UniversalBuffer & treeOrderBuf, oneapi::internal::UniversalBuffer & partialPrefixSums,
-                                      int spliteValue, size_t iStart, size_t nRows, size_t localSize, size_t nLocalSums);
-
-    services::Status partitionCopy(oneapi::internal::UniversalBuffer & treeOrderBuf, oneapi::internal::UniversalBuffer & treeOrder, size_t iStart,
-                                   size_t nRows);
-
-    services::Status doPartition(const oneapi::internal::UniversalBuffer & data, oneapi::internal::UniversalBuffer & treeOrder,
-                                 oneapi::internal::UniversalBuffer & treeOrderBuf, int splitValue, size_t iStart, size_t nRows, size_t & nLeft,
-                                 size_t & nRight);
-
-    services::Status updateResponse(oneapi::internal::UniversalBuffer & treeOrder, oneapi::internal::UniversalBuffer & response, size_t iStart,
-                                    size_t nRows, algorithmFPType inc);
-
     oneapi::internal::KernelPtr kernelScan;
     oneapi::internal::KernelPtr kernelReduce;
-    oneapi::internal::KernelPtr kernelInitializeTreeOrder;
-    oneapi::internal::KernelPtr kernelComputePartialHistograms;
-    oneapi::internal::KernelPtr kernelReducePartialHistograms;
-    oneapi::internal::KernelPtr kernelComputeHistogramDiff;
     oneapi::internal::KernelPtr kernelComputeOptCoeffs;
-    oneapi::internal::KernelPtr kernelComputeTotalOptCoeffs;
-    oneapi::internal::KernelPtr kernelComputeBestSplitForFeatures;
-    oneapi::internal::KernelPtr kernelPartitionScan;
-    oneapi::internal::KernelPtr kernelPartitionSumScan;
-    oneapi::internal::KernelPtr kernelPartitionReorder;
-    oneapi::internal::KernelPtr kernelPartitionCopy;
-    oneapi::internal::KernelPtr kernelUpdateResponse;
 
-    const uint32_t _maxWorkItemsPerGroup = 128;   // should be a power of two for interal needs
-    const uint32_t _maxLocalBuffer       = 30000; // should be less than a half of local memory (two buffers)
-    const uint32_t _preferableSubGroup   = 16;    // preferable maximal sub-group size
-    const uint32_t _maxLocalSize         = 128;
-    const uint32_t _maxLocalSums         = 256;
-    const uint32_t _maxLocalHistograms   = 256;
-    const uint32_t _preferableGroupSize  = 256;
+    const uint32_t _preferableSubGroup = 16; // preferable maximal sub-group size
 };
 
 } // namespace internal
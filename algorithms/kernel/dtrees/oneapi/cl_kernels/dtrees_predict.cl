@@ -0,0 +1,158 @@
+/* file: dtrees_predict.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of OpenCL kernels of the decision trees ensembles prediction.
+//  Trees are stored in the flattened layout: featureIndexes[i] is the split feature of the node i or -1 for a leaf,
+//  leftIndexes[i] is the index of the left child of the split node (the right child follows it)
+//  or the class of the classification leaf, values[i] is the split value or the response of the leaf.
+//--
+*/
+
+#ifndef __DTREES_PREDICT_CL__
+#define __DTREES_PREDICT_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    dtrees_predict,
+
+    /* Each work-group processes one row, work-items of the group traverse different trees.
+       responseType: 0 - responses of the trees are summed up in the group tree % nGroups,
+                     1 - votes for the classes of the leaves, 2 - sums of the class probabilities of the leaves */
+    __kernel void predictByTrees(__global const algorithmFPType * data, uint nCols, __global const int * featureIndexes,
+                                 __global const int * leftIndexes, __global const algorithmFPType * values, __global const uint * treeOffsets,
+                                 __global const uint * isUnordered, __global const algorithmFPType * probabilities, uint nTrees, uint nGroups,
+                                 uint responseType, __global algorithmFPType * partialSums, __global algorithmFPType * sums) {
+        const uint row       = get_global_id(0);
+        const uint localId   = get_local_id(1);
+        const uint localSize = get_local_size(1);
+
+        __global const algorithmFPType * x = data + row * nCols;
+        __global algorithmFPType * partial = partialSums + (row * localSize + localId) * nGroups;
+
+        for (uint g = 0; g < nGroups; g++)
+        {
+            partial[g] = (algorithmFPType)0;
+        }
+
+        for (uint t = localId; t < nTrees; t += localSize)
+        {
+            uint node = treeOffsets[t];
+            for (int feature = featureIndexes[node]; feature >= 0; feature = featureIndexes[node])
+            {
+                const algorithmFPType value = values[node];
+                const uint isRight          = isUnordered[feature] ? ((int)x[feature] != (int)value) : (x[feature] > value);
+                node                        = treeOffsets[t] + leftIndexes[node] + isRight;
+            }
+
+            if (responseType == 0)
+            {
+                partial[t % nGroups] += values[node];
+            }
+            else if (responseType == 1)
+            {
+                partial[leftIndexes[node]] += (algorithmFPType)1;
+            }
+            else
+            {
+                for (uint g = 0; g < nGroups; g++)
+                {
+                    partial[g] += probabilities[node * nGroups + g];
+                }
+            }
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        for (uint g = localId; g < nGroups; g += localSize)
+        {
+            algorithmFPType sum = (algorithmFPType)0;
+            for (uint l = 0; l < localSize; l++)
+            {
+                sum += partialSums[(row * localSize + l) * nGroups + g];
+            }
+            sums[row * nGroups + g] = sum;
+        }
+    }
+
+    /* finalizeType: 0 - scaled response, 1 - scaled sums are the probabilities of the classes,
+                     2 - sigmoid of the response for two classes, 3 - softmax of the responses of the classes */
+    __kernel void finalize(__global const algorithmFPType * sums, uint nGroups, uint finalizeType, algorithmFPType scale,
+                           uint computeLabels, uint computeProbabilities, __global algorithmFPType * labels,
+                           __global algorithmFPType * probabilities) {
+        const uint row                     = get_global_id(0);
+        __global const algorithmFPType * s = sums + row * nGroups;
+
+        if (finalizeType == 0)
+        {
+            labels[row] = scale * s[0];
+            return;
+        }
+
+        if (finalizeType == 2)
+        {
+            const algorithmFPType f = s[0];
+            if (computeLabels) labels[row] = (f >= (algorithmFPType)0) ? (algorithmFPType)1 : (algorithmFPType)0;
+            if (computeProbabilities)
+            {
+                const algorithmFPType p    = (algorithmFPType)1 / ((algorithmFPType)1 + exp(-f));
+                probabilities[2 * row]     = (algorithmFPType)1 - p;
+                probabilities[2 * row + 1] = p;
+            }
+            return;
+        }
+
+        uint maxClass            = 0;
+        algorithmFPType maxValue = s[0];
+        for (uint g = 1; g < nGroups; g++)
+        {
+            if (s[g] > maxValue)
+            {
+                maxValue = s[g];
+                maxClass = g;
+            }
+        }
+        if (computeLabels) labels[row] = (algorithmFPType)maxClass;
+        if (!computeProbabilities) return;
+
+        __global algorithmFPType * p = probabilities + row * nGroups;
+        if (finalizeType == 1)
+        {
+            for (uint g = 0; g < nGroups; g++)
+            {
+                p[g] = scale * s[g];
+            }
+        }
+        else
+        {
+            algorithmFPType sum = (algorithmFPType)0;
+            for (uint g = 0; g < nGroups; g++)
+            {
+                p[g] = exp(s[g] - maxValue);
+                sum += p[g];
+            }
+            for (uint g = 0; g < nGroups; g++)
+            {
+                p[g] /= sum;
+            }
+        }
+    }
+
+);
+
+#endif
@@ -0,0 +1,367 @@
+/* file: dtrees_predict_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the decision trees ensembles prediction on GPU
+//--
+*/
+
+#ifndef __DTREES_PREDICT_DENSE_DEFAULT_ONEAPI_IMPL_I__
+#define __DTREES_PREDICT_DENSE_DEFAULT_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/dtrees/oneapi/dtrees_predict_kernel_oneapi.h"
+#include "algorithms/kernel/dtrees/oneapi/cl_kernels/dtrees_predict.cl"
+#include "algorithms/kernel/dtrees/dtrees_feature_type_helper.h"
+
+#include "externals/service_ittnotify.h"
+#include "services/env_detect.h"
+#include "services/error_indexes.h"
+#include "service/kernel/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::data_management;
+using namespace daal::services;
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.buildProgram);
+
+    auto fptype_name   = getKeyFPType<algorithmFPType>();
+    auto build_options = fptype_name;
+    build_options.add("-cl-std=CL1.2");
+
+    services::String cachekey("__daal_algorithms_dtrees_predict_");
+    cachekey.add(fptype_name);
+
+    Status st;
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), dtrees_predict, build_options.c_str(), &st);
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::allocate(size_t nTrees, size_t nNodes, size_t nClasses)
+{
+    DAAL_CHECK(nNodes <= static_cast<size_t>(INT_MAX), ErrorBufferSizeIntegerOverflow);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nNodes, nClasses);
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    Status st;
+
+    _featureIndexes = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _leftIndexes = context.allocate(TypeIds::id<int>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _values = context.allocate(TypeIds::id<algorithmFPType>(), nNodes, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _treeOffsets = context.allocate(TypeIds::id<uint32_t>(), nTrees, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    _probabilities = context.allocate(TypeIds::id<algorithmFPType>(), nClasses ? nNodes * nClasses : 1, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    _nTrees   = nTrees;
+    _nNodes   = nNodes;
+    _nClasses = nClasses;
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::initFromGbtTrees(const gbt::internal::GbtDecisionTree * const * trees, size_t nTrees)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.initModel);
+
+    size_t nNodes = 0;
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        nNodes += trees[i]->getNumberOfNodes();
+    }
+    DAAL_CHECK_STATUS_VAR(allocate(nTrees, nNodes, 0));
+
+    Status st;
+    auto featureIndexesHost = _featureIndexes.template get<int>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto leftIndexesHost = _leftIndexes.template get<int>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto valuesHost = _values.template get<algorithmFPType>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto treeOffsetsHost = _treeOffsets.template get<uint32_t>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    int * const featureIndexes     = featureIndexesHost.get();
+    int * const leftIndexes        = leftIndexesHost.get();
+    algorithmFPType * const values = valuesHost.get();
+    uint32_t * const treeOffsets   = treeOffsetsHost.get();
+
+    /* Complete binary tree of the depth maxLvl: children of the node j are 2 * j + 1 and 2 * j + 2, all the leaves are on the last level */
+    size_t offset = 0;
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        const size_t nTreeNodes  = trees[i]->getNumberOfNodes();
+        const size_t nInternal   = (size_t(1) << trees[i]->getMaxLvl()) - 1;
+        const size_t nSplitNodes = nInternal < nTreeNodes ? nInternal : nTreeNodes;
+
+        const gbt::prediction::internal::ModelFPType * const splitPoints   = trees[i]->getSplitPoints();
+        const gbt::prediction::internal::FeatureIndexType * const fIndexes = trees[i]->getFeatureIndexesForSplit();
+
+        treeOffsets[i] = static_cast<uint32_t>(offset);
+        for (size_t j = 0; j < nTreeNodes; j++)
+        {
+            const bool isSplit         = j < nSplitNodes;
+            featureIndexes[offset + j] = isSplit ? static_cast<int>(gbt::prediction::internal::getSplitFeature(fIndexes[j])) : -1;
+            leftIndexes[offset + j]    = isSplit ? static_cast<int>(2 * j + 1) : 0;
+            values[offset + j]         = static_cast<algorithmFPType>(splitPoints[j]);
+        }
+        offset += nTreeNodes;
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::initFromDecisionTrees(const dtrees::internal::ModelImpl & model, size_t nTrees, size_t nClasses)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.initModel);
+
+    size_t nNodes = 0;
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        nNodes += model.at(i)->getNumberOfRows();
+        if (!model.getProbas(i)) nClasses = 0;
+    }
+    DAAL_CHECK_STATUS_VAR(allocate(nTrees, nNodes, nClasses));
+
+    Status st;
+    auto featureIndexesHost = _featureIndexes.template get<int>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto leftIndexesHost = _leftIndexes.template get<int>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto valuesHost = _values.template get<algorithmFPType>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto treeOffsetsHost = _treeOffsets.template get<uint32_t>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto probabilitiesHost = _probabilities.template get<algorithmFPType>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    int * const featureIndexes            = featureIndexesHost.get();
+    int * const leftIndexes               = leftIndexesHost.get();
+    algorithmFPType * const values        = valuesHost.get();
+    uint32_t * const treeOffsets          = treeOffsetsHost.get();
+    algorithmFPType * const probabilities = probabilitiesHost.get();
+
+    size_t offset = 0;
+    for (size_t i = 0; i < nTrees; i++)
+    {
+        const dtrees::internal::DecisionTreeTable * const tree = model.at(i);
+        const dtrees::internal::DecisionTreeNode * const nodes = (const dtrees::internal::DecisionTreeNode *)tree->getArray();
+        const size_t nTreeNodes                                = tree->getNumberOfRows();
+
+        treeOffsets[i] = static_cast<uint32_t>(offset);
+        for (size_t j = 0; j < nTreeNodes; j++)
+        {
+            featureIndexes[offset + j] = nodes[j].featureIndex;
+            leftIndexes[offset + j]    = static_cast<int>(nodes[j].leftIndexOrClass);
+            values[offset + j]         = static_cast<algorithmFPType>(nodes[j].featureValueOrResponse);
+        }
+
+        if (nClasses)
+        {
+            const double * const probas = model.getProbas(i);
+            for (size_t j = 0; j < nTreeNodes * nClasses; j++)
+            {
+                probabilities[offset * nClasses + j] = static_cast<algorithmFPType>(probas[j]);
+            }
+        }
+        offset += nTreeNodes;
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::initFeatureTypes(const NumericTable & data)
+{
+    const size_t nCols = data.getNumberOfColumns();
+
+    dtrees::internal::FeatureTypes featureTypes;
+    DAAL_CHECK_MALLOC(featureTypes.init(data));
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    Status st;
+    _isUnordered = context.allocate(TypeIds::id<uint32_t>(), nCols, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    auto isUnorderedHost = _isUnordered.template get<uint32_t>().toHost(writeOnly, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    for (size_t j = 0; j < nCols; j++)
+    {
+        isUnorderedHost.get()[j] = featureTypes.isUnordered(j) ? 1 : 0;
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::predictByTrees(const Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nCols,
+                                                                  ResponseType responseType, uint32_t nGroups, UniversalBuffer & partialSums,
+                                                                  UniversalBuffer & sums, uint32_t localSize)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.predictByTrees);
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    auto & factory = context.getClKernelFactory();
+    DAAL_CHECK_STATUS_VAR(buildProgram(factory));
+
+    Status st;
+    auto kernel = factory.getKernel("predictByTrees", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(13);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, nCols);
+    args.set(2, _featureIndexes, AccessModeIds::read);
+    args.set(3, _leftIndexes, AccessModeIds::read);
+    args.set(4, _values, AccessModeIds::read);
+    args.set(5, _treeOffsets, AccessModeIds::read);
+    args.set(6, _isUnordered, AccessModeIds::read);
+    args.set(7, _probabilities, AccessModeIds::read);
+    args.set(8, static_cast<uint32_t>(_nTrees));
+    args.set(9, nGroups);
+    args.set(10, static_cast<uint32_t>(responseType));
+    args.set(11, partialSums, AccessModeIds::readwrite);
+    args.set(12, sums, AccessModeIds::write);
+
+    KernelRange localRange(1, localSize);
+    KernelRange globalRange(nRows, localSize);
+
+    KernelNDRange range(2);
+    range.global(globalRange, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    range.local(localRange, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    context.run(range, kernel, args, &st);
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::finalize(const UniversalBuffer & sums, uint32_t nRows, uint32_t nGroups, FinalizeType finalizeType,
+                                                            algorithmFPType scale, const UniversalBuffer & labels,
+                                                            const UniversalBuffer & probabilities, bool computeLabels, bool computeProbabilities)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.finalize);
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    auto & factory = context.getClKernelFactory();
+    DAAL_CHECK_STATUS_VAR(buildProgram(factory));
+
+    Status st;
+    auto kernel = factory.getKernel("finalize", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(8);
+    args.set(0, sums, AccessModeIds::read);
+    args.set(1, nGroups);
+    args.set(2, static_cast<uint32_t>(finalizeType));
+    args.set(3, scale);
+    args.set(4, static_cast<uint32_t>(computeLabels));
+    args.set(5, static_cast<uint32_t>(computeProbabilities));
+    args.set(6, labels, AccessModeIds::write);
+    args.set(7, probabilities, AccessModeIds::write);
+
+    KernelRange range(nRows);
+    context.run(range, kernel, args, &st);
+    return st;
+}
+
+template <typename algorithmFPType>
+Status TreeEnsemblePredictOneAPI<algorithmFPType>::predict(const NumericTable & data, ResponseType responseType, size_t nGroups,
+                                                           FinalizeType finalizeType, algorithmFPType scale, NumericTable * labels,
+                                                           NumericTable * probabilities)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    const size_t nRows = data.getNumberOfRows();
+    const size_t nCols = data.getNumberOfColumns();
+    if (!nRows || !_nTrees) return Status();
+
+    DAAL_CHECK(nCols <= static_cast<size_t>(UINT_MAX) && nGroups <= static_cast<size_t>(UINT_MAX), ErrorBufferSizeIntegerOverflow);
+    DAAL_CHECK_STATUS_VAR(initFeatureTypes(data));
+
+    const uint32_t maxBlockRowCount = 4096;
+    const uint32_t maxLocalSize     = 32;
+    const uint32_t localSize        = _nTrees < maxLocalSize ? static_cast<uint32_t>(_nTrees) : maxLocalSize;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxBlockRowCount * localSize, nGroups);
+
+    auto & context = Environment::getInstance()->getDefaultExecutionContext();
+    Status st;
+    auto partialSums = context.allocate(TypeIds::id<algorithmFPType>(), maxBlockRowCount * localSize * nGroups, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto sums = context.allocate(TypeIds::id<algorithmFPType>(), maxBlockRowCount * nGroups, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    NumericTable & dataTable = const_cast<NumericTable &>(data);
+    for (size_t startRow = 0; startRow < nRows; startRow += maxBlockRowCount)
+    {
+        const uint32_t nBlockRows = static_cast<uint32_t>(nRows - startRow < maxBlockRowCount ? nRows - startRow : maxBlockRowCount);
+
+        BlockDescriptor<algorithmFPType> dataRows;
+        DAAL_CHECK_STATUS_VAR(dataTable.getBlockOfRows(startRow, nBlockRows, readOnly, dataRows));
+        DAAL_CHECK_STATUS_VAR(predictByTrees(dataRows.getBuffer(), nBlockRows, static_cast<uint32_t>(nCols), responseType,
+                                             static_cast<uint32_t>(nGroups), partialSums, sums, localSize));
+        DAAL_CHECK_STATUS_VAR(dataTable.releaseBlockOfRows(dataRows));
+
+        /* Absent results are replaced with the sums buffer, the kernel does not write them */
+        BlockDescriptor<algorithmFPType> labelRows;
+        BlockDescriptor<algorithmFPType> probabilityRows;
+        UniversalBuffer labelsBuffer        = sums;
+        UniversalBuffer probabilitiesBuffer = sums;
+        if (labels)
+        {
+            DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(startRow, nBlockRows, writeOnly, labelRows));
+            labelsBuffer = labelRows.getBuffer();
+        }
+        if (probabilities)
+        {
+            DAAL_CHECK_STATUS_VAR(probabilities->getBlockOfRows(startRow, nBlockRows, writeOnly, probabilityRows));
+            probabilitiesBuffer = probabilityRows.getBuffer();
+        }
+
+        DAAL_CHECK_STATUS_VAR(finalize(sums, nBlockRows, static_cast<uint32_t>(nGroups), finalizeType, scale, labelsBuffer, probabilitiesBuffer,
+                                       labels != nullptr, probabilities != nullptr));
+
+        if (labels) DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
+        if (probabilities) DAAL_CHECK_STATUS_VAR(probabilities->releaseBlockOfRows(probabilityRows));
+    }
+    return st;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
+
+#endif
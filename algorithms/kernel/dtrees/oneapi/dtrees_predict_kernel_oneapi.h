@@ -0,0 +1,114 @@
+/* file: dtrees_predict_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class that computes the predictions of the decision trees ensembles on GPU
+//--
+*/
+
+#ifndef __DTREES_PREDICT_KERNEL_ONEAPI_H__
+#define __DTREES_PREDICT_KERNEL_ONEAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/kernel/dtrees/dtrees_model_impl.h"
+#include "algorithms/kernel/dtrees/gbt/gbt_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dtrees
+{
+namespace prediction
+{
+namespace internal
+{
+/**
+ * Computes the predictions of the trees ensemble on GPU. The trees are copied to the device in the flattened layout
+ * with one array per node attribute, so that the model is uploaded in a few transfers and traversed without pointer chasing.
+ * Responses of the trees are reduced on the device.
+ */
+template <typename algorithmFPType>
+class TreeEnsemblePredictOneAPI : public Base
+{
+public:
+    /* How the leaves of the trees contribute to the per-row sums */
+    enum ResponseType
+    {
+        treeResponse           = 0, /* response of the tree i is added to the sum i % nGroups */
+        leafClassVote          = 1, /* leaf votes for its class */
+        leafClassProbabilities = 2  /* class probabilities of the leaf are added to the sums */
+    };
+
+    /* How the per-row sums are converted into the results */
+    enum FinalizeType
+    {
+        scaledResponse      = 0,
+        scaledProbabilities = 1,
+        sigmoid             = 2,
+        softmax             = 3
+    };
+
+    TreeEnsemblePredictOneAPI() : _nTrees(0), _nNodes(0), _nClasses(0) {}
+
+    /* Uploads the trees stored as complete binary trees */
+    services::Status initFromGbtTrees(const gbt::internal::GbtDecisionTree * const * trees, size_t nTrees);
+
+    /* Uploads the trees of the decision forest model, the class probabilities of the leaves are uploaded if nClasses is not zero */
+    services::Status initFromDecisionTrees(const dtrees::internal::ModelImpl & model, size_t nTrees, size_t nClasses);
+
+    bool hasLeafProbabilities() const { return _nClasses != 0; }
+
+    services::Status predict(const data_management::NumericTable & data, ResponseType responseType, size_t nGroups, FinalizeType finalizeType,
+                             algorithmFPType scale, data_management::NumericTable * labels, data_management::NumericTable * probabilities);
+
+private:
+    services::Status allocate(size_t nTrees, size_t nNodes, size_t nClasses);
+
+    services::Status initFeatureTypes(const data_management::NumericTable & data);
+
+    services::Status predictByTrees(const services::Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nCols, ResponseType responseType,
+                                    uint32_t nGroups, oneapi::internal::UniversalBuffer & partialSums, oneapi::internal::UniversalBuffer & sums,
+                                    uint32_t localSize);
+
+    services::Status finalize(const oneapi::internal::UniversalBuffer & sums, uint32_t nRows, uint32_t nGroups, FinalizeType finalizeType,
+                              algorithmFPType scale, const oneapi::internal::UniversalBuffer & labels,
+                              const oneapi::internal::UniversalBuffer & probabilities, bool computeLabels, bool computeProbabilities);
+
+    static services::Status buildProgram(oneapi::internal::ClKernelFactoryIface & factory);
+
+    size_t _nTrees;
+    size_t _nNodes;
+    size_t _nClasses;
+    oneapi::internal::UniversalBuffer _featureIndexes;
+    oneapi::internal::UniversalBuffer _leftIndexes;
+    oneapi::internal::UniversalBuffer _values;
+    oneapi::internal::UniversalBuffer _treeOffsets;
+    oneapi::internal::UniversalBuffer _probabilities;
+    oneapi::internal::UniversalBuffer _isUnordered;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace dtrees
+} // namespace algorithms
+} // namespace daal
+
+#endif
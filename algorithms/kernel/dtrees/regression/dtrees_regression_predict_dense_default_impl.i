@@ -74,23 +74,134 @@ protected:
         algorithmFPType val    = 0;
         const size_t iLastTree = iFirstTree + nTrees;
 
+        if (_compactForest)
+        {
+            for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree)
+            {
+                const size_t idx = dtrees::prediction::internal::findNode<algorithmFPType, cpu>(*_compactForest, iTree, _featHelper, x);
+                val += _compactForest->getResponse(_compactForest->getNodes(iTree)[idx]);
+            }
+            return val;
+        }
         for (size_t iTree = iFirstTree; iTree < iLastTree; ++iTree) val += predict(*_aTree[iTree], _featHelper, x);
         return val;
     }
+
+    /* Copies the trees to the arrays of feature indices, left child indices and split values or responses.
+       The nodes of every tree keep the breadth-first order of DecisionTreeTable, the child indices are local to the tree */
+    services::Status convertTrees();
+
+    /* Computes the sum of the responses of the trees for s_cVectorBlockSize rows, all rows of the block descend one level per pass */
+    void predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x, size_t nCols, algorithmFPType * res);
+
     services::Status run(services::HostAppIface * pHostApp, algorithmFPType factor);
 
 protected:
+    static const size_t s_cVectorBlockSize = 32;
+
     dtrees::internal::FeatureTypes _featHelper;
     TArray<const dtrees::internal::DecisionTreeTable *, cpu> _aTree;
+    dtrees::internal::CompactForestPtr _compactForest; /* set instead of _aTree when the model is compact */
+    TArray<int, cpu> _tFI;         /* split: feature index, leaf: -1 */
+    TArray<int, cpu> _tLC;         /* split: index of the left child in the tree */
+    TArray<ModelFPType, cpu> _tFV; /* split: feature value, leaf: response */
+    TArray<size_t, cpu> _treeOffsets;
     const NumericTable * _data;
     NumericTable * _res;
 };
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::convertTrees()
+{
+    const size_t nTreesTotal = _aTree.size();
+    _treeOffsets.reset(nTreesTotal + 1);
+    DAAL_CHECK_MALLOC(_treeOffsets.get());
+    size_t * const offsets = _treeOffsets.get();
+    offsets[0]             = 0;
+    for (size_t iTree = 0; iTree < nTreesTotal; ++iTree) offsets[iTree + 1] = offsets[iTree] + _aTree[iTree]->getNumberOfRows();
+
+    const size_t nNodesTotal = offsets[nTreesTotal];
+    _tFI.reset(nNodesTotal);
+    _tLC.reset(nNodesTotal);
+    _tFV.reset(nNodesTotal);
+    DAAL_CHECK_MALLOC(_tFI.get() && _tLC.get() && _tFV.get());
+
+    daal::threader_for(nTreesTotal, nTreesTotal, [&](size_t iTree) {
+        const DecisionTreeNode * const aNode = (const DecisionTreeNode *)_aTree[iTree]->getArray();
+        const size_t treeSize                = offsets[iTree + 1] - offsets[iTree];
+        int * const fi                       = _tFI.get() + offsets[iTree];
+        int * const lc                       = _tLC.get() + offsets[iTree];
+        ModelFPType * const fv               = _tFV.get() + offsets[iTree];
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < treeSize; ++i)
+        {
+            fi[i] = aNode[i].featureIndex;
+            lc[i] = aNode[i].isSplit() ? int(aNode[i].leftIndexOrClass) : 0;
+            fv[i] = aNode[i].featureValueOrResponse;
+        }
+    });
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PredictRegressionTaskBase<algorithmFPType, cpu>::predictByTreesVector(size_t iFirstTree, size_t nTrees, const algorithmFPType * x,
+                                                                           size_t nCols, algorithmFPType * res)
+{
+    int nodes[s_cVectorBlockSize];
+    algorithmFPType val[s_cVectorBlockSize];
+    services::internal::service_memset_seq<algorithmFPType, cpu>(val, algorithmFPType(0), s_cVectorBlockSize);
+
+    for (size_t iTree = iFirstTree, iLastTree = iFirstTree + nTrees; iTree < iLastTree; ++iTree)
+    {
+        const int * const fi         = _tFI.get() + _treeOffsets[iTree];
+        const int * const lc         = _tLC.get() + _treeOffsets[iTree];
+        const ModelFPType * const fv = _tFV.get() + _treeOffsets[iTree];
+        services::internal::service_memset_seq<int, cpu>(nodes, 0, s_cVectorBlockSize);
+
+        /* The rows that reached a leaf stay there, the search stops when no row is left in a split node */
+        for (size_t check = (fi[0] != -1); check > 0;)
+        {
+            check = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < s_cVectorBlockSize; ++i)
+            {
+                const int cn      = nodes[i];
+                const int isSplit = (fi[cn] != -1);
+                const int idx     = isSplit * fi[cn];
+                const int sn      = (x[i * nCols + idx] > fv[cn]);
+                nodes[i]          = isSplit ? lc[cn] + sn : cn;
+                check += isSplit;
+            }
+        }
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < s_cVectorBlockSize; ++i) val[i] += algorithmFPType(fv[nodes[i]]);
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < s_cVectorBlockSize; ++i) res[i] = val[i];
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::HostAppIface * pHostApp, algorithmFPType factor)
 {
     const auto nTreesTotal = _aTree.size();
-    const auto treeSize    = _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+    const auto treeSize    = _compactForest ? _compactForest->getNumberOfNodes(0) * sizeof(dtrees::internal::CompactTreeNode) :
+                                          _aTree[0]->getNumberOfRows() * sizeof(dtrees::internal::DecisionTreeNode);
+
+    /* Trees with unordered features are traversed node by node, the block traversal supports ordered splits only.
+       Compact trees are traversed node by node too, the arrays of the block traversal would restore the size of the model */
+    const bool bVectorPath = !_compactForest && !_featHelper.hasUnorderedFeatures() && cpu != __avx512_mic__;
+    if (bVectorPath)
+    {
+        services::Status st = convertTrees();
+        DAAL_CHECK_STATUS_VAR(st);
+    }
 
     dtrees::prediction::internal::TileDimensions<algorithmFPType> dim(*_data, nTreesTotal, treeSize);
     WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, 1);
@@ -110,7 +221,29 @@ services::Status PredictRegressionTaskBase<algorithmFPType, cpu>::run(services::
             ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
             DAAL_CHECK_BLOCK_STATUS_THR(xBD);
             algorithmFPType * res = resBD.get() + iStartRow;
-            if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
+            if (bVectorPath)
+            {
+                const size_t nVectorBlocks = nRowsToProcess / s_cVectorBlockSize;
+                auto processVectorBlock    = [&](size_t iVectorBlock) {
+                    const size_t iRow = iVectorBlock * s_cVectorBlockSize;
+                    algorithmFPType val[s_cVectorBlockSize];
+                    predictByTreesVector(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols, dim.nCols, val);
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t i = 0; i < s_cVectorBlockSize; ++i) res[iRow + i] += factor * val[i];
+                };
+                if (nVectorBlocks < 2 * nThreads)
+                {
+                    for (size_t iVectorBlock = 0; iVectorBlock < nVectorBlocks; ++iVectorBlock) processVectorBlock(iVectorBlock);
+                }
+                else
+                {
+                    daal::threader_for(nVectorBlocks, nVectorBlocks, processVectorBlock);
+                }
+                for (size_t iRow = nVectorBlocks * s_cVectorBlockSize; iRow < nRowsToProcess; ++iRow)
+                    res[iRow] += factor * predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
+            }
+            else if (nRowsToProcess < 2 * nThreads || cpu == __avx512_mic__)
             {
                 for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
                     res[iRow] += factor * predictByTrees(iTree, nTreesToUse, xBD.get() + iRow * dim.nCols);
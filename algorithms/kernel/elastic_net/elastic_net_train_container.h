@@ -63,6 +63,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     elastic_net::Model * m                       = result->get(model).get();
     const elastic_net::training::Parameter * par = static_cast<elastic_net::training::Parameter *>(_par);
     daal::services::Environment::env & env       = *_env;
+
+    /* The default solver runs over the Gram matrix built from the precomputed cross-products without reading the data */
+    if (input->get(xtx))
+    {
+        __DAAL_CALL_KERNEL(env, internal::TrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeFromCrossProducts,
+                           *(input->get(xtx)), *(input->get(xty)), x->getNumberOfRows(), *m, *result, *par);
+    }
+
     services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > objFunc(
         new daal::algorithms::optimization_solver::mse::Batch<algorithmFPType>(x->getNumberOfRows()));
     __DAAL_CALL_KERNEL(env, internal::TrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
@@ -31,6 +31,7 @@
 #include "service/kernel/service_algo_utils.h"
 #include "algorithms/optimization_solver/objective_function/mse_batch.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
+#include "algorithms/kernel/optimization_solver/coordinate_descent/coordinate_descent_dense_gram_impl.i"
 
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_math.h"
@@ -64,10 +65,10 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
     const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
     DAAL_ASSERT(p == m.getNumberOfBetas());
 
-    algorithmFPType * xMeansPtr;
+    algorithmFPType * xMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> xMeans;
 
-    algorithmFPType * yMeansPtr;
+    algorithmFPType * yMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> yMeans;
 
     NumericTablePtr xTrain = x;
@@ -192,12 +193,16 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             }
         });
     }
+    if (par.penaltyL1Path)
+    {
+        return computePath(xTrain, yTrain, xMeansPtr, yMeansPtr, m, res, par, objFunc);
+    }
+
     services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver); //par.optimizationSolver->clone();
     if (!pSolver.get())
     {
         //create cd solver
-        services::SharedPtr<optimization_solver::coordinate_descent::Batch<algorithmFPType> > cdAlgorithm =
-            optimization_solver::coordinate_descent::Batch<algorithmFPType>::create();
+        pSolver = createDefaultSolver();
         NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(nDependentVariables, p, &s);
         DAAL_CHECK_STATUS_VAR(s);
         daal::internal::WriteRows<algorithmFPType, cpu> pArgBD(pArg.get(), 0, p);
@@ -205,14 +210,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         algorithmFPType * pArgPtr = pArgBD.get();
         daal::services::internal::service_memset<algorithmFPType, cpu>(pArgPtr, 0, nDependentVariables * p);
 
-        cdAlgorithm->input.set(optimization_solver::iterative_solver::inputArgument, pArg);
-
-        cdAlgorithm->parameter().nIterations            = 10000;
-        cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
-        cdAlgorithm->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
-        cdAlgorithm->parameter().positive               = false;
-        cdAlgorithm->parameter().skipTheFirstComponents = true;
-        pSolver                                         = cdAlgorithm;
+        pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, pArg);
     }
 
     objFunc->input.set(mse::data, xTrain);
@@ -241,11 +239,325 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
 
     //write data to model
     daal::internal::ReadRows<algorithmFPType, cpu> ar(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), 0, p);
-    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nDependentVariables);
     DAAL_CHECK_BLOCK_STATUS(ar);
+    return setModel(ar.get(), xMeansPtr, yMeansPtr, m);
+}
+
+template <typename algorithmFPType, elastic_net::training::Method method, CpuType cpu>
+services::SharedPtr<optimization_solver::iterative_solver::Batch> TrainBatchKernel<algorithmFPType, method, cpu>::createDefaultSolver()
+{
+    services::SharedPtr<optimization_solver::coordinate_descent::Batch<algorithmFPType> > cdAlgorithm =
+        optimization_solver::coordinate_descent::Batch<algorithmFPType>::create();
+    cdAlgorithm->parameter().nIterations            = 10000;
+    cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
+    cdAlgorithm->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
+    cdAlgorithm->parameter().positive               = false;
+    cdAlgorithm->parameter().skipTheFirstComponents = true;
+    cdAlgorithm->parameter().screening              = true;
+    return cdAlgorithm;
+}
+
+/**
+ *  \brief Trains the models for all penalties of the regularization path, the solution for the previous penalty
+ *         is the initial point for the next one. If the Gram matrix fits into memory and the default solver is used,
+ *         the coordinate descent runs over the Gram matrix computed once for all penalties of the path.
+ *         The model of the last penalty of the path is the main result.
+ */
+template <typename algorithmFPType, elastic_net::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::computePath(
+    const NumericTablePtr & x, const NumericTablePtr & y, const algorithmFPType * xMeans, const algorithmFPType * yMeans, elastic_net::Model & m,
+    Result & res, const Parameter & par, services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc)
+{
+    services::Status s;
+    const size_t nFeatures           = x->getNumberOfColumns();
+    const size_t nRows               = x->getNumberOfRows();
+    const size_t p                   = nFeatures + 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+    const size_t maxGramFeatures     = 4096;
+
+    if (!par.optimizationSolver && nFeatures <= nRows && nFeatures <= maxGramFeatures)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nDependentVariables);
+        daal::internal::TArray<algorithmFPType, cpu> gramT(nFeatures * nFeatures);
+        daal::internal::TArray<algorithmFPType, cpu> xyT(nFeatures * nDependentVariables);
+        algorithmFPType * gram = gramT.get();
+        algorithmFPType * xy   = xyT.get();
+        DAAL_CHECK_MALLOC(gram && xy);
+        {
+            daal::internal::ReadRows<algorithmFPType, cpu> xBD(x.get(), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(xBD);
+            daal::internal::ReadRows<algorithmFPType, cpu> yBD(y.get(), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(yBD);
+            coordinate_descent::internal::computeGram<algorithmFPType, cpu>(xBD.get(), yBD.get(), nRows, nFeatures, nDependentVariables, gram, xy);
+        }
+        return computeOverGram(gram, xy, nRows, xMeans, yMeans, m, res, par);
+    }
+
+    NumericTable * penaltyL1Path = par.penaltyL1Path.get();
+    const size_t nPath           = penaltyL1Path->getNumberOfRows();
+    const size_t nL1Columns      = penaltyL1Path->getNumberOfColumns();
+    daal::internal::ReadRows<algorithmFPType, cpu> l1BD(penaltyL1Path, 0, nPath);
+    DAAL_CHECK_BLOCK_STATUS(l1BD);
+    const algorithmFPType * l1 = l1BD.get();
+
+    NumericTable * penaltyL2Path = par.penaltyL2Path.get();
+    NumericTable * penaltyL2     = penaltyL2Path ? penaltyL2Path : par.penaltyL2.get();
+    const size_t nL2Columns      = penaltyL2->getNumberOfColumns();
+    const size_t l2Stride        = penaltyL2Path ? nL2Columns : 0; /* penaltyL2 is used for all penalties of the path */
+    daal::internal::ReadRows<algorithmFPType, cpu> l2BD(penaltyL2, 0, penaltyL2Path ? nPath : 1);
+    DAAL_CHECK_BLOCK_STATUS(l2BD);
+    const algorithmFPType * l2 = l2BD.get();
+
+    data_management::DataCollectionPtr models = res.get(pathModels);
+    DAAL_CHECK(models && models->size() == nPath, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> argumentT(p * nDependentVariables);
+    algorithmFPType * argument = argumentT.get();
+    DAAL_CHECK_MALLOC(argument);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(argument, 0, p * nDependentVariables);
+
+    services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver);
+    if (!pSolver.get()) pSolver = createDefaultSolver();
+
+    objFunc->input.set(mse::data, x);
+    objFunc->input.set(mse::dependentVariables, y);
+    objFunc->parameter().interceptFlag = false;
+    pSolver->getParameter()->function  = objFunc;
+
+    NumericTablePtr argumentTable = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(argument, nDependentVariables, p, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, argumentTable);
+
+    for (size_t i = 0; i < nPath; i++)
+    {
+        algorithmFPType * l1Row        = const_cast<algorithmFPType *>(l1 + i * nL1Columns);
+        NumericTablePtr penaltyL1Table = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(l1Row, nL1Columns, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        objFunc->parameter().penaltyL1 = penaltyL1Table;
+        algorithmFPType * l2Row        = const_cast<algorithmFPType *>(l2 + i * l2Stride);
+        NumericTablePtr penaltyL2Table = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(l2Row, nL2Columns, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        objFunc->parameter().penaltyL2 = penaltyL2Table;
+
+        DAAL_CHECK_STATUS(s, pSolver->compute());
+
+        /* Warm start: the solution for the current penalty is the initial point for the next one */
+        daal::internal::ReadRows<algorithmFPType, cpu> ar(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), 0, p);
+        DAAL_CHECK_BLOCK_STATUS(ar);
+        const int result = daal::services::internal::daal_memcpy_s(argument, p * nDependentVariables * sizeof(algorithmFPType), ar.get(),
+                                                                   p * nDependentVariables * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        elastic_net::Model * pathModel = elastic_net::Model::cast((*models)[i]).get();
+        DAAL_CHECK_STATUS(s, setModel(argument, xMeans, yMeans, *pathModel));
+    }
+    return setModel(argument, xMeans, yMeans, m);
+}
+
+/**
+ *  \brief Minimizes the objective function over the Gram matrix for one penalty of the path, the p x k matrix b is updated in place.
+ *         The penalties of all dependent variables are solved together if they are equal, otherwise one by one
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status solveOverGram(const algorithmFPType * gram, const algorithmFPType * xy, size_t nFeatures, size_t nDependentVariables, size_t nRows,
+                               const algorithmFPType * l1, size_t nL1Columns, const algorithmFPType * l2, size_t nL2Columns, algorithmFPType * l1Prev,
+                               algorithmFPType * b)
+{
+    const size_t nIterations                = 10000;
+    const algorithmFPType accuracyThreshold = 0.00001;
+    size_t nSweeps                          = 0;
+    services::Status s;
+    if (nL1Columns == 1 && nL2Columns == 1)
+    {
+        coordinate_descent::internal::GramTask<algorithmFPType, cpu> task(gram, xy, nFeatures, nDependentVariables, nRows);
+        DAAL_CHECK_STATUS(s, task.compute(b, l1[0], l2[0], l1Prev[0], nIterations, accuracyThreshold, nSweeps));
+        l1Prev[0] = l1[0];
+        return s;
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 2, nFeatures);
+    daal::internal::TArray<algorithmFPType, cpu> columnsT(2 * nFeatures);
+    algorithmFPType * xyColumn = columnsT.get();
+    DAAL_CHECK_MALLOC(xyColumn);
+    algorithmFPType * bColumn = xyColumn + nFeatures;
+
+    for (size_t i = 0; i < nDependentVariables; i++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            xyColumn[j] = xy[j * nDependentVariables + i];
+            bColumn[j]  = b[j * nDependentVariables + i];
+        }
+        const algorithmFPType l1Value = l1[nL1Columns == 1 ? 0 : i];
+        const algorithmFPType l2Value = l2[nL2Columns == 1 ? 0 : i];
+
+        coordinate_descent::internal::GramTask<algorithmFPType, cpu> task(gram, xyColumn, nFeatures, 1, nRows);
+        DAAL_CHECK_STATUS(s, task.compute(bColumn, l1Value, l2Value, l1Prev[i], nIterations, accuracyThreshold, nSweeps));
+        l1Prev[i] = l1Value;
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            b[j * nDependentVariables + i] = bColumn[j];
+        }
+    }
+    return s;
+}
+
+/**
+ *  \brief Trains the model, and the models of the regularization path if it is set, with the coordinate descent over
+ *         the p x p Gram matrix and the p x nDependentVariables products X^T * y of the centered data
+ */
+template <typename algorithmFPType, elastic_net::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::computeOverGram(const algorithmFPType * gram, const algorithmFPType * xy,
+                                                                                size_t nRows, const algorithmFPType * xMeans,
+                                                                                const algorithmFPType * yMeans, elastic_net::Model & m,
+                                                                                Result & res, const Parameter & par)
+{
+    services::Status s;
+    const size_t p                   = m.getNumberOfBetas();
+    const size_t nFeatures           = p - 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+
+    if (par.optResultToCompute & computeGramMatrix)
+    {
+        daal::internal::WriteOnlyRows<algorithmFPType, cpu> gramBD(res.get(gramMatrixId).get(), 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(gramBD);
+        const int result = daal::services::internal::daal_memcpy_s(gramBD.get(), nFeatures * nFeatures * sizeof(algorithmFPType), gram,
+                                                                   nFeatures * nFeatures * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> argumentT(p * nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> l1PrevT(nDependentVariables);
+    algorithmFPType * argument = argumentT.get();
+    algorithmFPType * l1Prev   = l1PrevT.get();
+    DAAL_CHECK_MALLOC(argument && l1Prev);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(argument, 0, p * nDependentVariables);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(l1Prev, 0, nDependentVariables);
+
+    if (!par.penaltyL1Path)
+    {
+        NumericTable * penaltyL1 = par.penaltyL1.get();
+        NumericTable * penaltyL2 = par.penaltyL2.get();
+        daal::internal::ReadRows<algorithmFPType, cpu> l1BD(penaltyL1, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(l1BD);
+        daal::internal::ReadRows<algorithmFPType, cpu> l2BD(penaltyL2, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(l2BD);
+        DAAL_CHECK_STATUS(s, (solveOverGram<algorithmFPType, cpu>(gram, xy, nFeatures, nDependentVariables, nRows, l1BD.get(),
+                                                                  penaltyL1->getNumberOfColumns(), l2BD.get(), penaltyL2->getNumberOfColumns(),
+                                                                  l1Prev, argument + nDependentVariables)));
+        return setModel(argument, xMeans, yMeans, m);
+    }
+
+    NumericTable * penaltyL1Path = par.penaltyL1Path.get();
+    const size_t nPath           = penaltyL1Path->getNumberOfRows();
+    const size_t nL1Columns      = penaltyL1Path->getNumberOfColumns();
+    daal::internal::ReadRows<algorithmFPType, cpu> l1BD(penaltyL1Path, 0, nPath);
+    DAAL_CHECK_BLOCK_STATUS(l1BD);
+    const algorithmFPType * l1 = l1BD.get();
+
+    NumericTable * penaltyL2Path = par.penaltyL2Path.get();
+    NumericTable * penaltyL2     = penaltyL2Path ? penaltyL2Path : par.penaltyL2.get();
+    const size_t nL2Columns      = penaltyL2->getNumberOfColumns();
+    const size_t l2Stride        = penaltyL2Path ? nL2Columns : 0; /* penaltyL2 is used for all penalties of the path */
+    daal::internal::ReadRows<algorithmFPType, cpu> l2BD(penaltyL2, 0, penaltyL2Path ? nPath : 1);
+    DAAL_CHECK_BLOCK_STATUS(l2BD);
+    const algorithmFPType * l2 = l2BD.get();
+
+    data_management::DataCollectionPtr models = res.get(pathModels);
+    DAAL_CHECK(models && models->size() == nPath, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    for (size_t i = 0; i < nPath; i++)
+    {
+        DAAL_CHECK_STATUS(s, (solveOverGram<algorithmFPType, cpu>(gram, xy, nFeatures, nDependentVariables, nRows, l1 + i * nL1Columns, nL1Columns,
+                                                                  l2 + i * l2Stride, nL2Columns, l1Prev, argument + nDependentVariables)));
+
+        elastic_net::Model * pathModel = elastic_net::Model::cast((*models)[i]).get();
+        DAAL_CHECK_STATUS(s, setModel(argument, xMeans, yMeans, *pathModel));
+    }
+    return setModel(argument, xMeans, yMeans, m);
+}
+
+/**
+ *  \brief Builds the Gram matrix and the products X^T * y of the centered data from the cross-products in the layout
+ *         of the normal equations model: the last row and column of X'X hold the sums of the features and the number
+ *         of observations, the last column of X'Y holds the sums of the dependent variables
+ */
+template <typename algorithmFPType, elastic_net::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::computeFromCrossProducts(const NumericTable & xtxTable,
+                                                                                         const NumericTable & xtyTable, size_t nRows,
+                                                                                         elastic_net::Model & m, Result & res, const Parameter & par)
+{
+    const size_t nFeatures           = m.getNumberOfBetas() - 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+    const size_t nColumns            = xtxTable.getNumberOfColumns();
+
+    daal::internal::ReadRows<algorithmFPType, cpu> xtxBD(const_cast<NumericTable &>(xtxTable), 0, nColumns);
+    DAAL_CHECK_BLOCK_STATUS(xtxBD);
+    daal::internal::ReadRows<algorithmFPType, cpu> xtyBD(const_cast<NumericTable &>(xtyTable), 0, nDependentVariables);
+    DAAL_CHECK_BLOCK_STATUS(xtyBD);
+    const algorithmFPType * xtx = xtxBD.get();
+    const algorithmFPType * xty = xtyBD.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> gramT(nFeatures * nFeatures);
+    daal::internal::TArray<algorithmFPType, cpu> xyT(nFeatures * nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> meansT(nFeatures + nDependentVariables);
+    algorithmFPType * gram   = gramT.get();
+    algorithmFPType * xy     = xyT.get();
+    algorithmFPType * xMeans = meansT.get();
+    DAAL_CHECK_MALLOC(gram && xy && xMeans);
+    algorithmFPType * yMeans = xMeans + nFeatures;
+
+    /* Without the intercept the data is not centered and the number of observations is the number of rows of the data */
+    const bool interceptFlag = par.interceptFlag;
+    const algorithmFPType n  = (interceptFlag ? xtx[nFeatures * nColumns + nFeatures] : algorithmFPType(nRows));
+    DAAL_CHECK(n > 0, ErrorIncorrectNumberOfObservations);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        xMeans[j] = (interceptFlag ? xtx[j * nColumns + nFeatures] / n : algorithmFPType(0));
+    }
+    for (size_t k = 0; k < nDependentVariables; k++)
+    {
+        yMeans[k] = (interceptFlag ? xty[k * nColumns + nFeatures] / n : algorithmFPType(0));
+    }
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            gram[i * nFeatures + j] = xtx[i * nColumns + j] - n * xMeans[i] * xMeans[j];
+        }
+        for (size_t k = 0; k < nDependentVariables; k++)
+        {
+            xy[i * nDependentVariables + k] = xty[k * nColumns + i] - n * xMeans[i] * yMeans[k];
+        }
+    }
+
+    const size_t nObservations = (size_t)n;
+    return computeOverGram(gram, xy, nObservations, interceptFlag ? xMeans : nullptr, interceptFlag ? yMeans : nullptr, m, res, par);
+}
+
+/**
+ *  \brief Copies the argument of size p x nDependentVariables of the objective function into the coefficients of the model,
+ *         the intercept is computed from the means of the centered data if they are given
+ */
+template <typename algorithmFPType, elastic_net::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::setModel(const algorithmFPType * a, const algorithmFPType * xMeansPtr,
+                                                                         const algorithmFPType * yMeansPtr, elastic_net::Model & m)
+{
+    const size_t p                   = m.getNumberOfBetas();
+    const size_t nFeatures           = p - 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+
+    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nDependentVariables);
     DAAL_CHECK_BLOCK_STATUS(br);
-    const algorithmFPType * a = ar.get();
-    algorithmFPType * pBeta   = br.get();
+    algorithmFPType * pBeta = br.get();
 
     for (size_t i = 0; i < nDependentVariables; i++)
     {
@@ -254,10 +566,11 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             pBeta[i * p + j] = a[j * nDependentVariables + i];
         }
     }
-    if (par.interceptFlag)
+    if (xMeansPtr)
     {
         daal::internal::TArray<algorithmFPType, cpu> dotPtr(nDependentVariables);
         algorithmFPType * dot = dotPtr.get();
+        DAAL_CHECK_MALLOC(dot);
         for (size_t i = 0; i < nDependentVariables; i++) dot[i] = 0;
 
         for (size_t i = 0; i < nDependentVariables; i++)
@@ -274,7 +587,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         for (size_t j = 0; j < nDependentVariables; ++j) pBeta[p * j + 0] = 0;
     }
 
-    return s;
+    return services::Status();
 }
 
 } /* namespace internal */
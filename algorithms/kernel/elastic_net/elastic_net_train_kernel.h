@@ -50,6 +50,22 @@ public:
     services::Status compute(const HostAppIfacePtr & pHost, const NumericTablePtr & x, const NumericTablePtr & y, elastic_net::Model & m,
                              Result & res, const Parameter & par,
                              services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc);
+
+    services::Status computeFromCrossProducts(const NumericTable & xtx, const NumericTable & xty, size_t nRows, elastic_net::Model & m, Result & res,
+                                              const Parameter & par);
+
+private:
+    services::Status computePath(const NumericTablePtr & x, const NumericTablePtr & y, const algorithmFPType * xMeans, const algorithmFPType * yMeans,
+                                 elastic_net::Model & m, Result & res, const Parameter & par,
+                                 services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc);
+
+    services::Status computeOverGram(const algorithmFPType * gram, const algorithmFPType * xy, size_t nRows, const algorithmFPType * xMeans,
+                                     const algorithmFPType * yMeans, elastic_net::Model & m, Result & res, const Parameter & par);
+
+    static services::SharedPtr<daal::algorithms::optimization_solver::iterative_solver::Batch> createDefaultSolver();
+
+    static services::Status setModel(const algorithmFPType * argument, const algorithmFPType * xMeans, const algorithmFPType * yMeans,
+                                     elastic_net::Model & m);
 };
 
 } // namespace internal
@@ -39,7 +39,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_ELASTIC_NET_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultNumericTableId + 1) {}
+Result::Result() : linear_model::training::Result(lastOptionalResultModelCollectionId + 1) {}
 
 /**
  * Returns the result of elastic net model-based training
@@ -81,6 +81,26 @@ void Result::set(OptionalResultNumericTableId id, const data_management::Numeric
     Argument::set(id, value);
 }
 
+/**
+* Returns the collection of models of the regularization path
+* \param[in] id    Identifier of the result
+* \return          Collection of models that corresponds to the given identifier
+*/
+data_management::DataCollectionPtr Result::get(OptionalResultModelCollectionId id) const
+{
+    return services::staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+* Sets the collection of models of the regularization path
+* \param[in] id      Identifier of the result
+* \param[in] value   Collection of models
+*/
+void Result::set(OptionalResultModelCollectionId id, const data_management::DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of elastic net model-based training
  * \param[in] input   %Input object for the algorithm
@@ -105,6 +125,16 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
         s |= data_management::checkNumericTable(get(gramMatrixId).get(), gramMatrixStr(), 0, 0, in->getNumberOfFeatures(), in->getNumberOfFeatures());
 
     s |= elastic_net::checkModel(model.get(), *par, nBeta, nResponses, method);
+
+    if (p->penaltyL1Path)
+    {
+        const data_management::DataCollectionPtr models = get(pathModels);
+        DAAL_CHECK(models && models->size() == p->penaltyL1Path->getNumberOfRows(), ErrorIncorrectNumberOfElementsInResultCollection);
+        for (size_t i = 0; i < models->size() && s; i++)
+        {
+            s |= elastic_net::checkModel(elastic_net::Model::cast((*models)[i]).get(), *par, nBeta, nResponses, method);
+        }
+    }
     return s;
 }
 
@@ -51,6 +51,21 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
     DAAL_CHECK_MALLOC(mImpl)
     set(model, elastic_net::ModelPtr(mImpl));
 
+    if (parameter->penaltyL1Path)
+    {
+        const size_t nPath = parameter->penaltyL1Path->getNumberOfRows();
+        data_management::DataCollectionPtr models(new data_management::DataCollection(nPath));
+        DAAL_CHECK_MALLOC(models)
+        for (size_t i = 0; i < nPath && s; i++)
+        {
+            elastic_net::internal::ModelImpl * pathModel =
+                new elastic_net::internal::ModelImpl(in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s);
+            DAAL_CHECK_MALLOC(pathModel)
+            (*models)[i] = elastic_net::ModelPtr(pathModel);
+        }
+        set(pathModels, models);
+    }
+
     if (parameter->optResultToCompute & computeGramMatrix)
         set(gramMatrixId, data_management::HomogenNumericTable<algorithmFPType>::create(in->getNumberOfFeatures(), in->getNumberOfFeatures(),
                                                                                         data_management::NumericTableIface::doAllocate, &s));
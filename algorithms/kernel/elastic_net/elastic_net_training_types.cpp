@@ -37,7 +37,7 @@ namespace training
 {
 namespace interface1
 {
-Input::Input() : linear_model::training::Input(lastOptionalInputId + 1) {}
+Input::Input() : linear_model::training::Input(lastCrossProductInputId + 1) {}
 Input::Input(const Input & other) : linear_model::training::Input(other) {}
 
 /**
@@ -111,6 +111,26 @@ void Input::set(OptionalDataId id, const data_management::NumericTablePtr & ptr)
     pOpt->set(id, ptr);
 }
 
+/**
+ * Returns a cross-product precomputed for elastic net model-based training
+ * \param[in] id    Identifier of the cross-product
+ * \return          Cross-product that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(CrossProductInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets a cross-product precomputed for elastic net model-based training
+ * \param[in] id      Identifier of the cross-product
+ * \param[in] value   Pointer to the cross-product
+ */
+void Input::set(CrossProductInputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Returns the number of columns in the input data set
  * \return Number of columns in the input data set
@@ -154,6 +174,26 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     DAAL_CHECK((penaltyL1NumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL1NumberOfColumns), ErrorIncorrectNumberOfColumns);
     const size_t penaltyL2NumberOfColumns = parameter->penaltyL2->getNumberOfColumns();
     DAAL_CHECK((penaltyL2NumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL2NumberOfColumns), ErrorIncorrectNumberOfColumns);
+
+    if (parameter->penaltyL1Path)
+    {
+        const size_t penaltyL1PathNumberOfColumns = parameter->penaltyL1Path->getNumberOfColumns();
+        DAAL_CHECK((penaltyL1PathNumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL1PathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
+    if (parameter->penaltyL2Path)
+    {
+        const size_t penaltyL2PathNumberOfColumns = parameter->penaltyL2Path->getNumberOfColumns();
+        DAAL_CHECK((penaltyL2PathNumberOfColumns == 1) || (nColumnsInDepVariable == penaltyL2PathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
+
+    if (get(xtx) || get(xty))
+    {
+        /* The data is not read, so a custom solver that works with the data can not be used */
+        DAAL_CHECK_EX(!parameter->optimizationSolver, ErrorIncorrectParameter, ParameterName, optimizationSolverStr());
+        const size_t nBetas = dataTable->getNumberOfColumns() + (int)(parameter->interceptFlag == true);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(xtx).get(), XTXTableStr(), 0, 0, nBetas, nBetas));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(xty).get(), XTYTableStr(), 0, 0, nBetas, nColumnsInDepVariable));
+    }
     return services::Status();
 }
 
@@ -170,6 +210,21 @@ services::Status Parameter::check() const
 {
     services::Status status = checkNumericTable(penaltyL1.get(), penaltyL1Str(), packed_mask, 0, 0, 1);
     status                  = (status == services::Status() ? checkNumericTable(penaltyL2.get(), penaltyL2Str(), packed_mask, 0, 0, 1) : status);
+    if (!status) return status;
+
+    if (penaltyL1Path)
+    {
+        DAAL_CHECK_STATUS(status, checkNumericTable(penaltyL1Path.get(), "penaltyL1Path", packed_mask));
+        if (penaltyL2Path)
+        {
+            const size_t nPath = penaltyL1Path->getNumberOfRows();
+            DAAL_CHECK_STATUS(status, checkNumericTable(penaltyL2Path.get(), "penaltyL2Path", packed_mask, 0, 0, nPath));
+        }
+    }
+    else
+    {
+        DAAL_CHECK_EX(!penaltyL2Path, ErrorIncorrectParameter, ArgumentName, "penaltyL2Path");
+    }
     return status;
 }
 
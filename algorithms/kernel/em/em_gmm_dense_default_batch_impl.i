@@ -81,6 +81,11 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
 
         Math<algorithmFPType, cpu>::vLog(nComponents, alpha, logAlpha); // inplace: same memory as alpha
 
+        if (par.covarianceStorage == diagonal)
+        {
+            DAAL_CHECK_STATUS(s, static_cast<GmmModelDiagType *>(covs.get())->computeLogDensityCoefficients(means, logAlpha))
+        }
+
         logLikelyhood = 0;
 
         SafeStatus safeStat;
@@ -110,19 +115,7 @@ services::Status EMKernelTask<algorithmFPType, method, cpu>::compute()
 
         setResultToZero();
 
-        threadBuffer.reduce([=, &logLikelyhood](Task<algorithmFPType, cpu> * e) -> void {
-            logLikelyhood += e->logLikelyhood;
-            e->logLikelyhood = 0;
-            for (size_t k = 0; k < nComponents; k++)
-            {
-                if (e->mergedWSums[k] > MinVal<algorithmFPType>::get())
-                {
-                    stepM_mergePartialSums(covs->getSigma(k), &e->mergedPartialCP[k * covs->getOneCovSize()], &means[k * nFeatures],
-                                           &e->mergedPartialMeans[k * nFeatures], alpha[k], e->mergedWSums[k], nFeatures, covs.get());
-                }
-            }
-            e->setMergedToZero();
-        });
+        DAAL_CHECK_STATUS(s, stepM_reduce(threadBuffer, logLikelyhood))
         logLikelyhood -= logLikelyhoodCorrection;
 
         DAAL_CHECK_STATUS(s, stepM_merge(iterCounter))
@@ -157,145 +150,67 @@ inline double exp_threshold<double>(void)
 }
 
 /**
- * Function computes t.w values that stores weight of each data point belongs to each cluster.
- * t.s is computed by numeric stable log-sum-exp trick.
+ * Function converts log-densities t.p of the block stored by components to the responsibilities in place.
+ * Maximum over the components is subtracted before exponentiation and its sum is accumulated to t.partLogLikelyhood.
  */
 template <typename algorithmFPType, Method method, CpuType cpu>
-void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t,
-                                                       em_gmm::CovarianceStorageId covType)
+void EMKernelTask<algorithmFPType, method, cpu>::computeResponsibilities(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t)
 {
-    const size_t nComponents = t.nComponents;
-    const size_t nFeatures   = t.nFeatures;
-
-    if (covType == diagonal)
-    {
-        for (size_t k = 0; k < nComponents; k++)
-        {
-            const algorithmFPType * curMean  = &t.means[k * nFeatures];
-            const algorithmFPType * invSigma = (t.covs->getSigma())[k];
-            const algorithmFPType addition   = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
-
-            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-            {
-                algorithmFPType tp = 0;
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < nFeatures; j++)
-                {
-                    algorithmFPType x_mu = t.dataBlock[i * nFeatures + j] - curMean[j];
-                    tp += x_mu * x_mu * invSigma[j];
-                }
-
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * tp;
-            }
-        }
-    }
-    else
-    {
-        daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
-
-        for (size_t k = 0; k < nComponents; k++)
-        {
-            for (size_t j = 0; j < nFeatures; j++)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-                {
-                    t.x_mu[j * nVectorsInCurrentBlock + i] =
-                        t.trans_data[j * nVectorsInCurrentBlock + i] - t.means[k * nFeatures + j]; // transposed x_mu
-                }
-            }
-
-            t.covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, t.x_mu, t.Ax_mu); // Ax_mu is also transposed
-
-            algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
-
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = 0.0;
-            }
-
-            for (size_t j = 0; j < nFeatures; j++)
-            {
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-                {
-                    t.p[k * nVectorsInCurrentBlock + i] += t.x_mu[j * nVectorsInCurrentBlock + i] * t.Ax_mu[j * nVectorsInCurrentBlock + i];
-                }
-            }
+    const size_t nComponents           = t.nComponents;
+    const algorithmFPType expThreshold = exp_threshold<algorithmFPType>();
+    algorithmFPType * p                = t.p;
+    algorithmFPType * maxInRow         = t.rowSum;
 
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * t.p[k * nVectorsInCurrentBlock + i];
-            }
-        }
-    }
-
-    t.partLogLikelyhood        = 0;
-    algorithmFPType * maxInRow = t.rowSum;
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
     {
-        maxInRow[i] = t.p[i];
+        maxInRow[i] = p[i];
     }
-
     for (size_t k = 1; k < nComponents; k++)
     {
+        const algorithmFPType * pComp = p + k * nVectorsInCurrentBlock;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            if (t.p[k * nVectorsInCurrentBlock + i] > maxInRow[i])
-            {
-                maxInRow[i] = t.p[k * nVectorsInCurrentBlock + i];
-            }
+            maxInRow[i] = (pComp[i] > maxInRow[i]) ? pComp[i] : maxInRow[i];
         }
     }
 
     for (size_t k = 0; k < nComponents; k++)
     {
+        algorithmFPType * pComp = p + k * nVectorsInCurrentBlock;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            t.p[k * nVectorsInCurrentBlock + i] -= maxInRow[i];
-            if (t.p[k * nVectorsInCurrentBlock + i] < exp_threshold<algorithmFPType>())
-            {
-                t.p[k * nVectorsInCurrentBlock + i] = exp_threshold<algorithmFPType>();
-            }
+            const algorithmFPType value = pComp[i] - maxInRow[i];
+            pComp[i]                    = (value < expThreshold) ? expThreshold : value;
         }
     }
 
+    algorithmFPType partLogLikelyhood = 0;
     PRAGMA_IVDEP
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
     {
-        t.partLogLikelyhood += maxInRow[i];
-    }
-
-    PRAGMA_IVDEP
-    PRAGMA_VECTOR_ALWAYS
-    for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
-    {
+        partLogLikelyhood += maxInRow[i];
         maxInRow[i] = 0; // same memory as t.rowSum, set to zero before computing row sum
     }
+    t.partLogLikelyhood = partLogLikelyhood;
 
-    Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock * nComponents, t.p, t.p);
+    Math<algorithmFPType, cpu>::vExp(nVectorsInCurrentBlock * nComponents, p, p);
 
+    algorithmFPType * rowSum = t.rowSum;
     for (size_t k = 0; k < nComponents; k++)
     {
+        const algorithmFPType * pComp = p + k * nVectorsInCurrentBlock;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            t.rowSum[i] += t.p[k * nVectorsInCurrentBlock + i];
+            rowSum[i] += pComp[i];
         }
     }
 
@@ -305,18 +220,85 @@ void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCu
     PRAGMA_VECTOR_ALWAYS
     for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
     {
-        t.rowSumInv[i] = one / t.rowSum[i];
+        t.rowSumInv[i] = one / rowSum[i];
     }
 
     for (size_t k = 0; k < nComponents; k++)
     {
+        algorithmFPType * pComp = p + k * nVectorsInCurrentBlock;
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
         for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
         {
-            t.p[k * nVectorsInCurrentBlock + i] = t.p[k * nVectorsInCurrentBlock + i] * t.rowSumInv[i];
+            pComp[i] *= t.rowSumInv[i];
+        }
+    }
+}
+
+/**
+ * Function computes t.w values that stores weight of each data point belongs to each cluster.
+ * t.s is computed by numeric stable log-sum-exp trick.
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+void EMKernelTask<algorithmFPType, method, cpu>::stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t,
+                                                       em_gmm::CovarianceStorageId covType)
+{
+    const size_t nComponents = t.nComponents;
+    const size_t nFeatures   = t.nFeatures;
+
+    if (covType == diagonal)
+    {
+        /* Log-densities of all the components are computed at once, x_mu and Ax_mu are used as the buffers for the centered data */
+        static_cast<GmmModelDiag<algorithmFPType, cpu> *>(t.covs)->computeLogDensities(nVectorsInCurrentBlock, t.dataBlock, t.x_mu, t.Ax_mu, t.p);
+    }
+    else
+    {
+        daal::services::internal::transpose<algorithmFPType, cpu>(t.dataBlock, nVectorsInCurrentBlock, nFeatures, t.trans_data);
+
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+                {
+                    t.x_mu[j * nVectorsInCurrentBlock + i] =
+                        t.trans_data[j * nVectorsInCurrentBlock + i] - t.means[k * nFeatures + j]; // transposed x_mu
+                }
+            }
+
+            t.covs->multiplyByInverseMatrix(nVectorsInCurrentBlock, k, t.x_mu, t.Ax_mu); // Ax_mu is also transposed
+
+            algorithmFPType addition = t.logAlpha[k] + t.logSqrtInvDetSigma[k];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                t.p[k * nVectorsInCurrentBlock + i] = 0.0;
+            }
+
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+                {
+                    t.p[k * nVectorsInCurrentBlock + i] += t.x_mu[j * nVectorsInCurrentBlock + i] * t.Ax_mu[j * nVectorsInCurrentBlock + i];
+                }
+            }
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                t.p[k * nVectorsInCurrentBlock + i] = addition + -0.5 * t.p[k * nVectorsInCurrentBlock + i];
+            }
         }
     }
+
+    computeResponsibilities(nVectorsInCurrentBlock, t);
     t.w = t.p;
 }
 
@@ -384,6 +366,44 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_partial(const size_t nV
     return Status();
 }
 
+/**
+ * Function merges thread local sums of weights, means and cross products into the result.
+ * Components are merged in parallel, the partial results of the threads are merged in the fixed order for each component
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMKernelTask<algorithmFPType, method, cpu>::stepM_reduce(daal::tls<Task<algorithmFPType, cpu> *> & threadBuffer,
+                                                                algorithmFPType & logLikelyhood)
+{
+    const size_t nThreads = threader_get_max_threads_number();
+    TArray<Task<algorithmFPType, cpu> *, cpu> tasksPtr(nThreads);
+    DAAL_CHECK_MALLOC(tasksPtr.get())
+    Task<algorithmFPType, cpu> ** tasks = tasksPtr.get();
+
+    size_t nTasks = 0;
+    threadBuffer.reduce([=, &logLikelyhood, &nTasks](Task<algorithmFPType, cpu> * e) -> void {
+        logLikelyhood += e->logLikelyhood;
+        e->logLikelyhood = 0;
+        tasks[nTasks++]  = e;
+    });
+    DAAL_ASSERT(nTasks <= nThreads)
+
+    GmmModel<algorithmFPType, cpu> * pCovs = covs.get();
+    const size_t sizeOfOneCov              = pCovs->getOneCovSize();
+    daal::threader_for(nComponents, nComponents, [=](size_t k) {
+        for (size_t iTask = 0; iTask < nTasks; iTask++)
+        {
+            Task<algorithmFPType, cpu> * e = tasks[iTask];
+            if (e->mergedWSums[k] > MinVal<algorithmFPType>::get())
+            {
+                stepM_mergePartialSums(pCovs->getSigma(k), &e->mergedPartialCP[k * sizeOfOneCov], &means[k * nFeatures],
+                                       &e->mergedPartialMeans[k * nFeatures], alpha[k], e->mergedWSums[k], nFeatures, pCovs);
+            }
+            e->setMergedToZero(k);
+        }
+    });
+    return Status();
+}
+
 /**
  * Function scales merged values of to get result
  */
@@ -398,9 +418,13 @@ Status EMKernelTask<algorithmFPType, method, cpu>::stepM_merge(size_t iteration)
             e->addIntDetail(Iteration, iteration + 1);
             return Status(e);
         }
-        covs->finalize(k, alpha[k]);
-        alpha[k] /= nVectors;
     }
+
+    GmmModel<algorithmFPType, cpu> * pCovs = covs.get();
+    daal::threader_for(nComponents, nComponents, [=](size_t k) {
+        pCovs->finalize(k, alpha[k]);
+        alpha[k] /= nVectors;
+    });
     return Status();
 }
 
@@ -75,9 +75,11 @@ public:
     Status initialize();
     services::Status setStartValues();
     void setResultToZero();
+    Status stepM_reduce(daal::tls<Task<algorithmFPType, cpu> *> & threadBuffer, algorithmFPType & logLikelyhood);
     Status stepM_merge(size_t iteration);
 
     static void stepE(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
+    static void computeResponsibilities(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t);
     static algorithmFPType computePartialLogLikelyhood(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t);
     static Status stepM_partial(const size_t nVectorsInCurrentBlock, Task<algorithmFPType, cpu> & t, em_gmm::CovarianceStorageId covType);
     static void stepM_mergePartialSums(algorithmFPType * cp_n, algorithmFPType * cp_m, algorithmFPType * mean_n, algorithmFPType * mean_m,
@@ -173,7 +173,11 @@ public:
     using GmmModel<algorithmFPType, cpu>::logSqrtInvDetSigma;
     using GmmModel<algorithmFPType, cpu>::covRegularizer;
     using GmmModel<algorithmFPType, cpu>::EIGENVALUE_THRESHOLD;
-    GmmModelDiag(size_t _nFeatures, size_t _nComponents) : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents) {}
+    typedef Blas<algorithmFPType, cpu> blas;
+
+    GmmModelDiag(size_t _nFeatures, size_t _nComponents)
+        : GmmModel<algorithmFPType, cpu>(_nFeatures, _nComponents), coefficientsPtr(2 * _nComponents * _nFeatures + 2 * _nComponents + _nFeatures)
+    {}
     size_t getOneCovSize() { return nFeatures; }
     size_t getNumberOfRowsInCov() { return 1; }
     void multiplyByInverseMatrix(size_t nVectorsInCurrentBlock, size_t k, algorithmFPType * X, algorithmFPType * CovX)
@@ -278,6 +282,110 @@ public:
 
     void stepM_mergeCovs(algorithmFPType * cp_n, algorithmFPType * cp_m, algorithmFPType * mean_n, algorithmFPType * mean_m, algorithmFPType & w_n,
                          algorithmFPType & w_m, size_t nFeatures);
+
+    /**
+     * Precomputes the coefficients of the log-densities of the components, so that for all the components they are computed as
+     * log(alpha_k) + log(sqrt(det(inv(sigma_k)))) - 0.5 * ((x - c)^2 * inv(sigma_k) - 2 * (x - c) * (mu_k - c) * inv(sigma_k) +
+     * (mu_k - c)^2 * inv(sigma_k)), where c is the average of the means of the components that reduces the cancellation error.
+     * Must be called after computeSigmaInverse().
+     */
+    Status computeLogDensityCoefficients(const algorithmFPType * means, const algorithmFPType * logAlpha)
+    {
+        DAAL_CHECK_MALLOC(coefficientsPtr.get())
+        algorithmFPType * invSigmaCoeffs = coefficientsPtr.get();
+        algorithmFPType * meanCoeffs     = invSigmaCoeffs + nComponents * nFeatures;
+        algorithmFPType * meanSqSums     = meanCoeffs + nComponents * nFeatures;
+        algorithmFPType * additions      = meanSqSums + nComponents;
+        algorithmFPType * center         = additions + nComponents;
+
+        const algorithmFPType invNComponents = 1.0 / nComponents;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            center[j] = 0;
+        }
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                center[j] += means[k * nFeatures + j] * invNComponents;
+            }
+        }
+
+        for (size_t k = 0; k < nComponents; k++)
+        {
+            const algorithmFPType * invSigma = sigma[k];
+            const algorithmFPType * mean     = means + k * nFeatures;
+            algorithmFPType meanSqSum        = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType mu_c        = mean[j] - center[j];
+                invSigmaCoeffs[k * nFeatures + j] = invSigma[j];
+                meanCoeffs[k * nFeatures + j]     = mu_c * invSigma[j];
+                meanSqSum += mu_c * mu_c * invSigma[j];
+            }
+            meanSqSums[k] = meanSqSum;
+            additions[k]  = logAlpha[k] + logSqrtInvDetSigma[k];
+        }
+        return Status();
+    }
+
+    /**
+     * Computes the log-densities of all the components for the block of the data with two matrix multiplications,
+     * p is stored by components. x_c and x_c_sq are the buffers of the size of the block
+     */
+    void computeLogDensities(size_t nVectorsInCurrentBlock, const algorithmFPType * data, algorithmFPType * x_c, algorithmFPType * x_c_sq,
+                             algorithmFPType * p)
+    {
+        const algorithmFPType * invSigmaCoeffs = coefficientsPtr.get();
+        const algorithmFPType * meanCoeffs     = invSigmaCoeffs + nComponents * nFeatures;
+        const algorithmFPType * meanSqSums     = meanCoeffs + nComponents * nFeatures;
+        const algorithmFPType * additions      = meanSqSums + nComponents;
+        const algorithmFPType * center         = additions + nComponents;
+
+        for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType value = data[i * nFeatures + j] - center[j];
+                x_c[i * nFeatures + j]      = value;
+                x_c_sq[i * nFeatures + j]   = value * value;
+            }
+        }
+
+        char transa              = 'T';
+        char transb              = 'N';
+        DAAL_INT m               = nVectorsInCurrentBlock;
+        DAAL_INT n               = nComponents;
+        DAAL_INT k               = nFeatures;
+        algorithmFPType one      = 1.0;
+        algorithmFPType zero     = 0.0;
+        algorithmFPType minusTwo = -2.0;
+        blas::xxgemm(&transa, &transb, &m, &n, &k, &one, x_c_sq, &k, invSigmaCoeffs, &k, &zero, p, &m);
+        blas::xxgemm(&transa, &transb, &m, &n, &k, &minusTwo, x_c, &k, meanCoeffs, &k, &one, p, &m);
+
+        for (size_t iComp = 0; iComp < nComponents; iComp++)
+        {
+            algorithmFPType * pComp = p + iComp * nVectorsInCurrentBlock;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nVectorsInCurrentBlock; i++)
+            {
+                /* Mahalanobis distance is non-negative, rounding errors of the expansion are cut off */
+                algorithmFPType distance = pComp[i] + meanSqSums[iComp];
+                distance                 = (distance < 0) ? 0 : distance;
+                pComp[i]                 = additions[iComp] - 0.5 * distance;
+            }
+        }
+    }
+
+protected:
+    TArray<algorithmFPType, cpu> coefficientsPtr;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -353,6 +461,20 @@ struct Task
         }
     }
 
+    void setMergedToZero(size_t k)
+    {
+        size_t sizeOfOneCov = covs->getOneCovSize();
+        mergedWSums[k]      = 0;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            mergedPartialMeans[k * nFeatures + i] = 0;
+        }
+        for (size_t i = 0; i < sizeOfOneCov; i++)
+        {
+            mergedPartialCP[k * sizeOfOneCov + i] = 0;
+        }
+    }
+
     Status next(size_t j0, size_t nVectorsInCurrentBlock)
     {
         dataTableBD.set(dataTable, j0, nVectorsInCurrentBlock);
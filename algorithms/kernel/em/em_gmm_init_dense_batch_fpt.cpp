@@ -78,6 +78,22 @@ ErrorID EMforKernel<algorithmFPType>::run(data_management::NumericTable & inputD
 
 template class EMforKernel<DAAL_FPTYPE>;
 
+template <typename algorithmFPType>
+services::Status KMeansInitForKernel<algorithmFPType>::run(data_management::NumericTable & inputData, data_management::NumericTable & centroids,
+                                                           const engines::EnginePtr & engine)
+{
+    this->input.set(daal::algorithms::kmeans::init::data, NumericTablePtr(&inputData, EmptyDeleter()));
+    if (engine) this->parameter.engine = engine;
+
+    daal::algorithms::kmeans::init::ResultPtr kmeansResult(new daal::algorithms::kmeans::init::Result());
+    kmeansResult->set(daal::algorithms::kmeans::init::centroids, NumericTablePtr(&centroids, EmptyDeleter()));
+
+    this->setResult(kmeansResult);
+    return this->computeNoThrow();
+}
+
+template class KMeansInitForKernel<DAAL_FPTYPE>;
+
 } // namespace internal
 } // namespace init
 } // namespace em_gmm
@@ -26,6 +26,8 @@
 #include "service/kernel/service_data_utils.h"
 #include "externals/service_stat.h"
 #include "algorithms/kernel/distributions/uniform/uniform_impl.i"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_error_handling.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -57,6 +59,8 @@ services::Status EMInitKernel<algorithmFPType, method, cpu>::compute(NumericTabl
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status EMInitKernelTask<algorithmFPType, method, cpu>::compute()
 {
+    if (method == kMeansPlusPlusDense) return computeByKMeansPlusPlus();
+
     Status s;
     DAAL_CHECK_STATUS(s, initialize())
 
@@ -81,6 +85,194 @@ services::Status EMInitKernelTask<algorithmFPType, method, cpu>::compute()
     return Status();
 }
 
+/**
+ * Initializes the means with K-Means++ and estimates the weights and the covariances
+ * in one pass over the data instead of running the short EM trials
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMInitKernelTask<algorithmFPType, method, cpu>::computeByKMeansPlusPlus()
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, initialize())
+
+    KMeansInitForKernel<algorithmFPType> kmeansInit(nComponents);
+    DAAL_CHECK_STATUS(s, kmeansInit.run(data, *means, parameter.engine))
+
+    DAAL_CHECK_STATUS(s, estimateComponents())
+    return writeValuesToTables();
+}
+
+/**
+ * Assigns every observation to the nearest mean and computes the fraction of the observations,
+ * their mean and their covariance for every component.
+ * Deviations from the initial means are accumulated to reduce the cancellation error
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+Status EMInitKernelTask<algorithmFPType, method, cpu>::estimateComponents()
+{
+    const bool isFull         = (parameter.covarianceStorage != em_gmm::diagonal);
+    const size_t covSize      = covs.getOneCovSize();
+    const size_t nSums        = nComponents * (1 + nFeatures + covSize);
+    const size_t blockSize    = 512;
+    const size_t nBlocks      = nVectors / blockSize + !!(nVectors % blockSize);
+    const algorithmFPType * c = means->getArray();
+
+    daal::tls<algorithmFPType *> tlsSums([=]() -> algorithmFPType * { return service_scalable_calloc<algorithmFPType, cpu>(nSums + nFeatures); });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        algorithmFPType * localSums = tlsSums.local();
+        DAAL_CHECK_MALLOC_THR(localSums);
+        algorithmFPType * counts = localSums;
+        algorithmFPType * sums   = counts + nComponents;
+        algorithmFPType * cp     = sums + nComponents * nFeatures;
+        algorithmFPType * d      = cp + nComponents * covSize;
+
+        const size_t iStartRow = iBlock * blockSize;
+        const size_t nRows     = (iBlock == nBlocks - 1) ? nVectors - iStartRow : blockSize;
+        ReadRows<algorithmFPType, cpu, NumericTable> dataRows(data, iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType * x = dataRows.get();
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType * xi = x + i * nFeatures;
+            size_t nearest             = 0;
+            algorithmFPType minDist    = MaxVal<algorithmFPType>::get();
+            for (size_t k = 0; k < nComponents; k++)
+            {
+                algorithmFPType dist = 0;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    const algorithmFPType diff = xi[j] - c[k * nFeatures + j];
+                    dist += diff * diff;
+                }
+                if (dist < minDist)
+                {
+                    minDist = dist;
+                    nearest = k;
+                }
+            }
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                d[j] = xi[j] - c[nearest * nFeatures + j];
+                sums[nearest * nFeatures + j] += d[j];
+            }
+            counts[nearest] += 1;
+
+            algorithmFPType * cpk = cp + nearest * covSize;
+            if (isFull)
+            {
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t l = 0; l <= j; l++)
+                    {
+                        cpk[j * nFeatures + l] += d[j] * d[l];
+                    }
+                }
+            }
+            else
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    cpk[j] += d[j] * d[j];
+                }
+            }
+        }
+    });
+
+    TArrayScalableCalloc<algorithmFPType, cpu> totalSumsPtr(nSums);
+    algorithmFPType * totalSums = totalSumsPtr.get();
+    if (!totalSums) safeStat.add(ErrorMemoryAllocationFailed);
+    tlsSums.reduce([=](algorithmFPType * localSums) -> void {
+        if (!localSums) return;
+        if (totalSums)
+        {
+            for (size_t i = 0; i < nSums; i++)
+            {
+                totalSums[i] += localSums[i];
+            }
+        }
+        service_scalable_free<algorithmFPType, cpu>(localSums);
+    });
+    DAAL_CHECK_SAFE_STATUS()
+
+    const algorithmFPType * counts = totalSums;
+    const algorithmFPType * sums   = counts + nComponents;
+    const algorithmFPType * cp     = sums + nComponents * nFeatures;
+
+    /* Components without observations get the weight of one observation */
+    algorithmFPType totalCount = 0;
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        totalCount += (counts[k] > 0 ? counts[k] : algorithmFPType(1));
+    }
+
+    algorithmFPType * alphaArray = alpha->getArray();
+    algorithmFPType * meansArray = means->getArray();
+    for (size_t k = 0; k < nComponents; k++)
+    {
+        const algorithmFPType nk = counts[k];
+        alphaArray[k]            = (nk > 0 ? nk : algorithmFPType(1)) / totalCount;
+
+        algorithmFPType * sigma = covs.getSigmaArray(k);
+        for (size_t i = 0; i < covSize; i++)
+        {
+            sigma[i] = 0;
+        }
+        if (nk < 2)
+        {
+            /* Not enough observations to estimate the covariance, the variance of the data is used */
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sigma[isFull ? j * nFeatures + j : j] = varianceArray[j];
+            }
+            continue;
+        }
+
+        const algorithmFPType invNk   = algorithmFPType(1) / nk;
+        const algorithmFPType * meanD = sums + k * nFeatures;
+        const algorithmFPType * cpk   = cp + k * covSize;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (isFull)
+            {
+                for (size_t l = 0; l <= j; l++)
+                {
+                    const algorithmFPType value = cpk[j * nFeatures + l] * invNk - meanD[j] * meanD[l] * invNk * invNk;
+                    sigma[j * nFeatures + l]    = value;
+                    sigma[l * nFeatures + j]    = value;
+                }
+            }
+            else
+            {
+                sigma[j] = cpk[j] * invNk - meanD[j] * meanD[j] * invNk * invNk;
+            }
+        }
+
+        /* Features that are constant within the component get the variance of the data */
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            algorithmFPType & diag = sigma[isFull ? j * nFeatures + j : j];
+            if (diag <= 0) diag = varianceArray[j];
+        }
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            meansArray[k * nFeatures + j] += meanD[j] * invNk;
+        }
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 EMInitKernelTask<algorithmFPType, method, cpu>::EMInitKernelTask(NumericTable & data, NumericTable & weightsToInit, NumericTable & meansToInit,
                                                                  DataCollectionPtr & covariancesToInit, const Parameter & parameter,
@@ -32,6 +32,7 @@
 #include "algorithms/em/em_gmm_init_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
 #include "algorithms/em/em_gmm.h"
+#include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kernel/distributions/uniform/uniform_kernel.h"
 
 namespace daal
@@ -96,6 +97,8 @@ public:
         }
     }
     DataCollectionPtr & getSigma() { return sigma; }
+    algorithmFPType * getSigmaArray(size_t k) { return static_cast<HomogenNT *>((*sigma)[k].get())->getArray(); }
+    size_t getOneCovSize() const { return nRows * nFeatures; }
     Status writeToTables(DataCollectionPtr covariancesToInit)
     {
         for (size_t k = 0; k < nComponents; k++)
@@ -148,6 +151,8 @@ private:
     Status generateSelectedSet();
     Status initialize();
     Status computeVariance();
+    Status computeByKMeansPlusPlus();
+    Status estimateComponents();
 
     NumericTable & data;
     NumericTable & weightsToInit;
@@ -183,6 +188,17 @@ public:
                 data_management::DataCollectionPtr & inputCov, const em_gmm::CovarianceStorageId covType, algorithmFPType & loglikelyhood);
 };
 
+template <typename algorithmFPType>
+class KMeansInitForKernel : public daal::algorithms::kmeans::init::Batch<algorithmFPType, kmeans::init::plusPlusDense>
+{
+public:
+    KMeansInitForKernel(const size_t nComponents) : daal::algorithms::kmeans::init::Batch<algorithmFPType, kmeans::init::plusPlusDense>(nComponents)
+    {}
+    virtual ~KMeansInitForKernel() {}
+
+    services::Status run(data_management::NumericTable & inputData, data_management::NumericTable & centroids, const engines::EnginePtr & engine);
+};
+
 } // namespace internal
 
 } // namespace init
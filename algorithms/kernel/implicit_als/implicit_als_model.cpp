@@ -54,6 +54,18 @@ services::Status Parameter::check() const
     {
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, preferenceThresholdStr()));
     }
+    if (solverMethod != choleskySolver && solverMethod != conjugateGradientSolver)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, solverMethodStr()));
+    }
+    if (solverMethod == conjugateGradientSolver && nCGIterations == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nCGIterationsStr()));
+    }
+    if (nTopItems == 0)
+    {
+        return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ParameterName, nTopItemsStr()));
+    }
     return services::Status();
 }
 
@@ -26,6 +26,8 @@
 
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/kernel/implicit_als/implicit_als_predict_ratings_dense_default_kernel.h"
+#include "algorithms/kernel/implicit_als/oneapi/implicit_als_predict_ratings_kernel_oneapi.h"
+#include "oneapi/internal/utils.h"
 
 namespace daal
 {
@@ -44,7 +46,21 @@ namespace ratings
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    auto & context    = oneapi::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (method == topItemsDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSPredictTopItemsKernel, algorithmFPType);
+    }
+    else if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    }
+    else
+    {
+        __DAAL_INITIALIZE_KERNELS_SYCL(internal::ImplicitALSPredictKernelOneAPI, algorithmFPType);
+    }
 }
 
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
@@ -67,9 +83,30 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Parameter * par                        = static_cast<Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
 
+    if (method == topItemsDense)
+    {
+        NumericTable * dataTable       = input->get(data).get();
+        NumericTable * topItemsTable   = result->get(topItems).get();
+        NumericTable * topRatingsTable = result->get(topRatings).get();
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictTopItemsKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
+                           itemsFactorsTable, dataTable, topItemsTable, topRatingsTable, par);
+    }
+
     NumericTable * ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
-    __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
-                       itemsFactorsTable, ratingsTable, par);
+
+    auto & context    = oneapi::internal::getDefaultContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
+                           itemsFactorsTable, ratingsTable, par);
+    }
+    else
+    {
+        __DAAL_CALL_KERNEL_SYCL(env, internal::ImplicitALSPredictKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, usersFactorsTable,
+                                itemsFactorsTable, ratingsTable, par);
+    }
 }
 
 /**
@@ -55,6 +55,22 @@ public:
                              const Parameter * parameter);
 };
 
+/**
+ * Computes the items with the highest predicted ratings for each user.
+ * Ratings are computed by tiles of users and items and are pushed to the bounded heaps of the users,
+ * so the full users x items ratings matrix is never stored
+ */
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSPredictTopItemsKernel : public daal::algorithms::Kernel
+{
+public:
+    ImplicitALSPredictTopItemsKernel() {}
+    virtual ~ImplicitALSPredictTopItemsKernel() {}
+
+    services::Status compute(const NumericTable * usersFactorsTable, const NumericTable * itemsFactorsTable, const NumericTable * dataTable,
+                             NumericTable * topItemsTable, NumericTable * topRatingsTable, const Parameter * parameter);
+};
+
 } // namespace internal
 } // namespace ratings
 } // namespace prediction
@@ -39,7 +39,7 @@ namespace ratings
 {
 namespace interface1
 {
-Input::Input() : InputIface(lastModelInputId + 1) {}
+Input::Input() : InputIface(lastNumericTableInputId + 1) {}
 
 /**
  * Returns an input Model object for the rating prediction stage of the implicit ALS algorithm
@@ -61,6 +61,26 @@ void Input::set(ModelInputId id, const ModelPtr & ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input numeric table object
+ * \return          Input object that corresponds to the given identifier
+ */
+data_management::NumericTablePtr Input::get(NumericTableInputId id) const
+{
+    return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(NumericTableInputId id, const data_management::NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Returns the number of rows in the input numeric table
  * \return Number of rows in the input numeric table
@@ -103,6 +123,19 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     const int unexpectedLayouts = (int)packed_mask;
     services::Status s          = checkNumericTable(trainedModel->getUsersFactors().get(), usersFactorsStr(), unexpectedLayouts, 0, nFactors);
     s |= checkNumericTable(trainedModel->getItemsFactors().get(), itemsFactorsStr(), unexpectedLayouts, 0, nFactors);
+    if (!s || method != topItemsDense) return s;
+
+    const size_t nUsers = getNumberOfUsers();
+    const size_t nItems = getNumberOfItems();
+    DAAL_CHECK_EX(alsParameter->nTopItems <= nItems, ErrorIncorrectParameter, ParameterName, nTopItemsStr());
+
+    /* Known ratings are optional */
+    data_management::NumericTablePtr dataTable = get(data);
+    if (dataTable)
+    {
+        const int expectedLayout = (int)NumericTableIface::csrArray;
+        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr(), 0, expectedLayout, nItems, nUsers));
+    }
     return s;
 }
 
@@ -76,6 +76,14 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     const size_t nItems         = algInput->getNumberOfItems();
 
     const int unexpectedLayouts = (int)packed_mask;
+    if (method == topItemsDense)
+    {
+        const size_t nTopItems = static_cast<const Parameter *>(parameter)->nTopItems;
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(topItems).get(), topItemsStr(), unexpectedLayouts, 0, nTopItems, nUsers));
+        return checkNumericTable(get(topRatings).get(), topRatingsStr(), unexpectedLayouts, 0, nTopItems, nUsers);
+    }
     return checkNumericTable(get(prediction).get(), predictionStr(), unexpectedLayouts, 0, nItems, nUsers);
 }
 
@@ -52,6 +52,14 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
     size_t nUsers = algInput->getNumberOfUsers();
     size_t nItems = algInput->getNumberOfItems();
     Status st;
+    if (method == topItemsDense)
+    {
+        const size_t nTopItems = static_cast<const Parameter *>(parameter)->nTopItems;
+        set(topItems, HomogenNumericTable<int>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+        set(topRatings, HomogenNumericTable<algorithmFPType>::create(nTopItems, nUsers, NumericTableIface::doAllocate, &st));
+        return st;
+    }
     set(prediction, HomogenNumericTable<algorithmFPType>::create(nItems, nUsers, NumericTableIface::doAllocate, &st));
     return st;
 }
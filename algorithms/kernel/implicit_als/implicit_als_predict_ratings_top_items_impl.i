@@ -0,0 +1,230 @@
+/* file: implicit_als_predict_ratings_top_items_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of impicit ALS prediction of the items with the highest ratings
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_TOP_ITEMS_IMPL_I__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_TOP_ITEMS_IMPL_I__
+
+#include "algorithms/kernel/implicit_als/implicit_als_predict_ratings_dense_default_kernel.h"
+#include "algorithms/kernel/service_heap.h"
+#include "algorithms/threading/threading.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "externals/service_blas.h"
+#include "externals/service_memory.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+template <typename algorithmFPType>
+struct RatedItem
+{
+    algorithmFPType rating;
+    int index;
+};
+
+/* The item with the lower rating is the greater one, so the root of the max-heap holds the worst of the top items.
+   Ties are broken by the item index to make the result deterministic */
+template <typename algorithmFPType>
+struct RatedItemCompare
+{
+    bool operator()(const RatedItem<algorithmFPType> & a, const RatedItem<algorithmFPType> & b) const
+    {
+        return (a.rating > b.rating) || (a.rating == b.rating && a.index < b.index);
+    }
+};
+
+/* Thread-local buffers: ratings of a tile, heaps of the users in a block and the mask of the rated items of a tile */
+template <typename algorithmFPType, CpuType cpu>
+struct TopItemsTls
+{
+    DAAL_NEW_DELETE();
+    TopItemsTls(size_t nUsersInBlock, size_t nItemsInTile, size_t nTopItems)
+        : ratings(nUsersInBlock * nItemsInTile), heaps(nUsersInBlock * nTopItems), heapSizes(nUsersInBlock), excluded(nItemsInTile)
+    {}
+    bool isValid() const { return ratings.get() && heaps.get() && heapSizes.get() && excluded.get(); }
+
+    TArray<algorithmFPType, cpu> ratings;
+    TArray<RatedItem<algorithmFPType>, cpu> heaps;
+    TArray<size_t, cpu> heapSizes;
+    TArray<bool, cpu> excluded;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status ImplicitALSPredictTopItemsKernel<algorithmFPType, cpu>::compute(const NumericTable * usersFactorsTable,
+                                                                                 const NumericTable * itemsFactorsTable, const NumericTable * dataTable,
+                                                                                 NumericTable * topItemsTable, NumericTable * topRatingsTable,
+                                                                                 const Parameter * parameter)
+{
+    typedef RatedItem<algorithmFPType> Item;
+
+    const size_t nUsers    = usersFactorsTable->getNumberOfRows();
+    const size_t nItems    = itemsFactorsTable->getNumberOfRows();
+    const size_t nFactors  = parameter->nFactors;
+    const size_t nTopItems = parameter->nTopItems;
+
+    const size_t nUsersInBlock = 64;
+    const size_t nItemsInTile  = 1024;
+    const size_t nBlocks       = nUsers / nUsersInBlock + !!(nUsers % nUsersInBlock);
+
+    ReadRows<algorithmFPType, cpu> mtItemsFactors(*const_cast<NumericTable *>(itemsFactorsTable), 0, nItems);
+    DAAL_CHECK_BLOCK_STATUS(mtItemsFactors);
+    const algorithmFPType * itemsFactors = mtItemsFactors.get();
+
+    CSRNumericTableIface * csrData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(dataTable));
+
+    daal::tls<TopItemsTls<algorithmFPType, cpu> *> tlsData([=]() {
+        auto ptr = new TopItemsTls<algorithmFPType, cpu>(nUsersInBlock, nItemsInTile, nTopItems);
+        if (ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        TopItemsTls<algorithmFPType, cpu> * local = tlsData.local();
+        DAAL_CHECK_THR(local, services::ErrorMemoryAllocationFailed);
+
+        const size_t startUser   = iBlock * nUsersInBlock;
+        const size_t nBlockUsers = (nUsers - startUser < nUsersInBlock) ? nUsers - startUser : nUsersInBlock;
+
+        ReadRows<algorithmFPType, cpu> mtUsersFactors(*const_cast<NumericTable *>(usersFactorsTable), startUser, nBlockUsers);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtUsersFactors);
+        ReadRowsCSR<algorithmFPType, cpu> mtData(csrData, startUser, nBlockUsers);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        WriteOnlyRows<int, cpu> mtTopItems(*topItemsTable, startUser, nBlockUsers);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtTopItems);
+        WriteOnlyRows<algorithmFPType, cpu> mtTopRatings(*topRatingsTable, startUser, nBlockUsers);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtTopRatings);
+
+        const algorithmFPType * usersFactors = mtUsersFactors.get();
+        const size_t * dataCols              = mtData.cols();
+        const size_t * dataRows              = mtData.rows();
+        algorithmFPType * ratings            = local->ratings.get();
+        Item * heaps                         = local->heaps.get();
+        size_t * heapSizes                   = local->heapSizes.get();
+        bool * excluded                      = local->excluded.get();
+        const RatedItemCompare<algorithmFPType> compare;
+
+        for (size_t u = 0; u < nBlockUsers; u++)
+        {
+            heapSizes[u] = 0;
+        }
+
+        for (size_t startItem = 0; startItem < nItems; startItem += nItemsInTile)
+        {
+            const size_t nTileItems = (nItems - startItem < nItemsInTile) ? nItems - startItem : nItemsInTile;
+
+            /* ratings = usersFactors * itemsFactors^T for the tile */
+            const char trans   = 'T';
+            const char notrans = 'N';
+            const algorithmFPType one(1.0);
+            const algorithmFPType zero(0.0);
+            DAAL_INT m   = (DAAL_INT)nTileItems;
+            DAAL_INT n   = (DAAL_INT)nBlockUsers;
+            DAAL_INT k   = (DAAL_INT)nFactors;
+            DAAL_INT ldc = (DAAL_INT)nTileItems;
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m, &n, &k, &one, itemsFactors + startItem * nFactors, &k, usersFactors, &k, &zero,
+                                               ratings, &ldc);
+
+            for (size_t u = 0; u < nBlockUsers; u++)
+            {
+                const algorithmFPType * userRatings = ratings + u * nTileItems;
+                Item * heap                         = heaps + u * nTopItems;
+                size_t & heapSize                   = heapSizes[u];
+
+                /* Items rated by the user are not predicted, the column indices of the CSR data are one-based */
+                if (dataRows)
+                {
+                    daal::services::internal::service_memset_seq<bool, cpu>(excluded, false, nTileItems);
+                    for (size_t iRating = dataRows[u] - dataRows[0]; iRating < dataRows[u + 1] - dataRows[0]; iRating++)
+                    {
+                        const size_t item = dataCols[iRating] - 1;
+                        if (item >= startItem && item < startItem + nTileItems) excluded[item - startItem] = true;
+                    }
+                }
+
+                for (size_t j = 0; j < nTileItems; j++)
+                {
+                    if (dataRows && excluded[j]) continue;
+
+                    const Item item = { userRatings[j], (int)(startItem + j) };
+                    if (heapSize < nTopItems)
+                    {
+                        heap[heapSize++] = item;
+                        if (heapSize == nTopItems) daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + nTopItems, compare);
+                    }
+                    else if (compare(item, heap[0]))
+                    {
+                        heap[0] = item;
+                        daal::algorithms::internal::internalAdjustMaxHeap<cpu>(heap, heap + nTopItems, (ptrdiff_t)nTopItems, (ptrdiff_t)0,
+                                                                               compare);
+                    }
+                }
+            }
+        }
+
+        /* Top items are sorted by the ratings in descending order,
+           if less than nTopItems items are not rated by the user, the rest of the row is filled with -1 */
+        int * topItems              = mtTopItems.get();
+        algorithmFPType * topRatings = mtTopRatings.get();
+        for (size_t u = 0; u < nBlockUsers; u++)
+        {
+            Item * heap           = heaps + u * nTopItems;
+            const size_t heapSize = heapSizes[u];
+            if (heapSize < nTopItems) daal::algorithms::internal::makeMaxHeap<cpu>(heap, heap + heapSize, compare);
+            daal::algorithms::internal::sortMaxHeap<cpu>(heap, heap + heapSize, compare);
+
+            for (size_t j = 0; j < nTopItems; j++)
+            {
+                topItems[u * nTopItems + j]   = (j < heapSize) ? heap[j].index : -1;
+                topRatings[u * nTopItems + j] = (j < heapSize) ? heap[j].rating : algorithmFPType(0);
+            }
+        }
+    });
+
+    tlsData.reduce([](TopItemsTls<algorithmFPType, cpu> * ptr) { delete ptr; });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace ratings
+} // namespace prediction
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -176,8 +176,10 @@ template <typename algorithmFPType, CpuType cpu>
 struct AlsTls
 {
     DAAL_NEW_DELETE();
-    AlsTls(size_t nBlocks, const Parameter & parameter) : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors) {}
-    bool isValid() const { return _lhs.get(); }
+    AlsTls(size_t nBlocks, const Parameter & parameter)
+        : _nBlocks(nBlocks), _prm(parameter), _lhs(parameter.nFactors * parameter.nFactors), _cgBuffers(parameter.nFactors)
+    {}
+    bool isValid() const { return _lhs.get() && _cgBuffers.isValid(); }
 
     Status run(NumericTable & dstFactors, ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, const algorithmFPType * xtx,
                NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
@@ -185,10 +187,14 @@ struct AlsTls
 protected:
     Status formSystem(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
                       const int ** indices);
+    Status gatherRatings(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors, const size_t * nColFactorsRows,
+                         const int ** indices);
+    Status findSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices);
 
 protected:
     WriteOnlyRows<algorithmFPType, cpu> _mtDstFactors;
     TArray<algorithmFPType, cpu> _lhs;
+    ImplicitALSCGTls<algorithmFPType, cpu> _cgBuffers;
     ReadRows<algorithmFPType, cpu> _mtSrcFactors;
     const Parameter & _prm;
     size_t _nBlocks;
@@ -204,6 +210,19 @@ Status AlsTls<algorithmFPType, cpu>::run(NumericTable & dstFactors, ReadRowsCSR<
     DAAL_CHECK_BLOCK_STATUS(_mtDstFactors);
     algorithmFPType * rhs = _mtDstFactors.get();
     service_memset<algorithmFPType, cpu>(rhs, 0.0, _prm.nFactors);
+
+    if (_prm.solverMethod == conjugateGradientSolver)
+    {
+        /* The factors of the previous iteration are not available on this step, the conjugate gradient method starts from zeros */
+        Status s = gatherRatings(mtData, i, aSrcFactors, nColFactorsRows, indices);
+        if (s.ok())
+        {
+            const size_t nRatings       = mtData.rows()[i + 1] - mtData.rows()[i];
+            const algorithmFPType gamma = algorithmFPType(_prm.lambda) * nRatings;
+            ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(_prm.nFactors, xtx, gamma, _prm.nCGIterations, nRatings, _cgBuffers, rhs);
+        }
+        return s;
+    }
     result = daal::services::internal::daal_memcpy_s(_lhs.get(), _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType), xtx,
                                                      _prm.nFactors * _prm.nFactors * sizeof(algorithmFPType));
 
@@ -258,6 +277,19 @@ Status ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     DAAL_CHECK_BLOCK_STATUS(mtXTX);
     const algorithmFPType * xtx = mtXTX.get();
 
+    /* The conjugate gradient method multiplies by the full cross-product matrix, only its upper triangle is computed on step 1 */
+    TArray<algorithmFPType, cpu> fullXtx;
+    if (parameter->solverMethod == conjugateGradientSolver)
+    {
+        const size_t xtxSize = parameter->nFactors * parameter->nFactors;
+        fullXtx.reset(xtxSize);
+        DAAL_CHECK_MALLOC(fullXtx.get());
+        int result = daal::services::internal::daal_memcpy_s(fullXtx.get(), xtxSize * sizeof(algorithmFPType), xtx, xtxSize * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        ImplicitALSTrainKernelBase<algorithmFPType, cpu>::symmetrize(parameter->nFactors, fullXtx.get());
+        xtx = fullXtx.get();
+    }
+
     const size_t nRows                    = dataTable->getNumberOfRows();
     const CSRNumericTableIface * csrIface = dynamic_cast<const CSRNumericTableIface *>(dataTable);
     ReadRowsCSR<algorithmFPType, cpu> mtData(*const_cast<CSRNumericTableIface *>(csrIface), 0, nRows);
@@ -292,36 +324,8 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu
         DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
         int colIndex = (int)mtData.cols()[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < _nBlocks; block++)
-        {
-            if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        const int * blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex])
-                hiIndex = meIndex - 1;
-            else if (colIndex > blockIndices[meIndex])
-                loIndex = meIndex + 1;
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex) break;
-        }
-        if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
-
-        _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+        Status s = findSrcFactors(colIndex, aSrcFactors, nColFactorsRows, indices);
+        if (!s) return s;
         ImplicitALSTrainKernelBase<algorithmFPType, cpu>::updateSystem(_prm.nFactors, _mtSrcFactors.get(), &c1, &c, lhs, rhs);
     }
 
@@ -334,6 +338,69 @@ Status AlsTls<algorithmFPType, cpu>::formSystem(ReadRowsCSR<algorithmFPType, cpu
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::findSrcFactors(int colIndex, NumericTable ** aSrcFactors, const size_t * nColFactorsRows, const int ** indices)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < _nBlocks; block++)
+    {
+        if (indices[block] && indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    const int * blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex])
+            hiIndex = meIndex - 1;
+        else if (colIndex > blockIndices[meIndex])
+            loIndex = meIndex + 1;
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex) break;
+    }
+    if (colIndex != blockIndices[meIndex]) return Status(ErrorALSInconsistentSparseDataBlocks);
+
+    _mtSrcFactors.set(*aSrcFactors[blockIndex], meIndex, 1);
+    DAAL_CHECK_BLOCK_STATUS(_mtSrcFactors);
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status AlsTls<algorithmFPType, cpu>::gatherRatings(ReadRowsCSR<algorithmFPType, cpu> & mtData, size_t i, NumericTable ** aSrcFactors,
+                                                   const size_t * nColFactorsRows, const int ** indices)
+{
+    const size_t startIdx = mtData.rows()[i] - 1;
+    const size_t endIdx   = mtData.rows()[i + 1] - 1;
+    DAAL_CHECK_MALLOC(_cgBuffers.reserve(endIdx - startIdx));
+
+    algorithmFPType * ratedFactors = _cgBuffers.ratedFactors.get();
+    algorithmFPType * confidences  = _cgBuffers.confidences.get();
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        DAAL_ASSERT(mtData.cols()[j] <= services::internal::MaxVal<int>::get())
+        Status s = findSrcFactors((int)mtData.cols()[j] - 1, aSrcFactors, nColFactorsRows, indices);
+        if (!s) return s;
+
+        const algorithmFPType * srcFactors = _mtSrcFactors.get();
+        algorithmFPType * ratedFactorsRow  = ratedFactors + (j - startIdx) * _prm.nFactors;
+        for (size_t k = 0; k < _prm.nFactors; k++)
+        {
+            ratedFactorsRow[k] = srcFactors[k];
+        }
+        confidences[j - startIdx] = algorithmFPType(_prm.alpha) * mtData.values()[j];
+    }
+    return Status();
+}
+
 } // namespace internal
 } // namespace training
 } // namespace implicit_als
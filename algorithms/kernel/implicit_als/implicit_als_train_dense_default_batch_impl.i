@@ -86,6 +86,108 @@ bool ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solve(size_t nCols, algor
     return (info == 0);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::symmetrize(size_t nFactors, algorithmFPType * xtx)
+{
+    for (size_t i = 0; i < nFactors; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            xtx[j * nFactors + i] = xtx[i * nFactors + j];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(size_t nFactors, const algorithmFPType * xtx, algorithmFPType gamma,
+                                                               size_t nIterations, size_t nRatings, ImplicitALSCGTls<algorithmFPType, cpu> & buffers,
+                                                               algorithmFPType * x)
+{
+    /* GEMV parameters, the rated factors are stored as the column-major nFactors x nRatings matrix Y^T */
+    const char notrans  = 'N';
+    const char trans    = 'T';
+    const DAAL_INT iOne = 1;
+    const DAAL_INT nF   = (DAAL_INT)nFactors;
+    const DAAL_INT nR   = (DAAL_INT)nRatings;
+    const algorithmFPType zero(0.0);
+    const algorithmFPType one(1.0);
+    const algorithmFPType minusOne(-1.0);
+    const algorithmFPType eps(1.0e-20);
+
+    const algorithmFPType * y = buffers.ratedFactors.get();
+    const algorithmFPType * c = buffers.confidences.get();
+    algorithmFPType * t       = buffers.products.get();
+    algorithmFPType * r       = buffers.work.get();
+    algorithmFPType * p       = r + nFactors;
+    algorithmFPType * ap      = p + nFactors;
+
+    /* Residual r = b - A * x = Y^T * (1 + c - c * (Y * x)) - (xtx + gamma * I) * x */
+    if (nRatings)
+    {
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &nF, &nR, &one, y, &nF, x, &iOne, &zero, t, &iOne);
+        for (size_t i = 0; i < nRatings; i++)
+        {
+            t[i] = one + c[i] - c[i] * t[i];
+        }
+        Blas<algorithmFPType, cpu>::xxgemv(&notrans, &nF, &nR, &one, y, &nF, t, &iOne, &zero, r, &iOne);
+    }
+    else
+    {
+        service_memset_seq<algorithmFPType, cpu>(r, zero, nFactors);
+    }
+    Blas<algorithmFPType, cpu>::xxgemv(&notrans, &nF, &nF, &minusOne, xtx, &nF, x, &iOne, &one, r, &iOne);
+
+    algorithmFPType rr = zero;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] -= gamma * x[k];
+        p[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t iter = 0; iter < nIterations && rr > eps; iter++)
+    {
+        /* ap = A * p = (xtx + gamma * I) * p + Y^T * (c * (Y * p)) */
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ap[k] = gamma * p[k];
+        }
+        Blas<algorithmFPType, cpu>::xxgemv(&notrans, &nF, &nF, &one, xtx, &nF, p, &iOne, &one, ap, &iOne);
+        if (nRatings)
+        {
+            Blas<algorithmFPType, cpu>::xxgemv(&trans, &nF, &nR, &one, y, &nF, p, &iOne, &zero, t, &iOne);
+            for (size_t i = 0; i < nRatings; i++)
+            {
+                t[i] *= c[i];
+            }
+            Blas<algorithmFPType, cpu>::xxgemv(&notrans, &nF, &nR, &one, y, &nF, t, &iOne, &one, ap, &iOne);
+        }
+
+        algorithmFPType pap = zero;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            pap += p[k] * ap[k];
+        }
+        if (!(pap > zero)) break;
+
+        const algorithmFPType step = rr / pap;
+        algorithmFPType rrNew      = zero;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        const algorithmFPType beta = rrNew / rr;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
+}
+
 static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t & blockSize, size_t & tailSize)
 {
     const size_t nThreads       = threader_get_threads_number();
@@ -106,21 +208,30 @@ static inline void getSizes(size_t nRows, size_t nCols, size_t & nBlocks, size_t
     return;
 }
 
+/* Splits the rows into the blocks processed in parallel. The rows of the CSR data are balanced by the numbers of ratings,
+   the cost of solving the system of a row is counted as nFactors ratings */
+template <CpuType cpu>
+static inline Status getRowBlocks(size_t nRows, size_t nCols, const size_t * rowOffsets, size_t nFactors, CSRRowBlocks<cpu> & blocks)
+{
+    size_t nBlocks, blockSize, tailSize;
+    getSizes(nRows, nCols, nBlocks, blockSize, tailSize);
+    return blocks.init(rowOffsets, nRows, nBlocks, nRows, nFactors);
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t nRows, size_t nCols, const algorithmFPType * data,
                                                                         const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
                                                                         algorithmFPType * colFactors, algorithmFPType * rowFactors,
                                                                         algorithmFPType alpha, algorithmFPType lambda, algorithmFPType * xtx,
-                                                                        daal::tls<algorithmFPType *> & lhs)
+                                                                        daal::tls<algorithmFPType *> & lhs, const CSRRowBlocks<cpu> & blocks,
+                                                                        daal::affinity_partitioner * partitioner)
 {
     SafeStatus safeStat;
-    size_t nBlocks, blockSize, tailSize;
-
-    getSizes(nRows, nCols, nBlocks, blockSize, tailSize);
+    const size_t nBlocks = blocks.nBlocks();
 
-    daal::threader_for(nBlocks, nBlocks, [&](size_t i) {
-        const size_t curBlockSize = (i < tailSize) ? blockSize + 1 : blockSize;
-        const size_t offset       = (i < tailSize) ? i * blockSize + i : i * blockSize + tailSize;
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [&](size_t i) {
+        const size_t curBlockSize = blocks.blockSize(i);
+        const size_t offset       = blocks.blockStart(i);
         int result                = 0;
 
         for (size_t j = 0; j < curBlockSize; j++)
@@ -146,6 +257,60 @@ Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(size_t n
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data,
+                                                                          const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                          algorithmFPType * colFactors, algorithmFPType * rowFactors,
+                                                                          algorithmFPType alpha, algorithmFPType lambda, algorithmFPType * xtx,
+                                                                          size_t nIterations, bool useRowFactors, const CSRRowBlocks<cpu> & blocks,
+                                                                          daal::affinity_partitioner * partitioner)
+{
+    SafeStatus safeStat;
+    const size_t nBlocks = blocks.nBlocks();
+
+    symmetrize(nFactors, xtx);
+
+    daal::tls<ImplicitALSCGTls<algorithmFPType, cpu> *> cgTls([=]() {
+        auto ptr = new ImplicitALSCGTls<algorithmFPType, cpu>(nFactors);
+        if (ptr && !ptr->isValid())
+        {
+            delete ptr;
+            ptr = nullptr;
+        }
+        return ptr;
+    });
+
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [&](size_t i) {
+        const size_t curBlockSize = blocks.blockSize(i);
+        const size_t offset       = blocks.blockStart(i);
+
+        ImplicitALSCGTls<algorithmFPType, cpu> * cgTlsLocal = cgTls.local();
+        DAAL_CHECK_THR(cgTlsLocal, ErrorMemoryAllocationFailed);
+
+        for (size_t j = 0; j < curBlockSize; j++)
+        {
+            algorithmFPType * x = rowFactors + (offset + j) * nFactors;
+
+            /* The factors computed on the previous iteration are the initial approximation */
+            if (!useRowFactors)
+            {
+                service_memset_seq<algorithmFPType, cpu>(x, algorithmFPType(0.0), nFactors);
+            }
+
+            size_t nRatings       = 0;
+            algorithmFPType gamma = 0.0;
+            DAAL_CHECK_THR(this->gatherRatings(offset + j, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda, *cgTlsLocal,
+                                               nRatings, gamma),
+                           ErrorMemoryAllocationFailed);
+
+            solveCG(nFactors, xtx, gamma, nIterations, nRatings, *cgTlsLocal, x);
+        }
+    });
+
+    cgTls.reduce([](ImplicitALSCGTls<algorithmFPType, cpu> * cgTlsLocal) { delete cgTlsLocal; });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data,
                                                                                 size_t * colIndices, size_t * rowOffsets,
@@ -294,6 +459,72 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(size
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::gatherRatings(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                          const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                          const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                          algorithmFPType lambda, ImplicitALSCGTls<algorithmFPType, cpu> & buffers,
+                                                                          size_t & nRatings, algorithmFPType & gamma)
+{
+    const size_t startIdx = rowOffsets[i] - 1;
+    const size_t endIdx   = rowOffsets[i + 1] - 1;
+    nRatings              = endIdx - startIdx;
+    if (!buffers.reserve(nRatings)) return false;
+
+    algorithmFPType * ratedFactors = buffers.ratedFactors.get();
+    algorithmFPType * confidences  = buffers.confidences.get();
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        const algorithmFPType * colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+        algorithmFPType * ratedFactorsRow     = ratedFactors + (j - startIdx) * nFactors;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ratedFactorsRow[k] = colFactorsRow[k];
+        }
+        confidences[j - startIdx] = alpha * data[j];
+    }
+
+    gamma = lambda * nRatings;
+    return true;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::gatherRatings(size_t i, size_t nCols, const algorithmFPType * data,
+                                                                               const size_t * colIndices, const size_t * rowOffsets, size_t nFactors,
+                                                                               const algorithmFPType * colFactors, algorithmFPType alpha,
+                                                                               algorithmFPType lambda, ImplicitALSCGTls<algorithmFPType, cpu> & buffers,
+                                                                               size_t & nRatings, algorithmFPType & gamma)
+{
+    const algorithmFPType * row = data + i * nCols;
+    nRatings                    = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        nRatings += (row[j] > 0.0);
+    }
+    if (!buffers.reserve(nRatings)) return false;
+
+    algorithmFPType * ratedFactors = buffers.ratedFactors.get();
+    algorithmFPType * confidences  = buffers.confidences.get();
+    size_t iRating                 = 0;
+    for (size_t j = 0; j < nCols; j++)
+    {
+        if (row[j] > 0.0)
+        {
+            const algorithmFPType * colFactorsRow = colFactors + j * nFactors;
+            algorithmFPType * ratedFactorsRow     = ratedFactors + iRating * nFactors;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                ratedFactorsRow[k] = colFactorsRow[k];
+            }
+            confidences[iRating++] = alpha * row[j];
+        }
+    }
+
+    /* Same regularization as in formSystem */
+    gamma = lambda * (nRatings + 1);
+    return true;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
                                                                                      implicit_als::Model * model, const Parameter * parameter)
@@ -333,17 +564,36 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::com
                                                                                                  * sizeof(algorithmFPType));
     });
 
+    /* The blocks of rows are computed once for all iterations */
+    CSRRowBlocks<cpu> userBlocks, itemBlocks;
+    DAAL_CHECK_STATUS(s, getRowBlocks<cpu>(nUsers, nItems, rowOffsets, nFactors, userBlocks));
+    DAAL_CHECK_STATUS(s, getRowBlocks<cpu>(nItems, nUsers, colOffsets, nFactors, itemBlocks));
+    /* Every sweep over the users or the items runs the blocks in the same threads as the previous sweep */
+    daal::affinity_partitioner userPartitioner, itemPartitioner;
+
+    /* Users factors are not initialized before the first iteration, the conjugate gradient method starts from zeros for them */
+    const bool useCG     = (parameter->solverMethod == conjugateGradientSolver);
     algorithmFPType beta = 0.0;
     for (size_t i = 0; i < parameter->maxIterations; i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        if (useCG)
+            s = this->computeFactorsCG(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx,
+                                       parameter->nCGIterations, i > 0, userBlocks, &userPartitioner);
+        else
+            s = this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx,
+                                     lhs, userBlocks, &userPartitioner);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        if (useCG)
+            s = this->computeFactorsCG(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx,
+                                       parameter->nCGIterations, true, itemBlocks, &itemPartitioner);
+        else
+            s = this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx,
+                                     lhs, itemBlocks, &itemPartitioner);
         if (!s) break;
 
 #if 0
@@ -396,17 +646,35 @@ services::Status ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>
         return (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->nFactors * parameter->nFactors
                                                                                                  * sizeof(algorithmFPType));
     });
+    CSRRowBlocks<cpu> userBlocks, itemBlocks;
+    DAAL_CHECK_STATUS(s, getRowBlocks<cpu>(nUsers, nItems, nullptr, nFactors, userBlocks));
+    DAAL_CHECK_STATUS(s, getRowBlocks<cpu>(nItems, nUsers, nullptr, nFactors, itemBlocks));
+    /* Every sweep over the users or the items runs the blocks in the same threads as the previous sweep */
+    daal::affinity_partitioner userPartitioner, itemPartitioner;
+
+    /* Users factors are not initialized before the first iteration, the conjugate gradient method starts from zeros for them */
+    const bool useCG     = (parameter->solverMethod == conjugateGradientSolver);
     algorithmFPType beta = 0.0;
     for (size_t i = 0; i < parameter->maxIterations; i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx, lhs);
+        if (useCG)
+            s = this->computeFactorsCG(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx,
+                                       parameter->nCGIterations, i > 0, userBlocks, &userPartitioner);
+        else
+            s = this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors, alpha, lambda, xtx,
+                                     lhs, userBlocks, &userPartitioner);
         if (!s) break;
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx, lhs);
+        if (useCG)
+            s = this->computeFactorsCG(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx,
+                                       parameter->nCGIterations, true, itemBlocks, &itemPartitioner);
+        else
+            s = this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors, alpha, lambda, xtx,
+                                     lhs, itemBlocks, &itemPartitioner);
         if (!s) break;
 
 #if 0
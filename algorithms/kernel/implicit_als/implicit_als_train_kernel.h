@@ -51,6 +51,42 @@ struct ImplicitALSTrainTaskBase;
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct ImplicitALSTrainTask;
 
+/**
+ * Thread-local buffers of the conjugate gradient solver:
+ * factors of the columns rated in the current row, the confidence increments alpha * r of the ratings
+ * and the work vectors of the solver
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct ImplicitALSCGTls
+{
+    DAAL_NEW_DELETE();
+    ImplicitALSCGTls(size_t nFactors) : nFactors(nFactors), capacity(0), work(3 * nFactors) {}
+    bool isValid() const { return work.get(); }
+
+    /* Makes the buffers large enough to hold nRatings ratings */
+    bool reserve(size_t nRatings)
+    {
+        if (nRatings <= capacity) return true;
+        ratedFactors.reset(nRatings * nFactors);
+        confidences.reset(nRatings);
+        products.reset(nRatings);
+        if (!ratedFactors.get() || !confidences.get() || !products.get())
+        {
+            capacity = 0;
+            return false;
+        }
+        capacity = nRatings;
+        return true;
+    }
+
+    size_t nFactors;
+    size_t capacity;
+    daal::internal::TArray<algorithmFPType, cpu> ratedFactors;
+    daal::internal::TArray<algorithmFPType, cpu> confidences;
+    daal::internal::TArray<algorithmFPType, cpu> products;
+    daal::internal::TArray<algorithmFPType, cpu> work;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 class ImplicitALSTrainKernelCommon : public daal::algorithms::Kernel
 {
@@ -67,6 +103,15 @@ public:
 
     static bool solve(size_t nCols, algorithmFPType * a, algorithmFPType * b);
 
+    /* Fills the lower triangle of the column-major nFactors x nFactors matrix from its upper triangle */
+    static void symmetrize(size_t nFactors, algorithmFPType * xtx);
+
+    /* Runs nIterations of the conjugate gradient method for the system
+       (xtx + gamma * I + sum_i confidences[i] * y_i * y_i^T) * x = sum_i (1 + confidences[i]) * y_i,
+       where y_i are the rows of ratedFactors. x holds the initial approximation on input */
+    static void solveCG(size_t nFactors, const algorithmFPType * xtx, algorithmFPType gamma, size_t nIterations, size_t nRatings,
+                        ImplicitALSCGTls<algorithmFPType, cpu> & buffers, algorithmFPType * x);
+
 protected:
     friend struct ImplicitALSTrainTaskBase<algorithmFPType, cpu>;
     friend struct ImplicitALSTrainTask<algorithmFPType, fastCSR, cpu>;
@@ -74,7 +119,19 @@ protected:
 
     services::Status computeFactors(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                                     size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
-                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs);
+                                    algorithmFPType lambda, algorithmFPType * xtx, daal::tls<algorithmFPType *> & lhs,
+                                    const daal::internal::CSRRowBlocks<cpu> & blocks, daal::affinity_partitioner * partitioner);
+
+    services::Status computeFactorsCG(size_t nRows, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                                      size_t nFactors, algorithmFPType * colFactors, algorithmFPType * rowFactors, algorithmFPType alpha,
+                                      algorithmFPType lambda, algorithmFPType * xtx, size_t nIterations, bool useRowFactors,
+                                      const daal::internal::CSRRowBlocks<cpu> & blocks, daal::affinity_partitioner * partitioner);
+
+    /* Copies the factors of the columns rated in the i-th row and the confidence increments of the ratings to the buffers,
+       computes the number of the ratings and the regularization coefficient of the row. Returns false if the buffers cannot be allocated */
+    virtual bool gatherRatings(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                               size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                               ImplicitALSCGTls<algorithmFPType, cpu> & buffers, size_t & nRatings, algorithmFPType & gamma) = 0;
 
     virtual void formSystem(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
                             size_t nFactors, algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType * lhs, algorithmFPType * rhs,
@@ -100,6 +157,9 @@ protected:
     virtual void computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType alpha, algorithmFPType lambda,
                                      algorithmFPType * costFunctionPtr) DAAL_C11_OVERRIDE;
+    virtual bool gatherRatings(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                               size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                               ImplicitALSCGTls<algorithmFPType, cpu> & buffers, size_t & nRatings, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -113,6 +173,9 @@ protected:
     virtual void computeCostFunction(size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType * data, size_t * colIndices, size_t * rowOffsets,
                                      algorithmFPType * itemsFactors, algorithmFPType * usersFactors, algorithmFPType alpha, algorithmFPType lambda,
                                      algorithmFPType * costFunctionPtr) DAAL_C11_OVERRIDE;
+    virtual bool gatherRatings(size_t i, size_t nCols, const algorithmFPType * data, const size_t * colIndices, const size_t * rowOffsets,
+                               size_t nFactors, const algorithmFPType * colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                               ImplicitALSCGTls<algorithmFPType, cpu> & buffers, size_t & nRatings, algorithmFPType & gamma) DAAL_C11_OVERRIDE;
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -0,0 +1,62 @@
+/* file: implicit_als_train_memory_estimate.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Estimate of the memory allocated by the implicit ALS training in the batch processing mode
+//--
+*/
+
+#include "algorithms/implicit_als/implicit_als_training_batch.h"
+#include "algorithms/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+size_t estimateMemorySize(size_t nUsers, size_t nItems, size_t nNonZeros, const Parameter & parameter, int method, size_t fpSize)
+{
+    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t nFactors = parameter.nFactors;
+
+    /* Factors of the users and of the items in the model */
+    size_t size = (nUsers + nItems) * nFactors * fpSize;
+
+    /* Product of the transposed factors by the factors */
+    size += nFactors * nFactors * fpSize;
+
+    /* Per-thread matrices of the systems of normal equations and buffers of the conjugate gradient */
+    size += nThreads * (nFactors * nFactors + 4 * nFactors) * fpSize;
+
+    /* Transposed input data */
+    if (method == fastCSR) size += nNonZeros * (fpSize + sizeof(size_t)) + (nItems + 1) * sizeof(size_t);
+    else size += nNonZeros * fpSize;
+
+    return size;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,265 @@
+/* file: implicit_als_train.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of OpenCL kernels of implicit ALS training.
+//  Each work-group solves the system of normal equations of one row of the ratings matrix:
+//  (xtx + gamma * I + sum_j c_j * y_j * y_j^T) * x = sum_j (1 + c_j) * y_j,
+//  where y_j are the factors of the columns rated in the row and c_j = alpha * r_j.
+//  Ratings are stored in the CSR format with zero-based indices.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_CL__
+#define __IMPLICIT_ALS_TRAIN_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    implicit_als_train,
+
+    void sumReduce(__local algorithmFPType * localSum, uint localId, uint localSize) {
+        for (uint stride = localSize / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride)
+            {
+                localSum[localId] += localSum[localId + stride];
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    algorithmFPType dotProduct(__global const algorithmFPType * a, __global const algorithmFPType * b, uint n, __local algorithmFPType * localSum,
+                               uint localId, uint localSize) {
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint k = localId; k < n; k += localSize)
+        {
+            sum += a[k] * b[k];
+        }
+        localSum[localId] = sum;
+        sumReduce(localSum, localId, localSize);
+        const algorithmFPType result = localSum[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        return result;
+    }
+
+    /* ap = (xtx + gamma * I + sum_j c_j * y_j * y_j^T) * p, products holds c_j * (y_j, p) of the ratings of the row */
+    void multiply(__global const algorithmFPType * values, __global const uint * colIndices, uint begin, uint end,
+                  __global const algorithmFPType * colFactors, __global const algorithmFPType * xtx, uint nFactors, algorithmFPType alpha,
+                  algorithmFPType gamma, __global const algorithmFPType * p, __global algorithmFPType * products, __global algorithmFPType * ap,
+                  uint localId, uint localSize) {
+        for (uint j = begin + localId; j < end; j += localSize)
+        {
+            __global const algorithmFPType * y = colFactors + colIndices[j] * nFactors;
+            algorithmFPType yp                 = (algorithmFPType)0;
+            for (uint k = 0; k < nFactors; k++)
+            {
+                yp += y[k] * p[k];
+            }
+            products[j] = alpha * values[j] * yp;
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        for (uint k = localId; k < nFactors; k += localSize)
+        {
+            algorithmFPType sum = gamma * p[k];
+            for (uint l = 0; l < nFactors; l++)
+            {
+                sum += xtx[k * nFactors + l] * p[l];
+            }
+            for (uint j = begin; j < end; j++)
+            {
+                sum += products[j] * colFactors[colIndices[j] * nFactors + k];
+            }
+            ap[k] = sum;
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+    }
+
+    __kernel void solveCG(__global const algorithmFPType * values, __global const uint * colIndices, __global const uint * rowOffsets,
+                          __global const algorithmFPType * colFactors, __global const algorithmFPType * xtx, __global algorithmFPType * rowFactors,
+                          __global algorithmFPType * work, __global algorithmFPType * products, uint firstRow, uint nFactors, algorithmFPType alpha,
+                          algorithmFPType lambda, uint gammaShift, uint nIterations, uint useRowFactors) {
+        const uint row       = get_global_id(0);
+        const uint i         = firstRow + row;
+        const uint localId   = get_local_id(1);
+        const uint localSize = get_local_size(1);
+
+        __local algorithmFPType localSum[LOCAL_SIZE];
+
+        const uint begin            = rowOffsets[i];
+        const uint end              = rowOffsets[i + 1];
+        const algorithmFPType gamma = lambda * (algorithmFPType)(end - begin + gammaShift);
+
+        __global algorithmFPType * x  = rowFactors + i * nFactors;
+        __global algorithmFPType * r  = work + row * 3 * nFactors;
+        __global algorithmFPType * p  = r + nFactors;
+        __global algorithmFPType * ap = p + nFactors;
+
+        if (!useRowFactors)
+        {
+            for (uint k = localId; k < nFactors; k += localSize)
+            {
+                x[k] = (algorithmFPType)0;
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        /* r = b - A * x */
+        multiply(values, colIndices, begin, end, colFactors, xtx, nFactors, alpha, gamma, x, products, ap, localId, localSize);
+        for (uint k = localId; k < nFactors; k += localSize)
+        {
+            algorithmFPType b = (algorithmFPType)0;
+            for (uint j = begin; j < end; j++)
+            {
+                b += ((algorithmFPType)1 + alpha * values[j]) * colFactors[colIndices[j] * nFactors + k];
+            }
+            r[k] = b - ap[k];
+            p[k] = r[k];
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        algorithmFPType rr = dotProduct(r, r, nFactors, localSum, localId, localSize);
+        for (uint it = 0; it < nIterations && rr > (algorithmFPType)0; it++)
+        {
+            multiply(values, colIndices, begin, end, colFactors, xtx, nFactors, alpha, gamma, p, products, ap, localId, localSize);
+
+            const algorithmFPType pap = dotProduct(p, ap, nFactors, localSum, localId, localSize);
+            if (pap <= (algorithmFPType)0) break;
+            const algorithmFPType step = rr / pap;
+
+            for (uint k = localId; k < nFactors; k += localSize)
+            {
+                x[k] += step * p[k];
+                r[k] -= step * ap[k];
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+
+            const algorithmFPType rrNew = dotProduct(r, r, nFactors, localSum, localId, localSize);
+            const algorithmFPType beta  = rrNew / rr;
+            rr                          = rrNew;
+
+            for (uint k = localId; k < nFactors; k += localSize)
+            {
+                p[k] = r[k] + beta * p[k];
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+
+    /* The system is formed in the work buffer and solved with the Cholesky decomposition,
+       errors[row] is set to 1 if the matrix of the system is not positive-definite */
+    __kernel void solveCholesky(__global const algorithmFPType * values, __global const uint * colIndices, __global const uint * rowOffsets,
+                                __global const algorithmFPType * colFactors, __global const algorithmFPType * xtx,
+                                __global algorithmFPType * rowFactors, __global algorithmFPType * work, __global uint * errors, uint firstRow,
+                                uint nFactors, algorithmFPType alpha, algorithmFPType lambda, uint gammaShift) {
+        const uint row       = get_global_id(0);
+        const uint i         = firstRow + row;
+        const uint localId   = get_local_id(1);
+        const uint localSize = get_local_size(1);
+
+        const uint begin            = rowOffsets[i];
+        const uint end              = rowOffsets[i + 1];
+        const algorithmFPType gamma = lambda * (algorithmFPType)(end - begin + gammaShift);
+
+        __global algorithmFPType * a = work + row * nFactors * nFactors;
+        __global algorithmFPType * b = rowFactors + i * nFactors;
+
+        for (uint e = localId; e < nFactors * nFactors; e += localSize)
+        {
+            const uint k        = e / nFactors;
+            const uint l        = e % nFactors;
+            algorithmFPType sum = xtx[e] + ((k == l) ? gamma : (algorithmFPType)0);
+            for (uint j = begin; j < end; j++)
+            {
+                __global const algorithmFPType * y = colFactors + colIndices[j] * nFactors;
+                sum += alpha * values[j] * y[k] * y[l];
+            }
+            a[e] = sum;
+        }
+        for (uint k = localId; k < nFactors; k += localSize)
+        {
+            algorithmFPType sum = (algorithmFPType)0;
+            for (uint j = begin; j < end; j++)
+            {
+                sum += ((algorithmFPType)1 + alpha * values[j]) * colFactors[colIndices[j] * nFactors + k];
+            }
+            b[k] = sum;
+        }
+        barrier(CLK_GLOBAL_MEM_FENCE);
+
+        /* Lower triangle of the matrix is overwritten with the Cholesky factor L, a = L * L^T */
+        for (uint k = 0; k < nFactors; k++)
+        {
+            const algorithmFPType pivot = a[k * nFactors + k];
+            if (!(pivot > (algorithmFPType)0))
+            {
+                if (localId == 0) errors[row] = 1;
+                return;
+            }
+            const algorithmFPType diag = sqrt(pivot);
+            barrier(CLK_GLOBAL_MEM_FENCE);
+
+            for (uint l = k + 1 + localId; l < nFactors; l += localSize)
+            {
+                a[l * nFactors + k] /= diag;
+            }
+            if (localId == 0) a[k * nFactors + k] = diag;
+            barrier(CLK_GLOBAL_MEM_FENCE);
+
+            const uint n = nFactors - k - 1;
+            for (uint e = localId; e < n * n; e += localSize)
+            {
+                const uint l = k + 1 + e / n;
+                const uint m = k + 1 + e % n;
+                if (m <= l) a[l * nFactors + m] -= a[l * nFactors + k] * a[m * nFactors + k];
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        /* Solve L * z = b */
+        for (uint k = 0; k < nFactors; k++)
+        {
+            const algorithmFPType z = b[k] / a[k * nFactors + k];
+            barrier(CLK_GLOBAL_MEM_FENCE);
+            for (uint l = k + 1 + localId; l < nFactors; l += localSize)
+            {
+                b[l] -= a[l * nFactors + k] * z;
+            }
+            if (localId == 0) b[k] = z;
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        /* Solve L^T * x = z */
+        for (uint k = nFactors; k > 0; k--)
+        {
+            const algorithmFPType x = b[k - 1] / a[(k - 1) * nFactors + k - 1];
+            barrier(CLK_GLOBAL_MEM_FENCE);
+            for (uint l = localId; l < k - 1; l += localSize)
+            {
+                b[l] -= a[(k - 1) * nFactors + l] * x;
+            }
+            if (localId == 0) b[k - 1] = x;
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+    }
+
+);
+
+#endif
@@ -0,0 +1,101 @@
+/* file: implicit_als_predict_ratings_dense_default_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of impicit ALS prediction algorithm for GPU
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_DEFAULT_ONEAPI_IMPL_I__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_DEFAULT_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/implicit_als/oneapi/implicit_als_predict_ratings_kernel_oneapi.h"
+#include "service/kernel/oneapi/blas_gpu.h"
+#include "oneapi/internal/utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::oneapi::internal;
+
+template <typename algorithmFPType>
+services::Status ImplicitALSPredictKernelOneAPI<algorithmFPType>::compute(const NumericTable * usersFactorsTable,
+                                                                          const NumericTable * itemsFactorsTable, NumericTable * ratingsTable,
+                                                                          const Parameter * parameter)
+{
+    services::Status status;
+
+    const size_t nUsers   = usersFactorsTable->getNumberOfRows();
+    const size_t nItems   = itemsFactorsTable->getNumberOfRows();
+    const size_t nFactors = parameter->nFactors;
+
+    DAAL_CHECK(static_cast<size_t>(static_cast<uint32_t>(nItems * nFactors)) == nItems * nFactors, services::ErrorBufferSizeIntegerOverflow);
+
+    /* Ratings are computed by blocks of users, so that the indices of the ratings block fit into 32 bits */
+    const size_t maxBlockElements = 1 << 28;
+    size_t nUsersPerBlock         = maxBlockElements / (nItems > nFactors ? nItems : nFactors);
+    if (nUsersPerBlock < 1) nUsersPerBlock = 1;
+
+    BlockDescriptor<algorithmFPType> itemsFactorsBlock;
+    DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(itemsFactorsTable)->getBlockOfRows(0, nItems, readOnly, itemsFactorsBlock));
+    const services::Buffer<algorithmFPType> itemsFactors = itemsFactorsBlock.getBuffer();
+
+    for (size_t startUser = 0; startUser < nUsers; startUser += nUsersPerBlock)
+    {
+        const size_t nBlockUsers = (nUsers - startUser < nUsersPerBlock) ? nUsers - startUser : nUsersPerBlock;
+
+        BlockDescriptor<algorithmFPType> usersFactorsBlock;
+        BlockDescriptor<algorithmFPType> ratingsBlock;
+        DAAL_CHECK_STATUS(status, const_cast<NumericTable *>(usersFactorsTable)->getBlockOfRows(startUser, nBlockUsers, readOnly, usersFactorsBlock));
+        DAAL_CHECK_STATUS(status, ratingsTable->getBlockOfRows(startUser, nBlockUsers, writeOnly, ratingsBlock));
+
+        const services::Buffer<algorithmFPType> usersFactors = usersFactorsBlock.getBuffer();
+        services::Buffer<algorithmFPType> ratings            = ratingsBlock.getBuffer();
+
+        /* ratings = usersFactors * itemsFactors^T */
+        status = BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, nBlockUsers, nItems,
+                                                 nFactors, algorithmFPType(1.0), usersFactors, nFactors, 0, itemsFactors, nFactors, 0,
+                                                 algorithmFPType(0.0), ratings, nItems, 0);
+
+        status |= const_cast<NumericTable *>(usersFactorsTable)->releaseBlockOfRows(usersFactorsBlock);
+        status |= ratingsTable->releaseBlockOfRows(ratingsBlock);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    status |= const_cast<NumericTable *>(itemsFactorsTable)->releaseBlockOfRows(itemsFactorsBlock);
+    return status;
+}
+
+} // namespace internal
+} // namespace ratings
+} // namespace prediction
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
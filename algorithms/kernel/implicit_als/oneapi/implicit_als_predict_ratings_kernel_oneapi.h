@@ -0,0 +1,59 @@
+/* file: implicit_als_predict_ratings_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for implicit ALS
+//  prediction on GPU.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_KERNEL_ONEAPI_H__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_KERNEL_ONEAPI_H__
+
+#include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
+#include "algorithms/implicit_als/implicit_als_model.h"
+#include "algorithms/kernel/kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+template <typename algorithmFPType>
+class ImplicitALSPredictKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const data_management::NumericTable * usersFactorsTable, const data_management::NumericTable * itemsFactorsTable,
+                             data_management::NumericTable * ratingsTable, const Parameter * parameter);
+};
+
+} // namespace internal
+} // namespace ratings
+} // namespace prediction
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,356 @@
+/* file: implicit_als_train_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of impicit ALS training algorithm for GPU
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __IMPLICIT_ALS_TRAIN_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "algorithms/kernel/implicit_als/oneapi/implicit_als_train_kernel_oneapi.h"
+#include "algorithms/kernel/implicit_als/oneapi/cl_kernels/implicit_als_train.cl"
+#include "service/kernel/oneapi/blas_gpu.h"
+#include "service/kernel/oneapi/sparse_reducer.h"
+#include "oneapi/internal/utils.h"
+#include "externals/service_ittnotify.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+DAAL_ITTNOTIFY_DOMAIN(daal.algorithms.implicit_als.training.batch.oneapi);
+
+/* Number of work-items that solve one system, should be a power of two */
+const uint32_t implicitALSLocalSize = 64;
+
+/* Maximal number of elements in the buffers of the systems solved at once */
+const size_t implicitALSMaxBlockElements = 1 << 26;
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::uploadRatings(const algorithmFPType * values, const size_t * colIndices,
+                                                                                          const size_t * rowOffsets, uint32_t nRows, uint32_t nCols,
+                                                                                          ImplicitALSRatingsOneAPI & ratings,
+                                                                                          ImplicitALSRatingsOneAPI & transposedRatings)
+{
+    services::Status status;
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    const size_t nNonZeros = rowOffsets[nRows] - rowOffsets[0];
+    DAAL_CHECK(static_cast<size_t>(static_cast<uint32_t>(nNonZeros)) == nNonZeros, services::ErrorBufferSizeIntegerOverflow);
+
+    services::SharedPtr<uint32_t> indices(static_cast<uint32_t *>(services::daal_malloc((nNonZeros ? nNonZeros : 1) * sizeof(uint32_t))),
+                                          services::ServiceDeleter());
+    services::SharedPtr<uint32_t> offsets(static_cast<uint32_t *>(services::daal_malloc((nRows + 1) * sizeof(uint32_t))), services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(indices && offsets);
+
+    for (size_t k = 0; k < nNonZeros; k++)
+    {
+        indices.get()[k] = static_cast<uint32_t>(colIndices[k] - 1);
+    }
+    for (uint32_t row = 0; row <= nRows; row++)
+    {
+        offsets.get()[row] = static_cast<uint32_t>(rowOffsets[row] - rowOffsets[0]);
+    }
+
+    ratings.values = context.allocate(TypeIds::id<algorithmFPType>(), nNonZeros ? nNonZeros : 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ratings.colIndices = context.allocate(TypeIds::uint32, nNonZeros ? nNonZeros : 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ratings.rowOffsets = context.allocate(TypeIds::uint32, nRows + 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (nNonZeros)
+    {
+        context.copy(ratings.values, 0, const_cast<algorithmFPType *>(values), 0, nNonZeros, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        context.copy(ratings.colIndices, 0, indices.get(), 0, nNonZeros, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    context.copy(ratings.rowOffsets, 0, offsets.get(), 0, nRows + 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* Rows of the transposed matrix are the columns of the original one */
+    math::SparseReducer::ColumnMajorMatrix columns =
+        math::SparseReducer::toColumnMajor<algorithmFPType>(values, colIndices, rowOffsets, nRows, nCols, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    transposedRatings.values     = columns.values;
+    transposedRatings.colIndices = columns.rowIndices;
+    transposedRatings.rowOffsets = columns.colOffsets;
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::uploadDenseRatings(const algorithmFPType * data, uint32_t nRows,
+                                                                                               uint32_t nCols, ImplicitALSRatingsOneAPI & ratings,
+                                                                                               ImplicitALSRatingsOneAPI & transposedRatings)
+{
+    services::SharedPtr<size_t> rowOffsets(static_cast<size_t *>(services::daal_malloc((nRows + 1) * sizeof(size_t))), services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(rowOffsets);
+
+    size_t nNonZeros = 0;
+    for (size_t i = 0; i < static_cast<size_t>(nRows) * nCols; i++)
+    {
+        nNonZeros += (data[i] > algorithmFPType(0));
+    }
+
+    services::SharedPtr<algorithmFPType> values(
+        static_cast<algorithmFPType *>(services::daal_malloc((nNonZeros ? nNonZeros : 1) * sizeof(algorithmFPType))), services::ServiceDeleter());
+    services::SharedPtr<size_t> colIndices(static_cast<size_t *>(services::daal_malloc((nNonZeros ? nNonZeros : 1) * sizeof(size_t))),
+                                           services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(values && colIndices);
+
+    /* Only the positive ratings take part in the systems of normal equations */
+    size_t k            = 0;
+    rowOffsets.get()[0] = 1;
+    for (uint32_t row = 0; row < nRows; row++)
+    {
+        const algorithmFPType * dataRow = data + static_cast<size_t>(row) * nCols;
+        for (uint32_t col = 0; col < nCols; col++)
+        {
+            if (dataRow[col] > algorithmFPType(0))
+            {
+                values.get()[k]     = dataRow[col];
+                colIndices.get()[k] = col + 1;
+                k++;
+            }
+        }
+        rowOffsets.get()[row + 1] = k + 1;
+    }
+
+    return uploadRatings(values.get(), colIndices.get(), rowOffsets.get(), nRows, nCols, ratings, transposedRatings);
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::computeFactors(
+    ExecutionContextIface & context, const ImplicitALSRatingsOneAPI & ratings, uint32_t nRows, uint32_t nCols, uint32_t nFactors,
+    const UniversalBuffer & colFactors, UniversalBuffer & rowFactors, UniversalBuffer & xtx, UniversalBuffer & products,
+    const Parameter * parameter, bool useRowFactors)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeFactors);
+    services::Status status;
+
+    /* xtx = Y^T * Y, where Y are the factors of the columns */
+    DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, nFactors,
+                                                              nFactors, nCols, algorithmFPType(1.0), colFactors, nFactors, 0, colFactors, nFactors, 0,
+                                                              algorithmFPType(0.0), xtx, nFactors, 0));
+
+    ClKernelFactoryIface & factory = context.getClKernelFactory();
+
+    services::String buildOptions = getKeyFPType<algorithmFPType>();
+    buildOptions.add("-cl-std=CL1.2 -D LOCAL_SIZE=64"); // should be equal to implicitALSLocalSize
+    services::String cachekey("__daal_algorithms_implicit_als_training_batch_");
+    cachekey.add(buildOptions);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), implicit_als_train, buildOptions.c_str());
+
+    const bool useCG          = (parameter->solverMethod == conjugateGradientSolver);
+    const uint32_t gammaShift = (method == defaultDense) ? 1 : 0;
+    const size_t rowSize      = useCG ? 3 * nFactors : static_cast<size_t>(nFactors) * nFactors;
+
+    size_t blockSize = implicitALSMaxBlockElements / rowSize;
+    if (blockSize < 1) blockSize = 1;
+    if (blockSize > nRows) blockSize = nRows;
+
+    UniversalBuffer work = context.allocate(TypeIds::id<algorithmFPType>(), blockSize * rowSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer errors;
+    if (!useCG)
+    {
+        errors = context.allocate(TypeIds::uint32, blockSize, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    KernelPtr kernel = factory.getKernel(useCG ? "solveCG" : "solveCholesky", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const algorithmFPType alpha  = parameter->alpha;
+    const algorithmFPType lambda = parameter->lambda;
+
+    for (uint32_t firstRow = 0; firstRow < nRows; firstRow += blockSize)
+    {
+        const uint32_t nBlockRows = (nRows - firstRow < blockSize) ? nRows - firstRow : blockSize;
+
+        KernelArguments args(useCG ? 15 : 13);
+        args.set(0, ratings.values, AccessModeIds::read);
+        args.set(1, ratings.colIndices, AccessModeIds::read);
+        args.set(2, ratings.rowOffsets, AccessModeIds::read);
+        args.set(3, colFactors, AccessModeIds::read);
+        args.set(4, xtx, AccessModeIds::read);
+        args.set(5, rowFactors, AccessModeIds::readwrite);
+        args.set(6, work, AccessModeIds::readwrite);
+        if (useCG)
+        {
+            args.set(7, products, AccessModeIds::readwrite);
+            args.set(8, firstRow);
+            args.set(9, nFactors);
+            args.set(10, alpha);
+            args.set(11, lambda);
+            args.set(12, gammaShift);
+            args.set(13, static_cast<uint32_t>(parameter->nCGIterations));
+            args.set(14, static_cast<uint32_t>(useRowFactors));
+        }
+        else
+        {
+            context.fill(errors, 0.0, &status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            args.set(7, errors, AccessModeIds::write);
+            args.set(8, firstRow);
+            args.set(9, nFactors);
+            args.set(10, alpha);
+            args.set(11, lambda);
+            args.set(12, gammaShift);
+        }
+
+        KernelRange localRange(1, implicitALSLocalSize);
+        KernelRange globalRange(nBlockRows, implicitALSLocalSize);
+
+        KernelNDRange range(2);
+        range.global(globalRange, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        range.local(localRange, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        context.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        if (!useCG)
+        {
+            auto errorsHost = errors.template get<uint32_t>().toHost(ReadWriteMode::readOnly);
+            DAAL_CHECK_MALLOC(errorsHost.get());
+            for (uint32_t row = 0; row < nBlockRows; row++)
+            {
+                if (errorsHost.get()[row]) return services::Status(services::ErrorALSInternal);
+            }
+        }
+    }
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+services::Status ImplicitALSTrainBatchKernelOneAPI<algorithmFPType, method>::compute(const NumericTable * dataTable, implicit_als::Model * initModel,
+                                                                                    implicit_als::Model * model, const Parameter * parameter)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    services::Status status;
+    auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    const size_t nUsers   = dataTable->getNumberOfRows();
+    const size_t nItems   = dataTable->getNumberOfColumns();
+    const size_t nFactors = parameter->nFactors;
+
+    /* Factors are indexed with 32-bit integers on the device */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nUsers, nFactors);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nItems, nFactors);
+    DAAL_CHECK(static_cast<size_t>(static_cast<uint32_t>(nUsers * nFactors)) == nUsers * nFactors, services::ErrorBufferSizeIntegerOverflow);
+    DAAL_CHECK(static_cast<size_t>(static_cast<uint32_t>(nItems * nFactors)) == nItems * nFactors, services::ErrorBufferSizeIntegerOverflow);
+    DAAL_CHECK(static_cast<size_t>(static_cast<uint32_t>(nFactors * nFactors)) == nFactors * nFactors, services::ErrorBufferSizeIntegerOverflow);
+
+    NumericTable * ratingsTable = const_cast<NumericTable *>(dataTable);
+    ImplicitALSRatingsOneAPI ratings;
+    ImplicitALSRatingsOneAPI transposedRatings;
+    size_t nNonZeros = 0;
+    if (method == fastCSR)
+    {
+        CSRNumericTableIface * csrTable = dynamic_cast<CSRNumericTableIface *>(ratingsTable);
+        DAAL_CHECK(csrTable, services::ErrorIncorrectTypeOfInputNumericTable);
+
+        CSRBlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(status, csrTable->getSparseBlock(0, nUsers, readOnly, block));
+        nNonZeros = block.getDataSize();
+        status    = uploadRatings(block.getBlockValuesPtr(), block.getBlockColumnIndicesPtr(), block.getBlockRowIndicesPtr(), nUsers, nItems, ratings,
+                               transposedRatings);
+        status |= csrTable->releaseSparseBlock(block);
+    }
+    else
+    {
+        BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(status, ratingsTable->getBlockOfRows(0, nUsers, readOnly, block));
+        const algorithmFPType * data = block.getBlockPtr();
+        for (size_t i = 0; i < nUsers * nItems; i++)
+        {
+            nNonZeros += (data[i] > algorithmFPType(0));
+        }
+        status = uploadDenseRatings(data, nUsers, nItems, ratings, transposedRatings);
+        status |= ratingsTable->releaseBlockOfRows(block);
+    }
+    DAAL_CHECK_STATUS_VAR(status);
+
+    NumericTable * itemsFactorsTable = model->getItemsFactors().get();
+    NumericTable * usersFactorsTable = model->getUsersFactors().get();
+
+    BlockDescriptor<algorithmFPType> itemsFactorsBlock;
+    BlockDescriptor<algorithmFPType> usersFactorsBlock;
+    DAAL_CHECK_STATUS(status, itemsFactorsTable->getBlockOfRows(0, nItems, readWrite, itemsFactorsBlock));
+    DAAL_CHECK_STATUS(status, usersFactorsTable->getBlockOfRows(0, nUsers, readWrite, usersFactorsBlock));
+
+    UniversalBuffer itemsFactors = itemsFactorsBlock.getBuffer();
+    UniversalBuffer usersFactors = usersFactorsBlock.getBuffer();
+
+    NumericTable * initItemsFactorsTable = initModel->getItemsFactors().get();
+    if (initItemsFactorsTable != itemsFactorsTable)
+    {
+        BlockDescriptor<algorithmFPType> initItemsFactorsBlock;
+        DAAL_CHECK_STATUS(status, initItemsFactorsTable->getBlockOfRows(0, nItems, readOnly, initItemsFactorsBlock));
+        context.copy(itemsFactors, 0, initItemsFactorsBlock.getBuffer(), 0, nItems * nFactors, &status);
+        status |= initItemsFactorsTable->releaseBlockOfRows(initItemsFactorsBlock);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    UniversalBuffer xtx = context.allocate(TypeIds::id<algorithmFPType>(), nFactors * nFactors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer products;
+    if (parameter->solverMethod == conjugateGradientSolver)
+    {
+        products = context.allocate(TypeIds::id<algorithmFPType>(), nNonZeros ? nNonZeros : 1, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    /* Users factors are not initialized before the first iteration, the conjugate gradient method starts from zeros for them */
+    for (size_t i = 0; i < parameter->maxIterations && status; i++)
+    {
+        status = computeFactors(context, ratings, nUsers, nItems, nFactors, itemsFactors, usersFactors, xtx, products, parameter, i > 0);
+        if (status)
+        {
+            status = computeFactors(context, transposedRatings, nItems, nUsers, nFactors, usersFactors, itemsFactors, xtx, products, parameter, true);
+        }
+    }
+
+    status |= itemsFactorsTable->releaseBlockOfRows(itemsFactorsBlock);
+    status |= usersFactorsTable->releaseBlockOfRows(usersFactorsBlock);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
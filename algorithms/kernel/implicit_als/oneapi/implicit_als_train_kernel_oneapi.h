@@ -0,0 +1,88 @@
+/* file: implicit_als_train_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for implicit ALS
+//  training on GPU.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_TRAIN_KERNEL_ONEAPI_H__
+#define __IMPLICIT_ALS_TRAIN_KERNEL_ONEAPI_H__
+
+#include "algorithms/implicit_als/implicit_als_training_batch.h"
+#include "algorithms/implicit_als/implicit_als_model.h"
+#include "algorithms/kernel/kernel.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+
+/**
+ * Ratings matrix on the device in the CSR format with zero-based indices
+ */
+struct ImplicitALSRatingsOneAPI
+{
+    UniversalBuffer values;
+    UniversalBuffer colIndices;
+    UniversalBuffer rowOffsets;
+};
+
+/**
+ * Trains the model on GPU. The ratings are uploaded to the device in the CSR layout and in the transposed one,
+ * zero ratings of the dense input are skipped. Systems of normal equations are solved by one work-group per row.
+ */
+template <typename algorithmFPType, Method method>
+class ImplicitALSTrainBatchKernelOneAPI : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const data_management::NumericTable * dataTable, implicit_als::Model * initModel, implicit_als::Model * model,
+                             const Parameter * parameter);
+
+private:
+    /* Uploads the ratings given in the CSR format with one-based indices */
+    static services::Status uploadRatings(const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, uint32_t nRows,
+                                          uint32_t nCols, ImplicitALSRatingsOneAPI & ratings, ImplicitALSRatingsOneAPI & transposedRatings);
+
+    /* Uploads the positive ratings of the dense row-major table */
+    static services::Status uploadDenseRatings(const algorithmFPType * data, uint32_t nRows, uint32_t nCols, ImplicitALSRatingsOneAPI & ratings,
+                                               ImplicitALSRatingsOneAPI & transposedRatings);
+
+    /* Computes the factors of the rows of the ratings matrix, products is the scratch buffer of the conjugate gradient solver
+       with one element per rating */
+    static services::Status computeFactors(ExecutionContextIface & context, const ImplicitALSRatingsOneAPI & ratings, uint32_t nRows,
+                                           uint32_t nCols, uint32_t nFactors, const UniversalBuffer & colFactors, UniversalBuffer & rowFactors,
+                                           UniversalBuffer & xtx, UniversalBuffer & products, const Parameter * parameter, bool useRowFactors);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace implicit_als
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,210 @@
+/* file: ball_tree_knn_classification_model_impl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the ball tree based k-Nearest Neighbors (kNN) model
+//--
+*/
+
+#ifndef __BALL_TREE_KNN_CLASSIFICATION_MODEL_IMPL_
+#define __BALL_TREE_KNN_CLASSIFICATION_MODEL_IMPL_
+
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ball_tree_knn_classification
+{
+namespace interface1
+{
+/**
+ * The tree is complete binary: the children of the node i are the nodes 2 * i + 1 and 2 * i + 2, the node 0 is the root.
+ * The training observations are reordered so that the observations of every node are adjacent, the node ranges table keeps
+ * the first and the past-the-last positions of them. The reordered observations are stored feature by feature,
+ * i.e. the table of points has nFeatures rows and nObservations columns, so the observations of a leaf are scanned with
+ * vector instructions. The balls table keeps the center of the ball of each node followed by its radius.
+ * A node with at most leafSize observations is a leaf, the nodes below the leaves are not used.
+ */
+class Model::ModelImpl
+{
+public:
+    /**
+     * Empty constructor for deserialization
+     */
+    ModelImpl(size_t nFeatures = 0) : _nFeatures(nFeatures), _leafSize(0), _points(), _pointLabels(), _balls(), _nodeRanges(), _data(), _labels() {}
+
+    /**
+     * Returns the training observations in the order of the tree leaves stored feature by feature
+     * \return Table of the reordered training observations
+     */
+    data_management::NumericTablePtr getPoints() { return _points; }
+
+    /**
+     * Returns the training observations in the order of the tree leaves stored feature by feature
+     * \return Table of the reordered training observations
+     */
+    data_management::NumericTableConstPtr getPoints() const { return _points; }
+
+    /**
+     * Sets a table of the training observations in the order of the tree leaves stored feature by feature
+     * \param[in]  value  Table of the reordered training observations
+     */
+    void setPoints(const data_management::NumericTablePtr & value) { _points = value; }
+
+    /**
+     * Returns the labels of the training observations in the order of the tree leaves
+     * \return Table of the reordered training labels
+     */
+    data_management::NumericTablePtr getPointLabels() { return _pointLabels; }
+
+    /**
+     * Returns the labels of the training observations in the order of the tree leaves
+     * \return Table of the reordered training labels
+     */
+    data_management::NumericTableConstPtr getPointLabels() const { return _pointLabels; }
+
+    /**
+     * Sets a table of the labels of the training observations in the order of the tree leaves
+     * \param[in]  value  Table of the reordered training labels
+     */
+    void setPointLabels(const data_management::NumericTablePtr & value) { _pointLabels = value; }
+
+    /**
+     * Returns the table of the centers and the radii of the balls of the tree nodes
+     * \return Table of the balls
+     */
+    data_management::NumericTablePtr getBalls() { return _balls; }
+
+    /**
+     * Returns the table of the centers and the radii of the balls of the tree nodes
+     * \return Table of the balls
+     */
+    data_management::NumericTableConstPtr getBalls() const { return _balls; }
+
+    /**
+     * Sets a table of the centers and the radii of the balls of the tree nodes
+     * \param[in]  value  Table of the balls
+     */
+    void setBalls(const data_management::NumericTablePtr & value) { _balls = value; }
+
+    /**
+     * Returns the table of the ranges of the reordered observations of the tree nodes
+     * \return Table of the node ranges
+     */
+    data_management::NumericTablePtr getNodeRanges() { return _nodeRanges; }
+
+    /**
+     * Returns the table of the ranges of the reordered observations of the tree nodes
+     * \return Table of the node ranges
+     */
+    data_management::NumericTableConstPtr getNodeRanges() const { return _nodeRanges; }
+
+    /**
+     * Sets a table of the ranges of the reordered observations of the tree nodes
+     * \param[in]  value  Table of the node ranges
+     */
+    void setNodeRanges(const data_management::NumericTablePtr & value) { _nodeRanges = value; }
+
+    /**
+     * Returns the maximal number of observations in a leaf of the tree
+     * \return Maximal number of observations in a leaf
+     */
+    size_t getLeafSize() const { return _leafSize; }
+
+    /**
+     * Sets the maximal number of observations in a leaf of the tree
+     * \param[in]  value  Maximal number of observations in a leaf
+     */
+    void setLeafSize(size_t value) { _leafSize = value; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTableConstPtr getData() const { return _data; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTablePtr getData() { return _data; }
+
+    /**
+     * Sets a training data
+     * \param[in]  value  Training data
+     */
+    void setData(const data_management::NumericTablePtr & value) { _data = value; }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTableConstPtr getLabels() const { return _labels; }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTablePtr getLabels() { return _labels; }
+
+    /**
+     * Sets a training labels
+     * \param[in]  value  Training labels
+     */
+    void setLabels(const data_management::NumericTablePtr & value) { _labels = value; }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        arch->set(_nFeatures);
+        arch->set(_leafSize);
+        arch->setSharedPtrObj(_points);
+        arch->setSharedPtrObj(_pointLabels);
+        arch->setSharedPtrObj(_balls);
+        arch->setSharedPtrObj(_nodeRanges);
+        arch->setSharedPtrObj(_data);
+        arch->setSharedPtrObj(_labels);
+
+        return services::Status();
+    }
+
+private:
+    size_t _nFeatures;
+    size_t _leafSize;
+    data_management::NumericTablePtr _points;
+    data_management::NumericTablePtr _pointLabels;
+    data_management::NumericTablePtr _balls;
+    data_management::NumericTablePtr _nodeRanges;
+    data_management::NumericTablePtr _data;
+    data_management::NumericTablePtr _labels;
+};
+
+} // namespace interface1
+} // namespace ball_tree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
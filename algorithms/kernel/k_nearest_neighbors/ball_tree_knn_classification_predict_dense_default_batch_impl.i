@@ -0,0 +1,276 @@
+/* file: ball_tree_knn_classification_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the neighbors search for ball tree based k-Nearest Neighbors prediction.
+//--
+*/
+
+#ifndef __BALL_TREE_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __BALL_TREE_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "algorithms/threading/threading.h"
+#include "services/daal_defines.h"
+#include "algorithms/algorithm.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "externals/service_math.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_classification_predict_dense_default_batch.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ball_tree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace ball_tree_knn_classification::internal;
+
+/* Number of queries processed by one task */
+const size_t queryBlockSize = 64;
+
+/* Majority vote of the neighbors, ties are resolved in favor of the smallest class label */
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType vote(const Neighbor<algorithmFpType> * neighbors, size_t nNeighbors, const algorithmFpType * labels, algorithmFpType * classes)
+{
+    for (size_t i = 0; i < nNeighbors; i++)
+    {
+        classes[i] = labels[neighbors[i].index];
+    }
+    daal::algorithms::internal::qSort<algorithmFpType, cpu>(nNeighbors, classes);
+
+    algorithmFpType winnerClass = classes[0];
+    size_t winnerWeight         = 1;
+    size_t currentWeight        = 1;
+    for (size_t i = 1; i < nNeighbors; i++)
+    {
+        currentWeight = (classes[i] == classes[i - 1] ? currentWeight + 1 : 1);
+        if (currentWeight > winnerWeight)
+        {
+            winnerWeight = currentWeight;
+            winnerClass  = classes[i];
+        }
+    }
+    return winnerClass;
+}
+
+/* Depth-first search of the k nearest neighbors: the nearer child is visited first and the balls that cannot contain
+   an observation closer than the current k-th neighbor are skipped */
+template <typename algorithmFpType, CpuType cpu>
+class TreeSearch
+{
+public:
+    TreeSearch(const algorithmFpType * points, size_t nPoints, size_t dim, const algorithmFpType * balls, const int * ranges, size_t leafSize)
+        : _points(points), _nPoints(nPoints), _dim(dim), _balls(balls), _ranges(ranges), _leafSize(leafSize)
+    {}
+
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        NearestNeighbors<algorithmFpType, cpu> neighbors;
+        TArray<algorithmFpType, cpu> distances;
+        TArray<algorithmFpType, cpu> classes;
+        TArray<Neighbor<algorithmFpType>, cpu> stack;
+    };
+
+    bool init(Local & local, size_t k, size_t depth) const
+    {
+        return local.neighbors.init(k) && local.distances.reset(_leafSize) && local.classes.reset(k) && local.stack.reset(depth + 2);
+    }
+
+    void search(const algorithmFpType * query, Local & local) const
+    {
+        NearestNeighbors<algorithmFpType, cpu> & neighbors = local.neighbors;
+        Neighbor<algorithmFpType> * const stack            = local.stack.get();
+        neighbors.clear();
+
+        size_t stackSize  = 1;
+        stack[0].distance = lowerBound(query, 0);
+        stack[0].index    = 0;
+        while (stackSize)
+        {
+            const Neighbor<algorithmFpType> top = stack[--stackSize];
+            if (neighbors.full() && !(top.distance < neighbors.bound())) continue;
+
+            const size_t iNode = top.index;
+            const size_t first = _ranges[2 * iNode];
+            const size_t last  = _ranges[2 * iNode + 1];
+            if (last - first <= _leafSize)
+            {
+                scanLeaf(query, first, last, local);
+                continue;
+            }
+
+            /* The farther child is pushed first, so the nearer one is visited first */
+            const size_t iLeft          = 2 * iNode + 1;
+            const algorithmFpType left  = lowerBound(query, iLeft);
+            const algorithmFpType right = lowerBound(query, iLeft + 1);
+            const bool leftIsNearer     = (left <= right);
+            stack[stackSize].distance   = (leftIsNearer ? right : left);
+            stack[stackSize++].index    = (int)(leftIsNearer ? iLeft + 1 : iLeft);
+            stack[stackSize].distance   = (leftIsNearer ? left : right);
+            stack[stackSize++].index    = (int)(leftIsNearer ? iLeft : iLeft + 1);
+        }
+    }
+
+private:
+    /* Squared distance from the query to the ball of the node */
+    algorithmFpType lowerBound(const algorithmFpType * query, size_t iNode) const
+    {
+        const algorithmFpType * const ball = _balls + iNode * (_dim + 1);
+        const algorithmFpType distance     = squaredDistance<algorithmFpType, cpu>(query, ball, _dim);
+        const algorithmFpType gap          = daal::internal::Math<algorithmFpType, cpu>::sSqrt(distance) - ball[_dim];
+        return (gap > 0 ? gap * gap : algorithmFpType(0));
+    }
+
+    /* The observations of the leaf are stored feature by feature, so the distances to all of them are computed at once
+       by the vectorized loop over the observations */
+    void scanLeaf(const algorithmFpType * query, size_t first, size_t last, Local & local) const
+    {
+        const size_t size                 = last - first;
+        algorithmFpType * const distances = local.distances.get();
+        for (size_t i = 0; i < size; i++)
+        {
+            distances[i] = 0;
+        }
+        for (size_t j = 0; j < _dim; j++)
+        {
+            const algorithmFpType * const column = _points + j * _nPoints + first;
+            const algorithmFpType value          = query[j];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < size; i++)
+            {
+                const algorithmFpType diff = column[i] - value;
+                distances[i] += diff * diff;
+            }
+        }
+        for (size_t i = 0; i < size; i++)
+        {
+            local.neighbors.insert(distances[i], (int)(first + i));
+        }
+    }
+
+    const algorithmFpType * _points;
+    size_t _nPoints;
+    size_t _dim;
+    const algorithmFpType * _balls;
+    const int * _ranges;
+    size_t _leafSize;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
+                                                                                             NumericTable * y,
+                                                                                             const daal::algorithms::Parameter * par)
+{
+    typedef TreeSearch<algorithmFpType, cpu> Search;
+    typedef typename Search::Local Local;
+
+    const ball_tree_knn_classification::Parameter * const parameter = dynamic_cast<const ball_tree_knn_classification::Parameter *>(par);
+    DAAL_CHECK(parameter, ErrorNullParameterNotSupported);
+
+    const Model * const model           = static_cast<const Model *>(m);
+    const Model::ModelImpl * const impl = model->impl();
+    NumericTable * const pointsTable    = const_cast<NumericTable *>(impl->getPoints().get());
+    NumericTable * const labelsTable    = const_cast<NumericTable *>(impl->getPointLabels().get());
+    NumericTable * const ballsTable     = const_cast<NumericTable *>(impl->getBalls().get());
+    NumericTable * const rangesTable    = const_cast<NumericTable *>(impl->getNodeRanges().get());
+
+    const size_t nPoints  = pointsTable->getNumberOfColumns();
+    const size_t dim      = pointsTable->getNumberOfRows();
+    const size_t nNodes   = ballsTable->getNumberOfRows();
+    const size_t nQueries = x->getNumberOfRows();
+    const size_t k        = (parameter->k < nPoints ? parameter->k : nPoints);
+    const size_t leafSize = impl->getLeafSize();
+    const size_t depth    = treeDepth(nPoints, leafSize);
+    DAAL_CHECK(nNodes == (size_t(2) << depth) - 1, ErrorModelNotFullInitialized);
+
+    ReadRows<algorithmFpType, cpu> pointsRows(pointsTable, 0, dim);
+    DAAL_CHECK_BLOCK_STATUS(pointsRows);
+    ReadRows<algorithmFpType, cpu> labelsRows(labelsTable, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(labelsRows);
+    const algorithmFpType * const labels = labelsRows.get();
+    ReadRows<algorithmFpType, cpu> ballsRows(ballsTable, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(ballsRows);
+    ReadRows<int, cpu> rangesRows(rangesTable, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(rangesRows);
+
+    const Search search(pointsRows.get(), nPoints, dim, ballsRows.get(), rangesRows.get(), leafSize);
+
+    services::Status status;
+    daal::tls<Local *> localTLS([=, &search, &status]() -> Local * {
+        Local * const ptr = new Local();
+        if (!ptr || !search.init(*ptr, k, depth))
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            return nullptr;
+        }
+        return ptr;
+    });
+
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t blockCount   = (nQueries + queryBlockSize - 1) / queryBlockSize;
+    SafeStatus safeStat;
+    daal::threader_for(blockCount, blockCount, [&](int iBlock) {
+        Local * const local = localTLS.local();
+        DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+
+        const size_t first = iBlock * queryBlockSize;
+        const size_t last  = (first + queryBlockSize < nQueries ? first + queryBlockSize : nQueries);
+
+        ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const dx = xRows.get();
+        algorithmFpType * const dy       = yRows.get();
+
+        for (size_t i = 0; i < last - first; i++)
+        {
+            search.search(dx + i * xColumnCount, *local);
+            dy[i * y->getNumberOfColumns()] =
+                vote<algorithmFpType, cpu>(local->neighbors.get(), local->neighbors.size(), labels, local->classes.get());
+        }
+    });
+
+    localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_SAFE_STATUS();
+    return status;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace ball_tree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,400 @@
+/* file: ball_tree_knn_classification_train_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the tree construction for the ball tree based k-Nearest Neighbors.
+//--
+*/
+
+#ifndef __BALL_TREE_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+#define __BALL_TREE_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_sort.h"
+#include "externals/service_memory.h"
+#include "externals/service_math.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_classification_train_kernel.h"
+#include "algorithms/kernel/k_nearest_neighbors/ball_tree_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ball_tree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::internal;
+using namespace ball_tree_knn_classification::internal;
+
+/* Number of observations processed by one task */
+const size_t rowsPerBlock = 256;
+
+/* Splits the nodes of the tree level by level. The nodes of the upper levels are few, so each of them is processed
+   by all threads block by block; the nodes of the lower levels are processed by one thread each.
+   The partial results of the blocks are combined in the same order on both paths, so the tree does not depend
+   on the number of threads */
+template <typename algorithmFpType, CpuType cpu>
+class TreeBuilder
+{
+public:
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        TArray<algorithmFpType, cpu> sums;
+        TArray<algorithmFpType, cpu> direction;
+
+        bool init(size_t dim) { return sums.reset(dim) && direction.reset(dim); }
+    };
+
+    TreeBuilder(const algorithmFpType * data, size_t dim, size_t leafSize, int * indices, algorithmFpType * keys, algorithmFpType * balls,
+                int * ranges)
+        : _data(data), _dim(dim), _leafSize(leafSize), _indices(indices), _keys(keys), _balls(balls), _ranges(ranges)
+    {}
+
+    /* Computes the ball of the node and splits its observations between the children by the median of their projections
+       onto the line through two distant observations */
+    services::Status processNode(size_t iNode, Local & local, bool parallel)
+    {
+        typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
+        const size_t first = _ranges[2 * iNode];
+        const size_t last  = _ranges[2 * iNode + 1];
+        const size_t size  = last - first;
+        if (!size) return services::Status();
+
+        services::Status s;
+        algorithmFpType * const center = _balls + iNode * (_dim + 1);
+        DAAL_CHECK_STATUS(s, computeCenter(first, last, center, local, parallel));
+
+        Neighbor<algorithmFpType> farthest;
+        DAAL_CHECK_STATUS(s, findFarthest(first, last, center, farthest, parallel));
+        center[_dim] = Math::sSqrt(farthest.distance);
+        if (size <= _leafSize) return s;
+
+        const algorithmFpType * const a = _data + _indices[farthest.index] * _dim;
+        DAAL_CHECK_STATUS(s, findFarthest(first, last, a, farthest, parallel));
+        const algorithmFpType * const b = _data + _indices[farthest.index] * _dim;
+
+        algorithmFpType * const direction = local.direction.get();
+        for (size_t j = 0; j < _dim; j++)
+        {
+            direction[j] = b[j] - a[j];
+        }
+        forEachBlock(first, last, parallel, [&](size_t iFirst, size_t iLast) { project(iFirst, iLast, direction); });
+
+        const size_t rank            = (size + 1) / 2;
+        const algorithmFpType * keys = _keys;
+        algorithms::internal::multiSelect<cpu>(_indices + first, _indices + last, &rank, 1, [=](int i, int j) { return keys[i] < keys[j]; });
+
+        int * const left  = _ranges + 2 * (2 * iNode + 1);
+        int * const right = left + 2;
+        left[0]           = (int)first;
+        left[1]           = (int)(first + rank);
+        right[0]          = (int)(first + rank);
+        right[1]          = (int)last;
+        return s;
+    }
+
+private:
+    template <typename Func>
+    static void forEachBlock(size_t first, size_t last, bool parallel, const Func & func)
+    {
+        const size_t nBlocks = (last - first + rowsPerBlock - 1) / rowsPerBlock;
+        if (parallel)
+        {
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                const size_t iFirst = first + iBlock * rowsPerBlock;
+                func(iFirst, (iFirst + rowsPerBlock < last ? iFirst + rowsPerBlock : last));
+            });
+            return;
+        }
+        for (size_t iFirst = first; iFirst < last; iFirst += rowsPerBlock)
+        {
+            func(iFirst, (iFirst + rowsPerBlock < last ? iFirst + rowsPerBlock : last));
+        }
+    }
+
+    void sumBlock(size_t first, size_t last, algorithmFpType * sums) const
+    {
+        service_memset_seq<algorithmFpType, cpu>(sums, algorithmFpType(0), _dim);
+        for (size_t i = first; i < last; i++)
+        {
+            const algorithmFpType * const row = _data + _indices[i] * _dim;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _dim; j++)
+            {
+                sums[j] += row[j];
+            }
+        }
+    }
+
+    /* Returns the position of the observation farthest from the point, ties are resolved in favor of the smallest position */
+    Neighbor<algorithmFpType> farthestInBlock(size_t first, size_t last, const algorithmFpType * point) const
+    {
+        Neighbor<algorithmFpType> result = { squaredDistance<algorithmFpType, cpu>(point, _data + _indices[first] * _dim, _dim), (int)first };
+        for (size_t i = first + 1; i < last; i++)
+        {
+            const algorithmFpType distance = squaredDistance<algorithmFpType, cpu>(point, _data + _indices[i] * _dim, _dim);
+            if (distance > result.distance)
+            {
+                result.distance = distance;
+                result.index    = (int)i;
+            }
+        }
+        return result;
+    }
+
+    void project(size_t first, size_t last, const algorithmFpType * direction) const
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            const algorithmFpType * const row = _data + _indices[i] * _dim;
+            algorithmFpType key               = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _dim; j++)
+            {
+                key += row[j] * direction[j];
+            }
+            _keys[_indices[i]] = key;
+        }
+    }
+
+    services::Status computeCenter(size_t first, size_t last, algorithmFpType * center, Local & local, bool parallel) const
+    {
+        const size_t nBlocks = (last - first + rowsPerBlock - 1) / rowsPerBlock;
+        service_memset_seq<algorithmFpType, cpu>(center, algorithmFpType(0), _dim);
+        if (parallel)
+        {
+            TArray<algorithmFpType, cpu> partialSums(nBlocks * _dim);
+            DAAL_CHECK_MALLOC(partialSums.get());
+            algorithmFpType * const sums = partialSums.get();
+            forEachBlock(first, last, true,
+                         [&](size_t iFirst, size_t iLast) { sumBlock(iFirst, iLast, sums + ((iFirst - first) / rowsPerBlock) * _dim); });
+            for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    center[j] += sums[iBlock * _dim + j];
+                }
+            }
+        }
+        else
+        {
+            algorithmFpType * const sums = local.sums.get();
+            forEachBlock(first, last, false, [&](size_t iFirst, size_t iLast) {
+                sumBlock(iFirst, iLast, sums);
+                for (size_t j = 0; j < _dim; j++)
+                {
+                    center[j] += sums[j];
+                }
+            });
+        }
+
+        const algorithmFpType factor = algorithmFpType(1) / algorithmFpType(last - first);
+        for (size_t j = 0; j < _dim; j++)
+        {
+            center[j] *= factor;
+        }
+        return services::Status();
+    }
+
+    services::Status findFarthest(size_t first, size_t last, const algorithmFpType * point, Neighbor<algorithmFpType> & result, bool parallel) const
+    {
+        const size_t nBlocks = (last - first + rowsPerBlock - 1) / rowsPerBlock;
+        if (parallel)
+        {
+            TArray<Neighbor<algorithmFpType>, cpu> partial(nBlocks);
+            DAAL_CHECK_MALLOC(partial.get());
+            Neighbor<algorithmFpType> * const farthest = partial.get();
+            forEachBlock(first, last, true, [&](size_t iFirst, size_t iLast) {
+                farthest[(iFirst - first) / rowsPerBlock] = farthestInBlock(iFirst, iLast, point);
+            });
+            result = farthest[0];
+            for (size_t iBlock = 1; iBlock < nBlocks; iBlock++)
+            {
+                if (farthest[iBlock].distance > result.distance) result = farthest[iBlock];
+            }
+        }
+        else
+        {
+            result = farthestInBlock(first, last, point);
+        }
+        return services::Status();
+    }
+
+    const algorithmFpType * _data;
+    size_t _dim;
+    size_t _leafSize;
+    int * _indices;
+    algorithmFpType * _keys;
+    algorithmFpType * _balls;
+    int * _ranges;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::compute(
+    NumericTable * x, NumericTable * y, ball_tree_knn_classification::Model * r, const ball_tree_knn_classification::Parameter & par)
+{
+    typedef TreeBuilder<algorithmFpType, cpu> Builder;
+    typedef typename Builder::Local Local;
+
+    services::Status status;
+    const size_t nRows = x->getNumberOfRows();
+    const size_t dim   = x->getNumberOfColumns();
+    DAAL_CHECK(nRows <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+
+    const size_t leafSize = par.leafSize;
+    const size_t depth    = treeDepth(nRows, leafSize);
+    const size_t nNodes   = (size_t(2) << depth) - 1;
+
+    ReadRows<algorithmFpType, cpu> xRows(x, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xRows);
+    const algorithmFpType * const data = xRows.get();
+    ReadRows<algorithmFpType, cpu> yRows(y, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yRows);
+    const algorithmFpType * const labels = yRows.get();
+
+    TArray<int, cpu> indices(nRows);
+    TArray<algorithmFpType, cpu> keys(nRows);
+    DAAL_CHECK_MALLOC(indices.get() && keys.get());
+    for (size_t i = 0; i < nRows; i++)
+    {
+        indices[i] = (int)i;
+    }
+
+    NumericTablePtr ballsTable = HomogenNumericTable<algorithmFpType>::create(dim + 1, nNodes, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> ballsRows(ballsTable.get(), 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(ballsRows);
+    algorithmFpType * const balls = ballsRows.get();
+    service_memset<algorithmFpType, cpu>(balls, algorithmFpType(0), nNodes * (dim + 1));
+
+    /* The nodes below the leaves keep empty ranges */
+    NumericTablePtr rangesTable = HomogenNumericTable<int>::create(2, nNodes, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<int, cpu> rangesRows(rangesTable.get(), 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(rangesRows);
+    int * const ranges = rangesRows.get();
+    service_memset<int, cpu>(ranges, 0, nNodes * 2);
+    ranges[1] = (int)nRows;
+
+    Builder builder(data, dim, leafSize, indices.get(), keys.get(), balls, ranges);
+
+    Local upperLocal;
+    DAAL_CHECK_MALLOC(upperLocal.init(dim));
+
+    daal::tls<Local *> localTLS([=, &status]() -> Local * {
+        Local * const ptr = new Local();
+        if (!ptr || !ptr->init(dim))
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            return nullptr;
+        }
+        return ptr;
+    });
+
+    const size_t nThreads = threader_get_threads_number();
+    SafeStatus safeStat;
+    for (size_t level = 0; level <= depth && status.ok(); level++)
+    {
+        const size_t firstNode   = (size_t(1) << level) - 1;
+        const size_t nLevelNodes = size_t(1) << level;
+        if (nLevelNodes < nThreads)
+        {
+            for (size_t i = 0; i < nLevelNodes && status.ok(); i++)
+            {
+                status |= builder.processNode(firstNode + i, upperLocal, true);
+            }
+            continue;
+        }
+
+        daal::threader_for(nLevelNodes, nLevelNodes, [&](size_t i) {
+            Local * const local = localTLS.local();
+            DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+            const services::Status s = builder.processNode(firstNode + i, *local, false);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+        if (!safeStat.ok()) break;
+    }
+
+    localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_SAFE_STATUS();
+
+    /* The reordered observations are stored feature by feature, so the prediction scans the leaves with vector instructions */
+    NumericTablePtr pointsTable = HomogenNumericTable<algorithmFpType>::create(nRows, dim, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> pointsRows(pointsTable.get(), 0, dim);
+    DAAL_CHECK_BLOCK_STATUS(pointsRows);
+    algorithmFpType * const points = pointsRows.get();
+
+    NumericTablePtr pointLabelsTable = HomogenNumericTable<algorithmFpType>::create(1, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> pointLabelsRows(pointLabelsTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(pointLabelsRows);
+    algorithmFpType * const pointLabels = pointLabelsRows.get();
+
+    const int * const order = indices.get();
+    const size_t nBlocks    = (nRows + rowsPerBlock - 1) / rowsPerBlock;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = (first + rowsPerBlock < nRows ? first + rowsPerBlock : nRows);
+        for (size_t j = 0; j < dim; j++)
+        {
+            algorithmFpType * const column = points + j * nRows;
+            for (size_t i = first; i < last; i++)
+            {
+                column[i] = data[order[i] * dim + j];
+            }
+        }
+        for (size_t i = first; i < last; i++)
+        {
+            pointLabels[i] = labels[order[i]];
+        }
+    });
+
+    Model::ModelImpl * const impl = r->impl();
+    impl->setPoints(pointsTable);
+    impl->setPointLabels(pointLabelsTable);
+    impl->setBalls(ballsTable);
+    impl->setNodeRanges(rangesTable);
+    impl->setLeafSize(leafSize);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace ball_tree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
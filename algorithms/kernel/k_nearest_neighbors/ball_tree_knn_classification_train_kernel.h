@@ -0,0 +1,63 @@
+/* file: ball_tree_knn_classification_train_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for ball tree based k-Nearest Neighbors training.
+//--
+*/
+
+#ifndef __BALL_TREE_KNN_CLASSIFICATION_TRAIN_KERNEL_H__
+#define __BALL_TREE_KNN_CLASSIFICATION_TRAIN_KERNEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/algorithm_base_common.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_training_types.h"
+#include "algorithms/kernel/service_error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ball_tree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::services;
+
+template <typename algorithmFpType, training::Method method, CpuType cpu>
+class KNNClassificationTrainBatchKernel
+{};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(NumericTable * x, NumericTable * y, ball_tree_knn_classification::Model * r,
+                             const ball_tree_knn_classification::Parameter & par);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace ball_tree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
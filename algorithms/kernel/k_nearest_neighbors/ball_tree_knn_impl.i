@@ -0,0 +1,122 @@
+/* file: ball_tree_knn_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions used by the training and the prediction stages of the ball tree based kNN
+//--
+*/
+
+#ifndef __BALL_TREE_KNN_IMPL_I__
+#define __BALL_TREE_KNN_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "externals/service_memory.h"
+#include "service/kernel/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ball_tree_knn_classification
+{
+namespace internal
+{
+using namespace daal::services::internal;
+
+template <typename algorithmFpType>
+struct Neighbor
+{
+    algorithmFpType distance;
+    int index;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+DAAL_FORCEINLINE algorithmFpType squaredDistance(const algorithmFpType * a, const algorithmFpType * b, size_t dim)
+{
+    algorithmFpType sum = 0;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < dim; i++)
+    {
+        const algorithmFpType diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/* Returns the depth of the complete binary tree with the leaves of at most leafSize observations */
+inline size_t treeDepth(size_t nObservations, size_t leafSize)
+{
+    size_t depth = 0;
+    for (size_t size = nObservations; size > leafSize; size = (size + 1) / 2)
+    {
+        depth++;
+    }
+    return depth;
+}
+
+/* The k nearest neighbors found so far sorted by the distance in ascending order */
+template <typename algorithmFpType, CpuType cpu>
+class NearestNeighbors
+{
+public:
+    NearestNeighbors() : _k(0), _size(0) {}
+
+    bool init(size_t k)
+    {
+        _k    = k;
+        _size = 0;
+        return _neighbors.reset(k);
+    }
+
+    void clear() { _size = 0; }
+
+    size_t size() const { return _size; }
+
+    bool full() const { return _size == _k; }
+
+    /* Squared distance to the k-th neighbor, the candidates at this distance or farther are not accepted */
+    algorithmFpType bound() const { return _neighbors[_k - 1].distance; }
+
+    const Neighbor<algorithmFpType> * get() const { return _neighbors.get(); }
+
+    void insert(algorithmFpType distance, int index)
+    {
+        if (full() && !(distance < bound())) return;
+
+        size_t i = (full() ? _k - 1 : _size++);
+        for (; i > 0 && distance < _neighbors[i - 1].distance; i--)
+        {
+            _neighbors[i] = _neighbors[i - 1];
+        }
+        _neighbors[i].distance = distance;
+        _neighbors[i].index    = index;
+    }
+
+private:
+    size_t _k;
+    size_t _size;
+    TArray<Neighbor<algorithmFpType>, cpu> _neighbors;
+};
+
+} // namespace internal
+} // namespace ball_tree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,242 @@
+/* file: hnsw_knn_classification_model_impl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the HNSW based k-Nearest Neighbors (kNN) model
+//--
+*/
+
+#ifndef __HNSW_KNN_CLASSIFICATION_MODEL_IMPL_
+#define __HNSW_KNN_CLASSIFICATION_MODEL_IMPL_
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn_classification
+{
+namespace interface1
+{
+/**
+ * The graph is stored in a table of int values with 1 + 2 * maxConnections columns.
+ * Row i < nNodes keeps the bottom layer links of the node i: the number of links followed by the indices of the linked nodes.
+ * The links of the node i on the layer l > 0 are kept in the row nNodes + firstUpperRow(i) + l - 1 in the same format.
+ * The node levels table has two columns: the top layer of the node and firstUpperRow of the node.
+ */
+class Model::ModelImpl
+{
+public:
+    /**
+     * Empty constructor for deserialization
+     */
+    ModelImpl(size_t nFeatures = 0)
+        : _nFeatures(nFeatures), _maxConnections(0), _entryPoint(0), _maxLevel(0), _graph(), _nodeLevels(), _data(), _labels()
+    {}
+
+    /**
+     * Returns the table of graph links
+     * \return Table of graph links
+     */
+    data_management::NumericTablePtr getGraph() { return _graph; }
+
+    /**
+     * Returns the table of graph links
+     * \return Table of graph links
+     */
+    data_management::NumericTableConstPtr getGraph() const { return _graph; }
+
+    /**
+     * Sets a table of graph links
+     * \param[in]  value  Table of graph links
+     */
+    void setGraph(const data_management::NumericTablePtr & value) { _graph = value; }
+
+    /**
+     * Returns the table of node levels
+     * \return Table of node levels
+     */
+    data_management::NumericTablePtr getNodeLevels() { return _nodeLevels; }
+
+    /**
+     * Returns the table of node levels
+     * \return Table of node levels
+     */
+    data_management::NumericTableConstPtr getNodeLevels() const { return _nodeLevels; }
+
+    /**
+     * Sets a table of node levels
+     * \param[in]  value  Table of node levels
+     */
+    void setNodeLevels(const data_management::NumericTablePtr & value) { _nodeLevels = value; }
+
+    /**
+     * Returns the index of the node the search starts from
+     * \return Index of the entry point node
+     */
+    size_t getEntryPoint() const { return _entryPoint; }
+
+    /**
+     * Sets the index of the node the search starts from
+     * \param[in]  value  Index of the entry point node
+     */
+    void setEntryPoint(size_t value) { _entryPoint = value; }
+
+    /**
+     * Returns the top layer of the graph
+     * \return Top layer of the graph
+     */
+    size_t getMaxLevel() const { return _maxLevel; }
+
+    /**
+     * Sets the top layer of the graph
+     * \param[in]  value  Top layer of the graph
+     */
+    void setMaxLevel(size_t value) { _maxLevel = value; }
+
+    /**
+     * Returns the maximal number of links of a node on the upper layers of the graph
+     * \return Maximal number of links of a node on the upper layers
+     */
+    size_t getMaxConnections() const { return _maxConnections; }
+
+    /**
+     * Sets the maximal number of links of a node on the upper layers of the graph
+     * \param[in]  value  Maximal number of links of a node on the upper layers
+     */
+    void setMaxConnections(size_t value) { _maxConnections = value; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTableConstPtr getData() const { return _data; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTablePtr getData() { return _data; }
+
+    /**
+     * Sets a training data
+     * \param[in]  value  Training data
+     * \param[in]  copy   Flag indicating necessary of data deep copying to avoid direct usage and modification of input data.
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT DAAL_FORCEINLINE services::Status setData(const data_management::NumericTablePtr & value, bool copy)
+    {
+        return copyTable<algorithmFPType>(value, copy, _data);
+    }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTableConstPtr getLabels() const { return _labels; }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTablePtr getLabels() { return _labels; }
+
+    /**
+     * Sets a training labels
+     * \param[in]  value  Training labels
+     * \param[in]  copy   Flag indicating necessary of data deep copying to avoid direct usage and modification of input labels.
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT DAAL_FORCEINLINE services::Status setLabels(const data_management::NumericTablePtr & value, bool copy)
+    {
+        return copyTable<algorithmFPType>(value, copy, _labels);
+    }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        arch->set(_nFeatures);
+        arch->set(_maxConnections);
+        arch->set(_entryPoint);
+        arch->set(_maxLevel);
+        arch->setSharedPtrObj(_graph);
+        arch->setSharedPtrObj(_nodeLevels);
+        arch->setSharedPtrObj(_data);
+        arch->setSharedPtrObj(_labels);
+
+        return services::Status();
+    }
+
+private:
+    /* The copy is a homogeneous table, so the prediction can access the rows of the training data without conversions */
+    template <typename algorithmFPType>
+    static services::Status copyTable(const data_management::NumericTablePtr & value, bool copy, data_management::NumericTablePtr & dest)
+    {
+        if (!copy)
+        {
+            dest = value;
+            return services::Status();
+        }
+
+        services::Status st;
+        const size_t nRows = value->getNumberOfRows();
+        const size_t nCols = value->getNumberOfColumns();
+        data_management::NumericTablePtr tbl =
+            data_management::HomogenNumericTable<algorithmFPType>::create(nCols, nRows, data_management::NumericTable::doAllocate, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        data_management::BlockDescriptor<algorithmFPType> destBD, srcBD;
+        DAAL_CHECK_STATUS(st, tbl->getBlockOfRows(0, nRows, data_management::writeOnly, destBD));
+        st = value->getBlockOfRows(0, nRows, data_management::readOnly, srcBD);
+        if (st)
+        {
+            const size_t size = nRows * nCols * sizeof(algorithmFPType);
+            if (services::internal::daal_memcpy_s(destBD.getBlockPtr(), size, srcBD.getBlockPtr(), size))
+            {
+                st = services::Status(services::ErrorMemoryCopyFailedInternal);
+            }
+            value->releaseBlockOfRows(srcBD);
+        }
+        tbl->releaseBlockOfRows(destBD);
+        if (st) dest = tbl;
+        return st;
+    }
+
+    size_t _nFeatures;
+    size_t _maxConnections;
+    size_t _entryPoint;
+    size_t _maxLevel;
+    data_management::NumericTablePtr _graph;
+    data_management::NumericTablePtr _nodeLevels;
+    data_management::NumericTablePtr _data;
+    data_management::NumericTablePtr _labels;
+};
+
+} // namespace interface1
+} // namespace hnsw_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
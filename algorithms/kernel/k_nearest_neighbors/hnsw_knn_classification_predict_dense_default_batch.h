@@ -0,0 +1,61 @@
+/* file: hnsw_knn_classification_predict_dense_default_batch.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes HNSW based k-Nearest Neighbors prediction results.
+//--
+*/
+
+#ifndef __HNSW_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_H__
+#define __HNSW_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_H__
+
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_predict.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_classification_model_impl.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFpType, prediction::Method method, CpuType cpu>
+class KNNClassificationPredictKernel : public daal::algorithms::Kernel
+{};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace hnsw_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
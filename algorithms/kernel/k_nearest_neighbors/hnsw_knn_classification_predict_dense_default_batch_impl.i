@@ -0,0 +1,189 @@
+/* file: hnsw_knn_classification_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate neighbors search for HNSW based k-Nearest Neighbors prediction.
+//--
+*/
+
+#ifndef __HNSW_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __HNSW_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "algorithms/threading/threading.h"
+#include "services/daal_defines.h"
+#include "algorithms/algorithm.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_classification_predict_dense_default_batch.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace hnsw_knn_classification::internal;
+
+/* Number of queries processed by one task */
+const size_t queryBlockSize = 64;
+
+/* Majority vote of the neighbors, ties are resolved in favor of the smallest class label */
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType vote(const Neighbor<algorithmFpType> * neighbors, size_t nNeighbors, const algorithmFpType * labels, algorithmFpType * classes)
+{
+    for (size_t i = 0; i < nNeighbors; i++)
+    {
+        classes[i] = labels[neighbors[i].index];
+    }
+    daal::algorithms::internal::qSort<algorithmFpType, cpu>(nNeighbors, classes);
+
+    algorithmFpType winnerClass = classes[0];
+    size_t winnerWeight         = 1;
+    size_t currentWeight        = 1;
+    for (size_t i = 1; i < nNeighbors; i++)
+    {
+        currentWeight = (classes[i] == classes[i - 1] ? currentWeight + 1 : 1);
+        if (currentWeight > winnerWeight)
+        {
+            winnerWeight = currentWeight;
+            winnerClass  = classes[i];
+        }
+    }
+    return winnerClass;
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
+                                                                                             NumericTable * y, const daal::algorithms::Parameter * par)
+{
+    const hnsw_knn_classification::Parameter * const parameter = dynamic_cast<const hnsw_knn_classification::Parameter *>(par);
+    DAAL_CHECK(parameter, ErrorNullParameterNotSupported);
+
+    const Model * const model           = static_cast<const Model *>(m);
+    const Model::ModelImpl * const impl = model->impl();
+    NumericTable * const dataTable      = const_cast<NumericTable *>(impl->getData().get());
+    NumericTable * const labelsTable    = const_cast<NumericTable *>(impl->getLabels().get());
+    NumericTable * const graphTable     = const_cast<NumericTable *>(impl->getGraph().get());
+    NumericTable * const levelsTable    = const_cast<NumericTable *>(impl->getNodeLevels().get());
+
+    const size_t nNodes   = dataTable->getNumberOfRows();
+    const size_t dim      = dataTable->getNumberOfColumns();
+    const size_t nQueries = x->getNumberOfRows();
+    const size_t k        = (parameter->k < nNodes ? parameter->k : nNodes);
+    const size_t ef       = (parameter->efSearch > k ? parameter->efSearch : k);
+
+    ReadRows<algorithmFpType, cpu> dataRows(dataTable, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+    const algorithmFpType * const data = dataRows.get();
+
+    ReadRows<algorithmFpType, cpu> labelsRows(labelsTable, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(labelsRows);
+    const algorithmFpType * const labels = labelsRows.get();
+
+    ReadRows<int, cpu> graphRows(graphTable, 0, graphTable->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(graphRows);
+    ReadRows<int, cpu> levelsRows(levelsTable, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(levelsRows);
+
+    const GraphView<cpu> graph(const_cast<int *>(graphRows.get()), levelsRows.get(), nNodes, impl->getMaxConnections());
+    const DirectLinkReader<cpu> reader(graph);
+    const int entryPoint  = (int)impl->getEntryPoint();
+    const size_t maxLevel = impl->getMaxLevel();
+
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        LayerSearch<algorithmFpType, cpu> search;
+        TArray<Neighbor<algorithmFpType>, cpu> neighbors;
+        TArray<algorithmFpType, cpu> classes;
+    };
+
+    services::Status status;
+    daal::tls<Local *> localTLS([=, &status]() -> Local * {
+        Local * const ptr = new Local();
+        if (!ptr || !ptr->search.init(nNodes, ef, graph.maxLinks(0)) || !ptr->neighbors.reset(ef) || !ptr->classes.reset(k))
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            return nullptr;
+        }
+        return ptr;
+    });
+
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t blockCount   = (nQueries + queryBlockSize - 1) / queryBlockSize;
+    SafeStatus safeStat;
+    daal::threader_for(blockCount, blockCount, [&](int iBlock) {
+        Local * const local = localTLS.local();
+        DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+
+        const size_t first = iBlock * queryBlockSize;
+        const size_t last  = (first + queryBlockSize < nQueries ? first + queryBlockSize : nQueries);
+
+        ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const dx = xRows.get();
+        algorithmFpType * const dy       = yRows.get();
+
+        for (size_t i = 0; i < last - first; i++)
+        {
+            const algorithmFpType * const query = dx + i * xColumnCount;
+
+            int entry                     = entryPoint;
+            algorithmFpType entryDistance = squaredDistance<algorithmFpType, cpu>(query, data + entry * dim, dim);
+            for (size_t l = maxLevel; l > 0; l--)
+            {
+                local->search.searchGreedy(query, data, dim, reader, l, entry, entryDistance);
+            }
+
+            const services::Status s = local->search.searchLayer(query, data, dim, reader, 0, ef, entry, entryDistance);
+            DAAL_CHECK_STATUS_THR(s);
+
+            const size_t nFound = local->search.extractResult(local->neighbors.get());
+            dy[i * y->getNumberOfColumns()] =
+                vote<algorithmFpType, cpu>(local->neighbors.get(), (nFound < k ? nFound : k), labels, local->classes.get());
+        }
+    });
+
+    localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_SAFE_STATUS();
+    return status;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace hnsw_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,347 @@
+/* file: hnsw_knn_classification_train_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the graph construction for the HNSW based k-Nearest Neighbors.
+//--
+*/
+
+#ifndef __HNSW_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+#define __HNSW_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "externals/service_memory.h"
+#include "externals/service_math.h"
+#include "externals/service_rng.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/engines/engine_batch_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_classification_train_kernel.h"
+#include "algorithms/kernel/k_nearest_neighbors/hnsw_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::internal;
+using namespace hnsw_knn_classification::internal;
+
+/* Number of mutexes protecting the link lists of the nodes, node i is protected by the mutex i % nodeLockCount */
+const size_t nodeLockCount = 4096;
+/* Number of nodes inserted into the graph by one task */
+const size_t insertBlockSize = 64;
+
+/* Reads the links of the graph under construction under the lock of the node */
+template <CpuType cpu>
+class LockedLinkReader
+{
+public:
+    LockedLinkReader(const GraphView<cpu> & graph, daal::Mutex * locks, size_t nLocks) : _graph(graph), _locks(locks), _nLocks(nLocks) {}
+
+    size_t read(size_t node, size_t level, int * buffer) const
+    {
+        AUTOLOCK(_locks[node % _nLocks]);
+        const int * const row = _graph.links(node, level);
+        const size_t count    = row[0];
+        for (size_t i = 0; i < count; i++)
+        {
+            buffer[i] = row[i + 1];
+        }
+        return count;
+    }
+
+private:
+    const GraphView<cpu> & _graph;
+    daal::Mutex * _locks;
+    size_t _nLocks;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class GraphBuilder
+{
+public:
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        LayerSearch<algorithmFpType, cpu> search;
+        TArray<Neighbor<algorithmFpType>, cpu> candidates;
+        TArray<Neighbor<algorithmFpType>, cpu> selected;
+        TArray<Neighbor<algorithmFpType>, cpu> pruned;
+    };
+
+    GraphBuilder(const algorithmFpType * data, size_t dim, GraphView<cpu> & graph, daal::Mutex * locks, size_t nLocks, size_t ef)
+        : _data(data), _dim(dim), _graph(graph), _reader(graph, locks, nLocks), _locks(locks), _nLocks(nLocks), _ef(ef), _entryPoint(0), _maxLevel(0)
+    {}
+
+    void setEntryPoint(size_t node)
+    {
+        _entryPoint = node;
+        _maxLevel   = _graph.level(node);
+    }
+
+    size_t getEntryPoint() const { return _entryPoint; }
+
+    size_t getMaxLevel() const { return _maxLevel; }
+
+    services::Status insert(size_t node, Local & local)
+    {
+        const algorithmFpType * const query = _data + node * _dim;
+        const size_t level                  = _graph.level(node);
+
+        /* The node that becomes the new top of the graph holds the entry point lock for the whole insertion */
+        _entryLock.lock();
+        int entry             = (int)_entryPoint;
+        const size_t maxLevel = _maxLevel;
+        const bool isNewTop   = (level > maxLevel);
+        if (!isNewTop) _entryLock.unlock();
+
+        services::Status s;
+        algorithmFpType entryDistance = squaredDistance<algorithmFpType, cpu>(query, _data + entry * _dim, _dim);
+        for (size_t l = maxLevel; l > level; l--)
+        {
+            local.search.searchGreedy(query, _data, _dim, _reader, l, entry, entryDistance);
+        }
+
+        for (size_t l = (level < maxLevel ? level : maxLevel) + 1; l-- > 0;)
+        {
+            s = local.search.searchLayer(query, _data, _dim, _reader, l, _ef, entry, entryDistance);
+            if (!s) break;
+
+            Neighbor<algorithmFpType> * const candidates = local.candidates.get();
+            const size_t nCandidates                     = local.search.extractResult(candidates);
+            const size_t nSelected                       = selectNeighbors(candidates, nCandidates, _graph.maxConnections(), local.selected.get());
+
+            {
+                AUTOLOCK(_locks[node % _nLocks]);
+                int * const row = _graph.links(node, l);
+                for (size_t i = 0; i < nSelected; i++)
+                {
+                    row[i + 1] = local.selected[i].index;
+                }
+                row[0] = (int)nSelected;
+            }
+
+            /* The nearest found node is the entry point of the next layer, the candidates are overwritten by addLink() */
+            entry         = candidates[0].index;
+            entryDistance = candidates[0].distance;
+            for (size_t i = 0; i < nSelected; i++)
+            {
+                addLink(local.selected[i].index, node, local.selected[i].distance, l, local);
+            }
+        }
+
+        if (isNewTop)
+        {
+            if (s)
+            {
+                _entryPoint = node;
+                _maxLevel   = level;
+            }
+            _entryLock.unlock();
+        }
+        return s;
+    }
+
+private:
+    /* Heuristic of the HNSW paper: a candidate is dropped if it is closer to one of the already selected nodes than to the base node.
+       The candidates are sorted by the distance to the base node in ascending order */
+    size_t selectNeighbors(const Neighbor<algorithmFpType> * candidates, size_t nCandidates, size_t maxLinks, Neighbor<algorithmFpType> * selected) const
+    {
+        size_t nSelected = 0;
+        for (size_t i = 0; i < nCandidates && nSelected < maxLinks; i++)
+        {
+            const algorithmFpType * const candidate = _data + candidates[i].index * _dim;
+            bool keep                               = true;
+            for (size_t j = 0; j < nSelected && keep; j++)
+            {
+                keep = (squaredDistance<algorithmFpType, cpu>(candidate, _data + selected[j].index * _dim, _dim) >= candidates[i].distance);
+            }
+            if (keep) selected[nSelected++] = candidates[i];
+        }
+        return nSelected;
+    }
+
+    /* Adds the reverse link target -> source, the links of the target are pruned with the heuristic if they overflow */
+    void addLink(int target, size_t source, algorithmFpType distance, size_t level, Local & local)
+    {
+        AUTOLOCK(_locks[target % _nLocks]);
+        int * const row       = _graph.links(target, level);
+        const size_t count    = row[0];
+        const size_t maxLinks = _graph.maxLinks(level);
+        if (count < maxLinks)
+        {
+            row[count + 1] = (int)source;
+            row[0]         = (int)(count + 1);
+            return;
+        }
+
+        const algorithmFpType * const base           = _data + target * _dim;
+        Neighbor<algorithmFpType> * const candidates = local.candidates.get();
+        for (size_t i = 0; i < count; i++)
+        {
+            candidates[i].index    = row[i + 1];
+            candidates[i].distance = squaredDistance<algorithmFpType, cpu>(base, _data + row[i + 1] * _dim, _dim);
+        }
+        candidates[count].index    = (int)source;
+        candidates[count].distance = distance;
+        sortNeighbors<algorithmFpType, cpu>(candidates, count + 1);
+
+        const size_t nSelected = selectNeighbors(candidates, count + 1, maxLinks, local.pruned.get());
+        for (size_t i = 0; i < nSelected; i++)
+        {
+            row[i + 1] = local.pruned[i].index;
+        }
+        row[0] = (int)nSelected;
+    }
+
+    const algorithmFpType * _data;
+    size_t _dim;
+    GraphView<cpu> & _graph;
+    LockedLinkReader<cpu> _reader;
+    daal::Mutex * _locks;
+    size_t _nLocks;
+    size_t _ef;
+    daal::Mutex _entryLock;
+    size_t _entryPoint;
+    size_t _maxLevel;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::compute(NumericTable * x,
+                                                                                                         hnsw_knn_classification::Model * r,
+                                                                                                         const hnsw_knn_classification::Parameter & par,
+                                                                                                         engines::BatchBase & engine)
+{
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+    typedef GraphBuilder<algorithmFpType, cpu> Builder;
+    typedef typename Builder::Local Local;
+
+    services::Status status;
+    const size_t nNodes = x->getNumberOfRows();
+    const size_t dim    = x->getNumberOfColumns();
+    DAAL_CHECK(nNodes <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+
+    const size_t maxConnections = par.maxConnections;
+    const size_t ef             = (par.efConstruction > maxConnections ? par.efConstruction : maxConnections);
+    const size_t width          = 2 * maxConnections + 1;
+
+    ReadRows<algorithmFpType, cpu> xRows(x, 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(xRows);
+    const algorithmFpType * const data = xRows.get();
+
+    /* The top layer of a node is drawn from the exponential distribution with the normalization factor 1 / ln(maxConnections) */
+    NumericTablePtr nodeLevelsTable = HomogenNumericTable<int>::create(2, nNodes, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<int, cpu> nodeLevelsRows(nodeLevelsTable.get(), 0, nNodes);
+    DAAL_CHECK_BLOCK_STATUS(nodeLevelsRows);
+    int * const nodeLevels = nodeLevelsRows.get();
+    size_t nUpperRows      = 0;
+    {
+        TArray<algorithmFpType, cpu> uniform(nNodes);
+        DAAL_CHECK_MALLOC(uniform.get());
+        auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+        DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+        daal::internal::RNGs<algorithmFpType, cpu> rng;
+        DAAL_CHECK(!rng.uniform(nNodes, uniform.get(), engineImpl->getState(), (algorithmFpType)0, (algorithmFpType)1), ErrorIncorrectErrorcodeFromGenerator);
+
+        const algorithmFpType levelFactor = (algorithmFpType)1 / Math::sLog((algorithmFpType)maxConnections);
+        for (size_t i = 0; i < nNodes; i++)
+        {
+            const size_t level    = (size_t)(-Math::sLog((algorithmFpType)1 - uniform[i]) * levelFactor);
+            nodeLevels[2 * i]     = (int)level;
+            nodeLevels[2 * i + 1] = (int)nUpperRows;
+            nUpperRows += level;
+        }
+    }
+    DAAL_CHECK(nNodes + nUpperRows <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+
+    NumericTablePtr graphTable = HomogenNumericTable<int>::create(width, nNodes + nUpperRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<int, cpu> graphRows(graphTable.get(), 0, nNodes + nUpperRows);
+    DAAL_CHECK_BLOCK_STATUS(graphRows);
+    int * const links = graphRows.get();
+    service_memset<int, cpu>(links, 0, (nNodes + nUpperRows) * width);
+
+    GraphView<cpu> graph(links, nodeLevels, nNodes, maxConnections);
+
+    TArray<daal::Mutex, cpu> locks(nNodes < nodeLockCount ? nNodes : nodeLockCount);
+    DAAL_CHECK_MALLOC(locks.get());
+
+    Builder builder(data, dim, graph, locks.get(), locks.size(), ef);
+    builder.setEntryPoint(0);
+
+    daal::tls<Local *> localTLS([=, &status]() -> Local * {
+        Local * const ptr = new Local();
+        if (!ptr || !ptr->search.init(nNodes, ef, 2 * maxConnections) || !ptr->candidates.reset(ef + 2 * maxConnections + 1)
+            || !ptr->selected.reset(ef + 2 * maxConnections + 1) || !ptr->pruned.reset(2 * maxConnections + 1))
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            return nullptr;
+        }
+        return ptr;
+    });
+
+    /* The first node is the initial entry point, the remaining nodes are inserted in parallel */
+    const size_t nBlocks = (nNodes > 1 ? (nNodes - 1 + insertBlockSize - 1) / insertBlockSize : 0);
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) {
+        Local * const local = localTLS.local();
+        DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+
+        const size_t begin = 1 + iBlock * insertBlockSize;
+        const size_t end   = (begin + insertBlockSize < nNodes ? begin + insertBlockSize : nNodes);
+        for (size_t i = begin; i < end; i++)
+        {
+            const services::Status s = builder.insert(i, *local);
+            DAAL_CHECK_STATUS_THR(s);
+        }
+    });
+
+    localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_SAFE_STATUS();
+
+    Model::ModelImpl * const impl = r->impl();
+    impl->setGraph(graphTable);
+    impl->setNodeLevels(nodeLevelsTable);
+    impl->setEntryPoint(builder.getEntryPoint());
+    impl->setMaxLevel(builder.getMaxLevel());
+    impl->setMaxConnections(maxConnections);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace hnsw_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
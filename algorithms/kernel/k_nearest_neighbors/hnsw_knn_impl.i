@@ -0,0 +1,343 @@
+/* file: hnsw_knn_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions for the graph search used by the training and the prediction stages of the HNSW based kNN
+//--
+*/
+
+#ifndef __HNSW_KNN_IMPL_I__
+#define __HNSW_KNN_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "externals/service_memory.h"
+#include "service/kernel/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace hnsw_knn_classification
+{
+namespace internal
+{
+using namespace daal::services::internal;
+
+template <typename algorithmFpType>
+struct Neighbor
+{
+    algorithmFpType distance;
+    int index;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+DAAL_FORCEINLINE algorithmFpType squaredDistance(const algorithmFpType * a, const algorithmFpType * b, size_t dim)
+{
+    algorithmFpType sum = 0;
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < dim; i++)
+    {
+        const algorithmFpType diff = a[i] - b[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+/* Sorts a short array of neighbors by the distance in ascending order */
+template <typename algorithmFpType, CpuType cpu>
+void sortNeighbors(Neighbor<algorithmFpType> * neighbors, size_t n)
+{
+    for (size_t i = 1; i < n; i++)
+    {
+        const Neighbor<algorithmFpType> value = neighbors[i];
+        size_t j                              = i;
+        for (; j > 0 && value.distance < neighbors[j - 1].distance; j--)
+        {
+            neighbors[j] = neighbors[j - 1];
+        }
+        neighbors[j] = value;
+    }
+}
+
+/* Binary heap of neighbors. The nearest neighbor is on the top if nearestOnTop is true, the farthest one otherwise.
+   The heap grows on demand, push() returns false if the memory cannot be allocated */
+template <typename algorithmFpType, bool nearestOnTop, CpuType cpu>
+class NeighborHeap
+{
+public:
+    NeighborHeap() : _size(0) {}
+
+    bool init(size_t capacity)
+    {
+        _size = 0;
+        return _elements.reset(capacity);
+    }
+
+    void clear() { _size = 0; }
+
+    size_t size() const { return _size; }
+
+    bool empty() const { return _size == 0; }
+
+    const Neighbor<algorithmFpType> & top() const { return _elements[0]; }
+
+    bool push(algorithmFpType distance, int index)
+    {
+        if (_size == _elements.size() && !grow()) return false;
+
+        size_t i = _size++;
+        for (; i > 0; i = (i - 1) / 2)
+        {
+            const size_t parent = (i - 1) / 2;
+            if (!before(distance, _elements[parent].distance)) break;
+            _elements[i] = _elements[parent];
+        }
+        _elements[i].distance = distance;
+        _elements[i].index    = index;
+        return true;
+    }
+
+    void pop()
+    {
+        const Neighbor<algorithmFpType> last = _elements[--_size];
+        size_t i                             = 0;
+        for (size_t child = 1; child < _size; child = 2 * i + 1)
+        {
+            if (child + 1 < _size && before(_elements[child + 1].distance, _elements[child].distance)) child++;
+            if (!before(_elements[child].distance, last.distance)) break;
+            _elements[i] = _elements[child];
+            i            = child;
+        }
+        if (_size) _elements[i] = last;
+    }
+
+private:
+    static bool before(algorithmFpType a, algorithmFpType b) { return nearestOnTop ? (a < b) : (b < a); }
+
+    bool grow()
+    {
+        const size_t capacity = (_elements.size() ? 2 * _elements.size() : 16);
+        TArray<Neighbor<algorithmFpType>, cpu> elements(_size);
+        if (_size && !elements.get()) return false;
+        for (size_t i = 0; i < _size; i++)
+        {
+            elements[i] = _elements[i];
+        }
+        if (!_elements.reset(capacity)) return false;
+        for (size_t i = 0; i < _size; i++)
+        {
+            _elements[i] = elements[i];
+        }
+        return true;
+    }
+
+    TArray<Neighbor<algorithmFpType>, cpu> _elements;
+    size_t _size;
+};
+
+/* Marks the nodes visited by the current search, the marks of the previous searches are invalidated in O(1) */
+template <CpuType cpu>
+class VisitedSet
+{
+public:
+    VisitedSet() : _tag(0) {}
+
+    bool init(size_t nNodes)
+    {
+        _tag = 0;
+        if (!_marks.reset(nNodes)) return false;
+        service_memset_seq<unsigned int, cpu>(_marks.get(), 0u, nNodes);
+        return true;
+    }
+
+    void reset()
+    {
+        if (++_tag == 0)
+        {
+            service_memset_seq<unsigned int, cpu>(_marks.get(), 0u, _marks.size());
+            _tag = 1;
+        }
+    }
+
+    /* Returns true if the node was not visited before and marks it as visited */
+    bool visit(size_t node)
+    {
+        if (_marks[node] == _tag) return false;
+        _marks[node] = _tag;
+        return true;
+    }
+
+private:
+    TArray<unsigned int, cpu> _marks;
+    unsigned int _tag;
+};
+
+/* Access to the rows of the graph table, see the description of the layout in Model::ModelImpl */
+template <CpuType cpu>
+class GraphView
+{
+public:
+    GraphView(int * links, const int * nodeLevels, size_t nNodes, size_t maxConnections)
+        : _links(links), _nodeLevels(nodeLevels), _nNodes(nNodes), _maxConnections(maxConnections), _width(2 * maxConnections + 1)
+    {}
+
+    int * links(size_t node, size_t level) const
+    {
+        const size_t row = (level ? _nNodes + _nodeLevels[2 * node + 1] + level - 1 : node);
+        return _links + row * _width;
+    }
+
+    size_t maxLinks(size_t level) const { return (level ? _maxConnections : 2 * _maxConnections); }
+
+    size_t maxConnections() const { return _maxConnections; }
+
+    size_t level(size_t node) const { return _nodeLevels[2 * node]; }
+
+    size_t width() const { return _width; }
+
+private:
+    int * _links;
+    const int * _nodeLevels;
+    size_t _nNodes;
+    size_t _maxConnections;
+    size_t _width;
+};
+
+/* Reads the links of the trained graph, no synchronization is needed */
+template <CpuType cpu>
+class DirectLinkReader
+{
+public:
+    DirectLinkReader(const GraphView<cpu> & graph) : _graph(graph) {}
+
+    size_t read(size_t node, size_t level, int * buffer) const
+    {
+        const int * const row = _graph.links(node, level);
+        const size_t count    = row[0];
+        for (size_t i = 0; i < count; i++)
+        {
+            buffer[i] = row[i + 1];
+        }
+        return count;
+    }
+
+private:
+    const GraphView<cpu> & _graph;
+};
+
+/* Thread local scratch and the search procedures of the HNSW paper */
+template <typename algorithmFpType, CpuType cpu>
+class LayerSearch
+{
+public:
+    typedef NeighborHeap<algorithmFpType, true, cpu> CandidateHeap;
+    typedef NeighborHeap<algorithmFpType, false, cpu> ResultHeap;
+
+    bool init(size_t nNodes, size_t ef, size_t maxLinks)
+    {
+        return _visited.init(nNodes) && _candidates.init(ef + maxLinks) && _result.init(ef + 1) && _linkBuffer.reset(maxLinks);
+    }
+
+    /* Moves the entry point to the nearest linked node while the distance decreases */
+    template <typename LinkReader>
+    void searchGreedy(const algorithmFpType * query, const algorithmFpType * data, size_t dim, const LinkReader & reader, size_t level, int & entry,
+                      algorithmFpType & entryDistance)
+    {
+        int * const buffer = _linkBuffer.get();
+        bool changed       = true;
+        while (changed)
+        {
+            changed            = false;
+            const size_t count = reader.read(entry, level, buffer);
+            for (size_t i = 0; i < count; i++)
+            {
+                const algorithmFpType distance = squaredDistance<algorithmFpType, cpu>(query, data + buffer[i] * dim, dim);
+                if (distance < entryDistance)
+                {
+                    entryDistance = distance;
+                    entry         = buffer[i];
+                    changed       = true;
+                }
+            }
+        }
+    }
+
+    /* Searches the layer for the ef nearest nodes starting from the entry point, they are kept in result() with the farthest one on the top */
+    template <typename LinkReader>
+    services::Status searchLayer(const algorithmFpType * query, const algorithmFpType * data, size_t dim, const LinkReader & reader, size_t level,
+                                 size_t ef, int entry, algorithmFpType entryDistance)
+    {
+        int * const buffer = _linkBuffer.get();
+        _visited.reset();
+        _candidates.clear();
+        _result.clear();
+
+        _visited.visit(entry);
+        _candidates.push(entryDistance, entry);
+        _result.push(entryDistance, entry);
+
+        while (!_candidates.empty())
+        {
+            const Neighbor<algorithmFpType> current = _candidates.top();
+            if (current.distance > _result.top().distance && _result.size() >= ef) break;
+            _candidates.pop();
+
+            const size_t count = reader.read(current.index, level, buffer);
+            for (size_t i = 0; i < count; i++)
+            {
+                const int node = buffer[i];
+                if (!_visited.visit(node)) continue;
+
+                const algorithmFpType distance = squaredDistance<algorithmFpType, cpu>(query, data + node * dim, dim);
+                if (_result.size() < ef || distance < _result.top().distance)
+                {
+                    DAAL_CHECK_MALLOC(_candidates.push(distance, node));
+                    _result.push(distance, node);
+                    if (_result.size() > ef) _result.pop();
+                }
+            }
+        }
+        return services::Status();
+    }
+
+    /* Moves the found nodes to the array in ascending order of the distance, returns the number of the nodes */
+    size_t extractResult(Neighbor<algorithmFpType> * sorted)
+    {
+        const size_t count = _result.size();
+        for (size_t i = count; i > 0; i--)
+        {
+            sorted[i - 1] = _result.top();
+            _result.pop();
+        }
+        return count;
+    }
+
+private:
+    VisitedSet<cpu> _visited;
+    CandidateHeap _candidates;
+    ResultHeap _result;
+    TArray<int, cpu> _linkBuffer;
+};
+
+} // namespace internal
+} // namespace hnsw_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
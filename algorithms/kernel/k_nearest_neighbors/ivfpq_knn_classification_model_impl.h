@@ -0,0 +1,261 @@
+/* file: ivfpq_knn_classification_model_impl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the IVF-PQ based k-Nearest Neighbors (kNN) model
+//--
+*/
+
+#ifndef __IVFPQ_KNN_CLASSIFICATION_MODEL_IMPL_
+#define __IVFPQ_KNN_CLASSIFICATION_MODEL_IMPL_
+
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ivfpq_knn_classification
+{
+namespace interface1
+{
+/**
+ * The training observations are grouped by the inverted lists: the list offsets table keeps the position of the first
+ * observation of each list followed by the total number of the observations. For every observation in this order
+ * the codes table keeps one byte per subquantizer, the index of the codeword nearest to the corresponding features of
+ * the residual between the observation and the centroid of its list. The codebooks table keeps the codewords of all
+ * subquantizers side by side: the row c holds the c-th codeword of each subquantizer in the columns of its features.
+ * The subquantizer j encodes the features from j * nFeatures / nSubquantizers to (j + 1) * nFeatures / nSubquantizers.
+ */
+class Model::ModelImpl
+{
+public:
+    /**
+     * Empty constructor for deserialization
+     */
+    ModelImpl(size_t nFeatures = 0)
+        : _nFeatures(nFeatures),
+          _nSubquantizers(0),
+          _coarseCentroids(),
+          _codebooks(),
+          _codes(),
+          _listOffsets(),
+          _pointIndices(),
+          _pointLabels(),
+          _data(),
+          _labels()
+    {}
+
+    /**
+     * Returns the centroids of the inverted lists
+     * \return Table of the centroids of the inverted lists
+     */
+    data_management::NumericTablePtr getCoarseCentroids() { return _coarseCentroids; }
+
+    /**
+     * Returns the centroids of the inverted lists
+     * \return Table of the centroids of the inverted lists
+     */
+    data_management::NumericTableConstPtr getCoarseCentroids() const { return _coarseCentroids; }
+
+    /**
+     * Sets a table of the centroids of the inverted lists
+     * \param[in]  value  Table of the centroids of the inverted lists
+     */
+    void setCoarseCentroids(const data_management::NumericTablePtr & value) { _coarseCentroids = value; }
+
+    /**
+     * Returns the codewords of the subquantizers
+     * \return Table of the codewords of the subquantizers
+     */
+    data_management::NumericTablePtr getCodebooks() { return _codebooks; }
+
+    /**
+     * Returns the codewords of the subquantizers
+     * \return Table of the codewords of the subquantizers
+     */
+    data_management::NumericTableConstPtr getCodebooks() const { return _codebooks; }
+
+    /**
+     * Sets a table of the codewords of the subquantizers
+     * \param[in]  value  Table of the codewords of the subquantizers
+     */
+    void setCodebooks(const data_management::NumericTablePtr & value) { _codebooks = value; }
+
+    /**
+     * Returns the codes of the training observations in the order of the inverted lists
+     * \return Table of the codes of the training observations
+     */
+    data_management::NumericTablePtr getCodes() { return _codes; }
+
+    /**
+     * Returns the codes of the training observations in the order of the inverted lists
+     * \return Table of the codes of the training observations
+     */
+    data_management::NumericTableConstPtr getCodes() const { return _codes; }
+
+    /**
+     * Sets a table of the codes of the training observations
+     * \param[in]  value  Table of the codes of the training observations
+     */
+    void setCodes(const data_management::NumericTablePtr & value) { _codes = value; }
+
+    /**
+     * Returns the positions of the first observations of the inverted lists
+     * \return Table of the offsets of the inverted lists
+     */
+    data_management::NumericTablePtr getListOffsets() { return _listOffsets; }
+
+    /**
+     * Returns the positions of the first observations of the inverted lists
+     * \return Table of the offsets of the inverted lists
+     */
+    data_management::NumericTableConstPtr getListOffsets() const { return _listOffsets; }
+
+    /**
+     * Sets a table of the offsets of the inverted lists
+     * \param[in]  value  Table of the offsets of the inverted lists
+     */
+    void setListOffsets(const data_management::NumericTablePtr & value) { _listOffsets = value; }
+
+    /**
+     * Returns the indices of the training observations in the order of the inverted lists
+     * \return Table of the indices of the training observations
+     */
+    data_management::NumericTablePtr getPointIndices() { return _pointIndices; }
+
+    /**
+     * Returns the indices of the training observations in the order of the inverted lists
+     * \return Table of the indices of the training observations
+     */
+    data_management::NumericTableConstPtr getPointIndices() const { return _pointIndices; }
+
+    /**
+     * Sets a table of the indices of the training observations
+     * \param[in]  value  Table of the indices of the training observations
+     */
+    void setPointIndices(const data_management::NumericTablePtr & value) { _pointIndices = value; }
+
+    /**
+     * Returns the labels of the training observations in the order of the inverted lists
+     * \return Table of the reordered training labels
+     */
+    data_management::NumericTablePtr getPointLabels() { return _pointLabels; }
+
+    /**
+     * Returns the labels of the training observations in the order of the inverted lists
+     * \return Table of the reordered training labels
+     */
+    data_management::NumericTableConstPtr getPointLabels() const { return _pointLabels; }
+
+    /**
+     * Sets a table of the reordered training labels
+     * \param[in]  value  Table of the reordered training labels
+     */
+    void setPointLabels(const data_management::NumericTablePtr & value) { _pointLabels = value; }
+
+    /**
+     * Returns the number of the groups of the features encoded separately
+     * \return Number of the subquantizers
+     */
+    size_t getNumberOfSubquantizers() const { return _nSubquantizers; }
+
+    /**
+     * Sets the number of the groups of the features encoded separately
+     * \param[in]  value  Number of the subquantizers
+     */
+    void setNumberOfSubquantizers(size_t value) { _nSubquantizers = value; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTableConstPtr getData() const { return _data; }
+
+    /**
+     * Returns training data
+     * \return Training data
+     */
+    data_management::NumericTablePtr getData() { return _data; }
+
+    /**
+     * Sets a training data
+     * \param[in]  value  Training data
+     */
+    void setData(const data_management::NumericTablePtr & value) { _data = value; }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTableConstPtr getLabels() const { return _labels; }
+
+    /**
+     * Returns training labels
+     * \return Training labels
+     */
+    data_management::NumericTablePtr getLabels() { return _labels; }
+
+    /**
+     * Sets a training labels
+     * \param[in]  value  Training labels
+     */
+    void setLabels(const data_management::NumericTablePtr & value) { _labels = value; }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        arch->set(_nFeatures);
+        arch->set(_nSubquantizers);
+        arch->setSharedPtrObj(_coarseCentroids);
+        arch->setSharedPtrObj(_codebooks);
+        arch->setSharedPtrObj(_codes);
+        arch->setSharedPtrObj(_listOffsets);
+        arch->setSharedPtrObj(_pointIndices);
+        arch->setSharedPtrObj(_pointLabels);
+        arch->setSharedPtrObj(_data);
+        arch->setSharedPtrObj(_labels);
+
+        return services::Status();
+    }
+
+private:
+    size_t _nFeatures;
+    size_t _nSubquantizers;
+    data_management::NumericTablePtr _coarseCentroids;
+    data_management::NumericTablePtr _codebooks;
+    data_management::NumericTablePtr _codes;
+    data_management::NumericTablePtr _listOffsets;
+    data_management::NumericTablePtr _pointIndices;
+    data_management::NumericTablePtr _pointLabels;
+    data_management::NumericTablePtr _data;
+    data_management::NumericTablePtr _labels;
+};
+
+} // namespace interface1
+} // namespace ivfpq_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
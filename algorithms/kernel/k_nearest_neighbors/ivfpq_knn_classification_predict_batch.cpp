@@ -0,0 +1,118 @@
+/* file: ivfpq_knn_classification_predict_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for IVF-PQ based k-Nearest Neighbors (kNN) model-based prediction
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_predict_types.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_classification_model_impl.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ivfpq_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+/** Default constructor */
+Input::Input() : classifier::prediction::Input() {}
+
+/**
+ * Returns the input Model object in the prediction stage of the IVF-PQ based kNN algorithm
+ * \param[in] id    Identifier of the input Model object
+ * \return          %Input object that corresponds to the given identifier
+ */
+ivfpq_knn_classification::ModelPtr Input::get(classifier::prediction::ModelInputId id) const
+{
+    return services::staticPointerCast<ivfpq_knn_classification::Model, data_management::SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input NumericTable object in the prediction stage of the classification algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(classifier::prediction::NumericTableInputId id, const data_management::NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Sets the input Model object in the prediction stage of the IVF-PQ based kNN algorithm
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(classifier::prediction::ModelInputId id, const ivfpq_knn_classification::ModelPtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the input object
+ * \param[in] parameter Pointer to the structure of the algorithm parameters
+ * \param[in] method    Computation method
+ */
+services::Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    services::Status s = classifier::prediction::Input::check(parameter, method);
+    if (!s) return s;
+
+    const ivfpq_knn_classification::ModelPtr m = get(classifier::prediction::model);
+    const size_t nSubquantizers                = m->impl()->getNumberOfSubquantizers();
+    const size_t nFeatures                     = m->impl()->getNumberOfFeatures();
+    DAAL_CHECK(nSubquantizers > 0 && nSubquantizers <= nFeatures, ErrorModelNotFullInitialized);
+
+    s |= checkNumericTable(m->impl()->getCoarseCentroids().get(), coarseCentroidsStr(), 0, 0, nFeatures);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    const size_t nLists = m->impl()->getCoarseCentroids()->getNumberOfRows();
+    s |= checkNumericTable(m->impl()->getCodebooks().get(), codebooksStr(), 0, 0, nFeatures);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    DAAL_CHECK(m->impl()->getCodebooks()->getNumberOfRows() <= 256, ErrorModelNotFullInitialized);
+    s |= checkNumericTable(m->impl()->getListOffsets().get(), listOffsetsStr(), 0, 0, 1, nLists + 1);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    s |= checkNumericTable(m->impl()->getCodes().get(), codesStr(), 0, 0, nSubquantizers);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    const size_t nPoints = m->impl()->getCodes()->getNumberOfRows();
+    s |= checkNumericTable(m->impl()->getPointIndices().get(), indicesStr(), 0, 0, 1, nPoints);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+    s |= checkNumericTable(m->impl()->getPointLabels().get(), labelsStr(), 0, 0, 1, nPoints);
+    DAAL_CHECK(s, ErrorModelNotFullInitialized);
+
+    /* The re-ranking reads the training observations kept by the model */
+    const Parameter * const par = static_cast<const Parameter *>(parameter);
+    if (par && par->nCandidates > 0)
+    {
+        s |= checkNumericTable(m->impl()->getData().get(), dataStr(), 0, 0, nFeatures, nPoints);
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace ivfpq_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,315 @@
+/* file: ivfpq_knn_classification_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the neighbors search for IVF-PQ based k-Nearest Neighbors prediction.
+//--
+*/
+
+#ifndef __IVFPQ_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __IVFPQ_KNN_CLASSIFICATION_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "algorithms/threading/threading.h"
+#include "services/daal_defines.h"
+#include "algorithms/algorithm.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_classification_predict_dense_default_batch.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ivfpq_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::services;
+using namespace daal::internal;
+using namespace ivfpq_knn_classification::internal;
+
+/* Number of queries processed by one task */
+const size_t queryBlockSize = 64;
+
+/* Majority vote of the neighbors, ties are resolved in favor of the smallest class label */
+template <typename algorithmFpType, CpuType cpu>
+algorithmFpType vote(const Neighbor<algorithmFpType> * neighbors, size_t nNeighbors, const algorithmFpType * labels, algorithmFpType * classes)
+{
+    for (size_t i = 0; i < nNeighbors; i++)
+    {
+        classes[i] = labels[neighbors[i].index];
+    }
+    daal::algorithms::internal::qSort<algorithmFpType, cpu>(nNeighbors, classes);
+
+    algorithmFpType winnerClass = classes[0];
+    size_t winnerWeight         = 1;
+    size_t currentWeight        = 1;
+    for (size_t i = 1; i < nNeighbors; i++)
+    {
+        currentWeight = (classes[i] == classes[i - 1] ? currentWeight + 1 : 1);
+        if (currentWeight > winnerWeight)
+        {
+            winnerWeight = currentWeight;
+            winnerClass  = classes[i];
+        }
+    }
+    return winnerClass;
+}
+
+/* Searches the nearest neighbors among the observations of the inverted lists nearest to the query. The distances to
+   the observations are approximated by the asymmetric distance computation: for every list a lookup table keeps the
+   squared distances from the residual of the query to the codewords of each subquantizer, so the distance to an
+   observation is the sum of nSubquantizers table values selected by its codes */
+template <typename algorithmFpType, CpuType cpu>
+class ListSearch
+{
+public:
+    ListSearch(const algorithmFpType * coarseCentroids, size_t nLists, const algorithmFpType * codebooks, size_t nCodewords, const byte * codes,
+               const int * listOffsets, const int * pointIndices, size_t dim, size_t nSubquantizers, NumericTable * data)
+        : _coarseCentroids(coarseCentroids),
+          _nLists(nLists),
+          _codebooks(codebooks),
+          _nCodewords(nCodewords),
+          _codes(codes),
+          _listOffsets(listOffsets),
+          _pointIndices(pointIndices),
+          _dim(dim),
+          _nSubquantizers(nSubquantizers),
+          _data(data)
+    {}
+
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        NearestNeighbors<algorithmFpType, cpu> lists;
+        NearestNeighbors<algorithmFpType, cpu> candidates;
+        NearestNeighbors<algorithmFpType, cpu> neighbors;
+        TArray<algorithmFpType, cpu> residual;
+        TArray<algorithmFpType, cpu> table;
+        TArray<algorithmFpType, cpu> classes;
+        ReadRows<algorithmFpType, cpu> row;
+    };
+
+    bool init(Local & local, size_t k, size_t nProbes, size_t nCandidates) const
+    {
+        return local.lists.init(nProbes) && local.candidates.init(nCandidates) && local.neighbors.init(k) && local.residual.reset(_dim)
+               && local.table.reset(_nSubquantizers * _nCodewords) && local.classes.reset(k);
+    }
+
+    /* Fills the candidates with the nearest observations by the approximate distances */
+    void search(const algorithmFpType * query, Local & local) const
+    {
+        /* The empty lists are not probed */
+        local.lists.clear();
+        for (size_t list = 0; list < _nLists; list++)
+        {
+            if (_listOffsets[list] == _listOffsets[list + 1]) continue;
+            local.lists.insert(squaredDistance<algorithmFpType, cpu>(query, _coarseCentroids + list * _dim, _dim), (int)list);
+        }
+
+        local.candidates.clear();
+        const algorithmFpType * const table = local.table.get();
+        for (size_t i = 0; i < local.lists.size(); i++)
+        {
+            const size_t list = local.lists.get()[i].index;
+            const size_t last = _listOffsets[list + 1];
+            fillTable(query, list, local);
+            for (size_t position = _listOffsets[list]; position < last; position++)
+            {
+                const byte * const code  = _codes + position * _nSubquantizers;
+                algorithmFpType distance = 0;
+                for (size_t j = 0; j < _nSubquantizers; j++)
+                {
+                    distance += table[j * _nCodewords + code[j]];
+                }
+                local.candidates.insert(distance, (int)position);
+            }
+        }
+    }
+
+    /* Fills the neighbors with the candidates nearest to the query by the exact distances */
+    services::Status rerank(const algorithmFpType * query, Local & local) const
+    {
+        local.neighbors.clear();
+        const Neighbor<algorithmFpType> * const candidates = local.candidates.get();
+        for (size_t i = 0; i < local.candidates.size(); i++)
+        {
+            const algorithmFpType * const point = local.row.set(_data, _pointIndices[candidates[i].index], 1);
+            DAAL_CHECK_BLOCK_STATUS(local.row);
+            local.neighbors.insert(squaredDistance<algorithmFpType, cpu>(query, point, _dim), candidates[i].index);
+        }
+        local.row.release();
+        return services::Status();
+    }
+
+private:
+    /* The differences between the residual of the query and a codeword are computed for all features at once,
+       then they are summed up within the features of each subquantizer */
+    void fillTable(const algorithmFpType * query, size_t list, Local & local) const
+    {
+        algorithmFpType * const residual       = local.residual.get();
+        algorithmFpType * const table          = local.table.get();
+        const algorithmFpType * const centroid = _coarseCentroids + list * _dim;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < _dim; j++)
+        {
+            residual[j] = query[j] - centroid[j];
+        }
+
+        for (size_t c = 0; c < _nCodewords; c++)
+        {
+            const algorithmFpType * const codeword = _codebooks + c * _dim;
+            for (size_t j = 0; j < _nSubquantizers; j++)
+            {
+                const size_t begin = subquantizerBegin(j, _dim, _nSubquantizers);
+                const size_t end   = subquantizerBegin(j + 1, _dim, _nSubquantizers);
+                table[j * _nCodewords + c] = squaredDistance<algorithmFpType, cpu>(residual + begin, codeword + begin, end - begin);
+            }
+        }
+    }
+
+    const algorithmFpType * _coarseCentroids;
+    size_t _nLists;
+    const algorithmFpType * _codebooks;
+    size_t _nCodewords;
+    const byte * _codes;
+    const int * _listOffsets;
+    const int * _pointIndices;
+    size_t _dim;
+    size_t _nSubquantizers;
+    NumericTable * _data;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
+                                                                                             NumericTable * y,
+                                                                                             const daal::algorithms::Parameter * par)
+{
+    typedef ListSearch<algorithmFpType, cpu> Search;
+    typedef typename Search::Local Local;
+
+    const ivfpq_knn_classification::Parameter * const parameter = dynamic_cast<const ivfpq_knn_classification::Parameter *>(par);
+    DAAL_CHECK(parameter, ErrorNullParameterNotSupported);
+
+    const Model * const model                 = static_cast<const Model *>(m);
+    const Model::ModelImpl * const impl       = model->impl();
+    NumericTable * const coarseCentroidsTable = const_cast<NumericTable *>(impl->getCoarseCentroids().get());
+    NumericTable * const codebooksTable       = const_cast<NumericTable *>(impl->getCodebooks().get());
+    NumericTable * const listOffsetsTable     = const_cast<NumericTable *>(impl->getListOffsets().get());
+    NumericTable * const pointIndicesTable    = const_cast<NumericTable *>(impl->getPointIndices().get());
+    NumericTable * const labelsTable          = const_cast<NumericTable *>(impl->getPointLabels().get());
+    HomogenNumericTable<byte> * const codesTable =
+        dynamic_cast<HomogenNumericTable<byte> *>(const_cast<NumericTable *>(impl->getCodes().get()));
+    DAAL_CHECK(codesTable, ErrorModelNotFullInitialized);
+
+    const size_t dim            = impl->getNumberOfFeatures();
+    const size_t nSubquantizers = impl->getNumberOfSubquantizers();
+    const size_t nLists         = coarseCentroidsTable->getNumberOfRows();
+    const size_t nCodewords     = codebooksTable->getNumberOfRows();
+    const size_t nPoints        = codesTable->getNumberOfRows();
+    const size_t nQueries       = x->getNumberOfRows();
+    const size_t k              = (parameter->k < nPoints ? parameter->k : nPoints);
+    const size_t nProbes        = (parameter->nProbes < nLists ? parameter->nProbes : nLists);
+    const bool doRerank         = (parameter->nCandidates > 0);
+    const size_t nCandidates    = (doRerank ? (parameter->nCandidates > k ? parameter->nCandidates : k) : k);
+
+    ReadRows<algorithmFpType, cpu> coarseCentroidsRows(coarseCentroidsTable, 0, nLists);
+    DAAL_CHECK_BLOCK_STATUS(coarseCentroidsRows);
+    ReadRows<algorithmFpType, cpu> codebooksRows(codebooksTable, 0, nCodewords);
+    DAAL_CHECK_BLOCK_STATUS(codebooksRows);
+    ReadRows<int, cpu> listOffsetsRows(listOffsetsTable, 0, nLists + 1);
+    DAAL_CHECK_BLOCK_STATUS(listOffsetsRows);
+    DAAL_CHECK(size_t(listOffsetsRows.get()[nLists]) == nPoints, ErrorModelNotFullInitialized);
+    ReadRows<int, cpu> pointIndicesRows(pointIndicesTable, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(pointIndicesRows);
+    ReadRows<algorithmFpType, cpu> labelsRows(labelsTable, 0, nPoints);
+    DAAL_CHECK_BLOCK_STATUS(labelsRows);
+    const algorithmFpType * const labels = labelsRows.get();
+
+    NumericTable * const dataTable = const_cast<NumericTable *>(impl->getData().get());
+    DAAL_CHECK(!doRerank || dataTable, ErrorModelNotFullInitialized);
+
+    const Search search(coarseCentroidsRows.get(), nLists, codebooksRows.get(), nCodewords, codesTable->getArray(), listOffsetsRows.get(),
+                        pointIndicesRows.get(), dim, nSubquantizers, dataTable);
+
+    services::Status status;
+    daal::tls<Local *> localTLS([=, &search, &status]() -> Local * {
+        Local * const ptr = new Local();
+        if (!ptr || !search.init(*ptr, k, nProbes, nCandidates))
+        {
+            status.add(services::ErrorMemoryAllocationFailed);
+            delete ptr;
+            return nullptr;
+        }
+        return ptr;
+    });
+
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t blockCount   = (nQueries + queryBlockSize - 1) / queryBlockSize;
+    SafeStatus safeStat;
+    daal::threader_for(blockCount, blockCount, [&](int iBlock) {
+        Local * const local = localTLS.local();
+        DAAL_CHECK_THR(local, ErrorMemoryAllocationFailed);
+
+        const size_t first = iBlock * queryBlockSize;
+        const size_t last  = (first + queryBlockSize < nQueries ? first + queryBlockSize : nQueries);
+
+        ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const dx = xRows.get();
+        algorithmFpType * const dy       = yRows.get();
+
+        for (size_t i = 0; i < last - first; i++)
+        {
+            const algorithmFpType * const query = dx + i * xColumnCount;
+            search.search(query, *local);
+
+            NearestNeighbors<algorithmFpType, cpu> * neighbors = &local->candidates;
+            if (doRerank)
+            {
+                DAAL_CHECK_STATUS_THR(search.rerank(query, *local));
+                neighbors = &local->neighbors;
+            }
+            dy[i * y->getNumberOfColumns()] = vote<algorithmFpType, cpu>(neighbors->get(), neighbors->size(), labels, local->classes.get());
+        }
+    });
+
+    localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_SAFE_STATUS();
+    return status;
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace ivfpq_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,384 @@
+/* file: ivfpq_knn_classification_train_dense_default_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the training of the IVF-PQ based k-Nearest Neighbors: the k-means clustering and the encoding.
+//--
+*/
+
+#ifndef __IVFPQ_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+#define __IVFPQ_KNN_CLASSIFICATION_TRAIN_DENSE_DEFAULT_IMPL_I__
+
+#include "services/daal_defines.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_sort.h"
+#include "externals/service_memory.h"
+#include "externals/service_math.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/daal_strings.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_classification_model_impl.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_classification_train_kernel.h"
+#include "algorithms/kernel/k_nearest_neighbors/ivfpq_knn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ivfpq_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::services::internal;
+using namespace daal::internal;
+using namespace ivfpq_knn_classification::internal;
+
+/* Number of observations processed by one task */
+const size_t rowsPerBlock = 256;
+
+/* Number of the training observations per centroid used by the k-means clustering */
+const size_t samplesPerCentroid = 64;
+
+/* Lloyd's k-means clustering of the first dim values of the rows that are stride values apart. The centroids are stored
+   with the same stride and are initialized with evenly spaced rows; the centroid of a cluster that becomes empty is kept */
+template <typename algorithmFpType, CpuType cpu>
+class KMeans
+{
+public:
+    struct Local
+    {
+        DAAL_NEW_DELETE();
+        TArray<algorithmFpType, cpu> sums;
+        TArray<size_t, cpu> counts;
+
+        bool init(size_t nClusters, size_t dim)
+        {
+            if (!sums.reset(nClusters * dim) || !counts.reset(nClusters)) return false;
+            service_memset<algorithmFpType, cpu>(sums.get(), algorithmFpType(0), nClusters * dim);
+            service_memset<size_t, cpu>(counts.get(), 0, nClusters);
+            return true;
+        }
+    };
+
+    static services::Status compute(const algorithmFpType * data, size_t nRows, size_t dim, size_t stride, size_t nClusters,
+                                    size_t nIterations, algorithmFpType * centroids)
+    {
+        for (size_t c = 0; c < nClusters; c++)
+        {
+            const algorithmFpType * const row = data + (c * nRows / nClusters) * stride;
+            for (size_t j = 0; j < dim; j++)
+            {
+                centroids[c * stride + j] = row[j];
+            }
+        }
+
+        services::Status status;
+        Local total;
+        DAAL_CHECK_MALLOC(total.init(nClusters, dim));
+        algorithmFpType * const sums = total.sums.get();
+        size_t * const counts        = total.counts.get();
+
+        const size_t nBlocks = (nRows + rowsPerBlock - 1) / rowsPerBlock;
+        for (size_t iteration = 0; iteration < nIterations; iteration++)
+        {
+            daal::tls<Local *> localTLS([=, &status]() -> Local * {
+                Local * const ptr = new Local();
+                if (!ptr || !ptr->init(nClusters, dim))
+                {
+                    status.add(services::ErrorMemoryAllocationFailed);
+                    delete ptr;
+                    return nullptr;
+                }
+                return ptr;
+            });
+
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                Local * const local = localTLS.local();
+                if (!local) return;
+
+                const size_t first = iBlock * rowsPerBlock;
+                const size_t last  = (first + rowsPerBlock < nRows ? first + rowsPerBlock : nRows);
+                for (size_t i = first; i < last; i++)
+                {
+                    const algorithmFpType * const row = data + i * stride;
+                    algorithmFpType distance;
+                    const size_t c                   = nearestCentroid<algorithmFpType, cpu>(row, centroids, nClusters, dim, stride, distance);
+                    algorithmFpType * const localSum = local->sums.get() + c * dim;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < dim; j++)
+                    {
+                        localSum[j] += row[j];
+                    }
+                    local->counts[c]++;
+                }
+            });
+
+            service_memset<algorithmFpType, cpu>(sums, algorithmFpType(0), nClusters * dim);
+            service_memset<size_t, cpu>(counts, 0, nClusters);
+            localTLS.reduce([=](Local * ptr) -> void {
+                if (!ptr) return;
+                for (size_t i = 0; i < nClusters * dim; i++)
+                {
+                    sums[i] += ptr->sums[i];
+                }
+                for (size_t c = 0; c < nClusters; c++)
+                {
+                    counts[c] += ptr->counts[c];
+                }
+                delete ptr;
+            });
+            DAAL_CHECK_STATUS_VAR(status);
+
+            for (size_t c = 0; c < nClusters; c++)
+            {
+                if (!counts[c]) continue;
+                const algorithmFpType inverse = algorithmFpType(1) / algorithmFpType(counts[c]);
+                for (size_t j = 0; j < dim; j++)
+                {
+                    centroids[c * stride + j] = sums[c * dim + j] * inverse;
+                }
+            }
+        }
+        return status;
+    }
+};
+
+/* Returns the list that keeps the given position, the empty lists are skipped */
+inline size_t findList(const int * listOffsets, size_t nLists, size_t position)
+{
+    size_t first = 0;
+    size_t last  = nLists;
+    while (last - first > 1)
+    {
+        const size_t middle = (first + last) / 2;
+        if (size_t(listOffsets[middle]) <= position)
+        {
+            first = middle;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+template <typename algorithmFpType, CpuType cpu>
+services::Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::compute(
+    NumericTable * x, NumericTable * y, ivfpq_knn_classification::Model * r, const ivfpq_knn_classification::Parameter & par)
+{
+    typedef KMeans<algorithmFpType, cpu> Clustering;
+
+    services::Status status;
+    const size_t nRows = x->getNumberOfRows();
+    const size_t dim   = x->getNumberOfColumns();
+    DAAL_CHECK(nRows <= (size_t)MaxVal<int>::get(), ErrorIncorrectNumberOfObservations);
+    DAAL_CHECK_EX(par.nLists <= nRows, ErrorIncorrectParameter, ParameterName, nListsStr());
+    DAAL_CHECK_EX(par.nSubquantizers <= dim, ErrorIncorrectParameter, ParameterName, nSubquantizersStr());
+
+    const size_t nLists         = par.nLists;
+    const size_t nSubquantizers = par.nSubquantizers;
+    const size_t nIterations    = par.nIterations;
+    const size_t nClustersMax   = (nLists > maxCodewords ? nLists : maxCodewords);
+    const size_t nSamples       = (samplesPerCentroid * nClustersMax < nRows ? samplesPerCentroid * nClustersMax : nRows);
+    const size_t nCodewords     = (maxCodewords < nSamples ? maxCodewords : nSamples);
+
+    /* The centroids and the codewords are trained on the evenly spaced observations */
+    TArray<algorithmFpType, cpu> samples(nSamples * dim);
+    DAAL_CHECK_MALLOC(samples.get());
+    const size_t nSampleBlocks = (nSamples + rowsPerBlock - 1) / rowsPerBlock;
+    SafeStatus safeStat;
+    daal::threader_for(nSampleBlocks, nSampleBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = (first + rowsPerBlock < nSamples ? first + rowsPerBlock : nSamples);
+        ReadRows<algorithmFpType, cpu> xRows;
+        for (size_t i = first; i < last; i++)
+        {
+            const algorithmFpType * const row = xRows.set(x, i * nRows / nSamples, 1);
+            DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+            for (size_t j = 0; j < dim; j++)
+            {
+                samples[i * dim + j] = row[j];
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    NumericTablePtr coarseCentroidsTable = HomogenNumericTable<algorithmFpType>::create(dim, nLists, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> coarseCentroidsRows(coarseCentroidsTable.get(), 0, nLists);
+    DAAL_CHECK_BLOCK_STATUS(coarseCentroidsRows);
+    algorithmFpType * const coarseCentroids = coarseCentroidsRows.get();
+    DAAL_CHECK_STATUS(status, Clustering::compute(samples.get(), nSamples, dim, dim, nLists, nIterations, coarseCentroids));
+
+    /* The subquantizers encode the residuals of the observations to the centroids of their lists */
+    daal::threader_for(nSampleBlocks, nSampleBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = (first + rowsPerBlock < nSamples ? first + rowsPerBlock : nSamples);
+        for (size_t i = first; i < last; i++)
+        {
+            algorithmFpType * const row = samples.get() + i * dim;
+            algorithmFpType distance;
+            const algorithmFpType * const centroid =
+                coarseCentroids + nearestCentroid<algorithmFpType, cpu>(row, coarseCentroids, nLists, dim, dim, distance) * dim;
+            for (size_t j = 0; j < dim; j++)
+            {
+                row[j] -= centroid[j];
+            }
+        }
+    });
+
+    NumericTablePtr codebooksTable = HomogenNumericTable<algorithmFpType>::create(dim, nCodewords, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> codebooksRows(codebooksTable.get(), 0, nCodewords);
+    DAAL_CHECK_BLOCK_STATUS(codebooksRows);
+    algorithmFpType * const codebooks = codebooksRows.get();
+    for (size_t j = 0; j < nSubquantizers; j++)
+    {
+        const size_t begin = subquantizerBegin(j, dim, nSubquantizers);
+        const size_t end   = subquantizerBegin(j + 1, dim, nSubquantizers);
+        DAAL_CHECK_STATUS(status, Clustering::compute(samples.get() + begin, nSamples, end - begin, dim, nCodewords, nIterations, codebooks + begin));
+    }
+    samples.reset(0);
+
+    /* The observations are assigned to the lists first, so the codes are written directly in the order of the lists */
+    TArray<int, cpu> lists(nRows);
+    DAAL_CHECK_MALLOC(lists.get());
+    const size_t nBlocks = (nRows + rowsPerBlock - 1) / rowsPerBlock;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = (first + rowsPerBlock < nRows ? first + rowsPerBlock : nRows);
+        ReadRows<algorithmFpType, cpu> xRows(x, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        const algorithmFpType * const data = xRows.get();
+        for (size_t i = first; i < last; i++)
+        {
+            algorithmFpType distance;
+            lists[i] = (int)nearestCentroid<algorithmFpType, cpu>(data + (i - first) * dim, coarseCentroids, nLists, dim, dim, distance);
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    NumericTablePtr listOffsetsTable = HomogenNumericTable<int>::create(1, nLists + 1, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<int, cpu> listOffsetsRows(listOffsetsTable.get(), 0, nLists + 1);
+    DAAL_CHECK_BLOCK_STATUS(listOffsetsRows);
+    int * const listOffsets = listOffsetsRows.get();
+    service_memset<int, cpu>(listOffsets, 0, nLists + 1);
+    for (size_t i = 0; i < nRows; i++)
+    {
+        listOffsets[lists[i] + 1]++;
+    }
+    for (size_t c = 0; c < nLists; c++)
+    {
+        listOffsets[c + 1] += listOffsets[c];
+    }
+
+    /* The list of every observation is replaced with its position in the order of the lists */
+    TArray<int, cpu> cursors(nLists);
+    DAAL_CHECK_MALLOC(cursors.get());
+    for (size_t c = 0; c < nLists; c++)
+    {
+        cursors[c] = listOffsets[c];
+    }
+    int * const positions = lists.get();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        const int list = positions[i];
+        positions[i]   = cursors[list]++;
+    }
+
+    services::SharedPtr<HomogenNumericTable<byte> > codesTable =
+        HomogenNumericTable<byte>::create(nSubquantizers, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    byte * const codes = codesTable->getArray();
+
+    NumericTablePtr pointIndicesTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<int, cpu> pointIndicesRows(pointIndicesTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(pointIndicesRows);
+    int * const pointIndices = pointIndicesRows.get();
+
+    NumericTablePtr pointLabelsTable = HomogenNumericTable<algorithmFpType>::create(1, nRows, NumericTable::doAllocate, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    WriteOnlyRows<algorithmFpType, cpu> pointLabelsRows(pointLabelsTable.get(), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(pointLabelsRows);
+    algorithmFpType * const pointLabels = pointLabelsRows.get();
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = (first + rowsPerBlock < nRows ? first + rowsPerBlock : nRows);
+        ReadRows<algorithmFpType, cpu> xRows(x, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(xRows);
+        ReadRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const data   = xRows.get();
+        const algorithmFpType * const labels = yRows.get();
+        TArray<algorithmFpType, cpu> residual(dim);
+        DAAL_CHECK_THR(residual.get(), ErrorMemoryAllocationFailed);
+
+        for (size_t i = first; i < last; i++)
+        {
+            const size_t position                  = positions[i];
+            const size_t list                      = findList(listOffsets, nLists, position);
+            const algorithmFpType * const row      = data + (i - first) * dim;
+            const algorithmFpType * const centroid = coarseCentroids + list * dim;
+            for (size_t j = 0; j < dim; j++)
+            {
+                residual[j] = row[j] - centroid[j];
+            }
+
+            byte * const code = codes + position * nSubquantizers;
+            for (size_t j = 0; j < nSubquantizers; j++)
+            {
+                const size_t begin = subquantizerBegin(j, dim, nSubquantizers);
+                const size_t end   = subquantizerBegin(j + 1, dim, nSubquantizers);
+                algorithmFpType distance;
+                code[j] =
+                    (byte)nearestCentroid<algorithmFpType, cpu>(residual.get() + begin, codebooks + begin, nCodewords, end - begin, dim, distance);
+            }
+            pointIndices[position] = (int)i;
+            pointLabels[position]  = labels[i - first];
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    Model::ModelImpl * const impl = r->impl();
+    impl->setCoarseCentroids(coarseCentroidsTable);
+    impl->setCodebooks(codebooksTable);
+    impl->setCodes(codesTable);
+    impl->setListOffsets(listOffsetsTable);
+    impl->setPointIndices(pointIndicesTable);
+    impl->setPointLabels(pointLabelsTable);
+    impl->setNumberOfSubquantizers(nSubquantizers);
+    return status;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace ivfpq_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -66,7 +66,8 @@ services::Status Model::serializeImpl(data_management::InputDataArchive * arch)
 services::Status Model::deserializeImpl(const data_management::OutputDataArchive * arch)
 {
     daal::algorithms::classifier::Model::serialImpl<const data_management::OutputDataArchive, true>(arch);
-    _impl->serialImpl<const data_management::OutputDataArchive, true>(arch);
+    _impl->serialImpl<const data_management::OutputDataArchive, true>(
+        arch, COMPUTE_DAAL_VERSION(arch->getMajorVersion(), arch->getMinorVersion(), arch->getUpdateVersion()));
 
     return services::Status();
 }
@@ -76,6 +77,154 @@ size_t Model::getNumberOfFeatures() const
     return _impl->getNumberOfFeatures();
 }
 
+services::Status Model::addObservations(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels)
+{
+    return _impl->addObservations(data, labels);
+}
+
+services::Status Model::removeObservations(const data_management::NumericTablePtr & ids)
+{
+    return _impl->removeObservations(ids);
+}
+
+size_t Model::getNumberOfObservations() const
+{
+    return _impl->getNumberOfObservations();
+}
+
+size_t Model::getNumberOfRemovedObservations() const
+{
+    return _impl->getNumberOfRemovedObservations();
+}
+
+namespace
+{
+/* Appends the rows to the homogeneous table, or the zero rows if the values are not given. The memory of the table
+   grows geometrically, so a series of small additions takes linear time */
+template <typename T>
+services::Status appendRows(NumericTablePtr & table, size_t & capacity, size_t nColumns, const T * values, size_t nNewRows)
+{
+    HomogenNumericTable<T> * const homogen = dynamic_cast<HomogenNumericTable<T> *>(table.get());
+    DAAL_CHECK(!table || homogen, ErrorIncorrectTypeOfNumericTable);
+
+    const size_t nRows           = (table ? table->getNumberOfRows() : 0);
+    services::SharedPtr<T> array = (homogen ? homogen->getArraySharedPtr() : services::SharedPtr<T>());
+    if (!array || nRows + nNewRows > capacity)
+    {
+        const size_t newCapacity = (2 * capacity > nRows + nNewRows ? 2 * capacity : nRows + nNewRows);
+        services::SharedPtr<T> newArray((T *)services::daal_malloc(newCapacity * nColumns * sizeof(T)), services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(newArray.get());
+        if (nRows)
+        {
+            DAAL_CHECK(!services::internal::daal_memcpy_s(newArray.get(), nRows * nColumns * sizeof(T), array.get(), nRows * nColumns * sizeof(T)),
+                       ErrorMemoryCopyFailedInternal);
+        }
+        array    = newArray;
+        capacity = newCapacity;
+    }
+
+    T * const dst = array.get() + nRows * nColumns;
+    for (size_t i = 0; i < nNewRows * nColumns; i++)
+    {
+        dst[i] = (values ? values[i] : T(0));
+    }
+
+    services::Status st;
+    if (homogen)
+    {
+        st |= homogen->setArray(array, nRows + nNewRows);
+    }
+    else
+    {
+        table = HomogenNumericTable<T>::create(array, nColumns, nRows + nNewRows, &st);
+    }
+    return st;
+}
+
+template <typename T>
+services::Status appendObservations(NumericTablePtr & dataTable, NumericTablePtr & labelsTable, size_t & capacity, NumericTable & data,
+                                    NumericTable & labels)
+{
+    const size_t nRows = data.getNumberOfRows();
+    BlockDescriptor<T> dataBD, labelsBD;
+    services::Status st = data.getBlockOfRows(0, nRows, readOnly, dataBD);
+    if (st) st = labels.getBlockOfRows(0, nRows, readOnly, labelsBD);
+
+    /* Both tables share the capacity, the capacity is updated after the second table grows */
+    size_t dataCapacity = capacity;
+    if (st) st = appendRows<T>(dataTable, dataCapacity, data.getNumberOfColumns(), dataBD.getBlockPtr(), nRows);
+    if (st) st = appendRows<T>(labelsTable, capacity, 1, labelsBD.getBlockPtr(), nRows);
+
+    data.releaseBlockOfRows(dataBD);
+    labels.releaseBlockOfRows(labelsBD);
+    return st;
+}
+} // namespace
+
+services::Status Model::ModelImpl::addObservations(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels)
+{
+    DAAL_CHECK(_data && _kdTreeTable, ErrorModelNotFullInitialized);
+    services::Status st;
+    DAAL_CHECK_STATUS(st, checkNumericTable(data.get(), dataStr(), 0, 0, _nFeatures));
+    DAAL_CHECK_STATUS(st, checkNumericTable(labels.get(), labelsStr(), 0, 0, 1, data->getNumberOfRows()));
+
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nOld  = getNumberOfObservations();
+
+    /* The added observations are stored in single precision if the training observations are */
+    const NumericTableDictionaryPtr dictionary = _data->getDictionarySharedPtr();
+    const bool isFloat = (dictionary && dictionary->getNumberOfFeatures() && dictionary->getFeature(0).indexType == features::DAAL_FLOAT32);
+    DAAL_CHECK_STATUS(st, isFloat ? appendObservations<float>(_insertedData, _insertedLabels, _insertedCapacity, *data, *labels) :
+                                    appendObservations<double>(_insertedData, _insertedLabels, _insertedCapacity, *data, *labels));
+
+    if (_removedFlags && _removedFlags->getNumberOfRows() == nOld)
+    {
+        st |= appendRows<int>(_removedFlags, _removedCapacity, 1, nullptr, nRows);
+    }
+    return st;
+}
+
+services::Status Model::ModelImpl::removeObservations(const data_management::NumericTablePtr & ids)
+{
+    DAAL_CHECK(_data && _kdTreeTable, ErrorModelNotFullInitialized);
+    services::Status st;
+    DAAL_CHECK_STATUS(st, checkNumericTable(ids.get(), idsStr(), 0, 0, 1));
+
+    /* The positions of the observations in the tree are absent in the models read from the archives written before 2021.1.7 */
+    DAAL_CHECK(_positions, ErrorMethodNotSupported);
+
+    const size_t nBase  = _data->getNumberOfRows();
+    const size_t nTotal = getNumberOfObservations();
+    HomogenNumericTable<DAAL_UINT64> * const positionsTable = dynamic_cast<HomogenNumericTable<DAAL_UINT64> *>(_positions.get());
+    DAAL_CHECK(positionsTable && positionsTable->getNumberOfRows() == nBase, ErrorModelNotFullInitialized);
+    const DAAL_UINT64 * const positions = positionsTable->getArray();
+
+    if (!_removedFlags)
+    {
+        DAAL_CHECK_STATUS(st, appendRows<int>(_removedFlags, _removedCapacity, 1, nullptr, nTotal));
+    }
+    int * const flags = static_cast<HomogenNumericTable<int> *>(_removedFlags.get())->getArray();
+
+    const size_t nIds = ids->getNumberOfRows();
+    BlockDescriptor<double> idsBD;
+    DAAL_CHECK_STATUS(st, ids->getBlockOfColumnValues(0, 0, nIds, readOnly, idsBD));
+    const double * const values = idsBD.getBlockPtr();
+    for (size_t i = 0; i < nIds; i++)
+    {
+        if (!(values[i] >= 0 && values[i] < double(nTotal)))
+        {
+            st.add(ErrorIncorrectIndex);
+            break;
+        }
+        const size_t id       = (size_t)values[i];
+        const size_t position = (id < nBase ? (size_t)positions[id] : id);
+        _nRemoved += !flags[position];
+        flags[position] = 1;
+    }
+    ids->releaseBlockOfColumnValues(idsBD);
+    return st;
+}
+
 } // namespace interface1
 
 namespace interface2
@@ -25,6 +25,7 @@
 #define __KDTREE_KNN_CLASSIFICATION_MODEL_IMPL_
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
+#include "service/kernel/service_defines.h"
 
 namespace daal
 {
@@ -64,7 +65,17 @@ public:
     /**
      * Empty constructor for deserialization
      */
-    ModelImpl(size_t nFeatures = 0) : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _nFeatures(nFeatures) {}
+    ModelImpl(size_t nFeatures = 0)
+        : _kdTreeTable(),
+          _rootNodeIndex(0),
+          _lastNodeIndex(0),
+          _data(),
+          _labels(),
+          _nFeatures(nFeatures),
+          _nRemoved(0),
+          _insertedCapacity(0),
+          _removedCapacity(0)
+    {}
 
     /**
      * Returns the KD-tree table
@@ -121,7 +132,7 @@ public:
     data_management::NumericTablePtr getData() { return _data; }
 
     template <typename Archive, bool onDeserialize>
-    services::Status serialImpl(Archive * arch)
+    services::Status serialImpl(Archive * arch, int daalVersion = INTEL_DAAL_VERSION)
     {
         arch->set(_nFeatures);
         arch->set(_rootNodeIndex);
@@ -130,6 +141,30 @@ public:
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
 
+        /* The observations added and removed after the training are kept in the archives since 2021.1.7,
+           the models read from the earlier archives do not support the removal of the observations */
+        if (daalVersion >= COMPUTE_DAAL_VERSION(2021, 1, 7))
+        {
+            arch->setSharedPtrObj(_positions);
+            arch->setSharedPtrObj(_insertedData);
+            arch->setSharedPtrObj(_insertedLabels);
+            arch->setSharedPtrObj(_removedFlags);
+            arch->set(_nRemoved);
+        }
+        else if (onDeserialize)
+        {
+            _positions.reset();
+            _insertedData.reset();
+            _insertedLabels.reset();
+            _removedFlags.reset();
+            _nRemoved = 0;
+        }
+
+        if (onDeserialize)
+        {
+            _insertedCapacity = 0;
+            _removedCapacity  = 0;
+        }
         return services::Status();
     }
 
@@ -222,6 +257,50 @@ public:
      */
     size_t getNumberOfFeatures() const { return _nFeatures; }
 
+    /**
+     * Sets the positions of the training observations in the tree order
+     * \param[in]  value  Table with the position of each training observation, indexed by its row in the training data
+     */
+    void setPositions(const data_management::NumericTablePtr & value) { _positions = value; }
+
+    /**
+     * Returns the observations added to the model after the training
+     * \return Table of the added observations, empty if there are none
+     */
+    data_management::NumericTableConstPtr getInsertedData() const { return _insertedData; }
+
+    /**
+     * Returns the labels of the observations added to the model after the training
+     * \return Table of the labels of the added observations, empty if there are none
+     */
+    data_management::NumericTableConstPtr getInsertedLabels() const { return _insertedLabels; }
+
+    /**
+     * Returns the flags of the removed observations. The flags of the training observations in the tree order
+     * are followed by the flags of the added observations
+     * \return Table of the flags of the removed observations, empty if there are none
+     */
+    data_management::NumericTableConstPtr getRemovedFlags() const { return _removedFlags; }
+
+    /**
+     * Returns the number of the training and the added observations including the removed ones
+     * \return Number of the observations
+     */
+    size_t getNumberOfObservations() const
+    {
+        return (_data ? _data->getNumberOfRows() : 0) + (_insertedData ? _insertedData->getNumberOfRows() : 0);
+    }
+
+    /**
+     * Returns the number of the removed observations
+     * \return Number of the removed observations
+     */
+    size_t getNumberOfRemovedObservations() const { return _nRemoved; }
+
+    services::Status addObservations(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels);
+
+    services::Status removeObservations(const data_management::NumericTablePtr & ids);
+
 private:
     size_t _nFeatures;
     KDTreeTablePtr _kdTreeTable;
@@ -229,6 +308,16 @@ private:
     size_t _lastNodeIndex;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+
+    /* The observations added after the training are not put into the tree, the prediction scans them by the brute force.
+       The removed observations stay in place and are skipped by the prediction until the model is trained again */
+    data_management::NumericTablePtr _positions;
+    data_management::NumericTablePtr _insertedData;
+    data_management::NumericTablePtr _insertedLabels;
+    data_management::NumericTablePtr _removedFlags;
+    size_t _nRemoved;
+    size_t _insertedCapacity;
+    size_t _removedCapacity;
 };
 
 } // namespace interface1
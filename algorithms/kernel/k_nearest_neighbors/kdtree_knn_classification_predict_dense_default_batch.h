@@ -55,6 +55,20 @@ template <typename T, CpuType cpu>
 class Heap;
 template <typename algorithmFpType>
 struct SearchNode;
+template <typename algorithmFpType, CpuType cpu>
+class SearchContext;
+
+/* Changes of the model made after the training: the flags of the removed observations in the tree order followed by
+   the flags of the added observations, and the added observations with their labels */
+template <typename algorithmFpType>
+struct ModelUpdates
+{
+    const int * removed;
+    const algorithmFpType * insertedData;
+    const algorithmFpType * insertedLabels;
+    size_t nInserted;
+    size_t nTrained;
+};
 
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
@@ -64,15 +78,49 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
+    KNNClassificationPredictKernel();
+
+    ~KNNClassificationPredictKernel();
+
     services::Status compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
 
+    /* Finds the nearest neighbors of the queries in the local model without voting, the first step of the distributed processing mode */
+    services::Status computeNeighbors(const NumericTable * x, const classifier::Model * m, NumericTable * distances, NumericTable * labels,
+                                      const daal::algorithms::Parameter * par);
+
 protected:
+    services::Status searchQueries(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * distances,
+                                   NumericTable * labels, const daal::algorithms::Parameter * par);
+
+    void storeNeighbors(const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels,
+                        const ModelUpdates<algorithmFpType> & updates, size_t k, algorithmFpType * neighborDistances,
+                        algorithmFpType * neighborLabels);
+
     void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                               kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data);
+                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const int * removed);
+
+    void scanInsertedObservations(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k,
+                                  const ModelUpdates<algorithmFpType> & updates, size_t nFeatures);
 
     services::Status predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
-                             const NumericTable & labels, size_t k);
+                             const NumericTable & labels, const ModelUpdates<algorithmFpType> & updates, size_t k, algorithmFpType * classes);
+
+private:
+    /* Search buffers of the threads, they live as long as the kernel so that the repeated calls on small batches do not reallocate them */
+    SearchContext<algorithmFpType, cpu> * _context;
+};
+
+/* Merges the nearest neighbors found on the local nodes and votes over the merged neighbors */
+template <typename algorithmFpType, prediction::Method method, CpuType cpu>
+class KNNClassificationPredictDistrStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    services::Status compute(size_t nPartials, const NumericTable * const * partialDistances, const NumericTable * const * partialLabels,
+                             NumericTable * distances, NumericTable * labels, const daal::algorithms::Parameter * par);
+
+    services::Status finalizeCompute(const NumericTable * distances, const NumericTable * labels, NumericTable * y,
+                                     const daal::algorithms::Parameter * par);
 };
 
 } // namespace internal
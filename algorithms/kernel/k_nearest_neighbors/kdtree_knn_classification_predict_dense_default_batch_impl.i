@@ -30,9 +30,11 @@
 #include "services/daal_atomic_int.h"
 #include "externals/service_memory.h"
 #include "service/kernel/service_data_utils.h"
+#include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_math.h"
 #include "externals/service_rng.h"
 #include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_kernel_math.h"
 #include "data_management/data/numeric_table.h"
 #include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h"
 #include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_model_impl.h"
@@ -213,15 +215,97 @@ struct SearchNode
     algorithmFpType minDistance;
 };
 
+/* Search buffers of one thread, they grow on demand and are reused by the subsequent calls of the kernel */
+template <typename algorithmFpType, CpuType cpu>
+struct SearchLocal
+{
+    DAAL_NEW_DELETE();
+
+    SearchLocal() : heapCapacity(0), stackCapacity(0) {}
+
+    bool reserve(size_t heapSize, size_t stackSize)
+    {
+        if (heapCapacity < heapSize)
+        {
+            heap.clear();
+            heapCapacity = 0;
+            if (!heap.init(heapSize) || !classes.reset(heapSize)) return false;
+            heapCapacity = heapSize;
+        }
+        /* The stack grows itself during the search, it is allocated once */
+        if (!stackCapacity)
+        {
+            if (!stack.init(stackSize)) return false;
+            stackCapacity = stackSize;
+        }
+        return true;
+    }
+
+    Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> heap;
+    kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> stack;
+    TArray<algorithmFpType, cpu> classes;
+    size_t heapCapacity;
+    size_t stackCapacity;
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class SearchContext
+{
+public:
+    typedef SearchLocal<algorithmFpType, cpu> Local;
+
+    DAAL_NEW_DELETE();
+
+    SearchContext() : _localTLS([]() -> Local * { return new Local(); }) {}
+
+    ~SearchContext()
+    {
+        _localTLS.reduce([](Local * ptr) -> void { delete ptr; });
+    }
+
+    Local * local() { return _localTLS.local(); }
+
+private:
+    daal::tls<Local *> _localTLS;
+};
+
+/* Batches of up to this number of rows are processed in the calling thread without the parallel dispatch */
+const size_t serialRowCount = 16;
+
+template <typename algorithmFpType, CpuType cpu>
+KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::KNNClassificationPredictKernel() : _context(nullptr)
+{}
+
+template <typename algorithmFpType, CpuType cpu>
+KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::~KNNClassificationPredictKernel()
+{
+    delete _context;
+    _context = nullptr;
+}
+
 template <typename algorithmFpType, CpuType cpu>
 Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(const NumericTable * x, const classifier::Model * m,
                                                                                    NumericTable * y, const daal::algorithms::Parameter * par)
 {
-    Status status;
+    return searchQueries(x, m, y, nullptr, nullptr, par);
+}
+
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::computeNeighbors(const NumericTable * x, const classifier::Model * m,
+                                                                                            NumericTable * distances, NumericTable * labels,
+                                                                                            const daal::algorithms::Parameter * par)
+{
+    return searchQueries(x, m, nullptr, distances, labels, par);
+}
 
-    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
-    typedef Heap<Neighbors, cpu> MaxHeap;
-    typedef kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> SearchStack;
+/* Processes the queries by blocks of rows, either votes into y or stores the sorted neighbors into distances and labels */
+template <typename algorithmFpType, CpuType cpu>
+Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::searchQueries(const NumericTable * x, const classifier::Model * m,
+                                                                                         NumericTable * y, NumericTable * distances,
+                                                                                         NumericTable * neighborLabels,
+                                                                                         const daal::algorithms::Parameter * par)
+{
+    typedef SearchLocal<algorithmFpType, cpu> Local;
     typedef daal::services::internal::MaxVal<algorithmFpType> MaxVal;
     typedef daal::internal::Math<algorithmFpType, cpu> Math;
 
@@ -242,6 +326,28 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const NumericTable & data    = *(model->impl()->getData());
     const NumericTable & labels  = *(model->impl()->getLabels());
 
+    /* The observations added after the training are read once, the removed observations are skipped by the search */
+    NumericTable * const removedTable        = const_cast<NumericTable *>(model->impl()->getRemovedFlags().get());
+    NumericTable * const insertedTable       = const_cast<NumericTable *>(model->impl()->getInsertedData().get());
+    NumericTable * const insertedLabelsTable = const_cast<NumericTable *>(model->impl()->getInsertedLabels().get());
+    const size_t nInserted                   = (insertedTable ? insertedTable->getNumberOfRows() : 0);
+
+    ReadRows<int, cpu> removedRows;
+    ReadRows<algorithmFpType, cpu> insertedRows, insertedLabelsRows;
+    ModelUpdates<algorithmFpType> updates = { nullptr, nullptr, nullptr, nInserted, data.getNumberOfRows() };
+    if (removedTable && model->impl()->getNumberOfRemovedObservations())
+    {
+        updates.removed = removedRows.set(removedTable, 0, removedTable->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(removedRows);
+    }
+    if (nInserted)
+    {
+        updates.insertedData = insertedRows.set(insertedTable, 0, nInserted);
+        DAAL_CHECK_BLOCK_STATUS(insertedRows);
+        updates.insertedLabels = insertedLabelsRows.set(insertedLabelsTable, 0, nInserted);
+        DAAL_CHECK_BLOCK_STATUS(insertedLabelsRows);
+    }
+
     size_t iSize = 1;
     while (iSize < k)
     {
@@ -253,87 +359,84 @@ Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compu
     const algorithmFpType base    = 2.0;
     const size_t expectedMaxDepth = (Math::sLog(xRowCount) / Math::sLog(base) + 1) * __KDTREE_DEPTH_MULTIPLICATION_FACTOR;
     const size_t stackSize        = Math::sPowx(base, Math::sCeil(Math::sLog(expectedMaxDepth) / Math::sLog(base)));
-    struct Local
-    {
-        MaxHeap heap;
-        SearchStack stack;
-    };
-    daal::tls<Local *> localTLS([=, &status]() -> Local * {
-        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
-        if (ptr)
-        {
-            if (!ptr->heap.init(heapSize))
-            {
-                status.add(services::ErrorMemoryAllocationFailed);
-                service_scalable_free<Local, cpu>(ptr);
-                return nullptr;
-            }
-            if (!ptr->stack.init(stackSize))
-            {
-                status.add(services::ErrorMemoryAllocationFailed);
-                ptr->heap.clear();
-                service_scalable_free<Local, cpu>(ptr);
-                return nullptr;
-            }
-        }
-        else
-        {
-            status.add(services::ErrorMemoryAllocationFailed);
-        }
-        return ptr;
-    });
 
-    DAAL_CHECK_STATUS_OK((status.ok()), status);
+    if (!_context)
+    {
+        _context = new SearchContext<algorithmFpType, cpu>();
+        DAAL_CHECK_MALLOC(_context)
+    }
+    SearchContext<algorithmFpType, cpu> & context = *_context;
 
     const auto maxThreads     = threader_get_threads_number();
     const size_t xColumnCount = x->getNumberOfColumns();
-    const size_t yColumnCount = y->getNumberOfColumns();
-    const auto rowsPerBlock   = (xRowCount + maxThreads - 1) / maxThreads;
+    const size_t yColumnCount = y ? y->getNumberOfColumns() : 0;
+    const auto rowsPerBlock   = (xRowCount <= serialRowCount ? xRowCount : (xRowCount + maxThreads - 1) / maxThreads);
     const auto blockCount     = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
+    if (!blockCount) return Status();
     SafeStatus safeStat;
-    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &data, &labels, &rowsPerBlock, &k, &safeStat](int iBlock) {
-        Local * const local = localTLS.local();
-        if (local)
+    auto processBlock = [=, &context, &kdTreeTable, &data, &labels, &updates, &rowsPerBlock, &k, &safeStat](int iBlock) {
+        Local * const local = context.local();
+        DAAL_CHECK_THR(local && local->reserve(heapSize, stackSize), services::ErrorMemoryAllocationFailed);
+
+        const size_t first = iBlock * rowsPerBlock;
+        const size_t last  = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
+
+        const algorithmFpType radius = MaxVal::get();
+        data_management::BlockDescriptor<algorithmFpType> xBD;
+        const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
+        const algorithmFpType * const dx = xBD.getBlockPtr();
+        if (y)
         {
-            const size_t first = iBlock * rowsPerBlock;
-            const size_t last  = min<cpu>(static_cast<decltype(xRowCount)>(first + rowsPerBlock), xRowCount);
-
-            const algorithmFpType radius = MaxVal::get();
-            data_management::BlockDescriptor<algorithmFpType> xBD;
-            const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
-            const algorithmFpType * const dx = xBD.getBlockPtr();
             data_management::BlockDescriptor<algorithmFpType> yBD;
             y->getBlockOfRows(first, last - first, writeOnly, yBD);
             auto * const dy = yBD.getBlockPtr();
             for (size_t i = 0; i < last - first; ++i)
             {
-                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data);
-                services::Status s = predict(dy[i * yColumnCount], local->heap, labels, k);
+                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
+                                     updates.removed);
+                scanInsertedObservations(&dx[i * xColumnCount], local->heap, k, updates, xColumnCount);
+                services::Status s = predict(dy[i * yColumnCount], local->heap, labels, updates, k, local->classes.get());
                 DAAL_CHECK_STATUS_THR(s)
             }
             y->releaseBlockOfRows(yBD);
-            const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
         }
-    });
-
-    DAAL_CHECK_SAFE_STATUS()
-
-    localTLS.reduce([=](Local * ptr) -> void {
-        if (ptr)
+        else
         {
-            ptr->stack.clear();
-            ptr->heap.clear();
-            service_scalable_free<Local, cpu>(ptr);
+            data_management::BlockDescriptor<algorithmFpType> dBD, lBD;
+            distances->getBlockOfRows(first, last - first, writeOnly, dBD);
+            neighborLabels->getBlockOfRows(first, last - first, writeOnly, lBD);
+            algorithmFpType * const dd = dBD.getBlockPtr();
+            algorithmFpType * const dl = lBD.getBlockPtr();
+            for (size_t i = 0; i < last - first; ++i)
+            {
+                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data,
+                                     updates.removed);
+                scanInsertedObservations(&dx[i * xColumnCount], local->heap, k, updates, xColumnCount);
+                storeNeighbors(local->heap, labels, updates, k, &dd[i * k], &dl[i * k]);
+            }
+            neighborLabels->releaseBlockOfRows(lBD);
+            distances->releaseBlockOfRows(dBD);
         }
-    });
-    return status;
+        const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
+    };
+
+    if (blockCount == 1)
+    {
+        processBlock(0);
+    }
+    else
+    {
+        daal::threader_for(blockCount, blockCount, processBlock);
+    }
+
+    return safeStat.detach();
 }
 
 template <typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNearestNeighbors(
     const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
     kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-    const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data)
+    const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data, const int * removed)
 {
     heap.reset();
     stack.reset();
@@ -376,10 +479,7 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
                 DAAL_PREFETCH_READ_T0(nx);
                 DAAL_PREFETCH_READ_T0(nx + 16);
 
-                for (i = 0; i < end - start; ++i)
-                {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-                }
+                daal::algorithms::internal::addSquaredDifferences<algorithmFpType, cpu>(query[j - 1], dx, end - start, distance);
 
                 const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
 
@@ -389,16 +489,13 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
             }
             {
                 const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
-                for (i = 0; i < end - start; ++i)
-                {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
-                }
+                daal::algorithms::internal::addSquaredDifferences<algorithmFpType, cpu>(query[j - 1], dx, end - start, distance);
                 const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
             }
 
             for (i = start; i < end; ++i)
             {
-                if (distance[i - start] <= radius)
+                if (distance[i - start] <= radius && !(removed && removed[i]))
                 {
                     curNeighbor.distance = distance[i - start];
                     curNeighbor.index    = i;
@@ -458,9 +555,80 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::findNea
     }
 }
 
+/* The observations added after the training are few, they are compared with the query one by one */
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::scanInsertedObservations(
+    const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k, const ModelUpdates<algorithmFpType> & updates,
+    size_t nFeatures)
+{
+    const int * const removed = (updates.removed ? updates.removed + updates.nTrained : nullptr);
+    for (size_t i = 0; i < updates.nInserted; ++i)
+    {
+        if (removed && removed[i]) continue;
+
+        const algorithmFpType * const row = updates.insertedData + i * nFeatures;
+        algorithmFpType distance          = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            const algorithmFpType diff = row[j] - query[j];
+            distance += diff * diff;
+        }
+
+        GlobalNeighbors<algorithmFpType, cpu> neighbor;
+        neighbor.distance = distance;
+        neighbor.index    = updates.nTrained + i;
+        if (heap.size() < k)
+        {
+            heap.push(neighbor, k);
+        }
+        else if (heap.getMax()->distance > distance)
+        {
+            heap.replaceMax(neighbor);
+        }
+    }
+}
+
+/* Returns the label of the training or the added observation */
+template <typename algorithmFpType>
+DAAL_FORCEINLINE algorithmFpType readLabel(const NumericTable & labels, const ModelUpdates<algorithmFpType> & updates, size_t index)
+{
+    if (index >= updates.nTrained) return updates.insertedLabels[index - updates.nTrained];
+
+    data_management::BlockDescriptor<algorithmFpType> labelBD;
+    const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, index, 1, readOnly, labelBD);
+    const algorithmFpType label = *(labelBD.getBlockPtr());
+    const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelBD);
+    return label;
+}
+
+/* Writes the neighbors in the ascending order of the distances, the positions without a neighbor get the largest distance */
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::storeNeighbors(const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
+                                                                                        const NumericTable & labels,
+                                                                                        const ModelUpdates<algorithmFpType> & updates, size_t k,
+                                                                                        algorithmFpType * neighborDistances,
+                                                                                        algorithmFpType * neighborLabels)
+{
+    const size_t heapSize = heap.size();
+    for (size_t i = 0; i < heapSize; ++i)
+    {
+        neighborDistances[i] = heap[i].distance;
+        neighborLabels[i]    = readLabel(labels, updates, heap[i].index);
+    }
+    daal::algorithms::internal::qSort<algorithmFpType, algorithmFpType, cpu>(heapSize, neighborDistances, neighborLabels);
+    for (size_t i = heapSize; i < k; ++i)
+    {
+        neighborDistances[i] = daal::services::internal::MaxVal<algorithmFpType>::get();
+        neighborLabels[i]    = 0;
+    }
+}
+
 template <typename algorithmFpType, CpuType cpu>
 services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::predict(
-    algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
+    algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels,
+    const ModelUpdates<algorithmFpType> & updates, size_t k, algorithmFpType * classes)
 {
     const size_t heapSize = heap.size();
     if (heapSize < 1) return services::Status();
@@ -471,15 +639,9 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
         size_t weight;
     };
 
-    data_management::BlockDescriptor<algorithmFpType> labelBD;
-    algorithmFpType * classes =
-        static_cast<algorithmFpType *>(daal::services::internal::service_malloc<algorithmFpType, cpu>(heapSize * sizeof(*classes)));
-    DAAL_CHECK_MALLOC(classes)
     for (size_t i = 0; i < heapSize; ++i)
     {
-        const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
-        classes[i] = *(labelBD.getBlockPtr());
-        const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelBD);
+        classes[i] = readLabel(labels, updates, heap[i].index);
     }
     daal::algorithms::internal::qSort<algorithmFpType, cpu>(heapSize, classes);
     algorithmFpType currentClass = classes[0];
@@ -503,8 +665,6 @@ services::Status KNNClassificationPredictKernel<algorithmFpType, defaultDense, c
         }
     }
     predictedClass = winnerClass;
-    daal_free(classes);
-    classes = nullptr;
     return services::Status();
 }
 
@@ -0,0 +1,35 @@
+/* file: kdtree_knn_classification_predict_dense_default_distr_step2_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors algorithm container for the prediction in the
+//  distributed processing mode - a class that contains fast K-Nearest Neighbors prediction
+//  kernels for supported architectures.
+//--
+*/
+
+#include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_distr_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::prediction::DistributedContainer, distributed, step2Master, DAAL_FPTYPE,
+                                      kdtree_knn_classification::prediction::defaultDense)
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,134 @@
+/* file: kdtree_knn_classification_predict_distr_container.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors algorithm container for the prediction in the
+//  distributed processing mode - a class that contains fast K-Nearest Neighbors prediction
+//  kernels for supported architectures.
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_distributed.h"
+#include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFpType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFpType, method, cpu>::DistributedContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationPredictKernel, algorithmFpType, method);
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFpType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFpType, method, cpu>::compute()
+{
+    const Input * const input  = static_cast<const Input *>(_in);
+    PartialResult * const pres = static_cast<PartialResult *>(_pres);
+
+    const data_management::NumericTableConstPtr a = input->get(classifier::prediction::data);
+    const classifier::ModelConstPtr m             = input->get(classifier::prediction::model);
+    const data_management::NumericTablePtr d      = pres->get(neighborDistances);
+    const data_management::NumericTablePtr l      = pres->get(neighborLabels);
+
+    const daal::algorithms::Parameter * const par = _par;
+    daal::services::Environment::env & env        = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), computeNeighbors, a.get(),
+                       m.get(), d.get(), l.get(), par);
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+services::Status DistributedContainer<step1Local, algorithmFpType, method, cpu>::finalizeCompute()
+{
+    return services::Status();
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFpType, method, cpu>::DistributedContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KNNClassificationPredictDistrStep2Kernel, algorithmFpType, method);
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFpType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFpType, method, cpu>::compute()
+{
+    DistributedStep2MasterInput * const input = static_cast<DistributedStep2MasterInput *>(_in);
+    data_management::DataCollection * dcInput = input->get(partialResults).get();
+    PartialResult * const pres                = static_cast<PartialResult *>(_pres);
+
+    const size_t nPartials = dcInput->size();
+    daal::internal::TArray<const data_management::NumericTable *, cpu> aPtr(2 * nPartials);
+    const data_management::NumericTable ** a = aPtr.get();
+    DAAL_CHECK_MALLOC(a);
+    for (size_t i = 0; i < nPartials; i++)
+    {
+        PartialResult * inPres = static_cast<PartialResult *>((*dcInput)[i].get());
+        a[i]                   = inPres->get(neighborDistances).get();
+        a[nPartials + i]       = inPres->get(neighborLabels).get();
+    }
+
+    const daal::algorithms::Parameter * const par = _par;
+    daal::services::Environment::env & env        = *_env;
+
+    services::Status s = __DAAL_CALL_KERNEL_STATUS(env, internal::KNNClassificationPredictDistrStep2Kernel,
+                                                   __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), compute, nPartials, a, a + nPartials,
+                                                   pres->get(neighborDistances).get(), pres->get(neighborLabels).get(), par);
+
+    dcInput->clear();
+    return s;
+}
+
+template <typename algorithmFpType, Method method, CpuType cpu>
+services::Status DistributedContainer<step2Master, algorithmFpType, method, cpu>::finalizeCompute()
+{
+    PartialResult * const pres                   = static_cast<PartialResult *>(_pres);
+    classifier::prediction::Result * const result = static_cast<classifier::prediction::Result *>(_res);
+
+    const daal::algorithms::Parameter * const par = _par;
+    daal::services::Environment::env & env        = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), finalizeCompute,
+                       pres->get(neighborDistances).get(), pres->get(neighborLabels).get(), result->get(classifier::prediction::prediction).get(),
+                       par);
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,224 @@
+/* file: kdtree_knn_classification_predict_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the second step of KD-tree based kNN model-based prediction
+//  in the distributed processing mode: the merge of the nearest neighbors found
+//  on the local nodes and the voting.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DISTR_STEP2_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DISTR_STEP2_IMPL_I__
+
+#include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_dense_default_batch_impl.i"
+#include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_partial_result.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+/* Head of one sorted list of neighbors in the merge, the order is reversed so that the max-heap routines keep the nearest head on top */
+template <typename algorithmFpType>
+struct MergeHead
+{
+    algorithmFpType distance;
+    size_t list;
+
+    inline bool operator<(const MergeHead & rhs) const { return (rhs.distance < distance); }
+};
+
+/* Rows of the queries processed by one task of the merge */
+const size_t mergeRowsPerBlock = 256;
+
+template <typename algorithmFpType, prediction::Method method, CpuType cpu>
+services::Status KNNClassificationPredictDistrStep2Kernel<algorithmFpType, method, cpu>::compute(size_t nPartials,
+                                                                                                 const NumericTable * const * partialDistances,
+                                                                                                 const NumericTable * const * partialLabels,
+                                                                                                 NumericTable * distances, NumericTable * labels,
+                                                                                                 const daal::algorithms::Parameter * par)
+{
+    typedef MergeHead<algorithmFpType> Head;
+
+    const size_t k = getNumberOfNeighbors(par);
+    DAAL_CHECK(k, ErrorNullParameterNotSupported);
+    const size_t nRows = distances->getNumberOfRows();
+    if (!nRows || !nPartials) return Status();
+
+    /* The neighbors merged on the previous calls are one more sorted list */
+    const size_t nLists  = nPartials + 1;
+    const size_t nBlocks = (nRows + mergeRowsPerBlock - 1) / mergeRowsPerBlock;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first      = iBlock * mergeRowsPerBlock;
+        const size_t nBlockRows = (first + mergeRowsPerBlock > nRows ? nRows - first : mergeRowsPerBlock);
+        const size_t listSize   = nBlockRows * k;
+
+        /* Copies of the lists of the block: distances of all the lists followed by the labels of all the lists */
+        TArray<algorithmFpType, cpu> bufferArray(2 * nLists * listSize);
+        TArray<Head, cpu> headsArray(nLists);
+        TArray<size_t, cpu> positionsArray(nLists);
+        DAAL_CHECK_THR(bufferArray.get() && headsArray.get() && positionsArray.get(), ErrorMemoryAllocationFailed);
+        algorithmFpType * const listDistances = bufferArray.get();
+        algorithmFpType * const listLabels    = listDistances + nLists * listSize;
+        Head * const heads                    = headsArray.get();
+        size_t * const positions              = positionsArray.get();
+
+        for (size_t j = 0; j < nLists; ++j)
+        {
+            NumericTable * const dTable = const_cast<NumericTable *>(j < nPartials ? partialDistances[j] : distances);
+            NumericTable * const lTable = const_cast<NumericTable *>(j < nPartials ? partialLabels[j] : labels);
+            ReadRows<algorithmFpType, cpu> dRows(dTable, first, nBlockRows);
+            ReadRows<algorithmFpType, cpu> lRows(lTable, first, nBlockRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(dRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(lRows);
+            daal::services::internal::daal_memcpy_s(listDistances + j * listSize, listSize * sizeof(algorithmFpType), dRows.get(),
+                                                    listSize * sizeof(algorithmFpType));
+            daal::services::internal::daal_memcpy_s(listLabels + j * listSize, listSize * sizeof(algorithmFpType), lRows.get(),
+                                                    listSize * sizeof(algorithmFpType));
+        }
+
+        WriteOnlyRows<algorithmFpType, cpu> dRows(distances, first, nBlockRows);
+        WriteOnlyRows<algorithmFpType, cpu> lRows(labels, first, nBlockRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(lRows);
+        algorithmFpType * const dd = dRows.get();
+        algorithmFpType * const dl = lRows.get();
+
+        for (size_t i = 0; i < nBlockRows; ++i)
+        {
+            const size_t rowOffset = i * k;
+            for (size_t j = 0; j < nLists; ++j)
+            {
+                heads[j].distance = listDistances[j * listSize + rowOffset];
+                heads[j].list     = j;
+                positions[j]      = 0;
+            }
+            makeMaxHeap<cpu>(heads, heads + nLists);
+
+            /* The lists hold nLists * k entries together, so the heap does not run out of heads before k neighbors are taken */
+            size_t nActive = nLists;
+            for (size_t r = 0; r < k; ++r)
+            {
+                const size_t j    = heads[0].list;
+                const size_t pos  = j * listSize + rowOffset + positions[j];
+                dd[rowOffset + r] = listDistances[pos];
+                dl[rowOffset + r] = listLabels[pos];
+                /* The nearest head is replaced in place by the next entry of its list and sifted down */
+                if (++positions[j] < k)
+                {
+                    heads[0].distance = listDistances[pos + 1];
+                }
+                else
+                {
+                    heads[0] = heads[--nActive];
+                }
+                internalAdjustMaxHeap<cpu>(heads, heads + nActive, nActive, size_t(0));
+            }
+        }
+    });
+
+    return safeStat.detach();
+}
+
+template <typename algorithmFpType, prediction::Method method, CpuType cpu>
+services::Status KNNClassificationPredictDistrStep2Kernel<algorithmFpType, method, cpu>::finalizeCompute(const NumericTable * distances,
+                                                                                                         const NumericTable * labels,
+                                                                                                         NumericTable * y,
+                                                                                                         const daal::algorithms::Parameter * par)
+{
+    const size_t k = getNumberOfNeighbors(par);
+    DAAL_CHECK(k, ErrorNullParameterNotSupported);
+    const size_t nRows = distances->getNumberOfRows();
+    if (!nRows) return Status();
+
+    const size_t nBlocks = (nRows + mergeRowsPerBlock - 1) / mergeRowsPerBlock;
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t first      = iBlock * mergeRowsPerBlock;
+        const size_t nBlockRows = (first + mergeRowsPerBlock > nRows ? nRows - first : mergeRowsPerBlock);
+
+        TArray<algorithmFpType, cpu> classesArray(k);
+        DAAL_CHECK_THR(classesArray.get(), ErrorMemoryAllocationFailed);
+        algorithmFpType * const classes = classesArray.get();
+
+        ReadRows<algorithmFpType, cpu> dRows(const_cast<NumericTable *>(distances), first, nBlockRows);
+        ReadRows<algorithmFpType, cpu> lRows(const_cast<NumericTable *>(labels), first, nBlockRows);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, nBlockRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(lRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(yRows);
+        const algorithmFpType * const dd = dRows.get();
+        const algorithmFpType * const dl = lRows.get();
+        algorithmFpType * const dy       = yRows.get();
+        const size_t yColumnCount        = y->getNumberOfColumns();
+
+        for (size_t i = 0; i < nBlockRows; ++i)
+        {
+            /* Same voting as in the batch processing mode: the most frequent label, the smallest one among equally frequent labels */
+            size_t nNeighbors = 0;
+            for (; nNeighbors < k && dd[i * k + nNeighbors] < MaxVal<algorithmFpType>::get(); ++nNeighbors)
+            {
+                classes[nNeighbors] = dl[i * k + nNeighbors];
+            }
+            if (!nNeighbors) continue;
+
+            daal::algorithms::internal::qSort<algorithmFpType, cpu>(nNeighbors, classes);
+            algorithmFpType currentClass = classes[0];
+            algorithmFpType winnerClass  = currentClass;
+            size_t currentWeight         = 1;
+            size_t winnerWeight          = currentWeight;
+            for (size_t j = 1; j < nNeighbors; ++j)
+            {
+                if (classes[j] == currentClass)
+                {
+                    if ((++currentWeight) > winnerWeight)
+                    {
+                        winnerWeight = currentWeight;
+                        winnerClass  = currentClass;
+                    }
+                }
+                else
+                {
+                    currentWeight = 1;
+                    currentClass  = classes[j];
+                }
+            }
+            dy[i * yColumnCount] = winnerClass;
+        }
+    });
+
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
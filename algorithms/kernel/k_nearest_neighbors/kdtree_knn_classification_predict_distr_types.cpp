@@ -0,0 +1,183 @@
+/* file: kdtree_knn_classification_predict_distr_types.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the input and partial result of KD-tree based kNN model-based prediction
+//  in the distributed processing mode.
+//--
+*/
+
+#include "algorithms/kernel/k_nearest_neighbors/kdtree_knn_classification_predict_partial_result.h"
+#include "service/kernel/serialization_utils.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_K_NEAREST_NEIGHBOR_PARTIAL_RESULT_ID);
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the partial result of KD-tree based kNN model-based prediction
+ * \param[in] id   Identifier of the partial result
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of KD-tree based kNN model-based prediction
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the partial result of KD-tree based kNN model-based prediction
+ * \param[in] input      %Input object of the algorithm
+ * \param[in] parameter  Algorithm parameter
+ * \param[in] method     Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    const size_t k = internal::getNumberOfNeighbors(parameter);
+    DAAL_CHECK(k, ErrorNullParameterNotSupported);
+    const size_t nRows          = internal::getNumberOfQueries(input);
+    const int unexpectedLayouts = (int)packed_mask;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(neighborDistances).get(), neighborDistancesStr(), unexpectedLayouts, 0, k, nRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(neighborLabels).get(), neighborLabelsStr(), unexpectedLayouts, 0, k, nRows));
+    return s;
+}
+
+/**
+ * Checks the partial result of KD-tree based kNN model-based prediction
+ * \param[in] parameter  Algorithm parameter
+ * \param[in] method     Computation method
+ */
+services::Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    const size_t k = internal::getNumberOfNeighbors(parameter);
+    DAAL_CHECK(k, ErrorNullParameterNotSupported);
+    const int unexpectedLayouts = (int)packed_mask;
+
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(neighborDistances).get(), neighborDistancesStr(), unexpectedLayouts, 0, k));
+    const size_t nRows = get(neighborDistances)->getNumberOfRows();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(neighborLabels).get(), neighborLabelsStr(), unexpectedLayouts, 0, k, nRows));
+    return s;
+}
+
+DistributedStep2MasterInput::DistributedStep2MasterInput() : daal::algorithms::Input(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the collection of partial results
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+DataCollectionPtr DistributedStep2MasterInput::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the collection of partial results
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the object
+ */
+void DistributedStep2MasterInput::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, staticPointerCast<SerializationIface, DataCollection>(ptr));
+}
+
+/**
+ * Adds the partial result computed on a local node
+ * \param[in] id     Identifier of the input object
+ * \param[in] value  Pointer to the partial result
+ */
+void DistributedStep2MasterInput::add(MasterInputId id, const PartialResultPtr & value)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(value);
+}
+
+/**
+ * Returns the number of queries in the partial results
+ * \return Number of queries
+ */
+size_t DistributedStep2MasterInput::getNumberOfRows() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection || !collection->size()) return 0;
+    PartialResultPtr pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[0]);
+    if (!pres || !pres->get(neighborDistances)) return 0;
+    return pres->get(neighborDistances)->getNumberOfRows();
+}
+
+/**
+ * Checks the input objects of the second step of the distributed processing mode
+ * \param[in] parameter  Algorithm parameter
+ * \param[in] method     Computation method
+ */
+services::Status DistributedStep2MasterInput::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    const size_t k = internal::getNumberOfNeighbors(parameter);
+    DAAL_CHECK(k, ErrorNullParameterNotSupported);
+
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    const size_t nBlocks = collection->size();
+    DAAL_CHECK(nBlocks > 0, ErrorIncorrectNumberOfInputNumericTables);
+
+    const size_t nRows          = getNumberOfRows();
+    const int unexpectedLayouts = (int)packed_mask;
+    services::Status s;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResultPtr pres = dynamicPointerCast<PartialResult, SerializationIface>((*collection)[i]);
+        DAAL_CHECK(pres, ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, checkNumericTable(pres->get(neighborDistances).get(), neighborDistancesStr(), unexpectedLayouts, 0, k, nRows));
+        DAAL_CHECK_STATUS(s, checkNumericTable(pres->get(neighborLabels).get(), neighborLabelsStr(), unexpectedLayouts, 0, k, nRows));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,112 @@
+/* file: kdtree_knn_classification_predict_partial_result.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of KD-tree based kNN model-based prediction
+//  in the distributed processing mode.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_PARTIAL_RESULT_H__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_PARTIAL_RESULT_H__
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+/* Returns the number of neighbors from any of the supported versions of the parameter, 0 for an unsupported parameter */
+inline size_t getNumberOfNeighbors(const daal::algorithms::Parameter * parameter)
+{
+    const kdtree_knn_classification::interface2::Parameter * par2 = dynamic_cast<const kdtree_knn_classification::interface2::Parameter *>(parameter);
+    if (par2) return par2->k;
+    const kdtree_knn_classification::interface1::Parameter * par1 = dynamic_cast<const kdtree_knn_classification::interface1::Parameter *>(parameter);
+    if (par1) return par1->k;
+    return 0;
+}
+
+/* Returns the number of queries of the first or of the second step input, 0 for an empty input */
+inline size_t getNumberOfQueries(const daal::algorithms::Input * input)
+{
+    const DistributedStep2MasterInput * step2Input = dynamic_cast<const DistributedStep2MasterInput *>(input);
+    if (step2Input) return step2Input->getNumberOfRows();
+    const classifier::prediction::Input * step1Input = dynamic_cast<const classifier::prediction::Input *>(input);
+    if (step1Input && step1Input->get(classifier::prediction::data)) return step1Input->get(classifier::prediction::data)->getNumberOfRows();
+    return 0;
+}
+
+} // namespace internal
+
+namespace interface1
+{
+using namespace daal::data_management;
+
+/**
+ * Allocates memory to store the partial result of KD-tree based kNN model-based prediction
+ * \param[in] input      %Input of the algorithm
+ * \param[in] parameter  Parameter of the algorithm
+ * \param[in] method     Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                     const int method)
+{
+    const size_t k = internal::getNumberOfNeighbors(parameter);
+    DAAL_CHECK(k, services::ErrorNullParameterNotSupported);
+    const size_t nRows = internal::getNumberOfQueries(input);
+
+    services::Status status;
+    set(neighborDistances, HomogenNumericTable<algorithmFPType>::create(k, nRows, NumericTable::doAllocate, &status));
+    DAAL_CHECK_STATUS_VAR(status);
+    set(neighborLabels, HomogenNumericTable<algorithmFPType>::create(k, nRows, NumericTable::doAllocate, &status));
+    DAAL_CHECK_STATUS_VAR(status);
+    return initialize<algorithmFPType>(input, parameter, method);
+}
+
+/**
+ * Marks all the positions of the partial result as positions without a neighbor
+ * \param[in] input      %Input of the algorithm
+ * \param[in] parameter  Parameter of the algorithm
+ * \param[in] method     Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status status;
+    DAAL_CHECK_STATUS(status, get(neighborDistances)->assign(services::internal::MaxVal<algorithmFPType>::get()));
+    DAAL_CHECK_STATUS(status, get(neighborLabels)->assign((algorithmFPType)0.0));
+    return status;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -171,6 +171,19 @@ Status KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     DAAL_CHECK_STATUS(status, rearrangePoints(*x, indexes));
     DAAL_CHECK_STATUS(status, rearrangePoints(*y, indexes));
 
+    /* The model keeps the position of each training observation in the tree order to remove the observations by their rows */
+    services::SharedPtr<HomogenNumericTable<DAAL_UINT64> > positionsTable =
+        HomogenNumericTable<DAAL_UINT64>::create(1, xRowCount, NumericTable::doAllocate, &status);
+    if (status)
+    {
+        DAAL_UINT64 * const positions = positionsTable->getArray();
+        for (size_t i = 0; i < xRowCount; ++i)
+        {
+            positions[indexes[i]] = i;
+        }
+        r->impl()->setPositions(positionsTable);
+    }
+
     daal_free(bboxQ);
     daal_free(indexes);
     bboxQ   = nullptr;
@@ -1324,7 +1337,8 @@ algorithmFpType KNNClassificationTrainBatchKernel<algorithmFpType, training::def
             inSortValues[i].idx   = indexes[start + i];
         }
 
-        radixSort(inSortValues, elementCount, outSortValues);
+        auto getValue = [](const IndexValuePair<algorithmFpType, cpu> & item) -> const algorithmFpType & { return item.value; };
+        status |= daal::algorithms::internal::radixSort<cpu, algorithmFpType>(inSortValues, outSortValues, elementCount, getValue);
 
         // Copy back the indexes.
         for (i = 0; i < elementCount; ++i)
@@ -1503,242 +1517,6 @@ size_t KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense
     return idx;
 }
 
-template <typename algorithmFpType, CpuType cpu>
-void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::radixSort(IndexValuePair<algorithmFpType, cpu> * inValues,
-                                                                                                size_t valueCount,
-                                                                                                IndexValuePair<algorithmFpType, cpu> * outValues)
-{
-#if (__FPTYPE__(DAAL_FPTYPE) == __float__)
-    typedef IndexValuePair<algorithmFpType, cpu> Item;
-    typedef unsigned int IntegerType;
-    const size_t histogramSize = 256;
-    int histogram[histogramSize], histogramPS[histogramSize + 1];
-    Item * first       = inValues;
-    Item * second      = outValues;
-    size_t valueCount4 = valueCount / 4 * 4;
-    for (unsigned int pass = 0; pass < 3; ++pass)
-    {
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int pos    = histogramPS[(val1 >> (pass * 8)) & 0xFF]++;
-            second[pos]      = first[i];
-        }
-
-        Item * temp = first;
-        first       = second;
-        second      = temp;
-    }
-    {
-        unsigned int pass = 3;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        // Handle negative values.
-        const size_t indexOfNegatives = histogramSize / 2;
-        int countOfNegatives          = histogramPS[histogramSize] - histogramPS[indexOfNegatives];
-        // Fixes offsets for positive values.
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[i] += countOfNegatives;
-        }
-        // Fixes offsets for negative values.
-        histogramPS[histogramSize - 1] = histogram[histogramSize - 1];
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[histogramSize - 2 - i] = histogramPS[histogramSize - 1 - i] + histogram[histogramSize - 2 - i];
-        }
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int bin    = (val1 >> (pass * 8)) & 0xFF;
-            int pos;
-            if (bin >= indexOfNegatives)
-            {
-                pos = --histogramPS[bin];
-            }
-            else
-            {
-                pos = histogramPS[bin]++;
-            }
-            second[pos] = first[i];
-        }
-    }
-#else  // #if (__FPTYPE__(DAAL_FPTYPE) == __float__)
-    typedef IndexValuePair<algorithmFpType, cpu> Item;
-    typedef DAAL_UINT64 IntegerType;
-    const size_t histogramSize = 256;
-    int histogram[histogramSize], histogramPS[histogramSize + 1];
-    Item * first       = inValues;
-    Item * second      = outValues;
-    size_t valueCount4 = valueCount / 4 * 4;
-    for (unsigned int pass = 0; pass < 7; ++pass)
-    {
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int pos    = histogramPS[(val1 >> (pass * 8)) & 0xFF]++;
-            second[pos]      = first[i];
-        }
-
-        Item * temp = first;
-        first       = second;
-        second      = temp;
-    }
-    {
-        unsigned int pass = 7;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            histogram[i] = 0;
-        }
-        for (size_t i = 0; i < valueCount4; i += 4)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            IntegerType val2 = *reinterpret_cast<IntegerType *>(&first[i + 1].value);
-            IntegerType val3 = *reinterpret_cast<IntegerType *>(&first[i + 2].value);
-            IntegerType val4 = *reinterpret_cast<IntegerType *>(&first[i + 3].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-            ++histogram[(val2 >> (pass * 8)) & 0xFF];
-            ++histogram[(val3 >> (pass * 8)) & 0xFF];
-            ++histogram[(val4 >> (pass * 8)) & 0xFF];
-        }
-        for (size_t i = valueCount4; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            ++histogram[(val1 >> (pass * 8)) & 0xFF];
-        }
-
-        int sum = 0, prevSum = 0;
-        for (size_t i = 0; i < histogramSize; ++i)
-        {
-            sum += histogram[i];
-            histogramPS[i] = prevSum;
-            prevSum        = sum;
-        }
-        histogramPS[histogramSize] = prevSum;
-
-        // Handle negative values.
-        const size_t indexOfNegatives = histogramSize / 2;
-        int countOfNegatives          = histogramPS[histogramSize] - histogramPS[indexOfNegatives];
-        // Fixes offsets for positive values.
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[i] += countOfNegatives;
-        }
-        // Fixes offsets for negative values.
-        histogramPS[histogramSize - 1] = histogram[histogramSize - 1];
-        for (size_t i = 0; i < indexOfNegatives - 1; ++i)
-        {
-            histogramPS[histogramSize - 2 - i] = histogramPS[histogramSize - 1 - i] + histogram[histogramSize - 2 - i];
-        }
-
-        for (size_t i = 0; i < valueCount; ++i)
-        {
-            IntegerType val1 = *reinterpret_cast<IntegerType *>(&first[i].value);
-            const int bin    = (val1 >> (pass * 8)) & 0xFF;
-            int pos;
-            if (bin >= indexOfNegatives)
-            {
-                pos = --histogramPS[bin];
-            }
-            else
-            {
-                pos = histogramPS[bin]++;
-            }
-            second[pos] = first[i];
-        }
-    }
-#endif // #if (__FPTYPE__(DAAL_FPTYPE) == __float__)
-}
-
 } // namespace internal
 } // namespace training
 } // namespace kdtree_knn_classification
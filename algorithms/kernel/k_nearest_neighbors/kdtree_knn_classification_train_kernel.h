@@ -101,9 +101,6 @@ protected:
                                                       services::Status & status);
 
     size_t adjustIndexesInSerial(size_t start, size_t end, size_t dimension, algorithmFpType median, const NumericTable & x, size_t * indexes);
-
-    DAAL_FORCEINLINE void radixSort(IndexValuePair<algorithmFpType, cpu> * inValues, size_t valueCount,
-                                    IndexValuePair<algorithmFpType, cpu> * outValues);
 };
 
 } // namespace internal
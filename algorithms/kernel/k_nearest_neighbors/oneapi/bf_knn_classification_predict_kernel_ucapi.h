@@ -57,10 +57,24 @@ private:
                                       const services::Buffer<algorithmFpType> & query, oneapi::internal::UniversalBuffer & distances,
                                       uint32_t dataBlockRowCount, uint32_t queryBlockRowCount, uint32_t nFeatures);
 
+    // Computes the distances from the queries to their candidate neighbors in the precision of the algorithm
+    services::Status refineCandidates(oneapi::internal::ExecutionContextIface & context, const services::Buffer<algorithmFpType> & data,
+                                      const services::Buffer<algorithmFpType> & query, const oneapi::internal::UniversalBuffer & candidates,
+                                      const services::Buffer<int> & labels, oneapi::internal::UniversalBuffer & refinedDistances,
+                                      oneapi::internal::UniversalBuffer & refinedLabels, uint32_t queryBlockRowCount, uint32_t nCandidates,
+                                      uint32_t nFeatures);
+
     services::Status computeWinners(oneapi::internal::ExecutionContextIface & context, const oneapi::internal::UniversalBuffer & labels,
                                     uint32_t queryBlockRowCount, uint32_t k, oneapi::internal::UniversalBuffer labelsOut);
 
     services::Status buildProgram(oneapi::internal::ClKernelFactoryIface & kernel_factory);
+
+    template <typename T>
+    services::Status uploadTile(oneapi::internal::ExecutionContextIface & context, NumericTable * table, uint32_t startRow, uint32_t nRows,
+                                uint32_t nCols, oneapi::internal::UniversalBuffer & tile);
+
+    template <typename T>
+    static bool isDeviceResident(NumericTable * table, services::Status & status);
 };
 
 } // namespace internal
@@ -28,6 +28,7 @@
 #include "algorithms/kernel/k_nearest_neighbors/oneapi/bf_knn_classification_model_ucapi_impl.h"
 
 #include "service/kernel/oneapi/blas_gpu.h"
+#include "service/kernel/oneapi/reduced_precision.h"
 #include "algorithms/kernel/k_nearest_neighbors/oneapi/cl_kernels/bf_knn_cl_kernels.cl"
 
 #include "externals/service_ittnotify.h"
@@ -128,17 +129,85 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
     SelectIndexed::Result selectResult(context, k, maxQueryBlockRowCount, distances.type(), &st);
     DAAL_CHECK_STATUS_VAR(st);
 
+    // Reference data that is not on the device is streamed through two staging tiles,
+    // the upload of the next tile overlaps with the kernels of the current one when the kernels are scheduled asynchronously
+    const bool isDataStreamed   = !isDeviceResident<algorithmFpType>(points, st);
+    const bool isLabelsStreamed = !isDeviceResident<int>(labels, st);
+    DAAL_CHECK_STATUS_VAR(st);
+    const uint32_t nStagingTiles = 2;
+    UniversalBuffer dataTiles[nStagingTiles];
+    UniversalBuffer labelTiles[nStagingTiles];
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, maxDataBlockRowCount, nFeatures);
+    for (uint32_t i = 0; i < nStagingTiles; i++)
+    {
+        if (isDataStreamed)
+        {
+            dataTiles[i] = context.allocate(TypeIds::id<algorithmFpType>(), maxDataBlockRowCount * nFeatures, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        if (isLabelsStreamed)
+        {
+            labelTiles[i] = context.allocate(TypeIds::id<int>(), maxDataBlockRowCount, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+    }
+    uint32_t nUploadedTiles = 0;
+
     SelectIndexed::Params params(k, TypeIds::id<algorithmFpType>(), maxDataBlockRowCount, parameter->engine);
     SelectIndexedFactory factory;
     SharedPtr<SelectIndexed> selector(factory.create(k, params, &st));
     DAAL_CHECK_STATUS_VAR(st);
 
+    // With the reduced precision storage the reference data is packed to 16-bit values once, during the first query block.
+    // The nCandidates nearest rows of every data block are selected by the distances computed from the packed data,
+    // their distances are recomputed from the data in the precision of the algorithm to select the k nearest neighbors
+    const bool isReducedPrecision     = parameter->dataStorageType != fullPrecisionStorage;
+    const math::PackedType packedType = parameter->dataStorageType == bfloat16Storage ? math::PackedType::bfloat16 : math::PackedType::float16;
+    const uint32_t refinementFactor   = 4;
+    const uint32_t nCandidates        = k * refinementFactor < maxDataBlockRowCount ? k * refinementFactor : maxDataBlockRowCount;
+    UniversalBuffer packedData;
+    UniversalBuffer packedDataSumOfSquares;
+    UniversalBuffer packedQuery;
+    UniversalBuffer packedQuerySumOfSquares;
+    UniversalBuffer refinedDistances;
+    UniversalBuffer refinedLabels;
+    SelectIndexed::Result candidatesResult;
+    SharedPtr<SelectIndexed> candidatesSelector;
+    if (isReducedPrecision)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nDataRows, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, k, refinementFactor);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, maxQueryBlockRowCount, nCandidates);
+        packedData = context.allocate(math::ReducedPrecision::packedTypeId(), nDataRows * nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        packedDataSumOfSquares = context.allocate(TypeIds::id<algorithmFpType>(), nDataRows, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        packedQuery = context.allocate(math::ReducedPrecision::packedTypeId(), maxQueryBlockRowCount * nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        packedQuerySumOfSquares = context.allocate(TypeIds::id<algorithmFpType>(), maxQueryBlockRowCount, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        refinedDistances = context.allocate(TypeIds::id<algorithmFpType>(), maxQueryBlockRowCount * nCandidates, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        refinedLabels = context.allocate(TypeIds::id<int>(), maxQueryBlockRowCount * nCandidates, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        candidatesResult = SelectIndexed::Result(context, nCandidates, maxQueryBlockRowCount, distances.type(), &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        SelectIndexed::Params candidatesParams(nCandidates, TypeIds::id<algorithmFpType>(), maxDataBlockRowCount, parameter->engine);
+        candidatesSelector.reset(factory.create(nCandidates, candidatesParams, &st));
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
     for (uint32_t qblock = 0; qblock < nQueryBlockCount; qblock++)
     {
         Range curQueryRange = Range::createFromBlock(qblock, maxQueryBlockRowCount, nQueryRows);
         BlockDescriptor<algorithmFpType> queryRows;
         DAAL_CHECK_STATUS_VAR(ntData->getBlockOfRows(curQueryRange.startIndex, curQueryRange.count, readOnly, queryRows));
         auto curQuery = queryRows.getBuffer();
+        if (isReducedPrecision)
+        {
+            DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::pack<algorithmFpType>(packedType, curQuery, curQueryRange.count, nFeatures, packedQuery, 0,
+                                                                                packedQuerySumOfSquares, algorithmFpType(1.0)));
+        }
         for (uint32_t sblock = 0; sblock < nSelectionBlockCount; sblock++)
         {
             uint32_t curSelectionMaxNumberOfChunks = sblock == 0 ? selectionMaxNumberOfChunks : selectionMaxNumberOfChunks - 1;
@@ -148,28 +217,76 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::compute(const Numer
             {
                 Range curDataRange = Range::createFromBlock(dblock, maxDataBlockRowCount, nDataRows);
                 BlockDescriptor<int> labelRows;
-                DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, labelRows));
                 BlockDescriptor<algorithmFpType> dataRows;
-                DAAL_CHECK_STATUS_VAR(points->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, dataRows));
-                // Collect sums of squares from train data
-                auto sumResult = math::SumReducer::sum(math::Layout::RowMajor, dataRows.getBuffer(), curDataRange.count, nFeatures, &st);
-                DAAL_CHECK_STATUS_VAR(st);
-                // Initialize GEMM distances
-                DAAL_CHECK_STATUS_VAR(scatterSumOfSquares(context, sumResult.sumOfSquares, curDataRange.count, curQueryRange.count, distances));
-                // Let's calculate distances using GEMM
-                DAAL_CHECK_STATUS_VAR(
-                    computeDistances(context, dataRows.getBuffer(), curQuery, distances, curDataRange.count, curQueryRange.count, nFeatures));
-                // Select k smallest distances and their labels from every row of the [curQueryRange.count]x[curDataRange.count] block
-                selector->selectNearestDistancesAndLabels(distances, labelRows.getBuffer(), k, curQueryRange.count, curDataRange.count,
-                                                          curDataRange.count, 0, selectResult, &st);
-                DAAL_CHECK_STATUS_VAR(st);
+                Buffer<int> curLabels;
+                Buffer<algorithmFpType> curData;
+                const uint32_t tile = nUploadedTiles++ % nStagingTiles;
+                if (isDataStreamed)
+                {
+                    DAAL_CHECK_STATUS_VAR(
+                        uploadTile<algorithmFpType>(context, points, curDataRange.startIndex, curDataRange.count, nFeatures, dataTiles[tile]));
+                    curData = dataTiles[tile].get<algorithmFpType>();
+                }
+                else
+                {
+                    DAAL_CHECK_STATUS_VAR(points->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, dataRows));
+                    curData = dataRows.getBuffer();
+                }
+                if (isLabelsStreamed)
+                {
+                    DAAL_CHECK_STATUS_VAR(uploadTile<int>(context, labels, curDataRange.startIndex, curDataRange.count, 1, labelTiles[tile]));
+                    curLabels = labelTiles[tile].get<int>();
+                }
+                else
+                {
+                    DAAL_CHECK_STATUS_VAR(labels->getBlockOfRows(curDataRange.startIndex, curDataRange.count, readOnly, labelRows));
+                    curLabels = labelRows.getBuffer();
+                }
+                if (isReducedPrecision)
+                {
+                    if (qblock == 0)
+                    {
+                        DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::pack<algorithmFpType>(packedType, curData, curDataRange.count, nFeatures,
+                                                                                            packedData, curDataRange.startIndex,
+                                                                                            packedDataSumOfSquares, algorithmFpType(1.0)));
+                    }
+                    // Approximate distances from the packed data
+                    DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::gemm<algorithmFpType>(
+                        packedType, packedQuery, 0, curQueryRange.count, packedData, curDataRange.startIndex, curDataRange.count, nFeatures,
+                        algorithmFpType(-2.0), packedDataSumOfSquares, distances, curDataRange.count, 1));
+                    const uint32_t nBlockCandidates = curDataRange.count < nCandidates ? curDataRange.count : nCandidates;
+                    candidatesSelector->selectIndices(distances, nBlockCandidates, curQueryRange.count, curDataRange.count, curDataRange.count,
+                                                      curDataRange.count, candidatesResult, &st);
+                    DAAL_CHECK_STATUS_VAR(st);
+                    DAAL_CHECK_STATUS_VAR(refineCandidates(context, curData, curQuery, candidatesResult.indices, curLabels, refinedDistances,
+                                                           refinedLabels, curQueryRange.count, nBlockCandidates, nFeatures));
+                    // Select k smallest exact distances and their labels from the candidates
+                    selector->selectNearestDistancesAndLabels(refinedDistances, refinedLabels, k, curQueryRange.count, nBlockCandidates,
+                                                              nBlockCandidates, nBlockCandidates, selectResult, &st);
+                    DAAL_CHECK_STATUS_VAR(st);
+                }
+                else
+                {
+                    // Collect sums of squares from train data
+                    auto sumResult = math::SumReducer::sum(math::Layout::RowMajor, curData, curDataRange.count, nFeatures, &st);
+                    DAAL_CHECK_STATUS_VAR(st);
+                    // Initialize GEMM distances
+                    DAAL_CHECK_STATUS_VAR(scatterSumOfSquares(context, sumResult.sumOfSquares, curDataRange.count, curQueryRange.count, distances));
+                    // Let's calculate distances using GEMM
+                    DAAL_CHECK_STATUS_VAR(
+                        computeDistances(context, curData, curQuery, distances, curDataRange.count, curQueryRange.count, nFeatures));
+                    // Select k smallest distances and their labels from every row of the [curQueryRange.count]x[curDataRange.count] block
+                    selector->selectNearestDistancesAndLabels(distances, curLabels, k, curQueryRange.count, curDataRange.count,
+                                                              curDataRange.count, 0, selectResult, &st);
+                    DAAL_CHECK_STATUS_VAR(st);
+                }
                 // copy block results to buffer in order to get merged with the same selection algorithm (up to selectionMaxNumberOfChunks of partial results)
                 // and keep the first part containing previously merged result if exists
                 DAAL_CHECK_STATUS_VAR(copyPartialDistancesAndLabels(context, selectResult.values, selectResult.indices, partialDistances,
                                                                     partialLabels, curQueryRange.count, k, selectionChunkCount,
                                                                     selectionMaxNumberOfChunks));
-                DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
-                DAAL_CHECK_STATUS_VAR(points->releaseBlockOfRows(dataRows));
+                if (!isLabelsStreamed) DAAL_CHECK_STATUS_VAR(labels->releaseBlockOfRows(labelRows));
+                if (!isDataStreamed) DAAL_CHECK_STATUS_VAR(points->releaseBlockOfRows(dataRows));
                 selectionChunkCount++;
             }
             // merge partial data by one more K-selection
@@ -265,6 +382,39 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::computeDistances(Ex
                                            algorithmFpType(1.0), distances.get<algorithmFpType>(), dataBlockRowCount, 0);
 }
 
+template <typename algorithmFpType>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::refineCandidates(ExecutionContextIface & context, const Buffer<algorithmFpType> & data,
+                                                                              const Buffer<algorithmFpType> & query,
+                                                                              const UniversalBuffer & candidates, const Buffer<int> & labels,
+                                                                              UniversalBuffer & refinedDistances, UniversalBuffer & refinedLabels,
+                                                                              uint32_t queryBlockRowCount, uint32_t nCandidates, uint32_t nFeatures)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.refineCandidates);
+    if (nCandidates > static_cast<uint32_t>(INT_MAX) || nFeatures > static_cast<uint32_t>(INT_MAX))
+    {
+        return services::Status(services::ErrorBufferSizeIntegerOverflow);
+    }
+    Status st;
+    auto & kernel_factory = context.getClKernelFactory();
+    DAAL_CHECK_STATUS_VAR(buildProgram(kernel_factory));
+    auto kernel_refine_candidates = kernel_factory.getKernel("refine_candidates", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    KernelArguments args(8);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, query, AccessModeIds::read);
+    args.set(2, candidates, AccessModeIds::read);
+    args.set(3, labels, AccessModeIds::read);
+    args.set(4, refinedDistances, AccessModeIds::write);
+    args.set(5, refinedLabels, AccessModeIds::write);
+    args.set(6, nCandidates);
+    args.set(7, nFeatures);
+
+    KernelRange global_range(queryBlockRowCount, nCandidates);
+    context.run(global_range, kernel_refine_candidates, args, &st);
+    return st;
+}
+
 template <typename algorithmFpType>
 Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::computeWinners(ExecutionContextIface & context, const UniversalBuffer & labels,
                                                                             uint32_t queryBlockRowCount, uint32_t k, UniversalBuffer labelsOut)
@@ -297,6 +447,34 @@ Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::computeWinners(Exec
     return st;
 }
 
+template <typename algorithmFpType>
+template <typename T>
+Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::uploadTile(ExecutionContextIface & context, NumericTable * table, uint32_t startRow,
+                                                                        uint32_t nRows, uint32_t nCols, UniversalBuffer & tile)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.uploadTile);
+    Status st;
+    BlockDescriptor<T> block;
+    DAAL_CHECK_STATUS_VAR(table->getBlockOfRows(startRow, nRows, readOnly, block));
+    context.copy(tile, 0, static_cast<void *>(block.getBlockPtr()), 0, size_t(nRows) * nCols, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    return table->releaseBlockOfRows(block);
+}
+
+template <typename algorithmFpType>
+template <typename T>
+bool KNNClassificationPredictKernelUCAPI<algorithmFpType>::isDeviceResident(NumericTable * table, Status & status)
+{
+    if (!status || table->getNumberOfRows() == 0) return true;
+
+    BlockDescriptor<T> block;
+    status |= table->getBlockOfRows(0, 1, readOnly, block);
+    if (!status) return true;
+    const bool isSyclBuffer = block.getBuffer().isSyclBuffer();
+    status |= table->releaseBlockOfRows(block);
+    return isSyclBuffer;
+}
+
 template <typename algorithmFpType>
 Status KNNClassificationPredictKernelUCAPI<algorithmFpType>::buildProgram(ClKernelFactoryIface & kernel_factory)
 {
@@ -48,6 +48,27 @@ DECLARE_SOURCE(
         partialCategories[global_id_0 * K * TotalParts + Part * K + global_id_1] = categories[global_id_0 * K + global_id_1];
     }
 
+    __kernel void refine_candidates(__global const algorithmFPType * data, __global const algorithmFPType * query, __global const int * candidates,
+                                    __global const int * labels, __global algorithmFPType * distances, __global int * candidateLabels,
+                                    int nCandidates, int nFeatures) {
+        const int global_id_0 = get_global_id(0);
+        const int global_id_1 = get_global_id(1);
+        const int index       = global_id_0 * nCandidates + global_id_1;
+        const int row         = candidates[index];
+
+        __global const algorithmFPType * queryRow = &query[global_id_0 * nFeatures];
+        __global const algorithmFPType * dataRow  = &data[row * nFeatures];
+
+        algorithmFPType sum = 0.0;
+        for (int i = 0; i < nFeatures; i++)
+        {
+            const algorithmFPType diff = queryRow[i] - dataRow[i];
+            sum += diff * diff;
+        }
+        distances[index]       = sum;
+        candidateLabels[index] = labels[row];
+    }
+
     __kernel void find_max_occurance(__global const sortedType * data, __global algorithmFPType * result, int K) {
         const int global_id_0             = get_global_id(0);
         __global const sortedType * array = &data[global_id_0 * K];
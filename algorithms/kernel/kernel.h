@@ -28,6 +28,7 @@
 #include "service/kernel/service_defines.h"
 #include "services/daal_kernel_defines.h"
 #include "services/internal/gpu_support_checker.h"
+#include "externals/service_profiler.h"
 
 #undef __DAAL_INITIALIZE_KERNELS
 #define __DAAL_INITIALIZE_KERNELS(KernelClass, ...)    \
@@ -53,6 +54,7 @@
 #undef __DAAL_CALL_KERNEL
 #define __DAAL_CALL_KERNEL(env, KernelClass, templateArguments, method, ...)            \
     {                                                                                   \
+        daal::internal::DispatchReport::record(#KernelClass, __FILE__, cpu);            \
         return ((KernelClass<templateArguments, cpu> *)(_kernel))->method(__VA_ARGS__); \
     }
 
@@ -64,7 +66,7 @@
 
 #undef __DAAL_CALL_KERNEL_STATUS
 #define __DAAL_CALL_KERNEL_STATUS(env, KernelClass, templateArguments, method, ...) \
-    ((KernelClass<templateArguments, cpu> *)(_kernel))->method(__VA_ARGS__);
+    (daal::internal::DispatchReport::record(#KernelClass, __FILE__, cpu), ((KernelClass<templateArguments, cpu> *)(_kernel))->method(__VA_ARGS__));
 
 #define __DAAL_INSTANTIATE_DISPATCH_IMPL(ContainerTemplate, Mode, ClassName, BaseClassName, ...)                                                    \
     DAAL_KERNEL_SSE2_CONTAINER1(ContainerTemplate, __VA_ARGS__)                                                                                     \
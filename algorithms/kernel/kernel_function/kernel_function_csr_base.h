@@ -30,6 +30,7 @@
 #include "algorithms/kernel_function/kernel_function_linear.h"
 #include "algorithms/kernel_function/kernel_function_rbf.h"
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "algorithms/kernel/service_sell_matrix.h"
 #include "algorithms/kernel/kernel.h"
 
 using namespace daal::internal;
@@ -52,10 +53,12 @@ struct KernelCSRImplBase : public Kernel
     virtual services::Status computeInternalMatrixMatrix(const NumericTable * a1, const NumericTable * a2, NumericTable * r,
                                                          const ParameterBase * par) = 0;
 
+    /* The data cached by the previous calls is dropped unless the caller guarantees that the inputs are unchanged */
     services::Status compute(ComputationMode computationMode, const NumericTable * a1, const NumericTable * a2, NumericTable * r,
-                             const daal::algorithms::Parameter * par)
+                             const daal::algorithms::Parameter * par, bool reuseCachedData = false)
     {
         const ParameterBase * svmPar = static_cast<const ParameterBase *>(par);
+        if (!reuseCachedData) resetCache();
 
         switch (computationMode)
         {
@@ -68,10 +71,22 @@ struct KernelCSRImplBase : public Kernel
         return services::Status();
     }
 
+    /* Drops the data cached by the previous calls */
+    virtual void resetCache() { _sellA1.invalidate(); }
+
 protected:
     inline algorithmFPType computeDotProduct(const size_t startIndex1, const size_t endIndex1, const algorithmFPType * dataA1,
                                              const size_t * colIndicesA1, const size_t startIndex2, const size_t endIndex2,
                                              const algorithmFPType * dataA2, const size_t * colIndicesA2);
+
+    /* Computes the dot products of the rows of the CSR table a1 with the row [startIndex2, endIndex2) of the CSR data of a2.
+       The rows of a1 are converted to the SELL-C-sigma layout once per table and the subsequent calls for the same table reuse it
+       while the caller enables the reuse of the cached data */
+    services::Status computeDotProducts(const NumericTable * a1, const algorithmFPType * dataA1, const size_t * colIndicesA1,
+                                        const size_t * rowOffsetsA1, const size_t startIndex2, const size_t endIndex2,
+                                        const algorithmFPType * dataA2, const size_t * colIndicesA2, algorithmFPType * dotProducts);
+
+    daal::algorithms::internal::SellCSigmaMatrix<algorithmFPType, cpu> _sellA1;
 };
 
 } // namespace internal
@@ -74,6 +74,39 @@ algorithmFPType KernelCSRImplBase<algorithmFPType, cpu>::computeDotProduct(const
     return computeDotProductBaseline<algorithmFPType, cpu>(startIndexA, endIndexA, valuesA, indicesA, startIndexB, endIndexB, valuesB, indicesB);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status KernelCSRImplBase<algorithmFPType, cpu>::computeDotProducts(const NumericTable * a1, const algorithmFPType * dataA1,
+                                                                             const size_t * colIndicesA1, const size_t * rowOffsetsA1,
+                                                                             const size_t startIndex2, const size_t endIndex2,
+                                                                             const algorithmFPType * dataA2, const size_t * colIndicesA2,
+                                                                             algorithmFPType * dotProducts)
+{
+    const size_t nVectors1 = a1->getNumberOfRows();
+    if (!_sellA1.isConvertedFrom(a1, dataA1, rowOffsetsA1, nVectors1))
+    {
+        services::Status s = _sellA1.convert(a1, dataA1, colIndicesA1, rowOffsetsA1, nVectors1, 1);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    if (!_sellA1.isUseful())
+    {
+        for (size_t i = 0; i < nVectors1; i++)
+        {
+            dotProducts[i] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i + 1] - 1, dataA1, colIndicesA1, startIndex2, endIndex2, dataA2,
+                                               colIndicesA2);
+        }
+        return services::Status();
+    }
+
+    /* The row of a2 is scattered to the dense vector that is multiplied by the rows of a1 in the SELL-C-sigma layout */
+    services::internal::TArrayCalloc<algorithmFPType, cpu> x(a1->getNumberOfColumns());
+    DAAL_CHECK_MALLOC(x.get());
+    for (size_t k = startIndex2; k < endIndex2; k++) x[colIndicesA2[k] - 1] = dataA2[k];
+
+    _sellA1.multiply(x.get(), dotProducts);
+    return services::Status();
+}
+
 #if defined(__INTEL_COMPILER)
 
     #undef __DAAL_IA32e
@@ -52,10 +52,12 @@ struct KernelImplBase : public Kernel
     virtual services::Status computeInternalMatrixMatrix(const NumericTable * a1, const NumericTable * a2, NumericTable * r,
                                                          const ParameterBase * par) = 0;
 
+    /* The data cached by the previous calls is dropped unless the caller guarantees that the inputs are unchanged */
     services::Status compute(ComputationMode computationMode, const NumericTable * a1, const NumericTable * a2, NumericTable * r,
-                             const daal::algorithms::Parameter * par)
+                             const daal::algorithms::Parameter * par, bool reuseCachedData = false)
     {
         const ParameterBase * svmPar = static_cast<const ParameterBase *>(par);
+        if (!reuseCachedData) resetCache();
 
         switch (computationMode)
         {
@@ -67,6 +69,9 @@ struct KernelImplBase : public Kernel
         DAAL_ASSERT(false); //should never come here
         return services::Status();
     }
+
+    /* Drops the data cached by the previous calls */
+    virtual void resetCache() {}
 };
 
 } // namespace internal
@@ -24,6 +24,7 @@
 #include "algorithms/kernel_function/kernel_function_linear.h"
 #include "algorithms/kernel/kernel_function/kernel_function_linear_dense_default_kernel.h"
 #include "algorithms/kernel/kernel_function/kernel_function_linear_csr_fast_kernel.h"
+#include "service/kernel/service_algo_utils.h"
 
 using namespace daal::data_management;
 
@@ -65,8 +66,10 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     ComputationMode computationMode = static_cast<ParameterBase *>(par)->computationMode;
 
+    const bool reuseCachedData = services::internal::reusesCachedData(*input);
+
     __DAAL_CALL_KERNEL(env, internal::KernelImplLinear, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, computationMode, a[0], a[1], r[0],
-                       par);
+                       par, reuseCachedData);
 }
 
 }; // namespace linear
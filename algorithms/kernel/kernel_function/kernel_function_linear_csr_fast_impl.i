@@ -91,10 +91,11 @@ services::Status KernelImplLinear<fastCSR, algorithmFPType, cpu>::computeInterna
     algorithmFPType k        = (algorithmFPType)(linPar->k);
 
     //compute
+    services::Status s = this->computeDotProducts(a1, mtA1.values(), mtA1.cols(), rowOffsetsA1, rowOffsetsA2[0] - 1, rowOffsetsA2[1] - 1,
+                                                  mtA2.values(), mtA2.cols(), dataR);
+    DAAL_CHECK_STATUS_VAR(s);
     for (size_t i = 0; i < nVectors1; i++)
     {
-        dataR[i] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i + 1] - 1, mtA1.values(), mtA1.cols(), rowOffsetsA2[0] - 1,
-                                     rowOffsetsA2[1] - 1, mtA2.values(), mtA2.cols());
         dataR[i] = dataR[i] * k + b;
     }
 
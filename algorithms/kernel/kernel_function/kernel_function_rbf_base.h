@@ -26,6 +26,7 @@
 
 #include "algorithms/kernel_function/kernel_function_types_rbf.h"
 #include "algorithms/kernel/kernel.h"
+#include "service/kernel/data_management/service_numeric_table.h"
 
 using namespace daal::internal;
 
@@ -43,6 +44,46 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 struct KernelImplRBF
 {};
 
+/**
+ * Squared norms of the rows of a data set. They are computed once and reused while the kernel function
+ * is called for the same table, e.g. row by row when svm training fills its cache of the kernel matrix.
+ * The norms are invalidated at the start of each computation of the kernel function unless the caller
+ * that owns the kernel function enabled the reuse of the cached data, see services::internal::setCachedDataReuse()
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SqrNormsCache
+{
+public:
+    SqrNormsCache() : _table(nullptr), _data(nullptr), _nRows(0) {}
+
+    /* Returns the cached norms if they were computed for the same table, nullptr otherwise */
+    const algorithmFPType * get(const data_management::NumericTable * table, const algorithmFPType * data, size_t nRows) const
+    {
+        return (_norms.get() && table == _table && data == _data && nRows == _nRows) ? _norms.get() : nullptr;
+    }
+
+    /* Returns the buffer to be filled with the norms of the given table, nullptr if the allocation fails */
+    algorithmFPType * reset(const data_management::NumericTable * table, const algorithmFPType * data, size_t nRows)
+    {
+        _table = nullptr;
+        if (_norms.size() < nRows) _norms.reset(nRows);
+        if (!_norms.get()) return nullptr;
+        _table = table;
+        _data  = data;
+        _nRows = nRows;
+        return _norms.get();
+    }
+
+    /* Discards the cached norms, the memory is kept for the next data set */
+    void invalidate() { _table = nullptr; }
+
+private:
+    TArray<algorithmFPType, cpu> _norms;
+    const data_management::NumericTable * _table;
+    const algorithmFPType * _data;
+    size_t _nRows;
+};
+
 } // namespace internal
 
 } // namespace rbf
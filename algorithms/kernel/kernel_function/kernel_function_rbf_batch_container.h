@@ -24,6 +24,7 @@
 #include "algorithms/kernel_function/kernel_function_rbf.h"
 #include "algorithms/kernel/kernel_function/kernel_function_rbf_dense_default_kernel.h"
 #include "algorithms/kernel/kernel_function/kernel_function_rbf_csr_fast_kernel.h"
+#include "service/kernel/service_algo_utils.h"
 
 using namespace daal::data_management;
 
@@ -71,8 +72,10 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
             return services::Status(services::ErrorIncorrectTypeOfInputNumericTable);
     }
 
+    const bool reuseCachedData = services::internal::reusesCachedData(*input);
+
     __DAAL_CALL_KERNEL(env, internal::KernelImplRBF, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, computationMode, a[0], a[1], r[0],
-                       par);
+                       par, reuseCachedData);
 }
 
 } // namespace rbf
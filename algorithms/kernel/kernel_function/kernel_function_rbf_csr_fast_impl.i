@@ -86,6 +86,23 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalVe
     return services::Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+const algorithmFPType * KernelImplRBF<fastCSR, algorithmFPType, cpu>::getSqrNorms(const NumericTable * a, const algorithmFPType * data,
+                                                                                  const size_t * rowOffsets, size_t nRows)
+{
+    const algorithmFPType * cached = _sqrNormsCache.get(a, data, nRows);
+    if (cached) return cached;
+
+    algorithmFPType * sqrNorms = _sqrNormsCache.reset(a, data, nRows);
+    if (!sqrNorms) return nullptr;
+    daal::threader_for_optional(nRows, nRows, [=](size_t i) {
+        algorithmFPType sum = 0.0;
+        for (size_t j = rowOffsets[i] - 1; j < rowOffsets[i + 1] - 1; j++) sum += data[j] * data[j];
+        sqrNorms[i] = sum;
+    });
+    return sqrNorms;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMatrixVector(const NumericTable * a1, const NumericTable * a2,
                                                                                            NumericTable * r, const ParameterBase * par)
@@ -113,21 +130,20 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
     const size_t startIndex2    = rowOffsetsA2[0] - 1;
     const size_t endIndex2      = rowOffsetsA2[1] - 1;
 
+    /* The squared norms of the rows of a1 are reused by the subsequent calls for the other rows of a2 */
+    const algorithmFPType * sqrDataA1 = getSqrNorms(a1, dataA1, rowOffsetsA1, nVectors1);
+    DAAL_CHECK_MALLOC(sqrDataA1);
+
     algorithmFPType factor = 0.0;
     for (size_t index = startIndex2; index < endIndex2; index++)
     {
         factor += dataA2[index] * dataA2[index];
     }
+    services::Status s = this->computeDotProducts(a1, dataA1, mtA1.cols(), rowOffsetsA1, startIndex2, endIndex2, dataA2, mtA2.cols(), dataR);
+    DAAL_CHECK_STATUS_VAR(s);
     for (size_t i = 0; i < nVectors1; i++)
     {
-        size_t startIndex1 = rowOffsetsA1[i] - 1;
-        size_t endIndex1   = rowOffsetsA1[i + 1] - 1;
-        dataR[i]           = computeDotProduct(startIndex1, endIndex1, dataA1, mtA1.cols(), startIndex2, endIndex2, dataA2, mtA2.cols());
-        dataR[i]           = -2.0 * dataR[i] + factor;
-        for (size_t index = startIndex1; index < endIndex1; index++)
-        {
-            dataR[i] += dataA1[index] * dataA1[index];
-        }
+        dataR[i] = -2.0 * dataR[i] + factor + sqrDataA1[i];
         dataR[i] *= coeff;
 
         // make all values less than threshold as threshold value
@@ -195,15 +211,9 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
         const size_t * colIndicesA2    = mtA2.cols();
         const size_t * rowOffsetsA2    = mtA2.rows();
 
-        DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, nVectors1, nVectors2);
-        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors1 + nVectors2, sizeof(algorithmFPType));
-
-        daal::internal::TArray<algorithmFPType, cpu> aBuf((nVectors1 + nVectors2));
-        DAAL_CHECK(aBuf.get(), services::ErrorMemoryAllocationFailed);
-        algorithmFPType * buffer = aBuf.get();
-
-        algorithmFPType * sqrDataA1 = buffer;
-        algorithmFPType * sqrDataA2 = buffer + nVectors1;
+        daal::internal::TArray<algorithmFPType, cpu> aSqrDataA1(nVectors1);
+        DAAL_CHECK(aSqrDataA1.get(), services::ErrorMemoryAllocationFailed);
+        algorithmFPType * sqrDataA1 = aSqrDataA1.get();
 
         SpBlas<algorithmFPType, cpu>::xgemm_a_bt(dataA1, colIndicesA1, rowOffsetsA1, dataA2, colIndicesA2, rowOffsetsA2, nVectors1, nVectors2,
                                                  a1->getNumberOfColumns(), dataR);
@@ -215,30 +225,23 @@ services::Status KernelImplRBF<fastCSR, algorithmFPType, cpu>::computeInternalMa
                 sqrDataA1[i] += dataA1[j] * dataA1[j];
             }
         });
-        daal::threader_for_optional(nVectors2, nVectors2, [=](size_t i) {
-            sqrDataA2[i] = zero;
-            for (size_t j = rowOffsetsA2[i] - 1; j < rowOffsetsA2[i + 1] - 1; j++)
-            {
-                sqrDataA2[i] += dataA2[j] * dataA2[j];
-            }
-        });
+        /* a2 is usually the whole data set that stays the same over the calls, e.g. in svm training and prediction */
+        const algorithmFPType * sqrDataA2 = getSqrNorms(a2, dataA2, rowOffsetsA2, nVectors2);
+        DAAL_CHECK(sqrDataA2, services::ErrorMemoryAllocationFailed);
+
+        /* The exponent is applied to each row of the gemm output while it is in cache */
+        const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
         daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i) {
+            algorithmFPType * rowR = dataR + i * nVectors2;
             for (size_t k = 0; k < nVectors2; k++)
             {
-                dataR[i * nVectors2 + k] *= negTwo;
-                dataR[i * nVectors2 + k] += (sqrDataA1[i] + sqrDataA2[k]);
-                dataR[i * nVectors2 + k] *= coeff;
-
                 // make all values less than threshold as threshold value
                 // to fix slow work on vExp on large negative inputs
-                if (dataR[i * nVectors2 + k] < Math<algorithmFPType, cpu>::vExpThreshold())
-                {
-                    dataR[i * nVectors2 + k] = Math<algorithmFPType, cpu>::vExpThreshold();
-                }
+                const algorithmFPType val = coeff * (negTwo * rowR[k] + sqrDataA1[i] + sqrDataA2[k]);
+                rowR[k]                   = val < expThreshold ? expThreshold : val;
             }
+            daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors2, rowR, rowR);
         });
-
-        daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1 * nVectors2, dataR, dataR);
     }
     return services::Status();
 }
@@ -50,6 +50,18 @@ struct KernelImplRBF<fastCSR, algorithmFPType, cpu> : public daal::algorithms::k
                                                          const ParameterBase * par);
     virtual services::Status computeInternalMatrixMatrix(const NumericTable * a1, const NumericTable * a2, NumericTable * r,
                                                          const ParameterBase * par);
+
+    void resetCache() DAAL_C11_OVERRIDE
+    {
+        daal::algorithms::kernel_function::internal::KernelCSRImplBase<algorithmFPType, cpu>::resetCache();
+        _sqrNormsCache.invalidate();
+    }
+
+protected:
+    /* Returns squared norms of the rows of the table, they are taken from the cache if it keeps the norms of this table */
+    const algorithmFPType * getSqrNorms(const NumericTable * a, const algorithmFPType * data, const size_t * rowOffsets, size_t nRows);
+
+    SqrNormsCache<algorithmFPType, cpu> _sqrNormsCache;
 };
 
 } // namespace internal
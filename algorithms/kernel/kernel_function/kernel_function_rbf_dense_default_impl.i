@@ -76,6 +76,26 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
     return services::Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+const algorithmFPType * KernelImplRBF<defaultDense, algorithmFPType, cpu>::getSqrNorms(const NumericTable * a, const algorithmFPType * data,
+                                                                                       size_t nRows, size_t nFeatures)
+{
+    const algorithmFPType * cached = _sqrNormsCache.get(a, data, nRows);
+    if (cached) return cached;
+
+    algorithmFPType * sqrNorms = _sqrNormsCache.reset(a, data, nRows);
+    if (!sqrNorms) return nullptr;
+    daal::threader_for_optional(nRows, nRows, [=](size_t i) {
+        const algorithmFPType * row = data + i * nFeatures;
+        algorithmFPType sum         = 0.0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++) sum += row[j] * row[j];
+        sqrNorms[i] = sum;
+    });
+    return sqrNorms;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInternalMatrixVector(const NumericTable * a1, const NumericTable * a2,
                                                                                                 NumericTable * r, const ParameterBase * par)
@@ -97,24 +117,42 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
     algorithmFPType * dataR = mtR.get();
 
     //compute
-    const Parameter * rbfPar          = static_cast<const Parameter *>(par);
-    const algorithmFPType invSqrSigma = (algorithmFPType)(1.0 / (rbfPar->sigma * rbfPar->sigma));
-    for (size_t i = 0; i < nVectors1; i++)
+    /* The squared norms of the rows of a1 are reused by the subsequent calls for the other rows of a2 */
+    const algorithmFPType * sqrDataA1 = getSqrNorms(a1, dataA1, nVectors1, nFeatures);
+    DAAL_CHECK_MALLOC(sqrDataA1);
+    algorithmFPType sqrDataA2 = 0.0;
+    if (a2 == a1)
     {
-        algorithmFPType factor = 0.0;
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        for (size_t j = 0; j < nFeatures; j++)
-        {
-            algorithmFPType diff = (dataA1[i * nFeatures + j] - dataA2[j]);
-            factor += diff * diff;
-        }
-        dataR[i] = -0.5 * invSqrSigma * factor;
+        sqrDataA2 = sqrDataA1[par->rowIndexY];
+    }
+    else
+    {
+        for (size_t j = 0; j < nFeatures; j++) sqrDataA2 += dataA2[j] * dataA2[j];
+    }
 
-        if (dataR[i] < Math<algorithmFPType, cpu>::vExpThreshold())
-        {
-            dataR[i] = Math<algorithmFPType, cpu>::vExpThreshold();
-        }
+    char trans = 'T';
+    DAAL_INT m_(nFeatures), n_(nVectors1), lda(nFeatures), inc(1);
+    algorithmFPType one(1.0), zero(0.0);
+    if (is_in_parallel())
+    {
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &m_, &n_, &one, dataA1, &lda, dataA2, &inc, &zero, dataR, &inc);
+    }
+    else
+    {
+        Blas<algorithmFPType, cpu>::xgemv(&trans, &m_, &n_, &one, dataA1, &lda, dataA2, &inc, &zero, dataR, &inc);
+    }
+
+    const Parameter * rbfPar           = static_cast<const Parameter *>(par);
+    const algorithmFPType coeff        = (algorithmFPType)(-0.5 / (rbfPar->sigma * rbfPar->sigma));
+    const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < nVectors1; i++)
+    {
+        algorithmFPType sqrDist = sqrDataA1[i] + sqrDataA2 - algorithmFPType(2.0) * dataR[i];
+        sqrDist                 = sqrDist > zero ? sqrDist : zero;
+        dataR[i]                = coeff * sqrDist;
+        dataR[i]                = dataR[i] < expThreshold ? expThreshold : dataR[i];
     }
     daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1, dataR, dataR);
     return services::Status();
@@ -165,15 +203,9 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
                                               &zero, dataR, (DAAL_INT *)&nVectors2);
         }
 
-        DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, nVectors1, nVectors2);
-        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nVectors1 + nVectors2, sizeof(algorithmFPType));
-
-        daal::internal::TArray<algorithmFPType, cpu> aBuf((nVectors1 + nVectors2));
-        DAAL_CHECK(aBuf.get(), services::ErrorMemoryAllocationFailed);
-        algorithmFPType * buffer = aBuf.get();
-
-        algorithmFPType * sqrDataA1 = buffer;
-        algorithmFPType * sqrDataA2 = buffer + nVectors1;
+        daal::internal::TArray<algorithmFPType, cpu> aSqrDataA1(nVectors1);
+        DAAL_CHECK(aSqrDataA1.get(), services::ErrorMemoryAllocationFailed);
+        algorithmFPType * sqrDataA1 = aSqrDataA1.get();
         for (size_t i = 0; i < nVectors1; i++)
         {
             sqrDataA1[i] = zero;
@@ -182,27 +214,23 @@ services::Status KernelImplRBF<defaultDense, algorithmFPType, cpu>::computeInter
                 sqrDataA1[i] += dataA1[i * nFeatures + j] * dataA1[i * nFeatures + j];
             }
         }
-        for (size_t i = 0; i < nVectors2; i++)
-        {
-            sqrDataA2[i] = zero;
-            for (size_t j = 0; j < nFeatures; j++)
-            {
-                sqrDataA2[i] += dataA2[i * nFeatures + j] * dataA2[i * nFeatures + j];
-            }
-        }
-        for (size_t i = 0; i < nVectors1; i++)
-        {
+        /* a2 is usually the whole data set that stays the same over the calls, e.g. in svm training and prediction */
+        const algorithmFPType * sqrDataA2 = getSqrNorms(a2, dataA2, nVectors2, nFeatures);
+        DAAL_CHECK(sqrDataA2, services::ErrorMemoryAllocationFailed);
+
+        /* The exponent is applied to each row of the gemm output while it is in cache */
+        const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
+        daal::threader_for_optional(nVectors1, nVectors1, [=](size_t i) {
+            algorithmFPType * rowR = dataR + i * nVectors2;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
             for (size_t k = 0; k < nVectors2; k++)
             {
-                dataR[i * nVectors2 + k] += (sqrDataA1[i] + sqrDataA2[k]);
-                dataR[i * nVectors2 + k] *= coeff;
-                if (dataR[i * nVectors2 + k] < Math<algorithmFPType, cpu>::vExpThreshold())
-                {
-                    dataR[i * nVectors2 + k] = Math<algorithmFPType, cpu>::vExpThreshold();
-                }
+                const algorithmFPType val = coeff * (rowR[k] + sqrDataA1[i] + sqrDataA2[k]);
+                rowR[k]                   = val < expThreshold ? expThreshold : val;
             }
-        }
-        daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors1 * nVectors2, dataR, dataR);
+            daal::internal::Math<algorithmFPType, cpu>::vExp(nVectors2, rowR, rowR);
+        });
     }
     else
     {
@@ -48,6 +48,18 @@ struct KernelImplRBF<defaultDense, algorithmFPType, cpu> : public daal::algorith
                                                          const ParameterBase * par);
     virtual services::Status computeInternalMatrixMatrix(const NumericTable * a1, const NumericTable * a2, NumericTable * r,
                                                          const ParameterBase * par);
+
+    void resetCache() DAAL_C11_OVERRIDE
+    {
+        daal::algorithms::kernel_function::internal::KernelImplBase<algorithmFPType, cpu>::resetCache();
+        _sqrNormsCache.invalidate();
+    }
+
+protected:
+    /* Returns squared norms of the rows of the table, they are taken from the cache if it keeps the norms of this table */
+    const algorithmFPType * getSqrNorms(const NumericTable * a, const algorithmFPType * data, size_t nRows, size_t nFeatures);
+
+    SqrNormsCache<algorithmFPType, cpu> _sqrNormsCache;
 };
 
 } // namespace internal
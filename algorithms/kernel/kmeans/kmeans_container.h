@@ -28,11 +28,14 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kernel/kmeans/kmeans_lloyd_kernel.h"
+#include "algorithms/kernel/kmeans/kmeans_minibatch_kernel.h"
 #include "algorithms/kernel/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
 #include "oneapi/internal/execution_context.h"
 
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_algo_utils.h"
 
 namespace daal
 {
@@ -81,7 +84,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     if (deviceInfo.isCpu || method != lloydDense)
     {
-        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par);
+        __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                           daal::services::internal::hostApp(*input), a, r, par);
     }
     else
     {
@@ -230,6 +234,67 @@ services::Status DistributedContainer<step2Master, algorithmFPType, method, cpu>
                        par);
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    const size_t na = 2;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+    a[1] = static_cast<NumericTable *>(input->get(inputCentroids).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    Input * input        = static_cast<Input *>(_in);
+    PartialResult * pres = static_cast<PartialResult *>(_pres);
+    Result * result      = static_cast<Result *>(_res);
+    Parameter * par      = static_cast<Parameter *>(_par);
+
+    const size_t na = 4;
+    NumericTable * a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(nObservations).get());
+    a[1] = static_cast<NumericTable *>(pres->get(partialSums).get());
+    a[2] = static_cast<NumericTable *>(pres->get(partialObjectiveFunction).get());
+    a[3] = static_cast<NumericTable *>(input->get(inputCentroids).get());
+
+    const size_t nr = 3;
+    NumericTable * r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids).get());
+    r[1] = static_cast<NumericTable *>(result->get(objectiveFunction).get());
+    r[2] = static_cast<NumericTable *>(result->get(nIterations).get());
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
@@ -82,7 +82,8 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
     const size_t inputFeatures = get(data)->getNumberOfColumns();
     const size_t inputRows     = get(data)->getNumberOfRows();
 
-    if (kmPar->maxIterations > 0)
+    /* The blocks of the online processing mode may be smaller than the number of clusters */
+    if (kmPar->maxIterations > 0 && method != miniBatchDense)
     {
         DAAL_CHECK(inputRows >= kmPar->nClusters, ErrorKMeansNumberOfClustersIsTooLarge);
     }
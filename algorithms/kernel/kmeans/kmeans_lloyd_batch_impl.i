@@ -27,6 +27,7 @@
 #include "services/daal_defines.h"
 #include "externals/service_memory.h"
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_algo_utils.h"
 
 #include "algorithms/kernel/kmeans/kmeans_lloyd_impl.i"
 
@@ -46,7 +47,8 @@ namespace kmeans
 namespace internal
 {
 template <Method method, typename algorithmFPType, CpuType cpu>
-Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par)
+Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * const * a,
+                                                               const NumericTable * const * r, const Parameter * par)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(compute);
 
@@ -114,18 +116,48 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
     TArray<algorithmFPType, cpu> cValues(nClusters);
     TArray<size_t, cpu> cIndices(nClusters);
 
+    /* Bounds of Hamerly's algorithm are kept between the iterations to skip the most of the distance computations */
+    const size_t n       = ntData->getNumberOfRows();
+    const bool useBounds = (nIter > 1);
+
+    TArray<int, cpu> boundsAssignments(useBounds ? n : 0);
+    TArray<algorithmFPType, cpu> boundsLower(useBounds ? n : 0);
+    TArray<algorithmFPType, cpu> boundsHalfMinDist(useBounds ? nClusters : 0);
+    TArray<algorithmFPType, cpu> oldClusters(useBounds ? nClusters * p : 0);
+    LloydBounds<algorithmFPType> bounds;
+    bounds.valid = false;
+    if (useBounds)
+    {
+        DAAL_CHECK(boundsAssignments.get() && boundsLower.get() && boundsHalfMinDist.get() && oldClusters.get(),
+                   services::ErrorMemoryAllocationFailed);
+        bounds.assignments = boundsAssignments.get();
+        bounds.lowerBounds = boundsLower.get();
+        bounds.halfMinDist = boundsHalfMinDist.get();
+    }
+
     Status s;
     algorithmFPType oldTargetFunc(0.0);
+    daal::affinity_partitioner partitioner;
     size_t kIter;
     for (kIter = 0; kIter < nIter; kIter++)
     {
+        if (services::internal::isCancelled(s, pHostApp)) return s;
+
         SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, inClusters);
         DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
         DAAL_ASSERT(task);
+        task->partitioner = &partitioner;
 
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(addNTToTaskThreaded);
-            s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get());
+            if (useBounds)
+            {
+                s = task->template addNTToTaskThreadedBounds<method>(ntData, bounds);
+            }
+            else
+            {
+                s = task->template addNTToTaskThreaded<method>(ntData, catCoef.get());
+            }
         }
 
         if (!s)
@@ -141,6 +173,13 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
         size_t cNum;
         DAAL_CHECK_STATUS(s, task->kmeansComputeCentroidsCandidates(cValues.get(), cIndices.get(), cNum));
+
+        /* inClusters and clusters are the same buffer starting from the second iteration */
+        if (useBounds)
+        {
+            result |= daal::services::internal::daal_memcpy_s(oldClusters.get(), nClusters * p * sizeof(algorithmFPType), inClusters,
+                                                              nClusters * p * sizeof(algorithmFPType));
+        }
         size_t cPos = 0;
 
         algorithmFPType newCentersGoalFunc = (algorithmFPType)0.0;
@@ -185,6 +224,7 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
 
                 if (internal::Math<algorithmFPType, cpu>::sFabs(oldTargetFunc - newTargetFunc) < par->accuracyThreshold)
                 {
+                    services::internal::reportProgress(pHostApp, kIter + 1, newTargetFunc);
                     kIter++;
                     break;
                 }
@@ -197,6 +237,13 @@ Status KMeansBatchKernel<method, algorithmFPType, cpu>::compute(const NumericTab
                 oldTargetFunc -= newCentersGoalFunc;
             }
         }
+        services::internal::reportProgress(pHostApp, kIter + 1, oldTargetFunc);
+
+        if (useBounds)
+        {
+            DAAL_ITTNOTIFY_SCOPED_TASK(kmeansUpdateBounds);
+            kmeansUpdateBounds<algorithmFPType, cpu>(p, nClusters, oldClusters.get(), clusters, bounds);
+        }
         inClusters = clusters;
     }
 
@@ -30,6 +30,7 @@
 #include "algorithms/threading/threading.h"
 #include "externals/service_blas.h"
 #include "externals/service_spblas.h"
+#include "externals/service_math.h"
 #include "service/kernel/service_data_utils.h"
 
 namespace daal
@@ -80,6 +81,27 @@ struct tls_task_t
         {
             service_scalable_free<size_t, cpu>(cIndices);
         }
+        if (rowIdx)
+        {
+            service_scalable_free<int, cpu>(rowIdx);
+        }
+        if (rowGoal)
+        {
+            service_scalable_free<algorithmFPType, cpu>(rowGoal);
+        }
+        if (rowBuff)
+        {
+            service_scalable_free<algorithmFPType, cpu>(rowBuff);
+        }
+    }
+
+    /* Buffers of the bounds based search are allocated on the first use only */
+    bool allocateBoundsBuffers(int dim, int max_block_size)
+    {
+        if (!rowIdx) rowIdx = service_scalable_calloc<int, cpu>(max_block_size);
+        if (!rowGoal) rowGoal = service_scalable_calloc<algorithmFPType, cpu>(max_block_size);
+        if (!rowBuff) rowBuff = service_scalable_calloc<algorithmFPType, cpu>(max_block_size * dim);
+        return rowIdx && rowGoal && rowBuff;
     }
 
     static tls_task_t<algorithmFPType, cpu> * create(int dim, int clNum, int max_block_size)
@@ -104,6 +126,25 @@ struct tls_task_t
     size_t cNum                = 0;
     algorithmFPType * cValues  = nullptr;
     size_t * cIndices          = nullptr;
+    int * rowIdx               = nullptr;
+    algorithmFPType * rowGoal  = nullptr;
+    algorithmFPType * rowBuff  = nullptr;
+};
+
+/* State of Hamerly's algorithm kept between the iterations of Lloyd method.
+   The distance to the assigned centroid is recomputed exactly on each iteration, and the search over all centroids is skipped
+   if this distance does not exceed the lower bound of the distance to the other centroids
+   or the half of the distance from the assigned centroid to the closest other centroid */
+template <typename algorithmFPType>
+struct LloydBounds
+{
+    int * assignments;              /* Centroids assigned to the observations on the previous iteration */
+    algorithmFPType * lowerBounds;  /* Lower bounds of the distances from the observations to the not assigned centroids */
+    algorithmFPType * halfMinDist;  /* Half of the distance from each centroid to the closest other centroid */
+    algorithmFPType maxDrift;       /* Largest shift of the centroids on the previous iteration */
+    algorithmFPType secondMaxDrift; /* Largest shift of the centroids except the one with index maxDriftIdx */
+    size_t maxDriftIdx;
+    bool valid; /* False until the first iteration initializes the assignments and the bounds */
 };
 
 template <typename algorithmFPType>
@@ -131,6 +172,7 @@ struct task_t
         clNum          = _clNum;
         cCenters       = _centroids;
         max_block_size = 512;
+        partitioner    = nullptr;
 
         /* Allocate memory for all arrays inside TLS */
         tls_task = new daal::tls<tls_task_t<algorithmFPType, cpu> *>([=]() -> tls_task_t<algorithmFPType, cpu> * {
@@ -184,6 +226,13 @@ struct task_t
     template <Method method>
     Status addNTToTaskThreaded(const NumericTable * const ntData, const algorithmFPType * const catCoef, NumericTable * ntAssign = nullptr);
 
+    Status addNTToTaskThreadedBoundsDense(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds);
+
+    Status addNTToTaskThreadedBoundsCSR(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds);
+
+    template <Method method>
+    Status addNTToTaskThreadedBounds(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds);
+
     template <typename centroidsFPType>
     int kmeansUpdateCluster(int jidx, centroidsFPType * s1);
 
@@ -199,6 +248,7 @@ struct task_t
     daal::tls<tls_task_t<algorithmFPType, cpu> *> * tls_task;
     algorithmFPType * clSq;
     algorithmFPType * cCenters;
+    daal::affinity_partitioner * partitioner; /* Keeps the blocks of observations in the same threads across the iterations */
 
     int dim;
     int clNum;
@@ -218,7 +268,7 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedDense(const NumericTable
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [=, &safeStat](const int k) {
         struct tls_task_t<algorithmFPType, cpu> * tt = tls_task->local();
         DAAL_CHECK_MALLOC_THR(tt);
         const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDeafult : blockSizeDeafult;
@@ -333,14 +383,21 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable *
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
+    /* Balance the blocks by the numbers of non-zero values */
+    CSRRowBlocks<cpu> blocks;
+    Status st = blocks.init(ntDataCsr, n, nBlocks, blockSizeDeafult);
+    DAAL_CHECK_STATUS_VAR(st);
+    nBlocks = blocks.nBlocks();
+
     SafeStatus safeStat;
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int k) {
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [=, &safeStat, &blocks](const int k) {
         struct tls_task_t<algorithmFPType, cpu> * tt = tls_task->local();
         DAAL_CHECK_MALLOC_THR(tt);
 
-        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDeafult : blockSizeDeafult;
+        const size_t iStart    = blocks.blockStart(k);
+        const size_t blockSize = blocks.blockSize(k);
 
-        ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, k * blockSizeDeafult, blockSize);
+        ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, iStart, blockSize);
         DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
 
         const algorithmFPType * const data = dataBlock.values();
@@ -359,7 +416,7 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable *
         algorithmFPType * cS1 = tt->cS1;
 
         int * assignments = nullptr;
-        WriteOnlyRows<int, cpu> assignBlock(ntAssign, k * blockSizeDeafult, blockSize);
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, iStart, blockSize);
         if (ntAssign)
         {
             DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
@@ -402,7 +459,7 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedCSR(const NumericTable *
                 csrCursor++;
             }
 
-            kmeansInsertCandidate(tt, minGoalVal, k * blockSizeDeafult + i);
+            kmeansInsertCandidate(tt, minGoalVal, iStart + i);
 
             *trg += minGoalVal;
 
@@ -435,6 +492,320 @@ Status task_t<algorithmFPType, cpu>::addNTToTaskThreaded(const NumericTable * co
     return Status();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedBoundsDense(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds)
+{
+    const size_t n                = ntData->getNumberOfRows();
+    const size_t blockSizeDeafult = max_block_size;
+
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks * blockSizeDeafult != n);
+
+    SafeStatus safeStat;
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [=, &safeStat, &bounds](const int k) {
+        struct tls_task_t<algorithmFPType, cpu> * tt = tls_task->local();
+        DAAL_CHECK_MALLOC_THR(tt && tt->allocateBoundsBuffers(dim, max_block_size));
+        const size_t blockSize = (k == nBlocks - 1) ? n - k * blockSizeDeafult : blockSizeDeafult;
+
+        ReadRows<algorithmFPType, cpu> mtData(*const_cast<NumericTable *>(ntData), k * blockSizeDeafult, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(mtData);
+        const algorithmFPType * const data = mtData.get();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+
+        int * const assignments             = bounds.assignments + k * blockSizeDeafult;
+        algorithmFPType * const lowerBounds = bounds.lowerBounds + k * blockSizeDeafult;
+
+        algorithmFPType * x_clusters = tt->mkl_buff;
+        algorithmFPType * rowGoal    = tt->rowGoal;
+        algorithmFPType * rowBuff    = tt->rowBuff;
+        int * rowIdx                 = tt->rowIdx;
+
+        /* Observations that can change the cluster are gathered into rowBuff */
+        size_t nSearch = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            if (bounds.valid)
+            {
+                const size_t a                  = assignments[i];
+                const algorithmFPType * const c = inClusters + a * p;
+
+                algorithmFPType dist = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : dist))
+                for (size_t j = 0; j < p; j++)
+                {
+                    dist += (data[i * p + j] - c[j]) * (data[i * p + j] - c[j]);
+                }
+
+                const algorithmFPType lower = lowerBounds[i] - (a == bounds.maxDriftIdx ? bounds.secondMaxDrift : bounds.maxDrift);
+                const algorithmFPType bound = (lower > bounds.halfMinDist[a] ? lower : bounds.halfMinDist[a]);
+                if (dist <= bound * bound)
+                {
+                    rowGoal[i]     = dist;
+                    lowerBounds[i] = lower;
+                    continue;
+                }
+            }
+
+            rowIdx[nSearch] = i;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                rowBuff[nSearch * p + j] = data[i * p + j];
+            }
+            nSearch++;
+        }
+
+        if (nSearch)
+        {
+            const char transa           = 't';
+            const char transb           = 'n';
+            const DAAL_INT _m           = nSearch;
+            const DAAL_INT _n           = nClusters;
+            const DAAL_INT _k           = p;
+            const algorithmFPType alpha = -1.0;
+            const DAAL_INT lda          = p;
+            const DAAL_INT ldy          = p;
+            const algorithmFPType beta  = 1.0;
+            const DAAL_INT ldaty        = nSearch;
+
+            for (size_t j = 0; j < nClusters; j++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t r = 0; r < nSearch; r++)
+                {
+                    x_clusters[r + j * nSearch] = clustersSq[j];
+                }
+            }
+
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, rowBuff, &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+
+            for (size_t r = 0; r < nSearch; r++)
+            {
+                algorithmFPType minGoalVal    = x_clusters[r];
+                algorithmFPType secondGoalVal = MaxVal<algorithmFPType>::get();
+                size_t minIdx                 = 0;
+
+                for (size_t j = 1; j < nClusters; j++)
+                {
+                    const algorithmFPType localGoalVal = x_clusters[r + j * nSearch];
+                    if (localGoalVal < minGoalVal)
+                    {
+                        secondGoalVal = minGoalVal;
+                        minGoalVal    = localGoalVal;
+                        minIdx        = j;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+
+                algorithmFPType sqNorm = algorithmFPType(0);
+                PRAGMA_IVDEP
+                PRAGMA_ICC_NO16(omp simd reduction(+ : sqNorm))
+                for (size_t j = 0; j < p; j++)
+                {
+                    sqNorm += rowBuff[r * p + j] * rowBuff[r * p + j];
+                }
+
+                const size_t i = rowIdx[r];
+                DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
+                assignments[i] = (int)minIdx;
+                rowGoal[i]     = minGoalVal * 2.0 + sqNorm;
+                if (nClusters > 1)
+                {
+                    const algorithmFPType secondDist = secondGoalVal * 2.0 + sqNorm;
+                    lowerBounds[i] = (secondDist > algorithmFPType(0) ? Math<algorithmFPType, cpu>::sSqrt(secondDist) : algorithmFPType(0));
+                }
+                else
+                {
+                    lowerBounds[i] = MaxVal<algorithmFPType>::get();
+                }
+            }
+        }
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t minIdx = assignments[i];
+
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += data[i * p + j];
+            }
+
+            kmeansInsertCandidate(tt, rowGoal[i], k * blockSizeDeafult + i);
+            cS0[minIdx]++;
+
+            goal += rowGoal[i];
+        }
+
+        tt->goalFunc += goal;
+    }); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedBoundsCSR(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds)
+{
+    CSRNumericTableIface * ntDataCsr = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntData));
+
+    const size_t n                = ntData->getNumberOfRows();
+    const size_t blockSizeDeafult = max_block_size;
+
+    size_t nBlocks = n / blockSizeDeafult;
+    nBlocks += (nBlocks * blockSizeDeafult != n);
+
+    /* Balance the blocks by the numbers of non-zero values */
+    CSRRowBlocks<cpu> blocks;
+    Status st = blocks.init(ntDataCsr, n, nBlocks, blockSizeDeafult);
+    DAAL_CHECK_STATUS_VAR(st);
+    nBlocks = blocks.nBlocks();
+
+    SafeStatus safeStat;
+    daal::threader_for_affinity(nBlocks, nBlocks, partitioner, [=, &safeStat, &blocks, &bounds](const int k) {
+        struct tls_task_t<algorithmFPType, cpu> * tt = tls_task->local();
+        DAAL_CHECK_MALLOC_THR(tt);
+
+        const size_t iStart    = blocks.blockStart(k);
+        const size_t blockSize = blocks.blockSize(k);
+
+        ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, iStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+
+        const algorithmFPType * const data = dataBlock.values();
+        const size_t * const colIdx        = dataBlock.cols();
+        const size_t * const rowIdx        = dataBlock.rows();
+
+        const size_t p                           = dim;
+        const size_t nClusters                   = clNum;
+        const algorithmFPType * const inClusters = cCenters;
+        const algorithmFPType * const clustersSq = clSq;
+
+        int * const assignments             = bounds.assignments + iStart;
+        algorithmFPType * const lowerBounds = bounds.lowerBounds + iStart;
+
+        int * cS0             = tt->cS0;
+        algorithmFPType * cS1 = tt->cS1;
+
+        algorithmFPType goal = algorithmFPType(0);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            const size_t jStart = rowIdx[i] - 1;
+            const size_t jEnd   = rowIdx[i + 1] - 1;
+
+            algorithmFPType sqNorm = algorithmFPType(0);
+            for (size_t j = jStart; j < jEnd; j++)
+            {
+                sqNorm += data[j] * data[j];
+            }
+
+            bool search                = true;
+            size_t minIdx              = 0;
+            algorithmFPType minGoalVal = algorithmFPType(0);
+            if (bounds.valid)
+            {
+                minIdx                          = assignments[i];
+                const algorithmFPType * const c = inClusters + minIdx * p;
+
+                algorithmFPType dotProduct = algorithmFPType(0);
+                for (size_t j = jStart; j < jEnd; j++)
+                {
+                    dotProduct += data[j] * c[colIdx[j] - 1];
+                }
+                minGoalVal = (clustersSq[minIdx] - dotProduct) * 2.0 + sqNorm;
+
+                const algorithmFPType lower = lowerBounds[i] - (minIdx == bounds.maxDriftIdx ? bounds.secondMaxDrift : bounds.maxDrift);
+                const algorithmFPType bound = (lower > bounds.halfMinDist[minIdx] ? lower : bounds.halfMinDist[minIdx]);
+                if (minGoalVal <= bound * bound)
+                {
+                    lowerBounds[i] = lower;
+                    search         = false;
+                }
+            }
+
+            if (search)
+            {
+                algorithmFPType secondGoalVal = MaxVal<algorithmFPType>::get();
+                minGoalVal                    = MaxVal<algorithmFPType>::get();
+                for (size_t c = 0; c < nClusters; c++)
+                {
+                    algorithmFPType dotProduct = algorithmFPType(0);
+                    for (size_t j = jStart; j < jEnd; j++)
+                    {
+                        dotProduct += data[j] * inClusters[c * p + colIdx[j] - 1];
+                    }
+
+                    const algorithmFPType localGoalVal = clustersSq[c] - dotProduct;
+                    if (localGoalVal < minGoalVal || c == 0)
+                    {
+                        secondGoalVal = (c == 0 ? secondGoalVal : minGoalVal);
+                        minGoalVal    = localGoalVal;
+                        minIdx        = c;
+                    }
+                    else if (localGoalVal < secondGoalVal)
+                    {
+                        secondGoalVal = localGoalVal;
+                    }
+                }
+                minGoalVal = minGoalVal * 2.0 + sqNorm;
+
+                DAAL_ASSERT(minIdx <= services::internal::MaxVal<int>::get())
+                assignments[i] = (int)minIdx;
+                if (nClusters > 1)
+                {
+                    const algorithmFPType secondDist = secondGoalVal * 2.0 + sqNorm;
+                    lowerBounds[i] = (secondDist > algorithmFPType(0) ? Math<algorithmFPType, cpu>::sSqrt(secondDist) : algorithmFPType(0));
+                }
+                else
+                {
+                    lowerBounds[i] = MaxVal<algorithmFPType>::get();
+                }
+            }
+
+            for (size_t j = jStart; j < jEnd; j++)
+            {
+                cS1[minIdx * p + colIdx[j] - 1] += data[j];
+            }
+
+            kmeansInsertCandidate(tt, minGoalVal, iStart + i);
+            cS0[minIdx]++;
+
+            goal += minGoalVal;
+        }
+
+        tt->goalFunc += goal;
+    });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+template <Method method>
+Status task_t<algorithmFPType, cpu>::addNTToTaskThreadedBounds(const NumericTable * const ntData, LloydBounds<algorithmFPType> & bounds)
+{
+    if (method == lloydDense)
+    {
+        return addNTToTaskThreadedBoundsDense(ntData, bounds);
+    }
+    else if (method == lloydCSR)
+    {
+        return addNTToTaskThreadedBoundsCSR(ntData, bounds);
+    }
+    DAAL_ASSERT(false);
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 template <typename centroidsFPType>
 int task_t<algorithmFPType, cpu>::kmeansUpdateCluster(int jidx, centroidsFPType * s1)
@@ -570,6 +941,62 @@ void task_t<algorithmFPType, cpu>::kmeansClearClusters(algorithmFPType * goalFun
     }
 }
 
+/* Updates the centroid shifts and the distances between the centroids used by the bounds on the next iteration */
+template <typename algorithmFPType, CpuType cpu>
+void kmeansUpdateBounds(const size_t p, const size_t nClusters, const algorithmFPType * const oldClusters, const algorithmFPType * const clusters,
+                        LloydBounds<algorithmFPType> & bounds)
+{
+    bounds.maxDrift       = algorithmFPType(0);
+    bounds.secondMaxDrift = algorithmFPType(0);
+    bounds.maxDriftIdx    = 0;
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        algorithmFPType drift = algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_ICC_NO16(omp simd reduction(+ : drift))
+        for (size_t j = 0; j < p; j++)
+        {
+            drift += (clusters[i * p + j] - oldClusters[i * p + j]) * (clusters[i * p + j] - oldClusters[i * p + j]);
+        }
+        drift = Math<algorithmFPType, cpu>::sSqrt(drift);
+
+        if (drift > bounds.maxDrift)
+        {
+            bounds.secondMaxDrift = bounds.maxDrift;
+            bounds.maxDrift       = drift;
+            bounds.maxDriftIdx    = i;
+        }
+        else if (drift > bounds.secondMaxDrift)
+        {
+            bounds.secondMaxDrift = drift;
+        }
+    }
+
+    algorithmFPType * const halfMinDist = bounds.halfMinDist;
+    daal::threader_for(nClusters, nClusters, [=](const int i) {
+        algorithmFPType minDist = MaxVal<algorithmFPType>::get();
+        for (size_t k = 0; k < nClusters; k++)
+        {
+            if (k == i) continue;
+
+            algorithmFPType dist = algorithmFPType(0);
+            PRAGMA_IVDEP
+            PRAGMA_ICC_NO16(omp simd reduction(+ : dist))
+            for (size_t j = 0; j < p; j++)
+            {
+                dist += (clusters[i * p + j] - clusters[k * p + j]) * (clusters[i * p + j] - clusters[k * p + j]);
+            }
+            if (dist < minDist)
+            {
+                minDist = dist;
+            }
+        }
+        halfMinDist[i] = (nClusters > 1 ? Math<algorithmFPType, cpu>::sSqrt(minDist) * 0.5 : minDist);
+    });
+
+    bounds.valid = true;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status RecalculationObservationsDense(const size_t p, const size_t nClusters, const algorithmFPType * const inClusters,
                                       const NumericTable * const ntData, const algorithmFPType * const catCoef, NumericTable * ntAssign,
@@ -663,16 +1090,23 @@ Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, cons
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
+    /* Balance the blocks by the numbers of non-zero values */
+    CSRRowBlocks<cpu> blocks;
+    Status st = blocks.init(ntDataCsr, n, nBlocks, blockSizeDeafult);
+    DAAL_CHECK_STATUS_VAR(st);
+    nBlocks = blocks.nBlocks();
+
     SafeStatus safeStat;
 
     TArrayScalable<algorithmFPType, cpu> goalLocal(nBlocks);
     algorithmFPType * goalLocalData = goalLocal.get();
     DAAL_CHECK_MALLOC(goalLocalData);
 
-    daal::threader_for(nBlocks, nBlocks, [=, &safeStat](const int iBlock) {
-        const size_t blockSize = ((iBlock == nBlocks - 1) ? n - iBlock * blockSizeDeafult : blockSizeDeafult);
+    daal::threader_for(nBlocks, nBlocks, [=, &safeStat, &blocks](const int iBlock) {
+        const size_t iStart    = blocks.blockStart(iBlock);
+        const size_t blockSize = blocks.blockSize(iBlock);
 
-        ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, iBlock * blockSizeDeafult, blockSize);
+        ReadRowsCSR<algorithmFPType, cpu> dataBlock(ntDataCsr, iStart, blockSize);
         DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
 
         const algorithmFPType * const data = dataBlock.values();
@@ -681,7 +1115,7 @@ Status RecalculationObservationsCSR(const size_t p, const size_t nClusters, cons
 
         int * assignments = nullptr;
 
-        WriteOnlyRows<int, cpu> assignBlock(ntAssign, iBlock * blockSizeDeafult, blockSize);
+        WriteOnlyRows<int, cpu> assignBlock(ntAssign, iStart, blockSize);
         if (ntAssign)
         {
             DAAL_CHECK_BLOCK_STATUS_THR(assignBlock);
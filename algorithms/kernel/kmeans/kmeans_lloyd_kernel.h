@@ -28,6 +28,7 @@
 //#include "kmeans_batch.h"
 #include "algorithms/kernel/kernel.h"
 #include "data_management/data/numeric_table.h"
+#include "services/host_app.h"
 
 using namespace daal::data_management;
 
@@ -43,7 +44,8 @@ template <Method method, typename algorithmFPType, CpuType cpu>
 class KMeansBatchKernel : public Kernel
 {
 public:
-    services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTable * const * a, const NumericTable * const * r,
+                             const Parameter * par);
 };
 
 template <Method method, typename algorithmFPType, CpuType cpu>
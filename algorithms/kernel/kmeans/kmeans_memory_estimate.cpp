@@ -0,0 +1,66 @@
+/* file: kmeans_memory_estimate.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Estimate of the memory allocated by K-Means algorithm in the batch processing mode
+//--
+*/
+
+#include "algorithms/kmeans/kmeans_batch.h"
+#include "algorithms/threading/threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/* Number of observations processed by a thread at once, see kmeans_lloyd_impl.i */
+const size_t blockSize = 512;
+
+size_t estimateMemorySize(const Input & input, const Parameter & parameter, size_t fpSize)
+{
+    const data_management::NumericTablePtr data = input.get(kmeans::data);
+    if (!data) return 0;
+
+    const size_t n        = data->getNumberOfRows();
+    const size_t p        = data->getNumberOfColumns();
+    const size_t k        = parameter.nClusters;
+    const size_t nThreads = daal::threader_get_threads_number();
+
+    /* Centroids, assignments, objective function and number of iterations */
+    size_t size = k * p * fpSize + (parameter.assignFlag ? n * sizeof(int) : 0) + 2 * fpSize;
+
+    /* Sums and counters of the observations of the clusters and the candidates for the empty clusters */
+    size += k * (p * fpSize + fpSize + sizeof(int) + sizeof(size_t));
+
+    /* Bounds of Hamerly's algorithm kept between the iterations */
+    if (parameter.maxIterations > 1) size += n * (sizeof(int) + fpSize) + k * (p + 1) * fpSize;
+
+    /* Per-thread distances to the clusters, rows of the block and partial sums */
+    size += nThreads * (blockSize * (k + p + 1) * fpSize + blockSize * sizeof(int) + k * (p + 1) * fpSize + k * (sizeof(int) + sizeof(size_t)));
+
+    return size;
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
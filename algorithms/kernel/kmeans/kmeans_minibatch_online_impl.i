@@ -0,0 +1,192 @@
+/* file: kmeans_minibatch_online_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch method for K-means algorithm.
+//
+//  Each data block is a mini-batch: the observations are assigned to the current centroids
+//  and added to the per-cluster sums. With the per-centroid learning rate equal to
+//  the inverse number of the observations assigned to the centroid so far,
+//  the centroid after the update is exactly the mean of all observations assigned to it.
+//--
+*/
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/threading/threading.h"
+#include "services/daal_defines.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+
+#include "algorithms/kernel/kmeans/kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+/* Centroids of the clusters with no observations assigned so far are taken from the initial centroids */
+template <typename algorithmFPType, CpuType cpu>
+Status computeMiniBatchCentroids(const size_t p, const size_t nClusters, const int * const clusterS0, const algorithmFPType * const clusterS1,
+                                 const NumericTable * const ntInitClusters, algorithmFPType * const clusters)
+{
+    bool hasEmptyClusters = false;
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        hasEmptyClusters |= (clusterS0[i] <= 0);
+    }
+
+    ReadRows<algorithmFPType, cpu> mtInitClusters;
+    const algorithmFPType * initClusters = nullptr;
+    if (hasEmptyClusters)
+    {
+        DAAL_CHECK(ntInitClusters, services::ErrorNullInputNumericTable);
+        initClusters = mtInitClusters.set(*const_cast<NumericTable *>(ntInitClusters), 0, nClusters);
+        DAAL_CHECK_BLOCK_STATUS(mtInitClusters);
+    }
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        if (clusterS0[i] > 0)
+        {
+            const algorithmFPType coeff = 1.0 / clusterS0[i];
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                clusters[i * p + j] = clusterS1[i * p + j] * coeff;
+            }
+        }
+        else
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                clusters[i * p + j] = initClusters[i * p + j];
+            }
+        }
+    }
+    return Status();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::compute(size_t na, const NumericTable * const * a, size_t nr, const NumericTable * const * r,
+                                                                 const Parameter * par)
+{
+    NumericTable * ntData  = const_cast<NumericTable *>(a[0]);
+    const size_t p         = ntData->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+
+    WriteRows<int, cpu> mtClusterS0(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusterS0);
+    int * clusterS0 = mtClusterS0.get();
+    WriteRows<algorithmFPType, cpu> mtClusterS1(*const_cast<NumericTable *>(r[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusterS1);
+    algorithmFPType * clusterS1 = mtClusterS1.get();
+    WriteRows<algorithmFPType, cpu> mtTargetFunc(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    algorithmFPType * goalFunc = mtTargetFunc.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters, p);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nClusters * p, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, sizeof(double));
+
+    TArray<algorithmFPType, cpu> clusters(nClusters * p);
+    TArray<int, cpu> blockS0(nClusters);
+    TArray<algorithmFPType, cpu> blockS1(nClusters * p);
+    TArray<double, cpu> dS1(p);
+    DAAL_CHECK_MALLOC(clusters.get() && blockS0.get() && blockS1.get() && dS1.get());
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (computeMiniBatchCentroids<algorithmFPType, cpu>(p, nClusters, clusterS0, clusterS1, a[1], clusters.get())));
+
+    algorithmFPType blockTargetFunc = algorithmFPType(0);
+    {
+        SharedPtr<task_t<algorithmFPType, cpu> > task = task_t<algorithmFPType, cpu>::create(p, nClusters, clusters.get());
+        DAAL_CHECK(task.get(), services::ErrorMemoryAllocationFailed);
+
+        s = task->template addNTToTaskThreaded<lloydDense>(ntData, nullptr);
+        if (!s)
+        {
+            task->kmeansClearClusters(nullptr);
+            return s;
+        }
+
+        task->template kmeansComputeCentroids<lloydDense>(blockS0.get(), blockS1.get(), dS1.get());
+        task->kmeansClearClusters(&blockTargetFunc);
+    }
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        clusterS0[i] += blockS0[i];
+    }
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nClusters * p; j++)
+    {
+        clusterS1[j] += blockS1[j];
+    }
+
+    goalFunc[0] += blockTargetFunc;
+    return s;
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(size_t na, const NumericTable * const * a, size_t nr,
+                                                                         const NumericTable * const * r, const Parameter * par)
+{
+    const size_t p         = a[1]->getNumberOfColumns();
+    const size_t nClusters = par->nClusters;
+
+    ReadRows<int, cpu> mtClusterS0(*const_cast<NumericTable *>(a[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusterS0);
+    ReadRows<algorithmFPType, cpu> mtClusterS1(*const_cast<NumericTable *>(a[1]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusterS1);
+    ReadRows<algorithmFPType, cpu> mtInTargetFunc(*const_cast<NumericTable *>(a[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtInTargetFunc);
+
+    WriteOnlyRows<algorithmFPType, cpu> mtClusters(*const_cast<NumericTable *>(r[0]), 0, nClusters);
+    DAAL_CHECK_BLOCK_STATUS(mtClusters);
+    WriteOnlyRows<algorithmFPType, cpu> mtTargetFunc(*const_cast<NumericTable *>(r[1]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtTargetFunc);
+    WriteOnlyRows<int, cpu> mtIterations(*const_cast<NumericTable *>(r[2]), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(mtIterations);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, (computeMiniBatchCentroids<algorithmFPType, cpu>(p, nClusters, mtClusterS0.get(), mtClusterS1.get(), a[3], mtClusters.get())));
+
+    /* The objective function is accumulated over the mini-batches with the centroids the observations were assigned to,
+       the stream is processed in a single pass */
+    *mtTargetFunc.get() = *mtInTargetFunc.get();
+    *mtIterations.get() = 1;
+    return s;
+}
+
+} // namespace internal
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -42,7 +42,13 @@ namespace interface1
  *  \param[in] _maxIterations Number of iterations
  */
 Parameter::Parameter(size_t _nClusters, size_t _maxIterations)
-    : nClusters(_nClusters), maxIterations(_maxIterations), accuracyThreshold(0.0), gamma(1.0), distanceType(euclidean), assignFlag(true)
+    : nClusters(_nClusters),
+      maxIterations(_maxIterations),
+      accuracyThreshold(0.0),
+      gamma(1.0),
+      distanceType(euclidean),
+      assignFlag(true),
+      dataStorageType(fullPrecisionStorage)
 {}
 
 /**
@@ -55,7 +61,8 @@ Parameter::Parameter(const Parameter & other)
       accuracyThreshold(other.accuracyThreshold),
       gamma(other.gamma),
       distanceType(other.distanceType),
-      assignFlag(other.assignFlag)
+      assignFlag(other.assignFlag),
+      dataStorageType(other.dataStorageType)
 {}
 
 services::Status Parameter::check() const
@@ -56,6 +56,13 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     DAAL_CHECK_STATUS_VAR(status);
     set(partialObjectiveFunction, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &status));
     DAAL_CHECK_STATUS_VAR(status);
+
+    /* The online processing mode does not keep the data blocks, so neither candidates nor assignments are collected */
+    if (method == miniBatchDense)
+    {
+        return status;
+    }
+
     set(partialCandidatesDistances, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &status));
     DAAL_CHECK_STATUS_VAR(status);
     set(partialCandidatesCentroids, HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, &status));
@@ -71,6 +78,23 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
     return status;
 }
 
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode
+ * \param[in] input        Pointer to the structure of the input objects
+ * \param[in] parameter    Pointer to the structure of the algorithm parameters
+ * \param[in] method       Computation method of the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status PartialResult::initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                       const int method)
+{
+    services::Status status;
+    DAAL_CHECK_STATUS(status, get(nObservations)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(status, get(partialSums)->assign((algorithmFPType)0.0));
+    DAAL_CHECK_STATUS(status, get(partialObjectiveFunction)->assign((algorithmFPType)0.0));
+    return status;
+}
+
 } // namespace kmeans
 } // namespace algorithms
 } // namespace daal
@@ -88,9 +88,26 @@ public:
         return norm2;
     }
 
-    algorithmFPType getGemmResult(size_t iRow, size_t iCol, size_t nRows, size_t nCols, const algorithmFPType * gemmResult) const
+    //find the candidate with the minimal value of 0.5*(c, c) - (x, c) for every row of the block,
+    //gemmResult is stored by rows: the minimal value is found first, then the first candidate having it
+    void findNearestCandidates(const algorithmFPType * cNorm2, size_t nRows, size_t nCandidates, const algorithmFPType * gemmResult,
+                               algorithmFPType * bestValue, int * bestCandidate) const
     {
-        return gemmResult[iRow * nCols + iCol];
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            const algorithmFPType * pGemm = gemmResult + iRow * nCandidates;
+            algorithmFPType valBest       = cNorm2[0] - pGemm[0];
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t iCand = 1; iCand < nCandidates; ++iCand)
+            {
+                const algorithmFPType valCand = cNorm2[iCand] - pGemm[iCand];
+                valBest                       = (valCand < valBest) ? valCand : valBest;
+            }
+            size_t iBest = 0;
+            while ((iBest + 1 < nCandidates) && (cNorm2[iBest] - pGemm[iBest] != valBest)) ++iBest;
+            bestValue[iRow]     = valBest;
+            bestCandidate[iRow] = int(iBest);
+        }
     }
 
 protected:
@@ -136,9 +153,32 @@ public:
         return res;
     }
 
-    algorithmFPType getGemmResult(size_t iRow, size_t iCol, size_t nRows, size_t nCols, const algorithmFPType * gemmResult) const
+    //find the candidate with the minimal value of 0.5*(c, c) - (x, c) for every row of the block,
+    //gemmResult is stored by candidates, so the rows are processed in the inner loop
+    void findNearestCandidates(const algorithmFPType * cNorm2, size_t nRows, size_t nCandidates, const algorithmFPType * gemmResult,
+                               algorithmFPType * bestValue, int * bestCandidate) const
     {
-        return gemmResult[iRow + iCol * nRows];
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            bestValue[iRow]     = cNorm2[0] - gemmResult[iRow];
+            bestCandidate[iRow] = 0;
+        }
+        for (size_t iCand = 1; iCand < nCandidates; ++iCand)
+        {
+            const algorithmFPType * pGemm = gemmResult + iCand * nRows;
+            const algorithmFPType norm2   = cNorm2[iCand];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
+            {
+                const algorithmFPType valCand = norm2 - pGemm[iRow];
+                const bool isBetter           = (valCand < bestValue[iRow]);
+                bestValue[iRow]               = isBetter ? valCand : bestValue[iRow];
+                bestCandidate[iRow]           = isBetter ? int(iCand) : bestCandidate[iRow];
+            }
+        }
     }
 
 protected:
@@ -428,9 +468,10 @@ protected:
 template <typename algorithmFPType, CpuType cpu>
 struct TlsPPData
 {
-    algorithmFPType * gemmResult; //result of gemm call is placed here
+    algorithmFPType * gemmResult; //result of gemm call is placed here, followed by the values of the nearest candidates per row of a block
     algorithmFPType accMinDist2;  //goal function accumulated for all blocks processed by a thread
-    int aCandidateRating[1];      //rating of candidates updated in all blocks processed by a thread
+    int * aBestCandidate;         //index of the nearest new candidate per row of a block
+    int aCandidateRating[1];      //rating of candidates updated in all blocks processed by a thread, followed by aBestCandidate
 };
 
 //TaskParallelPlusUpdateDist class is used by kmeans init batch and distributed kernel
@@ -458,8 +499,6 @@ public:
 
 protected:
     Status processBlock(size_t iBlock, TlsPPData_t * tlsLocal, size_t iFirstOfNewCandidates, size_t nNewCandidates);
-    bool findBestCandidate(typename DataHelper::BlockHelperType & blockHelper, size_t iRow, algorithmFPType * pDistSq, size_t nRowsToProcess,
-                           size_t nNewCandidates, size_t & iBestCandidate, const algorithmFPType * gemmResult) const;
 
 protected:
     size_t _nBlocks;
@@ -736,36 +775,6 @@ size_t TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::samplePoints(siz
     return iNewCandidate;
 }
 
-template <typename algorithmFPType, CpuType cpu, typename DataHelper>
-bool TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::findBestCandidate(typename DataHelper::BlockHelperType & blockHelper, size_t iRow,
-                                                                                     algorithmFPType * pDistSq, size_t nRowsToProcess,
-                                                                                     size_t nNewCandidates, size_t & iBestCandidate,
-                                                                                     const algorithmFPType * gemmResult) const
-{
-    size_t iCandidate = 0;
-    iBestCandidate    = iCandidate;
-    algorithmFPType valBest =
-        _lastAddedCenterNorm2[iCandidate] - blockHelper.getGemmResult(iRow, iCandidate, nRowsToProcess, nNewCandidates, gemmResult);
-    for (iCandidate = 1; iCandidate < nNewCandidates; ++iCandidate)
-    {
-        algorithmFPType valCand =
-            _lastAddedCenterNorm2[iCandidate] - blockHelper.getGemmResult(iRow, iCandidate, nRowsToProcess, nNewCandidates, gemmResult);
-        if (valBest > valCand)
-        {
-            valBest        = valCand;
-            iBestCandidate = iCandidate;
-        }
-    }
-    const algorithmFPType * pLastAddedCenter = _lastAddedCenter;
-    const algorithmFPType dist2              = blockHelper.getRowSumSq(iRow, pLastAddedCenter + iBestCandidate * this->_data.dim);
-    if (dist2 < pDistSq[iRow])
-    {
-        pDistSq[iRow] = dist2;
-        return true;
-    }
-    return false;
-}
-
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 Status TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::processBlock(size_t iBlock, TlsPPData_t * tlsLocal, size_t iFirstOfNewCandidates,
                                                                                   size_t nNewCandidates)
@@ -778,15 +787,20 @@ Status TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::processBloc
     typename DataHelper::BlockHelperType blockHelper(_data.ntIface(), _data.dim, iStartRow, nRowsToProcess);
     DAAL_CHECK_BLOCK_STATUS(blockHelper);
     blockHelper.callGemm(_lastAddedCenter, nRowsToProcess, nNewCandidates, tlsLocal->gemmResult);
+    blockHelper.findNearestCandidates(_lastAddedCenterNorm2, nRowsToProcess, nNewCandidates, tlsLocal->gemmResult,
+                                      tlsLocal->gemmResult + _nRowsInBlock * nNewCandidates, tlsLocal->aBestCandidate);
 
     algorithmFPType * pDistSq  = _aMinDist + iStartRow;
     auto * pNearestCandIndex   = _aNearestCandidateIdx + iStartRow;
     algorithmFPType sumOfDist2 = 0;
     for (size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
     {
-        size_t iBestCandidate = 0;
-        if (findBestCandidate(blockHelper, iRow, pDistSq, nRowsToProcess, nNewCandidates, iBestCandidate, tlsLocal->gemmResult))
+        const size_t iBestCandidate = tlsLocal->aBestCandidate[iRow];
+        //the exact distance is computed for the nearest candidate only
+        const algorithmFPType dist2 = blockHelper.getRowSumSq(iRow, _lastAddedCenter + iBestCandidate * _data.dim);
+        if (dist2 < pDistSq[iRow])
         {
+            pDistSq[iRow]             = dist2;
             const auto iPrevCandidate = pNearestCandIndex[iRow];
             pNearestCandIndex[iRow]   = iFirstOfNewCandidates + iBestCandidate;
             aCandidateRating[iPrevCandidate] -= 1;
@@ -802,16 +816,18 @@ Status TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::processBloc
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 Status TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::updateMinDist(size_t iFirstOfNewCandidates, size_t nNewCandidates)
 {
-    const size_t nCandidates  = iFirstOfNewCandidates + nNewCandidates;
-    const size_t gemmDataSize = _nRowsInBlock * nCandidates;
+    const size_t nCandidates = iFirstOfNewCandidates + nNewCandidates;
+    //gemm is computed for the new candidates only
+    const size_t gemmDataSize = _nRowsInBlock * (nNewCandidates + 1);
     daal::tls<TlsPPData_t *> tlsData([=]() -> TlsPPData_t * {
-        const size_t sz     = sizeof(TlsPPData_t) + (nCandidates - 1) * sizeof(int);
+        const size_t sz     = sizeof(TlsPPData_t) + (nCandidates + _nRowsInBlock - 1) * sizeof(int);
         byte * ptr          = service_scalable_calloc<byte, cpu>(sz);
         TlsPPData_t * pData = new (ptr) TlsPPData_t;
         //allocate memory for Intel(R) MKL result
         if (pData)
         {
-            pData->gemmResult = service_calloc<algorithmFPType, cpu>(gemmDataSize);
+            pData->aBestCandidate = pData->aCandidateRating + nCandidates;
+            pData->gemmResult     = service_calloc<algorithmFPType, cpu>(gemmDataSize);
             if (!pData->gemmResult)
             {
                 service_scalable_free<byte, cpu>(ptr);
@@ -0,0 +1,95 @@
+/* file: kmeans_predict_container.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction container.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_CONTAINER_H__
+#define __KMEANS_PREDICT_CONTAINER_H__
+
+#include "algorithms/kmeans/kmeans_predict.h"
+#include "algorithms/kernel/kmeans/kmeans_predict_kernel.h"
+#include "algorithms/kernel/kmeans/oneapi/kmeans_dense_lloyd_batch_kernel_ucapi.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu || method != defaultDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::KMeansPredictKernel, method, algorithmFPType);
+    }
+    else
+    {
+        _kernel = new kmeans::internal::KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>();
+    }
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
+
+    const data_management::NumericTable * ntData      = input->get(data).get();
+    const data_management::NumericTable * ntCentroids = input->get(inputCentroids).get();
+    data_management::NumericTable * ntAssignments     = result->get(assignments).get();
+
+    if (deviceInfo.isCpu || method != defaultDense)
+    {
+        daal::services::Environment::env & env = *_env;
+        __DAAL_CALL_KERNEL(env, internal::KMeansPredictKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, ntData, ntCentroids,
+                           ntAssignments);
+    }
+    else
+    {
+        return ((kmeans::internal::KMeansDenseLloydBatchKernelUCAPI<algorithmFPType> *)(_kernel))->predict(ntData, ntCentroids, ntAssignments);
+    }
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,47 @@
+/* file: kmeans_predict_dense_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the K-Means prediction kernel.
+//--
+*/
+
+#include "algorithms/kernel/kmeans/kmeans_predict_kernel.h"
+#include "algorithms/kernel/kmeans/kmeans_predict_impl.i"
+#include "algorithms/kernel/kmeans/kmeans_predict_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+namespace internal
+{
+template class KMeansPredictKernel<defaultDense, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,235 @@
+/* file: kmeans_predict_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Means prediction: the observations are assigned to the nearest centroids.
+//
+//  argmin_j |x - c_j|^2 = argmin_j (0.5 * |c_j|^2 - <x, c_j>), so the squared norms of the centroids are computed once,
+//  and the inner products are computed with matrix-matrix products for the blocks of the observations
+//  and the tiles of the centroids. The minimum over the tile is merged into the running minimum of the block
+//  right after the product, while the tile is still in cache.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_IMPL_I__
+#define __KMEANS_PREDICT_IMPL_I__
+
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_data_utils.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/threading/threading.h"
+#include "externals/service_blas.h"
+#include "externals/service_spblas.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+class DataBlock
+{};
+
+/* Block of the observations stored in the dense layout */
+template <typename algorithmFPType, CpuType cpu>
+class DataBlock<defaultDense, algorithmFPType, cpu>
+{
+public:
+    static Status split(NumericTable * ntData, size_t nRows, size_t maxBlockSize, CSRRowBlocks<cpu> & blocks)
+    {
+        const size_t nBlocks = nRows / maxBlockSize + !!(nRows % maxBlockSize);
+        return blocks.init(static_cast<const size_t *>(nullptr), nRows, nBlocks, maxBlockSize);
+    }
+
+    DataBlock(NumericTable * ntData, size_t iStart, size_t nRows) : _rows(ntData, iStart, nRows), _nRows(nRows) {}
+
+    const Status & status() const { return _rows.status(); }
+
+    /* distances[i + j * nRows] -= <x_i, c_j> for the centroids c_j, j < nCentroids */
+    void subtractInnerProducts(const algorithmFPType * centroids, size_t nCentroids, size_t nFeatures, algorithmFPType * distances)
+    {
+        const char transa           = 't';
+        const char transb           = 'n';
+        const DAAL_INT m            = _nRows;
+        const DAAL_INT n            = nCentroids;
+        const DAAL_INT k            = nFeatures;
+        const algorithmFPType alpha = -1.0;
+        const algorithmFPType beta  = 1.0;
+
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha, _rows.get(), &k, centroids, &k, &beta, distances, &m);
+    }
+
+private:
+    ReadRows<algorithmFPType, cpu> _rows;
+    size_t _nRows;
+};
+
+/* Block of the observations stored in the CSR layout, the row offsets and the column indices are one-based */
+template <typename algorithmFPType, CpuType cpu>
+class DataBlock<fastCSR, algorithmFPType, cpu>
+{
+public:
+    static Status split(NumericTable * ntData, size_t nRows, size_t maxBlockSize, CSRRowBlocks<cpu> & blocks)
+    {
+        const size_t nBlocks = nRows / maxBlockSize + !!(nRows % maxBlockSize);
+        return blocks.init(dynamic_cast<CSRNumericTableIface *>(ntData), nRows, nBlocks, maxBlockSize);
+    }
+
+    DataBlock(NumericTable * ntData, size_t iStart, size_t nRows) : _rows(dynamic_cast<CSRNumericTableIface *>(ntData), iStart, nRows), _nRows(nRows)
+    {}
+
+    const Status & status() const { return _rows.status(); }
+
+    void subtractInnerProducts(const algorithmFPType * centroids, size_t nCentroids, size_t nFeatures, algorithmFPType * distances)
+    {
+        const char transa           = 'n';
+        const DAAL_INT m            = _nRows;
+        const DAAL_INT n            = nCentroids;
+        const DAAL_INT k            = nFeatures;
+        const algorithmFPType alpha = -1.0;
+        const algorithmFPType beta  = 1.0;
+        const char matdescra[6]     = { 'G', 0, 0, 'F', 0, 0 };
+
+        SpBlas<algorithmFPType, cpu>::xxcsrmm(&transa, &m, &n, &k, &alpha, matdescra, _rows.values(), (DAAL_INT *)_rows.cols(),
+                                              (DAAL_INT *)_rows.rows(), centroids, &k, &beta, distances, &m);
+    }
+
+private:
+    ReadRowsCSR<algorithmFPType, cpu> _rows;
+    size_t _nRows;
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+Status KMeansPredictKernel<method, algorithmFPType, cpu>::compute(const NumericTable * ntData, const NumericTable * ntCentroids,
+                                                                  NumericTable * ntAssignments)
+{
+    NumericTable * data     = const_cast<NumericTable *>(ntData);
+    const size_t nRows      = ntData->getNumberOfRows();
+    const size_t nFeatures  = ntData->getNumberOfColumns();
+    const size_t nCentroids = ntCentroids->getNumberOfRows();
+    DAAL_CHECK(nCentroids <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    ReadRows<algorithmFPType, cpu> centroidsRows(const_cast<NumericTable *>(ntCentroids), 0, nCentroids);
+    DAAL_CHECK_BLOCK_STATUS(centroidsRows);
+    const algorithmFPType * const centroids = centroidsRows.get();
+
+    TArray<algorithmFPType, cpu> halfSqNormsArr(nCentroids);
+    DAAL_CHECK_MALLOC(halfSqNormsArr.get());
+    algorithmFPType * const halfSqNorms = halfSqNormsArr.get();
+    daal::threader_for(nCentroids, nCentroids, [&](size_t j) {
+        const algorithmFPType * const c = centroids + j * nFeatures;
+        algorithmFPType sum             = 0;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nFeatures; k++)
+        {
+            sum += c[k] * c[k];
+        }
+        halfSqNorms[j] = algorithmFPType(0.5) * sum;
+    });
+
+    /* The distances of a block of rows to a tile of centroids fit into L2 cache */
+    const size_t maxBlockSize = 512;
+    const size_t tileSize     = (nCentroids < 256 ? nCentroids : 256);
+
+    CSRRowBlocks<cpu> blocks;
+    Status st = DataBlock<method, algorithmFPType, cpu>::split(data, nRows, maxBlockSize, blocks);
+    DAAL_CHECK_STATUS_VAR(st);
+    const size_t nBlocks = blocks.nBlocks();
+
+    /* Per-thread buffer: distances of the block to the tile followed by the running minimums of the block */
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(maxBlockSize * (tileSize + 1));
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t iStart    = blocks.blockStart(iBlock);
+        const size_t blockSize = blocks.blockSize(iBlock);
+
+        algorithmFPType * const distances = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(distances);
+        algorithmFPType * const minDistances = distances + maxBlockSize * tileSize;
+
+        DataBlock<method, algorithmFPType, cpu> dataBlock(data, iStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+
+        WriteOnlyRows<int, cpu> assignmentsRows(ntAssignments, iStart, blockSize);
+        DAAL_CHECK_BLOCK_STATUS_THR(assignmentsRows);
+        int * const assignments = assignmentsRows.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            minDistances[i] = services::internal::MaxVal<algorithmFPType>::get();
+            assignments[i]  = 0;
+        }
+
+        for (size_t jStart = 0; jStart < nCentroids; jStart += tileSize)
+        {
+            const size_t jSize = (jStart + tileSize < nCentroids ? tileSize : nCentroids - jStart);
+
+            for (size_t j = 0; j < jSize; j++)
+            {
+                const algorithmFPType halfSqNorm = halfSqNorms[jStart + j];
+                algorithmFPType * const d        = distances + j * blockSize;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < blockSize; i++)
+                {
+                    d[i] = halfSqNorm;
+                }
+            }
+
+            dataBlock.subtractInnerProducts(centroids + jStart * nFeatures, jSize, nFeatures, distances);
+
+            /* The centroids are visited in the increasing order, so the ties are resolved to the smallest index */
+            for (size_t j = 0; j < jSize; j++)
+            {
+                const algorithmFPType * const d = distances + j * blockSize;
+                const int index                 = (int)(jStart + j);
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < blockSize; i++)
+                {
+                    const bool isCloser = d[i] < minDistances[i];
+                    minDistances[i]     = isCloser ? d[i] : minDistances[i];
+                    assignments[i]      = isCloser ? index : assignments[i];
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,55 @@
+/* file: kmeans_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that assigns the observations to the nearest K-Means centroids.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_KERNEL_H__
+#define __KMEANS_PREDICT_KERNEL_H__
+
+#include "algorithms/kmeans/kmeans_predict_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace internal
+{
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansPredictKernel : public Kernel
+{
+public:
+    services::Status compute(const data_management::NumericTable * ntData, const data_management::NumericTable * ntCentroids,
+                             data_management::NumericTable * ntAssignments);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,120 @@
+/* file: kmeans_predict_types.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the classes of the K-Means prediction.
+//--
+*/
+
+#include "algorithms/kmeans/kmeans_predict_types.h"
+#include "services/daal_defines.h"
+#include "service/kernel/serialization_utils.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_KMEANS_PREDICTION_RESULT_ID);
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+
+/**
+ * Returns an input object of the K-Means prediction
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets an input object of the K-Means prediction
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the %Input object
+ * \param[in] par       Pointer to the parameters of the algorithm
+ * \param[in] method    Algorithm computation method
+ */
+Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    Status s;
+    const int expectedLayout = (method == fastCSR ? (int)NumericTableIface::csrArray : 0);
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(data).get(), dataStr(), 0, expectedLayout));
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    return checkNumericTable(get(inputCentroids).get(), inputCentroidsStr(), (int)packed_mask, 0, nFeatures);
+}
+
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the K-Means prediction
+ * \param[in] id   Identifier of the result, \ref ResultId
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets the result of the K-Means prediction
+ * \param[in] id        Identifier of the result
+ * \param[in] value     Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in      Pointer to the %input objects
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const
+{
+    const Input * input  = static_cast<const Input *>(in);
+    const size_t nRows   = input->get(data)->getNumberOfRows();
+    const int unexpected = (int)packed_mask;
+    return checkNumericTable(get(assignments).get(), assignmentsStr(), unexpected, 0, 1, nRows);
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
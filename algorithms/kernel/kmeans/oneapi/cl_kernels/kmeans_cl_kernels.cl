@@ -147,7 +147,7 @@ DECLARE_SOURCE(
         int minIdx             = -1;
         for (int i = 0; i < numgrp; i++)
         {
-            algorithmFPType curVal   = (i == numgrp - 1 && local_id >= rem) ? HUGE : distances[global_id + N * (local_id + i * size)];
+            algorithmFPType curVal   = (i == numgrp - 1 && rem > 0 && local_id >= rem) ? HUGE : distances[global_id + N * (local_id + i * size)];
             algorithmFPType localMin = sub_group_reduce_min(curVal);
             if (localMin < minVal)
             {
@@ -156,7 +156,8 @@ DECLARE_SOURCE(
             }
         }
         int curInd = 1;
-        if (minIdx < numgrp - 1 || local_id < rem) curInd = (distances[global_id + N * (local_id + minIdx * size)] > minVal) ? 1 : -local_id;
+        if (minIdx < numgrp - 1 || rem == 0 || local_id < rem)
+            curInd = (distances[global_id + N * (local_id + minIdx * size)] > minVal) ? 1 : -local_id;
         int ind = minIdx * size - sub_group_reduce_min(curInd);
         if (local_id == 0)
         {
@@ -335,6 +336,27 @@ DECLARE_SOURCE(
         assignments[global_id] = minIdx;
     }
 
+    __kernel void refine_assigned_distances(__global const algorithmFPType * data, __global const algorithmFPType * centroids,
+                                            __global const int * assignments, __global algorithmFPType * distances,
+                                            __global algorithmFPType * mindistances, int N, int nFeatures) {
+        const int global_id = get_global_id(0);
+
+        if (global_id < N)
+        {
+            const int cl_id                           = assignments[global_id];
+            __global const algorithmFPType * row      = &data[global_id * nFeatures];
+            __global const algorithmFPType * centroid = &centroids[cl_id * nFeatures];
+
+            algorithmFPType dist = 0.0;
+            for (int i = 0; i < nFeatures; i++)
+            {
+                dist += centroid[i] * (0.5 * centroid[i] - row[i]);
+            }
+            distances[global_id + cl_id * N] = dist;
+            mindistances[global_id]          = dist;
+        }
+    }
+
     __kernel void partial_reduce_centroids(__global const algorithmFPType * data, __global const algorithmFPType * distances,
                                            __global const int * assignments, __global algorithmFPType * partialCentroids,
                                            __global int * partialCentroidsCounters, int N, int K, int P, int doReset) {
@@ -46,6 +46,9 @@ class KMeansDenseLloydBatchKernelUCAPI : public Kernel
 public:
     services::Status compute(const NumericTable * const * a, const NumericTable * const * r, const Parameter * par);
 
+    /* Assigns the observations to the nearest of the given centroids without updating the centroids */
+    services::Status predict(const NumericTable * ntData, const NumericTable * ntCentroids, NumericTable * ntAssignments);
+
 private:
     void computeSquares(oneapi::internal::ExecutionContextIface & context, const oneapi::internal::KernelPtr & kernel_compute_squares,
                         const services::Buffer<algorithmFPType> & data, oneapi::internal::UniversalBuffer & dataSq, uint32_t nRows,
@@ -63,6 +66,11 @@ private:
                             oneapi::internal::UniversalBuffer & distances, const services::Buffer<int> & assignments,
                             oneapi::internal::UniversalBuffer & mindistances, uint32_t blockSize, uint32_t nClusters, services::Status * st);
 
+    void refineAssignedDistances(oneapi::internal::ExecutionContextIface & context, const oneapi::internal::KernelPtr & kernel_refine_distances,
+                                 const services::Buffer<algorithmFPType> & data, const services::Buffer<algorithmFPType> & centroids,
+                                 const services::Buffer<int> & assignments, oneapi::internal::UniversalBuffer & distances,
+                                 oneapi::internal::UniversalBuffer & mindistances, uint32_t blockSize, uint32_t nFeatures, services::Status * st);
+
     void computePartialCandidates(oneapi::internal::ExecutionContextIface & context, const oneapi::internal::KernelPtr & kernel_partial_candidates,
                                   const services::Buffer<int> & assignments, oneapi::internal::UniversalBuffer & mindistances,
                                   oneapi::internal::UniversalBuffer & dataSq, oneapi::internal::UniversalBuffer & candidates,
@@ -29,6 +29,7 @@
 #include "oneapi/internal/execution_context.h"
 #include "oneapi/internal/types.h"
 #include "service/kernel/oneapi/blas_gpu.h"
+#include "service/kernel/oneapi/reduced_precision.h"
 
 #include "externals/service_ittnotify.h"
 
@@ -177,6 +178,8 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
     auto update_objective_function  = kernel_factory.getKernel("update_objective_function", &st);
     auto compute_partial_candidates = kernel_factory.getKernel("partial_candidates", &st);
     auto merge_partial_candidates   = kernel_factory.getKernel("merge_candidates", &st);
+    auto refine_assigned_distances  = kernel_factory.getKernel("refine_assigned_distances", &st);
+    DAAL_CHECK_STATUS_VAR(st);
 
     BlockDescriptor<algorithmFPType> inCentroidsRows;
     ntInCentroids->getBlockOfRows(0, nClusters, readOnly, inCentroidsRows);
@@ -195,8 +198,44 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
     size_t iter    = 0;
     size_t nBlocks = nRows / blockSize + int(nRows % blockSize != 0);
 
+    // With the reduced precision storage the data is packed to 16-bit values once and the centroids are packed on every iteration,
+    // the assignments are computed from the packed values and the distances to the assigned centroids are recomputed
+    // in the precision of the algorithm for the objective function and the candidates for the empty clusters
+    const bool isReducedPrecision     = par->dataStorageType != fullPrecisionStorage;
+    const math::PackedType packedType = par->dataStorageType == bfloat16Storage ? math::PackedType::bfloat16 : math::PackedType::float16;
+    UniversalBuffer packedData;
+    UniversalBuffer packedDataSq;
+    UniversalBuffer packedCentroids;
+    if (isReducedPrecision)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nFeatures);
+        packedData = context.allocate(math::ReducedPrecision::packedTypeId(), nRows * nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        packedDataSq = context.allocate(TypeIds::id<algorithmFPType>(), nRows, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        packedCentroids = context.allocate(math::ReducedPrecision::packedTypeId(), nClusters * nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        for (size_t block = 0; block < nBlocks; block++)
+        {
+            const size_t first        = block * blockSize;
+            const size_t curBlockSize = first + blockSize > nRows ? nRows - first : blockSize;
+
+            BlockDescriptor<algorithmFPType> dataRows;
+            DAAL_CHECK_STATUS_VAR(ntData->getBlockOfRows(first, curBlockSize, readOnly, dataRows));
+            DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::pack<algorithmFPType>(packedType, dataRows.getBuffer(), curBlockSize, nFeatures, packedData,
+                                                                                first, packedDataSq, algorithmFPType(0.5)));
+            DAAL_CHECK_STATUS_VAR(ntData->releaseBlockOfRows(dataRows));
+        }
+    }
+
     for (; iter < nIter; iter++)
     {
+        if (isReducedPrecision)
+        {
+            DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::pack<algorithmFPType>(packedType, inCentroids, nClusters, nFeatures, packedCentroids, 0,
+                                                                                centroidsSq, algorithmFPType(0.5)));
+        }
         for (size_t block = 0; block < nBlocks; block++)
         {
             size_t first = block * blockSize;
@@ -217,14 +256,29 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
             ntAssignments->getBlockOfRows(first, curBlockSize, writeOnly, assignmentsRows);
             auto assignments = assignmentsRows.getBuffer();
 
-            computeSquares(context, compute_squares, inCentroids, centroidsSq, nClusters, nFeatures, &st);
-            DAAL_CHECK_STATUS_VAR(st);
-            initDistances(context, init_distances, centroidsSq, distances, curBlockSize, nClusters, &st);
-            DAAL_CHECK_STATUS_VAR(st);
-            computeDistances(context, data, inCentroids, distances, blockSize, nClusters, nFeatures, &st);
-            DAAL_CHECK_STATUS_VAR(st);
-            computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
-            DAAL_CHECK_STATUS_VAR(st);
+            if (isReducedPrecision)
+            {
+                // distances[i + j * curBlockSize] = 0.5 * |c_j|^2 - <x_i, c_j> computed from the packed data and centroids
+                DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::gemm<algorithmFPType>(packedType, packedData, first, curBlockSize, packedCentroids, 0,
+                                                                                    nClusters, nFeatures, algorithmFPType(-1.0), centroidsSq,
+                                                                                    distances, 1, curBlockSize));
+                computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+                refineAssignedDistances(context, refine_assigned_distances, data, inCentroids, assignments, distances, mindistances, curBlockSize,
+                                        nFeatures, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+            }
+            else
+            {
+                computeSquares(context, compute_squares, inCentroids, centroidsSq, nClusters, nFeatures, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+                initDistances(context, init_distances, centroidsSq, distances, curBlockSize, nClusters, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+                computeDistances(context, data, inCentroids, distances, blockSize, nClusters, nFeatures, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+                computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
+                DAAL_CHECK_STATUS_VAR(st);
+            }
             computeSquares(context, compute_squares, data, dataSq, curBlockSize, nFeatures, &st);
             DAAL_CHECK_STATUS_VAR(st);
             computePartialCandidates(context, compute_partial_candidates, assignments, mindistances, dataSq, candidates, candidateDistances,
@@ -292,6 +346,11 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
 
         inCentroids = outCentroids;
     }
+    if (isReducedPrecision)
+    {
+        DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::pack<algorithmFPType>(packedType, inCentroids, nClusters, nFeatures, packedCentroids, 0,
+                                                                            centroidsSq, algorithmFPType(0.5)));
+    }
     for (size_t block = 0; block < nBlocks; block++)
     {
         size_t first = block * blockSize;
@@ -312,14 +371,28 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
         ntAssignments->getBlockOfRows(first, curBlockSize, writeOnly, assignmentsRows);
         auto assignments = assignmentsRows.getBuffer();
 
-        computeSquares(context, compute_squares, inCentroids, centroidsSq, nClusters, nFeatures, &st);
-        DAAL_CHECK_STATUS_VAR(st);
-        initDistances(context, init_distances, centroidsSq, distances, curBlockSize, nClusters, &st);
-        DAAL_CHECK_STATUS_VAR(st);
-        computeDistances(context, data, inCentroids, distances, blockSize, nClusters, nFeatures, &st);
-        DAAL_CHECK_STATUS_VAR(st);
-        computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
-        DAAL_CHECK_STATUS_VAR(st);
+        if (isReducedPrecision)
+        {
+            DAAL_CHECK_STATUS_VAR(math::ReducedPrecision::gemm<algorithmFPType>(packedType, packedData, first, curBlockSize, packedCentroids, 0,
+                                                                                nClusters, nFeatures, algorithmFPType(-1.0), centroidsSq, distances,
+                                                                                1, curBlockSize));
+            computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            refineAssignedDistances(context, refine_assigned_distances, data, inCentroids, assignments, distances, mindistances, curBlockSize,
+                                    nFeatures, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        else
+        {
+            computeSquares(context, compute_squares, inCentroids, centroidsSq, nClusters, nFeatures, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            initDistances(context, init_distances, centroidsSq, distances, curBlockSize, nClusters, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            computeDistances(context, data, inCentroids, distances, blockSize, nClusters, nFeatures, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
         computeSquares(context, compute_squares, data, dataSq, curBlockSize, nFeatures, &st);
         DAAL_CHECK_STATUS_VAR(st);
         updateObjectiveFunction(context, update_objective_function, dataSq, distances, assignments, objFunction, curBlockSize, nClusters,
@@ -344,6 +417,97 @@ Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::compute(const NumericT
     return st;
 }
 
+template <typename algorithmFPType>
+Status KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::predict(const NumericTable * ntData, const NumericTable * ntCentroids,
+                                                                  NumericTable * ntAssignments)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(predict);
+
+    Status st;
+
+    auto & context        = Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernel_factory = context.getClKernelFactory();
+
+    NumericTable * ntInData      = const_cast<NumericTable *>(ntData);
+    NumericTable * ntInCentroids = const_cast<NumericTable *>(ntCentroids);
+
+    const size_t nRows     = ntInData->getNumberOfRows();
+    const size_t nFeatures = ntInData->getNumberOfColumns();
+    const size_t nClusters = ntInCentroids->getNumberOfRows();
+
+    auto fptype_name   = oneapi::internal::getKeyFPType<algorithmFPType>();
+    auto build_options = fptype_name;
+
+    build_options.add(getBuildOptions(nClusters));
+
+    services::String cachekey("__daal_algorithms_kmeans_lloyd_dense_batch_");
+    cachekey.add(fptype_name);
+    cachekey.add(build_options.c_str());
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(predict.buildProgram);
+        kernel_factory.build(ExecutionTargetIds::device, cachekey.c_str(), kmeans_cl_kernels, build_options.c_str());
+    }
+
+    /* Only the distances of a block to all the centroids are kept, so the block is limited by the number of clusters */
+    const size_t nValuesInBlock = 1024 * 1024 * 1024 / sizeof(algorithmFPType);
+    size_t blockSize            = nValuesInBlock / nClusters;
+    if (blockSize < 1)
+    {
+        return Status(ErrorKMeansNumberOfClustersIsTooLarge);
+    }
+    if (blockSize > nRows)
+    {
+        blockSize = nRows;
+    }
+
+    auto centroidsSq  = context.allocate(TypeIds::id<algorithmFPType>(), nClusters, &st);
+    auto distances    = context.allocate(TypeIds::id<algorithmFPType>(), blockSize * nClusters, &st);
+    auto mindistances = context.allocate(TypeIds::id<algorithmFPType>(), blockSize, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    auto compute_squares = kernel_factory.getKernel(getComputeSquaresKernelName(nFeatures), &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto init_distances      = kernel_factory.getKernel("init_distances", &st);
+    auto compute_assignments = kernel_factory.getKernel("reduce_assignments", &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    BlockDescriptor<algorithmFPType> centroidsRows;
+    DAAL_CHECK_STATUS_VAR(ntInCentroids->getBlockOfRows(0, nClusters, readOnly, centroidsRows));
+    auto centroids = centroidsRows.getBuffer();
+
+    /* 0.5 * |c_j|^2 is computed once for all the blocks */
+    computeSquares(context, compute_squares, centroids, centroidsSq, nClusters, nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const size_t nBlocks = nRows / blockSize + size_t(nRows % blockSize != 0);
+    for (size_t block = 0; block < nBlocks; block++)
+    {
+        const size_t first        = block * blockSize;
+        const size_t curBlockSize = first + blockSize > nRows ? nRows - first : blockSize;
+
+        BlockDescriptor<algorithmFPType> dataRows;
+        DAAL_CHECK_STATUS_VAR(ntInData->getBlockOfRows(first, curBlockSize, readOnly, dataRows));
+        auto data = dataRows.getBuffer();
+
+        BlockDescriptor<int> assignmentsRows;
+        DAAL_CHECK_STATUS_VAR(ntAssignments->getBlockOfRows(first, curBlockSize, writeOnly, assignmentsRows));
+        auto assignments = assignmentsRows.getBuffer();
+
+        initDistances(context, init_distances, centroidsSq, distances, curBlockSize, nClusters, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        computeDistances(context, data, centroids, distances, curBlockSize, nClusters, nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        computeAssignments(context, compute_assignments, distances, assignments, mindistances, curBlockSize, nClusters, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+
+        DAAL_CHECK_STATUS_VAR(ntInData->releaseBlockOfRows(dataRows));
+        DAAL_CHECK_STATUS_VAR(ntAssignments->releaseBlockOfRows(assignmentsRows));
+    }
+
+    return ntInCentroids->releaseBlockOfRows(centroidsRows);
+}
+
 template <typename algorithmFPType>
 uint32_t KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::getCandidatePartNum(uint32_t nClusters)
 {
@@ -533,6 +697,43 @@ void KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::computeAssignments(Execu
     }
 }
 
+template <typename algorithmFPType>
+void KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::refineAssignedDistances(ExecutionContextIface & context,
+                                                                                const KernelPtr & kernel_refine_distances,
+                                                                                const Buffer<algorithmFPType> & data,
+                                                                                const Buffer<algorithmFPType> & centroids,
+                                                                                const Buffer<int> & assignments, UniversalBuffer & distances,
+                                                                                UniversalBuffer & mindistances, uint32_t blockSize,
+                                                                                uint32_t nFeatures, Status * st)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.refineAssignedDistances);
+
+    KernelArguments args(7);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, centroids, AccessModeIds::read);
+    args.set(2, assignments, AccessModeIds::read);
+    args.set(3, distances, AccessModeIds::readwrite);
+    args.set(4, mindistances, AccessModeIds::write);
+    args.set(5, blockSize);
+    args.set(6, nFeatures);
+
+    size_t workgroupsCount = getWorkgroupsCount(blockSize);
+
+    KernelRange local_range(_maxWorkItemsPerGroup);
+    KernelRange global_range(workgroupsCount * _maxWorkItemsPerGroup);
+
+    KernelNDRange range(1);
+    range.global(global_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+    range.local(local_range, st);
+    DAAL_CHECK_STATUS_PTR(st);
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.refineAssignedDistances.run);
+        context.run(range, kernel_refine_distances, args, st);
+    }
+}
+
 template <typename algorithmFPType>
 void KMeansDenseLloydBatchKernelUCAPI<algorithmFPType>::computePartialCandidates(
     ExecutionContextIface & context, const KernelPtr & kernel_partial_candidates, const Buffer<int> & assignments, UniversalBuffer & mindistances,
@@ -42,7 +42,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LASSO_REGRESSION_PREDICTION_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : linear_model::prediction::Input(lastModelInputId + 1) {}
+Input::Input() : linear_model::prediction::Input(linear_model::prediction::lastModelCollectionInputId + 1) {}
 Input::Input(const Input & other) : linear_model::prediction::Input(other) {}
 
 /**
@@ -85,7 +85,7 @@ void Input::set(ModelInputId id, const lasso_regression::ModelPtr & value)
     linear_model::prediction::Input::set(linear_model::prediction::ModelInputId(id), value);
 }
 
-Result::Result() : linear_model::prediction::Result(lastResultId + 1) {}
+Result::Result() : linear_model::prediction::Result(linear_model::prediction::lastResultCollectionId + 1) {}
 
 /**
  * Returns the result of lasso regression model-based prediction
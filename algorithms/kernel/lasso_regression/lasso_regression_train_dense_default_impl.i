@@ -31,6 +31,7 @@
 #include "service/kernel/service_algo_utils.h"
 #include "algorithms/optimization_solver/objective_function/mse_batch.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_batch.h"
+#include "algorithms/kernel/optimization_solver/coordinate_descent/coordinate_descent_dense_gram_impl.i"
 
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_math.h"
@@ -64,10 +65,10 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
     const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
     DAAL_ASSERT(p == m.getNumberOfBetas());
 
-    algorithmFPType * xMeansPtr;
+    algorithmFPType * xMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> xMeans;
 
-    algorithmFPType * yMeansPtr;
+    algorithmFPType * yMeansPtr = nullptr;
     daal::internal::TArray<algorithmFPType, cpu> yMeans;
 
     NumericTablePtr xTrain = x;
@@ -192,29 +193,24 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             }
         });
     }
+    if (par.lassoParametersPath)
+    {
+        return computePath(xTrain, yTrain, xMeansPtr, yMeansPtr, m, res, par, objFunc);
+    }
+
     services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver); //par.optimizationSolver->clone();
     if (!pSolver.get())
     {
         //create cd solver
-        services::SharedPtr<optimization_solver::coordinate_descent::Batch<algorithmFPType> > cdAlgorithm =
-            optimization_solver::coordinate_descent::Batch<algorithmFPType>::create();
-        NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(
-            nDependentVariables, p,
-            &s); //;data_management::HomogenNumericTable<algorithmFPType>::create(nDependentVariables, p, NumericTable::doAllocate, 0, &s);
+        pSolver = createDefaultSolver();
+        NumericTablePtr pArg = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(nDependentVariables, p, &s);
         DAAL_CHECK_STATUS_VAR(s);
         daal::internal::WriteRows<algorithmFPType, cpu> pArgBD(pArg.get(), 0, p);
         DAAL_CHECK_BLOCK_STATUS(pArgBD);
         algorithmFPType * pArgPtr = pArgBD.get();
         daal::services::internal::service_memset<algorithmFPType, cpu>(pArgPtr, 0, nDependentVariables * p);
 
-        cdAlgorithm->input.set(optimization_solver::iterative_solver::inputArgument, pArg);
-
-        cdAlgorithm->parameter().nIterations            = 10000;
-        cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
-        cdAlgorithm->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
-        cdAlgorithm->parameter().positive               = false;
-        cdAlgorithm->parameter().skipTheFirstComponents = true;
-        pSolver                                         = cdAlgorithm;
+        pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, pArg);
     }
 
     objFunc->input.set(mse::data, xTrain);
@@ -242,11 +238,147 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
 
     //write data to model
     daal::internal::ReadRows<algorithmFPType, cpu> ar(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), 0, p);
-    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nDependentVariables);
     DAAL_CHECK_BLOCK_STATUS(ar);
+    return setModel(ar.get(), xMeansPtr, yMeansPtr, m);
+}
+
+template <typename algorithmFPType, lasso_regression::training::Method method, CpuType cpu>
+services::SharedPtr<optimization_solver::iterative_solver::Batch> TrainBatchKernel<algorithmFPType, method, cpu>::createDefaultSolver()
+{
+    services::SharedPtr<optimization_solver::coordinate_descent::Batch<algorithmFPType> > cdAlgorithm =
+        optimization_solver::coordinate_descent::Batch<algorithmFPType>::create();
+    cdAlgorithm->parameter().nIterations            = 10000;
+    cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
+    cdAlgorithm->parameter().selection              = optimization_solver::coordinate_descent::cyclic;
+    cdAlgorithm->parameter().positive               = false;
+    cdAlgorithm->parameter().skipTheFirstComponents = true;
+    cdAlgorithm->parameter().screening              = true;
+    return cdAlgorithm;
+}
+
+/**
+ *  \brief Trains the models for all penalties of the regularization path, the solution for the previous penalty
+ *         is the initial point for the next one. If the Gram matrix fits into memory and the default solver is used,
+ *         the coordinate descent runs over the Gram matrix computed once for all penalties of the path.
+ *         The model of the last penalty of the path is the main result.
+ */
+template <typename algorithmFPType, lasso_regression::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::computePath(
+    const NumericTablePtr & x, const NumericTablePtr & y, const algorithmFPType * xMeans, const algorithmFPType * yMeans, lasso_regression::Model & m,
+    Result & res, const Parameter & par, services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc)
+{
+    services::Status s;
+    const size_t nFeatures           = x->getNumberOfColumns();
+    const size_t nRows               = x->getNumberOfRows();
+    const size_t p                   = nFeatures + 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+    const size_t maxGramFeatures     = 4096;
+
+    NumericTable * penaltyL1Path = par.lassoParametersPath.get();
+    const size_t nPath           = penaltyL1Path->getNumberOfRows();
+    const size_t nL1Columns      = penaltyL1Path->getNumberOfColumns();
+    daal::internal::ReadRows<algorithmFPType, cpu> l1BD(penaltyL1Path, 0, nPath);
+    DAAL_CHECK_BLOCK_STATUS(l1BD);
+    const algorithmFPType * l1 = l1BD.get();
+
+    data_management::DataCollectionPtr models = res.get(pathModels);
+    DAAL_CHECK(models && models->size() == nPath, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, p, nDependentVariables);
+    daal::internal::TArray<algorithmFPType, cpu> argumentT(p * nDependentVariables);
+    algorithmFPType * argument = argumentT.get();
+    DAAL_CHECK_MALLOC(argument);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(argument, 0, p * nDependentVariables);
+
+    if (!par.optimizationSolver && nFeatures <= nRows && nFeatures <= maxGramFeatures)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nDependentVariables);
+        daal::internal::TArray<algorithmFPType, cpu> gramT(nFeatures * nFeatures);
+        daal::internal::TArray<algorithmFPType, cpu> xyT(nFeatures * nDependentVariables);
+        algorithmFPType * gram = gramT.get();
+        algorithmFPType * xy   = xyT.get();
+        DAAL_CHECK_MALLOC(gram && xy);
+        {
+            daal::internal::ReadRows<algorithmFPType, cpu> xBD(x.get(), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(xBD);
+            daal::internal::ReadRows<algorithmFPType, cpu> yBD(y.get(), 0, nRows);
+            DAAL_CHECK_BLOCK_STATUS(yBD);
+            coordinate_descent::internal::computeGram<algorithmFPType, cpu>(xBD.get(), yBD.get(), nRows, nFeatures, nDependentVariables, gram, xy);
+        }
+        if (par.optResultToCompute & computeGramMatrix)
+        {
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> gramBD(res.get(gramMatrixId).get(), 0, nFeatures);
+            DAAL_CHECK_BLOCK_STATUS(gramBD);
+            const int result = daal::services::internal::daal_memcpy_s(gramBD.get(), nFeatures * nFeatures * sizeof(algorithmFPType), gram,
+                                                                       nFeatures * nFeatures * sizeof(algorithmFPType));
+            DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        }
+
+        coordinate_descent::internal::GramTask<algorithmFPType, cpu> task(gram, xy, nFeatures, nDependentVariables, nRows);
+        algorithmFPType l1Prev = 0;
+        for (size_t i = 0; i < nPath; i++)
+        {
+            const algorithmFPType l1Value = l1[i * nL1Columns];
+            size_t nSweeps                = 0;
+            DAAL_CHECK_STATUS(s, task.compute(argument + nDependentVariables, l1Value, algorithmFPType(0), l1Prev, 10000, 0.00001, nSweeps));
+            l1Prev = l1Value;
+
+            lasso_regression::Model * pathModel = lasso_regression::Model::cast((*models)[i]).get();
+            DAAL_CHECK_STATUS(s, setModel(argument, xMeans, yMeans, *pathModel));
+        }
+        return setModel(argument, xMeans, yMeans, m);
+    }
+
+    services::SharedPtr<optimization_solver::iterative_solver::Batch> pSolver(par.optimizationSolver);
+    if (!pSolver.get()) pSolver = createDefaultSolver();
+
+    objFunc->input.set(mse::data, x);
+    objFunc->input.set(mse::dependentVariables, y);
+    objFunc->parameter().interceptFlag = false;
+    pSolver->getParameter()->function  = objFunc;
+
+    NumericTablePtr argumentTable = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(argument, nDependentVariables, p, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    pSolver->getInput()->set(optimization_solver::iterative_solver::inputArgument, argumentTable);
+
+    for (size_t i = 0; i < nPath; i++)
+    {
+        algorithmFPType * l1Row        = const_cast<algorithmFPType *>(l1 + i * nL1Columns);
+        NumericTablePtr penaltyL1Table = daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>::create(l1Row, nL1Columns, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        objFunc->parameter().penaltyL1 = penaltyL1Table;
+
+        DAAL_CHECK_STATUS(s, pSolver->compute());
+
+        /* Warm start: the solution for the current penalty is the initial point for the next one */
+        daal::internal::ReadRows<algorithmFPType, cpu> ar(*(pSolver->getResult()->get(optimization_solver::iterative_solver::minimum)), 0, p);
+        DAAL_CHECK_BLOCK_STATUS(ar);
+        const int result = daal::services::internal::daal_memcpy_s(argument, p * nDependentVariables * sizeof(algorithmFPType), ar.get(),
+                                                                   p * nDependentVariables * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+        lasso_regression::Model * pathModel = lasso_regression::Model::cast((*models)[i]).get();
+        DAAL_CHECK_STATUS(s, setModel(argument, xMeans, yMeans, *pathModel));
+    }
+    return setModel(argument, xMeans, yMeans, m);
+}
+
+/**
+ *  \brief Copies the argument of size p x nDependentVariables of the objective function into the coefficients of the model,
+ *         the intercept is computed from the means of the centered data if they are given
+ */
+template <typename algorithmFPType, lasso_regression::training::Method method, CpuType cpu>
+services::Status TrainBatchKernel<algorithmFPType, method, cpu>::setModel(const algorithmFPType * a, const algorithmFPType * xMeansPtr,
+                                                                         const algorithmFPType * yMeansPtr, lasso_regression::Model & m)
+{
+    const size_t p                   = m.getNumberOfBetas();
+    const size_t nFeatures           = p - 1;
+    const size_t nDependentVariables = m.getBeta()->getNumberOfRows();
+
+    daal::internal::WriteRows<algorithmFPType, cpu> br(*m.getBeta(), 0, nDependentVariables);
     DAAL_CHECK_BLOCK_STATUS(br);
-    const algorithmFPType * a = ar.get();
-    algorithmFPType * pBeta   = br.get();
+    algorithmFPType * pBeta = br.get();
 
     for (size_t i = 0; i < nDependentVariables; i++)
     {
@@ -255,10 +387,11 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
             pBeta[i * p + j] = a[j * nDependentVariables + i];
         }
     }
-    if (par.interceptFlag)
+    if (xMeansPtr)
     {
         daal::internal::TArray<algorithmFPType, cpu> dotPtr(nDependentVariables);
         algorithmFPType * dot = dotPtr.get();
+        DAAL_CHECK_MALLOC(dot);
         for (size_t i = 0; i < nDependentVariables; i++) dot[i] = 0;
 
         for (size_t i = 0; i < nDependentVariables; i++)
@@ -275,7 +408,7 @@ services::Status TrainBatchKernel<algorithmFPType, method, cpu>::compute(
         for (size_t j = 0; j < nDependentVariables; ++j) pBeta[p * j + 0] = 0;
     }
 
-    return s;
+    return services::Status();
 }
 
 } /* namespace internal */
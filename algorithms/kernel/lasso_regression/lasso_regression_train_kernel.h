@@ -50,6 +50,16 @@ public:
     services::Status compute(const HostAppIfacePtr & pHost, const NumericTablePtr & x, const NumericTablePtr & y, lasso_regression::Model & m,
                              Result & res, const Parameter & par,
                              services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc);
+
+private:
+    services::Status computePath(const NumericTablePtr & x, const NumericTablePtr & y, const algorithmFPType * xMeans, const algorithmFPType * yMeans,
+                                 lasso_regression::Model & m, Result & res, const Parameter & par,
+                                 services::SharedPtr<daal::algorithms::optimization_solver::mse::Batch<algorithmFPType> > & objFunc);
+
+    static services::SharedPtr<daal::algorithms::optimization_solver::iterative_solver::Batch> createDefaultSolver();
+
+    static services::Status setModel(const algorithmFPType * argument, const algorithmFPType * xMeans, const algorithmFPType * yMeans,
+                                     lasso_regression::Model & m);
 };
 
 } // namespace internal
@@ -39,7 +39,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LASSO_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultNumericTableId + 1) {}
+Result::Result() : linear_model::training::Result(lastOptionalResultModelCollectionId + 1) {}
 
 /**
  * Returns the result of lasso regression model-based training
@@ -81,6 +81,26 @@ void Result::set(OptionalResultNumericTableId id, const data_management::Numeric
     Argument::set(id, value);
 }
 
+/**
+* Returns the collection of models of the regularization path
+* \param[in] id    Identifier of the result
+* \return          Collection of models that corresponds to the given identifier
+*/
+data_management::DataCollectionPtr Result::get(OptionalResultModelCollectionId id) const
+{
+    return services::staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+* Sets the collection of models of the regularization path
+* \param[in] id      Identifier of the result
+* \param[in] value   Collection of models
+*/
+void Result::set(OptionalResultModelCollectionId id, const data_management::DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of lasso regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -105,6 +125,16 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
         s |= data_management::checkNumericTable(get(gramMatrixId).get(), gramMatrixStr(), 0, 0, in->getNumberOfFeatures(), in->getNumberOfFeatures());
 
     s |= lasso_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+
+    if (p->lassoParametersPath)
+    {
+        const data_management::DataCollectionPtr models = get(pathModels);
+        DAAL_CHECK(models && models->size() == p->lassoParametersPath->getNumberOfRows(), ErrorIncorrectNumberOfElementsInResultCollection);
+        for (size_t i = 0; i < models->size() && s; i++)
+        {
+            s |= lasso_regression::checkModel(lasso_regression::Model::cast((*models)[i]).get(), *par, nBeta, nResponses, method);
+        }
+    }
     return s;
 }
 
@@ -51,6 +51,21 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
     DAAL_CHECK_MALLOC(mImpl)
     set(model, lasso_regression::ModelPtr(mImpl));
 
+    if (parameter->lassoParametersPath)
+    {
+        const size_t nPath = parameter->lassoParametersPath->getNumberOfRows();
+        data_management::DataCollectionPtr models(new data_management::DataCollection(nPath));
+        DAAL_CHECK_MALLOC(models)
+        for (size_t i = 0; i < nPath && s; i++)
+        {
+            lasso_regression::internal::ModelImpl * pathModel =
+                new lasso_regression::internal::ModelImpl(in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s);
+            DAAL_CHECK_MALLOC(pathModel)
+            (*models)[i] = lasso_regression::ModelPtr(pathModel);
+        }
+        set(pathModels, models);
+    }
+
     if (parameter->optResultToCompute & computeGramMatrix)
         set(gramMatrixId, data_management::HomogenNumericTable<algorithmFPType>::create(in->getNumberOfFeatures(), in->getNumberOfFeatures(),
                                                                                         data_management::NumericTableIface::doAllocate, &s));
@@ -151,6 +151,12 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
 
     const size_t lassoParamsNumberOfColumns = parameter->lassoParameters->getNumberOfColumns();
     DAAL_CHECK((lassoParamsNumberOfColumns == 1) || (nColumnsInDepVariable == lassoParamsNumberOfColumns), ErrorIncorrectNumberOfColumns);
+
+    if (parameter->lassoParametersPath)
+    {
+        const size_t lassoPathNumberOfColumns = parameter->lassoParametersPath->getNumberOfColumns();
+        DAAL_CHECK((lassoPathNumberOfColumns == 1) || (nColumnsInDepVariable == lassoPathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
     return services::Status();
 }
 
@@ -164,7 +170,12 @@ Parameter::Parameter(const SolverPtr & solver)
 
 services::Status Parameter::check() const
 {
-    return checkNumericTable(lassoParameters.get(), lassoParametersStr(), packed_mask, 0, 0, 1);
+    services::Status status = checkNumericTable(lassoParameters.get(), lassoParametersStr(), packed_mask, 0, 0, 1);
+    if (status && lassoParametersPath)
+    {
+        status = checkNumericTable(lassoParametersPath.get(), "lassoParametersPath", packed_mask);
+    }
+    return status;
 }
 
 } // namespace interface1
@@ -40,6 +40,15 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LM_PREDICTION_RESULT_ID);
 
+Parameter::Parameter(InferencePrecision precision) : inferencePrecision(precision) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(inferencePrecision == fullPrecision || inferencePrecision == bfloat16Precision || inferencePrecision == int8Precision,
+                  ErrorIncorrectParameter, ParameterName, inferencePrecisionStr());
+    return Status();
+}
+
 Input::Input(size_t nElements) : regression::prediction::Input(nElements) {}
 Input::Input(const Input & other) : regression::prediction::Input(other) {}
 
@@ -63,9 +72,37 @@ void Input::set(ModelInputId id, const linear_model::ModelPtr & value)
     regression::prediction::Input::set(regression::prediction::ModelInputId(id), value);
 }
 
+DataCollectionPtr Input::get(ModelCollectionInputId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+void Input::set(ModelCollectionInputId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
 Status Input::check(const daal::algorithms::Parameter * parameter, int method) const
 {
     Status s;
+    const DataCollectionPtr modelCollection = get(models);
+    if (modelCollection)
+    {
+        const NumericTablePtr dataTable = get(data);
+        DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+        DAAL_CHECK_EX(modelCollection->size() > 0, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, modelsStr());
+
+        const size_t nBeta = dataTable->getNumberOfColumns() + 1;
+        for (size_t i = 0; i < modelCollection->size(); i++)
+        {
+            const linear_model::ModelPtr m = linear_model::Model::cast((*modelCollection)[i]);
+            DAAL_CHECK(m, ErrorNullModel);
+            DAAL_CHECK_EX(m->getNumberOfFeatures() == dataTable->getNumberOfColumns(), ErrorIncorrectNumberOfFeatures, ArgumentName, dataStr());
+            DAAL_CHECK_STATUS(s, checkNumericTable(m->getBeta().get(), betaStr(), 0, 0, nBeta, m->getNumberOfResponses()));
+        }
+        return s;
+    }
+
     DAAL_CHECK_STATUS(s, regression::prediction::Input::check(parameter, method));
 
     size_t nBeta      = get(data)->getNumberOfColumns() + 1;
@@ -85,11 +122,36 @@ void Result::set(ResultId id, const NumericTablePtr & value)
     regression::prediction::Result::set(regression::prediction::ResultId(id), value);
 }
 
+DataCollectionPtr Result::get(ResultCollectionId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+void Result::set(ResultCollectionId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
 Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
 {
     Status s;
+    const Input * in                        = static_cast<const Input *>(input);
+    const DataCollectionPtr modelCollection = in->get(models);
+    if (modelCollection)
+    {
+        const DataCollectionPtr predictionCollection = get(predictions);
+        DAAL_CHECK_EX(predictionCollection && predictionCollection->size() == modelCollection->size(),
+                      ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, predictionsStr());
+        const size_t nRows = in->get(data)->getNumberOfRows();
+        for (size_t i = 0; i < modelCollection->size(); i++)
+        {
+            const size_t nResponses = linear_model::Model::cast((*modelCollection)[i])->getNumberOfResponses();
+            DAAL_CHECK_STATUS(s, checkNumericTable(NumericTable::cast((*predictionCollection)[i]).get(), predictionsStr(), 0, 0, nResponses, nRows));
+        }
+        return s;
+    }
+
     DAAL_CHECK_STATUS(s, regression::prediction::Result::check(input, par, method));
-    const Input * in  = static_cast<const Input *>(input);
     size_t nResponses = in->get(model)->getNumberOfResponses();
 
     DAAL_CHECK_EX(get(prediction)->getNumberOfColumns() == nResponses, ErrorIncorrectNumberOfFeatures, ArgumentName, predictionStr());
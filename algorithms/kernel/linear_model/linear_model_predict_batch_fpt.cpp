@@ -39,14 +39,36 @@ using namespace daal::data_management;
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, const int method)
 {
-    const Input * in           = static_cast<const Input *>(input);
-    size_t nVectors            = in->get(data)->getNumberOfRows();
-    size_t nDependentVariables = in->get(model)->getNumberOfResponses();
+    const Input * in = static_cast<const Input *>(input);
+    size_t nVectors  = in->get(data)->getNumberOfRows();
     Status st;
 
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
     auto & deviceInfo = context.getInfoDevice();
 
+    const DataCollectionPtr modelCollection = in->get(models);
+    if (modelCollection)
+    {
+        const size_t nModels = modelCollection->size();
+        DataCollectionPtr predictionCollection(new DataCollection(nModels));
+        DAAL_CHECK_MALLOC(predictionCollection)
+        for (size_t i = 0; i < nModels && st; i++)
+        {
+            const size_t nResponses = linear_model::Model::cast((*modelCollection)[i])->getNumberOfResponses();
+            if (deviceInfo.isCpu)
+            {
+                (*predictionCollection)[i] = HomogenNumericTable<algorithmFPType>::create(nResponses, nVectors, NumericTable::doAllocate, &st);
+            }
+            else
+            {
+                (*predictionCollection)[i] = SyclHomogenNumericTable<algorithmFPType>::create(nResponses, nVectors, NumericTable::doAllocate, &st);
+            }
+        }
+        set(predictions, predictionCollection);
+        return st;
+    }
+
+    size_t nDependentVariables = in->get(model)->getNumberOfResponses();
     if (deviceInfo.isCpu)
     {
         set(prediction, HomogenNumericTable<algorithmFPType>::create(nDependentVariables, nVectors, NumericTable::doAllocate, &st));
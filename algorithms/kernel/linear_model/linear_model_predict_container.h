@@ -67,18 +67,41 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     Input * input   = static_cast<Input *>(_in);
     Result * result = static_cast<Result *>(_res);
 
-    NumericTable * a        = static_cast<NumericTable *>(input->get(data).get());
-    linear_model::Model * m = static_cast<linear_model::Model *>(input->get(model).get());
-    NumericTable * r        = static_cast<NumericTable *>(result->get(prediction).get());
-
     daal::services::Environment::env & env = *_env;
 
     auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
     auto & deviceInfo = context.getInfoDevice();
 
+    if (input->get(models))
+    {
+        NumericTable * a      = static_cast<NumericTable *>(input->get(data).get());
+        DataCollection * ms   = input->get(models).get();
+        DataCollection * rs   = result->get(predictions).get();
+        const Parameter * par = static_cast<const Parameter *>(_par);
+        if (deviceInfo.isCpu)
+        {
+            __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, ms, rs, par);
+        }
+
+        /* The models are scored one by one on GPU */
+        services::Status s;
+        for (size_t i = 0; i < ms->size() && s; i++)
+        {
+            linear_model::Model * m = static_cast<linear_model::Model *>((*ms)[i].get());
+            NumericTable * r        = static_cast<NumericTable *>((*rs)[i].get());
+            s |= ((internal::PredictKernelOneAPI<algorithmFPType, method> *)(_kernel))->compute(a, m, r);
+        }
+        return s;
+    }
+
+    NumericTable * a        = static_cast<NumericTable *>(input->get(data).get());
+    linear_model::Model * m = static_cast<linear_model::Model *>(input->get(model).get());
+    NumericTable * r        = static_cast<NumericTable *>(result->get(prediction).get());
+
     if (deviceInfo.isCpu)
     {
-        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r);
+        const Parameter * par = static_cast<const Parameter *>(_par);
+        __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, m, r, par);
     }
     else
     {
@@ -31,6 +31,7 @@
 #include "externals/service_blas.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "algorithms/kernel/service_error_handling.h"
+#include "service/kernel/service_arrays.h"
 
 namespace daal
 {
@@ -58,12 +59,13 @@ using namespace daal::services;
  *  \param responseBlock[out]   Resulting block of responses
  *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
  *                              false - otherwise.
+ *  \param gemm[in]             Products in the reduced precision, used if initialized with it
  */
 template <typename algorithmFPType, CpuType cpu>
-void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(DAAL_INT * numFeatures, DAAL_INT * numRows,
-                                                                                const algorithmFPType * dataBlock, DAAL_INT * numBetas,
-                                                                                const algorithmFPType * beta, DAAL_INT * numResponses,
-                                                                                algorithmFPType * responseBlock, bool findBeta0)
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
+    DAAL_INT * numFeatures, DAAL_INT * numRows, const algorithmFPType * dataBlock, DAAL_INT * numBetas, const algorithmFPType * beta,
+    DAAL_INT * numResponses, algorithmFPType * responseBlock, bool findBeta0,
+    const algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> & gemm)
 {
     /* GEMM parameters */
     char trans           = 'T';
@@ -71,8 +73,16 @@ void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
     algorithmFPType one  = 1.0;
     algorithmFPType zero = 0.0;
 
-    Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, numResponses, numRows, numFeatures, &one, beta + 1, numBetas, dataBlock, numFeatures, &zero,
-                                       responseBlock, numResponses);
+    if (gemm.isReduced())
+    {
+        Status s = gemm.compute(dataBlock, *numRows, *numFeatures, responseBlock, *numResponses);
+        if (!s) return s;
+    }
+    else
+    {
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, numResponses, numRows, numFeatures, &one, beta + 1, numBetas, dataBlock, numFeatures,
+                                           &zero, responseBlock, numResponses);
+    }
 
     if (findBeta0)
     {
@@ -86,10 +96,12 @@ void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses(
                                                numResponses);
         }
     } /* if (findBeta0) */
+    return Status();
 } /* void PredictKernel<algorithmFPType, defaultDense, cpu>::computeBlockOfResponses */
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r)
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r,
+                                                                            const Parameter * par)
 {
     linear_model::Model * model = const_cast<linear_model::Model *>(m);
 
@@ -108,6 +120,14 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
     DAAL_CHECK_BLOCK_STATUS(betaRows)
     const algorithmFPType * beta = betaRows.get();
 
+    /* The coefficients are packed once for all blocks of the data */
+    algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> gemm;
+    if (par && par->inferencePrecision != fullPrecision)
+    {
+        Status s = gemm.init(par->inferencePrecision, beta + 1, numResponses, dataTable->getNumberOfColumns(), betaTable->getNumberOfColumns());
+        if (!s) return s;
+    }
+
     size_t numRowsInBlock = _numRowsInBlock;
 
     if (numRowsInBlock < 1)
@@ -124,7 +144,7 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
 
     SafeStatus safeStat;
     /* Loop over input data blocks */
-    daal::threader_for(numBlocks, numBlocks, [=, &safeStat](int iBlock) {
+    daal::threader_for(numBlocks, numBlocks, [=, &safeStat, &gemm](int iBlock) {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow   = startRow + numRowsInBlock;
         if (endRow > numVectors)
@@ -159,12 +179,113 @@ services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(cons
         DAAL_INT * pnumResponses        = (DAAL_INT *)&numResponses;
 
         /* Calculate predictions */
-        computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas, beta, pnumResponses, responseBlock, model->getInterceptFlag());
+        s = computeBlockOfResponses(&numFeatures, &numRows, dataBlock, &nAllBetas, beta, pnumResponses, responseBlock, model->getInterceptFlag(),
+                                    gemm);
+        if (!s)
+        {
+            safeStat |= s;
+        }
     }); /* daal::threader_for */
 
     return safeStat.detach();
 } /* void PredictKernel<algorithmFPType, defaultDense, cpu>::compute */
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable * a, const data_management::DataCollection * models,
+                                                                            data_management::DataCollection * r, const Parameter * par)
+{
+    NumericTable * dataTable = const_cast<NumericTable *>(a);
+    const size_t numVectors  = dataTable->getNumberOfRows();
+    const size_t numFeatures = dataTable->getNumberOfColumns();
+    const size_t numBetas    = numFeatures + 1;
+    const size_t numModels   = models->size();
+
+    /* The responses of the i-th model are the columns [offsets[i], offsets[i + 1]) of the stacked responses */
+    TArray<size_t, cpu> offsetsArray(numModels + 1);
+    size_t * offsets = offsetsArray.get();
+    DAAL_CHECK_MALLOC(offsets);
+    offsets[0] = 0;
+    for (size_t i = 0; i < numModels; i++)
+    {
+        offsets[i + 1] = offsets[i] + linear_model::Model::cast((*models)[i])->getNumberOfResponses();
+    }
+    const size_t numAllResponses = offsets[numModels];
+
+    /* The intercept of the models without it is zero, so it is added for all stacked responses */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numAllResponses, numBetas);
+    TArray<algorithmFPType, cpu> stackedBetaArray(numAllResponses * numBetas);
+    algorithmFPType * stackedBeta = stackedBetaArray.get();
+    DAAL_CHECK_MALLOC(stackedBeta);
+    for (size_t i = 0; i < numModels; i++)
+    {
+        linear_model::Model * model = linear_model::Model::cast((*models)[i]).get();
+        const size_t numResponses   = offsets[i + 1] - offsets[i];
+        ReadRows<algorithmFPType, cpu> betaRows(model->getBeta().get(), 0, numResponses);
+        DAAL_CHECK_BLOCK_STATUS(betaRows);
+        algorithmFPType * dst = stackedBeta + offsets[i] * numBetas;
+        const int result      = daal::services::internal::daal_memcpy_s(dst, numResponses * numBetas * sizeof(algorithmFPType), betaRows.get(),
+                                                                   numResponses * numBetas * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+        if (!model->getInterceptFlag())
+        {
+            for (size_t j = 0; j < numResponses; j++)
+            {
+                dst[j * numBetas] = 0;
+            }
+        }
+    }
+
+    algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> gemm;
+    if (par && par->inferencePrecision != fullPrecision)
+    {
+        Status s = gemm.init(par->inferencePrecision, stackedBeta + 1, numAllResponses, numFeatures, numBetas);
+        if (!s) return s;
+    }
+
+    const size_t numRowsInBlock = _numRowsInBlock;
+    const size_t numBlocks      = numVectors / numRowsInBlock + !!(numVectors % numRowsInBlock);
+
+    daal::TlsMem<algorithmFPType, cpu> tlsResponses(numRowsInBlock * numAllResponses);
+    SafeStatus safeStat;
+    daal::threader_for(numBlocks, numBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * numRowsInBlock;
+        const size_t nRows    = (startRow + numRowsInBlock > numVectors ? numVectors - startRow : numRowsInBlock);
+
+        algorithmFPType * responseBlock = tlsResponses.local();
+        DAAL_CHECK_MALLOC_THR(responseBlock);
+
+        ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+
+        DAAL_INT numRowsInt         = (DAAL_INT)nRows;
+        DAAL_INT numFeaturesInt     = (DAAL_INT)numFeatures;
+        DAAL_INT numBetasInt        = (DAAL_INT)numBetas;
+        DAAL_INT numAllResponsesInt = (DAAL_INT)numAllResponses;
+        DAAL_CHECK_STATUS_THR(computeBlockOfResponses(&numFeaturesInt, &numRowsInt, dataRows.get(), &numBetasInt, stackedBeta, &numAllResponsesInt,
+                                                      responseBlock, true, gemm));
+
+        /* Scatter the stacked responses of the block into the results of the models */
+        for (size_t i = 0; i < numModels; i++)
+        {
+            const size_t numResponses = offsets[i + 1] - offsets[i];
+            WriteOnlyRows<algorithmFPType, cpu> resultRows(NumericTable::cast((*r)[i]).get(), startRow, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(resultRows);
+            algorithmFPType * result = resultRows.get();
+            for (size_t row = 0; row < nRows; row++)
+            {
+                const algorithmFPType * src = responseBlock + row * numAllResponses + offsets[i];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < numResponses; j++)
+                {
+                    result[row * numResponses + j] = src[j];
+                }
+            }
+        }
+    });
+    return safeStat.detach();
+}
+
 } /* namespace internal */
 } /* namespace prediction */
 } /* namespace linear_model */
@@ -29,7 +29,9 @@
 #include "externals/service_memory.h"
 #include "algorithms/kernel/kernel.h"
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "externals/service_blas.h"
+#include "algorithms/kernel/service_reduced_precision_gemm.h"
 
 using namespace daal::data_management;
 
@@ -53,19 +55,34 @@ public:
      *  \param a[in]    Matrix of input variables X
      *  \param m[in]    Linear regression model obtained on training stage
      *  \param r[out]   Prediction results
+     *  \param par[in]  Parameters of the prediction, can be null
      */
-    services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r);
+    services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r, const Parameter * par = nullptr);
 };
 
 template <typename algorithmFpType, CpuType cpu>
 class PredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r);
+    services::Status compute(const NumericTable * a, const linear_model::Model * m, NumericTable * r, const Parameter * par = nullptr);
+
+    /**
+     *  \brief Computes the predictions of several models at once: the coefficients of all models are stacked,
+     *         so a block of the data is read once and multiplied by one matrix of coefficients
+     *
+     *  \param a[in]        Matrix of input variables X
+     *  \param models[in]   Collection of linear models with the same number of features
+     *  \param r[out]       Collection of the tables with the predictions of every model
+     *  \param par[in]      Parameters of the prediction, can be null
+     */
+    services::Status compute(const NumericTable * a, const data_management::DataCollection * models, data_management::DataCollection * r,
+                             const Parameter * par = nullptr);
 
 protected:
-    void computeBlockOfResponses(DAAL_INT * numFeatures, DAAL_INT * numRows, const algorithmFpType * dataBlock, DAAL_INT * numBetas,
-                                 const algorithmFpType * beta, DAAL_INT * numResponses, algorithmFpType * responseBlock, bool findBeta0);
+    /* The products of the data and the coefficients are computed by gemm when it is initialized with the reduced precision */
+    services::Status computeBlockOfResponses(DAAL_INT * numFeatures, DAAL_INT * numRows, const algorithmFpType * dataBlock, DAAL_INT * numBetas,
+                                             const algorithmFpType * beta, DAAL_INT * numResponses, algorithmFpType * responseBlock,
+                                             bool findBeta0, const algorithms::internal::ReducedPrecisionGemm<algorithmFpType, cpu> & gemm);
 
     static const size_t _numRowsInBlock = 256;
 };
@@ -23,6 +23,8 @@
 
 #include "algorithms/kernel/linear_model/linear_model_train_qr_kernel.h"
 #include "externals/service_lapack.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
 
 namespace daal
 {
@@ -162,6 +164,41 @@ Status CommonKernel<algorithmFPType, cpu>::merge(DAAL_INT nBetas, DAAL_INT nResp
     return (!result) ? status : Status(services::ErrorMemoryCopyFailedInternal);
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status CommonKernel<algorithmFPType, cpu>::mergeTree(DAAL_INT nBetas, DAAL_INT nResponses, size_t n, algorithmFPType ** r, algorithmFPType ** qty)
+{
+    DAAL_INT lwork;
+    Status st = CommonKernel<algorithmFPType, cpu>::computeWorkSize(2 * nBetas, nBetas, nResponses, lwork);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    const size_t rSize   = nBetas * nBetas;
+    const size_t qtySize = nBetas * nResponses;
+
+    /* Per-thread buffer: R's and Q^T * Y's of the pair merged by rows, reflectors and work array of LAPACK */
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(2 * rSize + 2 * qtySize + nBetas + lwork);
+
+    SafeStatus safeStat;
+    for (size_t stride = 1; stride < n; stride *= 2)
+    {
+        /* The result of the pair (i, i + stride) replaces the i-th result */
+        const size_t nPairs = (n - stride + 2 * stride - 1) / (2 * stride);
+        daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+            const size_t i = iPair * 2 * stride;
+            const size_t j = i + stride;
+
+            algorithmFPType * r12 = tlsBuffer.local();
+            DAAL_CHECK_MALLOC_THR(r12);
+            algorithmFPType * qty12 = r12 + 2 * rSize;
+            algorithmFPType * tau   = qty12 + 2 * qtySize;
+            algorithmFPType * work  = tau + nBetas;
+
+            DAAL_CHECK_STATUS_THR(merge(nBetas, nResponses, r[i], qty[i], r[j], qty[j], r12, qty12, r[i], qty[i], tau, work, lwork));
+        });
+        DAAL_CHECK_SAFE_STATUS();
+    }
+    return st;
+}
+
 } // namespace internal
 } // namespace training
 } // namespace qr
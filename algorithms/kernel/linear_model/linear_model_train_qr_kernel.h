@@ -199,6 +199,18 @@ public:
     static Status merge(DAAL_INT p, DAAL_INT ny, const algorithmFPType * r1, const algorithmFPType * qty1, const algorithmFPType * r2,
                         const algorithmFPType * qty2, algorithmFPType * r12, algorithmFPType * qty12, algorithmFPType * r, algorithmFPType * qty,
                         algorithmFPType * tau, algorithmFPType * work, DAAL_INT lwork);
+
+    /**
+     * Merges n results of QR decomposition together in a binary tree:
+     * the independent pairs of one level of the tree are merged in parallel
+     * \param[in]     p    Size of the matrix R
+     * \param[in]     ny   Number of rows in the matrix Q^T * Y
+     * \param[in]     n    Number of the results to merge
+     * \param[in,out] r    Array of n matrices R of size p x p, the result is stored in r[0]
+     * \param[in,out] qty  Array of n matrices Q^T * Y of size ny x p, the result is stored in qty[0]
+     * \return Status of the computations
+     */
+    static Status mergeTree(DAAL_INT p, DAAL_INT ny, size_t n, algorithmFPType ** r, algorithmFPType ** qty);
 };
 
 /**
@@ -243,11 +255,14 @@ public:
      * \param[in] n          Number of partial resuts in the input array
      * \param[in] partialr   Array of n numeric tables R of size P x P
      * \param[in] partialqty Array of n numeric tables \f$Q^T \times Y\f$ of size Ny x P
-     * \param[out] r         Numeric table R of size P x P
-     * \param[out] xty       Numeric table \f$Q^T \times Y\f$ of size Ny x P
+     * \param[in,out] r      Numeric table R of size P x P
+     * \param[in,out] xty    Numeric table \f$Q^T \times Y\f$ of size Ny x P
+     * \param[in] initializeResult Flag. True if the partial results overwrite r and qty,
+     *                              false if they are merged into the current contents of r and qty
      * \return Status of the computations
      */
-    static Status compute(size_t n, NumericTable ** partialr, NumericTable ** partialqty, NumericTable & r, NumericTable & qty);
+    static Status compute(size_t n, NumericTable ** partialr, NumericTable ** partialqty, NumericTable & r, NumericTable & qty,
+                          bool initializeResult = true);
 };
 
 /**
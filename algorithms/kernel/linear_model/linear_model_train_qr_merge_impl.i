@@ -23,6 +23,8 @@
 
 #include "algorithms/kernel/linear_model/linear_model_train_qr_kernel.h"
 #include "externals/service_lapack.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
 
 namespace daal
 {
@@ -43,29 +45,33 @@ using namespace daal::services::internal;
 
 template <typename algorithmFPType, CpuType cpu>
 Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** partialr, NumericTable ** partialqty, NumericTable & rTable,
-                                                  NumericTable & qtyTable)
+                                                  NumericTable & qtyTable, bool initializeResult)
 {
-    size_t nBetas(rTable.getNumberOfRows());
-    size_t nBetas2(2 * nBetas);
-    size_t nResponses(qtyTable.getNumberOfRows());
-    Status st;
-    int result = 0;
-
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, 2);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, nBetas2);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas * nBetas2, sizeof(algorithmFPType));
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses, nBetas2);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses * nBetas2, sizeof(algorithmFPType));
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, sizeof(algorithmFPType));
-
-    TArray<algorithmFPType, cpu> rMerge(nBetas * nBetas2);
-    DAAL_CHECK_MALLOC(rMerge.get());
-
-    TArray<algorithmFPType, cpu> qtyMerge(nResponses * nBetas2);
-    DAAL_CHECK_MALLOC(qtyMerge.get());
-
-    TArray<algorithmFPType, cpu> tau(nBetas);
-    DAAL_CHECK_MALLOC(tau.get());
+    const size_t nBetas     = rTable.getNumberOfRows();
+    const size_t nResponses = qtyTable.getNumberOfRows();
+    const size_t rSize      = nBetas * nBetas;
+    const size_t qtySize    = nResponses * nBetas;
+
+    /* The current contents of r and qty are merged as one more partial result */
+    const size_t nMerged = n + (initializeResult ? 0 : 1);
+    const size_t iFirst  = nMerged - n;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nBetas, nBetas);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nResponses, nBetas);
+    DAAL_OVERFLOW_CHECK_BY_ADDING(size_t, rSize, qtySize);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nMerged, rSize + qtySize);
+
+    TArray<algorithmFPType, cpu> rqtyBuffer(nMerged * (rSize + qtySize));
+    DAAL_CHECK_MALLOC(rqtyBuffer.get());
+
+    TArray<algorithmFPType *, cpu> rPtrs(nMerged);
+    TArray<algorithmFPType *, cpu> qtyPtrs(nMerged);
+    DAAL_CHECK_MALLOC(rPtrs.get() && qtyPtrs.get());
+    for (size_t i = 0; i < nMerged; i++)
+    {
+        rPtrs[i]   = rqtyBuffer.get() + i * (rSize + qtySize);
+        qtyPtrs[i] = rPtrs[i] + rSize;
+    }
 
     WriteRowsType rFinalBlock(rTable, 0, nBetas);
     DAAL_CHECK_BLOCK_STATUS(rFinalBlock);
@@ -75,41 +81,35 @@ Status MergeKernel<algorithmFPType, cpu>::compute(size_t n, NumericTable ** part
     DAAL_CHECK_BLOCK_STATUS(qtyFinalBlock);
     algorithmFPType * qtyFinal = qtyFinalBlock.get();
 
-    ReadRowsType rBlock(partialr[0], 0, nBetas);
-    DAAL_CHECK_BLOCK_STATUS(rBlock);
-    const algorithmFPType * r = rBlock.get();
-
-    ReadRowsType qtyBlock(partialqty[0], 0, nResponses);
-    DAAL_CHECK_BLOCK_STATUS(qtyBlock);
-    const algorithmFPType * qty = qtyBlock.get();
-
-    const size_t rSizeInBytes   = nBetas * nBetas * sizeof(algorithmFPType);
-    const size_t qtySizeInBytes = nResponses * nBetas * sizeof(algorithmFPType);
-    result |= daal::services::internal::daal_memcpy_s(rFinal, rSizeInBytes, r, rSizeInBytes);
-    result |= daal::services::internal::daal_memcpy_s(qtyFinal, qtySizeInBytes, qty, qtySizeInBytes);
-
-    DAAL_INT lwork;
-    st = (!result) ? CommonKernel<algorithmFPType, cpu>::computeWorkSize(nBetas2, nBetas, nResponses, lwork) : Status(ErrorMemoryCopyFailedInternal);
-    DAAL_CHECK_STATUS_VAR(st);
-
-    TArray<algorithmFPType, cpu> work(lwork);
-    DAAL_CHECK_MALLOC(work.get());
-
-    for (size_t i = 1; i < n; i++)
+    const size_t rSizeInBytes   = rSize * sizeof(algorithmFPType);
+    const size_t qtySizeInBytes = qtySize * sizeof(algorithmFPType);
+    if (!initializeResult)
     {
-        rBlock.set(partialr[i], 0, nBetas);
-        DAAL_CHECK_BLOCK_STATUS(rBlock);
-        r = rBlock.get();
+        int result = daal::services::internal::daal_memcpy_s(rPtrs[0], rSizeInBytes, rFinal, rSizeInBytes);
+        result |= daal::services::internal::daal_memcpy_s(qtyPtrs[0], qtySizeInBytes, qtyFinal, qtySizeInBytes);
+        DAAL_CHECK(!result, ErrorMemoryCopyFailedInternal);
+    }
 
-        qtyBlock.set(partialqty[i], 0, nResponses);
-        DAAL_CHECK_BLOCK_STATUS(qtyBlock);
-        qty = qtyBlock.get();
+    /* Partial results of the nodes are copied in parallel */
+    SafeStatus safeStat;
+    daal::threader_for(n, n, [&](size_t i) {
+        ReadRowsType rBlock(partialr[i], 0, nBetas);
+        DAAL_CHECK_BLOCK_STATUS_THR(rBlock);
+        ReadRowsType qtyBlock(partialqty[i], 0, nResponses);
+        DAAL_CHECK_BLOCK_STATUS_THR(qtyBlock);
+
+        int result = daal::services::internal::daal_memcpy_s(rPtrs[iFirst + i], rSizeInBytes, rBlock.get(), rSizeInBytes);
+        result |= daal::services::internal::daal_memcpy_s(qtyPtrs[iFirst + i], qtySizeInBytes, qtyBlock.get(), qtySizeInBytes);
+        if (result) safeStat.add(ErrorMemoryCopyFailedInternal);
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    Status st = CommonKernel<algorithmFPType, cpu>::mergeTree(nBetas, nResponses, nMerged, rPtrs.get(), qtyPtrs.get());
+    DAAL_CHECK_STATUS_VAR(st);
 
-        st |= CommonKernel<algorithmFPType, cpu>::merge(nBetas, nResponses, r, qty, rFinal, qtyFinal, rMerge.get(), qtyMerge.get(), rFinal, qtyFinal,
-                                                        tau.get(), work.get(), lwork);
-        DAAL_CHECK_STATUS_VAR(st);
-    }
-    return st;
+    int result = daal::services::internal::daal_memcpy_s(rFinal, rSizeInBytes, rPtrs[0], rSizeInBytes);
+    result |= daal::services::internal::daal_memcpy_s(qtyFinal, qtySizeInBytes, qtyPtrs[0], qtySizeInBytes);
+    return (!result) ? st : Status(ErrorMemoryCopyFailedInternal);
 }
 
 } // namespace internal
@@ -41,7 +41,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_LINEAR_REGRESSION_PREDICTION_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : linear_model::prediction::Input(lastModelInputId + 1) {}
+Input::Input() : linear_model::prediction::Input(linear_model::prediction::lastModelCollectionInputId + 1) {}
 
 /**
  * Returns an input object for making linear regression model-based prediction
@@ -83,7 +83,27 @@ void Input::set(ModelInputId id, const linear_regression::ModelPtr & value)
     linear_model::prediction::Input::set(linear_model::prediction::ModelInputId(id), value);
 }
 
-Result::Result() : linear_model::prediction::Result(lastResultId + 1) {};
+/**
+ * Returns the collection of models for making linear regression model-based prediction with several models at once
+ * \param[in] id    Identifier of the input object
+ * \return          Collection of models that corresponds to the given identifier
+ */
+DataCollectionPtr Input::get(ModelCollectionInputId id) const
+{
+    return linear_model::prediction::Input::get(linear_model::prediction::ModelCollectionInputId(id));
+}
+
+/**
+ * Sets the collection of models for making linear regression model-based prediction with several models at once
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   Collection of trained models
+ */
+void Input::set(ModelCollectionInputId id, const DataCollectionPtr & value)
+{
+    linear_model::prediction::Input::set(linear_model::prediction::ModelCollectionInputId(id), value);
+}
+
+Result::Result() : linear_model::prediction::Result(linear_model::prediction::lastResultCollectionId + 1) {};
 
 /**
  * Returns the result of linear regression model-based prediction
@@ -105,6 +125,26 @@ void Result::set(ResultId id, const NumericTablePtr & value)
     linear_model::prediction::Result::set(linear_model::prediction::ResultId(id), value);
 }
 
+/**
+ * Returns the collection of results of linear regression model-based prediction with several models at once
+ * \param[in] id    Identifier of the result
+ * \return          Collection of results that corresponds to the given identifier
+ */
+DataCollectionPtr Result::get(ResultCollectionId id) const
+{
+    return linear_model::prediction::Result::get(linear_model::prediction::ResultCollectionId(id));
+}
+
+/**
+ * Sets the collection of results of linear regression model-based prediction with several models at once
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Collection of numeric tables
+ */
+void Result::set(ResultCollectionId id, const DataCollectionPtr & value)
+{
+    linear_model::prediction::Result::set(linear_model::prediction::ResultCollectionId(id), value);
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace linear_regression
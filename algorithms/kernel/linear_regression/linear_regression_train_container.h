@@ -98,6 +98,23 @@ Status BatchContainer<algorithmFPType, method, cpu>::compute()
     {
         linear_regression::ModelNormEqPtr m = linear_regression::ModelNormEq::cast(result->get(model));
 
+        /* The normal equations are solved for the precomputed cross-products without reading the data */
+        if (input->get(xtx))
+        {
+            if (deviceInfo.isCpu)
+            {
+                __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense),
+                                   computeFromCrossProducts, *(input->get(xtx)), *(input->get(xty)), *(m->getXTXTable()), *(m->getXTYTable()),
+                                   *(m->getBeta()), par->interceptFlag);
+            }
+            else
+            {
+                __DAAL_CALL_KERNEL_SYCL(env, internal::BatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense),
+                                        computeFromCrossProducts, *(input->get(xtx)), *(input->get(xty)), *(m->getXTXTable()),
+                                        *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag);
+            }
+        }
+
         if (deviceInfo.isCpu)
         {
             __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, training::normEqDense), compute,
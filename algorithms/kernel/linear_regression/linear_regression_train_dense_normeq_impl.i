@@ -48,6 +48,15 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computeFromCrossProducts(const NumericTable & xtxInput,
+                                                                                          const NumericTable & xtyInput, NumericTable & xtx,
+                                                                                          NumericTable & xty, NumericTable & beta,
+                                                                                          bool interceptFlag) const
+{
+    return FinalizeKernelType::compute(xtxInput, xtyInput, xtx, xty, beta, interceptFlag, KernelHelper<algorithmFPType, cpu>());
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx,
                                                                           NumericTable & xty, bool interceptFlag) const
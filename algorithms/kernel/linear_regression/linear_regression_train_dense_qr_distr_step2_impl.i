@@ -43,7 +43,8 @@ template <typename algorithmFPType, CpuType cpu>
 Status DistributedKernel<algorithmFPType, training::qrDense, cpu>::compute(size_t n, NumericTable ** partialr, NumericTable ** partialqty,
                                                                            NumericTable & r, NumericTable & qty) const
 {
-    return MergeKernelType::compute(n, partialr, partialqty, r, qty);
+    /* Partial results are merged into the ones of the previous calls, so the partial models can be added as they arrive */
+    return MergeKernelType::compute(n, partialr, partialqty, r, qty, false);
 }
 
 template <typename algorithmFPType, CpuType cpu>
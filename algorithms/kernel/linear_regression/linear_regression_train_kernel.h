@@ -67,6 +67,9 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
 public:
     Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, NumericTable & beta,
                    bool interceptFlag) const;
+
+    Status computeFromCrossProducts(const NumericTable & xtxInput, const NumericTable & xtyInput, NumericTable & xtx, NumericTable & xty,
+                                    NumericTable & beta, bool interceptFlag) const;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/linear_regression/linear_regression_training_types.h"
+#include "service/kernel/daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -37,7 +38,7 @@ namespace training
 namespace interface1
 {
 /** Default constructor */
-Input::Input() : linear_model::training::Input(lastInputId + 1) {}
+Input::Input() : linear_model::training::Input(lastCrossProductInputId + 1) {}
 Input::Input(const Input & other) : linear_model::training::Input(other) {}
 
 /**
@@ -60,6 +61,26 @@ void Input::set(InputId id, const NumericTablePtr & value)
     linear_model::training::Input::set(linear_model::training::InputId(id), value);
 }
 
+/**
+ * Returns a cross-product precomputed for linear regression model-based training
+ * \param[in] id    Identifier of the cross-product
+ * \return          Cross-product that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(CrossProductInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets a cross-product precomputed for linear regression model-based training
+ * \param[in] id      Identifier of the cross-product
+ * \param[in] value   Pointer to the cross-product
+ */
+void Input::set(CrossProductInputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Returns the number of columns in the input data set
  * \return Number of columns in the input data set
@@ -88,6 +109,17 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     NumericTablePtr dataTable = get(data);
     size_t nRowsInData        = dataTable->getNumberOfRows();
     size_t nColumnsInData     = dataTable->getNumberOfColumns();
+
+    if (get(xtx) || get(xty))
+    {
+        /* The normal equations are solved for the precomputed cross-products, the data is not read */
+        DAAL_CHECK(method == normEqDense, ErrorMethodNotSupported);
+        const size_t nBetas     = nColumnsInData + (int)(parameter->interceptFlag == true);
+        const size_t nResponses = get(dependentVariables)->getNumberOfColumns();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(xtx).get(), XTXTableStr(), 0, 0, nBetas, nBetas));
+        return checkNumericTable(get(xty).get(), XTYTableStr(), 0, 0, nBetas, nResponses);
+    }
+
     if (method == normEqDense)
     {
         DAAL_CHECK(nRowsInData >= nColumnsInData + (int)(parameter->interceptFlag == true), ErrorIncorrectNumberOfRows);
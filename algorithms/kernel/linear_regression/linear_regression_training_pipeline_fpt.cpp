@@ -0,0 +1,116 @@
+/* file: linear_regression_training_pipeline_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of linear regression training on the data retrieved from a data source.
+//--
+*/
+
+#include "algorithms/linear_regression/linear_regression_training_pipeline.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/merged_numeric_table.h"
+#include "algorithms/kernel/service_threading.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+namespace
+{
+/* Block of the training data and the dependent variables loaded from the data source */
+template <typename algorithmFPType>
+struct PipelineBlock
+{
+    Status create(size_t nFeatures, size_t nDependentVariables)
+    {
+        Status s;
+        data = HomogenNumericTable<algorithmFPType>::create(nFeatures, 0, NumericTable::doNotAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        dependentVariables = HomogenNumericTable<algorithmFPType>::create(nDependentVariables, 0, NumericTable::doNotAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        merged = MergedNumericTable::create(data, dependentVariables, &s);
+        return s;
+    }
+
+    Status load(DataSource & dataSource, size_t nRowsInBlock)
+    {
+        nRows = dataSource.loadDataBlock(nRowsInBlock, merged.get());
+        return dataSource.status();
+    }
+
+    NumericTablePtr data;
+    NumericTablePtr dependentVariables;
+    NumericTablePtr merged;
+    size_t nRows;
+};
+} // namespace
+
+template <typename algorithmFPType>
+DAAL_EXPORT Status OnlinePipeline::compute(linear_model::training::Online & algorithm, DataSource & dataSource)
+{
+    DAAL_CHECK(_nFeatures > 0 && _nDependentVariables > 0 && _nRowsInBlock > 0, ErrorIncorrectParameter);
+    _nProcessedRows = 0;
+
+    regression::training::Input * input = algorithm.getInput();
+    DAAL_CHECK(input, ErrorNullInput);
+
+    Status s;
+    PipelineBlock<algorithmFPType> blocks[2];
+    DAAL_CHECK_STATUS(s, blocks[0].create(_nFeatures, _nDependentVariables));
+    DAAL_CHECK_STATUS(s, blocks[1].create(_nFeatures, _nDependentVariables));
+
+    DAAL_CHECK_STATUS(s, blocks[0].load(dataSource, _nRowsInBlock));
+
+    daal::task_group taskGroup;
+    for (size_t current = 0; blocks[current].nRows > 0; current = 1 - current)
+    {
+        PipelineBlock<algorithmFPType> & block = blocks[current];
+        input->set(regression::training::data, block.data);
+        input->set(regression::training::dependentVariables, block.dependentVariables);
+
+        /* The block is processed by the task while the next block is loaded by the calling thread */
+        Status computeStatus;
+        auto computeBlock = [&]() { computeStatus = algorithm.compute(); };
+        taskGroup.run(computeBlock);
+
+        Status loadStatus = blocks[1 - current].load(dataSource, _nRowsInBlock);
+        taskGroup.wait();
+
+        DAAL_CHECK_STATUS_VAR(computeStatus);
+        DAAL_CHECK_STATUS_VAR(loadStatus);
+        _nProcessedRows += block.nRows;
+    }
+    return s;
+}
+
+template DAAL_EXPORT Status OnlinePipeline::compute<DAAL_FPTYPE>(linear_model::training::Online & algorithm, DataSource & dataSource);
+
+} // namespace interface1
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
@@ -46,6 +46,14 @@ services::Status BatchKernelOneAPI<algorithmFPType, training::normEqDense>::comp
     return status;
 }
 
+template <typename algorithmFPType>
+services::Status BatchKernelOneAPI<algorithmFPType, training::normEqDense>::computeFromCrossProducts(NumericTable & xtxInput, NumericTable & xtyInput,
+                                                                                                     NumericTable & xtx, NumericTable & xty,
+                                                                                                     NumericTable & beta, bool interceptFlag) const
+{
+    return FinalizeKernelType::compute(xtxInput, xtyInput, xtx, xty, beta, interceptFlag, KernelHelperOneAPI<algorithmFPType>());
+}
+
 template <typename algorithmFPType>
 services::Status OnlineKernelOneAPI<algorithmFPType, training::normEqDense>::compute(NumericTable & x, NumericTable & y, NumericTable & xtx,
                                                                                      NumericTable & xty, bool interceptFlag) const
@@ -64,6 +64,8 @@ class BatchKernelOneAPI<algorithmFPType, training::normEqDense> : public daal::a
 public:
     services::Status compute(NumericTable & x, NumericTable & y, NumericTable & xtx, NumericTable & xty, NumericTable & beta,
                              bool interceptFlag) const;
+    services::Status computeFromCrossProducts(NumericTable & xtxInput, NumericTable & xtyInput, NumericTable & xtx, NumericTable & xty,
+                                              NumericTable & beta, bool interceptFlag) const;
 };
 
 template <typename algorithmFPType, training::Method method>
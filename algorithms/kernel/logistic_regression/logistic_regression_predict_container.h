@@ -70,7 +70,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     NumericTable * a                  = static_cast<NumericTable *>(input->get(classifier::prediction::data).get());
     logistic_regression::Model * m    = static_cast<logistic_regression::Model *>(input->get(classifier::prediction::model).get());
-    const classifier::Parameter * par = static_cast<classifier::Parameter *>(_par);
+    const Parameter * par             = static_cast<Parameter *>(_par);
 
     NumericTable * r = ((par->resultsToEvaluate & classifier::computeClassLabels) ? result->get(classifier::prediction::prediction).get() : nullptr);
     NumericTable * prob =
@@ -86,7 +86,7 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     if (deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::PredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
-                           daal::services::internal::hostApp(*input), a, m, par->nClasses, r, prob, logProb);
+                           daal::services::internal::hostApp(*input), a, m, par->nClasses, r, prob, logProb, par->inferencePrecision);
     }
     else
     {
@@ -38,6 +38,7 @@
 #include "service/kernel/service_algo_utils.h"
 #include "service/kernel/service_environment.h"
 #include "externals/service_blas.h"
+#include "algorithms/kernel/service_reduced_precision_gemm.h"
 #include "algorithms/kernel/objective_function/cross_entropy_loss/cross_entropy_loss_dense_default_batch_kernel.h"
 #include "algorithms/kernel/objective_function/logistic_loss/logistic_loss_dense_default_batch_kernel.h"
 
@@ -56,6 +57,39 @@ namespace internal
 {
 namespace ll = daal::algorithms::optimization_solver::logistic_loss;
 
+/* Computes the raw values xb[nRows,nClasses] with the products of the reduced precision, beta[nClasses,nCols + 1] contains the intercepts */
+template <typename algorithmFPType, CpuType cpu>
+services::Status applyBetaReduced(const algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> & gemm, const algorithmFPType * x,
+                                  const algorithmFPType * beta, algorithmFPType * xb, size_t nRows, size_t nClasses, size_t nCols)
+{
+    services::Status s = gemm.compute(x, nRows, nCols, xb, nClasses);
+    if (!s) return s;
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        for (size_t j = 0; j < nClasses; ++j) xb[i * nClasses + j] += beta[j * (nCols + 1)];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+struct TlsData
+{
+    DAAL_NEW_DELETE();
+    TlsData(size_t n, const NumericTable * ntX) : x(const_cast<NumericTable *>(ntX))
+    {
+        raw = services::internal::service_scalable_calloc<algorithmFPType, cpu>(n);
+    }
+
+    ~TlsData()
+    {
+        if (raw) services::internal::service_scalable_free<algorithmFPType, cpu>(raw);
+    }
+
+    ReadRows<algorithmFPType, cpu> x;
+    WriteOnlyRows<algorithmFPType, cpu> tmp;
+    algorithmFPType * raw = nullptr;
+};
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictBinaryClassificationTask
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -63,56 +97,15 @@ template <typename algorithmFPType, CpuType cpu>
 class PredictBinaryClassificationTask
 {
 public:
-    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, NumericTable * logProb)
-        : _data(x), _res(y), _prob(prob), _logProb(logProb)
+    PredictBinaryClassificationTask(const NumericTable * x, NumericTable * y, NumericTable * prob, NumericTable * logProb,
+                                    InferencePrecision precision)
+        : _data(x), _res(y), _prob(prob), _logProb(logProb), _precision(precision)
     {}
-    services::Status run(const NumericTable & beta, services::HostAppIface * pHostApp)
-    {
-        NumericTable * pRaw   = _prob ? _prob : (_logProb ? _logProb : _res);
-        const auto nRowsTotal = pRaw->getNumberOfRows();
-        WriteOnlyRows<algorithmFPType, cpu> rawBD(pRaw, 0, nRowsTotal);
-        DAAL_CHECK_BLOCK_STATUS(rawBD);
-        algorithmFPType * aRaw = rawBD.get();
-        //compute raw values
-        auto s = predictRaw(pHostApp, beta, aRaw);
-        if (!s) return s;
-        if (_prob || _logProb)
-        {
-            //before transforming raw values to sigmoid and logarithm, predict labels
-            if (_res)
-            {
-                WriteOnlyRows<algorithmFPType, cpu> resBD(_res, 0, nRowsTotal);
-                DAAL_CHECK_BLOCK_STATUS(resBD);
-                predictLabels(aRaw, resBD.get(), nRowsTotal);
-            }
-            ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::sigmoid(aRaw, aRaw, nRowsTotal);
-            if (pRaw->getNumberOfColumns() == 2)
-            {
-                stretchProbaOnTwoColumns(aRaw, nRowsTotal);
-            }
-            if (_logProb)
-            {
-                if (_prob)
-                {
-                    WriteOnlyRows<algorithmFPType, cpu> logBD(_logProb, 0, nRowsTotal);
-                    DAAL_CHECK_BLOCK_STATUS(logBD);
-                    daal::internal::Math<algorithmFPType, cpu>::vLog(_logProb->getNumberOfRows() * _logProb->getNumberOfColumns(), aRaw, logBD.get());
-                }
-                else
-                {
-                    daal::internal::Math<algorithmFPType, cpu>::vLog(_logProb->getNumberOfRows() * _logProb->getNumberOfColumns(), aRaw, aRaw);
-                }
-            }
-            return s;
-        }
-        //only labels are required
-        DAAL_ASSERT(pRaw == _res);
-        predictLabels(aRaw, aRaw, nRowsTotal);
-        return s;
-    }
+    services::Status run(const NumericTable & beta, services::HostAppIface * pHostApp);
 
 protected:
-    services::Status predictRaw(services::HostAppIface * pHostApp, const NumericTable & beta, algorithmFPType * pRes);
+    services::Status predictRaw(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * rawRes, size_t nRows, size_t nCols);
+    services::Status predictProba(const algorithmFPType * pSigmoid, size_t iStartRow, size_t nRows);
     void predictLabels(const algorithmFPType * pRaw, algorithmFPType * pRes, size_t nRows)
     {
         const algorithmFPType label[2] = { algorithmFPType(1.), algorithmFPType(0.) };
@@ -123,15 +116,22 @@ protected:
             pRes[iRow] = label[services::internal::SignBit<algorithmFPType, cpu>::get(pRaw[iRow])];
         }
     }
-    void stretchProbaOnTwoColumns(algorithmFPType * const data, const size_t numberRows)
+    void stretchProba(const algorithmFPType * pSigmoid, algorithmFPType * pRes, size_t nRows, size_t nColumns)
     {
-        for (size_t index = 2 * numberRows - 1; index >= 3; index -= 2)
+        if (nColumns == 2)
         {
-            data[index]     = data[index / 2];
-            data[index - 1] = algorithmFPType(1.) - data[index];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t iRow = 0; iRow < nRows; ++iRow)
+            {
+                pRes[2 * iRow]     = algorithmFPType(1.) - pSigmoid[iRow];
+                pRes[2 * iRow + 1] = pSigmoid[iRow];
+            }
+        }
+        else
+        {
+            services::internal::tmemcpy<algorithmFPType, cpu>(pRes, pSigmoid, nRows);
         }
-        data[1] = data[0];
-        data[0] = algorithmFPType(1.) - data[1];
     }
 
 protected:
@@ -139,15 +139,16 @@ protected:
     NumericTable * _res;
     NumericTable * _prob;
     NumericTable * _logProb;
+    InferencePrecision _precision;
+    algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> _gemm;
 };
 
 template <typename algorithmFPType, CpuType cpu>
-services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictRaw(services::HostAppIface * pHostApp, const NumericTable & beta,
-                                                                                   algorithmFPType * pRes)
+services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::run(const NumericTable & beta, services::HostAppIface * pHostApp)
 {
     const size_t nRowsTotal          = _data->getNumberOfRows();
     const size_t nCols               = _data->getNumberOfColumns();
-    const size_t nYPerRow            = 1;
+    const size_t nYPerRow            = (_prob || _logProb) ? 3 : 1;
     const size_t nRowsInBlockDefault = 500;
 
     const size_t nRowsInBlock = services::internal::getNumElementsFitInMemory(services::internal::getL1CacheSize() * 0.8,
@@ -157,6 +158,16 @@ services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictR
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable &>(beta), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(betaBD);
 
+    if (_precision != fullPrecision)
+    {
+        services::Status s = _gemm.init(_precision, betaBD.get() + 1, 1, nCols, nCols + 1);
+        if (!s) return s;
+    }
+
+    /* Raw values, labels and probabilities are computed block by block while the block stays in cache */
+    using TlsDataCpu = TlsData<algorithmFPType, cpu>;
+    daal::tls<TlsDataCpu *> tlsData([=]() -> TlsDataCpu * { return new TlsDataCpu(nRowsInBlock, _data); });
+
     SafeStatus safeStat;
     HostAppHelper host(pHostApp, 1000);
     daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
@@ -168,14 +179,71 @@ services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictR
         }
         const size_t iStartRow      = iBlock * nRowsInBlock;
         const size_t nRowsToProcess = (iBlock == nDataBlocks - 1) ? nRowsTotal - iBlock * nRowsInBlock : nRowsInBlock;
-        ReadRows<algorithmFPType, cpu> xBD(const_cast<NumericTable *>(_data), iStartRow, nRowsToProcess);
-        DAAL_CHECK_BLOCK_STATUS_THR(xBD);
-        algorithmFPType * res = pRes + iStartRow;
-        ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::applyBeta(xBD.get(), betaBD.get(), res, nRowsToProcess, nCols, true);
+        TlsDataCpu * pLocal         = tlsData.local();
+        DAAL_CHECK_MALLOC_THR(pLocal);
+        DAAL_CHECK_MALLOC_THR(pLocal->raw);
+        const algorithmFPType * pXBlock = pLocal->x.next(iStartRow, nRowsToProcess);
+        DAAL_CHECK_BLOCK_STATUS_THR(pLocal->x);
+        algorithmFPType * pRawValues = pLocal->raw;
+        s = predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nCols);
+        DAAL_CHECK_STATUS_THR(s);
+        if (_res)
+        {
+            //labels are predicted before transforming raw values to sigmoid
+            pLocal->tmp.set(_res, iStartRow, nRowsToProcess);
+            DAAL_CHECK_BLOCK_STATUS_THR(pLocal->tmp);
+            predictLabels(pRawValues, pLocal->tmp.get(), nRowsToProcess);
+        }
+        if (_prob || _logProb)
+        {
+            ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::sigmoid(pRawValues, pRawValues, nRowsToProcess);
+            s = predictProba(pRawValues, iStartRow, nRowsToProcess);
+            DAAL_CHECK_STATUS_THR(s);
+        }
     });
+    tlsData.reduce([](TlsDataCpu * ptr) { delete ptr; });
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictRaw(const algorithmFPType * x, const algorithmFPType * beta,
+                                                                                   algorithmFPType * rawRes, size_t nRows, size_t nCols)
+{
+    if (_gemm.isReduced()) return applyBetaReduced<algorithmFPType, cpu>(_gemm, x, beta, rawRes, nRows, 1, nCols);
+
+    ll::internal::LogLossKernel<algorithmFPType, ll::defaultDense, cpu>::applyBeta(x, beta, rawRes, nRows, nCols, true);
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PredictBinaryClassificationTask<algorithmFPType, cpu>::predictProba(const algorithmFPType * pSigmoid, size_t iStartRow,
+                                                                                     size_t nRows)
+{
+    WriteOnlyRows<algorithmFPType, cpu> probBD;
+    if (_prob)
+    {
+        probBD.set(_prob, iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(probBD);
+        stretchProba(pSigmoid, probBD.get(), nRows, _prob->getNumberOfColumns());
+    }
+    if (_logProb)
+    {
+        const size_t nColumns = _logProb->getNumberOfColumns();
+        WriteOnlyRows<algorithmFPType, cpu> logBD(_logProb, iStartRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS(logBD);
+        if (_prob && _prob->getNumberOfColumns() == nColumns)
+        {
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRows * nColumns, probBD.get(), logBD.get());
+        }
+        else
+        {
+            stretchProba(pSigmoid, logBD.get(), nRows, nColumns);
+            daal::internal::Math<algorithmFPType, cpu>::vLog(nRows * nColumns, logBD.get(), logBD.get());
+        }
+    }
+    return services::Status();
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 // PredictMulticlassTask
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -183,38 +251,22 @@ template <typename algorithmFPType, CpuType cpu>
 class PredictMulticlassTask
 {
 public:
-    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, NumericTable * logProb)
-        : _data(x), _res(y), _prob(prob), _logProb(logProb)
+    PredictMulticlassTask(const NumericTable * x, NumericTable * y, NumericTable * prob, NumericTable * logProb, InferencePrecision precision)
+        : _data(x), _res(y), _prob(prob), _logProb(logProb), _precision(precision)
     {}
     services::Status run(const NumericTable & beta, services::HostAppIface * pHostApp);
 
 protected:
-    void predictRaw(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * rawRes, size_t nRows, size_t nClasses, size_t nCols);
+    services::Status predictRaw(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * rawRes, size_t nRows, size_t nClasses,
+                                size_t nCols);
 
 protected:
     const NumericTable * _data;
     NumericTable * _res;
     NumericTable * _prob;
     NumericTable * _logProb;
-};
-
-template <typename algorithmFPType, CpuType cpu>
-struct TlsData
-{
-    DAAL_NEW_DELETE();
-    TlsData(size_t n, const NumericTable * ntX) : x(const_cast<NumericTable *>(ntX))
-    {
-        raw = services::internal::service_scalable_calloc<algorithmFPType, cpu>(n);
-    }
-
-    ~TlsData()
-    {
-        if (raw) services::internal::service_scalable_free<algorithmFPType, cpu>(raw);
-    }
-
-    ReadRows<algorithmFPType, cpu> x;
-    WriteOnlyRows<algorithmFPType, cpu> tmp;
-    algorithmFPType * raw = nullptr;
+    InferencePrecision _precision;
+    algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> _gemm;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -240,6 +292,12 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
     ReadRows<algorithmFPType, cpu> betaBD(const_cast<NumericTable &>(beta), 0, nClasses);
     DAAL_CHECK_BLOCK_STATUS(betaBD);
 
+    if (_precision != fullPrecision)
+    {
+        services::Status s = _gemm.init(_precision, betaBD.get() + 1, nClasses, nCols, nCols + 1);
+        if (!s) return s;
+    }
+
     using TlsDataCpu = TlsData<algorithmFPType, cpu>;
     daal::tls<TlsDataCpu *> tlsData([=]() -> TlsDataCpu * { return new TlsDataCpu(nRowsInBlock * nClasses, _data); });
 
@@ -259,7 +317,8 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
         const algorithmFPType * pXBlock = pLocal->x.next(iStartRow, nRowsToProcess);
         DAAL_CHECK_BLOCK_STATUS_THR(pLocal->x);
         algorithmFPType * pRawValues = pLocal->raw;
-        predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        s = predictRaw(pXBlock, betaBD.get(), pRawValues, nRowsToProcess, nClasses, nCols);
+        DAAL_CHECK_STATUS_THR(s);
         if (_res)
         {
             algorithmFPType * res = resBD.get() + iStartRow;
@@ -299,11 +358,14 @@ services::Status PredictMulticlassTask<algorithmFPType, cpu>::run(const NumericT
 }
 
 template <typename algorithmFPType, CpuType cpu>
-void PredictMulticlassTask<algorithmFPType, cpu>::predictRaw(const algorithmFPType * x, const algorithmFPType * beta, algorithmFPType * rawRes,
-                                                             size_t nRows, size_t nClasses, size_t nCols)
+services::Status PredictMulticlassTask<algorithmFPType, cpu>::predictRaw(const algorithmFPType * x, const algorithmFPType * beta,
+                                                                         algorithmFPType * rawRes, size_t nRows, size_t nClasses, size_t nCols)
 {
+    if (_gemm.isReduced()) return applyBetaReduced<algorithmFPType, cpu>(_gemm, x, beta, rawRes, nRows, nClasses, nCols);
+
     namespace cel = daal::algorithms::optimization_solver::cross_entropy_loss;
     cel::internal::CrossEntropyLossKernel<algorithmFPType, cel::defaultDense, cpu>::applyBeta(x, beta, rawRes, nRows, nClasses, nCols, true);
+    return services::Status();
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -312,16 +374,16 @@ void PredictMulticlassTask<algorithmFPType, cpu>::predictRaw(const algorithmFPTy
 template <typename algorithmFPType, prediction::Method method, CpuType cpu>
 services::Status PredictKernel<algorithmFPType, method, cpu>::compute(services::HostAppIface * pHostApp, const NumericTable * x,
                                                                       const logistic_regression::Model * m, size_t nClasses, NumericTable * pRes,
-                                                                      NumericTable * pProbab, NumericTable * pLogProbab)
+                                                                      NumericTable * pProbab, NumericTable * pLogProbab, InferencePrecision precision)
 {
     const daal::algorithms::logistic_regression::internal::ModelImpl * pModel =
         static_cast<const daal::algorithms::logistic_regression::internal::ModelImpl *>(m);
     if (nClasses == 2)
     {
-        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, pRes, pProbab, pLogProbab);
+        PredictBinaryClassificationTask<algorithmFPType, cpu> task(x, pRes, pProbab, pLogProbab, precision);
         return task.run(*pModel->getBeta(), pHostApp);
     }
-    PredictMulticlassTask<algorithmFPType, cpu> task(x, pRes, pProbab, pLogProbab);
+    PredictMulticlassTask<algorithmFPType, cpu> task(x, pRes, pProbab, pLogProbab, precision);
     return task.run(*pModel->getBeta(), pHostApp);
 }
 
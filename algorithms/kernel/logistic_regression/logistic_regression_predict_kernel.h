@@ -55,9 +55,11 @@ public:
      *  \param pRes[out] Prediction results
      *  \param pProbab[out] Probability prediction results
      *  \param pLogProbab[out] Log of probability prediction results
+     *  \param precision[in] Precision of the products of the data and the coefficients
      */
     services::Status compute(services::HostAppIface * pHostApp, const NumericTable * a, const logistic_regression::Model * m, size_t nClasses,
-                             NumericTable * pRes, NumericTable * pProbab, NumericTable * pLogProbab);
+                             NumericTable * pRes, NumericTable * pProbab, NumericTable * pLogProbab,
+                             InferencePrecision precision = fullPrecision);
 };
 
 } // namespace internal
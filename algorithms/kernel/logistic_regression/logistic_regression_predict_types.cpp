@@ -105,6 +105,23 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
 }
 
 } // namespace interface1
+
+namespace interface2
+{
+Parameter::Parameter(size_t nClasses, InferencePrecision precision) : classifier::Parameter(nClasses), inferencePrecision(precision) {}
+
+Parameter::Parameter(const Parameter & o) : classifier::Parameter(o), inferencePrecision(o.inferencePrecision) {}
+
+services::Status Parameter::check() const
+{
+    Status s;
+    DAAL_CHECK_STATUS(s, classifier::Parameter::check());
+    DAAL_CHECK_EX(inferencePrecision == fullPrecision || inferencePrecision == bfloat16Precision || inferencePrecision == int8Precision,
+                  ErrorIncorrectParameter, ParameterName, inferencePrecisionStr());
+    return s;
+}
+
+} // namespace interface2
 } // namespace prediction
 } // namespace logistic_regression
 } // namespace algorithms
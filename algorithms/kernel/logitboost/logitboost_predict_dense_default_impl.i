@@ -33,6 +33,7 @@
 #include "externals/service_memory.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "algorithms/kernel/logitboost/logitboost_impl.i"
+#include "algorithms/kernel/decision_tree/decision_tree_blocked_forest_impl.i"
 
 using namespace daal::algorithms::logitboost::internal;
 
@@ -47,6 +48,7 @@ namespace prediction
 namespace internal
 {
 using namespace daal::internal;
+using decision_tree::internal::BlockedForest;
 
 template <typename algorithmFPType, CpuType cpu>
 services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::compute(const NumericTablePtr & a, const Model * m, NumericTable * r,
@@ -70,27 +72,67 @@ services::Status LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::co
     daal::services::internal::service_memset<algorithmFPType, cpu>(F.get(), 0, n * nc);
 
     services::Status s;
-    services::SharedPtr<regression::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
-    regression::prediction::Input * predictInput                      = learnerPredict->getInput();
-    DAAL_CHECK(predictInput, services::ErrorNullInput);
-    predictInput->set(regression::prediction::data, a);
 
-    /* Calculate additive function values */
-    for (size_t m = 0; m < M; m++)
+    /* Decision trees and stumps are compiled into the blocked forest and all terms of additive regression are computed in one pass */
+    bool bTrees = false;
+    BlockedForest<algorithmFPType, cpu> forest;
+    if (!BlockedForest<algorithmFPType, cpu>::hasUnorderedFeatures(*a))
     {
-        for (size_t j = 0; j < nc; j++)
+        DAAL_CHECK_STATUS(s, (forest.template convertWeakLearners<decision_tree::regression::Model, decision_tree::regression::DecisionTreeNode>(
+                                 *boostModel, M * nc, bTrees)));
+    }
+
+    if (bTrees)
+    {
+        const algorithmFPType inv_nc = 1.0 / (algorithmFPType)nc;
+        const algorithmFPType coef   = (algorithmFPType)(nc - 1) / (algorithmFPType)nc;
+        algorithmFPType * const dp   = pred.get();
+        algorithmFPType * const dF   = F.get();
+
+        /* The trees come in the order of the terms, F of the rows is updated when the predictions of all classes of the term are known */
+        DAAL_CHECK_STATUS(s, forest.predict(*a, [&](size_t iRow, size_t nRows, size_t iTree, const int * leaves) {
+            const size_t j = iTree % nc;
+            for (size_t i = iRow; i < iRow + nRows; i++) dp[j * n + i] = forest.getLeafValue(iTree, leaves[i - iRow]);
+            if (j < nc - 1) return;
+
+            for (size_t i = iRow; i < iRow + nRows; i++)
+            {
+                for (size_t k = 0; k < nc; k++)
+                {
+                    algorithmFPType sum = dp[k * n + i];
+                    for (size_t l = 0; l < nc; l++)
+                    {
+                        if (l != k) sum += dp[l * n + i];
+                    }
+                    dF[i * nc + k] += coef * (dp[k * n + i] - sum * inv_nc);
+                }
+            }
+        }));
+    }
+    else
+    {
+        services::SharedPtr<regression::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
+        regression::prediction::Input * predictInput                      = learnerPredict->getInput();
+        DAAL_CHECK(predictInput, services::ErrorNullInput);
+        predictInput->set(regression::prediction::data, a);
+
+        /* Calculate additive function values */
+        for (size_t m = 0; m < M; m++)
         {
-            HomogenNTPtr predTable = HomogenNT::create(pred.get() + j * n, 1, n, &s);
-            DAAL_CHECK_STATUS_VAR(s);
-            regression::prediction::ResultPtr predictionRes(new regression::prediction::Result());
-            DAAL_CHECK_MALLOC(predictionRes.get())
-            predictionRes->set(regression::prediction::prediction, predTable);
-            DAAL_CHECK_STATUS(s, learnerPredict->setResult(predictionRes));
-            regression::ModelPtr learnerModel = boostModel->getWeakLearnerModel(m * nc + j);
-            predictInput->set(regression::prediction::model, learnerModel);
-            DAAL_CHECK_STATUS(s, learnerPredict->computeNoThrow());
+            for (size_t j = 0; j < nc; j++)
+            {
+                HomogenNTPtr predTable = HomogenNT::create(pred.get() + j * n, 1, n, &s);
+                DAAL_CHECK_STATUS_VAR(s);
+                regression::prediction::ResultPtr predictionRes(new regression::prediction::Result());
+                DAAL_CHECK_MALLOC(predictionRes.get())
+                predictionRes->set(regression::prediction::prediction, predTable);
+                DAAL_CHECK_STATUS(s, learnerPredict->setResult(predictionRes));
+                regression::ModelPtr learnerModel = boostModel->getWeakLearnerModel(m * nc + j);
+                predictInput->set(regression::prediction::model, learnerModel);
+                DAAL_CHECK_STATUS(s, learnerPredict->computeNoThrow());
+            }
+            UpdateF<algorithmFPType, cpu>(dim, n, nc, pred.get(), F.get());
         }
-        UpdateF<algorithmFPType, cpu>(dim, n, nc, pred.get(), F.get());
     }
 
     /* Calculate classes labels for input data */
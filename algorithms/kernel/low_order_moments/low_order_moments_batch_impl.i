@@ -39,16 +39,19 @@ template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataTable, Result * result,
                                                                                    const Parameter * parameter)
 {
+    NumericTable * featureIndicesTable = parameter->featureIndices.get();
     if (method == defaultDense)
     {
         switch (parameter->estimatesToCompute)
         {
-        case estimatesMinMax: return estimates_batch_minmax::compute_estimates<algorithmFPType, cpu>(dataTable, result);
-        case estimatesMeanVariance: return estimates_batch_meanvariance::compute_estimates<algorithmFPType, cpu>(dataTable, result);
+        case estimatesMinMax: return estimates_batch_minmax::compute_estimates<algorithmFPType, cpu>(dataTable, featureIndicesTable, result);
+        case estimatesMeanVariance:
+            return estimates_batch_meanvariance::compute_estimates<algorithmFPType, cpu>(dataTable, featureIndicesTable, result);
         default /* estimatesAll */: break;
         }
-        return estimates_batch_all::compute_estimates<algorithmFPType, cpu>(dataTable, result);
+        return estimates_batch_all::compute_estimates<algorithmFPType, cpu>(dataTable, featureIndicesTable, result);
     }
+    if (featureIndicesTable) return Status(ErrorMethodNotImplemented);
 
     LowOrderMomentsBatchTask<algorithmFPType, cpu> task(dataTable, result);
 
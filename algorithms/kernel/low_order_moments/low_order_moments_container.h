@@ -39,13 +39,19 @@ namespace algorithms
 {
 namespace low_order_moments
 {
+/* Sparse data is processed on GPU by all the CSR methods, dense data by the default method only */
+inline bool isBatchMethodSupportedOnGpu(Method method)
+{
+    return method == defaultDense || method == fastCSR || method == singlePassCSR || method == sumCSR;
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
     auto & context    = daal::oneapi::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (method != defaultDense || deviceInfo.isCpu)
+    if (!isBatchMethodSupportedOnGpu(method) || deviceInfo.isCpu)
     {
         __DAAL_INITIALIZE_KERNELS(internal::LowOrderMomentsBatchKernel, algorithmFPType, method);
     }
@@ -75,13 +81,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     auto & context    = daal::oneapi::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
 
-    if (method != defaultDense || deviceInfo.isCpu)
+    if (!isBatchMethodSupportedOnGpu(method) || deviceInfo.isCpu)
     {
         __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, dataTable, result,
                            par);
     }
     else
     {
+        if (par->featureIndices) return services::Status(services::ErrorMethodNotImplemented);
         __DAAL_CALL_KERNEL_SYCL(env, oneapi::internal::LowOrderMomentsBatchKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 dataTable, result, par);
     }
@@ -131,6 +138,7 @@ services::Status OnlineContainer<algorithmFPType, method, cpu>::compute()
     }
     else
     {
+        if (par->forgettingFactor < 1.0) return services::Status(services::ErrorMethodNotImplemented);
         __DAAL_CALL_KERNEL_SYCL(env, oneapi::internal::LowOrderMomentsOnlineKernelOneAPI, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
                                 dataTable, partialResult, par, isOnline);
     }
@@ -20,12 +20,26 @@ using namespace daal::services;
 template <typename algorithmFPType, CpuType cpu>
 struct common_moments_data_t
 {
-    common_moments_data_t(NumericTable * dataTable, Result * r) : dataTable(dataTable)
+    common_moments_data_t(NumericTable * dataTable, NumericTable * featureIndicesTable, Result * r) : dataTable(dataTable), featureIndices(nullptr)
     {
         malloc_errors = 0;
 
         nVectors  = dataTable->getNumberOfRows();
-        nFeatures = dataTable->getNumberOfColumns();
+        nColumns  = dataTable->getNumberOfColumns();
+        nFeatures = nColumns;
+
+        /* Estimates are computed for the selected subset of columns only */
+        if (featureIndicesTable)
+        {
+            featureIndicesBD.set(featureIndicesTable, 0, 1);
+            featureIndices = featureIndicesBD.get();
+            nFeatures      = featureIndicesTable->getNumberOfColumns();
+            if (!featureIndices)
+            {
+                malloc_errors++;
+                return;
+            }
+        }
 
         dataTable->getBlockOfRows(0, 1 /*nVectors*/, readOnly, firstRowBD);
         firstRow = firstRowBD.getBlockPtr();
@@ -88,9 +102,12 @@ struct common_moments_data_t
     int malloc_errors;
 
     size_t nVectors;
+    size_t nColumns;
     size_t nFeatures;
 
     NumericTable * dataTable;
+    daal::internal::ReadRows<int, cpu, NumericTable> featureIndicesBD;
+    const int * featureIndices;
     NumericTablePtr resultTable[lastResultId + 1];
 
     BlockDescriptor<algorithmFPType> firstRowBD;
@@ -234,11 +251,63 @@ struct tls_moments_data_t
     }
 };
 
+/* Updates the estimates of the features [jStart, jEnd) with the rows of a data block.
+ * Column blocking keeps the TLS arrays of the processed features in cache for wide data sets */
+template <typename algorithmFPType, CpuType cpu, bool selectedFeatures>
+void update_estimates(tls_moments_data_t<algorithmFPType, cpu> * _td, const algorithmFPType * _dataArray_block, size_t _nRows, size_t nColumns,
+                      const int * featureIndices, size_t jStart, size_t jEnd)
+{
+    for (size_t i = 0; i < _nRows; i++)
+    {
+/* loop invariants */
+#if defined _MEAN_ENABLE_
+        const algorithmFPType _invN = algorithmFPType(1.0) / algorithmFPType(_td->nvectors + i + 1);
+#endif
+
+        const algorithmFPType * const argi = _dataArray_block + i * nColumns;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = jStart; j < jEnd; j++)
+        {
+            const algorithmFPType arg = (selectedFeatures ? argi[featureIndices[j]] : argi[j]);
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+            const algorithmFPType arg2 = arg * arg;
+#endif
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            const algorithmFPType delta = arg - _td->mean[j];
+#endif
+
+#ifdef _MIN_ENABLE_
+            _td->min[j] = arg < _td->min[j] ? arg : _td->min[j];
+#endif
+#ifdef _MAX_ENABLE_
+            _td->max[j] = arg > _td->max[j] ? arg : _td->max[j];
+#endif
+
+#ifdef _SUM_ENABLE_
+            _td->sum[j] += arg;
+#endif
+#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
+            _td->sum2[j] += arg2;
+#endif
+
+#ifdef _MEAN_ENABLE_
+            _td->mean[j] += delta * _invN;
+#endif
+
+#if defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+            _td->varc[j] += delta * (arg - _td->mean[j]);
+#endif
+        }
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
-Status compute_estimates(NumericTable * dataTable, Result * result)
+Status compute_estimates(NumericTable * dataTable, NumericTable * featureIndicesTable, Result * result)
 {
     /* Common data structure */
-    common_moments_data_t<algorithmFPType, cpu> _cd(dataTable, result);
+    common_moments_data_t<algorithmFPType, cpu> _cd(dataTable, featureIndicesTable, result);
     if (_cd.malloc_errors) return Status(daal::services::ErrorMemoryAllocationFailed);
 
     /* Rows and features splitting by blocks */
@@ -269,51 +338,20 @@ Status compute_estimates(NumericTable * dataTable, Result * result)
             DAAL_CHECK_BLOCK_STATUS_THR(dataTableBD);
             const algorithmFPType * _dataArray_block = dataTableBD.get();
 
-            for (size_t i = 0; i < _nRows; i++)
+            const size_t numFeaturesInBlock = 256;
+            for (size_t jStart = 0; jStart < _cd.nFeatures; jStart += numFeaturesInBlock)
             {
-/* loop invariants */
-#if defined _MEAN_ENABLE_
-                const algorithmFPType _invN = algorithmFPType(1.0) / algorithmFPType(_td->nvectors + 1);
-#endif
-
-                const algorithmFPType * const argi = _dataArray_block + i * _cd.nFeatures;
-
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j < _cd.nFeatures; j++)
+                const size_t jEnd = (jStart + numFeaturesInBlock < _cd.nFeatures) ? jStart + numFeaturesInBlock : _cd.nFeatures;
+                if (_cd.featureIndices)
                 {
-                    const algorithmFPType arg = argi[j];
-#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
-                    const algorithmFPType arg2 = arg * arg;
-#endif
-#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
-                    const algorithmFPType delta = arg - _td->mean[j];
-#endif
-
-#ifdef _MIN_ENABLE_
-                    _td->min[j] = arg < _td->min[j] ? arg : _td->min[j];
-#endif
-#ifdef _MAX_ENABLE_
-                    _td->max[j] = arg > _td->max[j] ? arg : _td->max[j];
-#endif
-
-#ifdef _SUM_ENABLE_
-                    _td->sum[j] += arg;
-#endif
-#if (defined _SUM2_ENABLE_ || defined _SORM_ENABLE_)
-                    _td->sum2[j] += arg2;
-#endif
-
-#ifdef _MEAN_ENABLE_
-                    _td->mean[j] += delta * _invN;
-#endif
-
-#if defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
-                    _td->varc[j] += delta * (arg - _td->mean[j]);
-#endif
+                    update_estimates<algorithmFPType, cpu, true>(_td, _dataArray_block, _nRows, _cd.nColumns, _cd.featureIndices, jStart, jEnd);
+                }
+                else
+                {
+                    update_estimates<algorithmFPType, cpu, false>(_td, _dataArray_block, _nRows, _cd.nColumns, nullptr, jStart, jEnd);
                 }
-                _td->nvectors++;
             }
+            _td->nvectors += _nRows;
         });
     } /* end for  DAAL_ITTNOTIFY_SCOPED_TASK(LowOrderMomentsBatchTask.ProcessBlocks); */
 
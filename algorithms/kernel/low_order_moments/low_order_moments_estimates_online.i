@@ -190,6 +190,49 @@ struct tls_moments_data_t
 #endif /* #if (defined _MIN_ENABLE_ || defined _MAX_ENABLE_) */
     }
 
+    /* Merges the estimates of other into the estimates of this buffer, used to combine the TLS buffers by pairs */
+    void combine(const tls_moments_data_t & other, const size_t nFeatures)
+    {
+        if (malloc_errors || other.malloc_errors)
+        {
+            malloc_errors++;
+            return;
+        }
+        if (other.nvectors == 0) return;
+
+        const algorithmFPType n1_p_n2 = nvectors + other.nvectors;
+#if (defined _MEAN_ENABLE_) || (defined _VARC_ENABLE_)
+        const algorithmFPType delta_scale = nvectors * other.nvectors / n1_p_n2;
+        const algorithmFPType mean_scale  = algorithmFPType(1.0) / n1_p_n2;
+#endif
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+#if (defined _MEAN_ENABLE_) || (defined _VARC_ENABLE_)
+            const algorithmFPType delta = other.mean[j] - mean[j];
+    #if (defined _VARC_ENABLE_) || (defined _STDEV_ENABLE_) || (defined _VART_ENABLE_)
+            varc[j] += other.varc[j] + delta * delta * delta_scale;
+    #endif
+            mean[j] = (mean[j] * nvectors + other.mean[j] * other.nvectors) * mean_scale;
+#endif
+#if (defined _SUM_ENABLE_) || (defined _MEAN_ENABLE_)
+            sum[j] += other.sum[j];
+#endif
+#if (defined _SUM2_ENABLE_) || (defined _SORM_ENABLE_)
+            sum2[j] += other.sum2[j];
+#endif
+#if (defined _MIN_ENABLE_)
+            min[j] = other.min[j] < min[j] ? other.min[j] : min[j];
+#endif
+#if (defined _MAX_ENABLE_)
+            max[j] = other.max[j] > max[j] ? other.max[j] : max[j];
+#endif
+        }
+        nvectors = n1_p_n2;
+    }
+
     ~tls_moments_data_t()
     {
 #if (defined _MEAN_ENABLE_) || (defined _VARC_ENABLE_)
@@ -355,59 +398,65 @@ Status compute_estimates(NumericTable * dataTable, PartialResult * partialResult
 
         bool bMemoryAllocationFailed = false;
 
-        /* Merge results by TLS buffers */
-        tls_data.reduce([&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
-            if (_td->malloc_errors)
-            {
-                bMemoryAllocationFailed = true;
-                delete _td;
-                return;
-            }
-            if (!safeStat)
-            {
-                delete _td;
-                return;
-            }
+        /* Merge results by TLS buffers, the buffers are combined by pairs in parallel first */
+        tls_data.tree_reduce(
+            [&](tls_moments_data_t<algorithmFPType, cpu> *& _dst, tls_moments_data_t<algorithmFPType, cpu> *& _src) {
+                _dst->combine(*_src, _cd.nFeatures);
+                delete _src;
+                _src = nullptr;
+            },
+            [&](tls_moments_data_t<algorithmFPType, cpu> * _td) {
+                if (_td->malloc_errors)
+                {
+                    bMemoryAllocationFailed = true;
+                    delete _td;
+                    return;
+                }
+                if (!safeStat)
+                {
+                    delete _td;
+                    return;
+                }
 
-            /* loop invariants */
-            algorithmFPType n1_p_n2        = n_current + _td->nvectors;
-            algorithmFPType n1_m_n2        = n_current * _td->nvectors;
-            algorithmFPType delta_scale    = n1_m_n2 / n1_p_n2;
-            algorithmFPType mean_scale     = algorithmFPType(1.0) / (n1_p_n2);
-            algorithmFPType variance_scale = algorithmFPType(1.0) / (n1_p_n2 - algorithmFPType(1.0));
+                /* loop invariants */
+                algorithmFPType n1_p_n2        = n_current + _td->nvectors;
+                algorithmFPType n1_m_n2        = n_current * _td->nvectors;
+                algorithmFPType delta_scale    = n1_m_n2 / n1_p_n2;
+                algorithmFPType mean_scale     = algorithmFPType(1.0) / (n1_p_n2);
+                algorithmFPType variance_scale = algorithmFPType(1.0) / (n1_p_n2 - algorithmFPType(1.0));
 
-            PRAGMA_IVDEP
-            PRAGMA_VECTOR_ALWAYS
-            for (size_t j = 0; j < _cd.nFeatures; j++)
-            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < _cd.nFeatures; j++)
+                {
 #if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
-                algorithmFPType delta = _td->mean[j] - _cd.mean[j];
+                    algorithmFPType delta = _td->mean[j] - _cd.mean[j];
 #endif
 #ifdef _MIN_ENABLE_
-                if (_td->min[j] < _min[j]) _min[j] = _td->min[j]; /* merging _min */
+                    if (_td->min[j] < _min[j]) _min[j] = _td->min[j]; /* merging _min */
 #endif
 #ifdef _MAX_ENABLE_
-                if (_td->max[j] > _max[j]) _max[j] = _td->max[j]; /* merging _max */
+                    if (_td->max[j] > _max[j]) _max[j] = _td->max[j]; /* merging _max */
 #endif
 #if (defined _SUM_ENABLE_) || (defined _MEAN_ENABLE_)
-                _sums[j] += _td->sum[j]; /* merging _sums */
+                    _sums[j] += _td->sum[j]; /* merging _sums */
 #endif
 #ifdef _SUM2_ENABLE_
-                _sumSq[j] += _td->sum2[j]; /* merging sum2 */
+                    _sumSq[j] += _td->sum2[j]; /* merging sum2 */
 #endif
 #if defined _VARC_ENABLE_ || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
-                _cd.variance[j] =
-                    (_td->varc[j] + _cd.variance[j] * (n_current - 1) + delta * delta * delta_scale) * variance_scale; /* merging variances */
+                    _cd.variance[j] =
+                        (_td->varc[j] + _cd.variance[j] * (n_current - 1) + delta * delta * delta_scale) * variance_scale; /* merging variances */
 #endif
 #ifdef _MEAN_ENABLE_
-                _cd.mean[j] = (_cd.mean[j] * n_current + _td->mean[j] * _td->nvectors) * mean_scale; /* merging means */
+                    _cd.mean[j] = (_cd.mean[j] * n_current + _td->mean[j] * _td->nvectors) * mean_scale; /* merging means */
 #endif
-            }
-            /* Increase number of already merged values */
-            n_current += _td->nvectors;
+                }
+                /* Increase number of already merged values */
+                n_current += _td->nvectors;
 
-            delete _td;
-        });
+                delete _td;
+            });
 
         if (bMemoryAllocationFailed) return Status(daal::services::ErrorMemoryAllocationFailed);
         DAAL_CHECK_SAFE_STATUS();
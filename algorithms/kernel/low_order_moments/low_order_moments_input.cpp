@@ -92,6 +92,26 @@ services::Status Input::check(const daal::algorithms::Parameter * parameter, int
         NumericTablePtr sum = dataTable->basicStatistics.get(NumericTableIface::sum);
         DAAL_CHECK_STATUS(s, checkNumericTable(sum.get(), basicStatisticsSumStr(), 0, 0, dataTable->getNumberOfColumns(), 1));
     }
+
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+    if (par && par->featureIndices)
+    {
+        NumericTable * indicesTable = par->featureIndices.get();
+        DAAL_CHECK_STATUS(s, checkNumericTable(indicesTable, featureIndicesStr(), 0, 0, 0, 1));
+
+        const size_t nIndices = indicesTable->getNumberOfColumns();
+        const size_t nColumns = dataTable->getNumberOfColumns();
+        BlockDescriptor<int> block;
+        DAAL_CHECK_STATUS(s, indicesTable->getBlockOfRows(0, 1, readOnly, block));
+        const int * indices = block.getBlockPtr();
+        bool bValid         = true;
+        for (size_t i = 0; i < nIndices; i++)
+        {
+            bValid &= (indices[i] >= 0 && size_t(indices[i]) < nColumns);
+        }
+        indicesTable->releaseBlockOfRows(block);
+        DAAL_CHECK_EX(bValid, ErrorIncorrectParameter, ParameterName, featureIndicesStr());
+    }
     return s;
 }
 
@@ -36,10 +36,200 @@ namespace low_order_moments
 namespace internal
 {
 using namespace daal::services;
+
+/* Per-feature weighted statistics of a range of rows: total weight, weighted mean,
+ * weighted sum of squared deviations from the mean, weighted sum of squares, min and max */
+template <typename algorithmFPType, CpuType cpu>
+struct DecayedMomentsAccumulator
+{
+    DecayedMomentsAccumulator(size_t nFeatures) : weight(0), mean(nFeatures), m2(nFeatures), sumSq(nFeatures), min(nFeatures), max(nFeatures)
+    {
+        const algorithmFPType maxVal = daal::services::internal::MaxVal<algorithmFPType>::get();
+        if (!isValid()) return;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j]  = 0;
+            m2[j]    = 0;
+            sumSq[j] = 0;
+            min[j]   = maxVal;
+            max[j]   = -maxVal;
+        }
+    }
+
+    bool isValid() const { return mean.get() && m2.get() && sumSq.get() && min.get() && max.get(); }
+
+    /* Weighted Welford update with a single row */
+    void update(const algorithmFPType * x, algorithmFPType w, size_t nFeatures)
+    {
+        weight += w;
+        const algorithmFPType ratio = (weight > 0 ? w / weight : 0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType delta = x[j] - mean[j];
+            mean[j] += ratio * delta;
+            m2[j] += w * delta * (x[j] - mean[j]);
+            sumSq[j] += w * x[j] * x[j];
+            min[j] = (x[j] < min[j] ? x[j] : min[j]);
+            max[j] = (x[j] > max[j] ? x[j] : max[j]);
+        }
+    }
+
+    /* Weighted pairwise merge of the statistics of another range of rows */
+    void merge(const DecayedMomentsAccumulator & other, size_t nFeatures)
+    {
+        const algorithmFPType total = weight + other.weight;
+        const algorithmFPType ratio = (total > 0 ? other.weight / total : 0);
+        const algorithmFPType coeff = (total > 0 ? weight * other.weight / total : 0);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType delta = other.mean[j] - mean[j];
+            mean[j] += ratio * delta;
+            m2[j] += other.m2[j] + coeff * delta * delta;
+            sumSq[j] += other.sumSq[j];
+            min[j] = (other.min[j] < min[j] ? other.min[j] : min[j]);
+            max[j] = (other.max[j] > max[j] ? other.max[j] : max[j]);
+        }
+        weight = total;
+    }
+
+    algorithmFPType weight;
+    TArray<algorithmFPType, cpu> mean;
+    TArray<algorithmFPType, cpu> m2;
+    TArray<algorithmFPType, cpu> sumSq;
+    TArray<algorithmFPType, cpu> min;
+    TArray<algorithmFPType, cpu> max;
+};
+
+/* Online update with exponential forgetting: row i of the n-row block gets the weight
+ * f^(n-1-i) and the partial results accumulated so far are scaled by f^n */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeDecayed(NumericTable * dataTable, PartialResult * partialResult, algorithmFPType forgettingFactor, bool isOnline)
+{
+    typedef DecayedMomentsAccumulator<algorithmFPType, cpu> Accumulator;
+
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    if (nVectors == 0) return Status();
+
+    const size_t blockSize = 256;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    const algorithmFPType invFactor = algorithmFPType(1) / forgettingFactor;
+
+    SafeStatus safeStat;
+    daal::tls<Accumulator *> tlsAcc([=, &safeStat]() -> Accumulator * {
+        Accumulator * acc = new Accumulator(nFeatures);
+        if (!acc || !acc->isValid())
+        {
+            delete acc;
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            return nullptr;
+        }
+        return acc;
+    });
+
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        Accumulator * acc = tlsAcc.local();
+        if (!acc) return;
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
+        const algorithmFPType * data = dataRows.get();
+
+        /* Weights grow towards the end of the block: w(i + 1) = w(i) / f */
+        algorithmFPType w = Math<algorithmFPType, cpu>::sPowx(forgettingFactor, algorithmFPType(nVectors - 1 - startRow));
+        for (size_t i = 0; i < nRows; i++, w *= invFactor)
+        {
+            acc->update(data + i * nFeatures, w, nFeatures);
+        }
+    });
+
+    Accumulator * total = nullptr;
+    tlsAcc.reduce([&](Accumulator * acc) {
+        if (!acc) return;
+        if (!total)
+        {
+            total = acc;
+            return;
+        }
+        total->merge(*acc, nFeatures);
+        delete acc;
+    });
+    Status s = safeStat.detach();
+    if (!s || !total)
+    {
+        delete total;
+        return s ? Status(services::ErrorMemoryAllocationFailed) : s;
+    }
+
+    WriteRows<algorithmFPType, cpu> nObsRows(partialResult->get(nObservations).get(), 0, 1);
+    WriteRows<algorithmFPType, cpu> minRows(partialResult->get(partialMinimum).get(), 0, 1);
+    WriteRows<algorithmFPType, cpu> maxRows(partialResult->get(partialMaximum).get(), 0, 1);
+    WriteRows<algorithmFPType, cpu> sumRows(partialResult->get(partialSum).get(), 0, 1);
+    WriteRows<algorithmFPType, cpu> sumSqRows(partialResult->get(partialSumSquares).get(), 0, 1);
+    WriteRows<algorithmFPType, cpu> sumSqCenRows(partialResult->get(partialSumSquaresCentered).get(), 0, 1);
+    if (!nObsRows.get() || !minRows.get() || !maxRows.get() || !sumRows.get() || !sumSqRows.get() || !sumSqCenRows.get())
+    {
+        delete total;
+        return Status(services::ErrorMemoryAllocationFailed);
+    }
+
+    algorithmFPType * pMin      = minRows.get();
+    algorithmFPType * pMax      = maxRows.get();
+    algorithmFPType * pSum      = sumRows.get();
+    algorithmFPType * pSumSq    = sumSqRows.get();
+    algorithmFPType * pSumSqCen = sumSqCenRows.get();
+
+    const algorithmFPType decay = Math<algorithmFPType, cpu>::sPowx(forgettingFactor, algorithmFPType(nVectors));
+
+    const algorithmFPType prevWeight = (isOnline ? nObsRows.get()[0] * decay : algorithmFPType(0));
+    const algorithmFPType newWeight  = prevWeight + total->weight;
+    const algorithmFPType coeff      = (newWeight > 0 ? prevWeight * total->weight / newWeight : 0);
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (isOnline)
+        {
+            const algorithmFPType prevSum  = pSum[j] * decay;
+            const algorithmFPType prevMean = (prevWeight > 0 ? prevSum / prevWeight : 0);
+            const algorithmFPType delta    = total->mean[j] - prevMean;
+
+            pSumSqCen[j] = pSumSqCen[j] * decay + total->m2[j] + coeff * delta * delta;
+            pSum[j]      = prevSum + total->weight * total->mean[j];
+            pSumSq[j]    = pSumSq[j] * decay + total->sumSq[j];
+            pMin[j]      = (total->min[j] < pMin[j] ? total->min[j] : pMin[j]);
+            pMax[j]      = (total->max[j] > pMax[j] ? total->max[j] : pMax[j]);
+        }
+        else
+        {
+            pSumSqCen[j] = total->m2[j];
+            pSum[j]      = total->weight * total->mean[j];
+            pSumSq[j]    = total->sumSq[j];
+            pMin[j]      = total->min[j];
+            pMax[j]      = total->max[j];
+        }
+    }
+    nObsRows.get()[0] = newWeight;
+
+    delete total;
+    return Status();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable * dataTable, PartialResult * partialResult,
                                                                                     const Parameter * parameter, bool isOnline)
 {
+    if (parameter->featureIndices) return Status(ErrorMethodNotImplemented);
+    if (parameter->forgettingFactor < 1.0)
+    {
+        return computeDecayed<algorithmFPType, cpu>(dataTable, partialResult, (algorithmFPType)parameter->forgettingFactor, isOnline);
+    }
+
     if (method == defaultDense)
     {
         switch (parameter->estimatesToCompute)
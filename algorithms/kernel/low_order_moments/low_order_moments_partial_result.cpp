@@ -119,10 +119,11 @@ services::Status PartialResult::checkImpl(size_t nFeatures) const
     return s;
 }
 
-Parameter::Parameter(EstimatesToCompute _estimatesToCompute) : estimatesToCompute(_estimatesToCompute) {}
+Parameter::Parameter(EstimatesToCompute _estimatesToCompute) : estimatesToCompute(_estimatesToCompute), forgettingFactor(1.0) {}
 
 services::Status Parameter::check() const
 {
+    DAAL_CHECK_EX(forgettingFactor > 0.0 && forgettingFactor <= 1.0, ErrorIncorrectParameter, ParameterName, forgettingFactorStr());
     return Status();
 }
 
@@ -83,6 +83,8 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     size_t nFeatures = 0;
     services::Status s;
     DAAL_CHECK_STATUS(s, (static_cast<const InputIface *>(input))->getNumberOfColumns(nFeatures));
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+    if (parameter && parameter->featureIndices) nFeatures = parameter->featureIndices->getNumberOfColumns();
     return checkImpl(nFeatures);
 }
 
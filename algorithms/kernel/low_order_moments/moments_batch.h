@@ -47,6 +47,8 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     services::Status s;
     size_t nFeatures = 0;
     DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfColumns(nFeatures));
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+    if (par && par->featureIndices) nFeatures = par->featureIndices->getNumberOfColumns();
 
     auto & context    = oneapi::internal::getDefaultContext();
     auto & deviceInfo = context.getInfoDevice();
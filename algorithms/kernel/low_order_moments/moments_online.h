@@ -56,7 +56,12 @@ DAAL_EXPORT services::Status PartialResult::allocate(const daal::algorithms::Inp
 
     if (method != defaultDense || deviceInfo.isCpu)
     {
-        set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
+        /* With forgetting the number of observations is the sum of their weights, it is not integer */
+        const Parameter * par = static_cast<const Parameter *>(parameter);
+        if (par && par->forgettingFactor < 1.0)
+            set(nObservations, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+        else
+            set(nObservations, HomogenNumericTable<size_t>::create(1, 1, NumericTable::doAllocate, &s));
         for (size_t i = 1; i < lastPartialResultId + 1; i++)
         {
             Argument::set(i, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
@@ -0,0 +1,63 @@
+/* file: low_order_moments_csr_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of low order moments kernels for CSR data.
+//--
+*/
+
+#ifndef __LOW_ORDER_MOMENTS_CSR_KERNELS_CL__
+#define __LOW_ORDER_MOMENTS_CSR_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    low_order_moments_csr_kernels,
+
+    __kernel void finalizeCSR(const uint nVectors, const uint nFeatures, __global const algorithmFPType * sums,
+                              __global const algorithmFPType * sqSums, __global const algorithmFPType * minimums,
+                              __global const algorithmFPType * maximums, __global algorithmFPType * gMin, __global algorithmFPType * gMax,
+                              __global algorithmFPType * gSum, __global algorithmFPType * gSum2, __global algorithmFPType * gSum2Cent,
+                              __global algorithmFPType * gMean, __global algorithmFPType * gSecondOrderRawMoment, __global algorithmFPType * gVariance,
+                              __global algorithmFPType * gStDev, __global algorithmFPType * gVariation) {
+        const uint col = get_global_id(0);
+        if (col >= nFeatures) return;
+
+        const algorithmFPType n        = (algorithmFPType)nVectors;
+        const algorithmFPType sum      = sums[col];
+        const algorithmFPType sum2     = sqSums[col];
+        const algorithmFPType mean     = sum / n;
+        const algorithmFPType sum2Cent = sum2 - sum * mean;
+        const algorithmFPType variance = sum2Cent / (n - (algorithmFPType)1);
+        const algorithmFPType stDev    = (algorithmFPType)sqrt(variance);
+
+        gMin[col]                  = minimums[col];
+        gMax[col]                  = maximums[col];
+        gSum[col]                  = sum;
+        gSum2[col]                 = sum2;
+        gSum2Cent[col]             = sum2Cent;
+        gMean[col]                 = mean;
+        gSecondOrderRawMoment[col] = sum2 / n;
+        gVariance[col]             = variance;
+        gStDev[col]                = stDev;
+        gVariation[col]            = stDev / mean;
+    }
+
+);
+
+#endif
@@ -30,6 +30,7 @@
 #include "services/error_indexes.h"
 #include "algorithms/kernel/low_order_moments/oneapi/cl_kernels/low_order_moments_kernels_all.h"
 #include "algorithms/kernel/low_order_moments/oneapi/low_order_moments_kernel_batch_oneapi.h"
+#include "algorithms/kernel/low_order_moments/oneapi/low_order_moments_csr_batch_oneapi_impl.i"
 #include "externals/service_ittnotify.h"
 #include "oneapi/internal/utils.h"
 
@@ -146,6 +147,10 @@ services::Status LowOrderMomentsBatchKernelOneAPI<algorithmFPType, method>::comp
             return task.compute();
         }
     }
+    else if (method == fastCSR || method == singlePassCSR || method == sumCSR)
+    {
+        return computeCSR<algorithmFPType, method>(context, dataTable, result);
+    }
 
     return status;
 }
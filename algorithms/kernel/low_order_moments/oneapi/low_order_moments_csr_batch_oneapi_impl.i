@@ -0,0 +1,155 @@
+/* file: low_order_moments_csr_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Low order moments computation for CSR data in the batch processing mode on GPU.
+//  As in the CPU implementation of the CSR methods, all the moments are computed.
+//--
+*/
+
+#ifndef __LOW_ORDER_MOMENTS_CSR_BATCH_ONEAPI_IMPL_I__
+#define __LOW_ORDER_MOMENTS_CSR_BATCH_ONEAPI_IMPL_I__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "algorithms/kernel/low_order_moments/oneapi/cl_kernels/low_order_moments_csr_kernels.cl"
+#include "service/kernel/oneapi/sparse_reducer.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace low_order_moments
+{
+namespace oneapi
+{
+namespace internal
+{
+template <typename algorithmFPType>
+static services::Status copyPrecomputedSums(ExecutionContextIface & context, NumericTable * dataTable, size_t nFeatures,
+                                            const UniversalBuffer & sums)
+{
+    NumericTable * const precomputedSumsTable = dataTable->basicStatistics.get(NumericTable::sum).get();
+    if (!precomputedSumsTable) return services::Status(services::ErrorPrecomputedSumNotAvailable);
+
+    services::Status status;
+    BlockDescriptor<algorithmFPType> precomputedSumsBlock;
+    DAAL_CHECK_STATUS(status, precomputedSumsTable->getBlockOfRows(0, 1, readOnly, precomputedSumsBlock));
+
+    context.copy(sums, 0, precomputedSumsBlock.getBuffer(), 0, nFeatures, &status);
+
+    precomputedSumsTable->releaseBlockOfRows(precomputedSumsBlock);
+    return status;
+}
+
+template <typename algorithmFPType, Method method>
+static services::Status computeCSR(ExecutionContextIface & context, NumericTable * dataTable, Result * result)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeCSR);
+
+    services::Status status;
+
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    DAAL_CHECK(nVectors <= static_cast<size_t>(static_cast<uint32_t>(nVectors)), services::ErrorBufferSizeIntegerOverflow);
+    DAAL_CHECK(nFeatures <= static_cast<size_t>(static_cast<uint32_t>(nFeatures)), services::ErrorBufferSizeIntegerOverflow);
+
+    CSRNumericTableIface * csrDataTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
+    DAAL_CHECK(csrDataTable, services::ErrorIncorrectTypeOfInputNumericTable);
+
+    math::SparseReducer::ColumnMajorMatrix matrix;
+    {
+        CSRBlockDescriptor<algorithmFPType> dataBlock;
+        DAAL_CHECK_STATUS(status, csrDataTable->getSparseBlock(0, nVectors, readOnly, dataBlock));
+
+        matrix = math::SparseReducer::toColumnMajor<algorithmFPType>(dataBlock.getBlockValuesPtr(), dataBlock.getBlockColumnIndicesPtr(),
+                                                                     dataBlock.getBlockRowIndicesPtr(), nVectors, nFeatures, &status);
+        csrDataTable->releaseSparseBlock(dataBlock);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    math::SparseReducer::Result columnStatistics =
+        math::SparseReducer::reduceColumns(matrix, TypeIds::id<algorithmFPType>(), nVectors, nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (method == sumCSR)
+    {
+        DAAL_CHECK_STATUS(status, copyPrecomputedSums<algorithmFPType>(context, dataTable, nFeatures, columnStatistics.sum));
+    }
+
+    auto & factory = context.getClKernelFactory();
+    {
+        auto build_options = getKeyFPType<algorithmFPType>();
+        build_options.add(" -cl-std=CL1.2 ");
+
+        services::String cachekey("__daal_algorithms_low_order_moments_batch_kernels_csr");
+        cachekey.add(getKeyFPType<algorithmFPType>());
+
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), low_order_moments_csr_kernels, build_options.c_str(), &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    auto kernel = factory.getKernel("finalizeCSR", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    TaskInfoBatch<algorithmFPType, estimatesAll> info;
+    NumericTablePtr resultTable[TaskInfoBatch<algorithmFPType, estimatesAll>::nResults];
+    BlockDescriptor<algorithmFPType> resultBD[TaskInfoBatch<algorithmFPType, estimatesAll>::nResults];
+
+    unsigned int nAcquired = 0;
+    for (; nAcquired < TaskInfoBatch<algorithmFPType, estimatesAll>::nResults; nAcquired++)
+    {
+        resultTable[nAcquired] = result->get((ResultId)info.resIds[nAcquired]);
+        status |= resultTable[nAcquired]->getBlockOfRows(0, 1, writeOnly, resultBD[nAcquired]);
+        if (!status) break;
+    }
+
+    if (status)
+    {
+        KernelArguments args(6 + TaskInfoBatch<algorithmFPType, estimatesAll>::nResults);
+
+        unsigned int argsI = 0;
+        args.set(argsI++, static_cast<uint32_t>(nVectors));
+        args.set(argsI++, static_cast<uint32_t>(nFeatures));
+        args.set(argsI++, columnStatistics.sum, AccessModeIds::read);
+        args.set(argsI++, columnStatistics.sumOfSquares, AccessModeIds::read);
+        args.set(argsI++, columnStatistics.minimum, AccessModeIds::read);
+        args.set(argsI++, columnStatistics.maximum, AccessModeIds::read);
+        for (unsigned int i = 0; i < TaskInfoBatch<algorithmFPType, estimatesAll>::nResults; i++)
+        {
+            args.set(argsI++, resultBD[i].getBuffer(), AccessModeIds::write);
+        }
+
+        KernelRange range(nFeatures);
+        context.run(range, kernel, args, &status);
+    }
+
+    for (unsigned int i = 0; i < nAcquired; i++)
+    {
+        resultTable[i]->releaseBlockOfRows(resultBD[i]);
+    }
+
+    return status;
+}
+
+} // namespace internal
+} // namespace oneapi
+} // namespace low_order_moments
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -70,6 +70,34 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_CHECK_STATUS(s, computeDataSize(nVectors, nFeatures, nClasses, xTable, y, nSubsetVectors, dataSize));
     }
 
+    /* Group the observations by classes once, the training subsets of all the pairs of classes are gathered from the groups */
+    TArray<size_t, cpu> classOffsetsBuffer(nClasses + 1);
+    TArray<size_t, cpu> classRowsBuffer(nVectors);
+    DAAL_CHECK_MALLOC(classOffsetsBuffer.get() && classRowsBuffer.get());
+    const size_t * classOffsets = classOffsetsBuffer.get();
+    const size_t * classRows    = classRowsBuffer.get();
+    {
+        Status s;
+        DAAL_CHECK_STATUS(s, groupByClasses(nVectors, nClasses, y, classOffsetsBuffer.get(), classRowsBuffer.get()));
+    }
+
+    /* Train the models of the largest pairs of classes first for the better load balance of the threads */
+    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
+    TArray<size_t, cpu> modelOrderBuffer(nModels);
+    TArray<size_t, cpu> modelSizeBuffer(nModels);
+    DAAL_CHECK_MALLOC(modelOrderBuffer.get() && modelSizeBuffer.get());
+    size_t * modelOrder = modelOrderBuffer.get();
+    size_t * modelSize  = modelSizeBuffer.get();
+    for (size_t i = 1, imodel = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, imodel++)
+        {
+            modelOrder[imodel] = imodel;
+            modelSize[imodel]  = (classOffsets[i + 1] - classOffsets[i]) + (classOffsets[j + 1] - classOffsets[j]);
+        }
+    }
+    daal::algorithms::internal::qSort<size_t, size_t, cpu>(nModels, modelSize, modelOrder);
+
     typedef SubTask<algorithmFPType, ClsType, cpu> TSubTask;
     /* Allocate memory for storing subsets of input data */
     daal::ls<TSubTask *> lsTask([=, &simpleTrainingInit]() {
@@ -79,8 +107,9 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
     });
 
     SafeStatus safeStat;
-    const size_t nModels = (nClasses * (nClasses - 1)) >> 1;
-    daal::threader_for(nModels, nModels, [&](size_t imodel) {
+    daal::threader_for(nModels, nModels, [&](size_t iTask) {
+        const size_t imodel = modelOrder[nModels - 1 - iTask];
+
         /* Find indices of positive and negative classes for current model */
         size_t i    = 1; /* index of the positive class */
         size_t j    = 0; /* index of the negative class */
@@ -101,7 +130,7 @@ services::Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType,
         DAAL_LS_RELEASE(TSubTask, lsTask, local); //releases local storage when leaving this scope
 
         size_t nRowsInSubset = 0;
-        Status s             = local->getDataSubset(nFeatures, nVectors, i, j, y, nRowsInSubset);
+        Status s             = local->getDataSubset(nFeatures, classRows, classOffsets, i, j, nRowsInSubset);
         DAAL_CHECK_STATUS_THR(s);
         classifier::ModelPtr pModel;
         if (nRowsInSubset)
@@ -167,14 +196,42 @@ Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType,
     return Status();
 }
 
+template <typename algorithmFPType, typename ClsType, typename MccParType, CpuType cpu>
+Status MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, ClsType, MccParType, cpu>::groupByClasses(
+    size_t nVectors, size_t nClasses, const int * y, size_t * classOffsets, size_t * classRows)
+{
+    daal::services::internal::service_memset<size_t, cpu>(classOffsets, 0, nClasses + 1);
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        classOffsets[y[i] + 1]++;
+    }
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        classOffsets[i + 1] += classOffsets[i];
+    }
+
+    TArray<size_t, cpu> classPositionBuffer(nClasses);
+    DAAL_CHECK_MALLOC(classPositionBuffer.get());
+    size_t * classPosition = classPositionBuffer.get();
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        classPosition[i] = classOffsets[i];
+    }
+    /* The observations of each class keep their order in the input data set */
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        classRows[classPosition[y[i]]++] = i;
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                         const int * y, size_t & nRows)
+Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                         algorithmFPType label, size_t & nRows)
 {
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t iRow = 0; iRow < nClassRows; iRow++)
     {
-        if (y[ix] != classIdx) continue;
-        _mtX.next(ix, 1);
+        _mtX.next(rows[iRow], 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         PRAGMA_IVDEP
         PRAGMA_VECTOR_ALWAYS
@@ -186,15 +243,14 @@ Status SubTaskDense<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t
 }
 
 template <typename algorithmFPType, typename ClsType, CpuType cpu>
-Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                                                                       const int * y, size_t & nRows)
+Status SubTaskCSR<algorithmFPType, ClsType, cpu>::copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows,
+                                                                       algorithmFPType label, size_t & nRows)
 {
     _rowOffsetsX[0]  = 1;
     size_t dataIndex = (nRows ? _rowOffsetsX[nRows] - _rowOffsetsX[0] : 0);
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t iRow = 0; iRow < nClassRows; iRow++)
     {
-        if (y[ix] != classIdx) continue;
-        _mtX.next(ix, 1);
+        _mtX.next(rows[iRow], 1);
         DAAL_CHECK_BLOCK_STATUS(_mtX);
         const size_t nNonZeroValuesInRow = _mtX.rows()[1] - _mtX.rows()[0];
         const size_t * colIndices        = _mtX.cols();
@@ -52,13 +52,25 @@ public:
     DAAL_NEW_DELETE();
     virtual ~SubTask() {}
 
-    services::Status getDataSubset(size_t nFeatures, size_t nVectors, int classIdxPositive, int classIdxNegative, const int * y, size_t & nRows)
+    /**
+     * Gathers the training subset of the pair of classes
+     * \param[in]  nFeatures         Number of features
+     * \param[in]  classRows         Indices of the observations grouped by classes
+     * \param[in]  classOffsets      Offsets of the groups of classes in classRows
+     * \param[in]  classIdxPositive  Index of the positive class
+     * \param[in]  classIdxNegative  Index of the negative class
+     * \param[out] nRows             Number of observations in the subset
+     */
+    services::Status getDataSubset(size_t nFeatures, const size_t * classRows, const size_t * classOffsets, size_t classIdxPositive,
+                                   size_t classIdxNegative, size_t & nRows)
     {
         nRows = 0;
         /* Prepare "positive" observations of the training subset */
-        services::Status s = copyDataIntoSubtable(nFeatures, nVectors, classIdxPositive, 1, y, nRows);
+        services::Status s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxPositive],
+                                                  classOffsets[classIdxPositive + 1] - classOffsets[classIdxPositive], 1, nRows);
         if (s) /* Prepare "negative" observations of the training subset */
-            s = copyDataIntoSubtable(nFeatures, nVectors, classIdxNegative, -1, y, nRows);
+            s = copyDataIntoSubtable(nFeatures, classRows + classOffsets[classIdxNegative],
+                                     classOffsets[classIdxNegative + 1] - classOffsets[classIdxNegative], -1, nRows);
         return s;
     }
 
@@ -93,7 +105,7 @@ protected:
 
     bool isValid() const { return _subsetX.get() && _subsetYTable.get() && _simpleTraining.get(); }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const int * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) = 0;
 
 protected:
@@ -135,7 +147,7 @@ private:
         }
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const int * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
@@ -171,7 +183,7 @@ private:
         if (!status) return;
     }
 
-    virtual services::Status copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label, const int * y,
+    virtual services::Status copyDataIntoSubtable(size_t nFeatures, const size_t * rows, size_t nClassRows, algorithmFPType label,
                                                   size_t & nRows) DAAL_C11_OVERRIDE;
 
 private:
@@ -188,6 +200,8 @@ public:
 protected:
     services::Status computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses, const NumericTable * xTable, const int * y,
                                      size_t & nSubsetVectors, size_t & dataSize);
+
+    services::Status groupByClasses(size_t nVectors, size_t nClasses, const int * y, size_t * classOffsets, size_t * classRows);
 };
 
 } // namespace internal
@@ -90,6 +90,35 @@ struct methodSpecific<fastCSR, algorithmFPType, cpu>
                                               int * classes, algorithmFPType * buff);
 };
 
+/**
+ * Computes the index of the maximal element in each row of the matrix of size n x c stored by columns.
+ * The loop over rows is the inner one to be vectorized, the first maximal element is selected as in the sequential search
+ */
+template <typename algorithmFPType, CpuType cpu>
+static void argmaxByColumns(const algorithmFPType * buff, size_t n, size_t c, algorithmFPType * maxVal, int * classes)
+{
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < n; j++)
+    {
+        maxVal[j]  = buff[j];
+        classes[j] = 0;
+    }
+
+    for (size_t cl = 1; cl < c; cl++)
+    {
+        const algorithmFPType * column = buff + cl * n;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < n; j++)
+        {
+            const bool isGreater = (column[j] > maxVal[j]);
+            maxVal[j]            = isGreater ? column[j] : maxVal[j];
+            classes[j]           = isGreater ? int(cl) : classes[j];
+        }
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::compute(const NumericTable * a, const Model * m, NumericTable * r,
                                                                                 const multinomial_naive_bayes::interface1::Parameter * parameter)
@@ -123,10 +152,11 @@ services::Status NaiveBayesPredictKernel<algorithmFPType, method, cpu>::compute(
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult, c);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult * c, sizeof(algorithmFPType));
+    /* Class scores of the block of rows stored by classes followed by the maximal scores */
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult, c + 1);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, blockSizeDeafult * (c + 1), sizeof(algorithmFPType));
 
-    daal::tls<algorithmFPType *> mkl_buff([=]() -> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(blockSizeDeafult * c); });
+    daal::tls<algorithmFPType *> mkl_buff([=]() -> algorithmFPType * { return _CALLOC_<algorithmFPType, cpu>(blockSizeDeafult * (c + 1)); });
 
     SafeStatus safeStat;
     daal::threader_for(nBlocks, nBlocks, [=, &mkl_buff, &safeStat](int k) {
@@ -164,39 +194,22 @@ services::Status methodSpecific<defaultDense, algorithmFPType, cpu>::getPredicti
     const algorithmFPType * data = rrData.get();
 
     {
+        /* buff = data * aux_table^T of size n x c stored by columns */
         const char transa           = 't';
         const char transb           = 'n';
-        const DAAL_INT _m           = c;
-        const DAAL_INT _n           = n;
+        const DAAL_INT _m           = n;
+        const DAAL_INT _n           = c;
         const DAAL_INT _k           = p;
         const algorithmFPType alpha = 1.0;
         const DAAL_INT lda          = p;
         const DAAL_INT ldy          = p;
         const algorithmFPType beta  = 0.0;
-        const DAAL_INT ldaty        = c;
+        const DAAL_INT ldaty        = n;
 
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, aux_table, &lda, data, &ldy, &beta, buff, &ldaty);
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data, &lda, aux_table, &ldy, &beta, buff, &ldaty);
     }
 
-    for (size_t j = 0; j < n; j++)
-    {
-        int max_c                 = 0;
-        algorithmFPType max_c_val = -(services::internal::MaxVal<algorithmFPType>::get());
-
-        PRAGMA_IVDEP
-        for (size_t cl = 0; cl < c; cl++)
-        {
-            algorithmFPType val = buff[j * c + cl];
-
-            if (val > max_c_val)
-            {
-                max_c_val = val;
-                max_c     = cl;
-            }
-        }
-
-        classes[j] = max_c;
-    }
+    argmaxByColumns<algorithmFPType, cpu>(buff, n, c, buff + n * c, classes);
 
     return services::Status();
 }
@@ -226,25 +239,7 @@ services::Status methodSpecific<fastCSR, algorithmFPType, cpu>::getPredictionDat
                                               &_p, &beta, buff, &_n);
     }
 
-    for (size_t j = 0; j < n; j++)
-    {
-        int max_c                 = 0;
-        algorithmFPType max_c_val = -(services::internal::MaxVal<algorithmFPType>::get());
-
-        PRAGMA_IVDEP
-        for (size_t cl = 0; cl < c; cl++)
-        {
-            algorithmFPType val = buff[j + cl * n];
-
-            if (val > max_c_val)
-            {
-                max_c_val = val;
-                max_c     = cl;
-            }
-        }
-
-        classes[j] = max_c;
-    }
+    argmaxByColumns<algorithmFPType, cpu>(buff, n, c, buff + n * c, classes);
 
     return services::Status();
 }
@@ -118,7 +118,7 @@ struct localDataCollector<algorithmFPType, fastCSR, cpu>
     size_t _p;
     size_t _c;
 
-    ReadRowsCSR<algorithmFPType, cpu> rrData;
+    ReadRowsCSRNative<algorithmFPType, cpu> rrData;
     ReadRows<int, cpu> rrClass;
 
     algorithmFPType * n_ci;
@@ -139,6 +139,7 @@ struct localDataCollector<algorithmFPType, fastCSR, cpu>
         const algorithmFPType * data = rrData.values();
         const size_t * colIdx        = rrData.cols();
         const size_t * rowIdx        = rrData.rows();
+        const size_t indexBase       = rrData.indexBase();
         const int * predefClass      = rrClass.get();
 
         size_t k = 0;
@@ -152,7 +153,7 @@ struct localDataCollector<algorithmFPType, fastCSR, cpu>
             PRAGMA_VECTOR_ALWAYS
             for (size_t i = 0; i < jn; i++)
             {
-                size_t col = colIdx[k + i] - 1;
+                size_t col = colIdx[k + i] - indexBase;
 
                 n_ci[cl * _p + col] += data[k + i];
             }
@@ -194,22 +195,41 @@ Status collectCounters(const Parameter * nbPar, NumericTable * ntData, NumericTa
         }
     });
 
-    tls_n_ci.reduce([=](algorithmFPType * v) {
-        if (!v) return;
+    /* The local counters are added by pairs in parallel, the sum of all of them is added to the counters of the model */
+    tls_n_ci.tree_reduce(
+        [=](algorithmFPType *& dst, algorithmFPType *& src) {
+            if (!src) return;
+            if (!dst)
+            {
+                dst = src;
+                src = nullptr;
+                return;
+            }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < p * c; i++)
+            {
+                dst[i] += src[i];
+            }
+            _FREE_<algorithmFPType, cpu>(src);
+            src = nullptr;
+        },
+        [=](algorithmFPType * v) {
+            if (!v) return;
 
-        PRAGMA_IVDEP
-        PRAGMA_VECTOR_ALWAYS
-        PRAGMA_VECTOR_ALIGNED
-        for (size_t j = 0; j < c; j++)
-        {
-            for (size_t i = 0; i < p; i++)
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            PRAGMA_VECTOR_ALIGNED
+            for (size_t j = 0; j < c; j++)
             {
-                n_ci[j * p + i] += v[j * p + i];
-                n_c[j] += v[j * p + i];
+                for (size_t i = 0; i < p; i++)
+                {
+                    n_ci[j * p + i] += v[j * p + i];
+                    n_c[j] += v[j * p + i];
+                }
             }
-        }
-        _FREE_<algorithmFPType, cpu>(v);
-    });
+            _FREE_<algorithmFPType, cpu>(v);
+        });
 
     return safeStat.detach();
 }
@@ -41,7 +41,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input() : daal::algorithms::Input(lastOptionalInputId + 1) {}
 Input::Input(const Input & other) : daal::algorithms::Input(other) {}
 
 /**
@@ -64,6 +64,26 @@ void Input::set(InputId id, const NumericTablePtr & ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an optional input object for the min-max normalization algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+low_order_moments::PartialResultPtr Input::get(OptionalInputId id) const
+{
+    return staticPointerCast<low_order_moments::PartialResult, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the optional input object of the min-max normalization algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(OptionalInputId id, const low_order_moments::PartialResultPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Check the correctness of the %Input object
  * \param[in] par       Algorithm parameter
@@ -88,6 +108,13 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     {
         DAAL_CHECK_STATUS(s, checkNumericTable(maximumsTable.get(), basicStatisticsMaximumStr(), 0, 0, nColumns, 1));
     }
+
+    low_order_moments::PartialResultPtr moments = get(partialMoments);
+    if (moments)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(moments->get(low_order_moments::partialMinimum).get(), partialMinimumStr(), 0, 0, nColumns, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(moments->get(low_order_moments::partialMaximum).get(), partialMaximumStr(), 0, 0, nColumns, 1));
+    }
     return s;
 }
 
@@ -27,6 +27,8 @@
 #include "algorithms/normalization/minmax.h"
 #include "algorithms/kernel/normalization/minmax/minmax_moments.h"
 #include "algorithms/kernel/normalization/minmax/minmax_kernel.h"
+#include "algorithms/kernel/normalization/minmax/oneapi/minmax_kernel_oneapi.h"
+#include "oneapi/internal/execution_context.h"
 
 namespace daal
 {
@@ -41,7 +43,17 @@ namespace interface1
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::MinMaxKernel, algorithmFPType, method);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::MinMaxKernel, algorithmFPType, method);
+    }
+    else
+    {
+        _kernel = new internal::MinMaxKernelOneAPI<algorithmFPType>();
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -64,7 +76,28 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTablePtr minimums;
     NumericTablePtr maximums;
     Status s;
-    DAAL_CHECK_STATUS(s, internal::computeMinimumsAndMaximums(moments, dataTable, minimums, maximums));
+
+    /* Precomputed moments allow to skip the extra pass over the data */
+    low_order_moments::PartialResultPtr partialMoments = input->get(minmax::partialMoments);
+    if (partialMoments)
+    {
+        minimums = partialMoments->get(low_order_moments::partialMinimum);
+        maximums = partialMoments->get(low_order_moments::partialMaximum);
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, internal::computeMinimumsAndMaximums(moments, dataTable, minimums, maximums));
+    }
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (!deviceInfo.isCpu)
+    {
+        return ((internal::MinMaxKernelOneAPI<algorithmFPType> *)(_kernel))
+            ->compute(*dataTable, *normalizedDataTable, *minimums, *maximums, (algorithmFPType)(parameter->lowerBound),
+                      (algorithmFPType)(parameter->upperBound));
+    }
 
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::MinMaxKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *dataTable.get(),
@@ -23,6 +23,8 @@
 
 #include "algorithms/normalization/minmax_types.h"
 #include "service/kernel/daal_strings.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table_sycl_homogen.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -45,6 +47,19 @@ namespace interface1
  */
 template <typename algorithmFPType>
 DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, int method)
+{
+    return allocate<algorithmFPType>(input, NULL, method);
+}
+
+/**
+ * Allocates memory to store the result of the minmax normalization algorithm,
+ * in the in-place mode the input data table is used to store the normalized data
+ * \param[in] input     %Input object for the minmax normalization algorithm
+ * \param[in] parameter %Parameter of the minmax normalization algorithm
+ * \param[in] method    Computation method of the minmax normalization algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method)
 {
     DAAL_CHECK(input, ErrorNullInput);
 
@@ -54,15 +69,35 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, int m
     Status s;
     DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
 
-    const size_t nRows                  = dataTable->getNumberOfRows();
-    const size_t nColumns               = dataTable->getNumberOfColumns();
-    NumericTablePtr normalizedDataTable = HomogenNumericTable<algorithmFPType>::create(nColumns, nRows, NumericTable::doAllocate, &s);
+    const ParameterBase * algParameter = static_cast<const ParameterBase *>(parameter);
+    if (algParameter && algParameter->inPlace)
+    {
+        set(normalizedData, dataTable);
+        return s;
+    }
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    const size_t nRows    = dataTable->getNumberOfRows();
+    const size_t nColumns = dataTable->getNumberOfColumns();
+    NumericTablePtr normalizedDataTable;
+    if (deviceInfo.isCpu)
+    {
+        normalizedDataTable = HomogenNumericTable<algorithmFPType>::create(nColumns, nRows, NumericTable::doAllocate, &s);
+    }
+    else
+    {
+        normalizedDataTable = SyclHomogenNumericTable<algorithmFPType>::create(nColumns, nRows, NumericTable::doAllocate, &s);
+    }
     DAAL_CHECK_STATUS_VAR(s);
     set(normalizedData, normalizedDataTable);
     return s;
 }
 
 template DAAL_EXPORT Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, int method);
+template DAAL_EXPORT Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter,
+                                                          int method);
 
 } // namespace interface1
 } // namespace minmax
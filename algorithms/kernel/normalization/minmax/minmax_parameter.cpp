@@ -38,7 +38,7 @@ namespace interface1
 {
 /** Constructs min-max normalization parameters */
 DAAL_EXPORT ParameterBase::ParameterBase(double lowerBound, double upperBound, const SharedPtr<low_order_moments::BatchImpl> & moments)
-    : lowerBound(lowerBound), upperBound(upperBound), moments(moments)
+    : lowerBound(lowerBound), upperBound(upperBound), inPlace(false), moments(moments)
 {}
 
 /**
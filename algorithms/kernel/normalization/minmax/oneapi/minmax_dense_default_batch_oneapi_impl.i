@@ -0,0 +1,83 @@
+/* file: minmax_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of min-max normalization on GPU. The data is shifted by the minimums and scaled
+//  to the range [lowerBound, upperBound] by one fused pass that may overwrite the input table.
+//--
+*/
+
+#ifndef __MINMAX_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __MINMAX_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/normalization/oneapi/normalization_kernel_oneapi_impl.i"
+#include "externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(normalization.minmax.dense.default.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services;
+
+template <typename algorithmFPType>
+Status MinMaxKernelOneAPI<algorithmFPType>::compute(NumericTable & inputTable, NumericTable & resultTable, NumericTable & minimums,
+                                                     NumericTable & maximums, const algorithmFPType lowerBound, const algorithmFPType upperBound)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    const size_t nFeatures = inputTable.getNumberOfColumns();
+    DAAL_CHECK(nFeatures <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    BlockDescriptor<algorithmFPType> minimumsBlock;
+    DAAL_CHECK_STATUS(status, minimums.getBlockOfRows(0, 1, ReadWriteMode::readOnly, minimumsBlock));
+    BlockDescriptor<algorithmFPType> maximumsBlock;
+    DAAL_CHECK_STATUS(status, maximums.getBlockOfRows(0, 1, ReadWriteMode::readOnly, maximumsBlock));
+
+    UniversalBuffer scale = ctx.allocate(TypeIds::id<algorithmFPType>(), nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, NormalizationKernel::computeMinMaxScale(minimumsBlock.getBuffer(), maximumsBlock.getBuffer(), upperBound - lowerBound,
+                                                                      uint32_t(nFeatures), scale));
+
+    DAAL_CHECK_STATUS(status, NormalizationKernel::scaleAndShift(inputTable, resultTable, minimumsBlock.getBuffer(), scale, lowerBound));
+
+    DAAL_CHECK_STATUS(status, maximums.releaseBlockOfRows(maximumsBlock));
+    DAAL_CHECK_STATUS(status, minimums.releaseBlockOfRows(minimumsBlock));
+
+    resultTable.setNormalizationFlag(NumericTableIface::minMaxNormalized);
+    return status;
+}
+
+} // namespace internal
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,61 @@
+/* file: minmax_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class that computes min-max normalization on GPU.
+//--
+*/
+
+#ifndef __MINMAX_KERNEL_ONEAPI_H__
+#define __MINMAX_KERNEL_ONEAPI_H__
+
+#include "algorithms/normalization/minmax_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "algorithms/kernel/normalization/oneapi/normalization_kernel_oneapi.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType>
+class MinMaxKernelOneAPI : public Kernel
+{
+public:
+    services::Status compute(NumericTable & inputTable, NumericTable & resultTable, NumericTable & minimums, NumericTable & maximums,
+                             const algorithmFPType lowerBound, const algorithmFPType upperBound);
+
+private:
+    typedef normalization::internal::NormalizationKernelOneAPI<algorithmFPType> NormalizationKernel;
+};
+
+} // namespace internal
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
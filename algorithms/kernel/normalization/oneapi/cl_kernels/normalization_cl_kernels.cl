@@ -0,0 +1,77 @@
+/* file: normalization_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of normalization OpenCL kernels.
+//--
+*/
+
+#ifndef __NORMALIZATION_CL_KERNELS_CL__
+#define __NORMALIZATION_CL_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    normalization_cl_kernels,
+
+    __kernel void computeMeanVariance(const __global algorithmFPType * sums, const __global algorithmFPType * sumSquaresCentered,
+                                      algorithmFPType invN, algorithmFPType invNm1, __global algorithmFPType * means,
+                                      __global algorithmFPType * variances) {
+        const uint j = get_global_id(0);
+        means[j]     = sums[j] * invN;
+        variances[j] = sumSquaresCentered[j] * invNm1;
+    }
+
+    /* Inverse standard deviations of the features, the features with zero variance are mapped to zeros */
+    __kernel void computeZScoreScale(const __global algorithmFPType * variances, int doScale, __global algorithmFPType * scale) {
+        const uint j = get_global_id(0);
+        if (!doScale)
+        {
+            scale[j] = (algorithmFPType)1;
+            return;
+        }
+        const algorithmFPType variance = variances[j];
+        scale[j]                       = (variance != (algorithmFPType)0) ? (algorithmFPType)1 / sqrt(variance) : (algorithmFPType)0;
+    }
+
+    __kernel void computeMinMaxScale(const __global algorithmFPType * minimums, const __global algorithmFPType * maximums, algorithmFPType delta,
+                                     __global algorithmFPType * scale) {
+        const uint j = get_global_id(0);
+        scale[j]     = delta / (maximums[j] - minimums[j]);
+    }
+
+    /* Shifts the value by the center of the feature, scales it and adds the offset in one pass over the data */
+    __kernel void scaleAndShift(const __global algorithmFPType * x, uint nFeatures, const __global algorithmFPType * center,
+                                const __global algorithmFPType * scale, algorithmFPType offset, __global algorithmFPType * y) {
+        const uint i    = get_global_id(0);
+        const uint j    = get_global_id(1);
+        const ulong idx = (ulong)i * nFeatures + j;
+        y[idx]          = (x[idx] - center[j]) * scale[j] + offset;
+    }
+
+    __kernel void scaleAndShiftInPlace(__global algorithmFPType * x, uint nFeatures, const __global algorithmFPType * center,
+                                       const __global algorithmFPType * scale, algorithmFPType offset) {
+        const uint i    = get_global_id(0);
+        const uint j    = get_global_id(1);
+        const ulong idx = (ulong)i * nFeatures + j;
+        x[idx]          = (x[idx] - center[j]) * scale[j] + offset;
+    }
+
+);
+
+#endif
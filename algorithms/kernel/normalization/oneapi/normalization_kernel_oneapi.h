@@ -0,0 +1,78 @@
+/* file: normalization_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class with the GPU kernels shared by the normalization algorithms.
+//--
+*/
+
+#ifndef __NORMALIZATION_KERNEL_ONEAPI_H__
+#define __NORMALIZATION_KERNEL_ONEAPI_H__
+
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType>
+class NormalizationKernelOneAPI
+{
+public:
+    /* Writes (x - center[j]) * scale[j] + offset into the result table in one pass, the result table may be the input table */
+    static services::Status scaleAndShift(NumericTable & inputTable, NumericTable & resultTable, const oneapi::internal::UniversalBuffer & center,
+                                          const oneapi::internal::UniversalBuffer & scale, algorithmFPType offset);
+
+    static services::Status computeMeanVariance(const oneapi::internal::UniversalBuffer & sums,
+                                                const oneapi::internal::UniversalBuffer & sumSquaresCentered, algorithmFPType nObservations,
+                                                uint32_t nFeatures, oneapi::internal::UniversalBuffer & means,
+                                                oneapi::internal::UniversalBuffer & variances);
+
+    static services::Status computeZScoreScale(const oneapi::internal::UniversalBuffer & variances, bool doScale, uint32_t nFeatures,
+                                               oneapi::internal::UniversalBuffer & scale);
+
+    static services::Status computeMinMaxScale(const oneapi::internal::UniversalBuffer & minimums, const oneapi::internal::UniversalBuffer & maximums,
+                                               algorithmFPType delta, uint32_t nFeatures, oneapi::internal::UniversalBuffer & scale);
+
+    /* Copies the values of the input table into the result table on device */
+    static services::Status copy(NumericTable & inputTable, NumericTable & resultTable);
+
+    /* Copies the values of the buffer into the first row of the table on device */
+    static services::Status writeRow(const oneapi::internal::UniversalBuffer & values, uint32_t nFeatures, NumericTable & table);
+
+private:
+    /* The program is built before every kernel run since the algorithms that compute the moments replace the current program */
+    static services::Status buildProgram(oneapi::internal::ClKernelFactoryIface & factory);
+
+    static services::Status runFeatureKernel(const char * name, uint32_t nFeatures, oneapi::internal::KernelArguments & args);
+};
+
+} // namespace internal
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
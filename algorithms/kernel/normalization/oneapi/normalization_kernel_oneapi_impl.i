@@ -0,0 +1,209 @@
+/* file: normalization_kernel_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the GPU kernels shared by the normalization algorithms.
+//--
+*/
+
+#ifndef __NORMALIZATION_KERNEL_ONEAPI_IMPL_I__
+#define __NORMALIZATION_KERNEL_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/normalization/oneapi/normalization_kernel_oneapi.h"
+#include "algorithms/kernel/normalization/oneapi/cl_kernels/normalization_cl_kernels.cl"
+#include "service/kernel/service_data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services;
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    Status status;
+    services::String options = getKeyFPType<algorithmFPType>();
+
+    services::String cachekey("__daal_algorithms_normalization_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), normalization_cl_kernels, options.c_str(), &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::runFeatureKernel(const char * name, uint32_t nFeatures, KernelArguments & args)
+{
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    DAAL_CHECK_STATUS(status, buildProgram(ctx.getClKernelFactory()));
+
+    KernelPtr kernel = ctx.getClKernelFactory().getKernel(name, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelRange range(nFeatures);
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::scaleAndShift(NumericTable & inputTable, NumericTable & resultTable,
+                                                                 const UniversalBuffer & center, const UniversalBuffer & scale,
+                                                                 algorithmFPType offset)
+{
+    const size_t nRows     = inputTable.getNumberOfRows();
+    const size_t nFeatures = inputTable.getNumberOfColumns();
+    DAAL_CHECK(nRows <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_CHECK(nFeatures <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    DAAL_CHECK_STATUS(status, buildProgram(ctx.getClKernelFactory()));
+
+    const KernelRange range(nRows, nFeatures);
+
+    /* In the in-place mode the data is read and overwritten by the same kernel without the intermediate buffer */
+    if (&inputTable == &resultTable)
+    {
+        KernelPtr kernel = ctx.getClKernelFactory().getKernel("scaleAndShiftInPlace", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        BlockDescriptor<algorithmFPType> dataBlock;
+        DAAL_CHECK_STATUS(status, resultTable.getBlockOfRows(0, nRows, ReadWriteMode::readWrite, dataBlock));
+
+        KernelArguments args(5);
+        args.set(0, dataBlock.getBuffer(), AccessModeIds::readwrite);
+        args.set(1, uint32_t(nFeatures));
+        args.set(2, center, AccessModeIds::read);
+        args.set(3, scale, AccessModeIds::read);
+        args.set(4, offset);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        return resultTable.releaseBlockOfRows(dataBlock);
+    }
+
+    KernelPtr kernel = ctx.getClKernelFactory().getKernel("scaleAndShift", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, inputTable.getBlockOfRows(0, nRows, ReadWriteMode::readOnly, dataBlock));
+    BlockDescriptor<algorithmFPType> resultBlock;
+    DAAL_CHECK_STATUS(status, resultTable.getBlockOfRows(0, nRows, ReadWriteMode::writeOnly, resultBlock));
+
+    KernelArguments args(6);
+    args.set(0, dataBlock.getBuffer(), AccessModeIds::read);
+    args.set(1, uint32_t(nFeatures));
+    args.set(2, center, AccessModeIds::read);
+    args.set(3, scale, AccessModeIds::read);
+    args.set(4, offset);
+    args.set(5, resultBlock.getBuffer(), AccessModeIds::write);
+    ctx.run(range, kernel, args, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DAAL_CHECK_STATUS(status, resultTable.releaseBlockOfRows(resultBlock));
+    return inputTable.releaseBlockOfRows(dataBlock);
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::computeMeanVariance(const UniversalBuffer & sums, const UniversalBuffer & sumSquaresCentered,
+                                                                       algorithmFPType nObservations, uint32_t nFeatures, UniversalBuffer & means,
+                                                                       UniversalBuffer & variances)
+{
+    DAAL_CHECK(nObservations > algorithmFPType(1.0), ErrorIncorrectNumberOfObservations);
+
+    KernelArguments args(6);
+    args.set(0, sums, AccessModeIds::read);
+    args.set(1, sumSquaresCentered, AccessModeIds::read);
+    args.set(2, algorithmFPType(1.0) / nObservations);
+    args.set(3, algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0)));
+    args.set(4, means, AccessModeIds::write);
+    args.set(5, variances, AccessModeIds::write);
+    return runFeatureKernel("computeMeanVariance", nFeatures, args);
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::computeZScoreScale(const UniversalBuffer & variances, bool doScale, uint32_t nFeatures,
+                                                                      UniversalBuffer & scale)
+{
+    KernelArguments args(3);
+    args.set(0, variances, AccessModeIds::read);
+    args.set(1, int(doScale));
+    args.set(2, scale, AccessModeIds::write);
+    return runFeatureKernel("computeZScoreScale", nFeatures, args);
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::computeMinMaxScale(const UniversalBuffer & minimums, const UniversalBuffer & maximums,
+                                                                      algorithmFPType delta, uint32_t nFeatures, UniversalBuffer & scale)
+{
+    KernelArguments args(4);
+    args.set(0, minimums, AccessModeIds::read);
+    args.set(1, maximums, AccessModeIds::read);
+    args.set(2, delta);
+    args.set(3, scale, AccessModeIds::write);
+    return runFeatureKernel("computeMinMaxScale", nFeatures, args);
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::copy(NumericTable & inputTable, NumericTable & resultTable)
+{
+    const size_t nRows     = inputTable.getNumberOfRows();
+    const size_t nFeatures = inputTable.getNumberOfColumns();
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, inputTable.getBlockOfRows(0, nRows, ReadWriteMode::readOnly, dataBlock));
+    BlockDescriptor<algorithmFPType> resultBlock;
+    DAAL_CHECK_STATUS(status, resultTable.getBlockOfRows(0, nRows, ReadWriteMode::writeOnly, resultBlock));
+
+    ctx.copy(resultBlock.getBuffer(), 0, dataBlock.getBuffer(), 0, nRows * nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    DAAL_CHECK_STATUS(status, resultTable.releaseBlockOfRows(resultBlock));
+    return inputTable.releaseBlockOfRows(dataBlock);
+}
+
+template <typename algorithmFPType>
+Status NormalizationKernelOneAPI<algorithmFPType>::writeRow(const UniversalBuffer & values, uint32_t nFeatures, NumericTable & table)
+{
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    BlockDescriptor<algorithmFPType> block;
+    DAAL_CHECK_STATUS(status, table.getBlockOfRows(0, 1, ReadWriteMode::writeOnly, block));
+
+    ctx.copy(block.getBuffer(), 0, values, 0, nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    return table.releaseBlockOfRows(block);
+}
+
+} // namespace internal
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
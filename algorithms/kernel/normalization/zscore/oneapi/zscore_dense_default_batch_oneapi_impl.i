@@ -0,0 +1,186 @@
+/* file: zscore_dense_default_batch_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of z-score normalization on GPU. The means and variances are computed by the GPU kernels of the low order moments
+//  algorithm, the data is centered and scaled by one fused pass that may overwrite the input table.
+//--
+*/
+
+#ifndef __ZSCORE_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+#define __ZSCORE_DENSE_DEFAULT_BATCH_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/normalization/oneapi/normalization_kernel_oneapi_impl.i"
+#include "externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(normalization.zscore.dense.default.batch.oneapi);
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services;
+
+template <typename algorithmFPType>
+Status ZScoreKernelOneAPI<algorithmFPType>::computeMeansAndVariances(const Parameter<algorithmFPType, defaultDense> & parameter,
+                                                                      const NumericTablePtr & resultMeans, const NumericTablePtr & resultVariances,
+                                                                      NumericTablePtr & means, NumericTablePtr & variances)
+{
+    low_order_moments::BatchImpl * moments = parameter.moments.get();
+    moments->parameter.estimatesToCompute  = low_order_moments::estimatesMeanVariance;
+
+    Status status;
+    low_order_moments::ResultPtr momentsResult(new low_order_moments::Result());
+    DAAL_CHECK_STATUS(status,
+                      momentsResult->allocate<algorithmFPType>(&(moments->input), &(moments->parameter), (int)low_order_moments::defaultDense));
+
+    /* The requested results are written by the moments algorithm directly */
+    if (resultMeans) momentsResult->set(low_order_moments::mean, resultMeans);
+    if (resultVariances) momentsResult->set(low_order_moments::variance, resultVariances);
+    DAAL_CHECK_STATUS(status, moments->setResult(momentsResult));
+
+    DAAL_CHECK(moments->computeNoThrow(), ErrorMeanAndStandardDeviationComputing);
+
+    means     = momentsResult->get(low_order_moments::mean);
+    variances = momentsResult->get(low_order_moments::variance);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status ZScoreKernelOneAPI<algorithmFPType>::computeMeansAndVariancesFromMoments(const low_order_moments::PartialResult & partialMoments,
+                                                                                 uint32_t nFeatures, UniversalBuffer & means,
+                                                                                 UniversalBuffer & variances)
+{
+    Status status;
+
+    NumericTablePtr nObservationsTable = partialMoments.get(low_order_moments::nObservations);
+    BlockDescriptor<algorithmFPType> nObservationsBlock;
+    DAAL_CHECK_STATUS(status, nObservationsTable->getBlockOfRows(0, 1, ReadWriteMode::readOnly, nObservationsBlock));
+    const algorithmFPType nObservations = nObservationsBlock.getBlockPtr()[0];
+    DAAL_CHECK_STATUS(status, nObservationsTable->releaseBlockOfRows(nObservationsBlock));
+
+    NumericTablePtr sumTable      = partialMoments.get(low_order_moments::partialSum);
+    NumericTablePtr sumSqCenTable = partialMoments.get(low_order_moments::partialSumSquaresCentered);
+    BlockDescriptor<algorithmFPType> sumBlock;
+    DAAL_CHECK_STATUS(status, sumTable->getBlockOfRows(0, 1, ReadWriteMode::readOnly, sumBlock));
+    BlockDescriptor<algorithmFPType> sumSqCenBlock;
+    DAAL_CHECK_STATUS(status, sumSqCenTable->getBlockOfRows(0, 1, ReadWriteMode::readOnly, sumSqCenBlock));
+
+    DAAL_CHECK_STATUS(status, NormalizationKernel::computeMeanVariance(sumBlock.getBuffer(), sumSqCenBlock.getBuffer(), nObservations, nFeatures,
+                                                                        means, variances));
+
+    DAAL_CHECK_STATUS(status, sumSqCenTable->releaseBlockOfRows(sumSqCenBlock));
+    return sumTable->releaseBlockOfRows(sumBlock);
+}
+
+template <typename algorithmFPType>
+Status ZScoreKernelOneAPI<algorithmFPType>::compute(const NumericTablePtr & inputTable, NumericTable & resultTable,
+                                                     const NumericTablePtr & resultMeans, const NumericTablePtr & resultVariances,
+                                                     const Parameter<algorithmFPType, defaultDense> & parameter,
+                                                     const low_order_moments::PartialResult * partialMoments)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    const size_t nFeatures = inputTable->getNumberOfColumns();
+    DAAL_CHECK(nFeatures <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+
+    Status status;
+
+    /* Check if input data are already normalized */
+    if (inputTable->isNormalized(NumericTableIface::standardScoreNormalized))
+    {
+        if (inputTable.get() != &resultTable)
+        {
+            DAAL_CHECK_STATUS(status, NormalizationKernel::copy(*inputTable, resultTable));
+            resultTable.setNormalizationFlag(NumericTableIface::standardScoreNormalized);
+        }
+        return status;
+    }
+
+    const bool computeMeans     = parameter.resultsToCompute & mean;
+    const bool computeVariances = parameter.resultsToCompute & variance;
+
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    const TypeId idType         = TypeIds::id<algorithmFPType>();
+
+    UniversalBuffer means;
+    UniversalBuffer variances;
+    NumericTablePtr meansTable;
+    NumericTablePtr variancesTable;
+    BlockDescriptor<algorithmFPType> meansBlock;
+    BlockDescriptor<algorithmFPType> variancesBlock;
+
+    if (partialMoments)
+    {
+        means = ctx.allocate(idType, nFeatures, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        variances = ctx.allocate(idType, nFeatures, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        DAAL_CHECK_STATUS(status, computeMeansAndVariancesFromMoments(*partialMoments, uint32_t(nFeatures), means, variances));
+
+        if (computeMeans)
+        {
+            DAAL_CHECK_STATUS(status, NormalizationKernel::writeRow(means, uint32_t(nFeatures), *resultMeans));
+        }
+        if (computeVariances)
+        {
+            DAAL_CHECK_STATUS(status, NormalizationKernel::writeRow(variances, uint32_t(nFeatures), *resultVariances));
+        }
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(status, computeMeansAndVariances(parameter, computeMeans ? resultMeans : NumericTablePtr(),
+                                                           computeVariances ? resultVariances : NumericTablePtr(), meansTable, variancesTable));
+
+        DAAL_CHECK_STATUS(status, meansTable->getBlockOfRows(0, 1, ReadWriteMode::readOnly, meansBlock));
+        DAAL_CHECK_STATUS(status, variancesTable->getBlockOfRows(0, 1, ReadWriteMode::readOnly, variancesBlock));
+        means     = meansBlock.getBuffer();
+        variances = variancesBlock.getBuffer();
+    }
+
+    UniversalBuffer scale = ctx.allocate(idType, nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_STATUS(status, NormalizationKernel::computeZScoreScale(variances, parameter.doScale, uint32_t(nFeatures), scale));
+
+    DAAL_CHECK_STATUS(status, NormalizationKernel::scaleAndShift(*inputTable, resultTable, means, scale, algorithmFPType(0)));
+
+    if (meansTable)
+    {
+        DAAL_CHECK_STATUS(status, variancesTable->releaseBlockOfRows(variancesBlock));
+        DAAL_CHECK_STATUS(status, meansTable->releaseBlockOfRows(meansBlock));
+    }
+
+    resultTable.setNormalizationFlag(NumericTableIface::standardScoreNormalized);
+    return status;
+}
+
+} // namespace internal
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,79 @@
+/* file: zscore_dense_default_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class that computes z-score normalization on GPU.
+//--
+*/
+
+#ifndef __ZSCORE_DENSE_DEFAULT_KERNEL_ONEAPI_H__
+#define __ZSCORE_DENSE_DEFAULT_KERNEL_ONEAPI_H__
+
+#include "algorithms/normalization/zscore_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/kernel/normalization/oneapi/normalization_kernel_oneapi.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace zscore
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType>
+class ZScoreKernelOneAPI : public Kernel
+{
+public:
+    /**
+     *  \brief Function that computes z-score normalization on GPU
+     *
+     *  \param inputTable[in]        Input data of the algorithm
+     *  \param resultTable[out]      Table that stores normalized data results, may be the input table
+     *  \param resultMeans[out]      Table that stores means results
+     *  \param resultVariances[out]  Table that stores variances results
+     *  \param parameter[in]         Parameters of the algorithm
+     *  \param partialMoments[in]    Optional partial results of the low order moments algorithm
+     */
+    services::Status compute(const NumericTablePtr & inputTable, NumericTable & resultTable, const NumericTablePtr & resultMeans,
+                             const NumericTablePtr & resultVariances, const Parameter<algorithmFPType, defaultDense> & parameter,
+                             const low_order_moments::PartialResult * partialMoments = nullptr);
+
+private:
+    typedef normalization::internal::NormalizationKernelOneAPI<algorithmFPType> NormalizationKernel;
+
+    /* Computes the means and variances with the low order moments algorithm, its GPU kernels write them into the tables */
+    services::Status computeMeansAndVariances(const Parameter<algorithmFPType, defaultDense> & parameter, const NumericTablePtr & resultMeans,
+                                              const NumericTablePtr & resultVariances, NumericTablePtr & means, NumericTablePtr & variances);
+
+    services::Status computeMeansAndVariancesFromMoments(const low_order_moments::PartialResult & partialMoments, uint32_t nFeatures,
+                                                         oneapi::internal::UniversalBuffer & means, oneapi::internal::UniversalBuffer & variances);
+};
+
+} // namespace internal
+} // namespace zscore
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
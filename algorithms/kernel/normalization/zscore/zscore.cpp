@@ -41,7 +41,7 @@ namespace zscore
 namespace interface1
 {
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input() : daal::algorithms::Input(lastOptionalInputId + 1) {}
 Input::Input(const Input & other) : daal::algorithms::Input(other) {}
 
 /**
@@ -64,6 +64,26 @@ void Input::set(InputId id, const NumericTablePtr & ptr)
     Argument::set(id, ptr);
 }
 
+/**
+ * Returns an optional input object for the z-score normalization algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+low_order_moments::PartialResultPtr Input::get(OptionalInputId id) const
+{
+    return staticPointerCast<low_order_moments::PartialResult, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the optional input object of the z-score normalization algorithm
+ * \param[in] id    Identifier of the optional %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(OptionalInputId id, const low_order_moments::PartialResultPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
 /**
  * Check the correctness of the %Input object
  * \param[in] par       Algorithm parameter
@@ -79,6 +99,16 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
         DAAL_CHECK_STATUS(
             s, checkNumericTable(get(data)->basicStatistics.get(NumericTableIface::sum).get(), basicStatisticsSumStr(), 0, 0, nFeatures, 1));
     }
+
+    low_order_moments::PartialResultPtr moments = get(partialMoments);
+    if (moments)
+    {
+        const size_t nFeatures = get(data)->getNumberOfColumns();
+        DAAL_CHECK_STATUS(s, checkNumericTable(moments->get(low_order_moments::nObservations).get(), nObservationsStr(), 0, 0, 1, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(moments->get(low_order_moments::partialSum).get(), partialSumStr(), 0, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(moments->get(low_order_moments::partialSumSquaresCentered).get(), partialSumSquaresCenteredStr(), 0,
+                                               0, nFeatures, 1));
+    }
     return s;
 }
 
@@ -136,7 +166,7 @@ Status Result::check(const daal::algorithms::Input * in, const daal::algorithms:
 
 namespace interface3
 {
-BaseParameter::BaseParameter(const bool doScale) : resultsToCompute(none), doScale(doScale) {}
+BaseParameter::BaseParameter(const bool doScale) : resultsToCompute(none), doScale(doScale), inPlace(false) {}
 
 } // namespace interface3
 
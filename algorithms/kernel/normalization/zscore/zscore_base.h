@@ -71,13 +71,18 @@ public:
      *  \param resultMeans[out]  Table that stores means results
      *  \param resultVariances[out]  Table that stores variances results
      *  \param parameter[in]     Parameters of the algorithm
+     *  \param partialMoments[in] Optional partial results of the low order moments algorithm,
+     *                            if set the means and variances are obtained from them instead of the extra pass over the data
      */
     Status compute(NumericTable & inputTable, NumericTable & resultTable, NumericTable & resultMeans, NumericTable & resultVariances,
-                   const daal::algorithms::Parameter & parameter);
+                   const daal::algorithms::Parameter & parameter, const low_order_moments::PartialResult * partialMoments = nullptr);
 
 protected:
     Status common_compute(NumericTable & inputTable, NumericTable & resultTable, algorithmFPType * means_total, algorithmFPType * variances_total,
-                          const daal::algorithms::Parameter & parameter);
+                          const daal::algorithms::Parameter & parameter, const low_order_moments::PartialResult * partialMoments = nullptr);
+
+    Status computeMeanVarianceFromMoments(const low_order_moments::PartialResult & partialMoments, const size_t nFeatures,
+                                           algorithmFPType * resultMean, algorithmFPType * resultVariance);
 
     virtual Status computeMeanVariance_thr(NumericTable & inputTable, algorithmFPType * resultMean, algorithmFPType * resultVariance,
                                            const daal::algorithms::Parameter & parameter) = 0;
@@ -25,6 +25,8 @@
 #include "algorithms/kernel/normalization/zscore/zscore_base.h"
 #include "algorithms/kernel/normalization/zscore/zscore_dense_default_kernel.h"
 #include "algorithms/kernel/normalization/zscore/zscore_dense_sum_kernel.h"
+#include "algorithms/kernel/normalization/zscore/oneapi/zscore_dense_default_kernel_oneapi.h"
+#include "oneapi/internal/execution_context.h"
 
 namespace daal
 {
@@ -39,7 +41,17 @@ namespace interface3
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv) : AnalysisContainerIface<batch>(daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::ZScoreKernel, algorithmFPType, method);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu || method != defaultDense)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::ZScoreKernel, algorithmFPType, method);
+    }
+    else
+    {
+        _kernel = new internal::ZScoreKernelOneAPI<algorithmFPType>();
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -51,6 +63,9 @@ BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 {
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     Input * input                          = static_cast<Input *>(_in);
     Result * result                        = static_cast<Result *>(_res);
     daal::algorithms::Parameter * par      = _par;
@@ -65,10 +80,16 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     {
         Parameter<algorithmFPType, defaultDense> * parameter = static_cast<Parameter<algorithmFPType, defaultDense> *>(par);
         parameter->moments->input.set(low_order_moments::data, inputTable);
+
+        if (!deviceInfo.isCpu)
+        {
+            return ((internal::ZScoreKernelOneAPI<algorithmFPType> *)(_kernel))
+                ->compute(inputTable, *resultTable, resultMeans, resultVariances, *parameter, input->get(partialMoments).get());
+        }
     }
 
     __DAAL_CALL_KERNEL(env, internal::ZScoreKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *inputTable, *resultTable,
-                       *resultMeans, *resultVariances, *par);
+                       *resultMeans, *resultVariances, *par, input->get(partialMoments).get());
 }
 
 } // namespace interface3
@@ -36,7 +36,8 @@ namespace internal
 {
 template <typename algorithmFPType, CpuType cpu>
 Status ZScoreKernelBase<algorithmFPType, cpu>::common_compute(NumericTable & inputTable, NumericTable & resultTable, algorithmFPType * mean_total,
-                                                              algorithmFPType * variances_total, const daal::algorithms::Parameter & parameter)
+                                                              algorithmFPType * variances_total, const daal::algorithms::Parameter & parameter,
+                                                              const low_order_moments::PartialResult * partialMoments)
 {
 #define _BLOCK_SIZE_NORM_ 256
 
@@ -92,9 +93,16 @@ Status ZScoreKernelBase<algorithmFPType, cpu>::common_compute(NumericTable & inp
 
     SafeStatus safeStat;
 
-    /* Call method-specific function to compute means and variances */
+    /* Call method-specific function to compute means and variances unless they are obtained from the precomputed moments */
     Status s;
-    DAAL_CHECK_STATUS(s, computeMeanVariance_thr(inputTable, mean_total, variances_total, parameter));
+    if (partialMoments)
+    {
+        DAAL_CHECK_STATUS(s, computeMeanVarianceFromMoments(*partialMoments, _nFeatures, mean_total, variances_total));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, computeMeanVariance_thr(inputTable, mean_total, variances_total, parameter));
+    }
 
     if (doScale)
     {
@@ -160,6 +168,36 @@ Status ZScoreKernelBase<algorithmFPType, cpu>::common_compute(NumericTable & inp
     return safeStat.detach();
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status ZScoreKernelBase<algorithmFPType, cpu>::computeMeanVarianceFromMoments(const low_order_moments::PartialResult & partialMoments,
+                                                                              const size_t nFeatures, algorithmFPType * resultMean,
+                                                                              algorithmFPType * resultVariance)
+{
+    ReadRows<algorithmFPType, cpu> nObservationsBD(partialMoments.get(low_order_moments::nObservations).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nObservationsBD);
+    ReadRows<algorithmFPType, cpu> sumBD(partialMoments.get(low_order_moments::partialSum).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumBD);
+    ReadRows<algorithmFPType, cpu> sumSqCenBD(partialMoments.get(low_order_moments::partialSumSquaresCentered).get(), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(sumSqCenBD);
+
+    const algorithmFPType nObservations = nObservationsBD.get()[0];
+    DAAL_CHECK(nObservations > algorithmFPType(1.0), ErrorIncorrectNumberOfObservations);
+
+    const algorithmFPType invN       = algorithmFPType(1.0) / nObservations;
+    const algorithmFPType invNm1     = algorithmFPType(1.0) / (nObservations - algorithmFPType(1.0));
+    const algorithmFPType * sum      = sumBD.get();
+    const algorithmFPType * sumSqCen = sumSqCenBD.get();
+
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        resultMean[j]     = sum[j] * invN;
+        resultVariance[j] = sumSqCen[j] * invNm1;
+    }
+    return Status();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status ZScoreKernelBase<algorithmFPType, cpu>::compute(NumericTable & inputTable, NumericTable & resultTable,
                                                        const daal::algorithms::Parameter & parameter)
@@ -182,7 +220,8 @@ Status ZScoreKernelBase<algorithmFPType, cpu>::compute(NumericTable & inputTable
 
 template <typename algorithmFPType, CpuType cpu>
 Status ZScoreKernelBase<algorithmFPType, cpu>::compute(NumericTable & inputTable, NumericTable & resultTable, NumericTable & resultMeans,
-                                                       NumericTable & resultVariances, const daal::algorithms::Parameter & parameter)
+                                                       NumericTable & resultVariances, const daal::algorithms::Parameter & parameter,
+                                                       const low_order_moments::PartialResult * partialMoments)
 {
     const size_t _nFeatures = inputTable.getNumberOfColumns();
     const daal::algorithms::normalization::zscore::interface3::BaseParameter * par =
@@ -211,7 +250,7 @@ Status ZScoreKernelBase<algorithmFPType, cpu>::compute(NumericTable & inputTable
 
     DAAL_CHECK(variances_total, ErrorMemoryAllocationFailed);
 
-    return common_compute(inputTable, resultTable, mean_total, variances_total, parameter);
+    return common_compute(inputTable, resultTable, mean_total, variances_total, parameter, partialMoments);
 };
 
 } // namespace internal
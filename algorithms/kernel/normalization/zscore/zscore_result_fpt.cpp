@@ -22,6 +22,8 @@
 */
 
 #include "algorithms/kernel/normalization/zscore/zscore_result.h"
+#include "oneapi/internal/execution_context.h"
+#include "data_management/data/numeric_table_sycl_homogen.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -44,17 +46,37 @@ namespace interface2
 template <typename algorithmFPType>
 Status ResultImpl::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter)
 {
-    Status status = interface1::ResultImpl::allocate<algorithmFPType>(input);
-    DAAL_CHECK_STATUS_VAR(status);
-
     const Input * in = static_cast<const Input *>(input);
     DAAL_CHECK(in, ErrorNullInput);
 
     NumericTablePtr dataTable = in->get(zscore::data);
     DAAL_CHECK(dataTable, ErrorNullInputNumericTable);
 
+    /* Parameters of the previous interfaces do not provide the in-place mode */
+    const interface3::BaseParameter * inPlacePar = dynamic_cast<const interface3::BaseParameter *>(parameter);
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
     const size_t nFeatures = dataTable->getNumberOfColumns();
 
+    Status status;
+    if (inPlacePar && inPlacePar->inPlace)
+    {
+        (*this)[normalizedData] = dataTable;
+    }
+    else if (!deviceInfo.isCpu)
+    {
+        (*this)[normalizedData] =
+            SyclHomogenNumericTable<algorithmFPType>::create(nFeatures, dataTable->getNumberOfRows(), NumericTableIface::doAllocate, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+    else
+    {
+        status |= interface1::ResultImpl::allocate<algorithmFPType>(input);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
     if (parameter != NULL)
     {
         const BaseParameter * algParameter = static_cast<const BaseParameter *>(parameter);
@@ -62,13 +84,30 @@ Status ResultImpl::allocate(const daal::algorithms::Input * input, const daal::a
 
         if (algParameter->resultsToCompute & mean)
         {
-            (*this)[means] = HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            if (deviceInfo.isCpu)
+            {
+                (*this)[means] =
+                    HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            }
+            else
+            {
+                (*this)[means] =
+                    SyclHomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            }
             DAAL_CHECK_STATUS_VAR(status);
         }
         if (algParameter->resultsToCompute & variance)
         {
-            (*this)[variances] =
-                HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            if (deviceInfo.isCpu)
+            {
+                (*this)[variances] =
+                    HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            }
+            else
+            {
+                (*this)[variances] =
+                    SyclHomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTableIface::doAllocate, algorithmFPType(0.), &status);
+            }
             DAAL_CHECK_STATUS_VAR(status);
         }
     }
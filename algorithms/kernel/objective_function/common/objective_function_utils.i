@@ -54,6 +54,122 @@ services::Status getXY(NumericTable * dataNT, NumericTable * dependentVariablesN
     return services::Status();
 }
 
+/**
+ * Rows of the data set in the CSR format with one-based indices
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct CSRData
+{
+    const algorithmFPType * values;
+    const size_t * cols;
+    const size_t * rowOffsets;
+    TArrayScalable<algorithmFPType, cpu> valuesArray; /* Copies of the rows selected by the batch indices */
+    TArrayScalable<size_t, cpu> colsArray;
+    TArrayScalable<size_t, cpu> rowOffsetsArray;
+};
+
+/**
+ * Copies the rows of the CSR data set selected by the batch indices and the corresponding dependent variables
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status getCSRXY(CSRNumericTableIface * csr, NumericTable * dependentVariablesNT, const NumericTable * indNT,
+                          CSRData<algorithmFPType, cpu> & x, algorithmFPType * aY, size_t nRows, size_t n)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(getXY);
+
+    ReadRows<int, cpu> rInd(*const_cast<NumericTable *>(indNT), 0, n);
+    DAAL_CHECK_BLOCK_STATUS(rInd);
+    const int * ind = rInd.get();
+    ReadRows<algorithmFPType, cpu> yr(*dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+
+    x.rowOffsetsArray.reset(n + 1);
+    size_t * rowOffsets = x.rowOffsetsArray.get();
+    DAAL_CHECK_MALLOC(rowOffsets);
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(csr);
+    rowOffsets[0] = 1;
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.next(ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        rowOffsets[i + 1] = rowOffsets[i] + xr.rows()[1] - xr.rows()[0];
+        aY[i]             = yr.get()[ind[i]];
+    }
+
+    const size_t nNonZeros = rowOffsets[n] - 1;
+    x.valuesArray.reset(nNonZeros ? nNonZeros : 1);
+    x.colsArray.reset(nNonZeros ? nNonZeros : 1);
+    DAAL_CHECK_MALLOC(x.valuesArray.get() && x.colsArray.get());
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        xr.next(ind[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(xr);
+        const size_t nInRow = rowOffsets[i + 1] - rowOffsets[i];
+        services::internal::tmemcpy<algorithmFPType, cpu>(x.valuesArray.get() + rowOffsets[i] - 1, xr.values(), nInRow);
+        services::internal::tmemcpy<size_t, cpu>(x.colsArray.get() + rowOffsets[i] - 1, xr.cols(), nInRow);
+    }
+
+    x.values     = x.valuesArray.get();
+    x.cols       = x.colsArray.get();
+    x.rowOffsets = rowOffsets;
+    return services::Status();
+}
+
+/**
+ * Returns the maximal squared norm of the rows of the CSR data set
+ */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType getCSRMaxSquaredRowNorm(const CSRData<algorithmFPType, cpu> & x, size_t n)
+{
+    const size_t blockSize = 256;
+    size_t nBlocks         = n / blockSize;
+    nBlocks += (nBlocks * blockSize != n);
+    algorithmFPType globalMaxNorm = 0;
+
+    TlsMem<algorithmFPType, cpu, services::internal::ScalableCalloc<algorithmFPType, cpu> > tlsData(1);
+    daal::threader_for(nBlocks, nBlocks, [&](const size_t iBlock) {
+        algorithmFPType & _maxNorm = *tlsData.local();
+        const size_t startRow      = iBlock * blockSize;
+        const size_t finishRow     = (iBlock + 1 == nBlocks ? n : (iBlock + 1) * blockSize);
+        for (size_t i = startRow; i < finishRow; i++)
+        {
+            algorithmFPType curentNorm = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = x.rowOffsets[i] - 1; j < x.rowOffsets[i + 1] - 1; j++)
+            {
+                curentNorm += x.values[j] * x.values[j];
+            }
+            if (curentNorm > _maxNorm)
+            {
+                _maxNorm = curentNorm;
+            }
+        }
+    });
+    tlsData.reduce([&](algorithmFPType * maxNorm) {
+        if (globalMaxNorm < *maxNorm)
+        {
+            globalMaxNorm = *maxNorm;
+        }
+    });
+    return globalMaxNorm;
+}
+
+/**
+ * Fills the descriptor of the general matrix in the CSR format with one-based indices for the sparse BLAS routines
+ */
+inline void setCSRMatrixDescriptor(char * matdescra)
+{
+    matdescra[0] = 'G'; // general matrix
+    matdescra[1] = (char)0;
+    matdescra[2] = (char)0;
+    matdescra[3] = 'F'; // 1-based indexing
+    matdescra[4] = (char)0;
+    matdescra[5] = (char)0;
+}
+
 } // namespace internal
 
 } // namespace objective_function
@@ -24,6 +24,7 @@
 #include "service/kernel/service_utils.h"
 #include "service/kernel/service_environment.h"
 #include "externals/service_ittnotify.h"
+#include "externals/service_spblas.h"
 
 DAAL_ITTNOTIFY_DOMAIN(cross_entropy_loss.dense.default.batch);
 
@@ -178,6 +179,162 @@ void addHessInPt(algorithmFPType * h, const algorithmFPType * xi, const algorith
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass, NumericTable * proximalProjection,
+                                                  const Parameter * parameter)
+{
+    WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nClasses * nBetaPerClass);
+    DAAL_CHECK_BLOCK_STATUS(proxPtr);
+    algorithmFPType * prox = proxPtr.get();
+
+    for (size_t i = 0; i < nClasses; i++) prox[i * nBetaPerClass] = b[i * nBetaPerClass];
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        for (size_t j = 1; j < nBetaPerClass; j++)
+        {
+            if (b[i * nBetaPerClass + j] > parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
+            }
+            if (b[i * nBetaPerClass + j] < -parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
+            }
+            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
+            {
+                prox[i * nBetaPerClass + j] = 0;
+            }
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass, NumericTable * nonSmoothTermValue,
+                                             const Parameter * parameter, algorithmFPType & notSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & value = *vr.get();
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        for (size_t j = 1; j < nBetaPerClass; j++)
+            notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+    }
+    value = notSmoothTerm;
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status setLipschitzConstant(algorithmFPType maxNorm, size_t n, NumericTable * lipschitzConstant, const Parameter * parameter)
+{
+    DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+    WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+    algorithmFPType & c = *lipschitzConstantPtr.get();
+
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+    algorithmFPType lipschitz    = 0.25 * (maxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+    c                            = 2 * lipschitz + displacement;
+    return services::Status();
+}
+
+/* Computes the value of the function from the probabilities of the classes */
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeValue(const algorithmFPType * prob, const algorithmFPType * y, size_t n, const algorithmFPType * b, size_t nClasses,
+                                     size_t nBetaPerClass, const algorithmFPType * notSmoothTerm, NumericTable * valueNT, const Parameter * parameter)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    TArrayScratch<algorithmFPType, cpu> logP(n * nClasses);
+    DAAL_CHECK_MALLOC(logP.get());
+    daal::internal::Math<algorithmFPType, cpu>::vLog(n * nClasses, prob, logP.get());
+
+    WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & value    = *vr.get();
+    value                      = 0.0;
+    const algorithmFPType * lp = logP.get();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (size_t j = 0; j < nClasses; ++j) value += (size_t(y[i]) == j) * lp[i * nClasses + j];
+    }
+
+    value *= -div;
+
+    if (parameter->penaltyL2 > 0)
+    {
+        for (size_t i = 0; i < nClasses; i++)
+        {
+            for (size_t j = 1; j < nBetaPerClass; j++) value += b[i * nBetaPerClass + j] * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+        }
+    }
+
+    if (parameter->penaltyL1 > 0)
+    {
+        if (notSmoothTerm)
+        {
+            value += *notSmoothTerm;
+        }
+        else
+        {
+            for (size_t i = 0; i < nClasses; i++)
+            {
+                for (size_t j = 1; j < nBetaPerClass; j++)
+                    value += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
+            }
+        }
+    }
+    return services::Status();
+}
+
+/* Averages the gradient accumulated over the observations and adds the L2 penalty */
+template <typename algorithmFPType, CpuType cpu>
+static void finalizeGradient(algorithmFPType * g, size_t n, const algorithmFPType * b, size_t nClasses, size_t nBetaPerClass,
+                             const Parameter * parameter)
+{
+    const size_t nBeta        = nClasses * nBetaPerClass;
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+    for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
+
+    if (parameter->penaltyL2 > 0)
+    {
+        for (size_t i = 0; i < nClasses; i++)
+        {
+            for (size_t j = 1; j < nBetaPerClass; j++) g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
+        }
+    }
+}
+
+/* Averages the upper triangle of the Hessian accumulated over the observations, makes it symmetric and adds the L2 penalty */
+template <typename algorithmFPType, CpuType cpu>
+static void finalizeHessian(algorithmFPType * h, size_t n, size_t nBeta, size_t nBetaPerClass, const Parameter * parameter)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    //hessian is a symmetrical matrix
+    for (size_t i = 0; i < nBeta; ++i)
+    {
+        h[i * nBeta + i] *= div;
+        for (size_t j = i + 1; j < nBeta; ++j)
+        {
+            h[i * nBeta + j] *= div;
+            h[j * nBeta + i] = h[i * nBeta + j];
+        }
+    }
+
+    if (parameter->penaltyL2 > 0)
+    {
+        for (size_t i = 0; i < nBeta; i++)
+        {
+            const algorithmFPType regularValue = 2 * parameter->penaltyL2;
+            h[i * nBeta + i] += (i % nBetaPerClass) ? regularValue : 0;
+        }
+    }
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t nRows,
                                                                                  size_t n, size_t p, NumericTable * betaNT, NumericTable * valueNT,
@@ -190,7 +347,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
 
-    TArrayScalable<algorithmFPType, cpu> f(n * nClasses);
+    TArrayScratch<algorithmFPType, cpu> f(n * nClasses);
     const size_t nBetaPerClass = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses * nBetaPerClass);
@@ -199,53 +356,20 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
     DAAL_CHECK_BLOCK_STATUS(betar);
     const algorithmFPType * b = betar.get();
 
+    services::Status st;
     if (proximalProjection)
     {
-        WriteRows<algorithmFPType, cpu> proxPtr(proximalProjection, 0, nBeta);
-        DAAL_CHECK_BLOCK_STATUS(proxPtr);
-        algorithmFPType * prox = proxPtr.get();
-
-        for (size_t i = 0; i < nClasses; i++) prox[i * nBetaPerClass] = b[i * nBetaPerClass];
-        for (size_t i = 0; i < nClasses; i++)
-        {
-            for (size_t j = 1; j < nBetaPerClass; j++)
-            {
-                if (b[i * nBetaPerClass + j] > parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] - parameter->penaltyL1;
-                }
-                if (b[i * nBetaPerClass + j] < -parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = b[i * nBetaPerClass + j] + parameter->penaltyL1;
-                }
-                if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i * nBetaPerClass + j]) <= parameter->penaltyL1)
-                {
-                    prox[i * nBetaPerClass + j] = 0;
-                }
-            }
-        }
+        DAAL_CHECK_STATUS(st, (computeProximalProjection<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, proximalProjection, parameter)));
     }
 
     algorithmFPType notSmoothTerm = 0;
     if (nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType & value = *vr.get();
-        for (size_t i = 0; i < nClasses; i++)
-        {
-            for (size_t j = 1; j < nBetaPerClass; j++)
-                notSmoothTerm += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
-        }
-        value = notSmoothTerm;
+        DAAL_CHECK_STATUS(st, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm)));
     }
 
     if (lipschitzConstant)
     {
-        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
-        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
-        algorithmFPType & c = *lipschitzConstantPtr.get();
-
         const size_t blockSize = 256;
         size_t nBlocks         = n / blockSize;
         nBlocks += (nBlocks * blockSize != n);
@@ -280,10 +404,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
-        algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
-        c                            = 2 * lipschitz + displacement;
+        DAAL_CHECK_STATUS(st, (setLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
     }
 
     if (valueNT || gradientNT || hessianNT)
@@ -294,51 +415,10 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
         //f = softmax(f)
         softmaxThreaded(f.get(), f.get(), n, nClasses);
 
-        const bool bL1 = (parameter->penaltyL1 > 0);
-        const bool bL2 = (parameter->penaltyL2 > 0);
-
-        const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
         if (valueNT)
         {
-            TArrayScalable<algorithmFPType, cpu> logP(f.size());
-            daal::internal::Math<algorithmFPType, cpu>::vLog(n * nClasses, f.get(), logP.get());
-
-            WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
-            DAAL_CHECK_BLOCK_STATUS(vr);
-            algorithmFPType & value    = *vr.get();
-            value                      = 0.0;
-            const algorithmFPType * lp = logP.get();
-
-            for (size_t i = 0; i < n; ++i)
-            {
-                for (size_t j = 0; j < nClasses; ++j) value += (size_t(y[i]) == j) * lp[i * nClasses + j];
-            }
-
-            value *= -div;
-
-            if (bL2)
-            {
-                for (size_t i = 0; i < nClasses; i++)
-                {
-                    for (size_t j = 1; j < nBetaPerClass; j++) value += b[i * nBetaPerClass + j] * b[i * nBetaPerClass + j] * parameter->penaltyL2;
-                }
-            }
-
-            if (bL1)
-            {
-                if (nonSmoothTermValue)
-                {
-                    value += notSmoothTerm;
-                }
-                else
-                {
-                    for (size_t i = 0; i < nClasses; i++)
-                    {
-                        for (size_t j = 1; j < nBetaPerClass; j++)
-                            value += (b[i * nBetaPerClass + j] < 0 ? -b[i * nBetaPerClass + j] : b[i * nBetaPerClass + j]) * parameter->penaltyL1;
-                    }
-                }
-            }
+            DAAL_CHECK_STATUS(st, (computeValue<algorithmFPType, cpu>(f.get(), y, n, b, nClasses, nBetaPerClass,
+                                                                      nonSmoothTermValue ? &notSmoothTerm : nullptr, valueNT, parameter)));
         }
 
         if (gradientNT)
@@ -367,15 +447,7 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
                     addGradInPt<algorithmFPType, cpu>(g, x + i * p, pp + i * nClasses, size_t(y[i]), interceptFactor, nClasses, nBetaPerClass);
             }
 
-            for (size_t i = 0; i < nBeta; ++i) g[i] *= div;
-
-            if (bL2)
-            {
-                for (size_t i = 0; i < nClasses; i++)
-                {
-                    for (size_t j = 1; j < nBetaPerClass; j++) g[i * nBetaPerClass + j] += 2 * b[i * nBetaPerClass + j] * parameter->penaltyL2;
-                }
-            }
+            finalizeGradient<algorithmFPType, cpu>(g, n, b, nClasses, nBetaPerClass, parameter);
         }
         if (hessianNT)
         {
@@ -394,28 +466,202 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doCompute
             });
             tlsData.reduceTo(h, hSize);
 
-            //hessian is a symmetrical matrix
-            for (size_t i = 0; i < nBeta; ++i)
-            {
-                h[i * nBeta + i] *= div;
-                for (size_t j = i + 1; j < nBeta; ++j)
-                {
-                    h[i * nBeta + j] *= div;
-                    h[j * nBeta + i] = h[i * nBeta + j];
-                }
-            }
+            finalizeHessian<algorithmFPType, cpu>(h, n, nBeta, nBetaPerClass, parameter);
+        }
+    }
+    return st;
+}
+
+/*
+    Computations on the data set in the CSR format:
+    F = X * B and the gradient X^T * (P - Y) are computed with the sparse BLAS matrix-matrix products.
+    Notice: the dense matrices of the sparse BLAS products with one-based indices are stored in the column-major layout,
+    the coefficients of the k-th class are the k-th column of the column-major matrix beta + 1 with the leading dimension p + 1.
+    The Hessian is accumulated over the rows expanded into the dense buffers.
+*/
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::doComputeCSR(const algorithmFPType * values, const size_t * cols,
+                                                                                    const size_t * rowOffsets, const algorithmFPType * y, size_t n,
+                                                                                    size_t p, NumericTable * betaNT, NumericTable * valueNT,
+                                                                                    NumericTable * hessianNT, NumericTable * gradientNT,
+                                                                                    NumericTable * nonSmoothTermValue,
+                                                                                    NumericTable * proximalProjection,
+                                                                                    NumericTable * lipschitzConstant, Parameter * parameter)
+{
+    const size_t nClasses = parameter->nClasses;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nClasses);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nClasses, sizeof(algorithmFPType));
+
+    const size_t nBetaPerClass = p + 1;
+    DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
+    DAAL_ASSERT(betaNT->getNumberOfRows() == nClasses * nBetaPerClass);
+    const size_t nBeta = betaNT->getNumberOfColumns() * betaNT->getNumberOfRows();
+    ReadRows<algorithmFPType, cpu> betar(betaNT, 0, nBeta);
+    DAAL_CHECK_BLOCK_STATUS(betar);
+    const algorithmFPType * b = betar.get();
+
+    services::Status st;
+    if (proximalProjection)
+    {
+        DAAL_CHECK_STATUS(st, (computeProximalProjection<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, proximalProjection, parameter)));
+    }
+
+    algorithmFPType notSmoothTerm = 0;
+    if (nonSmoothTermValue)
+    {
+        DAAL_CHECK_STATUS(st, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nClasses, nBetaPerClass, nonSmoothTermValue, parameter, notSmoothTerm)));
+    }
+
+    objective_function::internal::CSRData<algorithmFPType, cpu> x;
+    x.values     = values;
+    x.cols       = cols;
+    x.rowOffsets = rowOffsets;
+
+    if (lipschitzConstant)
+    {
+        const algorithmFPType maxNorm = objective_function::internal::getCSRMaxSquaredRowNorm<algorithmFPType, cpu>(x, n);
+        DAAL_CHECK_STATUS(st, (setLipschitzConstant<algorithmFPType, cpu>(maxNorm, n, lipschitzConstant, parameter)));
+    }
+
+    if (!(valueNT || gradientNT || hessianNT)) return st;
+
+    DAAL_ASSERT(n <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_INT nRows       = (DAAL_INT)n;
+    DAAL_INT nCols       = (DAAL_INT)p;
+    DAAL_INT nClassesInt = (DAAL_INT)nClasses;
+    DAAL_INT ldb         = (DAAL_INT)nBetaPerClass;
+
+    char matdescra[6];
+    objective_function::internal::setCSRMatrixDescriptor(matdescra);
+    char trans           = 'T';
+    char notrans         = 'N';
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+
+    TArrayScalable<algorithmFPType, cpu> fArray(n * nClasses);
+    TArrayScalable<algorithmFPType, cpu> fTArray(n * nClasses);
+    algorithmFPType * f  = fArray.get();
+    algorithmFPType * fT = fTArray.get();
+    DAAL_CHECK_MALLOC(f && fT);
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+        //fT = X*b in the column-major layout
+        SpBlas<algorithmFPType, cpu>::xcsrmm(&notrans, &nRows, &nClassesInt, &nCols, &one, matdescra, values, (DAAL_INT *)cols,
+                                             (DAAL_INT *)rowOffsets, b + 1, &ldb, &zero, fT, &nRows);
+
+        //f = X*b + b0
+        const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < nClasses; ++k) f[i * nClasses + k] = fT[k * n + i] + interceptFactor * b[k * nBetaPerClass];
+        }
+    }
 
-            if (bL2)
+    //f = softmax(f)
+    softmaxThreaded(f, f, n, nClasses);
+
+    if (valueNT)
+    {
+        DAAL_CHECK_STATUS(st, (computeValue<algorithmFPType, cpu>(f, y, n, b, nClasses, nBetaPerClass, nonSmoothTermValue ? &notSmoothTerm : nullptr,
+                                                                  valueNT, parameter)));
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+
+        DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> gr(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        algorithmFPType * g = gr.get();
+
+        /* fT is reused for the residuals P - Y in the column-major layout */
+        algorithmFPType * r = fT;
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < nClasses; ++k)
+                r[k * n + i] = ((size_t(y[i]) == k) ? f[i * nClasses + k] - algorithmFPType(1.) : f[i * nClasses + k]);
+        }
+
+        SpBlas<algorithmFPType, cpu>::xcsrmm(&trans, &nRows, &nClassesInt, &nCols, &one, matdescra, values, (DAAL_INT *)cols, (DAAL_INT *)rowOffsets,
+                                             r, &nRows, &zero, g + 1, &ldb);
+
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            algorithmFPType sum = 0;
+            if (parameter->interceptFlag)
             {
-                for (size_t i = 0; i < nBeta; i++)
-                {
-                    const algorithmFPType regularValue = 2 * parameter->penaltyL2;
-                    h[i * nBeta + i] += (i % nBetaPerClass) ? regularValue : 0;
-                }
+                for (size_t i = 0; i < n; ++i) sum += r[k * n + i];
             }
+            g[k * nBetaPerClass] = sum;
         }
+
+        finalizeGradient<algorithmFPType, cpu>(g, n, b, nClasses, nBetaPerClass, parameter);
     }
-    return services::Status();
+
+    if (hessianNT)
+    {
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        DAAL_ASSERT(hessianNT->getNumberOfColumns() == nBeta);
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        algorithmFPType * h                   = hr.get();
+        const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
+        const auto hSize                      = nBeta * nBeta;
+        TlsSum<algorithmFPType, cpu> tlsData(hSize);
+        TlsSum<algorithmFPType, cpu> tlsRow(p);
+
+        daal::threader_for(n, n, [&](size_t i) {
+            algorithmFPType * xi = tlsRow.local();
+            for (size_t j = rowOffsets[i] - 1; j < rowOffsets[i + 1] - 1; ++j) xi[cols[j] - 1] = values[j];
+            addHessInPt<algorithmFPType, cpu>(tlsData.local(), xi, f + i * nClasses, interceptFactor, nClasses, nBetaPerClass, nBeta);
+            for (size_t j = rowOffsets[i] - 1; j < rowOffsets[i + 1] - 1; ++j) xi[cols[j] - 1] = 0;
+        });
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), hSize);
+        tlsData.reduceTo(h, hSize);
+
+        finalizeHessian<algorithmFPType, cpu>(h, n, nBeta, nBetaPerClass, parameter);
+    }
+    return st;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::computeCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT,
+                                                                                  size_t nRows, size_t p, NumericTable * betaNT,
+                                                                                  NumericTable * valueNT, NumericTable * hessianNT,
+                                                                                  NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                                  NumericTable * proximalProjection,
+                                                                                  NumericTable * lipschitzConstant, Parameter * parameter)
+{
+    const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
+    if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
+
+    if (ntInd)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+
+        objective_function::internal::CSRData<algorithmFPType, cpu> x;
+        TArrayScalable<algorithmFPType, cpu> aY(n);
+        DAAL_CHECK_MALLOC(aY.get());
+
+        services::Status s;
+        DAAL_CHECK_STATUS(
+            s, (objective_function::internal::getCSRXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, x, aY.get(), nRows, n)));
+        return doComputeCSR(x.values, x.cols, x.rowOffsets, aY.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                            proximalProjection, lipschitzConstant, parameter);
+    }
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, 0, nRows);
+    ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+
+    return doComputeCSR(xr.values(), xr.cols(), xr.rows(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                        proximalProjection, lipschitzConstant, parameter);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -430,6 +676,14 @@ services::Status CrossEntropyLossKernel<algorithmFPType, method, cpu>::compute(N
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface * csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (csrData)
+    {
+        return computeCSR(csrData, dependentVariablesNT, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
+                          lipschitzConstant, parameter);
+    }
+
     if (ntInd)
     {
         const size_t n = ntInd->getNumberOfColumns();
@@ -27,6 +27,7 @@
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_blas.h"
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
 
 namespace daal
 {
@@ -62,6 +63,16 @@ protected:
     services::Status doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t nRows, size_t n, size_t p, NumericTable * betaNT,
                                NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
                                NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter);
+
+    services::Status computeCSR(CSRNumericTableIface * data, NumericTable * dependentVariables, size_t nRows, size_t p, NumericTable * betaNT,
+                                NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                NumericTable * proximalProjection, NumericTable * lipschitzConstant, Parameter * parameter);
+
+    /* Computes the results on the rows of the data set in the CSR format with one-based indices */
+    services::Status doComputeCSR(const algorithmFPType * values, const size_t * cols, const size_t * rowOffsets, const algorithmFPType * y, size_t n,
+                                  size_t p, NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT, NumericTable * gradientNT,
+                                  NumericTable * nonSmoothTermValue, NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                  Parameter * parameter);
 };
 
 } // namespace internal
@@ -24,6 +24,7 @@
 #include "externals/service_math.h"
 #include "service/kernel/service_utils.h"
 #include "externals/service_ittnotify.h"
+#include "externals/service_spblas.h"
 
 DAAL_ITTNOTIFY_DOMAIN(logistic_loss.dense.default.batch);
 
@@ -124,21 +125,147 @@ void LogLossKernel<algorithmFPType, method, cpu>::sigmoid(const algorithmFPType
     for (size_t i = 0; i < n; ++i) s[i] = algorithmFPType(1.0) / (algorithmFPType(1.0) + s[i]);
 }
 
-template <typename algorithmFPType, Method method, CpuType cpu>
-services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
-                                                                        NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
-                                                                        NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
-                                                                        NumericTable * proximalProjection, NumericTable * lipschitzConstant,
-                                                                        Parameter * parameter)
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeProximalProjection(const algorithmFPType * b, size_t nBeta, NumericTable * proximalProjection,
+                                                  const Parameter * parameter)
+{
+    DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
+    algorithmFPType * prox;
+
+    HomogenNumericTable<algorithmFPType> * hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(proximalProjection);
+    WriteRows<algorithmFPType, cpu> pr;
+    if (hmgProx)
+    {
+        prox = hmgProx->getArray();
+    }
+    else
+    {
+        pr.set(proximalProjection, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(pr);
+        prox = pr.get();
+    }
+
+    prox[0] = b[0];
+    for (size_t i = 1; i < nBeta; i++)
+    {
+        if (b[i] > parameter->penaltyL1)
+        {
+            prox[i] = b[i] - parameter->penaltyL1;
+        }
+        if (b[i] < -parameter->penaltyL1)
+        {
+            prox[i] = b[i] + parameter->penaltyL1;
+        }
+        if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= parameter->penaltyL1)
+        {
+            prox[i] = 0;
+        }
+    }
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status setLipschitzConstant(algorithmFPType maxNorm, size_t n, NumericTable * lipschitzConstant, const Parameter * parameter)
+{
+    DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
+    WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(lipschitzConstantPtr);
+    algorithmFPType & c = *lipschitzConstantPtr.get();
+
+    algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
+    algorithmFPType lipschitz    = 0.25 * (maxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
+    algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
+    c                            = 2 * lipschitz + displacement;
+    return services::Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeNonSmoothTerm(const algorithmFPType * b, size_t nBeta, NumericTable * nonSmoothTermValue, const Parameter * parameter,
+                                             algorithmFPType & nonSmoothTerm)
+{
+    WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & v = *vr.get();
+
+    if ((parameter->penaltyL1 > 0))
+    {
+        for (size_t i = 1; i < nBeta; ++i)
+        {
+            nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+    v = nonSmoothTerm;
+    return services::Status();
+}
+
+/* Computes the value of the function from the sigmoids s = sigm(f), s1 = 1 - s stored in sg */
+template <typename algorithmFPType, CpuType cpu>
+static services::Status computeValue(const algorithmFPType * sg, const algorithmFPType * y, size_t n, const algorithmFPType * b, size_t nBeta,
+                                     const algorithmFPType * nonSmoothTerm, NumericTable * valueNT, const Parameter * parameter)
+{
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    TArrayScratch<algorithmFPType, cpu> logS(2 * n);
+    DAAL_CHECK_MALLOC(logS.get());
+    daal::internal::Math<algorithmFPType, cpu>::vLog(2 * n, sg, logS.get());
+
+    const algorithmFPType * ls  = logS.get();
+    const algorithmFPType * ls1 = ls + n;
+
+    WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(vr);
+    algorithmFPType & value = *vr.get();
+    value                   = 0.0;
+    for (size_t i = 0; i < n; ++i) value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
+
+    value *= -div;
+    if (parameter->penaltyL2 > 0)
+    {
+        for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
+    }
+
+    if (parameter->penaltyL1 > 0)
+    {
+        if (nonSmoothTerm)
+        {
+            value += *nonSmoothTerm;
+        }
+        else
+        {
+            for (size_t i = 1; i < nBeta; ++i) value += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
+        }
+    }
+    return services::Status();
+}
+
+/* Adds the intercept term, averages the gradient g[1], ..., g[p] accumulated over the observations and adds the L2 penalty */
+template <typename algorithmFPType, CpuType cpu>
+static void finalizeGradient(algorithmFPType * g, const algorithmFPType * s, const algorithmFPType * y, size_t n, const algorithmFPType * b,
+                             size_t nBeta, const Parameter * parameter)
+{
+    const size_t iFirstBeta   = parameter->interceptFlag ? 0 : 1;
+    const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+
+    g[0] = 0;
+    if (parameter->interceptFlag)
+    {
+        for (size_t i = 0; i < n; ++i) g[0] += (s[i] - y[i]);
+    }
+    for (size_t i = iFirstBeta; i < nBeta; ++i) g[i] *= div;
+
+    if (parameter->penaltyL2 > 0)
+    {
+        for (size_t i = 1; i < nBeta; ++i) g[i] += 2. * b[i] * parameter->penaltyL2;
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+static services::Status getBeta(NumericTable * betaNT, size_t nBeta, ReadRows<algorithmFPType, cpu> & betar, const algorithmFPType *& b)
 {
-    const size_t nBeta = p + 1;
     DAAL_ASSERT(betaNT->getNumberOfColumns() == 1);
     DAAL_ASSERT(betaNT->getNumberOfRows() == nBeta);
 
-    const algorithmFPType * b;
     HomogenNumericTable<algorithmFPType> * hmgBeta = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(betaNT);
-    ReadRows<algorithmFPType, cpu> betar;
-
     if (hmgBeta)
     {
         b = (*hmgBeta).getArray();
@@ -149,49 +276,49 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         DAAL_CHECK_BLOCK_STATUS(betar);
         b = betar.get();
     }
+    return services::Status();
+}
 
-    if (proximalProjection)
+template <typename algorithmFPType, CpuType cpu>
+static services::Status getGradient(NumericTable * gradientNT, size_t nBeta, WriteRows<algorithmFPType, cpu> & gr, algorithmFPType *& g)
+{
+    DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
+
+    HomogenNumericTable<algorithmFPType> * hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientNT);
+    if (hmgGrad)
     {
-        DAAL_ASSERT(proximalProjection->getNumberOfRows() == nBeta);
-        algorithmFPType * prox;
+        g = hmgGrad->getArray();
+    }
+    else
+    {
+        gr.set(gradientNT, 0, nBeta);
+        DAAL_CHECK_BLOCK_STATUS(gr);
+        g = gr.get();
+    }
+    return services::Status();
+}
 
-        HomogenNumericTable<algorithmFPType> * hmgProx = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(proximalProjection);
-        WriteRows<algorithmFPType, cpu> pr;
-        if (hmgProx)
-        {
-            prox = hmgProx->getArray();
-        }
-        else
-        {
-            pr.set(proximalProjection, 0, nBeta);
-            DAAL_CHECK_BLOCK_STATUS(pr);
-            prox = pr.get();
-        }
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const algorithmFPType * x, const algorithmFPType * y, size_t n, size_t p,
+                                                                        NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
+                                                                        NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                        NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                        Parameter * parameter)
+{
+    const size_t nBeta = p + 1;
 
-        prox[0] = b[0];
-        for (size_t i = 1; i < nBeta; i++)
-        {
-            if (b[i] > parameter->penaltyL1)
-            {
-                prox[i] = b[i] - parameter->penaltyL1;
-            }
-            if (b[i] < -parameter->penaltyL1)
-            {
-                prox[i] = b[i] + parameter->penaltyL1;
-            }
-            if (daal::internal::Math<algorithmFPType, cpu>::sFabs(b[i]) <= parameter->penaltyL1)
-            {
-                prox[i] = 0;
-            }
-        }
+    services::Status st;
+    const algorithmFPType * b;
+    ReadRows<algorithmFPType, cpu> betar;
+    DAAL_CHECK_STATUS(st, (getBeta<algorithmFPType, cpu>(betaNT, nBeta, betar, b)));
+
+    if (proximalProjection)
+    {
+        DAAL_CHECK_STATUS(st, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter)));
     }
 
     if (lipschitzConstant)
     {
-        DAAL_ASSERT(lipschitzConstant->getNumberOfRows() == 1);
-        WriteRows<algorithmFPType, cpu> lipschitzConstantPtr(lipschitzConstant, 0, 1);
-        algorithmFPType & c = *lipschitzConstantPtr.get();
-
         const size_t blockSize = 256;
         size_t nBlocks         = n / blockSize;
         nBlocks += (nBlocks * blockSize != n);
@@ -224,27 +351,13 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             }
         });
 
-        algorithmFPType alpha_scaled = algorithmFPType(parameter->penaltyL2) / algorithmFPType(n);
-        algorithmFPType lipschitz    = 0.25 * (globalMaxNorm + algorithmFPType(parameter->interceptFlag)) + alpha_scaled;
-        algorithmFPType displacement = daal::internal::Math<algorithmFPType, cpu>::sMin(2 * parameter->penaltyL2, lipschitz);
-        c                            = 2 * lipschitz + displacement;
+        DAAL_CHECK_STATUS(st, (setLipschitzConstant<algorithmFPType, cpu>(globalMaxNorm, n, lipschitzConstant, parameter)));
     }
 
     algorithmFPType nonSmoothTerm = 0;
     if (nonSmoothTermValue)
     {
-        WriteRows<algorithmFPType, cpu> vr(nonSmoothTermValue, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(vr);
-        algorithmFPType & v = *vr.get();
-
-        if ((parameter->penaltyL1 > 0))
-        {
-            for (size_t i = 1; i < nBeta; ++i)
-            {
-                nonSmoothTerm += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
-            }
-        }
-        v = nonSmoothTerm;
+        DAAL_CHECK_STATUS(st, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm)));
     }
 
     if (valueNT || gradientNT || hessianNT)
@@ -252,8 +365,8 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         TNArray<algorithmFPType, 16, cpu> f;
         TNArray<algorithmFPType, 32, cpu> sg;
 
-        TArrayScalable<algorithmFPType, cpu> fScalable;
-        TArrayScalable<algorithmFPType, cpu> sgScalable;
+        TArrayScratch<algorithmFPType, cpu> fScratch;
+        TArrayScratch<algorithmFPType, cpu> sgScratch;
 
         algorithmFPType * fPtr;
         algorithmFPType * sgPtr;
@@ -266,10 +379,10 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
         }
         else
         {
-            fScalable.reset(n);
-            sgScalable.reset(2 * n);
-            fPtr  = fScalable.get();
-            sgPtr = sgScalable.get();
+            fScratch.reset(n);
+            sgScratch.reset(2 * n);
+            fPtr  = fScratch.get();
+            sgPtr = sgScratch.get();
         }
         //f = X*b + b0
         applyBetaThreaded(x, b, fPtr, n, p, parameter->interceptFlag);
@@ -283,66 +396,24 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             sigmoids<algorithmFPType, cpu>(sgPtr, n);
         }
 
-        const bool bL1 = (parameter->penaltyL1 > 0);
-        const bool bL2 = (parameter->penaltyL2 > 0);
-
-        const size_t iFirstBeta   = parameter->interceptFlag ? 0 : 1;
         const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
 
         if (valueNT)
         {
-            TArrayScalable<algorithmFPType, cpu> logS(2 * n);
-            daal::internal::Math<algorithmFPType, cpu>::vLog(2 * n, sgPtr, logS.get());
-
-            const algorithmFPType * ls  = logS.get();
-            const algorithmFPType * ls1 = ls + n;
-
-            WriteRows<algorithmFPType, cpu> vr(valueNT, 0, 1);
-            DAAL_CHECK_BLOCK_STATUS(vr);
-            algorithmFPType & value = *vr.get();
-            value                   = 0.0;
-            for (size_t i = 0; i < n; ++i) value += y[i] * ls[i] + (algorithmFPType(1) - y[i]) * ls1[i];
-
-            value *= -div;
-            if (bL2)
-            {
-                for (size_t i = 1; i < nBeta; ++i) value += b[i] * b[i] * parameter->penaltyL2;
-            }
-
-            if (bL1)
-            {
-                if (nonSmoothTermValue)
-                {
-                    value += nonSmoothTerm;
-                }
-                else
-                {
-                    for (size_t i = 1; i < nBeta; ++i) value += (b[i] < 0 ? -b[i] : b[i]) * parameter->penaltyL1;
-                }
-            }
+            DAAL_CHECK_STATUS(st, (computeValue<algorithmFPType, cpu>(sgPtr, y, n, b, nBeta, nonSmoothTermValue ? &nonSmoothTerm : nullptr, valueNT,
+                                                                      parameter)));
         }
 
         if (gradientNT)
         {
             DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
 
-            DAAL_ASSERT(gradientNT->getNumberOfRows() == nBeta);
             algorithmFPType * s = sgPtr;
 
             algorithmFPType * g;
-            HomogenNumericTable<algorithmFPType> * hmgGrad = dynamic_cast<HomogenNumericTable<algorithmFPType> *>(gradientNT);
             WriteRows<algorithmFPType, cpu> gr;
-            if (hmgGrad)
-            {
-                g = hmgGrad->getArray();
-            }
-            else
-            {
-                gr.set(gradientNT, 0, nBeta);
-                DAAL_CHECK_BLOCK_STATUS(gr);
-                g = gr.get();
-            }
-            g[0]                = 0;
+            DAAL_CHECK_STATUS(st, (getGradient<algorithmFPType, cpu>(gradientNT, nBeta, gr, g)));
+
             char trans          = 'T';
             char notrans        = 'N';
             algorithmFPType one = 1.0;
@@ -398,16 +469,7 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
                 }
             }
 
-            if (parameter->interceptFlag)
-            {
-                for (size_t i = 0; i < n; ++i) g[0] += (s[i] - y[i]);
-            }
-            for (size_t i = iFirstBeta; i < nBeta; ++i) g[i] *= div;
-
-            if (bL2)
-            {
-                for (size_t i = 1; i < nBeta; ++i) g[i] += 2. * b[i] * parameter->penaltyL2;
-            }
+            finalizeGradient<algorithmFPType, cpu>(g, s, y, n, b, nBeta, parameter);
         }
 
         if (hessianNT)
@@ -461,7 +523,210 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::doCompute(const al
             }
         }
     }
-    return services::Status();
+    return st;
+}
+
+/*
+    Computations on the data set in the CSR format:
+    f = X * b + b0 and the gradient X^T * (s - y) are computed with the sparse BLAS matrix-vector products,
+    the Hessian is accumulated over the pairs of non-zero values of the rows in parallel over the blocks of rows
+*/
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::doComputeCSR(const algorithmFPType * values, const size_t * cols,
+                                                                           const size_t * rowOffsets, const algorithmFPType * y, size_t n, size_t p,
+                                                                           NumericTable * betaNT, NumericTable * valueNT, NumericTable * hessianNT,
+                                                                           NumericTable * gradientNT, NumericTable * nonSmoothTermValue,
+                                                                           NumericTable * proximalProjection, NumericTable * lipschitzConstant,
+                                                                           Parameter * parameter)
+{
+    const size_t nBeta = p + 1;
+
+    services::Status st;
+    const algorithmFPType * b;
+    ReadRows<algorithmFPType, cpu> betar;
+    DAAL_CHECK_STATUS(st, (getBeta<algorithmFPType, cpu>(betaNT, nBeta, betar, b)));
+
+    if (proximalProjection)
+    {
+        DAAL_CHECK_STATUS(st, (computeProximalProjection<algorithmFPType, cpu>(b, nBeta, proximalProjection, parameter)));
+    }
+
+    objective_function::internal::CSRData<algorithmFPType, cpu> x;
+    x.values     = values;
+    x.cols       = cols;
+    x.rowOffsets = rowOffsets;
+
+    if (lipschitzConstant)
+    {
+        const algorithmFPType maxNorm = objective_function::internal::getCSRMaxSquaredRowNorm<algorithmFPType, cpu>(x, n);
+        DAAL_CHECK_STATUS(st, (setLipschitzConstant<algorithmFPType, cpu>(maxNorm, n, lipschitzConstant, parameter)));
+    }
+
+    algorithmFPType nonSmoothTerm = 0;
+    if (nonSmoothTermValue)
+    {
+        DAAL_CHECK_STATUS(st, (computeNonSmoothTerm<algorithmFPType, cpu>(b, nBeta, nonSmoothTermValue, parameter, nonSmoothTerm)));
+    }
+
+    if (!(valueNT || gradientNT || hessianNT)) return st;
+
+    DAAL_ASSERT(n <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_ASSERT(p <= services::internal::MaxVal<DAAL_INT>::get());
+    DAAL_INT nRows = (DAAL_INT)n;
+    DAAL_INT nCols = (DAAL_INT)p;
+
+    char matdescra[6];
+    objective_function::internal::setCSRMatrixDescriptor(matdescra);
+    char trans           = 'T';
+    char notrans         = 'N';
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+
+    TArrayScalable<algorithmFPType, cpu> fArray(n);
+    TArrayScalable<algorithmFPType, cpu> sgArray(2 * n);
+    algorithmFPType * f  = fArray.get();
+    algorithmFPType * sg = sgArray.get();
+    DAAL_CHECK_MALLOC(f && sg);
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyBeta);
+        //f = X*b + b0
+        SpBlas<algorithmFPType, cpu>::xcsrmv(&notrans, &nRows, &nCols, &one, matdescra, values, (DAAL_INT *)cols, (DAAL_INT *)rowOffsets,
+                                             (DAAL_INT *)rowOffsets + 1, b + 1, &zero, f);
+        if (parameter->interceptFlag)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; ++i) f[i] += b[0];
+        }
+    }
+
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(sigmoids);
+        //s = exp(-f)
+        vexp<algorithmFPType, cpu>(f, sg, n);
+
+        //s = sigm(f), s1 = 1 - s
+        sigmoids<algorithmFPType, cpu>(sg, n);
+    }
+
+    if (valueNT)
+    {
+        DAAL_CHECK_STATUS(st, (computeValue<algorithmFPType, cpu>(sg, y, n, b, nBeta, nonSmoothTermValue ? &nonSmoothTerm : nullptr, valueNT,
+                                                                  parameter)));
+    }
+
+    if (gradientNT)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(applyGradient);
+
+        algorithmFPType * g;
+        WriteRows<algorithmFPType, cpu> gr;
+        DAAL_CHECK_STATUS(st, (getGradient<algorithmFPType, cpu>(gradientNT, nBeta, gr, g)));
+
+        /* f is reused for the residuals s - y */
+        algorithmFPType * r = f;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; ++i) r[i] = sg[i] - y[i];
+
+        SpBlas<algorithmFPType, cpu>::xcsrmv(&trans, &nRows, &nCols, &one, matdescra, values, (DAAL_INT *)cols, (DAAL_INT *)rowOffsets,
+                                             (DAAL_INT *)rowOffsets + 1, r, &zero, g + 1);
+
+        finalizeGradient<algorithmFPType, cpu>(g, sg, y, n, b, nBeta, parameter);
+    }
+
+    if (hessianNT)
+    {
+        DAAL_ASSERT(hessianNT->getNumberOfRows() == nBeta);
+        WriteRows<algorithmFPType, cpu> hr(hessianNT, 0, nBeta * nBeta);
+        DAAL_CHECK_BLOCK_STATUS(hr);
+        algorithmFPType * h = hr.get();
+
+        algorithmFPType * s = sg;
+        for (size_t i = 0; i < n; ++i)
+        {
+            s[i] *= s[i + n]; //sigmoid derivative at x[i]
+        }
+
+        /* Upper triangle of the Hessian is accumulated, x[i][-1] = 1 corresponds to the intercept term */
+        const size_t hSize                    = nBeta * nBeta;
+        const algorithmFPType interceptFactor = (parameter->interceptFlag ? 1 : 0);
+        const size_t nRowsInBlock             = 256;
+        const size_t nDataBlocks              = n / nRowsInBlock + !!(n % nRowsInBlock);
+        TlsSum<algorithmFPType, cpu> tlsData(hSize);
+        daal::threader_for(nDataBlocks, nDataBlocks, [&](size_t iBlock) {
+            algorithmFPType * hLocal = tlsData.local();
+            const size_t iEndRow     = (iBlock == nDataBlocks - 1) ? n : (iBlock + 1) * nRowsInBlock;
+            for (size_t i = iBlock * nRowsInBlock; i < iEndRow; ++i)
+            {
+                const size_t begin = rowOffsets[i] - 1;
+                const size_t end   = rowOffsets[i + 1] - 1;
+                hLocal[0] += interceptFactor * s[i];
+                for (size_t jj = begin; jj < end; ++jj)
+                {
+                    const size_t j            = cols[jj];
+                    const algorithmFPType sxj = s[i] * values[jj];
+                    hLocal[j] += interceptFactor * sxj;
+                    for (size_t kk = begin; kk < end; ++kk)
+                    {
+                        const size_t k = cols[kk];
+                        if (k >= j) hLocal[j * nBeta + k] += sxj * values[kk];
+                    }
+                }
+            }
+        });
+        daal::services::internal::service_memset<algorithmFPType, cpu>(h, algorithmFPType(0), hSize);
+        tlsData.reduceTo(h, hSize);
+
+        const algorithmFPType div = algorithmFPType(1) / algorithmFPType(n);
+        for (size_t j = 0; j < nBeta; ++j)
+        {
+            h[j * nBeta + j] *= div;
+            for (size_t k = j + 1; k < nBeta; ++k)
+            {
+                h[j * nBeta + k] *= div;
+                h[k * nBeta + j] = h[j * nBeta + k];
+            }
+            if (j > 0) h[j * nBeta + j] += 2. * parameter->penaltyL2;
+        }
+    }
+    return st;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status LogLossKernel<algorithmFPType, method, cpu>::computeCSR(CSRNumericTableIface * dataNT, NumericTable * dependentVariablesNT,
+                                                                         size_t nRows, size_t p, NumericTable * betaNT, NumericTable * valueNT,
+                                                                         NumericTable * hessianNT, NumericTable * gradientNT,
+                                                                         NumericTable * nonSmoothTermValue, NumericTable * proximalProjection,
+                                                                         NumericTable * lipschitzConstant, Parameter * parameter)
+{
+    const daal::data_management::NumericTable * ntInd = parameter->batchIndices.get();
+    if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
+
+    if (ntInd)
+    {
+        const size_t n = ntInd->getNumberOfColumns();
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, sizeof(algorithmFPType));
+
+        objective_function::internal::CSRData<algorithmFPType, cpu> x;
+        TArrayScalable<algorithmFPType, cpu> aY(n);
+        DAAL_CHECK_MALLOC(aY.get());
+
+        services::Status s;
+        DAAL_CHECK_STATUS(
+            s, (objective_function::internal::getCSRXY<algorithmFPType, cpu>(dataNT, dependentVariablesNT, ntInd, x, aY.get(), nRows, n)));
+        return doComputeCSR(x.values, x.cols, x.rowOffsets, aY.get(), n, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                            proximalProjection, lipschitzConstant, parameter);
+    }
+
+    ReadRowsCSR<algorithmFPType, cpu> xr(dataNT, 0, nRows);
+    ReadRows<algorithmFPType, cpu> yr(dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xr);
+    DAAL_CHECK_BLOCK_STATUS(yr);
+
+    return doComputeCSR(xr.values(), xr.cols(), xr.rows(), yr.get(), nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue,
+                        proximalProjection, lipschitzConstant, parameter);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -477,6 +742,13 @@ services::Status LogLossKernel<algorithmFPType, method, cpu>::compute(NumericTab
     if (ntInd && (ntInd->getNumberOfColumns() == nRows)) ntInd = nullptr;
     services::Status s;
     const size_t p = dataNT->getNumberOfColumns();
+
+    CSRNumericTableIface * csrData = dynamic_cast<CSRNumericTableIface *>(dataNT);
+    if (csrData)
+    {
+        return computeCSR(csrData, dependentVariablesNT, nRows, p, betaNT, valueNT, hessianNT, gradientNT, nonSmoothTermValue, proximalProjection,
+                          lipschitzConstant, parameter);
+    }
     if (ntInd)
     {
         const size_t n                                               = ntInd->getNumberOfColumns();
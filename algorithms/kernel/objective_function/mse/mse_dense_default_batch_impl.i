@@ -75,14 +75,14 @@ inline services::Status MSEKernel<algorithmFPType, method, cpu>::compute(Numeric
                     const bool featuresEqual                            = soaDataPtr->getDictionary()->getFeaturesEqual();
                     bool isContinuous                                   = false;
                     data_management::features::IndexNumType currentType = features::internal::getIndexNumType<algorithmFPType>();
-                    if (currentType == (*(soaDataPtr->getDictionary()))[0].getIndexType())
+                    if (currentType == soaDataPtr->getDictionary()->getFeature(0).getIndexType())
                     {
                         isContinuous = true;
                         if (!featuresEqual)
                         {
                             for (size_t i = 1; i < nTheta; i++)
                             {
-                                if (currentType != (*(soaDataPtr->getDictionary()))[i].getIndexType())
+                                if (currentType != soaDataPtr->getDictionary()->getFeature(i).getIndexType())
                                 {
                                     isContinuous = false;
                                     break;
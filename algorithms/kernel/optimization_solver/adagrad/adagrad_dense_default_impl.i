@@ -196,8 +196,8 @@ services::Status AdagradKernel<algorithmFPType, method, cpu>::compute(HostAppIfa
         if (nIter > 1)
         {
             algorithmFPType pointNorm, gradientNorm;
-            DAAL_CHECK_STATUS(s, (IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(workValue, nRows, pointNorm, _blockSize, _threadStart)));
-            DAAL_CHECK_STATUS(s, (IterativeSolverKernel<algorithmFPType, cpu>::vectorNorm(gradient, nRows, gradientNorm, _blockSize, _threadStart)));
+            DAAL_CHECK_STATUS(s, (IterativeSolverKernel<algorithmFPType, cpu>::vectorNorms(workValue, gradient, nRows, pointNorm, gradientNorm,
+                                                                                            _blockSize, _threadStart)));
             const algorithmFPType gradientThreshold =
                 parameter->accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(algorithmFPType(1.0), pointNorm);
             if (gradientNorm <= gradientThreshold)
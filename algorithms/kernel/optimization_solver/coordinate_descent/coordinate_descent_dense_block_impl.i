@@ -0,0 +1,570 @@
+/* file: coordinate_descent_dense_block_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the block coordinate descent for the mean squared error objective function
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_DENSE_BLOCK_IMPL_I__
+#define __COORDINATE_DESCENT_DENSE_BLOCK_IMPL_I__
+
+#include "algorithms/optimization_solver/objective_function/mse_batch.h"
+#include "algorithms/kernel/service_threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "externals/service_math.h"
+#include "externals/service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+
+/*
+    Block coordinate descent for the mean squared error with L1 and L2 penalties:
+    ----------------------------------------------------------------------------
+    The coordinates are grouped into the blocks of weakly correlated features. All coordinates of a block are updated
+    simultaneously from the same residual r = y - X * b:
+        b_j = S(h_j * b_j + x_j^T * r / n, l1) / (h_j + l2),  h_j = x_j^T * x_j / n,
+    where S is the soft thresholding operator. The rows are split between the threads, every thread applies the updates
+    of the previous block to its rows of the residual and accumulates thread-local partial dot products x_j^T * r of the next block.
+
+    With the screening enabled the strong rule discards the coordinates with |x_j^T * r| / n < 2 * l1 - lambdaMax,
+    where lambdaMax = max_j |x_j^T * r| / n, before the descent. The discarded coordinates that violate
+    the optimality condition |x_j^T * r| / n <= l1 at the minimum are returned to the working set and the descent is resumed.
+*/
+template <typename algorithmFPType, CpuType cpu>
+class MSEBlockTask
+{
+public:
+    MSEBlockTask(const algorithmFPType * x, const algorithmFPType * y, algorithmFPType * b, size_t nRows, size_t nFeatures, size_t yDim,
+                 bool interceptFlag, algorithmFPType l1, algorithmFPType l2, bool positive)
+        : _x(x),
+          _y(y),
+          _b(b),
+          _nRows(nRows),
+          _nFeatures(nFeatures),
+          _yDim(yDim),
+          _interceptFlag(interceptFlag),
+          _l1(l1),
+          _l2(l2),
+          _positive(positive),
+          _nBlocks(0)
+    {}
+
+    services::Status compute(const Parameter * parameter, size_t & nSweeps);
+
+private:
+    services::Status init();
+    services::Status buildBlocks(const size_t * ids, size_t nIds, size_t maxBlockSize);
+    services::Status sweep(size_t maxBlockSize, algorithmFPType & maxDiff, algorithmFPType & maxValue);
+    services::Status processRows(const size_t * prevIds, size_t nPrevIds, const algorithmFPType * deltas, const size_t * ids, size_t nIds,
+                                 algorithmFPType * dots);
+    bool isOptimal(const algorithmFPType * dots) const;
+
+    /* Value of the coordinate id in the i-th row, the coordinate 0 is the intercept */
+    algorithmFPType xValue(size_t i, size_t id) const { return id ? _x[i * _nFeatures + id - 1] : algorithmFPType(1); }
+
+    static const size_t _rowBlockSize  = 256;
+    static const size_t _nSampleRows   = 1024;    /* Number of the first rows used to estimate correlations of the features */
+    static const size_t _maxOpenBlocks = 4;       /* Number of the blocks being filled at the same time */
+    static const algorithmFPType _maxCorrelation; /* Maximal absolute correlation of the features of one block */
+
+    const algorithmFPType * _x;
+    const algorithmFPType * _y;
+    algorithmFPType * _b;
+    const size_t _nRows;
+    const size_t _nFeatures;
+    const size_t _yDim;
+    const bool _interceptFlag;
+    const algorithmFPType _l1;
+    const algorithmFPType _l2;
+    const bool _positive;
+
+    TArray<algorithmFPType, cpu> _residual;
+    TArray<algorithmFPType, cpu> _hessian;
+    TArray<size_t, cpu> _features;
+    TArray<size_t, cpu> _blockOffsets;
+    size_t _nBlocks;
+};
+
+template <typename algorithmFPType, CpuType cpu>
+const algorithmFPType MSEBlockTask<algorithmFPType, cpu>::_maxCorrelation = algorithmFPType(0.1);
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status MSEBlockTask<algorithmFPType, cpu>::compute(const Parameter * parameter, size_t & nSweeps)
+{
+    Status s = init();
+    if (!s) return s;
+
+    const size_t nTheta        = _nFeatures + 1;
+    const size_t startId       = parameter->skipTheFirstComponents ? 1 : 0;
+    const size_t maxBlockSize  = parameter->featureBlockSize;
+    const size_t maxIterations = parameter->nIterations;
+
+    TArray<size_t, cpu> workingT(nTheta);
+    TArray<size_t, cpu> screenedT(nTheta);
+    TArray<algorithmFPType, cpu> dotsT(_nFeatures ? _nFeatures * _yDim : 1);
+    size_t * working       = workingT.get();
+    size_t * screened      = screenedT.get();
+    algorithmFPType * dots = dotsT.get();
+    DAAL_CHECK_MALLOC(working && screened && dots);
+
+    size_t nWorking  = 0;
+    size_t nScreened = 0;
+    if (parameter->screening && _l1 > 0 && _nFeatures)
+    {
+        for (size_t id = 1; id < nTheta; id++) screened[id - 1] = id;
+        s = processRows(nullptr, 0, nullptr, screened, _nFeatures, dots);
+        if (!s) return s;
+
+        const algorithmFPType inverseNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+        algorithmFPType lambdaMax          = 0;
+        for (size_t i = 0; i < _nFeatures * _yDim; i++)
+        {
+            const algorithmFPType value = Math<algorithmFPType, cpu>::sFabs(dots[i]) * inverseNRows;
+            lambdaMax                   = value > lambdaMax ? value : lambdaMax;
+        }
+        const algorithmFPType threshold = algorithmFPType(2) * _l1 - lambdaMax;
+
+        for (size_t id = startId; id < nTheta; id++)
+        {
+            bool keep = (id == 0);
+            for (size_t ic = 0; ic < _yDim && !keep; ic++)
+            {
+                keep = (_b[id * _yDim + ic] != 0) || (Math<algorithmFPType, cpu>::sFabs(dots[(id - 1) * _yDim + ic]) * inverseNRows >= threshold);
+            }
+            if (keep)
+            {
+                working[nWorking++] = id;
+            }
+            else
+            {
+                screened[nScreened++] = id;
+            }
+        }
+    }
+    else
+    {
+        for (size_t id = startId; id < nTheta; id++) working[nWorking++] = id;
+    }
+
+    nSweeps                                 = 0;
+    const algorithmFPType accuracyThreshold = parameter->accuracyThreshold;
+    for (;;)
+    {
+        s = buildBlocks(working, nWorking, maxBlockSize);
+        if (!s) return s;
+
+        while (nSweeps < maxIterations)
+        {
+            algorithmFPType maxDiff  = 0;
+            algorithmFPType maxValue = 0;
+            s                        = sweep(maxBlockSize, maxDiff, maxValue);
+            if (!s) return s;
+            nSweeps++;
+            if (maxDiff <= accuracyThreshold * maxValue) break;
+        }
+        if (!nScreened || nSweeps >= maxIterations) break;
+
+        /* Optimality check of the discarded coordinates */
+        s = processRows(nullptr, 0, nullptr, screened, nScreened, dots);
+        if (!s) return s;
+
+        const size_t nWorkingPrev = nWorking;
+        size_t nStillScreened     = 0;
+        for (size_t k = 0; k < nScreened; k++)
+        {
+            if (isOptimal(dots + k * _yDim))
+            {
+                screened[nStillScreened++] = screened[k];
+            }
+            else
+            {
+                working[nWorking++] = screened[k];
+            }
+        }
+        nScreened = nStillScreened;
+        if (nWorking == nWorkingPrev) break;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool MSEBlockTask<algorithmFPType, cpu>::isOptimal(const algorithmFPType * dots) const
+{
+    const algorithmFPType inverseNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+    for (size_t ic = 0; ic < _yDim; ic++)
+    {
+        const algorithmFPType value = dots[ic] * inverseNRows;
+        if ((_positive ? value : Math<algorithmFPType, cpu>::sFabs(value)) > _l1) return false;
+    }
+    return true;
+}
+
+/**
+ *  \brief Computes the residual r = y - X * b and the diagonal of the Hessian h_j = x_j^T * x_j / n
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status MSEBlockTask<algorithmFPType, cpu>::init()
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _nRows, _yDim);
+    _residual.reset(_nRows * _yDim);
+    _hessian.reset(_nFeatures);
+    algorithmFPType * r = _residual.get();
+    algorithmFPType * h = _hessian.get();
+    DAAL_CHECK_MALLOC(r && h);
+
+    const size_t nRowBlocks = _nRows / _rowBlockSize + !!(_nRows % _rowBlockSize);
+
+    TlsSum<algorithmFPType, cpu> tlsHessian(_nFeatures);
+    SafeStatus safeStat;
+    daal::threader_for(nRowBlocks, nRowBlocks, [&](size_t iBlock) {
+        algorithmFPType * localHessian = tlsHessian.local();
+        DAAL_CHECK_MALLOC_THR(localHessian);
+
+        const size_t startRow  = iBlock * _rowBlockSize;
+        const size_t finishRow = (iBlock + 1 == nRowBlocks) ? _nRows : startRow + _rowBlockSize;
+        for (size_t i = startRow; i < finishRow; i++)
+        {
+            const algorithmFPType * xi = _x + i * _nFeatures;
+            for (size_t ic = 0; ic < _yDim; ic++)
+            {
+                algorithmFPType value = _y[i * _yDim + ic] - (_interceptFlag ? _b[ic] : algorithmFPType(0));
+                for (size_t j = 0; j < _nFeatures; j++)
+                {
+                    value -= xi[j] * _b[(j + 1) * _yDim + ic];
+                }
+                r[i * _yDim + ic] = value;
+            }
+
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                localHessian[j] += xi[j] * xi[j];
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    daal::services::internal::service_memset_seq<algorithmFPType, cpu>(h, algorithmFPType(0), _nFeatures);
+    tlsHessian.reduceTo(h, _nFeatures);
+
+    const algorithmFPType inverseNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+    for (size_t j = 0; j < _nFeatures; j++)
+    {
+        h[j] *= inverseNRows;
+    }
+    return Status();
+}
+
+/**
+ *  \brief Groups the coordinates ids into the blocks of at most maxBlockSize weakly correlated coordinates.
+ *         A coordinate is added to the first of the blocks being filled that has no features correlated with it,
+ *         the fullest block is closed when a new one is needed. The intercept forms a separate block.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status MSEBlockTask<algorithmFPType, cpu>::buildBlocks(const size_t * ids, size_t nIds, size_t maxBlockSize)
+{
+    _features.reset(nIds ? nIds : 1);
+    _blockOffsets.reset(nIds + 1);
+    size_t * features = _features.get();
+    size_t * offsets  = _blockOffsets.get();
+    DAAL_CHECK_MALLOC(features && offsets);
+
+    _nBlocks   = 0;
+    offsets[0] = 0;
+    if (maxBlockSize == 1)
+    {
+        for (size_t k = 0; k < nIds; k++)
+        {
+            features[k]    = ids[k];
+            offsets[k + 1] = k + 1;
+        }
+        _nBlocks = nIds;
+        return Status();
+    }
+
+    const size_t nSampleRows = (_nRows < _nSampleRows) ? _nRows : _nSampleRows;
+    const size_t nOpenSlots  = _maxOpenBlocks * maxBlockSize;
+
+    TArray<algorithmFPType, cpu> normsT(nIds ? nIds : 1);
+    TArray<algorithmFPType, cpu> dotsT(nOpenSlots);
+    TArray<size_t, cpu> membersT(nOpenSlots);
+    size_t sizes[_maxOpenBlocks];
+    algorithmFPType * norms = normsT.get();
+    algorithmFPType * dots  = dotsT.get();
+    size_t * members        = membersT.get(); /* Positions in ids of the members of the blocks being filled */
+    DAAL_CHECK_MALLOC(norms && dots && members);
+
+    for (size_t k = 0; k < nIds; k++)
+    {
+        algorithmFPType norm = 0;
+        for (size_t i = 0; i < nSampleRows; i++)
+        {
+            const algorithmFPType value = xValue(i, ids[k]);
+            norm += value * value;
+        }
+        norms[k] = Math<algorithmFPType, cpu>::sSqrt(norm);
+    }
+
+    size_t nPlaced = 0;
+    size_t nOpen   = 0;
+    auto closeBlock = [&](size_t slot) {
+        for (size_t t = 0; t < sizes[slot]; t++)
+        {
+            features[nPlaced++] = ids[members[slot * maxBlockSize + t]];
+        }
+        offsets[++_nBlocks] = nPlaced;
+
+        nOpen--;
+        for (size_t t = 0; t < sizes[nOpen]; t++)
+        {
+            members[slot * maxBlockSize + t] = members[nOpen * maxBlockSize + t];
+        }
+        sizes[slot] = sizes[nOpen];
+    };
+
+    for (size_t k = 0; k < nIds; k++)
+    {
+        if (ids[k] == 0)
+        {
+            features[nPlaced++] = 0;
+            offsets[++_nBlocks] = nPlaced;
+            continue;
+        }
+
+        for (size_t slot = 0; slot < nOpen; slot++)
+        {
+            for (size_t t = 0; t < sizes[slot]; t++) dots[slot * maxBlockSize + t] = 0;
+        }
+        for (size_t i = 0; i < nSampleRows; i++)
+        {
+            const algorithmFPType value = xValue(i, ids[k]);
+            for (size_t slot = 0; slot < nOpen; slot++)
+            {
+                for (size_t t = 0; t < sizes[slot]; t++)
+                {
+                    dots[slot * maxBlockSize + t] += value * xValue(i, ids[members[slot * maxBlockSize + t]]);
+                }
+            }
+        }
+
+        size_t selected = nOpen;
+        for (size_t slot = 0; slot < nOpen && selected == nOpen; slot++)
+        {
+            bool isWeaklyCorrelated = true;
+            for (size_t t = 0; t < sizes[slot] && isWeaklyCorrelated; t++)
+            {
+                const algorithmFPType bound = _maxCorrelation * norms[k] * norms[members[slot * maxBlockSize + t]];
+                isWeaklyCorrelated          = Math<algorithmFPType, cpu>::sFabs(dots[slot * maxBlockSize + t]) <= bound;
+            }
+            if (isWeaklyCorrelated) selected = slot;
+        }
+
+        if (selected == nOpen)
+        {
+            if (nOpen == _maxOpenBlocks)
+            {
+                size_t fullest = 0;
+                for (size_t slot = 1; slot < nOpen; slot++)
+                {
+                    fullest = sizes[slot] > sizes[fullest] ? slot : fullest;
+                }
+                closeBlock(fullest);
+            }
+            selected        = nOpen++;
+            sizes[selected] = 0;
+        }
+
+        members[selected * maxBlockSize + sizes[selected]++] = k;
+        if (sizes[selected] == maxBlockSize) closeBlock(selected);
+    }
+    while (nOpen) closeBlock(nOpen - 1);
+
+    return Status();
+}
+
+/**
+ *  \brief Updates the coordinates of all blocks once
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status MSEBlockTask<algorithmFPType, cpu>::sweep(size_t maxBlockSize, algorithmFPType & maxDiff, algorithmFPType & maxValue)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, maxBlockSize, _yDim);
+    TArray<algorithmFPType, cpu> dotsT(maxBlockSize * _yDim);
+    TArray<algorithmFPType, cpu> deltasT(maxBlockSize * _yDim);
+    algorithmFPType * dots   = dotsT.get();
+    algorithmFPType * deltas = deltasT.get();
+    DAAL_CHECK_MALLOC(dots && deltas);
+
+    const algorithmFPType inverseNRows = algorithmFPType(1) / algorithmFPType(_nRows);
+    const size_t * features            = _features.get();
+    const size_t * offsets             = _blockOffsets.get();
+
+    Status s;
+    const size_t * prevIds = nullptr;
+    size_t nPrevIds        = 0;
+    for (size_t iBlock = 0; iBlock < _nBlocks; iBlock++)
+    {
+        const size_t * ids = features + offsets[iBlock];
+        const size_t nIds  = offsets[iBlock + 1] - offsets[iBlock];
+
+        /* Residual is updated with the deltas of the previous block while the dot products of the current block are computed */
+        s = processRows(prevIds, nPrevIds, deltas, ids, nIds, dots);
+        if (!s) return s;
+
+        for (size_t k = 0; k < nIds; k++)
+        {
+            const size_t id         = ids[k];
+            const algorithmFPType h = id ? _hessian[id - 1] : algorithmFPType(1);
+            for (size_t ic = 0; ic < _yDim; ic++)
+            {
+                algorithmFPType & value       = _b[id * _yDim + ic];
+                const algorithmFPType prev    = value;
+                const algorithmFPType product = dots[k * _yDim + ic] * inverseNRows;
+                if (id == 0)
+                {
+                    value = _interceptFlag ? prev + product : prev;
+                }
+                else if (h != 0)
+                {
+                    algorithmFPType z = h * prev + product;
+                    if (_positive && z < 0) z = 0;
+                    const algorithmFPType shrinked = (z > _l1) ? z - _l1 : ((z < -_l1) ? z + _l1 : algorithmFPType(0));
+                    value                          = shrinked / (h + _l2);
+                }
+                deltas[k * _yDim + ic] = value - prev;
+
+                const algorithmFPType diff         = Math<algorithmFPType, cpu>::sFabs(value - prev);
+                const algorithmFPType maxValueCurr = Math<algorithmFPType, cpu>::sFabs(value);
+                maxDiff                            = diff > maxDiff ? diff : maxDiff;
+                maxValue                           = maxValueCurr > maxValue ? maxValueCurr : maxValue;
+            }
+        }
+        prevIds  = ids;
+        nPrevIds = nIds;
+    }
+    return processRows(prevIds, nPrevIds, deltas, nullptr, 0, nullptr);
+}
+
+/**
+ *  \brief Subtracts the deltas of the coordinates prevIds multiplied by the features from the residual
+ *         and computes the dot products of the features of the coordinates ids with the updated residual
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status MSEBlockTask<algorithmFPType, cpu>::processRows(const size_t * prevIds, size_t nPrevIds, const algorithmFPType * deltas,
+                                                                 const size_t * ids, size_t nIds, algorithmFPType * dots)
+{
+    if (!nPrevIds && !nIds) return Status();
+
+    algorithmFPType * r     = _residual.get();
+    const size_t nDots      = nIds * _yDim;
+    const size_t nRowBlocks = _nRows / _rowBlockSize + !!(_nRows % _rowBlockSize);
+
+    TlsSum<algorithmFPType, cpu> tlsDots(nDots ? nDots : 1);
+    SafeStatus safeStat;
+    daal::threader_for(nRowBlocks, nRowBlocks, [&](size_t iBlock) {
+        algorithmFPType * localDots = tlsDots.local();
+        DAAL_CHECK_MALLOC_THR(localDots);
+
+        const size_t startRow  = iBlock * _rowBlockSize;
+        const size_t finishRow = (iBlock + 1 == nRowBlocks) ? _nRows : startRow + _rowBlockSize;
+        for (size_t i = startRow; i < finishRow; i++)
+        {
+            algorithmFPType * ri = r + i * _yDim;
+            for (size_t k = 0; k < nPrevIds; k++)
+            {
+                const algorithmFPType value = xValue(i, prevIds[k]);
+                for (size_t ic = 0; ic < _yDim; ic++)
+                {
+                    ri[ic] -= deltas[k * _yDim + ic] * value;
+                }
+            }
+            for (size_t k = 0; k < nIds; k++)
+            {
+                const algorithmFPType value = xValue(i, ids[k]);
+                for (size_t ic = 0; ic < _yDim; ic++)
+                {
+                    localDots[k * _yDim + ic] += value * ri[ic];
+                }
+            }
+        }
+    });
+    DAAL_CHECK_SAFE_STATUS();
+
+    if (nDots) tlsDots.reduceTo(dots, nDots);
+    return Status();
+}
+
+/**
+ *  \brief Minimizes the mean squared error objective function with the block coordinate descent,
+ *         the argument b of size (nFeatures + 1) x nDependentVariables is updated in place
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeMSEBlocks(mse::Batch<algorithmFPType> * mseFunction, algorithmFPType * b, size_t nTheta, size_t yDim,
+                                  const Parameter * parameter, size_t & nSweeps)
+{
+    NumericTable * dataNT               = mseFunction->input.get(mse::data).get();
+    NumericTable * dependentVariablesNT = mseFunction->input.get(mse::dependentVariables).get();
+    DAAL_CHECK(dataNT && dependentVariablesNT, ErrorNullInputNumericTable);
+
+    const size_t nRows     = dataNT->getNumberOfRows();
+    const size_t nFeatures = dataNT->getNumberOfColumns();
+    DAAL_CHECK(nFeatures + 1 == nTheta, ErrorIncorrectNumberOfRows);
+    DAAL_CHECK(dependentVariablesNT->getNumberOfColumns() == yDim && dependentVariablesNT->getNumberOfRows() == nRows,
+               ErrorIncorrectSizeOfInputNumericTable);
+
+    const mse::Parameter & mseParameter   = mseFunction->parameter();
+    algorithmFPType penalties[2]          = { 0, 0 };
+    const NumericTable * penaltyTables[2] = { mseParameter.penaltyL1.get(), mseParameter.penaltyL2.get() };
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (!penaltyTables[i]) continue;
+        ReadRows<algorithmFPType, cpu> penaltyBD(const_cast<NumericTable *>(penaltyTables[i]), 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(penaltyBD);
+        penalties[i] = penaltyBD.get()[0];
+    }
+
+    ReadRows<algorithmFPType, cpu> xBD(dataNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBD);
+    ReadRows<algorithmFPType, cpu> yBD(dependentVariablesNT, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBD);
+
+    MSEBlockTask<algorithmFPType, cpu> task(xBD.get(), yBD.get(), b, nRows, nFeatures, yDim, mseParameter.interceptFlag, penalties[0], penalties[1],
+                                            parameter->positive);
+    return task.compute(parameter, nSweeps);
+}
+
+} // namespace internal
+} // namespace coordinate_descent
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
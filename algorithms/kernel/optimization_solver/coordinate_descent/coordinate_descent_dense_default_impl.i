@@ -32,6 +32,7 @@
 #include "algorithms/kernel/optimization_solver/iterative_solver_kernel.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "algorithms/optimization_solver/coordinate_descent/coordinate_descent_types.h"
+#include "algorithms/kernel/optimization_solver/coordinate_descent/coordinate_descent_dense_block_impl.i"
 
 namespace daal
 {
@@ -78,6 +79,18 @@ services::Status CoordinateDescentKernel<algorithmFPType, method, cpu>::compute(
                                                          nRowsArgument * nColsArgument * sizeof(algorithmFPType));
     DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
 
+    if (parameter->featureBlockSize > 1 || parameter->screening)
+    {
+        mse::Batch<algorithmFPType> * mseFunction = dynamic_cast<mse::Batch<algorithmFPType> *>(parameter->function.get());
+        if (mseFunction)
+        {
+            size_t nSweeps = 0;
+            s              = computeMSEBlocks<algorithmFPType, cpu>(mseFunction, workValue, nRowsArgument, nColsArgument, parameter, nSweeps);
+            *nIter         = nSweeps;
+            return s;
+        }
+    }
+
     sum_of_functions::BatchPtr gradientHessianFunction = parameter->function->clone();
     const size_t maxIterations                         = parameter->nIterations;
 
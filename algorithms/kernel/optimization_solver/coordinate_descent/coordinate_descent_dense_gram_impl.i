@@ -0,0 +1,222 @@
+/* file: coordinate_descent_dense_gram_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the coordinate descent over the Gram matrix for the mean squared error objective function
+//--
+*/
+
+#ifndef __COORDINATE_DESCENT_DENSE_GRAM_IMPL_I__
+#define __COORDINATE_DESCENT_DENSE_GRAM_IMPL_I__
+
+#include "externals/service_blas.h"
+#include "externals/service_math.h"
+#include "externals/service_memory.h"
+#include "service/kernel/service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace coordinate_descent
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services;
+
+/*
+    Coordinate descent for the mean squared error with L1 and L2 penalties that uses the Gram matrix G = X^T * X
+    and the products c = X^T * y instead of the data. The products q = G * b are updated together with the coordinates,
+    so that x_j^T * r = c_j - q_j:
+        b_j = S(h_j * b_j + (c_j - q_j) / n, l1) / (h_j + l2),  h_j = G_jj / n.
+    One update costs O(p) operations, the Gram matrix is computed once and reused for all penalties of the regularization path.
+
+    The coordinates of the previous solution of the path are used as a warm start. The sequential strong rule discards
+    the zero coordinates with |c_j - q_j| / n < 2 * l1 - l1Prev before the descent, where l1Prev is the previous penalty of the path
+    or max_j |c_j - q_j| / n for the first one. The discarded coordinates that violate the optimality condition
+    are returned to the working set.
+*/
+template <typename algorithmFPType, CpuType cpu>
+class GramTask
+{
+public:
+    /* G is the p x p Gram matrix, c is the p x k matrix of the products X^T * y, n is the number of observations */
+    GramTask(const algorithmFPType * G, const algorithmFPType * c, size_t p, size_t k, size_t n) : _G(G), _c(c), _p(p), _k(k), _n(n) {}
+
+    /* Minimizes the objective function for the given penalties starting from b, the p x k matrix b is updated in place */
+    services::Status compute(algorithmFPType * b, algorithmFPType l1, algorithmFPType l2, algorithmFPType l1Prev, size_t nIterations,
+                             algorithmFPType accuracyThreshold, size_t & nSweeps)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _p, _k);
+        TArray<algorithmFPType, cpu> qT(_p * _k);
+        TArray<size_t, cpu> workingT(_p);
+        TArray<size_t, cpu> screenedT(_p);
+        algorithmFPType * q = qT.get();
+        size_t * working    = workingT.get();
+        size_t * screened   = screenedT.get();
+        DAAL_CHECK_MALLOC(q && working && screened);
+
+        /* q = G * b, G is symmetric so the row-major b is the column-major b^T */
+        {
+            char notrans         = 'N';
+            algorithmFPType one  = algorithmFPType(1);
+            algorithmFPType zero = algorithmFPType(0);
+            DAAL_INT pInt        = (DAAL_INT)_p;
+            DAAL_INT kInt        = (DAAL_INT)_k;
+            Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &kInt, &pInt, &pInt, &one, b, &kInt, _G, &pInt, &zero, q, &kInt);
+        }
+
+        const algorithmFPType inverseN = algorithmFPType(1) / algorithmFPType(_n);
+        if (l1Prev <= 0)
+        {
+            for (size_t i = 0; i < _p * _k; i++)
+            {
+                const algorithmFPType value = Math<algorithmFPType, cpu>::sFabs(_c[i] - q[i]) * inverseN;
+                l1Prev                      = value > l1Prev ? value : l1Prev;
+            }
+        }
+        const algorithmFPType threshold = algorithmFPType(2) * l1 - l1Prev;
+
+        size_t nWorking  = 0;
+        size_t nScreened = 0;
+        for (size_t j = 0; j < _p; j++)
+        {
+            bool keep = (l1 <= 0);
+            for (size_t ic = 0; ic < _k && !keep; ic++)
+            {
+                keep = (b[j * _k + ic] != 0) || (Math<algorithmFPType, cpu>::sFabs(_c[j * _k + ic] - q[j * _k + ic]) * inverseN >= threshold);
+            }
+            if (keep)
+            {
+                working[nWorking++] = j;
+            }
+            else
+            {
+                screened[nScreened++] = j;
+            }
+        }
+
+        nSweeps = 0;
+        for (;;)
+        {
+            while (nSweeps < nIterations)
+            {
+                algorithmFPType maxDiff  = 0;
+                algorithmFPType maxValue = 0;
+                for (size_t w = 0; w < nWorking; w++)
+                {
+                    const size_t j          = working[w];
+                    const algorithmFPType h = _G[j * _p + j] * inverseN;
+                    if (h == 0) continue;
+
+                    const algorithmFPType * Gj = _G + j * _p;
+                    for (size_t ic = 0; ic < _k; ic++)
+                    {
+                        const algorithmFPType prev     = b[j * _k + ic];
+                        const algorithmFPType z        = h * prev + (_c[j * _k + ic] - q[j * _k + ic]) * inverseN;
+                        const algorithmFPType shrinked = (z > l1) ? z - l1 : ((z < -l1) ? z + l1 : algorithmFPType(0));
+                        const algorithmFPType value    = shrinked / (h + l2);
+                        const algorithmFPType delta    = value - prev;
+                        b[j * _k + ic]                 = value;
+
+                        if (delta != 0)
+                        {
+                            PRAGMA_IVDEP
+                            PRAGMA_VECTOR_ALWAYS
+                            for (size_t l = 0; l < _p; l++)
+                            {
+                                q[l * _k + ic] += Gj[l] * delta;
+                            }
+                        }
+
+                        const algorithmFPType diff         = Math<algorithmFPType, cpu>::sFabs(delta);
+                        const algorithmFPType maxValueCurr = Math<algorithmFPType, cpu>::sFabs(value);
+                        maxDiff                            = diff > maxDiff ? diff : maxDiff;
+                        maxValue                           = maxValueCurr > maxValue ? maxValueCurr : maxValue;
+                    }
+                }
+                nSweeps++;
+                if (maxDiff <= accuracyThreshold * maxValue) break;
+            }
+            if (!nScreened || nSweeps >= nIterations) break;
+
+            /* Optimality check of the discarded coordinates */
+            const size_t nWorkingPrev = nWorking;
+            size_t nStillScreened     = 0;
+            for (size_t t = 0; t < nScreened; t++)
+            {
+                const size_t j = screened[t];
+                bool isOptimal = true;
+                for (size_t ic = 0; ic < _k && isOptimal; ic++)
+                {
+                    isOptimal = Math<algorithmFPType, cpu>::sFabs(_c[j * _k + ic] - q[j * _k + ic]) * inverseN <= l1;
+                }
+                if (isOptimal)
+                {
+                    screened[nStillScreened++] = j;
+                }
+                else
+                {
+                    working[nWorking++] = j;
+                }
+            }
+            nScreened = nStillScreened;
+            if (nWorking == nWorkingPrev) break;
+        }
+        return services::Status();
+    }
+
+private:
+    const algorithmFPType * _G;
+    const algorithmFPType * _c;
+    const size_t _p;
+    const size_t _k;
+    const size_t _n;
+};
+
+/**
+ *  \brief Computes the Gram matrix G = X^T * X of size p x p and the products c = X^T * Y of size p x k
+ *         for the row-major data X of size n x p and the row-major dependent variables Y of size n x k
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeGram(const algorithmFPType * X, const algorithmFPType * Y, size_t n, size_t p, size_t k, algorithmFPType * G,
+                       algorithmFPType * c)
+{
+    char notrans         = 'N';
+    char trans           = 'T';
+    algorithmFPType one  = algorithmFPType(1);
+    algorithmFPType zero = algorithmFPType(0);
+    DAAL_INT nInt        = (DAAL_INT)n;
+    DAAL_INT pInt        = (DAAL_INT)p;
+    DAAL_INT kInt        = (DAAL_INT)k;
+
+    /* Row-major X is the column-major X^T, G = X^T * X and c^T = Y^T * X in the column-major layout */
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &pInt, &pInt, &nInt, &one, X, &pInt, X, &pInt, &zero, G, &pInt);
+    Blas<algorithmFPType, cpu>::xgemm(&notrans, &trans, &kInt, &pInt, &nInt, &one, Y, &kInt, X, &pInt, &zero, c, &kInt);
+}
+
+} // namespace internal
+} // namespace coordinate_descent
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
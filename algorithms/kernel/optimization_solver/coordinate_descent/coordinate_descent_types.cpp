@@ -45,7 +45,9 @@ Parameter::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterat
       engine(engines::mt19937::Batch<>::create()),
       selection(cyclic),
       positive(false),
-      skipTheFirstComponents(false)
+      skipTheFirstComponents(false),
+      featureBlockSize(1),
+      screening(false)
 {}
 
 services::Status Parameter::check() const
@@ -56,6 +58,8 @@ services::Status Parameter::check() const
     if (batchSize > function->sumOfFunctionsParameter->numberOfTerms || batchSize == 0)
         return services::Status(services::Error::create(services::ErrorIncorrectParameter, services::ArgumentName, batchSizeStr()));
 
+    DAAL_CHECK_EX(featureBlockSize != 0, services::ErrorIncorrectParameter, services::ArgumentName, "featureBlockSize");
+
     return s;
 }
 
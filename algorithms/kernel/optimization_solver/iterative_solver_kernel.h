@@ -157,6 +157,66 @@ public:
         return safeStat.detach();
     }
 
+    /* Computes the norms of two vectors of the same size in one pass */
+    static services::Status vectorNorms(const algorithmFPType * vec1, const algorithmFPType * vec2, size_t nElements, algorithmFPType & res1,
+                                        algorithmFPType & res2, size_t minRowsNumInBlock = 256, size_t blockStartThreshold = 5000)
+    {
+        res1 = 0;
+        res2 = 0;
+        if (nElements < blockStartThreshold)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nElements; j++)
+            {
+                res1 += vec1[j] * vec1[j];
+                res2 += vec2[j] * vec2[j];
+            }
+            res1 = daal::internal::Math<algorithmFPType, cpu>::sSqrt(res1);
+            res2 = daal::internal::Math<algorithmFPType, cpu>::sSqrt(res2);
+            return services::Status();
+        }
+        daal::tls<algorithmFPType *> normTls([=]() -> algorithmFPType * {
+            algorithmFPType * normPtr =
+                (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(2 * sizeof(algorithmFPType));
+            DAAL_CHECK_STATUS_VAR(normPtr)
+            normPtr[0] = 0;
+            normPtr[1] = 0;
+            return normPtr;
+        });
+
+        SafeStatus safeStat;
+        processByBlocks<cpu>(
+            nElements,
+            [=, &normTls, &safeStat](size_t startOffset, size_t nRowsInBlock) {
+                algorithmFPType * normPtr = normTls.local();
+                DAAL_CHECK_THR(normPtr, services::ErrorMemoryAllocationFailed);
+                const algorithmFPType * vec1Local = &vec1[startOffset];
+                const algorithmFPType * vec2Local = &vec2[startOffset];
+                algorithmFPType norm1             = 0;
+                algorithmFPType norm2             = 0;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nRowsInBlock; j++)
+                {
+                    norm1 += vec1Local[j] * vec1Local[j];
+                    norm2 += vec2Local[j] * vec2Local[j];
+                }
+                normPtr[0] += norm1;
+                normPtr[1] += norm2;
+            },
+            minRowsNumInBlock, blockStartThreshold);
+
+        normTls.reduce([=, &res1, &res2](algorithmFPType * normPtr) -> void {
+            if (!normPtr) return;
+            res1 += normPtr[0];
+            res2 += normPtr[1];
+            daal_free(normPtr);
+        });
+        res1 = daal::internal::Math<algorithmFPType, cpu>::sSqrt(res1);
+        res2 = daal::internal::Math<algorithmFPType, cpu>::sSqrt(res2);
+        return safeStat.detach();
+    }
+
     static services::Status getRandom(int minVal, int maxVal, int * randomValue, int nRandomValues, engines::BatchBase & engine)
     {
         return distributions::uniform::internal::UniformKernel<int, distributions::uniform::defaultDense, cpu>::compute(minVal, maxVal, engine,
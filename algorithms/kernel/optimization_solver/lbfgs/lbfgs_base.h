@@ -179,10 +179,20 @@ private:
                               daal::algorithms::engines::internal::BatchBaseImpl * engine);
 
     /*
-    * Two-loop recursion algorithm that computes approximation of inverse Hessian matrix
-    * multiplied by input gradient vector from a set of correction pairs (s(j), y(j)), j = 1,...,m.
+    * Computes approximation of inverse Hessian matrix multiplied by input gradient vector
+    * from a set of correction pairs (s(j), y(j)), j = 1,...,m, using the compact representation of L-BFGS matrices
     */
-    void twoLoopRecursion(size_t m, size_t correctionIndex, algorithmFPType * gradient);
+    void computeInverseHessianProduct(size_t m, size_t correctionIndex, algorithmFPType * gradient);
+
+    /*
+    * Updates the inner products of the correction pair with the given index and all the correction pairs
+    */
+    void updateInnerProducts(size_t correctionIndex);
+
+    /*
+    * Allocates the inner products of the correction pairs and computes them for the initial correction pairs
+    */
+    Status initInnerProducts(size_t m);
 
 public:
     bool continueLineSearch;
@@ -225,7 +235,11 @@ private:
     algorithmFPType * correctionS;      /*!< Array of correction pairs parts s(1), ..., s(m). See formula (2.1) in [1] */
     algorithmFPType * correctionY;      /*!< Array of correction pairs parts y(1), ..., y(m). See formula (2.2) in [1] */
     algorithmFPType * rho;              /*!< Array of parameters rho of BFGS update. See formula (7.17) in [2] */
-    algorithmFPType * alpha;            /*!< Intermediate values used in two-loop recursion. See algorithm 7.4 in [2] */
+    size_t _nCorrectionPairs;                      /*!< Number of correction pairs m */
+    TArray<algorithmFPType, cpu> _innerProductsSY; /*!< Matrix of size m x m with the inner products s(i)^T * y(j) */
+    TArray<algorithmFPType, cpu> _innerProductsYY; /*!< Matrix of size m x m with the inner products y(i)^T * y(j) */
+    TArray<algorithmFPType, cpu> _compactWork;     /*!< Workspace of the compact representation */
+    TArray<size_t, cpu> _pairsOrder;               /*!< Indices of the correction pairs from the oldest to the newest */
     const size_t nStepLength;           /*!< Number of values in the provided step-length sequence */
     const algorithmFPType * stepLength; /*!< Array that stores step-length sequence */
     RNGs _rng;                          /*!< Random number generator */
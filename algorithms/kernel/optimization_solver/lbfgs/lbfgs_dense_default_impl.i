@@ -639,7 +639,7 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument(size_t iIteration, size_t
     if (t >= 2)
     {
         /* Compute H * gradient */
-        twoLoopRecursion(m, correctionIndex, gradient);
+        computeInverseHessianProduct(m, correctionIndex, gradient);
     }
     if (useWolfeConditions)
     {
@@ -732,7 +732,7 @@ Status LBFGSTask<algorithmFPType, cpu>::updateArgument1(size_t iIteration, size_
     if (t >= 2)
     {
         /* Compute H * gradient */
-        twoLoopRecursion(m, correctionIndex, gradient);
+        computeInverseHessianProduct(m, correctionIndex, gradient);
     }
     if (useWolfeConditions)
     {
@@ -806,48 +806,161 @@ Status LBFGSTask<algorithmFPType, cpu>::updateBatchIndices(size_t iPredefinedInd
 }
 
 /**
- * Two-loop recursion algorithm that computes approximation of inverse Hessian matrix
- * multiplied by input gradient vector from a set of correction pairs (s(j), y(j)), j = 1,...,m.
+ * Computes approximation of inverse Hessian matrix multiplied by input gradient vector
+ * from a set of correction pairs (s(j), y(j)), j = 1,...,m.
  *
- * See Algorithm 7.4 in [2].
+ * Uses the compact representation of L-BFGS matrices (R. H. Byrd, J. Nocedal, R. B. Schnabel,
+ * Representations of quasi-Newton matrices and their use in limited memory methods, 1994):
+ *     H * g = g + S * p - Y * u,  u = R^(-1) * S^T * g,  p = R^(-T) * ((D + Y^T * Y) * u - Y^T * g),
+ * where R is the upper triangle of S^T * Y and D is its diagonal. The result is the same as the one of
+ * the two-loop recursion (see Algorithm 7.4 in [2]), but the products with S and Y are computed with BLAS
+ * and the inner products S^T * Y and Y^T * Y are updated once per new correction pair.
  *
  * \param[in]  m               Number of correction pairs
  * \param[in]  correctionIndex Index of starting correction pair in a cyclic buffer
  * \param[in,out] gradient     On input:  Gradient vector.
- *                             On output: iterative_solver::Result of two-loop recursion.
+ *                             On output: Product of the inverse Hessian approximation and the gradient.
  */
 template <typename algorithmFPType, CpuType cpu>
-void LBFGSTask<algorithmFPType, cpu>::twoLoopRecursion(size_t m, size_t correctionIndex, algorithmFPType * gradient)
+void LBFGSTask<algorithmFPType, cpu>::computeInverseHessianProduct(size_t m, size_t correctionIndex, algorithmFPType * gradient)
 {
-    for (size_t k = 0; k < m; k++)
+    const algorithmFPType * sy = _innerProductsSY.get();
+    const algorithmFPType * yy = _innerProductsYY.get();
+    size_t * order             = _pairsOrder.get();
+
+    algorithmFPType * stg   = _compactWork.get(); /* S^T * g */
+    algorithmFPType * ytg   = stg + m;            /* Y^T * g */
+    algorithmFPType * u     = ytg + m;
+    algorithmFPType * p     = u + m;
+    algorithmFPType * coefS = p + m;
+    algorithmFPType * coefY = coefS + m;
+
+    /* Correction pairs from the oldest to the newest. The pairs with s^T * y = 0 do not change the product */
+    size_t k = 0;
+    for (size_t i = 0; i < m; i++)
     {
-        const size_t index                     = mod(correctionIndex + m - 1 - k, m);
-        const algorithmFPType * correctionSPtr = correctionS + index * this->argumentSize;
-        const algorithmFPType * correctionYPtr = correctionY + index * this->argumentSize;
+        const size_t index = mod(correctionIndex + i, m);
+        if (rho[index] != 0.0) order[k++] = index;
+    }
+    if (!k) return;
 
-        alpha[index] = rho[index] * dotProduct<algorithmFPType, cpu>(this->argumentSize, correctionSPtr, gradient);
+    char notrans         = 'N';
+    char trans           = 'T';
+    algorithmFPType zero = 0.0;
+    algorithmFPType one  = 1.0;
+    DAAL_INT n           = (DAAL_INT)(this->argumentSize);
+    DAAL_INT nPairs      = (DAAL_INT)m;
+    DAAL_INT ione        = 1;
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nPairs, &one, correctionS, &n, gradient, &ione, &zero, stg, &ione);
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nPairs, &one, correctionY, &n, gradient, &ione, &zero, ytg, &ione);
 
-        for (size_t j = 0; j < this->argumentSize; j++)
+    /* u = R^(-1) * S^T * g, R(i, j) = s(i)^T * y(j) for i <= j, R(i, i) = 1 / rho(i) */
+    for (size_t i = k; i-- > 0;)
+    {
+        algorithmFPType sum = stg[order[i]];
+        for (size_t j = i + 1; j < k; j++)
         {
-            gradient[j] -= alpha[index] * correctionYPtr[j];
+            sum -= sy[order[i] * m + order[j]] * u[j];
         }
+        u[i] = sum * rho[order[i]];
     }
 
-    for (size_t k = 0; k < m; k++)
+    /* p = R^(-T) * ((D + Y^T * Y) * u - Y^T * g) */
+    for (size_t i = 0; i < k; i++)
     {
-        const size_t index                     = mod(correctionIndex + k, m);
-        const algorithmFPType * correctionSPtr = correctionS + index * this->argumentSize;
-        const algorithmFPType * correctionYPtr = correctionY + index * this->argumentSize;
-
-        algorithmFPType beta = rho[index] * dotProduct<algorithmFPType, cpu>(this->argumentSize, correctionYPtr, gradient);
-
-        for (size_t j = 0; j < this->argumentSize; j++)
+        algorithmFPType sum = u[i] / rho[order[i]] - ytg[order[i]];
+        for (size_t j = 0; j < k; j++)
         {
-            gradient[j] += correctionSPtr[j] * (alpha[index] - beta);
+            sum += yy[order[i] * m + order[j]] * u[j];
         }
+        for (size_t j = 0; j < i; j++)
+        {
+            sum -= sy[order[j] * m + order[i]] * p[j];
+        }
+        p[i] = sum * rho[order[i]];
+    }
+
+    /* g = g + S * p - Y * u */
+    daal::services::internal::service_memset_seq<algorithmFPType, cpu>(coefS, zero, 2 * m);
+    for (size_t i = 0; i < k; i++)
+    {
+        coefS[order[i]] = p[i];
+        coefY[order[i]] = -u[i];
+    }
+    Blas<algorithmFPType, cpu>::xgemv(&notrans, &n, &nPairs, &one, correctionS, &n, coefS, &ione, &one, gradient, &ione);
+    Blas<algorithmFPType, cpu>::xgemv(&notrans, &n, &nPairs, &one, correctionY, &n, coefY, &ione, &one, gradient, &ione);
+}
+
+/**
+ * Updates the inner products s(i)^T * y(j) and y(i)^T * y(j) of the correction pair
+ * with the given index and all the stored correction pairs
+ *
+ * \param[in] correctionIndex  Index of the changed correction pair
+ */
+template <typename algorithmFPType, CpuType cpu>
+void LBFGSTask<algorithmFPType, cpu>::updateInnerProducts(size_t correctionIndex)
+{
+    const size_t m            = _nCorrectionPairs;
+    algorithmFPType * sy      = _innerProductsSY.get();
+    algorithmFPType * yy      = _innerProductsYY.get();
+    algorithmFPType * work    = _compactWork.get();
+    const algorithmFPType * s = correctionS + correctionIndex * this->argumentSize;
+    const algorithmFPType * y = correctionY + correctionIndex * this->argumentSize;
+
+    char trans           = 'T';
+    algorithmFPType zero = 0.0;
+    algorithmFPType one  = 1.0;
+    DAAL_INT n           = (DAAL_INT)(this->argumentSize);
+    DAAL_INT nPairs      = (DAAL_INT)m;
+    DAAL_INT ione        = 1;
+
+    /* Column correctionIndex of S^T * Y */
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nPairs, &one, correctionS, &n, y, &ione, &zero, work, &ione);
+    for (size_t i = 0; i < m; i++)
+    {
+        sy[i * m + correctionIndex] = work[i];
+    }
+
+    /* Row correctionIndex of S^T * Y */
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nPairs, &one, correctionY, &n, s, &ione, &zero, work, &ione);
+    for (size_t j = 0; j < m; j++)
+    {
+        sy[correctionIndex * m + j] = work[j];
+    }
+
+    /* Row and column correctionIndex of Y^T * Y */
+    Blas<algorithmFPType, cpu>::xgemv(&trans, &n, &nPairs, &one, correctionY, &n, y, &ione, &zero, work, &ione);
+    for (size_t i = 0; i < m; i++)
+    {
+        yy[i * m + correctionIndex] = work[i];
+        yy[correctionIndex * m + i] = work[i];
     }
 }
 
+/**
+ * Allocates the inner products of the correction pairs and the workspace of the compact representation
+ * and computes the inner products of the initial correction pairs
+ *
+ * \param[in] m  Number of correction pairs
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status LBFGSTask<algorithmFPType, cpu>::initInnerProducts(size_t m)
+{
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, m, m);
+    _nCorrectionPairs = m;
+    _innerProductsSY.reset(m * m);
+    _innerProductsYY.reset(m * m);
+    _compactWork.reset(6 * m);
+    _pairsOrder.reset(m);
+    DAAL_CHECK_MALLOC(_innerProductsSY.get() && _innerProductsYY.get() && _compactWork.get() && _pairsOrder.get());
+
+    for (size_t i = 0; i < m; i++)
+    {
+        updateInnerProducts(i);
+    }
+    return Status();
+}
+
 /**
 * Computes the correction pair (s, y) and the corresponding value rho
 *
@@ -916,6 +1029,7 @@ void LBFGSTask<algorithmFPType, cpu>::computeCorrectionPairImpl(size_t correctio
     {
         rho[correctionIndex] = 1.0 / rho[correctionIndex];
     }
+    updateInnerProducts(correctionIndex);
 }
 
 /**
@@ -1034,11 +1148,10 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
     /* Initialize work value with a start value provided by user */
     DAAL_CHECK_STATUS(s, this->setStartArgument(inputArgument));
     DAAL_CHECK_STATUS(s, initArgumentL(averageArgLIterInput, averageArgLIterResult, parameter));
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->m, sizeof(algorithmFPType));
-    alpha = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->m * sizeof(algorithmFPType));
-    DAAL_CHECK_MALLOC(argumentLCur && argumentLPrev && alpha);
+    DAAL_CHECK_MALLOC(argumentLCur && argumentLPrev);
 
     DAAL_CHECK_STATUS(s, initCorrectionPairs(correctionPairsInput, parameter, correctionPairsResult));
+    DAAL_CHECK_STATUS(s, initInnerProducts(parameter->m));
 
     /* Get step-length sequence */
     DAAL_CHECK_BLOCK_STATUS(mtStepLength);
@@ -1084,11 +1197,10 @@ Status LBFGSTask<algorithmFPType, cpu>::init(NumericTable * inputArgument, Numer
     /* Initialize work value with a start value provided by user */
     DAAL_CHECK_STATUS(s, this->setStartArgument(inputArgument));
     DAAL_CHECK_STATUS(s, initArgumentL(averageArgLIterInput, averageArgLIterResult, parameter));
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, parameter->m, sizeof(algorithmFPType));
-    alpha = (algorithmFPType *)daal::services::internal::service_calloc<algorithmFPType, cpu>(parameter->m * sizeof(algorithmFPType));
-    DAAL_CHECK_MALLOC(argumentLCur && argumentLPrev && alpha);
+    DAAL_CHECK_MALLOC(argumentLCur && argumentLPrev);
 
     DAAL_CHECK_STATUS(s, initCorrectionPairs(correctionPairsInput, parameter, correctionPairsResult));
+    DAAL_CHECK_STATUS(s, initInnerProducts(parameter->m));
 
     /* Get step-length sequence */
     DAAL_CHECK_BLOCK_STATUS(mtStepLength);
@@ -1141,11 +1253,6 @@ LBFGSTask<algorithmFPType, cpu>::~LBFGSTask()
         daal_free(rho);
         rho = nullptr;
     }
-    if (alpha)
-    {
-        daal_free(alpha);
-        alpha = nullptr;
-    }
     if (correctionPairs)
     {
         correctionPairs->releaseBlockOfRows(correctionPairsBD);
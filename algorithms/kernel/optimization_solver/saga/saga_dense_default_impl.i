@@ -32,6 +32,7 @@
 #include "algorithms/kernel/optimization_solver/iterative_solver_kernel.h"
 #include "algorithms/optimization_solver/iterative_solver/iterative_solver_types.h"
 #include "algorithms/optimization_solver/saga/saga_types.h"
+#include "algorithms/optimization_solver/objective_function/logistic_loss_batch.h"
 
 namespace daal
 {
@@ -47,6 +48,250 @@ using namespace daal::internal;
 using namespace daal::services;
 using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
 
+/**
+ *  \brief Saga with just-in-time (lazy) updates for the logistic loss objective function on CSR data.
+ *
+ *  The gradient of a term of the logistic loss is d(i) * x(i) plus the regularization, so only the scalar d(i) is stored
+ *  for each term instead of the full gradient. The coordinates not present in the sampled row change on each step only by
+ *  the constant average gradient, the L2 shrinkage and the L1 soft thresholding. These steps are accumulated and applied
+ *  in closed form when the coordinate is accessed, so each step costs O(number of non-zeros in the row).
+ *  The L2 term is used with its exact gradient and is not variance-reduced. Supported are the constant step length
+ *  and either of the L1 and L2 penalties
+ */
+template <typename algorithmFPType, CpuType cpu>
+class LazyLogLossSaga
+{
+public:
+    LazyLogLossSaga(algorithmFPType * w, size_t p, size_t n, bool interceptFlag, algorithmFPType stepLength, algorithmFPType penaltyL1,
+                    algorithmFPType penaltyL2)
+        : _w(w),
+          _p(p),
+          _n(n),
+          _interceptFlag(interceptFlag),
+          _stepLength(stepLength),
+          _tau(stepLength * penaltyL1),
+          _shrink(algorithmFPType(1) - algorithmFPType(2) * stepLength * penaltyL2),
+          _invN(algorithmFPType(1) / algorithmFPType(n))
+    {}
+
+    services::Status run(HostAppIface * pHost, CSRNumericTableIface * dataTable, NumericTable * dependentVariables, size_t maxIterations,
+                         algorithmFPType tolerance, NumericTable * batchIndicesNT, RngTask<int, cpu> & rngTask, size_t & nIterationsPerformed);
+
+    /* Returns true if the problem can be solved with lazy updates */
+    static bool isSupported(algorithmFPType penaltyL1, algorithmFPType penaltyL2) { return penaltyL1 == 0 || penaltyL2 == 0; }
+
+private:
+    /* Applies the steps of the iterations [_last[k], iIteration) to the coordinate k not present in the sampled rows */
+    void catchUp(size_t k, size_t iIteration)
+    {
+        const size_t t = iIteration - _last[k];
+        if (t)
+        {
+            _w[k + 1] = applySteps(_w[k + 1], _stepLength * _sum[k + 1] * _invN, t);
+            _last[k]  = iIteration;
+        }
+    }
+
+    /* Single step z <- S_tau(shrink * z - c) */
+    algorithmFPType applyStep(algorithmFPType z, algorithmFPType c) const
+    {
+        const algorithmFPType u = _shrink * z - c;
+        return (u > _tau ? u - _tau : (u < -_tau ? u + _tau : algorithmFPType(0)));
+    }
+
+    /* t steps z <- S_tau(shrink * z - c) in closed form, either tau or 1 - shrink is zero */
+    algorithmFPType applySteps(algorithmFPType z, algorithmFPType c, size_t t) const
+    {
+        if (_tau == 0)
+        {
+            if (_shrink == 1) return z - algorithmFPType(t) * c;
+            /* shrink^t * z - c * (1 + shrink + ... + shrink^(t-1)) */
+            algorithmFPType power = 1;
+            algorithmFPType base  = _shrink;
+            for (size_t e = t; e; e >>= 1, base *= base)
+            {
+                if (e & 1) power *= base;
+            }
+            return power * z - c * (algorithmFPType(1) - power) / (algorithmFPType(1) - _shrink);
+        }
+
+        /* Soft thresholding with the constant shift: z moves linearly while it keeps the sign, zero is absorbing if |c| <= tau */
+        while (t)
+        {
+            const algorithmFPType u = z - c;
+            if (u > _tau || u < -_tau)
+            {
+                const algorithmFPType step = (u > _tau ? c + _tau : c - _tau);
+                const algorithmFPType dist = (u > _tau ? u - _tau : -_tau - u);
+                if ((u > _tau) == (step <= 0)) return z - algorithmFPType(t) * step;
+                const algorithmFPType nSteps = dist / daal::internal::Math<algorithmFPType, cpu>::sFabs(step);
+                const size_t k               = (nSteps >= algorithmFPType(t)) ? t : size_t(nSteps) + 1;
+                z -= algorithmFPType(k) * step;
+                t -= k;
+            }
+            else
+            {
+                z = 0;
+                --t;
+                if (daal::internal::Math<algorithmFPType, cpu>::sFabs(c) <= _tau) break;
+            }
+        }
+        return z;
+    }
+
+    bool isChanged(algorithmFPType prev, algorithmFPType cur, algorithmFPType tolerance) const
+    {
+        return daal::internal::Math<algorithmFPType, cpu>::sFabs(prev - cur)
+               >= tolerance * daal::internal::Math<algorithmFPType, cpu>::sMax(1, daal::internal::Math<algorithmFPType, cpu>::sFabs(cur));
+    }
+
+    algorithmFPType * _w; /* Argument of size p + 1, the intercept is the first element */
+    const size_t _p;
+    const size_t _n;
+    const bool _interceptFlag;
+    const algorithmFPType _stepLength;
+    const algorithmFPType _tau;
+    const algorithmFPType _shrink;
+    const algorithmFPType _invN;
+    TArray<algorithmFPType, cpu> _sum; /* Sum of the loss gradients of all the terms */
+    TArray<size_t, cpu> _last;         /* Number of the iterations already applied to each coordinate */
+};
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status LazyLogLossSaga<algorithmFPType, cpu>::run(HostAppIface * pHost, CSRNumericTableIface * dataTable, NumericTable * dependentVariables,
+                                                             size_t maxIterations, algorithmFPType tolerance, NumericTable * batchIndicesNT,
+                                                             RngTask<int, cpu> & rngTask, size_t & nIterationsPerformed)
+{
+    services::Status s;
+    nIterationsPerformed = 0;
+
+    ReadRowsCSR<algorithmFPType, cpu> dataRows(dataTable, 0, _n);
+    DAAL_CHECK_BLOCK_STATUS(dataRows);
+    const algorithmFPType * values = dataRows.values();
+    const size_t * cols            = dataRows.cols();
+    const size_t * rowOffsets      = dataRows.rows();
+
+    ReadRows<algorithmFPType, cpu> yRows(dependentVariables, 0, _n);
+    DAAL_CHECK_BLOCK_STATUS(yRows);
+    const algorithmFPType * y = yRows.get();
+
+    ReadRows<int, cpu> batchIndicesRows;
+    if (batchIndicesNT)
+    {
+        batchIndicesRows.set(batchIndicesNT, 0, batchIndicesNT->getNumberOfRows());
+        DAAL_CHECK_BLOCK_STATUS(batchIndicesRows);
+    }
+
+    TArray<algorithmFPType, cpu> savedDerivativesArr(_n);
+    _sum.reset(_p + 1);
+    _last.reset(_p);
+    DAAL_CHECK_MALLOC(savedDerivativesArr.get() && _sum.get() && _last.get());
+    algorithmFPType * savedDerivatives = savedDerivativesArr.get();
+    algorithmFPType * sum              = _sum.get();
+    size_t * last                      = _last.get();
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sum, algorithmFPType(0), _p + 1);
+    daal::services::internal::service_memset<size_t, cpu>(last, size_t(0), _p);
+
+    const algorithmFPType intercept = _interceptFlag ? algorithmFPType(1) : algorithmFPType(0);
+
+    /* Loss derivative of the i-th term at the current argument, all the coordinates of the row are up to date */
+    auto derivative = [&](size_t i) -> algorithmFPType {
+        algorithmFPType f = intercept * _w[0];
+        for (size_t jj = rowOffsets[i] - 1; jj < rowOffsets[i + 1] - 1; jj++)
+        {
+            f += values[jj] * _w[cols[jj]];
+        }
+        f = -f;
+        daal::internal::Math<algorithmFPType, cpu>::vExp(1, &f, &f);
+        return algorithmFPType(1) / (algorithmFPType(1) + f) - y[i];
+    };
+
+    /* Initial derivatives of all the terms and their sum */
+    for (size_t i = 0; i < _n; i++)
+    {
+        savedDerivatives[i] = derivative(i);
+        sum[0] += intercept * savedDerivatives[i];
+        for (size_t jj = rowOffsets[i] - 1; jj < rowOffsets[i + 1] - 1; jj++)
+        {
+            sum[cols[jj]] += savedDerivatives[i] * values[jj];
+        }
+    }
+
+    services::internal::HostAppHelper host(pHost, 10);
+    const int * pValues = nullptr;
+    size_t iter         = 0;
+    for (; iter < maxIterations; iter++)
+    {
+        size_t i;
+        if (batchIndicesNT)
+        {
+            i = batchIndicesRows.get()[iter];
+        }
+        else
+        {
+            if (iter % 1024 == 0)
+            {
+                DAAL_CHECK_STATUS(s, rngTask.getWithReplacement(pValues));
+            }
+            i = pValues[iter % 1024];
+        }
+        if (host.isCancelled(s, 1))
+        {
+            nIterationsPerformed = iter;
+            return s;
+        }
+
+        const size_t begin = rowOffsets[i] - 1;
+        const size_t end   = rowOffsets[i + 1] - 1;
+        for (size_t jj = begin; jj < end; jj++)
+        {
+            catchUp(cols[jj] - 1, iter);
+        }
+
+        const algorithmFPType d     = derivative(i);
+        const algorithmFPType delta = d - savedDerivatives[i];
+        savedDerivatives[i]         = d;
+
+        bool continueCheck = false;
+        if (_interceptFlag)
+        {
+            sum[0] += delta;
+            const algorithmFPType prev = _w[0];
+            _w[0] -= _stepLength * (delta + sum[0] * _invN);
+            continueCheck |= isChanged(prev, _w[0], tolerance);
+        }
+        for (size_t jj = begin; jj < end; jj++)
+        {
+            const size_t j             = cols[jj];
+            const algorithmFPType grad = delta * values[jj];
+            sum[j] += grad;
+            const algorithmFPType prev = _w[j];
+            _w[j]                      = applyStep(prev, _stepLength * (grad + sum[j] * _invN));
+            last[j - 1]                = iter + 1;
+            continueCheck |= isChanged(prev, _w[j], tolerance);
+        }
+
+        /* The other coordinates are checked only when the ones of the sampled row have converged */
+        for (size_t k = 0; k < _p && !continueCheck; k++)
+        {
+            if (last[k] > iter) continue;
+            catchUp(k, iter);
+            const algorithmFPType prev = _w[k + 1];
+            _w[k + 1]                  = applyStep(prev, _stepLength * sum[k + 1] * _invN);
+            last[k]                    = iter + 1;
+            continueCheck |= isChanged(prev, _w[k + 1], tolerance);
+        }
+        if (!continueCheck) break;
+    }
+
+    nIterationsPerformed = (iter < maxIterations ? iter + 1 : maxIterations);
+    for (size_t k = 0; k < _p; k++)
+    {
+        catchUp(k, nIterationsPerformed);
+    }
+    return s;
+}
+
 /**
  *  \Kernel for Saga calculation
  */
@@ -123,6 +368,26 @@ services::Status SagaKernel<algorithmFPType, method, cpu>::compute(HostAppIface
     DAAL_CHECK_MALLOC(rngTask.init(parameter->function->sumOfFunctionsParameter->numberOfTerms, engine));
     const int * pValues = nullptr;
 
+    /* Sparse logistic regression problems are solved with lazy updates without storing the full gradients of the terms */
+    logistic_loss::Batch<algorithmFPType> * logLoss = dynamic_cast<logistic_loss::Batch<algorithmFPType> *>(function.get());
+    if (logLoss && !gradientsTableInput && !gradientsTableResult && learningRateLength <= 1)
+    {
+        CSRNumericTableIface * csrData       = dynamic_cast<CSRNumericTableIface *>(logLoss->input.get(logistic_loss::data).get());
+        const logistic_loss::Parameter & par = logLoss->parameter();
+        if (csrData && LazyLogLossSaga<algorithmFPType, cpu>::isSupported(par.penaltyL1, par.penaltyL2))
+        {
+            const algorithmFPType step = (learningRateLength ? learningRateArray[0] : auto_step);
+            LazyLogLossSaga<algorithmFPType, cpu> lazySaga(workValue, sizeArgument - 1, n, par.interceptFlag, step, par.penaltyL1, par.penaltyL2);
+            s = lazySaga.run(pHost, csrData, logLoss->input.get(logistic_loss::dependentVariables).get(), maxIterations, tolerance,
+                             parameter->batchIndices.get(), rngTask, iterationsPerformed);
+
+            WriteRows<algorithmFPType, cpu> nIterationsPerformed(*nIterations, 0, 1);
+            DAAL_CHECK_BLOCK_STATUS(nIterationsPerformed);
+            *nIterationsPerformed.get() = iterationsPerformed;
+            return s;
+        }
+    }
+
     algorithmFPType * savedGradients;
     TArray<algorithmFPType, cpu> savedGradientsPtr;
     WriteRows<algorithmFPType, cpu> gradientsTableInputPtr;
@@ -28,6 +28,7 @@
 #include "algorithms/kernel/optimization_solver/sgd/sgd_dense_default_kernel.h"
 #include "algorithms/kernel/optimization_solver/sgd/sgd_dense_minibatch_kernel.h"
 #include "algorithms/kernel/optimization_solver/sgd/sgd_dense_momentum_kernel.h"
+#include "algorithms/kernel/optimization_solver/sgd/sgd_dense_asynchronous_kernel.h"
 #include "service/kernel/service_algo_utils.h"
 #include "algorithms/kernel/optimization_solver/sgd/oneapi/sgd_dense_kernel_oneapi.h"
 #include "algorithms/kernel/optimization_solver/sgd/oneapi/sgd_dense_momentum_kernel_oneapi.h"
@@ -101,6 +102,41 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, asynchronous, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::SGDKernel, algorithmFPType, asynchronous);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, asynchronous, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, asynchronous, cpu>::compute()
+{
+    iterative_solver::Input * input     = static_cast<iterative_solver::Input *>(_in);
+    iterative_solver::Result * result   = static_cast<iterative_solver::Result *>(_res);
+    Parameter<asynchronous> * parameter = static_cast<Parameter<asynchronous> *>(_par);
+
+    daal::services::Environment::env & env = *_env;
+
+    NumericTable * inputArgument        = input->get(iterative_solver::inputArgument).get();
+    NumericTable * minimum              = result->get(iterative_solver::minimum).get();
+    NumericTable * nIterations          = result->get(iterative_solver::nIterations).get();
+    OptionalArgument * optionalArgument = input->get(iterative_solver::optionalArgument).get();
+    OptionalArgument * optionalResult   = result->get(iterative_solver::optionalResult).get();
+
+    NumericTable * learningRateSequence = parameter->learningRateSequence.get();
+    NumericTable * batchIndices         = parameter->batchIndices.get();
+
+    __DAAL_CALL_KERNEL(env, internal::SGDKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, asynchronous), compute,
+                       daal::services::internal::hostApp(*input), inputArgument, minimum, nIterations, parameter, learningRateSequence, batchIndices,
+                       optionalArgument, optionalResult, *parameter->engine);
+}
+
 } // namespace interface2
 
 } // namespace sgd
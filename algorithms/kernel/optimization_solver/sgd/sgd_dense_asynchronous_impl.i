@@ -0,0 +1,375 @@
+/* file: sgd_dense_asynchronous_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of asynchronous sgd algorithm
+//--
+*/
+
+#ifndef __SGD_DENSE_ASYNCHRONOUS_IMPL_I__
+#define __SGD_DENSE_ASYNCHRONOUS_IMPL_I__
+
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "externals/service_math.h"
+#include "externals/service_rng.h"
+#include "service/kernel/service_utils.h"
+#include "algorithms/kernel/optimization_solver/iterative_solver_kernel.h"
+#include "algorithms/kernel/engines/engine_types_internal.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/threading/threading.h"
+#include "service/kernel/service_data_utils.h"
+
+using namespace daal::algorithms::optimization_solver::iterative_solver::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+/**
+ *  \brief Kernel for asynchronous SGD calculation.
+ *  Every worker computes the gradients on its own minibatches and adds them to the shared argument
+ *  with the atomic operations, no barrier between the updates of different workers is used.
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::Status SGDKernel<algorithmFPType, asynchronous, cpu>::compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum,
+                                                                        NumericTable * nProceededIterationsNT, Parameter<asynchronous> * parameter,
+                                                                        NumericTable * learningRateSequence, NumericTable * batchIndices,
+                                                                        OptionalArgument * optionalArgument, OptionalArgument * optionalResult,
+                                                                        engines::BatchBase & engine)
+{
+    services::Status s;
+    const size_t nIter = parameter->nIterations;
+
+    /* if nIter == 0, set result as start point, the number of executed iters to 0 */
+    WriteRows<int, cpu, NumericTable> nProceededIterationsBD(*nProceededIterationsNT, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(nProceededIterationsBD);
+    int * nProceededIterations = nProceededIterationsBD.get();
+    if (nIter == 0)
+    {
+        nProceededIterations[0] = 0;
+        return s;
+    }
+
+    sum_of_functions::BatchPtr function = parameter->function;
+    const size_t nTerms                 = function->sumOfFunctionsParameter->numberOfTerms;
+    const size_t argumentSize           = minimum->getNumberOfRows();
+
+    size_t nWorkers = (parameter->nWorkers ? parameter->nWorkers : daal::threader_get_threads_number());
+    if (nWorkers > nIter) nWorkers = nIter;
+
+    size_t startIteration = 0;
+    NumericTable * lastIterationInput =
+        optionalArgument ? NumericTable::cast(optionalArgument->get(iterative_solver::lastIteration)).get() : nullptr;
+    if (lastIterationInput)
+    {
+        ReadRows<int, cpu, NumericTable> lastIterationInputBD(lastIterationInput, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationInputBD);
+        startIteration = lastIterationInputBD.get()[0];
+    }
+
+    ReadRows<int, cpu> predefinedBatchIndicesBD(batchIndices, 0, nIter);
+    ReadRows<algorithmFPType, cpu, NumericTable> learningRateBD(*learningRateSequence, 0, learningRateSequence->getNumberOfRows());
+    DAAL_CHECK_BLOCK_STATUS(learningRateBD);
+
+    SGDAsynchronousTask<algorithmFPType, cpu> task(nIter, parameter->batchSize, nTerms, argumentSize, nWorkers,
+                                                   algorithmFPType(parameter->accuracyThreshold), predefinedBatchIndicesBD.get(),
+                                                   learningRateBD.get(), learningRateSequence->getNumberOfRows(), startIteration);
+    DAAL_CHECK_STATUS(s, task.init(function, inputArgument, engine));
+
+    DAAL_CHECK_STATUS(s, parameter->deterministic ? task.runDeterministic() : task.runAsynchronous());
+
+    size_t nProceededIters = 0;
+    DAAL_CHECK_STATUS(s, task.getResult(minimum, nProceededIters));
+    DAAL_CHECK(nProceededIters <= services::internal::MaxVal<int>::get(), ErrorIterativeSolverIncorrectMaxNumberOfIterations)
+    nProceededIterations[0] = (int)nProceededIters;
+
+    NumericTable * lastIterationResult =
+        optionalResult ? NumericTable::cast(optionalResult->get(iterative_solver::lastIteration)).get() : nullptr;
+    if (lastIterationResult)
+    {
+        WriteRows<int, cpu, NumericTable> lastIterationResultBD(lastIterationResult, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(lastIterationResultBD);
+        lastIterationResultBD.get()[0] = startIteration + nProceededIters;
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+SGDAsynchronousTask<algorithmFPType, cpu>::SGDAsynchronousTask(size_t nIterations_, size_t batchSize_, size_t nTerms_, size_t argumentSize_,
+                                                               size_t nWorkers_, algorithmFPType accuracyThreshold_,
+                                                               const int * predefinedIndices_, const algorithmFPType * learningRateArray_,
+                                                               size_t learningRateLength_, size_t startIteration_)
+    : nIterations(nIterations_),
+      batchSize(batchSize_),
+      nTerms(nTerms_),
+      argumentSize(argumentSize_),
+      nWorkers(nWorkers_),
+      accuracyThreshold(accuracyThreshold_),
+      predefinedIndices(predefinedIndices_),
+      learningRateArray(learningRateArray_),
+      learningRateLength(learningRateLength_),
+      startIteration(startIteration_),
+      indicesStatus(predefinedIndices_ ? user : (batchSize_ < nTerms_ ? random : all)),
+      stopFlag(0)
+{}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::init(const sum_of_functions::BatchPtr & function, NumericTable * inputArgument,
+                                                       engines::BatchBase & engine)
+{
+    Status s;
+    argument = HomogenNumericTableCPU<algorithmFPType, cpu>::create(1, argumentSize, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+    {
+        ReadRows<algorithmFPType, cpu, NumericTable> startValueBD(*inputArgument, 0, argumentSize);
+        DAAL_CHECK_BLOCK_STATUS(startValueBD);
+        int result = daal::services::internal::daal_memcpy_s(argument->getArray(), argumentSize * sizeof(algorithmFPType), startValueBD.get(),
+                                                             argumentSize * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+    }
+
+    workers.reset(nWorkers);
+    DAAL_CHECK_MALLOC(workers.get());
+
+    engines::internal::Params<cpu> params(nWorkers);
+    services::internal::TArray<engines::EnginePtr, cpu> engines(nWorkers);
+    if (indicesStatus == random)
+    {
+        /* Each worker draws batchSize numbers per update from its own stream */
+        const size_t nUpdatesPerWorker = (nIterations + nWorkers - 1) / nWorkers;
+        for (size_t i = 0; i < nWorkers; i++) params.nSkip[i] = i * nUpdatesPerWorker * batchSize;
+
+        auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(&engine);
+        DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+        engines::internal::ParallelizationTechnique techniques[] = { engines::internal::family, engines::internal::leapfrog,
+                                                                     engines::internal::skipahead };
+        engines::internal::ParallelizationTechnique technique    = engines::internal::skipahead;
+        bool isSupported                                         = false;
+        for (auto & t : techniques)
+        {
+            if (engineImpl->hasSupport(t))
+            {
+                technique   = t;
+                isSupported = true;
+                break;
+            }
+        }
+        DAAL_CHECK(isSupported, ErrorEngineNotSupported);
+
+        engines::EnginePtr enginePtr(&engine, EmptyDeleter());
+        engines::internal::EnginesCollection<cpu> enginesCollection(enginePtr, technique, params, engines, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    for (size_t i = 0; i < nWorkers; i++)
+    {
+        SGDAsynchronousWorker<algorithmFPType, cpu> & worker = workers[i];
+        worker.function                                      = function->clone();
+        DAAL_CHECK_MALLOC(worker.function.get());
+        worker.function->sumOfFunctionsInput->set(sum_of_functions::argument, argument);
+
+        if (indicesStatus == user || indicesStatus == random)
+        {
+            worker.ntBatchIndices.reset(new HomogenNumericTableCPU<int, cpu>(NULL, batchSize, 1, s));
+            DAAL_CHECK_MALLOC(worker.ntBatchIndices.get());
+            DAAL_CHECK_STATUS_VAR(s);
+            worker.function->sumOfFunctionsParameter->batchIndices = worker.ntBatchIndices;
+        }
+        else
+        {
+            worker.function->sumOfFunctionsParameter->batchIndices = NumericTablePtr();
+        }
+
+        if (indicesStatus == random)
+        {
+            worker.indices.reset(batchSize);
+            DAAL_CHECK_MALLOC(worker.indices.get());
+            worker.engine = engines[i];
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::computeGradient(SGDAsynchronousWorker<algorithmFPType, cpu> & worker, size_t t)
+{
+    if (indicesStatus == user)
+    {
+        worker.ntBatchIndices->setArray(const_cast<int *>(predefinedIndices + t * batchSize), 1);
+    }
+    else if (indicesStatus == random)
+    {
+        auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(worker.engine.get());
+        DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+        DAAL_CHECK(batchSize <= services::internal::MaxVal<int>::get(), ErrorInconsistenceModelAndBatchSizeInParameter)
+        const int errorcode =
+            daal::internal::RNGs<int, cpu>().uniformWithoutReplacement((int)batchSize, worker.indices.get(), engineImpl->getState(), 0, (int)nTerms);
+        DAAL_CHECK(!errorcode, ErrorIncorrectErrorcodeFromGenerator);
+        worker.ntBatchIndices->setArray(worker.indices.get(), 1);
+    }
+    return worker.function->computeNoThrow();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::applyUpdate(SGDAsynchronousWorker<algorithmFPType, cpu> & worker, size_t t, bool atomicUpdate,
+                                                              bool & converged)
+{
+    NumericTable * gradientNT = worker.function->getResult()->get(objective_function::gradientIdx).get();
+    DAAL_CHECK(gradientNT, ErrorNullNumericTable);
+    ReadRows<algorithmFPType, cpu> gradientBD(gradientNT, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(gradientBD);
+    const algorithmFPType * g = gradientBD.get();
+    algorithmFPType * x       = argument->getArray();
+
+    converged = false;
+    if (nIterations != 1)
+    {
+        /* The argument may be changed by the other workers, the norm of its current state is used */
+        algorithmFPType pointNorm    = 0;
+        algorithmFPType gradientNorm = 0;
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            pointNorm += x[j] * x[j];
+            gradientNorm += g[j] * g[j];
+        }
+        pointNorm    = daal::internal::Math<algorithmFPType, cpu>::sSqrt(pointNorm);
+        gradientNorm = daal::internal::Math<algorithmFPType, cpu>::sSqrt(gradientNorm);
+
+        const algorithmFPType one(1.0);
+        const algorithmFPType gradientThreshold = accuracyThreshold * daal::internal::Math<algorithmFPType, cpu>::sMax(one, pointNorm);
+        if (gradientNorm < gradientThreshold)
+        {
+            converged = true;
+            return Status();
+        }
+    }
+
+    const algorithmFPType learningRate = learningRateArray[(startIteration + t) % learningRateLength];
+    if (atomicUpdate)
+    {
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            if (g[j] != 0) daal::atomic_add(x + j, -learningRate * g[j]);
+        }
+    }
+    else
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < argumentSize; j++)
+        {
+            x[j] -= learningRate * g[j];
+        }
+    }
+    worker.nProceededIters++;
+    return Status();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::runWorker(size_t iWorker)
+{
+    Status s;
+    SGDAsynchronousWorker<algorithmFPType, cpu> & worker = workers[iWorker];
+    for (size_t t = iWorker; t < nIterations && !isStopped(); t += nWorkers)
+    {
+        DAAL_CHECK_STATUS(s, computeGradient(worker, t));
+
+        bool converged = false;
+        DAAL_CHECK_STATUS(s, applyUpdate(worker, t, true, converged));
+        if (converged)
+        {
+            stop();
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::runAsynchronous()
+{
+    SafeStatus safeStat;
+    daal::threader_for(nWorkers, nWorkers, [&](size_t iWorker) {
+        Status s = runWorker(iWorker);
+        if (!s)
+        {
+            stop();
+            safeStat.add(s);
+        }
+    });
+    return safeStat.detach();
+}
+
+/**
+ *  The workers compute their gradients at the same value of the argument in parallel,
+ *  then the updates are applied in the order of the workers. Every worker runs in the same thread at all rounds,
+ *  so its buffers stay in the cache of the thread
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::runDeterministic()
+{
+    Status s;
+    daal::affinity_partitioner partitioner;
+    for (size_t first = 0; first < nIterations; first += nWorkers)
+    {
+        const size_t nWorkersInRound = (first + nWorkers <= nIterations ? nWorkers : nIterations - first);
+
+        SafeStatus safeStat;
+        daal::threader_for_affinity(nWorkersInRound, nWorkersInRound, &partitioner, [&](size_t iWorker) {
+            Status st = computeGradient(workers[iWorker], first + iWorker);
+            DAAL_CHECK_STATUS_THR(st);
+        });
+        DAAL_CHECK_SAFE_STATUS();
+
+        for (size_t iWorker = 0; iWorker < nWorkersInRound; iWorker++)
+        {
+            bool converged = false;
+            DAAL_CHECK_STATUS(s, applyUpdate(workers[iWorker], first + iWorker, false, converged));
+            if (converged) return s;
+        }
+    }
+    return s;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status SGDAsynchronousTask<algorithmFPType, cpu>::getResult(NumericTable * minimum, size_t & nProceededIters)
+{
+    WriteOnlyRows<algorithmFPType, cpu, NumericTable> minimumBD(*minimum, 0, argumentSize);
+    DAAL_CHECK_BLOCK_STATUS(minimumBD);
+    int result = daal::services::internal::daal_memcpy_s(minimumBD.get(), argumentSize * sizeof(algorithmFPType), argument->getArray(),
+                                                         argumentSize * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+
+    nProceededIters = 0;
+    for (size_t i = 0; i < nWorkers; i++) nProceededIters += workers[i].nProceededIters;
+    return Status();
+}
+
+} // namespace internal
+} // namespace sgd
+} // namespace optimization_solver
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,130 @@
+/* file: sgd_dense_asynchronous_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of template function that calculate asynchronous sgd.
+//--
+
+#ifndef __SGD_DENSE_ASYNCHRONOUS_KERNEL_H__
+#define __SGD_DENSE_ASYNCHRONOUS_KERNEL_H__
+
+#include "algorithms/optimization_solver/sgd/sgd_batch.h"
+#include "algorithms/kernel/kernel.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/kernel/optimization_solver/iterative_solver_kernel.h"
+#include "algorithms/kernel/optimization_solver/sgd/sgd_dense_kernel.h"
+#include "algorithms/kernel/optimization_solver/sgd/sgd_dense_minibatch_kernel.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/threading/threading.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace optimization_solver
+{
+namespace sgd
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class SGDKernel<algorithmFPType, asynchronous, cpu> : public iterative_solver::internal::IterativeSolverKernel<algorithmFPType, cpu>
+{
+public:
+    services::Status compute(HostAppIface * pHost, NumericTable * inputArgument, NumericTable * minimum, NumericTable * nIterations,
+                             Parameter<asynchronous> * parameter, NumericTable * learningRateSequence, NumericTable * batchIndices,
+                             OptionalArgument * optionalArgument, OptionalArgument * optionalResult, engines::BatchBase & engine);
+};
+
+/**
+ * Objective function, indices of the terms and random number engine that belong to one worker
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SGDAsynchronousWorker
+{
+    SGDAsynchronousWorker() : nProceededIters(0) {}
+
+    sum_of_functions::BatchPtr function;
+    SharedPtr<daal::internal::HomogenNumericTableCPU<int, cpu> > ntBatchIndices;
+    services::internal::TArray<int, cpu> indices;
+    engines::EnginePtr engine;
+    size_t nProceededIters;
+};
+
+/**
+ * Argument shared by the workers and the state of the asynchronous iterations.
+ * The t-th update is made by the worker t % nWorkers
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SGDAsynchronousTask
+{
+    SGDAsynchronousTask(size_t nIterations_, size_t batchSize_, size_t nTerms_, size_t argumentSize_, size_t nWorkers_,
+                        algorithmFPType accuracyThreshold_, const int * predefinedIndices_, const algorithmFPType * learningRateArray_,
+                        size_t learningRateLength_, size_t startIteration_);
+
+    Status init(const sum_of_functions::BatchPtr & function, NumericTable * inputArgument, engines::BatchBase & engine);
+
+    /* Computes the stochastic gradient of the t-th update at the current value of the argument */
+    Status computeGradient(SGDAsynchronousWorker<algorithmFPType, cpu> & worker, size_t t);
+
+    /* Applies the t-th update to the argument, the components of the gradient equal to zero are skipped */
+    Status applyUpdate(SGDAsynchronousWorker<algorithmFPType, cpu> & worker, size_t t, bool atomicUpdate, bool & converged);
+
+    /* Runs the updates of the worker concurrently with the other workers */
+    Status runWorker(size_t iWorker);
+
+    Status runAsynchronous();
+    Status runDeterministic();
+
+    Status getResult(NumericTable * minimum, size_t & nProceededIters);
+
+    bool isStopped() { return daal::atomic_compare_exchange(&stopFlag, 1, 1) == 1; }
+    void stop() { daal::atomic_compare_exchange(&stopFlag, 0, 1); }
+
+    size_t nIterations;
+    size_t batchSize;
+    size_t nTerms;
+    size_t argumentSize;
+    size_t nWorkers;
+    algorithmFPType accuracyThreshold;
+    const int * predefinedIndices;
+    const algorithmFPType * learningRateArray;
+    size_t learningRateLength;
+    size_t startIteration;
+    IndicesStatus indicesStatus;
+    int stopFlag;
+
+    SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > argument;
+    services::internal::TArray<SGDAsynchronousWorker<algorithmFPType, cpu>, cpu> workers;
+};
+
+} // namespace internal
+
+} // namespace sgd
+
+} // namespace optimization_solver
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -143,6 +143,31 @@ services::Status Parameter<momentum>::check() const
     return s;
 }
 
+Parameter<asynchronous>::Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations, double accuracyThreshold,
+                                   NumericTablePtr batchIndices, size_t batchSize, NumericTablePtr learningRateSequence, size_t nWorkers,
+                                   bool deterministic)
+    : BaseParameter(function, nIterations, accuracyThreshold, batchIndices, learningRateSequence, batchSize),
+      nWorkers(nWorkers),
+      deterministic(deterministic)
+{}
+
+/**
+ * Checks the correctness of the parameter
+ */
+services::Status Parameter<asynchronous>::check() const
+{
+    services::Status s = BaseParameter::check();
+    if (!s) return s;
+    if (batchIndices.get() != NULL)
+    {
+        s |= checkNumericTable(batchIndices.get(), batchIndicesStr(), 0, 0, batchSize, nIterations);
+        DAAL_CHECK_STATUS_VAR(s);
+    }
+
+    DAAL_CHECK_EX(batchSize <= function->sumOfFunctionsParameter->numberOfTerms && batchSize > 0, ErrorIncorrectParameter, ArgumentName, "batchSize");
+    return s;
+}
+
 Input::Input() {}
 Input::Input(const Input & other) {}
 
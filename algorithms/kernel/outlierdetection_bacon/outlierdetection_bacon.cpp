@@ -39,7 +39,7 @@ namespace interface1
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OUTLIER_DETECTION_BACON_RESULT_ID);
 
 Parameter::Parameter(InitializationMethod initMethod, double alpha, double toleranceToConverge)
-    : initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge)
+    : initMethod(initMethod), alpha(alpha), toleranceToConverge(toleranceToConverge), computeEstimates(false)
 {}
 
 services::Status Parameter::check() const
@@ -88,7 +88,7 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     return checkNumericTable(get(data).get(), dataStr());
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
 
 /**
  * Returns result of the multivariate outlier detection algorithm
@@ -119,7 +119,19 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
     Input * algInput      = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nVectors       = algInput->get(data)->getNumberOfRows();
     int unexpectedLayouts = packed_mask;
-    return checkNumericTable(get(weights).get(), weightsStr(), unexpectedLayouts, 0, 1, nVectors);
+    Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(weights).get(), weightsStr(), unexpectedLayouts, 0, 1, nVectors));
+
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+    if (parameter && parameter->computeEstimates)
+    {
+        const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(location).get(), locationStr(), unexpectedLayouts, 0, nFeatures, 1));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(scatter).get(), scatterStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(choleskyFactor).get(), choleskyFactorStr(), unexpectedLayouts, 0, nFeatures, nFeatures));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(threshold).get(), thresholdStr(), unexpectedLayouts, 0, 1, 1));
+    }
+    return s;
 }
 
 } // namespace interface1
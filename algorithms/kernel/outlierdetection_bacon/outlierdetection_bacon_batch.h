@@ -50,6 +50,20 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::Input * in
     Input * algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
     size_t nVectors  = algInput->get(data)->getNumberOfRows();
     set(weights, HomogenNumericTable<algorithmFPType>::create(1, nVectors, NumericTable::doAllocate, &s));
+    DAAL_CHECK_STATUS_VAR(s);
+
+    const Parameter * par = static_cast<const Parameter *>(parameter);
+    if (par && par->computeEstimates)
+    {
+        const size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        set(location, HomogenNumericTable<algorithmFPType>::create(nFeatures, 1, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        set(scatter, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        set(choleskyFactor, HomogenNumericTable<algorithmFPType>::create(nFeatures, nFeatures, NumericTable::doAllocate, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+        set(threshold, HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, &s));
+    }
     return s;
 }
 
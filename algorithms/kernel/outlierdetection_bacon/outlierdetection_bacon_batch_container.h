@@ -54,8 +54,14 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable & data    = *(static_cast<NumericTable *>(input->get(InputId::data).get()));
     NumericTable & weights = *(static_cast<NumericTable *>(result->get(ResultId::weights).get()));
 
+    NumericTable * location       = result->get(ResultId::location).get();
+    NumericTable * scatter        = result->get(ResultId::scatter).get();
+    NumericTable * choleskyFactor = result->get(ResultId::choleskyFactor).get();
+    NumericTable * threshold      = result->get(ResultId::threshold).get();
+
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, data, weights, *par);
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, data, weights,
+                       location, scatter, choleskyFactor, threshold, *par);
 }
 
 } // namespace interface1
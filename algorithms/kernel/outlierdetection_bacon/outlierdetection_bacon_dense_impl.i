@@ -29,6 +29,9 @@
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_math.h"
 #include "externals/service_stat.h"
+#include "externals/service_blas.h"
+#include "externals/service_lapack.h"
+#include "externals/service_memory.h"
 
 namespace daal
 {
@@ -44,6 +47,8 @@ using namespace daal::services;
 
 template <typename algorithmFPType, Method method, CpuType cpu>
 services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable & resultTable,
+                                                                               NumericTable * locationTable, NumericTable * scatterTable,
+                                                                               NumericTable * choleskyFactorTable, NumericTable * thresholdTable,
                                                                                const Parameter & par)
 {
     const __int64 nBaconParams = 3;
@@ -80,6 +85,135 @@ services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(N
 
     Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
 
+    if (par.computeEstimates)
+    {
+        DAAL_ASSERT(locationTable && scatterTable && choleskyFactorTable && thresholdTable);
+        return computeEstimates(nFeatures, nVectors, data, weight, *locationTable, *scatterTable, *choleskyFactorTable, *thresholdTable);
+    }
+    return Status();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeEstimates(size_t nFeatures, size_t nVectors,
+                                                                                        const algorithmFPType * data, const algorithmFPType * weight,
+                                                                                        NumericTable & locationTable, NumericTable & scatterTable,
+                                                                                        NumericTable & choleskyFactorTable,
+                                                                                        NumericTable & thresholdTable)
+{
+    const algorithmFPType zero = (algorithmFPType)0.0;
+
+    size_t nInliers = 0;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        nInliers += (weight[i] > zero);
+    }
+    /* The scatter matrix of less than p + 1 observations is singular */
+    DAAL_CHECK(nInliers > nFeatures, ErrorOutlierDetectionInternal);
+
+    WriteOnlyRows<algorithmFPType, cpu> locationBlock(locationTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(locationBlock)
+    WriteOnlyRows<algorithmFPType, cpu> scatterBlock(scatterTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(scatterBlock)
+    WriteOnlyRows<algorithmFPType, cpu> choleskyFactorBlock(choleskyFactorTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(choleskyFactorBlock)
+    WriteOnlyRows<algorithmFPType, cpu> thresholdBlock(thresholdTable, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(thresholdBlock)
+
+    algorithmFPType * location = locationBlock.get();
+    algorithmFPType * scatter  = scatterBlock.get();
+    algorithmFPType * factor   = choleskyFactorBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nInliers, nFeatures);
+    TArray<algorithmFPType, cpu> dataCenPtr(nInliers * nFeatures);
+    DAAL_CHECK_MALLOC(dataCenPtr.get())
+    algorithmFPType * dataCen = dataCenPtr.get();
+
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        location[j] = zero;
+    }
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        if (!(weight[i] > zero)) continue;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            location[j] += data[i * nFeatures + j];
+        }
+    }
+    const algorithmFPType invInliers = (algorithmFPType)1.0 / (algorithmFPType)nInliers;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        location[j] *= invInliers;
+    }
+
+    for (size_t i = 0, iInlier = 0; i < nVectors; i++)
+    {
+        if (!(weight[i] > zero)) continue;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dataCen[iInlier * nFeatures + j] = data[i * nFeatures + j] - location[j];
+        }
+        iInlier++;
+    }
+
+    /* Row-major centered data is the column-major matrix of size p x nInliers, scatter = dataCen * dataCen^T / (nInliers - 1) */
+    DAAL_INT dim          = (DAAL_INT)nFeatures;
+    DAAL_INT n            = (DAAL_INT)nInliers;
+    char uplo             = 'U';
+    char trans            = 'N';
+    algorithmFPType beta  = zero;
+    algorithmFPType alpha = (algorithmFPType)1.0 / (algorithmFPType)(nInliers - 1);
+    Blas<algorithmFPType, cpu>::xsyrk(&uplo, &trans, &dim, &n, &alpha, dataCen, &dim, &beta, scatter, &dim);
+
+    /* Column-major upper triangle is the row-major lower one */
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = i + 1; j < nFeatures; j++)
+        {
+            scatter[i * nFeatures + j] = scatter[j * nFeatures + i];
+        }
+    }
+
+    /* Column-major lower triangular factor L, scatter = L * L^T, is the row-major upper triangular factor U = L^T */
+    for (size_t i = 0; i < nFeatures * nFeatures; i++)
+    {
+        factor[i] = scatter[i];
+    }
+    DAAL_INT info = 0;
+    uplo          = 'L';
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, factor, &dim, &info);
+    DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            factor[i * nFeatures + j] = zero;
+        }
+    }
+
+    /* Threshold is the maximal Mahalanobis distance of the observations that are not outliers, dataCen is overwritten with L^-1 * dataCen */
+    char diag = 'N';
+    Lapack<algorithmFPType, cpu>::xtrtrs(&uplo, &trans, &diag, &dim, &n, factor, &dim, dataCen, &dim, &info);
+    DAAL_CHECK(info == 0, ErrorOutlierDetectionInternal);
+
+    algorithmFPType maxDistance = zero;
+    for (size_t i = 0; i < nInliers; i++)
+    {
+        algorithmFPType distance = zero;
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            distance += dataCen[i * nFeatures + j] * dataCen[i * nFeatures + j];
+        }
+        if (distance > maxDistance) maxDistance = distance;
+    }
+    thresholdBlock.get()[0] = Math<algorithmFPType, cpu>::sSqrt(maxDistance);
+
     return Status();
 }
 
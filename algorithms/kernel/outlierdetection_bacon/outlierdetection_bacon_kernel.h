@@ -43,7 +43,12 @@ namespace internal
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct OutlierDetectionKernel : public Kernel
 {
-    services::Status compute(NumericTable & data, NumericTable & weights, const Parameter & par);
+    services::Status compute(NumericTable & data, NumericTable & weights, NumericTable * location, NumericTable * scatter,
+                             NumericTable * choleskyFactor, NumericTable * threshold, const Parameter & par);
+
+    /** \brief Compute the location, scatter, its Cholesky factor and the threshold of the observations that are not outliers */
+    services::Status computeEstimates(size_t nFeatures, size_t nVectors, const algorithmFPType * data, const algorithmFPType * weight,
+                                      NumericTable & location, NumericTable & scatter, NumericTable & choleskyFactor, NumericTable & threshold);
 };
 
 } // namespace internal
@@ -38,7 +38,7 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID);
 
-Input::Input() : daal::algorithms::Input(4) {}
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
 Input::Input(const Input & other) : daal::algorithms::Input(other) {}
 
 /**
@@ -83,6 +83,10 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     {
         DAAL_CHECK_STATUS(s, checkNumericTable(get(threshold).get(), thresholdStr(), 0, 0, 1, 1));
     }
+    if (get(choleskyFactor))
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(choleskyFactor).get(), choleskyFactorStr(), 0, 0, nFeatures, nFeatures));
+    }
     return s;
 }
 
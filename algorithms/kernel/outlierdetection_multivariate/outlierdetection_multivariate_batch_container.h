@@ -56,10 +56,11 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable * locationTable  = static_cast<NumericTable *>(input->get(location).get());
     NumericTable * scatterTable   = static_cast<NumericTable *>(input->get(scatter).get());
     NumericTable * thresholdTable = static_cast<NumericTable *>(input->get(threshold).get());
+    NumericTable * choleskyTable  = static_cast<NumericTable *>(input->get(choleskyFactor).get());
 
     daal::services::Environment::env & env = *_env;
     __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, defaultDense), compute, dataTable,
-                       locationTable, scatterTable, thresholdTable, weightsTable);
+                       locationTable, scatterTable, thresholdTable, choleskyTable, weightsTable);
 }
 } // namespace interface1
 } // namespace multivariate_outlier_detection
@@ -30,6 +30,9 @@
 #include "externals/service_math.h"
 #include "externals/service_blas.h"
 #include "externals/service_lapack.h"
+#include "externals/service_memory.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_error_handling.h"
 #include "algorithms/kernel/outlierdetection_multivariate/outlierdetection_multivariate_kernel.h"
 
 namespace daal
@@ -157,10 +160,82 @@ inline Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeInter
     return Status();
 }
 
+template <typename algorithmFPType, Method method, CpuType cpu>
+inline Status OutlierDetectionKernel<algorithmFPType, method, cpu>::computeWithCholeskyFactor(const size_t nFeatures, const size_t nVectors,
+                                                                                              NumericTable & dataTable, NumericTable & resultTable,
+                                                                                              const algorithmFPType * location,
+                                                                                              const algorithmFPType * choleskyFactor,
+                                                                                              const algorithmFPType threshold)
+{
+    const algorithmFPType one            = (algorithmFPType)1.0;
+    const algorithmFPType zero           = (algorithmFPType)0.0;
+    const algorithmFPType squaredLimit   = threshold * threshold;
+    const size_t nRowsInBlock            = (nVectors < blockSize) ? nVectors : blockSize;
+    const size_t nBlocks                 = nVectors / blockSize + !!(nVectors % blockSize);
+    algorithmFPType * const factorMatrix = const_cast<algorithmFPType *>(choleskyFactor);
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nRowsInBlock);
+    daal::tls<algorithmFPType *> tlsBuffer(
+        [=]() -> algorithmFPType * { return services::internal::service_scalable_malloc<algorithmFPType, cpu>(nFeatures * nRowsInBlock); });
+
+    SafeStatus safeStat;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows    = (startRow + blockSize > nVectors) ? nVectors - startRow : blockSize;
+
+        algorithmFPType * const dataCen = tlsBuffer.local();
+        DAAL_CHECK_MALLOC_THR(dataCen);
+
+        ReadRows<algorithmFPType, cpu> dataBlock(dataTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(dataBlock);
+        const algorithmFPType * const data = dataBlock.get();
+
+        WriteOnlyRows<algorithmFPType, cpu> resultBlock(resultTable, startRow, nRows);
+        DAAL_CHECK_BLOCK_STATUS_THR(resultBlock);
+        algorithmFPType * const weight = resultBlock.get();
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dataCen[i * nFeatures + j] = data[i * nFeatures + j] - location[j];
+            }
+        }
+
+        /* The row-major upper triangular factor U is the column-major lower triangular matrix L = U^T, scatter = L * L^T.
+           Squared Mahalanobis distance of the centered observation x is the squared norm of the solution of L * z = x */
+        DAAL_INT dim  = (DAAL_INT)nFeatures;
+        DAAL_INT nrhs = (DAAL_INT)nRows;
+        char uplo     = 'L';
+        char trans    = 'N';
+        char diag     = 'N';
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &nrhs, factorMatrix, &dim, dataCen, &dim, &info);
+        DAAL_CHECK_THR(info == 0, ErrorOutlierDetectionInternal);
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType distance = zero;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                distance += dataCen[i * nFeatures + j] * dataCen[i * nFeatures + j];
+            }
+            weight[i] = (distance > squaredLimit) ? zero : one;
+        }
+    });
+
+    tlsBuffer.reduce([](algorithmFPType * buffer) { services::internal::service_scalable_free<algorithmFPType, cpu>(buffer); });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, Method method, CpuType cpu>
 Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTable & dataTable, NumericTable * locationTable,
                                                                      NumericTable * scatterTable, NumericTable * thresholdTable,
-                                                                     NumericTable & resultTable)
+                                                                     NumericTable * choleskyFactorTable, NumericTable & resultTable)
 {
     size_t nFeatures = dataTable.getNumberOfColumns();
     size_t nVectors  = dataTable.getNumberOfRows();
@@ -175,11 +250,18 @@ Status OutlierDetectionKernel<algorithmFPType, method, cpu>::compute(NumericTabl
 
     DAAL_CHECK(locationArray && scatterArray && thresholdArray, ErrorMemoryAllocationFailed)
 
-    if (!locationTable || !scatterTable || !thresholdTable)
+    if (!locationTable || (!scatterTable && !choleskyFactorTable) || !thresholdTable)
     {
         defaultInitialization(locationArray, scatterArray, thresholdArray, nFeatures);
     }
 
+    if (choleskyFactorTable)
+    {
+        ReadRows<algorithmFPType, cpu> choleskyFactorBlock(choleskyFactorTable, 0, nFeatures);
+        DAAL_CHECK_BLOCK_STATUS(choleskyFactorBlock)
+        return computeWithCholeskyFactor(nFeatures, nVectors, dataTable, resultTable, locationArray, choleskyFactorBlock.get(), thresholdArray[0]);
+    }
+
     /* Allocate memory for storing intermediate results */
     size_t bufferSize = nFeatures * nFeatures + 2 * nFeatures * nVectors;
     TArray<algorithmFPType, cpu> bufferPtr(bufferSize);
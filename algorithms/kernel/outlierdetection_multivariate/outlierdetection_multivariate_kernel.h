@@ -58,8 +58,14 @@ struct OutlierDetectionKernel : public Kernel
                                   const algorithmFPType * location, const algorithmFPType * scatter, const algorithmFPType threshold,
                                   algorithmFPType * buffer);
 
+    /** \brief Detect outliers in the data using the precomputed Cholesky factor of the scatter matrix,
+               blocks of observations are processed in parallel */
+    inline Status computeWithCholeskyFactor(const size_t nFeatures, const size_t nVectors, NumericTable & dataTable, NumericTable & resultTable,
+                                            const algorithmFPType * location, const algorithmFPType * choleskyFactor,
+                                            const algorithmFPType threshold);
+
     Status compute(NumericTable & dataTable, NumericTable * locationTable, NumericTable * scatterTable, NumericTable * thresholdTable,
-                   NumericTable & resultTable);
+                   NumericTable * choleskyFactorTable, NumericTable & resultTable);
 };
 
 /**
@@ -69,7 +75,7 @@ template <typename algorithmFPType, CpuType cpu>
 struct OutlierDetectionKernel<algorithmFPType, baconDense, cpu> : public Kernel
 {
     Status compute(NumericTable & dataTable, NumericTable * locationTable, NumericTable * scatterTable, NumericTable * thresholdTable,
-                   NumericTable & resultTable)
+                   NumericTable * choleskyFactorTable, NumericTable & resultTable)
     {
         return services::Status();
     }
@@ -0,0 +1,89 @@
+/* file: pca_svd_cl_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA SVD OpenCL kernels.
+//--
+*/
+
+#ifndef __PCA_SVD_CL_KERNELS_CL__
+#define __PCA_SVD_CL_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    pca_svd_cl_kernels,
+
+    algorithmFPType reduceSum(__local algorithmFPType * localSums, algorithmFPType value) {
+        const uint localId = get_local_id(0);
+        localSums[localId] = value;
+
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride) localSums[localId] += localSums[localId + stride];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        const algorithmFPType sum = localSums[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        return sum;
+    }
+
+    /* The work-group computes the mean and the sample variance of one feature in two passes over the column */
+    __kernel void computeMoments(const __global algorithmFPType * x, uint nRows, uint nFeatures, __global algorithmFPType * means,
+                                 __global algorithmFPType * variances, __global algorithmFPType * invSigmas) {
+        __local algorithmFPType localSums[LOCAL_SIZE];
+
+        const uint j       = get_group_id(0);
+        const uint localId = get_local_id(0);
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint i = localId; i < nRows; i += LOCAL_SIZE)
+        {
+            sum += x[(ulong)i * nFeatures + j];
+        }
+        const algorithmFPType mean = reduceSum(localSums, sum) / (algorithmFPType)nRows;
+
+        algorithmFPType sumSq = (algorithmFPType)0;
+        for (uint i = localId; i < nRows; i += LOCAL_SIZE)
+        {
+            const algorithmFPType centered = x[(ulong)i * nFeatures + j] - mean;
+            sumSq += centered * centered;
+        }
+        const algorithmFPType variance = reduceSum(localSums, sumSq) / (algorithmFPType)(nRows - 1);
+
+        if (localId == 0)
+        {
+            means[j]     = mean;
+            variances[j] = variance;
+            invSigmas[j] = (variance > (algorithmFPType)0) ? (algorithmFPType)1 / sqrt(variance) : (algorithmFPType)0;
+        }
+    }
+
+    __kernel void normalize(const __global algorithmFPType * x, const __global algorithmFPType * means, const __global algorithmFPType * invSigmas,
+                            uint nFeatures, __global algorithmFPType * xNormalized) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        const ulong id  = (ulong)i * nFeatures + j;
+        xNormalized[id] = (x[id] - means[j]) * invSigmas[j];
+    }
+
+);
+
+#endif
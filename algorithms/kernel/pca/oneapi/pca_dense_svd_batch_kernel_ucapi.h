@@ -0,0 +1,92 @@
+/* file: pca_dense_svd_batch_kernel_ucapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class that computes SVD-based PCA on GPU.
+//--
+*/
+
+#ifndef __PCA_DENSE_SVD_BATCH_KERNEL_UCAPI_H__
+#define __PCA_DENSE_SVD_BATCH_KERNEL_UCAPI_H__
+
+#include "algorithms/kernel/kernel.h"
+#include "algorithms/kernel/pca/pca_dense_correlation_base_iface.h"
+#include "algorithms/kernel/pca/pca_dense_svd_base.h"
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+#include "algorithms/pca/pca_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+template <typename algorithmFPType>
+class PCASVDKernelUCAPI : public Kernel
+{
+public:
+    using PCACorrelationBaseIfacePtr = services::SharedPtr<PCACorrelationBaseIface<algorithmFPType> >;
+
+public:
+    PCASVDKernelUCAPI(const PCACorrelationBaseIfacePtr & host_impl);
+
+    services::Status compute(InputDataType type, data_management::NumericTable & data,
+                             const interface3::BatchParameter<algorithmFPType, svdDense> * parameter, data_management::NumericTable & eigenvalues,
+                             data_management::NumericTable & eigenvectors, data_management::NumericTable & means,
+                             data_management::NumericTable & variances);
+
+    services::Status compute(InputDataType type, data_management::NumericTable & data,
+                             const interface3::BatchParameter<algorithmFPType, randomizedDense> * parameter,
+                             data_management::NumericTable & eigenvalues, data_management::NumericTable & eigenvectors,
+                             data_management::NumericTable & means, data_management::NumericTable & variances);
+
+private:
+    /* Number of work-items in the work-group that processes one feature */
+    static const uint32_t localSize = 256;
+
+    services::Status buildProgram(oneapi::internal::ClKernelFactoryIface & factory);
+
+    /* Computes the z-scores of the data on device, the means and the variances are written if requested */
+    services::Status normalize(InputDataType type, data_management::NumericTable & data, DAAL_UINT64 resultsToCompute,
+                               data_management::NumericTable & means, data_management::NumericTable & variances);
+
+    /* Computes the leading eigenvectors and eigenvalues of the symmetric (n x n) matrix on host */
+    services::Status decomposeSymmetric(const oneapi::internal::UniversalBuffer & matrix, uint32_t n, data_management::NumericTable & eigenvectors,
+                                        data_management::NumericTable & eigenvalues);
+
+    /* Replaces the columns of the (nRows x l) matrix by the orthonormal basis of their span */
+    services::Status orthonormalize(oneapi::internal::UniversalBuffer & y, uint32_t nRows, uint32_t l);
+
+    services::Status computeRandomized(const interface3::BatchParameter<algorithmFPType, randomizedDense> * parameter,
+                                       data_management::NumericTable & eigenvalues, data_management::NumericTable & eigenvectors);
+
+    PCACorrelationBaseIfacePtr _host_impl;
+    oneapi::internal::UniversalBuffer _normalized; /* Z-scores of the data, (nRows x nFeatures) */
+    uint32_t _nRows;
+    uint32_t _nFeatures;
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,425 @@
+/* file: pca_dense_svd_batch_kernel_ucapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of SVD-based PCA on GPU.
+//
+//  The right singular vectors of the normalized data set X[n,p] are the eigenvectors of X^T * X, so the data stays on device:
+//  the products of the tall matrices are computed by GEMM and only the small symmetric matrices are decomposed on host.
+//
+//  The randomized method follows the CPU algorithm, l = k + nOversamples random vectors are used to find the range of X:
+//  Y = X * Omega, the power iterations Y = orth(Y), Z = orth(X^T * Y), Y = X * Z improve the accuracy, Q = orth(Y).
+//  Then the leading eigenvectors U of B * B^T, B[l,p] = Q^T * X, give the right singular vectors V^T = Sigma^-1 * U^T * B.
+//  The columns are orthonormalized as Y * E * Lambda^-1/2, where E and Lambda are the eigenvectors and eigenvalues of Y^T * Y.
+//--
+*/
+
+#ifndef __PCA_DENSE_SVD_BATCH_KERNEL_UCAPI_IMPL_I__
+#define __PCA_DENSE_SVD_BATCH_KERNEL_UCAPI_IMPL_I__
+
+#include "externals/service_ittnotify.h"
+
+DAAL_ITTNOTIFY_DOMAIN(pca.dense.svd.batch.oneapi);
+
+#include "algorithms/kernel/pca/oneapi/cl_kernels/pca_svd_cl_kernels.cl"
+#include "data_management/data/numeric_table_sycl_homogen.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "service/kernel/oneapi/blas_gpu.h"
+#include "service/kernel/service_data_utils.h"
+#include "externals/service_math.h"
+#include "algorithms/kernel/distributions/normal/normal_kernel.h"
+#include "algorithms/kernel/distributions/normal/normal_impl.i"
+
+using namespace daal::services;
+using namespace daal::oneapi::internal;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+template <typename algorithmFPType>
+PCASVDKernelUCAPI<algorithmFPType>::PCASVDKernelUCAPI(const PCACorrelationBaseIfacePtr & host_impl)
+{
+    _host_impl = host_impl;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::buildProgram(ClKernelFactoryIface & factory)
+{
+    Status status;
+    services::String options = getKeyFPType<algorithmFPType>();
+    options.add(" -D LOCAL_SIZE=256 "); // should be equal to localSize
+
+    services::String cachekey("__daal_algorithms_pca_svd_dense_batch_");
+    cachekey.add(options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_svd_cl_kernels, options.c_str(), &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::compute(InputDataType type, NumericTable & data,
+                                                   const interface3::BatchParameter<algorithmFPType, svdDense> * parameter,
+                                                   NumericTable & eigenvalues, NumericTable & eigenvectors, NumericTable & means,
+                                                   NumericTable & variances)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    Status st;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    DAAL_CHECK_STATUS(st, buildProgram(ctx.getClKernelFactory()));
+    DAAL_CHECK_STATUS(st, normalize(type, data, parameter->resultsToCompute, means, variances));
+
+    /* The eigenvalues of X^T * X / (n - 1) are the squared singular values of X scaled as on CPU */
+    UniversalBuffer gram = ctx.allocate(TypeIds::id<algorithmFPType>(), _nFeatures * _nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.gram);
+        DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, _nFeatures,
+                                                              _nFeatures, _nRows, algorithmFPType(1.0) / algorithmFPType(_nRows - 1), _normalized,
+                                                              _nFeatures, 0, _normalized, _nFeatures, 0, algorithmFPType(0.0), gram, _nFeatures, 0));
+    }
+
+    DAAL_CHECK_STATUS(st, decomposeSymmetric(gram, _nFeatures, eigenvectors, eigenvalues));
+
+    if (parameter->isDeterministic)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.signFlipEigenvectors);
+        DAAL_CHECK_STATUS(st, _host_impl->signFlipEigenvectors(eigenvectors));
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::compute(InputDataType type, NumericTable & data,
+                                                   const interface3::BatchParameter<algorithmFPType, randomizedDense> * parameter,
+                                                   NumericTable & eigenvalues, NumericTable & eigenvectors, NumericTable & means,
+                                                   NumericTable & variances)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    Status st;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+    DAAL_CHECK_STATUS(st, buildProgram(ctx.getClKernelFactory()));
+    DAAL_CHECK_STATUS(st, normalize(type, data, parameter->resultsToCompute, means, variances));
+    DAAL_CHECK_STATUS(st, computeRandomized(parameter, eigenvalues, eigenvectors));
+
+    if (parameter->isDeterministic)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.signFlipEigenvectors);
+        DAAL_CHECK_STATUS(st, _host_impl->signFlipEigenvectors(eigenvectors));
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::normalize(InputDataType type, NumericTable & data, DAAL_UINT64 resultsToCompute, NumericTable & means,
+                                                     NumericTable & variances)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.normalize);
+    Status st;
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    const size_t nRows     = data.getNumberOfRows();
+    const size_t nFeatures = data.getNumberOfColumns();
+    DAAL_CHECK(nRows > 1 && nRows <= services::internal::MaxVal<uint32_t>::get(), ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_CHECK(nFeatures <= services::internal::MaxVal<uint32_t>::get(), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nRows, nFeatures);
+    _nRows     = uint32_t(nRows);
+    _nFeatures = uint32_t(nFeatures);
+
+    const TypeId idType = TypeIds::id<algorithmFPType>();
+    _normalized         = ctx.allocate(idType, _nRows * _nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(st, data.getBlockOfRows(0, _nRows, ReadWriteMode::readOnly, dataBlock));
+
+    UniversalBuffer meansBuffer = ctx.allocate(idType, _nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    UniversalBuffer variancesBuffer = ctx.allocate(idType, _nFeatures, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    if (type == normalizedDataset)
+    {
+        ctx.copy(_normalized, 0, dataBlock.getBuffer(), 0, _nRows * _nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        ctx.fill(meansBuffer, 0.0, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        ctx.fill(variancesBuffer, 1.0, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+    else
+    {
+        UniversalBuffer invSigmas = ctx.allocate(idType, _nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        {
+            KernelPtr kernel = factory.getKernel("computeMoments", &st);
+            DAAL_CHECK_STATUS_VAR(st);
+
+            KernelArguments args(6);
+            args.set(0, dataBlock.getBuffer(), AccessModeIds::read);
+            args.set(1, _nRows);
+            args.set(2, _nFeatures);
+            args.set(3, meansBuffer, AccessModeIds::write);
+            args.set(4, variancesBuffer, AccessModeIds::write);
+            args.set(5, invSigmas, AccessModeIds::write);
+
+            KernelRange localRange(localSize);
+            KernelRange globalRange(localSize * _nFeatures);
+            KernelNDRange range(1);
+            range.global(globalRange, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+            range.local(localRange, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+
+            ctx.run(range, kernel, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+        {
+            KernelPtr kernel = factory.getKernel("normalize", &st);
+            DAAL_CHECK_STATUS_VAR(st);
+
+            KernelArguments args(5);
+            args.set(0, dataBlock.getBuffer(), AccessModeIds::read);
+            args.set(1, meansBuffer, AccessModeIds::read);
+            args.set(2, invSigmas, AccessModeIds::read);
+            args.set(3, _nFeatures);
+            args.set(4, _normalized, AccessModeIds::write);
+
+            KernelRange range(_nRows, _nFeatures);
+            ctx.run(range, kernel, args, &st);
+            DAAL_CHECK_STATUS_VAR(st);
+        }
+    }
+    DAAL_CHECK_STATUS(st, data.releaseBlockOfRows(dataBlock));
+
+    if (resultsToCompute & mean)
+    {
+        BlockDescriptor<algorithmFPType> meansBlock;
+        DAAL_CHECK_STATUS(st, means.getBlockOfRows(0, 1, ReadWriteMode::writeOnly, meansBlock));
+        ctx.copy(meansBlock.getBuffer(), 0, meansBuffer, 0, _nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, means.releaseBlockOfRows(meansBlock));
+    }
+
+    if (resultsToCompute & variance)
+    {
+        BlockDescriptor<algorithmFPType> variancesBlock;
+        DAAL_CHECK_STATUS(st, variances.getBlockOfRows(0, 1, ReadWriteMode::writeOnly, variancesBlock));
+        ctx.copy(variancesBlock.getBuffer(), 0, variancesBuffer, 0, _nFeatures, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, variances.releaseBlockOfRows(variancesBlock));
+    }
+    return st;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::decomposeSymmetric(const UniversalBuffer & matrix, uint32_t n, NumericTable & eigenvectors,
+                                                              NumericTable & eigenvalues)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.decomposeSymmetric);
+    Status st;
+    auto matrixTable = SyclHomogenNumericTable<algorithmFPType>::create(matrix.template get<algorithmFPType>(), n, n, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    return _host_impl->computeCorrelationEigenvalues(*matrixTable, eigenvectors, eigenvalues);
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::orthonormalize(UniversalBuffer & y, uint32_t nRows, uint32_t l)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.orthonormalize);
+    Status st;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    const TypeId idType         = TypeIds::id<algorithmFPType>();
+
+    UniversalBuffer gram = ctx.allocate(idType, l * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, l, l, nRows,
+                                                          algorithmFPType(1.0), y, l, 0, y, l, 0, algorithmFPType(0.0), gram, l, 0));
+
+    auto eigenvectorsTable = HomogenNumericTable<algorithmFPType>::create(l, l, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto eigenvaluesTable = HomogenNumericTable<algorithmFPType>::create(l, 1, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, decomposeSymmetric(gram, l, *eigenvectorsTable, *eigenvaluesTable));
+
+    /* The directions with the negligible eigenvalues are dropped, the columns of Y are linearly dependent there */
+    const algorithmFPType * e      = eigenvectorsTable->getArray();
+    const algorithmFPType * lambda = eigenvaluesTable->getArray();
+    const algorithmFPType minValue = lambda[0] * algorithmFPType(l) * services::internal::EpsilonVal<algorithmFPType>::get();
+
+    services::SharedPtr<algorithmFPType> scaleHost(static_cast<algorithmFPType *>(services::daal_malloc(l * l * sizeof(algorithmFPType))),
+                                                   services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(scaleHost.get());
+    algorithmFPType * scale = scaleHost.get();
+    for (uint32_t i = 0; i < l; i++)
+    {
+        const algorithmFPType invSqrt =
+            (lambda[i] > minValue) ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, sse2>::sSqrt(lambda[i]) : algorithmFPType(0.0);
+        for (uint32_t r = 0; r < l; r++)
+        {
+            scale[r * l + i] = e[i * l + r] * invSqrt;
+        }
+    }
+
+    UniversalBuffer scaleBuffer = ctx.allocate(idType, l * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    ctx.copy(scaleBuffer, 0, (void *)scale, 0, l * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    UniversalBuffer q = ctx.allocate(idType, nRows * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, nRows, l, l,
+                                                          algorithmFPType(1.0), y, l, 0, scaleBuffer, l, 0, algorithmFPType(0.0), q, l, 0));
+    y = q;
+    return st;
+}
+
+template <typename algorithmFPType>
+Status PCASVDKernelUCAPI<algorithmFPType>::computeRandomized(const interface3::BatchParameter<algorithmFPType, randomizedDense> * parameter,
+                                                             NumericTable & eigenvalues, NumericTable & eigenvectors)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute.randomized);
+    Status st;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    const TypeId idType         = TypeIds::id<algorithmFPType>();
+
+    const uint32_t n = _nRows;
+    const uint32_t p = _nFeatures;
+    const uint32_t k = uint32_t(eigenvalues.getNumberOfColumns());
+
+    size_t nVectors = size_t(k) + parameter->nOversamples;
+    nVectors        = (nVectors < size_t(p)) ? nVectors : size_t(p);
+    nVectors        = (nVectors < size_t(n)) ? nVectors : size_t(n);
+    const uint32_t l = (nVectors > size_t(k)) ? uint32_t(nVectors) : k;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, n, l);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, p, l);
+
+    /* The Gaussian test matrix is generated on host by the engine of the parameter as on CPU */
+    UniversalBuffer z = ctx.allocate(idType, p * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.randomized.testMatrix);
+        DAAL_CHECK(parameter->engine, ErrorNullAuxiliaryAlgorithm);
+        services::SharedPtr<algorithmFPType> omega(static_cast<algorithmFPType *>(services::daal_malloc(p * l * sizeof(algorithmFPType))),
+                                                   services::ServiceDeleter());
+        DAAL_CHECK_MALLOC(omega.get());
+
+        distributions::normal::Parameter<algorithmFPType> normalParameter(algorithmFPType(0.0), algorithmFPType(1.0));
+        DAAL_CHECK_STATUS(st, (distributions::normal::internal::NormalKernelDefault<algorithmFPType, sse2>::compute(
+                                  &normalParameter, *parameter->engine, p * l, omega.get())));
+        ctx.copy(z, 0, (void *)omega.get(), 0, p * l, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+    }
+
+    const algorithmFPType one  = algorithmFPType(1.0);
+    const algorithmFPType zero = algorithmFPType(0.0);
+
+    /* Y = X * Omega */
+    UniversalBuffer y = ctx.allocate(idType, n * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, n, l, p, one,
+                                                          _normalized, p, 0, z, l, 0, zero, y, l, 0));
+
+    for (size_t it = 0; it < parameter->nPowerIterations; it++)
+    {
+        DAAL_ITTNOTIFY_SCOPED_TASK(compute.randomized.powerIteration);
+        DAAL_CHECK_STATUS(st, orthonormalize(y, n, l));
+
+        /* Z = X^T * Y */
+        DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, p, l, n,
+                                                              one, _normalized, p, 0, y, l, 0, zero, z, l, 0));
+        DAAL_CHECK_STATUS(st, orthonormalize(z, p, l));
+
+        /* Y = X * Z */
+        DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, n, l, p,
+                                                              one, _normalized, p, 0, z, l, 0, zero, y, l, 0));
+    }
+    DAAL_CHECK_STATUS(st, orthonormalize(y, n, l));
+
+    /* B = Q^T * X, the singular values of B are the ones of X */
+    UniversalBuffer b = ctx.allocate(idType, l * p, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, l, p, n, one, y,
+                                                          l, 0, _normalized, p, 0, zero, b, p, 0));
+
+    UniversalBuffer gram = ctx.allocate(idType, l * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, l, l, p, one, b,
+                                                          p, 0, b, p, 0, zero, gram, l, 0));
+
+    auto leftVectorsTable = HomogenNumericTable<algorithmFPType>::create(l, k, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    auto sigmasTable = HomogenNumericTable<algorithmFPType>::create(k, 1, NumericTable::doAllocate, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    DAAL_CHECK_STATUS(st, decomposeSymmetric(gram, l, *leftVectorsTable, *sigmasTable));
+
+    /* V^T = Sigma^-1 * U^T * B, the eigenvalues are the squared singular values scaled as on CPU */
+    const algorithmFPType * u      = leftVectorsTable->getArray();
+    const algorithmFPType * sigma2 = sigmasTable->getArray();
+
+    services::SharedPtr<algorithmFPType> hostValues(
+        static_cast<algorithmFPType *>(services::daal_malloc((size_t(k) * l + k) * sizeof(algorithmFPType))), services::ServiceDeleter());
+    DAAL_CHECK_MALLOC(hostValues.get());
+    algorithmFPType * scaledLeftVectors = hostValues.get();
+    algorithmFPType * values            = scaledLeftVectors + size_t(k) * l;
+    for (uint32_t i = 0; i < k; i++)
+    {
+        const algorithmFPType invSigma = (sigma2[i] > zero) ? one / daal::internal::Math<algorithmFPType, sse2>::sSqrt(sigma2[i]) : zero;
+        for (uint32_t r = 0; r < l; r++)
+        {
+            scaledLeftVectors[i * l + r] = u[i * l + r] * invSigma;
+        }
+        values[i] = (sigma2[i] > zero ? sigma2[i] : zero) / algorithmFPType(n - 1);
+    }
+
+    UniversalBuffer scaledLeftVectorsBuffer = ctx.allocate(idType, k * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+    ctx.copy(scaledLeftVectorsBuffer, 0, (void *)scaledLeftVectors, 0, k * l, &st);
+    DAAL_CHECK_STATUS_VAR(st);
+
+    {
+        BlockDescriptor<algorithmFPType> eigenvectorsBlock;
+        DAAL_CHECK_STATUS(st, eigenvectors.getBlockOfRows(0, k, ReadWriteMode::writeOnly, eigenvectorsBlock));
+        DAAL_CHECK_STATUS(st, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, k, p, l,
+                                                              one, scaledLeftVectorsBuffer, l, 0, b, p, 0, zero, eigenvectorsBlock.getBuffer(), p,
+                                                              0));
+        DAAL_CHECK_STATUS(st, eigenvectors.releaseBlockOfRows(eigenvectorsBlock));
+    }
+    {
+        BlockDescriptor<algorithmFPType> eigenvaluesBlock;
+        DAAL_CHECK_STATUS(st, eigenvalues.getBlockOfRows(0, 1, ReadWriteMode::writeOnly, eigenvaluesBlock));
+        ctx.copy(eigenvaluesBlock.getBuffer(), 0, (void *)values, 0, k, &st);
+        DAAL_CHECK_STATUS_VAR(st);
+        DAAL_CHECK_STATUS(st, eigenvalues.releaseBlockOfRows(eigenvaluesBlock));
+    }
+    return st;
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,62 @@
+/* file: pca_batchparameter_randomized_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parameters of the PCA randomized SVD algorithm.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+#include "service/kernel/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface3
+{
+/** Constructs PCA parameters */
+template <typename algorithmFPType>
+DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense>::BatchParameter(
+    const services::SharedPtr<normalization::zscore::BatchImpl> & normalization)
+    : BatchParameter<algorithmFPType, svdDense>(normalization), nOversamples(10), nPowerIterations(2), engine(engines::mt19937::Batch<>::create())
+{
+    this->nComponents = 10;
+}
+
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status BatchParameter<algorithmFPType, randomizedDense>::check() const
+{
+    services::Status s;
+    DAAL_CHECK_STATUS(s, (BatchParameter<algorithmFPType, svdDense>::check()));
+    DAAL_CHECK_EX(this->nComponents > 0, services::ErrorIncorrectParameter, services::ParameterName, nComponentsStr());
+    DAAL_CHECK(engine, services::ErrorNullAuxiliaryAlgorithm);
+    return s;
+}
+
+template DAAL_EXPORT BatchParameter<DAAL_FPTYPE, randomizedDense>::BatchParameter(
+    const services::SharedPtr<normalization::zscore::BatchImpl> & normalization);
+
+template DAAL_EXPORT services::Status BatchParameter<DAAL_FPTYPE, randomizedDense>::check() const;
+
+} // namespace interface3
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
@@ -44,6 +44,8 @@ services::Status PCACorrelationKernel<online, algorithmFPType, cpu>::compute(con
 {
     parameter->covariance->input.set(covariance::data, pData);
     parameter->covariance->parameter.outputMatrixType = covariance::correlationMatrix;
+    /* The partial results of PCA include only the cross-product, sums and number of observations */
+    parameter->covariance->parameter.coalescingBlockSize = 0;
 
     services::Status s = parameter->covariance->computeNoThrow();
     if (s) s = copyCovarianceResultToPartialResult(parameter->covariance->getPartialResult().get(), partialResult);
@@ -0,0 +1,112 @@
+/* file: pca_dense_incremental_online_container.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA incremental SVD algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_ONLINE_CONTAINER_H__
+#define __PCA_DENSE_INCREMENTAL_ONLINE_CONTAINER_H__
+
+#include "algorithms/kernel/kernel.h"
+#include "algorithms/pca/pca_online.h"
+#include "algorithms/kernel/pca/pca_dense_incremental_online_kernel.h"
+#include "algorithms/kernel/pca/pca_dense_svd_container.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, incrementalDense, cpu>::OnlineContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::PCAIncrementalOnlineKernel, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, incrementalDense, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, incrementalDense, cpu>::compute()
+{
+    Input * input                 = static_cast<Input *>(_in);
+    internal::InputDataType dtype = getInputDataType(input);
+
+    PartialResult<svdDense> * partialResult                        = static_cast<PartialResult<svdDense> *>(_pres);
+    OnlineParameter<algorithmFPType, incrementalDense> * parameter = static_cast<OnlineParameter<algorithmFPType, incrementalDense> *>(_par);
+
+    NumericTablePtr data = input->get(pca::data);
+
+    NumericTablePtr nObservations = partialResult->get(pca::nObservationsSVD);
+    NumericTablePtr sumSquaresSVD = partialResult->get(pca::sumSquaresSVD);
+    NumericTablePtr sumSVD        = partialResult->get(pca::sumSVD);
+
+    /* The sketch is the only element of the auxiliary data collection, it is created on the first block */
+    DataCollectionPtr sketchCollection = partialResult->get(auxiliaryData);
+    if (sketchCollection->size() == 0)
+    {
+        size_t nFeatures = sumSquaresSVD.get()->getNumberOfColumns();
+        services::Status s;
+        NumericTablePtr sketchTable =
+            HomogenNumericTable<algorithmFPType>::create(nFeatures, parameter->sketchSize, NumericTableIface::doAllocate, 0, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        sketchCollection->push_back(sketchTable);
+    }
+    NumericTablePtr sketch = partialResult->get(auxiliaryData, 0);
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCAIncrementalOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), compute, dtype, data, *nObservations,
+                       *sketch, *sumSVD, *sumSquaresSVD);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status OnlineContainer<algorithmFPType, incrementalDense, cpu>::finalizeCompute()
+{
+    Input * input                 = static_cast<Input *>(_in);
+    internal::InputDataType dtype = getInputDataType(input);
+
+    Result * result = static_cast<Result *>(_res);
+
+    PartialResult<svdDense> * partialResult = static_cast<PartialResult<svdDense> *>(_pres);
+
+    NumericTablePtr nObservations = partialResult->get(pca::nObservationsSVD);
+    NumericTablePtr sketch        = partialResult->get(auxiliaryData, 0);
+    DAAL_CHECK(sketch, services::ErrorNullAuxiliaryDataCollection);
+
+    NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::PCAIncrementalOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType), finalizeCompute, dtype, nObservations,
+                       *sketch, *eigenvalues, *eigenvectors);
+}
+
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,193 @@
+/* file: pca_dense_incremental_online_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the PCA incremental SVD algorithm in the online processing mode
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_ONLINE_IMPL_I__
+#define __PCA_DENSE_INCREMENTAL_ONLINE_IMPL_I__
+
+#include "externals/service_math.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "algorithms/kernel/svd/svd_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::data_management;
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalOnlineKernel<algorithmFPType, cpu>::compute(InputDataType type, const NumericTablePtr & data,
+                                                                           NumericTable & nObservations, NumericTable & sketch, NumericTable & sumSVD,
+                                                                           NumericTable & sumSquaresSVD)
+{
+    if (type == correlation) return services::Status(services::ErrorInputCorrelationNotSupportedInOnlineAndDistributed);
+
+    const size_t nVectors   = data->getNumberOfRows();
+    const size_t nFeatures  = sketch.getNumberOfColumns();
+    const size_t sketchSize = sketch.getNumberOfRows();
+
+    WriteRows<int, cpu> oldObservationsBlock(nObservations, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(oldObservationsBlock);
+    int * oldObservations         = oldObservationsBlock.get();
+    const size_t nOldObservations = *oldObservations;
+
+    services::Status s;
+    NumericTablePtr normalizedData;
+    if (type == normalizedDataset)
+    {
+        normalizedData = data;
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, this->normalizeDataset(data, nOldObservations + nVectors, nObservations, sumSVD, sumSquaresSVD, normalizedData));
+    }
+
+    const size_t nStacked = 2 * sketchSize;
+    const size_t nU       = (nFeatures < nStacked) ? nFeatures : nStacked;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nStacked, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nStacked * nFeatures, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> stackedPtr(nStacked * nFeatures);
+    TArray<algorithmFPType, cpu> uPtr(nU * nFeatures);
+    TArray<algorithmFPType, cpu> sPtr(nStacked);
+    TArray<algorithmFPType, cpu> vtPtr(nStacked * nStacked);
+    DAAL_CHECK_MALLOC(stackedPtr.get() && uPtr.get() && sPtr.get() && vtPtr.get());
+
+    ReadRows<algorithmFPType, cpu> dataBlock(*normalizedData, 0, nVectors);
+    DAAL_CHECK_BLOCK_STATUS(dataBlock);
+    const algorithmFPType * dataArray = dataBlock.get();
+
+    WriteRows<algorithmFPType, cpu> sketchBlock(sketch, 0, sketchSize);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+    algorithmFPType * sketchArray = sketchBlock.get();
+
+    for (size_t iRow = 0; iRow < nVectors; iRow += sketchSize)
+    {
+        const size_t nBlockRows = (nVectors - iRow < sketchSize) ? nVectors - iRow : sketchSize;
+        DAAL_CHECK_STATUS(s, updateSketch(sketchSize, nFeatures, nBlockRows, dataArray + iRow * nFeatures, sketchArray, stackedPtr.get(),
+                                          uPtr.get(), sPtr.get(), vtPtr.get()));
+    }
+
+    *oldObservations += nVectors;
+    return s;
+}
+
+/*
+    Row-major stacked[r, nFeatures] is treated as the column-major matrix stacked^T[nFeatures, r],
+    so the right singular vectors of the stacked rows are the left singular vectors u of stacked^T
+    and are returned in the column-major u[nFeatures, min(nFeatures, r)], i.e. in the rows of the row-major matrix.
+*/
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalOnlineKernel<algorithmFPType, cpu>::updateSketch(size_t sketchSize, size_t nFeatures, size_t nBlockRows,
+                                                                                const algorithmFPType * block, algorithmFPType * sketch,
+                                                                                algorithmFPType * stacked, algorithmFPType * u, algorithmFPType * s,
+                                                                                algorithmFPType * vt)
+{
+    const size_t nRows = sketchSize + nBlockRows;
+    const size_t nU    = (nFeatures < nRows) ? nFeatures : nRows;
+    const size_t nKept = (sketchSize < nU) ? sketchSize : nU;
+
+    daal::services::internal::daal_memcpy_s(stacked, sketchSize * nFeatures * sizeof(algorithmFPType), sketch,
+                                            sketchSize * nFeatures * sizeof(algorithmFPType));
+    daal::services::internal::daal_memcpy_s(stacked + sketchSize * nFeatures, nBlockRows * nFeatures * sizeof(algorithmFPType), block,
+                                            nBlockRows * nFeatures * sizeof(algorithmFPType));
+
+    DAAL_INT m = nFeatures;
+    DAAL_INT n = nRows;
+    DAAL_INT k = nU;
+    services::Status status = daal::algorithms::svd::internal::compute_svd_on_one_node<algorithmFPType, cpu>(m, n, stacked, m, s, u, m, vt, k);
+    if (!status) return status;
+
+    for (size_t i = 0; i < nKept; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sketch[i * nFeatures + j] = s[i] * u[i * nFeatures + j];
+        }
+    }
+    for (size_t i = nKept * nFeatures; i < sketchSize * nFeatures; i++)
+    {
+        sketch[i] = algorithmFPType(0);
+    }
+    return status;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status PCAIncrementalOnlineKernel<algorithmFPType, cpu>::finalizeCompute(InputDataType type, const NumericTablePtr & nObservationsTable,
+                                                                                   NumericTable & sketch, NumericTable & eigenvalues,
+                                                                                   NumericTable & eigenvectors)
+{
+    if (type == correlation) return services::Status(services::ErrorInputCorrelationNotSupportedInOnlineAndDistributed);
+
+    const size_t nVectors    = nObservationsTable->getValue<int>(0, 0);
+    const size_t nFeatures   = sketch.getNumberOfColumns();
+    const size_t nComponents = eigenvalues.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> sketchBlock(sketch, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(sketchBlock);
+    const algorithmFPType * sketchArray = sketchBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvaluesBlock(eigenvalues, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(eigenvaluesBlock);
+    algorithmFPType * eigenvaluesArray = eigenvaluesBlock.get();
+
+    WriteOnlyRows<algorithmFPType, cpu> eigenvectorsBlock(eigenvectors, 0, nComponents);
+    DAAL_CHECK_BLOCK_STATUS(eigenvectorsBlock);
+    algorithmFPType * eigenvectorsArray = eigenvectorsBlock.get();
+
+    /* The norms of the sketch rows are the singular values of the processed data */
+    for (size_t i = 0; i < nComponents; i++)
+    {
+        const algorithmFPType * row = sketchArray + i * nFeatures;
+        algorithmFPType sumSq       = algorithmFPType(0);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sumSq += row[j] * row[j];
+        }
+        eigenvaluesArray[i] = sumSq / (nVectors - 1);
+
+        const algorithmFPType invNorm =
+            (sumSq > algorithmFPType(0)) ? algorithmFPType(1) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(sumSq) : algorithmFPType(0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            eigenvectorsArray[i * nFeatures + j] = row[j] * invNorm;
+        }
+    }
+    return services::Status();
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
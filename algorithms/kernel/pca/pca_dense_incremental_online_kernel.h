@@ -0,0 +1,68 @@
+/* file: pca_dense_incremental_online_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA incremental SVD.
+//--
+*/
+
+#ifndef __PCA_DENSE_INCREMENTAL_ONLINE_KERNEL_H__
+#define __PCA_DENSE_INCREMENTAL_ONLINE_KERNEL_H__
+
+#include "algorithms/kernel/pca/pca_dense_svd_online_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+/**
+ * Keeps the sketch[sketchSize, nFeatures] whose rows are the leading right singular vectors of the processed data
+ * scaled by the singular values. The sketch is updated by the blocks of at most sketchSize rows,
+ * so the memory used does not depend on the number of observations and grows linearly with the number of features.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class PCAIncrementalOnlineKernel : public PCASVDOnlineKernel<algorithmFPType, cpu>
+{
+public:
+    PCAIncrementalOnlineKernel() {}
+
+    services::Status compute(InputDataType type, const data_management::NumericTablePtr & data, data_management::NumericTable & nObservations,
+                             data_management::NumericTable & sketch, data_management::NumericTable & sumSVD,
+                             data_management::NumericTable & sumSquaresSVD);
+
+    services::Status finalizeCompute(InputDataType type, const data_management::NumericTablePtr & nObservationsTable,
+                                     data_management::NumericTable & sketch, data_management::NumericTable & eigenvalues,
+                                     data_management::NumericTable & eigenvectors);
+
+protected:
+    /* Replaces the sketch with the leading part of the SVD of the sketch stacked with the block of nBlockRows rows,
+       stacked[sketchSize + nBlockRows, nFeatures], u[min(nFeatures, sketchSize + nBlockRows), nFeatures],
+       s[sketchSize + nBlockRows] and vt[(sketchSize + nBlockRows)^2] are the buffers */
+    services::Status updateSketch(size_t sketchSize, size_t nFeatures, size_t nBlockRows, const algorithmFPType * block, algorithmFPType * sketch,
+                                  algorithmFPType * stacked, algorithmFPType * u, algorithmFPType * s, algorithmFPType * vt);
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -28,6 +28,9 @@
 #include "algorithms/pca/pca_batch.h"
 #include "algorithms/kernel/pca/pca_dense_svd_batch_kernel.h"
 #include "algorithms/kernel/pca/pca_dense_svd_container.h"
+#include "algorithms/kernel/pca/pca_dense_correlation_base.h"
+#include "algorithms/kernel/pca/oneapi/pca_dense_svd_batch_kernel_ucapi.h"
+#include "oneapi/internal/execution_context.h"
 
 namespace daal
 {
@@ -40,7 +43,18 @@ namespace interface3
 template <typename algorithmFPType, CpuType cpu>
 BatchContainer<algorithmFPType, svdDense, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::PCASVDBatchKernel, algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::svdDense>);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::PCASVDBatchKernel, algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::svdDense>);
+    }
+    else
+    {
+        services::SharedPtr<internal::PCACorrelationBaseIface<algorithmFPType> > hostImpl(new internal::PCACorrelationBase<algorithmFPType, cpu>());
+        _kernel = new internal::PCASVDKernelUCAPI<algorithmFPType>(hostImpl);
+    }
 }
 
 template <typename algorithmFPType, CpuType cpu>
@@ -81,9 +95,91 @@ Status BatchContainer<algorithmFPType, svdDense, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::PCASVDBatchKernel,
-                       __DAAL_KERNEL_ARGUMENTS(algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::svdDense>), compute, dtype, *data,
-                       parameter, *eigenvalues, *eigenvectors, *means, *variances);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::PCASVDBatchKernel,
+                           __DAAL_KERNEL_ARGUMENTS(algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::svdDense>), compute, dtype,
+                           *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+    }
+    else
+    {
+        return ((internal::PCASVDKernelUCAPI<algorithmFPType> *)(_kernel))
+            ->compute(dtype, *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::PCASVDBatchKernel, algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::randomizedDense>);
+    }
+    else
+    {
+        services::SharedPtr<internal::PCACorrelationBaseIface<algorithmFPType> > hostImpl(new internal::PCACorrelationBase<algorithmFPType, cpu>());
+        _kernel = new internal::PCASVDKernelUCAPI<algorithmFPType>(hostImpl);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+BatchContainer<algorithmFPType, randomizedDense, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status BatchContainer<algorithmFPType, randomizedDense, cpu>::compute()
+{
+    Input * input   = static_cast<Input *>(_in);
+    Result * result = static_cast<Result *>(_res);
+    interface3::BatchParameter<algorithmFPType, pca::randomizedDense> * parameter =
+        static_cast<interface3::BatchParameter<algorithmFPType, pca::randomizedDense> *>(_par);
+
+    internal::InputDataType dtype = getInputDataType(input);
+
+    data_management::NumericTablePtr data         = input->get(pca::data);
+    data_management::NumericTablePtr eigenvalues  = result->get(pca::eigenvalues);
+    data_management::NumericTablePtr eigenvectors = result->get(pca::eigenvectors);
+    data_management::NumericTablePtr means        = result->get(pca::means);
+    data_management::NumericTablePtr variances    = result->get(pca::variances);
+
+    auto normalizationAlgorithm = parameter->normalization;
+    normalizationAlgorithm->input.set(normalization::zscore::data, data);
+
+    auto algParameter = &(normalizationAlgorithm->parameter());
+    if (parameter->resultsToCompute & mean)
+    {
+        algParameter->resultsToCompute |= normalization::zscore::mean;
+    }
+
+    if (parameter->resultsToCompute & variance)
+    {
+        algParameter->resultsToCompute |= normalization::zscore::variance;
+    }
+
+    daal::services::Environment::env & env = *_env;
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::PCASVDBatchKernel,
+                           __DAAL_KERNEL_ARGUMENTS(algorithmFPType, interface3::BatchParameter<algorithmFPType, pca::randomizedDense>), compute,
+                           dtype, *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+    }
+    else
+    {
+        return ((internal::PCASVDKernelUCAPI<algorithmFPType> *)(_kernel))
+            ->compute(dtype, *data, parameter, *eigenvalues, *eigenvectors, *means, *variances);
+    }
 }
 
 } // namespace interface3
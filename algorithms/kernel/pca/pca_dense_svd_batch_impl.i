@@ -42,6 +42,48 @@ using namespace daal::services::internal;
 using namespace daal::data_management;
 using namespace daal::internal;
 
+/**
+ *  \brief Computes the singular values and the right singular vectors of the normalized data set,
+ *         all the methods except randomizedDense compute the full decomposition
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct PCASVDDecomposition
+{
+    static services::Status compute(const NumericTable * normalizedDataTable, const ParameterType * parameter, NumericTable & eigenvalues,
+                                    NumericTable & eigenvectors)
+    {
+        const NumericTable * const * svdInputs = &normalizedDataTable;
+
+        NumericTable * svdResults[3] = { &eigenvalues, nullptr, &eigenvectors };
+        svd::Parameter params;
+        params.leftSingularMatrix = svd::notRequired;
+        daal::algorithms::svd::internal::SVDBatchKernel<algorithmFPType, svd::defaultDense, cpu> svdKernel;
+        return svdKernel.compute(1, svdInputs, 3, svdResults, &params);
+    }
+};
+
+template <typename algorithmFPType, CpuType cpu>
+struct PCASVDDecomposition<algorithmFPType, interface3::BatchParameter<algorithmFPType, randomizedDense>, cpu>
+{
+    typedef interface3::BatchParameter<algorithmFPType, randomizedDense> ParameterType;
+
+    static services::Status compute(const NumericTable * normalizedDataTable, const ParameterType * parameter, NumericTable & eigenvalues,
+                                    NumericTable & eigenvectors)
+    {
+        const NumericTable * const * svdInputs = &normalizedDataTable;
+
+        NumericTable * svdResults[3] = { &eigenvalues, nullptr, &eigenvectors };
+        svd::Parameter params;
+        params.leftSingularMatrix = svd::notRequired;
+        params.nComponents        = parameter->nComponents;
+        params.nOversamples       = parameter->nOversamples;
+        params.nPowerIterations   = parameter->nPowerIterations;
+        params.engine             = parameter->engine;
+        daal::algorithms::svd::internal::SVDBatchKernel<algorithmFPType, svd::randomizedDense, cpu> svdKernel;
+        return svdKernel.compute(1, svdInputs, 3, svdResults, &params);
+    }
+};
+
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
 services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute(InputDataType type, const NumericTablePtr & data,
                                                                                  NumericTable & eigenvalues, NumericTable & eigenvectors)
@@ -101,7 +143,8 @@ services::Status PCASVDBatchKernel<algorithmFPType, ParameterType, cpu>::compute
         }
     }
 
-    DAAL_CHECK_STATUS(status, this->decompose(normalizedData, eigenvalues, eigenvectors));
+    DAAL_CHECK_STATUS(status,
+                      (PCASVDDecomposition<algorithmFPType, ParameterType, cpu>::compute(normalizedData, parameter, eigenvalues, eigenvectors)));
     DAAL_CHECK_STATUS(status, this->scaleSingularValues(eigenvalues, data.getNumberOfRows()));
     if (parameter->isDeterministic)
     {
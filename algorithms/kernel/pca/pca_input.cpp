@@ -102,7 +102,7 @@ Status Input::check(const daal::algorithms::Parameter * par, int method) const
     else
     {
         DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
-        if (method == svdDense)
+        if (method == svdDense || method == randomizedDense)
         {
             DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
         }
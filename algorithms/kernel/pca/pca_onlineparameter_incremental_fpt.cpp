@@ -0,0 +1,54 @@
+/* file: pca_onlineparameter_incremental_fpt.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parameters of the PCA incremental SVD algorithm.
+//--
+*/
+
+#include "algorithms/pca/pca_types.h"
+#include "service/kernel/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+/** Constructs PCA parameters */
+template <typename algorithmFPType>
+DAAL_EXPORT OnlineParameter<algorithmFPType, incrementalDense>::OnlineParameter() : nComponents(10), sketchSize(20)
+{}
+
+template <typename algorithmFPType>
+DAAL_EXPORT services::Status OnlineParameter<algorithmFPType, incrementalDense>::check() const
+{
+    DAAL_CHECK_EX(nComponents > 0, services::ErrorIncorrectParameter, services::ParameterName, nComponentsStr());
+    DAAL_CHECK_EX(sketchSize >= nComponents, services::ErrorIncorrectParameter, services::ParameterName, sketchSizeStr());
+    return services::Status();
+}
+
+template DAAL_EXPORT OnlineParameter<DAAL_FPTYPE, incrementalDense>::OnlineParameter();
+template DAAL_EXPORT services::Status OnlineParameter<DAAL_FPTYPE, incrementalDense>::check() const;
+
+} // namespace interface1
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
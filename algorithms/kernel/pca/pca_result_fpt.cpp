@@ -69,6 +69,11 @@ DAAL_EXPORT services::Status Result::allocate(const daal::algorithms::PartialRes
     size_t nComponents           = 0;
     DAAL_UINT64 resultsToCompute = eigenvalue;
 
+    if (method == incrementalDense && parameter != NULL)
+    {
+        nComponents = static_cast<const interface1::OnlineParameter<algorithmFPType, incrementalDense> *>(parameter)->nComponents;
+    }
+
     auto impl = ResultImpl::cast(getStorage(*this));
     DAAL_CHECK(impl, services::ErrorNullPtr);
 
@@ -46,51 +46,51 @@ DECLARE_SOURCE(
         }
     }
 
-    __kernel void normalize(__global algorithmFPType * copyBlock, __global const algorithmFPType * rawMeans,
-                            __global const algorithmFPType * invSigmas, const char hasMeans, const char hasInvSigmas, const uint maxWorkItemsPerGroup,
-                            const uint numFeatures) {
-        const int glid                 = get_global_id(0);
-        const int numWorkItemsPerGroup = get_local_size(0);
-        const int numVec               = get_num_groups(0);
+    /* Scales the row of the basis by the inverse square root of the eigenvalue and its columns by the inverse sigmas,
+     * the work-group computes the negated projection of the means onto its component */
+    __kernel void computeScaledBasis(__global const algorithmFPType * basis, __global const algorithmFPType * invSigmas,
+                                     __global const algorithmFPType * invEigenvalues, __global const algorithmFPType * rawMeans, const char hasMeans,
+                                     const char hasInvSigmas, const char hasInvEigenvalues, const uint numFeatures,
+                                     __global algorithmFPType * scaledBasis, __global algorithmFPType * bias) {
+        __local algorithmFPType localSums[LOCAL_SIZE];
 
-        uint numOfDataItemsProcessedByWI = numFeatures / maxWorkItemsPerGroup;
+        const uint componentId = get_group_id(0);
+        const uint localId     = get_local_id(0);
 
-        for (uint i = 0; i < numOfDataItemsProcessedByWI + 1; i++)
+        const algorithmFPType rowScale = hasInvEigenvalues ? invEigenvalues[componentId] : (algorithmFPType)1;
+
+        const __global algorithmFPType * row = basis + (ulong)componentId * numFeatures;
+        __global algorithmFPType * scaledRow = scaledBasis + (ulong)componentId * numFeatures;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint j = localId; j < numFeatures; j += LOCAL_SIZE)
         {
-            const int dataId  = glid + numVec * numWorkItemsPerGroup * i;
-            const int meansId = dataId % numFeatures;
-            if (dataId < numFeatures * numVec)
-            {
-                if (hasMeans)
-                {
-                    copyBlock[dataId] = copyBlock[dataId] - rawMeans[meansId];
-                }
-                if (hasInvSigmas)
-                {
-                    copyBlock[dataId] = copyBlock[dataId] * invSigmas[meansId];
-                }
-            }
+            const algorithmFPType value = hasInvSigmas ? row[j] * rowScale * invSigmas[j] : row[j] * rowScale;
+            scaledRow[j]                = value;
+            if (hasMeans) sum += value * rawMeans[j];
         }
-    }
+        localSums[localId] = sum;
 
-    __kernel void whitening(__global algorithmFPType * transformedBlock, __global const algorithmFPType * invEigenValues,
-                            const uint maxWorkItemsPerGroup, const uint numComponents) {
-        const int glid                 = get_global_id(0);
-        const int numWorkItemsPerGroup = get_local_size(0);
-        const int numVec               = get_num_groups(0);
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride) localSums[localId] += localSums[localId + stride];
+        }
 
-        uint numOfDataItemsProcessedByWI = numComponents / maxWorkItemsPerGroup;
-        for (uint i = 0; i < numOfDataItemsProcessedByWI + 1; i++)
+        if (localId == 0 && hasMeans)
         {
-            const int dataId   = glid + numVec * numWorkItemsPerGroup * i;
-            const int eigValId = dataId % numComponents;
-            if (dataId < numComponents * numVec)
-            {
-                transformedBlock[dataId] = transformedBlock[dataId] * invEigenValues[eigValId];
-            }
+            bias[componentId] = -localSums[0];
         }
     }
 
+    /* Initializes the rows of the transformed data with the bias, the projection of the data is accumulated by GEMM */
+    __kernel void broadcastBias(__global const algorithmFPType * bias, const uint numComponents, __global algorithmFPType * transformedBlock) {
+        const uint rowId       = get_global_id(0);
+        const uint componentId = get_global_id(1);
+
+        transformedBlock[(ulong)rowId * numComponents + componentId] = bias[componentId];
+    }
+
 );
 
 #endif
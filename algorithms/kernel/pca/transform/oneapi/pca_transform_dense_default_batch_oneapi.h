@@ -49,16 +49,14 @@ public:
                              data_management::NumericTable * pMeans, data_management::NumericTable * pVariances,
                              data_management::NumericTable * pEigenvalues, data_management::NumericTable & transformedData);
 
-    void computeTransformedBlock(uint32_t numRows, uint32_t numFeatures, uint32_t numComponents, daal::oneapi::internal::UniversalBuffer & dataBlock,
-                                 const services::Buffer<algorithmFPType> & eigenvectors, const services::Buffer<algorithmFPType> & resultBlock);
+    void computeTransformedBlock(uint32_t numRows, uint32_t numFeatures, uint32_t numComponents,
+                                 const daal::oneapi::internal::UniversalBuffer & dataBlock, const daal::oneapi::internal::UniversalBuffer & basis,
+                                 const services::Buffer<algorithmFPType> & resultBlock, algorithmFPType beta);
 
 private:
     services::Status allocateBuffer(daal::oneapi::internal::ExecutionContextIface & context, daal::oneapi::internal::UniversalBuffer & returnBuffer,
                                     uint32_t bufferSize);
 
-    services::Status copyBuffer(daal::oneapi::internal::ExecutionContextIface & context, daal::oneapi::internal::UniversalBuffer & returnBuffer,
-                                data_management::NumericTable & data, const uint32_t nRows, const uint32_t nCols);
-
     services::Status buildKernel(daal::oneapi::internal::ExecutionContextIface & context, daal::oneapi::internal::ClKernelFactoryIface & factory);
 
     services::Status checkVariances(data_management::NumericTable & pVariances, uint32_t numRows);
@@ -66,22 +64,23 @@ private:
     services::Status computeInvSigmas(daal::oneapi::internal::ExecutionContextIface & context, data_management::NumericTable * variances,
                                       const services::Buffer<algorithmFPType> & invSigmas, const uint32_t numFeatures);
 
-    services::Status normalize(daal::oneapi::internal::ExecutionContextIface & context, daal::oneapi::internal::UniversalBuffer & copyBlock,
-                               daal::oneapi::internal::UniversalBuffer & rawMeans, daal::oneapi::internal::UniversalBuffer & invSigmas, bool hasMeans,
-                               bool hasInvSigmas, const uint32_t numFeatures, const uint32_t numVectors);
+    services::Status computeScaledBasis(daal::oneapi::internal::ExecutionContextIface & context,
+                                        const daal::oneapi::internal::UniversalBuffer & basis,
+                                        const daal::oneapi::internal::UniversalBuffer & rawMeans, bool hasMeans, bool hasInvSigmas,
+                                        bool hasInvEigenvalues, const uint32_t numFeatures, const uint32_t numComponents);
 
-    services::Status whitening(daal::oneapi::internal::ExecutionContextIface & context, const services::Buffer<algorithmFPType> & transformedBlock,
-                               daal::oneapi::internal::UniversalBuffer & invEigenvalues, const uint32_t numComponents, const uint32_t numVectors);
+    services::Status broadcastBias(daal::oneapi::internal::ExecutionContextIface & context,
+                                   const services::Buffer<algorithmFPType> & transformedBlock, const uint32_t numComponents,
+                                   const uint32_t numVectors);
 
-    services::Status initBuffers(daal::oneapi::internal::ExecutionContextIface & ctx, data_management::NumericTable & data,
-                                 const uint32_t numFeatures, const uint32_t numComponents, const uint32_t numVectors);
+    services::Status initBuffers(daal::oneapi::internal::ExecutionContextIface & ctx, const uint32_t numFeatures, const uint32_t numComponents);
 
 private:
-    const unsigned int maxWorkItemsPerGroup = 256;
+    static const uint32_t maxWorkItemsPerGroup = 256;
     daal::oneapi::internal::UniversalBuffer invSigmas;
     daal::oneapi::internal::UniversalBuffer invEigenvalues;
-    daal::oneapi::internal::UniversalBuffer rawMeans;
-    daal::oneapi::internal::UniversalBuffer copyBlock;
+    daal::oneapi::internal::UniversalBuffer scaledBasis; /* Basis with centering, normalization and whitening folded in */
+    daal::oneapi::internal::UniversalBuffer bias;        /* Negated projection of the means onto the scaled basis */
 };
 
 } // namespace internal
@@ -49,13 +49,14 @@ using namespace daal::oneapi::internal;
 
 template <typename algorithmFPType, transform::Method method>
 void TransformKernelOneAPI<algorithmFPType, method>::computeTransformedBlock(const uint32_t numRows, const uint32_t numFeatures,
-                                                                             const uint32_t numComponents, UniversalBuffer & dataBlock,
-                                                                             const services::Buffer<algorithmFPType> & eigenvectors,
-                                                                             const services::Buffer<algorithmFPType> & resultBlock)
+                                                                             const uint32_t numComponents, const UniversalBuffer & dataBlock,
+                                                                             const UniversalBuffer & basis,
+                                                                             const services::Buffer<algorithmFPType> & resultBlock,
+                                                                             algorithmFPType beta)
 {
     DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.gemm);
     BlasGpu<algorithmFPType>::xgemm(math::Layout::ColMajor, math::Transpose::Trans, math::Transpose::NoTrans, numComponents, numRows, numFeatures,
-                                    1.0, eigenvectors, numFeatures, 0, dataBlock, numFeatures, 0, 0.0, resultBlock, numComponents, 0);
+                                    1.0, basis, numFeatures, 0, dataBlock, numFeatures, 0, beta, resultBlock, numComponents, 0);
 }
 
 template <typename algorithmFPType, transform::Method method>
@@ -67,7 +68,6 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::computeInvSigma
     services::Status status;
 
     ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
 
     const char * const computeInvSigmasKernel = "computeInvSigmas";
     KernelPtr kernel                          = factory.getKernel(computeInvSigmasKernel);
@@ -83,32 +83,38 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::computeInvSigma
     return status;
 }
 
+/*
+    Centering, normalization to unit variance and whitening are folded into the basis as on CPU, so that the data is not copied:
+    y = invEigenvalues * V * invSigmas * (x - means) = W * x + bias,
+    where W = invEigenvalues * V * invSigmas is the scaled basis and bias = -W * means initializes the result accumulated by GEMM
+*/
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::normalize(ExecutionContextIface & ctx, UniversalBuffer & copyBlock,
-                                                                           UniversalBuffer & rawMeans, UniversalBuffer & invSigmas, bool hasMeans,
-                                                                           bool hasInvSigmas, const uint32_t numFeatures, const uint32_t numVectors)
+services::Status TransformKernelOneAPI<algorithmFPType, method>::computeScaledBasis(ExecutionContextIface & ctx, const UniversalBuffer & basis,
+                                                                                    const UniversalBuffer & rawMeans, bool hasMeans,
+                                                                                    bool hasInvSigmas, bool hasInvEigenvalues,
+                                                                                    const uint32_t numFeatures, const uint32_t numComponents)
 {
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.normalize);
+    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.computeScaledBasis);
     services::Status status;
 
     ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
-
-    const char * const normalizeKernel = "normalize";
-    KernelPtr kernel                   = factory.getKernel(normalizeKernel);
-
-    const unsigned int workItemsPerGroup = (numFeatures > maxWorkItemsPerGroup) ? maxWorkItemsPerGroup : numFeatures;
-    KernelArguments args(7);
-    args.set(0, copyBlock, AccessModeIds::readwrite);
-    args.set(1, rawMeans, AccessModeIds::read);
-    args.set(2, invSigmas, AccessModeIds::read);
-    args.set(3, static_cast<unsigned char>(hasMeans));
-    args.set(4, static_cast<unsigned char>(hasInvSigmas));
-    args.set(5, maxWorkItemsPerGroup);
-    args.set(6, numFeatures);
-
-    KernelRange local_range(workItemsPerGroup);
-    KernelRange global_range(workItemsPerGroup * numVectors);
+    KernelPtr kernel               = factory.getKernel("computeScaledBasis", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(10);
+    args.set(0, basis, AccessModeIds::read);
+    args.set(1, invSigmas, AccessModeIds::read);
+    args.set(2, invEigenvalues, AccessModeIds::read);
+    args.set(3, rawMeans, AccessModeIds::read);
+    args.set(4, static_cast<unsigned char>(hasMeans));
+    args.set(5, static_cast<unsigned char>(hasInvSigmas));
+    args.set(6, static_cast<unsigned char>(hasInvEigenvalues));
+    args.set(7, numFeatures);
+    args.set(8, scaledBasis, AccessModeIds::write);
+    args.set(9, bias, AccessModeIds::write);
+
+    KernelRange local_range(maxWorkItemsPerGroup);
+    KernelRange global_range(maxWorkItemsPerGroup * numComponents);
     KernelNDRange range(1);
     range.global(global_range, &status);
     DAAL_CHECK_STATUS_VAR(status);
@@ -121,36 +127,23 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::normalize(Execu
 }
 
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::whitening(ExecutionContextIface & ctx,
-                                                                           const services::Buffer<algorithmFPType> & transformedBlock,
-                                                                           UniversalBuffer & invEigenvalues, const uint32_t numComponents,
-                                                                           const uint32_t numVectors)
+services::Status TransformKernelOneAPI<algorithmFPType, method>::broadcastBias(ExecutionContextIface & ctx,
+                                                                               const services::Buffer<algorithmFPType> & transformedBlock,
+                                                                               const uint32_t numComponents, const uint32_t numVectors)
 {
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.whitening);
+    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.broadcastBias);
     services::Status status;
 
     ClKernelFactoryIface & factory = ctx.getClKernelFactory();
-    buildKernel(ctx, factory);
-
-    const char * const whiteningKernel = "whitening";
-    KernelPtr kernel                   = factory.getKernel(whiteningKernel);
-
-    const unsigned int workItemsPerGroup = (numComponents > maxWorkItemsPerGroup) ? maxWorkItemsPerGroup : numComponents;
-    KernelArguments args(4);
-    args.set(0, transformedBlock, AccessModeIds::readwrite);
-    args.set(1, invEigenvalues, AccessModeIds::read);
-    args.set(2, maxWorkItemsPerGroup);
-    args.set(3, numComponents);
-
-    KernelRange local_range(workItemsPerGroup);
-    KernelRange global_range(workItemsPerGroup * numVectors);
-
-    KernelNDRange range(1);
-    range.global(global_range, &status);
-    DAAL_CHECK_STATUS_VAR(status);
-    range.local(local_range, &status);
+    KernelPtr kernel               = factory.getKernel("broadcastBias", &status);
     DAAL_CHECK_STATUS_VAR(status);
 
+    KernelArguments args(3);
+    args.set(0, bias, AccessModeIds::read);
+    args.set(1, numComponents);
+    args.set(2, transformedBlock, AccessModeIds::write);
+
+    KernelRange range(numVectors, numComponents);
     ctx.run(range, kernel, args, &status);
 
     return status;
@@ -171,23 +164,6 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::allocateBuffer(
     return status;
 }
 
-template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::copyBuffer(ExecutionContextIface & ctx, UniversalBuffer & returnBuffer,
-                                                                            NumericTable & data, uint32_t nRows, uint32_t nCols)
-
-{
-    DAAL_ITTNOTIFY_SCOPED_TASK(pca.transform.compute.copyBuffer);
-    services::Status status;
-
-    BlockDescriptor<algorithmFPType> dataBlock;
-    DAAL_CHECK_STATUS(status, data.getBlockOfRows(0, nRows, ReadWriteMode::readOnly, dataBlock));
-
-    ctx.copy(returnBuffer, 0, dataBlock.getBuffer(), 0, nRows * nCols, &status);
-    data.releaseBlockOfRows(dataBlock);
-
-    return status;
-}
-
 template <typename algorithmFPType, transform::Method method>
 services::Status TransformKernelOneAPI<algorithmFPType, method>::checkVariances(NumericTable & pVariances, uint32_t numRows)
 {
@@ -216,27 +192,26 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::buildKernel(Exe
 
     auto fptype_name   = oneapi::internal::getKeyFPType<algorithmFPType>();
     auto build_options = fptype_name;
+    build_options.add(" -D LOCAL_SIZE=256 "); // should be equal to maxWorkItemsPerGroup
 
-    const services::String options = getKeyFPType<algorithmFPType>();
     services::String cachekey("__daal_algorithms_pca_transform");
-    cachekey.add(fptype_name);
-    factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_transform_cl_kernels, build_options.c_str());
+    cachekey.add(build_options);
+    factory.build(ExecutionTargetIds::device, cachekey.c_str(), pca_transform_cl_kernels, build_options.c_str(), &status);
 
     return status;
 }
 
 template <typename algorithmFPType, transform::Method method>
-services::Status TransformKernelOneAPI<algorithmFPType, method>::initBuffers(ExecutionContextIface & ctx, NumericTable & data,
-                                                                             const uint32_t numFeatures, const uint32_t numComponents,
-                                                                             const uint32_t numVectors)
+services::Status TransformKernelOneAPI<algorithmFPType, method>::initBuffers(ExecutionContextIface & ctx, const uint32_t numFeatures,
+                                                                             const uint32_t numComponents)
 {
     services::Status status;
 
     DAAL_CHECK_STATUS(status, allocateBuffer(ctx, invSigmas, numFeatures));
     DAAL_CHECK_STATUS(status, allocateBuffer(ctx, invEigenvalues, numComponents));
-    DAAL_CHECK_STATUS(status, allocateBuffer(ctx, rawMeans, numFeatures));
-    copyBlock = ctx.allocate(TypeIds::id<algorithmFPType>(), numVectors * numFeatures, &status);
-    copyBuffer(ctx, copyBlock, data, numVectors, numFeatures);
+    DAAL_CHECK_STATUS(status, allocateBuffer(ctx, bias, numComponents));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, numComponents, numFeatures);
+    scaledBasis = ctx.allocate(TypeIds::id<algorithmFPType>(), numComponents * numFeatures, &status);
 
     return status;
 }
@@ -254,52 +229,65 @@ services::Status TransformKernelOneAPI<algorithmFPType, method>::compute(Numeric
     const uint32_t numFeatures   = data.getNumberOfColumns();
     const uint32_t numComponents = transformedData.getNumberOfColumns();
 
-    initBuffers(ctx, data, numFeatures, numComponents, numVectors);
+    const bool hasMeans          = pMeans != nullptr;
+    const bool hasInvSigmas      = pVariances != nullptr;
+    const bool hasInvEigenvalues = pEigenvalues != nullptr;
 
-    bool hasInvSigmas = false;
-    if (pVariances != nullptr)
-    {
-        hasInvSigmas = true;
-        DAAL_CHECK_STATUS(status, checkVariances(*pVariances, numFeatures));
-        DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pVariances, invSigmas.template get<algorithmFPType>(), numFeatures));
-    }
+    DAAL_CHECK_STATUS(status, buildKernel(ctx, ctx.getClKernelFactory()));
 
-    if (pEigenvalues != nullptr)
-    {
-        DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pEigenvalues, invEigenvalues.template get<algorithmFPType>(), numComponents));
-    }
+    BlockDescriptor<algorithmFPType> basisBlock;
+    DAAL_CHECK_STATUS(status, eigenvectors.getBlockOfRows(0, numComponents, ReadWriteMode::readOnly, basisBlock));
+    UniversalBuffer basis = basisBlock.getBuffer();
 
-    bool hasMeans = false;
-    if (pMeans != nullptr)
+    if (hasMeans || hasInvSigmas || hasInvEigenvalues)
     {
-        hasMeans = true;
-        DAAL_CHECK_STATUS(status, copyBuffer(ctx, rawMeans, *pMeans, numFeatures, 1));
-    }
+        DAAL_CHECK_STATUS(status, initBuffers(ctx, numFeatures, numComponents));
 
-    bool isWhitening = pEigenvalues != nullptr;
-    bool isNormalize = pMeans != nullptr || pVariances != nullptr;
+        if (hasInvSigmas)
+        {
+            DAAL_CHECK_STATUS(status, checkVariances(*pVariances, numFeatures));
+            DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pVariances, invSigmas.template get<algorithmFPType>(), numFeatures));
+        }
 
-    if (isNormalize)
-    {
-        DAAL_CHECK_STATUS(status, normalize(ctx, copyBlock, rawMeans, invSigmas, hasMeans, hasInvSigmas, numFeatures, numVectors));
-    }
+        if (hasInvEigenvalues)
+        {
+            DAAL_CHECK_STATUS(status, computeInvSigmas(ctx, pEigenvalues, invEigenvalues.template get<algorithmFPType>(), numComponents));
+        }
 
-    BlockDescriptor<algorithmFPType> transformedBlock;
-    DAAL_CHECK_STATUS(status, transformedData.getBlockOfRows(0, transformedData.getNumberOfRows(), ReadWriteMode::readWrite, transformedBlock));
+        BlockDescriptor<algorithmFPType> meansBlock;
+        UniversalBuffer rawMeans = bias;
+        if (hasMeans)
+        {
+            DAAL_CHECK_STATUS(status, pMeans->getBlockOfRows(0, 1, ReadWriteMode::readOnly, meansBlock));
+            rawMeans = meansBlock.getBuffer();
+        }
 
-    BlockDescriptor<algorithmFPType> basis;
-    DAAL_CHECK_STATUS(status, eigenvectors.getBlockOfRows(0, numComponents, ReadWriteMode::readOnly, basis));
+        DAAL_CHECK_STATUS(status, computeScaledBasis(ctx, basis, rawMeans, hasMeans, hasInvSigmas, hasInvEigenvalues, numFeatures, numComponents));
 
-    computeTransformedBlock(numVectors, numFeatures, numComponents, copyBlock, basis.getBuffer(), transformedBlock.getBuffer());
+        if (hasMeans)
+        {
+            DAAL_CHECK_STATUS(status, pMeans->releaseBlockOfRows(meansBlock));
+        }
+        basis = scaledBasis;
+    }
 
-    if (isWhitening)
+    BlockDescriptor<algorithmFPType> transformedBlock;
+    DAAL_CHECK_STATUS(status, transformedData.getBlockOfRows(0, numVectors, ReadWriteMode::writeOnly, transformedBlock));
+
+    if (hasMeans)
     {
-        DAAL_CHECK_STATUS(status, whitening(ctx, transformedBlock.getBuffer(), invEigenvalues, numComponents, numVectors));
+        DAAL_CHECK_STATUS(status, broadcastBias(ctx, transformedBlock.getBuffer(), numComponents, numVectors));
     }
-    transformedData.releaseBlockOfRows(transformedBlock);
-    eigenvectors.releaseBlockOfRows(basis);
 
-    return status;
+    BlockDescriptor<algorithmFPType> dataBlock;
+    DAAL_CHECK_STATUS(status, data.getBlockOfRows(0, numVectors, ReadWriteMode::readOnly, dataBlock));
+
+    computeTransformedBlock(numVectors, numFeatures, numComponents, dataBlock.getBuffer(), basis, transformedBlock.getBuffer(),
+                            hasMeans ? algorithmFPType(1.0) : algorithmFPType(0.0));
+
+    DAAL_CHECK_STATUS(status, data.releaseBlockOfRows(dataBlock));
+    DAAL_CHECK_STATUS(status, transformedData.releaseBlockOfRows(transformedBlock));
+    return eigenvectors.releaseBlockOfRows(basisBlock);
 }
 
 } /* namespace internal */
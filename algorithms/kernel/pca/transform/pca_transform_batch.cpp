@@ -161,7 +161,14 @@ Status Result::check(const daal::algorithms::Input * input, const daal::algorith
     return s;
 }
 
-Parameter::Parameter(size_t nComponents) : nComponents(nComponents) {}
+Parameter::Parameter(size_t nComponents, InferencePrecision precision) : nComponents(nComponents), inferencePrecision(precision) {}
+
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(inferencePrecision == fullPrecision || inferencePrecision == bfloat16Precision || inferencePrecision == int8Precision,
+                  ErrorIncorrectParameter, ParameterName, inferencePrecisionStr());
+    return Status();
+}
 
 } // namespace interface1
 } // namespace transform
@@ -31,7 +31,6 @@
 
 #include "externals/service_blas.h"
 #include "externals/service_math.h"
-#include "service/kernel/service_unique_ptr.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "algorithms/kernel/service_error_handling.h"
 
@@ -90,10 +89,61 @@ services::Status ComputeInvSigmas(NumericTable * pVariances, TArray<algorithmFPT
     return status;
 }
 
+/*
+    Centering, normalization to unit variance and whitening are folded into the basis, so that the data blocks are not copied:
+    y = invEigenvalues * V * invSigmas * (x - means) = W * x - W * means,
+    where W = invEigenvalues * V * invSigmas is the scaled basis and W * means is the bias subtracted from the product of the block
+*/
+template <typename algorithmFPType, transform::Method method, CpuType cpu>
+services::Status TransformKernel<algorithmFPType, method, cpu>::computeScaledBasis(DAAL_INT numFeatures, DAAL_INT numComponents,
+                                                                                   const algorithmFPType * eigenvectors,
+                                                                                   const algorithmFPType * invSigmas,
+                                                                                   const algorithmFPType * invEigenvalues,
+                                                                                   const algorithmFPType * means, algorithmFPType * scaledBasis,
+                                                                                   algorithmFPType * bias)
+{
+    daal::threader_for(numComponents, numComponents, [=](int componentId) {
+        const algorithmFPType * pRow   = eigenvectors + componentId * numFeatures;
+        algorithmFPType * pScaledRow   = scaledBasis + componentId * numFeatures;
+        const algorithmFPType rowScale = invEigenvalues ? invEigenvalues[componentId] : algorithmFPType(1.0);
+
+        if (invSigmas)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t colId = 0; colId < numFeatures; ++colId)
+            {
+                pScaledRow[colId] = pRow[colId] * invSigmas[colId] * rowScale;
+            }
+        }
+        else
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t colId = 0; colId < numFeatures; ++colId)
+            {
+                pScaledRow[colId] = pRow[colId] * rowScale;
+            }
+        }
+
+        if (means)
+        {
+            algorithmFPType sum = algorithmFPType(0.0);
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t colId = 0; colId < numFeatures; ++colId)
+            {
+                sum += pScaledRow[colId] * means[colId];
+            }
+            bias[componentId] = sum;
+        }
+    });
+    return services::Status();
+}
+
 template <typename algorithmFPType, transform::Method method, CpuType cpu>
 services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans,
                                                                         NumericTable * pVariances, NumericTable * pEigenvalues,
-                                                                        NumericTable & transformedData)
+                                                                        NumericTable & transformedData, InferencePrecision precision)
 {
     DAAL_INT numVectors    = data.getNumberOfRows();
     DAAL_INT numFeatures   = data.getNumberOfColumns();
@@ -125,40 +175,45 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
     TArray<algorithmFPType, cpu> invEigenvalues(0);
     DAAL_CHECK_STATUS(status, ComputeInvSigmas(pEigenvalues, invEigenvalues, numComponents));
 
-    const algorithmFPType * pInvSigmas      = invSigmas.get();
-    const algorithmFPType * pInvEigenvalues = invEigenvalues.get();
-
-    size_t numInvSigmas = invSigmas.size();
-    size_t numMeans     = 0;
-
     const algorithmFPType * pRawMeans = nullptr;
     ReadRows<algorithmFPType, cpu> meansRows;
     if (pMeans != nullptr)
     {
-        numMeans = numFeatures;
-        meansRows.set(*pMeans, 0, numFeatures);
+        meansRows.set(*pMeans, 0, 1);
         DAAL_CHECK_BLOCK_STATUS(meansRows);
         pRawMeans = meansRows.get();
     }
 
-    bool isWhitening = pEigenvalues != nullptr;
-    bool isNormalize = pMeans != nullptr || pVariances != nullptr;
+    TArray<algorithmFPType, cpu> scaledBasis(0);
+    TArray<algorithmFPType, cpu> bias(0);
+    if (pMeans != nullptr || pVariances != nullptr || pEigenvalues != nullptr)
+    {
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numComponents, numFeatures);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numComponents * numFeatures, sizeof(algorithmFPType));
+        scaledBasis.reset(numComponents * numFeatures);
+        DAAL_CHECK_MALLOC(scaledBasis.get());
+        if (pRawMeans)
+        {
+            bias.reset(numComponents);
+            DAAL_CHECK_MALLOC(bias.get());
+        }
+        DAAL_CHECK_STATUS(status, computeScaledBasis(numFeatures, numComponents, pBasis, invSigmas.get(), invEigenvalues.get(), pRawMeans,
+                                                     scaledBasis.get(), bias.get()));
+        pBasis = scaledBasis.get();
+    }
+    const algorithmFPType * pBias = bias.get();
 
-    UniquePtr<daal::tls<algorithmFPType *>, cpu> tls;
-    if (isNormalize)
+    /* The basis is packed once for all blocks of the data */
+    algorithms::internal::ReducedPrecisionGemm<algorithmFPType, cpu> gemm;
+    if (precision != fullPrecision)
     {
-        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, numRowsInBlock * numFeatures * sizeof(algorithmFPType), sizeof(algorithmFPType));
-        tls.reset(new daal::tls<algorithmFPType *>([=]() {
-            return (algorithmFPType *)daal::services::internal::service_malloc<algorithmFPType, cpu>(numRowsInBlock * numFeatures
-                                                                                                     * sizeof(algorithmFPType));
-        }));
-        DAAL_CHECK_MALLOC(tls.get());
+        DAAL_CHECK_STATUS(status, gemm.init(precision, pBasis, numComponents, numFeatures, numFeatures));
     }
 
     SafeStatus safeStat;
 
     /* Loop over input data blocks */
-    daal::threader_for(numBlocks, numBlocks, [=, &tls, &transformedData, &data, &safeStat](int iBlock) {
+    daal::threader_for(numBlocks, numBlocks, [=, &transformedData, &data, &safeStat, &gemm](int iBlock) {
         size_t startRow = iBlock * numRowsInBlock;
         size_t endRow   = startRow + numRowsInBlock;
         if (endRow > numVectors)
@@ -169,7 +224,7 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         DAAL_INT numRows     = endRow - startRow;
         DAAL_INT numFeatures = data.getNumberOfColumns();
 
-        WriteRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
+        WriteOnlyRows<algorithmFPType, cpu> blockRows(transformedData, startRow, numRows);
         DAAL_CHECK_BLOCK_STATUS_THR(blockRows);
         algorithmFPType * pTransformedBlock = blockRows.get();
 
@@ -177,33 +232,18 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
         DAAL_CHECK_BLOCK_STATUS_THR(dataRows);
         const algorithmFPType * pDataBlock = dataRows.get();
 
-        if (isNormalize)
+        if (gemm.isReduced())
         {
-            algorithmFPType * pCopyBlock       = tls->local();
-            const algorithmFPType * pNormBlock = numMeans ? pCopyBlock : pDataBlock;
-            DAAL_CHECK_MALLOC_THR(pCopyBlock);
-            for (size_t rowId = 0; rowId < numRows; ++rowId)
-            {
-                /* compute centering if numMeans != 0 */
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numMeans; ++colId)
-                {
-                    pCopyBlock[rowId * numMeans + colId] = pDataBlock[rowId * numMeans + colId] - pRawMeans[colId];
-                }
-                /* compute normalization to unit variance if numInvSigmas!= 0 */
-                PRAGMA_IVDEP
-                PRAGMA_VECTOR_ALWAYS
-                for (size_t colId = 0; colId < numInvSigmas; ++colId)
-                {
-                    pCopyBlock[rowId * numInvSigmas + colId] = pNormBlock[rowId * numInvSigmas + colId] * pInvSigmas[colId];
-                }
-            }
-            pDataBlock = pCopyBlock;
+            services::Status s = gemm.compute(pDataBlock, numRows, numFeatures, pTransformedBlock, numComponents);
+            DAAL_CHECK_STATUS_THR(s);
+        }
+        else
+        {
+            computeTransformedBlock(&numRows, &numFeatures, (DAAL_INT *)&numComponents, pDataBlock, pBasis, pTransformedBlock);
         }
-        computeTransformedBlock(&numRows, &numFeatures, (DAAL_INT *)&numComponents, pDataBlock, pBasis, pTransformedBlock);
-        /* compute whitening to unit variance of transformed data if required */
-        if (isWhitening)
+
+        /* subtract the projection of the means */
+        if (pBias)
         {
             for (size_t rowId = 0; rowId < numRows; ++rowId)
             {
@@ -211,17 +251,12 @@ services::Status TransformKernel<algorithmFPType, method, cpu>::compute(NumericT
                 PRAGMA_VECTOR_ALWAYS
                 for (size_t colId = 0; colId < numComponents; ++colId)
                 {
-                    pTransformedBlock[rowId * numComponents + colId] = pTransformedBlock[rowId * numComponents + colId] * pInvEigenvalues[colId];
+                    pTransformedBlock[rowId * numComponents + colId] -= pBias[colId];
                 }
             }
         }
     }); /* daal::threader_for */
 
-    if (isNormalize)
-    {
-        tls->reduce([&](algorithmFPType * pCopyBlock) { daal_free(pCopyBlock); });
-    }
-
     return safeStat.detach();
 } /* void TransformKernel<algorithmFPType, defaultDense, cpu>::compute */
 
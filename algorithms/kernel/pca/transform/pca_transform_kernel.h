@@ -29,6 +29,7 @@
 #include "algorithms/kernel/kernel.h"
 #include "data_management/data/numeric_table.h"
 #include "externals/service_blas.h"
+#include "algorithms/kernel/service_reduced_precision_gemm.h"
 
 using namespace daal::data_management;
 
@@ -55,9 +56,10 @@ public:
      *  \param variances[in]        PCA variances
      *  \param eigenvalues[in]        PCA eigenvalues
      *  \param transformedData[out] Transformed data
+     *  \param precision[in]        Precision of the products of the data and the eigenvectors
      */
     services::Status compute(NumericTable & data, NumericTable & eigenvectors, NumericTable * pMeans, NumericTable * pVariances,
-                             NumericTable * pEigenvalues, NumericTable & transformedData);
+                             NumericTable * pEigenvalues, NumericTable & transformedData, InferencePrecision precision = fullPrecision);
 
     /**
     *  \brief Function that computes PCA transformation
@@ -74,6 +76,24 @@ public:
                                  const algorithmFPType * eigenvectors, algorithmFPType * resultBlock);
 
     static const size_t _numRowsInBlock = 256;
+
+protected:
+    /**
+    *  \brief Function that scales the eigenvectors by the inverse standard deviations of the features
+    *         and by the inverse square roots of the eigenvalues, and computes the projections of the means
+    *
+    *  \param numFeatures[in]      Number of features in input data row
+    *  \param numComponents[in]    Number of components
+    *  \param eigenvectors[in]     Eigenvectors
+    *  \param invSigmas[in]        Inverse standard deviations of the features, or nullptr if normalization is not required
+    *  \param invEigenvalues[in]   Inverse square roots of the eigenvalues, or nullptr if whitening is not required
+    *  \param means[in]            Means of the features, or nullptr if centering is not required
+    *  \param scaledBasis[out]     Scaled eigenvectors
+    *  \param bias[out]            Projections of the means on the scaled eigenvectors, set if means is not nullptr
+    */
+    services::Status computeScaledBasis(DAAL_INT numFeatures, DAAL_INT numComponents, const algorithmFPType * eigenvectors,
+                                        const algorithmFPType * invSigmas, const algorithmFPType * invEigenvalues, const algorithmFPType * means,
+                                        algorithmFPType * scaledBasis, algorithmFPType * bias);
 };
 } // namespace internal
 } // namespace transform
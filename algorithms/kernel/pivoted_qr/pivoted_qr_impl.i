@@ -29,6 +29,8 @@
 #include "externals/service_math.h"
 #include "service/kernel/service_defines.h"
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "algorithms/kernel/qr/qr_dense_default_tree_impl.i"
+#include "algorithms/threading/threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -136,6 +138,40 @@ services::Status PivotedQRKernel<method, algorithmFPType, cpu>::compute(const Nu
         }
     }
 
+    /* Tall-skinny matrices are split into at least two blocks per thread, each block has at least 2n rows */
+    const size_t nThreads = threader_get_threads_number();
+    size_t nBlocks        = 0;
+    if (nThreads > 1 && m >= 4 * n)
+    {
+        const size_t minBlockRows = 2 * n;
+        size_t blockRows          = m / (2 * nThreads);
+        blockRows                 = (blockRows < minBlockRows) ? minBlockRows : blockRows;
+        nBlocks                   = m / blockRows;
+    }
+
+    Status s = (nBlocks > 1) ? computeTSQR(dataTable, QTable, RTable, jpvt, nBlocks) : computeSeq(dataTable, QTable, RTable, jpvt);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockPi(PTable, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(blockPi);
+        algorithmFPType * Pi = blockPi.get();
+        for (size_t i = 0; i < n; i++)
+        {
+            Pi[i] = jpvt[i];
+        }
+    }
+
+    return Status();
+}
+
+template <daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+services::Status PivotedQRKernel<method, algorithmFPType, cpu>::computeSeq(const NumericTable & dataTable, NumericTable & QTable,
+                                                                           NumericTable & RTable, DAAL_INT * jpvt)
+{
+    const size_t n = dataTable.getNumberOfColumns();
+    const size_t m = dataTable.getNumberOfRows();
+
     DAAL_INT ldAi = m;
     DAAL_INT ldRi = n;
 
@@ -203,16 +239,130 @@ services::Status PivotedQRKernel<method, algorithmFPType, cpu>::compute(const Nu
         }
     }
 
+    return Status();
+}
+
+/*
+    Tall-skinny pivoted QR decomposition of A[m,n]:
+    ----------------------------------------------
+    1st step: split A into nBlocks blocks of rows and compute the QR decompositions a_k = q_k * r_k of the blocks in threads.
+    2nd step: reduce r_1 ... r_nBlocks by the binary tree of QR decompositions, so that A = Qt * Rt.
+    3rd step: compute the pivoted QR decomposition of the reduced factor Rt * P = Qr * R.
+              The column norms of Rt are the column norms of A, so that the pivoting is the same as for A.
+    4th step: the Q factor of A * P is Qt * Qr, the rows of the block k are q_k * M_k, M_k are the multipliers of the tree with
+              the root multiplier Qr. The products are computed in threads.
+
+    All the factors are stored in the column-major layout.
+*/
+template <daal::algorithms::pivoted_qr::Method method, typename algorithmFPType, CpuType cpu>
+services::Status PivotedQRKernel<method, algorithmFPType, cpu>::computeTSQR(const NumericTable & dataTable, NumericTable & QTable,
+                                                                            NumericTable & RTable, DAAL_INT * jpvt, size_t nBlocks)
+{
+    const size_t n         = dataTable.getNumberOfColumns();
+    const size_t m         = dataTable.getNumberOfRows();
+    const size_t blockRows = m / nBlocks;
+    const size_t rSize     = n * n;
+    const DAAL_INT ldq     = m;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, m);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * m, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, rSize, nBlocks);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, rSize * nBlocks, sizeof(algorithmFPType));
+    TArray<algorithmFPType, cpu> QTPtr(n * m);
+    TArray<algorithmFPType, cpu> RTPtr(rSize * nBlocks);
+    TArray<algorithmFPType, cpu> rootQPtr(rSize);
+    TArray<algorithmFPType, cpu> rootRPtr(rSize);
+    algorithmFPType * QT    = QTPtr.get();
+    algorithmFPType * RT    = RTPtr.get();
+    algorithmFPType * rootQ = rootQPtr.get();
+    algorithmFPType * rootR = rootRPtr.get();
+    DAAL_CHECK_MALLOC(QT && RT && rootQ && rootR);
+
+    /* the last block is generally bigger than the others */
+    auto getBlockSize = [=](size_t iBlock) -> size_t { return (iBlock == nBlocks - 1) ? m - iBlock * blockRows : blockRows; };
+
+    SafeStatus safeStat;
     {
-        WriteOnlyRows<algorithmFPType, cpu> blockPi(PTable, 0, 1);
-        DAAL_CHECK_BLOCK_STATUS(blockPi);
-        algorithmFPType * Pi = blockPi.get();
+        ReadRows<algorithmFPType, cpu> blockA(const_cast<NumericTable &>(dataTable), 0, m);
+        DAAL_CHECK_BLOCK_STATUS(blockA);
+        const algorithmFPType * A = blockA.get();
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t rowBegin = iBlock * blockRows;
+            const DAAL_INT nRows  = getBlockSize(iBlock);
+
+            for (size_t j = 0; j < n; j++)
+            {
+                PRAGMA_IVDEP
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    QT[j * m + rowBegin + i] = A[(rowBegin + i) * n + j];
+                }
+            }
+
+            /* the block is factorized in place, its R factor is stored in RT */
+            Status s = qr::internal::compute_QR_on_one_node_seq<algorithmFPType, cpu>(nRows, n, QT + rowBegin, ldq, RT + iBlock * rSize, n);
+            DAAL_CHECK_STATUS_THR(s);
+        });
+    }
+    DAAL_CHECK_SAFE_STATUS();
+
+    qr::internal::TSQRTreeReduction<algorithmFPType, cpu> tree;
+    Status s = tree.reduce(nBlocks, n, RT);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    for (size_t i = 0; i < rSize; i++)
+    {
+        rootQ[i] = RT[i];
+    }
+    ServiceStatus status = compute_pivoted_QR_on_one_node<algorithmFPType, cpu>(n, n, rootQ, n, rootR, n, jpvt);
+    if (status != SERV_ERR_OK)
+    {
+        if (status == SERV_ERR_MALLOC)
+            return Status(ErrorMemoryAllocationFailed);
+        else
+            return Status(ErrorPivotedQRInternal);
+    }
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockRi(RTable, 0, n);
+        DAAL_CHECK_BLOCK_STATUS(blockRi);
+        algorithmFPType * Ri = blockRi.get();
         for (size_t i = 0; i < n; i++)
         {
-            Pi[i] = jpvt[i];
+            for (size_t j = 0; j <= i; j++)
+            {
+                Ri[i + j * n] = rootR[i * n + j];
+            }
+            for (size_t j = i + 1; j < n; j++)
+            {
+                Ri[i + j * n] = 0.0;
+            }
         }
     }
 
+    /* the multipliers of the Q factors of the blocks replace the R factors */
+    s = tree.computeMultipliers(rootQ, RT);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu> blockQi(QTable, 0, m);
+        DAAL_CHECK_BLOCK_STATUS(blockQi);
+        algorithmFPType * Qi = blockQi.get();
+
+        /* the rows of the row-major Q in the block are (q_k * M_k)^T = M_k^T * q_k^T in the column-major layout */
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t rowBegin      = iBlock * blockRows;
+            const DAAL_INT nRows       = getBlockSize(iBlock);
+            const DAAL_INT nCols       = n;
+            const char trans           = 'T';
+            const algorithmFPType one  = 1.0;
+            const algorithmFPType zero = 0.0;
+            Blas<algorithmFPType, cpu>::xxgemm(&trans, &trans, &nCols, &nRows, &nCols, &one, RT + iBlock * rSize, &nCols, QT + rowBegin, &ldq, &zero,
+                                               Qi + rowBegin * n, &nCols);
+        });
+    }
+
     return Status();
 }
 
@@ -47,6 +47,13 @@ class PivotedQRKernel : public Kernel
 public:
     services::Status compute(const NumericTable & dataTable, NumericTable & QTable, NumericTable & RTable, NumericTable & PTable,
                              NumericTable * permutedColumns);
+
+private:
+    /* Pivoted QR decomposition of the whole matrix by one LAPACK call */
+    services::Status computeSeq(const NumericTable & dataTable, NumericTable & QTable, NumericTable & RTable, DAAL_INT * jpvt);
+
+    /* Tall-skinny QR decomposition of the row blocks followed by the pivoted QR decomposition of the reduced R factor */
+    services::Status computeTSQR(const NumericTable & dataTable, NumericTable & QTable, NumericTable & RTable, DAAL_INT * jpvt, size_t nBlocks);
 };
 
 } // namespace internal
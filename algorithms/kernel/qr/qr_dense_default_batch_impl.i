@@ -32,6 +32,7 @@
 #include "algorithms/kernel/service_error_handling.h"
 
 #include "algorithms/kernel/qr/qr_dense_default_impl.i"
+#include "algorithms/kernel/qr/qr_dense_default_tree_impl.i"
 
 #include "algorithms/threading/threading.h"
 
@@ -164,10 +165,11 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_seq(const size_t na,
                                a1[m1,n] -> q1[m1,n] , r1[n,n] ... ab[mb,n] -> qb[mb,n] and rb[n,n]
 
     2nd step:
-    Concatenate r1[n,n] , r2[n,n] ... rb[n,n] into one matrix B[n*b,n]
-    Compute QR decomposition for B[n*b,n] -> P[n*b,n] , R[n,n]. R - resulted matrix
+    Reduce r1[n,n] , r2[n,n] ... rb[n,n] by the binary tree of QR decompositions of the stacked pairs of factors
+    computed in threads on each level of the tree -> R[n,n]. R - resulted matrix.
+    The Q factors of the tree give the multipliers p1[n,n],p2[n,n]...pb[n,n] of the blocks
 
-    3rd step: Split P[n*b,n] matrix to 'b' blocks -> p1[n,n],p2[n,n]...pb[n,n]
+    3rd step:
     Multiply by q1..qb matrices from 1st step using GEMM for each block in threads:
                                q1[m1,n] * p1[n,n] -> q'1[m1,n] ... qb[mb,n] * pb[n,n] -> q'b[mb,n]
     Concatenate q'1[m1,n]...q'b[mb,n] into one resulted Q[m,n]  matrix.
@@ -217,10 +219,6 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na,
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, blocks);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, len, sizeof(algorithmFPType));
-    TArray<algorithmFPType, cpu> R_buffPtr(n * n);
-    algorithmFPType * R_buff = R_buffPtr.get();
-    DAAL_CHECK(R_buff, ErrorMemoryAllocationFailed);
-
     TArray<algorithmFPType, cpu> RT_buffPtr(len);
     algorithmFPType * RT_buff = RT_buffPtr.get();
     DAAL_CHECK(RT_buff, ErrorMemoryAllocationFailed);
@@ -244,10 +242,10 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na,
 
             TArrayScalable<algorithmFPType, cpu> QT_local_Arr(cols_local * brows_local);
             algorithmFPType * QT_local = QT_local_Arr.get();
-            TArrayScalable<algorithmFPType, cpu> RT_local_Arr(cols_local * cols_local);
-            algorithmFPType * RT_local = RT_local_Arr.get();
+            /* R of the block, lower values are zeros */
+            algorithmFPType * RT_local = RT_buff + k * cols_local * cols_local;
 
-            DAAL_CHECK_THR(QT_local && RT_local, ErrorMemoryAllocationFailed);
+            DAAL_CHECK_THR(QT_local, ErrorMemoryAllocationFailed);
 
             /* Get transposed Q from A */
             for (size_t i = 0; i < cols_local; i++)
@@ -272,33 +270,17 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na,
                     Q_block[i + j * cols_local] = QT_local[i * brows_local + j];
                 }
             }
-
-            /* Transpose R and zero lower values */
-            for (size_t i = 0; i < cols_local; i++)
-            {
-                size_t j;
-                PRAGMA_IVDEP
-                for (j = 0; j <= i; j++)
-                {
-                    RT_buff[k * cols_local + i * cols_local * blocks + j] = RT_local[i * cols_local + j];
-                }
-                PRAGMA_IVDEP
-                for (; j < cols_local; j++)
-                {
-                    RT_buff[k * cols_local + i * cols_local * blocks + j] = 0.0;
-                }
-            }
         });
     }
 
     DAAL_CHECK_SAFE_STATUS();
 
-    /* Step2: calculate QR on master node for resulted RB[blocks*n*n] */
-    /* ============================================================== */
+    /* Step2: reduce the R factors of the blocks by the binary tree, R is the first factor of RT_buff */
+    /* ============================================================================================ */
 
-    /* Call QR on master node for RB */
-    const auto ec = compute_QR_on_one_node_seq<algorithmFPType, cpu>(cols * blocks, cols, RT_buff, cols * blocks, R_buff, cols);
-    DAAL_CHECK_STATUS_VAR(ec);
+    TSQRTreeReduction<algorithmFPType, cpu> tree;
+    Status s = tree.reduce(blocks, cols, RT_buff);
+    DAAL_CHECK_STATUS_VAR(s);
 
     /* Transpose R */
     {
@@ -310,10 +292,15 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na,
             PRAGMA_IVDEP
             for (size_t j = 0; j < cols; j++)
             {
-                R_output[i + j * cols] = R_buff[i * cols + j];
+                R_output[i + j * cols] = RT_buff[i * cols + j];
             }
         }
     }
+
+    /* The multipliers of the Q factors of the blocks replace the R factors */
+    s = tree.computeMultipliers(NULL, RT_buff);
+    DAAL_CHECK_STATUS_VAR(s);
+
     /* Step3: calculate Q by merging Q*RB */
     /* ================================== */
 
@@ -326,22 +313,12 @@ Status QRBatchKernel<algorithmFPType, method, cpu>::compute_thr(const size_t na,
 
         TArrayScalable<algorithmFPType, cpu> QT_local_Arr(cols_local * brows_local);
         algorithmFPType * QT_local = QT_local_Arr.get();
-        TArrayScalable<algorithmFPType, cpu> RT_local_Arr(cols_local * cols_local);
-        algorithmFPType * RT_local = RT_local_Arr.get();
         TArrayScalable<algorithmFPType, cpu> QT_result_local_Arr(cols_local * brows_local);
         algorithmFPType * QT_result_local = QT_result_local_Arr.get();
 
-        DAAL_CHECK_THR(QT_local && QT_result_local && RT_local, ErrorMemoryAllocationFailed);
+        DAAL_CHECK_THR(QT_local && QT_result_local, ErrorMemoryAllocationFailed);
 
-        /* Transpose RB */
-        for (size_t i = 0; i < cols_local; i++)
-        {
-            PRAGMA_IVDEP
-            for (size_t j = 0; j < cols_local; j++)
-            {
-                RT_local[j * cols_local + i] = RT_buff[j * cols_local * blocks + k * cols_local + i];
-            }
-        }
+        algorithmFPType * RT_local = RT_buff + k * cols_local * cols_local;
 
         /* Transpose Q to QT */
         for (size_t i = 0; i < cols_local; i++)
@@ -0,0 +1,194 @@
+/* file: qr_dense_default_tree_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the binary tree reduction of the R factors for the tall-skinny QR decomposition
+//--
+*/
+
+#ifndef __QR_DENSE_DEFAULT_TREE_IMPL_I__
+#define __QR_DENSE_DEFAULT_TREE_IMPL_I__
+
+#include "externals/service_blas.h"
+#include "externals/service_memory.h"
+#include "service/kernel/service_arrays.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/qr/qr_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace qr
+{
+namespace internal
+{
+/*
+    Binary tree reduction of the R factors of the row blocks of a tall-skinny matrix A[m,n]:
+    ---------------------------------------------------------------------------------------
+    The leaves are the R factors r1[n,n] ... rb[n,n] of the QR decompositions of the blocks of A.
+    At each level the factors of the pairs of nodes are stacked into S[2n,n] = [r_left; r_right] and factorized: S = Qs[2n,n] * r[n,n],
+    the pairs are processed in parallel. The node without the pair is moved to the next level as is.
+    The R factor of the root is the R factor of A.
+
+    The Q factor of A in the rows of the block k is q_k * M_k, where M_k[n,n] is the product of the parts of Qs
+    on the way from the leaf k to the root: M_child = Qs_part(child) * M_parent, M_root = identity or the given matrix.
+
+    All the matrices are stored in the column-major layout.
+*/
+template <typename algorithmFPType, CpuType cpu>
+class TSQRTreeReduction
+{
+public:
+    TSQRTreeReduction() : _nBlocks(0), _n(0) {}
+
+    /**
+     *  \brief Reduces the R factors of nBlocks blocks stored one after another in r, each factor is n x n.
+     *         At output the first factor in r is the R factor of the whole matrix, the other factors are overwritten
+     */
+    Status reduce(size_t nBlocks, size_t n, algorithmFPType * r)
+    {
+        _nBlocks             = nBlocks;
+        _n                   = n;
+        const size_t rSize   = n * n;
+        const size_t nLevels = getNumberOfLevels();
+
+        size_t nPairsTotal = 0;
+        for (size_t level = 0, nNodes = nBlocks; level < nLevels; ++level, nNodes = (nNodes + 1) / 2) nPairsTotal += nNodes / 2;
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, 2 * rSize, nPairsTotal);
+        if (nPairsTotal)
+        {
+            _qs.reset(2 * rSize * nPairsTotal);
+            DAAL_CHECK_MALLOC(_qs.get());
+        }
+
+        SafeStatus safeStat;
+        size_t pairOffset = 0;
+        for (size_t level = 0, nNodes = nBlocks; level < nLevels; ++level, nNodes = (nNodes + 1) / 2)
+        {
+            const size_t nPairs = nNodes / 2;
+            const size_t stride = size_t(1) << level;
+            algorithmFPType * qsLevel = _qs.get() + 2 * rSize * pairOffset;
+
+            daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+                algorithmFPType * left  = r + (2 * iPair) * stride * rSize;
+                algorithmFPType * right = left + stride * rSize;
+                algorithmFPType * qs    = qsLevel + 2 * rSize * iPair;
+
+                /* S = [r_left; r_right] with the leading dimension 2n */
+                for (size_t j = 0; j < n; ++j)
+                {
+                    PRAGMA_IVDEP
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        qs[j * 2 * n + i]     = left[j * n + i];
+                        qs[j * 2 * n + n + i] = right[j * n + i];
+                    }
+                }
+
+                /* S is overwritten with Qs, the R factor of the pair replaces the left node */
+                Status s = compute_QR_on_one_node_seq<algorithmFPType, cpu>(2 * n, n, qs, 2 * n, left, n);
+                DAAL_CHECK_STATUS_THR(s);
+            });
+            DAAL_CHECK_SAFE_STATUS();
+            pairOffset += nPairs;
+        }
+        return Status();
+    }
+
+    /**
+     *  \brief Computes nBlocks multipliers M_k of the Q factors of the blocks stored one after another in m, each multiplier is n x n.
+     *         rootQ is the n x n multiplier of the root, identity is used if it is null
+     */
+    Status computeMultipliers(const algorithmFPType * rootQ, algorithmFPType * m) const
+    {
+        const size_t n     = _n;
+        const size_t rSize = n * n;
+
+        for (size_t i = 0; i < rSize; ++i) m[i] = rootQ ? rootQ[i] : algorithmFPType(0);
+        if (!rootQ)
+            for (size_t i = 0; i < n; ++i) m[i * n + i] = algorithmFPType(1);
+
+        const size_t nLevels = getNumberOfLevels();
+        if (!nLevels) return Status();
+
+        /* offsets of the Q factors of the pairs of the levels */
+        TArray<size_t, cpu> pairOffsets(nLevels);
+        TArray<size_t, cpu> nodeCounts(nLevels);
+        DAAL_CHECK_MALLOC(pairOffsets.get() && nodeCounts.get());
+        for (size_t level = 0, nNodes = _nBlocks, pairOffset = 0; level < nLevels; ++level, nNodes = (nNodes + 1) / 2)
+        {
+            pairOffsets[level] = pairOffset;
+            nodeCounts[level]  = nNodes;
+            pairOffset += nNodes / 2;
+        }
+
+        SafeStatus safeStat;
+        for (size_t l = nLevels; l > 0; --l)
+        {
+            const size_t level  = l - 1;
+            const size_t nPairs = nodeCounts[level] / 2;
+            const size_t stride = size_t(1) << level;
+            const algorithmFPType * qsLevel = _qs.get() + 2 * rSize * pairOffsets[level];
+
+            /* the multiplier of the parent is stored in the place of the left child */
+            daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+                algorithmFPType * mLeft  = m + (2 * iPair) * stride * rSize;
+                algorithmFPType * mRight = mLeft + stride * rSize;
+                const algorithmFPType * qs = qsLevel + 2 * rSize * iPair;
+
+                TArrayScalable<algorithmFPType, cpu> mParentArr(rSize);
+                algorithmFPType * mParent = mParentArr.get();
+                DAAL_CHECK_THR(mParent, ErrorMemoryAllocationFailed);
+                for (size_t i = 0; i < rSize; ++i) mParent[i] = mLeft[i];
+
+                const char notrans         = 'N';
+                const algorithmFPType one  = 1.0;
+                const algorithmFPType zero = 0.0;
+                const DAAL_INT nn          = n;
+                const DAAL_INT ldqs        = 2 * n;
+
+                Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &nn, &nn, &nn, &one, qs, &ldqs, mParent, &nn, &zero, mLeft, &nn);
+                Blas<algorithmFPType, cpu>::xxgemm(&notrans, &notrans, &nn, &nn, &nn, &one, qs + n, &ldqs, mParent, &nn, &zero, mRight, &nn);
+            });
+            DAAL_CHECK_SAFE_STATUS();
+        }
+        return Status();
+    }
+
+private:
+    size_t getNumberOfLevels() const
+    {
+        size_t nLevels = 0;
+        for (size_t nNodes = _nBlocks; nNodes > 1; nNodes = (nNodes + 1) / 2) ++nLevels;
+        return nLevels;
+    }
+
+    size_t _nBlocks;
+    size_t _n;
+    TArray<algorithmFPType, cpu> _qs; /* Q factors of the pairs of all the levels, 2n x n each */
+};
+
+} // namespace internal
+} // namespace qr
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -37,7 +37,7 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::Parameter(), quantileOrders(quantileOrders), compression(100)
 {
     Status s;
     if (quantileOrders.get() == NULL)
@@ -47,8 +47,26 @@ Parameter::Parameter(const NumericTablePtr quantileOrders) : daal::algorithms::P
     }
 }
 
-Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
-Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+Status Parameter::check() const
+{
+    DAAL_CHECK_EX(compression > 0, ErrorIncorrectParameter, ParameterName, compressionStr());
+    return Status();
+}
+
+Input::Input() : InputIface(lastInputId + 1) {}
+Input::Input(const Input & other) : InputIface(other) {}
+
+/**
+ * Returns the number of features in the input data set
+ * \param[out] nFeatures Number of features
+ */
+Status Input::getNumberOfFeatures(size_t & nFeatures) const
+{
+    NumericTablePtr dataTable = get(data);
+    Status s                  = checkNumericTable(dataTable.get(), dataStr());
+    nFeatures                 = (s ? dataTable->getNumberOfColumns() : 0);
+    return s;
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -121,15 +139,37 @@ Status Result::check(const daal::algorithms::Input * in, const daal::algorithms:
     Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
     if (!s) return s;
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    return checkImpl(par, input->get(data)->getNumberOfColumns());
+}
+
+/**
+ * Checks the correctness of the Result object in the online and distributed processing modes
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameters structure
+ * \param[in] method        Algorithm computation method
+ */
+Status Result::check(const daal::algorithms::PartialResult * partialResult, const daal::algorithms::Parameter * par, int method) const
+{
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+
+    Status s = checkNumericTable(parameter->quantileOrders.get(), quantileOrdersStr(), 0, 0, 0, 1);
+    if (!s) return s;
+
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const PartialResult *>(partialResult)->getNumberOfFeatures(nFeatures));
+    return checkImpl(par, nFeatures);
+}
+
+Status Result::checkImpl(const daal::algorithms::Parameter * par, size_t nFeatures) const
+{
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+    size_t nQuantileOrders      = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)NumericTableIface::csrArray | (int)NumericTableIface::upperPackedTriangularMatrix
                             | (int)NumericTableIface::lowerPackedTriangularMatrix | (int)NumericTableIface::upperPackedSymmetricMatrix
                             | (int)NumericTableIface::lowerPackedSymmetricMatrix;
 
-    s |= checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors);
-    return s;
+    return checkNumericTable(get(quantiles).get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures);
 }
 
 } // namespace interface1
@@ -25,9 +25,11 @@
 #define __QUANTILES_IMPL__
 
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
 #include "externals/service_memory.h"
-#include "externals/service_math.h"
-#include "externals/service_stat.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_sort.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -40,6 +42,10 @@ namespace quantiles
 {
 namespace internal
 {
+/* Quantile of the order q is the linear interpolation between the order statistics x(j) and x(j + 1),
+   j = floor((n - 1) * q), the same definition as used by the summary statistics of Intel(R) MKL.
+   Features are processed in parallel, the order statistics of a feature are found with the multi-selection
+   that partitions only the parts of the column containing the required ranks */
 template <Method method, typename algorithmFPType, CpuType cpu>
 services::Status QuantilesKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable,
                                                                         NumericTable & quantilesTable)
@@ -47,34 +53,72 @@ services::Status QuantilesKernel<method, algorithmFPType, cpu>::compute(const Nu
     const size_t nFeatures       = dataTable.getNumberOfColumns();
     const size_t nVectors        = dataTable.getNumberOfRows();
     const size_t nQuantileOrders = quantilesTable.getNumberOfColumns();
-
-    ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), 0, nVectors);
-    DAAL_CHECK_BLOCK_STATUS(dataBlock)
-    const algorithmFPType * data = dataBlock.get();
+    DAAL_CHECK(nVectors, services::ErrorQuantilesInternal);
 
     ReadRows<algorithmFPType, cpu> quantilesQrderBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
     DAAL_CHECK_BLOCK_STATUS(quantilesQrderBlock)
     const algorithmFPType * quantileOrders = quantilesQrderBlock.get();
 
+    /* Ranks of the order statistics x(j) and x(j + 1) for every quantile order, sorted and unique */
+    TArray<size_t, cpu> lowerRanks(nQuantileOrders);
+    TArray<size_t, cpu> ranksArray(2 * nQuantileOrders);
+    DAAL_CHECK_MALLOC(lowerRanks.get() && ranksArray.get());
+    size_t * ranks = ranksArray.get();
+    for (size_t i = 0; i < nQuantileOrders; i++)
+    {
+        const algorithmFPType order = quantileOrders[i];
+        DAAL_CHECK(order >= algorithmFPType(0) && order <= algorithmFPType(1), services::ErrorQuantileOrderValueIsInvalid);
+
+        const size_t lowerRank = (size_t)(order * algorithmFPType(nVectors - 1));
+        lowerRanks[i]          = (lowerRank < nVectors - 1) ? lowerRank : nVectors - 1;
+        ranks[2 * i]           = lowerRanks[i];
+        ranks[2 * i + 1]       = (lowerRanks[i] + 1 < nVectors) ? lowerRanks[i] + 1 : lowerRanks[i];
+    }
+    algorithms::internal::introSort<cpu>(ranks, ranks + 2 * nQuantileOrders, [](size_t a, size_t b) { return a < b; });
+    size_t nRanks = 0;
+    for (size_t i = 0; i < 2 * nQuantileOrders; i++)
+    {
+        if (!nRanks || ranks[nRanks - 1] != ranks[i]) ranks[nRanks++] = ranks[i];
+    }
+
     WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
     DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
     algorithmFPType * quantiles = quantilesBlock.get();
 
-    int errorcode = Statistics<algorithmFPType, cpu>::xQuantiles(data, nFeatures, nVectors, nQuantileOrders, quantileOrders, quantiles);
+    daal::tls<algorithmFPType *> tlsColumn(
+        [=]() -> algorithmFPType * { return services::internal::service_scalable_malloc<algorithmFPType, cpu>(nVectors); });
 
-    if (errorcode)
-    {
-        if (errorcode == __DAAL_VSL_SS_ERROR_BAD_QUANT_ORDER)
+    SafeStatus safeStat;
+    daal::threader_for(nFeatures, nFeatures, [&](size_t iFeature) {
+        algorithmFPType * const column = tlsColumn.local();
+        DAAL_CHECK_MALLOC_THR(column);
+
+        ReadColumns<algorithmFPType, cpu> columnBlock(const_cast<NumericTable &>(dataTable), iFeature, 0, nVectors);
+        DAAL_CHECK_BLOCK_STATUS_THR(columnBlock);
+        const algorithmFPType * const data = columnBlock.get();
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < nVectors; i++)
         {
-            return Status(services::ErrorQuantileOrderValueIsInvalid);
+            column[i] = data[i];
         }
-        else
+
+        algorithms::internal::multiSelect<cpu>(column, column + nVectors, ranks, nRanks, [](algorithmFPType a, algorithmFPType b) { return a < b; });
+
+        algorithmFPType * const featureQuantiles = quantiles + iFeature * nQuantileOrders;
+        for (size_t i = 0; i < nQuantileOrders; i++)
         {
-            return Status(services::ErrorQuantilesInternal);
+            const size_t j               = lowerRanks[i];
+            const algorithmFPType lower  = column[j];
+            const algorithmFPType upper  = (j + 1 < nVectors) ? column[j + 1] : lower;
+            const algorithmFPType weight = quantileOrders[i] * algorithmFPType(nVectors - 1) - algorithmFPType(j);
+            featureQuantiles[i]          = lower + weight * (upper - lower);
         }
-    }
+    });
 
-    return Status();
+    tlsColumn.reduce([](algorithmFPType * buffer) { services::internal::service_scalable_free<algorithmFPType, cpu>(buffer); });
+    return safeStat.detach();
 }
 
 } // namespace internal
@@ -25,7 +25,10 @@
 #define __QUANTILES_KERNEL_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 
 #include "service/kernel/service_defines.h"
 #include "service/kernel/data_management/service_micro_table.h"
@@ -47,6 +50,22 @@ struct QuantilesKernel : public Kernel
     services::Status compute(const NumericTable & dataTable, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
 };
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    services::Status compute(const NumericTable & dataTable, PartialResult & partialResult, const Parameter & parameter);
+    services::Status finalizeCompute(const PartialResult & partialResult, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    services::Status compute(const DataCollection & partialResults, PartialResult & partialResult, const Parameter & parameter);
+    services::Status finalizeCompute(const PartialResult & partialResult, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable);
+};
+
 } // namespace internal
 
 } // namespace quantiles
@@ -0,0 +1,201 @@
+/* file: quantiles_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result and the distributed input of the quantiles algorithm.
+//--
+*/
+
+#include "algorithms/quantiles/quantiles_types.h"
+#include "service/kernel/serialization_utils.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(lastPartialResultId + 1) {}
+
+/**
+ * Returns the number of features in the partial result of the quantiles algorithm
+ * \param[out] nFeatures Number of features
+ */
+Status PartialResult::getNumberOfFeatures(size_t & nFeatures) const
+{
+    NumericTablePtr ntPtr = get(partialMinimum);
+    Status s              = checkNumericTable(ntPtr.get(), partialMinimumStr());
+    nFeatures             = (s ? ntPtr->getNumberOfRows() : 0);
+    return s;
+}
+
+/**
+ * Returns the partial result of the quantiles algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantiles algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] parameter %Parameter of the algorithm
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfFeatures(nFeatures));
+    return checkImpl(parameter, nFeatures);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+Status PartialResult::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, static_cast<const InputIface *>(input)->getNumberOfFeatures(nFeatures));
+    return checkImpl(parameter, nFeatures);
+}
+
+Status PartialResult::checkImpl(const daal::algorithms::Parameter * parameter, size_t nFeatures) const
+{
+    Status s;
+    const size_t capacity       = 2 * static_cast<const Parameter *>(parameter)->compression;
+    const int unexpectedLayouts = (int)packed_mask;
+
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialCentroidMeans).get(), partialCentroidMeansStr(), unexpectedLayouts, 0, capacity, nFeatures));
+    DAAL_CHECK_STATUS(s,
+                      checkNumericTable(get(partialCentroidWeights).get(), partialCentroidWeightsStr(), unexpectedLayouts, 0, capacity, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMinimum).get(), partialMinimumStr(), unexpectedLayouts, 0, 1, nFeatures));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(partialMaximum).get(), partialMaximumStr(), unexpectedLayouts, 0, 1, nFeatures));
+    return s;
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput() : InputIface(lastMasterInputId + 1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+template <>
+DistributedInput<step2Master>::DistributedInput(const DistributedInput<step2Master> & other) : InputIface(other)
+{}
+
+/**
+ * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+template <>
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr & partialResult)
+{
+    DataCollectionPtr collection = staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets input object for the quantiles algorithm in the distributed processing mode
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+template <>
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr & ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of distributed input objects
+ */
+template <>
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Returns the number of features in the partial results
+ * \param[out] nFeatures Number of features
+ */
+template <>
+Status DistributedInput<step2Master>::getNumberOfFeatures(size_t & nFeatures) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    DAAL_CHECK(collection, ErrorNullInputDataCollection);
+    DAAL_CHECK(collection->size(), ErrorIncorrectNumberOfInputNumericTables);
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    DAAL_CHECK(partialResult, ErrorIncorrectElementInPartialResultCollection);
+    return partialResult->getNumberOfFeatures(nFeatures);
+}
+
+/**
+ * Checks algorithm parameters on the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <>
+Status DistributedInput<step2Master>::check(const daal::algorithms::Parameter * parameter, int method) const
+{
+    Status s;
+    size_t nFeatures = 0;
+    DAAL_CHECK_STATUS(s, getNumberOfFeatures(nFeatures));
+
+    DataCollectionPtr collection = get(partialResults);
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        DAAL_CHECK(partialResult, ErrorIncorrectElementInPartialResultCollection);
+        DAAL_CHECK_STATUS(s, partialResult->check(this, parameter, method));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
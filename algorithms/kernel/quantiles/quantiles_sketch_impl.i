@@ -0,0 +1,414 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the t-digest sketch used by the quantiles algorithm
+//  in the online and distributed processing modes
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "externals/service_math.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/threading/threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+/* Number of rows of the data set that are sorted and merged into the sketches at once */
+const size_t sketchBlockSize = 1024;
+
+/* Scale function of the sketch, k(q) in terms of t-digest. It grows as the square root of the distance to the tails,
+   as the arcsine scale function does, so the centroids near the minimum and the maximum hold few observations.
+   The range of the function is [0, compression / 2] */
+template <typename algorithmFPType, CpuType cpu>
+DAAL_FORCEINLINE algorithmFPType sketchScale(algorithmFPType q, algorithmFPType compression)
+{
+    const algorithmFPType quarter = compression / 4;
+    if (q < (algorithmFPType)0.5) return quarter * Math<algorithmFPType, cpu>::sSqrt(2 * q);
+    q = (q < (algorithmFPType)1 ? q : (algorithmFPType)1);
+    return quarter * (2 - Math<algorithmFPType, cpu>::sSqrt(2 * (1 - q)));
+}
+
+/* Merges weighted points into the sketch of one feature.
+   The sketch is stored in the row of the partial result: centroids sorted by the means, unused trailing slots have zero weight */
+template <typename algorithmFPType, CpuType cpu>
+class SketchMerger
+{
+public:
+    SketchMerger(size_t capacity, size_t maxPoints)
+        : _means(capacity + maxPoints), _weights(capacity + maxPoints), _points(maxPoints), _sortBuffer(maxPoints)
+    {}
+
+    bool isValid() const { return _means.get() && _weights.get() && _points.get() && _sortBuffer.get(); }
+
+    /* Buffer for maxPoints points of the caller */
+    algorithmFPType * points() { return _points.get(); }
+
+    /* Buffer for maxPoints points used by the radix sort of the caller */
+    algorithmFPType * sortBuffer() { return _sortBuffer.get(); }
+
+    /* Merges points sorted in ascending order into the sketch and compresses the result.
+       Points have unit weights if pointWeights is null */
+    void merge(algorithmFPType * means, algorithmFPType * weights, size_t capacity, const algorithmFPType * pointMeans,
+               const algorithmFPType * pointWeights, size_t nPoints, algorithmFPType compression)
+    {
+        algorithmFPType * const mergedMeans   = _means.get();
+        algorithmFPType * const mergedWeights = _weights.get();
+
+        size_t nCentroids = 0;
+        while (nCentroids < capacity && weights[nCentroids] > 0) nCentroids++;
+
+        size_t n              = 0;
+        algorithmFPType total = 0;
+        for (size_t i = 0, j = 0; i < nCentroids || j < nPoints;)
+        {
+            const algorithmFPType pointWeight = (j < nPoints ? (pointWeights ? pointWeights[j] : (algorithmFPType)1) : (algorithmFPType)0);
+            if (j < nPoints && !(pointWeight > 0))
+            {
+                j++;
+                continue;
+            }
+            if (j == nPoints || (i < nCentroids && means[i] <= pointMeans[j]))
+            {
+                mergedMeans[n]   = means[i];
+                mergedWeights[n] = weights[i];
+                i++;
+            }
+            else
+            {
+                mergedMeans[n]   = pointMeans[j];
+                mergedWeights[n] = pointWeight;
+                j++;
+            }
+            total += mergedWeights[n++];
+        }
+
+        compress(mergedMeans, mergedWeights, n, total, means, weights, capacity, compression);
+    }
+
+private:
+    /* Greedily merges the neighboring centroids while the merged centroid spans at most one unit of the scale function.
+       Any two neighbors of the result span more than one unit together, so at most compression + 1 centroids remain */
+    static void compress(const algorithmFPType * means, const algorithmFPType * weights, size_t n, algorithmFPType total,
+                         algorithmFPType * sketchMeans, algorithmFPType * sketchWeights, size_t capacity, algorithmFPType compression)
+    {
+        size_t nSketch = 0;
+        if (n)
+        {
+            algorithmFPType weightBefore = 0;
+            algorithmFPType scaleLeft    = 0;
+            algorithmFPType mean         = means[0];
+            algorithmFPType weight       = weights[0];
+            for (size_t k = 1; k < n; k++)
+            {
+                const algorithmFPType scaleRight = sketchScale<algorithmFPType, cpu>((weightBefore + weight + weights[k]) / total, compression);
+                if (scaleRight - scaleLeft <= 1 || nSketch + 1 == capacity)
+                {
+                    weight += weights[k];
+                    mean += (means[k] - mean) * weights[k] / weight;
+                }
+                else
+                {
+                    sketchMeans[nSketch]   = mean;
+                    sketchWeights[nSketch] = weight;
+                    nSketch++;
+
+                    weightBefore += weight;
+                    scaleLeft = sketchScale<algorithmFPType, cpu>(weightBefore / total, compression);
+                    mean      = means[k];
+                    weight    = weights[k];
+                }
+            }
+            sketchMeans[nSketch]   = mean;
+            sketchWeights[nSketch] = weight;
+            nSketch++;
+        }
+
+        for (size_t k = nSketch; k < capacity; k++)
+        {
+            sketchMeans[k]   = 0;
+            sketchWeights[k] = 0;
+        }
+    }
+
+    TArray<algorithmFPType, cpu> _means;
+    TArray<algorithmFPType, cpu> _weights;
+    TArray<algorithmFPType, cpu> _points;
+    TArray<algorithmFPType, cpu> _sortBuffer;
+};
+
+/* Interpolates the quantile of the order between the centers of the centroids.
+   The center of the centroid is placed at the middle of its weight, the tails are interpolated up to the minimum and the maximum */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType sketchQuantile(const algorithmFPType * means, const algorithmFPType * weights, size_t capacity, algorithmFPType minimum,
+                               algorithmFPType maximum, algorithmFPType order)
+{
+    size_t nCentroids     = 0;
+    algorithmFPType total = 0;
+    for (; nCentroids < capacity && weights[nCentroids] > 0; nCentroids++)
+    {
+        total += weights[nCentroids];
+    }
+    if (!nCentroids) return 0;
+
+    const algorithmFPType target = order * total;
+
+    algorithmFPType center = weights[0] / 2;
+    if (target <= center)
+    {
+        return minimum + (means[0] - minimum) * target / center;
+    }
+
+    algorithmFPType weightBefore = 0;
+    for (size_t k = 0; k + 1 < nCentroids; k++)
+    {
+        const algorithmFPType nextCenter = weightBefore + weights[k] + weights[k + 1] / 2;
+        if (target <= nextCenter)
+        {
+            return means[k] + (means[k + 1] - means[k]) * (target - center) / (nextCenter - center);
+        }
+        weightBefore += weights[k];
+        center = nextCenter;
+    }
+
+    const algorithmFPType last = means[nCentroids - 1];
+    const algorithmFPType tail = total - center;
+    return (tail > 0 ? last + (maximum - last) * (target - center) / tail : last);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+services::Status computeSketchQuantiles(const PartialResult & partialResult, const NumericTable & quantileOrdersTable, NumericTable & quantilesTable)
+{
+    NumericTable & meansTable   = *partialResult.get(partialCentroidMeans);
+    NumericTable & weightsTable = *partialResult.get(partialCentroidWeights);
+    const size_t nFeatures      = meansTable.getNumberOfRows();
+    const size_t capacity       = meansTable.getNumberOfColumns();
+    const size_t nOrders        = quantilesTable.getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> meansBlock(meansTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(meansBlock)
+    ReadRows<algorithmFPType, cpu> weightsBlock(weightsTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    ReadRows<algorithmFPType, cpu> minimumBlock(partialResult.get(partialMinimum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    ReadRows<algorithmFPType, cpu> maximumBlock(partialResult.get(partialMaximum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    ReadRows<algorithmFPType, cpu> ordersBlock(const_cast<NumericTable &>(quantileOrdersTable), 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(ordersBlock)
+    const algorithmFPType * orders = ordersBlock.get();
+    for (size_t i = 0; i < nOrders; i++)
+    {
+        DAAL_CHECK(orders[i] >= 0 && orders[i] <= 1, services::ErrorQuantileOrderValueIsInvalid);
+    }
+
+    WriteOnlyRows<algorithmFPType, cpu> quantilesBlock(quantilesTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(quantilesBlock)
+
+    const algorithmFPType * means   = meansBlock.get();
+    const algorithmFPType * weights = weightsBlock.get();
+    const algorithmFPType * minimum = minimumBlock.get();
+    const algorithmFPType * maximum = maximumBlock.get();
+    algorithmFPType * quantiles     = quantilesBlock.get();
+
+    daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+        for (size_t i = 0; i < nOrders; i++)
+        {
+            quantiles[j * nOrders + i] =
+                sketchQuantile<algorithmFPType, cpu>(means + j * capacity, weights + j * capacity, capacity, minimum[j], maximum[j], orders[i]);
+        }
+    });
+    return services::Status();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable & dataTable, PartialResult & partialResult,
+                                                                              const Parameter & parameter)
+{
+    typedef SketchMerger<algorithmFPType, cpu> Merger;
+
+    const size_t nFeatures            = dataTable.getNumberOfColumns();
+    const size_t nVectors             = dataTable.getNumberOfRows();
+    NumericTable & meansTable         = *partialResult.get(partialCentroidMeans);
+    const size_t capacity             = meansTable.getNumberOfColumns();
+    const algorithmFPType compression = (algorithmFPType)parameter.compression;
+
+    WriteRows<algorithmFPType, cpu> meansBlock(meansTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(meansBlock)
+    WriteRows<algorithmFPType, cpu> weightsBlock(partialResult.get(partialCentroidWeights).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    WriteRows<algorithmFPType, cpu> minimumBlock(partialResult.get(partialMinimum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    WriteRows<algorithmFPType, cpu> maximumBlock(partialResult.get(partialMaximum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    algorithmFPType * means   = meansBlock.get();
+    algorithmFPType * weights = weightsBlock.get();
+    algorithmFPType * minimum = minimumBlock.get();
+    algorithmFPType * maximum = maximumBlock.get();
+
+    const size_t blockSize = (nVectors < sketchBlockSize ? nVectors : sketchBlockSize);
+    daal::tls<Merger *> tlsMerger([=]() -> Merger * { return new Merger(capacity, blockSize); });
+
+    SafeStatus safeStat;
+    for (size_t start = 0; start < nVectors && safeStat.ok(); start += blockSize)
+    {
+        const size_t nRows = (nVectors - start < blockSize ? nVectors - start : blockSize);
+
+        ReadRows<algorithmFPType, cpu> dataBlock(const_cast<NumericTable &>(dataTable), start, nRows);
+        safeStat |= dataBlock.status();
+        if (!safeStat) break;
+        const algorithmFPType * data = dataBlock.get();
+
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+            Merger * merger = tlsMerger.local();
+            if (!merger || !merger->isValid())
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+
+            algorithmFPType * values = merger->points();
+            for (size_t i = 0; i < nRows; i++)
+            {
+                values[i] = data[i * nFeatures + j];
+            }
+            services::Status sortStatus = daal::algorithms::internal::radixSort<cpu, algorithmFPType>(values, merger->sortBuffer(), nRows);
+            DAAL_CHECK_STATUS_THR(sortStatus);
+
+            algorithmFPType * featureWeights = weights + j * capacity;
+            const bool isEmpty               = !(featureWeights[0] > 0);
+            minimum[j]                       = (isEmpty ? values[0] : Math<algorithmFPType, cpu>::sMin(minimum[j], values[0]));
+            maximum[j]                       = (isEmpty ? values[nRows - 1] : Math<algorithmFPType, cpu>::sMax(maximum[j], values[nRows - 1]));
+
+            merger->merge(means + j * capacity, featureWeights, capacity, values, nullptr, nRows, compression);
+        });
+    }
+
+    tlsMerger.reduce([](Merger * merger) -> void { delete merger; });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const PartialResult & partialResult,
+                                                                                      const NumericTable & quantileOrdersTable,
+                                                                                      NumericTable & quantilesTable)
+{
+    return computeSketchQuantiles<algorithmFPType, cpu>(partialResult, quantileOrdersTable, quantilesTable);
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(const DataCollection & partialResults,
+                                                                                   PartialResult & partialResult, const Parameter & parameter)
+{
+    typedef SketchMerger<algorithmFPType, cpu> Merger;
+
+    NumericTable & meansTable         = *partialResult.get(partialCentroidMeans);
+    const size_t nFeatures            = meansTable.getNumberOfRows();
+    const size_t capacity             = meansTable.getNumberOfColumns();
+    const algorithmFPType compression = (algorithmFPType)parameter.compression;
+
+    WriteRows<algorithmFPType, cpu> meansBlock(meansTable, 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(meansBlock)
+    WriteRows<algorithmFPType, cpu> weightsBlock(partialResult.get(partialCentroidWeights).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(weightsBlock)
+    WriteRows<algorithmFPType, cpu> minimumBlock(partialResult.get(partialMinimum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(minimumBlock)
+    WriteRows<algorithmFPType, cpu> maximumBlock(partialResult.get(partialMaximum).get(), 0, nFeatures);
+    DAAL_CHECK_BLOCK_STATUS(maximumBlock)
+
+    algorithmFPType * means   = meansBlock.get();
+    algorithmFPType * weights = weightsBlock.get();
+    algorithmFPType * minimum = minimumBlock.get();
+    algorithmFPType * maximum = maximumBlock.get();
+
+    daal::tls<Merger *> tlsMerger([=]() -> Merger * { return new Merger(capacity, capacity); });
+
+    SafeStatus safeStat;
+    for (size_t k = 0; k < partialResults.size() && safeStat.ok(); k++)
+    {
+        const PartialResult * localResult = static_cast<const PartialResult *>(partialResults[k].get());
+
+        ReadRows<algorithmFPType, cpu> localMeansBlock(localResult->get(partialCentroidMeans).get(), 0, nFeatures);
+        ReadRows<algorithmFPType, cpu> localWeightsBlock(localResult->get(partialCentroidWeights).get(), 0, nFeatures);
+        ReadRows<algorithmFPType, cpu> localMinimumBlock(localResult->get(partialMinimum).get(), 0, nFeatures);
+        ReadRows<algorithmFPType, cpu> localMaximumBlock(localResult->get(partialMaximum).get(), 0, nFeatures);
+        safeStat |= localMeansBlock.status();
+        safeStat |= localWeightsBlock.status();
+        safeStat |= localMinimumBlock.status();
+        safeStat |= localMaximumBlock.status();
+        if (!safeStat) break;
+
+        const algorithmFPType * localMeans   = localMeansBlock.get();
+        const algorithmFPType * localWeights = localWeightsBlock.get();
+        const algorithmFPType * localMinimum = localMinimumBlock.get();
+        const algorithmFPType * localMaximum = localMaximumBlock.get();
+
+        daal::threader_for(nFeatures, nFeatures, [&](size_t j) {
+            const algorithmFPType * pointWeights = localWeights + j * capacity;
+            if (!(pointWeights[0] > 0)) return;
+
+            Merger * merger = tlsMerger.local();
+            if (!merger || !merger->isValid())
+            {
+                safeStat.add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+
+            algorithmFPType * featureWeights = weights + j * capacity;
+            const bool isEmpty               = !(featureWeights[0] > 0);
+            minimum[j]                       = (isEmpty ? localMinimum[j] : Math<algorithmFPType, cpu>::sMin(minimum[j], localMinimum[j]));
+            maximum[j]                       = (isEmpty ? localMaximum[j] : Math<algorithmFPType, cpu>::sMax(maximum[j], localMaximum[j]));
+
+            merger->merge(means + j * capacity, featureWeights, capacity, localMeans + j * capacity, pointWeights, capacity, compression);
+        });
+    }
+
+    tlsMerger.reduce([](Merger * merger) -> void { delete merger; });
+    return safeStat.detach();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+services::Status QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(const PartialResult & partialResult,
+                                                                                           const NumericTable & quantileOrdersTable,
+                                                                                           NumericTable & quantilesTable)
+{
+    return computeSketchQuantiles<algorithmFPType, cpu>(partialResult, quantileOrdersTable, quantilesTable);
+}
+
+} // namespace internal
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
+
+#endif
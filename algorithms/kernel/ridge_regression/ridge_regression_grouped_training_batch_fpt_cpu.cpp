@@ -0,0 +1,49 @@
+/* file: ridge_regression_grouped_training_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the grouped ridge regression training kernels.
+//--
+*/
+
+#include "algorithms/kernel/ridge_regression/ridge_regression_grouped_training_container.h"
+#include "algorithms/kernel/ridge_regression/ridge_regression_grouped_training_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+} // namespace interface1
+
+namespace internal
+{
+template class GroupedTrainBatchKernel<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+} // namespace internal
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
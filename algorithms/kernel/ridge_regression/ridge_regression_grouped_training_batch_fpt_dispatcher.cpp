@@ -0,0 +1,33 @@
+/* file: ridge_regression_grouped_training_batch_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training container.
+//--
+*/
+
+#include "algorithms/kernel/ridge_regression/ridge_regression_grouped_training_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(ridge_regression::grouped_training::BatchContainer, batch, DAAL_FPTYPE,
+                                      ridge_regression::grouped_training::defaultDense)
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,78 @@
+/* file: ridge_regression_grouped_training_container.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training container.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_CONTAINER_H__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_CONTAINER_H__
+
+#include "algorithms/kernel/kernel.h"
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_batch.h"
+#include "algorithms/kernel/ridge_regression/ridge_regression_grouped_training_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+using namespace daal::data_management;
+using namespace daal::services;
+
+/**
+ *  \brief Initialize list of the grouped ridge regression training kernels with implementations for supported architectures
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::GroupedTrainBatchKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+/**
+ *  \brief Choose appropriate kernel to train the ridge regression models of the segments
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input * const input   = static_cast<Input *>(_in);
+    Result * const result = static_cast<Result *>(_res);
+    Parameter * const par = static_cast<Parameter *>(_par);
+
+    daal::services::Environment::env & env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::GroupedTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
+                       *(input->get(dependentVariables)), *(input->get(segments)), *(result->get(models)), *par);
+}
+
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,295 @@
+/* file: ridge_regression_grouped_training_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_IMPL_I__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_IMPL_I__
+
+#include "algorithms/kernel/ridge_regression/ridge_regression_grouped_training_kernel.h"
+#include "algorithms/threading/threading.h"
+#include "externals/service_blas.h"
+#include "externals/service_lapack.h"
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "service/kernel/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace internal
+{
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+template <typename algorithmFPType, CpuType cpu>
+SegmentTask<algorithmFPType, cpu>::SegmentTask(size_t nFeatures, size_t nBetasIntercept, size_t nResponses, size_t nRowsInBlock)
+    : x(nRowsInBlock * nFeatures),
+      y(nRowsInBlock * nResponses),
+      xtx(nBetasIntercept * nBetasIntercept),
+      xty(nBetasIntercept * nResponses),
+      xtxCopy(nBetasIntercept * nBetasIntercept),
+      beta(nBetasIntercept * nResponses)
+{}
+
+template <typename algorithmFPType, CpuType cpu>
+SegmentTask<algorithmFPType, cpu> * SegmentTask<algorithmFPType, cpu>::create(size_t nFeatures, size_t nBetasIntercept, size_t nResponses,
+                                                                              size_t nRowsInBlock)
+{
+    SegmentTask<algorithmFPType, cpu> * res = new SegmentTask<algorithmFPType, cpu>(nFeatures, nBetasIntercept, nResponses, nRowsInBlock);
+    if (res && !(res->x.get() && res->y.get() && res->xtx.get() && res->xty.get() && res->xtxCopy.get() && res->beta.get()))
+    {
+        delete res;
+        res = nullptr;
+    }
+    return res;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status GroupedTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(const NumericTable & xTable, const NumericTable & yTable,
+                                                                           const NumericTable & segmentsTable, DataCollection & models,
+                                                                           const Parameter & parameter) const
+{
+    const size_t nRows           = xTable.getNumberOfRows();
+    const size_t nFeatures       = xTable.getNumberOfColumns();
+    const size_t nResponses      = yTable.getNumberOfColumns();
+    const size_t nSegments       = parameter.nSegments;
+    const size_t nBetasIntercept = (parameter.interceptFlag ? nFeatures + 1 : nFeatures);
+
+    /* Sort the rows by the segments: rows of the i-th segment are rowIndices[segmentOffsets[i]], ..., rowIndices[segmentOffsets[i + 1] - 1] */
+    TArray<size_t, cpu> segmentOffsetsArray(nSegments + 1);
+    TArray<size_t, cpu> rowIndicesArray(nRows);
+    size_t * segmentOffsets = segmentOffsetsArray.get();
+    size_t * rowIndices     = rowIndicesArray.get();
+    DAAL_CHECK_MALLOC(segmentOffsets && rowIndices);
+    {
+        ReadColumns<int, cpu> segmentsBlock(const_cast<NumericTable &>(segmentsTable), 0, 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(segmentsBlock);
+        const int * segmentIds = segmentsBlock.get();
+
+        service_memset<size_t, cpu>(segmentOffsets, 0, nSegments + 1);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            DAAL_CHECK_EX(segmentIds[i] >= 0 && size_t(segmentIds[i]) < nSegments, ErrorIncorrectDataRange, ArgumentName, segmentsStr());
+            segmentOffsets[segmentIds[i] + 1]++;
+        }
+        for (size_t i = 0; i < nSegments; i++)
+        {
+            segmentOffsets[i + 1] += segmentOffsets[i];
+        }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            rowIndices[segmentOffsets[segmentIds[i]]++] = i;
+        }
+        /* Offsets are shifted by one segment after the placement of the rows */
+        for (size_t i = nSegments; i > 0; i--)
+        {
+            segmentOffsets[i] = segmentOffsets[i - 1];
+        }
+        segmentOffsets[0] = 0;
+    }
+
+    ReadRows<algorithmFPType, cpu> xBlock(const_cast<NumericTable &>(xTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(xBlock);
+    const algorithmFPType * x = xBlock.get();
+
+    ReadRows<algorithmFPType, cpu> yBlock(const_cast<NumericTable &>(yTable), 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(yBlock);
+    const algorithmFPType * y = yBlock.get();
+
+    const size_t nRidge = parameter.ridgeParameters->getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> ridgeBlock(*parameter.ridgeParameters, 0, 1);
+    DAAL_CHECK_BLOCK_STATUS(ridgeBlock);
+    const algorithmFPType * ridge = ridgeBlock.get();
+
+    /* Segments are small, so that each segment is processed by one thread */
+    const size_t nRowsInBlock = 128;
+    daal::tls<SegmentTaskType *> tlsTask([=]() { return SegmentTaskType::create(nFeatures, nBetasIntercept, nResponses, nRowsInBlock); });
+
+    SafeStatus safeStat;
+    daal::threader_for(nSegments, nSegments, [&](size_t iSegment) {
+        SegmentTaskType * task = tlsTask.local();
+        DAAL_CHECK_THR(task, ErrorMemoryAllocationFailed);
+
+        ridge_regression::ModelNormEq * model = dynamic_cast<ridge_regression::ModelNormEq *>(models[iSegment].get());
+        DAAL_CHECK_THR(model, ErrorNullModel);
+
+        const size_t begin = segmentOffsets[iSegment];
+        DAAL_CHECK_STATUS_THR(computeSegment(x, y, rowIndices + begin, segmentOffsets[iSegment + 1] - begin, nFeatures, nBetasIntercept, nResponses,
+                                             ridge, nRidge, *task, *model));
+    });
+
+    tlsTask.reduce([](SegmentTaskType * task) { delete task; });
+    return safeStat.detach();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+Status GroupedTrainBatchKernel<algorithmFPType, defaultDense, cpu>::computeSegment(const algorithmFPType * x, const algorithmFPType * y,
+                                                                                  const size_t * rows, size_t nRows, DAAL_INT nFeatures,
+                                                                                  DAAL_INT nBetasIntercept, DAAL_INT nResponses,
+                                                                                  const algorithmFPType * ridge, size_t nRidge,
+                                                                                  SegmentTaskType & task, ridge_regression::ModelNormEq & model)
+{
+    algorithmFPType * xtx = task.xtx.get();
+    algorithmFPType * xty = task.xty.get();
+    algorithmFPType * xs  = task.x.get();
+    algorithmFPType * ys  = task.y.get();
+
+    service_memset_seq<algorithmFPType, cpu>(xtx, algorithmFPType(0), nBetasIntercept * nBetasIntercept);
+    service_memset_seq<algorithmFPType, cpu>(xty, algorithmFPType(0), nBetasIntercept * nResponses);
+
+    char up      = 'U';
+    char trans   = 'T';
+    char notrans = 'N';
+    algorithmFPType one(1.0);
+
+    const size_t nRowsInBlock = task.x.size() / nFeatures;
+    for (size_t iStart = 0; iStart < nRows; iStart += nRowsInBlock)
+    {
+        DAAL_INT nRowsInChunk = (nRows - iStart < nRowsInBlock ? nRows - iStart : nRowsInBlock);
+
+        /* Gather the rows of the segment into the contiguous buffers */
+        for (DAAL_INT i = 0; i < nRowsInChunk; i++)
+        {
+            const algorithmFPType * xRow = x + rows[iStart + i] * nFeatures;
+            const algorithmFPType * yRow = y + rows[iStart + i] * nResponses;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < nFeatures; j++)
+            {
+                xs[i * nFeatures + j] = xRow[j];
+            }
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (DAAL_INT j = 0; j < nResponses; j++)
+            {
+                ys[i * nResponses + j] = yRow[j];
+            }
+        }
+
+        Blas<algorithmFPType, cpu>::xxsyrk(&up, &notrans, &nFeatures, &nRowsInChunk, &one, xs, &nFeatures, &one, xtx, &nBetasIntercept);
+        Blas<algorithmFPType, cpu>::xxgemm(&notrans, &trans, &nFeatures, &nResponses, &nRowsInChunk, &one, xs, &nFeatures, ys, &nResponses, &one,
+                                           xty, &nBetasIntercept);
+
+        if (nFeatures < nBetasIntercept)
+        {
+            algorithmFPType * xtxPtr = xtx + nFeatures * nBetasIntercept;
+            for (DAAL_INT i = 0; i < nRowsInChunk; i++)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (DAAL_INT j = 0; j < nFeatures; j++)
+                {
+                    xtxPtr[j] += xs[i * nFeatures + j];
+                }
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (DAAL_INT j = 0; j < nResponses; j++)
+                {
+                    xty[j * nBetasIntercept + nFeatures] += ys[i * nResponses + j];
+                }
+            }
+            xtxPtr[nFeatures] += algorithmFPType(nRowsInChunk);
+        }
+    }
+
+    Status st;
+    const size_t xtxSizeInBytes = nBetasIntercept * nBetasIntercept * sizeof(algorithmFPType);
+    const size_t xtySizeInBytes = nBetasIntercept * nResponses * sizeof(algorithmFPType);
+    DAAL_CHECK_STATUS(st, FinalizeKernelType::copyDataToTable(xtx, xtxSizeInBytes, *model.getXTXTable()));
+    DAAL_CHECK_STATUS(st, FinalizeKernelType::copyDataToTable(xty, xtySizeInBytes, *model.getXTYTable()));
+
+    const bool interceptFlag = (nFeatures < nBetasIntercept);
+    DAAL_CHECK_STATUS(st, solve(nBetasIntercept, nResponses, ridge, nRidge, interceptFlag, task));
+
+    /* The intercept term is the first coefficient of the model and the last one of the normal equations */
+    const size_t nBetas = nFeatures + 1;
+    WriteOnlyRows<algorithmFPType, cpu> betaBlock(*model.getBeta(), 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(betaBlock);
+    algorithmFPType * beta             = betaBlock.get();
+    const algorithmFPType * betaBuffer = task.beta.get();
+    for (DAAL_INT i = 0; i < nResponses; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (DAAL_INT j = 0; j < nFeatures; j++)
+        {
+            beta[i * nBetas + j + 1] = betaBuffer[i * nBetasIntercept + j];
+        }
+        beta[i * nBetas] = (interceptFlag ? betaBuffer[i * nBetasIntercept + nFeatures] : algorithmFPType(0));
+    }
+    return st;
+}
+
+/**
+ *  \brief Solves the normal equations of the segment with the ridge parameters added to the diagonal,
+ *         the intercept term is not regularized
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status GroupedTrainBatchKernel<algorithmFPType, defaultDense, cpu>::solve(DAAL_INT p, DAAL_INT ny, const algorithmFPType * ridge, size_t nRidge,
+                                                                         bool interceptFlag, SegmentTaskType & task)
+{
+    const algorithmFPType * xtx = task.xtx.get();
+    algorithmFPType * a         = task.xtxCopy.get();
+    algorithmFPType * b         = task.beta.get();
+
+    const size_t xtxSizeInBytes = p * p * sizeof(algorithmFPType);
+    const size_t xtySizeInBytes = p * ny * sizeof(algorithmFPType);
+    int result                  = daal::services::internal::daal_memcpy_s(b, xtySizeInBytes, task.xty.get(), xtySizeInBytes);
+
+    const DAAL_INT pToFix   = (interceptFlag ? p - 1 : p);
+    const DAAL_INT nSystems = (nRidge == 1 ? 1 : ny);
+    DAAL_INT nRhs           = (nRidge == 1 ? ny : 1);
+
+    char up = 'U';
+    DAAL_INT info;
+    for (DAAL_INT j = 0; j < nSystems; j++)
+    {
+        result |= daal::services::internal::daal_memcpy_s(a, xtxSizeInBytes, xtx, xtxSizeInBytes);
+        for (DAAL_INT i = 0; i < pToFix; i++)
+        {
+            a[i * (p + 1)] += ridge[j];
+        }
+
+        Lapack<algorithmFPType, cpu>::xxpotrf(&up, &p, a, &p, &info);
+        if (info < 0) return Status(ErrorRidgeRegressionInternal);
+        if (info > 0) return Status(ErrorNormEqSystemSolutionFailed);
+
+        Lapack<algorithmFPType, cpu>::xxpotrs(&up, &p, &nRhs, a, &p, b + j * p, &p, &info);
+        DAAL_CHECK(info == 0, ErrorRidgeRegressionInternal);
+    }
+    return (!result) ? Status() : Status(services::ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace internal
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,119 @@
+/* file: ridge_regression_grouped_training_input.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training classes.
+//--
+*/
+
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace interface1
+{
+Parameter::Parameter(size_t nSegments) : ridge_regression::TrainParameter(), nSegments(nSegments) {}
+
+services::Status Parameter::check() const
+{
+    DAAL_CHECK_EX(nSegments > 0, ErrorIncorrectParameter, ParameterName, nSegmentsStr());
+    return ridge_regression::TrainParameter::check();
+}
+
+Input::Input() : daal::algorithms::Input(lastInputId + 1) {}
+Input::Input(const Input & other) : daal::algorithms::Input(other) {}
+
+/**
+ * Returns an input object for the grouped ridge regression training
+ * \param[in] id    Identifier of the input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets an input object for the grouped ridge regression training
+ * \param[in] id      Identifier of the input object
+ * \param[in] value   Pointer to the object
+ */
+void Input::set(InputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+size_t Input::getNumberOfFeatures() const
+{
+    return get(data)->getNumberOfColumns();
+}
+
+/**
+ * Returns the number of dependent variables
+ * \return Number of dependent variables
+ */
+size_t Input::getNumberOfDependentVariables() const
+{
+    return get(dependentVariables)->getNumberOfColumns();
+}
+
+/**
+ * Checks an input object for the grouped ridge regression training
+ * \param[in] par     Algorithm parameter
+ * \param[in] method  Computation method
+ *
+ * \return Status of computations
+ */
+services::Status Input::check(const daal::algorithms::Parameter * par, int method) const
+{
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+
+    Status s;
+    DAAL_CHECK_STATUS(s, parameter->check());
+
+    const NumericTablePtr dataTable = get(data);
+    DAAL_CHECK_STATUS(s, checkNumericTable(dataTable.get(), dataStr()));
+
+    const size_t nRows = dataTable->getNumberOfRows();
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(dependentVariables).get(), dependentVariablesStr(), 0, 0, 0, nRows));
+    DAAL_CHECK_STATUS(s, checkNumericTable(get(segments).get(), segmentsStr(), 0, 0, 1, nRows));
+
+    const size_t nRidgeParameters = parameter->ridgeParameters->getNumberOfColumns();
+    DAAL_CHECK((nRidgeParameters == 1) || (nRidgeParameters == getNumberOfDependentVariables()), ErrorIncorrectNumberOfColumns);
+    return s;
+}
+
+} // namespace interface1
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,112 @@
+/* file: ridge_regression_grouped_training_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of structure containing kernels for the grouped ridge regression training.
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_KERNEL_H__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_KERNEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "algorithms/algorithm_base_common.h"
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+#include "algorithms/kernel/linear_model/linear_model_train_normeq_kernel.h"
+#include "service/kernel/service_arrays.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace internal
+{
+using namespace daal::data_management;
+using namespace daal::services;
+using daal::services::internal::TArray;
+
+/**
+ * Thread local storage used to train the model of one segment
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SegmentTask
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Creates thread local storage of the requested size
+     * \param[in] nFeatures         Number of features
+     * \param[in] nBetasIntercept   Number of columns in the normal equations
+     * \param[in] nResponses        Number of responses
+     * \param[in] nRowsInBlock      Number of rows gathered from the segment at once
+     * \return Pointer on the thread local storage object if the object was created successfully, NULL otherwise
+     */
+    static SegmentTask<algorithmFPType, cpu> * create(size_t nFeatures, size_t nBetasIntercept, size_t nResponses, size_t nRowsInBlock);
+
+    TArray<algorithmFPType, cpu> x;       /*!< Rows of the segment of size nRowsInBlock x P */
+    TArray<algorithmFPType, cpu> y;       /*!< Responses of the segment of size nRowsInBlock x Ny */
+    TArray<algorithmFPType, cpu> xtx;     /*!< Matrix X'^T * X' of size P' x P' */
+    TArray<algorithmFPType, cpu> xty;     /*!< Matrix X'^T * Y of size Ny x P' */
+    TArray<algorithmFPType, cpu> xtxCopy; /*!< Matrix of the system with the ridge parameters of size P' x P' */
+    TArray<algorithmFPType, cpu> beta;    /*!< Regression coefficients of size Ny x P' */
+
+protected:
+    SegmentTask(size_t nFeatures, size_t nBetasIntercept, size_t nResponses, size_t nRowsInBlock);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class GroupedTrainBatchKernel
+{};
+
+/**
+ * Trains one model per segment. Rows are sorted by the segments, normal equations of the segments
+ * are computed and solved with the Cholesky decomposition in parallel over the segments,
+ * each segment is processed with the sequential BLAS and LAPACK routines.
+ */
+template <typename algorithmFPType, CpuType cpu>
+class GroupedTrainBatchKernel<algorithmFPType, defaultDense, cpu> : public daal::algorithms::Kernel
+{
+    typedef linear_model::normal_equations::training::internal::FinalizeKernel<algorithmFPType, cpu> FinalizeKernelType;
+    typedef SegmentTask<algorithmFPType, cpu> SegmentTaskType;
+
+public:
+    Status compute(const NumericTable & x, const NumericTable & y, const NumericTable & segments, DataCollection & models,
+                   const Parameter & parameter) const;
+
+protected:
+    static Status computeSegment(const algorithmFPType * x, const algorithmFPType * y, const size_t * rows, size_t nRows, DAAL_INT nFeatures,
+                                 DAAL_INT nBetasIntercept, DAAL_INT nResponses, const algorithmFPType * ridge, size_t nRidge,
+                                 SegmentTaskType & task, ridge_regression::ModelNormEq & model);
+
+    static Status solve(DAAL_INT nBetasIntercept, DAAL_INT nResponses, const algorithmFPType * ridge, size_t nRidge, bool interceptFlag,
+                        SegmentTaskType & task);
+};
+
+} // namespace internal
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
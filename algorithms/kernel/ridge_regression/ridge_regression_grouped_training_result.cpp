@@ -0,0 +1,111 @@
+/* file: ridge_regression_grouped_training_result.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training result.
+//--
+*/
+
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+#include "service/kernel/serialization_utils.h"
+#include "service/kernel/daal_strings.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_RIDGE_REGRESSION_GROUPED_TRAINING_RESULT_ID);
+Result::Result() : daal::algorithms::Result(lastResultId + 1) {}
+
+/**
+ * Returns the result of the grouped ridge regression training
+ * \param[in] id    Identifier of the result
+ * \return          Result that corresponds to the given identifier
+ */
+DataCollectionPtr Result::get(ResultId id) const
+{
+    return DataCollection::cast(Argument::get(id));
+}
+
+/**
+ * Returns the model trained on the segment
+ * \param[in] id        Identifier of the result
+ * \param[in] segment   Identifier of the segment
+ * \return              Model trained on the observations of the segment
+ */
+ridge_regression::ModelNormEqPtr Result::get(ResultId id, size_t segment) const
+{
+    DataCollectionPtr collection = get(id);
+    if (!collection || segment >= collection->size()) return ridge_regression::ModelNormEqPtr();
+    return ridge_regression::ModelNormEq::cast((*collection)[segment]);
+}
+
+/**
+ * Sets the result of the grouped ridge regression training
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Result
+ */
+void Result::set(ResultId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the result of the grouped ridge regression training
+ * \param[in] input   %Input object for the algorithm
+ * \param[in] par     %Parameter of the algorithm
+ * \param[in] method  Computation method
+ *
+ * \return Status of computations
+ */
+services::Status Result::check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const
+{
+    const Input * in            = static_cast<const Input *>(input);
+    const Parameter * parameter = static_cast<const Parameter *>(par);
+
+    const DataCollectionPtr collection = get(models);
+    DAAL_CHECK_EX(collection, ErrorNullOutputDataCollection, ArgumentName, modelsStr());
+    DAAL_CHECK_EX(collection->size() == parameter->nSegments, ErrorIncorrectNumberOfElementsInResultCollection, ArgumentName, modelsStr());
+
+    const size_t nBeta      = in->getNumberOfFeatures() + 1;
+    const size_t nResponses = in->getNumberOfDependentVariables();
+
+    Status s;
+    for (size_t i = 0; i < parameter->nSegments; i++)
+    {
+        const ridge_regression::ModelNormEqPtr model = get(models, i);
+        DAAL_CHECK_EX(model, ErrorNullModel, ArgumentName, modelsStr());
+        DAAL_CHECK_STATUS(s, ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method));
+    }
+    return s;
+}
+
+} // namespace interface1
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,76 @@
+/* file: ridge_regression_grouped_training_result.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the grouped ridge regression training result allocation
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_RESULT_H__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_RESULT_H__
+
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+#include "algorithms/kernel/ridge_regression/ridge_regression_ne_model_impl.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+using namespace daal::services;
+using namespace daal::data_management;
+
+/**
+ * Allocates memory to store the result of the grouped ridge regression training
+ * \param[in] input     Pointer to an object containing the input data
+ * \param[in] parameter %Parameter of the grouped ridge regression training
+ * \param[in] method    Computation method for the algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method)
+{
+    const Input * const in      = static_cast<const Input *>(input);
+    const Parameter * const par = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures  = in->getNumberOfFeatures();
+    const size_t nResponses = in->getNumberOfDependentVariables();
+
+    DataCollectionPtr collection(new DataCollection(par->nSegments));
+    DAAL_CHECK_MALLOC(collection)
+
+    Status s;
+    const algorithmFPType dummy = 1.0;
+    for (size_t i = 0; i < par->nSegments && s; i++)
+    {
+        (*collection)[i] = ridge_regression::ModelNormEqPtr(new ridge_regression::internal::ModelNormEqImpl(nFeatures, nResponses, *par, dummy, s));
+    }
+    DAAL_CHECK_STATUS_VAR(s);
+
+    set(models, collection);
+    return s;
+}
+
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
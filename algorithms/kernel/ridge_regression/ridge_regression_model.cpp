@@ -41,7 +41,13 @@ TrainParameter::TrainParameter() : Parameter(), ridgeParameters(new HomogenNumer
 
 services::Status TrainParameter::check() const
 {
-    return checkNumericTable(ridgeParameters.get(), ridgeParametersStr(), packed_mask, 0, 0, 1);
+    services::Status s;
+    DAAL_CHECK_STATUS(s, checkNumericTable(ridgeParameters.get(), ridgeParametersStr(), packed_mask, 0, 0, 1));
+    if (ridgeParametersPath)
+    {
+        DAAL_CHECK_STATUS(s, checkNumericTable(ridgeParametersPath.get(), "ridgeParametersPath", packed_mask));
+    }
+    return s;
 }
 
 } // namespace interface1
@@ -73,9 +73,24 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
-                       *(input->get(dependentVariables)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()), par->interceptFlag,
-                       *(par->ridgeParameters));
+    services::Status s;
+    if (input->get(xtx))
+    {
+        s = __DAAL_CALL_KERNEL_STATUS(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computeFromCrossProducts,
+                                      *(input->get(xtx)), *(input->get(xty)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()),
+                                      par->interceptFlag, *(par->ridgeParameters));
+    }
+    else
+    {
+        s = __DAAL_CALL_KERNEL_STATUS(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, *(input->get(data)),
+                                      *(input->get(dependentVariables)), *(m->getXTXTable()), *(m->getXTYTable()), *(m->getBeta()),
+                                      par->interceptFlag, *(par->ridgeParameters));
+    }
+    if (!s || !par->ridgeParametersPath) return s;
+
+    /* The cross-products of the model are final at this point and are shared by all ridge parameters of the path */
+    __DAAL_CALL_KERNEL(env, internal::BatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), computePath, *(m->getXTXTable()),
+                       *(m->getXTYTable()), par->interceptFlag, *(par->ridgeParametersPath), *(result->get(pathModels)));
 }
 
 /**
@@ -25,6 +25,12 @@
 #define __RIDGE_REGRESSION_TRAIN_DENSE_NORMEQ_IMPL_I__
 
 #include "algorithms/kernel/ridge_regression/ridge_regression_train_kernel.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/threading/threading.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_data_utils.h"
+#include "externals/service_lapack.h"
 
 namespace daal
 {
@@ -48,6 +54,172 @@ Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::compute(const N
     return st;
 }
 
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computeFromCrossProducts(const NumericTable & xtxInput,
+                                                                                          const NumericTable & xtyInput, NumericTable & xtx,
+                                                                                          NumericTable & xty, NumericTable & beta, bool interceptFlag,
+                                                                                          const NumericTable & ridge) const
+{
+    return FinalizeKernelType::compute(xtxInput, xtyInput, xtx, xty, beta, interceptFlag, KernelHelper<algorithmFPType, cpu>(ridge));
+}
+
+/**
+ *  \brief Trains the models for all ridge parameters of the path with one eigendecomposition A = V * diag(lambda) * V^T
+ *         of the cross-product A of the centered data, the intercept is not penalized:
+ *             beta(alpha) = V * diag(1 / (lambda + alpha)) * V^T * c,  intercept = mean(y) - mean(x) * beta(alpha),
+ *         where c is the cross-product X^T * y of the centered data. A ridge parameter of the path costs O(p^2) operations
+ *         per dependent variable instead of the factorization of the p x p matrix.
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status BatchKernel<algorithmFPType, training::normEqDense, cpu>::computePath(const NumericTable & xtxTable, const NumericTable & xtyTable,
+                                                                             bool interceptFlag, const NumericTable & ridgePath,
+                                                                             DataCollection & models) const
+{
+    const size_t nColumns      = xtxTable.getNumberOfColumns();
+    const size_t nFeatures     = (interceptFlag ? nColumns - 1 : nColumns);
+    const size_t nResponses    = xtyTable.getNumberOfRows();
+    const size_t nPath         = ridgePath.getNumberOfRows();
+    const size_t nRidgeColumns = ridgePath.getNumberOfColumns();
+    DAAL_CHECK(models.size() == nPath, ErrorIncorrectNumberOfElementsInResultCollection);
+
+    ReadRows<algorithmFPType, cpu> xtxBlock(const_cast<NumericTable &>(xtxTable), 0, nColumns);
+    DAAL_CHECK_BLOCK_STATUS(xtxBlock);
+    ReadRows<algorithmFPType, cpu> xtyBlock(const_cast<NumericTable &>(xtyTable), 0, nResponses);
+    DAAL_CHECK_BLOCK_STATUS(xtyBlock);
+    ReadRows<algorithmFPType, cpu> ridgeBlock(const_cast<NumericTable &>(ridgePath), 0, nPath);
+    DAAL_CHECK_BLOCK_STATUS(ridgeBlock);
+    const algorithmFPType * const xtx   = xtxBlock.get();
+    const algorithmFPType * const xty   = xtyBlock.get();
+    const algorithmFPType * const ridge = ridgeBlock.get();
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nFeatures);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nFeatures, nResponses);
+    TArray<algorithmFPType, cpu> eigenvectorsArr(nFeatures * nFeatures);
+    TArray<algorithmFPType, cpu> eigenvaluesArr(nFeatures);
+    TArray<algorithmFPType, cpu> projectionsArr(nFeatures * nResponses);
+    TArray<algorithmFPType, cpu> meansArr(nFeatures + nResponses);
+    TArray<algorithmFPType, cpu> centeredXtyArr(nFeatures);
+    algorithmFPType * const eigenvectors = eigenvectorsArr.get();
+    algorithmFPType * const eigenvalues  = eigenvaluesArr.get();
+    algorithmFPType * const projections  = projectionsArr.get();
+    algorithmFPType * const xMeans       = meansArr.get();
+    algorithmFPType * const centeredXty  = centeredXtyArr.get();
+    DAAL_CHECK_MALLOC(eigenvectors && eigenvalues && projections && xMeans && centeredXty);
+    algorithmFPType * const yMeans = xMeans + nFeatures;
+
+    /* The last row and column of the cross-products hold the number of observations and the sums of the columns */
+    const algorithmFPType n = (interceptFlag ? xtx[nFeatures * nColumns + nFeatures] : algorithmFPType(1));
+    DAAL_CHECK(n > 0, ErrorIncorrectNumberOfObservations);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        xMeans[j] = (interceptFlag ? xtx[j * nColumns + nFeatures] / n : algorithmFPType(0));
+    }
+    for (size_t k = 0; k < nResponses; k++)
+    {
+        yMeans[k] = (interceptFlag ? xty[k * nColumns + nFeatures] / n : algorithmFPType(0));
+    }
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            eigenvectors[i * nFeatures + j] = xtx[i * nColumns + j] - n * xMeans[i] * xMeans[j];
+        }
+    }
+
+    {
+        char jobz       = 'V';
+        char uplo       = 'U';
+        DAAL_INT p      = (DAAL_INT)nFeatures;
+        DAAL_INT lwork  = 2 * p * p + 6 * p + 1;
+        DAAL_INT liwork = 5 * p + 3;
+        DAAL_INT info   = 0;
+
+        TArray<algorithmFPType, cpu> work(lwork);
+        TArray<DAAL_INT, cpu> iwork(liwork);
+        DAAL_CHECK_MALLOC(work.get() && iwork.get());
+
+        /* The i-th eigenvector is stored in the i-th row of the row-major array */
+        Lapack<algorithmFPType, cpu>::xxsyevd(&jobz, &uplo, &p, eigenvectors, &p, eigenvalues, work.get(), &lwork, iwork.get(), &liwork, &info);
+        DAAL_CHECK(info == 0, ErrorRidgeRegressionInternal);
+    }
+
+    /* projections[k * p + i] = <v_i, c_k> */
+    for (size_t k = 0; k < nResponses; k++)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            centeredXty[j] = xty[k * nColumns + j] - n * xMeans[j] * yMeans[k];
+        }
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            const algorithmFPType * const v = eigenvectors + i * nFeatures;
+            algorithmFPType sum             = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += v[j] * centeredXty[j];
+            }
+            projections[k * nFeatures + i] = sum;
+        }
+    }
+
+    /* The directions with the zero eigenvalues are dropped if the ridge parameter is zero, as the pseudo-inverse does */
+    const algorithmFPType maxEigenvalue = (nFeatures ? eigenvalues[nFeatures - 1] : algorithmFPType(0));
+    const algorithmFPType threshold     = maxEigenvalue * algorithmFPType(nFeatures) * services::internal::EpsilonVal<algorithmFPType>::get();
+    const size_t nBetas                 = nFeatures + 1;
+
+    daal::TlsMem<algorithmFPType, cpu> tlsWeights(nFeatures);
+    SafeStatus safeStat;
+    daal::threader_for(nPath, nPath, [&](size_t iPath) {
+        algorithmFPType * const weights = tlsWeights.local();
+        DAAL_CHECK_MALLOC_THR(weights);
+
+        ridge_regression::Model * const pathModel = ridge_regression::Model::cast(models[iPath]).get();
+        DAAL_CHECK_THR(pathModel, ErrorNullModel);
+        WriteOnlyRows<algorithmFPType, cpu> betaBlock(pathModel->getBeta().get(), 0, nResponses);
+        DAAL_CHECK_BLOCK_STATUS_THR(betaBlock);
+        algorithmFPType * const beta = betaBlock.get();
+
+        for (size_t k = 0; k < nResponses; k++)
+        {
+            const algorithmFPType alpha = ridge[iPath * nRidgeColumns + (nRidgeColumns == 1 ? 0 : k)];
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const algorithmFPType denominator = eigenvalues[i] + alpha;
+                weights[i] = (denominator > threshold ? projections[k * nFeatures + i] / denominator : algorithmFPType(0));
+            }
+
+            algorithmFPType * const b = beta + k * nBetas + 1;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                b[j] = 0;
+            }
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const algorithmFPType * const v = eigenvectors + i * nFeatures;
+                const algorithmFPType w         = weights[i];
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    b[j] += w * v[j];
+                }
+            }
+
+            algorithmFPType dot = 0;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dot += xMeans[j] * b[j];
+            }
+            beta[k * nBetas] = (interceptFlag ? yMeans[k] - dot : algorithmFPType(0));
+        }
+    });
+    return safeStat.detach();
+}
+
 template <typename algorithmFPType, CpuType cpu>
 Status OnlineKernel<algorithmFPType, training::normEqDense, cpu>::compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx,
                                                                           NumericTable & xty, bool interceptFlag) const
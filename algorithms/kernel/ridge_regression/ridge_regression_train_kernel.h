@@ -25,6 +25,7 @@
 #define __RIDGE_REGRESSION_TRAIN_KERNEL_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/algorithm_base_common.h"
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
 #include "algorithms/kernel/linear_model/linear_model_train_normeq_kernel.h"
@@ -68,6 +69,12 @@ class BatchKernel<algorithmFPType, training::normEqDense, cpu> : public daal::al
 public:
     Status compute(const NumericTable & x, const NumericTable & y, NumericTable & xtx, NumericTable & xty, NumericTable & beta, bool interceptFlag,
                    const NumericTable & ridge) const;
+
+    Status computeFromCrossProducts(const NumericTable & xtxInput, const NumericTable & xtyInput, NumericTable & xtx, NumericTable & xty,
+                                    NumericTable & beta, bool interceptFlag, const NumericTable & ridge) const;
+
+    Status computePath(const NumericTable & xtx, const NumericTable & xty, bool interceptFlag, const NumericTable & ridgePath,
+                       DataCollection & models) const;
 };
 
 template <typename algorithmFPType, training::Method method, CpuType cpu>
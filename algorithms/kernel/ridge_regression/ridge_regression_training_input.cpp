@@ -22,6 +22,7 @@
 */
 
 #include "algorithms/ridge_regression/ridge_regression_training_types.h"
+#include "service/kernel/daal_strings.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -36,7 +37,7 @@ namespace training
 {
 namespace interface1
 {
-Input::Input() : linear_model::training::Input(lastInputId + 1) {}
+Input::Input() : linear_model::training::Input(lastCrossProductInputId + 1) {}
 Input::Input(const Input & other) : linear_model::training::Input(other) {}
 
 /**
@@ -59,6 +60,26 @@ void Input::set(InputId id, const NumericTablePtr & value)
     linear_model::training::Input::set(linear_model::training::InputId(id), value);
 }
 
+/**
+ * Returns a cross-product precomputed for ridge regression model-based training
+ * \param[in] id    Identifier of the cross-product
+ * \return          Cross-product that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(CrossProductInputId id) const
+{
+    return NumericTable::cast(Argument::get(id));
+}
+
+/**
+ * Sets a cross-product precomputed for ridge regression model-based training
+ * \param[in] id      Identifier of the cross-product
+ * \param[in] value   Pointer to the cross-product
+ */
+void Input::set(CrossProductInputId id, const NumericTablePtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Returns the number of columns in the input data set
  * \return Number of columns in the input data set
@@ -93,16 +114,31 @@ services::Status Input::check(const daal::algorithms::Parameter * par, int metho
     size_t nRowsInData              = dataTable->getNumberOfRows();
     size_t nColumnsInData           = dataTable->getNumberOfColumns();
 
-    DAAL_CHECK(nRowsInData >= nColumnsInData, ErrorIncorrectNumberOfObservations);
-
     const NumericTablePtr dependentVariableTable = get(dependentVariables);
     const size_t nColumnsInDepVariable           = dependentVariableTable->getNumberOfColumns();
 
     TrainParameter * trainParameter = static_cast<TrainParameter *>(const_cast<daal::algorithms::Parameter *>(par));
     DAAL_CHECK_STATUS(s, trainParameter->check());
 
+    if (get(xtx) || get(xty))
+    {
+        /* The normal equations are solved for the precomputed cross-products, the data is not read */
+        const size_t nBetas = nColumnsInData + (int)(trainParameter->interceptFlag == true);
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(xtx).get(), XTXTableStr(), 0, 0, nBetas, nBetas));
+        DAAL_CHECK_STATUS(s, checkNumericTable(get(xty).get(), XTYTableStr(), 0, 0, nBetas, nColumnsInDepVariable));
+    }
+    else
+    {
+        DAAL_CHECK(nRowsInData >= nColumnsInData, ErrorIncorrectNumberOfObservations);
+    }
+
     size_t ridgeParamsNumberOfColumns = trainParameter->ridgeParameters->getNumberOfColumns();
     DAAL_CHECK((ridgeParamsNumberOfColumns == 1) || (nColumnsInDepVariable == ridgeParamsNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    if (trainParameter->ridgeParametersPath)
+    {
+        const size_t ridgePathNumberOfColumns = trainParameter->ridgeParametersPath->getNumberOfColumns();
+        DAAL_CHECK((ridgePathNumberOfColumns == 1) || (nColumnsInDepVariable == ridgePathNumberOfColumns), ErrorIncorrectNumberOfColumns);
+    }
     return services::Status();
 }
 
@@ -38,7 +38,7 @@ namespace training
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID);
-Result::Result() : linear_model::training::Result(lastResultId + 1) {}
+Result::Result() : linear_model::training::Result(lastOptionalResultModelCollectionId + 1) {}
 
 /**
  * Returns the result of ridge regression model-based training
@@ -60,6 +60,26 @@ void Result::set(ResultId id, const daal::algorithms::ridge_regression::ModelPtr
     linear_model::training::Result::set(linear_model::training::ResultId(id), value);
 }
 
+/**
+ * Returns the collection of models of the regularization path
+ * \param[in] id    Identifier of the result
+ * \return          Collection of models that corresponds to the given identifier
+ */
+DataCollectionPtr Result::get(OptionalResultModelCollectionId id) const
+{
+    return services::staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the collection of models of the regularization path
+ * \param[in] id      Identifier of the result
+ * \param[in] value   Collection of models
+ */
+void Result::set(OptionalResultModelCollectionId id, const DataCollectionPtr & value)
+{
+    Argument::set(id, value);
+}
+
 /**
  * Checks the result of ridge regression model-based training
  * \param[in] input   %Input object for the algorithm
@@ -83,7 +103,20 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
 
     const ridge_regression::ModelPtr model = get(training::model);
 
-    return ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method);
+    DAAL_CHECK_STATUS(s, ridge_regression::checkModel(model.get(), *par, nBeta, nResponses, method));
+
+    /* The models of the regularization path are trained only in the batch processing mode */
+    const TrainParameter * parameter = static_cast<const TrainParameter *>(par);
+    if (parameter->ridgeParametersPath && dynamic_cast<const Input *>(input))
+    {
+        const DataCollectionPtr models = get(pathModels);
+        DAAL_CHECK(models && models->size() == parameter->ridgeParametersPath->getNumberOfRows(), ErrorIncorrectNumberOfElementsInResultCollection);
+        for (size_t i = 0; i < models->size() && s; i++)
+        {
+            s |= ridge_regression::checkModel(ridge_regression::Model::cast((*models)[i]).get(), *par, nBeta, nResponses, method);
+        }
+    }
+    return s;
 }
 
 /**
@@ -96,7 +129,7 @@ services::Status Result::check(const daal::algorithms::Input * input, const daal
  */
 services::Status Result::check(const daal::algorithms::PartialResult * pr, const daal::algorithms::Parameter * par, int method) const
 {
-    DAAL_CHECK(Argument::size() == 1, ErrorIncorrectNumberOfOutputNumericTables);
+    DAAL_CHECK(Argument::size() == lastOptionalResultModelCollectionId + 1, ErrorIncorrectNumberOfOutputNumericTables);
     const PartialResult * partRes = static_cast<const PartialResult *>(pr);
 
     ridge_regression::ModelPtr model = get(training::model);
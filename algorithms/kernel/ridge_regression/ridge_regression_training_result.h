@@ -54,6 +54,20 @@ DAAL_EXPORT Status Result::allocate(const daal::algorithms::Input * input, const
         const algorithmFPType dummy = 1.0;
         set(model, ridge_regression::ModelPtr(new ridge_regression::internal::ModelNormEqImpl(
                        in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s)));
+
+        const TrainParameter * trainParameter = static_cast<const TrainParameter *>(parameter);
+        if (s && trainParameter->ridgeParametersPath)
+        {
+            const size_t nPath = trainParameter->ridgeParametersPath->getNumberOfRows();
+            data_management::DataCollectionPtr models(new data_management::DataCollection(nPath));
+            DAAL_CHECK_MALLOC(models)
+            for (size_t i = 0; i < nPath && s; i++)
+            {
+                (*models)[i] = ridge_regression::ModelPtr(new ridge_regression::internal::ModelNormEqImpl(
+                    in->getNumberOfFeatures(), in->getNumberOfDependentVariables(), *parameter, dummy, s));
+            }
+            set(pathModels, models);
+        }
     }
 
     return s;
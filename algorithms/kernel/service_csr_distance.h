@@ -0,0 +1,390 @@
+/* file: service_csr_distance.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the cosine and correlation distances for the data in the CSR format.
+//--
+*/
+
+#ifndef __SERVICE_CSR_DISTANCE_H__
+#define __SERVICE_CSR_DISTANCE_H__
+
+#include "data_management/data/csr_numeric_table.h"
+#include "externals/service_math.h"
+#include "externals/service_spblas.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_sort.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_data_utils.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/* Computes the distances d(i,j) = 1 - (x_i * x_j^T - c_i * c_j) / (s_i * s_j) between the rows of the CSR table x[n,p],
+   where c_i = sum(x_i) / sqrt(p) for the correlation distance and c_i = 0 for the cosine distance, s_i = sqrt(x_i * x_i^T - c_i^2).
+   Rows with zero s_i are at the unit distance from all other rows.
+   The products x_i * x_j^T are computed row by row with the sparse-sparse product of x by its transposed copy in the CSC layout,
+   so that only the rows j that share non-zero features with the row i are visited */
+template <typename algorithmFPType, CpuType cpu>
+class CSRDistances
+{
+public:
+    CSRDistances(bool centered) : _centered(centered), _n(0), _p(0), _values(nullptr), _cols(nullptr), _rows(nullptr) {}
+
+    services::Status init(const data_management::NumericTable * xTable)
+    {
+        data_management::CSRNumericTableIface * csr =
+            dynamic_cast<data_management::CSRNumericTableIface *>(const_cast<data_management::NumericTable *>(xTable));
+        DAAL_CHECK(csr, services::ErrorIncorrectTypeOfInputNumericTable);
+
+        _n = xTable->getNumberOfRows();
+        _p = xTable->getNumberOfColumns();
+
+        _xBlock.set(csr, 0, _n);
+        DAAL_CHECK_BLOCK_STATUS(_xBlock);
+        _values = _xBlock.values();
+        _cols   = _xBlock.cols();
+        _rows   = _xBlock.rows();
+
+        /* Row indices of the transposed copy are 32-bit */
+        const size_t nnz = _rows[_n] - _rows[0];
+        DAAL_CHECK(_n < services::internal::MaxVal<uint32_t>::get() && nnz < services::internal::MaxVal<uint32_t>::get(),
+                   services::ErrorIncorrectNumberOfObservations);
+
+        DAAL_CHECK_MALLOC(_shift.reset(_n) && _invNorm.reset(_n));
+        DAAL_CHECK_MALLOC(_cscValues.reset(nnz ? nnz : 1) && _cscRowIdx.reset(nnz ? nnz : 1) && _cscColStart.reset(_p + 1));
+
+        computeRowStatistics();
+        daal::internal::SpBlas<algorithmFPType, cpu>::xcsr2csc(_values, _cols, _rows, _n, _p, _cscValues.get(), _cscRowIdx.get(),
+                                                               _cscColStart.get());
+        return services::Status();
+    }
+
+    /* Computes the distances between all pairs of rows into the full, lower packed or upper packed table */
+    services::Status computeDense(data_management::NumericTable * rTable)
+    {
+        typedef data_management::NumericTableIface NTIface;
+        const int layout    = (int)rTable->getDataLayout();
+        const bool isLower  = (layout == NTIface::lowerPackedSymmetricMatrix || layout == NTIface::lowerPackedTriangularMatrix);
+        const bool isUpper  = (layout == NTIface::upperPackedSymmetricMatrix || layout == NTIface::upperPackedTriangularMatrix);
+        const bool isPacked = (layout & data_management::packed_mask);
+        DAAL_CHECK(!isPacked || isLower || isUpper, services::ErrorIncorrectTypeOfOutputNumericTable);
+
+        daal::internal::WriteOnlyPacked<algorithmFPType, cpu> packedBlock;
+        algorithmFPType * packed = nullptr;
+        if (isPacked)
+        {
+            packedBlock.set(rTable);
+            DAAL_CHECK_BLOCK_STATUS(packedBlock);
+            packed = packedBlock.get();
+        }
+
+        const size_t n       = _n;
+        const size_t nBlocks = n / _blockSize + !!(n % _blockSize);
+
+        SafeStatus safeStat;
+        daal::tls<RowBuffer *> tls([=, &safeStat]() -> RowBuffer * { return createBuffer(safeStat); });
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            RowBuffer * buf = tls.local();
+            DAAL_CHECK_MALLOC_THR(buf);
+
+            const size_t iBegin = iBlock * _blockSize;
+            const size_t iEnd   = (iBegin + _blockSize < n) ? iBegin + _blockSize : n;
+
+            daal::internal::WriteOnlyRows<algorithmFPType, cpu> rowsBlock;
+            if (!isPacked)
+            {
+                rowsBlock.set(rTable, iBegin, iEnd - iBegin);
+                DAAL_CHECK_BLOCK_STATUS_THR(rowsBlock);
+            }
+
+            for (size_t i = iBegin; i < iEnd; i++)
+            {
+                const size_t nIdx = computeProducts(i, *buf);
+                if (isLower)
+                {
+                    writeRow(i, *buf, nIdx, packed + i * (i + 1) / 2, 0, i + 1);
+                }
+                else if (isUpper)
+                {
+                    writeRow(i, *buf, nIdx, packed + (n * i - i * (i - 1) / 2), i, n);
+                }
+                else
+                {
+                    writeRow(i, *buf, nIdx, rowsBlock.get() + (i - iBegin) * n, 0, n);
+                }
+                clearProducts(*buf, nIdx);
+            }
+        });
+
+        tls.reduce([](RowBuffer * buf) -> void { delete buf; });
+        return safeStat.detach();
+    }
+
+    /* Computes the distances into the CSR table: for each row i the rows j != i that share non-zero features with it
+       and lie at the distance not greater than maxDistance are stored, at most k nearest of them if k is not zero.
+       The products are computed twice: the first pass counts the stored distances, the second one writes them */
+    services::Status computeSparse(data_management::NumericTable * rTable, algorithmFPType maxDistance, size_t k)
+    {
+        data_management::CSRNumericTable * csrResult = dynamic_cast<data_management::CSRNumericTable *>(rTable);
+        DAAL_CHECK(csrResult, services::ErrorIncorrectTypeOfOutputNumericTable);
+
+        const size_t n       = _n;
+        const size_t nBlocks = n / _blockSize + !!(n % _blockSize);
+
+        services::internal::TArray<size_t, cpu> rowCountsArr(n);
+        size_t * rowCounts = rowCountsArr.get();
+        DAAL_CHECK_MALLOC(rowCounts);
+
+        SafeStatus safeStat;
+        daal::tls<RowBuffer *> tls([=, &safeStat]() -> RowBuffer * { return createBuffer(safeStat); });
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            RowBuffer * buf = tls.local();
+            DAAL_CHECK_MALLOC_THR(buf);
+
+            const size_t iEnd = ((iBlock + 1) * _blockSize < n) ? (iBlock + 1) * _blockSize : n;
+            for (size_t i = iBlock * _blockSize; i < iEnd; i++)
+            {
+                const size_t nIdx = computeProducts(i, *buf);
+                rowCounts[i]      = selectNeighbors(i, *buf, nIdx, maxDistance, k, false);
+                clearProducts(*buf, nIdx);
+            }
+        });
+
+        size_t nnz = 0;
+        for (size_t i = 0; i < n; i++) nnz += rowCounts[i];
+
+        /* The table with no stored distances still keeps one element to allocate the arrays */
+        services::Status s = safeStat.detach();
+        if (s) s = csrResult->allocateDataMemory(nnz ? nnz : 1);
+        if (!s)
+        {
+            tls.reduce([](RowBuffer * buf) -> void { delete buf; });
+            return s;
+        }
+
+        algorithmFPType * resValues = nullptr;
+        size_t * resCols            = nullptr;
+        size_t * resRows            = nullptr;
+        csrResult->getArrays<algorithmFPType>(&resValues, &resCols, &resRows);
+
+        resRows[0] = 1;
+        for (size_t i = 0; i < n; i++) resRows[i + 1] = resRows[i] + rowCounts[i];
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            RowBuffer * buf = tls.local();
+            DAAL_CHECK_MALLOC_THR(buf);
+
+            const size_t iEnd = ((iBlock + 1) * _blockSize < n) ? (iBlock + 1) * _blockSize : n;
+            for (size_t i = iBlock * _blockSize; i < iEnd; i++)
+            {
+                const size_t nIdx              = computeProducts(i, *buf);
+                const size_t nNeighbors        = selectNeighbors(i, *buf, nIdx, maxDistance, k, true);
+                const Neighbor * const nb      = buf->neighbors.get();
+                algorithmFPType * const values = resValues + resRows[i] - 1;
+                size_t * const cols            = resCols + resRows[i] - 1;
+                for (size_t l = 0; l < nNeighbors; l++)
+                {
+                    values[l] = nb[l].distance;
+                    cols[l]   = nb[l].index + 1;
+                }
+                clearProducts(*buf, nIdx);
+            }
+        });
+
+        tls.reduce([](RowBuffer * buf) -> void { delete buf; });
+        return safeStat.detach();
+    }
+
+private:
+    struct Neighbor
+    {
+        algorithmFPType distance;
+        uint32_t index;
+    };
+
+    /* Scratch memory of the thread: the dense row of the products, the indices of its touched elements and their flags */
+    struct RowBuffer
+    {
+        DAAL_NEW_DELETE();
+
+        bool init(size_t n) { return products.reset(n) && idx.reset(n) && mask.reset(n) && neighbors.reset(n); }
+
+        services::internal::TArrayCalloc<algorithmFPType, cpu> products;
+        services::internal::TArray<uint32_t, cpu> idx;
+        services::internal::TArrayCalloc<char, cpu> mask;
+        services::internal::TArray<Neighbor, cpu> neighbors;
+    };
+
+    RowBuffer * createBuffer(SafeStatus & safeStat) const
+    {
+        RowBuffer * buf = new RowBuffer();
+        if (!buf || !buf->init(_n))
+        {
+            safeStat.add(services::ErrorMemoryAllocationFailed);
+            delete buf;
+            return nullptr;
+        }
+        return buf;
+    }
+
+    void computeRowStatistics()
+    {
+        const size_t nBlocks = _n / _blockSize + !!(_n % _blockSize);
+        const algorithmFPType invSqrtP =
+            _p ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(algorithmFPType(_p)) : algorithmFPType(0.0);
+
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iEnd = ((iBlock + 1) * _blockSize < _n) ? (iBlock + 1) * _blockSize : _n;
+            for (size_t i = iBlock * _blockSize; i < iEnd; i++)
+            {
+                const algorithmFPType * const x = _values + _rows[i] - _rows[0];
+                const size_t nnz                = _rows[i + 1] - _rows[i];
+
+                algorithmFPType sum   = 0;
+                algorithmFPType sumSq = 0;
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t l = 0; l < nnz; l++)
+                {
+                    sum += x[l];
+                    sumSq += x[l] * x[l];
+                }
+
+                const algorithmFPType shift = _centered ? sum * invSqrtP : algorithmFPType(0.0);
+                const algorithmFPType norm2 = sumSq - shift * shift;
+
+                _shift[i]   = shift;
+                _invNorm[i] = (norm2 > algorithmFPType(0.0)) ? algorithmFPType(1.0) / daal::internal::Math<algorithmFPType, cpu>::sSqrt(norm2) :
+                                                              algorithmFPType(0.0);
+            }
+        });
+    }
+
+    size_t computeProducts(size_t i, RowBuffer & buf) const
+    {
+        const size_t offset = _rows[i] - _rows[0];
+        return daal::internal::SpBlas<algorithmFPType, cpu>::xcsrrow_mm_csc(_values + offset, _cols + offset, _rows[i + 1] - _rows[i],
+                                                                           _cscValues.get(), _cscRowIdx.get(), _cscColStart.get(),
+                                                                           buf.products.get(), buf.idx.get(), buf.mask.get());
+    }
+
+    void clearProducts(RowBuffer & buf, size_t nIdx) const
+    {
+        algorithmFPType * const products = buf.products.get();
+        char * const mask                = buf.mask.get();
+        const uint32_t * const idx       = buf.idx.get();
+        for (size_t l = 0; l < nIdx; l++)
+        {
+            products[idx[l]] = 0;
+            mask[idx[l]]     = 0;
+        }
+    }
+
+    algorithmFPType distance(size_t i, size_t j, algorithmFPType product) const
+    {
+        return algorithmFPType(1.0) - (product - _shift[i] * _shift[j]) * _invNorm[i] * _invNorm[j];
+    }
+
+    /* Writes the distances d(i,j), j in [jBegin, jEnd), into row[j - jBegin] */
+    void writeRow(size_t i, const RowBuffer & buf, size_t nIdx, algorithmFPType * row, size_t jBegin, size_t jEnd) const
+    {
+        for (size_t j = jBegin; j < jEnd; j++)
+        {
+            row[j - jBegin] = distance(i, j, algorithmFPType(0.0));
+        }
+
+        const algorithmFPType * const products = buf.products.get();
+        const uint32_t * const idx             = buf.idx.get();
+        for (size_t l = 0; l < nIdx; l++)
+        {
+            const size_t j = idx[l];
+            if (j >= jBegin && j < jEnd)
+            {
+                row[j - jBegin] = distance(i, j, products[j]);
+            }
+        }
+        row[i - jBegin] = algorithmFPType(0.0);
+    }
+
+    /* Collects the neighbors of the row i into buf.neighbors, sorts them by the index if requested, returns their number */
+    size_t selectNeighbors(size_t i, RowBuffer & buf, size_t nIdx, algorithmFPType maxDistance, size_t k, bool sortByIndex) const
+    {
+        const algorithmFPType * const products = buf.products.get();
+        const uint32_t * const idx             = buf.idx.get();
+        Neighbor * const nb                    = buf.neighbors.get();
+
+        size_t nNeighbors = 0;
+        for (size_t l = 0; l < nIdx; l++)
+        {
+            const size_t j = idx[l];
+            if (j == i) continue;
+            const algorithmFPType d = distance(i, j, products[j]);
+            if (d <= maxDistance)
+            {
+                nb[nNeighbors].distance = d;
+                nb[nNeighbors].index    = j;
+                nNeighbors++;
+            }
+        }
+
+        if (k && nNeighbors > k)
+        {
+            if (!sortByIndex) return k;
+            daal::algorithms::internal::introSort<cpu>(nb, nb + nNeighbors, [](const Neighbor & a, const Neighbor & b) -> bool {
+                return (a.distance < b.distance) || (a.distance == b.distance && a.index < b.index);
+            });
+            nNeighbors = k;
+        }
+
+        if (sortByIndex)
+        {
+            daal::algorithms::internal::introSort<cpu>(nb, nb + nNeighbors,
+                                                       [](const Neighbor & a, const Neighbor & b) -> bool { return a.index < b.index; });
+        }
+        return nNeighbors;
+    }
+
+private:
+    static const size_t _blockSize = 128;
+
+    bool _centered;
+    size_t _n;
+    size_t _p;
+    daal::internal::ReadRowsCSR<algorithmFPType, cpu> _xBlock;
+    const algorithmFPType * _values;
+    const size_t * _cols;
+    const size_t * _rows;
+    services::internal::TArray<algorithmFPType, cpu> _shift;   /* c_i */
+    services::internal::TArray<algorithmFPType, cpu> _invNorm; /* 1 / s_i */
+    services::internal::TArray<algorithmFPType, cpu> _cscValues;
+    services::internal::TArray<uint32_t, cpu> _cscRowIdx;
+    services::internal::TArray<uint32_t, cpu> _cscColStart;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
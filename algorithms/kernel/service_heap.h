@@ -86,6 +86,22 @@ void popMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare c
     }
 }
 
+template <CpuType cpu, typename RandomAccessIterator, typename Compare>
+void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+{
+    auto i = last - first - 1;
+    while (0 < i)
+    {
+        const auto parent = heapParentIndex<cpu>(i);
+        if (!compare(*(first + parent), *(first + i)))
+        {
+            break;
+        }
+        iterSwap<cpu>(first + parent, first + i);
+        i = parent;
+    }
+}
+
 template <CpuType cpu, typename RandomAccessIterator, typename Compare>
 void makeMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
 {
@@ -102,7 +118,7 @@ DAAL_FORCEINLINE void sortMaxHeap(RandomAccessIterator first, RandomAccessIterat
 {
     while (1 < last - first)
     {
-        popMaxHeap<cpu>(first, --last, compare);
+        popMaxHeap<cpu>(first, last--, compare);
     }
 }
 
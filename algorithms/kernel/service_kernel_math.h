@@ -25,6 +25,9 @@
 #define __SERVICE_KERNEL_MATH_H__
 
 #include "externals/service_math.h"
+#include "externals/service_blas.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_data_utils.h"
 
 namespace daal
 {
@@ -71,6 +74,248 @@ FPType distance(const FPType * a, const FPType * b, size_t dim, FPType p)
     return daal::internal::Math<FPType, cpu>::sPowx(sum, (FPType)1.0 / p);
 }
 
+/* Adds squared differences between the value and the elements of the column: res[i] += (value - column[i])^2 */
+template <typename FPType, CpuType cpu>
+void addSquaredDifferences(FPType value, const FPType * column, size_t n, FPType * res)
+{
+    PRAGMA_IVDEP
+    PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        const FPType diff = value - column[i];
+        res[i] += diff * diff;
+    }
+}
+
+/* Squared Euclidean distances from the point x to the points stored by columns (structure of arrays):
+   res[i] = sum_k (x[k] - columns[k * stride + i])^2 for i < n. The dimensions up to maxDim are template parameters,
+   so the sum over the features is unrolled and the loop over the points is vectorized with the features of x held in registers */
+const size_t soaUnrolledMaxDim = 16;
+
+template <typename FPType, CpuType cpu, size_t dim>
+struct SoASquaredDistances
+{
+    static void compute(const FPType * x, const FPType * columns, size_t stride, size_t n, size_t runtimeDim, FPType * res)
+    {
+        if (runtimeDim != dim)
+        {
+            SoASquaredDistances<FPType, cpu, dim - 1>::compute(x, columns, stride, n, runtimeDim, res);
+            return;
+        }
+
+        FPType xk[dim];
+        for (size_t k = 0; k < dim; k++) xk[k] = x[k];
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; i++)
+        {
+            FPType sum = 0;
+            for (size_t k = 0; k < dim; k++)
+            {
+                const FPType diff = xk[k] - columns[k * stride + i];
+                sum += diff * diff;
+            }
+            res[i] = sum;
+        }
+    }
+};
+
+/* Dimensions above soaUnrolledMaxDim and zero dimension are processed column by column */
+template <typename FPType, CpuType cpu>
+struct SoASquaredDistances<FPType, cpu, 0>
+{
+    static void compute(const FPType * x, const FPType * columns, size_t stride, size_t n, size_t runtimeDim, FPType * res)
+    {
+        daal::services::internal::service_memset_seq<FPType, cpu>(res, FPType(0), n);
+        for (size_t k = 0; k < runtimeDim; k++)
+        {
+            addSquaredDifferences<FPType, cpu>(x[k], columns + k * stride, n, res);
+        }
+    }
+};
+
+template <typename FPType, CpuType cpu>
+void squaredDistancesSoA(const FPType * x, const FPType * columns, size_t stride, size_t n, size_t dim, FPType * res)
+{
+    if (dim > soaUnrolledMaxDim)
+        SoASquaredDistances<FPType, cpu, 0>::compute(x, columns, stride, n, dim, res);
+    else
+        SoASquaredDistances<FPType, cpu, soaUnrolledMaxDim>::compute(x, columns, stride, n, dim, res);
+}
+
+/* Computes tiles of squared Euclidean distances between the rows of two dense matrices.
+   For large dimensions the tile is computed as ||a||^2 + ||b||^2 - 2ab with GEMM, for small dimensions
+   the reference rows are transposed and processed by a register blocked loop vectorized over the reference rows,
+   the dimensions up to soaUnrolledMaxDim use the loops unrolled over the features.
+   The scratch memory is allocated once for the maximal sizes of the tiles, so the object is intended to be created per thread or per block */
+template <typename FPType, CpuType cpu>
+class PairwiseSquaredDistances
+{
+public:
+    /* Dimensions starting from this value are processed with GEMM */
+    static const size_t gemmMinDim = 32;
+
+    PairwiseSquaredDistances(size_t maxQueryRows, size_t maxReferenceRows, size_t dim)
+        : _maxQueryRows(maxQueryRows), _maxReferenceRows(maxReferenceRows), _dim(dim)
+    {
+        _buffer.reset(useGemm() ? maxQueryRows + maxReferenceRows : dim * maxReferenceRows);
+    }
+
+    bool isValid() const { return _buffer.get() || !(_dim && _maxReferenceRows); }
+
+    /* Computes res[i * nReference + j] = ||query_i - reference_j||^2 for the rows of query (nQuery x dim with leading dimension ldq)
+       and the rows of reference (nReference x dim with leading dimension ldr) */
+    void compute(const FPType * query, size_t nQuery, size_t ldq, const FPType * reference, size_t nReference, size_t ldr, FPType * res)
+    {
+        DAAL_ASSERT(nQuery <= _maxQueryRows && nReference <= _maxReferenceRows);
+        if (!nQuery || !nReference) return;
+        if (useGemm())
+            computeGemm(query, nQuery, ldq, reference, nReference, ldr, res);
+        else
+            computeBlocked(query, nQuery, ldq, reference, nReference, ldr, res);
+    }
+
+    /* Checks ||query_i - reference_j||^2 <= threshold for the value dist computed by the last compute() call.
+       The GEMM expansion loses precision when the distance is small compared to the norms of the rows,
+       so the candidates within the rounding error bound of the threshold are recomputed exactly */
+    bool isWithin(FPType dist, FPType threshold, size_t i, size_t j, const FPType * queryRow, const FPType * referenceRow) const
+    {
+        if (!useGemm()) return dist <= threshold;
+
+        const FPType * const queryNorms     = _buffer.get();
+        const FPType * const referenceNorms = queryNorms + _maxQueryRows;
+        const FPType errorBound = FPType(2 * _dim) * services::internal::EpsilonVal<FPType>::get() * (queryNorms[i] + referenceNorms[j]);
+        if (dist < threshold - errorBound) return true;
+        if (dist > threshold + errorBound) return false;
+        return distancePow2<FPType, cpu>(queryRow, referenceRow, _dim) <= threshold;
+    }
+
+private:
+    bool useGemm() const { return _dim >= gemmMinDim; }
+
+    static void computeSquaredNorms(const FPType * x, size_t n, size_t ld, size_t dim, FPType * norms)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            const FPType * const row = x + i * ld;
+            FPType sum               = 0;
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < dim; k++)
+            {
+                sum += row[k] * row[k];
+            }
+            norms[i] = sum;
+        }
+    }
+
+    void computeGemm(const FPType * query, size_t nQuery, size_t ldq, const FPType * reference, size_t nReference, size_t ldr, FPType * res)
+    {
+        FPType * const queryNorms     = _buffer.get();
+        FPType * const referenceNorms = queryNorms + _maxQueryRows;
+        computeSquaredNorms(query, nQuery, ldq, _dim, queryNorms);
+        computeSquaredNorms(reference, nReference, ldr, _dim, referenceNorms);
+
+        /* Row-major res = -2 * query * reference^T, that is column-major res^T = -2 * reference * query^T */
+        const char transa  = 't';
+        const char transb  = 'n';
+        const DAAL_INT m   = (DAAL_INT)nReference;
+        const DAAL_INT n   = (DAAL_INT)nQuery;
+        const DAAL_INT k   = (DAAL_INT)_dim;
+        const DAAL_INT lda = (DAAL_INT)ldr;
+        const DAAL_INT ldb = (DAAL_INT)ldq;
+        const DAAL_INT ldc = (DAAL_INT)nReference;
+        const FPType alpha = -2.0;
+        const FPType beta  = 0.0;
+        daal::internal::Blas<FPType, cpu>::xxgemm(&transa, &transb, &m, &n, &k, &alpha, reference, &lda, query, &ldb, &beta, res, &ldc);
+
+        for (size_t i = 0; i < nQuery; i++)
+        {
+            FPType * const resRow = res + i * nReference;
+            const FPType qNorm    = queryNorms[i];
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nReference; j++)
+            {
+                const FPType dist = resRow[j] + qNorm + referenceNorms[j];
+                /* Cancellation may produce small negative values for close points */
+                resRow[j] = (dist < (FPType)0) ? (FPType)0 : dist;
+            }
+        }
+    }
+
+    void computeBlocked(const FPType * query, size_t nQuery, size_t ldq, const FPType * reference, size_t nReference, size_t ldr, FPType * res)
+    {
+        const size_t dim    = _dim;
+        FPType * const refT = _buffer.get();
+        for (size_t j = 0; j < nReference; j++)
+        {
+            for (size_t k = 0; k < dim; k++)
+            {
+                refT[k * nReference + j] = reference[j * ldr + k];
+            }
+        }
+
+        if (dim <= soaUnrolledMaxDim)
+        {
+            for (size_t i = 0; i < nQuery; i++)
+            {
+                squaredDistancesSoA<FPType, cpu>(query + i * ldq, refT, nReference, nReference, dim, res + i * nReference);
+            }
+            return;
+        }
+
+        /* Four query rows share every load of the transposed reference values */
+        const size_t blockSize = 4;
+        size_t i               = 0;
+        for (; i + blockSize <= nQuery; i += blockSize)
+        {
+            FPType * const r0 = res + i * nReference;
+            FPType * const r1 = r0 + nReference;
+            FPType * const r2 = r1 + nReference;
+            FPType * const r3 = r2 + nReference;
+            daal::services::internal::service_memset_seq<FPType, cpu>(r0, FPType(0), blockSize * nReference);
+
+            for (size_t k = 0; k < dim; k++)
+            {
+                const FPType q0         = query[i * ldq + k];
+                const FPType q1         = query[(i + 1) * ldq + k];
+                const FPType q2         = query[(i + 2) * ldq + k];
+                const FPType q3         = query[(i + 3) * ldq + k];
+                const FPType * const rk = refT + k * nReference;
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nReference; j++)
+                {
+                    const FPType d0 = q0 - rk[j];
+                    const FPType d1 = q1 - rk[j];
+                    const FPType d2 = q2 - rk[j];
+                    const FPType d3 = q3 - rk[j];
+                    r0[j] += d0 * d0;
+                    r1[j] += d1 * d1;
+                    r2[j] += d2 * d2;
+                    r3[j] += d3 * d3;
+                }
+            }
+        }
+        for (; i < nQuery; i++)
+        {
+            FPType * const r = res + i * nReference;
+            daal::services::internal::service_memset_seq<FPType, cpu>(r, FPType(0), nReference);
+            for (size_t k = 0; k < dim; k++)
+            {
+                addSquaredDifferences<FPType, cpu>(query[i * ldq + k], refT + k * nReference, nReference, r);
+            }
+        }
+    }
+
+    size_t _maxQueryRows;
+    size_t _maxReferenceRows;
+    size_t _dim;
+    services::internal::TArray<FPType, cpu> _buffer;
+};
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
@@ -0,0 +1,316 @@
+/* file: service_reduced_precision_gemm.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Matrix products in reduced precision for the prediction and transformation kernels.
+//--
+*/
+
+#ifndef __SERVICE_REDUCED_PRECISION_GEMM_H__
+#define __SERVICE_REDUCED_PRECISION_GEMM_H__
+
+#include "algorithms/algorithm_types.h"
+#include "service/kernel/service_defines.h"
+#include "service/kernel/service_arrays.h"
+#include "services/error_handling.h"
+
+#if defined(__INTEL_COMPILER) && defined(DAAL_CPU)
+    #if (__CPUID__(DAAL_CPU) == __avx512__)
+        #include <immintrin.h>
+        #define __DAAL_REDUCED_PRECISION_AVX512__
+    #endif
+#endif
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/* Computes the products c[m,n] = a[m,k] * b[n,k]^T of the row-major matrices with the operands of the reduced precision.
+   The matrix b is packed once by init(), the rows of a are converted one by one in compute(), so that a is not copied.
+
+   bfloat16Precision: the operands are rounded to bfloat16 to the nearest even, the products of pairs are accumulated in single precision.
+   int8Precision: the rows b_j and a_i are quantized symmetrically to [-127, 127] with the scales max|b_j| / 127 and max|a_i| / 127.
+   a_i is stored as unsigned values shifted by 128 as required by the VNNI instructions, the shift is compensated by the sums of b_j:
+   c(i,j) = scale(a_i) * scale(b_j) * (sum((qa_i + 128) * qb_j) - 128 * sum(qb_j)).
+   The integer sums are exact for the chunks of up to _int8Chunk columns.
+
+   The AVX-512 VNNI and BF16 instructions are used in the avx512 branch when the processor supports them, the matrix extensions (AMX)
+   of the processors that have them are not used as these processors support the VNNI and BF16 instructions as well */
+template <typename algorithmFPType, CpuType cpu>
+class ReducedPrecisionGemm
+{
+public:
+    ReducedPrecisionGemm() : _precision(fullPrecision), _n(0), _k(0), _kPadded(0), _useIntrinsics(false) {}
+
+    /* Packs the matrix b[n,k] with the leading dimension ldb, fullPrecision leaves the object empty */
+    services::Status init(InferencePrecision precision, const algorithmFPType * b, size_t n, size_t k, size_t ldb)
+    {
+        _precision = precision;
+        _n         = n;
+        _k         = k;
+        if (precision == bfloat16Precision) return initBFloat16(b, ldb);
+        if (precision == int8Precision) return initInt8(b, ldb);
+        DAAL_CHECK(precision == fullPrecision, services::ErrorIncorrectParameter);
+        return services::Status();
+    }
+
+    bool isReduced() const { return _precision != fullPrecision; }
+
+    /* Computes c[i * ldc + j] for the rows of a[m,k] with the leading dimension lda, can be called from several threads */
+    services::Status compute(const algorithmFPType * a, size_t m, size_t lda, algorithmFPType * c, size_t ldc) const
+    {
+        return (_precision == bfloat16Precision) ? computeBFloat16(a, m, lda, c, ldc) : computeInt8(a, m, lda, c, ldc);
+    }
+
+private:
+    static int getCpuFeatures()
+    {
+        static const int features = __daal_serv_cpu_feature_detect();
+        return features;
+    }
+
+    static size_t roundUp(size_t value, size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+    static uint16_t toBFloat16(algorithmFPType value)
+    {
+        _daal_sp_union_t u;
+        u.fp = (float)value;
+        if ((u.hex[0] & 0x7FFFFFFFu) > 0x7F800000u) return uint16_t((u.hex[0] >> 16) | 0x40u); /* quiet NaN */
+        return uint16_t((u.hex[0] + 0x7FFFu + ((u.hex[0] >> 16) & 1u)) >> 16);
+    }
+
+    static float fromBFloat16(uint16_t value)
+    {
+        _daal_sp_union_t u;
+        u.hex[0] = uint32_t(value) << 16;
+        return u.fp;
+    }
+
+    static algorithmFPType computeScale(const algorithmFPType * x, size_t k)
+    {
+        algorithmFPType maxAbs = algorithmFPType(0);
+        for (size_t l = 0; l < k; l++)
+        {
+            const algorithmFPType absValue = (x[l] < algorithmFPType(0)) ? -x[l] : x[l];
+            maxAbs                         = (absValue > maxAbs) ? absValue : maxAbs;
+        }
+        return maxAbs / algorithmFPType(127);
+    }
+
+    static int quantize(algorithmFPType value, algorithmFPType invScale)
+    {
+        const algorithmFPType q = value * invScale;
+        const int iq            = int(q + ((q < algorithmFPType(0)) ? algorithmFPType(-0.5) : algorithmFPType(0.5)));
+        return (iq > 127) ? 127 : ((iq < -127) ? -127 : iq);
+    }
+
+    services::Status initBFloat16(const algorithmFPType * b, size_t ldb)
+    {
+        _kPadded = roundUp(_k, _bf16Block);
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _n, _kPadded);
+        uint16_t * bPacked = _bBFloat16.reset(_n * _kPadded);
+        DAAL_CHECK_MALLOC(bPacked);
+
+        for (size_t j = 0; j < _n; j++)
+        {
+            for (size_t l = 0; l < _k; l++)
+            {
+                bPacked[j * _kPadded + l] = toBFloat16(b[j * ldb + l]);
+            }
+            for (size_t l = _k; l < _kPadded; l++)
+            {
+                bPacked[j * _kPadded + l] = 0;
+            }
+        }
+
+        _useIntrinsics = (cpu == avx512) && (getCpuFeatures() & daal::internal::cpu_feature_avx512_bf16);
+        return services::Status();
+    }
+
+    services::Status initInt8(const algorithmFPType * b, size_t ldb)
+    {
+        _kPadded             = roundUp(_k, _int8Block);
+        const size_t nChunks = _kPadded / _int8Chunk + !!(_kPadded % _int8Chunk);
+
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _n, _kPadded);
+        DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, _n, nChunks);
+        int8_t * bPacked        = _bInt8.reset(_n * _kPadded);
+        int32_t * bSums         = _bSums.reset(_n * nChunks);
+        algorithmFPType * scale = _bScales.reset(_n);
+        DAAL_CHECK_MALLOC(bPacked && bSums && scale);
+
+        for (size_t j = 0; j < _n; j++)
+        {
+            const algorithmFPType * bRow   = b + j * ldb;
+            scale[j]                       = computeScale(bRow, _k);
+            const algorithmFPType invScale = (scale[j] > algorithmFPType(0)) ? algorithmFPType(1) / scale[j] : algorithmFPType(0);
+
+            for (size_t l = 0; l < _kPadded; l++)
+            {
+                bPacked[j * _kPadded + l] = int8_t((l < _k) ? quantize(bRow[l], invScale) : 0);
+            }
+            for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+            {
+                const size_t lEnd = ((iChunk + 1) * _int8Chunk < _kPadded) ? (iChunk + 1) * _int8Chunk : _kPadded;
+                int32_t sum       = 0;
+                for (size_t l = iChunk * _int8Chunk; l < lEnd; l++)
+                {
+                    sum += bPacked[j * _kPadded + l];
+                }
+                bSums[j * nChunks + iChunk] = sum;
+            }
+        }
+
+        _useIntrinsics = (cpu == avx512) && (getCpuFeatures() & daal::internal::cpu_feature_avx512_vnni);
+        return services::Status();
+    }
+
+    services::Status computeBFloat16(const algorithmFPType * a, size_t m, size_t lda, algorithmFPType * c, size_t ldc) const
+    {
+        services::internal::TArray<uint16_t, cpu> aRowArray(_kPadded);
+        uint16_t * aRow = aRowArray.get();
+        DAAL_CHECK_MALLOC(aRow);
+        for (size_t l = _k; l < _kPadded; l++)
+        {
+            aRow[l] = 0;
+        }
+
+        const uint16_t * bPacked = _bBFloat16.get();
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t l = 0; l < _k; l++)
+            {
+                aRow[l] = toBFloat16(a[i * lda + l]);
+            }
+            for (size_t j = 0; j < _n; j++)
+            {
+                c[i * ldc + j] = algorithmFPType(dotBFloat16(aRow, bPacked + j * _kPadded));
+            }
+        }
+        return services::Status();
+    }
+
+    services::Status computeInt8(const algorithmFPType * a, size_t m, size_t lda, algorithmFPType * c, size_t ldc) const
+    {
+        services::internal::TArray<uint8_t, cpu> aRowArray(_kPadded);
+        uint8_t * aRow = aRowArray.get();
+        DAAL_CHECK_MALLOC(aRow);
+        for (size_t l = _k; l < _kPadded; l++)
+        {
+            aRow[l] = 128;
+        }
+
+        const size_t nChunks           = _kPadded / _int8Chunk + !!(_kPadded % _int8Chunk);
+        const int8_t * bPacked         = _bInt8.get();
+        const int32_t * bSums          = _bSums.get();
+        const algorithmFPType * bScale = _bScales.get();
+        for (size_t i = 0; i < m; i++)
+        {
+            const algorithmFPType * aSrc   = a + i * lda;
+            const algorithmFPType aScale   = computeScale(aSrc, _k);
+            const algorithmFPType invScale = (aScale > algorithmFPType(0)) ? algorithmFPType(1) / aScale : algorithmFPType(0);
+            for (size_t l = 0; l < _k; l++)
+            {
+                aRow[l] = uint8_t(quantize(aSrc[l], invScale) + 128);
+            }
+
+            for (size_t j = 0; j < _n; j++)
+            {
+                const int8_t * bRow = bPacked + j * _kPadded;
+                algorithmFPType sum = algorithmFPType(0);
+                for (size_t iChunk = 0; iChunk < nChunks; iChunk++)
+                {
+                    const size_t lBegin = iChunk * _int8Chunk;
+                    const size_t lEnd   = (lBegin + _int8Chunk < _kPadded) ? lBegin + _int8Chunk : _kPadded;
+                    const int32_t acc   = dotInt8(aRow + lBegin, bRow + lBegin, lEnd - lBegin);
+                    sum += algorithmFPType(acc - 128 * bSums[j * nChunks + iChunk]);
+                }
+                c[i * ldc + j] = aScale * bScale[j] * sum;
+            }
+        }
+        return services::Status();
+    }
+
+    float dotBFloat16(const uint16_t * a, const uint16_t * b) const
+    {
+#if defined(__DAAL_REDUCED_PRECISION_AVX512__)
+        if (_useIntrinsics)
+        {
+            __m512 acc = _mm512_setzero_ps();
+            for (size_t l = 0; l < _kPadded; l += _bf16Block)
+            {
+                acc = _mm512_dpbf16_ps(acc, (__m512bh)_mm512_loadu_si512(a + l), (__m512bh)_mm512_loadu_si512(b + l));
+            }
+            return _mm512_reduce_add_ps(acc);
+        }
+#endif
+        float sum = 0.0f;
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t l = 0; l < _kPadded; l++)
+        {
+            sum += fromBFloat16(a[l]) * fromBFloat16(b[l]);
+        }
+        return sum;
+    }
+
+    /* n is a multiple of _int8Block */
+    int32_t dotInt8(const uint8_t * a, const int8_t * b, size_t n) const
+    {
+#if defined(__DAAL_REDUCED_PRECISION_AVX512__)
+        if (_useIntrinsics)
+        {
+            __m512i acc = _mm512_setzero_si512();
+            for (size_t l = 0; l < n; l += _int8Block)
+            {
+                acc = _mm512_dpbusd_epi32(acc, _mm512_loadu_si512(a + l), _mm512_loadu_si512(b + l));
+            }
+            return _mm512_reduce_add_epi32(acc);
+        }
+#endif
+        int32_t sum = 0;
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t l = 0; l < n; l++)
+        {
+            sum += int32_t(a[l]) * int32_t(b[l]);
+        }
+        return sum;
+    }
+
+    static const size_t _bf16Block = 32;      /* number of bfloat16 values in the AVX-512 register */
+    static const size_t _int8Block = 64;      /* number of 8-bit values in the AVX-512 register */
+    static const size_t _int8Chunk = 1 << 15; /* 255 * 127 * _int8Chunk does not overflow 32-bit integer */
+
+    InferencePrecision _precision;
+    size_t _n;
+    size_t _k;
+    size_t _kPadded;
+    bool _useIntrinsics;
+    services::internal::TArray<uint16_t, cpu> _bBFloat16;
+    services::internal::TArray<int8_t, cpu> _bInt8;
+    services::internal::TArray<int32_t, cpu> _bSums;
+    services::internal::TArray<algorithmFPType, cpu> _bScales;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,186 @@
+/* file: service_sell_matrix.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sparse matrix in the SELL-C-sigma layout built from the data in the CSR format.
+//--
+*/
+
+#ifndef __SERVICE_SELL_MATRIX_H__
+#define __SERVICE_SELL_MATRIX_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/threading/threading.h"
+#include "algorithms/kernel/service_sort.h"
+#include "service/kernel/service_arrays.h"
+#include "service/kernel/service_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace internal
+{
+/* The rows of the matrix are sorted by the numbers of non-zero values within the windows of sortWindow rows and grouped
+   into the chunks of chunkSize rows. Each chunk stores its values and 0-based column indices column by column, padded
+   to the longest row of the chunk, so the products with dense vectors are vectorized across the rows of the chunk.
+   The matrix remembers the CSR data it was converted from, which lets the callers reuse the conversion across calls */
+template <typename algorithmFPType, CpuType cpu>
+class SellCSigmaMatrix
+{
+public:
+    static const size_t chunkSize  = 8;
+    static const size_t sortWindow = 32 * chunkSize;
+
+    SellCSigmaMatrix() : _table(nullptr), _data(nullptr), _nRows(0), _nValues(0), _nChunks(0), _isUseful(false) {}
+
+    /* Returns true if the matrix keeps the result of the conversion of the given CSR data */
+    bool isConvertedFrom(const data_management::NumericTable * table, const algorithmFPType * data, const size_t * rowOffsets, size_t nRows) const
+    {
+        return (_table && table == _table && data == _data && nRows == _nRows && rowOffsets[nRows] - rowOffsets[0] == _nValues);
+    }
+
+    /* Forgets the CSR data the matrix was converted from, the next use of the matrix converts the data again */
+    void invalidate() { _table = nullptr; }
+
+    /* Returns false if the padding of the chunks makes the layout too large compared to the CSR data,
+       the callers process the CSR data directly in this case */
+    bool isUseful() const { return _isUseful; }
+
+    services::Status convert(const data_management::NumericTable * table, const algorithmFPType * data, const size_t * colIndices,
+                             const size_t * rowOffsets, size_t nRows, size_t indexBase)
+    {
+        _table    = nullptr;
+        _isUseful = false;
+        _nRows    = nRows;
+        _nChunks  = nRows / chunkSize + !!(nRows % chunkSize);
+        if (!nRows) return services::Status();
+
+        const size_t nSlots = _nChunks * chunkSize;
+        _rows.reset(nSlots);
+        _chunkOffsets.reset(_nChunks + 1);
+        DAAL_CHECK_MALLOC(_rows.get() && _chunkOffsets.get());
+        size_t * rows         = _rows.get();
+        size_t * chunkOffsets = _chunkOffsets.get();
+
+        /* The slots after the last row keep nRows and are skipped in the products */
+        for (size_t i = 0; i < nSlots; i++) rows[i] = (i < nRows) ? i : nRows;
+
+        const size_t nWindows = nRows / sortWindow + !!(nRows % sortWindow);
+        daal::threader_for(nWindows, nWindows, [&](size_t iWindow) {
+            const size_t iStart = iWindow * sortWindow;
+            const size_t iEnd   = (iStart + sortWindow < nRows) ? iStart + sortWindow : nRows;
+            introSort<cpu>(rows + iStart, rows + iEnd,
+                           [=](size_t i, size_t j) { return rowOffsets[i + 1] - rowOffsets[i] > rowOffsets[j + 1] - rowOffsets[j]; });
+        });
+
+        chunkOffsets[0] = 0;
+        for (size_t iChunk = 0; iChunk < _nChunks; iChunk++)
+        {
+            size_t width = 0;
+            for (size_t r = 0; r < chunkSize; r++)
+            {
+                const size_t row = rows[iChunk * chunkSize + r];
+                if (row < nRows && rowOffsets[row + 1] - rowOffsets[row] > width) width = rowOffsets[row + 1] - rowOffsets[row];
+            }
+            chunkOffsets[iChunk + 1] = chunkOffsets[iChunk] + width * chunkSize;
+        }
+
+        /* Keep the data in the CSR format if the padding grows the number of the values by more than a half */
+        _nValues = rowOffsets[nRows] - rowOffsets[0];
+        _table   = table;
+        _data    = data;
+        if (2 * chunkOffsets[_nChunks] > 3 * _nValues) return services::Status();
+
+        _values.reset(chunkOffsets[_nChunks]);
+        _cols.reset(chunkOffsets[_nChunks]);
+        if (chunkOffsets[_nChunks] && (!_values.get() || !_cols.get()))
+        {
+            _table = nullptr;
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        algorithmFPType * values = _values.get();
+        size_t * cols            = _cols.get();
+
+        daal::threader_for(_nChunks, _nChunks, [&](size_t iChunk) {
+            const size_t width = (chunkOffsets[iChunk + 1] - chunkOffsets[iChunk]) / chunkSize;
+            for (size_t r = 0; r < chunkSize; r++)
+            {
+                const size_t row    = rows[iChunk * chunkSize + r];
+                const size_t length = (row < nRows) ? rowOffsets[row + 1] - rowOffsets[row] : 0;
+                const size_t start  = (row < nRows) ? rowOffsets[row] - indexBase : 0;
+                for (size_t j = 0; j < width; j++)
+                {
+                    const size_t dst = chunkOffsets[iChunk] + j * chunkSize + r;
+                    values[dst]      = (j < length) ? data[start + j] : algorithmFPType(0);
+                    cols[dst]        = (j < length) ? colIndices[start + j] - indexBase : 0;
+                }
+            }
+        });
+        _isUseful = true;
+        return services::Status();
+    }
+
+    /* Computes y = A * x for the dense vector x, y is indexed by the rows of the original CSR data */
+    void multiply(const algorithmFPType * x, algorithmFPType * y) const
+    {
+        const algorithmFPType * values = _values.get();
+        const size_t * cols            = _cols.get();
+        const size_t * rows            = _rows.get();
+        const size_t * chunkOffsets    = _chunkOffsets.get();
+        const size_t nRows             = _nRows;
+
+        daal::threader_for(_nChunks, _nChunks, [&](size_t iChunk) {
+            algorithmFPType sums[chunkSize] = { 0 };
+
+            for (size_t k = chunkOffsets[iChunk]; k < chunkOffsets[iChunk + 1]; k += chunkSize)
+            {
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for (size_t r = 0; r < chunkSize; r++)
+                {
+                    sums[r] += values[k + r] * x[cols[k + r]];
+                }
+            }
+
+            for (size_t r = 0; r < chunkSize; r++)
+            {
+                const size_t row = rows[iChunk * chunkSize + r];
+                if (row < nRows) y[row] = sums[r];
+            }
+        });
+    }
+
+private:
+    const data_management::NumericTable * _table;
+    const algorithmFPType * _data;
+    size_t _nRows;
+    size_t _nValues;
+    size_t _nChunks;
+    bool _isUseful;
+    services::internal::TArray<algorithmFPType, cpu> _values;
+    services::internal::TArray<size_t, cpu> _cols;
+    services::internal::TArray<size_t, cpu> _rows;
+    services::internal::TArray<size_t, cpu> _chunkOffsets;
+};
+
+} // namespace internal
+} // namespace algorithms
+} // namespace daal
+
+#endif
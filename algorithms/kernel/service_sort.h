@@ -25,7 +25,9 @@
 #define __SERVICE_SORT_H__
 
 #include "service/kernel/service_utils.h"
+#include "service/kernel/service_arrays.h"
 #include "algorithms/kernel/service_heap.h"
+#include "algorithms/threading/threading.h"
 #include "services/collection.h"
 
 #if defined(__INTEL_COMPILER_BUILD_DATE)
@@ -762,6 +764,49 @@ DAAL_FORCEINLINE void introSort(RandomAccessIterator first, RandomAccessIterator
     internalIntroSort<cpu>(first, last, last - first, compare);
 }
 
+template <CpuType cpu, typename RandomAccessIterator, typename RankType, typename Diff, typename Compare>
+static void internalMultiSelect(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterator base, const RankType * rankFirst,
+                                const RankType * rankLast, Diff depthLimit, Compare compare)
+{
+    while (rankFirst != rankLast)
+    {
+        if (last - first <= DAAL_INSERTION_SORT_MAX_SIZE_IN_INTROSORT || depthLimit <= 0)
+        {
+            internalIntroSort<cpu>(first, last, last - first, compare);
+            return;
+        }
+
+        RandomAccessIterator partFirst, partLast;
+        partition3<cpu>(first, last, partFirst, partLast, compare);
+
+        depthLimit /= 2;
+        depthLimit += depthLimit / 2;
+
+        /* The ranks that fall into the range of the elements equal to the pivot are already in place */
+        const RankType * rankMid = rankFirst;
+        while (rankMid != rankLast && base + *rankMid < partFirst) ++rankMid;
+        const RankType * rankHigh = rankMid;
+        while (rankHigh != rankLast && base + *rankHigh < partLast) ++rankHigh;
+
+        if (rankFirst != rankMid) internalMultiSelect<cpu>(first, partFirst, base, rankFirst, rankMid, depthLimit, compare);
+        first     = partLast;
+        rankFirst = rankHigh;
+    }
+}
+
+/**
+ * \brief Rearranges the elements of the range so that the element at every position first + ranks[i]
+ *        is the one that would be there if the range was sorted. Only the partitions that contain
+ *        the ranks are processed, so selecting a few ranks takes linear time on average.
+ * \param[in] ranks   Positions to select in ascending order
+ * \param[in] nRanks  Number of the positions
+ */
+template <CpuType cpu, typename RandomAccessIterator, typename RankType, typename Compare>
+DAAL_FORCEINLINE void multiSelect(RandomAccessIterator first, RandomAccessIterator last, const RankType * ranks, size_t nRanks, Compare compare)
+{
+    internalMultiSelect<cpu>(first, last, first, ranks, ranks + nRanks, last - first, compare);
+}
+
 template <CpuType cpu, typename ForwardIterator, typename Compare>
 ForwardIterator isSortedUntil(ForwardIterator first, ForwardIterator last, Compare compare)
 {
@@ -784,6 +829,170 @@ DAAL_FORCEINLINE bool isSorted(ForwardIterator first, ForwardIterator last, Comp
     return (isSortedUntil<cpu>(first, last, compare) == last);
 }
 
+
+/**
+ * \brief Maps the key of the radix sort to the unsigned integer of the same size,
+ *        so that the order of the integers matches the order of the keys
+ */
+template <typename KeyType>
+struct RadixSortKeyTraits;
+
+template <>
+struct RadixSortKeyTraits<float>
+{
+    typedef unsigned int UIntType;
+    static DAAL_FORCEINLINE UIntType toUInt(const float & key)
+    {
+        const UIntType bits = __RADIX_SORT_CAST32(key);
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+};
+
+template <>
+struct RadixSortKeyTraits<double>
+{
+    typedef DAAL_UINT64 UIntType;
+    static DAAL_FORCEINLINE UIntType toUInt(const double & key)
+    {
+        const UIntType bits = __RADIX_SORT_CAST64(key);
+        return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+    }
+};
+
+template <>
+struct RadixSortKeyTraits<int>
+{
+    typedef unsigned int UIntType;
+    static DAAL_FORCEINLINE UIntType toUInt(const int & key) { return static_cast<UIntType>(key) ^ 0x80000000u; }
+};
+
+/* Minimal number of items per block of the parallel radix sort */
+const size_t radixSortMinBlockSize = 32768;
+
+template <typename Func>
+DAAL_FORCEINLINE void radixSortForBlocks(size_t nBlocks, const Func & func)
+{
+    if (nBlocks == 1)
+    {
+        func(0);
+    }
+    else
+    {
+        daal::threader_for(nBlocks, nBlocks, func);
+    }
+}
+
+/**
+ * \brief Stable LSD radix sort of the array of items by the keys of the float, double or int type.
+ *        The digits are 8-bit wide, the passes over the digits equal for all the keys are skipped.
+ *        Arrays of more than radixSortMinBlockSize items are split into blocks processed in parallel:
+ *        the digits are counted per block and each block scatters its items to its own offsets.
+ *
+ * \param x[in,out]  Array to sort
+ * \param buffer     Buffer of n items
+ * \param n[in]      Length of the arrays
+ * \param getKey[in] Function that returns the constant reference to the key of the item
+ */
+template <CpuType cpu, typename KeyType, typename ItemType, typename GetKey>
+services::Status radixSort(ItemType * x, ItemType * buffer, size_t n, const GetKey & getKey)
+{
+    typedef RadixSortKeyTraits<KeyType> Traits;
+    const size_t nBins   = 256;
+    const size_t nPasses = sizeof(typename Traits::UIntType);
+
+    size_t nBlocks        = n / radixSortMinBlockSize;
+    const size_t nThreads = daal::threader_get_threads_number();
+    if (nBlocks > nThreads) nBlocks = nThreads;
+    if (nBlocks < 1) nBlocks = 1;
+    const size_t blockSize = n / nBlocks + !!(n % nBlocks);
+
+    size_t localHistogram[nBins];
+    daal::services::internal::TArray<size_t, cpu> histogramArray(nBlocks > 1 ? nBlocks * nBins : 0);
+    size_t * histograms = (nBlocks > 1 ? histogramArray.get() : localHistogram);
+    DAAL_CHECK_MALLOC(histograms);
+
+    ItemType * src = x;
+    ItemType * dst = buffer;
+    for (size_t pass = 0; pass < nPasses; pass++)
+    {
+        const size_t shift = pass * 8;
+
+        radixSortForBlocks(nBlocks, [&](size_t iBlock) {
+            size_t * histogram = histograms + iBlock * nBins;
+            const size_t end   = (iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n;
+            for (size_t i = 0; i < nBins; i++) histogram[i] = 0;
+            for (size_t i = iBlock * blockSize; i < end; i++)
+            {
+                histogram[(Traits::toUInt(getKey(src[i])) >> shift) & (nBins - 1)]++;
+            }
+        });
+
+        /* Offsets of the digits are ordered by the digit and then by the block to keep the sort stable */
+        bool isDigitConstant = false;
+        size_t offset        = 0;
+        for (size_t iBin = 0; iBin < nBins; iBin++)
+        {
+            const size_t binStart = offset;
+            for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+            {
+                const size_t count                = histograms[iBlock * nBins + iBin];
+                histograms[iBlock * nBins + iBin] = offset;
+                offset += count;
+            }
+            isDigitConstant |= (offset - binStart == n);
+        }
+        if (isDigitConstant) continue;
+
+        radixSortForBlocks(nBlocks, [&](size_t iBlock) {
+            size_t * histogram = histograms + iBlock * nBins;
+            const size_t end   = (iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n;
+            for (size_t i = iBlock * blockSize; i < end; i++)
+            {
+                dst[histogram[(Traits::toUInt(getKey(src[i])) >> shift) & (nBins - 1)]++] = src[i];
+            }
+        });
+
+        ItemType * tmp = src;
+        src            = dst;
+        dst            = tmp;
+    }
+
+    if (src != x)
+    {
+        radixSortForBlocks(nBlocks, [&](size_t iBlock) {
+            const size_t end = (iBlock + 1) * blockSize < n ? (iBlock + 1) * blockSize : n;
+            for (size_t i = iBlock * blockSize; i < end; i++) x[i] = src[i];
+        });
+    }
+    return services::Status();
+}
+
+/**
+ * \brief Radix sort of the array of keys of the float, double or int type
+ *
+ * \param x[in,out] Array to sort
+ * \param buffer    Buffer of n keys
+ * \param n[in]     Length of the arrays
+ */
+template <CpuType cpu, typename KeyType>
+services::Status radixSort(KeyType * x, KeyType * buffer, size_t n)
+{
+    return radixSort<cpu, KeyType>(x, buffer, n, [](const KeyType & key) -> const KeyType & { return key; });
+}
+
+/**
+ * \brief Radix sort of the array of key-index pairs that have the key field of the float, double or int type
+ *
+ * \param x[in,out] Array to sort
+ * \param buffer    Buffer of n pairs
+ * \param n[in]     Length of the arrays
+ */
+template <CpuType cpu, typename KeyType, typename ItemType>
+services::Status radixSortByKey(ItemType * x, ItemType * buffer, size_t n)
+{
+    return radixSort<cpu, KeyType>(x, buffer, n, [](const ItemType & item) -> const KeyType & { return item.key; });
+}
+
 } // namespace internal
 } // namespace algorithms
 } // namespace daal
@@ -74,10 +74,12 @@ public:
     {
         if (_impl) _daal_del_task_group(_impl);
     }
+    /* In the deterministic mode the task runs immediately in the calling thread, so the tasks run in the order of submission
+       and only the parallel loops inside them run in parallel */
     template <typename F>
     void run(F & f)
     {
-        if (_impl)
+        if (_impl && !threader_env()->getDeterministicGroups())
             _daal_run_task_group(_impl, task_impl<F>::create(f));
         else
             f();
@@ -24,6 +24,9 @@
 #ifndef __SORTING_IMPL__
 #define __SORTING_IMPL__
 
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/threading/threading.h"
+
 namespace daal
 {
 namespace algorithms
@@ -32,6 +35,9 @@ namespace sorting
 {
 namespace internal
 {
+/* Number of observations starting from which the features are sorted with the parallel radix sort */
+const size_t radixSortMinNumberOfVectors = 2 * daal::algorithms::internal::radixSortMinBlockSize;
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable & inputTable, NumericTable & outputTable)
 {
@@ -46,8 +52,40 @@ Status SortingKernel<method, algorithmFPType, cpu>::compute(const NumericTable &
     DAAL_CHECK_BLOCK_STATUS(otputBlock);
     algorithmFPType * sortedData = otputBlock.get();
 
-    DAAL_CHECK(!(Statistics<algorithmFPType, cpu>::xSort(const_cast<algorithmFPType *>(data), nFeatures, nVectors, sortedData)), ErrorSorting);
-    return Status();
+    if (nVectors < radixSortMinNumberOfVectors)
+    {
+        DAAL_CHECK(!(Statistics<algorithmFPType, cpu>::xSort(const_cast<algorithmFPType *>(data), nFeatures, nVectors, sortedData)), ErrorSorting);
+        return Status();
+    }
+
+    TArray<algorithmFPType, cpu> columnArray(nFeatures > 1 ? nVectors : 0);
+    TArray<algorithmFPType, cpu> bufferArray(nVectors);
+    algorithmFPType * column = (nFeatures > 1 ? columnArray.get() : sortedData);
+    algorithmFPType * buffer = bufferArray.get();
+    DAAL_CHECK_MALLOC(column && buffer);
+
+    const size_t blockSize = daal::algorithms::internal::radixSortMinBlockSize;
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    Status s;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t end = (iBlock + 1) * blockSize < nVectors ? (iBlock + 1) * blockSize : nVectors;
+            for (size_t i = iBlock * blockSize; i < end; i++) column[i] = data[i * nFeatures + j];
+        });
+
+        DAAL_CHECK_STATUS(s, (daal::algorithms::internal::radixSort<cpu, algorithmFPType>(column, buffer, nVectors)));
+
+        if (nFeatures > 1)
+        {
+            daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+                const size_t end = (iBlock + 1) * blockSize < nVectors ? (iBlock + 1) * blockSize : nVectors;
+                for (size_t i = iBlock * blockSize; i < end; i++) sortedData[i * nFeatures + j] = column[i];
+            });
+        }
+    }
+    return s;
 }
 
 } // namespace internal
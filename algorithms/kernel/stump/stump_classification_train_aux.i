@@ -115,9 +115,17 @@ Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const N
         yTable = yTableZeroOne.get();
     }
 
-    /* Create an algorithm object to train the Decision tree model */
-    decision_tree::classification::training::Batch<algorithmFPtype> treeAlgorithm(par->nClasses);
-    treeAlgorithm.enableChecks(false);
+    /* Create an algorithm object to train the Decision tree model, boosting trains the stumps on the same data set
+       and the algorithm object keeps the order of the features between the calls */
+    if (!_treeAlgorithm)
+    {
+        _treeAlgorithm.reset(new decision_tree::classification::training::Batch<algorithmFPtype>(nClasses));
+        DAAL_CHECK_MALLOC(_treeAlgorithm.get())
+        _treeAlgorithm->enableChecks(false);
+    }
+    decision_tree::classification::training::Batch<algorithmFPtype> & treeAlgorithm = *_treeAlgorithm;
+
+    treeAlgorithm.parameter.nClasses                   = nClasses;
     treeAlgorithm.parameter.splitCriterion             = par->splitCriterion;
     treeAlgorithm.parameter.pruning                    = decision_tree::none;
     treeAlgorithm.parameter.maxTreeDepth               = 2;
@@ -26,6 +26,7 @@
 
 #include "algorithms/stump/stump_classification_training_types.h"
 #include "algorithms/stump/stump_classification_model.h"
+#include "algorithms/decision_tree/decision_tree_classification_training_batch.h"
 #include "algorithms/kernel/kernel.h"
 #include "data_management/data/numeric_table.h"
 
@@ -51,6 +52,9 @@ public:
 
 private:
     services::Status changeMinusOneToZero(const algorithmFPtype * yArray, algorithmFPtype * yZeroOne, size_t nVectors);
+
+    /* Kept between the calls so that the order of the features is reused when the stumps are trained on the same data set */
+    services::SharedPtr<decision_tree::classification::training::Batch<algorithmFPtype> > _treeAlgorithm;
 };
 
 } // namespace internal
@@ -64,9 +64,16 @@ services::Status StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t
 
     services::Status s;
 
-    /* Create an algorithm object to train the Decision tree model */
-    decision_tree::regression::training::Batch<> treeAlgorithm;
-    treeAlgorithm.enableChecks(false);
+    /* Create an algorithm object to train the Decision tree model, boosting trains the stumps on the same data set
+       and the algorithm object keeps the order of the features between the calls */
+    if (!_treeAlgorithm)
+    {
+        _treeAlgorithm.reset(new decision_tree::regression::training::Batch<>());
+        DAAL_CHECK_MALLOC(_treeAlgorithm.get())
+        _treeAlgorithm->enableChecks(false);
+    }
+    decision_tree::regression::training::Batch<> & treeAlgorithm = *_treeAlgorithm;
+
     treeAlgorithm.parameter.pruning                    = decision_tree::none;
     treeAlgorithm.parameter.maxTreeDepth               = 2;
     treeAlgorithm.parameter.minObservationsInLeafNodes = 1;
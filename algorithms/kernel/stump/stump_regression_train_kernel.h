@@ -26,6 +26,7 @@
 
 #include "algorithms/stump/stump_regression_training_types.h"
 #include "algorithms/stump/stump_regression_model.h"
+#include "algorithms/decision_tree/decision_tree_regression_training_batch.h"
 #include "algorithms/kernel/kernel.h"
 #include "data_management/data/numeric_table.h"
 
@@ -48,6 +49,10 @@ class StumpTrainKernel : public Kernel
 {
 public:
     services::Status compute(size_t n, const NumericTable * const * a, Model * r, const Parameter * par);
+
+private:
+    /* Kept between the calls so that the order of the features is reused when the stumps are trained on the same data set */
+    services::SharedPtr<decision_tree::regression::training::Batch<> > _treeAlgorithm;
 };
 
 } // namespace internal
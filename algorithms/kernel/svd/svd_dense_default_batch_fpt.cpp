@@ -35,6 +35,7 @@ template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::
 template DAAL_EXPORT services::Status Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult * partialResult,
                                                                     daal::algorithms::Parameter * parameter, const int method);
 template DAAL_EXPORT services::Status Result::allocateImpl<DAAL_FPTYPE>(size_t m, size_t n);
+template DAAL_EXPORT services::Status Result::allocateImpl<DAAL_FPTYPE>(size_t m, size_t n, size_t k);
 
 } // namespace interface1
 } // namespace svd
@@ -29,6 +29,7 @@
 #include "service/kernel/service_defines.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "algorithms/kernel/service_error_handling.h"
+#include "algorithms/kernel/service_threading.h"
 
 #include "algorithms/kernel/svd/svd_dense_default_impl.i"
 
@@ -46,6 +47,13 @@ namespace svd
 {
 namespace internal
 {
+/*
+    The R factors of the blocks are merged in a binary tree: on every level the pairs (i, i + stride) are
+    independent, the R factor of the stacked pair replaces the i-th one, and the Q factor of the stacked pair
+    is kept at the j-th position. After the SVD of the root R = U * Sigma * V, the rows of (Q * U) that
+    correspond to the blocks are computed top-down: the pair (i, j) gets Qtop * M_i and Qbottom * M_i.
+    All the matrices are stored in the column-major layout.
+*/
 template <typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
 Status SVDDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
                                                                         NumericTable * r[], const daal::algorithms::Parameter * par)
@@ -61,95 +69,127 @@ Status SVDDistributedStep2Kernel<algorithmFPType, method, cpu>::compute(const si
     const NumericTable * ntAux2_0 = a[0];
     NumericTable * ntSigma        = const_cast<NumericTable *>(r[0]);
 
-    size_t nBlocks = na;
-
-    size_t n   = ntAux2_0->getNumberOfColumns();
-    size_t nxb = n * nBlocks;
+    const size_t nBlocks = na;
+    const size_t n       = ntAux2_0->getNumberOfColumns();
+    const bool computeU  = (svdPar->leftSingularMatrix == requiredInPackedForm);
 
     WriteOnlyRows<algorithmFPType, cpu, NumericTable> sigmaBlock(ntSigma, 0, 1); /* Sigma [1][n]   */
     DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
     algorithmFPType * Sigma = sigmaBlock.get();
 
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, nxb);
     DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n, n);
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * n, sizeof(algorithmFPType));
-    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, n * nxb, sizeof(algorithmFPType));
-
-    TArray<algorithmFPType, cpu> Aux2TPtr(n * nxb);
-    TArray<algorithmFPType, cpu> VTPtr(n * n);
-    TArray<algorithmFPType, cpu> Aux3TPtr(n * nxb);
-    algorithmFPType * Aux2T = Aux2TPtr.get();
-    algorithmFPType * VT    = VTPtr.get();
-    algorithmFPType * Aux3T = Aux3TPtr.get();
-
-    DAAL_CHECK(Aux2T && VT && Aux3T, ErrorMemoryAllocationFailed);
+    const size_t nn = n * n;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nn, 2 * nBlocks);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nn * 2 * nBlocks, sizeof(algorithmFPType));
+
+    /* R factors of the blocks, replaced by the blocks of Q * U on the way down */
+    TArray<algorithmFPType, cpu> RsPtr(nBlocks * nn);
+    /* Q factors of the merges are needed only to compute the left singular vectors */
+    TArray<algorithmFPType, cpu> QsPtr(computeU ? nBlocks * 2 * nn : 0);
+    TArray<algorithmFPType, cpu> VTPtr(nn);
+    TArray<algorithmFPType, cpu> UPtr(nn);
+    algorithmFPType * Rs = RsPtr.get();
+    algorithmFPType * Qs = QsPtr.get();
+    algorithmFPType * VT = VTPtr.get();
+    algorithmFPType * U  = UPtr.get();
+
+    DAAL_CHECK(Rs && VT && U && (Qs || !computeU), ErrorMemoryAllocationFailed);
 
     SafeStatus safeStat;
 
     daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
-        ReadRows<algorithmFPType, cpu, NumericTable> aux2Block(const_cast<NumericTable *>(a[k]), 0, n); /* Aux2  [nxb][n] */
+        ReadRows<algorithmFPType, cpu, NumericTable> aux2Block(const_cast<NumericTable *>(a[k]), 0, n); /* Aux2  [n][n] */
         DAAL_CHECK_BLOCK_STATUS_THR(aux2Block);
         const algorithmFPType * Aux2 = aux2Block.get();
+        algorithmFPType * Rk         = Rs + k * nn;
 
         for (size_t i = 0; i < n; i++)
         {
             for (size_t j = 0; j < n; j++)
             {
-                Aux2T[j * nxb + k * n + i] = Aux2[i * n + j];
+                Rk[j * n + i] = Aux2[i * n + j];
             }
         }
     });
 
     if (!safeStat) return safeStat.detach();
 
-    {
-        DAAL_INT ldAux2 = nxb;
-        DAAL_INT ldAux3 = nxb;
-        DAAL_INT ldV    = n;
+    /* Per-thread buffer for the stacked pair on the way up and for the product on the way down */
+    daal::TlsMem<algorithmFPType, cpu> tlsBuffer(2 * nn);
 
-        DAAL_INT ldR = n;
-        DAAL_INT ldU = n;
+    size_t nLevels = 0;
+    for (size_t stride = 1; stride < nBlocks; stride *= 2)
+    {
+        const size_t nPairs = (nBlocks - stride + 2 * stride - 1) / (2 * stride);
+        daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+            const size_t i = iPair * 2 * stride;
+            const size_t j = i + stride;
 
-        TArray<algorithmFPType, cpu> RPtr(n * ldR);
-        TArray<algorithmFPType, cpu> UPtr(n * ldU);
-        algorithmFPType * R = RPtr.get();
-        algorithmFPType * U = UPtr.get();
+            algorithmFPType * QR = (computeU ? Qs + j * 2 * nn : tlsBuffer.local());
+            DAAL_CHECK_MALLOC_THR(QR);
+            algorithmFPType * Ri = Rs + i * nn;
+            algorithmFPType * Rj = Rs + j * nn;
 
-        DAAL_CHECK(U && R, ErrorMemoryAllocationFailed);
+            for (size_t col = 0; col < n; col++)
+            {
+                for (size_t row = 0; row < n; row++)
+                {
+                    QR[col * 2 * n + row]     = Ri[col * n + row];
+                    QR[col * 2 * n + n + row] = Rj[col * n + row];
+                    Ri[col * n + row]         = 0.0;
+                }
+            }
 
-        /* By some reason, there was this part in Sample */
-        for (size_t i = 0; i < n * ldR; i++)
-        {
-            R[i] = 0.0;
-        }
+            const auto ecQr = compute_QR_on_one_node_seq<algorithmFPType, cpu>(2 * n, n, QR, 2 * n, Ri, n);
+            DAAL_CHECK_STATUS_THR(ecQr);
+        });
+        if (!safeStat) return safeStat.detach();
+        nLevels++;
+    }
 
-        // Rc = P*R
-        const auto ecQr = compute_QR_on_one_node<algorithmFPType, cpu>(nxb, n, Aux2T, ldAux2, R, ldR);
-        if (!ecQr) return ecQr;
+    // Rroot -> U*Sigma*V
+    const auto ecSvd = compute_svd_on_one_node<algorithmFPType, cpu>(n, n, Rs, n, Sigma, U, n, VT, n);
+    if (!ecSvd) return ecSvd;
 
-        // Qn*R -> Qn*(U*Sigma*V) -> (Qn*U)*Sigma*V
-        const auto ecSvd = compute_svd_on_one_node<algorithmFPType, cpu>(n, n, R, ldR, Sigma, U, ldU, VT, ldV);
-        if (!ecSvd) return ecSvd;
+    if (computeU)
+    {
+        int result = daal::services::internal::daal_memcpy_s(Rs, nn * sizeof(algorithmFPType), U, nn * sizeof(algorithmFPType));
+        DAAL_CHECK(!result, ErrorMemoryCopyFailedInternal);
 
-        if (svdPar->leftSingularMatrix == requiredInPackedForm)
+        for (size_t level = nLevels; level > 0; level--)
         {
-            const auto ecGemm = compute_gemm_on_one_node<algorithmFPType, cpu>(nxb, n, Aux2T, ldAux2, U, ldU, Aux3T, ldAux3);
-            if (!ecGemm) return ecGemm;
+            const size_t stride = size_t(1) << (level - 1);
+            const size_t nPairs = (nBlocks - stride + 2 * stride - 1) / (2 * stride);
+            daal::threader_for(nPairs, nPairs, [&](size_t iPair) {
+                const size_t i = iPair * 2 * stride;
+                const size_t j = i + stride;
+
+                algorithmFPType * Q  = Qs + j * 2 * nn;
+                algorithmFPType * Mi = Rs + i * nn;
+                algorithmFPType * Mj = Rs + j * nn;
+
+                algorithmFPType * product = tlsBuffer.local();
+                DAAL_CHECK_MALLOC_THR(product);
+
+                compute_gemm_on_one_node_seq<algorithmFPType, cpu>(n, n, Q + n, 2 * n, Mi, n, Mj, n);
+                compute_gemm_on_one_node_seq<algorithmFPType, cpu>(n, n, Q, 2 * n, Mi, n, product, n);
+                const int result = daal::services::internal::daal_memcpy_s(Mi, nn * sizeof(algorithmFPType), product, nn * sizeof(algorithmFPType));
+                if (result) safeStat.add(ErrorMemoryCopyFailedInternal);
+            });
+            if (!safeStat) return safeStat.detach();
         }
-    }
 
-    if (svdPar->leftSingularMatrix == requiredInPackedForm)
-    {
         daal::threader_for(nBlocks, nBlocks, [=, &safeStat](int k) {
-            WriteOnlyRows<algorithmFPType, cpu, NumericTable> aux3Block(r[2 + k], 0, n); /* Aux3  [nxb][n] */
+            WriteOnlyRows<algorithmFPType, cpu, NumericTable> aux3Block(r[2 + k], 0, n); /* Aux3  [n][n] */
             DAAL_CHECK_BLOCK_STATUS_THR(aux3Block);
-            algorithmFPType * Aux3 = aux3Block.get();
+            algorithmFPType * Aux3     = aux3Block.get();
+            const algorithmFPType * Mk = Rs + k * nn;
 
             for (size_t i = 0; i < n; i++)
             {
                 for (size_t j = 0; j < n; j++)
                 {
-                    Aux3[i * n + j] = Aux3T[j * nxb + k * n + i];
+                    Aux3[i * n + j] = Mk[j * n + i];
                 }
             }
         });
@@ -52,6 +52,20 @@ public:
     Status compute_pcl(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const Parameter * par = 0);
 };
 
+/**
+ *  \brief Kernel that computes the leading singular values and vectors with the randomized range finder
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVDBatchKernel<algorithmFPType, daal::algorithms::svd::randomizedDense, cpu> : public Kernel
+{
+public:
+    Status compute(const size_t na, const NumericTable * const * a, const size_t nr, NumericTable * r[], const daal::algorithms::Parameter * par = 0);
+
+protected:
+    Status computeRange(DAAL_INT m, DAAL_INT n, DAAL_INT l, const algorithmFPType * A, algorithmFPType * Y, algorithmFPType * Z,
+                        algorithmFPType * R, const Parameter * svdPar);
+};
+
 template <typename algorithmFPType, daal::algorithms::svd::Method method, CpuType cpu>
 class SVDOnlineKernel : public Kernel
 {
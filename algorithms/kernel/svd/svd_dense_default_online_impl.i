@@ -178,32 +178,18 @@ Status SVDOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(const size
 
     if (s && svdPar->leftSingularMatrix == requiredInPackedForm)
     {
-        WriteOnlyRows<algorithmFPType, cpu, NumericTable> QBlock; /* Aux1i = Qin[m][n] */
-
-        size_t computedRows = 0;
-
+        /* Q of all the blocks in one parallel pass */
+        TArray<const NumericTable *, cpu> step3ntIn(2 * nBlocks);
+        DAAL_CHECK(step3ntIn.get(), ErrorMemoryAllocationFailed);
         for (size_t i = 0; i < nBlocks; i++)
         {
-            const NumericTable * ntAux1i = a[nBlocks + i];
-            size_t m                     = ntAux1i->getNumberOfRows();
-
-            algorithmFPType * Qi = QBlock.set(r[1], computedRows, m);
-            s                    = QBlock.status();
-            if (!s) break;
-
-            HomogenNumericTableCPU<algorithmFPType, cpu> ntQi(Qi, n, m, s);
-            DAAL_CHECK_STATUS_VAR(s);
-
-            const NumericTable * step3ntIn[2] = { ntAux1i, step2ntOut[2 + i] };
-            NumericTable * step3ntOut[1]      = { &ntQi };
-
-            SVDDistributedStep3Kernel<algorithmFPType, method, cpu> kernelStep3;
-            s = kernelStep3.compute(2, step3ntIn, 1, step3ntOut, par);
-
-            if (!s) break;
-
-            computedRows += m;
+            step3ntIn[i]           = a[nBlocks + i];
+            step3ntIn[nBlocks + i] = step2ntOut[2 + i];
         }
+        NumericTable * step3ntOut[1] = { r[1] };
+
+        SVDDistributedStep3Kernel<algorithmFPType, method, cpu> kernelStep3;
+        s = kernelStep3.compute(2 * nBlocks, step3ntIn.get(), 1, step3ntOut, par);
     }
 
     if (svdPar->leftSingularMatrix == requiredInPackedForm)
@@ -0,0 +1,216 @@
+/* file: svd_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the randomized SVD
+//--
+*/
+
+#ifndef __SVD_KERNEL_RANDOMIZED_BATCH_IMPL_I__
+#define __SVD_KERNEL_RANDOMIZED_BATCH_IMPL_I__
+
+#include "externals/service_memory.h"
+#include "externals/service_blas.h"
+#include "externals/service_rng.h"
+#include "service/kernel/service_defines.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "algorithms/kernel/engines/engine_batch_impl.h"
+#include "algorithms/kernel/service_error_handling.h"
+
+#include "algorithms/kernel/svd/svd_dense_default_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svd
+{
+namespace internal
+{
+/*
+    Randomized algorithm for computation of the k leading singular values and vectors:
+    ---------------------------------------------------------------------------------
+    A[m,n] input matrix, l = k + nOversamples random vectors are used to find the range of A
+
+    1st step:
+    Generate the Gaussian test matrix Omega[n,l] and compute Y[m,l] = A * Omega.
+    Power iterations improve the accuracy for the slowly decaying spectrum:
+    Y = qr(Y), Z = qr(A^T * Y), Y = A * Z.
+    Orthonormal Q[m,l] = qr(Y) approximates the range of A.
+
+    2nd step:
+    Compute B[l,n] = Q^T * A and its SVD: B = Ub * S * V^T.
+    The leading singular values of A are the first k values of S,
+    V^T[k,n] are the right singular vectors and U[m,k] = Q * Ub[l,k] are the left singular vectors.
+
+    Notice: row-major layout of the input and output tables is treated as the column-major layout of the transposed matrices,
+    so that the matrices are not transposed explicitly. Y, Z and B are stored in the column-major layout.
+*/
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::compute(const size_t na, const NumericTable * const * a, const size_t nr,
+                                                                     NumericTable * r[], const daal::algorithms::Parameter * par)
+{
+    svd::Parameter defaultParams;
+    const svd::Parameter * svdPar = &defaultParams;
+
+    if (par != 0)
+    {
+        svdPar = static_cast<const svd::Parameter *>(par);
+    }
+
+    NumericTable * ntA     = const_cast<NumericTable *>(a[0]);
+    NumericTable * ntSigma = r[0];
+
+    const size_t nCols       = ntA->getNumberOfColumns();
+    const size_t nRows       = ntA->getNumberOfRows();
+    const size_t nComponents = ntSigma->getNumberOfColumns();
+    const size_t nVectors    = (nComponents + svdPar->nOversamples < nCols) ? nComponents + svdPar->nOversamples : nCols;
+
+    DAAL_INT m = nRows;
+    DAAL_INT n = nCols;
+    DAAL_INT l = nVectors;
+    DAAL_INT k = nComponents;
+
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows, nVectors);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nRows * nVectors, sizeof(algorithmFPType));
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nCols, nVectors);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(size_t, nCols * nVectors, sizeof(algorithmFPType));
+
+    TArray<algorithmFPType, cpu> YPtr(nRows * nVectors);
+    TArray<algorithmFPType, cpu> ZPtr(nCols * nVectors);
+    TArray<algorithmFPType, cpu> VTPtr(nCols * nVectors);
+    TArray<algorithmFPType, cpu> RPtr(nVectors * nVectors);
+    TArray<algorithmFPType, cpu> SigmaPtr(nVectors);
+    algorithmFPType * Y     = YPtr.get();
+    algorithmFPType * Z     = ZPtr.get();
+    algorithmFPType * VT    = VTPtr.get();
+    algorithmFPType * R     = RPtr.get();
+    algorithmFPType * Sigma = SigmaPtr.get();
+    DAAL_CHECK(Y && Z && VT && R && Sigma, ErrorMemoryAllocationFailed);
+
+    ReadRows<algorithmFPType, cpu, NumericTable> aBlock(ntA, 0, nRows);
+    DAAL_CHECK_BLOCK_STATUS(aBlock);
+    const algorithmFPType * A = aBlock.get();
+
+    Status s = computeRange(m, n, l, A, Y, Z, R, svdPar);
+    if (!s) return s;
+
+    /* B = Q^T * A, Z is reused for B */
+    algorithmFPType one  = algorithmFPType(1.0);
+    algorithmFPType zero = algorithmFPType(0.0);
+    char trans           = 'T';
+    algorithmFPType * B  = Z;
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &trans, &l, &n, &m, &one, Y, &m, A, &n, &zero, B, &l);
+
+    /* Ub is stored in R */
+    s = compute_svd_on_one_node<algorithmFPType, cpu>(l, n, B, l, Sigma, R, l, VT, l);
+    if (!s) return s;
+
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> sigmaBlock(ntSigma, 0, 1);
+        DAAL_CHECK_BLOCK_STATUS(sigmaBlock);
+        algorithmFPType * tSigma = sigmaBlock.get();
+
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            tSigma[i] = Sigma[i];
+        }
+    }
+
+    if (svdPar->leftSingularMatrix == requiredInPackedForm)
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> uBlock(r[1], 0, nRows);
+        DAAL_CHECK_BLOCK_STATUS(uBlock);
+        algorithmFPType * U = uBlock.get();
+
+        /* U^T = Ub[l,k]^T * Q^T is the row-major U */
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &trans, &k, &m, &l, &one, R, &l, Y, &m, &zero, U, &k);
+    }
+
+    if (svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        WriteOnlyRows<algorithmFPType, cpu, NumericTable> vBlock(r[2], 0, nComponents);
+        DAAL_CHECK_BLOCK_STATUS(vBlock);
+        algorithmFPType * V = vBlock.get();
+
+        for (size_t i = 0; i < nComponents; i++)
+        {
+            PRAGMA_IVDEP
+            for (size_t j = 0; j < nCols; j++)
+            {
+                V[i * nCols + j] = VT[i + j * nVectors];
+            }
+        }
+    }
+
+    return Status();
+}
+
+/**
+ *  \brief Computes the orthonormal matrix Q[m,l] stored in Y that approximates the range of A[m,n],
+ *         Z[n,l] and R[l,l] are the buffers
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVDBatchKernel<algorithmFPType, randomizedDense, cpu>::computeRange(DAAL_INT m, DAAL_INT n, DAAL_INT l, const algorithmFPType * A,
+                                                                          algorithmFPType * Y, algorithmFPType * Z, algorithmFPType * R,
+                                                                          const Parameter * svdPar)
+{
+    auto engineImpl = dynamic_cast<daal::algorithms::engines::internal::BatchBaseImpl *>(svdPar->engine.get());
+    DAAL_CHECK(engineImpl, ErrorIncorrectEngineParameter);
+
+    /* Omega is stored in Z */
+    daal::internal::RNGs<algorithmFPType, cpu> rng;
+    DAAL_CHECK(!rng.gaussian(n * l, Z, engineImpl->getState(), algorithmFPType(0.0), algorithmFPType(1.0)), ErrorIncorrectErrorcodeFromGenerator);
+
+    algorithmFPType one  = algorithmFPType(1.0);
+    algorithmFPType zero = algorithmFPType(0.0);
+    char trans           = 'T';
+    char notrans         = 'N';
+
+    /* Y = A * Omega */
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &m, &l, &n, &one, A, &n, Z, &n, &zero, Y, &m);
+
+    Status s;
+    for (size_t it = 0; it < svdPar->nPowerIterations; it++)
+    {
+        s = compute_QR_on_one_node<algorithmFPType, cpu>(m, l, Y, m, R, l);
+        if (!s) return s;
+
+        /* Z = A^T * Y */
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &n, &l, &m, &one, A, &n, Y, &m, &zero, Z, &n);
+
+        s = compute_QR_on_one_node<algorithmFPType, cpu>(n, l, Z, n, R, l);
+        if (!s) return s;
+
+        /* Y = A * Z */
+        Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &m, &l, &n, &one, A, &n, Z, &n, &zero, Y, &m);
+    }
+
+    return compute_QR_on_one_node<algorithmFPType, cpu>(m, l, Y, m, R, l);
+}
+
+} // namespace internal
+} // namespace svd
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -106,6 +106,15 @@ Status Input::check(const daal::algorithms::Parameter * parameter, int method) c
     }
 
     DAAL_CHECK_EX(dataTable->getNumberOfColumns() <= dataTable->getNumberOfRows(), ErrorIncorrectNumberOfRows, ArgumentName, dataStr());
+
+    if (method == randomizedDense)
+    {
+        const Parameter * svdPar = static_cast<const Parameter *>(parameter);
+        DAAL_CHECK(svdPar, ErrorNullParameterNotSupported);
+        DAAL_CHECK_EX(svdPar->nComponents > 0 && svdPar->nComponents <= dataTable->getNumberOfColumns(), ErrorIncorrectParameter, ParameterName,
+                      nComponentsStr());
+        DAAL_CHECK(svdPar->engine, ErrorNullAuxiliaryAlgorithm);
+    }
     return Status();
 }
 
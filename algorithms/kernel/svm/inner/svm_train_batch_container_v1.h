@@ -64,8 +64,8 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     svm::interface1::Parameter * par       = static_cast<svm::interface1::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface1::Parameter), compute, x, *y, r,
-                       par);
+    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface1::Parameter), compute,
+                       daal::services::internal::hostApp(*input), x, *y, r, par);
 }
 } // namespace interface1
 } // namespace training
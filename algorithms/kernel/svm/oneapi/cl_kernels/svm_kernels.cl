@@ -0,0 +1,226 @@
+/* file: svm_kernels.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of SVM OpenCL kernels.
+//--
+*/
+
+#ifndef __SVM_KERNELS_CL__
+#define __SVM_KERNELS_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelSVM,
+
+    __kernel void computeSquares(const __global algorithmFPType * x, uint nFeatures, __global algorithmFPType * sqNorms) {
+        const uint i                        = get_global_id(0);
+        const __global algorithmFPType * xi = x + (ulong)i * nFeatures;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint j = 0; j < nFeatures; j++)
+        {
+            sum += xi[j] * xi[j];
+        }
+        sqNorms[i] = sum;
+    }
+
+    __kernel void gatherRows(const __global algorithmFPType * x, const __global int * indices, uint nFeatures, __global algorithmFPType * xSubset) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+
+        xSubset[i * nFeatures + j] = x[(ulong)indices[i] * nFeatures + j];
+    }
+
+    __kernel void gatherValues(const __global algorithmFPType * values, const __global int * indices, __global algorithmFPType * valuesSubset) {
+        const uint i    = get_global_id(0);
+        valuesSubset[i] = values[indices[i]];
+    }
+
+    /* Converts the inner products in the row-major block into the values of the RBF kernel */
+    __kernel void makeRBFKernel(const __global algorithmFPType * sqNormsRows, const __global algorithmFPType * sqNormsCols, uint nCols,
+                                algorithmFPType coeff, __global algorithmFPType * block) {
+        const uint i      = get_global_id(0);
+        const uint j      = get_global_id(1);
+        const ulong index = (ulong)i * nCols + j;
+
+        const algorithmFPType sqDistance = sqNormsRows[i] + sqNormsCols[j] - (algorithmFPType)2 * block[index];
+        block[index]                     = exp(coeff * fmax(sqDistance, (algorithmFPType)0));
+    }
+
+    /* The observations with the largest values of -y*grad in I_UP and the smallest ones in I_LOW get the smallest selection values */
+    __kernel void computeSelectionValues(const __global algorithmFPType * y, const __global algorithmFPType * alpha,
+                                         const __global algorithmFPType * grad, algorithmFPType C, algorithmFPType fpMax,
+                                         __global algorithmFPType * valuesUp, __global algorithmFPType * valuesLow) {
+        const uint i                 = get_global_id(0);
+        const algorithmFPType zero   = (algorithmFPType)0;
+        const algorithmFPType yi     = y[i];
+        const algorithmFPType alphai = alpha[i];
+        const algorithmFPType ygrad  = -yi * grad[i];
+
+        const bool isUpper = (yi > zero ? alphai < C : alphai > zero);
+        const bool isLower = (yi > zero ? alphai > zero : alphai < C);
+        valuesUp[i]        = isUpper ? -ygrad : fpMax;
+        valuesLow[i]       = isLower ? ygrad : fpMax;
+    }
+
+    __kernel void gatherKernelWS(const __global algorithmFPType * kernelBlock, const __global int * ws, uint nVectors,
+                                 __global algorithmFPType * kernelWS) {
+        const uint i   = get_global_id(0);
+        const uint j   = get_global_id(1);
+        const uint nWS = get_global_size(1);
+
+        kernelWS[i * nWS + j] = kernelBlock[(ulong)i * nVectors + ws[j]];
+    }
+
+    /* Reduces the values over the work-group, values[0] and indices[0] hold the maximum or the minimum and its index */
+    void argReduce(__local algorithmFPType * values, __local int * indices, uint localId, int findMax) {
+        for (uint stride = LOCAL_SIZE / 2; stride > 0; stride /= 2)
+        {
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (localId < stride)
+            {
+                const algorithmFPType other = values[localId + stride];
+                if (findMax ? other > values[localId] : other < values[localId])
+                {
+                    values[localId]  = other;
+                    indices[localId] = indices[localId + stride];
+                }
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    /* SMO with the second order working set selection for the sub-problem restricted to the working set,
+       every work item of the single work-group holds one observation of the working set */
+    __kernel void smoSolver(const __global algorithmFPType * y, const __global algorithmFPType * kernelWS, const __global int * ws,
+                            const __global algorithmFPType * grad, __global algorithmFPType * alpha, __global algorithmFPType * deltaWS,
+                            __global uint * nInnerIterations, uint nWS, algorithmFPType C, algorithmFPType eps, algorithmFPType tau,
+                            algorithmFPType fpMax, uint maxInnerIterations) {
+        __local algorithmFPType values[LOCAL_SIZE];
+        __local int indices[LOCAL_SIZE];
+        __local algorithmFPType pair[5];
+
+        const uint i               = get_local_id(0);
+        const bool isActive        = i < nWS;
+        const algorithmFPType zero = (algorithmFPType)0;
+        const algorithmFPType two  = (algorithmFPType)2;
+
+        const int wsi                  = isActive ? ws[i] : 0;
+        const algorithmFPType yi       = isActive ? y[wsi] : zero;
+        const algorithmFPType oldAlpha = isActive ? alpha[wsi] : zero;
+        const algorithmFPType Kii      = isActive ? kernelWS[i * nWS + i] : zero;
+        algorithmFPType alphai         = oldAlpha;
+        algorithmFPType gradi          = isActive ? grad[wsi] : zero;
+
+        uint iter = 0;
+        for (; iter < maxInnerIterations; iter++)
+        {
+            const bool isUpper          = isActive && (yi > zero ? alphai < C : alphai > zero);
+            const bool isLower          = isActive && (yi > zero ? alphai > zero : alphai < C);
+            const algorithmFPType ygrad = -yi * gradi;
+
+            values[i]  = isUpper ? ygrad : -fpMax;
+            indices[i] = i;
+            argReduce(values, indices, i, 1);
+            const int Bi               = indices[0];
+            const algorithmFPType GMax = values[0];
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (GMax == -fpMax) break;
+
+            values[i] = isLower ? ygrad : fpMax;
+            argReduce(values, indices, i, 0);
+            const algorithmFPType GMin2 = values[0];
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            const algorithmFPType KBiBi = kernelWS[Bi * nWS + Bi];
+            algorithmFPType objFunc     = fpMax;
+            algorithmFPType dt          = zero;
+            if (isLower && ygrad < GMax)
+            {
+                const algorithmFPType b = GMax - ygrad;
+                algorithmFPType a       = KBiBi + Kii - two * kernelWS[Bi * nWS + i];
+                if (a <= zero) a = tau;
+                dt      = b / a;
+                objFunc = -b * dt;
+            }
+            values[i]  = objFunc;
+            indices[i] = i;
+            argReduce(values, indices, i, 0);
+            const int Bj               = indices[0];
+            const algorithmFPType GMin = values[0];
+            barrier(CLK_LOCAL_MEM_FENCE);
+            if (GMin == fpMax || GMax - GMin2 < eps) break;
+
+            if (i == Bi)
+            {
+                pair[0] = alphai;
+                pair[1] = yi;
+            }
+            if (i == Bj)
+            {
+                pair[2] = alphai;
+                pair[3] = yi;
+                pair[4] = dt;
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            /* Update alpha and project it back to the feasible region */
+            const algorithmFPType oldAlphaBi = pair[0];
+            const algorithmFPType yBi        = pair[1];
+            const algorithmFPType oldAlphaBj = pair[2];
+            const algorithmFPType yBj        = pair[3];
+            const algorithmFPType delta      = pair[4];
+            const algorithmFPType sum        = yBi * oldAlphaBi + yBj * oldAlphaBj;
+
+            algorithmFPType newAlphaBi = clamp(oldAlphaBi + yBi * delta, zero, C);
+            algorithmFPType newAlphaBj = clamp(yBj * (sum - yBi * newAlphaBi), zero, C);
+            newAlphaBi                 = yBi * (sum - yBj * newAlphaBj);
+
+            if (i == Bi) alphai = newAlphaBi;
+            if (i == Bj) alphai = newAlphaBj;
+
+            const algorithmFPType dyi = yBi * (newAlphaBi - oldAlphaBi);
+            const algorithmFPType dyj = yBj * (newAlphaBj - oldAlphaBj);
+            if (isActive)
+            {
+                gradi += yi * (dyi * kernelWS[Bi * nWS + i] + dyj * kernelWS[Bj * nWS + i]);
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if (isActive)
+        {
+            deltaWS[i] = yi * (alphai - oldAlpha);
+            alpha[wsi] = alphai;
+        }
+        if (i == 0)
+        {
+            nInnerIterations[0] = iter;
+        }
+    }
+
+    __kernel void updateGradient(const __global algorithmFPType * y, const __global algorithmFPType * gradDelta, __global algorithmFPType * grad) {
+        const uint i = get_global_id(0);
+        grad[i] += y[i] * gradDelta[i];
+    }
+
+);
+
+#endif
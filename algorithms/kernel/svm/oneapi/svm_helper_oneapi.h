@@ -0,0 +1,208 @@
+/* file: svm_helper_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the helper functions shared by SVM training and prediction on GPU.
+//
+//  The kernel functions have no GPU implementation, so the linear and RBF kernels
+//  are computed here from the matrix-matrix product of the observations.
+//--
+*/
+
+#ifndef __SVM_HELPER_ONEAPI_H__
+#define __SVM_HELPER_ONEAPI_H__
+
+#include "algorithms/kernel_function/kernel_function_types_linear.h"
+#include "algorithms/kernel_function/kernel_function_types_rbf.h"
+#include "service/kernel/oneapi/blas_gpu.h"
+#include "algorithms/kernel/svm/oneapi/cl_kernels/svm_kernels.cl"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+
+/* Local size of the sub-problem solver, the working set on GPU contains at most this number of observations */
+const uint32_t svmLocalSize = 256;
+
+template <typename algorithmFPType>
+struct KernelParameterOneAPI
+{
+    KernelParameterOneAPI() : isRBF(false), k(1.0), b(0.0), coeff(0.0) {}
+
+    /* Returns false if the kernel is neither linear nor RBF */
+    bool init(const kernel_function::KernelIfacePtr & kernel)
+    {
+        const kernel_function::ParameterBase * kfPar         = kernel->getParameter();
+        const kernel_function::linear::Parameter * linearPar = dynamic_cast<const kernel_function::linear::Parameter *>(kfPar);
+        if (linearPar)
+        {
+            isRBF = false;
+            k     = algorithmFPType(linearPar->k);
+            b     = algorithmFPType(linearPar->b);
+            return true;
+        }
+        const kernel_function::rbf::Parameter * rbfPar = dynamic_cast<const kernel_function::rbf::Parameter *>(kfPar);
+        if (rbfPar)
+        {
+            isRBF = true;
+            coeff = algorithmFPType(-0.5 / (rbfPar->sigma * rbfPar->sigma));
+            return true;
+        }
+        return false;
+    }
+
+    bool isRBF;
+    algorithmFPType k;
+    algorithmFPType b;
+    algorithmFPType coeff;
+};
+
+template <typename algorithmFPType>
+struct HelperSVM
+{
+    static services::Status buildProgram(ClKernelFactoryIface & factory)
+    {
+        services::Status status;
+        services::String options = getKeyFPType<algorithmFPType>();
+        options.add(" -D LOCAL_SIZE=256 "); // should be equal to svmLocalSize
+
+        services::String cachekey("__daal_algorithms_svm_");
+        cachekey.add(options);
+        factory.build(ExecutionTargetIds::device, cachekey.c_str(), clKernelSVM, options.c_str(), &status);
+        return status;
+    }
+
+    static services::Status computeSquares(const UniversalBuffer & x, const uint32_t n, const uint32_t p, UniversalBuffer & sqNorms)
+    {
+        services::Status status;
+        ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+        ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+        DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+        KernelPtr kernel = factory.getKernel("computeSquares", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(3);
+        args.set(0, x, AccessModeIds::read);
+        args.set(1, p);
+        args.set(2, sqNorms, AccessModeIds::write);
+
+        KernelRange range(n);
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+
+    /* xSubset[i] = x[indices[i]] for the rows of p features */
+    static services::Status gatherRows(const UniversalBuffer & x, const UniversalBuffer & indices, const uint32_t nIndices, const uint32_t p,
+                                       UniversalBuffer & xSubset)
+    {
+        services::Status status;
+        ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+        ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+        DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+        KernelPtr kernel = factory.getKernel("gatherRows", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(4);
+        args.set(0, x, AccessModeIds::read);
+        args.set(1, indices, AccessModeIds::read);
+        args.set(2, p);
+        args.set(3, xSubset, AccessModeIds::write);
+
+        KernelRange range(nIndices, p);
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+
+    static services::Status gatherValues(const UniversalBuffer & values, const UniversalBuffer & indices, const uint32_t nIndices,
+                                         UniversalBuffer & valuesSubset)
+    {
+        services::Status status;
+        ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+        ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+        DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+        KernelPtr kernel = factory.getKernel("gatherValues", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(3);
+        args.set(0, values, AccessModeIds::read);
+        args.set(1, indices, AccessModeIds::read);
+        args.set(2, valuesSubset, AccessModeIds::write);
+
+        KernelRange range(nIndices);
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+
+    /**
+     * Computes the row-major block of the kernel values K(a_i, b_j), i < nA, j < nB.
+     * The squared norms of the rows are used by the RBF kernel only
+     */
+    static services::Status computeKernel(const KernelParameterOneAPI<algorithmFPType> & kfPar, const UniversalBuffer & a,
+                                          const UniversalBuffer & sqNormsA, const uint32_t nA, const UniversalBuffer & b,
+                                          const UniversalBuffer & sqNormsB, const uint32_t nB, const uint32_t p, UniversalBuffer & block)
+    {
+        services::Status status;
+        ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        if (!kfPar.isRBF)
+        {
+            /* k * <a_i, b_j> + b */
+            ctx.fill(block, double(kfPar.b), &status);
+            DAAL_CHECK_STATUS_VAR(status);
+            return BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, nA, nB, p, kfPar.k, a, p,
+                                                   0, b, p, 0, algorithmFPType(1.0), block, nB, 0);
+        }
+
+        /* exp(coeff * (|a_i|^2 + |b_j|^2 - 2 * <a_i, b_j>)) */
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::Trans, nA, nB,
+                                                                  p, algorithmFPType(1.0), a, p, 0, b, p, 0, algorithmFPType(0.0), block, nB, 0));
+
+        ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+        DAAL_CHECK_STATUS(status, buildProgram(factory));
+
+        KernelPtr kernel = factory.getKernel("makeRBFKernel", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(5);
+        args.set(0, sqNormsA, AccessModeIds::read);
+        args.set(1, sqNormsB, AccessModeIds::read);
+        args.set(2, nB);
+        args.set(3, kfPar.coeff);
+        args.set(4, block, AccessModeIds::readwrite);
+
+        KernelRange range(nA, nB);
+        ctx.run(range, kernel, args, &status);
+        return status;
+    }
+};
+
+} // namespace internal
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
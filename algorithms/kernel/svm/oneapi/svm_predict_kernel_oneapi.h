@@ -0,0 +1,63 @@
+/* file: svm_predict_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that contains SVM prediction functions on GPU.
+//--
+*/
+
+#ifndef __SVM_PREDICT_KERNEL_ONEAPI_H__
+#define __SVM_PREDICT_KERNEL_ONEAPI_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/model.h"
+#include "services/daal_defines.h"
+#include "algorithms/svm/svm_predict_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::data_management;
+
+template <typename algorithmFPType>
+class SVMPredictOneAPI : public Kernel
+{
+public:
+    /* Maximal number of elements in the (rows x support vectors) block of the kernel values */
+    static const uint32_t maxKernelBlockSize = 16 * 1024 * 1024;
+
+    services::Status compute(const NumericTablePtr & xTable, const daal::algorithms::Model * m, NumericTable & r,
+                             const daal::algorithms::Parameter * par);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,150 @@
+/* file: svm_predict_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  SVM prediction algorithm implementation on GPU: the decision function of a block of observations
+//  is the product of the block of kernel values with the classification coefficients.
+//--
+*/
+
+#ifndef __SVM_PREDICT_ONEAPI_IMPL_I__
+#define __SVM_PREDICT_ONEAPI_IMPL_I__
+
+#include "algorithms/kernel/svm/oneapi/svm_helper_oneapi.h"
+#include "service/kernel/service_data_utils.h"
+#include "externals/service_ittnotify.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace prediction
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services;
+using svm::internal::HelperSVM;
+
+template <typename algorithmFPType>
+services::Status SVMPredictOneAPI<algorithmFPType>::compute(const NumericTablePtr & xTable, const daal::algorithms::Model * m, NumericTable & r,
+                                                            const daal::algorithms::Parameter * par)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+
+    Model * model = static_cast<Model *>(const_cast<daal::algorithms::Model *>(m));
+    kernel_function::KernelIfacePtr kernel;
+    {
+        svm::interface1::Parameter * parameter = dynamic_cast<svm::interface1::Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
+        if (parameter) kernel = parameter->kernel;
+    }
+    {
+        svm::interface2::Parameter * parameter = dynamic_cast<svm::interface2::Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
+        if (parameter) kernel = parameter->kernel;
+    }
+    DAAL_CHECK(kernel, ErrorNullParameterNotSupported);
+
+    svm::internal::KernelParameterOneAPI<algorithmFPType> kfPar;
+    DAAL_CHECK(kfPar.init(kernel), ErrorMethodNotImplemented);
+
+    NumericTablePtr svCoeffTable = model->getClassificationCoefficients();
+    NumericTablePtr svTable      = model->getSupportVectors();
+    DAAL_CHECK(xTable->getDataLayout() != NumericTableIface::csrArray, ErrorMethodNotImplemented);
+    DAAL_CHECK(svTable->getDataLayout() != NumericTableIface::csrArray, ErrorMethodNotImplemented);
+
+    const size_t nVectors  = xTable->getNumberOfRows();
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t nSV       = svCoeffTable->getNumberOfRows();
+    DAAL_CHECK(nVectors <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_CHECK(nSV <= size_t(services::internal::MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    const TypeId idType         = TypeIds::id<algorithmFPType>();
+
+    BlockDescriptor<algorithmFPType> distanceBlock;
+    DAAL_CHECK_STATUS(status, r.getBlockOfRows(0, nVectors, ReadWriteMode::writeOnly, distanceBlock));
+    UniversalBuffer distance = distanceBlock.getBuffer();
+
+    ctx.fill(distance, nSV ? double(model->getBias()) : 0.0, &status);
+    if (!status || nSV == 0)
+    {
+        status |= r.releaseBlockOfRows(distanceBlock);
+        return status;
+    }
+
+    BlockDescriptor<algorithmFPType> svBlock;
+    DAAL_CHECK_STATUS(status, svTable->getBlockOfRows(0, nSV, ReadWriteMode::readOnly, svBlock));
+    BlockDescriptor<algorithmFPType> svCoeffBlock;
+    DAAL_CHECK_STATUS(status, svCoeffTable->getBlockOfRows(0, nSV, ReadWriteMode::readOnly, svCoeffBlock));
+    const UniversalBuffer sv      = svBlock.getBuffer();
+    const UniversalBuffer svCoeff = svCoeffBlock.getBuffer();
+
+    const size_t maxRowsInBlock = (maxKernelBlockSize / nSV ? maxKernelBlockSize / nSV : 1);
+    const uint32_t nRowsInBlock = uint32_t(nVectors < maxRowsInBlock ? nVectors : maxRowsInBlock);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, nRowsInBlock, nSV);
+
+    UniversalBuffer kernelBlock = ctx.allocate(idType, nRowsInBlock * nSV, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    UniversalBuffer sqNormsSV;
+    UniversalBuffer sqNormsBlock;
+    if (kfPar.isRBF)
+    {
+        sqNormsSV = ctx.allocate(idType, nSV, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        sqNormsBlock = ctx.allocate(idType, nRowsInBlock, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::computeSquares(sv, nSV, nFeatures, sqNormsSV));
+    }
+
+    for (size_t iStart = 0; iStart < nVectors; iStart += nRowsInBlock)
+    {
+        const uint32_t nRows = uint32_t(nVectors - iStart < nRowsInBlock ? nVectors - iStart : nRowsInBlock);
+
+        BlockDescriptor<algorithmFPType> xBlock;
+        DAAL_CHECK_STATUS(status, xTable->getBlockOfRows(iStart, nRows, ReadWriteMode::readOnly, xBlock));
+        const UniversalBuffer x = xBlock.getBuffer();
+
+        if (kfPar.isRBF)
+        {
+            DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::computeSquares(x, nRows, nFeatures, sqNormsBlock));
+        }
+        DAAL_CHECK_STATUS(status,
+                          HelperSVM<algorithmFPType>::computeKernel(kfPar, x, sqNormsBlock, nRows, sv, sqNormsSV, nSV, nFeatures, kernelBlock));
+
+        /* distance += K(x, sv) * svCoeff */
+        DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::NoTrans, math::Transpose::NoTrans, nRows,
+                                                                  1, nSV, algorithmFPType(1.0), kernelBlock, nSV, 0, svCoeff, 1, 0,
+                                                                  algorithmFPType(1.0), distance, 1, iStart));
+        DAAL_CHECK_STATUS(status, xTable->releaseBlockOfRows(xBlock));
+    }
+
+    DAAL_CHECK_STATUS(status, svTable->releaseBlockOfRows(svBlock));
+    DAAL_CHECK_STATUS(status, svCoeffTable->releaseBlockOfRows(svCoeffBlock));
+    return r.releaseBlockOfRows(distanceBlock);
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
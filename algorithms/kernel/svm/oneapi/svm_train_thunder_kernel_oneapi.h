@@ -0,0 +1,130 @@
+/* file: svm_train_thunder_kernel_oneapi.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate SVM Training functions with the thunder method on GPU.
+//--
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_KERNEL_ONEAPI_H__
+#define __SVM_TRAIN_THUNDER_KERNEL_ONEAPI_H__
+
+#include "algorithms/kernel/svm/svm_train_kernel.h"
+#include "algorithms/kernel/svm/oneapi/svm_helper_oneapi.h"
+#include "service/kernel/oneapi/select_indexed.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Training task of the thunder method on GPU. Every outer iteration selects the working set on the device,
+ * computes the rows of kernel matrix for the working set with a single matrix-matrix product,
+ * solves the sub-problem restricted to the working set in a single work-group and updates the gradient
+ * for all observations with a matrix-vector product. The coefficients are copied to the host to build the model
+ */
+template <typename algorithmFPType, typename ParameterType>
+struct SVMTrainThunderOneAPITask : public SVMTrainTask<algorithmFPType, ParameterType, sse2>
+{
+    typedef SVMTrainTask<algorithmFPType, ParameterType, sse2> super;
+    typedef oneapi::internal::UniversalBuffer UniversalBuffer;
+    typedef oneapi::internal::selection::SelectIndexed SelectIndexed;
+
+    static const uint32_t maxWorkingSetSize = svm::internal::svmLocalSize; /* Maximal number of observations in the working set */
+
+    SVMTrainThunderOneAPITask(size_t nVectors) : super(nVectors), _nFeatures(0), _nWSMax(0), _nWS(0), _nWSPrev(0) {}
+
+    Status setup(const ParameterType & svmPar, const services::Buffer<algorithmFPType> & x, size_t nFeatures, NumericTable & yTable);
+
+    Status compute(const ParameterType & svmPar, services::HostAppIface * pHostApp);
+
+    /* Copies the coefficients and the gradient to the host arrays used to build the model */
+    Status copyResultsToHost();
+
+protected:
+    /* Selects the observations of the working set, returns the duality gap of the current solution in diff */
+    Status selectWorkingSet(algorithmFPType C, algorithmFPType & diff);
+
+    Status computeKernelBlock();
+
+    /* Solves the sub-problem for the observations in the working set, returns the number of the inner iterations */
+    Status solveWorkingSet(algorithmFPType C, algorithmFPType eps, algorithmFPType tau, uint32_t maxInnerIterations, uint32_t & nInnerIterations);
+
+    Status updateGradient();
+
+    using super::_nVectors;
+    using super::_y;
+    using super::_alpha;
+    using super::_grad;
+
+protected:
+    uint32_t _nFeatures;                                          //Number of features in the input data set
+    uint32_t _nWSMax;                                             //Maximal number of observations in the working set
+    uint32_t _nWS;                                                //Number of observations in the working set at the current iteration
+    uint32_t _nWSPrev;                                            //Number of observations in the working set at the previous iteration
+    svm::internal::KernelParameterOneAPI<algorithmFPType> _kfPar; //Parameters of the linear or RBF kernel
+    services::SharedPtr<SelectIndexed> _selectorInit;             //Selects the most violating observations at the first iteration
+    services::SharedPtr<SelectIndexed> _selector;                 //Selects the most violating observations
+    SelectIndexed::Result _selectedUp;                            //Most violating observations from I_UP
+    SelectIndexed::Result _selectedLow;                           //Most violating observations from I_LOW
+    TArray<int, sse2> _wsHost;                                    //Indices of the observations in the working set
+    TArray<int, sse2> _wsPrevHost;                                //Working set of the previous iteration
+    TArray<char, sse2> _inWS;                                     //Flags of the observations that are in the working set
+    UniversalBuffer _x;                                           //Input data set on the device
+    UniversalBuffer _yBuff;                                       //Array of class labels
+    UniversalBuffer _alphaBuff;                                   //Array of classification coefficients
+    UniversalBuffer _gradBuff;                                    //Objective function gradient
+    UniversalBuffer _sqNorms;                                     //Squared norms of the observations, used by the RBF kernel
+    UniversalBuffer _valuesUp;                                    //Selection values of the observations from I_UP
+    UniversalBuffer _valuesLow;                                   //Selection values of the observations from I_LOW
+    UniversalBuffer _ws;                                          //Indices of the observations in the working set
+    UniversalBuffer _xWS;                                         //Rows of the input data for the working set
+    UniversalBuffer _sqNormsWS;                                   //Squared norms of the observations in the working set
+    UniversalBuffer _kernelBlock;                                 //Rows of kernel matrix for the working set, _nWSMax x nVectors
+    UniversalBuffer _kernelWS;                                    //Kernel matrix restricted to the working set
+    UniversalBuffer _deltaWS;                                     //y[i] * (change of alpha[i]) for the observations in the working set
+    UniversalBuffer _gradDelta;                                   //Change of the gradient for all observations
+    UniversalBuffer _nInnerIterations;                            //Number of the inner iterations made by the solver
+};
+
+template <typename algorithmFPType, typename ParameterType>
+class SVMTrainThunderOneAPI : public Kernel
+{
+public:
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r,
+                             const ParameterType * par);
+};
+
+} // namespace internal
+
+} // namespace training
+
+} // namespace svm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,449 @@
+/* file: svm_train_thunder_oneapi_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  SVM training algorithm implementation with the thunder method on GPU.
+//
+//  The iterations follow the CPU thunder method: the most violating observations of I_UP and I_LOW
+//  are selected on the device, the rest of the working set is filled on the host with the observations
+//  of the previous working set. The sub-problem is solved by SMO in a single work-group with the kernel
+//  matrix of the working set in global memory and the coefficients of the working set in private memory.
+//--
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_ONEAPI_IMPL_I__
+#define __SVM_TRAIN_THUNDER_ONEAPI_IMPL_I__
+
+#include "algorithms/engines/mt19937/mt19937.h"
+#include "externals/service_memory.h"
+#include "externals/service_ittnotify.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_data_utils.h"
+#include "algorithms/kernel/svm/svm_train_result_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+using namespace daal::oneapi::internal;
+using namespace daal::services::internal;
+using svm::internal::HelperSVM;
+using selection::SelectIndexedFactory;
+
+template <typename algorithmFPType, typename ParameterType>
+services::Status SVMTrainThunderOneAPI<algorithmFPType, ParameterType>::compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable,
+                                                                              NumericTable & yTable, daal::algorithms::Model * r,
+                                                                              const ParameterType * svmPar)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(compute);
+    DAAL_CHECK(xTable->getDataLayout() != NumericTableIface::csrArray, ErrorMethodNotImplemented);
+
+    const size_t nVectors  = xTable->getNumberOfRows();
+    const size_t nFeatures = xTable->getNumberOfColumns();
+
+    Status status;
+    BlockDescriptor<algorithmFPType> xBlock;
+    DAAL_CHECK_STATUS(status, xTable->getBlockOfRows(0, nVectors, ReadWriteMode::readOnly, xBlock));
+
+    SVMTrainThunderOneAPITask<algorithmFPType, ParameterType> task(nVectors);
+    status = task.setup(*svmPar, xBlock.getBuffer(), nFeatures, yTable);
+    if (status) status = task.compute(*svmPar, pHostApp);
+    if (status) status = task.copyResultsToHost();
+    status |= xTable->releaseBlockOfRows(xBlock);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    return task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C);
+}
+
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::setup(const ParameterType & svmPar, const services::Buffer<algorithmFPType> & x,
+                                                                        size_t nFeatures, NumericTable & yTable)
+{
+    DAAL_CHECK(_kfPar.init(svmPar.kernel), ErrorMethodNotImplemented);
+    DAAL_CHECK(_nVectors <= size_t(MaxVal<int>::get()), ErrorIncorrectNumberOfRowsInInputNumericTable);
+    DAAL_CHECK(nFeatures <= size_t(MaxVal<int>::get()), ErrorIncorrectNumberOfColumnsInInputNumericTable);
+    _nFeatures = uint32_t(nFeatures);
+    _x         = x;
+
+    /* The working set size is the largest power of 2 that does not exceed the number of observations and the local size of the solver */
+    _nWSMax = (_nVectors < 2 ? uint32_t(_nVectors) : 2);
+    while (2 * _nWSMax <= _nVectors && 2 * _nWSMax <= maxWorkingSetSize) _nWSMax *= 2;
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, _nWSMax, _nVectors);
+    DAAL_OVERFLOW_CHECK_BY_MULTIPLICATION(uint32_t, _nWSMax, _nFeatures);
+
+    _alpha.reset(_nVectors);
+    _y.reset(_nVectors);
+    _grad.reset(_nVectors);
+    _inWS.reset(_nVectors);
+    _wsHost.reset(_nWSMax);
+    _wsPrevHost.reset(_nWSMax);
+    DAAL_CHECK_MALLOC(_alpha.get() && _y.get() && _grad.get() && _inWS.get() && _wsHost.get() && _wsPrevHost.get());
+    service_memset<char, sse2>(_inWS.get(), char(0), _nVectors);
+
+    ReadColumns<algorithmFPType, sse2> mtY(yTable, 0, 0, _nVectors);
+    DAAL_CHECK_BLOCK_STATUS(mtY);
+    int result = daal_memcpy_s(_y.get(), _nVectors * sizeof(algorithmFPType), mtY.get(), _nVectors * sizeof(algorithmFPType));
+    DAAL_CHECK(!result, ErrorMemoryCopyFailedInternal);
+
+    Status status;
+    ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+    const TypeIds::Id idType    = TypeIds::id<algorithmFPType>();
+
+    _yBuff = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.copy(_yBuff, 0, (void *)_y.get(), 0, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _alphaBuff = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.fill(_alphaBuff, 0.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _gradBuff = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    ctx.fill(_gradBuff, -1.0, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _valuesUp = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _valuesLow = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _gradDelta = ctx.allocate(idType, _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _ws = ctx.allocate(TypeIds::id<int>(), _nWSMax, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _xWS = ctx.allocate(idType, _nWSMax * _nFeatures, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _kernelBlock = ctx.allocate(idType, _nWSMax * _nVectors, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _kernelWS = ctx.allocate(idType, _nWSMax * _nWSMax, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _deltaWS = ctx.allocate(idType, _nWSMax, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _nInnerIterations = ctx.allocate(TypeIds::id<uint32_t>(), 1, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    if (_kfPar.isRBF)
+    {
+        _sqNorms = ctx.allocate(idType, _nVectors, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        _sqNormsWS = ctx.allocate(idType, _nWSMax, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+        DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::computeSquares(_x, _nVectors, _nFeatures, _sqNorms));
+    }
+
+    /* Half of the working set is selected at the first iteration from each of I_UP and I_LOW, a quarter at the next ones */
+    const uint32_t nKInit = (_nWSMax / 2 ? _nWSMax / 2 : 1);
+    const uint32_t nK     = (_nWSMax / 4 ? _nWSMax / 4 : 1);
+    engines::EnginePtr engine(engines::mt19937::Batch<>::create());
+    SelectIndexedFactory factory;
+    SelectIndexed::Params paramsInit(nKInit, idType, _nVectors, engine);
+    _selectorInit.reset(factory.create(nKInit, paramsInit, &status));
+    DAAL_CHECK_STATUS_VAR(status);
+    SelectIndexed::Params params(nK, idType, _nVectors, engine);
+    _selector.reset(factory.create(nK, params, &status));
+    DAAL_CHECK_STATUS_VAR(status);
+
+    _selectedUp = SelectIndexed::Result(ctx, nKInit, 1, idType, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    _selectedLow = SelectIndexed::Result(ctx, nKInit, 1, idType, &status);
+    return status;
+}
+
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::compute(const ParameterType & svmPar, services::HostAppIface * pHostApp)
+{
+    const algorithmFPType C(svmPar.C);
+    const algorithmFPType eps(svmPar.accuracyThreshold);
+    const algorithmFPType tau(svmPar.tau);
+    /* Every sub-problem is solved with the accuracy that depends on the duality gap of the whole problem */
+    const algorithmFPType innerAccuracyFactor(0.1);
+    const size_t maxInnerIterations = 100 * _nWSMax;
+
+    Status s;
+    for (size_t iter = 0; iter < svmPar.maxIterations;)
+    {
+        algorithmFPType diff(0.0);
+        DAAL_CHECK_STATUS(s, selectWorkingSet(C, diff));
+        if (diff < eps || _nWS < 2) break;
+
+        services::internal::reportProgress(pHostApp, iter, diff);
+        if (services::internal::isCancelled(s, pHostApp)) break;
+
+        DAAL_CHECK_STATUS(s, computeKernelBlock());
+
+        const algorithmFPType innerEps = (innerAccuracyFactor * diff > eps ? innerAccuracyFactor * diff : eps);
+        const size_t nIterationsLeft   = svmPar.maxIterations - iter;
+        uint32_t nInnerIterations      = 0;
+        DAAL_CHECK_STATUS(s, solveWorkingSet(C, innerEps, tau, uint32_t(maxInnerIterations < nIterationsLeft ? maxInnerIterations : nIterationsLeft),
+                                             nInnerIterations));
+        if (nInnerIterations == 0) break;
+        iter += nInnerIterations;
+
+        DAAL_CHECK_STATUS(s, updateGradient());
+    }
+    return s;
+}
+
+/**
+ * \brief Select the working set: the observations from I_UP(alpha) with the largest values of -y[i]*grad[i]
+ *        and the observations from I_LOW(alpha) with the smallest ones are found on the device,
+ *        the rest of the working set is filled with the observations selected at the previous iteration
+ *
+ * \param[in]  C     Upper bound in constraints of the quadratic optimization problem
+ * \param[out] diff  The difference m(alpha) - M(alpha) for the whole problem
+ */
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::selectWorkingSet(algorithmFPType C, algorithmFPType & diff)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(selectWorkingSet);
+    Status status;
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::buildProgram(factory));
+
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    {
+        KernelPtr kernel = factory.getKernel("computeSelectionValues", &status);
+        DAAL_CHECK_STATUS_VAR(status);
+
+        KernelArguments args(7);
+        args.set(0, _yBuff, AccessModeIds::read);
+        args.set(1, _alphaBuff, AccessModeIds::read);
+        args.set(2, _gradBuff, AccessModeIds::read);
+        args.set(3, C);
+        args.set(4, fpMax);
+        args.set(5, _valuesUp, AccessModeIds::write);
+        args.set(6, _valuesLow, AccessModeIds::write);
+
+        KernelRange range(_nVectors);
+        ctx.run(range, kernel, args, &status);
+        DAAL_CHECK_STATUS_VAR(status);
+    }
+
+    const uint32_t nSelect   = (_nWSPrev ? _nWSMax / 2 : _nWSMax);
+    const uint32_t nK        = (nSelect / 2 ? nSelect / 2 : 1);
+    SelectIndexed & selector = (_nWSPrev ? *_selector : *_selectorInit);
+    const uint32_t nVectors  = uint32_t(_nVectors);
+    selector.selectIndices(_valuesUp, nK, 1, nVectors, nVectors, nVectors, _selectedUp, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    selector.selectIndices(_valuesLow, nK, 1, nVectors, nVectors, nVectors, _selectedLow, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    auto upValues   = _selectedUp.values.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    auto upIndices  = _selectedUp.indices.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+    auto lowValues  = _selectedLow.values.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    auto lowIndices = _selectedLow.indices.template get<int>().toHost(ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_MALLOC(upValues.get() && upIndices.get() && lowValues.get() && lowIndices.get());
+
+    /* The selected values are not sorted, the minimums give the duality gap */
+    algorithmFPType GMax = -fpMax;
+    algorithmFPType GMin = fpMax;
+    for (uint32_t k = 0; k < nK; k++)
+    {
+        if (upValues.get()[k] < fpMax && -upValues.get()[k] > GMax) GMax = -upValues.get()[k];
+        if (lowValues.get()[k] < GMin) GMin = lowValues.get()[k];
+    }
+    diff = GMax - GMin;
+
+    int * ws           = _wsHost.get();
+    char * inWS        = _inWS.get();
+    uint32_t nSelected = 0;
+    for (uint32_t k = 0; k < nK && nSelected < nSelect; k++)
+    {
+        const int iUp = upIndices.get()[k];
+        if (upValues.get()[k] < fpMax && !inWS[iUp])
+        {
+            inWS[iUp]       = 1;
+            ws[nSelected++] = iUp;
+        }
+        if (nSelected == nSelect) break;
+        const int iLow = lowIndices.get()[k];
+        if (lowValues.get()[k] < fpMax && !inWS[iLow])
+        {
+            inWS[iLow]      = 1;
+            ws[nSelected++] = iLow;
+        }
+    }
+
+    /* The observations from the previous working set are taken in the order they were added to it */
+    int * wsPrev = _wsPrevHost.get();
+    for (uint32_t k = 0; k < _nWSPrev && nSelected < _nWSMax; k++)
+    {
+        const int i = wsPrev[k];
+        if (inWS[i]) continue;
+        inWS[i]         = 1;
+        ws[nSelected++] = i;
+    }
+
+    for (uint32_t k = 0; k < nSelected; k++)
+    {
+        inWS[ws[k]] = 0;
+        wsPrev[k]   = ws[k];
+    }
+    _nWS     = nSelected;
+    _nWSPrev = nSelected;
+    if (!nSelected) return status;
+
+    ctx.copy(_ws, 0, (void *)ws, 0, nSelected, &status);
+    return status;
+}
+
+/**
+ * \brief Compute the rows of kernel matrix for the observations in the working set
+ *        and gather the kernel matrix restricted to the working set
+ */
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::computeKernelBlock()
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(computeKernelBlock);
+    Status status;
+    DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::gatherRows(_x, _ws, _nWS, _nFeatures, _xWS));
+    if (_kfPar.isRBF)
+    {
+        DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::gatherValues(_sqNorms, _ws, _nWS, _sqNormsWS));
+    }
+    DAAL_CHECK_STATUS(status, HelperSVM<algorithmFPType>::computeKernel(_kfPar, _xWS, _sqNormsWS, _nWS, _x, _sqNorms, _nVectors, _nFeatures,
+                                                                        _kernelBlock));
+
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    KernelPtr kernel               = factory.getKernel("gatherKernelWS", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(4);
+    args.set(0, _kernelBlock, AccessModeIds::read);
+    args.set(1, _ws, AccessModeIds::read);
+    args.set(2, uint32_t(_nVectors));
+    args.set(3, _kernelWS, AccessModeIds::write);
+
+    KernelRange range(_nWS, _nWS);
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+/**
+ * \brief Solve the sub-problem restricted to the working set using SMO with the second order working set selection
+ *
+ * \param[in]  C                  Upper bound in constraints of the quadratic optimization problem
+ * \param[in]  eps                Accuracy of the solution of the sub-problem
+ * \param[in]  tau                Parameter of the working set selection algorithm
+ * \param[in]  maxInnerIterations Maximal number of the updated pairs of coefficients
+ * \param[out] nInnerIterations   Number of the updated pairs of coefficients
+ */
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::solveWorkingSet(algorithmFPType C, algorithmFPType eps, algorithmFPType tau,
+                                                                                  uint32_t maxInnerIterations, uint32_t & nInnerIterations)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(solveWorkingSet);
+    Status status;
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    KernelPtr kernel               = factory.getKernel("smoSolver", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(13);
+    args.set(0, _yBuff, AccessModeIds::read);
+    args.set(1, _kernelWS, AccessModeIds::read);
+    args.set(2, _ws, AccessModeIds::read);
+    args.set(3, _gradBuff, AccessModeIds::read);
+    args.set(4, _alphaBuff, AccessModeIds::readwrite);
+    args.set(5, _deltaWS, AccessModeIds::write);
+    args.set(6, _nInnerIterations, AccessModeIds::write);
+    args.set(7, _nWS);
+    args.set(8, C);
+    args.set(9, eps);
+    args.set(10, tau);
+    args.set(11, MaxVal<algorithmFPType>::get());
+    args.set(12, maxInnerIterations);
+
+    KernelRange localRange(svm::internal::svmLocalSize);
+    KernelNDRange range(1);
+    range.global(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    ctx.run(range, kernel, args, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    auto nInnerIterationsHost = _nInnerIterations.template get<uint32_t>().toHost(ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_MALLOC(nInnerIterationsHost.get());
+    nInnerIterations = nInnerIterationsHost.get()[0];
+    return status;
+}
+
+/**
+ * \brief Update the gradient of the objective function for all observations:
+ *        grad[t] += y[t] * sum_i(kernel(x[ws[i]], x[t]) * y[ws[i]] * (change of alpha[ws[i]]))
+ */
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::updateGradient()
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(updateGradient);
+    Status status;
+    const uint32_t nVectors = uint32_t(_nVectors);
+    DAAL_CHECK_STATUS(status, BlasGpu<algorithmFPType>::xgemm(math::Layout::RowMajor, math::Transpose::Trans, math::Transpose::NoTrans, nVectors, 1,
+                                                              _nWS, algorithmFPType(1.0), _kernelBlock, nVectors, 0, _deltaWS, 1, 0,
+                                                              algorithmFPType(0.0), _gradDelta, 1, 0));
+
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    KernelPtr kernel               = factory.getKernel("updateGradient", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(3);
+    args.set(0, _yBuff, AccessModeIds::read);
+    args.set(1, _gradDelta, AccessModeIds::read);
+    args.set(2, _gradBuff, AccessModeIds::readwrite);
+
+    KernelRange range(nVectors);
+    ctx.run(range, kernel, args, &status);
+    return status;
+}
+
+template <typename algorithmFPType, typename ParameterType>
+Status SVMTrainThunderOneAPITask<algorithmFPType, ParameterType>::copyResultsToHost()
+{
+    Status status;
+    auto alphaHost = _alphaBuff.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    auto gradHost  = _gradBuff.template get<algorithmFPType>().toHost(ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    DAAL_CHECK_MALLOC(alphaHost.get() && gradHost.get());
+
+    const size_t size = _nVectors * sizeof(algorithmFPType);
+    int result        = daal_memcpy_s(_alpha.get(), size, alphaHost.get(), size);
+    result |= daal_memcpy_s(_grad.get(), size, gradHost.get(), size);
+    return (!result) ? status : Status(ErrorMemoryCopyFailedInternal);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
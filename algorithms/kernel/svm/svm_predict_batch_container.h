@@ -23,6 +23,7 @@
 
 #include "algorithms/svm/svm_predict.h"
 #include "algorithms/kernel/svm/svm_predict_kernel.h"
+#include "algorithms/kernel/svm/oneapi/svm_predict_kernel_oneapi.h"
 #include "algorithms/classifier/classifier_predict_types.h"
 
 namespace daal
@@ -41,7 +42,17 @@ namespace interface2
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::SVMPredictImpl, method, algorithmFPType);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::SVMPredictImpl, method, algorithmFPType);
+    }
+    else
+    {
+        _kernel = new internal::SVMPredictOneAPI<algorithmFPType>();
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -63,7 +74,17 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::algorithms::Parameter * par      = _par;
     daal::services::Environment::env & env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::SVMPredictImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, m, *r, par);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu)
+    {
+        __DAAL_CALL_KERNEL(env, internal::SVMPredictImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, m, *r, par);
+    }
+    else
+    {
+        return ((internal::SVMPredictOneAPI<algorithmFPType> *)(_kernel))->compute(a, m, *r, par);
+    }
 }
 } // namespace interface2
 } // namespace prediction
@@ -27,7 +27,10 @@
 #include "externals/service_memory.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "externals/service_blas.h"
-#include "externals/service_memory.h"
+#include "externals/service_math.h"
+#include "algorithms/kernel_function/kernel_function_types_linear.h"
+#include "algorithms/kernel_function/kernel_function_types_rbf.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -46,6 +49,10 @@ using namespace daal::services::internal;
 template <typename algorithmFPType, CpuType cpu>
 struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 {
+    /* Sizes of the (rows x support vectors) tiles of the fused decision function */
+    static const size_t nRowsInBlock = 64;
+    static const size_t nSVInBlock   = 256;
+
     services::Status compute(const NumericTablePtr & xTable, const daal::algorithms::Model * m, NumericTable & r,
                              const daal::algorithms::Parameter * par)
     {
@@ -85,6 +92,153 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
         DAAL_CHECK_BLOCK_STATUS(mtSVCoeff);
         const algorithmFPType * svCoeff = mtSVCoeff.get();
 
+        const bool isDense = xTable->getDataLayout() != NumericTableIface::csrArray && svTable->getDataLayout() != NumericTableIface::csrArray;
+        if (isDense)
+        {
+            const kernel_function::ParameterBase * kfPar         = kernel->getParameter();
+            const kernel_function::linear::Parameter * linearPar = dynamic_cast<const kernel_function::linear::Parameter *>(kfPar);
+            if (linearPar) return computeLinear(*xTable, *svTable, svCoeff, nSV, bias, *linearPar, distance);
+            const kernel_function::rbf::Parameter * rbfPar = dynamic_cast<const kernel_function::rbf::Parameter *>(kfPar);
+            if (rbfPar) return computeRBF(*xTable, *svTable, svCoeff, nSV, bias, *rbfPar, distance);
+        }
+        return computeByKernelFunction(xTable, svTable, kernel, svCoeff, nSV, bias, distance);
+    }
+
+protected:
+    /* Linear kernel: sum_i(a_i * (k * <x, sv_i> + b)) = k * <x, w> + b * sum_i(a_i) with w = sum_i(a_i * sv_i) */
+    services::Status computeLinear(NumericTable & xTable, NumericTable & svTable, const algorithmFPType * svCoeff, const size_t nSV,
+                                   const algorithmFPType bias, const kernel_function::linear::Parameter & kfPar, algorithmFPType * distance)
+    {
+        const size_t nVectors  = xTable.getNumberOfRows();
+        const size_t nFeatures = xTable.getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu> mtSV(svTable, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+
+        TArray<algorithmFPType, cpu> aW(nFeatures);
+        DAAL_CHECK_MALLOC(aW.get());
+        algorithmFPType * w = aW.get();
+        {
+            char trans = 'N';
+            DAAL_INT m_(nFeatures), n_(nSV), lda(nFeatures), inc(1);
+            algorithmFPType one(1.0), zero(0.0);
+            Blas<algorithmFPType, cpu>::xgemv(&trans, &m_, &n_, &one, mtSV.get(), &lda, svCoeff, &inc, &zero, w, &inc);
+        }
+
+        algorithmFPType coeffSum(0.0);
+        for (size_t i = 0; i < nSV; i++) coeffSum += svCoeff[i];
+        const algorithmFPType k(kfPar.k);
+        const algorithmFPType shift = algorithmFPType(kfPar.b) * coeffSum + bias;
+
+        const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            const size_t iStart = iBlock * nRowsInBlock;
+            const size_t nRows  = (iStart + nRowsInBlock > nVectors) ? nVectors - iStart : nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> mtX(xTable, iStart, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+
+            char trans = 'T';
+            DAAL_INT m_(nFeatures), n_(nRows), lda(nFeatures), inc(1);
+            algorithmFPType zero(0.0);
+            Blas<algorithmFPType, cpu>::xxgemv(&trans, &m_, &n_, &k, mtX.get(), &lda, w, &inc, &zero, distance + iStart, &inc);
+            for (size_t i = 0; i < nRows; i++) distance[iStart + i] += shift;
+        });
+        return safeStat.detach();
+    }
+
+    /* RBF kernel: the kernel values are computed tile by tile from the precomputed squared norms
+     * and reduced with the coefficients right away, so the full kernel matrix is never stored */
+    services::Status computeRBF(NumericTable & xTable, NumericTable & svTable, const algorithmFPType * svCoeff, const size_t nSV,
+                                const algorithmFPType bias, const kernel_function::rbf::Parameter & kfPar, algorithmFPType * distance)
+    {
+        const size_t nVectors  = xTable.getNumberOfRows();
+        const size_t nFeatures = xTable.getNumberOfColumns();
+        const algorithmFPType coeff(-0.5 / (kfPar.sigma * kfPar.sigma));
+        const algorithmFPType expThreshold = Math<algorithmFPType, cpu>::vExpThreshold();
+
+        ReadRows<algorithmFPType, cpu> mtSV(svTable, 0, nSV);
+        DAAL_CHECK_BLOCK_STATUS(mtSV);
+        const algorithmFPType * sv = mtSV.get();
+
+        TArray<algorithmFPType, cpu> aSVNorm(nSV);
+        DAAL_CHECK_MALLOC(aSVNorm.get());
+        algorithmFPType * svNorm = aSVNorm.get();
+        const size_t nSVBlocks   = nSV / nSVInBlock + !!(nSV % nSVInBlock);
+        daal::threader_for(nSVBlocks, nSVBlocks, [&](size_t iBlock) {
+            const size_t iEnd = (iBlock + 1) * nSVInBlock > nSV ? nSV : (iBlock + 1) * nSVInBlock;
+            for (size_t i = iBlock * nSVInBlock; i < iEnd; i++) svNorm[i] = sqrNorm(sv + i * nFeatures, nFeatures);
+        });
+
+        daal::tls<algorithmFPType *> tlsTile([=]() -> algorithmFPType * {
+            return services::internal::service_scalable_malloc<algorithmFPType, cpu>(nRowsInBlock * nSVInBlock);
+        });
+
+        const size_t nBlocks = nVectors / nRowsInBlock + !!(nVectors % nRowsInBlock);
+        SafeStatus safeStat;
+        daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+            algorithmFPType * tile = tlsTile.local();
+            DAAL_CHECK_MALLOC_THR(tile);
+
+            const size_t iStart = iBlock * nRowsInBlock;
+            const size_t nRows  = (iStart + nRowsInBlock > nVectors) ? nVectors - iStart : nRowsInBlock;
+            ReadRows<algorithmFPType, cpu> mtX(xTable, iStart, nRows);
+            DAAL_CHECK_BLOCK_STATUS_THR(mtX);
+            const algorithmFPType * x = mtX.get();
+
+            algorithmFPType xNorm[nRowsInBlock];
+            algorithmFPType * dist = distance + iStart;
+            for (size_t i = 0; i < nRows; i++)
+            {
+                xNorm[i] = sqrNorm(x + i * nFeatures, nFeatures);
+                dist[i]  = bias;
+            }
+
+            for (size_t jStart = 0; jStart < nSV; jStart += nSVInBlock)
+            {
+                const size_t nCols = (jStart + nSVInBlock > nSV) ? nSV - jStart : nSVInBlock;
+
+                /* tile[i * nCols + j] = <x_i, sv_j> */
+                char trans = 'T', notrans = 'N';
+                DAAL_INT m_(nCols), n_(nRows), k_(nFeatures), ld(nFeatures), ldc(nCols);
+                algorithmFPType one(1.0), zero(0.0);
+                Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &m_, &n_, &k_, &one, sv + jStart * nFeatures, &ld, x, &ld, &zero, tile, &ldc);
+
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    algorithmFPType * tileRow = tile + i * nCols;
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nCols; j++)
+                    {
+                        const algorithmFPType val = coeff * (xNorm[i] + svNorm[jStart + j] - algorithmFPType(2.0) * tileRow[j]);
+                        tileRow[j]                = val < expThreshold ? expThreshold : val;
+                    }
+                }
+                Math<algorithmFPType, cpu>::vExp(nRows * nCols, tile, tile);
+
+                const algorithmFPType * coeffs = svCoeff + jStart;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const algorithmFPType * tileRow = tile + i * nCols;
+                    algorithmFPType sum(0.0);
+                    PRAGMA_IVDEP
+                    PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < nCols; j++) sum += coeffs[j] * tileRow[j];
+                    dist[i] += sum;
+                }
+            }
+        });
+        tlsTile.reduce([](algorithmFPType * ptr) { services::internal::service_scalable_free<algorithmFPType, cpu>(ptr); });
+        return safeStat.detach();
+    }
+
+    /* Other kernels and sparse data: the kernel matrix is computed by the kernel function and reduced with the coefficients */
+    services::Status computeByKernelFunction(const NumericTablePtr & xTable, const NumericTablePtr & svTable,
+                                            const kernel_function::KernelIfacePtr & kernel, const algorithmFPType * svCoeff, const size_t nSV,
+                                            const algorithmFPType bias, algorithmFPType * distance)
+    {
+        const size_t nVectors = xTable->getNumberOfRows();
         TArray<algorithmFPType, cpu> aBuf(nSV * nVectors);
         DAAL_CHECK(aBuf.get(), ErrorMemoryAllocationFailed);
         algorithmFPType * buf = aBuf.get();
@@ -119,6 +273,15 @@ struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 
         return s;
     }
+
+    static algorithmFPType sqrNorm(const algorithmFPType * v, const size_t n)
+    {
+        algorithmFPType sum(0.0);
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < n; i++) sum += v[i] * v[i];
+        return sum;
+    }
 };
 
 } // namespace internal
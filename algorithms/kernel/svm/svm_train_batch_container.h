@@ -24,6 +24,8 @@
 #include "algorithms/svm/svm_train.h"
 #include "algorithms/kernel/svm/svm_train_kernel.h"
 #include "algorithms/kernel/svm/svm_train_boser_kernel.h"
+#include "algorithms/kernel/svm/svm_train_thunder_kernel.h"
+#include "algorithms/kernel/svm/oneapi/svm_train_thunder_kernel_oneapi.h"
 #include "algorithms/classifier/classifier_training_types.h"
 
 namespace daal
@@ -42,7 +44,17 @@ namespace interface2
 template <typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env * daalEnv)
 {
-    __DAAL_INITIALIZE_KERNELS(internal::SVMTrainImpl, method, svm::interface1::Parameter, algorithmFPType);
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu || method != thunder)
+    {
+        __DAAL_INITIALIZE_KERNELS(internal::SVMTrainImpl, method, svm::interface1::Parameter, algorithmFPType);
+    }
+    else
+    {
+        _kernel = new internal::SVMTrainThunderOneAPI<algorithmFPType, svm::interface2::Parameter>();
+    }
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -64,8 +76,20 @@ services::Status BatchContainer<algorithmFPType, method, cpu>::compute()
 
     svm::interface2::Parameter * par       = static_cast<svm::interface2::Parameter *>(_par);
     daal::services::Environment::env & env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface2::Parameter), compute, x, *y, r,
-                       par);
+
+    auto & context    = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & deviceInfo = context.getInfoDevice();
+
+    if (deviceInfo.isCpu || method != thunder)
+    {
+        __DAAL_CALL_KERNEL(env, internal::SVMTrainImpl, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType, svm::interface2::Parameter), compute,
+                           daal::services::internal::hostApp(*input), x, *y, r, par);
+    }
+    else
+    {
+        return ((internal::SVMTrainThunderOneAPI<algorithmFPType, svm::interface2::Parameter> *)(_kernel))
+            ->compute(daal::services::internal::hostApp(*input), x, *y, r, par);
+    }
 }
 } // namespace interface2
 } // namespace training
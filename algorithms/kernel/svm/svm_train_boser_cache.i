@@ -359,6 +359,243 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: the cache keeps a limited number of the rows of kernel matrix,
+ * the least recently used row is replaced when the requested row is not in the cache
+ */
+template <typename algorithmFPType, CpuType cpu>
+class SVMCache<lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    typedef SVMCacheImpl<algorithmFPType, cpu> super;
+    typedef SVMCache<lruCache, algorithmFPType, cpu> this_type;
+    using super::_cache;
+    using super::_kernel;
+    using super::_lineSize;
+    using super::_shrinkingRowIndices;
+    using super::_doShrinking;
+
+public:
+    DAAL_NEW_DELETE();
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] nLines        Number of the rows of kernel matrix kept in the cache
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    static SVMCache * create(size_t nLines, size_t lineSize, bool doShrinking, const NumericTablePtr & xTable,
+                             const kernel_function::KernelIfacePtr & kernel, Status & s)
+    {
+        s.clear();
+        this_type * res = new this_type(nLines, lineSize, doShrinking, xTable, kernel);
+        if (!res)
+            s.add(ErrorMemoryAllocationFailed);
+        else
+        {
+            s = res->init(xTable);
+            if (!s)
+            {
+                delete res;
+                res = nullptr;
+            }
+        }
+        return res;
+    }
+
+    virtual Status getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize, const algorithmFPType *& block) DAAL_C11_OVERRIDE
+    {
+        /* Single values, e.g. the diagonal of kernel matrix, are computed without caching the whole row */
+        if (blockSize == 1 && _lineIndex[getDataRowIndex(rowIndex)] < 0) return getValue(rowIndex, startColIndex, block);
+
+        const algorithmFPType * line = nullptr;
+        Status s                     = getLine(rowIndex, line);
+        block                        = line + startColIndex;
+        return s;
+    }
+
+    virtual Status getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize, const algorithmFPType *& block1,
+                                   const algorithmFPType *& block2) DAAL_C11_OVERRIDE
+    {
+        /* The first line becomes the most recently used one, so the cache with two or more lines does not replace it with the second one */
+        const algorithmFPType * line1 = nullptr;
+        const algorithmFPType * line2 = nullptr;
+        Status s                      = getLine(rowIndex1, line1);
+        if (s) s = getLine(rowIndex2, line2);
+        block1 = line1 + startColIndex;
+        block2 = line2 + startColIndex;
+        return s;
+    }
+
+    virtual Status updateShrinkingRowIndices(size_t nActiveVectors, const char * I) DAAL_C11_OVERRIDE;
+
+    using super::getDataRowIndex;
+
+    ~SVMCache() {}
+
+protected:
+    /**
+     * Constructs the cache that keeps the most recently used rows of kernel matrix
+     *
+     * \param[in] nLines        Number of the rows of kernel matrix kept in the cache
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     */
+    SVMCache(size_t nLines, size_t lineSize, bool doShrinking, const NumericTablePtr & xTable, const kernel_function::KernelIfacePtr & kernel)
+        : super(lineSize, doShrinking, kernel), _nLines(nLines), _head(-1), _tail(-1), _nUsedLines(0)
+    {}
+
+    Status init(const NumericTablePtr & xTable)
+    {
+        Status s = super::init();
+        if (!s) return s;
+        _cache.reset(_lineSize * _nLines);
+        _lineIndex.reset(_lineSize);
+        _lineDataRow.reset(_nLines);
+        _prev.reset(_nLines);
+        _next.reset(_nLines);
+        DAAL_CHECK_MALLOC(_cache.get() && _lineIndex.get() && _lineDataRow.get() && _prev.get() && _next.get());
+        if (_doShrinking)
+        {
+            _tmp.reset(_lineSize);
+            DAAL_CHECK_MALLOC(_tmp.get());
+        }
+        for (size_t i = 0; i < _lineSize; i++) _lineIndex[i] = -1;
+
+        _lineTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(NULL, 1, _lineSize, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _valueTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(&_value, 1, 1, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        _kernel->getInput()->set(kernel_function::X, xTable);
+        _kernel->getInput()->set(kernel_function::Y, xTable);
+
+        auto kfResultPtr = new kernel_function::Result();
+        DAAL_CHECK_MALLOC(kfResultPtr)
+        _kernelResult = kernel_function::ResultPtr(kfResultPtr);
+        _kernel->setResult(_kernelResult);
+        return s;
+    }
+
+    /* Computes one value of kernel matrix without caching the row */
+    Status getValue(size_t rowIndex, size_t colIndex, const algorithmFPType *& block)
+    {
+        _kernelResult->set(kernel_function::values, _valueTable);
+        _kernel->getParameter()->computationMode = kernel_function::vectorVector;
+        _kernel->getParameter()->rowIndexX       = getDataRowIndex(colIndex);
+        _kernel->getParameter()->rowIndexY       = getDataRowIndex(rowIndex);
+        _kernel->getParameter()->rowIndexResult  = 0;
+        block                                    = &_value;
+        return _kernel->computeNoThrow();
+    }
+
+    /* Returns the row of kernel matrix, the columns of the row follow the current order of the observations */
+    Status getLine(size_t rowIndex, const algorithmFPType *& line)
+    {
+        const size_t dataRowIndex = getDataRowIndex(rowIndex);
+        int iLine                 = _lineIndex[dataRowIndex];
+        if (iLine >= 0)
+        {
+            moveToHead(iLine);
+            line = _cache.get() + iLine * _lineSize;
+            return Status();
+        }
+
+        if (_nUsedLines < _nLines)
+        {
+            iLine = int(_nUsedLines++);
+        }
+        else
+        {
+            iLine = _tail;
+            if (_lineDataRow[iLine] < _lineSize) _lineIndex[_lineDataRow[iLine]] = -1;
+            unlink(iLine);
+        }
+        algorithmFPType * const cacheLine = _cache.get() + iLine * _lineSize;
+
+        /* Kernel function computes the row in the order of the input data, it is permuted if some observations were shrunk */
+        algorithmFPType * const kernelRow = _doShrinking ? _tmp.get() : cacheLine;
+        _lineTable->setArray(kernelRow, _lineSize);
+        _kernelResult->set(kernel_function::values, _lineTable);
+        _kernel->getParameter()->computationMode = kernel_function::matrixVector;
+        _kernel->getParameter()->rowIndexX       = 0;
+        _kernel->getParameter()->rowIndexY       = dataRowIndex;
+        _kernel->getParameter()->rowIndexResult  = 0;
+        Status s                                 = _kernel->computeNoThrow();
+        if (!s)
+        {
+            /* The line does not keep any row, it is the first one to be replaced */
+            _lineDataRow[iLine] = _lineSize;
+            pushTail(iLine);
+            return s;
+        }
+        if (_doShrinking)
+        {
+            for (size_t i = 0; i < _lineSize; i++) cacheLine[i] = kernelRow[_shrinkingRowIndices[i]];
+        }
+
+        _lineDataRow[iLine]      = dataRowIndex;
+        _lineIndex[dataRowIndex] = iLine;
+        pushHead(iLine);
+        line = cacheLine;
+        return s;
+    }
+
+    void unlink(int iLine)
+    {
+        if (_prev[iLine] >= 0)
+            _next[_prev[iLine]] = _next[iLine];
+        else
+            _head = _next[iLine];
+        if (_next[iLine] >= 0)
+            _prev[_next[iLine]] = _prev[iLine];
+        else
+            _tail = _prev[iLine];
+    }
+
+    void pushHead(int iLine)
+    {
+        _prev[iLine] = -1;
+        _next[iLine] = _head;
+        if (_head >= 0) _prev[_head] = iLine;
+        _head = iLine;
+        if (_tail < 0) _tail = iLine;
+    }
+
+    void pushTail(int iLine)
+    {
+        _next[iLine] = -1;
+        _prev[iLine] = _tail;
+        if (_tail >= 0) _next[_tail] = iLine;
+        _tail = iLine;
+        if (_head < 0) _head = iLine;
+    }
+
+    void moveToHead(int iLine)
+    {
+        if (iLine == _head) return;
+        unlink(iLine);
+        pushHead(iLine);
+    }
+
+protected:
+    const size_t _nLines;             /*!< Maximal number of the rows of kernel matrix kept in the cache */
+    TArray<int, cpu> _lineIndex;      /*!< Index of the cache line that keeps the row of kernel matrix or -1 */
+    TArray<size_t, cpu> _lineDataRow; /*!< Index of the input data row the cache line is computed for */
+    TArray<int, cpu> _prev;           /*!< Previous line in the list of the lines ordered by the time of the last use */
+    TArray<int, cpu> _next;           /*!< Next line in the list of the lines ordered by the time of the last use */
+    int _head;                        /*!< The most recently used line */
+    int _tail;                        /*!< The least recently used line */
+    size_t _nUsedLines;               /*!< Number of the lines taken from the storage */
+    TArray<algorithmFPType, cpu> _tmp;
+    algorithmFPType _value;
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _lineTable;
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _valueTable;
+    kernel_function::ResultPtr _kernelResult;
+};
+
 } // namespace internal
 
 } // namespace training
@@ -45,6 +45,8 @@
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "service/kernel/service_utils.h"
 #include "service/kernel/service_data_utils.h"
+#include "service/kernel/service_algo_utils.h"
+#include "algorithms/kernel/svm/svm_train_result_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -76,18 +78,19 @@ namespace training
 namespace internal
 {
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-services::Status SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu>::compute(const NumericTablePtr & xTable, NumericTable & yTable,
-                                                                                   daal::algorithms::Model * r, const ParameterType * svmPar)
+services::Status SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu>::compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable,
+                                                                                   NumericTable & yTable, daal::algorithms::Model * r,
+                                                                                   const ParameterType * svmPar)
 {
     SVMTrainTask<algorithmFPType, ParameterType, cpu> task(xTable->getNumberOfRows());
     Status s = task.setup(*svmPar, xTable, yTable);
     if (!s) return s;
-    s = task.compute(*svmPar);
+    s = task.compute(*svmPar, pHostApp);
     return s.ok() ? task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C) : s;
 }
 
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType & svmPar)
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType & svmPar, services::HostAppIface * pHostApp)
 {
     const algorithmFPType C(svmPar.C);
     const algorithmFPType eps(svmPar.accuracyThreshold);
@@ -106,6 +109,11 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const Paramete
             algorithmFPType delta, ma, Ma;
             if (!findMaximumViolatingPair(nActiveVectors, tau, Bi, Bj, delta, ma, Ma, curEps, s)) break;
             s = update(nActiveVectors, C, Bi, Bj, delta);
+            if ((iter + 1) % hostAppCheckStep == 0)
+            {
+                services::internal::reportProgress(pHostApp, iter + 1, curEps);
+                if (services::internal::isCancelled(s, pHostApp)) return s;
+            }
         }
         return s;
     }
@@ -126,6 +134,11 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const Paramete
             shrinkingIter = 0;
         }
         s = update(nActiveVectors, C, Bi, Bj, delta);
+        if ((iter + 1) % hostAppCheckStep == 0)
+        {
+            services::internal::reportProgress(pHostApp, iter + 1, curEps);
+            if (services::internal::isCancelled(s, pHostApp)) return s;
+        }
         if ((shrinkingIter % svmPar.shrinkingStep) == 0)
         {
             if ((!unshrink) && (curEps < 10.0 * eps))
@@ -150,265 +163,6 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::compute(const Paramete
     return s;
 }
 
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setResultsToModel(const NumericTable & xTable, Model & model, algorithmFPType C) const
-{
-    const algorithmFPType * alpha = _alpha.get();
-    const algorithmFPType zero(0.0);
-    size_t nSV = 0;
-    for (size_t i = 0; i < _nVectors; i++)
-    {
-        if (alpha[i] > zero) nSV++;
-    }
-
-    model.setNFeatures(xTable.getNumberOfColumns());
-    Status s;
-    DAAL_CHECK_STATUS(s, setSVCoefficients(nSV, model));
-    DAAL_CHECK_STATUS(s, setSVIndices(nSV, model));
-    if (xTable.getDataLayout() == NumericTableIface::csrArray)
-    {
-        DAAL_CHECK_STATUS(s, setSV_CSR(model, xTable, nSV));
-    }
-    else
-    {
-        DAAL_CHECK_STATUS(s, setSV_Dense(model, xTable, nSV));
-    }
-    /* Calculate bias and write it into model */
-    model.setBias(double(calculateBias(C)));
-    return s;
-}
-
-/**
- * \brief Write classification coefficients into resulting model
- *template <typename algorithmFPType, typename ParameterType, CpuType cpu>
- * \param[in]  nSV          Number of support vectors
- * \param[out] model        Resulting model
- */
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSVCoefficients(size_t nSV, Model & model) const
-{
-    const algorithmFPType zero(0.0);
-    NumericTablePtr svCoeffTable = model.getClassificationCoefficients();
-    Status s;
-    DAAL_CHECK_STATUS(s, svCoeffTable->resize(nSV));
-
-    WriteOnlyRows<algorithmFPType, cpu> mtSvCoeff(*svCoeffTable, 0, nSV);
-    DAAL_CHECK_BLOCK_STATUS(mtSvCoeff);
-    algorithmFPType * svCoeff     = mtSvCoeff.get();
-    const algorithmFPType * y     = _y.get();
-    const algorithmFPType * alpha = _alpha.get();
-
-    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
-    {
-        if (alpha[i] != zero)
-        {
-            svCoeff[iSV] = y[i] * alpha[i];
-            iSV++;
-        }
-    }
-    return s;
-}
-
-/**
- * \brief Write indices of the support vectors into resulting model
- *
- * \param[in]  nSV          Number of support vectors
- * \param[out] model        Resulting model
- */
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSVIndices(size_t nSV, Model & model) const
-{
-    NumericTablePtr svIndicesTable = model.getSupportIndices();
-    Status s;
-    DAAL_CHECK_STATUS(s, svIndicesTable->resize(nSV));
-
-    WriteOnlyRows<int, cpu> mtSvIndices(*svIndicesTable, 0, nSV);
-    DAAL_CHECK_BLOCK_STATUS(mtSvIndices);
-    int * svIndices = mtSvIndices.get();
-
-    const algorithmFPType zero(0.0);
-    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
-    {
-        if (_alpha[i] != zero)
-        {
-            DAAL_ASSERT(_cache->getDataRowIndex(i) <= services::internal::MaxVal<int>::get())
-            svIndices[iSV++] = (int)_cache->getDataRowIndex(i);
-        }
-    }
-    return s;
-}
-
-/**
- * \brief Write support vectors in dense format into resulting model
- *
- * \param[out] model        Resulting model
- * \param[in]  xTable       Input data set in dense layout
- * \param[in]  nSV          Number of support vectors
- */
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_Dense(Model & model, const NumericTable & xTable, size_t nSV) const
-{
-    const size_t nFeatures = xTable.getNumberOfColumns();
-    /* Allocate memory for support vectors and coefficients */
-    NumericTablePtr svTable = model.getSupportVectors();
-    Status s;
-    DAAL_CHECK_STATUS(s, svTable->resize(nSV));
-    if (nSV == 0) return s;
-
-    WriteOnlyRows<algorithmFPType, cpu> mtSv(*svTable, 0, nSV);
-    DAAL_CHECK_BLOCK_STATUS(mtSv);
-    algorithmFPType * sv = mtSv.get();
-
-    const algorithmFPType zero(0.0);
-    ReadRows<algorithmFPType, cpu> mtX;
-    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
-    {
-        if (_alpha[i] == zero) continue;
-        const size_t rowIndex = _cache->getDataRowIndex(i);
-        mtX.set(const_cast<NumericTable *>(&xTable), rowIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(mtX);
-        const algorithmFPType * xi = mtX.get();
-        for (size_t j = 0; j < nFeatures; j++)
-        {
-            sv[iSV * nFeatures + j] = xi[j];
-        }
-        iSV++;
-    }
-    return s;
-}
-
-/**
- * \brief Write support vectors in CSR format into resulting model
- *
- * \param[out] model        Resulting model
- * \param[in]  xTable       Input data set in CSR layout
- * \param[in]  nSV          Number of support vectors
- */
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_CSR(Model & model, const NumericTable & xTable, size_t nSV) const
-{
-    TArray<size_t, cpu> aSvRowOffsets(nSV + 1);
-    DAAL_CHECK_MALLOC(aSvRowOffsets.get());
-    size_t * svRowOffsetsBuffer = aSvRowOffsets.get();
-
-    CSRNumericTableIface * csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
-    ReadRowsCSR<algorithmFPType, cpu> mtX;
-
-    const algorithmFPType zero(0.0);
-    /* Calculate row offsets for the table that stores support vectors */
-    svRowOffsetsBuffer[0] = 1;
-    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
-    {
-        if (_alpha[i] > zero)
-        {
-            const size_t rowIndex = _cache->getDataRowIndex(i);
-            mtX.set(csrIface, rowIndex, 1);
-            DAAL_CHECK_BLOCK_STATUS(mtX);
-            svRowOffsetsBuffer[iSV + 1] = svRowOffsetsBuffer[iSV] + (mtX.rows()[1] - mtX.rows()[0]);
-            iSV++;
-        }
-    }
-
-    Status s;
-    /* Allocate memory for storing support vectors and coefficients */
-    CSRNumericTablePtr svTable = services::staticPointerCast<CSRNumericTable, NumericTable>(model.getSupportVectors());
-    DAAL_CHECK_STATUS(s, svTable->resize(nSV));
-    if (nSV == 0) return s;
-
-    const size_t svDataSize = svRowOffsetsBuffer[nSV] - svRowOffsetsBuffer[0];
-    DAAL_CHECK_STATUS(s, svTable->allocateDataMemory(svDataSize));
-
-    /* Copy row offsets into the table */
-    size_t * svRowOffsets = nullptr;
-    svTable->getArrays<algorithmFPType>(NULL, NULL, &svRowOffsets);
-    for (size_t i = 0; i < nSV + 1; i++)
-    {
-        svRowOffsets[i] = svRowOffsetsBuffer[i];
-    }
-
-    WriteOnlyRowsCSR<algorithmFPType, cpu> mtSv(*svTable, 0, nSV);
-    DAAL_CHECK_BLOCK_STATUS(mtSv);
-    algorithmFPType * sv  = mtSv.values();
-    size_t * svColIndices = mtSv.cols();
-
-    for (size_t i = 0, iSV = 0, svOffset = 0; i < _nVectors; i++)
-    {
-        if (_alpha[i] == zero) continue;
-        const size_t rowIndex = _cache->getDataRowIndex(i);
-        mtX.set(csrIface, rowIndex, 1);
-        DAAL_CHECK_BLOCK_STATUS(mtX);
-        const algorithmFPType * xi       = mtX.values();
-        const size_t * xiColIndices      = mtX.cols();
-        const size_t nNonZeroValuesInRow = mtX.rows()[1] - mtX.rows()[0];
-        for (size_t j = 0; j < nNonZeroValuesInRow; j++, svOffset++)
-        {
-            sv[svOffset]           = xi[j];
-            svColIndices[svOffset] = xiColIndices[j];
-        }
-        iSV++;
-    }
-    return s;
-}
-
-/**
- * \brief Calculate SVM model bias
- *
- * \param[in]  C        Upper bound in constraints of the quadratic optimization problem
- * \return Bias for the SVM model
- */
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-algorithmFPType SVMTrainTask<algorithmFPType, ParameterType, cpu>::calculateBias(algorithmFPType C) const
-{
-    algorithmFPType bias;
-    const algorithmFPType zero(0.0);
-    const algorithmFPType one(1.0);
-    size_t num_yg          = 0;
-    algorithmFPType sum_yg = 0.0;
-
-    const algorithmFPType fpMax   = MaxVal<algorithmFPType>::get();
-    algorithmFPType ub            = -(fpMax);
-    algorithmFPType lb            = fpMax;
-    const algorithmFPType * alpha = _alpha.get();
-    const algorithmFPType * y     = _y.get();
-    const algorithmFPType * grad  = _grad.get();
-    for (size_t i = 0; i < _nVectors; i++)
-    {
-        const algorithmFPType yg = -y[i] * grad[i];
-        if (y[i] == -one && alpha[i] == C)
-        {
-            ub = ((ub > yg) ? ub : yg);
-        } /// SVM_MAX(ub, yg);
-        else if (y[i] == one && alpha[i] == C)
-        {
-            lb = ((lb < yg) ? lb : yg);
-        } /// SVM_MIN(lb, yg);
-        else if (y[i] == one && alpha[i] == zero)
-        {
-            ub = ((ub > yg) ? ub : yg);
-        } /// SVM_MAX(ub, yg);
-        else if (y[i] == -one && alpha[i] == zero)
-        {
-            lb = ((lb < yg) ? lb : yg);
-        } /// SVM_MIN(lb, yg);
-        else
-        {
-            sum_yg += yg;
-            num_yg++;
-        }
-    }
-
-    if (num_yg == 0)
-    {
-        bias = 0.5 * (ub + lb);
-    }
-    else
-    {
-        bias = sum_yg / (algorithmFPType)num_yg;
-    }
-
-    return bias;
-}
-
 /**
  * \brief Working set selection (WSS3) function.
  *        Select an index i from a pair of indices B = {i, j} using WSS 3 algorithm from [1].
@@ -824,13 +578,24 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterT
     _kernelDiag.reset(_nVectors);
     DAAL_CHECK_MALLOC(_alpha.get() && _I.get() && _y.get() && _grad.get() && _kernelDiag.get());
 
+    /* The kernel function is called on the same training data until the end of training,
+       so it keeps the data it caches, e.g. the squared norms of the rows, while the clone lives */
     kernel_function::KernelIfacePtr kernel = svmPar.kernel->clone();
-    size_t cacheSize                       = svmPar.cacheSize;
+    DAAL_CHECK_MALLOC(kernel);
+    services::internal::setCachedDataReuse(true, *kernel->getInput());
+
+    size_t cacheSize         = svmPar.cacheSize;
+    const size_t nCacheLines = cacheSize / (_nVectors * sizeof(algorithmFPType));
     Status s;
     if (cacheSize >= _nVectors * _nVectors * sizeof(algorithmFPType))
     {
         _cache = SVMCache<simpleCache, algorithmFPType, cpu>::create(_nVectors, svmPar.doShrinking, xTable, kernel, s);
     }
+    else if (nCacheLines >= 2)
+    {
+        /* Two lines are needed to keep both rows of the working set */
+        _cache = SVMCache<lruCache, algorithmFPType, cpu>::create(nCacheLines, _nVectors, svmPar.doShrinking, xTable, kernel, s);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -845,12 +610,6 @@ Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterT
     return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
 }
 
-template <typename algorithmFPType, typename ParameterType, CpuType cpu>
-SVMTrainTask<algorithmFPType, ParameterType, cpu>::~SVMTrainTask()
-{
-    delete _cache;
-}
-
 /**
  * \brief Initialize the intermediate data used in SVM training
  *
@@ -937,6 +696,38 @@ Status SVMCache<noCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t
     return Status();
 }
 
+/**
+ * \brief Move the indices of the shrunk feature vector to the end of the array and
+ *        re-order the columns of the cached rows accordingly
+ *
+ * \param[in] nActiveVectors Number of observations in a training data set that are used
+ *                           in sequential minimum optimization at the current iteration
+ * \param[in] I              Array of flags that describe the status of feature vectors
+ * \return                   Status of the call
+ */
+template <typename algorithmFPType, CpuType cpu>
+Status SVMCache<lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t nActiveVectors, const char * I)
+{
+    size_t i = 0;
+    size_t j = nActiveVectors - 1;
+    while (i < j)
+    {
+        while (!(I[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ((I[j] & shrink) && j > 0) j--;
+        if (i >= j) break;
+        daal::services::internal::swap<cpu, size_t>(_shrinkingRowIndices[i], _shrinkingRowIndices[j]);
+
+        /* The lines are found by the index of the input data row, so only the columns are swapped */
+        for (size_t k = 0; k < _nUsedLines; k++)
+        {
+            daal::services::internal::swap<cpu, algorithmFPType>(_cache[i + k * _lineSize], _cache[j + k * _lineSize]);
+        }
+        i++;
+        j--;
+    }
+    return Status();
+}
+
 /**
  * \brief Move the indices of the shrunk feature vector to the end of the array and
  *        re-order rows and columns in the cache accordingly
@@ -49,7 +49,8 @@ namespace internal
 template <typename algorithmFPType, typename ParameterType, CpuType cpu>
 struct SVMTrainImpl<boser, algorithmFPType, ParameterType, cpu> : public Kernel
 {
-    services::Status compute(const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r, const ParameterType * par);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r,
+                             const ParameterType * par);
 };
 
 } // namespace internal
@@ -30,6 +30,7 @@
 #include "algorithms/svm/svm_train_types.h"
 #include "algorithms/kernel/kernel.h"
 #include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_algo_utils.h"
 
 using namespace daal::data_management;
 using namespace daal::internal;
@@ -59,13 +60,14 @@ template <typename algorithmFPType, typename ParameterType, CpuType cpu>
 struct SVMTrainTask
 {
     static const size_t kernelFunctionBlockSize = 1024; /* Size of the block of kernel function elements */
+    static const size_t hostAppCheckStep        = 1024; /* Number of SMO iterations between the cancellation checks */
 
     SVMTrainTask(size_t nVectors) : _cache(nullptr), _nVectors(nVectors) {}
 
     Status setup(const ParameterType & svmPar, const NumericTablePtr & xTable, NumericTable & yTable);
 
     /* Perform Sequential Minimum Optimization (SMO) algorithm to find optimal coefficients alpha */
-    Status compute(const ParameterType & svmPar);
+    Status compute(const ParameterType & svmPar, services::HostAppIface * pHostApp);
 
     /* Write support vectors and classification coefficients into model */
     Status setResultsToModel(const NumericTable & xTable, Model & model, algorithmFPType C) const;
@@ -112,6 +114,9 @@ protected:
 
     inline void updateAlpha(algorithmFPType C, int Bi, int Bj, algorithmFPType delta, algorithmFPType & newDeltai, algorithmFPType & newDeltaj);
 
+    /* Index of the input data row that corresponds to the i-th element of the arrays reordered by shrinking */
+    size_t getDataRowIndex(size_t i) const { return _cache ? _cache->getDataRowIndex(i) : i; }
+
 protected:
     const size_t _nVectors;                       //Number of observations in the input data set
     TArray<algorithmFPType, cpu> _y;              //Array of class labels
@@ -125,7 +130,8 @@ protected:
 template <Method method, typename algorithmFPType, typename ParameterType, CpuType cpu>
 struct SVMTrainImpl : public Kernel
 {
-    services::Status compute(const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r, const ParameterType * par);
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r,
+                             const ParameterType * par);
 };
 
 } // namespace internal
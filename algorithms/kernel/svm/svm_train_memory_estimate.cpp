@@ -0,0 +1,77 @@
+/* file: svm_train_memory_estimate.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Estimate of the memory allocated by the SVM training in the batch processing mode
+//--
+*/
+
+#include "algorithms/svm/svm_train.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+/* Maximal number of observations in the working set of the thunder method, see svm_train_thunder_kernel.h */
+const size_t maxWorkingSetSize = 1024;
+/* Number of values of the kernel matrix computed at once when the cache is too small to keep two rows, see svm_train_kernel.h */
+const size_t kernelBlockSize = 1024;
+
+size_t estimateMemorySize(size_t nRows, size_t nFeatures, const Parameter & parameter, int method, size_t fpSize)
+{
+    /* Support vectors, their indices and coefficients and the bias in the model */
+    size_t size = nRows * (nFeatures * fpSize + fpSize + sizeof(int)) + fpSize;
+
+    if (method == thunder)
+    {
+        size_t nWS = (nRows < 2) ? nRows : 2;
+        while (2 * nWS <= nRows && 2 * nWS <= maxWorkingSetSize) nWS *= 2;
+
+        /* Coefficients, labels, gradients and sorting buffers of the observations */
+        size += nRows * (6 * fpSize + sizeof(int) + 1);
+
+        /* Rows of the kernel matrix and the observations of the working set */
+        size += nWS * nRows * fpSize + nWS * (nWS + nFeatures + 4) * fpSize;
+    }
+    else
+    {
+        /* Coefficients, labels, gradients, diagonal of the kernel matrix and the flags of the observations */
+        size += nRows * (4 * fpSize + 1);
+
+        /* Cache of the kernel matrix: the full matrix if it fits the cache, otherwise the rows that fit it */
+        const size_t matrixSize = nRows * nRows * fpSize;
+        const size_t rowSize    = nRows * fpSize;
+        if (parameter.cacheSize >= matrixSize) size += matrixSize;
+        else if (rowSize && parameter.cacheSize / rowSize >= 2) size += (parameter.cacheSize / rowSize) * rowSize;
+        else size += kernelBlockSize * fpSize;
+    }
+
+    return size;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,318 @@
+/* file: svm_train_result_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions of SVM training task that are common for all training methods:
+//  writing of the support vectors, classification coefficients and bias into the model
+//--
+*/
+
+#ifndef __SVM_TRAIN_RESULT_IMPL_I__
+#define __SVM_TRAIN_RESULT_IMPL_I__
+
+#include "externals/service_memory.h"
+#include "service/kernel/data_management/service_micro_table.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_utils.h"
+#include "service/kernel/service_data_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+SVMTrainTask<algorithmFPType, ParameterType, cpu>::~SVMTrainTask()
+{
+    delete _cache;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setResultsToModel(const NumericTable & xTable, Model & model, algorithmFPType C) const
+{
+    const algorithmFPType * alpha = _alpha.get();
+    const algorithmFPType zero(0.0);
+    size_t nSV = 0;
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        if (alpha[i] > zero) nSV++;
+    }
+
+    model.setNFeatures(xTable.getNumberOfColumns());
+    Status s;
+    DAAL_CHECK_STATUS(s, setSVCoefficients(nSV, model));
+    DAAL_CHECK_STATUS(s, setSVIndices(nSV, model));
+    if (xTable.getDataLayout() == NumericTableIface::csrArray)
+    {
+        DAAL_CHECK_STATUS(s, setSV_CSR(model, xTable, nSV));
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, setSV_Dense(model, xTable, nSV));
+    }
+    /* Calculate bias and write it into model */
+    model.setBias(double(calculateBias(C)));
+    return s;
+}
+
+/**
+ * \brief Write classification coefficients into resulting model
+ *template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+ * \param[in]  nSV          Number of support vectors
+ * \param[out] model        Resulting model
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSVCoefficients(size_t nSV, Model & model) const
+{
+    const algorithmFPType zero(0.0);
+    NumericTablePtr svCoeffTable = model.getClassificationCoefficients();
+    Status s;
+    DAAL_CHECK_STATUS(s, svCoeffTable->resize(nSV));
+
+    WriteOnlyRows<algorithmFPType, cpu> mtSvCoeff(*svCoeffTable, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSvCoeff);
+    algorithmFPType * svCoeff     = mtSvCoeff.get();
+    const algorithmFPType * y     = _y.get();
+    const algorithmFPType * alpha = _alpha.get();
+
+    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
+    {
+        if (alpha[i] != zero)
+        {
+            svCoeff[iSV] = y[i] * alpha[i];
+            iSV++;
+        }
+    }
+    return s;
+}
+
+/**
+ * \brief Write indices of the support vectors into resulting model
+ *
+ * \param[in]  nSV          Number of support vectors
+ * \param[out] model        Resulting model
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSVIndices(size_t nSV, Model & model) const
+{
+    NumericTablePtr svIndicesTable = model.getSupportIndices();
+    Status s;
+    DAAL_CHECK_STATUS(s, svIndicesTable->resize(nSV));
+
+    WriteOnlyRows<int, cpu> mtSvIndices(*svIndicesTable, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSvIndices);
+    int * svIndices = mtSvIndices.get();
+
+    const algorithmFPType zero(0.0);
+    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
+    {
+        if (_alpha[i] != zero)
+        {
+            DAAL_ASSERT(getDataRowIndex(i) <= services::internal::MaxVal<int>::get())
+            svIndices[iSV++] = (int)getDataRowIndex(i);
+        }
+    }
+    return s;
+}
+
+/**
+ * \brief Write support vectors in dense format into resulting model
+ *
+ * \param[out] model        Resulting model
+ * \param[in]  xTable       Input data set in dense layout
+ * \param[in]  nSV          Number of support vectors
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_Dense(Model & model, const NumericTable & xTable, size_t nSV) const
+{
+    const size_t nFeatures = xTable.getNumberOfColumns();
+    /* Allocate memory for support vectors and coefficients */
+    NumericTablePtr svTable = model.getSupportVectors();
+    Status s;
+    DAAL_CHECK_STATUS(s, svTable->resize(nSV));
+    if (nSV == 0) return s;
+
+    WriteOnlyRows<algorithmFPType, cpu> mtSv(*svTable, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSv);
+    algorithmFPType * sv = mtSv.get();
+
+    const algorithmFPType zero(0.0);
+    ReadRows<algorithmFPType, cpu> mtX;
+    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
+    {
+        if (_alpha[i] == zero) continue;
+        const size_t rowIndex = getDataRowIndex(i);
+        mtX.set(const_cast<NumericTable *>(&xTable), rowIndex, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType * xi = mtX.get();
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sv[iSV * nFeatures + j] = xi[j];
+        }
+        iSV++;
+    }
+    return s;
+}
+
+/**
+ * \brief Write support vectors in CSR format into resulting model
+ *
+ * \param[out] model        Resulting model
+ * \param[in]  xTable       Input data set in CSR layout
+ * \param[in]  nSV          Number of support vectors
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainTask<algorithmFPType, ParameterType, cpu>::setSV_CSR(Model & model, const NumericTable & xTable, size_t nSV) const
+{
+    TArray<size_t, cpu> aSvRowOffsets(nSV + 1);
+    DAAL_CHECK_MALLOC(aSvRowOffsets.get());
+    size_t * svRowOffsetsBuffer = aSvRowOffsets.get();
+
+    CSRNumericTableIface * csrIface = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(&xTable));
+    ReadRowsCSR<algorithmFPType, cpu> mtX;
+
+    const algorithmFPType zero(0.0);
+    /* Calculate row offsets for the table that stores support vectors */
+    svRowOffsetsBuffer[0] = 1;
+    for (size_t i = 0, iSV = 0; i < _nVectors; i++)
+    {
+        if (_alpha[i] > zero)
+        {
+            const size_t rowIndex = getDataRowIndex(i);
+            mtX.set(csrIface, rowIndex, 1);
+            DAAL_CHECK_BLOCK_STATUS(mtX);
+            svRowOffsetsBuffer[iSV + 1] = svRowOffsetsBuffer[iSV] + (mtX.rows()[1] - mtX.rows()[0]);
+            iSV++;
+        }
+    }
+
+    Status s;
+    /* Allocate memory for storing support vectors and coefficients */
+    CSRNumericTablePtr svTable = services::staticPointerCast<CSRNumericTable, NumericTable>(model.getSupportVectors());
+    DAAL_CHECK_STATUS(s, svTable->resize(nSV));
+    if (nSV == 0) return s;
+
+    const size_t svDataSize = svRowOffsetsBuffer[nSV] - svRowOffsetsBuffer[0];
+    DAAL_CHECK_STATUS(s, svTable->allocateDataMemory(svDataSize));
+
+    /* Copy row offsets into the table */
+    size_t * svRowOffsets = nullptr;
+    svTable->getArrays<algorithmFPType>(NULL, NULL, &svRowOffsets);
+    for (size_t i = 0; i < nSV + 1; i++)
+    {
+        svRowOffsets[i] = svRowOffsetsBuffer[i];
+    }
+
+    WriteOnlyRowsCSR<algorithmFPType, cpu> mtSv(*svTable, 0, nSV);
+    DAAL_CHECK_BLOCK_STATUS(mtSv);
+    algorithmFPType * sv  = mtSv.values();
+    size_t * svColIndices = mtSv.cols();
+
+    for (size_t i = 0, iSV = 0, svOffset = 0; i < _nVectors; i++)
+    {
+        if (_alpha[i] == zero) continue;
+        const size_t rowIndex = getDataRowIndex(i);
+        mtX.set(csrIface, rowIndex, 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType * xi       = mtX.values();
+        const size_t * xiColIndices      = mtX.cols();
+        const size_t nNonZeroValuesInRow = mtX.rows()[1] - mtX.rows()[0];
+        for (size_t j = 0; j < nNonZeroValuesInRow; j++, svOffset++)
+        {
+            sv[svOffset]           = xi[j];
+            svColIndices[svOffset] = xiColIndices[j];
+        }
+        iSV++;
+    }
+    return s;
+}
+
+/**
+ * \brief Calculate SVM model bias
+ *
+ * \param[in]  C        Upper bound in constraints of the quadratic optimization problem
+ * \return Bias for the SVM model
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+algorithmFPType SVMTrainTask<algorithmFPType, ParameterType, cpu>::calculateBias(algorithmFPType C) const
+{
+    algorithmFPType bias;
+    const algorithmFPType zero(0.0);
+    const algorithmFPType one(1.0);
+    size_t num_yg          = 0;
+    algorithmFPType sum_yg = 0.0;
+
+    const algorithmFPType fpMax   = MaxVal<algorithmFPType>::get();
+    algorithmFPType ub            = -(fpMax);
+    algorithmFPType lb            = fpMax;
+    const algorithmFPType * alpha = _alpha.get();
+    const algorithmFPType * y     = _y.get();
+    const algorithmFPType * grad  = _grad.get();
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        const algorithmFPType yg = -y[i] * grad[i];
+        if (y[i] == -one && alpha[i] == C)
+        {
+            ub = ((ub > yg) ? ub : yg);
+        } /// SVM_MAX(ub, yg);
+        else if (y[i] == one && alpha[i] == C)
+        {
+            lb = ((lb < yg) ? lb : yg);
+        } /// SVM_MIN(lb, yg);
+        else if (y[i] == one && alpha[i] == zero)
+        {
+            ub = ((ub > yg) ? ub : yg);
+        } /// SVM_MAX(ub, yg);
+        else if (y[i] == -one && alpha[i] == zero)
+        {
+            lb = ((lb < yg) ? lb : yg);
+        } /// SVM_MIN(lb, yg);
+        else
+        {
+            sum_yg += yg;
+            num_yg++;
+        }
+    }
+
+    if (num_yg == 0)
+    {
+        bias = 0.5 * (ub + lb);
+    }
+    else
+    {
+        bias = sum_yg / (algorithmFPType)num_yg;
+    }
+
+    return bias;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,529 @@
+/* file: svm_train_thunder_impl.i */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  SVM training algorithm implementation using the thunder method
+//--
+*/
+/*
+//  DESCRIPTION
+//
+//  Definition of the functions for training with SVM 2-class classifier.
+//  The working set of up to maxWorkingSetSize observations is selected from the most violating ones,
+//  half of the working set is kept between the iterations. The rows of kernel matrix for the working set
+//  are computed by one call of the kernel function, the sub-problem is solved by SMO with the second order
+//  working set selection from [1] and the gradient is updated with a matrix-vector product.
+//
+//  REFERENCES
+//
+//  1. Rong-En Fan, Pai-Hsuen Chen, Chih-Jen Lin,
+//     Working Set Selection Using Second Order Information
+//     for Training Support Vector Machines,
+//     Journal of Machine Learning Research 6 (2005), pp. 1889___1918
+//  2. Zeyi Wen, Jiashuai Shi, Qinbin Li, Bingsheng He, Jian Chen,
+//     ThunderSVM: A Fast SVM Library on GPUs and CPUs,
+//     Journal of Machine Learning Research, 19 (2018), pp. 1-5
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_IMPL_I__
+#define __SVM_TRAIN_THUNDER_IMPL_I__
+
+#include "externals/service_memory.h"
+#include "externals/service_blas.h"
+#include "service/kernel/data_management/service_micro_table.h"
+#include "service/kernel/data_management/service_numeric_table.h"
+#include "service/kernel/service_utils.h"
+#include "service/kernel/service_data_utils.h"
+#include "service/kernel/service_algo_utils.h"
+#include "algorithms/kernel/service_sort.h"
+#include "algorithms/kernel/svm/svm_train_result_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+services::Status SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu>::compute(services::HostAppIface * pHostApp,
+                                                                                     const NumericTablePtr & xTable, NumericTable & yTable,
+                                                                                     daal::algorithms::Model * r, const ParameterType * svmPar)
+{
+    SVMTrainThunderTask<algorithmFPType, ParameterType, cpu> task(xTable->getNumberOfRows());
+    Status s = task.setup(*svmPar, xTable, yTable);
+    if (!s) return s;
+    s = task.compute(*svmPar, xTable, pHostApp);
+    return s.ok() ? task.setResultsToModel(*xTable, *static_cast<Model *>(r), svmPar->C) : s;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::setup(const ParameterType & svmPar, const NumericTablePtr & xTable,
+                                                                       NumericTable & yTable)
+{
+    /* The working set size is the largest power of 2 that does not exceed the number of observations and maxWorkingSetSize */
+    _nWSMax = (_nVectors < 2 ? _nVectors : 2);
+    while (2 * _nWSMax <= _nVectors && 2 * _nWSMax <= maxWorkingSetSize) _nWSMax *= 2;
+
+    _alpha.reset(_nVectors);
+    _y.reset(_nVectors);
+    _grad.reset(_nVectors);
+    _inWS.reset(_nVectors);
+    _sortedValues.reset(_nVectors);
+    _sortedIndices.reset(_nVectors);
+    _gradDelta.reset(_nVectors);
+    DAAL_CHECK_MALLOC(_alpha.get() && _y.get() && _grad.get() && _inWS.get() && _sortedValues.get() && _sortedIndices.get() && _gradDelta.get());
+
+    _ws.reset(_nWSMax);
+    _wsPrev.reset(_nWSMax);
+    _kernelBlock.reset(_nWSMax * _nVectors);
+    _kernelWS.reset(_nWSMax * _nWSMax);
+    _alphaWS.reset(_nWSMax);
+    _gradWS.reset(_nWSMax);
+    _deltaWS.reset(_nWSMax);
+    DAAL_CHECK_MALLOC(_ws.get() && _wsPrev.get() && _kernelBlock.get() && _kernelWS.get() && _alphaWS.get() && _gradWS.get() && _deltaWS.get());
+
+    if (xTable->getDataLayout() != NumericTableIface::csrArray)
+    {
+        _xWS.reset(_nWSMax * xTable->getNumberOfColumns());
+        DAAL_CHECK_MALLOC(_xWS.get());
+    }
+    else
+    {
+        _xWSRowOffsets.reset(_nWSMax + 1);
+        DAAL_CHECK_MALLOC(_xWSRowOffsets.get());
+    }
+
+    daal::services::internal::service_memset<algorithmFPType, cpu>(_alpha.get(), algorithmFPType(0.0), _nVectors);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(_grad.get(), algorithmFPType(-1.0), _nVectors);
+    /* The kernel function is called on the same training data until the end of training,
+       so it keeps the data it caches, e.g. the squared norms of the rows, while the clone lives */
+    _kernel = svmPar.kernel->clone();
+    DAAL_CHECK_MALLOC(_kernel);
+    services::internal::setCachedDataReuse(true, *_kernel->getInput());
+
+    ReadColumns<algorithmFPType, cpu> mtY(yTable, 0, 0, _nVectors);
+    DAAL_CHECK_BLOCK_STATUS(mtY);
+    int result =
+        daal::services::internal::daal_memcpy_s(_y.get(), _nVectors * sizeof(algorithmFPType), mtY.get(), _nVectors * sizeof(algorithmFPType));
+    return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::compute(const ParameterType & svmPar, const NumericTablePtr & xTable,
+                                                                        services::HostAppIface * pHostApp)
+{
+    const algorithmFPType C(svmPar.C);
+    const algorithmFPType eps(svmPar.accuracyThreshold);
+    const algorithmFPType tau(svmPar.tau);
+    /* Every sub-problem is solved with the accuracy that depends on the duality gap of the whole problem */
+    const algorithmFPType innerAccuracyFactor(0.1);
+    const size_t maxInnerIterations = 100 * _nWSMax;
+
+    Status s;
+    for (size_t iter = 0; iter < svmPar.maxIterations;)
+    {
+        const algorithmFPType diff = selectWorkingSet(C);
+        if (diff < eps || _nWS < 2) break;
+
+        services::internal::reportProgress(pHostApp, iter, diff);
+        if (services::internal::isCancelled(s, pHostApp)) break;
+
+        DAAL_CHECK_STATUS(s, computeKernelBlock(xTable));
+
+        const algorithmFPType innerEps = (innerAccuracyFactor * diff > eps ? innerAccuracyFactor * diff : eps);
+        const size_t nIterationsLeft   = svmPar.maxIterations - iter;
+        const size_t nInnerIterations =
+            solveWorkingSet(C, innerEps, tau, (maxInnerIterations < nIterationsLeft ? maxInnerIterations : nIterationsLeft));
+        if (nInnerIterations == 0) break;
+        iter += nInnerIterations;
+
+        DAAL_CHECK_STATUS(s, updateGradient());
+    }
+    return s;
+}
+
+/**
+ * \brief Select the working set: the observations from I_UP(alpha) with the largest values of -y[i]*grad[i]
+ *        and the observations from I_LOW(alpha) with the smallest ones are added in turn,
+ *        the rest of the working set is filled with the observations selected at the previous iteration
+ *
+ * \param[in] C     Upper bound in constraints of the quadratic optimization problem
+ * \return The difference m(alpha) - M(alpha) for the whole problem
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+algorithmFPType SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::selectWorkingSet(algorithmFPType C)
+{
+    const algorithmFPType * y     = _y.get();
+    const algorithmFPType * grad  = _grad.get();
+    const algorithmFPType * alpha = _alpha.get();
+    algorithmFPType * values      = _sortedValues.get();
+    int * indices                 = _sortedIndices.get();
+    char * inWS                   = _inWS.get();
+    int * ws                      = _ws.get();
+
+    for (size_t i = 0; i < _nVectors; i++)
+    {
+        values[i]  = -y[i] * grad[i];
+        indices[i] = int(i);
+        inWS[i]    = 0;
+    }
+    daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(_nVectors, values, indices);
+
+    const algorithmFPType fpMax = MaxVal<algorithmFPType>::get();
+    algorithmFPType GMax        = -fpMax;
+    algorithmFPType GMin        = fpMax;
+    for (size_t k = _nVectors; k > 0; k--)
+    {
+        const int i = indices[k - 1];
+        if (isUpper(alpha[i], y[i], C))
+        {
+            GMax = values[k - 1];
+            break;
+        }
+    }
+    for (size_t k = 0; k < _nVectors; k++)
+    {
+        const int i = indices[k];
+        if (isLower(alpha[i], y[i], C))
+        {
+            GMin = values[k];
+            break;
+        }
+    }
+
+    const size_t nSelect = (_nWSPrev ? _nWSMax / 2 : _nWSMax);
+    size_t nSelected     = 0;
+    size_t kUp           = _nVectors;
+    size_t kLow          = 0;
+    while (nSelected < nSelect && (kUp > 0 || kLow < _nVectors))
+    {
+        for (; kUp > 0; kUp--)
+        {
+            const int i = indices[kUp - 1];
+            if (!inWS[i] && isUpper(alpha[i], y[i], C))
+            {
+                inWS[i]         = 1;
+                ws[nSelected++] = i;
+                kUp--;
+                break;
+            }
+        }
+        if (nSelected == nSelect) break;
+        for (; kLow < _nVectors; kLow++)
+        {
+            const int i = indices[kLow];
+            if (!inWS[i] && isLower(alpha[i], y[i], C))
+            {
+                inWS[i]         = 1;
+                ws[nSelected++] = i;
+                kLow++;
+                break;
+            }
+        }
+    }
+
+    /* The observations from the previous working set are taken in the order they were added to it */
+    const int * wsPrev = _wsPrev.get();
+    for (size_t k = 0; k < _nWSPrev && nSelected < _nWSMax; k++)
+    {
+        const int i = wsPrev[k];
+        if (inWS[i]) continue;
+        inWS[i]         = 1;
+        ws[nSelected++] = i;
+    }
+
+    _nWS     = nSelected;
+    _nWSPrev = nSelected;
+    for (size_t k = 0; k < nSelected; k++) _wsPrev[k] = ws[k];
+    return GMax - GMin;
+}
+
+/**
+ * \brief Compute the rows of kernel matrix for the observations in the working set
+ *
+ * \param[in] xTable        Input data set
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::computeKernelBlock(const NumericTablePtr & xTable)
+{
+    Status s;
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    NumericTablePtr wsTable;
+    if (xTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        DAAL_CHECK_STATUS(s, copyWorkingSetRowsCSR(xTable));
+        wsTable = CSRNumericTable::create(_xWS.get(), _xWSColIndices.get(), _xWSRowOffsets.get(), nFeatures, _nWS, CSRNumericTable::oneBased, &s);
+    }
+    else
+    {
+        DAAL_CHECK_STATUS(s, copyWorkingSetRowsDense(xTable));
+        wsTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_xWS.get(), nFeatures, _nWS, &s);
+    }
+    DAAL_CHECK_STATUS_VAR(s);
+
+    NumericTablePtr blockTable = HomogenNumericTableCPU<algorithmFPType, cpu>::create(_kernelBlock.get(), _nVectors, _nWS, &s);
+    DAAL_CHECK_STATUS_VAR(s);
+
+    _kernel->getParameter()->computationMode = kernel_function::matrixMatrix;
+    _kernel->getParameter()->rowIndexX       = 0;
+    _kernel->getParameter()->rowIndexY       = 0;
+    _kernel->getParameter()->rowIndexResult  = 0;
+    _kernel->getInput()->set(kernel_function::X, wsTable);
+    _kernel->getInput()->set(kernel_function::Y, xTable);
+
+    auto kfResultPtr = new kernel_function::Result();
+    DAAL_CHECK_MALLOC(kfResultPtr)
+    kernel_function::ResultPtr shRes(kfResultPtr);
+    shRes->set(kernel_function::values, blockTable);
+    _kernel->setResult(shRes);
+    DAAL_CHECK_STATUS(s, _kernel->computeNoThrow());
+
+    const algorithmFPType * kernelBlock = _kernelBlock.get();
+    algorithmFPType * kernelWS          = _kernelWS.get();
+    const int * ws                      = _ws.get();
+    for (size_t i = 0; i < _nWS; i++)
+    {
+        for (size_t j = 0; j < _nWS; j++) kernelWS[i * _nWS + j] = kernelBlock[i * _nVectors + ws[j]];
+    }
+    return s;
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::copyWorkingSetRowsDense(const NumericTablePtr & xTable)
+{
+    const size_t nFeatures = xTable->getNumberOfColumns();
+    const size_t rowSize   = nFeatures * sizeof(algorithmFPType);
+    ReadRows<algorithmFPType, cpu> mtX;
+    int result = 0;
+    for (size_t i = 0; i < _nWS; i++)
+    {
+        mtX.set(xTable.get(), _ws[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        result |= daal::services::internal::daal_memcpy_s(_xWS.get() + i * nFeatures, rowSize, mtX.get(), rowSize);
+    }
+    return (!result) ? Status() : Status(ErrorMemoryCopyFailedInternal);
+}
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::copyWorkingSetRowsCSR(const NumericTablePtr & xTable)
+{
+    CSRNumericTableIface * csrIface = dynamic_cast<CSRNumericTableIface *>(xTable.get());
+    DAAL_CHECK(csrIface, ErrorIncorrectTypeOfInputNumericTable);
+    ReadRowsCSR<algorithmFPType, cpu> mtX;
+
+    size_t * rowOffsets = _xWSRowOffsets.get();
+    rowOffsets[0]       = 1;
+    for (size_t i = 0; i < _nWS; i++)
+    {
+        mtX.set(csrIface, _ws[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        rowOffsets[i + 1] = rowOffsets[i] + (mtX.rows()[1] - mtX.rows()[0]);
+    }
+
+    const size_t nNonZeros = rowOffsets[_nWS] - rowOffsets[0];
+    if (nNonZeros > _xWS.size() || !_xWS.get())
+    {
+        _xWS.reset(nNonZeros ? nNonZeros : 1);
+        _xWSColIndices.reset(nNonZeros ? nNonZeros : 1);
+        DAAL_CHECK_MALLOC(_xWS.get() && _xWSColIndices.get());
+    }
+
+    algorithmFPType * values = _xWS.get();
+    size_t * colIndices      = _xWSColIndices.get();
+    for (size_t i = 0, offset = 0; i < _nWS; i++)
+    {
+        mtX.set(csrIface, _ws[i], 1);
+        DAAL_CHECK_BLOCK_STATUS(mtX);
+        const algorithmFPType * xi       = mtX.values();
+        const size_t * xiColIndices      = mtX.cols();
+        const size_t nNonZeroValuesInRow = mtX.rows()[1] - mtX.rows()[0];
+        for (size_t j = 0; j < nNonZeroValuesInRow; j++, offset++)
+        {
+            values[offset]     = xi[j];
+            colIndices[offset] = xiColIndices[j];
+        }
+    }
+    return Status();
+}
+
+/**
+ * \brief Solve the sub-problem restricted to the working set using SMO with the second order working set selection
+ *
+ * \param[in] C                  Upper bound in constraints of the quadratic optimization problem
+ * \param[in] eps                Accuracy of the solution of the sub-problem
+ * \param[in] tau                Parameter of the working set selection algorithm
+ * \param[in] maxInnerIterations Maximal number of the updated pairs of coefficients
+ * \return Number of the updated pairs of coefficients
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+size_t SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::solveWorkingSet(algorithmFPType C, algorithmFPType eps, algorithmFPType tau,
+                                                                                 size_t maxInnerIterations)
+{
+    const algorithmFPType zero(0.0);
+    const algorithmFPType two(2.0);
+    const algorithmFPType fpMax    = MaxVal<algorithmFPType>::get();
+    const int * ws                 = _ws.get();
+    const algorithmFPType * y      = _y.get();
+    const algorithmFPType * kernel = _kernelWS.get();
+    algorithmFPType * alphaWS      = _alphaWS.get();
+    algorithmFPType * gradWS       = _gradWS.get();
+    algorithmFPType * deltaWS      = _deltaWS.get();
+    const size_t nWS               = _nWS;
+
+    for (size_t i = 0; i < nWS; i++)
+    {
+        alphaWS[i] = _alpha[ws[i]];
+        gradWS[i]  = _grad[ws[i]];
+    }
+
+    size_t iter = 0;
+    for (; iter < maxInnerIterations; iter++)
+    {
+        int Bi               = -1;
+        algorithmFPType GMax = -fpMax;
+        for (size_t i = 0; i < nWS; i++)
+        {
+            const algorithmFPType yi = y[ws[i]];
+            if (!isUpper(alphaWS[i], yi, C)) continue;
+            const algorithmFPType objFunc = -yi * gradWS[i];
+            if (objFunc >= GMax)
+            {
+                GMax = objFunc;
+                Bi   = int(i);
+            }
+        }
+        if (Bi == -1) break;
+
+        int Bj                    = -1;
+        algorithmFPType GMin      = fpMax;
+        algorithmFPType GMin2     = fpMax;
+        algorithmFPType delta     = zero;
+        const algorithmFPType Kii = kernel[Bi * nWS + Bi];
+        for (size_t j = 0; j < nWS; j++)
+        {
+            const algorithmFPType yj = y[ws[j]];
+            if (!isLower(alphaWS[j], yj, C)) continue;
+            const algorithmFPType ygrad = -yj * gradWS[j];
+            if (ygrad <= GMin2) GMin2 = ygrad;
+            if (ygrad >= GMax) continue;
+
+            const algorithmFPType b = GMax - ygrad;
+            algorithmFPType a       = Kii + kernel[j * nWS + j] - two * kernel[Bi * nWS + j];
+            if (a <= zero) a = tau;
+            const algorithmFPType dt      = b / a;
+            const algorithmFPType objFunc = -b * dt;
+            if (objFunc <= GMin)
+            {
+                GMin  = objFunc;
+                Bj    = int(j);
+                delta = dt;
+            }
+        }
+        if (Bj == -1 || GMax - GMin2 < eps) break;
+
+        /* Update alpha and project it back to the feasible region */
+        const algorithmFPType yi        = y[ws[Bi]];
+        const algorithmFPType yj        = y[ws[Bj]];
+        const algorithmFPType oldAlphai = alphaWS[Bi];
+        const algorithmFPType oldAlphaj = alphaWS[Bj];
+        const algorithmFPType sum       = yi * oldAlphai + yj * oldAlphaj;
+
+        algorithmFPType newAlphai = oldAlphai + yi * delta;
+        if (newAlphai > C) newAlphai = C;
+        if (newAlphai < zero) newAlphai = zero;
+        algorithmFPType newAlphaj = yj * (sum - yi * newAlphai);
+        if (newAlphaj > C) newAlphaj = C;
+        if (newAlphaj < zero) newAlphaj = zero;
+        newAlphai = yi * (sum - yj * newAlphaj);
+
+        alphaWS[Bi] = newAlphai;
+        alphaWS[Bj] = newAlphaj;
+
+        const algorithmFPType dyi        = yi * (newAlphai - oldAlphai);
+        const algorithmFPType dyj        = yj * (newAlphaj - oldAlphaj);
+        const algorithmFPType * const Ki = kernel + Bi * nWS;
+        const algorithmFPType * const Kj = kernel + Bj * nWS;
+        for (size_t t = 0; t < nWS; t++)
+        {
+            gradWS[t] += y[ws[t]] * (dyi * Ki[t] + dyj * Kj[t]);
+        }
+    }
+
+    for (size_t i = 0; i < nWS; i++)
+    {
+        deltaWS[i]    = y[ws[i]] * (alphaWS[i] - _alpha[ws[i]]);
+        _alpha[ws[i]] = alphaWS[i];
+    }
+    return iter;
+}
+
+/**
+ * \brief Update the gradient of the objective function for all observations:
+ *        grad[t] += y[t] * sum_i(kernel(x[ws[i]], x[t]) * y[ws[i]] * (change of alpha[ws[i]]))
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+Status SVMTrainThunderTask<algorithmFPType, ParameterType, cpu>::updateGradient()
+{
+    /* Kernel block is a row-major nWS x nVectors matrix, so it is a column-major nVectors x nWS one for BLAS.
+       The gradient is updated by the blocks of observations that are kept in the same threads at every iteration */
+    const size_t blockSize = 2048;
+    const size_t nBlocks   = _nVectors / blockSize + !!(_nVectors % blockSize);
+
+    const algorithmFPType * kernelBlock = _kernelBlock.get();
+    const algorithmFPType * deltaWS     = _deltaWS.get();
+    const algorithmFPType * y           = _y.get();
+    algorithmFPType * gradDelta         = _gradDelta.get();
+    algorithmFPType * grad              = _grad.get();
+
+    daal::threader_for_affinity(nBlocks, nBlocks, &_partitioner, [&](size_t iBlock) {
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd   = (iStart + blockSize < _nVectors ? iStart + blockSize : _nVectors);
+
+        const char trans = 'N';
+        DAAL_INT m       = (DAAL_INT)(iEnd - iStart);
+        DAAL_INT n       = (DAAL_INT)_nWS;
+        DAAL_INT lda     = (DAAL_INT)_nVectors;
+        DAAL_INT inc     = 1;
+        algorithmFPType one(1.0);
+        algorithmFPType zero(0.0);
+        Blas<algorithmFPType, cpu>::xxgemv(&trans, &m, &n, &one, kernelBlock + iStart, &lda, deltaWS, &inc, &zero, gradDelta + iStart, &inc);
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t t = iStart; t < iEnd; t++)
+        {
+            grad[t] += y[t] * gradDelta[t];
+        }
+    });
+    return Status();
+}
+
+} // namespace internal
+} // namespace training
+} // namespace svm
+} // namespace algorithms
+} // namespace daal
+
+#endif
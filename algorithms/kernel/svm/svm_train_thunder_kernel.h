@@ -0,0 +1,134 @@
+/* file: svm_train_thunder_kernel.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate SVM Training functions with the thunder method.
+//--
+*/
+
+#ifndef __SVM_TRAIN_THUNDER_KERNEL_H__
+#define __SVM_TRAIN_THUNDER_KERNEL_H__
+
+#include "data_management/data/numeric_table.h"
+#include "algorithms/model.h"
+#include "services/daal_defines.h"
+#include "algorithms/svm/svm_train_types.h"
+#include "algorithms/kernel/kernel.h"
+#include "service/kernel/data_management/service_micro_table.h"
+#include "algorithms/threading/threading.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+#include "algorithms/kernel/svm/svm_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace svm
+{
+namespace training
+{
+namespace internal
+{
+/**
+ * Training task of the thunder method. Every outer iteration selects a working set of the most violating observations,
+ * computes the rows of kernel matrix for the working set with a single call of the kernel function,
+ * solves the sub-problem restricted to the working set and updates the gradient for all observations
+ */
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMTrainThunderTask : public SVMTrainTask<algorithmFPType, ParameterType, cpu>
+{
+    typedef SVMTrainTask<algorithmFPType, ParameterType, cpu> super;
+
+    static const size_t maxWorkingSetSize = 1024; /* Maximal number of observations in the working set */
+
+    SVMTrainThunderTask(size_t nVectors) : super(nVectors), _nWSMax(0), _nWS(0), _nWSPrev(0) {}
+
+    Status setup(const ParameterType & svmPar, const NumericTablePtr & xTable, NumericTable & yTable);
+
+    /* Perform the working set based Sequential Minimum Optimization (SMO) algorithm to find optimal coefficients alpha */
+    Status compute(const ParameterType & svmPar, const NumericTablePtr & xTable, services::HostAppIface * pHostApp);
+
+protected:
+    /* Selects the observations of the working set, returns the duality gap of the current solution */
+    algorithmFPType selectWorkingSet(algorithmFPType C);
+
+    Status computeKernelBlock(const NumericTablePtr & xTable);
+
+    Status copyWorkingSetRowsDense(const NumericTablePtr & xTable);
+
+    Status copyWorkingSetRowsCSR(const NumericTablePtr & xTable);
+
+    /* Solves the sub-problem for the observations in the working set, returns the number of the inner iterations */
+    size_t solveWorkingSet(algorithmFPType C, algorithmFPType eps, algorithmFPType tau, size_t maxInnerIterations);
+
+    Status updateGradient();
+
+    /* Checks if the observation belongs to I_UP(alpha) */
+    static bool isUpper(algorithmFPType alpha, algorithmFPType y, algorithmFPType C) { return (y > 0 ? alpha < C : alpha > 0); }
+
+    /* Checks if the observation belongs to I_LOW(alpha) */
+    static bool isLower(algorithmFPType alpha, algorithmFPType y, algorithmFPType C) { return (y > 0 ? alpha > 0 : alpha < C); }
+
+    using super::_nVectors;
+    using super::_y;
+    using super::_alpha;
+    using super::_grad;
+
+protected:
+    size_t _nWSMax;                                  //Maximal number of observations in the working set
+    size_t _nWS;                                     //Number of observations in the working set at the current iteration
+    size_t _nWSPrev;                                 //Number of observations in the working set at the previous iteration
+    kernel_function::KernelIfacePtr _kernel;         //Kernel function
+    TArray<int, cpu> _ws;                            //Indices of the observations in the working set
+    TArray<int, cpu> _wsPrev;                        //Working set of the previous iteration
+    TArray<char, cpu> _inWS;                         //Flags of the observations that are in the working set
+    TArray<algorithmFPType, cpu> _sortedValues;      //Values of -y[i]*grad[i] sorted in ascending order
+    TArray<int, cpu> _sortedIndices;                 //Indices of the observations sorted by -y[i]*grad[i]
+    TArray<algorithmFPType, cpu> _kernelBlock;       //Rows of kernel matrix for the working set, _nWSMax x nVectors
+    TArray<algorithmFPType, cpu> _kernelWS;          //Kernel matrix restricted to the working set
+    TArray<algorithmFPType, cpu> _alphaWS;           //Coefficients alpha of the sub-problem
+    TArray<algorithmFPType, cpu> _gradWS;            //Gradient of the sub-problem
+    TArray<algorithmFPType, cpu> _deltaWS;           //y[i] * (change of alpha[i]) for the observations in the working set
+    TArray<algorithmFPType, cpu> _gradDelta;         //Change of the gradient for all observations
+    TArray<algorithmFPType, cpu> _xWS;               //Rows of the input data for the working set, dense or CSR values
+    TArray<size_t, cpu> _xWSColIndices;              //Column indices of the working set rows in CSR layout
+    TArray<size_t, cpu> _xWSRowOffsets;              //Row offsets of the working set rows in CSR layout
+    daal::affinity_partitioner _partitioner;         //Keeps the blocks of the gradient in the same threads across the iterations
+};
+
+template <typename algorithmFPType, typename ParameterType, CpuType cpu>
+struct SVMTrainImpl<thunder, algorithmFPType, ParameterType, cpu> : public Kernel
+{
+    services::Status compute(services::HostAppIface * pHostApp, const NumericTablePtr & xTable, NumericTable & yTable, daal::algorithms::Model * r,
+                             const ParameterType * par);
+};
+
+} // namespace internal
+
+} // namespace training
+
+} // namespace svm
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -43,6 +43,7 @@
         #include <tbb/blocked_range.h>
         #include <tbb/tick_count.h>
         #include <tbb/scalable_allocator.h>
+        #include <tbb/spin_mutex.h>
 
         #if defined(_WIN32) || defined(_WIN64)
             #include <Windows.h>
@@ -180,6 +181,36 @@ struct cpu_mask_t
         return status;
     } // int set_cpu_index(int cpu_idx)
 
+    int clear()
+    {
+        if (status == 0)
+        {
+        #if defined __PINNER_LINUX__
+            CPU_ZERO_S(bit_parts_size, cpu_set);
+        #else // defined __PINNER_WINDOWS__
+            ga.Mask = 0;
+        #endif
+        }
+
+        return status;
+    } // int clear()
+
+    int add_cpu_index(int cpu_idx)
+    {
+        if (status == 0)
+        {
+        #if defined __PINNER_LINUX__
+            CPU_SET_S(cpu_idx, bit_parts_size, cpu_set);
+        #else // defined __PINNER_WINDOWS__
+            /* The mask is limited to the processor group of the first cpu */
+            if (ga.Mask == 0) ga.Group = cpu_idx / MASK_WIDTH;
+            if (ga.Group == cpu_idx / MASK_WIDTH) ga.Mask |= (KAFFINITY)1 << (cpu_idx % MASK_WIDTH);
+        #endif
+        }
+
+        return status;
+    } // int add_cpu_index(int cpu_idx)
+
     int get_status() { return status; } // int get_status()
 
     ~cpu_mask_t()
@@ -195,12 +226,54 @@ struct cpu_mask_t
     } // ~cpu_mask_t()
 };
 
+/* Fills the ordered queue with the cpus of the queue in the order of the policy.
+ * The order of the cpus of one node is kept, so physical cores go before their hyper-threads */
+static void order_cpu_queue(int policy, const int * queue, int * ordered, int ncpus, const int * cpu_node, int nnodes, int * node_pos)
+{
+    if (policy == daal::services::internal::compact_pinning)
+    {
+        int q = 0;
+        for (int node = 0; node < nnodes; node++)
+        {
+            for (int i = 0; i < ncpus; i++)
+            {
+                if (cpu_node[queue[i]] == node) ordered[q++] = queue[i];
+            }
+        }
+    }
+    else if (policy == daal::services::internal::scatter_pinning)
+    {
+        for (int node = 0; node < nnodes; node++) node_pos[node] = 0;
+
+        for (int q = 0; q < ncpus;)
+        {
+            for (int node = 0; node < nnodes && q < ncpus; node++)
+            {
+                int & pos = node_pos[node];
+                while (pos < ncpus && cpu_node[queue[pos]] != node) pos++;
+                if (pos < ncpus) ordered[q++] = queue[pos++];
+            }
+        }
+    }
+    else
+    {
+        for (int i = 0; i < ncpus; i++) ordered[i] = queue[i];
+    }
+}
+
+static void free_cpu_queue(void * ptr)
+{
+    daal::services::daal_free(ptr);
+}
+
 class thread_pinner_impl_t : public tbb::task_scheduler_observer
 {
     int status;
     int nthreads;
     int max_threads;
     int * cpu_queue;
+    int * active_queue;
+    int * policy_queue;
     bool do_pinning;
     tbb::atomic<int> is_pinning;
     tbb::enumerable_thread_specific<cpu_mask_t *> thread_mask;
@@ -209,6 +282,7 @@ class thread_pinner_impl_t : public tbb::task_scheduler_observer
 
 public:
     thread_pinner_impl_t(void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *));
+    thread_pinner_impl_t(int * node_cpu_queue, int node_ncpus);
     void on_scheduler_entry(bool);
     void on_scheduler_exit(bool);
     void init_thread_pinner(int statusToSet, int nthreadsToSet, int max_threadsToSet, int * cpu_queueToSet);
@@ -227,6 +301,11 @@ public:
         }
     }
 
+    /* Executes the task in the arena without the check for the nested pinning, used by the arenas of NUMA nodes
+     * that are entered concurrently by the threads bound to the node */
+    void execute_in_arena(daal::services::internal::thread_pinner_task_t & task) { pinner_arena.execute(task); }
+
+    int set_policy(int policy, const int * cpu_node, int nnodes);
     int get_status();
     bool get_pinning();
     bool set_pinning(bool p);
@@ -236,15 +315,33 @@ public:
 thread_pinner_impl_t::thread_pinner_impl_t(void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *))
     : pinner_arena(nthreads = daal::threader_get_threads_number()), tbb::task_scheduler_observer(pinner_arena), topo_deleter(deleter)
 {
-    do_pinning = (nthreads > 0) ? true : false;
-    is_pinning = 0;
+    do_pinning   = (nthreads > 0) ? true : false;
+    is_pinning   = 0;
+    policy_queue = NULL;
 
     read_topo(status, nthreads, max_threads, &cpu_queue);
+    active_queue = cpu_queue;
     observe(true);
 
     return;
 } /* thread_pinner_impl_t() */
 
+thread_pinner_impl_t::thread_pinner_impl_t(int * node_cpu_queue, int node_ncpus)
+    : pinner_arena(nthreads = node_ncpus), tbb::task_scheduler_observer(pinner_arena), topo_deleter(free_cpu_queue)
+{
+    status       = (node_cpu_queue && node_ncpus > 0) ? 0 : -1;
+    max_threads  = node_ncpus;
+    cpu_queue    = node_cpu_queue;
+    active_queue = cpu_queue;
+    policy_queue = NULL;
+    do_pinning   = true;
+    is_pinning   = 0;
+
+    observe(true);
+
+    return;
+} /* thread_pinner_impl_t(int *, int) */
+
 void thread_pinner_impl_t::on_scheduler_entry(bool) /*override*/
 {
     if (do_pinning == false || status < 0) return;
@@ -253,7 +350,7 @@ void thread_pinner_impl_t::on_scheduler_entry(bool) /*override*/
     int thr_idx = tbb::task_arena::current_thread_index();
 
     // Get next cpu from topology queue
-    int cpu_idx = cpu_queue[thr_idx % max_threads];
+    int cpu_idx = active_queue[thr_idx % max_threads];
 
     // Allocate source and target affinity masks
     cpu_mask_t * target_mask = new cpu_mask_t;
@@ -306,6 +403,29 @@ void thread_pinner_impl_t::on_scheduler_exit(bool) /*override*/
     return;
 } /* void on_scheduler_exit( bool ) */
 
+int thread_pinner_impl_t::set_policy(int policy, const int * cpu_node, int nnodes)
+{
+    if (status < 0) return status;
+
+    if (policy == daal::services::internal::default_pinning || !cpu_node)
+    {
+        active_queue = cpu_queue;
+        return 0;
+    }
+
+    if (!policy_queue)
+    {
+        policy_queue = (int *)daal::services::daal_malloc((max_threads + nnodes) * sizeof(int), 64);
+        if (!policy_queue) return -1;
+    }
+
+    /* The threads read the queue when they enter the arena, the new order applies to the next entries */
+    order_cpu_queue(policy, cpu_queue, policy_queue, max_threads, cpu_node, nnodes, policy_queue + max_threads);
+    active_queue = policy_queue;
+
+    return 0;
+} /* int set_policy(int policy, const int * cpu_node, int nnodes) */
+
 int thread_pinner_impl_t::get_status()
 {
     return status;
@@ -329,6 +449,7 @@ thread_pinner_impl_t::~thread_pinner_impl_t()
     observe(false);
 
     if (cpu_queue) topo_deleter(cpu_queue);
+    if (policy_queue) daal::services::daal_free(policy_queue);
 
     thread_mask.combine_each([](cpu_mask_t *& source_mask) { delete source_mask; });
 
@@ -352,10 +473,13 @@ DAAL_EXPORT void * _getThreadPinner(bool create_pinner, void (*read_topo)(int &,
     return NULL;
 } /* thread_pinner_t* getThreadPinner() */
 
+static void apply_thread_pinning_policy(thread_pinner_impl_t * impl);
+
 DAAL_EXPORT void _thread_pinner_thread_pinner_init(void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *))
 {
     static thread_pinner_impl_t impl(read_topo, deleter);
     IMPL = &impl;
+    apply_thread_pinning_policy(IMPL);
 }
 
 DAAL_EXPORT void _thread_pinner_execute(daal::services::internal::thread_pinner_task_t & task)
@@ -388,6 +512,220 @@ DAAL_EXPORT void _thread_pinner_on_scheduler_exit(bool p)
     IMPL->on_scheduler_exit(p);
 }
 
+/* NUMA nodes of the cpus and the arenas of the threads pinned to the cpus of one node */
+class numa_topology_t
+{
+    int status;
+    int nnodes;
+    int ncpus;
+    int * cpu_node;
+    int * cpu_queue;
+    bool is_read;
+    int policy;
+    thread_pinner_impl_t ** node_pinners;
+    void (*topo_deleter)(void *);
+    tbb::spin_mutex mutex;
+
+public:
+    tbb::enumerable_thread_specific<int> current_node;
+
+    numa_topology_t()
+        : status(0),
+          nnodes(0),
+          ncpus(0),
+          cpu_node(NULL),
+          cpu_queue(NULL),
+          is_read(false),
+          policy(daal::services::internal::default_pinning),
+          node_pinners(NULL),
+          topo_deleter(NULL),
+          current_node(-1)
+    {}
+
+    int read(void (*read_topo)(int &, int &, int &, int **), void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+    {
+        tbb::spin_mutex::scoped_lock lock(mutex);
+        if (is_read) return status;
+        is_read      = true;
+        topo_deleter = deleter;
+
+        int nthreads = 0, queue_ncpus = 0;
+        read_topo(status, nthreads, queue_ncpus, &cpu_queue);
+        if (status < 0) return status;
+
+        read_nodes(status, nnodes, ncpus, &cpu_node);
+        if (status < 0) return status;
+
+        if (queue_ncpus != ncpus)
+        {
+            status--;
+            return status;
+        }
+
+        node_pinners = (thread_pinner_impl_t **)daal::services::daal_calloc(nnodes * sizeof(thread_pinner_impl_t *));
+        if (!node_pinners) status--;
+
+        return status;
+    }
+
+    int get_number_of_nodes() const { return (status == 0) ? nnodes : 0; }
+    const int * get_cpu_node() const { return (status == 0) ? cpu_node : NULL; }
+
+    int set_policy(int p)
+    {
+        tbb::spin_mutex::scoped_lock lock(mutex);
+        policy = p;
+        return 0;
+    }
+
+    int get_policy() const { return policy; }
+
+    /* Creates the arena of the node on the first use. The threads of the arena are pinned to the cpus of the node
+     * in the compact order, so the arena uses the physical cores of the node first */
+    thread_pinner_impl_t * get_node_pinner(int node)
+    {
+        if (status != 0 || node < 0 || node >= nnodes) return NULL;
+
+        tbb::spin_mutex::scoped_lock lock(mutex);
+        if (node_pinners[node]) return node_pinners[node];
+
+        int node_ncpus = 0;
+        for (int i = 0; i < ncpus; i++) node_ncpus += (cpu_node[cpu_queue[i]] == node);
+        if (node_ncpus == 0) return NULL;
+
+        int * node_queue = (int *)daal::services::daal_malloc(node_ncpus * sizeof(int), 64);
+        if (!node_queue) return NULL;
+
+        int q = 0;
+        for (int i = 0; i < ncpus; i++)
+        {
+            if (cpu_node[cpu_queue[i]] == node) node_queue[q++] = cpu_queue[i];
+        }
+
+        thread_pinner_impl_t * pinner = new thread_pinner_impl_t(node_queue, node_ncpus);
+        if (pinner->get_status() != 0)
+        {
+            delete pinner;
+            return NULL;
+        }
+        node_pinners[node] = pinner;
+        return pinner;
+    }
+
+    int get_node_cpus(int node, cpu_mask_t & mask) const
+    {
+        if (mask.clear() != 0) return -1;
+        for (int i = 0; i < ncpus; i++)
+        {
+            if (cpu_node[cpu_queue[i]] == node && mask.add_cpu_index(cpu_queue[i]) != 0) return -1;
+        }
+        return 0;
+    }
+
+    ~numa_topology_t()
+    {
+        if (node_pinners)
+        {
+            for (int i = 0; i < nnodes; i++) delete node_pinners[i];
+            daal::services::daal_free(node_pinners);
+        }
+        if (cpu_node) topo_deleter(cpu_node);
+        if (cpu_queue) topo_deleter(cpu_queue);
+    }
+};
+
+static numa_topology_t & get_numa_topology()
+{
+    static numa_topology_t topology;
+    return topology;
+}
+
+/* Applies the policy set before the arena of all the cpus is created */
+static void apply_thread_pinning_policy(thread_pinner_impl_t * impl)
+{
+    numa_topology_t & topology = get_numa_topology();
+    if (topology.get_cpu_node()) impl->set_policy(topology.get_policy(), topology.get_cpu_node(), topology.get_number_of_nodes());
+}
+
+/* Binding of the calling thread to a NUMA node, keeps the state of the thread to restore */
+struct numa_node_binding_t
+{
+    int prev_node;
+    cpu_mask_t caller_mask;
+};
+
+DAAL_EXPORT int _thread_pinner_set_policy(int policy, void (*read_topo)(int &, int &, int &, int **),
+                                          void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+{
+    numa_topology_t & topology = get_numa_topology();
+    if (topology.read(read_topo, read_nodes, deleter) != 0) return -1;
+
+    topology.set_policy(policy);
+
+    /* The arenas of NUMA nodes are always compact, the policy applies to the arena of all the cpus */
+    if (!IMPL) return 0;
+    return IMPL->set_policy(policy, topology.get_cpu_node(), topology.get_number_of_nodes());
+}
+
+DAAL_EXPORT int _thread_pinner_get_number_of_nodes(void (*read_topo)(int &, int &, int &, int **), void (*read_nodes)(int &, int &, int &, int **),
+                                                   void (*deleter)(void *))
+{
+    numa_topology_t & topology = get_numa_topology();
+    topology.read(read_topo, read_nodes, deleter);
+    return topology.get_number_of_nodes();
+}
+
+DAAL_EXPORT void * _thread_pinner_enter_node(int node, void (*read_topo)(int &, int &, int &, int **),
+                                             void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+{
+    numa_topology_t & topology = get_numa_topology();
+    if (topology.read(read_topo, read_nodes, deleter) != 0) return NULL;
+    if (!topology.get_node_pinner(node)) return NULL;
+
+    numa_node_binding_t * binding = new numa_node_binding_t;
+    if (binding->caller_mask.get_thread_affinity() != 0)
+    {
+        delete binding;
+        return NULL;
+    }
+
+    /* The calling thread runs on the node while it is bound, so the memory it first touches is placed on the node */
+    cpu_mask_t node_mask;
+    if (topology.get_node_cpus(node, node_mask) != 0 || node_mask.set_thread_affinity() != 0)
+    {
+        binding->caller_mask.set_thread_affinity();
+        delete binding;
+        return NULL;
+    }
+
+    binding->prev_node             = topology.current_node.local();
+    topology.current_node.local() = node;
+    return binding;
+}
+
+DAAL_EXPORT void _thread_pinner_leave_node(void * ptr)
+{
+    numa_node_binding_t * binding = (numa_node_binding_t *)ptr;
+    if (!binding) return;
+
+    binding->caller_mask.set_thread_affinity();
+    get_numa_topology().current_node.local() = binding->prev_node;
+    delete binding;
+}
+
+DAAL_EXPORT bool _thread_pinner_execute_on_node(daal::services::internal::thread_pinner_task_t & task)
+{
+    numa_topology_t & topology = get_numa_topology();
+    const int node             = topology.current_node.local();
+    if (node < 0) return false;
+
+    thread_pinner_impl_t * pinner = topology.get_node_pinner(node);
+    if (!pinner) return false;
+
+    pinner->execute_in_arena(task);
+    return true;
+}
+
     #else /* if __DO_TBB_LAYER__ is not defined */
 
 DAAL_EXPORT void * _getThreadPinner(bool create_pinner, void (*read_topo)(int &, int &, int &, int **), void (*deleter)(void *))
@@ -416,6 +754,27 @@ DAAL_EXPORT int _thread_pinner_get_status()
 DAAL_EXPORT void _thread_pinner_on_scheduler_entry(bool p) {}
 DAAL_EXPORT void _thread_pinner_on_scheduler_exit(bool p) {}
 
+DAAL_EXPORT int _thread_pinner_set_policy(int policy, void (*read_topo)(int &, int &, int &, int **),
+                                          void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+{
+    return -1;
+}
+DAAL_EXPORT int _thread_pinner_get_number_of_nodes(void (*read_topo)(int &, int &, int &, int **), void (*read_nodes)(int &, int &, int &, int **),
+                                                   void (*deleter)(void *))
+{
+    return 0;
+}
+DAAL_EXPORT void * _thread_pinner_enter_node(int node, void (*read_topo)(int &, int &, int &, int **),
+                                             void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+{
+    return NULL;
+}
+DAAL_EXPORT void _thread_pinner_leave_node(void * binding) {}
+DAAL_EXPORT bool _thread_pinner_execute_on_node(daal::services::internal::thread_pinner_task_t & task)
+{
+    return false;
+}
+
     #endif /* if __DO_TBB_LAYER__ is not defined */
 
 #endif /* #if !defined (DAAL_THREAD_PINNING_DISABLED) */
@@ -82,6 +82,14 @@ public:
     virtual void operator()() = 0;
 };
 
+/* Orders of the cpus the threads of the arena are pinned to, values match Environment::ThreadPinningPolicy */
+enum thread_pinning_policy_t
+{
+    default_pinning = 0, /* physical cores of all the nodes, then their hyper-threads */
+    compact_pinning = 1, /* the cpus of one node, then the cpus of the next one */
+    scatter_pinning = 2  /* the cpus are taken from the nodes in turn */
+};
+
 } // namespace internal
 } // namespace services
 } // namespace daal
@@ -99,6 +107,15 @@ extern "C"
     DAAL_EXPORT bool _thread_pinner_set_pinning(bool p);
 
     DAAL_EXPORT void * _getThreadPinner(bool create_pinner, void(int &, int &, int &, int **), void (*deleter)(void *));
+
+    DAAL_EXPORT int _thread_pinner_set_policy(int policy, void(int &, int &, int &, int **), void(int &, int &, int &, int **),
+                                              void (*deleter)(void *));
+    DAAL_EXPORT int _thread_pinner_get_number_of_nodes(void(int &, int &, int &, int **), void(int &, int &, int &, int **),
+                                                       void (*deleter)(void *));
+    DAAL_EXPORT void * _thread_pinner_enter_node(int node, void(int &, int &, int &, int **), void(int &, int &, int &, int **),
+                                                 void (*deleter)(void *));
+    DAAL_EXPORT void _thread_pinner_leave_node(void * binding);
+    DAAL_EXPORT bool _thread_pinner_execute_on_node(daal::services::internal::thread_pinner_task_t & task);
 }
 
 namespace daal
@@ -125,6 +142,39 @@ inline thread_pinner_t * getThreadPinner(bool create_pinner, void (*read_topo)(i
     return (thread_pinner_t *)_getThreadPinner(create_pinner, read_topo, deleter);
 }
 
+/* Sets the order of the cpus for the threads of the pinned arenas, returns 0 if the order is applied */
+inline int setThreadPinningPolicy(thread_pinning_policy_t policy, void (*read_topo)(int &, int &, int &, int **),
+                                  void (*read_nodes)(int &, int &, int &, int **), void (*deleter)(void *))
+{
+    return _thread_pinner_set_policy((int)policy, read_topo, read_nodes, deleter);
+}
+
+/* Returns the number of NUMA nodes or 0 if the topology is not available */
+inline int getNumberOfNumaNodes(void (*read_topo)(int &, int &, int &, int **), void (*read_nodes)(int &, int &, int &, int **),
+                                void (*deleter)(void *))
+{
+    return _thread_pinner_get_number_of_nodes(read_topo, read_nodes, deleter);
+}
+
+/* Binds the calling thread and the algorithms it computes to the arena of the NUMA node.
+ * Returns the binding to pass to leaveNumaNode() or NULL if the thread is not bound */
+inline void * enterNumaNode(int node, void (*read_topo)(int &, int &, int &, int **), void (*read_nodes)(int &, int &, int &, int **),
+                            void (*deleter)(void *))
+{
+    return _thread_pinner_enter_node(node, read_topo, read_nodes, deleter);
+}
+
+inline void leaveNumaNode(void * binding)
+{
+    _thread_pinner_leave_node(binding);
+}
+
+/* Executes the task in the arena of the NUMA node the calling thread is bound to, returns false if the thread is not bound */
+inline bool executeOnNumaNode(thread_pinner_task_t & task)
+{
+    return _thread_pinner_execute_on_node(task);
+}
+
 } // namespace internal
 } // namespace services
 } // namespace daal
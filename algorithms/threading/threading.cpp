@@ -29,10 +29,27 @@
     #include <tbb/tbb.h>
     #include <tbb/spin_mutex.h>
     #include "tbb/scalable_allocator.h"
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
 #else
     #include "externals/service_service.h"
 #endif
 
+#if defined(_WIN32) || defined(_WIN64)
+    #define DAAL_THREADER_THREAD_LOCAL __declspec(thread)
+#else
+    #define DAAL_THREADER_THREAD_LOCAL __thread
+#endif
+
+/* Index of the group of iterations of the deterministic parallel loop run by the thread */
+static DAAL_THREADER_THREAD_LOCAL int threaderGroup = -1;
+
+DAAL_EXPORT int * _daal_threader_group_ptr()
+{
+    return &threaderGroup;
+}
+
 DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -82,13 +99,26 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** init)
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) {
+    auto body = [&](tbb::blocked_range<int> r) {
         int i;
         for (i = r.begin(); i < r.end(); i++)
         {
             func(i, a);
         }
-    });
+    };
+    if (daal::threader_env()->isDynamicScheduling())
+    {
+        /* The slower cores of hybrid processors take fewer chunks instead of finishing their share of the range last.
+           The chunks are bounded so that each thread takes several of them and the scheduling overhead stays small */
+        const int nChunksPerThread = 4;
+        const int nThreads         = (int)daal::threader_env()->getNumberOfThreads();
+        const int grainSize        = (nThreads > 0 && n / (nChunksPerThread * nThreads) > 1) ? n / (nChunksPerThread * nThreads) : 1;
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, grainSize), body, tbb::simple_partitioner());
+    }
+    else
+    {
+        tbb::parallel_for(tbb::blocked_range<int>(0, n, 1), body);
+    }
 #elif defined(__DO_SEQ_LAYER__)
     int i;
     for (i = 0; i < n; i++)
@@ -107,6 +137,51 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
 #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_affinity(int n, int threads_request, const void * a, daal::functype func, void * partitionerPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, n, 1),
+        [&](tbb::blocked_range<int> r) {
+            int i;
+            for (i = r.begin(); i < r.end(); i++)
+            {
+                func(i, a);
+            }
+        },
+        *(tbb::affinity_partitioner *)partitionerPtr);
+#elif defined(__DO_SEQ_LAYER__)
+    _daal_threader_for(n, threads_request, a, func);
+#endif
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int threads_request, const void * a, daal::functype2 func, void * partitionerPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, n, 1), [&](tbb::blocked_range<int> r) { func(r.begin(), r.end() - r.begin(), a); },
+        *(tbb::affinity_partitioner *)partitionerPtr);
+#elif defined(__DO_SEQ_LAYER__)
+    func(0, n, a);
+#endif
+}
+
+DAAL_EXPORT void * _daal_new_affinity_partitioner()
+{
+#if defined(__DO_TBB_LAYER__)
+    return (void *)(new tbb::affinity_partitioner());
+#elif defined(__DO_SEQ_LAYER__)
+    return NULL;
+#endif
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    delete (tbb::affinity_partitioner *)partitionerPtr;
+#endif
+}
+
 DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -127,6 +202,16 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
 #endif
 }
 
+DAAL_EXPORT void _daal_threader_invoke(const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    tbb::parallel_invoke([&]() { func(0, a); }, [&]() { func(1, a); });
+#elif defined(__DO_SEQ_LAYER__)
+    func(0, a);
+    func(1, a);
+#endif
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
 #if defined(__DO_TBB_LAYER__)
@@ -136,6 +221,44 @@ DAAL_EXPORT int _daal_threader_get_max_threads()
 #endif
 }
 
+DAAL_EXPORT void * _daal_new_arena(int nThreads)
+{
+#if defined(__DO_TBB_LAYER__)
+    /* One slot is reserved for the calling thread, so the arena of one thread runs the computations inline without workers */
+    return (void *)(new tbb::task_arena(nThreads > 0 ? nThreads : int(tbb::task_arena::automatic), 1));
+#elif defined(__DO_SEQ_LAYER__)
+    return NULL;
+#endif
+}
+
+DAAL_EXPORT void _daal_del_arena(void * arenaPtr)
+{
+#if defined(__DO_TBB_LAYER__)
+    delete (tbb::task_arena *)arenaPtr;
+#endif
+}
+
+DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype func)
+{
+#if defined(__DO_TBB_LAYER__)
+    if (arenaPtr)
+    {
+        ((tbb::task_arena *)arenaPtr)->execute([&]() { func(0, a); });
+        return;
+    }
+#endif
+    func(0, a);
+}
+
+DAAL_EXPORT int _daal_threader_get_arena_max_threads()
+{
+#if defined(__DO_TBB_LAYER__)
+    return tbb::this_task_arena::max_concurrency();
+#elif defined(__DO_SEQ_LAYER__)
+    return 1;
+#endif
+}
+
 DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func)
 {
 #if defined(__DO_TBB_LAYER__)
@@ -245,6 +368,101 @@ DAAL_EXPORT bool _daal_is_in_parallel()
 #endif
 }
 
+DAAL_EXPORT int _daal_atomic_compare_exchange_int(int * ptr, int expected, int desired)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(_MSC_VER)
+    return _InterlockedCompareExchange(reinterpret_cast<volatile long *>(ptr), desired, expected);
+    #else
+    return __sync_val_compare_and_swap(ptr, expected, desired);
+    #endif
+#else
+    const int previous = *ptr;
+    if (previous == expected)
+    {
+        *ptr = desired;
+    }
+    return previous;
+#endif
+}
+
+DAAL_EXPORT void _daal_atomic_add_float(float * ptr, float value)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(_MSC_VER)
+    typedef long IntType;
+    #else
+    typedef int IntType;
+    #endif
+    union
+    {
+        IntType i;
+        float f;
+    } expected, desired;
+    IntType * iptr = reinterpret_cast<IntType *>(ptr);
+    expected.f     = *ptr;
+    for (;;)
+    {
+        desired.f = expected.f + value;
+    #if defined(_MSC_VER)
+        const IntType previous = _InterlockedCompareExchange(reinterpret_cast<volatile long *>(iptr), desired.i, expected.i);
+        if (previous == expected.i) return;
+        expected.i = previous;
+    #else
+        if (__atomic_compare_exchange_n(iptr, &expected.i, desired.i, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return;
+    #endif
+    }
+#else
+    *ptr += value;
+#endif
+}
+
+DAAL_EXPORT void _daal_atomic_add_double(double * ptr, double value)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(_MSC_VER)
+    typedef __int64 IntType;
+    #else
+    typedef long long IntType;
+    #endif
+    union
+    {
+        IntType i;
+        double f;
+    } expected, desired;
+    IntType * iptr = reinterpret_cast<IntType *>(ptr);
+    expected.f     = *ptr;
+    for (;;)
+    {
+        desired.f = expected.f + value;
+    #if defined(_MSC_VER)
+        const IntType previous = _InterlockedCompareExchange64(reinterpret_cast<volatile __int64 *>(iptr), desired.i, expected.i);
+        if (previous == expected.i) return;
+        expected.i = previous;
+    #else
+        if (__atomic_compare_exchange_n(iptr, &expected.i, desired.i, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return;
+    #endif
+    }
+#else
+    *ptr += value;
+#endif
+}
+
+DAAL_EXPORT void _daal_atomic_add_size_t(size_t * ptr, size_t value)
+{
+#if defined(__DO_TBB_LAYER__)
+    #if defined(_WIN64)
+    _InterlockedExchangeAdd64(reinterpret_cast<volatile __int64 *>(ptr), (__int64)value);
+    #elif defined(_MSC_VER)
+    _InterlockedExchangeAdd(reinterpret_cast<volatile long *>(ptr), (long)value);
+    #else
+    __atomic_fetch_add(ptr, value, __ATOMIC_RELAXED);
+    #endif
+#else
+    *ptr += value;
+#endif
+}
+
 DAAL_EXPORT void * _daal_threader_env()
 {
     static daal::ThreaderEnvironment env;
@@ -25,6 +25,7 @@
 #define __THREADING_H__
 
 #include "services/daal_defines.h"
+#include "services/daal_memory.h"
 
 namespace daal
 {
@@ -40,7 +41,10 @@ extern "C"
     DAAL_EXPORT int _daal_threader_get_max_threads();
     DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void * a, daal::functype func);
     DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void * a, daal::functype2 func);
+    DAAL_EXPORT void _daal_threader_for_affinity(int n, int threads_request, const void * a, daal::functype func, void * partitionerPtr);
+    DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int threads_request, const void * a, daal::functype2 func, void * partitionerPtr);
     DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func);
+    DAAL_EXPORT void _daal_threader_invoke(const void * a, daal::functype func);
 
     DAAL_EXPORT void * _daal_get_tls_ptr(void * a, daal::tls_functype func);
     DAAL_EXPORT void * _daal_get_tls_local(void * tlsPtr);
@@ -59,6 +63,10 @@ extern "C"
     DAAL_EXPORT void _daal_unlock_mutex(void * mutexPtr);
     DAAL_EXPORT void _daal_del_mutex(void * mutexPtr);
     DAAL_EXPORT bool _daal_is_in_parallel();
+    DAAL_EXPORT int _daal_atomic_compare_exchange_int(int * ptr, int expected, int desired);
+    DAAL_EXPORT void _daal_atomic_add_float(float * ptr, float value);
+    DAAL_EXPORT void _daal_atomic_add_double(double * ptr, double value);
+    DAAL_EXPORT void _daal_atomic_add_size_t(size_t * ptr, size_t value);
 
     DAAL_EXPORT void * _daal_new_task_group();
     DAAL_EXPORT void _daal_del_task_group(void * taskGroupPtr);
@@ -69,6 +77,15 @@ extern "C"
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void ** init);
 
     DAAL_EXPORT void * _daal_threader_env();
+    DAAL_EXPORT int * _daal_threader_group_ptr();
+
+    DAAL_EXPORT void * _daal_new_arena(int nThreads);
+    DAAL_EXPORT void _daal_del_arena(void * arenaPtr);
+    DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype func);
+    DAAL_EXPORT int _daal_threader_get_arena_max_threads();
+
+    DAAL_EXPORT void * _daal_new_affinity_partitioner();
+    DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr);
 
     DAAL_EXPORT void * _threaded_scalable_malloc(const size_t size, const size_t alignment);
     DAAL_EXPORT void _threaded_scalable_free(void * ptr);
@@ -94,12 +111,20 @@ inline void threaded_scalable_free(void * ptr)
 class ThreaderEnvironment
 {
 public:
-    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()) {}
+    ThreaderEnvironment() : _numberOfThreads(_daal_threader_get_max_threads()), _dynamicScheduling(false), _deterministicGroups(0) {}
     size_t getNumberOfThreads() const { return _numberOfThreads; }
     void setNumberOfThreads(size_t value) { _numberOfThreads = value; }
+    /* If true, threader_for splits the iterations into several small chunks per thread taken by the first free thread */
+    bool isDynamicScheduling() const { return _dynamicScheduling; }
+    void setDynamicScheduling(bool value) { _dynamicScheduling = value; }
+    /* Number of the groups of iterations of the parallel loops in the deterministic mode, 0 if the mode is disabled */
+    size_t getDeterministicGroups() const { return _deterministicGroups; }
+    void setDeterministicGroups(size_t value) { _deterministicGroups = value; }
 
 private:
     size_t _numberOfThreads;
+    bool _dynamicScheduling;
+    size_t _deterministicGroups;
 };
 
 inline ThreaderEnvironment * threader_env()
@@ -109,7 +134,10 @@ inline ThreaderEnvironment * threader_env()
 
 inline size_t threader_get_threads_number()
 {
-    return threader_env()->getNumberOfThreads();
+    /* Computations in an arena of limited concurrency use the number of threads of the arena */
+    const size_t nThreads  = threader_env()->getNumberOfThreads();
+    const int arenaThreads = _daal_threader_get_arena_max_threads();
+    return (arenaThreads > 0 && size_t(arenaThreads) < nThreads) ? size_t(arenaThreads) : nThreads;
 }
 
 inline size_t setNumberOfThreads(const size_t numThreads, void ** init)
@@ -131,9 +159,52 @@ inline void threader_func_b(int i0, int in, const void * a)
     lambda(i0, in);
 }
 
+/* Index of the group of iterations of the deterministic parallel loop run by the calling thread, -1 outside of such loops */
+inline int threader_get_group()
+{
+    return *_daal_threader_group_ptr();
+}
+
+/* Returns true if the loop of n iterations is to be run by threader_for_groups() */
+inline bool threader_is_deterministic(int n)
+{
+    return n > 0 && threader_env()->getDeterministicGroups();
+}
+
+/* Deterministic mode: splits n iterations into the groups of consecutive iterations, their number depends on n only.
+   Every group runs in one thread in the order of its iterations and func(iGroup, begin, end) marks the thread with the index of the group,
+   so tls::local() returns the value of the group. The loops nested in a group run in the calling thread */
+template <typename F>
+inline void threader_for_groups(int n, const F & func)
+{
+    if (threader_get_group() >= 0)
+    {
+        func(threader_get_group(), 0, n);
+        return;
+    }
+    const size_t nGroupsMax = threader_env()->getDeterministicGroups();
+    const int nGroups       = (size_t(n) < nGroupsMax) ? n : int(nGroupsMax);
+    auto groupBody          = [&](int iGroup) {
+        int * const group   = _daal_threader_group_ptr();
+        const int prevGroup = *group;
+        *group              = iGroup;
+        func(iGroup, int(size_t(n) * iGroup / nGroups), int(size_t(n) * (iGroup + 1) / nGroups));
+        *group = prevGroup;
+    };
+    _daal_threader_for(nGroups, nGroups, static_cast<const void *>(&groupBody), threader_func<decltype(groupBody)>);
+}
+
 template <typename F>
 inline void threader_for(int n, int threads_request, const F & lambda)
 {
+    if (threader_is_deterministic(n))
+    {
+        threader_for_groups(n, [&](int, int begin, int end) {
+            for (int i = begin; i < end; ++i) lambda(i);
+        });
+        return;
+    }
+
     const void * a = static_cast<const void *>(&lambda);
 
     _daal_threader_for(n, threads_request, a, threader_func<F>);
@@ -142,6 +213,12 @@ inline void threader_for(int n, int threads_request, const F & lambda)
 template <typename F>
 inline void threader_for_blocked(int n, int threads_request, const F & lambda)
 {
+    if (threader_is_deterministic(n))
+    {
+        threader_for_groups(n, [&](int, int begin, int end) { lambda(begin, end - begin); });
+        return;
+    }
+
     const void * a = static_cast<const void *>(&lambda);
 
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
@@ -150,11 +227,194 @@ inline void threader_for_blocked(int n, int threads_request, const F & lambda)
 template <typename F>
 inline void threader_for_optional(int n, int threads_request, const F & lambda)
 {
+    if (threader_is_deterministic(n))
+    {
+        threader_for(n, threads_request, lambda);
+        return;
+    }
+
     const void * a = static_cast<const void *>(&lambda);
 
     _daal_threader_for_optional(n, threads_request, a, threader_func<F>);
 }
 
+/* Remembers the threads that ran the iterations of the parallel loop, so the next loop over the same range given the same partitioner
+ * runs every iteration in the thread that ran it before and finds the data of the iteration in the cache of that thread.
+ * The iterative algorithms keep one partitioner for the loop repeated at every iteration */
+class affinity_partitioner
+{
+public:
+    affinity_partitioner() : _ptr(_daal_new_affinity_partitioner()) {}
+    ~affinity_partitioner() { _daal_del_affinity_partitioner(_ptr); }
+
+    void * get() const { return _ptr; }
+
+private:
+    affinity_partitioner(const affinity_partitioner &);
+    affinity_partitioner & operator=(const affinity_partitioner &);
+
+    void * _ptr;
+};
+
+/* threader_for() that keeps the mapping of the iterations to the threads in the partitioner, null partitioner runs threader_for() */
+template <typename F>
+inline void threader_for_affinity(int n, int threads_request, affinity_partitioner * partitioner, const F & lambda)
+{
+    if (!partitioner || !partitioner->get() || threader_is_deterministic(n))
+    {
+        threader_for(n, threads_request, lambda);
+        return;
+    }
+
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_affinity(n, threads_request, a, threader_func<F>, partitioner->get());
+}
+
+template <typename F>
+inline void threader_for_blocked_affinity(int n, int threads_request, affinity_partitioner * partitioner, const F & lambda)
+{
+    if (!partitioner || !partitioner->get() || threader_is_deterministic(n))
+    {
+        threader_for_blocked(n, threads_request, lambda);
+        return;
+    }
+
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_affinity(n, threads_request, a, threader_func_b<F>, partitioner->get());
+}
+
+/* Combines n values by pairs in ceil(log2(n)) rounds, the pairs of a round are combined in parallel.
+ * combine(dst, src) merges the value with index src into the value with index dst, the result is in the value with index 0 */
+template <typename F>
+inline void tree_reduce(size_t n, const F & combine)
+{
+    for (size_t stride = 1; stride < n; stride *= 2)
+    {
+        const size_t nPairs = (n - stride + 2 * stride - 1) / (2 * stride);
+        if (nPairs == 1)
+        {
+            combine(size_t(0), stride);
+            continue;
+        }
+        threader_for(nPairs, nPairs, [&](int iPair) {
+            const size_t dst = size_t(iPair) * 2 * stride;
+            combine(dst, dst + stride);
+        });
+    }
+}
+
+/* Runs the lambda in the arena created by _daal_new_arena(), the parallel loops of the lambda use the threads of the arena only.
+ * Inside a group of the deterministic mode the lambda runs in the calling thread as the other nested parallel constructs */
+template <typename F>
+inline void threader_execute_in_arena(void * arena, const F & lambda)
+{
+    if (threader_get_group() >= 0)
+    {
+        lambda(0);
+        return;
+    }
+
+    const void * a = static_cast<const void *>(&lambda);
+
+    _daal_execute_in_arena(arena, a, threader_func<F>);
+}
+
+template <typename L, typename R>
+struct threader_invoke_args
+{
+    threader_invoke_args(const L & l, const R & r) : left(l), right(r) {}
+    const L & left;
+    const R & right;
+
+private:
+    threader_invoke_args & operator=(const threader_invoke_args &);
+};
+
+template <typename L, typename R>
+inline void threader_invoke_func(int i, const void * a)
+{
+    const threader_invoke_args<L, R> & args = *static_cast<const threader_invoke_args<L, R> *>(a);
+    if (i == 0)
+        args.left();
+    else
+        args.right();
+}
+
+/* Forks left() and right() as two tasks that may run in parallel and joins them before returning.
+   Calls can be nested at any depth: a thread waiting for the join executes pending branches of other threads,
+   so recursive algorithms may fork at every level of the recursion. */
+template <typename L, typename R>
+inline void threader_invoke(const L & left, const R & right)
+{
+    /* In the deterministic mode the functions run one after another, so the thread local values they use are created in the fixed order */
+    if (threader_get_group() >= 0 || threader_env()->getDeterministicGroups())
+    {
+        left();
+        right();
+        return;
+    }
+    const threader_invoke_args<L, R> args(left, right);
+    _daal_threader_invoke(&args, threader_invoke_func<L, R>);
+}
+
+/* Same as threader_invoke(left, right), but runs both branches in the calling thread
+   when the size of the subproblem is below grainSize and forking does not pay off */
+template <typename L, typename R>
+inline void threader_invoke(size_t size, size_t grainSize, const L & left, const R & right)
+{
+    if (size < grainSize)
+    {
+        left();
+        right();
+    }
+    else
+    {
+        threader_invoke(left, right);
+    }
+}
+
+/* Forks left() and right(), joins them and then runs the continuation join() in the calling thread */
+template <typename L, typename R, typename C>
+inline void threader_fork_join(size_t size, size_t grainSize, const L & left, const R & right, const C & join)
+{
+    threader_invoke(size, grainSize, left, right);
+    join();
+}
+
+template <typename F>
+struct threader_recursive_for_body
+{
+    threader_recursive_for_body(size_t b, size_t e, size_t g, const F & f) : begin(b), end(e), grainSize(g), func(f) {}
+    void operator()() const
+    {
+        if (end - begin <= grainSize)
+        {
+            func(begin, end);
+            return;
+        }
+        const size_t middle = begin + (end - begin) / 2;
+        threader_invoke(threader_recursive_for_body<F>(begin, middle, grainSize, func), threader_recursive_for_body<F>(middle, end, grainSize, func));
+    }
+    size_t begin;
+    size_t end;
+    size_t grainSize;
+    const F & func;
+
+private:
+    threader_recursive_for_body & operator=(const threader_recursive_for_body &);
+};
+
+/* Splits [begin, end) in halves recursively down to ranges of at most grainSize elements and calls func(rangeBegin, rangeEnd)
+   for every range. Unlike threader_for_blocked the splitting is done by forking tasks and is safe to nest inside other tasks. */
+template <typename F>
+inline void threader_recursive_for(size_t begin, size_t end, size_t grainSize, const F & func)
+{
+    if (begin >= end) return;
+    threader_recursive_for_body<F>(begin, end, grainSize ? grainSize : 1, func)();
+}
+
 template <typename lambdaType>
 inline void * tls_func(const void * a)
 {
@@ -189,12 +449,15 @@ public:
     virtual void del(void * a) { delete static_cast<lambdaType *>(a); }
 };
 
+/* In the deterministic mode the values are kept for the groups of iterations of threader_for_groups() instead of the threads,
+ * the values of the groups are reduced first in the order of the groups. The values created outside of the groups are kept per thread
+ * and reduced in an unspecified order after them */
 template <typename F>
 class tls : public tlsBase
 {
 public:
     template <typename lambdaType>
-    explicit tls(const lambdaType & lambda)
+    explicit tls(const lambdaType & lambda) : groupValues(nullptr), nGroups(0)
     {
         lambdaType * locall = new lambdaType(lambda);
         d                   = new tls_deleter_<lambdaType>();
@@ -203,12 +466,21 @@ public:
         const void * ac = static_cast<const void *>(locall);
         void * a        = const_cast<void *>(ac);
         voidLambda      = a;
+        createFunc      = tls_func<lambdaType>;
 
         tlsPtr = _daal_get_tls_ptr(a, tls_func<lambdaType>);
+
+        const size_t nDeterministicGroups = threader_env()->getDeterministicGroups();
+        if (nDeterministicGroups)
+        {
+            groupValues = static_cast<F *>(daal::services::daal_calloc(nDeterministicGroups * sizeof(F)));
+            if (groupValues) nGroups = nDeterministicGroups;
+        }
     }
 
     virtual ~tls()
     {
+        daal::services::daal_free(groupValues);
         d->del(voidLambda);
         delete d;
         _daal_del_tls_ptr(tlsPtr);
@@ -216,6 +488,12 @@ public:
 
     F local()
     {
+        const int group = threader_get_group();
+        if (group >= 0 && size_t(group) < nGroups)
+        {
+            if (!groupValues[group]) groupValues[group] = static_cast<F>(createFunc(voidLambda));
+            return groupValues[group];
+        }
         void * pf = _daal_get_tls_local(tlsPtr);
         return (static_cast<F>(pf));
     }
@@ -223,6 +501,7 @@ public:
     template <typename lambdaType>
     void reduce(const lambdaType & lambda)
     {
+        reduceGroups(lambda);
         const void * ac = static_cast<const void *>(&lambda);
         void * a        = const_cast<void *>(ac);
         _daal_reduce_tls(tlsPtr, a, tls_reduce_func<F, lambdaType>);
@@ -231,17 +510,53 @@ public:
     template <typename lambdaType>
     void parallel_reduce(const lambdaType & lambda)
     {
+        reduceGroups(lambda);
         const void * ac = static_cast<const void *>(&lambda);
         void * a        = const_cast<void *>(ac);
         _daal_parallel_reduce_tls(tlsPtr, a, tls_reduce_func<F, lambdaType>);
     }
 
+    /* Combines the local values by tree_reduce() and passes the combined value to the lambda.
+     * combine(dst, src) merges src into dst and releases src, the lambda releases the combined value.
+     * If there is no memory for the tree, the local values are passed to the lambda one by one as in reduce() */
+    template <typename combineType, typename lambdaType>
+    void tree_reduce(const combineType & combine, const lambdaType & lambda)
+    {
+        size_t n = 0;
+        reduce([&](F) { ++n; });
+        F * values = n > 2 ? static_cast<F *>(daal::services::daal_malloc(n * sizeof(F))) : nullptr;
+        if (!values)
+        {
+            reduce(lambda);
+            return;
+        }
+        size_t i = 0;
+        reduce([&](F v) { values[i++] = v; });
+        daal::tree_reduce(n, [&](size_t dst, size_t src) { combine(values[dst], values[src]); });
+        lambda(values[0]);
+        daal::services::daal_free(values);
+    }
+
 private:
+    template <typename lambdaType>
+    void reduceGroups(const lambdaType & lambda)
+    {
+        for (size_t i = 0; i < nGroups; ++i)
+        {
+            if (groupValues[i]) lambda(groupValues[i]);
+        }
+    }
+
     void * tlsPtr;
     void * voidLambda;
     tls_deleter * d;
+    void * (*createFunc)(const void *);
+    F * groupValues; /* Values of the groups of iterations in the deterministic mode */
+    size_t nGroups;
 };
 
+/* The values are not bound to the groups of the deterministic mode: a value is taken by the first thread that requests it,
+ * so ls suits the scratch buffers and is not to be used for the partial results that are reduced */
 template <typename F>
 class ls : public tlsBase
 {
@@ -318,6 +633,28 @@ inline bool is_in_parallel()
     return _daal_is_in_parallel();
 }
 
+/* Atomically replaces the value pointed by ptr with desired if it is equal to expected, returns the previous value */
+inline int atomic_compare_exchange(int * ptr, int expected, int desired)
+{
+    return _daal_atomic_compare_exchange_int(ptr, expected, desired);
+}
+
+/* Atomically adds value to the element pointed by ptr, no ordering of the other memory accesses is imposed */
+inline void atomic_add(float * ptr, float value)
+{
+    _daal_atomic_add_float(ptr, value);
+}
+
+inline void atomic_add(double * ptr, double value)
+{
+    _daal_atomic_add_double(ptr, value);
+}
+
+inline void atomic_add(size_t * ptr, size_t value)
+{
+    _daal_atomic_add_size_t(ptr, value);
+}
+
 } // namespace daal
 
 #endif
@@ -0,0 +1,76 @@
+/* file: cholesky_batched_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of Cholesky decomposition of many small matrices in one call
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CHOLESKY_BATCHED_BATCH"></a>
+ * \example cholesky_batched_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nMatrices = 10000;
+const size_t dim       = 4;
+
+int main(int argc, char * argv[])
+{
+    /* Create the table with one symmetric positive-definite matrix of size dim x dim in each row */
+    NumericTablePtr dataTable = HomogenNumericTable<>::create(dim * dim, nMatrices, NumericTable::doAllocate);
+
+    BlockDescriptor<float> block;
+    dataTable->getBlockOfRows(0, nMatrices, writeOnly, block);
+    float * matrices = block.getBlockPtr();
+    for (size_t k = 0; k < nMatrices; k++)
+    {
+        float * a = matrices + k * dim * dim;
+        for (size_t i = 0; i < dim; i++)
+        {
+            for (size_t j = 0; j < dim; j++)
+            {
+                a[i * dim + j] = (i == j) ? (float)(dim + k % 10) : 1.0f / (float)(1 + i + j);
+            }
+        }
+    }
+    dataTable->releaseBlockOfRows(block);
+
+    /* Create an algorithm to compute Cholesky decomposition of the matrices in the rows of the table */
+    cholesky::Batch<float, cholesky::batchedDense> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(cholesky::data, dataTable);
+
+    /* Compute Cholesky decomposition */
+    algorithm.compute();
+
+    /* Get computed Cholesky decomposition, each row contains the lower triangular factor of the corresponding matrix */
+    cholesky::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(cholesky::choleskyFactor), "Cholesky factors of the first matrices:", 5);
+
+    return 0;
+}
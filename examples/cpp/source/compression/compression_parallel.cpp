@@ -0,0 +1,163 @@
+/* file: compression_parallel.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of compression of independent data chunks in parallel
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COMPRESSION_PARALLEL"></a>
+ * \example compression_parallel.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+string datasetFileName = "../data/online/logitboost_train.csv";
+
+DataBlock sentDataStream;     /* Data stream to compress */
+DataBlock compressedData;     /* Compressed data stream with the chunk index */
+DataBlock receivedDataStream; /* Received uncompressed data stream */
+
+const size_t maxDataBlockSize = 16384; /* Maximum size of a data block written to the compression stream */
+const size_t chunkSize        = 32768; /* Size of the chunks compressed independently */
+
+void prepareMemory();
+void releaseMemory();
+void printCRC32();
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Read data from a file and allocate memory */
+    prepareMemory();
+
+    /* Create a compressor */
+    Compressor<zlib> compressor;
+    compressor.parameter.level = level9;
+
+    /* Create a stream that compresses the chunks of chunkSize bytes in parallel */
+    ParallelCompressionStream compressionStream(&compressor, chunkSize);
+
+    /* Write the data to compressionStream by blocks */
+    for (size_t offset = 0; offset < sentDataStream.getSize(); offset += maxDataBlockSize)
+    {
+        const size_t blockSize = min(maxDataBlockSize, sentDataStream.getSize() - offset);
+        compressionStream << DataBlock(sentDataStream.getPtr() + offset, blockSize);
+    }
+
+    /* Compress the remaining data and copy the compressed data with the chunk index */
+    compressedData.setSize(compressionStream.getCompressedDataSize());
+    compressedData.setPtr(new byte[compressedData.getSize()]);
+    compressionStream.copyCompressedArray(compressedData);
+
+    cout << "Number of compressed chunks: " << compressionStream.getNumberOfChunks() << endl;
+
+    /* Create a decompressor */
+    Decompressor<zlib> decompressor;
+
+    /* Create a stream that decompresses the chunks in parallel */
+    ParallelDecompressionStream decompressionStream(&decompressor);
+    decompressionStream << compressedData;
+
+    /* Decompress all the data */
+    receivedDataStream.setSize(decompressionStream.copyDecompressedArray(receivedDataStream.getPtr(), sentDataStream.getSize()));
+
+    /* Decompress only the chunks that overlap with the range of bytes in the middle of the data */
+    const size_t rangeOffset = sentDataStream.getSize() / 2;
+    const size_t rangeSize   = min(chunkSize, sentDataStream.getSize() - rangeOffset);
+    byte * range             = new byte[rangeSize];
+    decompressionStream.copyDecompressedArray(rangeOffset, range, rangeSize);
+
+    /* Compute and print checksums for sentDataStream and receivedDataStream */
+    printCRC32();
+
+    unsigned int crcSentRange     = getCRC32(sentDataStream.getPtr() + rangeOffset, 0, rangeSize);
+    unsigned int crcReceivedRange = getCRC32(range, 0, rangeSize);
+    cout << (crcSentRange == crcReceivedRange ? "OK: Randomly accessed range CRC matches with the sent data CRC"
+                                              : "ERROR: Randomly accessed range CRC mismatches with the sent data CRC")
+         << endl;
+    delete[] range;
+
+    releaseMemory();
+
+    return 0;
+}
+
+void prepareMemory()
+{
+    /* Allocate sentDataStream and read an input file */
+    byte * data;
+    sentDataStream.setSize(readTextFile(datasetFileName, &data));
+    sentDataStream.setPtr(data);
+
+    /* Allocate memory for receivedDataStream */
+    byte * receivedData = (byte *)daal::services::daal_malloc(sentDataStream.getSize());
+    checkAllocation(receivedData);
+    receivedDataStream.setPtr(receivedData);
+}
+
+void printCRC32()
+{
+    unsigned int crcSentDataStream     = 0;
+    unsigned int crcReceivedDataStream = 0;
+
+    /* Compute checksums for full input data and full received data */
+    crcSentDataStream     = getCRC32(sentDataStream.getPtr(), crcSentDataStream, sentDataStream.getSize());
+    crcReceivedDataStream = getCRC32(receivedDataStream.getPtr(), crcReceivedDataStream, receivedDataStream.getSize());
+
+    cout << endl << "Compression example program results:" << endl << endl;
+
+    cout << "Input data checksum:    0x" << hex << crcSentDataStream << endl;
+    cout << "Received data checksum: 0x" << hex << crcReceivedDataStream << endl;
+
+    if (sentDataStream.getSize() != receivedDataStream.getSize())
+    {
+        cout << "ERROR: Received data size mismatches with the sent data size" << endl;
+    }
+    else if (crcSentDataStream != crcReceivedDataStream)
+    {
+        cout << "ERROR: Received data CRC mismatches with the sent data CRC" << endl;
+    }
+    else
+    {
+        cout << "OK: Received data CRC matches with the sent data CRC" << endl;
+    }
+}
+
+void releaseMemory()
+{
+    if (compressedData.getPtr())
+    {
+        delete[] compressedData.getPtr();
+    }
+    if (receivedDataStream.getPtr())
+    {
+        daal::services::daal_free(receivedDataStream.getPtr());
+    }
+    if (sentDataStream.getPtr())
+    {
+        delete[] sentDataStream.getPtr();
+    }
+}
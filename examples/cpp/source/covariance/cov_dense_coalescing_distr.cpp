@@ -0,0 +1,160 @@
+/* file: cov_dense_coalescing_distr.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense variance-covariance matrix computation in the
+!    distributed processing mode with the data blocks on the local nodes
+!    smaller than the coalescing buffer
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COVARIANCE_DENSE_COALESCING_DISTRIBUTED">
+ * \example cov_dense_coalescing_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nBlocks       = 4;
+const size_t nObservations = 5;
+
+/* Number of rows of the buffer the small data blocks are coalesced in on the local nodes */
+const size_t coalescingBlockSize = 16;
+
+const string datasetFileNames[] = { "../data/distributed/covcormoments_dense_1.csv", "../data/distributed/covcormoments_dense_2.csv",
+                                    "../data/distributed/covcormoments_dense_3.csv", "../data/distributed/covcormoments_dense_4.csv" };
+
+covariance::PartialResultPtr computestep1Local(size_t block, size_t blockSize);
+covariance::ResultPtr computeOnMasterNode(covariance::PartialResultPtr * partialResult);
+covariance::PartialResultPtr serializeAndRestore(const covariance::PartialResultPtr & partialResult);
+double getMaxAbsDifference(const NumericTablePtr & table1, const NumericTablePtr & table2);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    covariance::PartialResultPtr partialResult[nBlocks];
+    covariance::PartialResultPtr referencePartialResult[nBlocks];
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        /* The partial results are sent to the master node without finalizing them on the local nodes,
+           the rows left in the coalescing buffer travel inside the serialized partial result */
+        partialResult[i]          = serializeAndRestore(computestep1Local(i, coalescingBlockSize));
+        referencePartialResult[i] = computestep1Local(i, 0);
+    }
+
+    covariance::ResultPtr result          = computeOnMasterNode(partialResult);
+    covariance::ResultPtr referenceResult = computeOnMasterNode(referencePartialResult);
+
+    printNumericTable(result->get(covariance::covariance), "Covariance matrix:");
+    printNumericTable(result->get(covariance::mean), "Mean vector:");
+
+    const double covarianceDifference = getMaxAbsDifference(result->get(covariance::covariance), referenceResult->get(covariance::covariance));
+    const double meanDifference       = getMaxAbsDifference(result->get(covariance::mean), referenceResult->get(covariance::mean));
+    std::cout << "Max difference from the computation without coalescing: " << std::max(covarianceDifference, meanDifference) << std::endl;
+
+    return (covarianceDifference < 1e-3 && meanDifference < 1e-3) ? 0 : -1;
+}
+
+covariance::PartialResultPtr computestep1Local(size_t block, size_t blockSize)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to compute a dense variance-covariance matrix in the distributed processing mode using the default method */
+    covariance::Distributed<step1Local> algorithm;
+    algorithm.parameter.coalescingBlockSize = blockSize;
+
+    while (dataSource.loadDataBlock(nObservations) == nObservations)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(covariance::data, dataSource.getNumericTable());
+
+        /* Compute partial estimates on the local node */
+        algorithm.compute();
+    }
+
+    /* Get the computed partial estimates */
+    return algorithm.getPartialResult();
+}
+
+covariance::ResultPtr computeOnMasterNode(covariance::PartialResultPtr * partialResult)
+{
+    /* Create an algorithm to compute a dense variance-covariance matrix in the distributed processing mode using the default method */
+    covariance::Distributed<step2Master> algorithm;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(covariance::partialResults, partialResult[i]);
+    }
+
+    /* Compute a partial estimate on the master node from the partial estimates on local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed dense variance-covariance matrix */
+    return algorithm.getResult();
+}
+
+covariance::PartialResultPtr serializeAndRestore(const covariance::PartialResultPtr & partialResult)
+{
+    /* Serialize the partial result into the data archive */
+    InputDataArchive inputArch;
+    partialResult->serialize(inputArch);
+
+    const size_t length = inputArch.getSizeOfArchive();
+    byte * buffer       = new byte[length];
+    inputArch.copyArchiveToArray(buffer, length);
+
+    /* Deserialize the partial result from the data archive */
+    OutputDataArchive outputArch(buffer, length);
+    covariance::PartialResultPtr restoredPartialResult(new covariance::PartialResult());
+    restoredPartialResult->deserialize(outputArch);
+
+    delete[] buffer;
+    return restoredPartialResult;
+}
+
+double getMaxAbsDifference(const NumericTablePtr & table1, const NumericTablePtr & table2)
+{
+    const size_t nRows = table1->getNumberOfRows();
+    BlockDescriptor<double> block1, block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+
+    double maxDifference = 0.0;
+    const size_t size    = nRows * table1->getNumberOfColumns();
+    for (size_t i = 0; i < size; i++)
+    {
+        maxDifference = std::max(maxDifference, std::abs(block1.getBlockPtr()[i] - block2.getBlockPtr()[i]));
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return maxDifference;
+}
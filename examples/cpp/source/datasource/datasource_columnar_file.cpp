@@ -0,0 +1,65 @@
+/* file: datasource_columnar_file.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of writing a numeric table to the columnar binary file
+!    and of mapping the file into memory
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_COLUMNAR_FILE"></a>
+ * \example datasource_columnar_file.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName  = "../data/batch/kmeans_dense.csv";
+string columnarFileName = "kmeans_dense.daalcf";
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Load data from .csv file */
+    dataSource.loadDataBlock();
+    NumericTablePtr table = dataSource.getNumericTable();
+
+    /* Write the data to the columnar binary file, each column is stored in a separate aligned section */
+    services::Status status = ColumnarFile::write(columnarFileName, *table, ColumnarFile::columnMajor);
+    checkStatus(status);
+
+    /* Map the file into memory, the data is read from disk on first access to the pages of the file */
+    NumericTablePtr mappedTable = ColumnarFile::map(columnarFileName, &status);
+    checkStatus(status);
+
+    /* Print result */
+    printNumericTable(table, "Data loaded from .csv file", 4, 20);
+    printNumericTable(mappedTable, "Data mapped from columnar file", 4, 20);
+
+    return 0;
+}
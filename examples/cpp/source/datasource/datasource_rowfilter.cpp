@@ -0,0 +1,69 @@
+/* file: datasource_rowfilter.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of loading a subset of columns and rows from a .csv file
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASOURCE_ROWFILTER"></a>
+ * \example datasource_rowfilter.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable);
+
+    /* Create data source dictionary from loading of the first .csv file */
+    dataSource.createDictionaryFromContext();
+
+    /* Filter in 3 leading columns from a .csv file, the remaining columns of a row are not parsed */
+    services::Collection<size_t> validList(3);
+    validList[0] = 0;
+    validList[1] = 1;
+    validList[2] = 2;
+
+    dataSource.getFeatureManager().addModifier(ColumnFilter().list(validList));
+
+    /* Load only the rows with positive values in the columns with indices 0 and 4,
+       the rows are checked before their values are converted */
+    dataSource.getFeatureManager().setRowFilter(RowFilter().greater(0, 0.0).greater(4, 0.0));
+
+    /* Load data from .csv file */
+    dataSource.loadDataBlock();
+
+    /* Print result */
+    NumericTablePtr table = dataSource.getNumericTable();
+    printNumericTable(table, "Loaded data", 4, 20);
+
+    return 0;
+}
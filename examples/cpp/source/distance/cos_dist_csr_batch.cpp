@@ -0,0 +1,72 @@
+/* file: cos_dist_csr_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing a cosine distance matrix for the data in the
+!    compressed sparse row format
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COSINE_DISTANCE_CSR_BATCH"></a>
+ * \example cos_dist_csr_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters
+   Input matrix is stored in the compressed sparse row format with one-based indexing
+ */
+const string datasetFileName = "../data/batch/covcormoments_csr.csv";
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Read datasetFileName from a file and create a numeric table to store input data */
+    CSRNumericTablePtr dataTable(createSparseTable<float>(datasetFileName));
+
+    /* Create an algorithm to compute a cosine distance matrix using the method for the CSR data */
+    cosine_distance::Batch<float, cosine_distance::fastCSR> algorithm;
+    algorithm.input.set(cosine_distance::data, dataTable);
+
+    /* Compute a cosine distance matrix */
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(cosine_distance::cosineDistance), "Cosine distance (upper left square 10*10) :", 10, 10);
+
+    /* Create an algorithm that stores only the distances to at most 5 nearest vectors that are not farther than 0.9
+       in the CSR numeric table */
+    cosine_distance::Batch<float, cosine_distance::fastCSR> sparseAlgorithm;
+    sparseAlgorithm.input.set(cosine_distance::data, dataTable);
+    sparseAlgorithm.parameter.resultFormat = cosine_distance::sparseResult;
+    sparseAlgorithm.parameter.maxDistance  = 0.9;
+    sparseAlgorithm.parameter.k            = 5;
+
+    sparseAlgorithm.compute();
+
+    printNumericTable(sparseAlgorithm.getResult()->get(cosine_distance::cosineDistance), "Sparse cosine distance (upper left square 10*10) :",
+                      10, 10);
+
+    return 0;
+}
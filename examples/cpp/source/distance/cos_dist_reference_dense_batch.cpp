@@ -0,0 +1,69 @@
+/* file: cos_dist_reference_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing the cosine distances between the query vectors
+!    and the reference vectors
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COSINE_DISTANCE_REFERENCE_BATCH"></a>
+ * \example cos_dist_reference_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/distance.csv";
+const size_t nQueryVectors   = 5;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the reference data from a .csv file */
+    FileDataSource<CSVFeatureManager> referenceSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    referenceSource.loadDataBlock();
+
+    /* Use the first vectors of the data set as the query vectors */
+    FileDataSource<CSVFeatureManager> querySource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    querySource.loadDataBlock(nQueryVectors);
+
+    /* Create an algorithm to compute the cosine distances using the default method */
+    cosine_distance::Batch<> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(cosine_distance::data, querySource.getNumericTable());
+    algorithm.input.set(cosine_distance::referenceData, referenceSource.getNumericTable());
+
+    /* Compute the distances between the query vectors and the reference vectors */
+    algorithm.compute();
+
+    /* Get the computed distances, one row per query vector */
+    cosine_distance::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(cosine_distance::cosineDistance), "Cosine distance from the query vectors", nQueryVectors, 15);
+
+    return 0;
+}
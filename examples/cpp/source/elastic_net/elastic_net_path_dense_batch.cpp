@@ -0,0 +1,89 @@
+/* file: elastic_net_path_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the regularization path of elastic net in the batch processing mode.
+!
+!    The program trains the sequence of elastic net models for the decreasing
+!    L1 penalties on a training data set. Each model is warm-started from
+!    the previous one.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ELASTIC_NET_PATH_BATCH"></a>
+ * \example elastic_net_path_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::elastic_net;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+const size_t nPath               = 5;  /* Number of L1 penalties on the regularization path */
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(HomogenNumericTable<>::create(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(HomogenNumericTable<>::create(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(MergedNumericTable::create(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create the decreasing sequence of L1 penalties shared by all dependent variables */
+    float l1Path[nPath] = { 10.0f, 3.0f, 1.0f, 0.3f, 0.1f };
+    NumericTablePtr penaltyL1Path(HomogenNumericTable<>::create(l1Path, 1, nPath));
+
+    /* Create an algorithm object to train the sequence of elastic net models */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    algorithm.parameter().penaltyL2     = NumericTablePtr(HomogenNumericTable<>::create(nDependentVariables, 1, NumericTable::doAllocate, 0.5f));
+    algorithm.parameter().penaltyL1Path = penaltyL1Path;
+
+    /* Build the elastic net models on the regularization path */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    DataCollectionPtr pathModels       = trainingResult->get(training::pathModels);
+    for (size_t i = 0; i < pathModels->size(); i++)
+    {
+        ModelPtr pathModel = Model::cast((*pathModels)[i]);
+        cout << "L1 penalty: " << l1Path[i] << endl;
+        printNumericTable(pathModel->getBeta(), "Elastic Net coefficients:");
+    }
+
+    return 0;
+}
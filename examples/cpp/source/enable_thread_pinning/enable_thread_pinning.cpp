@@ -55,6 +55,9 @@ int main(int argc, char * argv[])
 
     init.input.set(kmeans::init::data, dataSource.getNumericTable());
 
+    /* Pins the threads to the processors of one NUMA node before the next one */
+    services::Environment::getInstance()->setThreadPinningPolicy(services::Environment::compactThreadPinning);
+
     /* Enables thread pinning for next algorithm runs */
     services::Environment::getInstance()->enableThreadPinning(true);
 
@@ -71,8 +74,14 @@ int main(int argc, char * argv[])
     algorithm.input.set(kmeans::data, dataSource.getNumericTable());
     algorithm.input.set(kmeans::inputCentroids, centroids);
 
-    /* Run computations */
-    algorithm.compute();
+    {
+        /* Runs the computations in the arena of the threads pinned to the first NUMA node.
+           The memory allocated by the algorithm is placed on that node */
+        services::NumaNodeScope numaNodeScope(0);
+
+        /* Run computations */
+        algorithm.compute();
+    }
 
     /* Print the clusterization results */
     printNumericTable(algorithm.getResult()->get(kmeans::assignments), "First 10 cluster assignments:", 10);
@@ -0,0 +1,81 @@
+/* file: kmeans_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense K-Means clustering in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_ONLINE"></a>
+ * \example kmeans_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName      = "../data/batch/kmeans_dense.csv";
+const size_t nVectorsInBlock = 1000;
+
+/* K-Means algorithm parameters */
+const size_t nClusters = 20;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the first block of the data from the input file */
+    dataSource.loadDataBlock(nVectorsInBlock);
+
+    /* Get initial clusters for the K-Means algorithm from the first block */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, dataSource.getNumericTable());
+    init.compute();
+
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Create an algorithm object for the K-Means algorithm in the online processing mode */
+    kmeans::Online<> algorithm(nClusters);
+
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+
+    do
+    {
+        /* Update the centroids with the next block of the data */
+        algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+        algorithm.compute();
+    } while (dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock);
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Print the clusterization results */
+    printNumericTable(algorithm.getResult()->get(kmeans::centroids), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(algorithm.getResult()->get(kmeans::objectiveFunction), "Objective function value:");
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/* file: kmeans_predict_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the assignment of the observations to the trained K-Means centroids
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_PREDICT_DENSE_BATCH"></a>
+ * \example kmeans_predict_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, dataSource.getNumericTable());
+    init.compute();
+
+    /* Train the centroids with the K-Means algorithm without computing the assignments */
+    kmeans::Batch<> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data, dataSource.getNumericTable());
+    algorithm.input.set(kmeans::inputCentroids, init.getResult()->get(kmeans::init::centroids));
+
+    algorithm.compute();
+
+    /* Assign the observations to the nearest trained centroids */
+    kmeans::prediction::Batch<> prediction;
+
+    prediction.input.set(kmeans::prediction::data, dataSource.getNumericTable());
+    prediction.input.set(kmeans::prediction::inputCentroids, algorithm.getResult()->get(kmeans::centroids));
+
+    prediction.compute();
+
+    /* Print the assignments */
+    printNumericTable(prediction.getResult()->get(kmeans::prediction::assignments), "First 10 cluster assignments:", 10);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/* file: lasso_reg_block_cd_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of lasso regression training with the block coordinate descent solver
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LASSO_REGRESSION_BLOCK_CD_BATCH"></a>
+ * \example lasso_reg_block_cd_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms;
+using namespace daal::algorithms::lasso_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName  = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+const size_t featureBlockSize    = 4;  /* Maximal number of coordinates updated simultaneously */
+
+void trainModel();
+void testModel();
+
+training::ResultPtr trainingResult;
+prediction::ResultPtr predictionResult;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    testModel();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create the coordinate descent solver that updates blocks of weakly correlated coordinates in parallel
+       and skips the coordinates discarded by the strong rule screening */
+    services::SharedPtr<optimization_solver::coordinate_descent::Batch<> > cdAlgorithm = optimization_solver::coordinate_descent::Batch<>::create();
+    cdAlgorithm->parameter().nIterations            = 10000;
+    cdAlgorithm->parameter().accuracyThreshold      = 0.00001;
+    cdAlgorithm->parameter().skipTheFirstComponents = true;
+    cdAlgorithm->parameter().featureBlockSize       = featureBlockSize;
+    cdAlgorithm->parameter().screening              = true;
+
+    /* Create an algorithm object to train the multiple lasso regression model */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariables, trainDependentVariables);
+    algorithm.parameter().lassoParameters    = NumericTablePtr(new HomogenNumericTable<>(nDependentVariables, 1, NumericTable::doAllocate, 0.01f));
+    algorithm.parameter().optimizationSolver = cdAlgorithm;
+
+    /* Build the multiple lasso regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    trainingResult = algorithm.getResult();
+    printNumericTable(trainingResult->get(training::model)->getBeta(), "LASSO Regression coefficients:");
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testGroundTruth(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Load the data from the data file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict values of multiple lasso regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of multiple lasso regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction), "LASSO Regression prediction results: (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
@@ -0,0 +1,76 @@
+/* file: lin_reg_norm_eq_dense_pipeline.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple linear regression in the online processing mode.
+!
+!    The program trains the multiple linear regression model with the normal
+!    equations method on the blocks of the training data set that are loaded
+!    while the previous blocks are processed.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LINEAR_REGRESSION_NORM_EQ_PIPELINE"></a>
+ * \example lin_reg_norm_eq_dense_pipeline.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::linear_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/online/linear_regression_train.csv";
+
+const size_t nTrainVectorsInBlock = 250;
+
+const size_t nFeatures           = 10; /* Number of features in training data set */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm object to train the multiple linear regression model */
+    training::Online<> algorithm;
+
+    /* Update the multiple linear regression model with all blocks of the data source */
+    training::OnlinePipeline pipeline(nFeatures, nDependentVariables, nTrainVectorsInBlock);
+    services::Status status = pipeline.compute<float>(algorithm, trainDataSource);
+    if (!status)
+    {
+        cout << "Error: " << status.getDescription() << endl;
+        return -1;
+    }
+    cout << "Number of processed rows: " << pipeline.getNumberOfProcessedRows() << endl;
+
+    /* Finalize the multiple linear regression model */
+    algorithm.finalizeCompute();
+
+    /* Retrieve the algorithm results */
+    training::ResultPtr trainingResult = algorithm.getResult();
+    printNumericTable(trainingResult->get(training::model)->getBeta(), "Linear Regression coefficients:");
+
+    return 0;
+}
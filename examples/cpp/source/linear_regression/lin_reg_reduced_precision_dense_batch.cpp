@@ -0,0 +1,126 @@
+/* file: lin_reg_reduced_precision_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of multiple linear regression prediction with the products
+!    of the data and the coefficients computed in reduced precision.
+!
+!    The program trains the multiple linear regression model with the normal
+!    equations method and compares the predictions computed in the bfloat16
+!    and 8-bit integer precisions with the predictions of the full precision.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LINEAR_REGRESSION_REDUCED_PRECISION_BATCH"></a>
+ * \example lin_reg_reduced_precision_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::linear_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName  = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+
+NumericTablePtr predict(const NumericTablePtr & testData, const linear_regression::ModelPtr & model, InferencePrecision precision);
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    /* Retrieve the training data and dependent variables from the .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainMergedData(new MergedNumericTable(trainData, trainDependentVariables));
+    trainDataSource.loadDataBlock(trainMergedData.get());
+
+    /* Build the multiple linear regression model with the normal equations method */
+    training::Batch<> trainingAlgorithm;
+    trainingAlgorithm.input.set(training::data, trainData);
+    trainingAlgorithm.input.set(training::dependentVariables, trainDependentVariables);
+    trainingAlgorithm.compute();
+    linear_regression::ModelPtr model = trainingAlgorithm.getResult()->get(training::model);
+
+    /* Retrieve the test data from the .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    NumericTablePtr testData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testGroundTruth(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testMergedData(new MergedNumericTable(testData, testGroundTruth));
+    testDataSource.loadDataBlock(testMergedData.get());
+
+    /* Reduced precision is enabled explicitly with the parameter of the prediction */
+    NumericTablePtr fullPrediction     = predict(testData, model, fullPrecision);
+    NumericTablePtr bfloat16Prediction = predict(testData, model, bfloat16Precision);
+    NumericTablePtr int8Prediction     = predict(testData, model, int8Precision);
+
+    printNumericTable(fullPrediction, "Linear Regression prediction results in full precision (first 10 rows):", 10);
+    printNumericTable(bfloat16Prediction, "Linear Regression prediction results in bfloat16 precision (first 10 rows):", 10);
+    printNumericTable(int8Prediction, "Linear Regression prediction results in int8 precision (first 10 rows):", 10);
+
+    std::cout << "Maximal absolute difference from full precision:" << std::endl;
+    std::cout << "bfloat16: " << maxAbsDifference(fullPrediction, bfloat16Prediction) << std::endl;
+    std::cout << "int8:     " << maxAbsDifference(fullPrediction, int8Prediction) << std::endl;
+
+    return 0;
+}
+
+NumericTablePtr predict(const NumericTablePtr & testData, const linear_regression::ModelPtr & model, InferencePrecision precision)
+{
+    prediction::Batch<> algorithm;
+    algorithm.parameter.inferencePrecision = precision;
+
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, model);
+
+    algorithm.compute();
+
+    return algorithm.getResult()->get(prediction::prediction);
+}
+
+float maxAbsDifference(const NumericTablePtr & a, const NumericTablePtr & b)
+{
+    const size_t nRows = a->getNumberOfRows();
+    const size_t nCols = a->getNumberOfColumns();
+
+    BlockDescriptor<float> aBlock, bBlock;
+    a->getBlockOfRows(0, nRows, readOnly, aBlock);
+    b->getBlockOfRows(0, nRows, readOnly, bBlock);
+
+    float maxDifference = 0.0f;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        const float difference = aBlock.getBlockPtr()[i] - bBlock.getBlockPtr()[i];
+        if (difference > maxDifference) maxDifference = difference;
+        if (-difference > maxDifference) maxDifference = -difference;
+    }
+
+    a->releaseBlockOfRows(aBlock);
+    b->releaseBlockOfRows(bBlock);
+    return maxDifference;
+}
@@ -0,0 +1,75 @@
+/* file: zscore_moments_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of Z-score normalization algorithm that reuses the low order moments
+!    computed in the online processing mode and writes the result to the input data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ZSCORE_MOMENTS_BATCH"></a>
+ * \example zscore_moments_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::algorithms::normalization;
+
+/* Input data set parameters */
+string datasetName = "../data/batch/normalization.csv";
+
+int main()
+{
+    /* Retrieve the input data */
+    FileDataSource<CSVFeatureManager> dataSource(datasetName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+    dataSource.loadDataBlock();
+
+    NumericTablePtr data = dataSource.getNumericTable();
+
+    printNumericTable(data, "First 10 rows of the input data:", 10);
+
+    /* Compute partial low order moments of the data in the online processing mode */
+    low_order_moments::Online<> moments;
+    moments.input.set(low_order_moments::data, data);
+    moments.compute();
+
+    /* Create an algorithm */
+    zscore::Batch<> algorithm;
+
+    /* Set input objects for the algorithm, the means and variances are obtained from the partial moments */
+    algorithm.input.set(zscore::data, data);
+    algorithm.input.set(zscore::partialMoments, moments.getPartialResult());
+
+    /* Write the normalized data to the input data table */
+    algorithm.parameter().inPlace = true;
+
+    /* Compute Z-score normalization function */
+    algorithm.compute();
+
+    /* Print the results of stage */
+    zscore::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(zscore::normalizedData), "First 10 rows of the z-score normalization result:", 10);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/* file: out_detect_bacon_score_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of scoring new observations with the estimates computed by the Bacon method
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-OUT_DETECT_BACON_SCORE_DENSE_BATCH"></a>
+ * \example out_detect_bacon_score_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+typedef double algorithmFPType; /* Algorithm floating-point type */
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/outlierdetection.csv";
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to detect outliers using the BACON method and to compute the estimates of the clean data */
+    bacon_outlier_detection::Batch<algorithmFPType, bacon_outlier_detection::defaultDense> algorithm;
+
+    algorithm.input.set(bacon_outlier_detection::data, dataSource.getNumericTable());
+    algorithm.parameter.computeEstimates = true;
+
+    /* Compute outliers and the estimates */
+    algorithm.compute();
+
+    bacon_outlier_detection::ResultPtr res = algorithm.getResult();
+
+    printNumericTable(res->get(bacon_outlier_detection::location), "Location:");
+    printNumericTable(res->get(bacon_outlier_detection::threshold), "Threshold:");
+
+    /* Score the observations with the computed estimates without running the BACON method again */
+    multivariate_outlier_detection::Batch<algorithmFPType, multivariate_outlier_detection::defaultDense> scoring;
+
+    scoring.input.set(multivariate_outlier_detection::data, dataSource.getNumericTable());
+    scoring.input.set(multivariate_outlier_detection::location, res->get(bacon_outlier_detection::location));
+    scoring.input.set(multivariate_outlier_detection::choleskyFactor, res->get(bacon_outlier_detection::choleskyFactor));
+    scoring.input.set(multivariate_outlier_detection::threshold, res->get(bacon_outlier_detection::threshold));
+
+    scoring.compute();
+
+    multivariate_outlier_detection::ResultPtr scoringRes = scoring.getResult();
+
+    printNumericTables(res->get(bacon_outlier_detection::weights).get(), scoringRes->get(multivariate_outlier_detection::weights).get(),
+                       "Bacon weights", "Scoring weights", "Outlier detection result (Bacon estimates)");
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/* file: pca_incremental_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis (PCA) using the incremental
+!    singular value decomposition (SVD) method in the online processing mode
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_INCREMENTAL_DENSE_ONLINE"></a>
+ * \example pca_incremental_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nVectorsInBlock = 250;
+const string dataFileName    = "../data/online/pca_normalized.csv";
+
+/* PCA algorithm parameters */
+const size_t nComponents = 3;
+const size_t sketchSize  = 6;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &dataFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(dataFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm for principal component analysis using the incremental SVD method */
+    pca::Online<float, pca::incrementalDense> algorithm;
+
+    /* Only the sketch of sketchSize rows is kept between the blocks of the input data */
+    algorithm.parameter.nComponents = nComponents;
+    algorithm.parameter.sketchSize  = sketchSize;
+
+    while (dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock)
+    {
+        /* Set the input data to the algorithm */
+        algorithm.input.set(pca::data, dataSource.getNumericTable());
+
+        /* Update the sketch of the data */
+        algorithm.compute();
+    }
+
+    /* Finalize computations */
+    algorithm.finalizeCompute();
+
+    /* Print the results */
+    pca::ResultPtr result = algorithm.getResult();
+    printNumericTable(result->get(pca::eigenvalues), "Eigenvalues:");
+    printNumericTable(result->get(pca::eigenvectors), "Eigenvectors:");
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/* file: pca_randomized_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of principal component analysis (PCA) using the randomized
+!    singular value decomposition (SVD) method in the batch processing mode
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PCA_RANDOMIZED_DENSE_BATCH"></a>
+ * \example pca_randomized_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const string dataFileName = "../data/batch/pca_normalized.csv";
+const size_t nVectors     = 1000;
+const size_t nComponents  = 3;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &dataFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(dataFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock(nVectors);
+
+    /* Create an algorithm for principal component analysis using the randomized SVD method */
+    pca::Batch<float, pca::randomizedDense> algorithm;
+
+    /* Set the algorithm input data */
+    algorithm.input.set(pca::data, dataSource.getNumericTable());
+    algorithm.parameter.resultsToCompute = pca::mean | pca::variance | pca::eigenvalue;
+    algorithm.parameter.isDeterministic  = true;
+    algorithm.parameter.nComponents      = nComponents;
+
+    /* Compute results of the PCA algorithm */
+    algorithm.compute();
+
+    /* Print the results */
+    pca::ResultPtr result = algorithm.getResult();
+    printNumericTable(result->get(pca::eigenvalues), "Eigenvalues:");
+    printNumericTable(result->get(pca::eigenvectors), "Eigenvectors:");
+    printNumericTable(result->get(pca::means), "Means:");
+    printNumericTable(result->get(pca::variances), "Variances:");
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/* file: ridge_reg_norm_eq_dense_grouped_batch.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the grouped ridge regression training in the batch processing mode.
+!
+!    The program splits the training datasetFileName into segments, trains
+!    one ridge regression model per segment with the normal equations method
+!    and computes regression for the test data with the model of the first segment.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-RIDGE_REGRESSION_NORM_EQ_GROUPED_BATCH"></a>
+ * \example ridge_reg_norm_eq_dense_grouped_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+using namespace daal::algorithms::ridge_regression;
+
+/* Input data set parameters */
+string trainDatasetFileName = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName  = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10; /* Number of features in training and testing data sets */
+const size_t nDependentVariables = 2;  /* Number of dependent variables that correspond to each observation */
+const size_t nSegments           = 4;  /* Number of segments of the training data set */
+
+void trainModels();
+void testModel();
+
+grouped_training::ResultPtr trainingResult;
+prediction::ResultPtr predictionResult;
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModels();
+    testModel();
+
+    return 0;
+}
+
+void trainModels()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName, DataSource::notAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables */
+    NumericTablePtr trainData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr trainDependentVariables(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainDependentVariables));
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Assign the observations to the segments in a round-robin manner */
+    const size_t nRows = trainData->getNumberOfRows();
+    services::SharedPtr<HomogenNumericTable<int> > trainSegments(new HomogenNumericTable<int>(1, nRows, NumericTable::doAllocate));
+    int * segmentIds = trainSegments->getArray();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        segmentIds[i] = (int)(i % nSegments);
+    }
+
+    /* Create an algorithm object to train the ridge regression models of the segments */
+    grouped_training::Batch<> algorithm(nSegments);
+
+    /* Pass a training data set, dependent values and segments to the algorithm */
+    algorithm.input.set(grouped_training::data, trainData);
+    algorithm.input.set(grouped_training::dependentVariables, trainDependentVariables);
+    algorithm.input.set(grouped_training::segments, trainSegments);
+
+    /* Build the ridge regression models */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    trainingResult = algorithm.getResult();
+    for (size_t i = 0; i < nSegments; i++)
+    {
+        cout << "Segment " << i << ":" << endl;
+        printNumericTable(trainingResult->get(grouped_training::models, i)->getBeta(), "Ridge Regression coefficients:");
+    }
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    NumericTablePtr testData(new HomogenNumericTable<>(nFeatures, 0, NumericTable::doNotAllocate));
+    NumericTablePtr testGroundTruth(new HomogenNumericTable<>(nDependentVariables, 0, NumericTable::doNotAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Load the data from the data file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict values of ridge regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the model of the first segment to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(grouped_training::models, 0));
+
+    /* Predict values of ridge regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction), "Ridge Regression prediction results: (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
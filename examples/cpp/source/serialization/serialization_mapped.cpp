@@ -0,0 +1,106 @@
+/* file: serialization_mapped.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of numeric table deserialization from a memory-mapped file
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SERIALIZATION_MAPPED"></a>
+ * \example serialization_mapped.cpp
+ */
+
+#include <fstream>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/serialization.csv";
+
+/* File with the serialized numeric table */
+const string archiveFileName = "serialization_mapped.bin";
+
+void serializeNumericTable(NumericTablePtr dataTable, const string & fileName);
+NumericTablePtr deserializeNumericTable(const string & fileName);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Retrieve a numeric table */
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+
+    /* Print the original data */
+    printNumericTable(dataTable, "Data before serialization:");
+
+    /* Serialize the numeric table into the file */
+    serializeNumericTable(dataTable, archiveFileName);
+
+    /* Deserialize the numeric table from the file mapped into memory */
+    NumericTablePtr restoredDataTable = deserializeNumericTable(archiveFileName);
+
+    /* Print the restored data */
+    printNumericTable(restoredDataTable, "Data after deserialization:");
+
+    return 0;
+}
+
+void serializeNumericTable(NumericTablePtr dataTable, const string & fileName)
+{
+    /* Create a data archive to serialize the numeric table */
+    InputDataArchive dataArch;
+
+    /* Serialize the numeric table into the data archive */
+    dataTable->serialize(dataArch);
+
+    /* Store the serialized data in the file */
+    const size_t length = dataArch.getSizeOfArchive();
+    byte * buffer       = new byte[length];
+    dataArch.copyArchiveToArray(buffer, length);
+
+    ofstream file(fileName.c_str(), ios::binary);
+    file.write((const char *)buffer, length);
+    file.close();
+
+    delete[] buffer;
+}
+
+NumericTablePtr deserializeNumericTable(const string & fileName)
+{
+    /* Create a data archive that maps the file into memory, the data archive owns the mapped archive */
+    OutputDataArchive dataArch(new MappedDataArchive(fileName.c_str()));
+
+    /* Create a numeric table object */
+    NumericTablePtr dataTable = NumericTablePtr(new HomogenNumericTable<>());
+
+    /* Deserialize the numeric table from the data archive, the table refers to the data in the mapped file without copying it */
+    dataTable->deserialize(dataArch);
+
+    return dataTable;
+}
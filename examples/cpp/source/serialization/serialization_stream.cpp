@@ -0,0 +1,134 @@
+/* file: serialization_stream.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of numeric table serialization to a stream without keeping the whole archive in memory
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SERIALIZATION_STREAM"></a>
+ * \example serialization_stream.cpp
+ */
+
+#include <fstream>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/serialization.csv";
+
+/* File with the serialized numeric table */
+const string archiveFileName = "serialization_stream.bin";
+
+/* Size of the chunks passed to the stream */
+const size_t chunkSize = 4096;
+
+/* Sink that writes the serialized data to the file */
+class FileSink : public DataArchiveSinkIface
+{
+public:
+    FileSink(const string & fileName) : _file(fileName.c_str(), ios::binary) {}
+
+    services::Status write(const byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        _file.write((const char *)ptr, size);
+        return _file.good() ? services::Status() : services::Status(services::ErrorOnFileOpen);
+    }
+
+private:
+    ofstream _file;
+};
+
+/* Source that reads the serialized data from the file */
+class FileSource : public DataArchiveSourceIface
+{
+public:
+    FileSource(const string & fileName) : _file(fileName.c_str(), ios::binary) {}
+
+    size_t read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        _file.read((char *)ptr, size);
+        return (size_t)_file.gcount();
+    }
+
+private:
+    ifstream _file;
+};
+
+void serializeNumericTable(NumericTablePtr dataTable, DataArchiveSinkIface * sink);
+NumericTablePtr deserializeNumericTable(DataArchiveSourceIface * source);
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Retrieve a numeric table */
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+
+    /* Print the original data */
+    printNumericTable(dataTable, "Data before serialization:");
+
+    /* Serialize the numeric table to the file by chunks */
+    {
+        FileSink sink(archiveFileName);
+        serializeNumericTable(dataTable, &sink);
+    }
+
+    /* Deserialize the numeric table from the file by chunks */
+    FileSource source(archiveFileName);
+    NumericTablePtr restoredDataTable = deserializeNumericTable(&source);
+
+    /* Print the restored data */
+    printNumericTable(restoredDataTable, "Data after deserialization:");
+
+    return 0;
+}
+
+void serializeNumericTable(NumericTablePtr dataTable, DataArchiveSinkIface * sink)
+{
+    /* Create a data archive that passes the serialized data to the sink, the data archive owns the streaming archive */
+    InputDataArchive dataArch(new StreamingDataArchive(sink, chunkSize));
+
+    /* Serialize the numeric table into the data archive, the rest of the data is passed to the sink when the data archive is destroyed */
+    dataTable->serialize(dataArch);
+}
+
+NumericTablePtr deserializeNumericTable(DataArchiveSourceIface * source)
+{
+    /* Create a data archive that receives the serialized data from the source */
+    OutputDataArchive dataArch(new StreamingDataArchive(source, chunkSize));
+
+    /* Create a numeric table object */
+    NumericTablePtr dataTable = NumericTablePtr(new HomogenNumericTable<>());
+
+    /* Deserialize the numeric table from the data archive */
+    dataTable->deserialize(dataArch);
+
+    return dataTable;
+}
@@ -0,0 +1,168 @@
+/* file: cpu_dispatch_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of measuring the performance of the algorithms on the selected
+!    CPU branch of the library
+!
+!    The CPU branch can be selected only once per process, so that the full
+!    matrix of the branches is obtained by running the example once per branch:
+!      for cpu in sse2 ssse3 sse42 avx avx2 avx512; do ./cpu_dispatch_benchmark $cpu; done
+!    The branches that are not supported by the processor fall back to the best
+!    supported one, the branch actually used by each kernel is printed at the end.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CPU_DISPATCH_BENCHMARK"></a>
+ * \example cpu_dispatch_benchmark.cpp
+ */
+
+#include "daal.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Benchmark parameters */
+const size_t nRows        = 20000;
+const size_t nFeatures    = 64;
+const size_t nRowsForDist = 2000;
+const size_t nRepeats     = 5;
+
+const string reportFileName = "cpu_dispatch_report.txt";
+
+const char * cpuNames[] = { "sse2", "ssse3", "sse42", "avx", "avx2", "avx512_mic", "avx512" };
+const size_t nCpuNames  = sizeof(cpuNames) / sizeof(cpuNames[0]);
+
+NumericTablePtr createRandomTable(size_t nCols, size_t nRowsInTable, unsigned int seed);
+
+template <typename Func>
+void measure(const char * name, Func func);
+
+int main(int argc, char * argv[])
+{
+    /* The CPU branch is selected before any other call to the library */
+    if (argc > 1)
+    {
+        size_t cpu = 0;
+        while (cpu < nCpuNames && strcmp(argv[1], cpuNames[cpu])) ++cpu;
+        if (cpu == nCpuNames)
+        {
+            cout << "Unknown CPU branch: " << argv[1] << endl;
+            return -1;
+        }
+        Environment::getInstance()->setCpuId((int)cpu);
+    }
+
+    const int cpuId = Environment::getInstance()->getCpuId();
+    cout << "CPU branch: " << ((cpuId >= 0 && cpuId < (int)nCpuNames) ? cpuNames[cpuId] : "unknown") << endl;
+
+    /* Record the CPU branch selected for each kernel call */
+    Environment::getInstance()->enableDispatchReport();
+
+    NumericTablePtr data      = createRandomTable(nFeatures, nRows, 777);
+    NumericTablePtr responses = createRandomTable(1, nRows, 778);
+    NumericTablePtr distData  = createRandomTable(nFeatures, nRowsForDist, 779);
+
+    measure("covariance", [&]() {
+        covariance::Batch<> algorithm;
+        algorithm.input.set(covariance::data, data);
+        algorithm.compute();
+    });
+
+    measure("cosine_distance", [&]() {
+        cosine_distance::Batch<> algorithm;
+        algorithm.input.set(cosine_distance::data, distData);
+        algorithm.compute();
+    });
+
+    measure("linear_regression_training", [&]() {
+        linear_regression::training::Batch<> algorithm;
+        algorithm.input.set(linear_regression::training::data, data);
+        algorithm.input.set(linear_regression::training::dependentVariables, responses);
+        algorithm.compute();
+    });
+
+    measure("pca", [&]() {
+        pca::Batch<> algorithm;
+        algorithm.input.set(pca::data, data);
+        algorithm.compute();
+    });
+
+    if (Environment::getInstance()->writeDispatchReport(reportFileName.c_str()))
+    {
+        cout << "Failed to write the dispatch report" << endl;
+        return -1;
+    }
+
+    /* Every line of the report is: sequence number, CPU branch, kernel, source file and thread id,
+       the distinct branches of the kernels are printed */
+    cout << endl << "Dispatched kernels:" << endl;
+    ifstream report(reportFileName.c_str());
+    set<string> kernels;
+    string sequenceNumber, cpu, kernel, fileName, threadId;
+    while (report >> sequenceNumber >> cpu >> kernel >> fileName >> threadId)
+    {
+        if (kernels.insert(cpu + " " + kernel + " " + fileName).second) cout << cpu << " " << kernel << " (" << fileName << ")" << endl;
+    }
+
+    return 0;
+}
+
+NumericTablePtr createRandomTable(size_t nCols, size_t nRowsInTable, unsigned int seed)
+{
+    NumericTablePtr table = HomogenNumericTable<>::create(nCols, nRowsInTable, NumericTable::doAllocate);
+
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRowsInTable, writeOnly, block);
+    float * values = block.getBlockPtr();
+    for (size_t i = 0; i < nCols * nRowsInTable; i++)
+    {
+        seed      = seed * 1103515245u + 12345u;
+        values[i] = (float)((seed >> 8) & 0xFFFF) / 65536.0f;
+    }
+    table->releaseBlockOfRows(block);
+
+    return table;
+}
+
+template <typename Func>
+void measure(const char * name, Func func)
+{
+    /* Warm-up run */
+    func();
+
+    double best = 0.0;
+    for (size_t i = 0; i < nRepeats; i++)
+    {
+        const auto start = chrono::steady_clock::now();
+        func();
+        const double time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (i == 0 || time < best) best = time;
+    }
+
+    cout << name << ": " << best << " ms" << endl;
+}
@@ -0,0 +1,385 @@
+/* file: kernels_benchmark.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the microbenchmarks of the major algorithms of the library
+!    for tracking the performance between releases
+!
+!    Every benchmark is run once to warm up and then the given number of times,
+!    the best time of the runs is reported. One more run is made with the kernel
+!    tracing enabled, the time of the tasks recorded by the kernels is summed up
+!    by the task name and reported as the phases of the benchmark.
+!
+!    The results are written to kernels_benchmark.csv, one line per benchmark
+!    and phase: benchmark, rows, columns, phase, time in milliseconds.
+!    The phase "total" is the best wall time of the benchmark, the time of the
+!    other phases is summed up over all threads.
+!
+!    Usage: kernels_benchmark [number of repeats] [benchmark name filter]
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KERNELS_BENCHMARK"></a>
+ * \example kernels_benchmark.cpp
+ */
+
+#include "daal.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace daal::services;
+
+/* Shapes of the data sets */
+const size_t nRowsLarge    = 100000;
+const size_t nRowsMedium   = 20000;
+const size_t nRowsSmall    = 5000;
+const size_t nFeatures     = 32;
+const size_t nFeaturesWide = 128;
+
+const size_t nClusters   = 16;
+const size_t nIterations = 10;
+const size_t nTrees      = 50;
+const size_t nNeighbors  = 5;
+
+size_t nRepeats = 5;
+string filter;
+
+const string csvFileName    = "kernels_benchmark_data.csv";
+const string traceFileName  = "kernels_benchmark_trace.json";
+const string resultFileName = "kernels_benchmark.csv";
+
+ofstream results;
+
+NumericTablePtr createRandomTable(size_t nCols, size_t nRows, unsigned int seed);
+NumericTablePtr createLabels(const NumericTablePtr & data, float negativeLabel);
+void writeCsvFile(const NumericTablePtr & data, const string & fileName);
+void readPhases(const string & fileName, map<string, double> & phases);
+
+template <typename Func>
+void measure(const char * name, const NumericTablePtr & data, Func func);
+
+int main(int argc, char * argv[])
+{
+    if (argc > 1) nRepeats = (size_t)atoi(argv[1]);
+    if (argc > 2) filter = argv[2];
+    if (!nRepeats) nRepeats = 1;
+
+    results.open(resultFileName.c_str());
+    if (!results)
+    {
+        cout << "Failed to open " << resultFileName << endl;
+        return -1;
+    }
+    results << "benchmark,rows,columns,phase,time_ms" << endl;
+
+    NumericTablePtr dataLarge  = createRandomTable(nFeatures, nRowsLarge, 777);
+    NumericTablePtr dataWide   = createRandomTable(nFeaturesWide, nRowsMedium, 778);
+    NumericTablePtr dataMedium = createRandomTable(nFeatures, nRowsMedium, 779);
+    NumericTablePtr dataSmall  = createRandomTable(nFeatures, nRowsSmall, 780);
+    NumericTablePtr labels     = createLabels(dataMedium, 0.0f);
+    NumericTablePtr svmLabels  = createLabels(dataSmall, -1.0f);
+    NumericTablePtr responses  = createRandomTable(1, nRowsLarge, 781);
+
+    measure("covariance", dataWide, [&]() {
+        covariance::Batch<> algorithm;
+        algorithm.input.set(covariance::data, dataWide);
+        algorithm.compute();
+    });
+
+    kmeans::init::Batch<float, kmeans::init::randomDense> init(nClusters);
+    init.input.set(kmeans::init::data, dataLarge);
+    init.compute();
+    NumericTablePtr centroids = init.getResult()->get(kmeans::init::centroids);
+
+    measure("kmeans_iterations", dataLarge, [&]() {
+        kmeans::Batch<> algorithm(nClusters, nIterations);
+        algorithm.input.set(kmeans::data, dataLarge);
+        algorithm.input.set(kmeans::inputCentroids, centroids);
+        algorithm.compute();
+    });
+
+    measure("pca", dataWide, [&]() {
+        pca::Batch<> algorithm;
+        algorithm.input.set(pca::data, dataWide);
+        algorithm.compute();
+    });
+
+    /* Tree ensembles */
+    decision_forest::classification::training::ResultPtr dfModel;
+    measure("df_train", dataMedium, [&]() {
+        decision_forest::classification::training::Batch<> algorithm(2);
+        algorithm.input.set(classifier::training::data, dataMedium);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter.nTrees = nTrees;
+        algorithm.compute();
+        dfModel = algorithm.getResult();
+    });
+
+    measure("df_predict", dataMedium, [&]() {
+        decision_forest::classification::prediction::Batch<> algorithm(2);
+        algorithm.input.set(classifier::prediction::data, dataMedium);
+        algorithm.input.set(classifier::prediction::model, dfModel->get(classifier::training::model));
+        algorithm.compute();
+    });
+
+    gbt::classification::training::ResultPtr gbtModel;
+    measure("gbt_train", dataMedium, [&]() {
+        gbt::classification::training::Batch<> algorithm(2);
+        algorithm.input.set(classifier::training::data, dataMedium);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter().maxIterations = nTrees;
+        algorithm.compute();
+        gbtModel = algorithm.getResult();
+    });
+
+    measure("gbt_predict", dataMedium, [&]() {
+        gbt::classification::prediction::Batch<> algorithm(2);
+        algorithm.input.set(classifier::prediction::data, dataMedium);
+        algorithm.input.set(classifier::prediction::model, gbtModel->get(classifier::training::model));
+        algorithm.compute();
+    });
+
+    measure("svm_train", dataSmall, [&]() {
+        svm::training::Batch<> algorithm;
+        algorithm.parameter.kernel = kernel_function::KernelIfacePtr(new kernel_function::linear::Batch<>());
+        algorithm.input.set(classifier::training::data, dataSmall);
+        algorithm.input.set(classifier::training::labels, svmLabels);
+        algorithm.compute();
+    });
+
+    /* Nearest neighbors */
+    bf_knn_classification::training::ResultPtr bfModel;
+    measure("bf_knn_train", dataMedium, [&]() {
+        bf_knn_classification::training::Batch<> algorithm;
+        algorithm.input.set(classifier::training::data, dataMedium);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter().k = nNeighbors;
+        algorithm.compute();
+        bfModel = algorithm.getResult();
+    });
+
+    measure("bf_knn_predict", dataSmall, [&]() {
+        bf_knn_classification::prediction::Batch<> algorithm;
+        algorithm.input.set(classifier::prediction::data, dataSmall);
+        algorithm.input.set(classifier::prediction::model, bfModel->get(classifier::training::model));
+        algorithm.parameter().k = nNeighbors;
+        algorithm.compute();
+    });
+
+    kdtree_knn_classification::training::ResultPtr kdModel;
+    measure("kd_knn_train", dataMedium, [&]() {
+        kdtree_knn_classification::training::Batch<> algorithm;
+        algorithm.input.set(classifier::training::data, dataMedium);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.parameter.k = nNeighbors;
+        algorithm.compute();
+        kdModel = algorithm.getResult();
+    });
+
+    measure("kd_knn_predict", dataSmall, [&]() {
+        kdtree_knn_classification::prediction::Batch<> algorithm;
+        algorithm.input.set(classifier::prediction::data, dataSmall);
+        algorithm.input.set(classifier::prediction::model, kdModel->get(classifier::training::model));
+        algorithm.parameter.k = nNeighbors;
+        algorithm.compute();
+    });
+
+    /* Linear models */
+    linear_regression::training::ResultPtr linRegModel;
+    measure("linear_regression_train", dataLarge, [&]() {
+        linear_regression::training::Batch<> algorithm;
+        algorithm.input.set(linear_regression::training::data, dataLarge);
+        algorithm.input.set(linear_regression::training::dependentVariables, responses);
+        algorithm.compute();
+        linRegModel = algorithm.getResult();
+    });
+
+    measure("linear_regression_predict", dataLarge, [&]() {
+        linear_regression::prediction::Batch<> algorithm;
+        algorithm.input.set(linear_regression::prediction::data, dataLarge);
+        algorithm.input.set(linear_regression::prediction::model, linRegModel->get(linear_regression::training::model));
+        algorithm.compute();
+    });
+
+    logistic_regression::training::ResultPtr logRegModel;
+    measure("logistic_regression_train", dataMedium, [&]() {
+        logistic_regression::training::Batch<> algorithm(2);
+        algorithm.input.set(classifier::training::data, dataMedium);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+        logRegModel = algorithm.getResult();
+    });
+
+    measure("logistic_regression_predict", dataMedium, [&]() {
+        logistic_regression::prediction::Batch<> algorithm(2);
+        algorithm.input.set(classifier::prediction::data, dataMedium);
+        algorithm.input.set(classifier::prediction::model, logRegModel->get(classifier::training::model));
+        algorithm.compute();
+    });
+
+    /* Data management */
+    writeCsvFile(dataMedium, csvFileName);
+    measure("csv_load", dataMedium, [&]() {
+        FileDataSource<CSVFeatureManager> dataSource(csvFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+        dataSource.loadDataBlock();
+    });
+    remove(csvFileName.c_str());
+
+    measure("serialization", dataLarge, [&]() {
+        InputDataArchive inArchive;
+        dataLarge->serialize(inArchive);
+        const size_t length = inArchive.getSizeOfArchive();
+        byte * buffer       = new byte[length];
+        inArchive.copyArchiveToArray(buffer, length);
+
+        OutputDataArchive outArchive(buffer, length);
+        NumericTablePtr restored(new HomogenNumericTable<float>());
+        restored->deserialize(outArchive);
+        delete[] buffer;
+    });
+
+    remove(traceFileName.c_str());
+    cout << endl << "Results are written to " << resultFileName << endl;
+    return 0;
+}
+
+NumericTablePtr createRandomTable(size_t nCols, size_t nRows, unsigned int seed)
+{
+    NumericTablePtr table = HomogenNumericTable<>::create(nCols, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<float> block;
+    table->getBlockOfRows(0, nRows, writeOnly, block);
+    float * values = block.getBlockPtr();
+    for (size_t i = 0; i < nCols * nRows; i++)
+    {
+        seed      = seed * 1103515245u + 12345u;
+        values[i] = (float)((seed >> 8) & 0xFFFF) / 65536.0f;
+    }
+    table->releaseBlockOfRows(block);
+
+    return table;
+}
+
+/* Labels of the two classes separated by the sum of the first two features */
+NumericTablePtr createLabels(const NumericTablePtr & data, float negativeLabel)
+{
+    const size_t nRows    = data->getNumberOfRows();
+    const size_t nCols    = data->getNumberOfColumns();
+    NumericTablePtr table = HomogenNumericTable<>::create(1, nRows, NumericTable::doAllocate);
+
+    BlockDescriptor<float> dataBlock;
+    BlockDescriptor<float> labelsBlock;
+    data->getBlockOfRows(0, nRows, readOnly, dataBlock);
+    table->getBlockOfRows(0, nRows, writeOnly, labelsBlock);
+    const float * x = dataBlock.getBlockPtr();
+    float * y       = labelsBlock.getBlockPtr();
+    for (size_t i = 0; i < nRows; i++)
+    {
+        y[i] = (x[i * nCols] + x[i * nCols + 1] > 1.0f) ? 1.0f : negativeLabel;
+    }
+    table->releaseBlockOfRows(labelsBlock);
+    data->releaseBlockOfRows(dataBlock);
+
+    return table;
+}
+
+void writeCsvFile(const NumericTablePtr & data, const string & fileName)
+{
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nCols = data->getNumberOfColumns();
+
+    BlockDescriptor<float> block;
+    data->getBlockOfRows(0, nRows, readOnly, block);
+    const float * x = block.getBlockPtr();
+
+    ofstream file(fileName.c_str());
+    for (size_t i = 0; i < nRows; i++)
+    {
+        for (size_t j = 0; j < nCols; j++) file << x[i * nCols + j] << (j + 1 < nCols ? "," : "\n");
+    }
+    data->releaseBlockOfRows(block);
+}
+
+/* Sums up the duration of the tasks in the Chrome trace written by the library by the task name */
+void readPhases(const string & fileName, map<string, double> & phases)
+{
+    const string namePrefix = "{\"name\":\"";
+    const string durPrefix  = "\"dur\":";
+
+    ifstream trace(fileName.c_str());
+    string line;
+    while (getline(trace, line))
+    {
+        const size_t nameStart = line.find(namePrefix);
+        const size_t durStart  = line.find(durPrefix);
+        if (nameStart == string::npos || durStart == string::npos) continue;
+
+        const size_t nameBegin = nameStart + namePrefix.size();
+        const size_t nameEnd   = line.find('"', nameBegin);
+        if (nameEnd == string::npos) continue;
+
+        /* Durations in the trace are in microseconds */
+        phases[line.substr(nameBegin, nameEnd - nameBegin)] += atof(line.c_str() + durStart + durPrefix.size()) * 1e-3;
+    }
+}
+
+template <typename Func>
+void measure(const char * name, const NumericTablePtr & data, Func func)
+{
+    if (!filter.empty() && string(name).find(filter) == string::npos) return;
+
+    /* Warm-up run */
+    func();
+
+    double best = 0.0;
+    for (size_t i = 0; i < nRepeats; i++)
+    {
+        const auto start = chrono::steady_clock::now();
+        func();
+        const double time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (i == 0 || time < best) best = time;
+    }
+
+    /* Per-phase timings come from one more run with the kernel tracing enabled */
+    Environment::getInstance()->enableKernelTracing(true);
+    func();
+    Environment::getInstance()->enableKernelTracing(false);
+
+    map<string, double> phases;
+    if (!Environment::getInstance()->writeKernelTrace(traceFileName.c_str())) readPhases(traceFileName, phases);
+
+    const size_t nRows = data->getNumberOfRows();
+    const size_t nCols = data->getNumberOfColumns();
+
+    cout << name << " (" << nRows << " x " << nCols << "): " << best << " ms" << endl;
+    results << name << "," << nRows << "," << nCols << ",total," << best << endl;
+    for (map<string, double>::const_iterator it = phases.begin(); it != phases.end(); ++it)
+    {
+        cout << "    " << it->first << ": " << it->second << " ms" << endl;
+        results << name << "," << nRows << "," << nCols << "," << it->first << "," << it->second << endl;
+    }
+}
@@ -243,6 +243,7 @@ typedef void (*_threaded_free_t)(void *);
 
 typedef void (*_daal_threader_for_t)(int, int, const void *, daal::functype);
 typedef void (*_daal_threader_for_blocked_t)(int, int, const void *, daal::functype2);
+typedef void (*_daal_threader_invoke_t)(const void *, daal::functype);
 typedef int (*_daal_threader_get_max_threads_t)(void);
 
 typedef void * (*_daal_get_tls_ptr_t)(void *, daal::tls_functype);
@@ -267,10 +268,24 @@ typedef void (*_daal_del_task_group_t)(void * taskGroupPtr);
 typedef void (*_daal_run_task_group_t)(void * taskGroupPtr, daal::task * t);
 typedef void (*_daal_wait_task_group_t)(void * taskGroupPtr);
 
+typedef void * (*_daal_new_arena_t)(int nThreads);
+typedef void (*_daal_del_arena_t)(void * arenaPtr);
+typedef void (*_daal_execute_in_arena_t)(void * arenaPtr, const void * a, daal::functype func);
+typedef int (*_daal_threader_get_arena_max_threads_t)();
+
 typedef bool (*_daal_is_in_parallel_t)();
+typedef int (*_daal_atomic_compare_exchange_int_t)(int *, int, int);
+typedef void (*_daal_atomic_add_float_t)(float *, float);
+typedef void (*_daal_atomic_add_double_t)(double *, double);
+typedef void (*_daal_atomic_add_size_t_t)(size_t *, size_t);
 typedef void (*_daal_tbb_task_scheduler_free_t)(void *& init);
 typedef size_t (*_setNumberOfThreads_t)(const size_t, void **);
 typedef void * (*_daal_threader_env_t)();
+typedef int * (*_daal_threader_group_ptr_t)();
+typedef void (*_daal_threader_for_affinity_t)(int, int, const void *, daal::functype, void *);
+typedef void (*_daal_threader_for_blocked_affinity_t)(int, int, const void *, daal::functype2, void *);
+typedef void * (*_daal_new_affinity_partitioner_t)();
+typedef void (*_daal_del_affinity_partitioner_t)(void *);
 
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 typedef void (*_thread_pinner_thread_pinner_init_t)();
@@ -290,6 +305,7 @@ static _threaded_free_t _threaded_free_ptr     = NULL;
 static _daal_threader_for_t _daal_threader_for_ptr                         = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr         = NULL;
 static _daal_threader_for_t _daal_threader_for_optional_ptr                = NULL;
+static _daal_threader_invoke_t _daal_threader_invoke_ptr                   = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr                 = NULL;
@@ -314,10 +330,25 @@ static _daal_del_task_group_t _daal_del_task_group_ptr   = NULL;
 static _daal_run_task_group_t _daal_run_task_group_ptr   = NULL;
 static _daal_wait_task_group_t _daal_wait_task_group_ptr = NULL;
 
-static _daal_is_in_parallel_t _daal_is_in_parallel_ptr                   = NULL;
-static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr = NULL;
-static _setNumberOfThreads_t _setNumberOfThreads_ptr                     = NULL;
-static _daal_threader_env_t _daal_threader_env_ptr                       = NULL;
+static _daal_new_arena_t _daal_new_arena_ptr                                           = NULL;
+static _daal_del_arena_t _daal_del_arena_ptr                                           = NULL;
+static _daal_execute_in_arena_t _daal_execute_in_arena_ptr                             = NULL;
+static _daal_threader_get_arena_max_threads_t _daal_threader_get_arena_max_threads_ptr = NULL;
+
+static _daal_is_in_parallel_t _daal_is_in_parallel_ptr                           = NULL;
+static _daal_atomic_compare_exchange_int_t _daal_atomic_compare_exchange_int_ptr = NULL;
+static _daal_atomic_add_float_t _daal_atomic_add_float_ptr                       = NULL;
+static _daal_atomic_add_double_t _daal_atomic_add_double_ptr                     = NULL;
+static _daal_atomic_add_size_t_t _daal_atomic_add_size_t_ptr                     = NULL;
+static _daal_tbb_task_scheduler_free_t _daal_tbb_task_scheduler_free_ptr         = NULL;
+static _setNumberOfThreads_t _setNumberOfThreads_ptr                             = NULL;
+static _daal_threader_env_t _daal_threader_env_ptr                               = NULL;
+static _daal_threader_group_ptr_t _daal_threader_group_ptr_ptr                   = NULL;
+
+static _daal_threader_for_affinity_t _daal_threader_for_affinity_ptr                 = NULL;
+static _daal_threader_for_blocked_affinity_t _daal_threader_for_blocked_affinity_ptr = NULL;
+static _daal_new_affinity_partitioner_t _daal_new_affinity_partitioner_ptr           = NULL;
+static _daal_del_affinity_partitioner_t _daal_del_affinity_partitioner_ptr           = NULL;
 
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 static _thread_pinner_thread_pinner_init_t _thread_pinner_thread_pinner_init_ptr = NULL;
@@ -371,6 +402,47 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     _daal_threader_for_blocked_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_affinity(int n, int threads_request, const void * a, daal::functype func, void * partitionerPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_affinity_ptr == NULL)
+    {
+        _daal_threader_for_affinity_ptr = (_daal_threader_for_affinity_t)load_daal_thr_func("_daal_threader_for_affinity");
+    }
+    _daal_threader_for_affinity_ptr(n, threads_request, a, func, partitionerPtr);
+}
+
+DAAL_EXPORT void _daal_threader_for_blocked_affinity(int n, int threads_request, const void * a, daal::functype2 func, void * partitionerPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_for_blocked_affinity_ptr == NULL)
+    {
+        _daal_threader_for_blocked_affinity_ptr =
+            (_daal_threader_for_blocked_affinity_t)load_daal_thr_func("_daal_threader_for_blocked_affinity");
+    }
+    _daal_threader_for_blocked_affinity_ptr(n, threads_request, a, func, partitionerPtr);
+}
+
+DAAL_EXPORT void * _daal_new_affinity_partitioner()
+{
+    load_daal_thr_dll();
+    if (_daal_new_affinity_partitioner_ptr == NULL)
+    {
+        _daal_new_affinity_partitioner_ptr = (_daal_new_affinity_partitioner_t)load_daal_thr_func("_daal_new_affinity_partitioner");
+    }
+    return _daal_new_affinity_partitioner_ptr();
+}
+
+DAAL_EXPORT void _daal_del_affinity_partitioner(void * partitionerPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_affinity_partitioner_ptr == NULL)
+    {
+        _daal_del_affinity_partitioner_ptr = (_daal_del_affinity_partitioner_t)load_daal_thr_func("_daal_del_affinity_partitioner");
+    }
+    _daal_del_affinity_partitioner_ptr(partitionerPtr);
+}
+
 DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void * a, daal::functype func)
 {
     load_daal_thr_dll();
@@ -381,6 +453,16 @@ DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const v
     _daal_threader_for_optional_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_invoke(const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_threader_invoke_ptr == NULL)
+    {
+        _daal_threader_invoke_ptr = (_daal_threader_invoke_t)load_daal_thr_func("_daal_threader_invoke");
+    }
+    _daal_threader_invoke_ptr(a, func);
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -571,6 +653,47 @@ DAAL_EXPORT void _daal_wait_task_group(void * taskGroupPtr)
     _daal_wait_task_group_ptr(taskGroupPtr);
 }
 
+DAAL_EXPORT void * _daal_new_arena(int nThreads)
+{
+    load_daal_thr_dll();
+    if (_daal_new_arena_ptr == NULL)
+    {
+        _daal_new_arena_ptr = (_daal_new_arena_t)load_daal_thr_func("_daal_new_arena");
+    }
+    return _daal_new_arena_ptr(nThreads);
+}
+
+DAAL_EXPORT void _daal_del_arena(void * arenaPtr)
+{
+    load_daal_thr_dll();
+    if (_daal_del_arena_ptr == NULL)
+    {
+        _daal_del_arena_ptr = (_daal_del_arena_t)load_daal_thr_func("_daal_del_arena");
+    }
+    _daal_del_arena_ptr(arenaPtr);
+}
+
+DAAL_EXPORT void _daal_execute_in_arena(void * arenaPtr, const void * a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if (_daal_execute_in_arena_ptr == NULL)
+    {
+        _daal_execute_in_arena_ptr = (_daal_execute_in_arena_t)load_daal_thr_func("_daal_execute_in_arena");
+    }
+    _daal_execute_in_arena_ptr(arenaPtr, a, func);
+}
+
+DAAL_EXPORT int _daal_threader_get_arena_max_threads()
+{
+    load_daal_thr_dll();
+    if (_daal_threader_get_arena_max_threads_ptr == NULL)
+    {
+        _daal_threader_get_arena_max_threads_ptr =
+            (_daal_threader_get_arena_max_threads_t)load_daal_thr_func("_daal_threader_get_arena_max_threads");
+    }
+    return _daal_threader_get_arena_max_threads_ptr();
+}
+
 DAAL_EXPORT bool _daal_is_in_parallel()
 {
     load_daal_thr_dll();
@@ -581,6 +704,46 @@ DAAL_EXPORT bool _daal_is_in_parallel()
     return _daal_is_in_parallel_ptr();
 }
 
+DAAL_EXPORT int _daal_atomic_compare_exchange_int(int * ptr, int expected, int desired)
+{
+    load_daal_thr_dll();
+    if (_daal_atomic_compare_exchange_int_ptr == NULL)
+    {
+        _daal_atomic_compare_exchange_int_ptr = (_daal_atomic_compare_exchange_int_t)load_daal_thr_func("_daal_atomic_compare_exchange_int");
+    }
+    return _daal_atomic_compare_exchange_int_ptr(ptr, expected, desired);
+}
+
+DAAL_EXPORT void _daal_atomic_add_float(float * ptr, float value)
+{
+    load_daal_thr_dll();
+    if (_daal_atomic_add_float_ptr == NULL)
+    {
+        _daal_atomic_add_float_ptr = (_daal_atomic_add_float_t)load_daal_thr_func("_daal_atomic_add_float");
+    }
+    _daal_atomic_add_float_ptr(ptr, value);
+}
+
+DAAL_EXPORT void _daal_atomic_add_double(double * ptr, double value)
+{
+    load_daal_thr_dll();
+    if (_daal_atomic_add_double_ptr == NULL)
+    {
+        _daal_atomic_add_double_ptr = (_daal_atomic_add_double_t)load_daal_thr_func("_daal_atomic_add_double");
+    }
+    _daal_atomic_add_double_ptr(ptr, value);
+}
+
+DAAL_EXPORT void _daal_atomic_add_size_t(size_t * ptr, size_t value)
+{
+    load_daal_thr_dll();
+    if (_daal_atomic_add_size_t_ptr == NULL)
+    {
+        _daal_atomic_add_size_t_ptr = (_daal_atomic_add_size_t_t)load_daal_thr_func("_daal_atomic_add_size_t");
+    }
+    _daal_atomic_add_size_t_ptr(ptr, value);
+}
+
 DAAL_EXPORT void _daal_tbb_task_scheduler_free(void *& init)
 {
     load_daal_thr_dll();
@@ -611,6 +774,16 @@ DAAL_EXPORT void * _daal_threader_env()
     return _daal_threader_env_ptr();
 }
 
+DAAL_EXPORT int * _daal_threader_group_ptr()
+{
+    load_daal_thr_dll();
+    if (_daal_threader_group_ptr_ptr == NULL)
+    {
+        _daal_threader_group_ptr_ptr = (_daal_threader_group_ptr_t)load_daal_thr_func("_daal_threader_group_ptr");
+    }
+    return _daal_threader_group_ptr_ptr();
+}
+
 #if !(defined DAAL_THREAD_PINNING_DISABLED)
 DAAL_EXPORT void _thread_pinner_thread_pinner_init()
 {
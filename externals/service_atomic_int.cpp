@@ -63,6 +63,13 @@ dataType daal::services::Atomic<dataType>::dec()
     return --(*atomicPtr);
 }
 
+template <typename dataType>
+dataType daal::services::Atomic<dataType>::add(dataType value)
+{
+    tbb::atomic<dataType> * atomicPtr = (tbb::atomic<dataType> *)(this->_ptr);
+    return (*atomicPtr) += value;
+}
+
 template <typename dataType>
 void daal::services::Atomic<dataType>::set(dataType value)
 {
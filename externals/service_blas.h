@@ -27,6 +27,7 @@
 #include "services/daal_defines.h"
 #include "externals/service_memory.h"
 #include "externals/service_blas_mkl.h"
+#include "externals/service_profiler.h"
 #include "algorithms/kernel/service_error_handling.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 
@@ -45,24 +46,28 @@ struct Blas
     static void xsyrk(char * uplo, char * trans, SizeType * p, SizeType * n, fpType * alpha, fpType * a, SizeType * lda, fpType * beta, fpType * ata,
                       SizeType * ldata)
     {
+        Profiler::addFlops((size_t)*p * *p * *n);
         _impl<fpType, cpu>::xsyrk(uplo, trans, p, n, alpha, a, lda, beta, ata, ldata);
     }
 
     static void xxsyrk(char * uplo, char * trans, SizeType * p, SizeType * n, fpType * alpha, fpType * a, SizeType * lda, fpType * beta, fpType * ata,
                        SizeType * ldata)
     {
+        Profiler::addFlops((size_t)*p * *p * *n);
         _impl<fpType, cpu>::xxsyrk(uplo, trans, p, n, alpha, a, lda, beta, ata, ldata);
     }
 
     static void xsyr(const char * uplo, const SizeType * n, const fpType * alpha, const fpType * x, const SizeType * incx, fpType * a,
                      const SizeType * lda)
     {
+        Profiler::addFlops((size_t)*n * *n);
         _impl<fpType, cpu>::xsyr(uplo, n, alpha, x, incx, a, lda);
     }
 
     static void xxsyr(const char * uplo, const SizeType * n, const fpType * alpha, const fpType * x, const SizeType * incx, fpType * a,
                       const SizeType * lda)
     {
+        Profiler::addFlops((size_t)*n * *n);
         _impl<fpType, cpu>::xxsyr(uplo, n, alpha, x, incx, a, lda);
     }
 
@@ -70,6 +75,7 @@ struct Blas
                       const fpType * a, const SizeType * lda, const fpType * y, const SizeType * ldy, const fpType * beta, fpType * aty,
                       const SizeType * ldaty)
     {
+        Profiler::addFlops(2 * (size_t)*p * *ny * *n);
         _impl<fpType, cpu>::xgemm(transa, transb, p, ny, n, alpha, a, lda, y, ldy, beta, aty, ldaty);
     }
 
@@ -77,30 +83,35 @@ struct Blas
                        const fpType * a, const SizeType * lda, const fpType * y, const SizeType * ldy, const fpType * beta, fpType * aty,
                        const SizeType * ldaty)
     {
+        Profiler::addFlops(2 * (size_t)*p * *ny * *n);
         _impl<fpType, cpu>::xxgemm(transa, transb, p, ny, n, alpha, a, lda, y, ldy, beta, aty, ldaty);
     }
 
     static void xsymm(const char * side, const char * uplo, const SizeType * m, const SizeType * n, const fpType * alpha, const fpType * a,
                       const SizeType * lda, const fpType * b, const SizeType * ldb, const fpType * beta, fpType * c, const SizeType * ldc)
     {
+        Profiler::addFlops(2 * (size_t)*m * *n * ((*side == 'L' || *side == 'l') ? *m : *n));
         _impl<fpType, cpu>::xsymm(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     }
 
     static void xxsymm(char * side, char * uplo, SizeType * m, SizeType * n, fpType * alpha, fpType * a, SizeType * lda, fpType * b, SizeType * ldb,
                        fpType * beta, fpType * c, SizeType * ldc)
     {
+        Profiler::addFlops(2 * (size_t)*m * *n * ((*side == 'L' || *side == 'l') ? *m : *n));
         _impl<fpType, cpu>::xxsymm(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     }
 
     static void xgemv(const char * trans, const SizeType * m, const SizeType * n, const fpType * alpha, const fpType * a, const SizeType * lda,
                       const fpType * x, const SizeType * incx, const fpType * beta, fpType * y, const SizeType * incy)
     {
+        Profiler::addFlops(2 * (size_t)*m * *n);
         _impl<fpType, cpu>::xgemv(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     }
 
     static void xxgemv(const char * trans, const SizeType * m, const SizeType * n, const fpType * alpha, const fpType * a, const SizeType * lda,
                        const fpType * x, const SizeType * incx, const fpType * beta, fpType * y, const SizeType * incy)
     {
+        Profiler::addFlops(2 * (size_t)*m * *n);
         _impl<fpType, cpu>::xxgemv(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
     }
 
@@ -23,10 +23,519 @@
 
 #include "externals/service_memory.h"
 #include "externals/service_service.h"
+#include "services/env_detect.h"
+#include "algorithms/kernel/service_threading.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #define DAAL_SCRATCH_THREAD_LOCAL __declspec(thread)
+#else
+    #define DAAL_SCRATCH_THREAD_LOCAL __thread
+#endif
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+/* Buffers smaller than this are left to the allocating thread, spawning tasks for them costs more than it saves */
+const size_t firstTouchMinSize = 4 * 1024 * 1024;
+/* Granularity of distribution of pages between the threads, a multiple of the page size */
+const size_t firstTouchBlockSize = 256 * 1024;
+const size_t firstTouchPageSize  = 4096;
+
+static int memoryPlacementPolicy = daal::services::Environment::autoMemoryPlacement;
+
+void setMemoryPlacementPolicy(int policy)
+{
+    memoryPlacementPolicy = policy;
+}
+
+static bool isFirstTouchEnabled()
+{
+    if (memoryPlacementPolicy == daal::services::Environment::autoMemoryPlacement)
+    {
+        static const bool isMultiPackage = (daal::internal::Service<>::serv_get_ncpus() > 1);
+        return isMultiPackage;
+    }
+    return (memoryPlacementPolicy == daal::services::Environment::firstTouchMemoryPlacement);
+}
+
+void firstTouch(void * ptr, size_t sizeInBytes, bool fillZeros)
+{
+    char * const cptr = (char *)ptr;
+    if (!cptr) return;
+
+    if (sizeInBytes < firstTouchMinSize || daal::threader_get_threads_number() < 2 || !isFirstTouchEnabled())
+    {
+        if (fillZeros)
+        {
+            for (size_t i = 0; i < sizeInBytes; i++)
+            {
+                cptr[i] = '\0';
+            }
+        }
+        return;
+    }
+
+    const size_t nBlocks = (sizeInBytes + firstTouchBlockSize - 1) / firstTouchBlockSize;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * firstTouchBlockSize;
+        const size_t end   = (begin + firstTouchBlockSize < sizeInBytes) ? begin + firstTouchBlockSize : sizeInBytes;
+        if (fillZeros)
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                cptr[i] = '\0';
+            }
+        }
+        else
+        {
+            /* Writing a single byte is enough to fault the page in on the NUMA node of the current thread */
+            for (size_t i = begin; i < end; i += firstTouchPageSize)
+            {
+                cptr[i] = '\0';
+            }
+        }
+    });
+}
+
+/* Size of a transparent huge page on Intel(R) 64 */
+const size_t hugePageSize = 2 * 1024 * 1024;
+
+static int hugePagesPolicy         = daal::services::Environment::noHugePages;
+static size_t hugePagesMinSize     = hugePageSize;
+static size_t hugePagesAdvisedSize = 0;
+
+static daal::Mutex & hugePagesMutex()
+{
+    static daal::Mutex mutex;
+    return mutex;
+}
+
+int setHugePagesPolicy(int policy, size_t minSize)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    AUTOLOCK(hugePagesMutex());
+    hugePagesMinSize     = (minSize > hugePageSize) ? minSize : hugePageSize;
+    hugePagesPolicy      = policy;
+    hugePagesAdvisedSize = 0;
+    return 0;
+#else
+    return (policy == daal::services::Environment::noHugePages) ? 0 : -1;
+#endif
+}
+
+size_t getHugePagesAdvisedSize()
+{
+    AUTOLOCK(hugePagesMutex());
+    return hugePagesAdvisedSize;
+}
+
+void adviseHugePages(void * ptr, size_t sizeInBytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (!ptr || hugePagesPolicy != daal::services::Environment::transparentHugePages || sizeInBytes < hugePagesMinSize) return;
+
+    const size_t begin = ((size_t)ptr + hugePageSize - 1) / hugePageSize * hugePageSize;
+    const size_t end   = ((size_t)ptr + sizeInBytes) / hugePageSize * hugePageSize;
+    if (begin >= end) return;
+
+    /* On failure, e.g. if transparent huge pages are disabled in the kernel, the buffer stays backed with regular pages */
+    if (madvise((void *)begin, end - begin, MADV_HUGEPAGE) != 0) return;
+
+    AUTOLOCK(hugePagesMutex());
+    hugePagesAdvisedSize += end - begin;
+#endif
+}
+
+struct AccountedBlock
+{
+    void * ptr;
+    size_t size;
+};
+
+/* Open addressing table of the blocks allocated while the accounting is enabled */
+static AccountedBlock * accountedBlocks = NULL;
+static size_t accountedCapacity         = 0;
+static size_t accountedUsed             = 0; /* Including the removed entries */
+static size_t accountedLive             = 0;
+static volatile bool accountingEnabled  = false;
+static size_t allocatedSize             = 0;
+static size_t peakAllocatedSize         = 0;
+
+static DAAL_SCRATCH_THREAD_LOCAL size_t lastComputePeakSize = 0;
+
+static void * const accountedRemoved = (void *)1;
+
+static daal::Mutex & accountingMutex()
+{
+    static daal::Mutex mutex;
+    return mutex;
+}
+
+static size_t accountedSlot(const void * ptr, size_t capacity)
+{
+    return (((size_t)ptr >> 4) * (size_t)0x9E3779B97F4A7C15ULL) & (capacity - 1);
+}
+
+static void clearAccountedBlocks()
+{
+    daal::internal::Service<>::serv_free(accountedBlocks);
+    accountedBlocks   = NULL;
+    accountedCapacity = 0;
+    accountedUsed     = 0;
+    accountedLive     = 0;
+}
+
+/* Grows the table so that it is at most half full after the insertion */
+static bool reserveAccountedBlocks()
+{
+    if (2 * (accountedUsed + 1) <= accountedCapacity) return true;
+
+    /* Rehashing drops the removed entries, the table is grown only if the live entries take more than a quarter of it */
+    size_t capacity = 1024;
+    while (4 * (accountedLive + 1) > capacity) capacity *= 2;
+
+    AccountedBlock * blocks = (AccountedBlock *)daal::internal::Service<>::serv_malloc(capacity * sizeof(AccountedBlock), 64);
+    if (!blocks) return false;
+    for (size_t i = 0; i < capacity; ++i) blocks[i].ptr = NULL;
+
+    size_t used = 0;
+    for (size_t i = 0; i < accountedCapacity; ++i)
+    {
+        if (!accountedBlocks[i].ptr || accountedBlocks[i].ptr == accountedRemoved) continue;
+        size_t slot = accountedSlot(accountedBlocks[i].ptr, capacity);
+        while (blocks[slot].ptr) slot = (slot + 1) & (capacity - 1);
+        blocks[slot] = accountedBlocks[i];
+        ++used;
+    }
+
+    daal::internal::Service<>::serv_free(accountedBlocks);
+    accountedBlocks   = blocks;
+    accountedCapacity = capacity;
+    accountedUsed     = used;
+    return true;
+}
+
+void enableMemoryAccounting(bool enableFlag)
+{
+    AUTOLOCK(accountingMutex());
+    if (enableFlag && !accountingEnabled)
+    {
+        allocatedSize     = 0;
+        peakAllocatedSize = 0;
+    }
+    if (!enableFlag) clearAccountedBlocks();
+    accountingEnabled = enableFlag;
+}
+
+void accountMalloc(void * ptr, size_t sizeInBytes)
+{
+    if (!accountingEnabled || !ptr) return;
+
+    AUTOLOCK(accountingMutex());
+    if (!accountingEnabled || !reserveAccountedBlocks()) return;
+
+    /* The block freed by a path that is not accounted leaves a stale entry, it is replaced when its address is allocated again */
+    size_t slot     = accountedSlot(ptr, accountedCapacity);
+    size_t freeSlot = accountedCapacity;
+    for (; accountedBlocks[slot].ptr && accountedBlocks[slot].ptr != ptr; slot = (slot + 1) & (accountedCapacity - 1))
+    {
+        if (accountedBlocks[slot].ptr == accountedRemoved && freeSlot == accountedCapacity) freeSlot = slot;
+    }
+    if (accountedBlocks[slot].ptr == ptr)
+    {
+        allocatedSize -= accountedBlocks[slot].size;
+    }
+    else
+    {
+        if (freeSlot != accountedCapacity) slot = freeSlot;
+        else ++accountedUsed;
+        ++accountedLive;
+    }
+    accountedBlocks[slot].ptr  = ptr;
+    accountedBlocks[slot].size = sizeInBytes;
+
+    allocatedSize += sizeInBytes;
+    if (allocatedSize > peakAllocatedSize) peakAllocatedSize = allocatedSize;
+}
+
+void accountFree(void * ptr)
+{
+    if (!accountingEnabled || !ptr) return;
+
+    AUTOLOCK(accountingMutex());
+    if (!accountedCapacity) return;
+
+    for (size_t slot = accountedSlot(ptr, accountedCapacity); accountedBlocks[slot].ptr; slot = (slot + 1) & (accountedCapacity - 1))
+    {
+        if (accountedBlocks[slot].ptr == ptr)
+        {
+            allocatedSize -= accountedBlocks[slot].size;
+            accountedBlocks[slot].ptr = accountedRemoved;
+            --accountedLive;
+            return;
+        }
+    }
+}
+
+size_t getAllocatedMemorySize()
+{
+    AUTOLOCK(accountingMutex());
+    return allocatedSize;
+}
+
+size_t getPeakAllocatedMemorySize()
+{
+    AUTOLOCK(accountingMutex());
+    return peakAllocatedSize;
+}
+
+void resetPeakAllocatedMemorySize()
+{
+    AUTOLOCK(accountingMutex());
+    peakAllocatedSize = allocatedSize;
+}
+
+size_t getLastComputePeakMemorySize()
+{
+    return lastComputePeakSize;
+}
+
+MemoryAccountingScope::MemoryAccountingScope() : _startSize(0), _outerPeakSize(0), _isActive(accountingEnabled)
+{
+    if (!_isActive) return;
+
+    AUTOLOCK(accountingMutex());
+    _startSize        = allocatedSize;
+    _outerPeakSize    = peakAllocatedSize;
+    peakAllocatedSize = allocatedSize;
+}
+
+MemoryAccountingScope::~MemoryAccountingScope()
+{
+    if (!_isActive) return;
+
+    AUTOLOCK(accountingMutex());
+    lastComputePeakSize = (peakAllocatedSize > _startSize) ? peakAllocatedSize - _startSize : 0;
+    if (_outerPeakSize > peakAllocatedSize) peakAllocatedSize = _outerPeakSize;
+}
+
+/* Each block returned by scratchMalloc() is preceded by the header that tells where the block comes from */
+const size_t scratchHeaderSize = 64;
+/* Default size of the chunks of the arena */
+const size_t scratchChunkSize = 1024 * 1024;
+/* Larger blocks are allocated by daal_malloc(), their allocation cost is small compared to the work on them */
+const size_t scratchMaxBlockSize = 16 * 1024 * 1024;
+/* Size of the chunks an idle arena keeps for the next scopes */
+const size_t scratchMaxRetainedSize = 64 * 1024 * 1024;
+
+struct ScratchChunk
+{
+    ScratchChunk * next;
+    size_t size;
+    size_t used;
+    char * data() { return (char *)this + scratchHeaderSize; }
+};
+
+struct ScratchArena
+{
+    ScratchChunk * first;
+    ScratchChunk * current;
+    ScratchArena * nextIdle;
+};
+
+struct ScratchHeader
+{
+    ScratchArena * arena; /* NULL if the block is allocated by daal_malloc() */
+    size_t begin;         /* Offset of the header in the chunk of the arena */
+    size_t end;           /* Offset of the end of the block in the chunk of the arena */
+    size_t pad;           /* Offset of the block from the beginning of the memory allocated by daal_malloc() */
+};
+
+static DAAL_SCRATCH_THREAD_LOCAL ScratchArena * scratchArena = NULL;
+static ScratchArena * idleScratchArenas                      = NULL;
+
+static daal::Mutex & scratchArenaMutex()
+{
+    static daal::Mutex mutex;
+    return mutex;
+}
+
+static ScratchHeader * scratchHeader(void * ptr)
+{
+    return (ScratchHeader *)((char *)ptr - sizeof(ScratchHeader));
+}
+
+static void releaseScratchChunks(ScratchArena * arena, size_t retainedSize)
+{
+    size_t size          = 0;
+    ScratchChunk ** next = &arena->first;
+    while (*next)
+    {
+        ScratchChunk * chunk = *next;
+        if (size + chunk->size <= retainedSize)
+        {
+            size += chunk->size;
+            chunk->used = 0;
+            next        = &chunk->next;
+        }
+        else
+        {
+            *next = chunk->next;
+            daal::services::daal_free(chunk);
+        }
+    }
+    arena->current = arena->first;
+}
+
+void scratchArenaEnter(ScratchArenaMark & mark)
+{
+    mark.isOutermost = (scratchArena == NULL);
+    if (mark.isOutermost)
+    {
+        {
+            AUTOLOCK(scratchArenaMutex());
+            scratchArena = idleScratchArenas;
+            if (scratchArena) idleScratchArenas = scratchArena->nextIdle;
+        }
+        if (!scratchArena)
+        {
+            scratchArena = (ScratchArena *)daal::services::daal_malloc(sizeof(ScratchArena));
+            if (scratchArena)
+            {
+                scratchArena->first   = NULL;
+                scratchArena->current = NULL;
+            }
+        }
+    }
+    mark.chunk = scratchArena ? scratchArena->current : NULL;
+    mark.used  = (mark.chunk) ? ((ScratchChunk *)mark.chunk)->used : 0;
+}
+
+void scratchArenaLeave(const ScratchArenaMark & mark)
+{
+    ScratchArena * arena = scratchArena;
+    if (!arena) return;
+
+    if (mark.isOutermost)
+    {
+        releaseScratchChunks(arena, scratchMaxRetainedSize);
+        scratchArena = NULL;
+
+        AUTOLOCK(scratchArenaMutex());
+        arena->nextIdle   = idleScratchArenas;
+        idleScratchArenas = arena;
+        return;
+    }
+
+    /* The blocks allocated within the nested scope are above the mark */
+    ScratchChunk * chunk = (ScratchChunk *)mark.chunk;
+    for (ScratchChunk * c = chunk ? chunk->next : arena->first; c; c = c->next) c->used = 0;
+    if (chunk) chunk->used = mark.used;
+    arena->current = chunk ? chunk : arena->first;
+}
+
+static void * scratchHeapMalloc(size_t sizeInBytes, size_t alignment)
+{
+    const size_t pad = (alignment > scratchHeaderSize) ? alignment : scratchHeaderSize;
+    char * block     = (char *)daal::services::daal_malloc(pad + sizeInBytes, alignment);
+    if (!block) return NULL;
+
+    ScratchHeader * header = scratchHeader(block + pad);
+    header->arena          = NULL;
+    header->pad            = pad;
+    return block + pad;
+}
+
+void * scratchMalloc(size_t sizeInBytes, size_t alignment)
+{
+    ScratchArena * arena = scratchArena;
+    const size_t size    = scratchHeaderSize + (sizeInBytes + scratchHeaderSize - 1) / scratchHeaderSize * scratchHeaderSize;
+    if (!arena || alignment > scratchHeaderSize || size > scratchMaxBlockSize) return scratchHeapMalloc(sizeInBytes, alignment);
+
+    ScratchChunk * chunk = arena->current;
+    while (chunk && chunk->used + size > chunk->size)
+    {
+        chunk = chunk->next;
+        if (chunk) chunk->used = 0;
+    }
+    if (!chunk)
+    {
+        const size_t chunkSize = (size > scratchChunkSize) ? size : scratchChunkSize;
+        chunk                  = (ScratchChunk *)daal::services::daal_malloc(scratchHeaderSize + chunkSize, scratchHeaderSize);
+        if (!chunk) return scratchHeapMalloc(sizeInBytes, alignment);
+        chunk->size = chunkSize;
+        chunk->used = 0;
+
+        /* The new chunk follows the current one, the chunks before the current one are in use */
+        ScratchChunk ** next = arena->current ? &arena->current->next : &arena->first;
+        chunk->next          = *next;
+        *next                = chunk;
+    }
+    arena->current = chunk;
+
+    const size_t begin = chunk->used;
+    chunk->used += size;
+
+    char * ptr             = chunk->data() + begin + scratchHeaderSize;
+    ScratchHeader * header = scratchHeader(ptr);
+    header->arena          = arena;
+    header->begin          = begin;
+    header->end            = chunk->used;
+    return ptr;
+}
+
+void scratchFree(void * ptr)
+{
+    if (!ptr) return;
+
+    ScratchHeader * header = scratchHeader(ptr);
+    if (!header->arena)
+    {
+        daal::services::daal_free((char *)ptr - header->pad);
+        return;
+    }
+
+    /* The last block of the arena of the calling thread is released at once, so the arrays that are reallocated in a loop
+       reuse the memory. Other blocks are released in bulk when the scope is left */
+    ScratchArena * arena = scratchArena;
+    if (header->arena != arena) return;
+
+    ScratchChunk * chunk = arena->current;
+    if (chunk->data() + header->begin == (char *)ptr - scratchHeaderSize && header->end == chunk->used)
+    {
+        chunk->used = header->begin;
+    }
+}
+
+void scratchArenaFreeBuffers()
+{
+    AUTOLOCK(scratchArenaMutex());
+    while (idleScratchArenas)
+    {
+        ScratchArena * arena = idleScratchArenas;
+        idleScratchArenas    = arena->nextIdle;
+        releaseScratchChunks(arena, 0);
+        daal::services::daal_free(arena);
+    }
+}
+
+} // namespace internal
+} // namespace services
+} // namespace daal
 
 void * daal::services::daal_malloc(size_t size, size_t alignment)
 {
-    return daal::internal::Service<>::serv_malloc(size, alignment);
+    void * ptr = daal::internal::Service<>::serv_malloc(size, alignment);
+    daal::services::internal::adviseHugePages(ptr, size);
+    daal::services::internal::accountMalloc(ptr, size);
+    return ptr;
 }
 
 void * daal::services::daal_calloc(size_t size, size_t alignment)
@@ -47,8 +556,18 @@ void * daal::services::daal_calloc(size_t size, size_t alignment)
     return ptr;
 }
 
+void * daal::services::internal::daal_malloc_table_data(size_t size, size_t alignment)
+{
+    void * ptr = daal::internal::Service<>::serv_malloc(size, alignment);
+    daal::services::internal::adviseHugePages(ptr, size);
+    daal::services::internal::firstTouch(ptr, size, false);
+    daal::services::internal::accountMalloc(ptr, size);
+    return ptr;
+}
+
 void daal::services::daal_free(void * ptr)
 {
+    daal::services::internal::accountFree(ptr);
     daal::internal::Service<>::serv_free(ptr);
 }
 
@@ -63,6 +582,7 @@ namespace services
 {
 void daal_free_buffers()
 {
+    daal::services::internal::scratchArenaFreeBuffers();
     daal::internal::Service<>::serv_free_buffers();
 }
 } // namespace services
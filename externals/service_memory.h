@@ -35,24 +35,87 @@ namespace services
 {
 namespace internal
 {
-template <typename T, CpuType cpu>
-T * service_calloc(size_t size, size_t alignment = 64)
+/* Sets the value of Environment::MemoryPlacementPolicy used by daal_malloc_table_data */
+void setMemoryPlacementPolicy(int policy);
+
+/* Sets the value of Environment::HugePagesPolicy and the size of the smallest buffer backed with huge pages,
+   returns -1 if huge pages are not supported on the system */
+int setHugePagesPolicy(int policy, size_t minSize);
+size_t getHugePagesAdvisedSize();
+
+/* Advises the operating system to back the huge pages that lie within a newly allocated buffer with transparent huge pages.
+   Must be called before the pages of the buffer are touched */
+void adviseHugePages(void * ptr, size_t sizeInBytes);
+
+/* Touches the pages of a newly allocated buffer, optionally filling it with zeros.
+   Large buffers are touched by the worker threads in parallel when first-touch memory placement is enabled */
+void firstTouch(void * ptr, size_t sizeInBytes, bool fillZeros);
+
+/* Accounting of the memory allocated by the library, see Environment::enableMemoryAccounting().
+   The blocks allocated while the accounting is enabled are recorded with their sizes, the frees of the other blocks are ignored */
+void enableMemoryAccounting(bool enableFlag);
+void accountMalloc(void * ptr, size_t sizeInBytes);
+void accountFree(void * ptr);
+size_t getAllocatedMemorySize();
+size_t getPeakAllocatedMemorySize();
+void resetPeakAllocatedMemorySize();
+size_t getLastComputePeakMemorySize();
+
+/* Scope of one call of compute(), records the peak of the allocated memory above its level at the entry to the scope.
+   The peaks of the overlapping calls made by different threads include the memory of each other */
+class MemoryAccountingScope
 {
-    T * ptr = (T *)daal::services::daal_malloc(size * sizeof(T), alignment);
-    if (ptr == NULL)
-    {
-        return NULL;
-    }
+public:
+    MemoryAccountingScope();
+    ~MemoryAccountingScope();
 
-    char * const cptr        = (char *)ptr;
-    const size_t sizeInBytes = size * sizeof(T);
+private:
+    MemoryAccountingScope(const MemoryAccountingScope &);
+    MemoryAccountingScope & operator=(const MemoryAccountingScope &);
 
-    for (size_t i = 0; i < sizeInBytes; i++)
-    {
-        cptr[i] = '\0';
-    }
+    size_t _startSize;
+    size_t _outerPeakSize;
+    bool _isActive;
+};
 
-    return ptr;
+/* Position of the scratch arena of the calling thread at the entry to a scope */
+struct ScratchArenaMark
+{
+    void * chunk;
+    size_t used;
+    bool isOutermost;
+};
+
+/* Per-thread bump arena for the temporaries of the kernels. Between scratchArenaEnter() and scratchArenaLeave() scratchMalloc()
+   serves the calling thread from the arena; the memory allocated within the scope is released in bulk when the scope is left,
+   and the blocks of the arena are kept for the next scopes. Outside of a scope, in other threads and for large sizes
+   scratchMalloc() falls back to daal_malloc(). scratchFree() accepts the memory from both sources */
+void scratchArenaEnter(ScratchArenaMark & mark);
+void scratchArenaLeave(const ScratchArenaMark & mark);
+void * scratchMalloc(size_t sizeInBytes, size_t alignment);
+void scratchFree(void * ptr);
+
+/* Releases the blocks of the idle scratch arenas */
+void scratchArenaFreeBuffers();
+
+/* Scope of the scratch arena of the calling thread, entered around compute() of the algorithms */
+class ScratchArenaScope
+{
+public:
+    ScratchArenaScope() { scratchArenaEnter(_mark); }
+    ~ScratchArenaScope() { scratchArenaLeave(_mark); }
+
+private:
+    ScratchArenaScope(const ScratchArenaScope &);
+    ScratchArenaScope & operator=(const ScratchArenaScope &);
+
+    ScratchArenaMark _mark;
+};
+
+template <typename T, CpuType cpu>
+T * service_calloc(size_t size, size_t alignment = 64)
+{
+    return (T *)daal::services::daal_calloc(size * sizeof(T), alignment);
 }
 
 template <typename T, CpuType cpu>
@@ -76,6 +139,7 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
     {
         return NULL;
     }
+    accountMalloc(ptr, size * sizeof(T));
 
     char * const cptr        = (char *)ptr;
     const size_t sizeInBytes = size * sizeof(T);
@@ -91,15 +155,51 @@ T * service_scalable_calloc(size_t size, size_t alignment = 64)
 template <typename T, CpuType cpu>
 T * service_scalable_malloc(size_t size, size_t alignment = 64)
 {
-    return (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    T * ptr = (T *)threaded_scalable_malloc(size * sizeof(T), alignment);
+    accountMalloc(ptr, size * sizeof(T));
+    return ptr;
 }
 
 template <typename T, CpuType cpu>
 void service_scalable_free(T * ptr)
 {
+    accountFree(ptr);
     threaded_scalable_free(ptr);
 }
 
+template <typename T, CpuType cpu>
+T * service_scratch_malloc(size_t size, size_t alignment = 64)
+{
+    return (T *)scratchMalloc(size * sizeof(T), alignment);
+}
+
+template <typename T, CpuType cpu>
+T * service_scratch_calloc(size_t size, size_t alignment = 64)
+{
+    T * ptr = (T *)scratchMalloc(size * sizeof(T), alignment);
+
+    if (ptr == NULL)
+    {
+        return NULL;
+    }
+
+    char * const cptr        = (char *)ptr;
+    const size_t sizeInBytes = size * sizeof(T);
+
+    for (size_t i = 0; i < sizeInBytes; i++)
+    {
+        cptr[i] = '\0';
+    }
+
+    return ptr;
+}
+
+template <typename T, CpuType cpu>
+void service_scratch_free(T * ptr)
+{
+    scratchFree(ptr);
+}
+
 template <typename T, CpuType cpu>
 T * service_memset(T * const ptr, const T value, const size_t num)
 {
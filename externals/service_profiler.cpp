@@ -16,11 +16,271 @@
 *******************************************************************************/
 
 #include "externals/service_profiler.h"
+#include "services/daal_atomic_int.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+    #define DAAL_PROFILER_THREAD_LOCAL __declspec(thread)
+#else
+    #include <time.h>
+    #include <pthread.h>
+    #if defined(__linux__)
+        #include <unistd.h>
+        #include <sys/syscall.h>
+        #include <linux/perf_event.h>
+    #endif
+    #define DAAL_PROFILER_THREAD_LOCAL __thread
+#endif
 
 namespace daal
 {
 namespace internal
 {
+namespace
+{
+/* Hardware counters sampled for each task: cycles, instructions and last level cache misses */
+const size_t nCounters = 3;
+
+struct TraceEvent
+{
+    const char * name;
+    unsigned long long start;
+    unsigned long long duration;
+    unsigned long long counters[nCounters];
+    size_t bytes;
+    size_t flops;
+    size_t threadId;
+    size_t depth;
+};
+
+/* The oldest events are overwritten when the buffer is full */
+const size_t traceCapacity = 1 << 16;
+TraceEvent traceBuffer[traceCapacity];
+services::Atomic<size_t> traceCount(0);
+
+volatile bool traceEnabled        = false;
+unsigned long long traceStartTime = 0;
+
+DAAL_PROFILER_THREAD_LOCAL ProfilerTask * currentTask = NULL;
+DAAL_PROFILER_THREAD_LOCAL size_t currentDepth        = 0;
+
+volatile bool countersEnabled = false;
+
+/* Size of the cache line used to convert the last level cache misses to the bytes transferred from the memory */
+const size_t cacheLineSize = 64;
+
+#if defined(__linux__)
+/* Counters of a thread are opened as one group on the first task of the thread and closed at the exit of the thread */
+struct CounterGroup
+{
+    int fds[nCounters];
+};
+
+DAAL_PROFILER_THREAD_LOCAL CounterGroup * counterGroup = NULL;
+DAAL_PROFILER_THREAD_LOCAL bool counterGroupFailed     = false;
+
+pthread_key_t counterGroupKey;
+pthread_once_t counterGroupKeyOnce = PTHREAD_ONCE_INIT;
+
+void closeCounterGroup(void * ptr)
+{
+    CounterGroup * group = (CounterGroup *)ptr;
+    for (size_t i = 0; i < nCounters; ++i)
+    {
+        if (group->fds[i] >= 0) close(group->fds[i]);
+    }
+    free(group);
+}
+
+void createCounterGroupKey()
+{
+    pthread_key_create(&counterGroupKey, closeCounterGroup);
+}
+
+int openCounter(unsigned long long config, int groupFd)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = config;
+    attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+CounterGroup * getCounterGroup()
+{
+    if (counterGroup || counterGroupFailed) return counterGroup;
+
+    CounterGroup * group = (CounterGroup *)malloc(sizeof(CounterGroup));
+    if (!group)
+    {
+        counterGroupFailed = true;
+        return NULL;
+    }
+    static const unsigned long long configs[nCounters] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES };
+    bool isOpened                                      = true;
+    for (size_t i = 0; i < nCounters; ++i)
+    {
+        group->fds[i] = isOpened ? openCounter(configs[i], i ? group->fds[0] : -1) : -1;
+        isOpened      = isOpened && group->fds[i] >= 0;
+    }
+    if (!isOpened)
+    {
+        closeCounterGroup(group);
+        counterGroupFailed = true;
+        return NULL;
+    }
+
+    pthread_once(&counterGroupKeyOnce, createCounterGroupKey);
+    pthread_setspecific(counterGroupKey, group);
+    counterGroup = group;
+    return counterGroup;
+}
+
+/* Reads the counters of the calling thread scaled by the share of the time they were running if the counters were multiplexed */
+void readCounters(unsigned long long * values)
+{
+    for (size_t i = 0; i < nCounters; ++i) values[i] = 0;
+    if (!countersEnabled) return;
+    CounterGroup * group = getCounterGroup();
+    if (!group) return;
+
+    /* Number of counters, time enabled, time running and the values of the counters */
+    unsigned long long buffer[3 + nCounters];
+    if (read(group->fds[0], buffer, sizeof(buffer)) != (ssize_t)sizeof(buffer) || !buffer[2]) return;
+    const double scale = (double)buffer[1] / (double)buffer[2];
+    for (size_t i = 0; i < nCounters; ++i) values[i] = (unsigned long long)((double)buffer[3 + i] * scale);
+}
+#else
+void * getCounterGroup()
+{
+    return NULL;
+}
+
+void readCounters(unsigned long long * values)
+{
+    for (size_t i = 0; i < nCounters; ++i) values[i] = 0;
+}
+#endif
+
+/* Returns monotonic time in nanoseconds */
+unsigned long long getTime()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    static LARGE_INTEGER frequency = { 0 };
+    if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)(counter.QuadPart / frequency.QuadPart) * 1000000000ULL
+           + (unsigned long long)(counter.QuadPart % frequency.QuadPart) * 1000000000ULL / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+size_t getThreadId()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    return (size_t)GetCurrentThreadId();
+#elif defined(__linux__)
+    return (size_t)syscall(SYS_gettid);
+#else
+    return (size_t)pthread_self();
+#endif
+}
+
+void writeEscaped(FILE * file, const char * str)
+{
+    for (; str && *str; ++str)
+    {
+        if (*str == '"' || *str == '\\') fputc('\\', file);
+        fputc(*str, file);
+    }
+}
+
+/* Tracing can be turned on without code changes: DAAL_KERNEL_TRACE=<file> records the whole run and writes it to the file at exit,
+   DAAL_KERNEL_SUMMARY=<file> also samples the hardware counters and writes the tasks aggregated by the name to the file at exit */
+class TraceFromEnvironment
+{
+public:
+    TraceFromEnvironment() : _fileName(getenv("DAAL_KERNEL_TRACE")), _summaryFileName(getenv("DAAL_KERNEL_SUMMARY"))
+    {
+        if (_summaryFileName && *_summaryFileName) Profiler::enableCounters(true);
+        if ((_fileName && *_fileName) || (_summaryFileName && *_summaryFileName)) Profiler::enable(true);
+    }
+    ~TraceFromEnvironment()
+    {
+        if (_fileName && *_fileName) Profiler::writeTrace(_fileName);
+        if (_summaryFileName && *_summaryFileName) Profiler::writeSummary(_summaryFileName);
+    }
+
+private:
+    const char * _fileName;
+    const char * _summaryFileName;
+};
+
+TraceFromEnvironment traceFromEnvironment;
+
+struct DispatchEvent
+{
+    const char * kernelName;
+    const char * fileName;
+    int cpu;
+    size_t threadId;
+};
+
+const size_t dispatchCapacity = 1 << 12;
+DispatchEvent dispatchBuffer[dispatchCapacity];
+services::Atomic<size_t> dispatchCount(0);
+
+volatile bool dispatchEnabled = false;
+
+const char * getCpuName(int cpu)
+{
+    static const char * cpuNames[] = { "sse2", "ssse3", "sse42", "avx", "avx2", "avx512_mic", "avx512", "avx512_mic_e1" };
+    return (cpu >= 0 && cpu < (int)(sizeof(cpuNames) / sizeof(cpuNames[0]))) ? cpuNames[cpu] : "unknown";
+}
+
+const char * getBaseName(const char * fileName)
+{
+    const char * baseName = fileName;
+    for (const char * c = fileName; c && *c; ++c)
+    {
+        if (*c == '/' || *c == '\\') baseName = c + 1;
+    }
+    return baseName;
+}
+
+/* DAAL_DISPATCH_REPORT=<file> records the CPU branches of the whole run and writes them to the file at exit */
+class DispatchReportFromEnvironment
+{
+public:
+    DispatchReportFromEnvironment() : _fileName(getenv("DAAL_DISPATCH_REPORT"))
+    {
+        if (_fileName && *_fileName) DispatchReport::enable(true);
+    }
+    ~DispatchReportFromEnvironment()
+    {
+        if (_fileName && *_fileName) DispatchReport::write(_fileName);
+    }
+
+private:
+    const char * _fileName;
+};
+
+DispatchReportFromEnvironment dispatchReportFromEnvironment;
+
+} // namespace
+
 ProfilerTask Profiler::startTask(const char * taskName)
 {
     return ProfilerTask(taskName);
@@ -28,11 +288,226 @@ ProfilerTask Profiler::startTask(const char * taskName)
 
 void Profiler::endTask(const char * taskName) {}
 
-ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName) {}
+void Profiler::addBytes(size_t nBytes)
+{
+    if (traceEnabled && currentTask) currentTask->_bytes += nBytes;
+}
+
+void Profiler::addFlops(size_t nFlops)
+{
+    if (traceEnabled && currentTask) currentTask->_flops += nFlops;
+}
+
+void Profiler::enable(bool enableFlag)
+{
+    if (enableFlag && !traceEnabled)
+    {
+        traceCount.set(0);
+        traceStartTime = getTime();
+    }
+    traceEnabled = enableFlag;
+}
+
+bool Profiler::isEnabled()
+{
+    return traceEnabled;
+}
+
+int Profiler::writeTrace(const char * fileName)
+{
+    if (!fileName) return -1;
+    FILE * file = fopen(fileName, "w");
+    if (!file) return -1;
+
+    const size_t nEvents = traceCount.get();
+    const size_t first   = (nEvents > traceCapacity) ? nEvents - traceCapacity : 0;
+
+    fprintf(file, "{\"traceEvents\":[");
+    for (size_t i = first; i < nEvents; ++i)
+    {
+        const TraceEvent & e = traceBuffer[i % traceCapacity];
+        fprintf(file, "%s\n{\"name\":\"", (i == first) ? "" : ",");
+        writeEscaped(file, e.name);
+        fprintf(file, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"bytes\":%llu,\"flops\":%llu,\"depth\":%llu",
+                (unsigned long long)e.threadId, (double)(e.start - traceStartTime) * 1e-3, (double)e.duration * 1e-3, (unsigned long long)e.bytes,
+                (unsigned long long)e.flops, (unsigned long long)e.depth);
+        if (e.counters[0])
+        {
+            fprintf(file, ",\"cycles\":%llu,\"instructions\":%llu,\"llc_misses\":%llu", e.counters[0], e.counters[1], e.counters[2]);
+        }
+        fprintf(file, "}}");
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    const int result = ferror(file);
+    fclose(file);
+    return result ? -1 : 0;
+}
+
+bool Profiler::enableCounters(bool enableFlag)
+{
+    if (enableFlag && !getCounterGroup()) return false;
+    countersEnabled = enableFlag;
+    return true;
+}
+
+bool Profiler::isCountersEnabled()
+{
+    return countersEnabled;
+}
+
+int Profiler::writeSummary(const char * fileName)
+{
+    if (!fileName) return -1;
+
+    const size_t nEvents = traceCount.get();
+    const size_t first   = (nEvents > traceCapacity) ? nEvents - traceCapacity : 0;
+
+    /* Tasks are aggregated by the name, the time and the counters of a task include the nested tasks */
+    struct TaskSummary
+    {
+        const char * name;
+        size_t nCalls;
+        unsigned long long duration;
+        unsigned long long counters[nCounters];
+        unsigned long long bytes;
+        unsigned long long flops;
+    };
+    TaskSummary * tasks = (TaskSummary *)calloc(nEvents - first + 1, sizeof(TaskSummary));
+    if (!tasks) return -1;
+
+    size_t nTasks = 0;
+    for (size_t i = first; i < nEvents; ++i)
+    {
+        const TraceEvent & e = traceBuffer[i % traceCapacity];
+        size_t j             = 0;
+        while (j < nTasks && tasks[j].name != e.name && strcmp(tasks[j].name, e.name)) ++j;
+        if (j == nTasks) tasks[nTasks++].name = e.name;
+
+        TaskSummary & t = tasks[j];
+        ++t.nCalls;
+        t.duration += e.duration;
+        t.bytes += e.bytes;
+        t.flops += e.flops;
+        for (size_t k = 0; k < nCounters; ++k) t.counters[k] += e.counters[k];
+    }
+
+    FILE * file = fopen(fileName, "w");
+    if (!file)
+    {
+        free(tasks);
+        return -1;
+    }
+    fprintf(file, "task,calls,time_ms,bytes,flops,cycles,instructions,llc_misses,ipc,gb_per_s,dram_gb_per_s,gflop_per_s\n");
+    for (size_t j = 0; j < nTasks; ++j)
+    {
+        const TaskSummary & t = tasks[j];
+        /* Bytes per nanosecond and operations per nanosecond are GB/s and GFLOP/s */
+        const double duration = t.duration ? (double)t.duration : 1.0;
+        fputc('"', file);
+        writeEscaped(file, t.name);
+        fprintf(file, "\",%llu,%.6f,%llu,%llu,%llu,%llu,%llu,%.3f,%.3f,%.3f,%.3f\n", (unsigned long long)t.nCalls, (double)t.duration * 1e-6, t.bytes,
+                t.flops, t.counters[0], t.counters[1], t.counters[2], t.counters[0] ? (double)t.counters[1] / (double)t.counters[0] : 0.0,
+                (double)t.bytes / duration, (double)(t.counters[2] * cacheLineSize) / duration, (double)t.flops / duration);
+    }
+    free(tasks);
+
+    const int result = ferror(file);
+    fclose(file);
+    return result ? -1 : 0;
+}
+
+void DispatchReport::record(const char * kernelName, const char * fileName, int cpu)
+{
+    if (!dispatchEnabled) return;
+    DispatchEvent & e = dispatchBuffer[(dispatchCount.inc() - 1) % dispatchCapacity];
+    e.kernelName      = kernelName;
+    e.fileName        = fileName;
+    e.cpu             = cpu;
+    e.threadId        = getThreadId();
+}
+
+void DispatchReport::enable(bool enableFlag)
+{
+    if (enableFlag && !dispatchEnabled) dispatchCount.set(0);
+    dispatchEnabled = enableFlag;
+}
+
+bool DispatchReport::isEnabled()
+{
+    return dispatchEnabled;
+}
+
+int DispatchReport::write(const char * fileName)
+{
+    if (!fileName) return -1;
+    FILE * file = fopen(fileName, "w");
+    if (!file) return -1;
+
+    const size_t nEvents = dispatchCount.get();
+    const size_t first   = (nEvents > dispatchCapacity) ? nEvents - dispatchCapacity : 0;
+
+    for (size_t i = first; i < nEvents; ++i)
+    {
+        const DispatchEvent & e = dispatchBuffer[i % dispatchCapacity];
+        fprintf(file, "%llu %s %s %s %llu\n", (unsigned long long)i, getCpuName(e.cpu), e.kernelName, getBaseName(e.fileName),
+                (unsigned long long)e.threadId);
+    }
+
+    const int result = ferror(file);
+    fclose(file);
+    return result ? -1 : 0;
+}
+
+ProfilerTask::ProfilerTask(const char * taskName) : _taskName(taskName), _start(0), _bytes(0), _flops(0), _isActive(false), _parent(NULL)
+{
+    if (!traceEnabled) return;
+    _isActive   = true;
+    _parent     = currentTask;
+    currentTask = this;
+    ++currentDepth;
+    readCounters(_counters);
+    _start = getTime();
+}
+
+ProfilerTask::ProfilerTask(const ProfilerTask & other)
+    : _taskName(other._taskName),
+      _start(other._start),
+      _bytes(other._bytes),
+      _flops(other._flops),
+      _isActive(other._isActive),
+      _parent(other._parent)
+{
+    for (size_t i = 0; i < nCounters; ++i) _counters[i] = other._counters[i];
+    other._isActive = false;
+    if (_isActive && currentTask == &other) currentTask = this;
+}
 
 ProfilerTask::~ProfilerTask()
 {
     Profiler::endTask(_taskName);
+    if (!_isActive) return;
+
+    const unsigned long long end = getTime();
+    unsigned long long counters[nCounters];
+    readCounters(counters);
+    if (currentTask == this) currentTask = _parent;
+    if (_parent)
+    {
+        _parent->_bytes += _bytes;
+        _parent->_flops += _flops;
+    }
+    --currentDepth;
+
+    TraceEvent & e = traceBuffer[(traceCount.inc() - 1) % traceCapacity];
+    e.name         = _taskName;
+    e.start        = _start;
+    e.duration     = end - _start;
+    e.bytes        = _bytes;
+    e.flops        = _flops;
+    e.threadId     = getThreadId();
+    e.depth        = currentDepth;
+    for (size_t i = 0; i < nCounters; ++i) e.counters[i] = (_counters[0] && counters[i] > _counters[i]) ? counters[i] - _counters[i] : 0;
 }
 
 } // namespace internal
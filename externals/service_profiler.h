@@ -21,6 +21,11 @@
 //--
 */
 
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include "services/daal_defines.h"
+
 namespace daal
 {
 namespace internal
@@ -29,19 +34,72 @@ class ProfilerTask
 {
 public:
     ProfilerTask(const char * taskName);
+    /* Ownership of the measurement moves to the copy, so the task is recorded once */
+    ProfilerTask(const ProfilerTask & other);
     ~ProfilerTask();
 
 private:
+    ProfilerTask & operator=(const ProfilerTask &);
+
+    friend class Profiler;
+
     const char * _taskName;
+    unsigned long long _start;
+    unsigned long long _counters[3];
+    size_t _bytes;
+    size_t _flops;
+    mutable bool _isActive;
+    ProfilerTask * _parent;
 };
 
-// This class is a stub in the library. Its redefinition will be in Bechmarks
+/* Built-in tracer of the library. Records the tasks marked with DAAL_ITTNOTIFY_SCOPED_TASK into a ring buffer
+   when enabled with Environment::enableKernelTracing() or the DAAL_KERNEL_TRACE environment variable.
+   Can still be redefined in Benchmarks */
 class Profiler
 {
 public:
     static ProfilerTask startTask(const char * taskName);
     static void endTask(const char * taskName);
+
+    /* Attributes the number of bytes read or written to the innermost task running in the calling thread */
+    static void addBytes(size_t nBytes);
+
+    /* Attributes the number of floating-point operations to the innermost task running in the calling thread */
+    static void addFlops(size_t nFlops);
+
+    static void enable(bool enableFlag);
+    static bool isEnabled();
+
+    /* Writes recorded tasks in Chrome trace event format, returns 0 on success */
+    static int writeTrace(const char * fileName);
+
+    /* Enables sampling of the hardware counters (cycles, instructions, last level cache misses) of the calling thread for each task,
+       returns false if the counters are not available on the system. Used on Linux via perf_event_open */
+    static bool enableCounters(bool enableFlag);
+    static bool isCountersEnabled();
+
+    /* Writes recorded tasks aggregated by the task name in CSV format with the achieved bandwidth and the rate of floating-point
+       operations, returns 0 on success */
+    static int writeSummary(const char * fileName);
+};
+
+/* Records the CPU branch selected for each kernel call when enabled with Environment::enableDispatchReport()
+   or the DAAL_DISPATCH_REPORT environment variable */
+class DispatchReport
+{
+public:
+    /* kernelName and fileName are expected to be string literals */
+    static void record(const char * kernelName, const char * fileName, int cpu);
+
+    static void enable(bool enableFlag);
+    static bool isEnabled();
+
+    /* Writes the recorded calls one per line: sequence number, CPU branch, kernel, source file of the call and thread id,
+       returns 0 on success */
+    static int write(const char * fileName);
 };
 
 } // namespace internal
 } // namespace daal
+
+#endif
@@ -23,13 +23,123 @@
 
 #include "externals/service_service.h"
 
+namespace
+{
+/*
+    Clinger's fast path of the decimal to binary conversion:
+    if the decimal significand w fits into 53 bits and |q| <= 22, both w and 10^q are exact doubles
+    and w * 10^q (or w / 10^-q) is correctly rounded by a single IEEE operation.
+    Returns false if the text is not a plain decimal number of this kind, the caller falls back to the full conversion then.
+*/
+bool stringToDoubleFastPath(const char * nptr, char ** endptr, double & value)
+{
+    static const double powersOfTen[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                          1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const unsigned long long maxExactSignificand = 1ULL << 53;
+
+    const char * p = nptr;
+    while (*p == ' ' || *p == '\t')
+    {
+        ++p;
+    }
+
+    const bool negative = (*p == '-');
+    if (*p == '-' || *p == '+')
+    {
+        ++p;
+    }
+
+    unsigned long long significand = 0;
+    int nDigits                     = 0;
+    int exponent                    = 0;
+    for (; *p >= '0' && *p <= '9'; ++p, ++nDigits)
+    {
+        significand = significand * 10 + (unsigned long long)(*p - '0');
+    }
+    if (*p == '.')
+    {
+        ++p;
+        for (; *p >= '0' && *p <= '9'; ++p, ++nDigits, --exponent)
+        {
+            significand = significand * 10 + (unsigned long long)(*p - '0');
+        }
+    }
+    /* More than 19 digits may overflow the significand */
+    if (nDigits == 0 || nDigits > 19 || significand > maxExactSignificand)
+    {
+        return false;
+    }
+
+    if (*p == 'e' || *p == 'E')
+    {
+        const char * e              = p + 1;
+        const bool negativeExponent = (*e == '-');
+        if (*e == '-' || *e == '+')
+        {
+            ++e;
+        }
+        if (*e < '0' || *e > '9')
+        {
+            return false;
+        }
+        int explicitExponent = 0;
+        for (; *e >= '0' && *e <= '9'; ++e)
+        {
+            if (explicitExponent > 1000) return false;
+            explicitExponent = explicitExponent * 10 + (*e - '0');
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+        p = e;
+    }
+
+    if (exponent < -22 || exponent > 22)
+    {
+        return false;
+    }
+
+    double result = (double)significand;
+    result        = (exponent < 0) ? result / powersOfTen[-exponent] : result * powersOfTen[exponent];
+    value         = negative ? -result : result;
+
+    if (endptr)
+    {
+        *endptr = const_cast<char *>(p);
+    }
+    return true;
+}
+
+/* Checks whether the double is exactly halfway between two adjacent floats, so rounding it to float can differ
+   from rounding the decimal value it was converted from */
+bool isFloatMidpoint(double value)
+{
+    union
+    {
+        double d;
+        unsigned long long u;
+    } bits;
+    bits.d = value;
+    /* 29 low bits of the double significand are dropped when it is rounded to float */
+    return (bits.u & ((1ULL << 29) - 1)) == (1ULL << 28);
+}
+} // namespace
+
 float daal::services::daal_string_to_float(const char * nptr, char ** endptr)
 {
+    double value = 0.0;
+    if (stringToDoubleFastPath(nptr, endptr, value) && !isFloatMidpoint(value))
+    {
+        return (float)value;
+    }
     return daal::internal::Service<>::serv_string_to_float(nptr, endptr);
 }
 
 double daal::services::daal_string_to_double(const char * nptr, char ** endptr)
 {
+    double value = 0.0;
+    if (stringToDoubleFastPath(nptr, endptr, value))
+    {
+        return value;
+    }
     return daal::internal::Service<>::serv_string_to_double(nptr, endptr);
 }
 
@@ -188,13 +188,13 @@ public:
 
         const size_t nnzTotal = ia[m] - ia[0];
 
-        TArray<uint32_t, cpu> rowIdxCSCArr(nnzTotal);
+        services::internal::TArray<uint32_t, cpu> rowIdxCSCArr(nnzTotal);
         uint32_t * rowIdxCSC = rowIdxCSCArr.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr((n + 1) * nBlocks);
+        services::internal::TArray<uint32_t, cpu> colIdxCSCArr((n + 1) * nBlocks);
         uint32_t * colIdxCSC = colIdxCSCArr.get();
 
-        TArray<fpType, cpu> valuesCSCArr(nnzTotal);
+        services::internal::TArray<fpType, cpu> valuesCSCArr(nnzTotal);
         fpType * valuesCSC = valuesCSCArr.get();
 
         DAAL_CHECK(rowIdxCSC && colIdxCSC && valuesCSC, services::ErrorMemoryAllocationFailed);
@@ -264,22 +264,22 @@ public:
         const size_t nnzTotal_a = ia[ma] - ia[0];
         const size_t nnzTotal_b = ib[mb] - ia[0];
 
-        TArray<uint32_t, cpu> rowIdxCSCArr_a(nnzTotal_a);
+        services::internal::TArray<uint32_t, cpu> rowIdxCSCArr_a(nnzTotal_a);
         uint32_t * rowIdxCSC_a = rowIdxCSCArr_a.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr_a((n + 1) * nBlocks_a);
+        services::internal::TArray<uint32_t, cpu> colIdxCSCArr_a((n + 1) * nBlocks_a);
         uint32_t * colIdxCSC_a = colIdxCSCArr_a.get();
 
-        TArray<fpType, cpu> valuesCSCArr_a(nnzTotal_a);
+        services::internal::TArray<fpType, cpu> valuesCSCArr_a(nnzTotal_a);
         fpType * valuesCSC_a = valuesCSCArr_a.get();
 
-        TArray<uint32_t, cpu> rowIdxCSCArr_b(nnzTotal_b);
+        services::internal::TArray<uint32_t, cpu> rowIdxCSCArr_b(nnzTotal_b);
         uint32_t * rowIdxCSC_b = rowIdxCSCArr_b.get();
 
-        TArray<uint32_t, cpu> colIdxCSCArr_b((n + 1) * nBlocks_b);
+        services::internal::TArray<uint32_t, cpu> colIdxCSCArr_b((n + 1) * nBlocks_b);
         uint32_t * colIdxCSC_b = colIdxCSCArr_b.get();
 
-        TArray<fpType, cpu> valuesCSCArr_b(nnzTotal_b);
+        services::internal::TArray<fpType, cpu> valuesCSCArr_b(nnzTotal_b);
         fpType * valuesCSC_b = valuesCSCArr_b.get();
 
         DAAL_CHECK(rowIdxCSC_a && colIdxCSC_a && valuesCSC_a && rowIdxCSC_b && colIdxCSC_b && valuesCSC_b, services::ErrorMemoryAllocationFailed);
@@ -329,6 +329,47 @@ public:
 
         return services::Status();
     }
+
+    /**
+     *  Converts the CSR matrix A[m,n] with one-based indices into the CSC layout with zero-based indices,
+     *  cscValues and rowIdx are of size nnz(A), colStart is of size n + 1
+     */
+    static void xcsr2csc(const fpType * a, const size_t * ja, const size_t * ia, size_t m, size_t n, fpType * cscValues, uint32_t * rowIdx,
+                         uint32_t * colStart)
+    {
+        csr2csc(m, n, a, ja, ia, cscValues, rowIdx, colStart);
+    }
+
+    /**
+     *  Computes the row c = a * B^T of the sparse-sparse product, where a is the sparse row with one-based column indices ja
+     *  and B[mb,n] is given in the CSC layout with zero-based indices produced by xcsr2csc.
+     *  c is the dense row of size mb and mask are its flags of size mb, both are zero on entry. The indices of the elements of c
+     *  touched by the product are written into cIdx in the order of appearance, their number is returned.
+     *  The caller zeroes c and mask at the positions cIdx before the next call
+     */
+    static size_t xcsrrow_mm_csc(const fpType * a, const size_t * ja, size_t nnz, const fpType * bValues, const uint32_t * bRowIdx,
+                                 const uint32_t * bColStart, fpType * c, uint32_t * cIdx, char * mask)
+    {
+        size_t nIdx = 0;
+        for (size_t k = 0; k < nnz; ++k)
+        {
+            const size_t col      = ja[k] - 1;
+            const fpType value    = a[k];
+            const uint32_t iBegin = bColStart[col];
+            const uint32_t iEnd   = bColStart[col + 1];
+            for (uint32_t l = iBegin; l < iEnd; ++l)
+            {
+                const uint32_t iRow = bRowIdx[l];
+                if (!mask[iRow])
+                {
+                    mask[iRow]   = 1;
+                    cIdx[nIdx++] = iRow;
+                }
+                c[iRow] += value * bValues[l];
+            }
+        }
+        return nIdx;
+    }
 };
 
 } // namespace internal
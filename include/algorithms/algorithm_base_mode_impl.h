@@ -30,6 +30,7 @@
 #include "services/daal_kernel_defines.h"
 
 #include "services/host_app.h"
+#include "services/thread_arena.h"
 
 namespace daal
 {
@@ -104,6 +105,8 @@ public:
 
         s = setupFinalizeCompute();
         if (s) s |= this->_ac->finalizeCompute();
+        /* Kernels of the algorithm could be scheduled asynchronously, results are available only after the wait */
+        services::Environment::getInstance()->getDefaultExecutionContext().wait(&s);
         if (resetFinalizeFlag) s |= resetFinalizeCompute();
         return s;
     }
@@ -210,6 +213,18 @@ public:
     */
     void setHostApp(const services::HostAppIfacePtr & pHost);
 
+    /**
+    * Returns the arena of threads that runs the computations of the algorithm
+    * \return The arena of threads, empty pointer if the computations run in the threads of the library
+    */
+    services::ThreadArenaPtr threadArena();
+
+    /**
+    * Sets the arena of threads that runs the computations of the algorithm
+    * \param pArena The arena of threads, empty pointer to run the computations in the threads of the library
+    */
+    void setThreadArena(const services::ThreadArenaPtr & pArena);
+
 private:
     bool wasSetup;
     bool resetFlag;
@@ -248,6 +263,40 @@ public:
         return services::throwIfPossible(this->_status);
     }
 
+    /**
+     * Starts the computation of the final results in the %batch mode as a task of the thread pool of the library
+     * and returns without waiting for its end. The computations of the independent algorithms started this way
+     * run concurrently in the same threads. The task computes on a copy of the algorithm made by this method,
+     * so the later changes of the input and the parameters do not affect it. The results are written into
+     * the result of the algorithm, which must not be accessed until waitCompute() returns.
+     * If the previous computation started by this method is not finished, waits for it first.
+     * The computation is waited for when the algorithm is destroyed
+     * \return Status of the start of the computation
+     */
+    services::Status computeAsync();
+
+    /**
+     * Waits for the end of the computation started by computeAsync() without possibility of throwing an exception.
+     * \return Status of the computation, the status of success if no computation is started
+     */
+    services::Status waitComputeNoThrow();
+
+    /**
+     * Waits for the end of the computation started by computeAsync()
+     * \return Status of the computation, the status of success if no computation is started
+     */
+    services::Status waitCompute()
+    {
+        this->_status = waitComputeNoThrow();
+        return services::throwIfPossible(this->_status);
+    }
+
+    /**
+     * Returns true if the computation started by computeAsync() is not waited for yet
+     * \return True if the computation is started and not waited for
+     */
+    bool isComputeAsyncStarted() const;
+
     /**
      * Validates parameters of the compute method
      */
@@ -296,6 +345,40 @@ public:
 
     void enableResetOnCompute(bool flag) { resetFlag = flag; }
 
+    /**
+    * Enables the reuse of the results between the calls of the compute method.
+    * The results allocated by the previous call are validated against the current input and rewritten in place
+    * if their shapes match, so the repeated calls on the inputs of the same shape allocate no result memory.
+    * If the shapes do not match, the results are allocated again instead of failing the validation.
+    * The tables of the results returned by the previous call are overwritten, copy them to keep their contents
+    * The setting is not copied with the algorithm
+    * \param flag True to enable the reuse of the results
+    */
+    void enableResultReuse(bool flag);
+
+    /**
+    * Prepares the repeated computations of the algorithm on the inputs of the same layout, for example the prediction
+    * on the small blocks of observations with one model. Validates the parameters and the input including the model,
+    * allocates the results and sets up the container once. The following calls of the compute method skip these steps
+    * and only validate the shapes of the results, which are reused as with enableResultReuse().
+    * The caller guarantees that the inputs set after the preparation have the same number and types of features,
+    * and calls prepareCompute() again after replacing the model or changing the parameters. The preparation is not copied with the algorithm
+    * \return Status of the preparation
+    */
+    services::Status prepareCompute();
+
+    /**
+    * Cancels the preparation made by prepareCompute(), so the following calls of the compute method do the full validation
+    * \return Status of the cancellation
+    */
+    services::Status resetPreparedCompute();
+
+    /**
+    * Returns true if the algorithm is prepared for the repeated computations by prepareCompute()
+    * \return True if the algorithm is prepared
+    */
+    bool isPrepared() const;
+
     /**
     * Returns HostAppIface used by the class
     * \return HostAppIface used by the class
@@ -308,10 +391,26 @@ public:
     */
     void setHostApp(const services::HostAppIfacePtr & pHost);
 
+    /**
+    * Returns the arena of threads that runs the computations of the algorithm
+    * \return The arena of threads, empty pointer if the computations run in the threads of the library
+    */
+    services::ThreadArenaPtr threadArena();
+
+    /**
+    * Sets the arena of threads that runs the computations of the algorithm
+    * \param pArena The arena of threads, empty pointer to run the computations in the threads of the library
+    */
+    void setThreadArena(const services::ThreadArenaPtr & pArena);
+
 private:
     bool wasSetup;
     bool resetFlag;
 
+    services::Status computePrepared();
+    bool isResultReuseEnabled();
+    void setPrepared(bool flag);
+
     AlgorithmImpl & operator=(const AlgorithmImpl &);
 };
 /** @} */
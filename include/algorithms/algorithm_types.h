@@ -44,6 +44,26 @@ namespace daal
  */
 namespace algorithms
 {
+/**
+ * @ingroup base_algorithms
+ * @{
+ */
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__INFERENCEPRECISION"></a>
+ * \brief Precision of the matrix products computed by the prediction and transformation methods on CPU.
+ *        The reduced precision products use the AVX-512 VNNI and BF16 instructions when the processor supports them,
+ *        on other processors the same rounding of the operands is emulated, so that the accuracy does not depend on the processor
+ */
+enum InferencePrecision
+{
+    fullPrecision     = 0, /*!< Default: the products are computed in the precision of the algorithm */
+    bfloat16Precision = 1, /*!< The operands are rounded to bfloat16, the products are accumulated in single precision.
+                                The relative rounding error of each operand is bounded by 2^-8 */
+    int8Precision     = 2  /*!< The operands are quantized to 8-bit integers with per-row scales, the products are accumulated in 32-bit integers.
+                                The rounding error of each operand is bounded by 1/254 of the maximal absolute value of its row */
+};
+/** @} */
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
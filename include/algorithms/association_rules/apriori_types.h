@@ -50,6 +50,7 @@ namespace association_rules
 enum Method
 {
     apriori      = 0, /*!< Apriori method */
+    fpGrowth     = 1, /*!< FP-growth method that mines the conditional frequent-pattern trees */
     defaultDense = 0  /*!< Apriori default method */
 };
 
@@ -50,7 +50,9 @@ namespace cholesky
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense = 0, /*!< Default: performance-oriented method. */
+    batchedDense = 1  /*!< Decomposition of many small matrices in one call: each row of the input table
+                           contains a symmetric positive-definite matrix of size dim x dim in the row-major layout */
 };
 
 /**
@@ -69,7 +71,8 @@ enum InputId
  */
 enum ResultId
 {
-    choleskyFactor, /*!< Table to store the result. Contains the lower triangle matrix L of the decomposition */
+    choleskyFactor, /*!< Table to store the result. Contains the lower triangle matrix L of the decomposition.
+                         For the batchedDense method each row contains the matrix L of the corresponding input matrix */
     lastResultId = choleskyFactor
 };
 
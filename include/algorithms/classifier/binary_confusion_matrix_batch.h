@@ -137,6 +137,7 @@ public:
         const InputType * inputPtr = static_cast<const InputType *>(other);
         input.set(predictedLabels, inputPtr->get(predictedLabels));
         input.set(groundTruthLabels, inputPtr->get(groundTruthLabels));
+        input.set(predictedScores, inputPtr->get(predictedScores));
     }
 
     /**
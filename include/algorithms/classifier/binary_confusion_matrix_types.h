@@ -71,7 +71,8 @@ enum InputId
 {
     predictedLabels,   /*!< Labels computed in the prediction stage of the classification algorithm */
     groundTruthLabels, /*!< Expected labels */
-    lastInputId = groundTruthLabels
+    predictedScores,   /*!< Optional. Scores of the positive class computed in the prediction stage of the classification algorithm */
+    lastInputId = predictedScores
 };
 
 /**
@@ -82,7 +83,8 @@ enum ResultId
 {
     confusionMatrix, /*!< Binary confusion matrix */
     binaryMetrics,   /*!< Table that contains quality metrics (that is, precision, recall, etc.) for binary classifiers */
-    lastResultId = binaryMetrics
+    rankingMetrics,  /*!< Table that contains the areas under the ROC and precision-recall curves, computed if the scores are provided */
+    lastResultId = rankingMetrics
 };
 
 /**
@@ -100,6 +102,17 @@ enum BinaryMetricsId
     lastBinaryMetricsId = AUC
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__QUALITY_METRIC__BINARY_CONFUSION_MATRIX__RANKINGMETRICSID"></a>
+ * Available values stored in a numeric table corresponding to the ResultId::rankingMetrics index
+ */
+enum RankingMetricsId
+{
+    rocAUC, /*!< Area under the receiver operating characteristic curve */
+    prAUC,  /*!< Area under the precision-recall curve computed as the average precision */
+    lastRankingMetricsId = prAUC
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
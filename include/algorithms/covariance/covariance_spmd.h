@@ -0,0 +1,190 @@
+/* file: covariance_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the correlation or variance-covariance matrix algorithm
+//  in the SPMD processing mode
+//--
+*/
+
+#ifndef __COVARIANCE_SPMD_H__
+#define __COVARIANCE_SPMD_H__
+
+#include "algorithms/covariance/covariance_distributed.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace covariance
+{
+namespace internal
+{
+/**
+ * Combines the partial results of all the processes, the combined partial result is stored on every process.
+ * The sums are reduced first, then the cross-products are centered at the global mean and reduced,
+ * that gives the exact centered cross-product of all the data without the raw second moments
+ */
+template <typename algorithmFPType>
+services::Status allreducePartialResult(services::CommunicatorIface & comm, PartialResult & pres,
+                                        services::CommunicatorIface::TransportPrecision precision, bool packedCrossProduct)
+{
+    using namespace data_management;
+    NumericTable * nObsTable    = pres.get(nObservations).get();
+    NumericTable * crossTable   = pres.get(crossProduct).get();
+    NumericTable * sumTable     = pres.get(sum).get();
+    const size_t nFeatures      = sumTable->getNumberOfColumns();
+    NumericTable * sumTables[2] = { nObsTable, sumTable };
+
+    services::Status s;
+    BlockDescriptor<algorithmFPType> nObsBlock, sumBlock, crossBlock;
+    DAAL_CHECK_STATUS(s, nObsTable->getBlockOfRows(0, 1, readOnly, nObsBlock));
+    const algorithmFPType nLocal = nObsBlock.getBlockPtr()[0];
+    DAAL_CHECK_STATUS(s, nObsTable->releaseBlockOfRows(nObsBlock));
+
+    services::Collection<algorithmFPType> localMean(nFeatures);
+    DAAL_CHECK_MALLOC(localMean.data());
+    DAAL_CHECK_STATUS(s, sumTable->getBlockOfRows(0, 1, readOnly, sumBlock));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        localMean[j] = (nLocal > 0) ? sumBlock.getBlockPtr()[j] / nLocal : algorithmFPType(0);
+    }
+    DAAL_CHECK_STATUS(s, sumTable->releaseBlockOfRows(sumBlock));
+
+    DAAL_CHECK_STATUS(s, services::internal::allreduceTables<algorithmFPType>(comm, sumTables, 2, services::CommunicatorIface::sum));
+
+    DAAL_CHECK_STATUS(s, nObsTable->getBlockOfRows(0, 1, readOnly, nObsBlock));
+    const algorithmFPType nTotal = nObsBlock.getBlockPtr()[0];
+    DAAL_CHECK_STATUS(s, nObsTable->releaseBlockOfRows(nObsBlock));
+
+    /* C += nLocal * (localMean - mean) * (localMean - mean)^T */
+    if (nLocal > 0)
+    {
+        DAAL_CHECK_STATUS(s, sumTable->getBlockOfRows(0, 1, readOnly, sumBlock));
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            localMean[j] -= sumBlock.getBlockPtr()[j] / nTotal;
+        }
+        DAAL_CHECK_STATUS(s, sumTable->releaseBlockOfRows(sumBlock));
+
+        DAAL_CHECK_STATUS(s, crossTable->getBlockOfRows(0, nFeatures, readWrite, crossBlock));
+        algorithmFPType * cross = crossBlock.getBlockPtr();
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                cross[i * nFeatures + j] += nLocal * localMean[i] * localMean[j];
+            }
+        }
+        DAAL_CHECK_STATUS(s, crossTable->releaseBlockOfRows(crossBlock));
+    }
+
+    if (packedCrossProduct)
+    {
+        return services::internal::allreduceSymmetricTable<algorithmFPType>(comm, *crossTable, services::CommunicatorIface::sum, precision);
+    }
+    return services::internal::allreduceTables<algorithmFPType>(comm, &crossTable, 1, services::CommunicatorIface::sum, precision);
+}
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @defgroup covariance_spmd SPMD
+ * @ingroup covariance
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__COVARIANCE__SPMD"></a>
+ * \brief Computes correlation or variance-covariance matrix in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data, the partial results are combined
+ *        by the collective operations of the communicator and the whole result is available on every process.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the correlation or variance-covariance matrix, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::covariance::Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Spmd
+{
+public:
+    typedef algorithms::covariance::Input InputType;
+    typedef algorithms::covariance::Parameter ParameterType;
+    typedef algorithms::covariance::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm  Communicator of the processes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm)
+        : transportPrecision(services::CommunicatorIface::fullPrecision), packedCrossProduct(true), _comm(comm)
+    {}
+
+    /**
+     * Computes the result from the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+
+        services::Status s;
+        Distributed<step1Local, algorithmFPType, method> local;
+        local.input.set(data, input.get(data));
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        PartialResultPtr pres = local.getPartialResult();
+        DAAL_CHECK_STATUS(s, internal::allreducePartialResult<algorithmFPType>(*_comm, *pres, transportPrecision, packedCrossProduct));
+
+        Distributed<step2Master, algorithmFPType, method> master;
+        master.parameter = parameter;
+        master.input.add(partialResults, pres);
+        DAAL_CHECK_STATUS(s, master.compute());
+        DAAL_CHECK_STATUS(s, master.finalizeCompute());
+
+        _result = master.getResult();
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the correlation or variance-covariance matrix
+     * \return Structure that contains the computed matrix
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter structure */
+
+    /** Precision of the cross-product sent to the other processes, the sums and the number of observations are sent in the full precision */
+    services::CommunicatorIface::TransportPrecision transportPrecision;
+
+    /** If true, only the upper triangle of the symmetric cross-product is sent */
+    bool packedCrossProduct;
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace covariance
+} // namespace algorithms
+} // namespace daal
+#endif
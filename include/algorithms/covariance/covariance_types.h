@@ -75,10 +75,13 @@ enum InputId
  */
 enum PartialResultId
 {
-    nObservations, /*!< Number of observations processed so far */
-    crossProduct,  /*!< Cross-product matrix computed so far */
-    sum,           /*!< Vector of sums computed so far */
-    lastPartialResultId = sum
+    nObservations,  /*!< Number of observations processed so far */
+    crossProduct,   /*!< Cross-product matrix computed so far */
+    sum,            /*!< Vector of sums computed so far */
+    coalescedRows,  /*!< Rows of the small data blocks coalesced by the defaultDense method in the online and distributed processing
+                         modes and not merged into the cross-product and sums yet, see OnlineParameter::coalescingBlockSize */
+    nCoalescedRows, /*!< Number of the rows stored in coalescedRows */
+    lastPartialResultId = nCoalescedRows
 };
 
 /**
@@ -103,6 +106,17 @@ enum OutputMatrixType
     correlationMatrix /*!< Correlation matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__ACCUMULATIONPRECISION"></a>
+ * Available precisions of the accumulation of the cross-product and the sums for Covariance
+ */
+enum AccumulationPrecision
+{
+    algorithmPrecision = 0, /*!< Default: the cross-product and the sums are accumulated in the precision of the algorithm */
+    doublePrecision    = 1  /*!< The blocks of the single precision data are converted to double precision and the cross-product and the sums
+                                 are accumulated in double precision, the results are stored in the precision of the algorithm */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__MASTERINPUTID"></a>
  * \brief Available identifiers of master node input arguments of the Covariance algorithm
@@ -259,7 +273,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
     /** Default constructor */
     Parameter();
-    OutputMatrixType outputMatrixType; /*!< Type of the computed matrix */
+    OutputMatrixType outputMatrixType;           /*!< Type of the computed matrix */
+    AccumulationPrecision accumulationPrecision; /*!< Precision of the accumulation of the cross-product and the sums on CPU,
+                                                      used by the defaultDense and sumDense methods in the batch processing mode */
 };
 
 /**
@@ -281,6 +297,16 @@ struct DAAL_EXPORT OnlineParameter : public Parameter
      * Check the correctness of the %OnlineParameter object
      */
     services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t coalescingBlockSize; /*!< Number of rows of the buffer that coalesces the data blocks with fewer rows passed to
+                                     the consecutive compute() calls of the defaultDense method. The buffer is allocated in the partial
+                                     result as coalescedRows and nCoalescedRows, its rows are merged into the cross-product and sums
+                                     when the buffer is full, in finalizeCompute() and on the master node of the distributed processing.
+                                     The value 0 (default) disables the coalescing */
+    double forgettingFactor;    /*!< Factor in (0, 1] the weights of the observations processed so far are multiplied by with each
+                                     new observation. The value 1 (default) keeps the statistics over all the data, smaller values make them
+                                     follow the most recent data with the effective number of observations about 1 / (1 - forgettingFactor).
+                                     The data blocks are not coalesced if the value is less than 1 */
 };
 
 /**
@@ -0,0 +1,900 @@
+/* file: dbscan_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the DBSCAN algorithm in the SPMD processing mode
+//--
+*/
+
+#ifndef __DBSCAN_SPMD_H__
+#define __DBSCAN_SPMD_H__
+
+#include "algorithms/dbscan/dbscan_batch.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace dbscan
+{
+namespace internal
+{
+/* Kinds of the observations received by the process of the slab */
+enum ObservationKind
+{
+    ownedObservation = 0, /* Observation lies in the slab of the process */
+    innerHalo        = 1, /* Observation lies within epsilon of the slab, so its whole neighborhood is received and its core flag is exact */
+    outerHalo        = 2  /* Observation lies within 2 * epsilon of the slab, it completes the neighborhoods of the inner halo */
+};
+
+/* Header of the record of the observation, the weight and the features of the observation follow it */
+struct ObservationHeader
+{
+    size_t index;    /* Index of the observation on the process that sent it */
+    size_t kind;     /* ObservationKind */
+    size_t owner;    /* Process whose slab contains the observation */
+    size_t position; /* Position of the record of the observation in the part sent to the owner */
+};
+
+/* Query to the owner of the core observation of the inner halo: its cluster on the sender is a part of its cluster on the owner */
+struct MergeQuery
+{
+    size_t origin;   /* Process that sent the observation */
+    size_t position; /* Position of the record of the observation in the part sent by the origin to the owner */
+    size_t cluster;  /* Local cluster of the observation on the process that sends the query */
+};
+
+/* Local clusters of two processes that belong to the same cluster */
+struct ClusterEdge
+{
+    size_t rank1;
+    size_t cluster1;
+    size_t rank2;
+    size_t cluster2;
+};
+
+/* Final assignment of the observation sent back to the process that passed it to compute() */
+struct AssignmentRecord
+{
+    size_t index;
+    int assignment;
+    int isCore;
+};
+
+/* Owner of the observation and the processes that keep it in the halo, the slab of the process k is [splits[k], splits[k + 1]) */
+template <typename algorithmFPType>
+class SlabPartition
+{
+public:
+    SlabPartition() : _nProcesses(0), _splitFeature(0), _epsilon(0) {}
+
+    services::Status init(size_t nProcesses, size_t splitFeature, algorithmFPType epsilon)
+    {
+        _nProcesses   = nProcesses;
+        _splitFeature = splitFeature;
+        _epsilon      = epsilon;
+        _splits.resize(nProcesses);
+        DAAL_CHECK_MALLOC(_splits.data());
+        return services::Status();
+    }
+
+    algorithmFPType & split(size_t k) { return _splits[k]; }
+    size_t getSplitFeature() const { return _splitFeature; }
+
+    size_t getOwner(algorithmFPType x) const
+    {
+        size_t left  = 0;
+        size_t right = _nProcesses;
+        while (right - left > 1)
+        {
+            const size_t middle = (left + right) / 2;
+            if (_splits[middle] <= x)
+            {
+                left = middle;
+            }
+            else
+            {
+                right = middle;
+            }
+        }
+        return left;
+    }
+
+    /* Calls visit(k, kind) for the owner of the observation and for the processes that keep it in the halo */
+    template <typename Visitor>
+    void visit(algorithmFPType x, Visitor & visitor) const
+    {
+        const size_t owner = getOwner(x);
+        visitor(owner, ownedObservation);
+        for (size_t k = owner; k-- > 0;)
+        {
+            const algorithmFPType distance = x - _splits[k + 1];
+            if (distance > 2 * _epsilon) break;
+            visitor(k, distance <= _epsilon ? innerHalo : outerHalo);
+        }
+        for (size_t k = owner + 1; k < _nProcesses; k++)
+        {
+            const algorithmFPType distance = _splits[k] - x;
+            if (distance > 2 * _epsilon) break;
+            visitor(k, distance <= _epsilon ? innerHalo : outerHalo);
+        }
+    }
+
+private:
+    size_t _nProcesses;
+    size_t _splitFeature;
+    algorithmFPType _epsilon;
+    services::Collection<algorithmFPType> _splits;
+};
+
+struct RecordCounter
+{
+    RecordCounter(size_t * counts_, size_t * ownedCounts_) : counts(counts_), ownedCounts(ownedCounts_) {}
+
+    void operator()(size_t k, ObservationKind kind)
+    {
+        counts[k]++;
+        if (kind == ownedObservation) ownedCounts[k]++;
+    }
+
+    size_t * counts;
+    size_t * ownedCounts;
+};
+
+template <typename algorithmFPType>
+struct RecordWriter
+{
+    void operator()(size_t k, ObservationKind kind)
+    {
+        if (kind == ownedObservation)
+        {
+            owner         = k;
+            ownerPosition = positions[k];
+        }
+        ObservationHeader * header = (ObservationHeader *)(buffer + offsets[k] + positions[k] * recordSize);
+        header->index              = index;
+        header->kind               = (size_t)kind;
+        header->owner              = owner;
+        header->position           = ownerPosition;
+
+        algorithmFPType * values = (algorithmFPType *)(header + 1);
+        values[0]                = weight;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            values[j + 1] = row[j];
+        }
+        positions[k]++;
+    }
+
+    byte * buffer;
+    const size_t * offsets;
+    size_t * positions;
+    size_t recordSize;
+    size_t nFeatures;
+    size_t index;
+    size_t owner;
+    size_t ownerPosition;
+    algorithmFPType weight;
+    const algorithmFPType * row;
+};
+
+/**
+ * DBSCAN on the blocks of data of all the processes in a fixed number of collective operations.
+ * The observations are partitioned into the slabs along the feature with the largest range, the slabs have equal numbers of observations.
+ * Every process receives the observations of its slab and the halo of the observations within 2 * epsilon of the slab,
+ * clusters them locally and the local clusters that share the core observations of the boundaries are merged by the union-find
+ * on every process
+ */
+template <typename algorithmFPType, Method method>
+class SpmdClustering
+{
+public:
+    SpmdClustering(services::CommunicatorIface & comm, const Parameter & parameter)
+        : _comm(comm),
+          _parameter(parameter),
+          _nProcesses(comm.getSize()),
+          _rank(comm.getRank()),
+          _nFeatures(0),
+          _hasWeights(false),
+          _recordSize(0),
+          _nLocal(0),
+          _nLocalClusters(0),
+          _nClusters(0),
+          _clusterOffset(0)
+    {}
+
+    services::Status compute(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & weights, Result & result)
+    {
+        services::Status s;
+        DAAL_CHECK_STATUS(s, computeSlabs(*data, weights.get()));
+        DAAL_CHECK_STATUS(s, exchangeObservations(*data, weights.get()));
+        DAAL_CHECK_STATUS(s, clusterLocally());
+        DAAL_CHECK_STATUS(s, mergeClusters());
+        return computeResult(*data, result);
+    }
+
+private:
+    /* The ranges of the features are gathered from all the processes,
+     * the bounds of the slabs are the quantiles of the histogram of the split feature */
+    services::Status computeSlabs(data_management::NumericTable & data, data_management::NumericTable * weights)
+    {
+        using namespace data_management;
+        const size_t nRows = data.getNumberOfRows();
+        _nFeatures         = data.getNumberOfColumns();
+
+        /* Flags of the data and the weights followed by the minimums and the maximums of the features */
+        const size_t rangeSize = 2 + 2 * _nFeatures;
+        services::Collection<double> range(rangeSize);
+        services::Collection<double> allRanges(rangeSize * _nProcesses);
+        DAAL_CHECK_MALLOC(range.data() && allRanges.data());
+
+        services::Status s;
+        range[0] = double(nRows > 0);
+        range[1] = double(weights != NULL);
+        if (nRows)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            DAAL_CHECK_STATUS(s, data.getBlockOfRows(0, nRows, readOnly, block));
+            const algorithmFPType * x = block.getBlockPtr();
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                range[2 + j]              = x[j];
+                range[2 + _nFeatures + j] = x[j];
+            }
+            for (size_t i = 1; i < nRows; i++)
+            {
+                for (size_t j = 0; j < _nFeatures; j++)
+                {
+                    const double value        = x[i * _nFeatures + j];
+                    range[2 + j]              = (value < range[2 + j]) ? value : range[2 + j];
+                    range[2 + _nFeatures + j] = (value > range[2 + _nFeatures + j]) ? value : range[2 + _nFeatures + j];
+                }
+            }
+            DAAL_CHECK_STATUS(s, data.releaseBlockOfRows(block));
+        }
+        DAAL_CHECK_STATUS(s, _comm.allgather((const byte *)range.data(), rangeSize * sizeof(double), (byte *)allRanges.data()));
+
+        bool first = true;
+        for (size_t i = 0; i < _nProcesses; i++)
+        {
+            const double * processRange = allRanges.data() + i * rangeSize;
+            _hasWeights |= (processRange[1] != 0);
+            if (processRange[0] == 0) continue;
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                if (first || processRange[2 + j] < range[2 + j]) range[2 + j] = processRange[2 + j];
+                if (first || processRange[2 + _nFeatures + j] > range[2 + _nFeatures + j])
+                    range[2 + _nFeatures + j] = processRange[2 + _nFeatures + j];
+            }
+            first = false;
+        }
+
+        size_t splitFeature = 0;
+        for (size_t j = 1; j < _nFeatures && !first; j++)
+        {
+            if (range[2 + _nFeatures + j] - range[2 + j] > range[2 + _nFeatures + splitFeature] - range[2 + splitFeature]) splitFeature = j;
+        }
+        DAAL_CHECK_STATUS(s, _slabs.init(_nProcesses, splitFeature, algorithmFPType(_parameter.epsilon)));
+        if (first) return s;
+
+        const size_t nBins = nHistogramBins * _nProcesses;
+        const double lower = range[2 + splitFeature];
+        const double width = (range[2 + _nFeatures + splitFeature] - lower) / double(nBins);
+        services::Collection<double> histogram(nBins);
+        DAAL_CHECK_MALLOC(histogram.data());
+        for (size_t b = 0; b < nBins; b++)
+        {
+            histogram[b] = 0;
+        }
+        if (nRows)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            DAAL_CHECK_STATUS(s, data.getBlockOfColumnValues(splitFeature, 0, nRows, readOnly, block));
+            const algorithmFPType * x = block.getBlockPtr();
+            for (size_t i = 0; i < nRows; i++)
+            {
+                size_t b = (width > 0) ? size_t((x[i] - lower) / width) : 0;
+                histogram[b < nBins ? b : nBins - 1] += 1;
+            }
+            DAAL_CHECK_STATUS(s, data.releaseBlockOfColumnValues(block));
+        }
+        DAAL_CHECK_STATUS(s, _comm.allreduce(histogram.data(), nBins, services::CommunicatorIface::sum));
+
+        double total = 0;
+        for (size_t b = 0; b < nBins; b++)
+        {
+            total += histogram[b];
+        }
+
+        _slabs.split(0) = algorithmFPType(lower);
+        double count    = 0;
+        size_t b        = 0;
+        for (size_t k = 1; k < _nProcesses; k++)
+        {
+            const double target = total * double(k) / double(_nProcesses);
+            while (b < nBins && count + histogram[b] <= target)
+            {
+                count += histogram[b++];
+            }
+            _slabs.split(k) = algorithmFPType(lower + double(b) * width);
+        }
+        return s;
+    }
+
+    /* The observation is sent to the owner of its slab and to the processes that keep it in the halo */
+    services::Status exchangeObservations(data_management::NumericTable & data, data_management::NumericTable * weights)
+    {
+        using namespace data_management;
+        const size_t nRows = data.getNumberOfRows();
+        _recordSize        = sizeof(ObservationHeader) + (_nFeatures + 1) * sizeof(algorithmFPType);
+        _recordSize        = (_recordSize + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t);
+
+        services::Collection<size_t> counts(_nProcesses);
+        services::Collection<size_t> offsets(_nProcesses);
+        services::Collection<size_t> sendSizes(_nProcesses);
+        _ownedSent.resize(_nProcesses);
+        DAAL_CHECK_MALLOC(counts.data() && offsets.data() && sendSizes.data() && _ownedSent.data());
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            counts[k]     = 0;
+            _ownedSent[k] = 0;
+        }
+
+        services::Status s;
+        BlockDescriptor<algorithmFPType> dataBlock;
+        BlockDescriptor<algorithmFPType> weightsBlock;
+        if (nRows)
+        {
+            DAAL_CHECK_STATUS(s, data.getBlockOfRows(0, nRows, readOnly, dataBlock));
+        }
+        if (weights && nRows)
+        {
+            DAAL_CHECK_STATUS(s, weights->getBlockOfRows(0, nRows, readOnly, weightsBlock));
+        }
+        const algorithmFPType * x = dataBlock.getBlockPtr();
+        const algorithmFPType * w = weights ? weightsBlock.getBlockPtr() : NULL;
+        const size_t splitFeature = _slabs.getSplitFeature();
+
+        RecordCounter counter(counts.data(), _ownedSent.data());
+        for (size_t i = 0; i < nRows; i++)
+        {
+            _slabs.visit(x[i * _nFeatures + splitFeature], counter);
+        }
+
+        size_t sendSize = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            offsets[k]   = sendSize;
+            sendSizes[k] = counts[k] * _recordSize;
+            sendSize += sendSizes[k];
+            counts[k] = 0;
+        }
+        services::Collection<byte> sendBuffer(sendSize);
+        DAAL_CHECK_MALLOC(sendBuffer.data() || !sendSize);
+
+        RecordWriter<algorithmFPType> writer;
+        writer.buffer     = sendBuffer.data();
+        writer.offsets    = offsets.data();
+        writer.positions  = counts.data();
+        writer.recordSize = _recordSize;
+        writer.nFeatures  = _nFeatures;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            writer.index  = i;
+            writer.weight = w ? w[i] : algorithmFPType(1);
+            writer.row    = x + i * _nFeatures;
+            _slabs.visit(writer.row[splitFeature], writer);
+        }
+
+        if (weights && nRows)
+        {
+            DAAL_CHECK_STATUS(s, weights->releaseBlockOfRows(weightsBlock));
+        }
+        if (nRows)
+        {
+            DAAL_CHECK_STATUS(s, data.releaseBlockOfRows(dataBlock));
+        }
+
+        services::Collection<size_t> recvSizes;
+        DAAL_CHECK_STATUS(s, services::internal::exchangeParts(_comm, sendBuffer, sendSizes, _records, recvSizes));
+
+        _partStarts.resize(_nProcesses + 1);
+        DAAL_CHECK_MALLOC(_partStarts.data());
+        _partStarts[0] = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            _partStarts[k + 1] = _partStarts[k] + recvSizes[k] / _recordSize;
+        }
+        _nLocal = _partStarts[_nProcesses];
+        return s;
+    }
+
+    /* The received observations are clustered by the batch algorithm, the core flags of the owned observations and the inner halo are exact */
+    services::Status clusterLocally()
+    {
+        using namespace data_management;
+        services::Status s;
+        _assignments.resize(_nLocal);
+        _isCore.resize(_nLocal);
+        DAAL_CHECK_MALLOC((_assignments.data() && _isCore.data()) || !_nLocal);
+        if (!_nLocal) return s;
+
+        NumericTablePtr localData = HomogenNumericTable<algorithmFPType>::create(_nFeatures, _nLocal, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        NumericTablePtr localWeights = HomogenNumericTable<algorithmFPType>::create(1, _nLocal, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        {
+            BlockDescriptor<algorithmFPType> dataBlock;
+            BlockDescriptor<algorithmFPType> weightsBlock;
+            DAAL_CHECK_STATUS(s, localData->getBlockOfRows(0, _nLocal, writeOnly, dataBlock));
+            DAAL_CHECK_STATUS(s, localWeights->getBlockOfRows(0, _nLocal, writeOnly, weightsBlock));
+            algorithmFPType * x = dataBlock.getBlockPtr();
+            algorithmFPType * w = weightsBlock.getBlockPtr();
+            for (size_t i = 0; i < _nLocal; i++)
+            {
+                const algorithmFPType * values = (const algorithmFPType *)(header(i) + 1);
+                w[i]                           = values[0];
+                for (size_t j = 0; j < _nFeatures; j++)
+                {
+                    x[i * _nFeatures + j] = values[j + 1];
+                }
+            }
+            DAAL_CHECK_STATUS(s, localWeights->releaseBlockOfRows(weightsBlock));
+            DAAL_CHECK_STATUS(s, localData->releaseBlockOfRows(dataBlock));
+        }
+
+        Batch<algorithmFPType, method> local(algorithmFPType(_parameter.epsilon), _parameter.minObservations);
+        local.parameter().memorySavingMode = _parameter.memorySavingMode;
+        local.parameter().resultsToCompute = computeCoreIndices;
+        local.input.set(data, localData);
+        if (_hasWeights) local.input.set(weights, localWeights);
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        ResultPtr localResult = local.getResult();
+
+        NumericTable * nClustersTable   = localResult->get(nClusters).get();
+        NumericTable * assignmentsTable = localResult->get(assignments).get();
+        NumericTable * coreIndicesTable = localResult->get(coreIndices).get();
+
+        BlockDescriptor<int> block;
+        DAAL_CHECK_STATUS(s, nClustersTable->getBlockOfRows(0, 1, readOnly, block));
+        _nLocalClusters = size_t(block.getBlockPtr()[0]);
+        DAAL_CHECK_STATUS(s, nClustersTable->releaseBlockOfRows(block));
+
+        DAAL_CHECK_STATUS(s, assignmentsTable->getBlockOfRows(0, _nLocal, readOnly, block));
+        for (size_t i = 0; i < _nLocal; i++)
+        {
+            _assignments[i] = block.getBlockPtr()[i];
+            _isCore[i]      = 0;
+        }
+        DAAL_CHECK_STATUS(s, assignmentsTable->releaseBlockOfRows(block));
+
+        const size_t nCore = coreIndicesTable->getNumberOfRows();
+        if (nCore)
+        {
+            DAAL_CHECK_STATUS(s, coreIndicesTable->getBlockOfRows(0, nCore, readOnly, block));
+            for (size_t i = 0; i < nCore; i++)
+            {
+                _isCore[block.getBlockPtr()[i]] = 1;
+            }
+            DAAL_CHECK_STATUS(s, coreIndicesTable->releaseBlockOfRows(block));
+        }
+        return removeHaloClusters();
+    }
+
+    /* The local cluster without the owned and the inner halo core observations is a part of the cluster found by the owners
+     * of its observations, it is removed so that it is not counted as a separate cluster */
+    services::Status removeHaloClusters()
+    {
+        services::Collection<int> clusters(_nLocalClusters);
+        DAAL_CHECK_MALLOC(clusters.data() || !_nLocalClusters);
+        for (size_t c = 0; c < _nLocalClusters; c++)
+        {
+            clusters[c] = -1;
+        }
+        for (size_t i = 0; i < _nLocal; i++)
+        {
+            if (_isCore[i] && header(i)->kind != size_t(outerHalo)) clusters[_assignments[i]] = 0;
+        }
+
+        size_t nKept = 0;
+        for (size_t c = 0; c < _nLocalClusters; c++)
+        {
+            if (clusters[c] == 0) clusters[c] = int(nKept++);
+        }
+        for (size_t i = 0; i < _nLocal; i++)
+        {
+            if (_assignments[i] >= 0) _assignments[i] = clusters[_assignments[i]];
+        }
+        _nLocalClusters = nKept;
+        return services::Status();
+    }
+
+    /* The owners resolve the queries for the core observations of the inner halo into the edges between the local clusters,
+     * the edges of all the processes are gathered and merged by the union-find in the same order on every process */
+    services::Status mergeClusters()
+    {
+        services::Collection<size_t> counts(_nProcesses);
+        services::Collection<size_t> sendSizes(_nProcesses);
+        DAAL_CHECK_MALLOC(counts.data() && sendSizes.data());
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            counts[k] = 0;
+        }
+        for (size_t i = 0; i < _nLocal; i++)
+        {
+            if (header(i)->kind == size_t(innerHalo) && _isCore[i]) counts[header(i)->owner]++;
+        }
+
+        services::Collection<size_t> offsets(_nProcesses);
+        DAAL_CHECK_MALLOC(offsets.data());
+        size_t nQueries = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            offsets[k]   = nQueries;
+            sendSizes[k] = counts[k] * sizeof(MergeQuery);
+            nQueries += counts[k];
+        }
+        services::Collection<byte> sendBuffer(nQueries * sizeof(MergeQuery));
+        DAAL_CHECK_MALLOC(sendBuffer.data() || !nQueries);
+        MergeQuery * queries = (MergeQuery *)sendBuffer.data();
+        for (size_t p = 0; p < _nProcesses; p++)
+        {
+            for (size_t i = _partStarts[p]; i < _partStarts[p + 1]; i++)
+            {
+                const ObservationHeader * h = header(i);
+                if (h->kind != size_t(innerHalo) || !_isCore[i]) continue;
+                MergeQuery & query = queries[offsets[h->owner]++];
+                query.origin       = p;
+                query.position     = h->position;
+                query.cluster      = size_t(_assignments[i]);
+            }
+        }
+
+        services::Status s;
+        services::Collection<byte> recvBuffer;
+        services::Collection<size_t> recvSizes;
+        DAAL_CHECK_STATUS(s, services::internal::exchangeParts(_comm, sendBuffer, sendSizes, recvBuffer, recvSizes));
+
+        size_t nEdges = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            nEdges += recvSizes[k] / sizeof(MergeQuery);
+        }
+        services::Collection<ClusterEdge> edges(nEdges);
+        DAAL_CHECK_MALLOC(edges.data() || !nEdges);
+        const MergeQuery * received = (const MergeQuery *)recvBuffer.data();
+        size_t iEdge                = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            const size_t nReceived = recvSizes[k] / sizeof(MergeQuery);
+            for (size_t q = 0; q < nReceived; q++, received++)
+            {
+                const size_t row = _partStarts[received->origin] + received->position;
+                if (!_isCore[row]) continue;
+                ClusterEdge & edge = edges[iEdge++];
+                edge.rank1         = _rank;
+                edge.cluster1      = size_t(_assignments[row]);
+                edge.rank2         = k;
+                edge.cluster2      = received->cluster;
+            }
+        }
+        nEdges = iEdge;
+
+        /* Numbers of the edges and of the local clusters */
+        size_t sizes[2] = { nEdges, _nLocalClusters };
+        services::Collection<size_t> allSizes(2 * _nProcesses);
+        services::Collection<size_t> clusterOffsets(_nProcesses + 1);
+        DAAL_CHECK_MALLOC(allSizes.data() && clusterOffsets.data());
+        DAAL_CHECK_STATUS(s, _comm.allgather((const byte *)sizes, 2 * sizeof(size_t), (byte *)allSizes.data()));
+
+        size_t maxEdges   = 0;
+        clusterOffsets[0] = 0;
+        for (size_t k = 0; k < _nProcesses; k++)
+        {
+            maxEdges              = (allSizes[2 * k] > maxEdges) ? allSizes[2 * k] : maxEdges;
+            clusterOffsets[k + 1] = clusterOffsets[k] + allSizes[2 * k + 1];
+        }
+        const size_t nAllClusters = clusterOffsets[_nProcesses];
+
+        _parents.resize(nAllClusters);
+        DAAL_CHECK_MALLOC(_parents.data() || !nAllClusters);
+        for (size_t c = 0; c < nAllClusters; c++)
+        {
+            _parents[c] = c;
+        }
+
+        if (maxEdges)
+        {
+            services::Collection<ClusterEdge> paddedEdges(maxEdges);
+            services::Collection<ClusterEdge> allEdges(maxEdges * _nProcesses);
+            DAAL_CHECK_MALLOC(paddedEdges.data() && allEdges.data());
+            for (size_t e = 0; e < nEdges; e++)
+            {
+                paddedEdges[e] = edges[e];
+            }
+            DAAL_CHECK_STATUS(s, _comm.allgather((const byte *)paddedEdges.data(), maxEdges * sizeof(ClusterEdge), (byte *)allEdges.data()));
+
+            for (size_t k = 0; k < _nProcesses; k++)
+            {
+                for (size_t e = 0; e < allSizes[2 * k]; e++)
+                {
+                    const ClusterEdge & edge = allEdges[k * maxEdges + e];
+                    unite(clusterOffsets[edge.rank1] + edge.cluster1, clusterOffsets[edge.rank2] + edge.cluster2);
+                }
+            }
+        }
+
+        /* The clusters are numbered in the order of their first local clusters, which is the same on every process */
+        _labels.resize(nAllClusters);
+        DAAL_CHECK_MALLOC(_labels.data() || !nAllClusters);
+        _nClusters = 0;
+        for (size_t c = 0; c < nAllClusters; c++)
+        {
+            if (find(c) == c) _labels[c] = int(_nClusters++);
+        }
+        for (size_t c = 0; c < nAllClusters; c++)
+        {
+            _labels[c] = _labels[find(c)];
+        }
+        _clusterOffset = clusterOffsets[_rank];
+        return s;
+    }
+
+    /* The assignments of the owned observations are sent back to the processes that passed them to compute() */
+    services::Status computeResult(data_management::NumericTable & data, Result & result)
+    {
+        using namespace data_management;
+        const size_t nRows = data.getNumberOfRows();
+
+        services::Collection<size_t> sendSizes(_nProcesses);
+        services::Collection<size_t> recvSizes(_nProcesses);
+        DAAL_CHECK_MALLOC(sendSizes.data() && recvSizes.data());
+        size_t nOwned = 0;
+        for (size_t p = 0; p < _nProcesses; p++)
+        {
+            size_t count = 0;
+            for (size_t i = _partStarts[p]; i < _partStarts[p + 1]; i++)
+            {
+                count += (header(i)->kind == size_t(ownedObservation));
+            }
+            sendSizes[p] = count * sizeof(AssignmentRecord);
+            recvSizes[p] = _ownedSent[p] * sizeof(AssignmentRecord);
+            nOwned += count;
+        }
+
+        services::Collection<AssignmentRecord> sendRecords(nOwned);
+        services::Collection<AssignmentRecord> recvRecords(nRows);
+        DAAL_CHECK_MALLOC((sendRecords.data() || !nOwned) && (recvRecords.data() || !nRows));
+        size_t iRecord = 0;
+        for (size_t i = 0; i < _nLocal; i++)
+        {
+            if (header(i)->kind != size_t(ownedObservation)) continue;
+            AssignmentRecord & record = sendRecords[iRecord++];
+            record.index              = header(i)->index;
+            record.assignment         = (_assignments[i] < 0) ? _assignments[i] : _labels[_clusterOffset + size_t(_assignments[i])];
+            record.isCore             = _isCore[i];
+        }
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, _comm.alltoallv((const byte *)sendRecords.data(), sendSizes.data(), (byte *)recvRecords.data(), recvSizes.data()));
+
+        NumericTablePtr assignmentsTable = HomogenNumericTable<int>::create(1, nRows, NumericTable::doAllocate, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        NumericTablePtr nClustersTable = HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, int(_nClusters), &s);
+        DAAL_CHECK_STATUS_VAR(s);
+
+        services::Collection<int> isCore(nRows);
+        DAAL_CHECK_MALLOC(isCore.data() || !nRows);
+        size_t nCore = 0;
+        if (nRows)
+        {
+            BlockDescriptor<int> block;
+            DAAL_CHECK_STATUS(s, assignmentsTable->getBlockOfRows(0, nRows, writeOnly, block));
+            int * assignmentsPtr = block.getBlockPtr();
+            for (size_t i = 0; i < nRows; i++)
+            {
+                assignmentsPtr[recvRecords[i].index] = recvRecords[i].assignment;
+                isCore[recvRecords[i].index]         = recvRecords[i].isCore;
+                nCore += size_t(recvRecords[i].isCore);
+            }
+            DAAL_CHECK_STATUS(s, assignmentsTable->releaseBlockOfRows(block));
+        }
+        result.set(assignments, assignmentsTable);
+        result.set(nClusters, nClustersTable);
+
+        if (_parameter.resultsToCompute & computeCoreIndices)
+        {
+            NumericTablePtr coreIndicesTable =
+                HomogenNumericTable<int>::create(1, nCore, nCore ? NumericTable::doAllocate : NumericTable::notAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            if (nCore)
+            {
+                BlockDescriptor<int> block;
+                DAAL_CHECK_STATUS(s, coreIndicesTable->getBlockOfRows(0, nCore, writeOnly, block));
+                for (size_t i = 0, pos = 0; i < nRows; i++)
+                {
+                    if (isCore[i]) block.getBlockPtr()[pos++] = int(i);
+                }
+                DAAL_CHECK_STATUS(s, coreIndicesTable->releaseBlockOfRows(block));
+            }
+            result.set(coreIndices, coreIndicesTable);
+        }
+
+        if (_parameter.resultsToCompute & computeCoreObservations)
+        {
+            NumericTablePtr coreObservationsTable =
+                HomogenNumericTable<algorithmFPType>::create(_nFeatures, nCore, nCore ? NumericTable::doAllocate : NumericTable::notAllocate, &s);
+            DAAL_CHECK_STATUS_VAR(s);
+            if (nCore)
+            {
+                BlockDescriptor<algorithmFPType> dataBlock;
+                BlockDescriptor<algorithmFPType> coreBlock;
+                DAAL_CHECK_STATUS(s, data.getBlockOfRows(0, nRows, readOnly, dataBlock));
+                DAAL_CHECK_STATUS(s, coreObservationsTable->getBlockOfRows(0, nCore, writeOnly, coreBlock));
+                const algorithmFPType * x = dataBlock.getBlockPtr();
+                algorithmFPType * core    = coreBlock.getBlockPtr();
+                for (size_t i = 0, pos = 0; i < nRows; i++)
+                {
+                    if (!isCore[i]) continue;
+                    for (size_t j = 0; j < _nFeatures; j++)
+                    {
+                        core[pos * _nFeatures + j] = x[i * _nFeatures + j];
+                    }
+                    pos++;
+                }
+                DAAL_CHECK_STATUS(s, coreObservationsTable->releaseBlockOfRows(coreBlock));
+                DAAL_CHECK_STATUS(s, data.releaseBlockOfRows(dataBlock));
+            }
+            result.set(coreObservations, coreObservationsTable);
+        }
+        return s;
+    }
+
+    const ObservationHeader * header(size_t i) const { return (const ObservationHeader *)(_records.data() + i * _recordSize); }
+
+    size_t find(size_t c)
+    {
+        while (_parents[c] != c)
+        {
+            _parents[c] = _parents[_parents[c]];
+            c           = _parents[c];
+        }
+        return c;
+    }
+
+    /* The root with the smaller index is kept, so the result does not depend on the order of the edges */
+    void unite(size_t a, size_t b)
+    {
+        a = find(a);
+        b = find(b);
+        if (a < b)
+        {
+            _parents[b] = a;
+        }
+        else if (b < a)
+        {
+            _parents[a] = b;
+        }
+    }
+
+    static const size_t nHistogramBins = 256; /* Number of the bins of the histogram of the split feature per process */
+
+    services::CommunicatorIface & _comm;
+    const Parameter & _parameter;
+    const size_t _nProcesses;
+    const size_t _rank;
+    size_t _nFeatures;
+    bool _hasWeights;
+    SlabPartition<algorithmFPType> _slabs;
+
+    size_t _recordSize;
+    size_t _nLocal;
+    services::Collection<byte> _records;       /* Records of the received observations in the order of the ranks of the senders */
+    services::Collection<size_t> _partStarts;  /* Index of the first received observation of every sender */
+    services::Collection<size_t> _ownedSent;   /* Numbers of the observations sent to their owners */
+    services::Collection<int> _assignments;    /* Local clusters of the received observations */
+    services::Collection<int> _isCore;
+
+    size_t _nLocalClusters;
+    size_t _nClusters;
+    size_t _clusterOffset;
+    services::Collection<size_t> _parents; /* Union-find over the local clusters of all the processes */
+    services::Collection<int> _labels;
+};
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @defgroup dbscan_spmd SPMD
+ * @ingroup dbscan_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DBSCAN__SPMD"></a>
+ * \brief Computes the results of the DBSCAN algorithm in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data. The data is partitioned into the slabs of the feature with the largest range,
+ *        every process clusters its slab with the halo of the observations within 2 * epsilon of it, and the local clusters that share
+ *        the core observations of the boundaries are merged by the union-find. The whole computation takes a fixed number of collective operations
+ *        of the communicator instead of the iterative steps of the distributed processing mode.
+ *        The assignments are returned for the observations of the local block in their original order
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of DBSCAN, double or float
+ * \tparam method           Computation method used to cluster the slab of the process, \ref Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Spmd
+{
+public:
+    typedef algorithms::dbscan::Input InputType;
+    typedef algorithms::dbscan::Parameter ParameterType;
+    typedef algorithms::dbscan::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm            Communicator of the processes
+     * \param[in] epsilon         Radius of neighborhood
+     * \param[in] minObservations Minimal total weight of observations in neighborhood of core observation
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm, algorithmFPType epsilon, size_t minObservations)
+        : parameter(epsilon, minObservations), _comm(comm)
+    {}
+
+    /**
+     * Computes the clusters of the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, parameter.check());
+        DAAL_CHECK_STATUS(s, input.check(&parameter, (int)method));
+
+        _result = ResultPtr(new ResultType());
+        DAAL_CHECK_MALLOC(_result);
+        internal::SpmdClustering<algorithmFPType, method> clustering(*_comm, parameter);
+        return clustering.compute(input.get(data), input.get(weights), *_result);
+    }
+
+    /**
+     * Returns the structure that contains the assignments of the local block of data, the number of clusters
+     * and the core observations of the local block of data if they are requested by parameter.resultsToCompute
+     * \return Structure that contains the results of the DBSCAN algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter structure */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace dbscan
+} // namespace algorithms
+} // namespace daal
+#endif
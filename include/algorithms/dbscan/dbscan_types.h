@@ -52,6 +52,10 @@ const int undefined = -2;
 enum Method
 {
     defaultDense = 0, /*!< Default: performance-oriented method */
+    gridDense    = 1, /*!< Neighborhoods are searched in the adjacent cells of the uniform grid with the cell side equal to epsilon,
+                           suitable for low dimensional data. Available in the batch processing mode only */
+    kdTreeDense  = 2  /*!< Neighborhoods are searched with the kd-tree built over the observations,
+                           suitable for data of moderate dimensionality. Available in the batch processing mode only */
 };
 
 /**
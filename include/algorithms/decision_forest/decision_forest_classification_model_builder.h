@@ -273,6 +273,24 @@ public:
         return resId;
     }
 
+    /**
+    *  Create trees from the flat arrays of their nodes and add them to the model, the trees are built in parallel.
+    *  The nodes of the i-th tree are stored in the positions from treeOffsets[i] to (treeOffsets[i + 1] - 1) of the node arrays,
+    *  the first of them is the root of the tree, the indices of the children are given relative to the first node of the tree
+    *  \param[in] nTrees          Number of trees
+    *  \param[in] treeOffsets     Positions of the first nodes of the trees in the node arrays, array of size (nTrees + 1)
+    *  \param[in] featureIndices  Feature indices for spliting, negative values mark the leaf nodes
+    *  \param[in] featureValues   Feature values for spliting of the split nodes, class labels of the leaf nodes
+    *  \param[in] leftChildren    Indices of the left children of the split nodes
+    *  \param[in] rightChildren   Indices of the right children of the split nodes
+    */
+    void addTrees(const size_t nTrees, const size_t * const treeOffsets, const int * const featureIndices, const double * const featureValues,
+                  const size_t * const leftChildren, const size_t * const rightChildren)
+    {
+        _status |= addTreesInternal(nTrees, treeOffsets, featureIndices, featureValues, leftChildren, rightChildren);
+        services::throwIfPossible(_status);
+    }
+
     void setNFeatures(size_t nFeatures)
     {
         if (!_model.get())
@@ -312,6 +330,8 @@ protected:
                                                 NodeId & res);
     services::Status addSplitNodeInternal(const TreeId treeId, const NodeId parentId, const size_t position, const size_t featureIndex,
                                           const double featureValue, NodeId & res);
+    services::Status addTreesInternal(const size_t nTrees, const size_t * const treeOffsets, const int * const featureIndices,
+                                      const double * const featureValues, const size_t * const leftChildren, const size_t * const rightChildren);
 
 private:
     size_t _nClasses;
@@ -317,6 +317,20 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const
+    {
+        const data_management::NumericTablePtr x = input.get(classifier::training::data);
+        if (!x) return 0;
+        return decision_forest::training::internal::estimateMemorySize(x->getNumberOfRows(), x->getNumberOfColumns(), parameter.nClasses, parameter,
+                                                                       sizeof(algorithmFPType));
+    }
+
     virtual services::Status checkComputeParams() DAAL_C11_OVERRIDE;
 
 protected:
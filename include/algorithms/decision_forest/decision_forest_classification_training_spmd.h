@@ -0,0 +1,140 @@
+/* file: decision_forest_classification_training_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for Decision forest model-based training in the SPMD processing mode
+//--
+*/
+
+#ifndef __DECISION_FOREST_CLASSIFICATION_TRAINING_SPMD_H__
+#define __DECISION_FOREST_CLASSIFICATION_TRAINING_SPMD_H__
+
+#include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "algorithms/engines/mt2203/mt2203.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace classification
+{
+namespace training
+{
+namespace interface2
+{
+/**
+ * @defgroup decision_forest_classification_training_spmd SPMD
+ * @ingroup decision_forest_classification_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__CLASSIFICATION__TRAINING__SPMD"></a>
+ * \brief Trains the Decision forest classification model in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data and builds its share of parameter.nTrees trees
+ *        on the bootstrap samples of its block. The trees of all the processes are gathered and merged,
+ *        so that the whole forest is available on every process.
+ *        The process uses the mt2203 engine initialized with seed + rank, parameter.engine is not used.
+ *        Other results, such as the out-of-bag error and the variable importance, are computed on the block of the process.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for Decision forest, double or float
+ * \tparam method           Decision forest computation method, \ref daal::algorithms::decision_forest::classification::training::Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Spmd
+{
+public:
+    typedef classifier::training::Input InputType;
+    typedef algorithms::decision_forest::classification::training::Parameter ParameterType;
+    typedef algorithms::decision_forest::classification::training::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm      Communicator of the processes
+     * \param[in] nClasses  Number of classes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm, size_t nClasses) : parameter(nClasses), seed(777), _comm(comm)
+    {
+        parameter.minObservationsInLeafNode = 1;
+    }
+
+    /**
+     * Trains the trees on the blocks of data of all the processes and merges them into one model
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+        const size_t nProcesses = _comm->getSize();
+        const size_t rank       = _comm->getRank();
+        DAAL_CHECK_EX(parameter.nTrees >= nProcesses, services::ErrorIncorrectParameter, services::ParameterName, "nTrees");
+
+        services::Status s;
+        Batch<algorithmFPType, method> local(parameter.nClasses);
+        local.parameter        = parameter;
+        local.parameter.nTrees = parameter.nTrees / nProcesses + (rank < parameter.nTrees % nProcesses ? 1 : 0);
+        local.parameter.engine = engines::mt2203::Batch<algorithmFPType>::create(seed + rank, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        local.input.set(classifier::training::data, input.get(classifier::training::data));
+        local.input.set(classifier::training::labels, input.get(classifier::training::labels));
+        local.input.set(classifier::training::weights, input.get(classifier::training::weights));
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        services::Collection<services::SharedPtr<data_management::SerializationIface> > models;
+        DAAL_CHECK_STATUS(s, services::internal::allgatherSerializable(*_comm, *local.getResult()->get(classifier::training::model), models));
+
+        ModelPtr forest = services::dynamicPointerCast<Model, data_management::SerializationIface>(models[0]);
+        DAAL_CHECK(forest, services::ErrorIncorrectTypeOfModel);
+        for (size_t i = 1; i < models.size(); i++)
+        {
+            ModelPtr part = services::dynamicPointerCast<Model, data_management::SerializationIface>(models[i]);
+            DAAL_CHECK(part, services::ErrorIncorrectTypeOfModel);
+            DAAL_CHECK_STATUS(s, forest->addTrees(*part));
+        }
+
+        _result = local.getResult();
+        _result->set(classifier::training::model, forest);
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the model with the trees of all the processes
+     * \return Structure that contains results of Decision forest training
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< \ref interface1::Parameter "Parameters" of the algorithm */
+    size_t seed;             /*!< Seed of the engine, the process with the index rank uses seed + rank */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface2
+using interface2::Spmd;
+
+} // namespace training
+} // namespace classification
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+#endif
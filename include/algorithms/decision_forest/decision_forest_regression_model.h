@@ -118,6 +118,31 @@ public:
     */
     virtual size_t getNumberOfTrees() const = 0;
 
+    /**
+    *  Appends the trees of another model trained on the data with the same features.
+    *  The model predicts as the forest of the trees of both models
+    *  \param[in] other  Model whose trees are appended
+    *  \return Status of the operation
+    */
+    virtual services::Status addTrees(const Model & other) = 0;
+
+    /**
+    *  Replaces the trees of the model by the compact representation that takes about three times less memory
+    *  and reduces the cache misses of the prediction. The splits keep 16-bit feature indices and 16-bit indices of the split values
+    *  in the per-feature tables of the distinct split values used by the model, the children are referenced by 32-bit offsets.
+    *  The impurities and the numbers of samples of the nodes are released. Traversal, serialization and appending of the trees
+    *  restore the full representation of the trees
+    *  \return Status of the operation. The model is not changed if a split uses a feature with the index greater than 65534
+    *          or a feature has more than 65536 distinct split values
+    */
+    virtual services::Status compact() = 0;
+
+    /**
+    *  Checks whether the trees of the model are kept in the compact representation
+    *  \return true if the trees are compact
+    */
+    virtual bool isCompact() const = 0;
+
 protected:
     Model();
 };
@@ -0,0 +1,135 @@
+/* file: decision_forest_regression_training_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for decision forest regression model-based training in the SPMD processing mode
+//--
+*/
+
+#ifndef __DECISION_FOREST_REGRESSION_TRAINING_SPMD_H__
+#define __DECISION_FOREST_REGRESSION_TRAINING_SPMD_H__
+
+#include "algorithms/decision_forest/decision_forest_regression_training_batch.h"
+#include "algorithms/engines/mt2203/mt2203.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace decision_forest
+{
+namespace regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup decision_forest_regression_training_spmd SPMD
+ * @ingroup decision_forest_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__DECISION_FOREST__REGRESSION__TRAINING__SPMD"></a>
+ * \brief Trains the decision forest regression model in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data and builds its share of parameter.nTrees trees
+ *        on the bootstrap samples of its block. The trees of all the processes are gathered and merged,
+ *        so that the whole forest is available on every process.
+ *        The process uses the mt2203 engine initialized with seed + rank, parameter.engine is not used.
+ *        Other results, such as the out-of-bag error and the variable importance, are computed on the block of the process.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for decision forest, double or float
+ * \tparam method           Decision forest computation method, \ref daal::algorithms::decision_forest::regression::training::Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Spmd
+{
+public:
+    typedef algorithms::decision_forest::regression::training::Input InputType;
+    typedef algorithms::decision_forest::regression::training::Parameter ParameterType;
+    typedef algorithms::decision_forest::regression::training::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm  Communicator of the processes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm) : seed(777), _comm(comm) {}
+
+    /**
+     * Trains the trees on the blocks of data of all the processes and merges them into one model
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+        const size_t nProcesses = _comm->getSize();
+        const size_t rank       = _comm->getRank();
+        DAAL_CHECK_EX(parameter.nTrees >= nProcesses, services::ErrorIncorrectParameter, services::ParameterName, "nTrees");
+
+        services::Status s;
+        Batch<algorithmFPType, method> local;
+        local.parameter        = parameter;
+        local.parameter.nTrees = parameter.nTrees / nProcesses + (rank < parameter.nTrees % nProcesses ? 1 : 0);
+        local.parameter.engine = engines::mt2203::Batch<algorithmFPType>::create(seed + rank, &s);
+        DAAL_CHECK_STATUS_VAR(s);
+        local.input.set(data, input.get(data));
+        local.input.set(dependentVariable, input.get(dependentVariable));
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        services::Collection<services::SharedPtr<data_management::SerializationIface> > models;
+        DAAL_CHECK_STATUS(s, services::internal::allgatherSerializable(*_comm, *local.getResult()->get(model), models));
+
+        ModelPtr forest = services::dynamicPointerCast<Model, data_management::SerializationIface>(models[0]);
+        DAAL_CHECK(forest, services::ErrorIncorrectTypeOfModel);
+        for (size_t i = 1; i < models.size(); i++)
+        {
+            ModelPtr part = services::dynamicPointerCast<Model, data_management::SerializationIface>(models[i]);
+            DAAL_CHECK(part, services::ErrorIncorrectTypeOfModel);
+            DAAL_CHECK_STATUS(s, forest->addTrees(*part));
+        }
+
+        _result = local.getResult();
+        _result->set(model, forest);
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the model with the trees of all the processes
+     * \return Structure that contains results of decision forest training
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< \ref interface1::Parameter "Parameters" of the algorithm */
+    size_t seed;             /*!< Seed of the engine, the process with the index rank uses seed + rank */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace training
+} // namespace regression
+} // namespace decision_forest
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -109,7 +109,9 @@ public:
           varImportance(none),
           resultsToCompute(0),
           memorySavingMode(false),
-          bootstrap(true)
+          bootstrap(true),
+          maxBins(256),
+          minBinSize(5)
     {}
 
     size_t nTrees;                        /*!< Number of trees in the forest. Default is 10 */
@@ -129,11 +131,23 @@ public:
     DAAL_UINT64 resultsToCompute;         /*!< 64 bit integer flag that indicates the results to compute */
     bool memorySavingMode;                /*!< If true then use memory saving (but slower) mode */
     bool bootstrap;                       /*!< If true then training set for a tree is a bootstrap of the whole training set */
+    size_t maxBins;                       /*!< Used with the hist training method only, if memorySavingMode is false.
+                                                 Maximal number of discrete bins to bucket continuous features.
+                                                 Default is 256. Increasing the number results in higher computation costs */
+    size_t minBinSize;                    /*!< Used with the hist training method only, if memorySavingMode is false.
+                                                 Minimal number of observations in a bin. Default is 5 */
 };
 /* [Parameter source code] */
 } // namespace interface1
 using interface1::Parameter;
 /** @} */
+
+namespace internal
+{
+/* Returns the estimate of the size of the memory allocated by the decision forest training in the batch processing mode,
+   nClasses is 0 for the regression */
+DAAL_EXPORT size_t estimateMemorySize(size_t nRows, size_t nFeatures, size_t nClasses, const Parameter & parameter, size_t fpSize);
+} // namespace internal
 } // namespace training
 } // namespace decision_forest
 } // namespace algorithms
@@ -241,7 +241,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
           maxTreeDepth(0),
           minObservationsInLeafNodes(1),
           nBins(1),
-          splitCriterion(infoGain)
+          splitCriterion(infoGain),
+          maxBins(256),
+          minBinSize(5)
     {}
 
     /**
@@ -255,6 +257,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
     size_t nBins;                      /*!< The number of bins used to compute probabilities of the observations belonging to the class.
                                              The only supported value for current version of the library is 1. */
     SplitCriterion splitCriterion;     /*!< Split criterion for Decision tree classification */
+    size_t maxBins;                    /*!< Used with the hist training method only. Maximal number of discrete bins to bucket each feature into */
+    size_t minBinSize;                 /*!< Used with the hist training method only. Minimal number of observations in a bin */
 };
 /* [Parameter source code] */
 } // namespace interface2
@@ -60,7 +60,9 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense = 0, /*!< Default method */
+    hist         = 1  /*!< Features are mapped to bins once before the training, the splits are searched among the bin borders.
+                           See Parameter::maxBins and Parameter::minBinSize */
 };
 
 /**
@@ -74,7 +74,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      *  Main constructor
      */
-    Parameter() : daal::algorithms::Parameter(), pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5) {}
+    Parameter()
+        : daal::algorithms::Parameter(), pruning(reducedErrorPruning), maxTreeDepth(0), minObservationsInLeafNodes(5), maxBins(256), minBinSize(5)
+    {}
 
     /**
      * Checks a parameter of the Decision tree algorithm
@@ -84,6 +86,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Pruning pruning;                   /*!< Pruning method for Decision tree */
     size_t maxTreeDepth;               /*!< Maximum tree depth. 0 means unlimited depth. */
     size_t minObservationsInLeafNodes; /*!< Minimum number of observations in the leaf node. Can be any positive number. */
+    size_t maxBins;                    /*!< Used with the hist training method only. Maximal number of discrete bins to bucket each feature into */
+    size_t minBinSize;                 /*!< Used with the hist training method only. Minimal number of observations in a bin */
 };
 /* [Parameter source code] */
 
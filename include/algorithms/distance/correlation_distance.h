@@ -87,6 +87,7 @@ class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
     typedef algorithms::correlation_distance::Input InputType;
+    typedef algorithms::correlation_distance::Parameter ParameterType;
     typedef algorithms::correlation_distance::Result ResultType;
 
     Batch() { initialize(); }
@@ -97,7 +98,7 @@ public:
      * \param[in] other An algorithm to be used as the source to initialize the input objects
      *                  and parameters of the algorithm
      */
-    Batch(const Batch<algorithmFPType, method> & other) : input(other.input) { initialize(); }
+    Batch(const Batch<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
 
     /**
     * Returns the method of the algorithm
@@ -135,7 +136,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, NULL, (int)method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
         _res               = _result.get();
         return s;
     }
@@ -144,11 +145,13 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in                  = &input;
+        _par                 = &parameter;
         _result.reset(new ResultType());
     }
 
 public:
-    InputType input; /*!< %Input objects of the algorithm */
+    InputType input;         /*!< %Input objects of the algorithm */
+    ParameterType parameter; /*!< Parameters of the algorithm */
 
 private:
     ResultPtr _result;
@@ -51,7 +51,8 @@ namespace correlation_distance
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense = 0, /*!< Default: performance-oriented method. */
+    fastCSR      = 1  /*!< Method for input data stored in the compressed sparse row (CSR) format */
 };
 
 /**
@@ -73,11 +74,36 @@ enum ResultId
     lastResultId = correlationDistance
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CORRELATION_DISTANCE__RESULTFORMAT"></a>
+ * Available formats of the result of the correlation distance algorithm
+ */
+enum ResultFormat
+{
+    denseResult  = 0, /*!< Distances between all pairs of vectors are stored in the dense or packed symmetric matrix */
+    sparseResult = 1  /*!< Selected distances are stored in the numeric table in the CSR format, supported by fastCSR method only */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__CORRELATION_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the correlation distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter(ResultFormat resultFormat = denseResult, double maxDistance = 1.0, size_t k = 0);
+
+    ResultFormat resultFormat; /*!< Format of the result */
+    double maxDistance;        /*!< Only the distances not greater than maxDistance are stored in the sparse result */
+    size_t k;                  /*!< Maximal number of the nearest vectors stored in a row of the sparse result, 0 means no limit */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__CORRELATION_DISTANCE__INPUT"></a>
  * \brief %Input objects for the correlation distance algorithm
@@ -168,6 +194,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
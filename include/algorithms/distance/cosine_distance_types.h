@@ -51,7 +51,8 @@ namespace cosine_distance
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense = 0, /*!< Default: performance-oriented method. */
+    fastCSR      = 1  /*!< Method for input data stored in the compressed sparse row (CSR) format */
 };
 
 /**
@@ -60,8 +61,10 @@ enum Method
  */
 enum InputId
 {
-    data, /*!< %Input data table */
-    lastInputId = data
+    data,          /*!< %Input data table */
+    referenceData, /*!< Optional table of the reference vectors, if set the distances between the rows of data and
+                        the rows of referenceData are computed */
+    lastInputId = referenceData
 };
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COSINE_DISTANCE__RESULTID"></a>
@@ -73,11 +76,36 @@ enum ResultId
     lastResultId = cosineDistance
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__COSINE_DISTANCE__RESULTFORMAT"></a>
+ * Available formats of the result of the cosine distance algorithm
+ */
+enum ResultFormat
+{
+    denseResult  = 0, /*!< Distances between all pairs of vectors are stored in the dense or packed symmetric matrix */
+    sparseResult = 1  /*!< Selected distances are stored in the numeric table in the CSR format, supported by fastCSR method only */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__COSINE_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the cosine distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    Parameter(ResultFormat resultFormat = denseResult, double maxDistance = 1.0, size_t k = 0);
+
+    ResultFormat resultFormat; /*!< Format of the result */
+    double maxDistance;        /*!< Only the distances not greater than maxDistance are stored in the sparse result */
+    size_t k;                  /*!< Maximal number of the nearest vectors stored in a row of the sparse result, 0 means no limit */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__COSINE_DISTANCE__INPUT"></a>
  * \brief %Input objects for the cosine distance algorithm
@@ -168,6 +196,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -80,6 +80,22 @@ enum OptionalInputId
     lastOptionalInputId = optionalArgument
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__CROSSPRODUCTINPUTID"></a>
+ * \brief Available identifiers of optional input objects with the cross-products precomputed for elastic net model-based training,
+ *        for example, by the online or distributed linear regression training. If they are set, the default solver runs
+ *        the coordinate descent over the Gram matrix without reading the input data
+ */
+enum CrossProductInputId
+{
+    xtx                     = lastOptionalInputId + 1, /*!< Numeric table of size p' x p' with the cross-product X'X in the layout of
+                                                            linear_regression::ModelNormEq::getXTXTable(), p' = p + 1 if the intercept
+                                                            is computed and p otherwise */
+    xty                     = lastOptionalInputId + 2, /*!< Numeric table of size k x p' with the cross-product X'Y in the layout of
+                                                            linear_regression::ModelNormEq::getXTYTable() */
+    lastCrossProductInputId = xty
+};
+
 /**
 * <a name="DAAL-ENUM-ALGORITHMS__OPTIMIZATION_SOLVER__ITERATIVE_SOLVER__OPTIONALDATAID"></a>
 * Available identifiers of optional input for the iterative solver
@@ -120,6 +136,16 @@ enum OptionalResultNumericTableId
     lastResultNumericTableId = gramMatrixId
 };
 
+/**
+* <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__RESULT_MODEL_COLLECTION_ID"></a>
+* Available identifiers of the collections of models obtained in the training stage of the regression algorithm
+*/
+enum OptionalResultModelCollectionId
+{
+    pathModels                          = lastResultNumericTableId + 1, /*!< Models trained for the penalties of the regularization path */
+    lastOptionalResultModelCollectionId = pathModels
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__ELASTIC_NET__TRAINING__RESULTID"></a>
  * \brief Available identifiers for input data corruption
@@ -149,6 +175,8 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
         : linear_model::Parameter(o),
           penaltyL1(o.penaltyL1),
           penaltyL2(o.penaltyL2),
+          penaltyL1Path(o.penaltyL1Path),
+          penaltyL2Path(o.penaltyL2Path),
           optimizationSolver(o.optimizationSolver),
           dataUseInComputation(o.dataUseInComputation),
           optResultToCompute(o.optResultToCompute)
@@ -158,6 +186,11 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
 
     data_management::NumericTablePtr penaltyL1; /*!< Numeric table that contains values of elastic net L1 parameters */
     data_management::NumericTablePtr penaltyL2; /*!< Numeric table that contains values of elastic net L2 parameters */
+    data_management::NumericTablePtr penaltyL1Path; /*!< Numeric table of size nPath x (1 or nDependentVariables) with L1 parameters
+                                                         of the regularization path. If it is set, a model is trained for every row
+                                                         and the previous model is used as a warm start */
+    data_management::NumericTablePtr penaltyL2Path; /*!< Optional numeric table of size nPath x (1 or nDependentVariables)
+                                                         with L2 parameters of the regularization path. If it is not set, penaltyL2 is used */
 
     SolverPtr optimizationSolver; /*!< Default is coordinate descent solver */
 
@@ -243,6 +276,20 @@ public:
     */
     void set(OptionalDataId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+     * Returns a cross-product precomputed for elastic net model-based training
+     * \param[in] id    Identifier of the cross-product
+     * \return          Cross-product that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(CrossProductInputId id) const;
+
+    /**
+     * Sets a cross-product precomputed for elastic net model-based training
+     * \param[in] id      Identifier of the cross-product
+     * \param[in] value   Pointer to the cross-product
+     */
+    void set(CrossProductInputId id, const data_management::NumericTablePtr & value);
+
     /**
      * Returns the number of columns in the input data set
      * \return Number of columns in the input data set
@@ -304,6 +351,20 @@ public:
     */
     void set(OptionalResultNumericTableId id, const data_management::NumericTablePtr & value);
 
+    /**
+    * Returns the collection of models of the regularization path
+    * \param[in] id    Identifier of the result
+    * \return          Collection of models that corresponds to the given identifier
+    */
+    data_management::DataCollectionPtr get(OptionalResultModelCollectionId id) const;
+
+    /**
+    * Sets the collection of models of the regularization path
+    * \param[in] id      Identifier of the result
+    * \param[in] value   Collection of models
+    */
+    void set(OptionalResultModelCollectionId id, const data_management::DataCollectionPtr & value);
+
     /**
      * Allocates memory to store the result of elastic net model-based training
      * \param[in] input Pointer to an object containing the input data
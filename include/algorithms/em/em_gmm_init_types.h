@@ -88,7 +88,9 @@ enum ResultCovariancesId
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default: performance-oriented method. */
+    defaultDense        = 0, /*!< Default: performance-oriented method. */
+    kMeansPlusPlusDense = 1  /*!< Means are initialized with the K-Means++ algorithm, weights and covariances are estimated
+                                  from the observations nearest to the means in one pass over the data */
 };
 
 /**
@@ -109,8 +111,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      * Constructs parameters of the EM for GMM algorithm
      * \param[in] nComponents        Number of components in the Gaussian mixture model
-     * \param[in] nTrials            Number of trials of short EM runs
-     * \param[in] nIterations        Number of iterations in every short EM run
+     * \param[in] nTrials            Number of trials of short EM runs, used by the defaultDense method only
+     * \param[in] nIterations        Number of iterations in every short EM run, used by the defaultDense method only
      * \param[in] seed               Seed for randomly generating data points to start the initialization of short EM
      * \param[in] accuracyThreshold  Threshold for the termination of the algorithm
      * \param[in] covarianceStorage  Type of covariance in the Gaussian mixture model
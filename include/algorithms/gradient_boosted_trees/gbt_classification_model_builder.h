@@ -131,6 +131,25 @@ public:
         return resId;
     }
 
+    /**
+    *  Create trees from the flat arrays of their nodes and add them to the model, the trees are built in parallel.
+    *  The nodes of the i-th tree are stored in the positions from treeOffsets[i] to (treeOffsets[i + 1] - 1) of the node arrays,
+    *  the first of them is the root of the tree, the indices of the children are given relative to the first node of the tree
+    *  \param[in] nTrees          Number of trees
+    *  \param[in] treeOffsets     Positions of the first nodes of the trees in the node arrays, array of size (nTrees + 1)
+    *  \param[in] featureIndices  Feature indices for spliting, negative values mark the leaf nodes
+    *  \param[in] featureValues   Feature values for spliting of the split nodes, response values of the leaf nodes
+    *  \param[in] leftChildren    Indices of the left children of the split nodes
+    *  \param[in] rightChildren   Indices of the right children of the split nodes
+    *  \param[in] classLabels     Labels of classes for which the trees are created, ignored for two classes
+    */
+    void addTrees(size_t nTrees, const size_t * treeOffsets, const int * featureIndices, const double * featureValues, const size_t * leftChildren,
+                  const size_t * rightChildren, const size_t * classLabels)
+    {
+        _status |= addTreesInternal(nTrees, treeOffsets, featureIndices, featureValues, leftChildren, rightChildren, classLabels);
+        services::throwIfPossible(_status);
+    }
+
     /**
     *  Get built model
     *  \return Model pointer
@@ -155,6 +174,8 @@ protected:
     services::Status createTreeInternal(size_t nNodes, size_t classLabel, TreeId & resId);
     services::Status addLeafNodeInternal(TreeId treeId, NodeId parentId, size_t position, double response, NodeId & res);
     services::Status addSplitNodeInternal(TreeId treeId, NodeId parentId, size_t position, size_t featureIndex, double featureValue, NodeId & res);
+    services::Status addTreesInternal(size_t nTrees, const size_t * treeOffsets, const int * featureIndices, const double * featureValues,
+                                      const size_t * leftChildren, const size_t * rightChildren, const size_t * classLabels);
     services::Status convertModelInternal();
     size_t _nClasses;
     size_t _nIterations;
@@ -91,9 +91,21 @@ namespace interface2
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
 {
-    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::classifier::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be used for prediction */
+    Parameter(size_t nClasses = 2) : daal::algorithms::classifier::Parameter(nClasses), nIterations(0), earlyExitInterval(0), earlyExitMargin(0) {}
+    Parameter(const Parameter & o)
+        : daal::algorithms::classifier::Parameter(o),
+          nIterations(o.nIterations),
+          earlyExitInterval(o.earlyExitInterval),
+          earlyExitMargin(o.earlyExitMargin)
+    {}
+    size_t nIterations;       /*!< Number of iterations of the trained model to be used for prediction */
+    size_t earlyExitInterval; /*!< Number of iterations between the checks of the early exit of a block of rows.
+                                   The evaluation of the trees stops for the block when the predicted classes of all its rows
+                                   can no longer change. 0 disables the early exit. Supported on CPU only */
+    double earlyExitMargin;   /*!< If positive, the evaluation of the trees also stops for the rows whose raw boosted value
+                                   of the predicted class exceeds the value of any other class (the decision boundary
+                                   for two classes) by more than the margin. The predicted classes and probabilities
+                                   of such rows are approximate */
 };
 /* [Parameter source code] */
 } // namespace interface2
@@ -236,11 +236,12 @@ public:
  * \par Enumerations
  *      - \ref Method                         Gradient Boosted Trees training methods
  *      - \ref classifier::training::InputId  Identifiers of input objects for the Gradient Boosted Trees training algorithm
+ *      - \ref ModelInputId                   Identifiers of input models for the Gradient Boosted Trees training algorithm
  *      - \ref classifier::training::ResultId Identifiers of Gradient Boosted Trees training results
  *
  * \par References
  *      - \ref gbt::classification::interface1::Model "Model" class
- *      - \ref classifier::training::interface1::Input "classifier::training::Input" class
+ *      - \ref interface1::Input "Input" class
  */
 template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
 class DAAL_EXPORT Batch : public classifier::training::Batch
@@ -248,7 +249,7 @@ class DAAL_EXPORT Batch : public classifier::training::Batch
 public:
     typedef classifier::training::Batch super;
 
-    typedef typename super::InputType InputType;
+    typedef algorithms::gbt::classification::training::Input InputType;
     typedef algorithms::gbt::classification::training::Parameter ParameterType;
     typedef algorithms::gbt::classification::training::Result ResultType;
 
@@ -319,6 +320,20 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const
+    {
+        const data_management::NumericTablePtr x = input.get(classifier::training::data);
+        if (!x) return 0;
+        return gbt::training::internal::estimateMemorySize(x->getNumberOfRows(), x->getNumberOfColumns(), parameter().nClasses, parameter(),
+                                                           sizeof(algorithmFPType));
+    }
+
     virtual services::Status checkComputeParams() DAAL_C11_OVERRIDE;
 
 protected:
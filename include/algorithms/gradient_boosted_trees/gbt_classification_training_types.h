@@ -69,6 +69,17 @@ enum LossFunctionType
     custom        /* custom function type */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum ModelInputId
+{
+    inputModel       = classifier::training::lastInputId + 1, /*!< Optional model trained before, the training continues boosting it
+                                                                   and appends the new trees */
+    lastModelInputId = inputModel
+};
+
 enum ResultNumericTableId
 {
     variableImportanceByWeight = classifier::training::lastResultId + 1,
@@ -126,6 +137,47 @@ struct DAAL_EXPORT Parameter : public classifier::Parameter, public daal::algori
 
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__INPUT"></a>
+ * \brief %Input objects for model-based training
+ */
+class DAAL_EXPORT Input : public classifier::training::Input
+{
+public:
+    /** Default constructor */
+    Input();
+
+    /** Copy constructor */
+    Input(const Input & other) : classifier::training::Input(other) {}
+
+    virtual ~Input() {}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id    Identifier of the input model
+     * \return          %Input model that corresponds to the given identifier
+     */
+    gbt::classification::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id      Identifier of the input model
+     * \param[in] value   Pointer to the model
+     */
+    void set(ModelInputId id, const gbt::classification::ModelPtr & value);
+
+    /**
+     * Checks an input object for the gradient boosted trees algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     * \return Status of checking
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__RESULT"></a>
  * \brief Provides methods to access the result obtained with the compute() method
@@ -200,6 +252,7 @@ typedef services::SharedPtr<Result> ResultPtr;
 
 } // namespace interface1
 using interface2::Parameter;
+using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
 
@@ -86,8 +86,22 @@ enum ModelInputId
  */
 enum ResultId
 {
-    prediction   = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
-    lastResultId = prediction
+    prediction        = algorithms::regression::prediction::prediction, /*!< Result of gradient boosted trees model-based prediction */
+    shapContributions = prediction + 1,                                 /*!< SHAP contributions of the features to the prediction */
+    shapInteractions  = prediction + 2,                                 /*!< SHAP interaction values of the pairs of features */
+    lastResultId      = shapInteractions
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__PREDICTION__REGRESSSION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results to compute in addition to the prediction
+ */
+enum ResultToComputeId
+{
+    computeShapContributions = 0x00000001ULL, /*!< Compute the contributions of the features for every observation with TreeSHAP,
+                                                   the table has (nFeatures + 1) columns, the last one is the expected value of the model */
+    computeShapInteractions  = 0x00000002ULL  /*!< Compute the SHAP interaction values for every observation, the table has
+                                                   (nFeatures + 1) * (nFeatures + 1) columns */
 };
 
 /**
@@ -104,9 +118,10 @@ namespace interface1
 /* [Parameter source code] */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter() : daal::algorithms::Parameter(), nIterations(0) {}
-    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations) {}
-    size_t nIterations; /*!< Number of iterations of the trained model to be uses for prediction*/
+    Parameter() : daal::algorithms::Parameter(), nIterations(0), resultsToCompute(0) {}
+    Parameter(const Parameter & o) : daal::algorithms::Parameter(o), nIterations(o.nIterations), resultsToCompute(o.resultsToCompute) {}
+    size_t nIterations;          /*!< Number of iterations of the trained model to be uses for prediction*/
+    DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute in addition to the prediction */
 };
 /* [Parameter source code] */
 
@@ -162,6 +162,19 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const
+    {
+        const data_management::NumericTablePtr x = input.get(gbt::regression::training::data);
+        if (!x) return 0;
+        return gbt::training::internal::estimateMemorySize(x->getNumberOfRows(), x->getNumberOfColumns(), 0, parameter(), sizeof(algorithmFPType));
+    }
+
 protected:
     virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
 
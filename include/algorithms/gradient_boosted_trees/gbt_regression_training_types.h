@@ -86,6 +86,16 @@ enum InputId
     lastInputId       = dependentVariable
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__MODELINPUTID"></a>
+ * \brief Available identifiers of input models for model-based training
+ */
+enum ModelInputId
+{
+    inputModel       = lastInputId + 1, /*!< Optional model trained before, the training continues boosting it and appends the new trees */
+    lastModelInputId = inputModel
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__RESULTID"></a>
  * \brief Available identifiers of the result of model-based training
@@ -158,6 +168,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns an input model for model-based training
+     * \param[in] id    Identifier of the input model
+     * \return          %Input model that corresponds to the given identifier
+     */
+    gbt::regression::ModelPtr get(ModelInputId id) const;
+
+    /**
+     * Sets an input model for model-based training
+     * \param[in] id      Identifier of the input model
+     * \param[in] value   Pointer to the model
+     */
+    void set(ModelInputId id, const gbt::regression::ModelPtr & value);
+
     /**
     * Checks an input object for the gradient boosted trees algorithm
     * \param[in] par     Algorithm parameter
@@ -64,6 +64,29 @@ enum SplitMethod
     defaultSplit = inexact /*!< Default split finding method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__GROWTH_POLICY"></a>
+ * \brief Order in which the nodes of a tree are split in gradient boosted trees algorithm
+ */
+enum GrowthPolicy
+{
+    depthWise           = 0,        /*!< Every node is split as soon as its split is found, the tree grows level by level */
+    leafWise            = 1,        /*!< The leaf with the largest loss reduction is split first until the number of leaves reaches maxLeaves */
+    defaultGrowthPolicy = depthWise /*!< Default growth policy */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__SAMPLING_METHOD"></a>
+ * \brief Method of sampling of the observations used for a training of one tree in gradient boosted trees algorithm
+ */
+enum SamplingMethod
+{
+    uniformSampling = 0,              /*!< Uniform sampling without replacement of observationsPerTreeFraction of the observations */
+    goss            = 1,              /*!< Gradient-based one-side sampling: the observations with the largest absolute gradients are kept,
+                                           the rest are sampled uniformly and their gradients are scaled up accordingly */
+    defaultSampling = uniformSampling /*!< Default sampling method */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__VARIABLE_IMPORTANCE_MODES"></a>
  * \brief Variable importance computation modes
@@ -120,11 +143,28 @@ public:
     size_t minBinSize;                  /*!< Used with 'inexact' split finding method only.
                                                  Minimal number of observations in a bin. Default is 5 */
     int internalOptions;                /*!< Internal options */
+    GrowthPolicy growthPolicy;          /*!< Order in which the nodes of a tree are split. Default is depthWise */
+    size_t maxLeaves;                   /*!< Used with 'leafWise' growth policy only.
+                                                 Maximal number of leaves in a tree, 0 for unlimited. Default is 0 */
+    SamplingMethod samplingMethod;      /*!< Method of sampling of the observations for a tree. Default is uniformSampling */
+    double gossTopFraction;             /*!< Used with 'goss' sampling method only, observationsPerTreeFraction is not used then.
+                                                 Fraction of the observations with the largest absolute gradients kept for a tree.
+                                                 Range: [0, 1). Default is 0.2 */
+    double gossOtherFraction;           /*!< Used with 'goss' sampling method only.
+                                                 Fraction of the observations sampled uniformly from the rest.
+                                                 Range: (0, 1 - gossTopFraction]. Default is 0.1 */
 };
 /* [Parameter source code] */
 } // namespace interface1
 using interface1::Parameter;
 /** @} */
+
+namespace internal
+{
+/* Returns the estimate of the size of the memory allocated by the gradient boosted trees training in the batch processing mode,
+   nClasses is 0 for the regression */
+DAAL_EXPORT size_t estimateMemorySize(size_t nRows, size_t nFeatures, size_t nClasses, const Parameter & parameter, size_t fpSize);
+} // namespace internal
 } // namespace training
 } // namespace gbt
 } // namespace algorithms
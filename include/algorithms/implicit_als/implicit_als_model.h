@@ -45,6 +45,16 @@ namespace implicit_als
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__SOLVERMETHOD"></a>
+ * Available methods to solve the systems of normal equations for the factors of a user or an item
+ */
+enum SolverMethod
+{
+    choleskySolver          = 0, /*!< Forms the nFactors x nFactors system explicitly and solves it with the Cholesky decomposition */
+    conjugateGradientSolver = 1  /*!< Applies the matrix of the system implicitly in a fixed number of conjugate gradient iterations */
+};
+
 namespace interface1
 {
 /**
@@ -65,7 +75,14 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      * \param[in] preferenceThreshold Threshold used to define preference values
      */
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01, double preferenceThreshold = 0.0)
-        : nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda), preferenceThreshold(preferenceThreshold)
+        : nFactors(nFactors),
+          maxIterations(maxIterations),
+          alpha(alpha),
+          lambda(lambda),
+          preferenceThreshold(preferenceThreshold),
+          solverMethod(choleskySolver),
+          nCGIterations(3),
+          nTopItems(10)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -73,6 +90,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    SolverMethod solverMethod;  /*!< Method to solve the systems of normal equations in the implicit ALS training algorithm */
+    size_t nCGIterations;       /*!< Number of conjugate gradient iterations per system of normal equations,
+                                     used if solverMethod is conjugateGradientSolver */
+    size_t nTopItems;           /*!< Number of items with the highest ratings predicted for each user
+                                     by the prediction::ratings::topItemsDense method */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
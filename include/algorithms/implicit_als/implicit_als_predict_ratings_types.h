@@ -59,7 +59,8 @@ namespace ratings
 enum Method
 {
     defaultDense     = 0, /*!< Default: predicts ratings based on the ALS model and input data in the dense format */
-    allUsersAllItems = 0  /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    allUsersAllItems = 0, /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    topItemsDense    = 1  /*!< Predicts the items with the highest ratings for each user without storing the ratings of all items */
 };
 
 /**
@@ -73,6 +74,18 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__NUMERICTABLEINPUTID"></a>
+ * Available identifiers of input numeric table objects for the rating prediction stage
+ * of the implicit ALS algorithm
+ */
+enum NumericTableInputId
+{
+    data = lastModelInputId + 1, /*!< Optional %input table in the CSR format with the known ratings of the users.
+                                      Used by the topItemsDense method only: items rated by a user are not predicted for the user */
+    lastNumericTableInputId = data
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARTIALMODELINPUTID"></a>
  * Available identifiers of input PartialModel objects for the rating prediction stage
@@ -105,7 +118,11 @@ enum PartialResultId
 enum ResultId
 {
     prediction, /*!< Numeric table with the predicted ratings */
-    lastResultId = prediction
+    topItems,   /*!< Numeric table of size nUsers x nTopItems with the indices of the items with the highest predicted ratings,
+                     sorted by the ratings in descending order. Computed by the topItemsDense method only */
+    topRatings, /*!< Numeric table of size nUsers x nTopItems with the predicted ratings of the items in topItems.
+                     Computed by the topItemsDense method only */
+    lastResultId = topRatings
 };
 
 /**
@@ -162,6 +179,20 @@ public:
      */
     void set(ModelInputId id, const ModelPtr & ptr);
 
+    /**
+     * Returns an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table object
+     * \return          Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(NumericTableInputId id) const;
+
+    /**
+     * Sets an input numeric table object for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(NumericTableInputId id, const data_management::NumericTablePtr & ptr);
+
     /**
      * Returns the number of rows in the input numeric table
      * \return Number of rows in the input numeric table
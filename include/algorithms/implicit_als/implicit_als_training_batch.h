@@ -36,6 +36,13 @@ namespace implicit_als
 {
 namespace training
 {
+namespace internal
+{
+/* Returns the estimate of the size of the memory allocated by the implicit ALS training in the batch processing mode,
+   see Batch::estimateMemorySize() */
+DAAL_EXPORT size_t estimateMemorySize(size_t nUsers, size_t nItems, size_t nNonZeros, const Parameter & parameter, int method, size_t fpSize);
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -130,6 +137,21 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const
+    {
+        const data_management::NumericTablePtr x = input.get(data);
+        if (!x) return 0;
+        data_management::CSRNumericTableIface * csr = dynamic_cast<data_management::CSRNumericTableIface *>(x.get());
+        const size_t nNonZeros                      = csr ? csr->getDataSize() : x->getNumberOfRows() * x->getNumberOfColumns();
+        return internal::estimateMemorySize(x->getNumberOfRows(), x->getNumberOfColumns(), nNonZeros, parameter, (int)method, sizeof(algorithmFPType));
+    }
+
 protected:
     training::ResultPtr _result;
 
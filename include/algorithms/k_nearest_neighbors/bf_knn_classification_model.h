@@ -53,6 +53,17 @@ enum DataUseInModel
     doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__BF_KNN_CLASSIFICATION__DATASTORAGETYPE"></a>
+ * \brief Precision in which the GPU implementation stores the data for the computation of distances
+ */
+enum DataStorageType
+{
+    fullPrecisionStorage = 0, /*!< Default: the data is used in the precision of the algorithm */
+    bfloat16Storage      = 1, /*!< The data is packed to bfloat16, the distances are accumulated in single precision */
+    float16Storage       = 2  /*!< The data is packed to IEEE half precision, the distances are accumulated in single precision */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -74,7 +85,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
      */
     Parameter(size_t nClasses = 2, size_t nNeighbors = 1, DataUseInModel dataUse = doNotUse)
-        : daal::algorithms::classifier::Parameter(nClasses), k(nNeighbors), dataUseInModel(dataUse), engine(engines::mcg59::Batch<>::create())
+        : daal::algorithms::classifier::Parameter(nClasses),
+          k(nNeighbors),
+          dataUseInModel(dataUse),
+          engine(engines::mcg59::Batch<>::create()),
+          dataStorageType(fullPrecisionStorage)
     {}
 
     /**
@@ -82,7 +97,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      *  \param[in] other             Object to copy
      */
     Parameter(const Parameter & other)
-        : daal::algorithms::classifier::Parameter(other.nClasses), k(other.k), dataUseInModel(other.dataUseInModel), engine(other.engine->clone())
+        : daal::algorithms::classifier::Parameter(other.nClasses),
+          k(other.k),
+          dataUseInModel(other.dataUseInModel),
+          engine(other.engine->clone()),
+          dataStorageType(other.dataStorageType)
     {}
 
     /**
@@ -97,6 +116,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
             k                                                = other.k;
             dataUseInModel                                   = other.dataUseInModel;
             engine                                           = other.engine->clone();
+            dataStorageType                                  = other.dataStorageType;
         }
         return *this;
     }
@@ -106,9 +126,11 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      */
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    size_t k;                      /*!< Number of neighbors */
-    DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
-    engines::EnginePtr engine;     /*!< Engine for random choosing elements from training dataset */
+    size_t k;                        /*!< Number of neighbors */
+    DataUseInModel dataUseInModel;   /*!< The option to enable/disable an usage of the input dataset in kNN model */
+    engines::EnginePtr engine;       /*!< Engine for random choosing elements from training dataset */
+    DataStorageType dataStorageType; /*!< Precision of the data used for the distances on GPU, the distances to the candidate
+                                          neighbors are recomputed in the precision of the algorithm to get the exact order of neighbors */
 };
 /* [Parameter source code] */
 
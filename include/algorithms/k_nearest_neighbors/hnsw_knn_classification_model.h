@@ -0,0 +1,184 @@
+/* file: hnsw_knn_classification_model.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the approximate k-Nearest Neighbors (kNN) classification model
+//  based on hierarchical navigable small world graphs
+//--
+*/
+
+#ifndef __HNSW_KNN_CLASSIFICATION_MODEL_H__
+#define __HNSW_KNN_CLASSIFICATION_MODEL_H__
+
+#include "algorithms/classifier/classifier_model.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/engines/mcg59/mcg59.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup hnsw_knn_classification Approximate k-Nearest Neighbors
+ * \copydoc daal::algorithms::hnsw_knn_classification
+ * @ingroup classification
+ * @{
+ */
+
+/**
+ * \brief Contains classes for the approximate kNN algorithm based on hierarchical navigable small world (HNSW) graphs
+ */
+namespace hnsw_knn_classification
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__HNSW_KNN_CLASSIFICATION__DATAUSEINMODEL"></a>
+ * \brief The option to enable/disable an usage of the input dataset in the HNSW based kNN model
+ */
+enum DataUseInModel
+{
+    doNotUse = 0, /*!< The input data and labels will not be the component of the trained kNN model */
+    doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__HNSW_KNN_CLASSIFICATION__PARAMETER"></a>
+ * \brief HNSW based kNN algorithm parameters
+ *
+ * The graph is built with maxConnections links per node on the upper layers and 2 * maxConnections links on the bottom layer.
+ * Larger values of efConstruction improve the quality of the graph at the cost of the training time,
+ * larger values of efSearch improve the recall of the prediction at the cost of its latency.
+ *
+ * \snippet k_nearest_neighbors/hnsw_knn_classification_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nClasses             Number of classes
+     *  \param[in] nNeighbors           Number of neighbors
+     *  \param[in] nConnections         Maximal number of links of a node on the upper layers of the graph
+     *  \param[in] efConstructionSize   Size of the dynamic candidate list used on the training stage
+     *  \param[in] efSearchSize         Size of the dynamic candidate list used on the prediction stage
+     *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     */
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, size_t nConnections = 16, size_t efConstructionSize = 200, size_t efSearchSize = 64,
+              DataUseInModel dataUse = doNotUse)
+        : daal::algorithms::classifier::Parameter(nClasses),
+          k(nNeighbors),
+          maxConnections(nConnections),
+          efConstruction(efConstructionSize),
+          efSearch(efSearchSize),
+          dataUseInModel(dataUse),
+          engine(engines::mcg59::Batch<>::create())
+    {}
+
+    /**
+     * Checks a parameter of the HNSW based kNN algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t k;                      /*!< Number of neighbors */
+    size_t maxConnections;         /*!< Maximal number of links of a node on the upper layers of the graph */
+    size_t efConstruction;         /*!< Size of the dynamic candidate list used on the training stage */
+    size_t efSearch;               /*!< Size of the dynamic candidate list used on the prediction stage, defines the recall/latency tradeoff */
+    DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
+    engines::EnginePtr engine;     /*!< Engine for random assignment of the graph layers to the training observations */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__HNSW_KNN_CLASSIFICATION__MODEL"></a>
+ * \brief %Base class for models trained with the HNSW based kNN algorithm
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public daal::algorithms::classifier::Model
+{
+public:
+    DECLARE_MODEL_IFACE(Model, classifier::Model);
+
+    /**
+     * Constructs the model trained with the HNSW based kNN algorithm
+     * \param[in] nFeatures Number of features in the dataset
+     */
+    Model(size_t nFeatures = 0);
+
+    /**
+     * Constructs the model trained with the HNSW based kNN algorithm
+     * \param[in]  nFeatures Number of features in the dataset
+     * \param[out] stat      Status of the model construction
+     */
+    static services::SharedPtr<Model> create(size_t nFeatures = 0, services::Status * stat = NULL);
+
+    virtual ~Model();
+
+    class ModelImpl;
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    const ModelImpl * impl() const { return _impl; }
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    ModelImpl * impl() { return _impl; }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
+
+protected:
+    Model(size_t nFeatures, services::Status & st);
+
+    services::Status serializeImpl(data_management::InputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+    services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+private:
+    ModelImpl * _impl; /*!< Model implementation */
+};
+typedef services::SharedPtr<Model> ModelPtr;
+typedef services::SharedPtr<const Model> ModelConstPtr;
+} // namespace interface1
+
+using interface1::Parameter;
+using interface1::Model;
+using interface1::ModelPtr;
+using interface1::ModelConstPtr;
+
+} // namespace hnsw_knn_classification
+
+/** @} */
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,189 @@
+/* file: ivfpq_knn_classification_model.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the IVF-PQ based k-Nearest Neighbors (kNN) classification model
+//--
+*/
+
+#ifndef __IVFPQ_KNN_CLASSIFICATION_MODEL_H__
+#define __IVFPQ_KNN_CLASSIFICATION_MODEL_H__
+
+#include "algorithms/classifier/classifier_model.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup ivfpq_knn_classification k-Nearest Neighbors Based on IVF-PQ
+ * \copydoc daal::algorithms::ivfpq_knn_classification
+ * @ingroup classification
+ * @{
+ */
+
+/**
+ * \brief Contains classes for the kNN algorithm based on the inverted lists with the product quantization (IVF-PQ)
+ */
+namespace ivfpq_knn_classification
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IVFPQ_KNN_CLASSIFICATION__DATAUSEINMODEL"></a>
+ * \brief The option to enable/disable an usage of the input dataset in the IVF-PQ based kNN model
+ */
+enum DataUseInModel
+{
+    doNotUse = 0, /*!< The input data and labels will not be the component of the trained kNN model */
+    doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__IVFPQ_KNN_CLASSIFICATION__PARAMETER"></a>
+ * \brief IVF-PQ based kNN algorithm parameters
+ *
+ * The training observations are split into nLists inverted lists by the k-means clustering, and the residual of each
+ * observation to the centroid of its list is compressed by the product quantization: the features are divided into
+ * nSubquantizers groups, and each group is replaced by the one-byte index of the nearest of 256 codewords.
+ * The prediction scans only the nProbes lists nearest to the query and computes the approximate distances with
+ * the lookup tables of the distances from the query to the codewords. If nCandidates is not zero, that number of
+ * the nearest candidates is re-ranked by the exact distances, which requires the model to keep the training data.
+ *
+ * \snippet k_nearest_neighbors/ivfpq_knn_classification_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    /**
+     *  Parameter constructor
+     *  \param[in] nClasses             Number of classes
+     *  \param[in] nNeighbors           Number of neighbors
+     *  \param[in] nListsValue          Number of the inverted lists
+     *  \param[in] nSubquantizersValue  Number of the groups of the features encoded separately
+     *  \param[in] nProbesValue         Number of the inverted lists scanned by the prediction
+     *  \param[in] nCandidatesValue     Number of the candidates re-ranked by the exact distances, 0 disables the re-ranking
+     *  \param[in] nIterationsValue     Number of the iterations of the k-means clustering
+     *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     */
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, size_t nListsValue = 256, size_t nSubquantizersValue = 8, size_t nProbesValue = 8,
+              size_t nCandidatesValue = 0, size_t nIterationsValue = 10, DataUseInModel dataUse = doNotUse)
+        : daal::algorithms::classifier::Parameter(nClasses),
+          k(nNeighbors),
+          nLists(nListsValue),
+          nSubquantizers(nSubquantizersValue),
+          nProbes(nProbesValue),
+          nCandidates(nCandidatesValue),
+          nIterations(nIterationsValue),
+          dataUseInModel(dataUse)
+    {}
+
+    /**
+     * Checks a parameter of the IVF-PQ based kNN algorithm
+     */
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t k;                      /*!< Number of neighbors */
+    size_t nLists;                 /*!< Number of the inverted lists */
+    size_t nSubquantizers;         /*!< Number of the groups of the features encoded separately */
+    size_t nProbes;                /*!< Number of the inverted lists scanned by the prediction */
+    size_t nCandidates;            /*!< Number of the candidates re-ranked by the exact distances, 0 disables the re-ranking */
+    size_t nIterations;            /*!< Number of the iterations of the k-means clustering */
+    DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__IVFPQ_KNN_CLASSIFICATION__MODEL"></a>
+ * \brief %Base class for models trained with the IVF-PQ based kNN algorithm
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public daal::algorithms::classifier::Model
+{
+public:
+    DECLARE_MODEL_IFACE(Model, classifier::Model);
+
+    /**
+     * Constructs the model trained with the IVF-PQ based kNN algorithm
+     * \param[in] nFeatures Number of features in the dataset
+     */
+    Model(size_t nFeatures = 0);
+
+    /**
+     * Constructs the model trained with the IVF-PQ based kNN algorithm
+     * \param[in]  nFeatures Number of features in the dataset
+     * \param[out] stat      Status of the model construction
+     */
+    static services::SharedPtr<Model> create(size_t nFeatures = 0, services::Status * stat = NULL);
+
+    virtual ~Model();
+
+    class ModelImpl;
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    const ModelImpl * impl() const { return _impl; }
+
+    /**
+     * Returns actual model implementation
+     * \return Model implementation
+     */
+    ModelImpl * impl() { return _impl; }
+
+    /**
+     *  Retrieves the number of features in the dataset was used on the training stage
+     *  \return Number of features in the dataset was used on the training stage
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
+
+protected:
+    Model(size_t nFeatures, services::Status & st);
+
+    services::Status serializeImpl(data_management::InputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+    services::Status deserializeImpl(const data_management::OutputDataArchive * arch) DAAL_C11_OVERRIDE;
+
+private:
+    ModelImpl * _impl; /*!< Model implementation */
+};
+typedef services::SharedPtr<Model> ModelPtr;
+typedef services::SharedPtr<const Model> ModelConstPtr;
+} // namespace interface1
+
+using interface1::Parameter;
+using interface1::Model;
+using interface1::ModelPtr;
+using interface1::ModelConstPtr;
+
+} // namespace ivfpq_knn_classification
+
+/** @} */
+} // namespace algorithms
+} // namespace daal
+
+#endif
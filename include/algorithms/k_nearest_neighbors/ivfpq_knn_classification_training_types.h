@@ -0,0 +1,112 @@
+/* file: ivfpq_knn_classification_training_types.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the IVF-PQ based k-Nearest Neighbor (kNN) algorithm interface
+//--
+*/
+
+#ifndef __IVFPQ_KNN_CLASSIFICATION_TRAINING_TYPES_H__
+#define __IVFPQ_KNN_CLASSIFICATION_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/data_serialize.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_model.h"
+#include "algorithms/classifier/classifier_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * \brief Contains classes of the IVF-PQ based kNN algorithm
+ */
+namespace ivfpq_knn_classification
+{
+/**
+ * @defgroup ivfpq_knn_classification_training Training
+ * \copydoc daal::algorithms::ivfpq_knn_classification::training
+ * @ingroup ivfpq_knn_classification
+ * @{
+ */
+/**
+ * \brief Contains a class for IVF-PQ based kNN model-based training
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IVFPQ_KNN_CLASSIFICATION__TRAINING__METHOD"></a>
+ * \brief Computation methods for IVF-PQ based kNN model-based training
+ */
+enum Method
+{
+    defaultDense = 0 /*!< Default method */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__IVFPQ_KNN_CLASSIFICATION__TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method of IVF-PQ based kNN model-based training
+ */
+class DAAL_EXPORT Result : public classifier::training::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    /**
+     * Returns the result of IVF-PQ based kNN model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    daal::algorithms::ivfpq_knn_classification::ModelPtr get(classifier::training::ResultId id) const;
+
+    /**
+     * Allocates memory to store the result of IVF-PQ based kNN model-based training
+     * \param[in] input Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of IVF-PQ based kNN model-based training
+     * \param[in] method Computation method for the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const Parameter * parameter, int method);
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return classifier::training::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+} // namespace interface1
+
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace training
+/** @} */
+} // namespace ivfpq_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
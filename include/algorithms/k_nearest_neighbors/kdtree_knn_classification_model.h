@@ -196,6 +196,38 @@ public:
      */
     size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE;
 
+    /**
+     * Adds observations to the trained model without rebuilding the KD-tree.
+     * The added observations get the identifiers getNumberOfObservations(), getNumberOfObservations() + 1, ...
+     * in the order of the rows. The prediction scans them by the brute force, so the model should be trained again
+     * once their number becomes comparable with the size of the leaves of the KD-tree times its depth
+     * \param[in] data    Observations to add
+     * \param[in] labels  Labels of the observations to add
+     * \return Status of the addition
+     */
+    services::Status addObservations(const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & labels);
+
+    /**
+     * Removes observations from the trained model without rebuilding the KD-tree. The identifier of a training observation
+     * is its row in the training data, the identifiers of the added observations are described in addObservations().
+     * The removed observations are skipped by the prediction until the model is trained again
+     * \param[in] ids  Table with one column of the identifiers of the observations to remove
+     * \return Status of the removal
+     */
+    services::Status removeObservations(const data_management::NumericTablePtr & ids);
+
+    /**
+     *  Retrieves the number of the training and the added observations including the removed ones
+     *  \return Number of the observations
+     */
+    size_t getNumberOfObservations() const;
+
+    /**
+     *  Retrieves the number of the removed observations
+     *  \return Number of the removed observations
+     */
+    size_t getNumberOfRemovedObservations() const;
+
 protected:
     Model(size_t nFeatures, services::Status & st);
 
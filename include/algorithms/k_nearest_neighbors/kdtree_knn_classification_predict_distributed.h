@@ -0,0 +1,379 @@
+/* file: kdtree_knn_classification_predict_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for K-Nearest Neighbors (kNN) model-based prediction
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DISTRIBUTED_H__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * @defgroup kdtree_knn_classification_prediction_distributed Distributed
+ * @ingroup kdtree_knn_classification_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of KD-tree based kNN model-based prediction in the distributed processing mode.
+ *        The training data set is split between the local nodes, each node builds its own model
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Computation method, \ref Method
+ */
+template <ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods of the first step of KD-tree based kNN model-based prediction
+ *        in the distributed processing mode: the search of the nearest neighbors in the local model
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step1Local, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for KD-tree based kNN model-based prediction with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Finds the nearest neighbors of the queries in the local model
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing, the first step has no result besides the partial one
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Class containing computation methods of the second step of KD-tree based kNN model-based prediction
+ *        in the distributed processing mode: the merge of the local neighbors and the voting
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class DistributedContainer<step2Master, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for KD-tree based kNN model-based prediction with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges the nearest neighbors of the partial results into the k nearest neighbors of each query
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the labels of the queries by the voting of the merged neighbors
+     */
+    virtual services::Status finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTED"></a>
+ * \brief Provides methods to run KD-tree based kNN model-based prediction in the distributed processing mode
+ * <!-- \n<a href="DAAL-REF-KNN-ALGORITHM">kNN algorithm description and usage models</a> -->
+ *
+ * \tparam step             Step of the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Computation method, \ref Method
+ */
+template <ComputeStep step, typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Distributed
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Finds the k nearest neighbors of the queries among the training observations of the local node.
+ *        The model of the local node is built by the batch training on the local part of the training data set
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Computation method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref PartialResultId  Identifiers of partial results of the algorithm
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    typedef algorithms::kdtree_knn_classification::prediction::Input InputType;
+    typedef algorithms::kdtree_knn_classification::Parameter ParameterType;
+    typedef algorithms::kdtree_knn_classification::prediction::PartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed() { initialize(); }
+
+    /**
+     * Constructs the algorithm by copying input objects and parameters of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the nearest neighbors found on the local node
+     * \return Structure that contains the nearest neighbors found on the local node
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Sets the structure to store the nearest neighbors found on the local node
+     * \param[in] partialRes  Structure to store the partial result
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialRes)
+    {
+        DAAL_CHECK(partialRes, services::ErrorNullPartialResult);
+        _partialResult = partialRes;
+        _pres          = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm with a copy of input objects
+     * and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResultType());
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, _par, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in                        = &input;
+        _par                       = &parameter;
+    }
+
+public:
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< \ref kdtree_knn_classification::interface2::Parameter "Parameters" of prediction, only k is used */
+
+private:
+    PartialResultPtr _partialResult;
+
+    Distributed & operator=(const Distributed &);
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the nearest neighbors found on the local nodes and predicts the labels of the queries by the voting.
+ *        The partial results can be added by parts, compute() merges the added ones into the partial result of the master node
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Computation method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref MasterInputId    Identifiers of input objects of the second step
+ *      - \ref PartialResultId  Identifiers of partial results of the algorithm
+ */
+template <typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    typedef algorithms::kdtree_knn_classification::prediction::DistributedStep2MasterInput InputType;
+    typedef algorithms::kdtree_knn_classification::Parameter ParameterType;
+    typedef algorithms::classifier::prediction::Result ResultType;
+    typedef algorithms::kdtree_knn_classification::prediction::PartialResult PartialResultType;
+
+    /** Default constructor */
+    Distributed() { initialize(); }
+
+    /**
+     * Constructs the algorithm by copying input objects and parameters of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> & other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the predicted labels
+     * \return Structure that contains the predicted labels
+     */
+    classifier::prediction::ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the predicted labels
+     * \param[in] result  Structure to store the predicted labels
+     */
+    services::Status setResult(const classifier::prediction::ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns the structure that contains the merged nearest neighbors
+     * \return Structure that contains the merged nearest neighbors
+     */
+    PartialResultPtr getPartialResult() { return _partialResult; }
+
+    /**
+     * Sets the structure to store the merged nearest neighbors
+     * \param[in] partialRes  Structure to store the partial result
+     */
+    services::Status setPartialResult(const PartialResultPtr & partialRes)
+    {
+        DAAL_CHECK(partialRes, services::ErrorNullPartialResult);
+        _partialResult = partialRes;
+        _pres          = _partialResult.get();
+        return services::Status();
+    }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    services::Status checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        DAAL_CHECK(_partialResult, services::ErrorNullPartialResult);
+        DAAL_CHECK(_result, services::ErrorNullResult);
+        return _partialResult->check(_par, method);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm with a copy of input objects
+     * and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s;
+        const size_t nRows = _partialResult->get(neighborDistances)->getNumberOfRows();
+        _result.reset(new ResultType());
+        _result->set(classifier::prediction::prediction,
+                     data_management::HomogenNumericTable<algorithmFPType>::create(1, nRows, data_management::NumericTable::doAllocate, &s));
+        _res = _result.get();
+        return s;
+    }
+
+    virtual services::Status allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult.reset(new PartialResultType());
+        services::Status s = _partialResult->allocate<algorithmFPType>(&input, _par, (int)method);
+        _pres              = _partialResult.get();
+        return s;
+    }
+
+    virtual services::Status initializePartialResult() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in                        = &input;
+        _par                       = &parameter;
+    }
+
+public:
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< \ref kdtree_knn_classification::interface2::Parameter "Parameters" of prediction, only k is used */
+
+private:
+    PartialResultPtr _partialResult;
+    classifier::prediction::ResultPtr _result;
+
+    Distributed & operator=(const Distributed &);
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -58,6 +58,27 @@ enum Method
     defaultDense = 0 /*!< Default method */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__PARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of KD-tree based kNN model-based prediction in the distributed processing mode
+ */
+enum PartialResultId
+{
+    neighborDistances,  /*!< Table of size nQueries x k with the squared distances to the nearest neighbors in the ascending order */
+    neighborLabels,     /*!< Table of size nQueries x k with the class labels of the nearest neighbors */
+    lastPartialResultId = neighborLabels
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects of KD-tree based kNN model-based prediction in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults, /*!< Collection of partial results computed on the local nodes for the same queries */
+    lastMasterInputId = partialResults
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -107,9 +128,134 @@ public:
     services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__PARTIALRESULT"></a>
+ * \brief Provides methods to access the nearest neighbors of the queries found in a part of the training data set.
+ *        The squared distances of the row are in the ascending order, the positions without a neighbor hold the largest
+ *        value of the floating-point type
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(PartialResult)
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store the partial result of KD-tree based kNN model-based prediction
+     * \param[in] input      %Input of the algorithm, \ref Input or \ref DistributedStep2MasterInput
+     * \param[in] parameter  Parameter of the algorithm
+     * \param[in] method     Computation method
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Marks all the positions of the partial result as positions without a neighbor
+     * \param[in] input      %Input of the algorithm
+     * \param[in] parameter  Parameter of the algorithm
+     * \param[in] method     Computation method
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Returns the partial result of KD-tree based kNN model-based prediction
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of KD-tree based kNN model-based prediction
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks the partial result of KD-tree based kNN model-based prediction
+     * \param[in] input      %Input of the algorithm
+     * \param[in] parameter  Parameter of the algorithm
+     * \param[in] method     Computation method
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of KD-tree based kNN model-based prediction
+     * \param[in] parameter  Parameter of the algorithm
+     * \param[in] method     Computation method
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief Input objects of KD-tree based kNN model-based prediction in the second step of the distributed processing mode
+ */
+class DAAL_EXPORT DistributedStep2MasterInput : public daal::algorithms::Input
+{
+public:
+    DistributedStep2MasterInput();
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+     * Returns the collection of partial results
+     * \param[in] id   Identifier of the input object
+     * \return         %Input object that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Sets the collection of partial results
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr & ptr);
+
+    /**
+     * Adds the partial result computed on a local node
+     * \param[in] id     Identifier of the input object
+     * \param[in] value  Pointer to the partial result
+     */
+    void add(MasterInputId id, const PartialResultPtr & value);
+
+    /**
+     * Returns the number of queries in the partial results
+     * \return Number of queries
+     */
+    size_t getNumberOfRows() const;
+
+    /**
+     * Checks the input objects of the second step of the distributed processing mode
+     * \param[in] parameter  Parameter of the algorithm
+     * \param[in] method     Computation method
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter * parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
 } // namespace interface1
 
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::DistributedStep2MasterInput;
 
 } // namespace prediction
 /** @} */
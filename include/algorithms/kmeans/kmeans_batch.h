@@ -36,6 +36,12 @@ namespace algorithms
 {
 namespace kmeans
 {
+namespace internal
+{
+/* Returns the estimate of the size of the memory allocated by the computations in the batch processing mode, see Batch::estimateMemorySize() */
+DAAL_EXPORT size_t estimateMemorySize(const Input & input, const Parameter & parameter, size_t fpSize);
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -142,6 +148,14 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const { return internal::estimateMemorySize(input, parameter, sizeof(algorithmFPType)); }
+
 protected:
     virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
 
@@ -0,0 +1,168 @@
+/* file: kmeans_predict.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the K-Means prediction algorithm
+//  in the batch processing mode
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_H__
+#define __KMEANS_PREDICT_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace prediction
+{
+namespace interface1
+{
+/**
+ * @defgroup kmeans_prediction_batch Batch
+ * @ingroup kmeans_prediction
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the K-Means prediction.
+ *        It is associated with the daal::algorithms::kmeans::prediction::Batch class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means prediction, double or float
+ * \tparam method           Computation method of the K-Means prediction, \ref daal::algorithms::kmeans::prediction::Method
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the K-Means prediction with a specified environment
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the K-Means prediction in the batch processing mode
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__BATCH"></a>
+ * \brief Assigns the observations to the nearest of the given centroids, for example computed by the K-Means algorithm.
+ *        Unlike kmeans::Batch with zero iterations, the algorithm neither recomputes the centroids nor computes the objective function.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the K-Means prediction, double or float
+ * \tparam method           Computation method of the K-Means prediction, \ref daal::algorithms::kmeans::prediction::Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Computation methods of the K-Means prediction
+ *      - \ref InputId  Identifiers of input objects of the K-Means prediction
+ *      - \ref ResultId Identifiers of results of the K-Means prediction
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    typedef algorithms::kmeans::prediction::Input InputType;
+    typedef algorithms::kmeans::prediction::Result ResultType;
+
+    InputType input; /*!< %Input data structure */
+
+    /** Default constructor */
+    Batch() { initialize(); }
+
+    /**
+     * Constructs the K-Means prediction algorithm by copying input objects of another K-Means prediction algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> & other) : input(other.input) { initialize(); }
+
+    ~Batch() DAAL_C11_OVERRIDE {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the results of the K-Means prediction
+     * \return Structure that contains the results of the K-Means prediction
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the results of the K-Means prediction
+     * \param[in] result Structure to store the results of the K-Means prediction
+     */
+    services::Status setResult(const ResultPtr & result)
+    {
+        DAAL_CHECK(result, services::ErrorNullResult)
+        _result = result;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means prediction algorithm
+     * with a copy of input objects of this K-Means prediction algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in                  = &input;
+        _result.reset(new ResultType());
+    }
+
+    ResultPtr _result;
+
+private:
+    Batch & operator=(const Batch &);
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace prediction
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,183 @@
+/* file: kmeans_predict_types.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of the types of the K-Means prediction algorithm that assigns
+//  the observations to the nearest trained centroids.
+//--
+*/
+
+#ifndef __KMEANS_PREDICT_TYPES_H__
+#define __KMEANS_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+/**
+ * @defgroup kmeans_prediction Prediction
+ * \copydoc daal::algorithms::kmeans::prediction
+ * @ingroup kmeans
+ * @{
+ */
+/**
+ * \brief Contains classes to assign the observations to the nearest centroids computed by the K-Means algorithm
+ */
+namespace prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__METHOD"></a>
+ * Available methods of the K-Means prediction
+ */
+enum Method
+{
+    defaultDense = 0, /*!< Default: distances to the centroids are computed block by block with matrix-matrix products */
+    fastCSR      = 1  /*!< Method for input data stored in the compressed sparse row (CSR) format */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__INPUTID"></a>
+ * Available identifiers of input objects of the K-Means prediction
+ */
+enum InputId
+{
+    data,           /*!< %Input data table */
+    inputCentroids, /*!< Trained centroids, one centroid per row */
+    lastInputId = inputCentroids
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__PREDICTION__RESULTID"></a>
+ * Available identifiers of results of the K-Means prediction
+ */
+enum ResultId
+{
+    assignments, /*!< Indices of the nearest centroids of the observations */
+    lastResultId = assignments
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__INPUT"></a>
+ * \brief %Input objects of the K-Means prediction
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    Input();
+    Input(const Input & other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object of the K-Means prediction
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets an input object of the K-Means prediction
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr & ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] par       Pointer to the parameters of the algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the results obtained with the compute() method of the K-Means prediction
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    virtual ~Result() {}
+
+    /**
+     * Allocates memory to store the results of the K-Means prediction
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const int method);
+
+    /**
+     * Returns the result of the K-Means prediction
+     * \param[in] id   Identifier of the result, \ref ResultId
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the K-Means prediction
+     * \param[in] id        Identifier of the result
+     * \param[in] value     Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in      Pointer to the %input objects
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Algorithm computation method
+     */
+    virtual services::Status check(const daal::algorithms::Input * in, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    using daal::algorithms::interface1::Result::check;
+
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+} // namespace interface1
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace prediction
+/** @} */
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,487 @@
+/* file: kmeans_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the K-Means algorithm in the SPMD processing mode
+//--
+*/
+
+#ifndef __KMEANS_SPMD_H__
+#define __KMEANS_SPMD_H__
+
+#include "algorithms/kmeans/kmeans_batch.h"
+#include "algorithms/kmeans/kmeans_distributed.h"
+#include "services/communicator.h"
+#include "services/iteration_pipeline.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+template <typename algorithmFPType>
+services::Status copyRows(data_management::NumericTable * table, size_t nRows, algorithmFPType * dst, bool toTable)
+{
+    using namespace data_management;
+    const size_t n = nRows * table->getNumberOfColumns();
+    BlockDescriptor<algorithmFPType> block;
+    services::Status s;
+    DAAL_CHECK_STATUS(s, table->getBlockOfRows(0, nRows, toTable ? writeOnly : readOnly, block));
+    algorithmFPType * values = block.getBlockPtr();
+    for (size_t i = 0; i < n; i++)
+    {
+        if (toTable)
+        {
+            values[i] = dst[i];
+        }
+        else
+        {
+            dst[i] = values[i];
+        }
+    }
+    return table->releaseBlockOfRows(block);
+}
+
+/**
+ * Reduces the partial sums over all the processes by sending the changes of the partial sums since the previous iteration.
+ * Only the rows of the clusters whose partial sums changed are sent when it is cheaper than the dense reduction,
+ * which is the case when few observations change their clusters. The changes are rounded to the transport precision
+ * before they are sent and the rounding error is kept for the next iteration, so that the reduced sums do not drift
+ */
+template <typename algorithmFPType>
+class SumsDeltaReducer
+{
+public:
+    SumsDeltaReducer() : _nClusters(0), _nFeatures(0) {}
+
+    services::Status reduce(services::CommunicatorIface & comm, data_management::NumericTable & sums,
+                            services::CommunicatorIface::TransportPrecision precision)
+    {
+        const size_t nClusters = sums.getNumberOfRows();
+        const size_t nFeatures = sums.getNumberOfColumns();
+        const size_t size      = nClusters * nFeatures;
+        if (nClusters != _nClusters || nFeatures != _nFeatures)
+        {
+            _nClusters = nClusters;
+            _nFeatures = nFeatures;
+            _sent.resize(size);
+            _reduced.resize(size);
+            _delta.resize(size);
+            DAAL_CHECK_MALLOC((_sent.data() && _reduced.data() && _delta.data()) || !size);
+            for (size_t i = 0; i < size; i++)
+            {
+                _sent[i]    = algorithmFPType(0);
+                _reduced[i] = algorithmFPType(0);
+            }
+        }
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(&sums, nClusters, _delta.data(), false));
+        for (size_t i = 0; i < size; i++)
+        {
+            _delta[i] -= _sent[i];
+        }
+        services::internal::roundValues<algorithmFPType>(_delta.data(), size, precision);
+
+        size_t nChanged = 0;
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            bool changed = false;
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                _sent[i * nFeatures + j] += _delta[i * nFeatures + j];
+                changed |= (_delta[i * nFeatures + j] != algorithmFPType(0));
+            }
+            nChanged += changed;
+        }
+
+        algorithmFPType maxChanged = algorithmFPType(nChanged);
+        DAAL_CHECK_STATUS(s, comm.allreduce(&maxChanged, 1, services::CommunicatorIface::max));
+        const size_t nRecords   = (size_t)maxChanged;
+        const size_t valueSize  = services::internal::transportValueSize<algorithmFPType>(precision);
+        const size_t recordSize = sizeof(unsigned int) + nFeatures * valueSize;
+
+        /* The ring allreduce sends about twice the buffer, the allgather sends the records of all the processes */
+        if (nRecords && nRecords * recordSize * comm.getSize() < 2 * size * valueSize)
+        {
+            DAAL_CHECK_STATUS(s, reduceSparse(comm, nRecords, recordSize, precision));
+        }
+        else if (nRecords)
+        {
+            DAAL_CHECK_STATUS(s, services::internal::allreduceBuffer<algorithmFPType>(comm, _delta.data(), size, services::CommunicatorIface::sum,
+                                                                                      precision));
+            for (size_t i = 0; i < size; i++)
+            {
+                _reduced[i] += _delta[i];
+            }
+        }
+        return copyRows<algorithmFPType>(&sums, nClusters, _reduced.data(), true);
+    }
+
+private:
+    services::Status reduceSparse(services::CommunicatorIface & comm, size_t nRecords, size_t recordSize,
+                                  services::CommunicatorIface::TransportPrecision precision)
+    {
+        const unsigned int noCluster = (unsigned int)-1;
+        const size_t nProcesses      = comm.getSize();
+        services::Collection<byte> records(nRecords * recordSize);
+        services::Collection<byte> allRecords(nRecords * recordSize * nProcesses);
+        services::Collection<algorithmFPType> row(_nFeatures);
+        DAAL_CHECK_MALLOC((records.data() && allRecords.data() && row.data()) || !nRecords);
+
+        size_t iRecord = 0;
+        for (size_t i = 0; i < _nClusters; i++)
+        {
+            const algorithmFPType * delta = _delta.data() + i * _nFeatures;
+            bool changed                  = false;
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                changed |= (delta[j] != algorithmFPType(0));
+            }
+            if (!changed) continue;
+
+            byte * record           = records.data() + iRecord * recordSize;
+            *(unsigned int *)record = (unsigned int)i;
+            services::internal::encodeValues<algorithmFPType>(delta, _nFeatures, precision, record + sizeof(unsigned int));
+            iRecord++;
+        }
+        for (; iRecord < nRecords; iRecord++)
+        {
+            *(unsigned int *)(records.data() + iRecord * recordSize) = noCluster;
+        }
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, comm.allgather(records.data(), nRecords * recordSize, allRecords.data()));
+
+        /* The records are added in the same order on every process, so the reduced sums are the same everywhere */
+        for (size_t i = 0; i < nRecords * nProcesses; i++)
+        {
+            const byte * record         = allRecords.data() + i * recordSize;
+            const unsigned int iCluster = *(const unsigned int *)record;
+            if (iCluster == noCluster) continue;
+
+            services::internal::decodeValues<algorithmFPType>(record + sizeof(unsigned int), _nFeatures, precision, row.data());
+            algorithmFPType * reduced = _reduced.data() + iCluster * _nFeatures;
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                reduced[j] += row[j];
+            }
+        }
+        return s;
+    }
+
+    size_t _nClusters;
+    size_t _nFeatures;
+    services::Collection<algorithmFPType> _sent;    /* Sum of the changes sent by the calling process */
+    services::Collection<algorithmFPType> _reduced; /* Sum of the changes sent by all the processes */
+    services::Collection<algorithmFPType> _delta;
+};
+
+/**
+ * Combines the partial results of all the processes into the collection of partial results of the step 2, the collection is the same
+ * on every process. The numbers of observations, the sums and the objective function are reduced into the first partial result,
+ * the candidates for the empty clusters of every process are gathered into the partial results with zero sums
+ */
+/* One iteration of the Lloyd method in the SPMD processing mode: the sums and the candidates are reduced by the non-blocking
+ * collectives while the step2Master algorithm and the partial results of the other processes are allocated */
+template <typename algorithmFPType, Method method>
+class LloydIteration : public services::PipelinedIterationIface
+{
+public:
+    LloydIteration(const Parameter & parameter, const data_management::NumericTablePtr & data, const data_management::NumericTablePtr & centroids,
+                   services::CommunicatorIface::TransportPrecision precision, bool sparseSumsDelta)
+        : _parameter(parameter), _data(data), _centroids(centroids), _precision(precision), _sparseSumsDelta(sparseSumsDelta), _prevObjective(0), _nProcesses(0), _rank(0)
+    {}
+
+    services::Status computeLocal(size_t /*iteration*/) DAAL_C11_OVERRIDE
+    {
+        _local.reset(new Distributed<step1Local, algorithmFPType, method>(_parameter.nClusters, false));
+        DAAL_CHECK_MALLOC(_local);
+        _local->parameter.distanceType = _parameter.distanceType;
+        _local->parameter.gamma        = _parameter.gamma;
+        _local->input.set(data, _data);
+        _local->input.set(inputCentroids, _centroids);
+        return _local->compute();
+    }
+
+    services::Status postReduction(services::CommunicatorIface & comm, size_t /*iteration*/,
+                                   services::Collection<services::RequestIfacePtr> & requests) DAAL_C11_OVERRIDE
+    {
+        using namespace data_management;
+        PartialResult & pres   = *_local->getPartialResult();
+        const size_t nClusters = _parameter.nClusters;
+        const size_t nFeatures = pres.get(partialSums)->getNumberOfColumns();
+        _nProcesses            = comm.getSize();
+        _rank                  = comm.getRank();
+
+        const size_t candidatesSize = nClusters * (nFeatures + 1);
+        _candidates.resize(candidatesSize);
+        _allCandidates.resize(candidatesSize * _nProcesses);
+        _counts.resize(nClusters + 1);
+        DAAL_CHECK_MALLOC(_candidates.data() && _allCandidates.data() && _counts.data());
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(partialCandidatesDistances).get(), nClusters, _candidates.data(), false));
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(partialCandidatesCentroids).get(), nClusters, _candidates.data() + nClusters, false));
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(nObservations).get(), nClusters, _counts.data(), false));
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(partialObjectiveFunction).get(), 1, _counts.data() + nClusters, false));
+
+        requests.push_back(
+            comm.iallgather((const byte *)_candidates.data(), candidatesSize * sizeof(algorithmFPType), (byte *)_allCandidates.data()));
+        /* The numbers of observations may exceed the range of the half precision, they are always sent in the full precision */
+        requests.push_back(comm.iallreduce(_counts.data(), nClusters + 1, services::CommunicatorIface::sum));
+
+        /* The reduced precision and the sparse changes are encoded and decoded around the blocking collectives */
+        NumericTable * sumsTable = pres.get(partialSums).get();
+        if (_sparseSumsDelta)
+        {
+            return _sumsReducer.reduce(comm, *sumsTable, _precision);
+        }
+        if (_precision != services::CommunicatorIface::fullPrecision)
+        {
+            return services::internal::allreduceTables<algorithmFPType>(comm, &sumsTable, 1, services::CommunicatorIface::sum, _precision);
+        }
+        _sums.resize(nClusters * nFeatures);
+        DAAL_CHECK_MALLOC(_sums.data() || !nFeatures);
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(sumsTable, nClusters, _sums.data(), false));
+        requests.push_back(comm.iallreduce(_sums.data(), nClusters * nFeatures, services::CommunicatorIface::sum));
+        return s;
+    }
+
+    services::Status overlap(size_t /*iteration*/) DAAL_C11_OVERRIDE
+    {
+        using namespace data_management;
+        PartialResult & pres   = *_local->getPartialResult();
+        const size_t nClusters = _parameter.nClusters;
+        const size_t nFeatures = pres.get(partialSums)->getNumberOfColumns();
+
+        _master.reset(new Distributed<step2Master, algorithmFPType, method>(nClusters));
+        DAAL_CHECK_MALLOC(_master);
+
+        /* The reduced values are added to the partial result of the calling process, the others contribute the candidates only */
+        services::Status s;
+        _merged.clear();
+        for (size_t i = 0; i < _nProcesses; i++)
+        {
+            PartialResultPtr part(new PartialResult());
+            DAAL_CHECK_MALLOC(part);
+            if (i == _rank)
+            {
+                part->set(nObservations, pres.get(nObservations));
+                part->set(partialSums, pres.get(partialSums));
+                part->set(partialObjectiveFunction, pres.get(partialObjectiveFunction));
+                part->set(partialCandidatesDistances, pres.get(partialCandidatesDistances));
+                part->set(partialCandidatesCentroids, pres.get(partialCandidatesCentroids));
+            }
+            else
+            {
+                part->set(nObservations,
+                          HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, algorithmFPType(0), &s));
+                DAAL_CHECK_STATUS_VAR(s);
+                part->set(partialSums,
+                          HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, algorithmFPType(0), &s));
+                DAAL_CHECK_STATUS_VAR(s);
+                part->set(partialObjectiveFunction,
+                          HomogenNumericTable<algorithmFPType>::create(1, 1, NumericTable::doAllocate, algorithmFPType(0), &s));
+                DAAL_CHECK_STATUS_VAR(s);
+                part->set(partialCandidatesDistances, HomogenNumericTable<algorithmFPType>::create(1, nClusters, NumericTable::doAllocate, &s));
+                DAAL_CHECK_STATUS_VAR(s);
+                part->set(partialCandidatesCentroids,
+                          HomogenNumericTable<algorithmFPType>::create(nFeatures, nClusters, NumericTable::doAllocate, &s));
+                DAAL_CHECK_STATUS_VAR(s);
+            }
+            _merged.push_back(part);
+        }
+        return s;
+    }
+
+    services::Status finalize(size_t iteration, bool & converged) DAAL_C11_OVERRIDE
+    {
+        using namespace data_management;
+        PartialResult & pres        = *_local->getPartialResult();
+        const size_t nClusters      = _parameter.nClusters;
+        const size_t candidatesSize = _candidates.size();
+
+        services::Status s;
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(nObservations).get(), nClusters, _counts.data(), true));
+        DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(partialObjectiveFunction).get(), 1, _counts.data() + nClusters, true));
+        if (!_sparseSumsDelta && _precision == services::CommunicatorIface::fullPrecision)
+        {
+            DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(pres.get(partialSums).get(), nClusters, _sums.data(), true));
+        }
+        for (size_t i = 0; i < _nProcesses; i++)
+        {
+            if (i == _rank) continue;
+            algorithmFPType * processCandidates = _allCandidates.data() + i * candidatesSize;
+            DAAL_CHECK_STATUS(s, copyRows<algorithmFPType>(_merged[i]->get(partialCandidatesDistances).get(), nClusters, processCandidates, true));
+            DAAL_CHECK_STATUS(
+                s, copyRows<algorithmFPType>(_merged[i]->get(partialCandidatesCentroids).get(), nClusters, processCandidates + nClusters, true));
+        }
+
+        for (size_t i = 0; i < _merged.size(); i++)
+        {
+            _master->input.add(partialResults, _merged[i]);
+        }
+        DAAL_CHECK_STATUS(s, _master->compute());
+        DAAL_CHECK_STATUS(s, _master->finalizeCompute());
+
+        _centroids = _master->getResult()->get(centroids);
+        _objective = _master->getResult()->get(objectiveFunction);
+
+        BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(s, _objective->getBlockOfRows(0, 1, readOnly, block));
+        const algorithmFPType newObjective = block.getBlockPtr()[0];
+        DAAL_CHECK_STATUS(s, _objective->releaseBlockOfRows(block));
+
+        const algorithmFPType change = newObjective - _prevObjective;
+        _prevObjective               = newObjective;
+        converged                    = (iteration > 0 && (change < 0 ? -change : change) < _parameter.accuracyThreshold);
+        return s;
+    }
+
+    const data_management::NumericTablePtr & getCentroids() const { return _centroids; }
+    const data_management::NumericTablePtr & getObjective() const { return _objective; }
+
+private:
+    const Parameter & _parameter;
+    data_management::NumericTablePtr _data;
+    data_management::NumericTablePtr _centroids;
+    data_management::NumericTablePtr _objective;
+    services::CommunicatorIface::TransportPrecision _precision;
+    bool _sparseSumsDelta;
+    algorithmFPType _prevObjective;
+    size_t _nProcesses;
+    size_t _rank;
+
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > _local;
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > _master;
+    services::Collection<PartialResultPtr> _merged;
+    SumsDeltaReducer<algorithmFPType> _sumsReducer;
+    services::Collection<algorithmFPType> _candidates;
+    services::Collection<algorithmFPType> _allCandidates;
+    services::Collection<algorithmFPType> _counts; /* Numbers of observations followed by the objective function */
+    services::Collection<algorithmFPType> _sums;
+};
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @defgroup kmeans_spmd SPMD
+ * @ingroup kmeans_compute
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__SPMD"></a>
+ * \brief Computes the results of the K-Means algorithm in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data and the same initial centroids.
+ *        At each iteration the partial results are combined by the collective operations of the communicator,
+ *        so that the centroids are updated on every process and no process gathers the partial results of the others.
+ *        The iterations are run by services::IterationPipeline, the master step of an iteration is prepared while its reduction is in flight.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = lloydDense>
+class Spmd
+{
+public:
+    typedef algorithms::kmeans::Input InputType;
+    typedef algorithms::kmeans::Parameter ParameterType;
+    typedef algorithms::kmeans::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm         Communicator of the processes
+     * \param[in] nClusters    Number of clusters
+     * \param[in] nIterations  Number of iterations
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm, size_t nClusters, size_t nIterations = 1)
+        : parameter(nClusters, nIterations), transportPrecision(services::CommunicatorIface::fullPrecision), sparseSumsDelta(false), _comm(comm)
+    {}
+
+    /**
+     * Runs the iterations of the algorithm on the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        using namespace data_management;
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+
+        services::Status s;
+        internal::LloydIteration<algorithmFPType, method> iteration(parameter, input.get(data), input.get(inputCentroids), transportPrecision,
+                                                                    sparseSumsDelta);
+        services::IterationPipeline pipeline(_comm);
+        DAAL_CHECK_STATUS(s, pipeline.run(iteration, parameter.maxIterations));
+        NumericTablePtr centroidsTable = iteration.getCentroids();
+        NumericTablePtr objective      = iteration.getObjective();
+        const size_t it                = pipeline.getNumberOfIterations();
+
+        _result = ResultPtr(new ResultType());
+        DAAL_CHECK_MALLOC(_result);
+        _result->set(centroids, centroidsTable);
+        _result->set(objectiveFunction, objective);
+        _result->set(nIterations, HomogenNumericTable<int>::create(1, 1, NumericTable::doAllocate, (int)it, &s));
+        DAAL_CHECK_STATUS_VAR(s);
+
+        if (parameter.assignFlag)
+        {
+            Batch<algorithmFPType, method> assign(parameter.nClusters, 0);
+            assign.parameter.distanceType = parameter.distanceType;
+            assign.parameter.gamma        = parameter.gamma;
+            assign.input.set(data, input.get(data));
+            assign.input.set(inputCentroids, centroidsTable);
+            DAAL_CHECK_STATUS(s, assign.compute());
+            _result->set(assignments, assign.getResult()->get(assignments));
+        }
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the centroids, the objective function, the number of iterations
+     * and the assignments of the local block of data if parameter.assignFlag is set
+     * \return Structure that contains the results of the K-Means algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter structure */
+
+    /** Precision of the partial sums sent at each iteration, the numbers of observations are always sent in the full precision */
+    services::CommunicatorIface::TransportPrecision transportPrecision;
+
+    /** If true, only the changes of the partial sums since the previous iteration are sent, as the rows of the changed clusters
+     *  when it needs less data than the dense reduction */
+    bool sparseSumsDelta;
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace kmeans
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -48,9 +48,10 @@ namespace kmeans
  */
 enum Method
 {
-    lloydDense   = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
-    defaultDense = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR     = 1  /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydDense     = 0, /*!< Default: performance-oriented method, synonym of defaultDense */
+    defaultDense   = 0, /*!< Default: performance-oriented method, synonym of lloydDense */
+    lloydCSR       = 1, /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    miniBatchDense = 2  /*!< Mini-batch algorithm for the online processing mode */
 };
 
 /**
@@ -63,6 +64,17 @@ enum DistanceType
     lastDistanceType = euclidean
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__DATASTORAGETYPE"></a>
+ * Precision in which the GPU implementation stores the data for the computation of distances
+ */
+enum DataStorageType
+{
+    fullPrecisionStorage = 0, /*!< Default: the data is used in the precision of the algorithm */
+    bfloat16Storage      = 1, /*!< The data and centroids are packed to bfloat16, the distances are accumulated in single precision */
+    float16Storage       = 2  /*!< The data and centroids are packed to IEEE half precision, the distances are accumulated in single precision */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__KMEANS__INPUTID"></a>
  * \brief Available identifiers of input objects for K-Means algorithm
@@ -124,6 +136,7 @@ namespace interface1
  * \brief Parameters for K-Means algorithm
  * \par Enumerations
  *      - \ref DistanceType Methods for distance computation
+ *      - \ref DataStorageType Precision of the data used for the distances on GPU
  *
  * \snippet kmeans/kmeans_types.h Parameter source code
  */
@@ -143,12 +156,14 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      */
     Parameter(const Parameter & other);
 
-    size_t nClusters;          /*!< Number of clusters */
-    size_t maxIterations;      /*!< Number of iterations */
-    double accuracyThreshold;  /*!< Threshold for the termination of the algorithm */
-    double gamma;              /*!< Weight used in distance computation for categorical features */
-    DistanceType distanceType; /*!< Distance used in the algorithm */
-    bool assignFlag;           /*!< Do data points assignment */
+    size_t nClusters;                /*!< Number of clusters */
+    size_t maxIterations;            /*!< Number of iterations */
+    double accuracyThreshold;        /*!< Threshold for the termination of the algorithm */
+    double gamma;                    /*!< Weight used in distance computation for categorical features */
+    DistanceType distanceType;       /*!< Distance used in the algorithm */
+    bool assignFlag;                 /*!< Do data points assignment */
+    DataStorageType dataStorageType; /*!< Precision of the data used for the distances on GPU, the distances to the assigned centroids
+                                          are recomputed in the precision of the algorithm */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -225,6 +240,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
 
+    /**
+     * Initializes partial results of K-Means algorithm in the online processing mode
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status initialize(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
     /**
      * Returns a partial result of K-Means algorithm
      * \param[in] id   Identifier of the partial result
@@ -120,6 +120,16 @@ enum OptionalResultNumericTableId
     lastResultNumericTableId = gramMatrixId
 };
 
+/**
+* <a name="DAAL-ENUM-ALGORITHMS__LASSO_REGRESSION__TRAINING__RESULT_MODEL_COLLECTION_ID"></a>
+* Available identifiers of the collections of models obtained in the training stage of the regression algorithm
+*/
+enum OptionalResultModelCollectionId
+{
+    pathModels                          = lastResultNumericTableId + 1, /*!< Models trained for the penalties of the regularization path */
+    lastOptionalResultModelCollectionId = pathModels
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LASSO_REGRESSION__TRAINING__RESULTID"></a>
  * \brief Available identifiers for input data corruption
@@ -148,6 +158,7 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
     Parameter(const Parameter & o)
         : linear_model::Parameter(o),
           lassoParameters(o.lassoParameters),
+          lassoParametersPath(o.lassoParametersPath),
           optimizationSolver(o.optimizationSolver),
           dataUseInComputation(o.dataUseInComputation),
           optResultToCompute(o.optResultToCompute)
@@ -156,6 +167,9 @@ struct DAAL_EXPORT Parameter : public linear_model::Parameter
     services::Status check() const DAAL_C11_OVERRIDE;
 
     data_management::NumericTablePtr lassoParameters; /*!< Numeric table that contains values of lasso parameters */
+    data_management::NumericTablePtr lassoParametersPath; /*!< Numeric table of size nPath x (1 or nDependentVariables) with lasso parameters
+                                                               of the regularization path. If it is set, a model is trained for every row
+                                                               and the previous model is used as a warm start */
 
     SolverPtr optimizationSolver; /*!< Default is coordinate descent solver */
 
@@ -302,6 +316,20 @@ public:
     */
     void set(OptionalResultNumericTableId id, const data_management::NumericTablePtr & value);
 
+    /**
+    * Returns the collection of models of the regularization path
+    * \param[in] id    Identifier of the result
+    * \return          Collection of models that corresponds to the given identifier
+    */
+    data_management::DataCollectionPtr get(OptionalResultModelCollectionId id) const;
+
+    /**
+    * Sets the collection of models of the regularization path
+    * \param[in] id      Identifier of the result
+    * \param[in] value   Collection of models
+    */
+    void set(OptionalResultModelCollectionId id, const data_management::DataCollectionPtr & value);
+
     /**
      * Allocates memory to store the result of lasso regression model-based training
      * \param[in] input Pointer to an object containing the input data
@@ -25,6 +25,7 @@
 #define __LINEAR_MODEL_PREDICT_TYPES_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
 #include "algorithms/algorithm_types.h"
 #include "algorithms/linear_model/linear_model_model.h"
 #include "algorithms/regression/regression_predict_types.h"
@@ -75,6 +76,18 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__MODELCOLLECTIONINPUTID"></a>
+ * \brief Available identifiers of input collections of models for making the prediction with several models at once
+ */
+enum ModelCollectionInputId
+{
+    models                     = lastModelInputId + 1, /*!< Collection of trained linear models with the same number of features.
+                                                            If it is set, the model input is not used, the coefficients of all models
+                                                            are stacked and the data is read once */
+    lastModelCollectionInputId = models
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making the regression model-based prediction
@@ -85,11 +98,44 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_MODEL__PREDICTION__RESULTCOLLECTIONID"></a>
+ * \brief Available identifiers of the collections of results for making the prediction with several models at once
+ */
+enum ResultCollectionId
+{
+    predictions            = lastResultId + 1, /*!< Collection of the tables of size n x k_i with the predictions of the i-th model
+                                                    of the input collection of models */
+    lastResultCollectionId = predictions
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__LINEAR_MODEL__PREDICTION__PARAMETER"></a>
+ * \brief Parameters for making the regression model-based prediction
+ *
+ * \snippet linear_model/linear_model_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     * Constructs parameters for making the regression model-based prediction
+     * \param[in] precision  Precision of the products of the data and the regression coefficients, \ref InferencePrecision
+     */
+    Parameter(InferencePrecision precision = fullPrecision);
+
+    InferencePrecision inferencePrecision; /*!< Precision of the products of the data and the regression coefficients on CPU,
+                                                the intercept term is added in the precision of the algorithm */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_MODEL__PREDICTION__INPUT"></a>
  * \brief Provides an interface for input objects for making the regression model-based prediction
@@ -129,6 +175,20 @@ public:
      */
     void set(ModelInputId id, const linear_model::ModelPtr & value);
 
+    /**
+     * Returns the collection of models for making the prediction with several models at once
+     * \param[in] id    Identifier of the input object
+     * \return          Collection of models that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ModelCollectionInputId id) const;
+
+    /**
+     * Sets the collection of models for making the prediction with several models at once
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Collection of linear_model::Model objects
+     */
+    void set(ModelCollectionInputId id, const data_management::DataCollectionPtr & value);
+
     /**
      * Checks an input object for making the regression model-based prediction
      *
@@ -161,6 +221,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns the collection of results of the prediction with several models at once
+     * \param[in] id    Identifier of the result
+     * \return          Collection of results that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultCollectionId id) const;
+
+    /**
+     * Sets the collection of results of the prediction with several models at once
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Collection of numeric tables
+     */
+    void set(ResultCollectionId id, const data_management::DataCollectionPtr & value);
+
     /**
      * Allocates memory to store a partial result of the regression model-based prediction
      * \param[in] input   %Input object
@@ -195,6 +269,7 @@ protected:
 typedef services::SharedPtr<Result> ResultPtr;
 typedef services::SharedPtr<const Result> ResultConstPtr;
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 using interface1::ResultPtr;
@@ -89,10 +89,11 @@ class Batch<algorithmFPType, defaultDense> : public linear_model::prediction::Ba
 {
 public:
     typedef algorithms::linear_regression::prediction::Input InputType;
-    typedef algorithms::linear_regression::Parameter ParameterType;
+    typedef algorithms::linear_model::prediction::Parameter ParameterType;
     typedef algorithms::linear_regression::prediction::Result ResultType;
 
-    InputType input; /*!< %Input data structure */
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameters of the prediction */
 
     /** Default constructor */
     Batch() { initialize(); }
@@ -103,7 +104,7 @@ public:
      * \param[in] other Algorithm to use as the source to initialize the input objects
      *                  of the algorithm
      */
-    Batch(const Batch<algorithmFPType, defaultDense> & other) : input(other.input) { initialize(); }
+    Batch(const Batch<algorithmFPType, defaultDense> & other) : input(other.input), parameter(other.parameter) { initialize(); }
 
     /**
      * Returns the method of the algorithm
@@ -134,7 +135,7 @@ protected:
 
     services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = getResult()->template allocate<algorithmFPType>(this->_in, 0, 0);
+        services::Status s = getResult()->template allocate<algorithmFPType>(this->_in, &parameter, 0);
         this->_res         = this->_result.get();
         return s;
     }
@@ -144,7 +145,7 @@ protected:
         this->_ac  = new __DAAL_ALGORITHM_CONTAINER(batch, linear_model::prediction::BatchContainer, algorithmFPType,
                                                    linear_model::prediction::defaultDense)(&(this->_env));
         this->_in  = &input;
-        this->_par = NULL;
+        this->_par = &parameter;
         this->_result.reset(new ResultType());
     }
 
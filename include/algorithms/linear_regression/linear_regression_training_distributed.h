@@ -305,7 +305,10 @@ protected:
         return s;
     }
 
-    services::Status initializePartialResult() DAAL_C11_OVERRIDE { return services::Status(); }
+    services::Status initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        return _partialResult->initialize<algorithmFPType>(&input, &parameter, method);
+    }
 
     void initialize()
     {
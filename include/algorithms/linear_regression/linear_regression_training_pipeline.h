@@ -0,0 +1,98 @@
+/* file: linear_regression_training_pipeline.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for linear regression model-based training
+//  in the online processing mode on the data retrieved from a data source
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_TRAINING_PIPELINE_H__
+#define __LINEAR_REGRESSION_TRAINING_PIPELINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data_source/data_source.h"
+#include "algorithms/linear_model/linear_model_training_online.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @addtogroup linear_regression_online
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__TRAINING__ONLINEPIPELINE"></a>
+ * \brief Updates the partial result of the linear regression online training algorithm with all blocks of the data source.
+ *        The next block is loaded from the data source while the previous block is processed by the algorithm,
+ *        so that the input and the computations overlap. Two blocks of the data are stored at a time.
+ *
+ * \par References
+ *      - \ref linear_regression::training::interface1::Online "linear_regression::training::Online" class
+ */
+class DAAL_EXPORT OnlinePipeline
+{
+public:
+    /**
+     * Constructs the pipeline
+     * \param[in] nFeatures           Number of features, the first nFeatures columns of the data source
+     * \param[in] nDependentVariables Number of dependent variables, the columns of the data source that follow the features
+     * \param[in] nRowsInBlock        Maximal number of rows of the block loaded from the data source
+     */
+    OnlinePipeline(size_t nFeatures, size_t nDependentVariables, size_t nRowsInBlock = 16384)
+        : _nFeatures(nFeatures), _nDependentVariables(nDependentVariables), _nRowsInBlock(nRowsInBlock), _nProcessedRows(0)
+    {}
+
+    /**
+     * Loads the blocks from the data source until it is exhausted and updates the algorithm with them.
+     * The algorithm is not finalized.
+     * \param[in] algorithm  Linear regression training algorithm in the online processing mode
+     * \param[in] dataSource Data source to retrieve the training data and the dependent variables from
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status compute(linear_model::training::Online & algorithm, data_management::DataSource & dataSource);
+
+    /**
+     * Returns the number of rows processed by the last call of compute()
+     * \return Number of processed rows
+     */
+    size_t getNumberOfProcessedRows() const { return _nProcessedRows; }
+
+protected:
+    size_t _nFeatures;
+    size_t _nDependentVariables;
+    size_t _nRowsInBlock;
+    size_t _nProcessedRows;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlinePipeline;
+
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
+#endif
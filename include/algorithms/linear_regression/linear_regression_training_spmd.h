@@ -0,0 +1,125 @@
+/* file: linear_regression_training_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for linear regression model-based training
+//  in the SPMD processing mode
+//--
+*/
+
+#ifndef __LINEAR_REGRESSION_TRAINING_SPMD_H__
+#define __LINEAR_REGRESSION_TRAINING_SPMD_H__
+
+#include "algorithms/linear_regression/linear_regression_training_distributed.h"
+#include "algorithms/linear_regression/linear_regression_ne_model.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace linear_regression
+{
+namespace training
+{
+namespace interface1
+{
+/**
+ * @defgroup linear_regression_spmd SPMD
+ * @ingroup linear_regression_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LINEAR_REGRESSION__TRAINING__SPMD"></a>
+ * \brief Performs linear regression model-based training in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data, the cross-products of the partial models
+ *        are summed by the collective operations of the communicator and the model is available on every process.
+ *        Only the normal equations method is supported, the partial models of the QR method are not additive.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for linear regression model-based training, double or float
+ * \tparam method           Linear regression training method, \ref Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = normEqDense>
+class Spmd
+{
+public:
+    typedef algorithms::linear_regression::training::Input InputType;
+    typedef algorithms::linear_regression::Parameter ParameterType;
+    typedef algorithms::linear_regression::training::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm  Communicator of the processes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm) : _comm(comm) {}
+
+    /**
+     * Trains the model on the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+        DAAL_CHECK(method == normEqDense, services::ErrorMethodNotSupported);
+
+        services::Status s;
+        Distributed<step1Local, algorithmFPType, method> local;
+        local.parameter = parameter;
+        local.input.set(data, input.get(data));
+        local.input.set(dependentVariables, input.get(dependentVariables));
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        PartialResultPtr pres = local.getPartialResult();
+        ModelNormEq * model   = dynamic_cast<ModelNormEq *>(pres->get(training::partialModel).get());
+        DAAL_CHECK(model, services::ErrorIncorrectTypeOfModel);
+
+        data_management::NumericTable * tables[2] = { model->getXTXTable().get(), model->getXTYTable().get() };
+        DAAL_CHECK_STATUS(s, services::internal::allreduceTables<algorithmFPType>(*_comm, tables, 2, services::CommunicatorIface::sum));
+
+        Distributed<step2Master, algorithmFPType, method> master;
+        master.parameter = parameter;
+        master.input.add(partialModels, pres);
+        DAAL_CHECK_STATUS(s, master.compute());
+        DAAL_CHECK_STATUS(s, master.finalizeCompute());
+
+        _result = master.getResult();
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the result of linear regression model-based training
+     * \return Structure that contains the trained model
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training \ref interface1::Parameter "parameters" */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace training
+} // namespace linear_regression
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -71,6 +71,21 @@ enum InputId
     lastInputId        = dependentVariables
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__CROSSPRODUCTINPUTID"></a>
+ * \brief Available identifiers of optional input objects with the cross-products precomputed for linear regression model-based training
+ *        in the batch processing mode, for example, by the online or distributed training. If they are set, the algorithm
+ *        solves the normal equations without reading the input data
+ */
+enum CrossProductInputId
+{
+    xtx                     = lastInputId + 1, /*!< Numeric table of size p' x p' with the cross-product X'X in the layout of
+                                                    ModelNormEq::getXTXTable(), p' = p + 1 if the intercept is computed and p otherwise */
+    xty                     = lastInputId + 2, /*!< Numeric table of size k x p' with the cross-product X'Y in the layout of
+                                                    ModelNormEq::getXTYTable() */
+    lastCrossProductInputId = xty
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LINEAR_REGRESSION__TRAINING__MASTER_INPUT_ID"></a>
  * \brief Available identifiers of input objects for linear regression model-based training
@@ -156,6 +171,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns a cross-product precomputed for linear regression model-based training
+     * \param[in] id    Identifier of the cross-product
+     * \return          Cross-product that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(CrossProductInputId id) const;
+
+    /**
+     * Sets a cross-product precomputed for linear regression model-based training
+     * \param[in] id      Identifier of the cross-product
+     * \param[in] value   Pointer to the cross-product
+     */
+    void set(CrossProductInputId id, const data_management::NumericTablePtr & value);
+
     /**
      * Returns the number of columns in the input data set
      * \return Number of columns in the input data set
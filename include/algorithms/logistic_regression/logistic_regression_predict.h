@@ -250,7 +250,7 @@ public:
     typedef classifier::prediction::Batch super;
 
     typedef algorithms::logistic_regression::prediction::Input InputType;
-    typedef algorithms::classifier::Parameter ParameterType;
+    typedef algorithms::logistic_regression::prediction::interface2::Parameter ParameterType;
     typedef algorithms::classifier::prediction::Result ResultType;
 
     /**
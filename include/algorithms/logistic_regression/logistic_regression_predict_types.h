@@ -230,8 +230,39 @@ typedef services::SharedPtr<Result> ResultPtr;
 typedef services::SharedPtr<const Result> ResultConstPtr;
 
 } // namespace interface1
+
+/**
+ * \brief Contains version 2.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface2
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__LOGISTIC_REGRESSION__PREDICTION__PARAMETER"></a>
+ * \brief Parameters of the logistic regression prediction algorithm
+ *
+ * \snippet logistic_regression/logistic_regression_predict_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    /**
+     * Constructs parameters of the logistic regression prediction algorithm
+     * \param[in] nClasses   Number of classes
+     * \param[in] precision  Precision of the products of the data and the coefficients, \ref InferencePrecision
+     */
+    Parameter(size_t nClasses = 2, InferencePrecision precision = fullPrecision);
+    Parameter(const Parameter & o);
+
+    InferencePrecision inferencePrecision; /*!< Precision of the products of the data and the coefficients on CPU,
+                                                the intercept terms are added in the precision of the algorithm */
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+} // namespace interface2
+
 using interface1::Input;
-using classifier::Parameter;             /* Support of static backward compatibility */
+using interface2::Parameter;
 using classifier::prediction::Result;    /* Support of static backward compatibility */
 using classifier::prediction::ResultPtr; /* Support of static backward compatibility */
 } // namespace prediction
@@ -0,0 +1,175 @@
+/* file: low_order_moments_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the low order moments algorithm in the SPMD processing mode
+//--
+*/
+
+#ifndef __LOW_ORDER_MOMENTS_SPMD_H__
+#define __LOW_ORDER_MOMENTS_SPMD_H__
+
+#include "algorithms/moments/low_order_moments_online.h"
+#include "algorithms/moments/low_order_moments_distributed.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace low_order_moments
+{
+namespace internal
+{
+/**
+ * Combines the partial results of all the processes, the combined partial result is stored on every process.
+ * The sums of squared differences from the means are shifted to the global means before the reduction
+ */
+template <typename algorithmFPType>
+services::Status allreducePartialResult(services::CommunicatorIface & comm, PartialResult & pres)
+{
+    using namespace data_management;
+    NumericTable * nObsTable     = pres.get(nObservations).get();
+    NumericTable * sumTable      = pres.get(partialSum).get();
+    NumericTable * centeredTable = pres.get(partialSumSquaresCentered).get();
+    NumericTable * minTables[1]  = { pres.get(partialMinimum).get() };
+    NumericTable * maxTables[1]  = { pres.get(partialMaximum).get() };
+    NumericTable * sumTables[3]  = { nObsTable, sumTable, pres.get(partialSumSquares).get() };
+    const size_t nFeatures       = sumTable->getNumberOfColumns();
+
+    services::Status s;
+    BlockDescriptor<algorithmFPType> nObsBlock, sumBlock, centeredBlock;
+    DAAL_CHECK_STATUS(s, nObsTable->getBlockOfRows(0, 1, readOnly, nObsBlock));
+    const algorithmFPType nLocal = nObsBlock.getBlockPtr()[0];
+    DAAL_CHECK_STATUS(s, nObsTable->releaseBlockOfRows(nObsBlock));
+
+    services::Collection<algorithmFPType> localMean(nFeatures);
+    DAAL_CHECK_MALLOC(localMean.data());
+    DAAL_CHECK_STATUS(s, sumTable->getBlockOfRows(0, 1, readOnly, sumBlock));
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        localMean[j] = (nLocal > 0) ? sumBlock.getBlockPtr()[j] / nLocal : algorithmFPType(0);
+    }
+    DAAL_CHECK_STATUS(s, sumTable->releaseBlockOfRows(sumBlock));
+
+    DAAL_CHECK_STATUS(s, services::internal::allreduceTables<algorithmFPType>(comm, minTables, 1, services::CommunicatorIface::min));
+    DAAL_CHECK_STATUS(s, services::internal::allreduceTables<algorithmFPType>(comm, maxTables, 1, services::CommunicatorIface::max));
+    DAAL_CHECK_STATUS(s, services::internal::allreduceTables<algorithmFPType>(comm, sumTables, 3, services::CommunicatorIface::sum));
+
+    DAAL_CHECK_STATUS(s, nObsTable->getBlockOfRows(0, 1, readOnly, nObsBlock));
+    const algorithmFPType nTotal = nObsBlock.getBlockPtr()[0];
+    DAAL_CHECK_STATUS(s, nObsTable->releaseBlockOfRows(nObsBlock));
+
+    /* S += nLocal * (localMean - mean)^2 */
+    DAAL_CHECK_STATUS(s, sumTable->getBlockOfRows(0, 1, readOnly, sumBlock));
+    DAAL_CHECK_STATUS(s, centeredTable->getBlockOfRows(0, 1, readWrite, centeredBlock));
+    algorithmFPType * centered = centeredBlock.getBlockPtr();
+    if (nLocal > 0)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType diff = localMean[j] - sumBlock.getBlockPtr()[j] / nTotal;
+            centered[j] += nLocal * diff * diff;
+        }
+    }
+    DAAL_CHECK_STATUS(s, centeredTable->releaseBlockOfRows(centeredBlock));
+    DAAL_CHECK_STATUS(s, sumTable->releaseBlockOfRows(sumBlock));
+
+    NumericTable * centeredTables[1] = { centeredTable };
+    return services::internal::allreduceTables<algorithmFPType>(comm, centeredTables, 1, services::CommunicatorIface::sum);
+}
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * @defgroup low_order_moments_spmd SPMD
+ * @ingroup low_order_moments
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__LOW_ORDER_MOMENTS__SPMD"></a>
+ * \brief Computes moments of low order in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data, the partial results are combined
+ *        by the collective operations of the communicator and the whole result is available on every process.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the low order moments, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::low_order_moments::Method
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class Spmd
+{
+public:
+    typedef algorithms::low_order_moments::Input InputType;
+    typedef algorithms::low_order_moments::Parameter ParameterType;
+    typedef algorithms::low_order_moments::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm  Communicator of the processes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm) : _comm(comm) {}
+
+    /**
+     * Computes the result from the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+
+        services::Status s;
+        Distributed<step1Local, algorithmFPType, method> local;
+        local.parameter = parameter;
+        local.input.set(data, input.get(data));
+        DAAL_CHECK_STATUS(s, local.compute());
+
+        PartialResultPtr pres = local.getPartialResult();
+        DAAL_CHECK_STATUS(s, internal::allreducePartialResult<algorithmFPType>(*_comm, *pres));
+
+        Distributed<step2Master, algorithmFPType, method> master;
+        master.parameter = parameter;
+        master.input.add(partialResults, pres);
+        DAAL_CHECK_STATUS(s, master.compute());
+        DAAL_CHECK_STATUS(s, master.finalizeCompute());
+
+        _result = master.getResult();
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the computed moments
+     * \return Structure that contains the computed moments
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter structure */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace low_order_moments
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -270,6 +270,14 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Parameter(EstimatesToCompute _estimatesToCompute = estimatesAll);
 
     EstimatesToCompute estimatesToCompute; /*!< Estimates to be computed by the algorithm  */
+    double forgettingFactor;               /*!< Factor in (0, 1] the weights of the observations processed so far are multiplied by
+                                                with each new observation in the online processing mode. The value 1 (default) keeps
+                                                the statistics over all the data, smaller values make them follow the most recent data with
+                                                the effective number of observations about 1 / (1 - forgettingFactor). The minimum and
+                                                the maximum are not weighted and still cover all the data */
+    data_management::NumericTablePtr featureIndices; /*!< Optional numeric table of size 1 x k with the indices of the columns of the input
+                                                          data set to compute the estimates for. If not set, the estimates are computed
+                                                          for all the columns. Supported by the default method in the batch processing mode */
 
     services::Status check() const DAAL_C11_OVERRIDE;
 };
@@ -148,7 +148,7 @@ protected:
 
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
-        services::Status s = _result->allocate<algorithmFPType>(&input, method);
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, method);
         _res               = _result.get();
         return s;
     }
@@ -77,6 +77,18 @@ enum InputId
     lastInputId = data
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__MINMAX__OPTIONALINPUTID"></a>
+ * Available identifiers of optional input objects for the min-max normalization algorithm
+ * @ingroup minmax
+ */
+enum OptionalInputId
+{
+    partialMoments = lastInputId + 1, /*!< Partial results of the low order moments algorithm computed for the input data in the online mode.
+                                           If set, the minimums and maximums are obtained from them and the data is read once */
+    lastOptionalInputId = partialMoments
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__MINMAX__RESULTID"></a>
  * Available identifiers of results of the min-max normalization algorithm
@@ -105,6 +117,7 @@ public:
 
     double lowerBound; /*!< The lower bound of the features value will be obtained during normalization. */
     double upperBound; /*!< The upper bound of the features value will be obtained during normalization. */
+    bool inPlace;      /*!< If true, the normalized data is written to the input data table instead of the newly allocated one */
 
     services::SharedPtr<low_order_moments::BatchImpl> moments; /*!< Pointer to the algorithm that computes the low order moments */
 
@@ -160,6 +173,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+     * Returns an optional input object for the min-max normalization algorithm
+     * \param[in] id    Identifier of the optional %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    low_order_moments::PartialResultPtr get(OptionalInputId id) const;
+
+    /**
+     * Sets the optional input object of the min-max normalization algorithm
+     * \param[in] id    Identifier of the optional %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(OptionalInputId id, const low_order_moments::PartialResultPtr & ptr);
+
     /**
      * Check the correctness of the %Input object
      * \param[in] par       Algorithm parameter
@@ -193,6 +220,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, int method);
 
+    /**
+     * Allocates memory to store final results of the min-max normalization algorithms
+     * \param[in] input     Input objects for the min-max normalization algorithm
+     * \param[in] parameter Parameters of the min-max normalization algorithm
+     * \param[in] method    Algorithm computation method
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, int method);
+
     /**
      * Returns the final result of the min-max normalization algorithm
      * \param[in] id   Identifier of the final result, daal::algorithms::normalization::minmax::ResultId
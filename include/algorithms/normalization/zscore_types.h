@@ -79,6 +79,18 @@ enum InputId
     lastInputId = data
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__ZSCORE__OPTIONALINPUTID"></a>
+ * Available identifiers of optional input objects for the z-score normalization algorithm
+ * @ingroup zscore
+ */
+enum OptionalInputId
+{
+    partialMoments = lastInputId + 1, /*!< Partial results of the low order moments algorithm computed for the input data in the online mode.
+                                           If set, the means and variances are obtained from them and the data is read once */
+    lastOptionalInputId = partialMoments
+};
+
 /**
 * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__ZSCORE__RESULTID"></a>
 * Available identifiers of results of the z-score normalization algorithm
@@ -138,6 +150,20 @@ public:
     */
     void set(InputId id, const data_management::NumericTablePtr & ptr);
 
+    /**
+    * Returns an optional input object for the z-score normalization algorithm
+    * \param[in] id    Identifier of the optional %input object
+    * \return          %Input object that corresponds to the given identifier
+    */
+    low_order_moments::PartialResultPtr get(OptionalInputId id) const;
+
+    /**
+    * Sets the optional input object of the z-score normalization algorithm
+    * \param[in] id    Identifier of the optional %input object
+    * \param[in] ptr   Pointer to the input object
+    */
+    void set(OptionalInputId id, const low_order_moments::PartialResultPtr & ptr);
+
     /**
     * Check the correctness of the %Input object
     * \param[in] par       Algorithm parameter
@@ -258,6 +284,7 @@ public:
     BaseParameter(const bool doScale = true);
     DAAL_UINT64 resultsToCompute; /*!< 64 bit integer flag that indicates the results to compute */
     bool doScale; /*!< boolean flag that indicates the mode of computation. If true both centering and scaling, otherwise only centering. */
+    bool inPlace; /*!< If true, the normalized data is written to the input data table instead of the newly allocated one */
 };
 
 // /**
@@ -106,6 +106,10 @@ struct DAAL_EXPORT Parameter : public optimization_solver::iterative_solver::Par
     SelectionStrategy selection;
     bool positive;
     bool skipTheFirstComponents;
+    size_t featureBlockSize; /*!< Maximal number of weakly correlated coordinates updated simultaneously.
+                                  Blocks are supported for the mean squared error objective function, default is 1 (no blocks) */
+    bool screening;          /*!< Flag that enables the strong rule screening of the coordinates that are zero at the minimum.
+                                  Supported for the mean squared error objective function, default is false */
 };
 /* [Parameter source code] */
 
@@ -229,6 +229,30 @@ public:
     virtual services::Status compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__BATCHCONTAINER_ALGORITHMFPTYPE_ASYNCHRONOUS_CPU"></a>
+ * \brief Provides methods to run implementations of the asynchronous stochastic gradient descent algorithm on CPU
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BatchContainer<algorithmFPType, asynchronous, cpu> : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the asynchronous SGD algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the asynchronous SGD algorithm in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    virtual services::Status compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__BATCH"></a>
  * \brief Computes Stochastic gradient descent in the batch processing mode.
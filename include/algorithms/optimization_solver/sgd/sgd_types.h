@@ -56,7 +56,9 @@ enum Method
 {
     defaultDense = 0, /*!< Default: Required gradient is computed using only one term of objective function */
     miniBatch    = 1, /*!< Required gradient is computed using batchSize terms of objective function  */
-    momentum     = 2  /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    momentum     = 2, /*!< Required gradient is computed using batchSize terms of objective function, perform momentum update rule  */
+    asynchronous = 3  /*!< Worker threads compute the gradients using their own batchSize terms of objective function
+                           and update the argument concurrently without synchronization */
 };
 
 /**
@@ -544,6 +546,50 @@ struct DAAL_EXPORT Parameter<momentum> : public BaseParameter
 /* [ParameterMomentum source code] */
 /** @} */
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__PARAMETER_ASYNCHRONOUS"></a>
+ * \brief %Parameter for the asynchronous Stochastic gradient descent algorithm
+ *
+ * \snippet optimization_solver/sgd/sgd_types.h ParameterAsynchronous source code
+ */
+/* [ParameterAsynchronous source code] */
+template <>
+struct DAAL_EXPORT Parameter<asynchronous> : public BaseParameter
+{
+    /**
+     * Constructs the parameter class of the asynchronous Stochastic gradient descent algorithm
+     * \param[in] function             Objective function represented as sum of functions
+     * \param[in] nIterations          Maximal total number of updates of the argument made by all the workers
+     * \param[in] accuracyThreshold    Accuracy of the algorithm. The algorithm terminates when this accuracy is achieved
+     * \param[in] batchIndices         Numeric table that represents 32 bit integer indices of terms in the objective function. If no indices
+                                       are provided, the implementation will generate random indices. The i-th row is used for the i-th update.
+     * \param[in] batchSize            Number of batch indices to compute the stochastic gradient of a worker
+     * \param[in] learningRateSequence Numeric table that contains values of the learning rate sequence
+     * \param[in] nWorkers             Number of workers that update the argument concurrently. If 0, the number of threads is used
+     * \param[in] deterministic        Flag that makes the result reproducible for the given engine and number of workers
+     */
+    Parameter(const sum_of_functions::BatchPtr & function, size_t nIterations = 100, double accuracyThreshold = 1.0e-05,
+              data_management::NumericTablePtr batchIndices = data_management::NumericTablePtr(), size_t batchSize = 128,
+              data_management::NumericTablePtr learningRateSequence = data_management::NumericTablePtr(
+                  new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 1.0)),
+              size_t nWorkers = 0, bool deterministic = false);
+
+    /**
+     * Checks the correctness of the parameter
+     *
+     * \return Status of computations
+     */
+    virtual services::Status check() const;
+
+    virtual ~Parameter() {}
+
+    size_t nWorkers;    /*!< Number of workers that update the argument concurrently. If 0, the number of threads is used */
+    bool deterministic; /*!< If true, the workers compute their gradients at the same point and the updates are applied in the order
+                             of the workers, so that the result does not depend on the thread scheduling */
+};
+/* [ParameterAsynchronous source code] */
+/** @} */
+
 /**
 * <a name="DAAL-STRUCT-ALGORITHMS__OPTIMIZATION_SOLVER__SGD__INPUT"></a>
 * \brief %Input for the Stochastic gradient descent algorithm
@@ -76,7 +76,13 @@ enum InputId
  */
 enum ResultId
 {
-    weights = 0 /*!< Outlier detection results */
+    weights        = 0, /*!< Outlier detection results */
+    location       = 1, /*!< Vector of size 1 x p with the mean of the observations that are not outliers */
+    scatter        = 2, /*!< Variance-covariance matrix of size p x p of the observations that are not outliers */
+    choleskyFactor = 3, /*!< Upper triangular Cholesky factor U of size p x p of the scatter matrix, scatter = U^T * U */
+    threshold      = 4, /*!< Limit that defines the outlier region, the array of size 1 x 1 with
+                             the maximal Mahalanobis distance of the observations that are not outliers */
+    lastResultId   = threshold
 };
 
 /**
@@ -101,6 +107,9 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
                                                  Recommended value: \f$\alpha / n\f$, where n is the number of observations. */
     double toleranceToConverge;      /*!< Stopping criterion: the algorithm is terminated if the size of the basic subset
                                                  is changed by less than the threshold */
+    bool computeEstimates;           /*!< If true, the location, scatter, Cholesky factor of the scatter and threshold are computed
+                                                 for the observations that are not outliers. They are passed to the multivariate
+                                                 outlier detection algorithm to score new observations without recomputing them */
     virtual services::Status check() const DAAL_C11_OVERRIDE;
 };
 /* [ParameterBacon source code] */
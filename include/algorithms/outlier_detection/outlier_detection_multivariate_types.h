@@ -70,11 +70,13 @@ enum BaconInitializationMethod
  */
 enum InputId
 {
-    data,      /*!< %Input data table */
-    location,  /*!< Vector of mean estimates of size 1 x p */
-    scatter,   /*!< Measure of spread, the variance-covariance matrix of size p x p */
-    threshold, /*!< Limit that defines the outlier region, the array of size 1 x 1 containing a non-negative number */
-    lastInputId = threshold
+    data,           /*!< %Input data table */
+    location,       /*!< Vector of mean estimates of size 1 x p */
+    scatter,        /*!< Measure of spread, the variance-covariance matrix of size p x p */
+    threshold,      /*!< Limit that defines the outlier region, the array of size 1 x 1 containing a non-negative number */
+    choleskyFactor, /*!< Upper triangular Cholesky factor U of size p x p of the scatter matrix, scatter = U^T * U.
+                         If set, the scatter is not used and is not factorized on each computation */
+    lastInputId = choleskyFactor
 };
 
 /**
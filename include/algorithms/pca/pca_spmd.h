@@ -0,0 +1,126 @@
+/* file: pca_spmd.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the PCA algorithm in the SPMD processing mode
+//--
+*/
+
+#ifndef __PCA_SPMD_H__
+#define __PCA_SPMD_H__
+
+#include "algorithms/pca/pca_batch.h"
+#include "algorithms/covariance/covariance_spmd.h"
+#include "algorithms/moments/low_order_moments_spmd.h"
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace interface1
+{
+/**
+ * @defgroup pca_spmd SPMD
+ * @ingroup pca
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__SPMD"></a>
+ * \brief Computes the results of the PCA algorithm in the SPMD processing mode.
+ *        Every process calls compute() for its own block of data, the correlation matrix of all the data is computed
+ *        by \ref covariance::interface1::Spmd "covariance::Spmd" and its eigenvectors are computed on every process.
+ *        Only the correlation method is supported.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for PCA, double or float
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE>
+class Spmd
+{
+public:
+    typedef algorithms::pca::Input InputType;
+    typedef algorithms::pca::BatchParameter<algorithmFPType, correlationDense> ParameterType;
+    typedef algorithms::pca::Result ResultType;
+
+    /**
+     * Constructs the algorithm that runs on the processes of the communicator
+     * \param[in] comm  Communicator of the processes
+     */
+    Spmd(const services::CommunicatorIfacePtr & comm) : _comm(comm) {}
+
+    /**
+     * Computes the result from the blocks of data of all the processes
+     * \return Status of computations
+     */
+    services::Status compute()
+    {
+        DAAL_CHECK(_comm, services::ErrorNullPtr);
+
+        services::Status s;
+        covariance::Spmd<algorithmFPType> correlationAlg(_comm);
+        correlationAlg.parameter.outputMatrixType = covariance::correlationMatrix;
+        correlationAlg.input.set(covariance::data, input.get(data));
+        DAAL_CHECK_STATUS(s, correlationAlg.compute());
+
+        Batch<algorithmFPType, correlationDense> eigenAlg;
+        eigenAlg.parameter.resultsToCompute = parameter.resultsToCompute;
+        eigenAlg.parameter.nComponents      = parameter.nComponents;
+        eigenAlg.parameter.isDeterministic  = parameter.isDeterministic;
+        eigenAlg.input.set(correlation, correlationAlg.getResult()->get(covariance::correlation));
+        DAAL_CHECK_STATUS(s, eigenAlg.compute());
+
+        /* The means and the variances are not available from the correlation matrix */
+        _result = eigenAlg.getResult();
+        if (parameter.resultsToCompute & mean)
+        {
+            _result->set(means, correlationAlg.getResult()->get(covariance::mean));
+        }
+        if (parameter.resultsToCompute & variance)
+        {
+            low_order_moments::Spmd<algorithmFPType> momentsAlg(_comm);
+            momentsAlg.parameter.estimatesToCompute = low_order_moments::estimatesMeanVariance;
+            momentsAlg.input.set(low_order_moments::data, input.get(data));
+            DAAL_CHECK_STATUS(s, momentsAlg.compute());
+            _result->set(variances, momentsAlg.getResult()->get(low_order_moments::variance));
+        }
+        return s;
+    }
+
+    /**
+     * Returns the structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    ResultPtr getResult() { return _result; }
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Parameter structure */
+
+private:
+    services::CommunicatorIfacePtr _comm;
+    ResultPtr _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::Spmd;
+
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+#endif
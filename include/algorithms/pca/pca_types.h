@@ -32,6 +32,7 @@
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
 #include "algorithms/normalization/zscore.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -56,7 +57,9 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense     = 0, /*!< PCA Default method */
-    svdDense         = 1  /*!< PCA SVD method */
+    svdDense         = 1, /*!< PCA SVD method */
+    randomizedDense  = 2, /*!< PCA randomized SVD method that computes only the leading components */
+    incrementalDense = 3  /*!< PCA incremental SVD method that keeps the rank-limited sketch of the data in the online processing mode */
 };
 
 /**
@@ -119,7 +122,7 @@ enum PartialSVDTableResultId
     */
 enum PartialSVDCollectionResultId
 {
-    auxiliaryData = lastPartialSVDTableResultId + 1, /*!< Auxiliary data of the PCA SVD method */
+    auxiliaryData = lastPartialSVDTableResultId + 1, /*!< Auxiliary data of the PCA SVD method, the sketch of the data for the incremental method */
     distributedInputs, /*!< Auxiliary data of the PCA SVD method on the second step in the distributed processing mode */
     lastPartialSVDCollectionResultId = distributedInputs
 };
@@ -508,6 +511,27 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+    * <a name="DAAL-CLASS-ALGORITHMS__PCA__ONLINEPARAMETER_ALGORITHMFPTYPE_INCREMENTALDENSE"></a>
+    * \brief Class that specifies the parameters of the PCA incremental SVD algorithm in the online computing mode
+    */
+template <typename algorithmFPType>
+class DAAL_EXPORT OnlineParameter<algorithmFPType, incrementalDense> : public BaseParameter<algorithmFPType, incrementalDense>
+{
+public:
+    /** Constructs PCA parameters */
+    OnlineParameter();
+
+    size_t nComponents; /*!< Number of the leading principal components to compute */
+    size_t sketchSize;  /*!< Number of rows of the sketch that approximates the processed data, not less than nComponents */
+
+    /**
+    * Checks online parameter of the PCA incremental SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTEDPARAMETER"></a>
     * \brief Class that specifies the parameters of the PCA algorithm in the distributed computing mode
@@ -726,6 +750,30 @@ public:
     services::Status check() const DAAL_C11_OVERRIDE;
 };
 
+/**
+* <a name="DAAL-CLASS-ALGORITHMS__PCA__BATCHPARAMETER_ALGORITHMFPTYPE_RANDOMIZEDDENSE"></a>
+* \brief Class that specifies the parameters of the PCA randomized SVD algorithm in the batch computing mode
+*/
+template <typename algorithmFPType>
+class DAAL_EXPORT BatchParameter<algorithmFPType, randomizedDense> : public BatchParameter<algorithmFPType, svdDense>
+{
+public:
+    /** Constructs PCA parameters */
+    BatchParameter(const services::SharedPtr<normalization::zscore::BatchImpl> & normalizationForBatchParameter =
+                       services::SharedPtr<normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense> >(
+                           new normalization::zscore::Batch<algorithmFPType, normalization::zscore::defaultDense>()));
+
+    size_t nOversamples;       /*!< Number of the additional random vectors used to find the range of the data */
+    size_t nPowerIterations;   /*!< Number of the power iterations */
+    engines::EnginePtr engine; /*!< Engine that generates the random test matrix */
+
+    /**
+    * Checks batch parameter of the PCA randomized SVD algorithm
+    * \return Errors detected while checking
+    */
+    services::Status check() const DAAL_C11_OVERRIDE;
+};
+
 /**
     * <a name="DAAL-CLASS-ALGORITHMS__PCA__RESULT"></a>
     * \brief Provides methods to access results obtained with the PCA algorithm
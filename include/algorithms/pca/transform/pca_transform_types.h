@@ -231,13 +231,22 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /**
      *  Parameter constructor
      * \param[in] nComponents Number of principal components
+     * \param[in] precision   Precision of the products of the data and the principal components, \ref InferencePrecision
      */
-    Parameter(size_t nComponents = 0);
+    Parameter(size_t nComponents = 0, InferencePrecision precision = fullPrecision);
 
     /**
      *  Number of components
      */
     size_t nComponents;
+
+    /**
+     *  Precision of the products of the data and the principal components scaled for normalization and whitening on CPU.
+     *  The projections of the means are subtracted in the precision of the algorithm
+     */
+    InferencePrecision inferencePrecision;
+
+    services::Status check() const DAAL_C11_OVERRIDE;
 };
 /** @} */
 /** @} */
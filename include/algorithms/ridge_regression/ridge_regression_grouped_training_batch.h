@@ -0,0 +1,180 @@
+/* file: ridge_regression_grouped_training_batch.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the grouped ridge regression training in the batch processing mode
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_BATCH_H__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "services/daal_defines.h"
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+namespace grouped_training
+{
+namespace interface1
+{
+/**
+ * @defgroup ridge_regression_grouped_training_batch Batch
+ * @ingroup ridge_regression_grouped_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__BATCHCONTAINER"></a>
+ * \brief Class containing methods for the grouped ridge regression training using algorithmFPType precision arithmetic
+ */
+template <typename algorithmFPType, Method method, CpuType cpu>
+class BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the grouped ridge regression training with a specified environment in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env * daalEnv);
+
+    /** Default destructor */
+    ~BatchContainer();
+
+    /**
+     * Computes the result of the grouped ridge regression training in the batch processing mode
+     *
+     * \return Status of computations
+     */
+    services::Status compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__BATCH"></a>
+ * \brief Trains the collection of ridge regression models, one model per segment of the observations, in the batch processing mode.
+ *        Normal equations of all the segments are accumulated in one pass through the data set.
+ *        Linear regression models are trained with zero ridge parameters.
+ * <!-- \n<a href="DAAL-REF-RIDGEREGRESSION-ALGORITHM">Ridge regression algorithm description and usage models</a> -->
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the grouped ridge regression training, double or float
+ * \tparam method           Grouped ridge regression training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method    Computation methods
+ *      - \ref InputId   Identifiers of input objects
+ *      - \ref ResultId  Identifiers of the results
+ *
+ * \par References
+ *      - \ref ridge_regression::interface1::ModelNormEq "ridge_regression::ModelNormEq" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template <typename algorithmFPType = DAAL_ALGORITHM_FP_TYPE, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Training<batch>
+{
+public:
+    typedef algorithms::ridge_regression::grouped_training::Input InputType;
+    typedef algorithms::ridge_regression::grouped_training::Parameter ParameterType;
+    typedef algorithms::ridge_regression::grouped_training::Result ResultType;
+
+    InputType input;         /*!< %Input data structure */
+    ParameterType parameter; /*!< %Training \ref interface1::Parameter "parameters" */
+
+    /**
+     * Constructs the grouped ridge regression training algorithm
+     * \param[in] nSegments Number of segments
+     */
+    Batch(size_t nSegments = 0) : parameter(nSegments) { initialize(); }
+
+    /**
+     * Constructs the grouped ridge regression training algorithm by copying input objects
+     * and parameters of another grouped ridge regression training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> & other) : input(other.input), parameter(other.parameter) { initialize(); }
+
+    /**
+     * Returns the method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return (int)method; }
+
+    /**
+     * Returns the structure that contains the result of the grouped ridge regression training
+     * \return Structure that contains the result of the grouped ridge regression training
+     */
+    ResultPtr getResult() { return _result; }
+
+    /**
+     * Registers user-allocated memory to store the result of the grouped ridge regression training
+     * \param[in] res  Structure to store the result of the grouped ridge regression training
+     */
+    services::Status setResult(const ResultPtr & res)
+    {
+        DAAL_CHECK(res, services::ErrorNullResult)
+        _result = res;
+        _res    = _result.get();
+        return services::Status();
+    }
+
+    /**
+     * Returns a pointer to a newly allocated grouped ridge regression training algorithm
+     * with a copy of the input objects and parameters for this grouped ridge regression training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
+
+protected:
+    ResultPtr _result;
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
+
+    virtual services::Status allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::Status s = _result->allocate<algorithmFPType>(&input, &parameter, (int)method);
+        _res               = _result.get();
+        return s;
+    }
+
+    void initialize()
+    {
+        _ac     = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in     = &input;
+        _par    = &parameter;
+        _result = ResultPtr(new ResultType());
+    }
+
+private:
+    Batch & operator=(const Batch &);
+};
+/** @} */
+} // namespace interface1
+
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace grouped_training
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,233 @@
+/* file: ridge_regression_grouped_training_types.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for training of the collection of ridge regression models
+//  on the segments of the data set
+//--
+*/
+
+#ifndef __RIDGE_REGRESSION_GROUPED_TRAINING_TYPES_H__
+#define __RIDGE_REGRESSION_GROUPED_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+#include "algorithms/ridge_regression/ridge_regression_model.h"
+#include "algorithms/ridge_regression/ridge_regression_ne_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace ridge_regression
+{
+/**
+ * @defgroup ridge_regression_grouped_training Grouped training
+ * \copydoc daal::algorithms::ridge_regression::grouped_training
+ * @ingroup ridge_regression
+ * @{
+ */
+/**
+ * \brief Contains classes for training of ridge regression models on the segments of the data set,
+ *        one model per segment
+ */
+namespace grouped_training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__METHOD"></a>
+ * \brief Computation methods for the grouped ridge regression training
+ */
+enum Method
+{
+    defaultDense = 0, /*!< Normal equations method */
+    normEqDense  = 0  /*!< Normal equations method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__INPUTID"></a>
+ * \brief Available identifiers of input objects for the grouped ridge regression training
+ */
+enum InputId
+{
+    data,               /*!< %Input data table */
+    dependentVariables, /*!< Values of the dependent variable for the input data */
+    segments,           /*!< Identifiers of the segments of the observations, integers in the range [0, nSegments) */
+    lastInputId = segments
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__RESULTID"></a>
+ * \brief Available identifiers of the result of the grouped ridge regression training
+ */
+enum ResultId
+{
+    models, /*!< Collection of the ridge regression models, the i-th model is trained on the observations of the i-th segment */
+    lastResultId = models
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__PARAMETER"></a>
+ * \brief Parameters of the grouped ridge regression training
+ */
+struct DAAL_EXPORT Parameter : public ridge_regression::TrainParameter
+{
+    /**
+     * Constructs the parameters of the grouped ridge regression training
+     * \param[in] nSegments Number of segments
+     */
+    Parameter(size_t nSegments = 0);
+
+    services::Status check() const DAAL_C11_OVERRIDE;
+
+    size_t nSegments; /*!< Number of segments and trained models */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__INPUT"></a>
+ * \brief %Input objects for the grouped ridge regression training
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input();
+    Input(const Input & other);
+
+    virtual ~Input() {}
+
+    /**
+     * Returns an input object for the grouped ridge regression training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets an input object for the grouped ridge regression training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(InputId id, const data_management::NumericTablePtr & value);
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfFeatures() const;
+
+    /**
+     * Returns the number of dependent variables
+     * \return Number of dependent variables
+     */
+    size_t getNumberOfDependentVariables() const;
+
+    /**
+     * Checks an input object for the grouped ridge regression training
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__RIDGE_REGRESSION__GROUPED_TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method of the grouped ridge regression training
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE_CAST(Result)
+    Result();
+
+    /**
+     * Returns the result of the grouped ridge regression training
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultId id) const;
+
+    /**
+     * Returns the model trained on the segment
+     * \param[in] id        Identifier of the result
+     * \param[in] segment   Identifier of the segment
+     * \return              Model trained on the observations of the segment
+     */
+    ridge_regression::ModelNormEqPtr get(ResultId id, size_t segment) const;
+
+    /**
+     * Sets the result of the grouped ridge regression training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultId id, const data_management::DataCollectionPtr & value);
+
+    /**
+     * Allocates memory to store the result of the grouped ridge regression training
+     * \param[in] input     %Input object for the algorithm
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     *
+     * \return Status of computations
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocate(const daal::algorithms::Input * input, const daal::algorithms::Parameter * parameter, const int method);
+
+    /**
+     * Checks the result of the grouped ridge regression training
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     *
+     * \return Status of computations
+     */
+    services::Status check(const daal::algorithms::Input * input, const daal::algorithms::Parameter * par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        return daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+typedef services::SharedPtr<Result> ResultPtr;
+typedef services::SharedPtr<const Result> ResultConstPtr;
+} // namespace interface1
+
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::ResultConstPtr;
+
+} // namespace grouped_training
+/** @} */
+} // namespace ridge_regression
+} // namespace algorithms
+} // namespace daal
+
+#endif
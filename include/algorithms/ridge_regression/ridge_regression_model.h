@@ -71,7 +71,10 @@ struct DAAL_EXPORT TrainParameter : public Parameter
 
     services::Status check() const DAAL_C11_OVERRIDE;
 
-    data_management::NumericTablePtr ridgeParameters; /*!< Numeric table that contains values of ridge parameters */
+    data_management::NumericTablePtr ridgeParameters;     /*!< Numeric table that contains values of ridge parameters */
+    data_management::NumericTablePtr ridgeParametersPath; /*!< Optional numeric table of size nPath x (1 or nDependentVariables) with
+                                                               ridge parameters of the regularization path. If it is set, the batch training
+                                                               also trains a model for every row with one eigendecomposition of X'X */
 };
 /* [TrainParameter source code] */
 
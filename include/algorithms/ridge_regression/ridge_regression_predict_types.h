@@ -78,6 +78,16 @@ enum ModelInputId
     lastModelInputId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__PREDICTION__MODELCOLLECTIONINPUTID"></a>
+ * \brief Available identifiers of input collections of models for making ridge regression model-based prediction with several models at once
+ */
+enum ModelCollectionInputId
+{
+    models                     = linear_model::prediction::models, /*!< Collection of trained models with the same number of features */
+    lastModelCollectionInputId = models
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__PREDICTION__RESULTID"></a>
  * \brief Available identifiers of the result for making ridge regression model-based prediction
@@ -88,6 +98,16 @@ enum ResultId
     lastResultId = prediction
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__PREDICTION__RESULTCOLLECTIONID"></a>
+ * \brief Available identifiers of the collections of results of ridge regression model-based prediction with several models at once
+ */
+enum ResultCollectionId
+{
+    predictions            = linear_model::prediction::predictions, /*!< Collection of the predictions of every model of the input collection */
+    lastResultCollectionId = predictions
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -133,6 +153,20 @@ public:
      * \param[in] value   %Input object
      */
     void set(ModelInputId id, const ridge_regression::ModelPtr & value);
+
+    /**
+     * Returns the collection of models for making ridge regression model-based prediction with several models at once
+     * \param[in] id    Identifier of the input object
+     * \return          Collection of models that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ModelCollectionInputId id) const;
+
+    /**
+     * Sets the collection of models for making ridge regression model-based prediction with several models at once
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Collection of trained models
+     */
+    void set(ModelCollectionInputId id, const data_management::DataCollectionPtr & value);
 };
 
 /**
@@ -159,6 +193,20 @@ public:
      */
     void set(ResultId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns the collection of results of ridge regression model-based prediction with several models at once
+     * \param[in] id    Identifier of the result
+     * \return          Collection of results that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(ResultCollectionId id) const;
+
+    /**
+     * Sets the collection of results of ridge regression model-based prediction with several models at once
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Collection of numeric tables
+     */
+    void set(ResultCollectionId id, const data_management::DataCollectionPtr & value);
+
 protected:
     /** \private */
     template <typename Archive, bool onDeserialize>
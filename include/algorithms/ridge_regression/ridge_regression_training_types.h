@@ -70,6 +70,21 @@ enum InputId
     lastInputId        = dependentVariables
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__TRAINING__CROSSPRODUCTINPUTID"></a>
+ * \brief Available identifiers of optional input objects with the cross-products precomputed for ridge regression model-based training
+ *        in the batch processing mode, for example, by the online or distributed training. If they are set, the algorithm
+ *        solves the normal equations without reading the input data
+ */
+enum CrossProductInputId
+{
+    xtx                     = lastInputId + 1, /*!< Numeric table of size p' x p' with the cross-product X'X in the layout of
+                                                    ModelNormEq::getXTXTable(), p' = p + 1 if the intercept is computed and p otherwise */
+    xty                     = lastInputId + 2, /*!< Numeric table of size k x p' with the cross-product X'Y in the layout of
+                                                    ModelNormEq::getXTYTable() */
+    lastCrossProductInputId = xty
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__TRAINING__MASTER_INPUT_ID"></a>
  * \brief Available identifiers of input objects for ridge regression model-based training in the second step of the distributed processing mode
@@ -100,6 +115,16 @@ enum ResultId
     lastResultId = model
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__RIDGE_REGRESSION__TRAINING__OPTIONALRESULTMODELCOLLECTIONID"></a>
+ * \brief Available identifiers of optional collections of models computed by ridge regression model-based training
+ */
+enum OptionalResultModelCollectionId
+{
+    pathModels                          = lastResultId + 1, /*!< Models trained for the ridge parameters of the regularization path */
+    lastOptionalResultModelCollectionId = pathModels
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -154,6 +179,20 @@ public:
      */
     void set(InputId id, const data_management::NumericTablePtr & value);
 
+    /**
+     * Returns a cross-product precomputed for ridge regression model-based training
+     * \param[in] id    Identifier of the cross-product
+     * \return          Cross-product that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(CrossProductInputId id) const;
+
+    /**
+     * Sets a cross-product precomputed for ridge regression model-based training
+     * \param[in] id      Identifier of the cross-product
+     * \param[in] value   Pointer to the cross-product
+     */
+    void set(CrossProductInputId id, const data_management::NumericTablePtr & value);
+
     /**
      * Returns the number of columns in the input data set
      * \return Number of columns in the input data set
@@ -351,6 +390,20 @@ public:
      */
     void set(ResultId id, const ridge_regression::ModelPtr & value);
 
+    /**
+     * Returns the collection of models of the regularization path
+     * \param[in] id    Identifier of the result
+     * \return          Collection of models that corresponds to the given identifier
+     */
+    data_management::DataCollectionPtr get(OptionalResultModelCollectionId id) const;
+
+    /**
+     * Sets the collection of models of the regularization path
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Collection of models
+     */
+    void set(OptionalResultModelCollectionId id, const data_management::DataCollectionPtr & value);
+
     /**
      * Allocates memory to store the result of ridge regression model-based training
      * \param[in] input Pointer to an object containing the input data
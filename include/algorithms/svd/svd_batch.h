@@ -136,7 +136,7 @@ protected:
     virtual services::Status allocateResult() DAAL_C11_OVERRIDE
     {
         _result.reset(new ResultType());
-        services::Status s = _result->allocate<algorithmFPType>(_in, 0, 0);
+        services::Status s = _result->allocate<algorithmFPType>(_in, &parameter, (int)method);
         _res               = _result.get();
         return s;
     }
@@ -28,6 +28,7 @@
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
+#include "algorithms/engines/mt19937/mt19937.h"
 
 namespace daal
 {
@@ -48,7 +49,8 @@ namespace svd
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method */
+    randomizedDense = 1  /*!< Randomized method that computes the leading singular values and vectors with the randomized range finder */
 };
 
 /**
@@ -169,11 +171,20 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  \param[in] _rightSingularMatrix Format of the matrix of right singular vectors
      */
     Parameter(SVDResultFormat _leftSingularMatrix = requiredInPackedForm, SVDResultFormat _rightSingularMatrix = requiredInPackedForm)
-        : leftSingularMatrix(_leftSingularMatrix), rightSingularMatrix(_rightSingularMatrix)
+        : leftSingularMatrix(_leftSingularMatrix),
+          rightSingularMatrix(_rightSingularMatrix),
+          nComponents(10),
+          nOversamples(10),
+          nPowerIterations(2),
+          engine(engines::mt19937::Batch<>::create())
     {}
 
     SVDResultFormat leftSingularMatrix;  /*!< Format of the matrix of left singular vectors  >*/
     SVDResultFormat rightSingularMatrix; /*!< Format of the matrix of right singular vectors >*/
+    size_t nComponents;                  /*!< Number of the leading singular values and vectors computed by the randomizedDense method */
+    size_t nOversamples;                 /*!< Number of the additional random vectors used by the randomizedDense method */
+    size_t nPowerIterations;             /*!< Number of the power iterations of the randomizedDense method */
+    engines::EnginePtr engine;           /*!< Engine that generates the random test matrix for the randomizedDense method */
 };
 
 /**
@@ -472,6 +483,17 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n);
 
+    /**
+     * Allocates memory to store the leading singular values and vectors computed by the randomized SVD algorithm
+     * \tparam     algorithmFPType  Data type to use for storage in the resulting HomogenNumericTable
+     * \param[in]  m  Number of columns in the input data set
+     * \param[in]  n  Number of rows in the input data set
+     * \param[in]  k  Number of the leading singular values and vectors
+     * \return Status of allocation
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT services::Status allocateImpl(size_t m, size_t n, size_t k);
+
 protected:
     /** \private */
     template <typename Archive, bool onDeserialize>
@@ -38,6 +38,12 @@ namespace svm
 {
 namespace training
 {
+namespace internal
+{
+/* Returns the estimate of the size of the memory allocated by the SVM training in the batch processing mode, see Batch::estimateMemorySize() */
+DAAL_EXPORT size_t estimateMemorySize(size_t nRows, size_t nFeatures, const Parameter & parameter, int method, size_t fpSize);
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -307,6 +313,19 @@ public:
      */
     services::SharedPtr<Batch<algorithmFPType, method> > clone() const { return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl()); }
 
+    /**
+     * Returns the estimate of the peak size of the memory allocated by the compute() method for the current input and parameters,
+     * including the results. The estimate is computed without running the algorithm, the measured peak is returned by
+     * Environment::getLastComputePeakMemorySize() when memory accounting is enabled
+     * \return The size of the memory in bytes, 0 if the input data is not set
+     */
+    size_t estimateMemorySize() const
+    {
+        const data_management::NumericTablePtr x = input.get(classifier::training::data);
+        if (!x) return 0;
+        return internal::estimateMemorySize(x->getNumberOfRows(), x->getNumberOfColumns(), parameter, (int)method, sizeof(algorithmFPType));
+    }
+
 protected:
     virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE { return new Batch<algorithmFPType, method>(*this); }
 
@@ -53,6 +53,7 @@ namespace training
 enum Method
 {
     boser        = 0, /*!< Method proposed by Boser et al. */
+    thunder      = 1, /*!< Working set method that optimizes a block of violating pairs per iteration, as in ThunderSVM */
     defaultDense = 0  /*!< Default method */
 };
 
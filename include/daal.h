@@ -21,10 +21,13 @@
 #include "services/daal_memory.h"
 #include "services/base.h"
 #include "services/env_detect.h"
+#include "services/numa_node_scope.h"
+#include "services/thread_arena.h"
 #include "services/library_version_info.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/compression/lz4compression.h"
 #include "data_management/compression/lzocompression.h"
 #include "data_management/compression/rlecompression.h"
 #include "data_management/compression/zlibcompression.h"
@@ -34,20 +37,25 @@
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
 #include "data_management/data_source/string_data_source.h"
+#include "data_management/data_source/string_batch_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/columnar_file.h"
 #include "data_management/data/data_archive.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
 #include "data_management/data/factory.h"
 #include "data_management/data/data_serialize.h"
 #include "services/daal_shared_ptr.h"
+#include "services/communicator.h"
+#include "services/iteration_pipeline.h"
 #include "data_management/data/data_collection.h"
 #include "data_management/data/input_collection.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/subset_numeric_table.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -61,9 +69,13 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_spmd.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
+#include "algorithms/kmeans/kmeans_predict_types.h"
+#include "algorithms/kmeans/kmeans_predict.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_batch.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_online.h"
 #include "algorithms/naive_bayes/multinomial_naive_bayes_training_distributed.h"
@@ -77,8 +89,10 @@
 #include "algorithms/linear_regression/linear_regression_predict.h"
 #include "algorithms/linear_regression/linear_regression_qr_model.h"
 #include "algorithms/linear_regression/linear_regression_training_distributed.h"
+#include "algorithms/linear_regression/linear_regression_training_spmd.h"
 #include "algorithms/linear_regression/linear_regression_training_batch.h"
 #include "algorithms/linear_regression/linear_regression_training_online.h"
+#include "algorithms/linear_regression/linear_regression_training_pipeline.h"
 #include "algorithms/linear_regression/linear_regression_quality_metric_set_batch.h"
 #include "algorithms/linear_regression/linear_regression_quality_metric_set_types.h"
 #include "algorithms/linear_regression/linear_regression_single_beta_batch.h"
@@ -117,6 +131,7 @@
 #include "algorithms/pca/pca_batch.h"
 #include "algorithms/pca/pca_online.h"
 #include "algorithms/pca/pca_distributed.h"
+#include "algorithms/pca/pca_spmd.h"
 #include "algorithms/pca/pca_quality_metric_set_types.h"
 #include "algorithms/pca/pca_quality_metric_set_batch.h"
 #include "algorithms/pca/pca_explained_variance_types.h"
@@ -156,10 +171,12 @@
 #include "algorithms/moments/low_order_moments_batch.h"
 #include "algorithms/moments/low_order_moments_online.h"
 #include "algorithms/moments/low_order_moments_distributed.h"
+#include "algorithms/moments/low_order_moments_spmd.h"
 #include "algorithms/moments/low_order_moments_types.h"
 #include "algorithms/covariance/covariance_batch.h"
 #include "algorithms/covariance/covariance_online.h"
 #include "algorithms/covariance/covariance_distributed.h"
+#include "algorithms/covariance/covariance_spmd.h"
 #include "algorithms/covariance/covariance_types.h"
 #include "algorithms/weak_learner/weak_learner_model.h"
 #include "algorithms/weak_learner/weak_learner_predict.h"
@@ -185,6 +202,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -240,8 +259,11 @@
 #include "algorithms/ridge_regression/ridge_regression_training_batch.h"
 #include "algorithms/ridge_regression/ridge_regression_training_online.h"
 #include "algorithms/ridge_regression/ridge_regression_training_distributed.h"
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_types.h"
+#include "algorithms/ridge_regression/ridge_regression_grouped_training_batch.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_model.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict.h"
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_distributed.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_types.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
@@ -250,6 +272,21 @@
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_training_batch.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_training_types.h"
 #include "algorithms/k_nearest_neighbors/bf_knn_classification_predict_types.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_model.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_predict.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_training_batch.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_training_types.h"
+#include "algorithms/k_nearest_neighbors/hnsw_knn_classification_predict_types.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_model.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_predict.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_training_batch.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_training_types.h"
+#include "algorithms/k_nearest_neighbors/ball_tree_knn_classification_predict_types.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_model.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_predict.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_training_batch.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_training_types.h"
+#include "algorithms/k_nearest_neighbors/ivfpq_knn_classification_predict_types.h"
 #include "algorithms/decision_tree/decision_tree_classification_model.h"
 #include "algorithms/decision_tree/decision_tree_classification_predict.h"
 #include "algorithms/decision_tree/decision_tree_classification_training_batch.h"
@@ -264,9 +301,11 @@
 #include "algorithms/decision_forest/decision_forest_classification_model_builder.h"
 #include "algorithms/decision_forest/decision_forest_classification_predict.h"
 #include "algorithms/decision_forest/decision_forest_classification_training_batch.h"
+#include "algorithms/decision_forest/decision_forest_classification_training_spmd.h"
 #include "algorithms/decision_forest/decision_forest_regression_model.h"
 #include "algorithms/decision_forest/decision_forest_regression_predict.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_batch.h"
+#include "algorithms/decision_forest/decision_forest_regression_training_spmd.h"
 #include "algorithms/decision_forest/decision_forest_regression_training_types.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model.h"
 #include "algorithms/gradient_boosted_trees/gbt_classification_model_builder.h"
@@ -316,8 +355,11 @@
 #include "algorithms/engines/engine_family.h"
 #include "algorithms/engines/mt2203/mt2203.h"
 #include "algorithms/engines/mt2203/mt2203_types.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10.h"
+#include "algorithms/engines/philox4x32x10/philox4x32x10_types.h"
 #include "algorithms/dbscan/dbscan_types.h"
 #include "algorithms/dbscan/dbscan_batch.h"
 #include "algorithms/dbscan/dbscan_distributed.h"
+#include "algorithms/dbscan/dbscan_spmd.h"
 
 #endif /* #ifndef __DAAL_H__ */
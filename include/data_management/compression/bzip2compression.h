@@ -114,6 +114,7 @@ public:
 
 protected:
     void initialize();
+    Compressor<bzip2> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _strmp;
@@ -177,6 +178,7 @@ public:
 
 protected:
     void initialize();
+    Decompressor<bzip2> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _strmp;
@@ -65,8 +65,9 @@ enum CompressionMethod
 {
     zlib, /*!< DEFLATE compression method with a ZLIB block header or a simple GZIP block header */
     lzo,  /*!< LZO1X compatible compression method */
-    rle,  /*!< Run-Length Encoding method */
-    bzip2 /*!< BZIP2 compression method */
+    rle,   /*!< Run-Length Encoding method */
+    bzip2, /*!< BZIP2 compression method */
+    lz4    /*!< LZ4 compatible compression method */
 };
 
 /**
@@ -226,8 +227,16 @@ public:
     CompressorImpl() : Compression() { _isInitialized = false; }
     virtual ~CompressorImpl() {}
 
+    /**
+     * Returns a pointer to the newly allocated compressor of the same method with a copy of the parameters of this compressor.
+     * The new compressor does not share the state with this one and can process a separate data block concurrently
+     * \return Pointer to the newly allocated compressor, empty pointer if the compressor cannot be copied
+     */
+    services::SharedPtr<CompressorImpl> clone() const { return services::SharedPtr<CompressorImpl>(cloneImpl()); }
+
 protected:
     virtual void initialize() { _isInitialized = true; }
+    virtual CompressorImpl * cloneImpl() const { return NULL; }
     bool _isInitialized;
 };
 
@@ -249,8 +258,16 @@ public:
     DecompressorImpl() : Compression() { _isInitialized = false; }
     virtual ~DecompressorImpl() {}
 
+    /**
+     * Returns a pointer to the newly allocated decompressor of the same method with a copy of the parameters of this decompressor.
+     * The new decompressor does not share the state with this one and can process a separate data block concurrently
+     * \return Pointer to the newly allocated decompressor, empty pointer if the decompressor cannot be copied
+     */
+    services::SharedPtr<DecompressorImpl> clone() const { return services::SharedPtr<DecompressorImpl>(cloneImpl()); }
+
 protected:
     virtual void initialize() { _isInitialized = true; }
+    virtual DecompressorImpl * cloneImpl() const { return NULL; }
     bool _isInitialized;
 };
 
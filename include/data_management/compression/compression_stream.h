@@ -196,9 +196,186 @@ private:
 
     services::SharedPtr<services::ErrorCollection> _errors;
 };
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELCOMPRESSIONSTREAM"></a>
+ * \brief %ParallelCompressionStream class splits input raw data into chunks of a fixed size
+ *        and compresses the chunks independently of each other in parallel.
+ *        The compressed data starts with the chunk index that holds the raw and compressed sizes of all the chunks,
+ *        which allows %ParallelDecompressionStream to decompress the chunks in parallel and in random order.
+ *        All the raw data must be written to the stream before the compressed data is requested.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref CompressorImpl class
+ */
+class DAAL_EXPORT ParallelCompressionStream : public Base
+{
+public:
+    /**
+     * \brief %ParallelCompressionStream constructor
+     * \param compr     Pointer to a specific Compressor used for compression.
+     *                  Its copies are used to compress the chunks in parallel; the chunks are compressed sequentially
+     *                  with this compressor if it cannot be copied
+     * \param chunkSize Optional parameter, size in bytes of the raw data chunks compressed independently
+     */
+    ParallelCompressionStream(CompressorImpl * compr, size_t chunkSize = 1024 * 1024);
+    virtual ~ParallelCompressionStream() DAAL_C11_OVERRIDE;
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream. The filled chunks are compressed in parallel
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Writes the next DataBlock to %ParallelCompressionStream
+     * \param[in] inBlock  Next DataBlock to be compressed
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+    /**
+     * Returns the size of the compressed data that is not copied from the stream yet, including the chunk index.
+     * Compresses the remaining data, no data can be written to the stream after this call
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+    /**
+     * Returns the number of the chunks compressed independently.
+     * Compresses the remaining data, no data can be written to the stream after this call
+     * \return Number of the chunks
+     */
+    virtual size_t getNumberOfChunks();
+    /**
+     * Copies the next part of the compressed data to an external array.
+     * Compresses the remaining data, no data can be written to the stream after this call
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte * outPtr, size_t outSize);
+    /**
+     * Copies the next part of the compressed data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where compressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(DataBlock & outBlock) { return copyCompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    void * _chunks;
+    void * _index;
+
+    CompressorImpl * _compressor;
+    size_t _chunkSize;
+    size_t _nCompressedChunks;
+    bool _isFinalized;
+
+    size_t _readPos;
+
+    void compressChunks(size_t nChunks);
+    void finalize();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
+
+/**
+ * <a name="DAAL-CLASS-DATA_MANAGEMENT__PARALLELDECOMPRESSIONSTREAM"></a>
+ * \brief %ParallelDecompressionStream class decompresses the data compressed by %ParallelCompressionStream.
+ *        The chunks are decompressed in parallel on request, any range of the decompressed data can be accessed
+ *        without decompressing the chunks that do not overlap with the range.
+ * <!-- \n<a href="DAAL-REF-COMPRESSION">Data compression usage model</a> -->
+ *
+ * \par References
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref DecompressorImpl class
+ */
+class DAAL_EXPORT ParallelDecompressionStream : public Base
+{
+public:
+    /**
+     * \brief %ParallelDecompressionStream constructor
+     * \param decompr Pointer to a specific Decompressor used for decompression.
+     *                Its copies are used to decompress the chunks in parallel; the chunks are decompressed sequentially
+     *                with this decompressor if it cannot be copied
+     */
+    ParallelDecompressionStream(DecompressorImpl * decompr);
+    virtual ~ParallelDecompressionStream() DAAL_C11_OVERRIDE;
+    /**
+     * Writes the next part of the compressed data to %ParallelDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock with compressed data
+     */
+    virtual void push_back(DataBlock * inBlock);
+    /**
+     * Writes the next part of the compressed data to %ParallelDecompressionStream
+     * \param[in] inBlock  Pointer to the next DataBlock with compressed data
+     */
+    virtual void operator<<(DataBlock * inBlock) { push_back(inBlock); }
+    /**
+     * Writes the next part of the compressed data to %ParallelDecompressionStream
+     * \param[in] inBlock  Next DataBlock with compressed data
+     */
+    virtual void operator<<(DataBlock inBlock) { push_back(&inBlock); }
+    /**
+     * Returns the size of the decompressed data stored in %ParallelDecompressionStream.
+     * Requires all the compressed data to be written to the stream
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+    /**
+     * Returns the number of the chunks stored in %ParallelDecompressionStream
+     * \return Number of the chunks
+     */
+    virtual size_t getNumberOfChunks();
+    /**
+     * Decompresses the next part of the data to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte * outPtr, size_t outSize);
+    /**
+     * Decompresses the part of the data that starts at the given position to an external array.
+     * Only the chunks that overlap with the requested range are decompressed
+     * \param[in]  offset  Position in bytes in the decompressed data
+     * \param[out] outPtr  Pointer to the array where decompressed data is stored
+     * \param[in]  outSize Number of bytes to decompress
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(size_t offset, byte * outPtr, size_t outSize);
+    /**
+     * Decompresses the next part of the data to an external DataBlock
+     * \param[out] outBlock Reference to the DataBlock where decompressed data is stored
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(DataBlock & outBlock) { return copyDecompressedArray(outBlock.getPtr(), outBlock.getSize()); }
+
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    void * _data;
+    void * _index;
+
+    DecompressorImpl * _decompressor;
+    size_t _dataSize;
+    size_t _dataCapacity;
+    size_t _nChunks;
+
+    size_t _readPos;
+
+    bool readIndex();
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+};
 } // namespace interface1
 using interface1::CompressionStream;
 using interface1::DecompressionStream;
+using interface1::ParallelCompressionStream;
+using interface1::ParallelDecompressionStream;
 /** @} */
 
 } //namespace data_management
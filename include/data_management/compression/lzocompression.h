@@ -113,6 +113,7 @@ public:
 
 protected:
     void initialize();
+    Compressor<lzo> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _next_in;
@@ -177,6 +178,7 @@ public:
 
 protected:
     void initialize();
+    Decompressor<lzo> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _next_in;
@@ -109,6 +109,7 @@ public:
 
 protected:
     void initialize();
+    Compressor<rle> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _next_in;
@@ -168,6 +169,7 @@ public:
 
 protected:
     void initialize();
+    Decompressor<rle> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _next_in;
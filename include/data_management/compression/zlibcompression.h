@@ -113,6 +113,7 @@ public:
 
 protected:
     void initialize();
+    Compressor<zlib> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _strmp;
@@ -170,6 +171,7 @@ public:
 
 protected:
     void initialize();
+    Decompressor<zlib> * cloneImpl() const DAAL_C11_OVERRIDE;
 
 private:
     void * _strmp;
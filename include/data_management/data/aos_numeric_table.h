@@ -311,7 +311,7 @@ protected:
         if (size == 0)
             return services::Status(getNumberOfRows() == 0 ? services::ErrorIncorrectNumberOfObservations : services::ErrorIncorrectNumberOfFeatures);
 
-        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size), services::ServiceDeleter());
+        _ptr = services::SharedPtr<byte>((byte *)daal::services::internal::daal_malloc_table_data(size), services::ServiceDeleter());
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
 
         _memStatus = internallyAllocated;
@@ -327,11 +327,11 @@ protected:
         size_t sizeOfRowInDict = 0;
         for (size_t i = 0; i < ncols; ++i)
         {
-            if (!(*_ddict)[i].typeSize)
+            if (!_ddict->getFeature(i).typeSize)
             {
                 return false;
             }
-            sizeOfRowInDict += (*_ddict)[i].typeSize;
+            sizeOfRowInDict += _ddict->getFeature(i).typeSize;
         }
         if (sizeOfRowInDict > _structSize)
         {
@@ -361,7 +361,7 @@ protected:
         for (size_t i = 0; i < ncols; ++i)
         {
             _offsets[i] = offset;
-            offset += (*_ddict)[i].typeSize;
+            offset += _ddict->getFeature(i).typeSize;
         }
         _structSize = offset;
 
@@ -387,13 +387,20 @@ protected:
         }
         arch->set((char *)_offsets, getNumberOfColumns() * sizeof(size_t));
 
+        size_t size = getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The table refers to the data of the archive when it is possible, e.g. for the archive mapped from a file */
+            freeDataMemoryImpl();
+            if (arch->setArrayInPlace(_ptr, size * _structSize))
+            {
+                _memStatus = internallyAllocated;
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfRows();
-
         arch->set((char *)_ptr.get(), size * _structSize);
 
         return services::Status();
@@ -415,6 +422,8 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (!(rwFlag & (int)readOnly)) return services::Status();
@@ -423,7 +432,7 @@ private:
 
         for (size_t j = 0; j < ncols; j++)
         {
-            NumericTableFeature & f = (*_ddict)[j];
+            const NumericTableFeature & f = _ddict->getFeature(j);
 
             char * location = ptr + _offsets[j];
 
@@ -448,7 +457,7 @@ private:
 
             for (size_t j = 0; j < ncols; j++)
             {
-                NumericTableFeature & f = (*_ddict)[j];
+                const NumericTableFeature & f = _ddict->getFeature(j);
 
                 char * location = ptr + _offsets[j];
 
@@ -474,12 +483,14 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if ((block.getRWFlag() & (int)readOnly))
         {
-            NumericTableFeature & f = (*_ddict)[feat_idx];
-            char * ptr              = (char *)(_ptr.get()) + _structSize * idx + _offsets[feat_idx];
+            const NumericTableFeature & f = _ddict->getFeature(feat_idx);
+            char * ptr                    = (char *)(_ptr.get()) + _structSize * idx + _offsets[feat_idx];
             internal::getVectorStrideUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, ptr, _structSize, block.getBlockPtr(),
                                                                                                sizeof(T));
         }
@@ -493,7 +504,7 @@ private:
         {
             size_t feat_idx = block.getColumnsOffset();
 
-            NumericTableFeature & f = (*_ddict)[feat_idx];
+            const NumericTableFeature & f = _ddict->getFeature(feat_idx);
 
             char * ptr = (char *)(_ptr.get()) + _structSize * block.getRowsOffset() + _offsets[feat_idx];
 
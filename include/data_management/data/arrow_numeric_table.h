@@ -28,13 +28,55 @@
 #include "data_management/data/internal/conversion.h"
 #include "data_management/data/internal/base_arrow_numeric_table.h"
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include <arrow/table.h>
+#include <arrow/record_batch.h>
+#include <arrow/buffer.h>
+#include <arrow/memory_pool.h>
 #include <arrow/util/config.h>
 
 namespace daal
 {
 namespace data_management
 {
+namespace internal
+{
+/* Sets the types of the features of the dictionary from the types of the fields of the Apache Arrow schema */
+inline services::Status setFeaturesFromArrowSchema(const arrow::Schema & schema, NumericTableDictionary & dict)
+{
+    services::Status s;
+    const int ncols = schema.num_fields();
+    for (int col = 0; col < ncols; ++col)
+    {
+        const arrow::Type::type type = schema.field(col)->type()->id();
+        switch (type)
+        {
+        case arrow::Type::UINT8: s |= dict.setFeature<unsigned char>(col); break;
+        case arrow::Type::INT8: s |= dict.setFeature<char>(col); break;
+        case arrow::Type::UINT16: s |= dict.setFeature<unsigned short>(col); break;
+        case arrow::Type::INT16: s |= dict.setFeature<short>(col); break;
+        case arrow::Type::UINT32: s |= dict.setFeature<unsigned int>(col); break;
+        case arrow::Type::DATE32:
+        case arrow::Type::TIME32:
+        case arrow::Type::INT32: s |= dict.setFeature<int>(col); break;
+        case arrow::Type::UINT64: s |= dict.setFeature<DAAL_UINT64>(col); break;
+        case arrow::Type::DATE64:
+        case arrow::Type::TIMESTAMP:
+        case arrow::Type::TIME64:
+        case arrow::Type::INT64: s |= dict.setFeature<DAAL_INT64>(col); break;
+        case arrow::Type::FLOAT: s |= dict.setFeature<float>(col); break;
+        case arrow::Type::DOUBLE: s |= dict.setFeature<double>(col); break;
+        default: s.add(services::ErrorDataTypeNotSupported); return s;
+        }
+        if (!s) return s;
+        dict[col].featureType    = features::DAAL_CONTINUOUS;
+        dict[col].categoryNumber = 0;
+    }
+    return s;
+}
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -161,7 +203,7 @@ protected:
 
         for (size_t i = 0; i < ncol; ++i)
         {
-            const NumericTableFeature & f = (*_ddict)[i];
+            const NumericTableFeature & f = _ddict->getFeature(i);
 
             const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(i);
             DAAL_ASSERT(columnChunkedArrayPtr);
@@ -189,57 +231,78 @@ private:
         _layout    = arrow;
         _memStatus = userAllocated;
         if (st) st |= updateFeatures(*table);
+        if (st) updateChunkOffsets();
     }
 
     std::shared_ptr<const arrow::Table> _table;
+    std::vector<std::vector<int64_t> > _chunkOffsets; /* Indices of the first rows of the chunks for every column */
 
-    DAAL_FORCEINLINE services::Status updateFeatures(const arrow::Table & table)
+    DAAL_FORCEINLINE void updateChunkOffsets()
     {
-        services::Status s;
-        if (_ddict.get() == NULL)
+        const size_t ncols = getNumberOfColumns();
+        _chunkOffsets.resize(ncols);
+        for (size_t col = 0; col < ncols; ++col)
         {
-            _ddict = NumericTableDictionary::create(&s);
-        }
-        if (!s) return s;
+            const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(col);
+            DAAL_ASSERT(columnChunkedArrayPtr);
+            const int chunkCount = columnChunkedArrayPtr->num_chunks();
 
-        const std::shared_ptr<const arrow::Schema> schemaPtr = table.schema();
-        DAAL_ASSERT(schemaPtr);
-        const int ncols = schemaPtr->num_fields();
-        for (int col = 0; col < ncols; ++col)
-        {
-            const arrow::Type::type type = schemaPtr->field(col)->type()->id();
-            switch (type)
+            std::vector<int64_t> & offsets = _chunkOffsets[col];
+            offsets.resize(chunkCount + 1);
+            offsets[0] = 0;
+            for (int chunk = 0; chunk < chunkCount; ++chunk)
             {
-            case arrow::Type::UINT8: s |= setFeature<unsigned char>(col); break;
-            case arrow::Type::INT8: s |= setFeature<char>(col); break;
-            case arrow::Type::UINT16: s |= setFeature<unsigned short>(col); break;
-            case arrow::Type::INT16: s |= setFeature<short>(col); break;
-            case arrow::Type::UINT32: s |= setFeature<unsigned int>(col); break;
-            case arrow::Type::DATE32:
-            case arrow::Type::TIME32:
-            case arrow::Type::INT32: s |= setFeature<int>(col); break;
-            case arrow::Type::UINT64: s |= setFeature<DAAL_UINT64>(col); break;
-            case arrow::Type::DATE64:
-            case arrow::Type::TIMESTAMP:
-            case arrow::Type::TIME64:
-            case arrow::Type::INT64: s |= setFeature<DAAL_INT64>(col); break;
-            case arrow::Type::FLOAT: s |= setFeature<float>(col); break;
-            case arrow::Type::DOUBLE: s |= setFeature<double>(col); break;
-            default: s.add(services::ErrorDataTypeNotSupported); return s;
+                offsets[chunk + 1] = offsets[chunk] + columnChunkedArrayPtr->chunk(chunk)->length();
             }
         }
-        return s;
     }
 
+    /* Returns the index of the chunk of the column that contains the row, rowInChunk is set to the index of the row in the chunk */
+    DAAL_FORCEINLINE int findChunk(size_t col, size_t row, int64_t & rowInChunk) const
+    {
+        const std::vector<int64_t> & offsets = _chunkOffsets[col];
+        const int chunk = (int)(std::upper_bound(offsets.begin(), offsets.end(), (int64_t)row) - offsets.begin()) - 1;
+        DAAL_ASSERT(chunk >= 0 && chunk + 1 < (int)offsets.size());
+        rowInChunk = (int64_t)row - offsets[chunk];
+        return chunk;
+    }
+
+    /* Converts n values of the column starting from the row to the type T, the values may belong to several chunks */
     template <typename T>
-    services::Status setFeature(size_t idx, features::FeatureType featureType = features::DAAL_CONTINUOUS, size_t categoryNumber = 0)
+    DAAL_FORCEINLINE void readColumn(const arrow::ChunkedArray & columnChunkedArray, const NumericTableFeature & f, size_t col, size_t row, size_t n,
+                                     T * dst) const
     {
-        DAAL_ASSERT(_ddict);
-        services::Status s = _ddict->setFeature<T>(idx);
+        internal::vectorConvertFuncType upCast = internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>());
+
+        int64_t rowInChunk = 0;
+        int chunk          = findChunk(col, row, rowInChunk);
+        for (size_t offset = 0; offset < n; ++chunk, rowInChunk = 0)
+        {
+            const std::shared_ptr<const arrow::Array> arrayPtr = columnChunkedArray.chunk(chunk);
+            DAAL_ASSERT(arrayPtr);
+            const size_t nAvailable = (size_t)(arrayPtr->length() - rowInChunk);
+            const size_t nValues    = (n - offset < nAvailable) ? n - offset : nAvailable;
+            if (nValues == 0) continue;
+
+            const char * const ptr = getPtr(arrayPtr, f);
+            DAAL_ASSERT(ptr);
+            upCast(nValues, ptr + rowInChunk * f.typeSize, dst + offset);
+            offset += nValues;
+        }
+    }
+
+    DAAL_FORCEINLINE services::Status updateFeatures(const arrow::Table & table)
+    {
+        services::Status s;
+        if (_ddict.get() == NULL)
+        {
+            _ddict = NumericTableDictionary::create(&s);
+        }
         if (!s) return s;
-        (*_ddict)[idx].featureType    = featureType;
-        (*_ddict)[idx].categoryNumber = categoryNumber;
-        return s;
+
+        const std::shared_ptr<const arrow::Schema> schemaPtr = table.schema();
+        DAAL_ASSERT(schemaPtr);
+        return internal::setFeaturesFromArrowSchema(*schemaPtr, *_ddict);
     }
 
     template <typename T>
@@ -262,6 +325,24 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        /* Rows of the table with one column are returned without copying if they belong to one chunk */
+        if (ncols == 1 && features::internal::getIndexNumType<T>() == _ddict->getFeature(0).indexType)
+        {
+            int64_t rowInChunk                                 = 0;
+            const int chunk                                    = findChunk(0, idx, rowInChunk);
+            const std::shared_ptr<const arrow::Array> arrayPtr = getColumnChunkedArrayPtr(0)->chunk(chunk);
+            DAAL_ASSERT(arrayPtr);
+            if (rowInChunk + (int64_t)nrows <= arrayPtr->length())
+            {
+                const T * const ptr = getPtr<T>(arrayPtr, _ddict->getFeature(0));
+                DAAL_ASSERT(ptr);
+                block.setPtr(const_cast<T *>(ptr + rowInChunk), 1, nrows);
+                return services::Status();
+            }
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
@@ -280,37 +361,9 @@ private:
 
             for (size_t j = 0; j < ncols; ++j)
             {
-                const NumericTableFeature & f = (*_ddict)[j];
-
                 const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(j);
                 DAAL_ASSERT(columnChunkedArrayPtr);
-                const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx + i, di);
-                DAAL_ASSERT(sliceChunkedArrayPtr);
-                const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
-                const int chunkCount                          = sliceChunkedArray.num_chunks();
-                DAAL_ASSERT(chunkCount > 0);
-                if (chunkCount == 1)
-                {
-                    const char * const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, ptr, lbuf);
-                }
-                else
-                {
-                    size_t offset = 0;
-                    for (int chunk = 0; chunk < chunkCount; ++chunk)
-                    {
-                        const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                        DAAL_ASSERT(arrayPtr);
-                        const int64_t chunkLength = arrayPtr->length();
-                        DAAL_ASSERT(chunkLength > 0);
-                        const char * const ptr = getPtr(arrayPtr, f);
-                        DAAL_ASSERT(ptr);
-                        internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, &(lbuf[offset]));
-                        offset += chunkLength;
-                    }
-                    DAAL_ASSERT(offset == di);
-                }
+                readColumn<T>(*columnChunkedArrayPtr, _ddict->getFeature(j), j, idx + i, di, lbuf);
 
                 for (size_t ii = 0; ii < di; ++ii)
                 {
@@ -353,55 +406,37 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        const NumericTableFeature & f = (*_ddict)[featIdx];
+        const NumericTableFeature & f = _ddict->getFeature(featIdx);
 
         const std::shared_ptr<const arrow::ChunkedArray> columnChunkedArrayPtr = getColumnChunkedArrayPtr(featIdx);
         DAAL_ASSERT(columnChunkedArrayPtr);
-        const std::shared_ptr<const arrow::ChunkedArray> sliceChunkedArrayPtr = columnChunkedArrayPtr->Slice(idx, nrows);
-        DAAL_ASSERT(sliceChunkedArrayPtr);
-        const arrow::ChunkedArray & sliceChunkedArray = *sliceChunkedArrayPtr;
-        const int chunkCount                          = sliceChunkedArray.num_chunks();
-        DAAL_ASSERT(chunkCount > 0);
 
-        if (features::internal::getIndexNumType<T>() == f.indexType && chunkCount == 1)
-        {
-            const T * const ptr = getPtr<T>(sliceChunkedArray.chunk(0), f);
-            DAAL_ASSERT(ptr);
-            block.setPtr(const_cast<T * const>(ptr), 1, nrows);
-        }
-        else
+        /* Values that belong to one chunk are returned without copying */
+        if (features::internal::getIndexNumType<T>() == f.indexType)
         {
-            if (!block.resizeBuffer(1, nrows))
+            int64_t rowInChunk                                 = 0;
+            const int chunk                                    = findChunk(featIdx, idx, rowInChunk);
+            const std::shared_ptr<const arrow::Array> arrayPtr = columnChunkedArrayPtr->chunk(chunk);
+            DAAL_ASSERT(arrayPtr);
+            if (rowInChunk + (int64_t)nrows <= arrayPtr->length())
             {
-                return services::Status(services::ErrorMemoryAllocationFailed);
+                const T * const ptr = getPtr<T>(arrayPtr, f);
+                DAAL_ASSERT(ptr);
+                block.setPtr(const_cast<T *>(ptr + rowInChunk), 1, nrows);
+                return services::Status();
             }
+        }
 
-            if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
 
-            if (chunkCount == 1)
-            {
-                const char * const ptr = getPtr(sliceChunkedArray.chunk(0), f);
-                DAAL_ASSERT(ptr);
-                internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, ptr, block.getBlockPtr());
-            }
-            else
-            {
-                size_t offset     = 0;
-                T * const destPtr = block.getBlockPtr();
-                for (int chunk = 0; chunk < chunkCount; ++chunk)
-                {
-                    const std::shared_ptr<const arrow::Array> arrayPtr = sliceChunkedArray.chunk(chunk);
-                    DAAL_ASSERT(arrayPtr);
-                    const int64_t chunkLength = arrayPtr->length();
-                    DAAL_ASSERT(chunkLength > 0);
-                    const char * const ptr = getPtr(arrayPtr, f);
-                    DAAL_ASSERT(ptr);
-                    internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(chunkLength, ptr, destPtr + offset);
-                    offset += chunkLength;
-                }
-                DAAL_ASSERT(offset == di);
-            }
+        if (!block.resizeBuffer(1, nrows))
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
         }
+
+        if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+        readColumn<T>(*columnChunkedArrayPtr, f, featIdx, idx, nrows, block.getBlockPtr());
         return services::Status();
     }
 
@@ -444,10 +479,401 @@ private:
     }
 };
 typedef services::SharedPtr<ArrowImmutableNumericTable> ArrowImmutableNumericTablePtr;
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ARROWMUTABLENUMERICTABLE"></a>
+ *  \brief Class that provides methods to access data stored as a mutable Apache Arrow record batch.
+ *         The values written into the numeric table are stored in the buffers of the arrays of the record batch,
+ *         so the record batch can be passed to Apache Arrow IPC or Flight without copying once the algorithm finishes.
+ */
+class DAAL_EXPORT ArrowMutableNumericTable : public BaseArrowMutableNumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_IMPL();
+
+    /**
+     *  Constructs a numeric table that writes the values into the buffers of the record batch
+     *  \param[in]  batch         Apache Arrow record batch with mutable buffers of the primitive arrays without nulls
+     *  \param[out] stat          Status of the numeric table construction
+     *  \return Numeric table that shares the memory with the record batch
+     */
+    static DAAL_FORCEINLINE services::SharedPtr<ArrowMutableNumericTable> create(const std::shared_ptr<arrow::RecordBatch> & batch,
+                                                                                 services::Status * stat = NULL)
+    {
+        if (!batch)
+        {
+            if (stat)
+            {
+                stat->add(services::ErrorNullPtr);
+            }
+            return services::SharedPtr<ArrowMutableNumericTable>();
+        }
+
+        DAAL_DEFAULT_CREATE_IMPL_EX(ArrowMutableNumericTable, batch);
+    }
+
+    /**
+     *  Constructs a numeric table and allocates the record batch with the given schema in the memory pool,
+     *  the values of the allocated record batch are not initialized
+     *  \param[in]  schema        Apache Arrow schema with the primitive fields
+     *  \param[in]  nRows         Number of rows in the record batch
+     *  \param[out] stat          Status of the numeric table construction
+     *  \param[in]  pool          Apache Arrow memory pool used to allocate the buffers of the record batch
+     *  \return Numeric table that shares the memory with the record batch
+     */
+    static DAAL_FORCEINLINE services::SharedPtr<ArrowMutableNumericTable> create(const std::shared_ptr<arrow::Schema> & schema, size_t nRows,
+                                                                                 services::Status * stat = NULL,
+                                                                                 arrow::MemoryPool * pool = arrow::default_memory_pool())
+    {
+        if (!schema || !pool)
+        {
+            if (stat)
+            {
+                stat->add(services::ErrorNullPtr);
+            }
+            return services::SharedPtr<ArrowMutableNumericTable>();
+        }
+
+        DAAL_DEFAULT_CREATE_IMPL_EX(ArrowMutableNumericTable, schema, nRows, pool);
+    }
+
+    /**
+     *  Returns the record batch that stores the values of the numeric table
+     *  \return Apache Arrow record batch
+     */
+    std::shared_ptr<arrow::RecordBatch> getRecordBatch() const { return _batch; }
+
+    services::Status getBlockOfRows(size_t vectorIdx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vectorIdx, vector_num, rwflag, block);
+    }
+
+    services::Status getBlockOfRows(size_t vectorIdx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vectorIdx, vector_num, rwflag, block);
+    }
+
+    services::Status getBlockOfRows(size_t vectorIdx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vectorIdx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTBlock<double>(block); }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTBlock<float>(block); }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTBlock<int>(block); }
+
+    services::Status getBlockOfColumnValues(size_t featureIdx, size_t vectorIdx, size_t valueNum, ReadWriteMode rwflag,
+                                            BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(featureIdx, vectorIdx, valueNum, rwflag, block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t featureIdx, size_t vectorIdx, size_t valueNum, ReadWriteMode rwflag,
+                                            BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(featureIdx, vectorIdx, valueNum, rwflag, block);
+    }
+
+    services::Status getBlockOfColumnValues(size_t featureIdx, size_t vectorIdx, size_t valueNum, ReadWriteMode rwflag,
+                                            BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(featureIdx, vectorIdx, valueNum, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTFeature<double>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTFeature<float>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTFeature<int>(block); }
+
+protected:
+    services::Status setNumberOfColumnsImpl(size_t ncol) DAAL_C11_OVERRIDE
+    {
+        if (ncol == getNumberOfColumns()) return services::Status();
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::ErrorMethodNotSupported);
+    }
+
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        if (onDeserialize)
+        {
+            return services::Status(services::ErrorMethodNotSupported);
+        }
+
+        NumericTable::serialImpl<Archive, onDeserialize>(arch);
+
+        const size_t ncol = _ddict->getNumberOfFeatures();
+        const size_t nobs = getNumberOfRows();
+
+        for (size_t i = 0; i < ncol; ++i)
+        {
+            arch->set(_columns[i], nobs * _ddict->getFeature(i).typeSize);
+        }
+
+        return services::Status();
+    }
+
+private:
+    DAAL_FORCEINLINE ArrowMutableNumericTable(const std::shared_ptr<arrow::RecordBatch> & batch, services::Status & st)
+        : BaseArrowMutableNumericTable(batch->num_columns(), batch->num_rows(), st), _batch(batch)
+    {
+        _layout    = arrow;
+        _memStatus = userAllocated;
+        if (st) st |= updateFeatures(*batch->schema());
+        if (st) st |= updateColumns();
+    }
+
+    DAAL_FORCEINLINE ArrowMutableNumericTable(const std::shared_ptr<arrow::Schema> & schema, size_t nRows, arrow::MemoryPool * pool,
+                                              services::Status & st)
+        : BaseArrowMutableNumericTable(schema->num_fields(), nRows, st)
+    {
+        _layout    = arrow;
+        _memStatus = userAllocated;
+        if (st) st |= updateFeatures(*schema);
+        if (st) st |= allocateBatch(schema, nRows, pool);
+        if (st) st |= updateColumns();
+    }
+
+    std::shared_ptr<arrow::RecordBatch> _batch;
+    std::vector<char *> _columns; /* Pointers to the first values of the columns in the buffers of the record batch */
+
+    DAAL_FORCEINLINE services::Status updateFeatures(const arrow::Schema & schema)
+    {
+        services::Status s;
+        if (_ddict.get() == NULL)
+        {
+            _ddict = NumericTableDictionary::create(&s);
+        }
+        if (!s) return s;
+
+        return internal::setFeaturesFromArrowSchema(schema, *_ddict);
+    }
+
+    /* Allocates the buffers of the columns with the types of the features, the record batch takes the ownership of the buffers */
+    DAAL_FORCEINLINE services::Status allocateBatch(const std::shared_ptr<arrow::Schema> & schema, size_t nRows, arrow::MemoryPool * pool)
+    {
+        const size_t ncols = getNumberOfColumns();
+        std::vector<std::shared_ptr<arrow::ArrayData> > columns(ncols);
+        for (size_t col = 0; col < ncols; ++col)
+        {
+            const int64_t size = (int64_t)(nRows * _ddict->getFeature(col).typeSize);
+            std::shared_ptr<arrow::Buffer> buffer;
+#if ARROW_VERSION >= 17000
+            arrow::Result<std::unique_ptr<arrow::Buffer> > result = arrow::AllocateBuffer(size, pool);
+            if (result.ok()) buffer = std::move(result).ValueOrDie();
+#else
+            if (!arrow::AllocateBuffer(pool, size, &buffer).ok()) buffer.reset();
+#endif
+            if (!buffer) return services::Status(services::ErrorMemoryAllocationFailed);
+
+            std::vector<std::shared_ptr<arrow::Buffer> > buffers(2);
+            buffers[1]   = buffer;
+            columns[col] = arrow::ArrayData::Make(schema->field((int)col)->type(), (int64_t)nRows, buffers, 0);
+        }
+        _batch = arrow::RecordBatch::Make(schema, (int64_t)nRows, columns);
+        return services::Status();
+    }
+
+    /* Checks that the values of the columns can be written in place and collects the pointers to the first values of the columns */
+    DAAL_FORCEINLINE services::Status updateColumns()
+    {
+        const size_t ncols = getNumberOfColumns();
+        _columns.resize(ncols);
+        for (size_t col = 0; col < ncols; ++col)
+        {
+            const std::shared_ptr<arrow::ArrayData> arrayDataPtr = _batch->column_data((int)col);
+            if (!arrayDataPtr) return services::Status(services::ErrorNullPtr);
+            const arrow::ArrayData & arrayData = *arrayDataPtr;
+
+            if (arrayData.GetNullCount() != 0 || arrayData.length < _batch->num_rows() || arrayData.buffers.size() < 2 || !arrayData.buffers[1]
+                || !arrayData.buffers[1]->is_mutable())
+            {
+                return services::Status(services::ErrorIncorrectParameter);
+            }
+
+            const size_t typeSize = _ddict->getFeature(col).typeSize;
+            _columns[col]         = reinterpret_cast<char *>(arrayData.buffers[1]->mutable_data()) + arrayData.offset * typeSize;
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    DAAL_FORCEINLINE T * getColumnPtr(size_t col, size_t row) const
+    {
+        return reinterpret_cast<T *>(_columns[col]) + row;
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs  = getNumberOfRows();
+        block.setDetails(0, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(ncols, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (rwFlag & (int)writeOnly) resetKnownFiniteness();
+
+        /* Rows of the table with one column are accessed in place */
+        if (ncols == 1 && features::internal::getIndexNumType<T>() == _ddict->getFeature(0).indexType)
+        {
+            block.setPtr(getColumnPtr<T>(0, idx), 1, nrows);
+            return services::Status();
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        if (!block.resizeBuffer(ncols, nrows))
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+        T lbuf[32];
+        size_t di        = 32;
+        T * const buffer = block.getBlockPtr();
+
+        for (size_t i = 0; i < nrows; i += di)
+        {
+            if (i + di > nrows)
+            {
+                di = nrows - i;
+            }
+
+            for (size_t j = 0; j < ncols; ++j)
+            {
+                const NumericTableFeature & f = _ddict->getFeature(j);
+                internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(di, _columns[j] + (idx + i) * f.typeSize, lbuf);
+
+                for (size_t ii = 0; ii < di; ++ii)
+                {
+                    buffer[(i + ii) * ncols + j] = lbuf[ii];
+                }
+            }
+        }
+
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T> & block)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nrows = block.getNumberOfRows();
+        const size_t idx   = block.getRowsOffset();
+        T * const buffer   = block.getBlockPtr();
+
+        if ((block.getRWFlag() & (int)writeOnly) && nrows > 0 && !(ncols == 1 && buffer == getColumnPtr<T>(0, idx)))
+        {
+            resetKnownFiniteness();
+
+            T lbuf[32];
+            size_t di = 32;
+
+            for (size_t i = 0; i < nrows; i += di)
+            {
+                if (i + di > nrows)
+                {
+                    di = nrows - i;
+                }
+
+                for (size_t j = 0; j < ncols; ++j)
+                {
+                    const NumericTableFeature & f = _ddict->getFeature(j);
+
+                    for (size_t ii = 0; ii < di; ++ii)
+                    {
+                        lbuf[ii] = buffer[(i + ii) * ncols + j];
+                    }
+
+                    internal::getVectorDownCast(f.indexType, internal::getConversionDataType<T>())(di, lbuf, _columns[j] + (idx + i) * f.typeSize);
+                }
+            }
+        }
+
+        block.reset();
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t featIdx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t nobs = getNumberOfRows();
+        block.setDetails(featIdx, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(1, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (rwFlag & (int)writeOnly) resetKnownFiniteness();
+
+        const NumericTableFeature & f = _ddict->getFeature(featIdx);
+
+        /* Values of the column of the same type are accessed in place */
+        if (features::internal::getIndexNumType<T>() == f.indexType)
+        {
+            block.setPtr(getColumnPtr<T>(featIdx, idx), 1, nrows);
+            return services::Status();
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        if (!block.resizeBuffer(1, nrows))
+        {
+            return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
+
+        internal::getVectorUpCast(f.indexType, internal::getConversionDataType<T>())(nrows, _columns[featIdx] + idx * f.typeSize,
+                                                                                      block.getBlockPtr());
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTFeature(BlockDescriptor<T> & block)
+    {
+        const size_t featIdx = block.getColumnsOffset();
+        const size_t nrows   = block.getNumberOfRows();
+        const size_t idx     = block.getRowsOffset();
+
+        if ((block.getRWFlag() & (int)writeOnly) && nrows > 0 && block.getBlockPtr() != getColumnPtr<T>(featIdx, idx))
+        {
+            resetKnownFiniteness();
+
+            const NumericTableFeature & f = _ddict->getFeature(featIdx);
+            internal::getVectorDownCast(f.indexType, internal::getConversionDataType<T>())(nrows, block.getBlockPtr(),
+                                                                                            _columns[featIdx] + idx * f.typeSize);
+        }
+
+        block.reset();
+        return services::Status();
+    }
+};
+typedef services::SharedPtr<ArrowMutableNumericTable> ArrowMutableNumericTablePtr;
 /** @} */
 } // namespace interface1
 using interface1::ArrowImmutableNumericTable;
 using interface1::ArrowImmutableNumericTablePtr;
+using interface1::ArrowMutableNumericTable;
+using interface1::ArrowMutableNumericTablePtr;
 
 } // namespace data_management
 } // namespace daal
@@ -0,0 +1,379 @@
+/* file: columnar_file.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the columnar binary file format and of the numeric tables
+//  that map the files into memory.
+//--
+*/
+
+#ifndef __COLUMNAR_FILE_H__
+#define __COLUMNAR_FILE_H__
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data_source/internal/mapped_file.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__COLUMNARFILE"></a>
+ *  \brief Writes numeric tables to the columnar binary files and maps the files into memory as numeric tables.
+ *
+ *  The file starts with the header and with the descriptors of the columns followed by the data sections.
+ *  Each data section starts at the offset aligned to the page size. In the column-major layout every column
+ *  is a separate section of the values of the column type, in the row-major layout the single section
+ *  stores the rows of the values of the same type. Values of float, double and int columns are stored as is,
+ *  values of the other types are stored as doubles.
+ *
+ *  Mapped tables do not copy the data: pages of the file are read on first access and are shared
+ *  with all the processes that map the same file. Modifications of the mapped tables are private to
+ *  the process and are never written back to the file.
+ */
+class ColumnarFile
+{
+public:
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__COLUMNARFILE__LAYOUT"></a>
+     * \brief Layouts of the data in the columnar binary file
+     */
+    enum Layout
+    {
+        rowMajor    = 0, /*!< Rows of the table are stored one after another, the table is mapped as HomogenNumericTable */
+        columnMajor = 1  /*!< Columns of the table are stored one after another, the table is mapped as SOANumericTable */
+    };
+
+    /**
+     *  Writes the numeric table to the file
+     *  \param[in]  fileName  Name of the file
+     *  \param[in]  table     Numeric table to write
+     *  \param[in]  layout    Layout of the data in the file
+     *  \return Status of the operation
+     */
+    static services::Status write(const std::string & fileName, NumericTable & table, Layout layout = columnMajor)
+    {
+        const size_t nRows    = table.getNumberOfRows();
+        const size_t nColumns = table.getNumberOfColumns();
+        DAAL_CHECK(nColumns > 0, services::ErrorIncorrectNumberOfColumns);
+
+        services::Collection<ColumnDescriptor> columns(nColumns);
+        DAAL_CHECK_MALLOC(columns.data());
+
+        Header header;
+        daal::services::internal::daal_memcpy_s(header.magic, sizeof(header.magic), magic(), sizeof(header.magic));
+        header.nRows    = nRows;
+        header.nColumns = nColumns;
+        header.layout   = layout;
+
+        const features::IndexNumType rowType = (layout == rowMajor) ? getRowMajorType(table) : features::DAAL_OTHER_T;
+        DAAL_UINT64 offset                   = alignOffset(sizeof(Header) + nColumns * sizeof(ColumnDescriptor));
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            const features::IndexNumType type = (layout == rowMajor) ? rowType : getStoredType(table, j);
+
+            columns[j].indexType      = type;
+            columns[j].featureType    = table.getFeatureType(j);
+            columns[j].categoryNumber = table.getNumberOfCategories(j);
+            if (layout == columnMajor)
+            {
+                columns[j].offset = offset;
+                offset            = alignOffset(offset + nRows * getTypeSize(type));
+            }
+            else
+            {
+                columns[j].offset = offset + j * getTypeSize(type);
+            }
+        }
+
+        FILE * file = fopen(fileName.c_str(), "wb");
+        DAAL_CHECK(file, services::ErrorOnFileOpen);
+
+        services::Status s;
+        size_t written = sizeof(Header) + nColumns * sizeof(ColumnDescriptor);
+        if (fwrite(&header, sizeof(Header), 1, file) != 1 || fwrite(columns.data(), sizeof(ColumnDescriptor), nColumns, file) != nColumns)
+        {
+            s.add(services::ErrorOnFileWrite);
+        }
+
+        if (s && layout == columnMajor)
+        {
+            for (size_t j = 0; s && j < nColumns; j++)
+            {
+                s |= writePadding(file, columns[j].offset - written);
+                written = columns[j].offset;
+                switch (columns[j].indexType)
+                {
+                case features::DAAL_FLOAT32: s |= writeColumn<float>(file, table, j, nRows); break;
+                case features::DAAL_INT32_S: s |= writeColumn<int>(file, table, j, nRows); break;
+                default: s |= writeColumn<double>(file, table, j, nRows); break;
+                }
+                written += nRows * getTypeSize((features::IndexNumType)columns[j].indexType);
+            }
+        }
+        else if (s)
+        {
+            s |= writePadding(file, columns[0].offset - written);
+            switch (rowType)
+            {
+            case features::DAAL_FLOAT32: s |= writeRows<float>(file, table, nRows); break;
+            case features::DAAL_INT32_S: s |= writeRows<int>(file, table, nRows); break;
+            default: s |= writeRows<double>(file, table, nRows); break;
+            }
+        }
+
+        if (fclose(file) != 0 && s)
+        {
+            s.add(services::ErrorOnFileWrite);
+        }
+        return s;
+    }
+
+    /**
+     *  Maps the file written by ColumnarFile::write() into memory
+     *  \param[in]  fileName  Name of the file
+     *  \param[out] stat      Status of the operation
+     *  \return Numeric table that refers to the mapped data of the file
+     */
+    static NumericTablePtr map(const std::string & fileName, services::Status * stat = NULL)
+    {
+        services::Status s;
+        NumericTablePtr table = mapImpl(fileName, s);
+        services::internal::tryAssignStatusAndThrow(stat, s);
+        return table;
+    }
+
+private:
+    struct Header
+    {
+        char magic[8];
+        DAAL_UINT64 nRows;
+        DAAL_UINT64 nColumns;
+        DAAL_UINT64 layout;
+    };
+
+    struct ColumnDescriptor
+    {
+        DAAL_UINT64 indexType;
+        DAAL_UINT64 featureType;
+        DAAL_UINT64 categoryNumber;
+        DAAL_UINT64 offset;
+    };
+
+    enum
+    {
+        blockSize        = 4096, /* Size of the blocks of rows copied from the table on write */
+        sectionAlignment = 4096  /* Data sections are aligned to the page size so that they can be mapped independently */
+    };
+
+    static const char * magic() { return "DAALCF01"; }
+
+    static DAAL_UINT64 alignOffset(DAAL_UINT64 offset) { return (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment; }
+
+    static size_t getTypeSize(features::IndexNumType type)
+    {
+        switch (type)
+        {
+        case features::DAAL_FLOAT32: return sizeof(float);
+        case features::DAAL_INT32_S: return sizeof(int);
+        default: return sizeof(double);
+        }
+    }
+
+    static features::IndexNumType getStoredType(const NumericTable & table, size_t idx)
+    {
+        NumericTableDictionaryPtr dict = table.getDictionarySharedPtr();
+        if (dict && idx < dict->getNumberOfFeatures())
+        {
+            const features::IndexNumType type = dict->getFeature(idx).indexType;
+            if (type == features::DAAL_FLOAT32 || type == features::DAAL_INT32_S) return type;
+        }
+        return features::DAAL_FLOAT64;
+    }
+
+    /* Rows are stored in the same type if all the columns have it and in double otherwise */
+    static features::IndexNumType getRowMajorType(const NumericTable & table)
+    {
+        const features::IndexNumType type = getStoredType(table, 0);
+        for (size_t j = 1; j < table.getNumberOfColumns(); j++)
+        {
+            if (getStoredType(table, j) != type) return features::DAAL_FLOAT64;
+        }
+        return type;
+    }
+
+    static services::Status writePadding(FILE * file, size_t size)
+    {
+        const char zeros[sectionAlignment] = { 0 };
+        DAAL_CHECK(size <= sectionAlignment, services::ErrorOnFileWrite);
+        DAAL_CHECK(size == 0 || fwrite(zeros, 1, size, file) == size, services::ErrorOnFileWrite);
+        return services::Status();
+    }
+
+    template <typename T>
+    static services::Status writeColumn(FILE * file, NumericTable & table, size_t idx, size_t nRows)
+    {
+        BlockDescriptor<T> block;
+        for (size_t i = 0; i < nRows; i += blockSize)
+        {
+            const size_t n = services::internal::minValue<size_t>(blockSize, nRows - i);
+            DAAL_CHECK_STATUS_VAR(table.getBlockOfColumnValues(idx, i, n, readOnly, block));
+
+            const bool isWritten = (fwrite(block.getBlockPtr(), sizeof(T), n, file) == n);
+            DAAL_CHECK_STATUS_VAR(table.releaseBlockOfColumnValues(block));
+            DAAL_CHECK(isWritten, services::ErrorOnFileWrite);
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    static services::Status writeRows(FILE * file, NumericTable & table, size_t nRows)
+    {
+        const size_t nColumns = table.getNumberOfColumns();
+        BlockDescriptor<T> block;
+        for (size_t i = 0; i < nRows; i += blockSize)
+        {
+            const size_t n = services::internal::minValue<size_t>(blockSize, nRows - i);
+            DAAL_CHECK_STATUS_VAR(table.getBlockOfRows(i, n, readOnly, block));
+
+            const bool isWritten = (fwrite(block.getBlockPtr(), sizeof(T) * nColumns, n, file) == n);
+            DAAL_CHECK_STATUS_VAR(table.releaseBlockOfRows(block));
+            DAAL_CHECK(isWritten, services::ErrorOnFileWrite);
+        }
+        return services::Status();
+    }
+
+    static NumericTablePtr mapImpl(const std::string & fileName, services::Status & s)
+    {
+        services::SharedPtr<internal::MappedFile> file(new internal::MappedFile());
+        if (!file)
+        {
+            s.add(services::ErrorMemoryAllocationFailed);
+            return NumericTablePtr();
+        }
+
+        /* Copy-on-write mapping lets the tables be modified without changing the file */
+        s |= file->open(fileName.c_str(), true);
+        if (!s) return NumericTablePtr();
+
+        const char * data = file->data();
+        const size_t size = file->size();
+
+        Header header;
+        if (size < sizeof(Header))
+        {
+            s.add(services::ErrorIncorrectFileFormat);
+            return NumericTablePtr();
+        }
+        daal::services::internal::daal_memcpy_s(&header, sizeof(Header), data, sizeof(Header));
+
+        const size_t nRows    = (size_t)header.nRows;
+        const size_t nColumns = (size_t)header.nColumns;
+        if (memcmp(header.magic, magic(), sizeof(header.magic)) != 0 || (header.layout != rowMajor && header.layout != columnMajor)
+            || nColumns == 0 || nColumns > (size - sizeof(Header)) / sizeof(ColumnDescriptor))
+        {
+            s.add(services::ErrorIncorrectFileFormat);
+            return NumericTablePtr();
+        }
+
+        const ColumnDescriptor * columns = (const ColumnDescriptor *)(data + sizeof(Header));
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            const features::IndexNumType type = (features::IndexNumType)columns[j].indexType;
+            const size_t typeSize             = getTypeSize(type);
+            const size_t rowSize              = (header.layout == columnMajor) ? typeSize : nColumns * typeSize;
+            const DAAL_UINT64 sectionOffset   = (header.layout == columnMajor) ? columns[j].offset : columns[0].offset;
+
+            if ((type != features::DAAL_FLOAT32 && type != features::DAAL_FLOAT64 && type != features::DAAL_INT32_S)
+                || (header.layout == rowMajor && (type != columns[0].indexType || columns[j].offset != sectionOffset + j * typeSize))
+                || (sectionOffset % sectionAlignment) != 0 || sectionOffset > size || nRows > (size - sectionOffset) / rowSize)
+            {
+                s.add(services::ErrorIncorrectFileFormat);
+                return NumericTablePtr();
+            }
+        }
+
+        NumericTablePtr table;
+        if (header.layout == rowMajor)
+        {
+            switch (columns[0].indexType)
+            {
+            case features::DAAL_FLOAT32: table = mapRows<float>(file, columns[0].offset, nColumns, nRows, s); break;
+            case features::DAAL_INT32_S: table = mapRows<int>(file, columns[0].offset, nColumns, nRows, s); break;
+            default: table = mapRows<double>(file, columns[0].offset, nColumns, nRows, s); break;
+            }
+        }
+        else
+        {
+            SOANumericTablePtr soaTable = SOANumericTable::create(nColumns, nRows, DictionaryIface::notEqual, &s);
+            for (size_t j = 0; s && j < nColumns; j++)
+            {
+                switch (columns[j].indexType)
+                {
+                case features::DAAL_FLOAT32: s |= soaTable->setArray(mapArray<float>(file, columns[j].offset), j); break;
+                case features::DAAL_INT32_S: s |= soaTable->setArray(mapArray<int>(file, columns[j].offset), j); break;
+                default: s |= soaTable->setArray(mapArray<double>(file, columns[j].offset), j); break;
+                }
+            }
+            table = soaTable;
+        }
+        if (!s) return NumericTablePtr();
+
+        NumericTableDictionaryPtr dict = table->getDictionarySharedPtr();
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            (*dict)[j].featureType    = (features::FeatureType)columns[j].featureType;
+            (*dict)[j].categoryNumber = (size_t)columns[j].categoryNumber;
+        }
+        return table;
+    }
+
+    /* The returned pointer shares the ownership of the mapped file */
+    template <typename T>
+    static services::SharedPtr<T> mapArray(const services::SharedPtr<internal::MappedFile> & file, DAAL_UINT64 offset)
+    {
+        return services::SharedPtr<T>(file, (T *)file.get(), (T *)(file->data() + offset));
+    }
+
+    template <typename T>
+    static NumericTablePtr mapRows(const services::SharedPtr<internal::MappedFile> & file, DAAL_UINT64 offset, size_t nColumns, size_t nRows,
+                                   services::Status & s)
+    {
+        return HomogenNumericTable<T>::create(mapArray<T>(file, offset), nColumns, nRows, &s);
+    }
+};
+/** @} */
+} // namespace interface1
+
+using interface1::ColumnarFile;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
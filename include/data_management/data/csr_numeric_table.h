@@ -307,7 +307,7 @@ public:
      *  \param[in] vector_idx       Index of the first row to include into the block.
      *  \param[in] vector_num       Number of rows in the block.
      *  \param[in] rwflag           Flag specifying read/write access to the block of feature vectors.
-     *  \param[out] block           The block of feature values.
+     *  \param[out] block           The block of feature values. Its row offsets and column indices use the indexing scheme of the table.
      *
      *  \return Actual number of feature vectors returned by the method.
      */
@@ -647,7 +647,7 @@ public:
 
         if (nrow == 0) return services::Status(services::ErrorIncorrectNumberOfObservations);
 
-        const NumericTableFeature & f = (*_ddict)[0];
+        const NumericTableFeature & f = _ddict->getFeature(0);
 
         _ptr        = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(dataSize * f.typeSize), services::ServiceDeleter());
         _colIndices = services::SharedPtr<size_t>((size_t *)daal::services::daal_malloc(dataSize * sizeof(size_t)), services::ServiceDeleter());
@@ -679,7 +679,7 @@ public:
         services::Status s;
         DAAL_CHECK_STATUS(s, data_management::NumericTable::check(description, checkDataAllocation));
 
-        if (_indexing != oneBased)
+        if (_indexing != oneBased && _indexing != zeroBased)
         {
             return services::Status(services::Error::create(services::ErrorUnsupportedCSRIndexing, services::ArgumentName, description));
         }
@@ -688,6 +688,9 @@ public:
     }
 
 protected:
+    /* Index of the first element in the row offsets and column indices arrays */
+    size_t getIndexBase() const { return ((_indexing == oneBased) ? 1 : 0); }
+
     NumericTableFeature _defaultFeature;
     CSRIndexing _indexing;
 
@@ -744,7 +747,7 @@ protected:
 
         if (nfeat > 0)
         {
-            NumericTableFeature & f = (*_ddict)[0];
+            const NumericTableFeature & f = _ddict->getFeature(0);
 
             arch->set((char *)_ptr.get(), dataSize * f.typeSize);
             arch->set(_colIndices.get(), dataSize);
@@ -783,12 +786,16 @@ protected:
             return services::Status();
         }
 
-        const NumericTableFeature & f = (*_ddict)[0];
+        /* The rows are always converted to the dense layout */
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        const NumericTableFeature & f = _ddict->getFeature(0);
         const int indexType           = f.indexType;
 
         T * buffer;
         T * castingBuffer;
-        T * location = (T *)(_ptr.get() + (rowOffsets[idx] - 1) * f.typeSize);
+        const size_t base = getIndexBase();
+        T * location      = (T *)(_ptr.get() + (rowOffsets[idx] - base) * f.typeSize);
 
         if (features::internal::getIndexNumType<T>() == indexType)
         {
@@ -812,7 +819,7 @@ protected:
         }
 
         T * bufRowCursor       = castingBuffer;
-        size_t * indicesCursor = _colIndices.get() + rowOffsets[idx] - 1;
+        size_t * indicesCursor = _colIndices.get() + rowOffsets[idx] - base;
 
         for (size_t i = 0; i < ncols * nrows; i++)
         {
@@ -825,7 +832,7 @@ protected:
 
             for (size_t k = 0; k < sparseRowSize; k++)
             {
-                buffer[i * ncols + indicesCursor[k] - 1] = bufRowCursor[k];
+                buffer[i * ncols + indicesCursor[k] - base] = bufRowCursor[k];
             }
 
             bufRowCursor += sparseRowSize;
@@ -856,14 +863,17 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
-        const NumericTableFeature & f = (*_ddict)[0];
+        const NumericTableFeature & f = _ddict->getFeature(0);
         const int indexType           = f.indexType;
         if (data_management::features::DAAL_OTHER_T == indexType) return services::Status(services::ErrorDataTypeNotSupported);
 
-        char * rowCursor       = (char *)_ptr.get() + (rowOffsets[idx] - 1) * f.typeSize;
-        size_t * indicesCursor = _colIndices.get() + (rowOffsets[idx] - 1);
+        const size_t base      = getIndexBase();
+        char * rowCursor       = (char *)_ptr.get() + (rowOffsets[idx] - base) * f.typeSize;
+        size_t * indicesCursor = _colIndices.get() + (rowOffsets[idx] - base);
 
         T * bufferPtr = block.getBlockPtr();
 
@@ -875,7 +885,7 @@ protected:
 
             for (size_t k = 0; k < sparseRowSize; k++)
             {
-                if (indicesCursor[k] - 1 == feat_idx)
+                if (indicesCursor[k] - base == feat_idx)
                 {
                     internal::getVectorUpCast(indexType, internal::getConversionDataType<T>())(1, rowCursor + k * f.typeSize, bufferPtr + i);
                 }
@@ -911,14 +921,16 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        const NumericTableFeature & f = (*_ddict)[0];
+        const NumericTableFeature & f = _ddict->getFeature(0);
         const int indexType           = f.indexType;
 
-        size_t nValues = rowOffsets[idx + nrows] - rowOffsets[idx];
+        /* The block keeps the indexing of the table, so the index arrays are neither converted nor copied for the first block */
+        const size_t base = getIndexBase();
+        size_t nValues    = rowOffsets[idx + nrows] - rowOffsets[idx];
 
         if (features::internal::getIndexNumType<T>() == indexType)
         {
-            block.setValuesPtr(&_ptr, _ptr.get() + (rowOffsets[idx] - 1) * f.typeSize, nValues);
+            block.setValuesPtr(&_ptr, _ptr.get() + (rowOffsets[idx] - base) * f.typeSize, nValues);
         }
         else
         {
@@ -929,11 +941,11 @@ protected:
 
             if (data_management::features::DAAL_OTHER_T == indexType) return services::Status(services::ErrorDataTypeNotSupported);
 
-            services::SharedPtr<byte> location(_ptr, _ptr.get() + (rowOffsets[idx] - 1) * f.typeSize);
+            services::SharedPtr<byte> location(_ptr, _ptr.get() + (rowOffsets[idx] - base) * f.typeSize);
             internal::getVectorUpCast(indexType, internal::getConversionDataType<T>())(nValues, location.get(), block.getBlockValuesPtr());
         }
 
-        services::SharedPtr<size_t> shiftedColumns(_colIndices, _colIndices.get() + (rowOffsets[idx] - 1));
+        services::SharedPtr<size_t> shiftedColumns(_colIndices, _colIndices.get() + (rowOffsets[idx] - base));
         block.setColumnIndicesPtr(shiftedColumns, nValues);
 
         if (idx == 0)
@@ -951,7 +963,7 @@ protected:
 
             for (size_t i = 0; i < nrows + 1; i++)
             {
-                row_offsets[i] = rowOffsets[idx + i] - rowOffsets[idx] + 1;
+                row_offsets[i] = rowOffsets[idx + i] - rowOffsets[idx] + base;
             }
         }
         return services::Status();
@@ -962,8 +974,8 @@ protected:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
-            NumericTableFeature & f = (*_ddict)[0];
-            const int indexType     = f.indexType;
+            const NumericTableFeature & f = _ddict->getFeature(0);
+            const int indexType           = f.indexType;
 
             if (data_management::features::DAAL_OTHER_T == indexType && features::internal::getIndexNumType<T>() != indexType)
             {
@@ -978,7 +990,8 @@ protected:
                 size_t nValues = _rowOffsets.get()[idx + nrows] - _rowOffsets.get()[idx];
 
                 services::SharedPtr<byte> ptr      = services::reinterpretPointerCast<byte, T>(block.getBlockValuesSharedPtr());
-                services::SharedPtr<byte> location = services::SharedPtr<byte>(ptr, _ptr.get() + (_rowOffsets.get()[idx] - 1) * f.typeSize);
+                services::SharedPtr<byte> location =
+                    services::SharedPtr<byte>(ptr, _ptr.get() + (_rowOffsets.get()[idx] - getIndexBase()) * f.typeSize);
 
                 internal::getVectorDownCast(indexType, internal::getConversionDataType<T>())(nValues, ptr.get(), location.get());
             }
@@ -35,6 +35,7 @@
 #include "data_management/data/data_collection.h"
 #include "data_management/features/defines.h"
 #include "data_management/compression/compression_stream.h"
+#include "data_management/data_source/internal/mapped_file.h"
 
 namespace daal
 {
@@ -70,6 +71,14 @@ public:
      */
     virtual void read(byte * ptr, size_t size) = 0;
 
+    /**
+     *  Returns the pointer to the next part of an archive without copying it, if the archive keeps its content
+     *  in memory that can be shared with the deserialized objects
+     *  \param[in]  size Size of the data array
+     *  \return Pointer to the data, empty if the data is to be copied with read()
+     */
+    virtual services::SharedPtr<byte> readInPlace(size_t /*size*/) { return services::SharedPtr<byte>(); }
+
     /**
      *  Returns the size of an archive
      *  \return Size of the archive in bytes
@@ -166,6 +175,20 @@ public:
     int getUpdateVersion() DAAL_C11_OVERRIDE { return _updateVersion; }
 
 protected:
+    inline size_t alignValueUp(size_t value)
+    {
+        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        {
+            return value;
+        }
+
+        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
+
+        size_t alignedValue = value + alignm1;
+        alignedValue &= ~alignm1;
+        return alignedValue;
+    }
+
     int _majorVersion;
     int _minorVersion;
     int _updateVersion;
@@ -200,7 +223,7 @@ public:
     /**
      *  Copy constructor of a data archive
      */
-    DataArchive(const DataArchive & arch) : minBlocksNum(16), minBlockSize(1024 * 16)
+    DataArchive(const DataArchive & arch) : _errors(new services::ErrorCollection()), minBlocksNum(16), minBlockSize(1024 * 16)
     {
         blockPtr           = 0;
         blockAllocatedSize = 0;
@@ -240,7 +263,7 @@ public:
 
         addBlock(size);
 
-        int result = daal::services::internal::daal_memcpy_s(blockPtr[currentWriteBlock], size, ptr, size);
+        int result = copyMemory(blockPtr[currentWriteBlock], size, ptr, size);
         if (result)
         {
             this->_errors->add(services::ErrorMemoryCopyFailedInternal);
@@ -280,7 +303,7 @@ public:
 
         size_t offset = blockOffset[currentWriteBlock];
 
-        int result = daal::services::internal::daal_memcpy_s(&(blockPtr[currentWriteBlock][offset]), alignedSize, ptr, size);
+        int result = copyMemory(&(blockPtr[currentWriteBlock][offset]), alignedSize, ptr, size);
         if (result)
         {
             this->_errors->add(services::ErrorMemoryCopyFailedInternal);
@@ -303,7 +326,7 @@ public:
             return;
         }
 
-        int result = daal::services::internal::daal_memcpy_s(ptr, size, &(blockPtr[currentReadBlock][currentReadBlockOffset]), size);
+        int result = copyMemory(ptr, size, &(blockPtr[currentReadBlock][currentReadBlockOffset]), size);
         if (result)
         {
             this->_errors->add(services::ErrorMemoryCopyFailedInternal);
@@ -396,7 +419,7 @@ public:
         {
             size_t blockSize = blockOffset[i];
 
-            result |= daal::services::internal::daal_memcpy_s(&(ptr[offset]), blockSize, blockPtr[i], blockSize);
+            result |= copyMemory(&(ptr[offset]), blockSize, blockPtr[i], blockSize);
 
             offset += blockSize;
         }
@@ -425,9 +448,12 @@ protected:
             size_t * oldBlockOffset        = blockOffset;
             int result                     = 0;
 
-            blockPtr           = (byte **)daal::services::daal_malloc(sizeof(byte *) * (arraysSize + minBlocksNum));
-            blockAllocatedSize = (size_t *)daal::services::daal_malloc(sizeof(size_t) * (arraysSize + minBlocksNum));
-            blockOffset        = (size_t *)daal::services::daal_malloc(sizeof(size_t) * (arraysSize + minBlocksNum));
+            /* Arrays of blocks grow geometrically, so that appending a block takes amortized constant time */
+            const int newArraysSize = arraysSize + ((arraysSize > minBlocksNum) ? arraysSize : minBlocksNum);
+
+            blockPtr           = (byte **)daal::services::daal_malloc(sizeof(byte *) * newArraysSize);
+            blockAllocatedSize = (size_t *)daal::services::daal_malloc(sizeof(size_t) * newArraysSize);
+            blockOffset        = (size_t *)daal::services::daal_malloc(sizeof(size_t) * newArraysSize);
 
             if (blockPtr == 0 || blockAllocatedSize == 0 || blockOffset == 0)
             {
@@ -448,35 +474,68 @@ protected:
             daal::services::daal_free(oldBlockAllocatedSize);
             daal::services::daal_free(oldBlockOffset);
 
-            arraysSize += minBlocksNum;
+            arraysSize = newArraysSize;
         }
 
-        currentWriteBlock++;
+        /* Every next block is twice as large as the previous one up to maxBlockSize,
+           so that serialization of many small values does not allocate many small blocks */
+        size_t allocationSize = minBlockSize;
+        if (currentWriteBlock >= 0)
+        {
+            const size_t lastBlockSize = blockAllocatedSize[currentWriteBlock];
+            allocationSize             = (lastBlockSize < maxBlockSize / 2) ? 2 * lastBlockSize : (size_t)maxBlockSize;
+            if (allocationSize < minBlockSize) allocationSize = minBlockSize;
+        }
+        if (allocationSize < minNewSize) allocationSize = minNewSize;
 
-        size_t allocationSize = (minBlockSize > minNewSize) ? minBlockSize : minNewSize;
+        currentWriteBlock++;
 
         blockPtr[currentWriteBlock]           = (byte *)daal::services::daal_malloc(allocationSize);
         blockAllocatedSize[currentWriteBlock] = allocationSize;
         blockOffset[currentWriteBlock]        = 0;
     }
 
-    inline size_t alignValueUp(size_t value)
+    /**
+     *  Copies the array, large arrays are copied in parallel by chunks with a single memcpy per chunk
+     *  \return Non-zero value if the copying failed
+     */
+    static int copyMemory(byte * dst, size_t dstSize, const byte * src, size_t size)
     {
-        if (_majorVersion == 2016 && _minorVersion == 0 && _updateVersion == 0)
+        if (size < parallelCopyThreshold || !dst || !src || dstSize < size)
         {
-            return value;
+            return daal::services::internal::daal_memcpy_s(dst, dstSize, src, size);
         }
 
-        size_t alignm1 = DAAL_MALLOC_DEFAULT_ALIGNMENT - 1;
-
-        size_t alignedValue = value + alignm1;
-        alignedValue &= ~alignm1;
-        return alignedValue;
+        internal::parallelFor((size + copyChunkSize - 1) / copyChunkSize, CopyTask(dst, src, size));
+        return 0;
     }
 
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
+    enum
+    {
+        maxBlockSize          = 64 * 1024 * 1024, /* Maximal size of the block allocated for the values smaller than the block */
+        parallelCopyThreshold = 16 * 1024 * 1024, /* Arrays of this size and larger are copied in parallel */
+        copyChunkSize         = 4 * 1024 * 1024   /* Size of the chunks of arrays copied in parallel */
+    };
+
+    struct CopyTask
+    {
+        CopyTask(byte * dst, const byte * src, size_t size) : _dst(dst), _src(src), _size(size) {}
+
+        void operator()(size_t i) const
+        {
+            const size_t offset = i * copyChunkSize;
+            const size_t size   = (_size - offset < copyChunkSize) ? _size - offset : (size_t)copyChunkSize;
+            daal::services::internal::daal_memcpy_s(_dst + offset, size, _src + offset, size);
+        }
+
+        byte * _dst;
+        const byte * _src;
+        size_t _size;
+    };
+
     int minBlocksNum;
     size_t minBlockSize;
 
@@ -733,6 +792,459 @@ private:
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__MAPPEDDATAARCHIVE"></a>
+ *  \brief Read-only data archive that maps a file with the serialized data into memory.
+ *  Deserialized numeric tables refer to the data in the mapped file instead of copying it,
+ *  so that the pages of the file are shared by all the processes that deserialize the same file
+ */
+class MappedDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive from a file
+     *  \param[in]  fileName  Name of the file with the data archive written by InputDataArchive::copyArchiveToArray()
+     */
+    MappedDataArchive(const char * fileName) : _errors(new services::ErrorCollection()), _file(new internal::MappedFile()), _readOffset(0)
+    {
+        services::Status s = _file->open(fileName, true);
+        if (!s)
+        {
+            this->_errors->add(*s.getCollection());
+        }
+    }
+
+    ~MappedDataArchive() DAAL_C11_OVERRIDE {}
+
+    void write(byte * /*ptr*/, size_t /*size*/) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotImplemented); }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        if (_file->size() < _readOffset + alignedSize)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, size, _file->data() + _readOffset, size);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+
+        _readOffset += alignedSize;
+    }
+
+    services::SharedPtr<byte> readInPlace(size_t size) DAAL_C11_OVERRIDE
+    {
+        size_t alignedSize = alignValueUp(size);
+        if (size == 0 || _file->size() < _readOffset + alignedSize)
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        /* The data of archives written without alignment is copied */
+        byte * ptr = (byte *)(_file->data() + _readOffset);
+        if ((size_t)ptr & (DAAL_MALLOC_DEFAULT_ALIGNMENT - 1))
+        {
+            return services::SharedPtr<byte>();
+        }
+
+        _readOffset += alignedSize;
+        return services::SharedPtr<byte>(_file, (byte *)_file.get(), ptr);
+    }
+
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _file->size(); }
+
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        if (_file->size() == 0)
+        {
+            return services::SharedPtr<byte>();
+        }
+        return services::SharedPtr<byte>(_file, (byte *)_file.get(), (byte *)_file->data());
+    }
+
+    byte * getArchiveAsArray() DAAL_C11_OVERRIDE { return (byte *)_file->data(); }
+
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE { return std::string(_file->data(), _file->size()); }
+
+    size_t copyArchiveToArray(byte * ptr, size_t maxLength) const DAAL_C11_OVERRIDE
+    {
+        size_t length = getSizeOfArchive();
+
+        if (length == 0 || length > maxLength)
+        {
+            return length;
+        }
+
+        int result = daal::services::internal::daal_memcpy_s(ptr, maxLength, _file->data(), length);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return 0;
+        }
+
+        return length;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    services::SharedPtr<services::ErrorCollection> _errors;
+    services::SharedPtr<internal::MappedFile> _file;
+    size_t _readOffset;
+
+    MappedDataArchive(const MappedDataArchive &);
+    MappedDataArchive & operator=(const MappedDataArchive &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DATAARCHIVESINKIFACE"></a>
+ *  \brief Abstract interface class for the destination of a streaming data archive, e.g. a file or a socket
+ */
+class DataArchiveSinkIface : public Base
+{
+public:
+    ~DataArchiveSinkIface() DAAL_C11_OVERRIDE {}
+
+    /**
+     *  Consumes the next part of the serialized data
+     *  \param[in]  ptr  Pointer to the data, valid only until the method returns
+     *  \param[in]  size Size of the data in bytes
+     *  \return Status of the operation
+     */
+    virtual services::Status write(const byte * ptr, size_t size) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__DATAARCHIVESOURCEIFACE"></a>
+ *  \brief Abstract interface class for the origin of a streaming data archive, e.g. a file or a socket
+ */
+class DataArchiveSourceIface : public Base
+{
+public:
+    ~DataArchiveSourceIface() DAAL_C11_OVERRIDE {}
+
+    /**
+     *  Produces the next part of the serialized data
+     *  \param[out] ptr  Pointer to the memory for the data
+     *  \param[in]  size Maximal size of the data in bytes
+     *  \return Number of bytes copied to ptr, zero if the end of the data is reached
+     */
+    virtual size_t read(byte * ptr, size_t size) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__STREAMINGDATAARCHIVE"></a>
+ *  \brief Data archive that passes the serialized data to the sink by chunks of bounded size
+ *  or receives the data to deserialize from the source, the whole archive is never kept in memory
+ */
+class StreamingDataArchive : public DataArchiveImpl
+{
+public:
+    /**
+     *  Constructor of a data archive that writes to the sink
+     *  \param[in]  sink        Sink of the serialized data, must outlive the archive
+     *  \param[in]  bufferSize  Size of the chunks passed to the sink, except the large arrays passed as is
+     */
+    StreamingDataArchive(DataArchiveSinkIface * sink, size_t bufferSize = 1024 * 1024)
+        : _errors(new services::ErrorCollection()), _sink(sink), _source(NULL), _bufferSize(bufferSize), _bufferOffset(0), _bufferEnd(0), _size(0)
+    {
+        initialize();
+    }
+
+    /**
+     *  Constructor of a data archive that reads from the source.
+     *  The archive reads the source by chunks and may request more data than it deserializes,
+     *  so the source is expected to end with the archive
+     *  \param[in]  source      Source of the serialized data, must outlive the archive
+     *  \param[in]  bufferSize  Size of the chunks requested from the source, except for the large arrays read as is
+     */
+    StreamingDataArchive(DataArchiveSourceIface * source, size_t bufferSize = 1024 * 1024)
+        : _errors(new services::ErrorCollection()), _sink(NULL), _source(source), _bufferSize(bufferSize), _bufferOffset(0), _bufferEnd(0), _size(0)
+    {
+        initialize();
+    }
+
+    /**
+     *  Passes the rest of the buffered data to the sink
+     */
+    ~StreamingDataArchive() DAAL_C11_OVERRIDE { flush(); }
+
+    void write(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        if (!_sink || !_buffer)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        const size_t alignedSize = alignValueUp(size);
+        if (_bufferOffset + alignedSize > _bufferSize)
+        {
+            flush();
+        }
+
+        if (alignedSize > _bufferSize)
+        {
+            /* Large arrays are passed to the sink without copying, followed by the padding */
+            writeToSink(ptr, size);
+            for (size_t i = 0; i < alignedSize - size; i++)
+            {
+                _buffer.get()[i] = 0;
+            }
+            writeToSink(_buffer.get(), alignedSize - size);
+        }
+        else
+        {
+            int result = daal::services::internal::daal_memcpy_s(_buffer.get() + _bufferOffset, _bufferSize - _bufferOffset, ptr, size);
+            if (result)
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return;
+            }
+            for (size_t i = size; i < alignedSize; i++)
+            {
+                _buffer.get()[_bufferOffset + i] = 0;
+            }
+            _bufferOffset += alignedSize;
+        }
+        _size += alignedSize;
+    }
+
+    void read(byte * ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        if (!_source || !_buffer)
+        {
+            this->_errors->add(services::ErrorDataArchiveInternal);
+            return;
+        }
+
+        const size_t alignedSize = alignValueUp(size);
+
+        /* The buffered data is copied first, large arrays are read from the source directly into ptr */
+        size_t nCopied = (_bufferEnd - _bufferOffset < size) ? _bufferEnd - _bufferOffset : size;
+        int result     = daal::services::internal::daal_memcpy_s(ptr, size, _buffer.get() + _bufferOffset, nCopied);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        _bufferOffset += nCopied;
+
+        if (nCopied < size)
+        {
+            if (size - nCopied >= _bufferSize)
+            {
+                if (!readFromSource(ptr + nCopied, size - nCopied)) return;
+            }
+            else
+            {
+                if (!fillBuffer(size - nCopied)) return;
+                result = daal::services::internal::daal_memcpy_s(ptr + nCopied, size - nCopied, _buffer.get(), size - nCopied);
+                if (result)
+                {
+                    this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                    return;
+                }
+                _bufferOffset = size - nCopied;
+            }
+        }
+
+        /* Skip the padding */
+        size_t padding  = alignedSize - size;
+        size_t nSkipped = (_bufferEnd - _bufferOffset < padding) ? _bufferEnd - _bufferOffset : padding;
+        _bufferOffset += nSkipped;
+        if (nSkipped < padding)
+        {
+            if (!fillBuffer(padding - nSkipped)) return;
+            _bufferOffset = padding - nSkipped;
+        }
+        _size += alignedSize;
+    }
+
+    /**
+     *  Passes the buffered data to the sink
+     */
+    void flush()
+    {
+        if (_sink && _bufferOffset)
+        {
+            writeToSink(_buffer.get(), _bufferOffset);
+            _bufferOffset = 0;
+        }
+    }
+
+    /**
+     *  Returns the number of bytes written to or read from the archive
+     *  \return Size of the archive in bytes
+     */
+    size_t getSizeOfArchive() const DAAL_C11_OVERRIDE { return _size; }
+
+    /**
+     *  The streaming archive does not keep its content, the method returns an empty pointer
+     */
+    services::SharedPtr<byte> getArchiveAsArraySharedPtr() const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotImplemented);
+        return services::SharedPtr<byte>();
+    }
+
+    /**
+     *  The streaming archive does not keep its content, the method returns an empty string
+     */
+    std::string getArchiveAsString() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotImplemented);
+        return std::string();
+    }
+
+    /**
+     *  The streaming archive does not keep its content, the method copies nothing
+     *  \return Zero
+     */
+    size_t copyArchiveToArray(byte * /*ptr*/, size_t /*maxLength*/) const DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotImplemented);
+        return 0;
+    }
+
+    /**
+     * Returns errors during the computation
+     * \return Errors during the computation
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
+
+private:
+    void initialize()
+    {
+        if (_bufferSize < DAAL_MALLOC_DEFAULT_ALIGNMENT) _bufferSize = DAAL_MALLOC_DEFAULT_ALIGNMENT;
+        _buffer = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(_bufferSize), services::ServiceDeleter());
+        if (!_buffer) this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+
+    void writeToSink(const byte * ptr, size_t size)
+    {
+        if (size == 0) return;
+        services::Status s = _sink->write(ptr, size);
+        if (!s) this->_errors->add(*s.getCollection());
+    }
+
+    bool readFromSource(byte * ptr, size_t size)
+    {
+        for (size_t offset = 0; offset < size;)
+        {
+            const size_t nRead = _source->read(ptr + offset, size - offset);
+            if (nRead == 0)
+            {
+                this->_errors->add(services::ErrorDataArchiveInternal);
+                return false;
+            }
+            offset += nRead;
+        }
+        return true;
+    }
+
+    /* Reads at least minSize bytes into the empty buffer */
+    bool fillBuffer(size_t minSize)
+    {
+        _bufferOffset = 0;
+        _bufferEnd    = 0;
+        while (_bufferEnd < minSize)
+        {
+            const size_t nRead = _source->read(_buffer.get() + _bufferEnd, _bufferSize - _bufferEnd);
+            if (nRead == 0)
+            {
+                this->_errors->add(services::ErrorDataArchiveInternal);
+                return false;
+            }
+            _bufferEnd += nRead;
+        }
+        return true;
+    }
+
+    services::SharedPtr<services::ErrorCollection> _errors;
+    DataArchiveSinkIface * _sink;
+    DataArchiveSourceIface * _source;
+    services::SharedPtr<byte> _buffer;
+    size_t _bufferSize;
+    size_t _bufferOffset;
+    size_t _bufferEnd;
+    size_t _size;
+
+    StreamingDataArchive(const StreamingDataArchive &);
+    StreamingDataArchive & operator=(const StreamingDataArchive &);
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__BYTESHUFFLE"></a>
+ *  \brief Groups the bytes of the array elements by their positions within the elements.
+ *  The bytes of the same kind, e.g. the exponents of floating-point values, are stored together after the shuffle,
+ *  which makes the arrays of numbers compress much better. The arrays are shuffled by blocks of blockBytes bytes
+ */
+class ByteShuffle
+{
+public:
+    static const size_t blockBytes = 16384; /*!< Size in bytes of the block of the array shuffled at once */
+
+    /**
+     *  Returns true if the arrays of elements of the given size are shuffled
+     *  \param[in]   elementSize  Size of the array element in bytes
+     */
+    static bool isApplicable(size_t elementSize) { return elementSize > 1 && elementSize <= blockBytes; }
+
+    /**
+     *  Shuffles the bytes of the array of elements
+     *  \param[in]   src          Array to shuffle
+     *  \param[out]  dst          Shuffled array, the j-th bytes of the elements follow the (j - 1)-th bytes
+     *  \param[in]   nElements    Number of the elements in the array
+     *  \param[in]   elementSize  Size of the array element in bytes
+     */
+    static void shuffle(const byte * src, byte * dst, size_t nElements, size_t elementSize)
+    {
+        for (size_t j = 0; j < elementSize; j++)
+        {
+            for (size_t i = 0; i < nElements; i++)
+            {
+                dst[j * nElements + i] = src[i * elementSize + j];
+            }
+        }
+    }
+
+    /**
+     *  Restores the array of elements from its shuffled counterpart
+     *  \param[in]   src          Shuffled array
+     *  \param[out]  dst          Restored array
+     *  \param[in]   nElements    Number of the elements in the array
+     *  \param[in]   elementSize  Size of the array element in bytes
+     */
+    static void unshuffle(const byte * src, byte * dst, size_t nElements, size_t elementSize)
+    {
+        for (size_t j = 0; j < elementSize; j++)
+        {
+            for (size_t i = 0; i < nElements; i++)
+            {
+                dst[i * elementSize + j] = src[j * nElements + i];
+            }
+        }
+    }
+};
+
+/**
+ *  Flags stored in the header of the data archive
+ */
+enum DataArchiveFlags
+{
+    shuffledArrays = 0x1 /*!< Arrays of numeric tables are stored with their bytes shuffled by ByteShuffle */
+};
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INPUTDATAARCHIVE"></a>
  *  \brief Provides methods to create an archive data object (serialized) and access this object
@@ -743,7 +1255,7 @@ public:
     /**
      *  Default constructor
      */
-    InputDataArchive() : _finalized(false), _errors(new services::ErrorCollection())
+    InputDataArchive() : _finalized(false), _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = new DataArchive;
         archiveHeader();
@@ -754,16 +1266,18 @@ public:
      *  The new InputDataArchive object will own the provided pointer
      *  and free it when it gets deleted.
      */
-    InputDataArchive(DataArchiveIface * arch) : _finalized(false), _errors(new services::ErrorCollection())
+    InputDataArchive(DataArchiveIface * arch) : _finalized(false), _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = arch;
         archiveHeader();
     }
 
     /**
-     *  Constructor of an input data archive to a byte array of compressed data
+     *  Constructor of an input data archive to a byte array of compressed data.
+     *  The arrays of numeric tables are byte-shuffled before the compression
      */
-    InputDataArchive(daal::data_management::CompressorImpl * compressor) : _finalized(false), _errors(new services::ErrorCollection())
+    InputDataArchive(daal::data_management::CompressorImpl * compressor)
+        : _finalized(false), _shuffleArrays(true), _errors(new services::ErrorCollection())
     {
         _arch = new CompressedDataArchive(compressor);
         archiveHeader();
@@ -776,7 +1290,9 @@ public:
      */
     void archiveHeader()
     {
-        int headerValues[8] = { 0x4441414C, __INTEL_DAAL__, __INTEL_DAAL_MINOR__, __INTEL_DAAL_UPDATE__, 0, 0, 0, 0 };
+        int headerValues[8] = {
+            0x4441414C, __INTEL_DAAL__, __INTEL_DAAL_MINOR__, __INTEL_DAAL_UPDATE__, (_shuffleArrays ? (int)shuffledArrays : 0), 0, 0, 0
+        };
 
         _arch->setMajorVersion(headerValues[1]);
         _arch->setMinorVersion(headerValues[2]);
@@ -841,6 +1357,36 @@ public:
         _arch->write((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Performs data serialization of an array of numbers, the bytes of the numbers are shuffled if the archive is compressed
+     *  \param[in]   ptr          Pointer to the array of data to convert to the serialized format
+     *  \param[in]   nElements    Number of the elements in the array pointed to by ptr
+     *  \param[in]   elementSize  Size of the array element in bytes
+     */
+    void setShuffled(byte * ptr, size_t nElements, size_t elementSize)
+    {
+        if (!_shuffleArrays || !ByteShuffle::isApplicable(elementSize))
+        {
+            _arch->write(ptr, nElements * elementSize);
+            return;
+        }
+
+        byte buffer[ByteShuffle::blockBytes];
+        const size_t blockSize = ByteShuffle::blockBytes / elementSize;
+        for (size_t i = 0; i < nElements; i += blockSize)
+        {
+            const size_t n = (nElements - i < blockSize) ? nElements - i : blockSize;
+            ByteShuffle::shuffle(ptr + i * elementSize, buffer, n, elementSize);
+            _arch->write(buffer, n * elementSize);
+        }
+    }
+
+    /**
+     *  Performs data serialization of an array without copying, the serialization always copies the data with set()
+     *  \return False
+     */
+    bool setArrayInPlace(services::SharedPtr<byte> & /*ptr*/, size_t /*size*/) { return false; }
+
     /**
      *  Performs data serialization creating a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -986,6 +1532,7 @@ public:
 protected:
     DataArchiveIface * _arch;
     bool _finalized;
+    bool _shuffleArrays;
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -1003,7 +1550,7 @@ public:
     /**
      *  Constructor of an output data archive from an input data archive
      */
-    OutputDataArchive(InputDataArchive & arch) : _errors(new services::ErrorCollection())
+    OutputDataArchive(InputDataArchive & arch) : _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = new DataArchive(arch.getDataArchive());
         archiveHeader();
@@ -1014,7 +1561,7 @@ public:
      *  The new OutputDataArchive object will own the provided pointer
      *  and free it when it gets deleted.
      */
-    OutputDataArchive(DataArchiveIface * arch) : _errors(new services::ErrorCollection())
+    OutputDataArchive(DataArchiveIface * arch) : _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = arch;
         archiveHeader();
@@ -1023,7 +1570,7 @@ public:
     /**
      *  Constructor of an output data archive from a byte array
      */
-    OutputDataArchive(byte * ptr, size_t size) : _errors(new services::ErrorCollection())
+    OutputDataArchive(byte * ptr, size_t size) : _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = new DataArchive(ptr, size);
         archiveHeader();
@@ -1032,7 +1579,8 @@ public:
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
-    OutputDataArchive(daal::data_management::DecompressorImpl * decompressor, byte * ptr, size_t size) : _errors(new services::ErrorCollection())
+    OutputDataArchive(daal::data_management::DecompressorImpl * decompressor, byte * ptr, size_t size)
+        : _shuffleArrays(false), _errors(new services::ErrorCollection())
     {
         _arch = new DecompressedDataArchive(decompressor);
         _arch->write(ptr, size);
@@ -1056,6 +1604,7 @@ public:
         _arch->setMajorVersion(headerValues[1]);
         _arch->setMinorVersion(headerValues[2]);
         _arch->setUpdateVersion(headerValues[3]);
+        _shuffleArrays = (headerValues[4] & shuffledArrays) != 0;
     }
 
     /**
@@ -1120,6 +1669,51 @@ public:
         _arch->read((byte *)ptr, size * sizeof(T));
     }
 
+    /**
+     *  Performs data deserialization of an array of numbers serialized with InputDataArchive::setShuffled()
+     *  \param[out]  ptr          Pointer to the array of data to convert from the serialized format
+     *  \param[in]   nElements    Number of the elements in the array pointed to by ptr
+     *  \param[in]   elementSize  Size of the array element in bytes
+     */
+    void setShuffled(byte * ptr, size_t nElements, size_t elementSize) const
+    {
+        if (!_shuffleArrays || !ByteShuffle::isApplicable(elementSize))
+        {
+            _arch->read(ptr, nElements * elementSize);
+            return;
+        }
+
+        byte buffer[ByteShuffle::blockBytes];
+        const size_t blockSize = ByteShuffle::blockBytes / elementSize;
+        for (size_t i = 0; i < nElements; i += blockSize)
+        {
+            const size_t n = (nElements - i < blockSize) ? nElements - i : blockSize;
+            _arch->read(buffer, n * elementSize);
+            ByteShuffle::unshuffle(buffer, ptr + i * elementSize, n, elementSize);
+        }
+    }
+
+    /**
+     *  Performs data deserialization of an array without copying, if the archive supports it
+     *  \param[out]  ptr   Shared pointer to the deserialized array that refers to the memory of the archive
+     *  \param[in]   size  Size of the array in bytes
+     *  \return True if the array is deserialized, false if the array is to be copied with set()
+     */
+    bool setArrayInPlace(services::SharedPtr<byte> & ptr, size_t size) const
+    {
+        if (_shuffleArrays)
+        {
+            return false;
+        }
+        services::SharedPtr<byte> inPlacePtr = _arch->readInPlace(size);
+        if (!inPlacePtr)
+        {
+            return false;
+        }
+        ptr = inPlacePtr;
+        return true;
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -1231,6 +1825,7 @@ public:
 
 protected:
     DataArchiveIface * _arch;
+    mutable bool _shuffleArrays;
     services::SharedPtr<services::ErrorCollection> _errors;
 
 private:
@@ -1244,6 +1839,12 @@ using interface1::DataArchiveIface;
 using interface1::DataArchive;
 using interface1::CompressedDataArchive;
 using interface1::DecompressedDataArchive;
+using interface1::MappedDataArchive;
+using interface1::ByteShuffle;
+using interface1::DataArchiveFlags;
+using interface1::DataArchiveSinkIface;
+using interface1::DataArchiveSourceIface;
+using interface1::StreamingDataArchive;
 using interface1::InputDataArchive;
 using interface1::OutputDataArchive;
 
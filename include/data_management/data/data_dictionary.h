@@ -167,7 +167,7 @@ public:
      *  \DAAL_DEPRECATED_USE{ Dictionary::create }
      */
     Dictionary(size_t nfeat, FeaturesEqual featuresEqual = notEqual)
-        : _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection())
+        : _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _isCompact(false), _errors(new services::KernelErrorCollection())
     {
         if (nfeat)
         {
@@ -191,7 +191,9 @@ public:
      *  Default constructor of a data dictionary
      *  \DAAL_DEPRECATED_USE{ Dictionary::create }
      */
-    Dictionary() : _nfeat(0), _dict(0), _featuresEqual(DictionaryIface::notEqual), _errors(new services::KernelErrorCollection()) {}
+    Dictionary()
+        : _nfeat(0), _dict(0), _featuresEqual(DictionaryIface::notEqual), _isCompact(false), _errors(new services::KernelErrorCollection())
+    {}
 
     /**
      *  Constructs a default data dictionary
@@ -213,7 +215,8 @@ public:
             delete[] _dict;
             _dict = NULL;
         }
-        _nfeat = 0;
+        _nfeat     = 0;
+        _isCompact = false;
         return services::Status();
     }
 
@@ -223,7 +226,7 @@ public:
      */
     virtual services::Status setAllFeatures(const Feature & defaultFeature)
     {
-        if (_featuresEqual == DictionaryIface::equal)
+        if (_featuresEqual == DictionaryIface::equal || _isCompact)
         {
             if (_nfeat > 0)
             {
@@ -253,21 +256,16 @@ public:
     }
 
     /**
-     *  Sets the number of features
+     *  Sets the number of features.
+     *  The dictionary keeps a single feature until the features are accessed or set one by one
      *  \param[in]  numberOfFeatures  Number of features
      */
     virtual services::Status setNumberOfFeatures(size_t numberOfFeatures)
     {
         resetDictionary();
-        _nfeat = numberOfFeatures;
-        if (_featuresEqual == DictionaryIface::equal)
-        {
-            _dict = new Feature[1];
-        }
-        else
-        {
-            _dict = new Feature[_nfeat];
-        }
+        _nfeat     = numberOfFeatures;
+        _dict      = new Feature[1];
+        _isCompact = (_featuresEqual != DictionaryIface::equal);
         return services::Status();
     }
 
@@ -284,7 +282,9 @@ public:
     FeaturesEqual getFeaturesEqual() const { return _featuresEqual; }
 
     /**
-     *  Returns a feature with a given index
+     *  Returns a feature with a given index for modification.
+     *  Allocates the features one by one if the dictionary keeps a single feature, so it must not be called concurrently
+     *  with the other accesses to the dictionary. Use getFeature() to read the features
      *  \param[in]  idx  Index of the feature
      *  \return Requested feature
      */
@@ -296,10 +296,21 @@ public:
         }
         else
         {
+            expand();
             return _dict[idx];
         }
     }
 
+    /**
+     *  Returns a feature with a given index without modifying the dictionary
+     *  \param[in]  idx  Index of the feature
+     *  \return Requested feature
+     */
+    const Feature & getFeature(const size_t idx) const
+    {
+        return (_featuresEqual == DictionaryIface::equal || _isCompact) ? _dict[0] : _dict[idx];
+    }
+
     /**
      *  \brief Adds a feature to a data dictionary
      *
@@ -317,6 +328,7 @@ public:
         }
         else
         {
+            expand();
             _dict[idx] = feature;
         }
         return services::Status();
@@ -337,7 +349,7 @@ public:
     services::Status checkDictionary() const
     {
         size_t nFeat = _nfeat;
-        if (_featuresEqual == DictionaryIface::equal) nFeat = 1;
+        if (_featuresEqual == DictionaryIface::equal || _isCompact) nFeat = 1;
 
         for (size_t i = 0; i < nFeat; ++i)
         {
@@ -393,8 +405,17 @@ private:
         {
             arch->setObj(_dict, 1);
         }
+        else if (_isCompact && !onDeserialize)
+        {
+            /* The serialized dictionary contains all the features regardless of its representation in memory */
+            for (size_t i = 0; i < _nfeat; i++)
+            {
+                arch->setObj(_dict, 1);
+            }
+        }
         else
         {
+            expand();
             arch->setObj(_dict, _nfeat);
         }
 
@@ -407,10 +428,25 @@ protected:
     size_t _nfeat;
     FeaturesEqual _featuresEqual;
     Feature * _dict;
+    bool _isCompact; /* The features are not set one by one yet, _dict keeps the only feature common for all of them */
     services::SharedPtr<services::KernelErrorCollection> _errors;
 
+    /* Allocates the features one by one, so each of them can be modified */
+    void expand()
+    {
+        if (!_isCompact) return;
+        Feature * dict = new Feature[_nfeat];
+        for (size_t i = 0; i < _nfeat; i++)
+        {
+            dict[i] = _dict[0];
+        }
+        delete[] _dict;
+        _dict      = dict;
+        _isCompact = false;
+    }
+
     Dictionary(size_t nfeat, FeaturesEqual featuresEqual, services::Status & st)
-        : _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _errors(new services::KernelErrorCollection())
+        : _nfeat(0), _featuresEqual(featuresEqual), _dict(0), _isCompact(false), _errors(new services::KernelErrorCollection())
     {
         if (nfeat)
         {
@@ -419,7 +455,7 @@ protected:
     }
 
     Dictionary(services::Status & /*st*/)
-        : _nfeat(0), _featuresEqual(DictionaryIface::notEqual), _dict(0), _errors(new services::KernelErrorCollection())
+        : _nfeat(0), _featuresEqual(DictionaryIface::notEqual), _dict(0), _isCompact(false), _errors(new services::KernelErrorCollection())
     {}
 
 private:
@@ -538,13 +538,22 @@ public:
      *  Returns a pointer to a data set registered in a homogeneous Numeric Table
      *  \return Pointer to the data set
      */
-    DataType * getArray() const { return (DataType *)_ptr.get(); }
+    DataType * getArray() const
+    {
+        /* The data might be modified through the returned pointer unnoticed by the table */
+        exposeData();
+        return (DataType *)_ptr.get();
+    }
 
     /**
      *  Returns a pointer to a data set registered in a homogeneous Numeric Table
      *  \return Pointer to the data set
      */
-    services::SharedPtr<DataType> getArraySharedPtr() const { return services::reinterpretPointerCast<DataType, byte>(_ptr); }
+    services::SharedPtr<DataType> getArraySharedPtr() const
+    {
+        exposeData();
+        return services::reinterpretPointerCast<DataType, byte>(_ptr);
+    }
 
     /**
      *  Sets a pointer to a homogeneous data set
@@ -650,6 +659,7 @@ public:
 
         DataType * ptr         = (DataType *)_ptr.get();
         DataType valueDataType = (DataType)value;
+        resetKnownFiniteness();
 
         internal::vectorAssignValueToArray<DataType>(ptr, nColumns * nRows, valueDataType);
 
@@ -663,6 +673,7 @@ public:
      */
     DataType * operator[](size_t i)
     {
+        exposeData();
         size_t nColumns = getNumberOfColumns();
         return (DataType *)_ptr.get() + i * nColumns;
     }
@@ -791,11 +802,14 @@ protected:
                                                                 services::ErrorIncorrectNumberOfObservations);
         }
 
-        _ptr = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(size * sizeof(DataType)), services::ServiceDeleter());
+        _ptr = services::SharedPtr<byte>((byte *)daal::services::internal::daal_malloc_table_data(size * sizeof(DataType)),
+                                         services::ServiceDeleter());
 
         if (!_ptr) return services::Status(services::ErrorMemoryAllocationFailed);
 
+        /* The memory allocated by the table is tracked until its raw pointer is handed out by getArray() or operator[] */
         _memStatus = internallyAllocated;
+        enableFinitenessTracking();
         return services::Status();
     }
 
@@ -803,6 +817,8 @@ protected:
     {
         _ptr       = services::SharedPtr<byte>();
         _memStatus = notAllocated;
+        resetKnownFiniteness();
+        resetDataExposure();
     }
 
     template <typename Archive, bool onDeserialize>
@@ -810,14 +826,22 @@ protected:
     {
         NumericTable::serialImpl<Archive, onDeserialize>(archive);
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if (onDeserialize)
         {
+            /* The table refers to the data of the archive when it is possible, e.g. for the archive mapped from a file */
+            freeDataMemoryImpl();
+            if (archive->setArrayInPlace(_ptr, size * sizeof(DataType)))
+            {
+                _memStatus = internallyAllocated;
+                enableFinitenessTracking();
+                return services::Status();
+            }
             allocateDataMemoryImpl();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
-        archive->set((DataType *)_ptr.get(), size);
+        archive->setShuffled(_ptr.get(), size, sizeof(DataType));
 
         return services::Status();
     }
@@ -851,23 +875,26 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag & (int)writeOnly) resetKnownFiniteness();
+
         if (IsSameType<T, DataType>::value)
         {
             block.setPtr(&_ptr, internal_getBlockOfRows(idx), ncols, nrows);
         }
         else
         {
+            if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
             if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
             if (rwFlag & (int)readOnly)
             {
                 byte * location = internal_getBlockOfRows(idx);
 
-                for (size_t i = 0; i < nrows; i++)
-                {
-                    internal::getVectorUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
-                        ncols, ((DataType *)location) + i * ncols, ((T *)block.getBlockPtr()) + i * ncols);
-                }
+                /* the rows are contiguous both in the table and in the block, so they are converted at once */
+                internal::getVectorUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
+                    nrows * ncols, (DataType *)location, (T *)block.getBlockPtr());
+                addCopiedBytes(nrows * ncols * sizeof(T));
             }
         }
         return services::Status();
@@ -878,6 +905,7 @@ protected:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
+            resetKnownFiniteness();
             byte * location = internal_getBlockOfRows(block.getRowsOffset());
             size_t ncols    = getNumberOfColumns();
             size_t nrows    = block.getNumberOfRows();
@@ -889,15 +917,14 @@ protected:
                     int result =
                         daal::services::internal::daal_memcpy_s(location, nrows * ncols * sizeof(T), block.getBlockPtr(), nrows * ncols * sizeof(T));
                     DAAL_CHECK(!result, services::ErrorMemoryCopyFailedInternal);
+                    addCopiedBytes(nrows * ncols * sizeof(T));
                 }
             }
             else
             {
-                for (size_t i = 0; i < nrows; i++)
-                {
-                    internal::getVectorDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
-                        ncols, ((T *)block.getBlockPtr()) + i * ncols, ((DataType *)location) + i * ncols);
-                }
+                internal::getVectorDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
+                    nrows * ncols, (T *)block.getBlockPtr(), (DataType *)location);
+                addCopiedBytes(nrows * ncols * sizeof(T));
             }
         }
         block.reset();
@@ -919,12 +946,16 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag & (int)writeOnly) resetKnownFiniteness();
+
         if ((IsSameType<T, DataType>::value) && (ncols == 1))
         {
             block.setPtr(&_ptr, internal_getBlockOfRows(idx), ncols, nrows);
         }
         else
         {
+            if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
             if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
             if (rwFlag & (int)readOnly)
@@ -933,6 +964,7 @@ protected:
                 T * buffer          = block.getBlockPtr();
                 internal::getVectorStrideUpCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
                     nrows, location, sizeof(DataType) * ncols, buffer, sizeof(T));
+                addCopiedBytes(nrows * sizeof(T));
             }
         }
         return services::Status();
@@ -943,10 +975,15 @@ protected:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
+            resetKnownFiniteness();
             size_t ncols        = getNumberOfColumns();
             DataType * location = (DataType *)internal_getBlockOfRows(block.getRowsOffset(), block.getColumnsOffset());
-            internal::getVectorStrideDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
-                block.getNumberOfRows(), block.getBlockPtr(), sizeof(T), location, ncols * sizeof(DataType));
+            if ((void *)block.getBlockPtr() != (void *)location)
+            {
+                internal::getVectorStrideDownCast(features::internal::getIndexNumType<DataType>(), internal::getConversionDataType<T>())(
+                    block.getNumberOfRows(), block.getBlockPtr(), sizeof(T), location, ncols * sizeof(DataType));
+                addCopiedBytes(block.getNumberOfRows() * sizeof(T));
+            }
         }
         block.reset();
         return services::Status();
@@ -65,6 +65,22 @@ protected:
 };
 typedef services::SharedPtr<BaseArrowImmutableNumericTable> BaseArrowImmutableNumericTablePtr;
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__BASEARROWMUTABLENUMERICTABLE"></a>
+ *  \brief Base class that provides methods to access data stored as a mutable Apache Arrow record batch.
+ */
+class DAAL_EXPORT BaseArrowMutableNumericTable : public ArrowNumericTable
+{
+    DECLARE_SERIALIZABLE_TAG()
+
+public:
+    bool isMutable() const DAAL_C11_OVERRIDE { return true; }
+
+protected:
+    BaseArrowMutableNumericTable(size_t featnum, size_t obsnum, services::Status & st) : ArrowNumericTable(featnum, obsnum, st) {}
+};
+typedef services::SharedPtr<BaseArrowMutableNumericTable> BaseArrowMutableNumericTablePtr;
+
 /** @} */
 } // namespace interface1
 
@@ -72,6 +88,8 @@ using interface1::ArrowNumericTable;
 using interface1::ArrowNumericTablePtr;
 using interface1::BaseArrowImmutableNumericTable;
 using interface1::BaseArrowImmutableNumericTablePtr;
+using interface1::BaseArrowMutableNumericTable;
+using interface1::BaseArrowMutableNumericTablePtr;
 
 } // namespace data_management
 } // namespace daal
@@ -27,9 +27,15 @@ namespace data_management
 {
 namespace internal
 {
+/* Returns true if the table contains neither infinite values nor NaN values unless they are allowed.
+   The result is cached in the table until it is modified, so the repeated checks of the same data are free */
 template <typename DataType>
 DAAL_EXPORT bool allValuesAreFinite(NumericTable & table, bool allowNaN);
 
+/* Returns true if n values of the array contain neither infinite values nor NaN values unless they are allowed */
+template <typename DataType>
+DAAL_EXPORT bool valuesAreFinite(const DataType * values, size_t n, bool allowNaN);
+
 } // namespace internal
 } // namespace data_management
 } // namespace daal
@@ -0,0 +1,175 @@
+/* file: merged_table_access.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_MANAGEMENT_DATA_INTERNAL_MERGED_TABLE_ACCESS_H__
+#define __DATA_MANAGEMENT_DATA_INTERNAL_MERGED_TABLE_ACCESS_H__
+
+#include "services/daal_memory.h"
+#include "services/daal_atomic_int.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ * \brief Returns the pointer to the rows of the table stored contiguously in the type T starting from the row rowIdx,
+ *        or NULL if the rows of the table cannot be accessed without a copy.
+ *        The pointer is obtained via the block of the table accessed in the mode rwFlag, so that the read-only access
+ *        keeps the state of the table, e.g. its known finiteness, and the write access resets it
+ */
+template <typename T>
+inline T * getDirectRowsPtr(NumericTable * table, size_t rowIdx, int rwFlag = (int)readOnly)
+{
+    HomogenNumericTable<T> * homogenTable = dynamic_cast<HomogenNumericTable<T> *>(table);
+    const size_t nRows                    = table->getNumberOfRows();
+    if (!homogenTable || !nRows) return NULL;
+
+    BlockDescriptor<T> block;
+    if (!homogenTable->getBlockOfRows(0, nRows, (ReadWriteMode)rwFlag, block)) return NULL;
+    T * data = block.getBlockPtr();
+    homogenTable->releaseBlockOfRows(block);
+    return data ? data + rowIdx * homogenTable->getNumberOfColumns() : NULL;
+}
+
+/**
+ * \brief Returns the pointer to the values of the column colIdx of the table stored contiguously in the type T
+ *        starting from the row rowIdx, or NULL if the values of the column cannot be accessed without a copy.
+ *        The table is accessed in the mode rwFlag as in getDirectRowsPtr()
+ */
+template <typename T>
+inline T * getDirectColumnPtr(NumericTable * table, size_t colIdx, size_t rowIdx, int rwFlag = (int)readOnly)
+{
+    if (table->getNumberOfColumns() == 1)
+    {
+        return getDirectRowsPtr<T>(table, rowIdx, rwFlag);
+    }
+
+    SOANumericTable * soaTable = dynamic_cast<SOANumericTable *>(table);
+    const size_t nRows         = table->getNumberOfRows();
+    if (!soaTable || colIdx >= soaTable->getNumberOfColumns() || !nRows) return NULL;
+
+    NumericTableDictionaryPtr dict = soaTable->getDictionarySharedPtr();
+    if (!dict || dict->getFeature(colIdx).indexType != features::getIndexNumType<T>()) return NULL;
+
+    BlockDescriptor<T> block;
+    if (!soaTable->getBlockOfColumnValues(colIdx, 0, nRows, (ReadWriteMode)rwFlag, block)) return NULL;
+    T * column = block.getBlockPtr();
+    soaTable->releaseBlockOfColumnValues(block);
+    return column ? column + rowIdx : NULL;
+}
+
+/**
+ * \brief Copy of the data of a merged numeric table in the row-major layout built on the first read access
+ *        and reused by the next read accesses until it is invalidated.
+ *        The cache is filled under the lock and becomes visible to the readers only after it is completely filled
+ */
+class DAAL_EXPORT MergedTableCache
+{
+public:
+    MergedTableCache();
+
+    /** The copy does not share the cached data and the lock with the original, only the caching policy is copied */
+    MergedTableCache(const MergedTableCache & other);
+
+    ~MergedTableCache();
+
+    void enable(bool isEnabled)
+    {
+        _isEnabled = isEnabled;
+        invalidate();
+    }
+
+    bool isEnabled() const { return _isEnabled; }
+
+    /**
+     * \return True if the cache is completely filled
+     */
+    bool isFilled() const { return _isFilled.get() != 0; }
+
+    /**
+     * \return Pointer to the cached data of the type T, or NULL if the cache is not filled or the data is cached in another type
+     */
+    template <typename T>
+    T * get() const
+    {
+        return (isFilled() && _type == features::getIndexNumType<T>()) ? (T *)_data.get() : NULL;
+    }
+
+    /**
+     * Allocates the memory for nElements values of the type T, the previous content of the cache is discarded.
+     * The memory stays invisible to the readers until publish() is called. Must be called under the lock
+     */
+    template <typename T>
+    T * allocate(size_t nElements)
+    {
+        invalidate();
+        _data = services::SharedPtr<byte>((byte *)services::daal_malloc(nElements * sizeof(T)), services::ServiceDeleter());
+        if (!_data) return NULL;
+        _type = features::getIndexNumType<T>();
+        return (T *)_data.get();
+    }
+
+    /**
+     * Makes the allocated and filled memory visible to the readers. Must be called under the lock
+     */
+    void publish() { _isFilled.set(1); }
+
+    /**
+     * Discards the cached data. Must not be called concurrently with the accesses to the table
+     */
+    void invalidate()
+    {
+        _isFilled.set(0);
+        _data.reset();
+        _type = features::DAAL_OTHER_T;
+    }
+
+    void lock();
+    void unlock();
+
+    /**
+     * \brief Holds the lock of the cache within the scope
+     */
+    class ScopedLock
+    {
+    public:
+        ScopedLock(MergedTableCache & cache) : _cache(cache) { _cache.lock(); }
+        ~ScopedLock() { _cache.unlock(); }
+
+    private:
+        MergedTableCache & _cache;
+    };
+
+private:
+    MergedTableCache & operator=(const MergedTableCache &);
+
+    services::SharedPtr<byte> _data;
+    features::IndexNumType _type;
+    bool _isEnabled;
+    services::Atomic<int> _isFilled;
+    void * _mutex;
+};
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
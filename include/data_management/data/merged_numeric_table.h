@@ -28,6 +28,7 @@
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
 #include "data_management/data/data_serialize.h"
+#include "data_management/data/internal/merged_table_access.h"
 
 namespace daal
 {
@@ -103,6 +104,7 @@ public:
         if (table->getDataLayout() & csrArray) return services::Status(services::ErrorIncorrectTypeOfInputNumericTable);
 
         _tables->push_back(table);
+        _cache.invalidate();
 
         size_t ncols = getNumberOfColumns();
         size_t cols  = table->getNumberOfColumns();
@@ -128,9 +130,40 @@ public:
         return s;
     }
 
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__MERGEDNUMERICTABLE__CACHINGPOLICY"></a>
+     * \brief Policies of caching of the rows assembled from the nested tables
+     */
+    enum CachingPolicy
+    {
+        doNotCache  = 0, /*!< Rows are assembled from the nested tables on every access */
+        cacheOnRead = 1  /*!< The first read-only access assembles all the rows in the cache that serves the next read-only accesses */
+    };
+
+    /**
+     *  Sets the policy of caching of the rows assembled from the nested tables.
+     *  Columns of the nested HomogenNumericTable and SOANumericTable of the requested type are accessed in place regardless of the policy.
+     *  The cache is invalidated when the data is written via this table, when a table is added or the table is resized,
+     *  modifications made directly in the nested tables require the call of invalidateCache()
+     *  \param[in] policy  Caching policy
+     */
+    void setCachingPolicy(CachingPolicy policy) { _cache.enable(policy == cacheOnRead); }
+
+    /**
+     *  Returns the policy of caching of the rows assembled from the nested tables
+     *  \return Caching policy
+     */
+    CachingPolicy getCachingPolicy() const { return _cache.isEnabled() ? cacheOnRead : doNotCache; }
+
+    /**
+     *  Discards the cached rows, the next read-only access assembles the rows from the nested tables again
+     */
+    void invalidateCache() { _cache.invalidate(); }
+
     //the descriptions of the methods below are inherited from the base class
     services::Status resize(size_t nrow) DAAL_C11_OVERRIDE
     {
+        _cache.invalidate();
         for (size_t i = 0; i < _tables->size(); i++)
         {
             NumericTable * nt  = (NumericTable *)(_tables->operator[](i).get());
@@ -291,25 +324,25 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
-
-        if (rwFlag & (int)readOnly)
+        /* Rows of a single nested table stored in the type T are accessed in place */
+        T * rows = getNestedRowsPtr<T>(idx, rwFlag);
+        if (!rows && rwFlag == (int)readOnly && _cache.isEnabled())
         {
-            size_t cols = 0;
-            BlockDescriptor<T> innerBlock;
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
-                size_t lcols      = nt->getNumberOfColumns();
-
-                s |= nt->getBlockOfRows(idx, nrows, readOnly, innerBlock);
+            rows = getCachedRowsPtr<T>(idx, s);
+        }
+        if (rows)
+        {
+            block.setPtr(rows, ncols, nrows);
+            return s;
+        }
 
-                internal_inner_repack<T>(cols, lcols, nrows, ncols, innerBlock.getBlockPtr(), block.getBlockPtr());
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
 
-                s |= nt->releaseBlockOfRows(innerBlock);
+        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
-                cols += lcols;
-            }
+        if (rwFlag & (int)readOnly)
+        {
+            s |= readNestedRows<T>(idx, nrows, block.getBlockPtr());
         }
         return s;
     }
@@ -320,12 +353,15 @@ protected:
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
+            _cache.invalidate();
+
             size_t ncols  = getNumberOfColumns();
             size_t nrows  = block.getNumberOfRows();
             size_t offset = block.getRowsOffset();
             size_t cols   = 0;
             BlockDescriptor<T> innerBlock;
-            for (size_t k = 0; k < _tables->size(); k++)
+            bool isInPlace = (block.getBlockPtr() == getNestedRowsPtr<T>(offset));
+            for (size_t k = 0; !isInPlace && k < _tables->size(); k++)
             {
                 NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
                 size_t lcols      = nt->getNumberOfColumns();
@@ -357,6 +393,16 @@ protected:
         }
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        T * values = getNestedColumnPtr<T>(feat_idx, idx, rwFlag);
+        if (values)
+        {
+            block.setPtr(values, 1, nrows);
+            return s;
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (rwFlag & (int)readOnly)
@@ -392,11 +438,14 @@ protected:
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
+            _cache.invalidate();
+
             size_t feat_idx = block.getColumnsOffset();
             size_t idx      = block.getRowsOffset();
             size_t nrows    = block.getNumberOfRows();
             T * buffer      = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
+            bool isInPlace  = (buffer == getNestedColumnPtr<T>(feat_idx, idx));
+            for (size_t k = 0; !isInPlace && k < _tables->size(); k++)
             {
                 NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
                 size_t lcols      = nt->getNumberOfColumns();
@@ -421,6 +470,88 @@ protected:
         return s;
     }
 
+    /* Copies the rows [idx, idx + nrows) from the nested tables to dst */
+    template <typename T>
+    services::Status readNestedRows(size_t idx, size_t nrows, T * dst)
+    {
+        services::Status s;
+        size_t ncols = getNumberOfColumns();
+        size_t cols  = 0;
+        BlockDescriptor<T> innerBlock;
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lcols      = nt->getNumberOfColumns();
+
+            s |= nt->getBlockOfRows(idx, nrows, readOnly, innerBlock);
+
+            internal_inner_repack<T>(cols, lcols, nrows, ncols, innerBlock.getBlockPtr(), dst);
+
+            s |= nt->releaseBlockOfRows(innerBlock);
+
+            cols += lcols;
+        }
+        return s;
+    }
+
+    /* Rows are stored contiguously only if the table consists of a single nested table */
+    template <typename T>
+    T * getNestedRowsPtr(size_t idx, int rwFlag = (int)readOnly)
+    {
+        if (_tables->size() != 1) return NULL;
+        return internal::getDirectRowsPtr<T>((NumericTable *)(_tables->operator[](0).get()), idx, rwFlag);
+    }
+
+    template <typename T>
+    T * getNestedColumnPtr(size_t feat_idx, size_t idx, int rwFlag = (int)readOnly)
+    {
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lcols      = nt->getNumberOfColumns();
+
+            if (lcols > feat_idx)
+            {
+                return internal::getDirectColumnPtr<T>(nt, feat_idx, idx, rwFlag);
+            }
+
+            feat_idx -= lcols;
+        }
+        return NULL;
+    }
+
+    /* Returns the pointer to the row idx in the cache, the first call fills the cache with all the rows of the table under the lock */
+    template <typename T>
+    T * getCachedRowsPtr(size_t idx, services::Status & s)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs  = getNumberOfRows();
+
+        if (!_cache.isFilled())
+        {
+            internal::MergedTableCache::ScopedLock lock(_cache);
+            if (!_cache.isFilled())
+            {
+                T * data = _cache.allocate<T>(ncols * nobs);
+                if (data)
+                {
+                    services::Status st = readNestedRows<T>(0, nobs, data);
+                    if (!st)
+                    {
+                        _cache.invalidate();
+                        s |= st;
+                        return NULL;
+                    }
+                    _cache.publish();
+                }
+            }
+        }
+
+        /* The cache filled with the values of another type is not replaced as it may be in use, the rows are copied then */
+        T * cache = _cache.get<T>();
+        return cache ? cache + idx * ncols : NULL;
+    }
+
     services::Status setNumberOfRowsImpl(size_t nrow) DAAL_C11_OVERRIDE;
 
     services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE;
@@ -429,6 +560,7 @@ protected:
 
 protected:
     DataCollectionPtr _tables;
+    internal::MergedTableCache _cache;
 
     MergedNumericTable(services::Status & st);
 
@@ -395,6 +395,17 @@ public:
         minMaxNormalized        = 2  /*!< Min-max normalization */
     };
 
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__FINITENESSFLAG"></a>
+     * \brief Flags of the finiteness of the values known for the table
+     */
+    enum FinitenessFlag
+    {
+        finitenessUnknown = 0, /*!< Default: values were not checked since the last modification of the table */
+        noInfinities      = 1, /*!< Table read in the data type contains no infinite values */
+        noNaNs            = 2  /*!< Table read in the data type contains no NaN values */
+    };
+
     /**
      * <a name="DAAL-ENUM-DATA_MANAGEMENT__STORAGELAYOUT"></a>
      * \brief Storage layouts that may need to be supported
@@ -710,6 +721,7 @@ public:
     {
         size_t obsnum      = _obsnum;
         services::Status s = setNumberOfRowsImpl(nrows);
+        if (obsnum < nrows) resetKnownFiniteness();
         if ((_memStatus != userAllocated && obsnum < nrows) || _memStatus == notAllocated)
         {
             s |= allocateDataMemoryImpl();
@@ -746,7 +758,7 @@ public:
     {
         if (_ddict.get() != NULL && _ddict->getNumberOfFeatures() > feature_idx)
         {
-            const NumericTableFeature & f = (*_ddict)[feature_idx];
+            const NumericTableFeature & f = _ddict->getFeature(feature_idx);
             return f.featureType;
         }
         else
@@ -760,7 +772,7 @@ public:
     {
         if (_ddict.get() != NULL && _ddict->getNumberOfFeatures() > feature_idx && getFeatureType(feature_idx) != features::DAAL_CONTINUOUS)
         {
-            const NumericTableFeature & f = (*_ddict)[feature_idx];
+            const NumericTableFeature & f = _ddict->getFeature(feature_idx);
             return f.categoryNumber;
         }
         else
@@ -794,6 +806,51 @@ public:
         return oldValue;
     }
 
+    /**
+     *  Returns the number of bytes copied or converted between the memory of the table and the intermediate buffers
+     *  of block descriptors since the creation of the table or the last call to resetNumberOfCopiedBytes()
+     *  \return Number of bytes copied
+     */
+    size_t getNumberOfCopiedBytes() const;
+
+    /**
+     *  Resets the counter of bytes copied by block access methods of the table
+     */
+    void resetNumberOfCopiedBytes();
+
+    /**
+     *  Checks if the values of the table read in the type DataType are known to be finite, i.e. the table was checked
+     *  for infinite and NaN values or filled by a data source that tracked them, and was not modified after that.
+     *  The finiteness is known separately for each data type as the finite values might overflow in a narrower type
+     *  \tparam   DataType  Data type in which the values of the table are read
+     *  \param[in] allowNaN  Flag that NaN values are allowed
+     *  \return True if the values are known to be finite, false if their finiteness is unknown
+     */
+    template <typename DataType>
+    bool isKnownFinite(bool allowNaN) const
+    {
+        return hasFinitenessFlags(getFinitenessFlags<DataType>(allowNaN));
+    }
+
+    /**
+     *  Marks the values of the table read in the type DataType as known to be finite. The mark is reset when the table is modified
+     *  via its block access methods. Has no effect on the tables that do not track their modifications and on the tables
+     *  that handed out the raw pointers to their data
+     *  \tparam   DataType  Data type in which the values of the table are read
+     *  \param[in] allowNaN  Flag that NaN values might be present in the table
+     */
+    template <typename DataType>
+    void setKnownFinite(bool allowNaN)
+    {
+        addFinitenessFlags(getFinitenessFlags<DataType>(allowNaN));
+    }
+
+    /**
+     *  Resets the known finiteness of the values of the table.
+     *  Must be called if the data of the table is modified through a pointer obtained before the finiteness was checked
+     */
+    void resetKnownFiniteness() const;
+
     /**
      *  Returns errors during the computation
      *  \return Errors during the computation
@@ -907,11 +964,18 @@ protected:
 
 protected:
     NumericTable(NumericTableDictionaryPtr ddict, services::Status & /*st*/)
-        : _ddict(ddict), _obsnum(0), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _ddict(ddict),
+          _obsnum(0),
+          _memStatus(notAllocated),
+          _layout(layout_unknown),
+          _normalizationFlag(NumericTable::nonNormalized)
     {}
 
     NumericTable(size_t featnum, size_t obsnum, DictionaryIface::FeaturesEqual featuresEqual, services::Status & st)
-        : _obsnum(obsnum), _memStatus(notAllocated), _layout(layout_unknown), _normalizationFlag(NumericTable::nonNormalized)
+        : _obsnum(obsnum),
+          _memStatus(notAllocated),
+          _layout(layout_unknown),
+          _normalizationFlag(NumericTable::nonNormalized)
     {
         _ddict = NumericTableDictionary::create(featnum, featuresEqual, &st);
         if (!st) return;
@@ -929,6 +993,37 @@ protected:
 
     virtual void freeDataMemoryImpl() {}
 
+    void addCopiedBytes(size_t nBytes);
+
+    /**
+     *  Marks that all modifications of the data allocated by the table are visible to the table,
+     *  so that the known finiteness of its values is reset on each of them. The finiteness is tracked
+     *  only while the memory of the table is internally allocated
+     */
+    void enableFinitenessTracking();
+
+    /**
+     *  Marks that the raw pointer to the data of the table was handed out, so the data might be modified unnoticed by the table
+     *  and its finiteness is not known until the memory is reallocated
+     */
+    void exposeData() const;
+
+    /**
+     *  Marks that the raw pointers to the data of the table handed out before are not valid anymore, e.g. the memory is freed
+     */
+    void resetDataExposure();
+
+    bool hasFinitenessFlags(int flags) const;
+    void addFinitenessFlags(int flags);
+
+    /* The flags of the finiteness in the float and double types are kept in the separate bits */
+    template <typename DataType>
+    static int getFinitenessFlags(bool allowNaN)
+    {
+        const int flags = allowNaN ? (int)noInfinities : (int)(noInfinities | noNaNs);
+        return (features::internal::getIndexNumType<DataType>() == features::DAAL_FLOAT32) ? flags : (flags << 2);
+    }
+
     template <typename DataType>
     DataType getValueImpl(size_t column, size_t row, services::Status & status) const
     {
@@ -41,6 +41,13 @@ class DAAL_EXPORT SyclNumericTable : public NumericTable
 public:
     DAAL_CAST_OPERATOR(SyclNumericTable)
 
+    /**
+     *  Returns true if the data of the table is stored in the memory of the device, so that the algorithms
+     *  running on the device access it without copying through the host
+     *  \return Flag that indicates whether the data is resident on the device
+     */
+    virtual bool isDeviceResident() const { return false; }
+
 protected:
     explicit SyclNumericTable(size_t nColumns, size_t nRows, DictionaryIface::FeaturesEqual featuresEqual, services::Status & st)
         : NumericTable(nColumns, nRows, featuresEqual, st)
@@ -172,6 +172,8 @@ public:
 
     services::Status assign(int value) DAAL_C11_OVERRIDE { return assignImpl<int>(value); }
 
+    bool isDeviceResident() const DAAL_C11_OVERRIDE { return !isCpuTable() && _memStatus != notAllocated; }
+
 protected:
     SyclHomogenNumericTable(DictionaryIface::FeaturesEqual featuresEqual, size_t nColumns, size_t nRows, services::Status & st)
         : SyclNumericTable(nColumns, nRows, featuresEqual, st)
@@ -332,10 +334,14 @@ private:
     template <typename T, typename U>
     struct BufferIO
     {
-        static services::Status read(const services::Buffer<U> & buffer, BlockDescriptor<T> & block, size_t nRows, size_t nCols)
+        static services::Status read(const services::Buffer<U> & buffer, BlockDescriptor<T> & block, size_t nRows, size_t nCols,
+                                     ReadWriteMode rwFlag)
         {
             DAAL_ASSERT(buffer.size() == nRows * nCols);
 
+            /* The values are converted to the type of the block */
+            if (rwFlag == readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
             if (!block.resizeBuffer(nCols, nRows))
             {
                 services::Status status(services::ErrorMemoryAllocationFailed);
@@ -343,6 +349,12 @@ private:
                 return status;
             }
 
+            /* The data of the write-only block is overwritten, so it is not copied from the device */
+            if (rwFlag == writeOnly)
+            {
+                return services::Status();
+            }
+
             // TODO: Figure out how to convert the data without fallback to host
             auto hostPtr = buffer.toHost(data_management::readOnly);
             internal::VectorUpCast<U, T>()(nRows * nCols, hostPtr.get(), block.getBlockPtr());
@@ -367,7 +379,8 @@ private:
     template <typename T>
     struct BufferIO<T, T>
     {
-        static services::Status read(const services::Buffer<T> & buffer, BlockDescriptor<T> & block, size_t nRows, size_t nCols)
+        static services::Status read(const services::Buffer<T> & buffer, BlockDescriptor<T> & block, size_t nRows, size_t nCols,
+                                     ReadWriteMode rwFlag)
         {
             DAAL_ASSERT(buffer.size() == nRows * nCols);
 
@@ -415,7 +428,7 @@ private:
 
         const size_t nRowsBlock = (rowOffset + nRowsBlockDesired < nRows) ? nRowsBlockDesired : nRows - rowOffset;
 
-        return BufferIO<T, DataType>::read(getSubBuffer(rowOffset, nRowsBlock), block, nRowsBlock, nCols);
+        return BufferIO<T, DataType>::read(getSubBuffer(rowOffset, nRowsBlock), block, nRowsBlock, nCols, rwFlag);
     }
 
     template <typename T>
@@ -449,8 +462,44 @@ private:
             return _cpuTable->getBlockOfColumnValues(columnIndex, rowOffset, nRowsBlockDesired, rwFlag, block);
         }
 
-        services::throwIfPossible(services::ErrorMethodNotImplemented);
-        return services::ErrorMethodNotImplemented;
+        const size_t nRows = getNumberOfRows();
+        const size_t nCols = getNumberOfColumns();
+        block.setDetails(columnIndex, rowOffset, rwFlag);
+
+        if (rowOffset >= nRows)
+        {
+            block.reset();
+            return services::Status();
+        }
+
+        const size_t nRowsBlock = (rowOffset + nRowsBlockDesired < nRows) ? nRowsBlockDesired : nRows - rowOffset;
+
+        if (rwFlag == readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        if (!block.resizeBuffer(1, nRowsBlock))
+        {
+            services::Status status(services::ErrorMemoryAllocationFailed);
+            services::throwIfPossible(status);
+            return status;
+        }
+
+        /* Values of the column are strided in the buffer, they are gathered on the host */
+        if (rwFlag & (int)readOnly)
+        {
+            services::Status status;
+            auto hostPtr = getSubBuffer(rowOffset, nRowsBlock).toHost(data_management::readOnly, &status);
+            services::throwIfPossible(status);
+            DAAL_CHECK_STATUS_VAR(status);
+
+            const DataType * src = hostPtr.get() + columnIndex;
+            T * dst              = block.getBlockPtr();
+            for (size_t i = 0; i < nRowsBlock; i++)
+            {
+                dst[i] = static_cast<T>(src[i * nCols]);
+            }
+        }
+
+        return services::Status();
     }
 
     template <typename T>
@@ -461,8 +510,32 @@ private:
             return _cpuTable->releaseBlockOfColumnValues(block);
         }
 
-        services::throwIfPossible(services::ErrorMethodNotImplemented);
-        return services::ErrorMethodNotImplemented;
+        services::Status status;
+
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t nCols       = getNumberOfColumns();
+            const size_t nRows       = block.getNumberOfRows();
+            const size_t rowOffset   = block.getRowsOffset();
+            const size_t columnIndex = block.getColumnsOffset();
+
+            /* readWrite mapping keeps the other columns of the rows unchanged */
+            auto hostPtr = getSubBuffer(rowOffset, nRows).toHost(data_management::readWrite, &status);
+            services::throwIfPossible(status);
+
+            if (status)
+            {
+                const T * src  = block.getBlockPtr();
+                DataType * dst = hostPtr.get() + columnIndex;
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    dst[i * nCols] = static_cast<DataType>(src[i]);
+                }
+            }
+        }
+
+        block.reset();
+        return status;
     }
 
     services::Status allocateDataMemoryOnCpu()
@@ -240,6 +240,8 @@ public:
         return NumericTable::getDataMemoryStatus();
     }
 
+    bool isDeviceResident() const DAAL_C11_OVERRIDE { return !isCpuTable() && _memStatus != notAllocated; }
+
 protected:
     explicit SyclSOANumericTable(size_t nColumns, size_t nRows, DictionaryIface::FeaturesEqual featuresEqual, services::Status & st)
         : SyclNumericTable(nColumns, nRows, featuresEqual), _arrays(nColumns), _arraysInitialized(0), _partialMemStatus(notAllocated)
@@ -376,7 +378,7 @@ protected:
 
             for (size_t i = 0; i < ncol; i++)
             {
-                NumericTableFeature f = (*_ddict)[i];
+                NumericTableFeature f = _ddict->getFeature(i);
                 if (f.typeSize != 0)
                 {
                     DAAL_CHECK_STATUS_VAR(allocateArray(i, f));
@@ -468,7 +470,7 @@ protected:
         {
             for (size_t i = 0; i < ncol; i++)
             {
-                NumericTableFeature f = (*_ddict)[i];
+                NumericTableFeature f = _ddict->getFeature(i);
                 arch->set((char *)_cpuTable->getArray(i), nrows * f.typeSize);
             }
         }
@@ -476,7 +478,7 @@ protected:
         {
             for (size_t i = 0; i < ncol; i++)
             {
-                NumericTableFeature f = (*_ddict)[i];
+                NumericTableFeature f = _ddict->getFeature(i);
 
                 BufferHostReinterpreter<char> reinterpreter(_arrays[i], rwMode, nrows);
                 TypeDispatcher::dispatch(_arrays[i].type(), reinterpreter);
@@ -510,6 +512,9 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        /* The rows are gathered from the columns */
+        if (rwFlag == readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
@@ -633,7 +638,7 @@ private:
         {
             size_t feat_idx = block.getColumnsOffset();
 
-            NumericTableFeature & f = (*_ddict)[feat_idx];
+            const NumericTableFeature & f = _ddict->getFeature(feat_idx);
 
             if (features::internal::getIndexNumType<T>() != f.indexType)
             {
@@ -36,9 +36,12 @@ namespace data_management
  */
 enum ReadWriteMode
 {
-    readOnly  = 1,
-    writeOnly = 2,
-    readWrite = 3
+    readOnly         = 1,
+    writeOnly        = 2,
+    readWrite        = 3,
+    readOnlyBorrowed = 5 /*!< Read-only access to the memory of the table itself, supported by homogeneous and SOA numeric tables
+                          *   and by the tables that access such tables in place, e.g. merged tables and subsets.
+                          *   Fails with ErrorZeroCopyAccessNotAvailable if the block cannot be provided without a copy */
 };
 /** @} */
 
@@ -28,6 +28,7 @@
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
 #include "data_management/data/data_serialize.h"
+#include "data_management/data/internal/merged_table_access.h"
 
 namespace daal
 {
@@ -89,6 +90,7 @@ public:
         if (ncols != 0 && ncols != cols) return services::Status(services::ErrorIncorrectNumberOfFeatures);
 
         _tables->push_back(table);
+        _cache.invalidate();
 
         if (ncols == 0)
         {
@@ -117,6 +119,36 @@ public:
         return setNumberOfRowsImpl(_obsnum + obs);
     }
 
+    /**
+     * <a name="DAAL-ENUM-DATA_MANAGEMENT__ROWMERGEDNUMERICTABLE__CACHINGPOLICY"></a>
+     * \brief Policies of caching of the rows copied from the nested tables
+     */
+    enum CachingPolicy
+    {
+        doNotCache  = 0, /*!< Rows are copied from the nested tables on every access */
+        cacheOnRead = 1  /*!< The first read-only access copies all the rows to the cache that serves the next read-only accesses */
+    };
+
+    /**
+     *  Sets the policy of caching of the rows copied from the nested tables.
+     *  Rows that belong to a single nested HomogenNumericTable of the requested type are accessed in place regardless of the policy.
+     *  The cache is invalidated when the data is written via this table or when a table is added,
+     *  modifications made directly in the nested tables require the call of invalidateCache()
+     *  \param[in] policy  Caching policy
+     */
+    void setCachingPolicy(CachingPolicy policy) { _cache.enable(policy == cacheOnRead); }
+
+    /**
+     *  Returns the policy of caching of the rows copied from the nested tables
+     *  \return Caching policy
+     */
+    CachingPolicy getCachingPolicy() const { return _cache.isEnabled() ? cacheOnRead : doNotCache; }
+
+    /**
+     *  Discards the cached rows, the next read-only access copies the rows from the nested tables again
+     */
+    void invalidateCache() { _cache.invalidate(); }
+
     services::Status resize(size_t /*nrows*/) DAAL_C11_OVERRIDE
     {
         return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
@@ -235,30 +267,25 @@ protected:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
-
-        if (rwFlag & (int)readOnly)
+        /* Rows of a single nested table stored in the type T are accessed in place */
+        T * rows = getNestedRowsPtr<T>(idx, nrows, rwFlag);
+        if (!rows && rwFlag == (int)readOnly && _cache.isEnabled())
         {
-            size_t rows = 0;
-            BlockDescriptor<T> innerBlock;
-            for (size_t k = 0; k < _tables->size() && rows < idx + nrows; k++)
-            {
-                NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
-                size_t lrows      = nt->getNumberOfRows();
-
-                if (rows + lrows > idx)
-                {
-                    size_t idxBegin = (rows < idx) ? idx : rows;
-                    size_t idxEnd   = (rows + lrows < idx + nrows) ? rows + lrows : idx + nrows;
-                    s |= nt->getBlockOfRows(idxBegin - rows, idxEnd - idxBegin, readOnly, innerBlock);
+            rows = getCachedRowsPtr<T>(idx, s);
+        }
+        if (rows)
+        {
+            block.setPtr(rows, ncols, nrows);
+            return s;
+        }
 
-                    internal_inner_repack<T>(idxBegin - idx, idxEnd - idxBegin, ncols, innerBlock.getBlockPtr(), block.getBlockPtr());
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
 
-                    s |= nt->releaseBlockOfRows(innerBlock);
-                }
+        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
-                rows += lrows;
-            }
+        if (rwFlag & (int)readOnly)
+        {
+            s |= readNestedRows<T>(idx, nrows, block.getBlockPtr());
         }
         return s;
     }
@@ -269,28 +296,13 @@ protected:
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
-            size_t ncols = getNumberOfColumns();
+            _cache.invalidate();
+
             size_t nrows = block.getNumberOfRows();
             size_t idx   = block.getRowsOffset();
-            size_t rows  = 0;
-            BlockDescriptor<T> innerBlock;
-            for (size_t k = 0; k < _tables->size() && rows < idx + nrows; k++)
+            if (block.getBlockPtr() != getNestedRowsPtr<T>(idx, nrows))
             {
-                NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
-                size_t lrows      = nt->getNumberOfRows();
-
-                if (rows + lrows > idx)
-                {
-                    size_t idxBegin = (rows < idx) ? idx : rows;
-                    size_t idxEnd   = (rows + lrows < idx + nrows) ? rows + lrows : idx + nrows;
-                    s |= nt->getBlockOfRows(idxBegin - rows, idxEnd - idxBegin, writeOnly, innerBlock);
-
-                    internal_outer_repack<T>(idxBegin - idx, idxEnd - idxBegin, ncols, block.getBlockPtr(), innerBlock.getBlockPtr());
-
-                    s |= nt->releaseBlockOfRows(innerBlock);
-                }
-
-                rows += lrows;
+                s |= writeNestedRows<T>(idx, nrows, block.getBlockPtr());
             }
         }
         block.reset();
@@ -311,6 +323,16 @@ protected:
         }
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        T * values = getNestedColumnPtr<T>(feat_idx, idx, nrows, rwFlag);
+        if (values)
+        {
+            block.setPtr(values, 1, nrows);
+            return s;
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if (rwFlag & (int)readOnly)
@@ -332,7 +354,7 @@ protected:
                     T * location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        buffer[i] = location[i - idxBegin];
+                        buffer[i - idx] = location[i - idxBegin];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
@@ -349,12 +371,15 @@ protected:
         services::Status s;
         if (block.getRWFlag() & (int)writeOnly)
         {
+            _cache.invalidate();
+
             size_t feat_idx = block.getColumnsOffset();
             size_t idx      = block.getRowsOffset();
             size_t nrows    = block.getNumberOfRows();
             size_t rows     = 0;
             T * buffer      = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size() && rows < idx + nrows; k++)
+            bool isInPlace  = (buffer == getNestedColumnPtr<T>(feat_idx, idx, nrows));
+            for (size_t k = 0; !isInPlace && k < _tables->size() && rows < idx + nrows; k++)
             {
                 NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
                 size_t lrows      = nt->getNumberOfRows();
@@ -369,7 +394,7 @@ protected:
                     T * location = innerBlock.getBlockPtr();
                     for (size_t i = idxBegin; i < idxEnd; i++)
                     {
-                        location[i - idxBegin] = buffer[i];
+                        location[i - idxBegin] = buffer[i - idx];
                     }
                     s |= nt->releaseBlockOfColumnValues(innerBlock);
                 }
@@ -381,12 +406,140 @@ protected:
         return s;
     }
 
+    /* Copies the rows [idx, idx + nrows) from the nested tables to dst */
+    template <typename T>
+    services::Status readNestedRows(size_t idx, size_t nrows, T * dst)
+    {
+        services::Status s;
+        size_t ncols = getNumberOfColumns();
+        size_t rows  = 0;
+        BlockDescriptor<T> innerBlock;
+        for (size_t k = 0; k < _tables->size() && rows < idx + nrows; k++)
+        {
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lrows      = nt->getNumberOfRows();
+
+            if (rows + lrows > idx)
+            {
+                size_t idxBegin = (rows < idx) ? idx : rows;
+                size_t idxEnd   = (rows + lrows < idx + nrows) ? rows + lrows : idx + nrows;
+                s |= nt->getBlockOfRows(idxBegin - rows, idxEnd - idxBegin, readOnly, innerBlock);
+
+                internal_inner_repack<T>(idxBegin - idx, idxEnd - idxBegin, ncols, innerBlock.getBlockPtr(), dst);
+
+                s |= nt->releaseBlockOfRows(innerBlock);
+            }
+
+            rows += lrows;
+        }
+        return s;
+    }
+
+    /* Copies the rows [idx, idx + nrows) from src to the nested tables */
+    template <typename T>
+    services::Status writeNestedRows(size_t idx, size_t nrows, T * src)
+    {
+        services::Status s;
+        size_t ncols = getNumberOfColumns();
+        size_t rows  = 0;
+        BlockDescriptor<T> innerBlock;
+        for (size_t k = 0; k < _tables->size() && rows < idx + nrows; k++)
+        {
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lrows      = nt->getNumberOfRows();
+
+            if (rows + lrows > idx)
+            {
+                size_t idxBegin = (rows < idx) ? idx : rows;
+                size_t idxEnd   = (rows + lrows < idx + nrows) ? rows + lrows : idx + nrows;
+                s |= nt->getBlockOfRows(idxBegin - rows, idxEnd - idxBegin, writeOnly, innerBlock);
+
+                internal_outer_repack<T>(idxBegin - idx, idxEnd - idxBegin, ncols, src, innerBlock.getBlockPtr());
+
+                s |= nt->releaseBlockOfRows(innerBlock);
+            }
+
+            rows += lrows;
+        }
+        return s;
+    }
+
+    /* Returns the nested table that contains the rows [idx, idx + nrows) or NULL if the rows belong to several tables,
+       localIdx is set to the index of the row idx in the nested table */
+    NumericTable * getNestedTable(size_t idx, size_t nrows, size_t & localIdx)
+    {
+        size_t rows = 0;
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable * nt = (NumericTable *)(_tables->operator[](k).get());
+            size_t lrows      = nt->getNumberOfRows();
+
+            if (idx < rows + lrows)
+            {
+                localIdx = idx - rows;
+                return (idx + nrows <= rows + lrows) ? nt : NULL;
+            }
+
+            rows += lrows;
+        }
+        return NULL;
+    }
+
+    template <typename T>
+    T * getNestedRowsPtr(size_t idx, size_t nrows, int rwFlag = (int)readOnly)
+    {
+        size_t localIdx   = 0;
+        NumericTable * nt = getNestedTable(idx, nrows, localIdx);
+        return nt ? internal::getDirectRowsPtr<T>(nt, localIdx, rwFlag) : NULL;
+    }
+
+    template <typename T>
+    T * getNestedColumnPtr(size_t feat_idx, size_t idx, size_t nrows, int rwFlag = (int)readOnly)
+    {
+        size_t localIdx   = 0;
+        NumericTable * nt = getNestedTable(idx, nrows, localIdx);
+        return nt ? internal::getDirectColumnPtr<T>(nt, feat_idx, localIdx, rwFlag) : NULL;
+    }
+
+    /* Returns the pointer to the row idx in the cache, the first call fills the cache with all the rows of the table under the lock */
+    template <typename T>
+    T * getCachedRowsPtr(size_t idx, services::Status & s)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs  = getNumberOfRows();
+
+        if (!_cache.isFilled())
+        {
+            internal::MergedTableCache::ScopedLock lock(_cache);
+            if (!_cache.isFilled())
+            {
+                T * data = _cache.allocate<T>(ncols * nobs);
+                if (data)
+                {
+                    services::Status st = readNestedRows<T>(0, nobs, data);
+                    if (!st)
+                    {
+                        _cache.invalidate();
+                        s |= st;
+                        return NULL;
+                    }
+                    _cache.publish();
+                }
+            }
+        }
+
+        /* The cache filled with the values of another type is not replaced as it may be in use, the rows are copied then */
+        T * cache = _cache.get<T>();
+        return cache ? cache + idx * ncols : NULL;
+    }
+
     services::Status setNumberOfColumnsImpl(size_t ncols) DAAL_C11_OVERRIDE;
     services::Status allocateDataMemoryImpl(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE;
     void freeDataMemoryImpl() DAAL_C11_OVERRIDE;
 
 protected:
     DataCollectionPtr _tables;
+    internal::MergedTableCache _cache;
 
     RowMergedNumericTable(services::Status & st);
 
@@ -152,6 +152,7 @@ public:
         }
 
         _partialMemStatus = userAllocated;
+        resetKnownFiniteness();
 
         if (_arraysInitialized == getNumberOfColumns())
         {
@@ -182,6 +183,8 @@ public:
     {
         if (idx < _ddict->getNumberOfFeatures())
         {
+            /* The data might be modified through the returned pointer unnoticed by the table */
+            exposeData();
             return _arrays[idx];
         }
         else
@@ -392,10 +395,11 @@ protected:
 
         for (size_t i = 0; i < ncol; i++)
         {
-            NumericTableFeature f = (*_ddict)[i];
+            NumericTableFeature f = _ddict->getFeature(i);
             if (f.typeSize != 0)
             {
-                _arrays[i] = services::SharedPtr<byte>((byte *)daal::services::daal_malloc(f.typeSize * nrows), services::ServiceDeleter());
+                _arrays[i] = services::SharedPtr<byte>((byte *)daal::services::internal::daal_malloc_table_data(f.typeSize * nrows),
+                                                       services::ServiceDeleter());
                 _arraysInitialized++;
             }
             if (!_arrays[i])
@@ -412,7 +416,9 @@ protected:
 
         if (_arraysInitialized == ncol)
         {
+            /* The memory allocated by the table is tracked until its raw pointer is handed out by getArray() */
             _memStatus = internallyAllocated;
+            enableFinitenessTracking();
         }
 
         DAAL_CHECK_STATUS_VAR(generatesOffsets())
@@ -428,6 +434,8 @@ protected:
 
         _partialMemStatus = notAllocated;
         _memStatus        = notAllocated;
+        resetKnownFiniteness();
+        resetDataExposure();
     }
 
     template <typename Archive, bool onDeserialize>
@@ -445,10 +453,10 @@ protected:
 
         for (size_t i = 0; i < ncol; i++)
         {
-            NumericTableFeature f = (*_ddict)[i];
+            NumericTableFeature f = _ddict->getFeature(i);
             void * ptr            = getArraySharedPtr(i).get();
 
-            arch->set((char *)ptr, nrows * f.typeSize);
+            arch->setShuffled((byte *)ptr, nrows, f.typeSize);
         }
 
         return services::Status();
@@ -513,12 +521,12 @@ private:
     bool isHomogeneousFloatOrDouble() const
     {
         const size_t ncols                                      = getNumberOfColumns();
-        const NumericTableFeature & f0                          = (*_ddict)[0];
+        const NumericTableFeature & f0                          = _ddict->getFeature(0);
         daal::data_management::features::IndexNumType indexType = f0.indexType;
 
         for (size_t i = 1; i < ncols; ++i)
         {
-            const NumericTableFeature & f1 = (*_ddict)[i];
+            const NumericTableFeature & f1 = _ddict->getFeature(i);
             if (f1.indexType != indexType) return false;
         }
 
@@ -541,6 +549,17 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
+        if (rwFlag == readOnlyBorrowed)
+        {
+            /* Rows of the structure of arrays are contiguous in memory only when there is a single column */
+            if (ncols == 1 && features::internal::getIndexNumType<T>() == _ddict->getFeature(0).indexType)
+            {
+                block.setPtr(&(_arrays[0]), _arrays[0].get() + idx * sizeof(T), 1, nrows);
+                return services::Status();
+            }
+            return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+        }
+
         if (!block.resizeBuffer(ncols, nrows))
         {
             return services::Status(services::ErrorMemoryAllocationFailed);
@@ -553,7 +572,7 @@ private:
 
         if (_wrapOffsets.get())
         {
-            NumericTableFeature & f = (*_ddict)[0];
+            const NumericTableFeature & f = _ddict->getFeature(0);
 
             if (daal::data_management::features::getIndexNumType<T>() == f.indexType)
             {
@@ -575,7 +594,7 @@ private:
 
                 for (size_t j = 0; j < ncols; ++j)
                 {
-                    NumericTableFeature & f = (*_ddict)[j];
+                    const NumericTableFeature & f = _ddict->getFeature(j);
 
                     char * ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
 
@@ -588,6 +607,7 @@ private:
                 }
             }
         }
+        addCopiedBytes(nrows * ncols * sizeof(T));
 
         return services::Status();
     }
@@ -597,6 +617,7 @@ private:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
+            resetKnownFiniteness();
             size_t ncols = getNumberOfColumns();
             size_t nrows = block.getNumberOfRows();
             size_t idx   = block.getRowsOffset();
@@ -615,7 +636,7 @@ private:
 
                 for (size_t j = 0; j < ncols; j++)
                 {
-                    NumericTableFeature & f = (*_ddict)[j];
+                    const NumericTableFeature & f = _ddict->getFeature(j);
 
                     char * ptr = (char *)_arrays[j].get() + (idx + i) * f.typeSize;
 
@@ -627,6 +648,7 @@ private:
                     internal::getVectorDownCast(f.indexType, internal::getConversionDataType<T>())(di, lbuf, ptr);
                 }
             }
+            addCopiedBytes(nrows * ncols * sizeof(T));
         }
         block.reset();
         return services::Status();
@@ -646,9 +668,11 @@ private:
 
         nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
 
-        const NumericTableFeature & f = (*_ddict)[feat_idx];
+        const NumericTableFeature & f = _ddict->getFeature(feat_idx);
         const int indexType           = f.indexType;
 
+        if (rwFlag & (int)writeOnly) resetKnownFiniteness();
+
         if (features::internal::getIndexNumType<T>() == f.indexType)
         {
             block.setPtr(&(_arrays[feat_idx]), _arrays[feat_idx].get() + idx * f.typeSize, 1, nrows);
@@ -661,6 +685,8 @@ private:
                 return services::Status(services::ErrorDataTypeNotSupported);
             }
 
+            if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
             byte * location = _arrays[feat_idx].get() + idx * f.typeSize;
 
             if (!block.resizeBuffer(1, nrows))
@@ -671,6 +697,7 @@ private:
             if (!(block.getRWFlag() & (int)readOnly)) return services::Status();
 
             internal::getVectorUpCast(indexType, internal::getConversionDataType<T>())(nrows, location, block.getBlockPtr());
+            addCopiedBytes(nrows * sizeof(T));
         }
         return services::Status();
     }
@@ -680,10 +707,11 @@ private:
     {
         if (block.getRWFlag() & (int)writeOnly)
         {
+            resetKnownFiniteness();
             size_t feat_idx = block.getColumnsOffset();
 
-            NumericTableFeature & f = (*_ddict)[feat_idx];
-            const int indexType     = f.indexType;
+            const NumericTableFeature & f = _ddict->getFeature(feat_idx);
+            const int indexType           = f.indexType;
 
             if (data_management::features::DAAL_OTHER_T == indexType)
             {
@@ -696,6 +724,7 @@ private:
                 char * ptr = (char *)_arrays[feat_idx].get() + block.getRowsOffset() * f.typeSize;
 
                 internal::getVectorDownCast(indexType, internal::getConversionDataType<T>())(block.getNumberOfRows(), block.getBlockPtr(), ptr);
+                addCopiedBytes(block.getNumberOfRows() * sizeof(T));
             }
         }
         block.reset();
@@ -0,0 +1,394 @@
+/* file: subset_numeric_table.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the numeric table that is a view of the subset of rows and columns of another table.
+//--
+*/
+
+#ifndef __SUBSET_NUMERIC_TABLE_H__
+#define __SUBSET_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "services/collection.h"
+#include "services/daal_defines.h"
+#include "data_management/data/data_serialize.h"
+#include "data_management/data/internal/merged_table_access.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup numeric_tables
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__SUBSETNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access the subset of rows and columns of a numeric table without a copy of the data,
+ *         for example the folds of cross-validation, bootstrap samples or subsets of features.
+ *         The row i of the subset is the row rowIndices[i] of the parent table, the column j is the column colIndices[j].
+ *         The rows are copied from the parent table on access, the consecutive rows with all the columns of a parent
+ *         HomogenNumericTable of the requested type are accessed in place
+ */
+class DAAL_EXPORT SubsetNumericTable : public NumericTable
+{
+public:
+    DECLARE_SERIALIZABLE_TAG()
+    DECLARE_SERIALIZABLE_IMPL()
+
+    /**
+     *  Constructor for an empty subset Numeric Table, used by the deserialization
+     */
+    SubsetNumericTable();
+
+    /**
+     *  Constructs the subset of rows of the table
+     *  \param[in]  table       Parent table
+     *  \param[in]  rowIndices  Indices of the rows of the parent table, may repeat. NULL for all the rows
+     *  \param[in]  nRows       Number of the indices of the rows
+     *  \param[out] stat        Status of the SubsetNumericTable construction
+     */
+    static services::SharedPtr<SubsetNumericTable> create(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows,
+                                                          services::Status * stat = NULL);
+
+    /**
+     *  Constructs the subset of rows and columns of the table
+     *  \param[in]  table       Parent table
+     *  \param[in]  rowIndices  Indices of the rows of the parent table, may repeat. NULL for all the rows
+     *  \param[in]  nRows       Number of the indices of the rows
+     *  \param[in]  colIndices  Indices of the columns of the parent table. NULL for all the columns
+     *  \param[in]  nCols       Number of the indices of the columns
+     *  \param[out] stat        Status of the SubsetNumericTable construction
+     */
+    static services::SharedPtr<SubsetNumericTable> create(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows,
+                                                          const size_t * colIndices, size_t nCols, services::Status * stat = NULL);
+
+    /**
+     *  Returns the parent table of the subset
+     *  \return Parent table
+     */
+    NumericTablePtr getParentTable() const { return _table; }
+
+    /**
+     *  Returns the indices of the rows of the parent table that form the subset
+     *  \return Pointer to getNumberOfRows() indices, NULL if the subset contains all the rows of the parent table in their order
+     */
+    const size_t * getRowIndices() const { return _rowIndices.size() ? _rowIndices.data() : NULL; }
+
+    /**
+     *  Returns the indices of the columns of the parent table that form the subset
+     *  \return Pointer to getNumberOfColumns() indices, NULL if the subset contains all the columns of the parent table in their order
+     */
+    const size_t * getColumnIndices() const { return _colIndices.size() ? _colIndices.data() : NULL; }
+
+    services::Status resize(size_t /*nrows*/) DAAL_C11_OVERRIDE
+    {
+        return services::Status(services::throwIfPossible(services::ErrorMethodNotSupported));
+    }
+
+    MemoryStatus getDataMemoryStatus() const DAAL_C11_OVERRIDE { return _table ? _table->getDataMemoryStatus() : notAllocated; }
+
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    services::Status getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfRows(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTBlock<double>(block); }
+    services::Status releaseBlockOfRows(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTBlock<float>(block); }
+    services::Status releaseBlockOfRows(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTBlock<int>(block); }
+
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<double> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<float> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    services::Status getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num, ReadWriteMode rwflag,
+                                            BlockDescriptor<int> & block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<double> & block) DAAL_C11_OVERRIDE { return releaseTFeature<double>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<float> & block) DAAL_C11_OVERRIDE { return releaseTFeature<float>(block); }
+    services::Status releaseBlockOfColumnValues(BlockDescriptor<int> & block) DAAL_C11_OVERRIDE { return releaseTFeature<int>(block); }
+
+protected:
+    template <typename Archive, bool onDeserialize>
+    services::Status serialImpl(Archive * arch)
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>(arch);
+
+        arch->setSharedPtrObj(_table);
+        arch->set(_rowIndices);
+        arch->set(_colIndices);
+
+        return services::Status();
+    }
+
+    size_t parentRow(size_t i) const { return _rowIndices.size() ? _rowIndices[i] : i; }
+
+    size_t parentColumn(size_t j) const { return _colIndices.size() ? _colIndices[j] : j; }
+
+    /* Returns the number of the rows starting from the row i and preceding the row end that are consecutive rows of the parent table */
+    size_t consecutiveRows(size_t i, size_t end) const
+    {
+        if (!_rowIndices.size()) return end - i;
+        size_t n = 1;
+        while (i + n < end && _rowIndices[i + n] == _rowIndices[i] + n) n++;
+        return n;
+    }
+
+    /* Returns the pointer to the rows [idx, idx + nrows) in the parent table if they can be accessed in place, NULL otherwise */
+    template <typename T>
+    T * getParentRowsPtr(size_t idx, size_t nrows, int rwFlag = (int)readOnly)
+    {
+        if (_colIndices.size() || consecutiveRows(idx, idx + nrows) != nrows) return NULL;
+        return internal::getDirectRowsPtr<T>(_table.get(), parentRow(idx), rwFlag);
+    }
+
+    template <typename T>
+    T * getParentColumnPtr(size_t feat_idx, size_t idx, size_t nrows, int rwFlag = (int)readOnly)
+    {
+        if (consecutiveRows(idx, idx + nrows) != nrows) return NULL;
+        return internal::getDirectColumnPtr<T>(_table.get(), parentColumn(feat_idx), parentRow(idx), rwFlag);
+    }
+
+    template <typename T>
+    services::Status getTBlock(size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t ncols = getNumberOfColumns();
+        const size_t nobs  = getNumberOfRows();
+        block.setDetails(0, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(ncols, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        T * rows = getParentRowsPtr<T>(idx, nrows, rwFlag);
+        if (rows)
+        {
+            block.setPtr(rows, ncols, nrows);
+            return services::Status();
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        if (!block.resizeBuffer(ncols, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if (rwFlag & (int)readOnly)
+        {
+            return copyRows<T>(idx, nrows, block.getBlockPtr(), true);
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTBlock(BlockDescriptor<T> & block)
+    {
+        services::Status s;
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t nrows = block.getNumberOfRows();
+            const size_t idx   = block.getRowsOffset();
+            if (block.getBlockPtr() != getParentRowsPtr<T>(idx, nrows))
+            {
+                s |= copyRows<T>(idx, nrows, block.getBlockPtr(), false);
+            }
+        }
+        block.reset();
+        return s;
+    }
+
+    template <typename T>
+    services::Status getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> & block)
+    {
+        const size_t nobs = getNumberOfRows();
+        block.setDetails(feat_idx, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(1, 0);
+            return services::Status();
+        }
+
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        T * values = getParentColumnPtr<T>(feat_idx, idx, nrows, rwFlag);
+        if (values)
+        {
+            block.setPtr(values, 1, nrows);
+            return services::Status();
+        }
+
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
+        if (!block.resizeBuffer(1, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        if (rwFlag & (int)readOnly)
+        {
+            return copyColumn<T>(feat_idx, idx, nrows, block.getBlockPtr(), true);
+        }
+        return services::Status();
+    }
+
+    template <typename T>
+    services::Status releaseTFeature(BlockDescriptor<T> & block)
+    {
+        services::Status s;
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            const size_t feat_idx = block.getColumnsOffset();
+            const size_t idx      = block.getRowsOffset();
+            const size_t nrows    = block.getNumberOfRows();
+            if (block.getBlockPtr() != getParentColumnPtr<T>(feat_idx, idx, nrows))
+            {
+                s |= copyColumn<T>(feat_idx, idx, nrows, block.getBlockPtr(), false);
+            }
+        }
+        block.reset();
+        return s;
+    }
+
+    /* Copies the rows [idx, idx + nrows) of the subset from the parent table to buffer if toBuffer is true, from buffer to the parent table
+       otherwise. The rows of a parent HomogenNumericTable of the type T are read through the indices directly, the rows of other tables
+       are accessed by the blocks of consecutive rows */
+    template <typename T>
+    services::Status copyRows(size_t idx, size_t nrows, T * buffer, bool toBuffer)
+    {
+        services::Status s;
+        const size_t ncols       = getNumberOfColumns();
+        const size_t parentNCols = _table->getNumberOfColumns();
+
+        /* The values of the columns out of the subset are kept when the rows are written */
+        const ReadWriteMode parentMode = toBuffer ? readOnly : (_colIndices.size() ? readWrite : writeOnly);
+        T * const parentData           = internal::getDirectRowsPtr<T>(_table.get(), 0, parentMode);
+
+        BlockDescriptor<T> parentBlock;
+        for (size_t i = 0; i < nrows;)
+        {
+            const size_t first = parentRow(idx + i);
+            const size_t n     = parentData ? 1 : consecutiveRows(idx + i, idx + nrows);
+
+            T * parentRows = parentData ? parentData + first * parentNCols : NULL;
+            if (!parentRows)
+            {
+                s |= _table->getBlockOfRows(first, n, parentMode, parentBlock);
+                if (!s) return s;
+                parentRows = parentBlock.getBlockPtr();
+            }
+
+            for (size_t r = 0; r < n; r++)
+            {
+                T * const row       = buffer + (i + r) * ncols;
+                T * const parentRow = parentRows + r * parentNCols;
+                for (size_t j = 0; j < ncols; j++)
+                {
+                    if (toBuffer)
+                        row[j] = parentRow[parentColumn(j)];
+                    else
+                        parentRow[parentColumn(j)] = row[j];
+                }
+            }
+
+            if (!parentData) s |= _table->releaseBlockOfRows(parentBlock);
+            i += n;
+        }
+        return s;
+    }
+
+    template <typename T>
+    services::Status copyColumn(size_t feat_idx, size_t idx, size_t nrows, T * buffer, bool toBuffer)
+    {
+        services::Status s;
+        const size_t parentNCols  = _table->getNumberOfColumns();
+        const size_t parentColIdx = parentColumn(feat_idx);
+        T * const parentData      = internal::getDirectRowsPtr<T>(_table.get(), 0, toBuffer ? readOnly : readWrite);
+
+        if (parentData)
+        {
+            for (size_t i = 0; i < nrows; i++)
+            {
+                T & parentValue = parentData[parentRow(idx + i) * parentNCols + parentColIdx];
+                if (toBuffer)
+                    buffer[i] = parentValue;
+                else
+                    parentValue = buffer[i];
+            }
+            return s;
+        }
+
+        BlockDescriptor<T> parentBlock;
+        for (size_t i = 0; i < nrows;)
+        {
+            const size_t n = consecutiveRows(idx + i, idx + nrows);
+            s |= _table->getBlockOfColumnValues(parentColIdx, parentRow(idx + i), n, toBuffer ? readOnly : writeOnly, parentBlock);
+            if (!s) return s;
+
+            T * const parentValues = parentBlock.getBlockPtr();
+            for (size_t k = 0; k < n; k++)
+            {
+                if (toBuffer)
+                    buffer[i + k] = parentValues[k];
+                else
+                    parentValues[k] = buffer[i + k];
+            }
+
+            s |= _table->releaseBlockOfColumnValues(parentBlock);
+            i += n;
+        }
+        return s;
+    }
+
+protected:
+    NumericTablePtr _table;
+    services::Collection<size_t> _rowIndices; /* Empty if the subset contains all the rows of the parent table */
+    services::Collection<size_t> _colIndices; /* Empty if the subset contains all the columns of the parent table */
+
+    SubsetNumericTable(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows, const size_t * colIndices, size_t nCols,
+                       services::Status & st);
+};
+typedef services::SharedPtr<SubsetNumericTable> SubsetNumericTablePtr;
+/** @} */
+} // namespace interface1
+using interface1::SubsetNumericTable;
+using interface1::SubsetNumericTablePtr;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
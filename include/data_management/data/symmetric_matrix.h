@@ -634,6 +634,8 @@ protected:
 
         nrows = (idx + nrows < nDim) ? nrows : nDim - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(nDim, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if ((rwFlag & (int)readOnly))
@@ -688,6 +690,8 @@ protected:
 
         nrows = (idx + nrows < nDim) ? nrows : nDim - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status();
 
         if ((block.getRWFlag() & (int)readOnly))
@@ -737,6 +741,8 @@ protected:
             return services::Status();
         }
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nSize)) return services::Status();
 
         if (!(rwFlag & (int)readOnly)) return services::Status();
@@ -1324,6 +1330,8 @@ protected:
 
         nrows = (idx + nrows < nDim) ? nrows : nDim - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(nDim, nrows)) return services::Status(services::ErrorMemoryAllocationFailed);
 
         if ((rwFlag & (int)readOnly))
@@ -1378,6 +1386,8 @@ protected:
 
         nrows = (idx + nrows < nDim) ? nrows : nDim - idx;
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nrows)) return services::Status();
 
         if ((block.getRWFlag() & (int)readOnly))
@@ -1426,6 +1436,8 @@ protected:
             return services::Status();
         }
 
+        if (rwFlag == (int)readOnlyBorrowed) return services::Status(services::ErrorZeroCopyAccessNotAvailable);
+
         if (!block.resizeBuffer(1, nSize)) return services::Status();
 
         if (!(rwFlag & (int)readOnly)) return services::Status();
@@ -0,0 +1,237 @@
+/* file: arrow_data_source.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source that reads Apache Arrow record batches.
+//--
+*/
+
+#ifndef __ARROW_DATA_SOURCE_H__
+#define __ARROW_DATA_SOURCE_H__
+
+#include "data_management/data_source/data_source.h"
+#include "data_management/data/arrow_numeric_table.h"
+#include <limits>
+#include <arrow/record_batch.h>
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ARROWRECORDBATCHDATASOURCE"></a>
+ *  \brief Data source that reads Apache Arrow record batches from a record batch reader,
+ *  e.g. arrow::ipc::RecordBatchStreamReader. Loaded rows are returned as an ArrowImmutableNumericTable
+ *  that refers to the memory of the record batches without copying, rows loaded by one call may belong to several record batches
+ */
+class ArrowRecordBatchDataSource : public DataSource
+{
+public:
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  reader                         Reader of the record batches
+     *  \param[in]  doCreateDictionaryFromContext  Flag that specifies whether the Data Dictionary is created from the schema of the reader
+     */
+    ArrowRecordBatchDataSource(const std::shared_ptr<arrow::RecordBatchReader> & reader,
+                               DictionaryCreationFlag doCreateDictionaryFromContext = doDictionaryFromContext)
+        : DataSource(), _reader(reader), _batchOffset(0), _dataSourceStatus(readyForLoad)
+    {
+        DataSource::_autoNumericTableFlag = notAllocateNumericTable;
+        DataSource::_autoDictionaryFlag   = doCreateDictionaryFromContext;
+        if (!_reader)
+        {
+            _dataSourceStatus = notReady;
+            this->_status.add(services::ErrorNullPtr);
+        }
+    }
+
+    virtual ~ArrowRecordBatchDataSource() {}
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if (_dict) return services::throwIfPossible(services::Status(services::ErrorDictionaryAlreadyAvailable));
+        if (!_reader) return services::throwIfPossible(services::Status(services::ErrorNullPtr));
+
+        const std::shared_ptr<arrow::Schema> schemaPtr = _reader->schema();
+        DAAL_ASSERT(schemaPtr);
+        const size_t nFeatures = (size_t)schemaPtr->num_fields();
+
+        services::Status s;
+        _dict = DataSourceDictionary::create(nFeatures, DictionaryIface::notEqual, &s);
+        if (!s) return services::throwIfPossible(s);
+
+        for (size_t i = 0; i < nFeatures; ++i)
+        {
+            const std::shared_ptr<arrow::Field> fieldPtr = schemaPtr->field(i);
+            DataSourceFeature & feature                  = (*_dict)[i];
+            feature.setFeatureName(services::String(fieldPtr->name().c_str()));
+            switch (fieldPtr->type()->id())
+            {
+            case arrow::Type::UINT8: feature.setType<unsigned char>(); break;
+            case arrow::Type::INT8: feature.setType<char>(); break;
+            case arrow::Type::UINT16: feature.setType<unsigned short>(); break;
+            case arrow::Type::INT16: feature.setType<short>(); break;
+            case arrow::Type::UINT32: feature.setType<unsigned int>(); break;
+            case arrow::Type::DATE32:
+            case arrow::Type::TIME32:
+            case arrow::Type::INT32: feature.setType<int>(); break;
+            case arrow::Type::UINT64: feature.setType<DAAL_UINT64>(); break;
+            case arrow::Type::DATE64:
+            case arrow::Type::TIMESTAMP:
+            case arrow::Type::TIME64:
+            case arrow::Type::INT64: feature.setType<DAAL_INT64>(); break;
+            case arrow::Type::FLOAT: feature.setType<float>(); break;
+            case arrow::Type::DOUBLE: feature.setType<double>(); break;
+            default: return services::throwIfPossible(services::Status(services::ErrorDataTypeNotSupported));
+            }
+        }
+        return s;
+    }
+
+    DataSourceStatus getStatus() DAAL_C11_OVERRIDE { return _dataSourceStatus; }
+
+    /**
+     *  Returns the number of rows of the current record batch that are not loaded yet,
+     *  the total number of rows of the stream is not known in advance
+     */
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE { return _batch ? (size_t)(_batch->num_rows() - _batchOffset) : 0; }
+
+    /**
+     *  The numeric table is created by every call of loadDataBlock(), there is nothing to allocate
+     */
+    services::Status allocateNumericTable() DAAL_C11_OVERRIDE { return services::Status(); }
+
+    void freeNumericTable() DAAL_C11_OVERRIDE { _spnt = NumericTablePtr(); }
+
+    /**
+     *  Loads the next maxRows rows or less if the stream ends, the rows are available via getNumericTable()
+     *  \param[in]  maxRows  Maximal number of rows to load
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
+    {
+        services::Status s = checkDictionary();
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        _spnt = NumericTablePtr();
+        if (_dataSourceStatus != readyForLoad) return 0;
+
+        const size_t nColumns = getNumberOfColumns();
+        std::vector<arrow::ArrayVector> chunks(nColumns);
+
+        size_t nLoaded = 0;
+        while (nLoaded < maxRows)
+        {
+            if (!_batch || _batchOffset == _batch->num_rows())
+            {
+                if (!readNextBatch()) break;
+                continue;
+            }
+
+            const size_t nAvailable = (size_t)(_batch->num_rows() - _batchOffset);
+            const size_t nRows      = (maxRows - nLoaded < nAvailable) ? maxRows - nLoaded : nAvailable;
+
+            /* Slicing of the record batch does not copy the data */
+            const std::shared_ptr<arrow::RecordBatch> slicePtr = _batch->Slice(_batchOffset, (int64_t)nRows);
+            for (size_t i = 0; i < nColumns; ++i)
+            {
+                chunks[i].push_back(slicePtr->column(i));
+            }
+
+            _batchOffset += (int64_t)nRows;
+            nLoaded += nRows;
+        }
+        if (nLoaded == 0) return 0;
+
+        const std::shared_ptr<arrow::Schema> schemaPtr = _reader->schema();
+#if ARROW_VERSION >= 15000
+        std::vector<std::shared_ptr<arrow::ChunkedArray> > columns(nColumns);
+        for (size_t i = 0; i < nColumns; ++i)
+        {
+            columns[i] = std::make_shared<arrow::ChunkedArray>(chunks[i]);
+        }
+#else
+        std::vector<std::shared_ptr<arrow::Column> > columns(nColumns);
+        for (size_t i = 0; i < nColumns; ++i)
+        {
+            columns[i] = std::make_shared<arrow::Column>(schemaPtr->field(i), std::make_shared<arrow::ChunkedArray>(chunks[i]));
+        }
+#endif
+        const std::shared_ptr<arrow::Table> tablePtr = arrow::Table::Make(schemaPtr, columns, (int64_t)nLoaded);
+
+        _spnt = ArrowImmutableNumericTable::create(tablePtr, &s);
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+        return nLoaded;
+    }
+
+    /**
+     *  Loads all the rows remaining in the stream
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock() DAAL_C11_OVERRIDE { return loadDataBlock(std::numeric_limits<size_t>::max()); }
+
+private:
+    /* Reads the next non-empty record batch, returns false at the end of the stream */
+    bool readNextBatch()
+    {
+        do
+        {
+            const arrow::Status readStatus = _reader->ReadNext(&_batch);
+            if (!readStatus.ok())
+            {
+                _batch            = std::shared_ptr<arrow::RecordBatch>();
+                _dataSourceStatus = notReady;
+                this->_status.add(services::throwIfPossible(services::Status(services::ErrorOnFileRead)));
+                return false;
+            }
+        } while (_batch && _batch->num_rows() == 0);
+
+        _batchOffset = 0;
+        if (!_batch)
+        {
+            _dataSourceStatus = endOfData;
+            return false;
+        }
+        return true;
+    }
+
+    std::shared_ptr<arrow::RecordBatchReader> _reader;
+    std::shared_ptr<arrow::RecordBatch> _batch;
+    int64_t _batchOffset;
+    DataSourceStatus _dataSourceStatus;
+};
+/** @} */
+} // namespace interface1
+using interface1::ArrowRecordBatchDataSource;
+
+} // namespace data_management
+} // namespace daal
+#endif
@@ -55,7 +55,8 @@ public:
         byDefault                   = 0,
         allocateNumericTable        = 1 << 0,
         createDictionaryFromContext = 1 << 1,
-        parseHeader                 = 1 << 2
+        parseHeader                 = 1 << 2,
+        parallelLoading             = 1 << 3 /*!< Map the file into memory and parse its rows in parallel (FileDataSource only) */
     };
 
     static CsvDataSourceOptions::Value unite(const CsvDataSourceOptions::Value & lhs, const CsvDataSourceOptions::Value & rhs)
@@ -77,10 +78,32 @@ public:
 
     bool getParseHeaderFlag() const { return _impl.getFlag(parseHeader); }
 
+    bool getParallelLoadingFlag() const { return _impl.getFlag(parallelLoading); }
+
 private:
     internal::DataSourceOptionsImpl<Value> _impl;
 };
 
+/**
+ *  Checks whether rows can be parsed by concurrent calls of parseRowIn() of the feature manager.
+ *  Feature managers are not thread-safe unless they provide an overload of this function
+ */
+template <typename FeatureManager>
+inline bool isParallelParsingSupported(const FeatureManager & /*featureManager*/)
+{
+    return false;
+}
+
+/**
+ *  Checks whether the last row parsed by parseRowIn() of the feature manager is stored in the row buffer.
+ *  Feature managers that do not filter rows accept all of them
+ */
+template <typename FeatureManager>
+inline bool isLastRowAccepted(const FeatureManager & /*featureManager*/)
+{
+    return true;
+}
+
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__FILEDATASOURCE"></a>
  *  \brief Specifies methods to access data stored in files
@@ -216,6 +239,10 @@ public:
         {
             this->_status.add(services::throwIfPossible(services::Status(services::ErrorMemoryCopyFailedInternal)));
         }
+        else
+        {
+            super::updateFiniteness(nt);
+        }
         return nrows;
     }
 
@@ -223,6 +250,8 @@ public:
     {
         size_t nLines = loadDataBlock(maxRows, 0, maxRows, nt);
         nt->resize(nLines);
+        /* the statistics are accumulated over all the rows of the table */
+        if (nLines > 0) super::updateFiniteness(nt);
         return nLines;
     }
 
@@ -272,30 +301,16 @@ public:
         BlockDescriptor<DAAL_DATA_TYPE> ntBlock;
         nt->getBlockOfRows(0, nt->getNumberOfRows(), readWrite, ntBlock);
 
-        for (; j < maxRows && !iseof(); j++)
-        {
-            s = readLine();
-            if (!s)
-            {
-                this->_status.add(services::throwIfPossible(s));
-
-                return 0;
-            }
-            if (!_rawLineLength)
-            {
-                break;
-            }
+        s = parseRows(maxRows, rowOffset, nt, ntBlock, j);
 
-            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBlock.getBlockPtr() + (rowOffset + j) * nt->getNumberOfColumns(),
-                                                           ntBlock.getNumberOfColumns());
-
-            _featureManager.parseRowIn(_rawLineBuffer, _rawLineLength, this->_dict.get(), rowBuffer, rowOffset + j);
+        nt->releaseBlockOfRows(ntBlock);
 
-            super::updateStatistics(j, nt, ntBlock.getBlockPtr(), rowOffset);
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
         }
 
-        nt->releaseBlockOfRows(ntBlock);
-
         _featureManager.finalize(this->_dict.get());
 
         return rowOffset + j;
@@ -352,6 +367,46 @@ protected:
     virtual bool iseof() const          = 0;
     virtual services::Status readLine() = 0;
 
+    /**
+     *  Parses at most maxRows rows of the data source into the block of the numeric table
+     *  and updates the basic statistics of the table
+     *  \param[in]  maxRows    Maximum number of rows to parse
+     *  \param[in]  rowOffset  Index of the row in the block to store the first parsed row
+     *  \param[in]  nt         Numeric table to store the parsed rows
+     *  \param[in]  ntBlock    Block of rows of the numeric table
+     *  \param[out] nRows      Number of parsed rows
+     *  \return Status of the operation
+     */
+    virtual services::Status parseRows(size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock, size_t & nRows)
+    {
+        services::Status s;
+        for (nRows = 0; nRows < maxRows && !iseof();)
+        {
+            s = readLine();
+            if (!s)
+            {
+                return s;
+            }
+            if (!_rawLineLength)
+            {
+                break;
+            }
+
+            services::BufferView<DAAL_DATA_TYPE> rowBuffer(ntBlock.getBlockPtr() + (rowOffset + nRows) * nt->getNumberOfColumns(),
+                                                           ntBlock.getNumberOfColumns());
+
+            _featureManager.parseRowIn(_rawLineBuffer, _rawLineLength, this->_dict.get(), rowBuffer, rowOffset + nRows);
+            if (!isLastRowAccepted(_featureManager))
+            {
+                continue;
+            }
+
+            super::updateStatistics(nRows, nt, ntBlock.getBlockPtr(), rowOffset);
+            nRows++;
+        }
+        return s;
+    }
+
     virtual services::Status resetNumericTable(NumericTable * nt, const size_t newSize)
     {
         services::Status s;
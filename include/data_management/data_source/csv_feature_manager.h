@@ -300,6 +300,129 @@ public:
     }
 };
 
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__ROWFILTER"></a>
+ *  \brief Conditions on the raw tokens of a CSV row. The rows that do not satisfy all the conditions
+ *         are skipped by the data source before their tokens are converted to numeric values
+ */
+class RowFilter
+{
+public:
+    RowFilter() : _numberOfTokens(0) {}
+
+    /**
+     *  Adds the condition that the token of a feature is equal to the value
+     *  \param[in]  idx    Index of the feature in the CSV row
+     *  \param[in]  value  The value
+     */
+    RowFilter & equal(size_t idx, const std::string & value) { return addCondition(Condition(idx, Condition::equal, value)); }
+
+    /**
+     *  Adds the condition that the token of a feature is not equal to the value
+     *  \param[in]  idx    Index of the feature in the CSV row
+     *  \param[in]  value  The value
+     */
+    RowFilter & notEqual(size_t idx, const std::string & value) { return addCondition(Condition(idx, Condition::notEqual, value)); }
+
+    /**
+     *  Adds the condition that the numeric value of a feature is less than the threshold
+     *  \param[in]  idx        Index of the feature in the CSV row
+     *  \param[in]  threshold  The threshold
+     */
+    RowFilter & less(size_t idx, DAAL_DATA_TYPE threshold) { return addCondition(Condition(idx, Condition::less, threshold)); }
+
+    /**
+     *  Adds the condition that the numeric value of a feature is greater than the threshold
+     *  \param[in]  idx        Index of the feature in the CSV row
+     *  \param[in]  threshold  The threshold
+     */
+    RowFilter & greater(size_t idx, DAAL_DATA_TYPE threshold) { return addCondition(Condition(idx, Condition::greater, threshold)); }
+
+    /**
+     *  Checks whether the filter has no conditions
+     *  \return True if all rows are accepted
+     */
+    bool isEmpty() const { return _conditions.size() == 0; }
+
+    /**
+     *  Returns the number of leading tokens of a row needed to check the conditions
+     *  \return The number of tokens
+     */
+    size_t getNumberOfTokens() const { return _numberOfTokens; }
+
+    /**
+     *  Checks whether the tokens of a row satisfy all the conditions
+     *  \param[in]  tokens   Tokens of the row
+     *  \param[in]  nTokens  Number of tokens
+     *  \return True if the row is accepted
+     */
+    bool accept(const services::StringView * tokens, size_t nTokens) const
+    {
+        for (size_t i = 0; i < _conditions.size(); i++)
+        {
+            const Condition & c = _conditions[i];
+            if (c.idx >= nTokens)
+            {
+                return false;
+            }
+
+            const services::StringView & token = tokens[c.idx];
+            switch (c.type)
+            {
+            case Condition::equal:
+                if (!isEqual(token, c.value)) return false;
+                break;
+            case Condition::notEqual:
+                if (isEqual(token, c.value)) return false;
+                break;
+            case Condition::less:
+                if (!(daal::services::daal_string_to_float(token.c_str(), 0) < c.threshold)) return false;
+                break;
+            case Condition::greater:
+                if (!(daal::services::daal_string_to_float(token.c_str(), 0) > c.threshold)) return false;
+                break;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Condition
+    {
+        enum Type
+        {
+            equal,
+            notEqual,
+            less,
+            greater
+        };
+
+        Condition() : idx(0), type(equal), threshold(0) {}
+        Condition(size_t idx, Type type, const std::string & value) : idx(idx), type(type), value(value), threshold(0) {}
+        Condition(size_t idx, Type type, DAAL_DATA_TYPE threshold) : idx(idx), type(type), threshold(threshold) {}
+
+        size_t idx;
+        Type type;
+        std::string value;
+        DAAL_DATA_TYPE threshold;
+    };
+
+    RowFilter & addCondition(const Condition & condition)
+    {
+        _conditions.push_back(condition);
+        _numberOfTokens = (condition.idx + 1 > _numberOfTokens) ? condition.idx + 1 : _numberOfTokens;
+        return *this;
+    }
+
+    static bool isEqual(const services::StringView & token, const std::string & value)
+    {
+        return token.size() == value.size() && value.compare(0, value.size(), token.c_str(), token.size()) == 0;
+    }
+
+    services::Collection<Condition> _conditions;
+    size_t _numberOfTokens;
+};
+
 namespace interface1
 {
 /**
@@ -318,7 +441,7 @@ public:
     /**
      *  Default constructor
      */
-    CSVFeatureManager() : _delimiter(','), _isHeaderParsed(false), _numberOfTokens(0) {}
+    CSVFeatureManager() : _delimiter(','), _isHeaderParsed(false), _numberOfTokens(0), _numberOfTokensToParse(0), _isRowAccepted(true) {}
 
     virtual ~CSVFeatureManager() {}
 
@@ -355,15 +478,38 @@ public:
         funcList.clear();
         fillAuxVectAndFuncList(*dictionary);
         _numberOfTokens = dictionary->getNumberOfFeatures();
+        updateNumberOfTokensToParse();
 
         return services::Status();
     }
 
     /**
-     * Adds a simple feature modifier
+     * Adds a simple feature modifier. The tokens after the last feature that is not filtered out
+     * by the modifiers are not parsed
      * \param[in]  modifier The modifier
      */
-    void addModifier(const ModifierIface & modifier) { modifier.apply(funcList, auxVect); }
+    void addModifier(const ModifierIface & modifier)
+    {
+        modifier.apply(funcList, auxVect);
+        updateNumberOfTokensToParse();
+    }
+
+    /**
+     * Sets the filter of rows. The rows rejected by the filter are skipped
+     * before their tokens are converted to numeric values
+     * \param[in]  filter The filter of rows
+     */
+    void setRowFilter(const RowFilter & filter)
+    {
+        _rowFilter = filter;
+        updateNumberOfTokensToParse();
+    }
+
+    /**
+     * Checks whether the last row passed to parseRowIn() is accepted by the filter of rows
+     * \return False if the row is rejected and the row buffer is left unchanged
+     */
+    bool isLastRowAccepted() const { return _isRowAccepted; }
 
     /**
      * Adds extended feature modifier
@@ -441,6 +587,7 @@ public:
         {
             fillDictionaryWithoutModifiers(*dictionary);
         }
+        updateNumberOfTokensToParse();
     }
 
     /**
@@ -460,9 +607,27 @@ public:
         size_t i = 0;
         internal::CSVRowTokenizer tokenizer(rawRowData, rawDataSize, _delimiter);
 
+        if (!_rowFilter.isEmpty())
+        {
+            size_t nTokens = 0;
+            for (tokenizer.reset(); tokenizer.good() && nTokens < _numberOfTokensToParse; tokenizer.next(), nTokens++)
+            {
+                _tokens[nTokens] = tokenizer.getCurrentToken();
+            }
+
+            _isRowAccepted = _rowFilter.accept(_tokens.data(), nTokens);
+            if (!_isRowAccepted)
+            {
+                return;
+            }
+
+            parseTokens(_tokens.data(), nTokens, rowBuffer);
+            return;
+        }
+
         if (_modifiersManager)
         {
-            for (tokenizer.reset(); tokenizer.good() && i < _numberOfTokens; tokenizer.next(), i++)
+            for (tokenizer.reset(); tokenizer.good() && i < _numberOfTokensToParse; tokenizer.next(), i++)
             {
                 _modifiersManager->setToken(i, tokenizer.getCurrentToken());
             }
@@ -471,7 +636,7 @@ public:
         else
         {
             DAAL_DATA_TYPE * row = rowBuffer.data();
-            for (tokenizer.reset(); tokenizer.good() && i < _numberOfTokens; tokenizer.next(), i++)
+            for (tokenizer.reset(); tokenizer.good() && i < _numberOfTokensToParse; tokenizer.next(), i++)
             {
                 const services::StringView token = tokenizer.getCurrentToken();
                 funcList[i](token.c_str(), auxVect[i], row);
@@ -479,6 +644,22 @@ public:
         }
     }
 
+    /**
+     * Checks whether parseRowIn() can be called concurrently for different rows.
+     * It is true when no feature modifiers are set and data has no categorical features,
+     * so parsing does not update any state of the feature manager or the dictionary
+     * \return True if rows can be parsed in parallel
+     */
+    bool isParallelParsingSupported() const
+    {
+        if (_modifiersManager || !_rowFilter.isEmpty()) return false;
+        for (size_t i = 0; i < funcList.size(); i++)
+        {
+            if (funcList[i] != ModifierIface::contFunc && funcList[i] != ModifierIface::nullFunc) return false;
+        }
+        return true;
+    }
+
     /**
      * Finalizes CSV data parsing
      * \param[in]  dictionary  Pointer to the dictionary
@@ -493,6 +674,59 @@ public:
     }
 
 private:
+    void parseTokens(const services::StringView * tokens, size_t nTokens, services::BufferView<DAAL_DATA_TYPE> & rowBuffer)
+    {
+        const size_t nParsed = services::internal::minValue(nTokens, _numberOfTokens);
+        if (_modifiersManager)
+        {
+            for (size_t i = 0; i < nParsed; i++)
+            {
+                _modifiersManager->setToken(i, tokens[i]);
+            }
+            _modifiersManager->applyModifiers(rowBuffer);
+        }
+        else
+        {
+            DAAL_DATA_TYPE * row = rowBuffer.data();
+            for (size_t i = 0; i < nParsed; i++)
+            {
+                funcList[i](tokens[i].c_str(), auxVect[i], row);
+            }
+        }
+    }
+
+    /* Tokens after the last one used by the modifiers and the filter of rows are not parsed */
+    void updateNumberOfTokensToParse()
+    {
+        size_t nUsed = 0;
+        if (_modifiersManager)
+        {
+            nUsed = _modifiersManager->getNumberOfUsedInputFeatures();
+        }
+        else
+        {
+            for (size_t i = funcList.size(); i > 0; i--)
+            {
+                if (funcList[i - 1] != ModifierIface::nullFunc)
+                {
+                    nUsed = i;
+                    break;
+                }
+            }
+        }
+        nUsed                  = services::internal::maxValue(nUsed, _rowFilter.getNumberOfTokens());
+        _numberOfTokensToParse = services::internal::minValue(nUsed, _numberOfTokens);
+        if (!_rowFilter.isEmpty())
+        {
+            _tokens.clear();
+            for (size_t i = 0; i < _numberOfTokensToParse; i++)
+            {
+                _tokens.push_back(services::StringView());
+            }
+        }
+        _isRowAccepted = true;
+    }
+
     void fillDictionaryWithoutModifiers(DataSourceDictionary & dictionary)
     {
         const size_t nFeatures = _featuresInfo.getNumberOfFeatures();
@@ -551,11 +785,26 @@ protected:
 private:
     bool _isHeaderParsed;
     size_t _numberOfTokens;
+    size_t _numberOfTokensToParse;
+    bool _isRowAccepted;
     BlockDescriptor<DAAL_DATA_TYPE> _currentRowBlock;
 
+    RowFilter _rowFilter;
+    services::Collection<services::StringView> _tokens;
+
     internal::CSVFeaturesInfo _featuresInfo;
     modifiers::csv::internal::ModifiersManagerPtr _modifiersManager;
 };
+
+inline bool isParallelParsingSupported(const CSVFeatureManager & featureManager)
+{
+    return featureManager.isParallelParsingSupported();
+}
+
+inline bool isLastRowAccepted(const CSVFeatureManager & featureManager)
+{
+    return featureManager.isLastRowAccepted();
+}
 /** @} */
 } // namespace interface1
 
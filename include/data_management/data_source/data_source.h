@@ -29,6 +29,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/internal/finiteness_checker.h"
 
 #include "data_management/data_source/data_source_utils.h"
 
@@ -727,6 +728,59 @@ protected:
         s.add(combineSingleStatistics(ntSrc, ntDst, wasEmpty, NumericTable::sumSquares));
         return s;
     }
+
+    /**
+     *  Marks the values of the numeric table as known to be finite if the sums of its columns, accumulated in the basic statistics
+     *  while the rows were loaded, are finite. So the finiteness of the loaded data is not checked by one more pass over the table
+     *  \param[in]  nt  Numeric table all the rows of which were loaded with the update of the basic statistics
+     */
+    void updateFiniteness(NumericTable * nt)
+    {
+        if (nt == NULL || nt->getNumberOfRows() == 0) return;
+
+        NumericTablePtr ntMin = nt->basicStatistics.get(NumericTable::minimum);
+        NumericTablePtr ntMax = nt->basicStatistics.get(NumericTable::maximum);
+        NumericTablePtr ntSum = nt->basicStatistics.get(NumericTable::sum);
+        if (ntMin.get() == NULL || ntMax.get() == NULL || ntSum.get() == NULL) return;
+
+        BlockDescriptor<_summaryStatisticsType> blockMin;
+        BlockDescriptor<_summaryStatisticsType> blockMax;
+        BlockDescriptor<_summaryStatisticsType> blockSum;
+
+        ntMin->getBlockOfRows(0, 1, readOnly, blockMin);
+        ntMax->getBlockOfRows(0, 1, readOnly, blockMax);
+        ntSum->getBlockOfRows(0, 1, readOnly, blockSum);
+
+        const _summaryStatisticsType * minimum = blockMin.getBlockPtr();
+        const _summaryStatisticsType * maximum = blockMax.getBlockPtr();
+        const _summaryStatisticsType * sum     = blockSum.getBlockPtr();
+
+        const size_t nCols = nt->getNumberOfColumns();
+
+        /* infinite and NaN values propagate to the sum */
+        const bool finite = minimum && maximum && sum && blockSum.getNumberOfColumns() == nCols && internal::valuesAreFinite(sum, nCols, false);
+
+        /* the loaded values that exceed the range of the single precision are infinite in the single precision features
+           and when the table is read in the single precision */
+        NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+        bool finiteInFloat               = finite;
+        for (size_t i = 0; i < nCols && finiteInFloat; i++)
+        {
+            finiteInFloat = minimum[i] >= -FLT_MAX && maximum[i] <= FLT_MAX;
+        }
+        bool finiteInDouble = finite;
+        for (size_t i = 0; i < nCols && finiteInDouble; i++)
+        {
+            if (ntDict->getFeature(i).indexType == features::DAAL_FLOAT32) finiteInDouble = minimum[i] >= -FLT_MAX && maximum[i] <= FLT_MAX;
+        }
+
+        ntMin->releaseBlockOfRows(blockMin);
+        ntMax->releaseBlockOfRows(blockMax);
+        ntSum->releaseBlockOfRows(blockSum);
+
+        if (finiteInFloat) nt->setKnownFinite<float>(false);
+        if (finiteInDouble) nt->setKnownFinite<double>(false);
+    }
 };
 
 /** @} */
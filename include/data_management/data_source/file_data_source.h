@@ -32,6 +32,8 @@
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data_source/internal/mapped_file.h"
+#include "data_management/data_source/internal/csv_parallel_parser.h"
 
 namespace daal
 {
@@ -45,7 +47,9 @@ namespace interface1
  */
 /**
  *  <a name="DAAL-CLASS-DATA_MANAGEMENT__FILEDATASOURCE"></a>
- *  \brief Specifies methods to access data stored in files
+ *  \brief Specifies methods to access data stored in files.
+ *         With CsvDataSourceOptions::parallelLoading the file is mapped into memory and,
+ *         if the feature manager supports it, rows are parsed in parallel
  *  \tparam FeatureManager         The type of feature manager that specifies how to extract numerical data from CSV
  *  \tparam SummaryStatisticsType  The floating point type to compute summary statics for numeric table
  */
@@ -88,7 +92,7 @@ public:
      */
     FileDataSource(const std::string & fileName, CsvDataSourceOptions options, size_t initialMaxRows = 10) : super(options, initialMaxRows)
     {
-        _status |= initialize(fileName);
+        _status |= initialize(fileName, options.getParallelLoadingFlag());
     }
 
     virtual ~FileDataSource()
@@ -98,9 +102,36 @@ public:
     }
 
 public:
+    using super::loadDataBlock;
+
+    size_t loadDataBlock(NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        if (!_mappedFile.isOpen())
+        {
+            return super::loadDataBlock(nt);
+        }
+
+        services::Status s = super::checkDictionary();
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        /* All rows are known in advance, so they are parsed straight into the table with no intermediate blocks */
+        internal::CsvParallelParser<FeatureManager, SummaryStatisticsType> parser(_mappedFile.data(), _mappedFile.size(),
+                                                                                  this->getFeatureManager(), this->_dict.get());
+        return loadDataBlock(parser.countRows(_mappedPos), nt);
+    }
+
     services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
     {
         services::Status s = super::createDictionaryFromContext();
+        if (_mappedFile.isOpen())
+        {
+            _mappedPos = 0;
+            return s;
+        }
         fseek(_file, 0, SEEK_SET);
         _fileBufferPos = _fileBufferLen;
         return s;
@@ -109,7 +140,50 @@ public:
     DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE { return (iseof() ? DataSourceIface::endOfData : DataSourceIface::readyForLoad); }
 
 protected:
-    bool iseof() const DAAL_C11_OVERRIDE { return (_fileBufferPos == _readedFromFileLen && feof(_file)); }
+    bool iseof() const DAAL_C11_OVERRIDE
+    {
+        if (_mappedFile.isOpen()) return _mappedPos >= _mappedFile.size();
+        return (_fileBufferPos == _readedFromFileLen && feof(_file));
+    }
+
+    services::Status parseRows(size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock,
+                               size_t & nRows) DAAL_C11_OVERRIDE
+    {
+        if (!_mappedFile.isOpen() || !isParallelParsingSupported(this->getFeatureManager()))
+        {
+            return super::parseRows(maxRows, rowOffset, nt, ntBlock, nRows);
+        }
+
+        internal::CsvParallelParser<FeatureManager, SummaryStatisticsType> parser(_mappedFile.data(), _mappedFile.size(),
+                                                                                  this->getFeatureManager(), this->_dict.get());
+        return parser.parse(_mappedPos, maxRows, rowOffset, nt, ntBlock, nRows);
+    }
+
+    services::Status readMappedLine()
+    {
+        const char * data = _mappedFile.data();
+        const size_t size = _mappedFile.size();
+
+        const size_t lineEnd    = internal::findFirst(data, _mappedPos, size, '\n');
+        const size_t lineLength = lineEnd - _mappedPos;
+        while (lineLength + 1 > (size_t)_rawLineBufferLen)
+        {
+            if (!super::enlargeBuffer()) return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        if (lineLength && services::internal::daal_memcpy_s(_rawLineBuffer, _rawLineBufferLen, data + _mappedPos, lineLength))
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        _rawLineLength = (int)lineLength;
+        _mappedPos     = (lineEnd < size) ? lineEnd + 1 : lineEnd;
+
+        while (_rawLineLength > 0 && _rawLineBuffer[_rawLineLength - 1] == '\r')
+        {
+            _rawLineLength--;
+        }
+        _rawLineBuffer[_rawLineLength] = '\0';
+        return services::Status();
+    }
 
     bool readLine(char * buffer, int count, int & pos)
     {
@@ -119,13 +193,22 @@ protected:
         {
             if (_fileBufferPos < _readedFromFileLen)
             {
-                if (_fileBuffer[_fileBufferPos] == '\0')
+                /* Copy the symbols up to the line break at once */
+                const size_t chunkBegin = (size_t)_fileBufferPos;
+                const size_t chunkEnd   = services::internal::minValue((size_t)_readedFromFileLen, chunkBegin + (size_t)(count - 1 - pos));
+                const size_t stop       = internal::findFirstOf(_fileBuffer, chunkBegin, chunkEnd, '\n', '\0');
+                if (stop < chunkEnd && _fileBuffer[stop] == '\0')
+                {
+                    return false;
+                }
+
+                const size_t nCopy = (stop < chunkEnd) ? stop + 1 - chunkBegin : chunkEnd - chunkBegin;
+                if (services::internal::daal_memcpy_s(buffer + pos, (size_t)(count - pos), _fileBuffer + chunkBegin, nCopy))
                 {
                     return false;
                 }
-                buffer[pos] = _fileBuffer[_fileBufferPos];
-                ++pos;
-                ++_fileBufferPos;
+                pos += (int)nCopy;
+                _fileBufferPos += (int)nCopy;
                 if (buffer[pos - 1] == '\n') break;
             }
             else
@@ -146,6 +229,11 @@ protected:
 
     services::Status readLine() DAAL_C11_OVERRIDE
     {
+        if (_mappedFile.isOpen())
+        {
+            return readMappedLine();
+        }
+
         _rawLineLength = 0;
         while (!iseof())
         {
@@ -176,7 +264,7 @@ protected:
     }
 
 private:
-    services::Status initialize(const std::string & fileName)
+    services::Status initialize(const std::string & fileName, bool parallelLoading = false)
     {
         _file              = NULL;
         _fileName          = fileName;
@@ -184,10 +272,15 @@ private:
         _fileBufferPos     = _fileBufferLen;
         _fileBuffer        = NULL;
         _readedFromFileLen = 0;
+        _mappedPos         = 0;
         if (fileName.find('\0') != std::string::npos)
         {
             return services::throwIfPossible(services::ErrorNullByteInjection);
         }
+        if (parallelLoading)
+        {
+            return services::throwIfPossible(_mappedFile.open(fileName.c_str()));
+        }
 #if (defined(_MSC_VER) && (_MSC_VER >= 1400))
         errno_t error;
         error = fopen_s(&_file, fileName.c_str(), "r");
@@ -222,6 +315,9 @@ protected:
     int _fileBufferPos;
     int _readedFromFileLen;
 
+    internal::MappedFile _mappedFile;
+    size_t _mappedPos;
+
 private:
     static const size_t INITIAL_FILE_BUFFER_LENGTH = 1048576;
 };
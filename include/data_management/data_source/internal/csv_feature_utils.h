@@ -23,6 +23,7 @@
 #include "services/collection.h"
 #include "services/daal_string.h"
 #include "data_management/features/defines.h"
+#include "data_management/data_source/internal/csv_symbol_scanner.h"
 
 namespace daal
 {
@@ -73,11 +74,7 @@ public:
         }
 
         _prevPos = _pos;
-
-        while (isValidSymbol(_pos) && !isStopSymbol(_pos))
-        {
-            _pos++;
-        }
+        _pos     = findFirstOf(_rawData, _pos, _rawDataSize, _delimiter, '\0');
 
         _tokenSize = _pos - _prevPos;
         _goodFlag  = isValidSymbol(_prevPos);
@@ -0,0 +1,422 @@
+/* file: csv_parallel_parser.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_SOURCE_INTERNAL_CSV_PARALLEL_PARSER_H__
+#define __DATA_SOURCE_INTERNAL_CSV_PARALLEL_PARSER_H__
+
+#include "services/collection.h"
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+#include "services/buffer_view.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data_source/data_source_dictionary.h"
+#include "data_management/data_source/internal/mapped_file.h"
+#include "data_management/data_source/internal/csv_symbol_scanner.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__CSVCHUNK"></a>
+ *  \brief Contiguous part of CSV data processed by one task. The chunk owns all rows
+ *         that start inside [begin, end), rows may span the chunk end.
+ */
+struct CsvChunk
+{
+    CsvChunk() : begin(0), end(0), firstRow(0) {}
+    CsvChunk(size_t b, size_t e, size_t row) : begin(b), end(e), firstRow(row) {}
+
+    size_t begin;
+    size_t end;
+    size_t firstRow; /*!< Number of line breaks between the start of the data and the chunk begin */
+};
+
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__CSVPARALLELPARSER"></a>
+ *  \brief Parses rows of CSV data that resides in memory in parallel. Every task
+ *         parses the rows of its chunk directly into the rows of the target numeric table.
+ *  \tparam FeatureManager         Feature manager that supports concurrent calls of parseRowIn()
+ *  \tparam SummaryStatisticsType  The floating point type to compute summary statistics
+ */
+template <typename FeatureManager, typename SummaryStatisticsType>
+class CsvParallelParser
+{
+public:
+    CsvParallelParser(const char * data, size_t dataSize, FeatureManager & featureManager, DataSourceDictionary * dict)
+        : _data(data), _dataSize(dataSize), _featureManager(featureManager), _dict(dict)
+    {}
+
+    /**
+     *  Counts the rows of the data starting at the position
+     *  \param[in]  pos  Position of the first row
+     *  \return Number of rows
+     */
+    size_t countRows(size_t pos) const
+    {
+        if (pos >= _dataSize) return 0;
+
+        services::Collection<CsvChunk> chunks;
+        size_t cut = 0;
+        splitOnRows(pos, size_t(-1), chunks, cut);
+
+        size_t nLines = 0;
+        if (chunks.size())
+        {
+            const CsvChunk & last = chunks[chunks.size() - 1];
+            nLines                = last.firstRow + countLineBreaks(last.begin, last.end);
+        }
+        return (_data[cut - 1] != '\n') ? nLines + 1 : nLines;
+    }
+
+    /**
+     *  Parses at most maxRows rows starting at the position into the block of rows
+     *  \param[in,out] pos        Position of the first row, set to the position of the next unparsed row on exit
+     *  \param[in]     maxRows    Maximum number of rows to parse
+     *  \param[in]     rowOffset  Index of the row in the block to store the first parsed row
+     *  \param[in]     nt         Numeric table to store the parsed rows
+     *  \param[in]     ntBlock    Block of rows of the numeric table
+     *  \param[out]    nRows      Number of parsed rows
+     *  \return Status of the operation
+     */
+    services::Status parse(size_t & pos, size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock,
+                           size_t & nRows)
+    {
+        nRows = 0;
+        if (pos >= _dataSize || !maxRows) return services::Status();
+
+        services::Collection<CsvChunk> chunks;
+        size_t cut = 0;
+        splitOnRows(pos, maxRows, chunks, cut);
+        const size_t nChunks = chunks.size();
+        if (!nChunks) return services::Status();
+
+        const size_t nStatCols = nt->getNumberOfColumns();
+        ChunkResults results(nChunks, nStatCols);
+        if (!results.isValid()) return services::Status(services::ErrorMemoryAllocationFailed);
+
+        ParseTask task(*this, chunks, results, pos, cut, rowOffset, nt->getNumberOfColumns(), ntBlock);
+        parallelFor(nChunks, task);
+
+        /* Rows after the first empty line are not loaded, like in sequential parsing */
+        size_t nextPos = cut;
+        nRows          = (chunks[nChunks - 1].firstRow + countLineBreaks(chunks[nChunks - 1].begin, chunks[nChunks - 1].end));
+        if (_data[cut - 1] != '\n') ++nRows;
+
+        for (size_t i = 0; i < nChunks; i++)
+        {
+            if (!results.isAllocated[i]) return services::Status(services::ErrorMemoryAllocationFailed);
+            if (results.emptyRow[i] < nRows)
+            {
+                nRows   = results.emptyRow[i];
+                nextPos = results.resumePos[i];
+            }
+        }
+
+        combineStatistics(chunks, results, nRows, nStatCols, nt);
+        pos = nextPos;
+        return services::Status();
+    }
+
+private:
+    struct ChunkResults
+    {
+        ChunkResults(size_t nChunks, size_t nCols)
+            : n(nChunks), nStatRows(nChunks), emptyRow(nChunks), resumePos(nChunks), isAllocated(nChunks), stats(NULL)
+        {
+            if (!isAllocatedCollections()) return;
+            for (size_t i = 0; i < n; i++)
+            {
+                nStatRows[i]   = 0;
+                emptyRow[i]    = size_t(-1);
+                resumePos[i]   = 0;
+                isAllocated[i] = true;
+            }
+            stats = (SummaryStatisticsType *)services::daal_malloc(nChunks * 4 * nCols * sizeof(SummaryStatisticsType));
+        }
+        ~ChunkResults() { services::daal_free(stats); }
+
+        bool isValid() const { return stats && isAllocatedCollections(); }
+
+        bool isAllocatedCollections() const
+        {
+            return nStatRows.size() == n && emptyRow.size() == n && resumePos.size() == n && isAllocated.size() == n;
+        }
+
+        size_t n;
+        services::Collection<size_t> nStatRows;
+        services::Collection<size_t> emptyRow;
+        services::Collection<size_t> resumePos;
+        services::Collection<bool> isAllocated;
+        SummaryStatisticsType * stats; /*!< Minimum, maximum, sum and sum of squares for every chunk */
+
+    private:
+        ChunkResults(const ChunkResults &);
+        ChunkResults & operator=(const ChunkResults &);
+    };
+
+    struct CountTask
+    {
+        CountTask(const CsvParallelParser & parser, const services::Collection<CsvChunk> & chunks, size_t * counts)
+            : _parser(parser), _chunks(chunks), _counts(counts)
+        {}
+        void operator()(size_t i) const { _counts[i] = _parser.countLineBreaks(_chunks[i].begin, _chunks[i].end); }
+
+        const CsvParallelParser & _parser;
+        const services::Collection<CsvChunk> & _chunks;
+        size_t * _counts;
+    };
+
+    struct ParseTask
+    {
+        ParseTask(CsvParallelParser & parser, const services::Collection<CsvChunk> & chunks, ChunkResults & results, size_t dataBegin,
+                  size_t dataEnd, size_t rowOffset, size_t nCols, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock)
+            : _parser(parser),
+              _chunks(chunks),
+              _results(results),
+              _dataBegin(dataBegin),
+              _dataEnd(dataEnd),
+              _rowOffset(rowOffset),
+              _nCols(nCols),
+              _ntBlock(ntBlock)
+        {}
+        void operator()(size_t i) const { _parser.parseChunk(i, _chunks[i], _results, _dataBegin, _dataEnd, _rowOffset, _nCols, _ntBlock); }
+
+        CsvParallelParser & _parser;
+        const services::Collection<CsvChunk> & _chunks;
+        ChunkResults & _results;
+        size_t _dataBegin;
+        size_t _dataEnd;
+        size_t _rowOffset;
+        size_t _nCols;
+        BlockDescriptor<DAAL_DATA_TYPE> & _ntBlock;
+    };
+
+    size_t countLineBreaks(size_t begin, size_t end) const { return countSymbols(_data, begin, end, '\n'); }
+
+    size_t findLineBreak(size_t begin, size_t end) const { return findFirst(_data, begin, end, '\n'); }
+
+    /**
+     *  Splits the data that starts at pos into chunks on line boundaries. Line breaks are counted in windows of
+     *  chunks in parallel until maxRows rows are found or the end of the data is reached.
+     */
+    void splitOnRows(size_t pos, size_t maxRows, services::Collection<CsvChunk> & chunks, size_t & cut) const
+    {
+        const size_t nThreads    = services::Environment::getInstance()->getNumberOfThreads();
+        const size_t nWindow     = 4 * (nThreads ? nThreads : 1);
+        const size_t remaining   = _dataSize - pos;
+        const size_t perThread   = remaining / nWindow + 1;
+        const size_t chunkSize   = perThread < _minChunkSize ? _minChunkSize : (perThread > _maxChunkSize ? _maxChunkSize : perThread);
+        const size_t windowBytes = chunkSize * nWindow;
+
+        services::Collection<CsvChunk> window(nWindow);
+        services::Collection<size_t> counts(nWindow);
+
+        size_t nLines = 0;
+        cut           = _dataSize;
+        for (size_t wBegin = pos; wBegin < _dataSize; wBegin += windowBytes)
+        {
+            size_t nWindowChunks = 0;
+            for (size_t b = wBegin; b < _dataSize && nWindowChunks < nWindow; b += chunkSize, nWindowChunks++)
+            {
+                window[nWindowChunks] = CsvChunk(b, (b + chunkSize < _dataSize ? b + chunkSize : _dataSize), 0);
+            }
+
+            CountTask task(*this, window, &counts[0]);
+            parallelFor(nWindowChunks, task);
+
+            for (size_t i = 0; i < nWindowChunks; i++)
+            {
+                CsvChunk chunk = window[i];
+                chunk.firstRow = nLines;
+                if (nLines + counts[i] >= maxRows)
+                {
+                    /* Row maxRows - 1 ends inside this chunk */
+                    size_t lineBreak = chunk.begin;
+                    for (size_t k = nLines; k < maxRows; k++) lineBreak = findLineBreak(k == nLines ? chunk.begin : lineBreak + 1, chunk.end);
+                    cut       = lineBreak + 1;
+                    chunk.end = cut;
+                    chunks.push_back(chunk);
+                    return;
+                }
+                nLines += counts[i];
+                chunks.push_back(chunk);
+            }
+        }
+    }
+
+    void parseChunk(size_t iChunk, const CsvChunk & chunk, ChunkResults & results, size_t dataBegin, size_t dataEnd, size_t rowOffset,
+                    size_t nCols, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock)
+    {
+        size_t lineBegin = chunk.begin;
+        size_t row       = chunk.firstRow;
+        if (lineBegin != dataBegin && _data[lineBegin - 1] != '\n')
+        {
+            /* The row that covers the chunk begin belongs to the previous chunk */
+            lineBegin = findLineBreak(lineBegin, chunk.end) + 1;
+            ++row;
+        }
+        if (lineBegin >= chunk.end) return;
+
+        size_t bufferSize = _initialLineBufferSize;
+        char * buffer     = (char *)services::daal_malloc(bufferSize);
+        if (!buffer)
+        {
+            results.isAllocated[iChunk] = false;
+            return;
+        }
+
+        SummaryStatisticsType * minimum    = results.stats + iChunk * 4 * nCols;
+        SummaryStatisticsType * maximum    = minimum + nCols;
+        SummaryStatisticsType * sum        = maximum + nCols;
+        SummaryStatisticsType * sumSquares = sum + nCols;
+
+        size_t nStatRows = 0;
+        while (lineBegin < chunk.end)
+        {
+            const size_t lineBreak = findLineBreak(lineBegin, dataEnd);
+            size_t lineEnd         = lineBreak;
+            while (lineEnd > lineBegin && _data[lineEnd - 1] == '\r') --lineEnd;
+
+            const size_t lineLength = lineEnd - lineBegin;
+            if (!lineLength)
+            {
+                results.emptyRow[iChunk]  = row;
+                results.resumePos[iChunk] = (lineBreak < dataEnd) ? lineBreak + 1 : dataEnd;
+                break;
+            }
+
+            if (lineLength + 1 > bufferSize)
+            {
+                services::daal_free(buffer);
+                bufferSize = 2 * (lineLength + 1);
+                buffer     = (char *)services::daal_malloc(bufferSize);
+                if (!buffer)
+                {
+                    results.isAllocated[iChunk] = false;
+                    return;
+                }
+            }
+            services::internal::daal_memcpy_s(buffer, bufferSize, _data + lineBegin, lineLength);
+            buffer[lineLength] = '\0';
+
+            DAAL_DATA_TYPE * rowPtr = ntBlock.getBlockPtr() + (rowOffset + row) * nCols;
+            services::BufferView<DAAL_DATA_TYPE> rowBuffer(rowPtr, ntBlock.getNumberOfColumns());
+            _featureManager.parseRowIn(buffer, lineLength, _dict, rowBuffer, rowOffset + row);
+
+            if (nStatRows)
+            {
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    const SummaryStatisticsType value = rowPtr[j];
+                    if (minimum[j] > value) minimum[j] = value;
+                    if (maximum[j] < value) maximum[j] = value;
+                    sum[j] += value;
+                    sumSquares[j] += value * value;
+                }
+            }
+            else
+            {
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    const SummaryStatisticsType value = rowPtr[j];
+                    minimum[j]                        = value;
+                    maximum[j]                        = value;
+                    sum[j]                            = value;
+                    sumSquares[j]                     = value * value;
+                }
+            }
+
+            ++nStatRows;
+            ++row;
+            lineBegin = lineBreak + 1;
+        }
+        results.nStatRows[iChunk] = nStatRows;
+        services::daal_free(buffer);
+    }
+
+    void combineStatistics(const services::Collection<CsvChunk> & chunks, const ChunkResults & results, size_t nRows, size_t nCols,
+                           NumericTable * nt) const
+    {
+        if (!nRows) return;
+
+        NumericTablePtr ntMin   = nt->basicStatistics.get(NumericTable::minimum);
+        NumericTablePtr ntMax   = nt->basicStatistics.get(NumericTable::maximum);
+        NumericTablePtr ntSum   = nt->basicStatistics.get(NumericTable::sum);
+        NumericTablePtr ntSumSq = nt->basicStatistics.get(NumericTable::sumSquares);
+        if (!ntMin || !ntMax || !ntSum || !ntSumSq) return;
+
+        BlockDescriptor<SummaryStatisticsType> blockMin, blockMax, blockSum, blockSumSq;
+        ntMin->getBlockOfRows(0, 1, writeOnly, blockMin);
+        ntMax->getBlockOfRows(0, 1, writeOnly, blockMax);
+        ntSum->getBlockOfRows(0, 1, writeOnly, blockSum);
+        ntSumSq->getBlockOfRows(0, 1, writeOnly, blockSumSq);
+
+        SummaryStatisticsType * minimum    = blockMin.getBlockPtr();
+        SummaryStatisticsType * maximum    = blockMax.getBlockPtr();
+        SummaryStatisticsType * sum        = blockSum.getBlockPtr();
+        SummaryStatisticsType * sumSquares = blockSumSq.getBlockPtr();
+
+        if (minimum && maximum && sum && sumSquares)
+        {
+            bool bFirst = true;
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                if (chunks[i].firstRow >= nRows) break;
+                if (!results.nStatRows[i]) continue;
+
+                const SummaryStatisticsType * chunkMin = results.stats + i * 4 * nCols;
+                const SummaryStatisticsType * chunkMax = chunkMin + nCols;
+                const SummaryStatisticsType * chunkSum = chunkMax + nCols;
+                const SummaryStatisticsType * chunkSq  = chunkSum + nCols;
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    if (bFirst || minimum[j] > chunkMin[j]) minimum[j] = chunkMin[j];
+                    if (bFirst || maximum[j] < chunkMax[j]) maximum[j] = chunkMax[j];
+                    sum[j]        = (bFirst ? 0 : sum[j]) + chunkSum[j];
+                    sumSquares[j] = (bFirst ? 0 : sumSquares[j]) + chunkSq[j];
+                }
+                bFirst = false;
+            }
+        }
+
+        ntMin->releaseBlockOfRows(blockMin);
+        ntMax->releaseBlockOfRows(blockMax);
+        ntSum->releaseBlockOfRows(blockSum);
+        ntSumSq->releaseBlockOfRows(blockSumSq);
+    }
+
+    CsvParallelParser(const CsvParallelParser &);
+    CsvParallelParser & operator=(const CsvParallelParser &);
+
+    const char * _data;
+    size_t _dataSize;
+    FeatureManager & _featureManager;
+    DataSourceDictionary * _dict;
+
+    static const size_t _minChunkSize          = 1 << 16;
+    static const size_t _maxChunkSize          = 1 << 23;
+    static const size_t _initialLineBufferSize = 1024;
+};
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
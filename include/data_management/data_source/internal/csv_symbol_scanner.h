@@ -0,0 +1,131 @@
+/* file: csv_symbol_scanner.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Scanning of CSV data for delimiters and line breaks
+//--
+*/
+
+#ifndef __CSV_SYMBOL_SCANNER_H__
+#define __CSV_SYMBOL_SCANNER_H__
+
+#include <cstddef>
+
+#include "services/daal_defines.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define DAAL_CSV_SCANNER_SSE2
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+#if defined(DAAL_CSV_SCANNER_SSE2)
+DAAL_FORCEINLINE size_t countTrailingZeros(unsigned int mask)
+{
+    #if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (size_t)index;
+    #else
+    return (size_t)__builtin_ctz(mask);
+    #endif
+}
+
+DAAL_FORCEINLINE size_t countBits(unsigned int mask)
+{
+    #if defined(_MSC_VER)
+    /* __popcnt needs the POPCNT instruction that is not implied by SSE2 */
+    mask = mask - ((mask >> 1) & 0x55555555u);
+    mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+    return (size_t)((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+    #else
+    return (size_t)__builtin_popcount(mask);
+    #endif
+}
+#endif
+
+/**
+ *  Returns the index of the first symbol in [begin, end) that is equal to c1 or c2, or end if there is no such symbol.
+ *  Sixteen symbols are compared at once when SSE2 is available
+ */
+DAAL_FORCEINLINE size_t findFirstOf(const char * data, size_t begin, size_t end, char c1, char c2)
+{
+    size_t i = begin;
+#if defined(DAAL_CSV_SCANNER_SSE2)
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v         = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, v1), _mm_cmpeq_epi8(v, v2)));
+        if (mask)
+        {
+            return i + countTrailingZeros(mask);
+        }
+    }
+#endif
+    for (; i < end; i++)
+    {
+        if (data[i] == c1 || data[i] == c2) return i;
+    }
+    return end;
+}
+
+/**
+ *  Returns the index of the first symbol in [begin, end) that is equal to c, or end if there is no such symbol
+ */
+DAAL_FORCEINLINE size_t findFirst(const char * data, size_t begin, size_t end, char c)
+{
+    return findFirstOf(data, begin, end, c, c);
+}
+
+/**
+ *  Returns the number of symbols in [begin, end) that are equal to c
+ */
+DAAL_FORCEINLINE size_t countSymbols(const char * data, size_t begin, size_t end, char c)
+{
+    size_t n = 0;
+    size_t i = begin;
+#if defined(DAAL_CSV_SCANNER_SSE2)
+    const __m128i vc = _mm_set1_epi8(c);
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        n += countBits((unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, vc)));
+    }
+#endif
+    for (; i < end; i++)
+    {
+        n += (data[i] == c);
+    }
+    return n;
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -0,0 +1,100 @@
+/* file: mapped_file.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __DATA_SOURCE_INTERNAL_MAPPED_FILE_H__
+#define __DATA_SOURCE_INTERNAL_MAPPED_FILE_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__INTERNAL__MAPPEDFILE"></a>
+ *  \brief View of a file mapped into the address space of the process, changes are never written back to the file
+ */
+class DAAL_EXPORT MappedFile : public Base
+{
+public:
+    MappedFile();
+    virtual ~MappedFile();
+
+    /**
+     *  Maps the whole file into memory
+     *  \param[in]  fileName     Name of the file to map
+     *  \param[in]  copyOnWrite  If true, the mapped pages are writable and the modified pages become private copies of the process,
+     *                           the other pages stay shared with all the processes that map the same file
+     *  \return Status of the operation
+     */
+    services::Status open(const char * fileName, bool copyOnWrite = false);
+
+    /**
+     *  Unmaps the file, the pointer returned by data() becomes invalid
+     */
+    void close();
+
+    bool isOpen() const { return _isOpen; }
+
+    const char * data() const { return _data; }
+
+    size_t size() const { return _size; }
+
+private:
+    MappedFile(const MappedFile &);
+    MappedFile & operator=(const MappedFile &);
+
+    const char * _data;
+    size_t _size;
+    bool _isOpen;
+    void * _fileHandle;
+    void * _mappingHandle;
+};
+
+typedef void (*ParallelBlockFunctionType)(size_t iBlock, const void * context);
+
+/**
+ *  Calls func(iBlock, context) for every iBlock in [0, nBlocks) using the threading layer of the library
+ */
+DAAL_EXPORT void parallelForBlocks(size_t nBlocks, const void * context, ParallelBlockFunctionType func);
+
+template <typename Functor>
+inline void parallelBlockFunction(size_t iBlock, const void * context)
+{
+    const Functor & func = *static_cast<const Functor *>(context);
+    func(iBlock);
+}
+
+/**
+ *  Calls func(iBlock) for every iBlock in [0, nBlocks) in parallel
+ *  \tparam Functor  Type of the functor, must provide void operator()(size_t) const
+ */
+template <typename Functor>
+inline void parallelFor(size_t nBlocks, const Functor & func)
+{
+    parallelForBlocks(nBlocks, static_cast<const void *>(&func), parallelBlockFunction<Functor>);
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -181,37 +181,18 @@ public:
             return 0;
         }
 
-        I handle = _kdbConnect();
-
-        if (handle <= 0)
-        {
-            return 0;
-        }
-
-        size_t nRows = getNumberOfAvailableRows();
+        size_t nRows = 0;
+        K result     = queryNextRows(maxRows, nRows);
 
-        if (nRows == 0)
+        if (!result)
         {
-            DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::resizeNumericTableImpl(0, nt);
-            _kdbClose(handle);
+            if (this->_errors->isEmpty())
+            {
+                DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::resizeNumericTableImpl(0, nt);
+            }
             return 0;
         }
 
-        if (maxRows != 0 && nRows > maxRows)
-        {
-            nRows = maxRows;
-        }
-
-        std::ostringstream query;
-        query << "(" << _query << ")[(til " << nRows << ") + " << _idx_last_read << +"]";
-        std::string query_exec = query.str();
-
-        K result = k(handle, const_cast<char *>(query_exec.c_str()), (K)0);
-
-        _kdbClose(handle);
-
-        _idx_last_read += nRows;
-
         DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::resizeNumericTableImpl(nRows, nt);
 
         if (nt->getDataMemoryStatus() == NumericTableIface::userAllocated)
@@ -272,6 +253,57 @@ public:
         return nRows;
     }
 
+    /**
+     *  Loads a data block of a specified size into a Numeric Table with the structure of arrays layout.
+     *  The columns of the KDB table are wrapped into the Numeric Table without copying
+     *  \param[in] maxRows Maximum number of rows to load from a Data Source, 0 to load all available rows
+     *  \return Numeric Table with the loaded rows, empty pointer if no rows are loaded
+     */
+    SOANumericTablePtr loadDataBlockToSOA(size_t maxRows)
+    {
+        checkDictionary();
+        if (!this->_errors->isEmpty())
+        {
+            return SOANumericTablePtr();
+        }
+
+        size_t nRows = 0;
+        K result     = queryNextRows(maxRows, nRows);
+        if (!result)
+        {
+            return SOANumericTablePtr();
+        }
+
+        SOANumericTablePtr nt;
+        if (result->t == XT)
+        {
+            nt = featureManager.statementResultsSOANumericTableFromColumnData(kK(result->k)[1], nRows);
+        }
+        else if (result->t == XD)
+        {
+            nt = featureManager.statementResultsSOANumericTableFromColumnData(kK(result)[1], nRows);
+        }
+        else
+        {
+            this->_errors->add(services::ErrorKDBWrongTypeOfOutput);
+        }
+        r0(result);
+
+        if (!nt)
+        {
+            return SOANumericTablePtr();
+        }
+
+        NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+        const size_t nFeatures           = services::internal::minValue(_dict->getNumberOfFeatures(), nt->getNumberOfColumns());
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            ntDict->setFeature((*_dict)[i].ntFeature, i);
+        }
+
+        return nt;
+    }
+
     services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
     {
         if (_dict) return services::Status(services::ErrorDictionaryAlreadyAvailable);
@@ -357,6 +389,58 @@ private:
     std::string _query;
     size_t _idx_last_read;
 
+    /* Queries at most maxRows next rows of the table, returns NULL if no rows are available or the query fails */
+    K queryNextRows(size_t maxRows, size_t & nRows)
+    {
+        nRows    = 0;
+        I handle = _kdbConnect();
+
+        if (handle <= 0)
+        {
+            return (K)0;
+        }
+
+        nRows = getNumberOfAvailableRows();
+
+        if (nRows == 0)
+        {
+            _kdbClose(handle);
+            return (K)0;
+        }
+
+        if (maxRows != 0 && nRows > maxRows)
+        {
+            nRows = maxRows;
+        }
+
+        std::ostringstream query;
+        query << "(" << _query << ")[(til " << nRows << ") + " << _idx_last_read << +"]";
+        std::string query_exec = query.str();
+
+        K result = k(handle, const_cast<char *>(query_exec.c_str()), (K)0);
+
+        _kdbClose(handle);
+
+        if (!result)
+        {
+            nRows = 0;
+            this->_errors->add(services::ErrorKDBNetworkError);
+            return (K)0;
+        }
+
+        if (result->t == -128)
+        {
+            nRows = 0;
+            r0(result);
+            this->_errors->add(services::ErrorKDBServerError);
+            return (K)0;
+        }
+
+        _idx_last_read += nRows;
+
+        return result;
+    }
+
     I _kdbConnect()
     {
         I handle = khpu(const_cast<char *>(_dbname.c_str()), _port, const_cast<char *>((_username + ":" + _password).c_str()));
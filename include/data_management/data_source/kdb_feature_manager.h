@@ -24,10 +24,13 @@
 #define __KDB_FEATURE_MANAGER_H__
 
 #include "services/daal_memory.h"
+#include "services/internal/utilities.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data/data_dictionary.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data_source/internal/mapped_file.h"
 
 #include <k.h>
 
@@ -37,6 +40,21 @@ namespace data_management
 {
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-KDBCOLUMNDELETER"></a>
+ * \brief Releases the reference to a q vector wrapped into a numeric table
+ */
+class KDBColumnDeleter : public services::DeleterIface
+{
+public:
+    explicit KDBColumnDeleter(K column) : _column(r1(column)) {}
+
+    void operator()(const void * /*ptr*/) DAAL_C11_OVERRIDE { r0(_column); }
+
+private:
+    K _column;
+};
+
 /**
  * <a name="DAAL-CLASS-KDBFEATUREMANAGER"></a>
  * \brief Contains KDB-specific commands
@@ -135,40 +153,88 @@ public:
         }
     }
 
+    /**
+     *  Copies the columns of a KDB table into a Numeric Table. The column vectors are converted
+     *  in parallel by blocks of rows
+     *
+     *  \param[in]   columnData  Column data of a KDB table
+     *  \param[out]  nt          Numeric Table to store the rows
+     *  \param[in]   nRows       Number of rows to copy
+     */
     void statementResultsNumericTableFromColumnData(const K & columnData, NumericTable * nt, size_t nRows)
     {
         BlockDescriptor<DAAL_DATA_TYPE> block;
         nt->getBlockOfRows(0, nRows, writeOnly, block);
         DAAL_DATA_TYPE * blockPtr = block.getBlockPtr();
-        size_t nFeatures          = nt->getNumberOfColumns();
-        for (size_t row = 0; row < nRows; row++)
+        const size_t nFeatures    = nt->getNumberOfColumns();
+
+        for (size_t col = 0; col < nFeatures; col++)
         {
-            for (size_t col = 0; col < nFeatures; col++)
+            if (!isCopySupported(kK(columnData)[col]->t))
             {
-                K column = kK(columnData)[col];
-                switch (column->t)
-                {
-                case (KB): blockPtr[row * nFeatures + col] = kG(column)[row]; break;
-                case (KG): blockPtr[row * nFeatures + col] = kG(column)[row]; break;
-                case (KH): blockPtr[row * nFeatures + col] = kH(column)[row]; break;
-                case (KI):
-                case (KM):
-                case (KD):
-                case (KU):
-                case (KV):
-                case (KT): blockPtr[row * nFeatures + col] = kI(column)[row]; break;
-                case (KJ):
-                case (KP):
-                case (KN): blockPtr[row * nFeatures + col] = kJ(column)[row]; break;
-                case (KE): blockPtr[row * nFeatures + col] = kE(column)[row]; break;
-                case (KF): blockPtr[row * nFeatures + col] = kF(column)[row]; break;
-                default: _errors->add(services::ErrorKDBTypeUnsupported); break;
-                }
+                _errors->add(services::ErrorKDBTypeUnsupported);
             }
         }
+
+        const size_t nBlocks = (nRows + _rowsInBlock - 1) / _rowsInBlock;
+        ColumnCopyTask task(columnData, blockPtr, nRows, nFeatures, _rowsInBlock);
+        internal::parallelFor(nBlocks, task);
+
         nt->releaseBlockOfRows(block);
     }
 
+    /**
+     *  Wraps the columns of a KDB table into a Numeric Table with the structure of arrays layout without copying.
+     *  The Numeric Table keeps the references to the column vectors
+     *
+     *  \param[in]   columnData  Column data of a KDB table
+     *  \param[in]   nRows       Number of rows in the columns
+     *  \return Numeric Table that refers to the column vectors, empty pointer if a column type is not supported
+     */
+    SOANumericTablePtr statementResultsSOANumericTableFromColumnData(const K & columnData, size_t nRows)
+    {
+        const size_t nFeatures = columnData->n;
+
+        services::Status s;
+        SOANumericTablePtr nt = SOANumericTable::create(nFeatures, nRows, DictionaryIface::notEqual, &s);
+        if (!s)
+        {
+            _errors->add(services::ErrorNumericTableNotAllocated);
+            return SOANumericTablePtr();
+        }
+
+        for (size_t col = 0; col < nFeatures && s; col++)
+        {
+            K column = kK(columnData)[col];
+            switch (column->t)
+            {
+            case (KB):
+            case (KG):
+            case (KC): s |= nt->setArray(wrapColumn<char>(column, kC(column)), col); break;
+            case (KH): s |= nt->setArray(wrapColumn<short>(column, kH(column)), col); break;
+            case (KI):
+            case (KM):
+            case (KD):
+            case (KU):
+            case (KV):
+            case (KT): s |= nt->setArray(wrapColumn<int>(column, kI(column)), col); break;
+            case (KJ):
+            case (KP):
+            case (KN): s |= nt->setArray(wrapColumn<DAAL_INT64>(column, kJ(column)), col); break;
+            case (KE): s |= nt->setArray(wrapColumn<float>(column, kE(column)), col); break;
+            case (KF): s |= nt->setArray(wrapColumn<double>(column, kF(column)), col); break;
+            default: s |= services::Status(services::ErrorKDBTypeUnsupported); break;
+            }
+        }
+
+        if (!s)
+        {
+            _errors->add(services::ErrorKDBTypeUnsupported);
+            return SOANumericTablePtr();
+        }
+        return nt;
+    }
+
     void statementResultsNumericTableFromList(const K & lst, NumericTable * nt, size_t nRows)
     {
         BlockDescriptor<DAAL_DATA_TYPE> block;
@@ -211,10 +277,96 @@ public:
     services::SharedPtr<services::ErrorCollection> getErrors() { return _errors; }
 
 private:
+    /* Copies the rows of one block from the column vectors into the row-major block of the numeric table */
+    class ColumnCopyTask
+    {
+    public:
+        ColumnCopyTask(const K & columnData, DAAL_DATA_TYPE * blockPtr, size_t nRows, size_t nFeatures, size_t rowsInBlock)
+            : _columnData(columnData), _blockPtr(blockPtr), _nRows(nRows), _nFeatures(nFeatures), _rowsInBlock(rowsInBlock)
+        {}
+
+        void operator()(size_t iBlock) const
+        {
+            const size_t begin = iBlock * _rowsInBlock;
+            const size_t end   = services::internal::minValue(begin + _rowsInBlock, _nRows);
+
+            for (size_t col = 0; col < _nFeatures; col++)
+            {
+                K column             = kK(_columnData)[col];
+                DAAL_DATA_TYPE * dst = _blockPtr + col;
+                switch (column->t)
+                {
+                case (KB):
+                case (KG): copyColumn(kG(column), dst, begin, end); break;
+                case (KH): copyColumn(kH(column), dst, begin, end); break;
+                case (KI):
+                case (KM):
+                case (KD):
+                case (KU):
+                case (KV):
+                case (KT): copyColumn(kI(column), dst, begin, end); break;
+                case (KJ):
+                case (KP):
+                case (KN): copyColumn(kJ(column), dst, begin, end); break;
+                case (KE): copyColumn(kE(column), dst, begin, end); break;
+                case (KF): copyColumn(kF(column), dst, begin, end); break;
+                default: break;
+                }
+            }
+        }
+
+    private:
+        template <typename T>
+        void copyColumn(const T * src, DAAL_DATA_TYPE * dst, size_t begin, size_t end) const
+        {
+            for (size_t row = begin; row < end; row++)
+            {
+                dst[row * _nFeatures] = static_cast<DAAL_DATA_TYPE>(src[row]);
+            }
+        }
+
+        const K & _columnData;
+        DAAL_DATA_TYPE * _blockPtr;
+        size_t _nRows;
+        size_t _nFeatures;
+        size_t _rowsInBlock;
+    };
+
+    static bool isCopySupported(H type)
+    {
+        switch (type)
+        {
+        case (KB):
+        case (KG):
+        case (KH):
+        case (KI):
+        case (KM):
+        case (KD):
+        case (KU):
+        case (KV):
+        case (KT):
+        case (KJ):
+        case (KP):
+        case (KN):
+        case (KE):
+        case (KF): return true;
+        default: return false;
+        }
+    }
+
+    template <typename T, typename KType>
+    static services::SharedPtr<T> wrapColumn(K column, KType * data)
+    {
+        return services::SharedPtr<T>(reinterpret_cast<T *>(data), KDBColumnDeleter(column));
+    }
+
+    static const size_t _rowsInBlock = 4096;
+
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 
 } // namespace interface1
+using interface1::KDBColumnDeleter;
 using interface1::KDBFeatureManager;
 
 } // namespace data_management
@@ -19,6 +19,7 @@
 #define __DATA_SOURCE_MODIFIERS_INTERNAL_ENGINE_H__
 
 #include "services/collection.h"
+#include "services/internal/utilities.h"
 #include "data_management/features/identifiers.h"
 
 namespace daal
@@ -219,11 +220,11 @@ public:
     typedef typename Config::InputFeatureInfoType InputFeatureInfoType;
     typedef typename Config::OutputFeatureInfoType OutputFeatureInfoType;
 
-    ModifierBinding() : _outputFeaturesOffset(0), _numberOfOutputFeatures(0) {}
+    ModifierBinding() : _outputFeaturesOffset(0), _numberOfOutputFeatures(0), _numberOfUsedInputFeatures(0) {}
 
     explicit ModifierBinding(const features::FeatureIdCollectionIfacePtr & identifiers, const services::SharedPtr<Modifier> & modifier,
                              services::Status * /*status*/ = NULL)
-        : _outputFeaturesOffset(0), _numberOfOutputFeatures(0), _modifier(modifier), _identifiers(identifiers)
+        : _outputFeaturesOffset(0), _numberOfOutputFeatures(0), _numberOfUsedInputFeatures(0), _modifier(modifier), _identifiers(identifiers)
     {}
 
     services::Status bind(size_t outputFeaturesOffset, const features::FeatureIdMappingIfacePtr & mapping,
@@ -247,6 +248,13 @@ public:
         _outputFeaturesOffset   = outputFeaturesOffset;
         _numberOfOutputFeatures = _config.getNumberOfOutputFeatures();
 
+        _numberOfUsedInputFeatures = 0;
+        for (size_t i = 0; i < pickedInputFeatureInfo->size(); i++)
+        {
+            const size_t index         = (size_t)((*pickedInputFeatureInfo)[i] - &(*inputFeaturesInfo)[0]);
+            _numberOfUsedInputFeatures = services::internal::maxValue(_numberOfUsedInputFeatures, index + 1);
+        }
+
         return status;
     }
 
@@ -262,12 +270,16 @@ public:
 
     size_t getNumberOfOutputFeatures() const { return _numberOfOutputFeatures; }
 
+    /* Returns the number of leading input features that contain all the features picked by the modifier */
+    size_t getNumberOfUsedInputFeatures() const { return _numberOfUsedInputFeatures; }
+
 private:
     Config _config;
     Context _context;
 
     size_t _outputFeaturesOffset;
     size_t _numberOfOutputFeatures;
+    size_t _numberOfUsedInputFeatures;
 
     services::SharedPtr<Modifier> _modifier;
     features::FeatureIdCollectionIfacePtr _identifiers;
@@ -286,7 +298,7 @@ public:
     typedef typename ModifierBinding::InputFeatureInfoType InputFeatureInfoType;
     typedef typename ModifierBinding::OutputFeatureInfoType OutputFeatureInfoType;
 
-    ModifiersBinder() : _numberOfOutputFeatures(0) {}
+    ModifiersBinder() : _numberOfOutputFeatures(0), _numberOfUsedInputFeatures(0) {}
 
     services::Status add(const features::FeatureIdCollectionIfacePtr & identifiers, const services::SharedPtr<ModifierType> & modifier)
     {
@@ -327,17 +339,20 @@ public:
 
         services::Status status;
 
-        size_t outputFeaturesOffset = 0;
+        size_t outputFeaturesOffset      = 0;
+        size_t numberOfUsedInputFeatures = 0;
         for (size_t i = 0; i < _bindings.size(); i++)
         {
             status |= _bindings[i].bind(outputFeaturesOffset, mapping, inputFeaturesInfo);
             DAAL_CHECK_STATUS_VAR(status);
 
             outputFeaturesOffset += _bindings[i].getNumberOfOutputFeatures();
+            numberOfUsedInputFeatures = services::internal::maxValue(numberOfUsedInputFeatures, _bindings[i].getNumberOfUsedInputFeatures());
         }
 
-        _inputFeaturesInfo      = inputFeaturesInfo;
-        _numberOfOutputFeatures = outputFeaturesOffset;
+        _inputFeaturesInfo         = inputFeaturesInfo;
+        _numberOfOutputFeatures    = outputFeaturesOffset;
+        _numberOfUsedInputFeatures = numberOfUsedInputFeatures;
 
         return status;
     }
@@ -346,6 +361,8 @@ public:
 
     size_t getNumberOfModifiers() const { return _bindings.size(); }
 
+    size_t getNumberOfUsedInputFeatures() const { return _numberOfUsedInputFeatures; }
+
     const ModifierBinding & getBinding(size_t index) const { return _bindings[index]; }
 
     services::Collection<InputFeatureInfoType> & getInputFeaturesInfo() { return *_inputFeaturesInfo; }
@@ -354,6 +371,7 @@ public:
 
 private:
     size_t _numberOfOutputFeatures;
+    size_t _numberOfUsedInputFeatures;
     services::Collection<ModifierBinding> _bindings;
     services::internal::CollectionPtr<InputFeatureInfoType> _inputFeaturesInfo;
 };
@@ -404,6 +422,12 @@ public:
 
     size_t getNumberOfOutputFeatures() const { return _binder.getNumberOfOutputFeatures(); }
 
+    /**
+     *  Returns the number of leading input features that contain all the features used by the modifiers,
+     *  the remaining input features do not need to be read
+     */
+    size_t getNumberOfUsedInputFeatures() const { return _binder.getNumberOfUsedInputFeatures(); }
+
 protected:
     ModifiersManager() {}
 
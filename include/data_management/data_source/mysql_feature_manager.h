@@ -26,6 +26,7 @@
 #include <sstream>
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
 #include "data_management/features/shortcuts.h"
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/internal/sql_feature_utils.h"
@@ -50,7 +51,9 @@ namespace interface1
 class SQLFeatureManager
 {
 public:
-    SQLFeatureManager() : _fetchBuffer(), _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection)) {}
+    SQLFeatureManager()
+        : _fetchBuffer(), _errors(services::SharedPtr<services::ErrorCollection>(new services::ErrorCollection)), _rowArraySize(1), _rowsFetched(0)
+    {}
 
     /**
      * Adds extended feature modifier
@@ -83,6 +86,25 @@ public:
         return *this;
     }
 
+    /**
+     * Sets the number of rows fetched from the ODBC driver with one call. If the number is greater than one
+     * and no feature modifiers are added, the columns are bound to arrays of values and the rows are fetched by rowsets.
+     * The arrays of a numeric table with the structure of arrays layout are filled by the driver directly
+     * \param[in]   rowArraySize The number of rows in the rowset
+     * \return Reference to itself
+     */
+    SQLFeatureManager & setRowArraySize(size_t rowArraySize)
+    {
+        _rowArraySize = (rowArraySize > 0) ? rowArraySize : 1;
+        return *this;
+    }
+
+    /**
+     * Returns the number of rows fetched from the ODBC driver with one call
+     * \return The number of rows in the rowset
+     */
+    size_t getRowArraySize() const { return _rowArraySize; }
+
     /**
      *  Executes an SQL statement from an ODBC statement handle and writes it to a Numeric Table
      *  \param[in]   hdlStmt ODBC statement handle that contains an SQL query
@@ -94,6 +116,11 @@ public:
         DAAL_ASSERT(nt);
         DAAL_ASSERT(hdlStmt);
 
+        if (_rowArraySize > 1 && !_modifiersManager)
+        {
+            return statementResultsNumericTableByRowsets(hdlStmt, nt, maxRows);
+        }
+
         nt->resize(maxRows);
 
         nt->getBlockOfRows(0, maxRows, writeOnly, _currentRowBlock);
@@ -187,6 +214,183 @@ public:
     services::ErrorCollectionPtr getErrors() { return services::ErrorCollectionPtr(new services::ErrorCollection()); }
 
 private:
+    /* Fetches rowsets of up to _rowArraySize rows with the columns bound to arrays of DAAL_DATA_TYPE values */
+    DataSourceIface::DataSourceStatus statementResultsNumericTableByRowsets(SQLHSTMT hdlStmt, NumericTable * nt, size_t maxRows)
+    {
+        nt->resize(maxRows);
+
+        const size_t nColumns = nt->getNumberOfColumns();
+        services::Status s    = prepareRowsetBuffers(hdlStmt, nColumns);
+        if (!s)
+        {
+            _errors->add(services::ErrorODBC);
+            return DataSourceIface::notReady;
+        }
+
+        /* Row-major tables are filled from the column-wise buffers, the arrays of SOA tables are bound directly */
+        const bool bindToTable    = getColumnArrays(nt, nColumns);
+        DAAL_DATA_TYPE * ntBuffer = NULL;
+        if (!bindToTable)
+        {
+            nt->getBlockOfRows(0, maxRows, writeOnly, _currentRowBlock);
+            ntBuffer = _currentRowBlock.getBlockPtr();
+        }
+
+        const SQLSMALLINT targetSQLType = internal::getSQLTypeForFloatingType<DAAL_DATA_TYPE>();
+
+        SQLRETURN ret = SQL_SUCCESS;
+        size_t read   = 0;
+        while (read < maxRows)
+        {
+            const size_t rowsetSize = services::internal::minValue(_rowArraySize, maxRows - read);
+            ret                     = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)rowsetSize, 0);
+            if (!SQL_SUCCEEDED(ret))
+            {
+                break;
+            }
+
+            for (size_t j = 0; j < nColumns && (SQL_SUCCEEDED(ret)); j++)
+            {
+                DAAL_DATA_TYPE * const values = bindToTable ? _columnArrays[j] + read : _rowsetValues.offset(j * _rowArraySize);
+                ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(j + 1), targetSQLType, (SQLPOINTER)values, (SQLLEN)sizeof(DAAL_DATA_TYPE),
+                                 _rowsetIndicators.offset(j * _rowArraySize));
+            }
+            if (!SQL_SUCCEEDED(ret))
+            {
+                break;
+            }
+
+            _rowsFetched = 0;
+            ret          = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 0);
+            if (!SQL_SUCCEEDED(ret))
+            {
+                break;
+            }
+
+            const size_t nFetched = services::internal::minValue((size_t)_rowsFetched, rowsetSize);
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const SQLLEN * const indicators = _rowsetIndicators.offset(j * _rowArraySize);
+                if (bindToTable)
+                {
+                    DAAL_DATA_TYPE * const column = _columnArrays[j] + read;
+                    for (size_t i = 0; i < nFetched; i++)
+                    {
+                        if (indicators[i] == SQL_NULL_DATA)
+                        {
+                            column[i] = DAAL_DATA_TYPE(0.0);
+                        }
+                    }
+                }
+                else
+                {
+                    const DAAL_DATA_TYPE * const values = _rowsetValues.offset(j * _rowArraySize);
+                    DAAL_DATA_TYPE * const rows         = ntBuffer + read * nColumns + j;
+                    for (size_t i = 0; i < nFetched; i++)
+                    {
+                        rows[i * nColumns] = (indicators[i] == SQL_NULL_DATA) ? DAAL_DATA_TYPE(0.0) : values[i];
+                    }
+                }
+            }
+
+            read += nFetched;
+            if (nFetched < rowsetSize)
+            {
+                ret = SQL_NO_DATA;
+                break;
+            }
+        }
+
+        if (!bindToTable)
+        {
+            nt->releaseBlockOfRows(_currentRowBlock);
+        }
+        nt->resize(read);
+
+        /* While more rows are available the columns are bound back to the single-row fetch buffer */
+        DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
+        if (ret != SQL_NO_DATA)
+        {
+            if (!SQL_SUCCEEDED(ret) || !SQL_SUCCEEDED(restoreRowBinding(hdlStmt)))
+            {
+                status = DataSourceIface::notReady;
+                _errors->add(services::ErrorODBC);
+            }
+        }
+        else if (read < maxRows)
+        {
+            status = DataSourceIface::endOfData;
+        }
+        return status;
+    }
+
+    services::Status prepareRowsetBuffers(SQLHSTMT hdlStmt, size_t nColumns)
+    {
+        services::Status status;
+        DAAL_CHECK_STATUS(status, _rowsetValues.reallocate(nColumns * _rowArraySize));
+        DAAL_CHECK_STATUS(status, _rowsetIndicators.reallocate(nColumns * _rowArraySize));
+        DAAL_CHECK_STATUS(status, _columnArrays.reallocate(nColumns));
+
+        SQLRETURN ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+        if (SQL_SUCCEEDED(ret))
+        {
+            ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)&_rowsFetched, 0);
+        }
+        if (!SQL_SUCCEEDED(ret))
+        {
+            return services::throwIfPossible(services::ErrorODBC);
+        }
+        return status;
+    }
+
+    /* Returns true if the table stores every column in a separate array of DAAL_DATA_TYPE values */
+    bool getColumnArrays(NumericTable * nt, size_t nColumns)
+    {
+        if (nt->getDataLayout() != NumericTableIface::soa)
+        {
+            return false;
+        }
+
+        SOANumericTable * soaTable       = dynamic_cast<SOANumericTable *>(nt);
+        NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
+        if (!soaTable || !ntDict || ntDict->getNumberOfFeatures() < nColumns)
+        {
+            return false;
+        }
+
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            if ((*ntDict)[j].indexType != features::internal::getIndexNumType<DAAL_DATA_TYPE>())
+            {
+                return false;
+            }
+            _columnArrays[j] = (DAAL_DATA_TYPE *)soaTable->getArray(j);
+            if (!_columnArrays[j])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Binds the columns back to the single-row fetch buffer, so the statement can be fetched row by row again */
+    SQLRETURN restoreRowBinding(SQLHSTMT hdlStmt)
+    {
+        SQLRETURN ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+        if (!SQL_SUCCEEDED(ret) || !_fetchBuffer)
+        {
+            return ret;
+        }
+
+        const SQLSMALLINT targetSQLType = internal::getSQLTypeForFloatingType<DAAL_DATA_TYPE>();
+        for (size_t i = 0; i < _fetchBuffer->getNumberOfFeatures() && SQL_SUCCEEDED(ret); i++)
+        {
+            ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(i + 1), targetSQLType, (SQLPOINTER)_fetchBuffer->getBufferForFeature(i),
+                             _fetchBuffer->getBufferSizeForFeature(i), _fetchBuffer->getActualDataSizeBufferForFeature(i));
+        }
+        return ret;
+    }
+
     internal::SQLFeaturesInfo getFeaturesInfo(SQLHSTMT hdlStmt, services::Status * status = NULL)
     {
         SQLSMALLINT nFeatures = 0;
@@ -318,6 +522,12 @@ private:
     BlockDescriptor<DAAL_DATA_TYPE> _currentRowBlock;
     services::SharedPtr<services::ErrorCollection> _errors;
     modifiers::sql::internal::ModifiersManagerPtr _modifiersManager;
+
+    size_t _rowArraySize;
+    SQLULEN _rowsFetched;
+    services::internal::PrimitiveCollection<DAAL_DATA_TYPE> _rowsetValues;
+    services::internal::PrimitiveCollection<SQLLEN> _rowsetIndicators;
+    services::internal::PrimitiveCollection<DAAL_DATA_TYPE *> _columnArrays;
 };
 
 typedef SQLFeatureManager MySQLFeatureManager;
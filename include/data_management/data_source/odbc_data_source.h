@@ -338,6 +338,7 @@ public:
         }
 
         nt->releaseBlockOfRows(blockNt);
+        if (nRead > 0) super::updateFiniteness(nt);
 
         NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
         size_t nFeatures                 = _dict->getNumberOfFeatures();
@@ -455,6 +456,10 @@ public:
         {
             this->_status.add(services::throwIfPossible(services::ErrorMemoryCopyFailedInternal));
         }
+        else
+        {
+            super::updateFiniteness(nt);
+        }
 
         NumericTableDictionaryPtr ntDict = nt->getDictionarySharedPtr();
         size_t nFeatures                 = _dict->getNumberOfFeatures();
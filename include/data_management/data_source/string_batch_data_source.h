@@ -0,0 +1,593 @@
+/* file: string_batch_data_source.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the data source for batches of in-memory messages.
+//--
+*/
+
+#ifndef __STRING_BATCH_DATA_SOURCE_H__
+#define __STRING_BATCH_DATA_SOURCE_H__
+
+#include "services/collection.h"
+#include "services/daal_memory.h"
+#include "services/env_detect.h"
+#include "services/buffer_view.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data_source/csv_data_source.h"
+#include "data_management/data_source/internal/mapped_file.h"
+#include "data_management/data_source/internal/csv_symbol_scanner.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+/**
+ * @ingroup data_sources
+ * @{
+ */
+/**
+ *  <a name="DAAL-CLASS-DATA_MANAGEMENT__STRINGBATCHDATASOURCE"></a>
+ *  \brief Specifies methods to access CSV data stored in a batch of in-memory messages.
+ *         Every message holds complete rows, rows of different messages are parsed in parallel
+ *         straight into the numeric table. The data source keeps its buffers and the memory of
+ *         the homogeneous numeric table it loads between the batches of messages.
+ *  \tparam FeatureManager         The type of feature manager that specifies how to extract numerical data from CSV
+ *  \tparam SummaryStatisticsType  The floating point type to compute summary statics for numeric table
+ */
+template <typename FeatureManager, typename SummaryStatisticsType = DAAL_SUMMARY_STATISTICS_TYPE>
+class StringBatchDataSource : public CsvDataSource<FeatureManager, SummaryStatisticsType>
+{
+private:
+    typedef CsvDataSource<FeatureManager, SummaryStatisticsType> super;
+    typedef HomogenNumericTable<DAAL_DATA_TYPE> DefaultNumericTableType;
+
+protected:
+    using super::_rawLineBuffer;
+    using super::_rawLineBufferLen;
+    using super::_rawLineLength;
+    using super::_status;
+
+public:
+    typedef services::BufferView<const char> MessageView;
+
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  doAllocateNumericTable          Flag that specifies whether a Numeric Table
+     *                                              associated with a Data Source is allocated inside the Data Source
+     *  \param[in]  doCreateDictionaryFromContext   Flag that specifies whether a Data Dictionary
+     *                                              is created from the context of the Data Source
+     *  \param[in]  initialMaxRows                  Initial value of maximum number of rows in Numeric Table allocated in loadDataBlock() method
+     */
+    StringBatchDataSource(DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                          DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
+                          size_t initialMaxRows                                                 = 10)
+        : super(doAllocateNumericTable, doCreateDictionaryFromContext, initialMaxRows)
+    {
+        initialize();
+    }
+
+    /**
+     *  Constructs a Data Source for the batch of messages
+     *  \param[in]  messages                        Array of views of the messages, the data of the messages is not copied
+     *  \param[in]  nMessages                       Number of the messages
+     *  \param[in]  doAllocateNumericTable          Flag that specifies whether a Numeric Table
+     *                                              associated with a Data Source is allocated inside the Data Source
+     *  \param[in]  doCreateDictionaryFromContext   Flag that specifies whether a Data Dictionary
+     *                                              is created from the context of the Data Source
+     *  \param[in]  initialMaxRows                  Initial value of maximum number of rows in Numeric Table allocated in loadDataBlock() method
+     */
+    StringBatchDataSource(const MessageView * messages, size_t nMessages,
+                          DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
+                          DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
+                          size_t initialMaxRows                                                 = 10)
+        : super(doAllocateNumericTable, doCreateDictionaryFromContext, initialMaxRows)
+    {
+        initialize();
+        setMessages(messages, nMessages);
+    }
+
+    virtual ~StringBatchDataSource()
+    {
+        for (size_t i = 0; i < _lineBuffers.size(); i++) services::daal_free(_lineBuffers[i]);
+        services::daal_free(_blockStats);
+    }
+
+    /**
+     *  Sets a new batch of messages as a source for data. The messages must stay valid until the next call of the method
+     *  \param[in]  messages   Array of views of the messages, the data of the messages is not copied
+     *  \param[in]  nMessages  Number of the messages
+     */
+    void setMessages(const MessageView * messages, size_t nMessages)
+    {
+        if (!messages && nMessages)
+        {
+            _status.add(services::throwIfPossible(services::Status(services::ErrorNullPtr)));
+            return;
+        }
+        if (!_messages.resize(nMessages) || !_firstRows.resize(nMessages + 1))
+        {
+            _status.add(services::throwIfPossible(services::Status(services::ErrorMemoryAllocationFailed)));
+            return;
+        }
+        for (size_t i = 0; i < nMessages; i++) _messages[i] = messages[i];
+        _nMessages = nMessages;
+        resetData();
+    }
+
+    /**
+     *  Returns the number of messages in the current batch
+     *  \return Number of the messages
+     */
+    size_t getNumberOfMessages() const { return _nMessages; }
+
+    /**
+     *  Moves the data source to the beginning of the current batch of messages
+     */
+    void resetData() { moveTo(0, 0); }
+
+public:
+    using super::loadDataBlock;
+
+    size_t loadDataBlock(NumericTable * nt) DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::checkDictionary();
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        size_t nRows = 0;
+        s            = countRows(nRows);
+        if (!s)
+        {
+            this->_status.add(services::throwIfPossible(s));
+            return 0;
+        }
+
+        /* All rows of the batch are known in advance, so they are parsed straight into the table with no intermediate blocks */
+        return loadDataBlock(nRows, nt);
+    }
+
+    services::Status createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        services::Status s = super::createDictionaryFromContext();
+        resetData();
+        return s;
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE { return (iseof() ? DataSourceIface::endOfData : DataSourceIface::readyForLoad); }
+
+protected:
+    bool iseof() const DAAL_C11_OVERRIDE { return _messageIndex >= _nMessages; }
+
+    services::Status readLine() DAAL_C11_OVERRIDE
+    {
+        _rawLineLength = 0;
+        if (iseof())
+        {
+            _rawLineBuffer[0] = '\0';
+            return services::Status();
+        }
+
+        const char * data = _messages[_messageIndex].data();
+        const size_t size = _messages[_messageIndex].size();
+
+        const size_t lineEnd    = internal::findFirst(data, _messagePos, size, '\n');
+        const size_t lineLength = lineEnd - _messagePos;
+        while (lineLength + 1 > (size_t)_rawLineBufferLen)
+        {
+            if (!super::enlargeBuffer()) return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+        if (lineLength && services::internal::daal_memcpy_s(_rawLineBuffer, _rawLineBufferLen, data + _messagePos, lineLength))
+        {
+            return services::Status(services::ErrorMemoryCopyFailedInternal);
+        }
+        _rawLineLength = (int)lineLength;
+        moveTo(_messageIndex, (lineEnd < size) ? lineEnd + 1 : lineEnd);
+
+        while (_rawLineLength > 0 && _rawLineBuffer[_rawLineLength - 1] == '\r')
+        {
+            _rawLineLength--;
+        }
+        _rawLineBuffer[_rawLineLength] = '\0';
+        return services::Status();
+    }
+
+    services::Status parseRows(size_t maxRows, size_t rowOffset, NumericTable * nt, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock,
+                               size_t & nRows) DAAL_C11_OVERRIDE
+    {
+        if (!isParallelParsingSupported(this->getFeatureManager()))
+        {
+            return super::parseRows(maxRows, rowOffset, nt, ntBlock, nRows);
+        }
+
+        nRows = 0;
+        if (iseof() || !maxRows) return services::Status();
+
+        size_t nAvailableRows = 0;
+        services::Status s    = countRows(nAvailableRows);
+        if (!s) return s;
+
+        const size_t nRowsToParse = (maxRows < nAvailableRows) ? maxRows : nAvailableRows;
+        if (!nRowsToParse) return services::Status();
+
+        /* Messages that hold the rows to parse */
+        const size_t firstMessage = _messageIndex;
+        size_t endMessage         = firstMessage;
+        while (endMessage < _nMessages && _firstRows[endMessage] < nRowsToParse) ++endMessage;
+
+        const size_t nCols = nt->getNumberOfColumns();
+        size_t nBlocks     = 0;
+        DAAL_CHECK_STATUS(s, splitOnBlocks(firstMessage, endMessage, nRowsToParse, nCols, nBlocks));
+
+        ParseTask task(*this, nRowsToParse, rowOffset, nCols, ntBlock);
+        internal::parallelFor(nBlocks, task);
+
+        /* Rows after the first empty line are not loaded, like in sequential parsing */
+        size_t nextMessage = endMessage;
+        size_t nextPos     = 0;
+        nRows              = nRowsToParse;
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            if (!_blockResults[i].isAllocated) return services::Status(services::ErrorMemoryAllocationFailed);
+            if (_blockResults[i].emptyRow < nRows)
+            {
+                nRows       = _blockResults[i].emptyRow;
+                nextMessage = _blockResults[i].resumeMessage;
+                nextPos     = _blockResults[i].resumePos;
+            }
+        }
+
+        if (nRows == nRowsToParse && nRowsToParse < nAvailableRows)
+        {
+            /* The last parsed row ends inside the last message */
+            nextMessage       = endMessage - 1;
+            const char * data = _messages[nextMessage].data();
+            const size_t size = _messages[nextMessage].size();
+            nextPos           = messageBegin(nextMessage);
+            for (size_t row = _firstRows[nextMessage]; row < nRowsToParse; row++)
+            {
+                nextPos = internal::findFirst(data, nextPos, size, '\n') + 1;
+            }
+        }
+
+        combineStatistics(nBlocks, nRows, nCols, nt);
+        moveTo(nextMessage, nextPos);
+        return services::Status();
+    }
+
+    services::Status resetNumericTable(NumericTable * nt, const size_t newSize) DAAL_C11_OVERRIDE
+    {
+        DefaultNumericTableType * table = dynamic_cast<DefaultNumericTableType *>(nt);
+        if (!table) return super::resetNumericTable(nt, newSize);
+
+        /* The memory of the table is reused while the batches fit into it and grows geometrically otherwise */
+        const size_t nCols = this->getNumericTableNumberOfColumns();
+        services::SharedPtr<DAAL_DATA_TYPE> tableArray = table->getArraySharedPtr();
+        if (tableArray.get() != _tableArray.get() || nCols != _tableColumns)
+        {
+            const bool isReusable = (tableArray && table->getNumberOfColumns() == nCols);
+            _tableArray           = isReusable ? tableArray : services::SharedPtr<DAAL_DATA_TYPE>();
+            _tableCapacity        = isReusable ? table->getNumberOfRows() : 0;
+            _tableColumns         = nCols;
+        }
+
+        if (newSize > _tableCapacity)
+        {
+            const size_t capacity = (newSize < 2 * _tableCapacity) ? 2 * _tableCapacity : newSize;
+            _tableArray = services::SharedPtr<DAAL_DATA_TYPE>((DAAL_DATA_TYPE *)services::daal_malloc(capacity * nCols * sizeof(DAAL_DATA_TYPE)),
+                                                              services::ServiceDeleter());
+            _tableCapacity = _tableArray ? capacity : 0;
+            if (!_tableArray && capacity && nCols) return services::Status(services::ErrorMemoryAllocationFailed);
+        }
+
+        services::Status s = table->setArray(_tableArray, newSize);
+        if (!s) return s;
+        return super::resetNumericTable(nt, newSize);
+    }
+
+private:
+    struct BlockResult
+    {
+        BlockResult() : beginMessage(0), endMessage(0), nStatRows(0), emptyRow(size_t(-1)), resumeMessage(0), resumePos(0), isAllocated(true) {}
+
+        size_t beginMessage;
+        size_t endMessage;
+        size_t nStatRows;
+        size_t emptyRow;
+        size_t resumeMessage;
+        size_t resumePos;
+        bool isAllocated;
+    };
+
+    struct CountTask
+    {
+        CountTask(const StringBatchDataSource & source) : _source(source) {}
+        void operator()(size_t i) const { _source.countMessageRows(_source._messageIndex + i); }
+
+        const StringBatchDataSource & _source;
+    };
+
+    struct ParseTask
+    {
+        ParseTask(StringBatchDataSource & source, size_t nRows, size_t rowOffset, size_t nCols, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock)
+            : _source(source), _nRows(nRows), _rowOffset(rowOffset), _nCols(nCols), _ntBlock(ntBlock)
+        {}
+        void operator()(size_t i) const { _source.parseBlock(i, _nRows, _rowOffset, _nCols, _ntBlock); }
+
+        StringBatchDataSource & _source;
+        size_t _nRows;
+        size_t _rowOffset;
+        size_t _nCols;
+        BlockDescriptor<DAAL_DATA_TYPE> & _ntBlock;
+    };
+
+    void initialize()
+    {
+        _nMessages     = 0;
+        _messageIndex  = 0;
+        _messagePos    = 0;
+        _isCounted     = false;
+        _blockStats    = NULL;
+        _nBlockStats   = 0;
+        _tableCapacity = 0;
+        _tableColumns  = 0;
+    }
+
+    size_t messageBegin(size_t iMessage) const { return (iMessage == _messageIndex) ? _messagePos : 0; }
+
+    /* Moves the position to the row that starts at pos of the message, exhausted messages are skipped */
+    void moveTo(size_t iMessage, size_t pos)
+    {
+        while (iMessage < _nMessages && pos >= _messages[iMessage].size())
+        {
+            ++iMessage;
+            pos = 0;
+        }
+        _messageIndex = iMessage;
+        _messagePos   = (iMessage < _nMessages) ? pos : 0;
+        _isCounted    = false;
+    }
+
+    /* Stores the number of the rows of the message that are not parsed yet in _firstRows[iMessage + 1] */
+    void countMessageRows(size_t iMessage) const
+    {
+        const char * data = _messages[iMessage].data();
+        const size_t size = _messages[iMessage].size();
+        const size_t pos  = messageBegin(iMessage);
+
+        size_t nRows = (pos < size) ? internal::countSymbols(data, pos, size, '\n') : 0;
+        if (pos < size && data[size - 1] != '\n') ++nRows;
+        _firstRows[iMessage + 1] = nRows;
+    }
+
+    /* Computes the index of the first row of every remaining message relative to the current position */
+    services::Status countRows(size_t & nRows)
+    {
+        nRows = 0;
+        if (iseof()) return services::Status();
+
+        if (!_isCounted)
+        {
+            CountTask task(*this);
+            internal::parallelFor(_nMessages - _messageIndex, task);
+
+            _firstRows[_messageIndex] = 0;
+            for (size_t i = _messageIndex; i < _nMessages; i++) _firstRows[i + 1] += _firstRows[i];
+            _isCounted = true;
+        }
+        nRows = _firstRows[_nMessages];
+        return services::Status();
+    }
+
+    /* Splits the messages into blocks with similar numbers of rows, the buffers of the blocks are kept between the calls */
+    services::Status splitOnBlocks(size_t firstMessage, size_t endMessage, size_t nRows, size_t nCols, size_t & nBlocks)
+    {
+        const size_t nThreads  = services::Environment::getInstance()->getNumberOfThreads();
+        const size_t nMessages = endMessage - firstMessage;
+        const size_t maxBlocks = 4 * (nThreads ? nThreads : 1);
+        nBlocks                = (nMessages < maxBlocks) ? nMessages : maxBlocks;
+
+        if (!_blockResults.resize(nBlocks)) return services::Status(services::ErrorMemoryAllocationFailed);
+        while (_lineBuffers.size() < nBlocks)
+        {
+            if (!_lineBuffers.safe_push_back(NULL) || !_lineBufferSizes.safe_push_back(0))
+            {
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            }
+        }
+
+        if (_nBlockStats < nBlocks * 4 * nCols)
+        {
+            services::daal_free(_blockStats);
+            _nBlockStats = nBlocks * 4 * nCols;
+            _blockStats  = (SummaryStatisticsType *)services::daal_malloc(_nBlockStats * sizeof(SummaryStatisticsType));
+            if (!_blockStats)
+            {
+                _nBlockStats = 0;
+                return services::Status(services::ErrorMemoryAllocationFailed);
+            }
+        }
+
+        size_t iMessage = firstMessage;
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            const size_t rowsEnd = (i + 1 < nBlocks) ? (i + 1) * nRows / nBlocks : nRows;
+
+            _blockResults[i]              = BlockResult();
+            _blockResults[i].beginMessage = iMessage;
+            while (iMessage < endMessage && _firstRows[iMessage] < rowsEnd) ++iMessage;
+            _blockResults[i].endMessage = iMessage;
+        }
+        return services::Status();
+    }
+
+    void parseBlock(size_t iBlock, size_t nRows, size_t rowOffset, size_t nCols, BlockDescriptor<DAAL_DATA_TYPE> & ntBlock)
+    {
+        BlockResult & result = _blockResults[iBlock];
+        char *& buffer       = _lineBuffers[iBlock];
+        size_t & bufferSize  = _lineBufferSizes[iBlock];
+
+        SummaryStatisticsType * minimum    = _blockStats + iBlock * 4 * nCols;
+        SummaryStatisticsType * maximum    = minimum + nCols;
+        SummaryStatisticsType * sum        = maximum + nCols;
+        SummaryStatisticsType * sumSquares = sum + nCols;
+
+        size_t nStatRows = 0;
+        for (size_t iMessage = result.beginMessage; iMessage < result.endMessage; iMessage++)
+        {
+            const char * data = _messages[iMessage].data();
+            const size_t size = _messages[iMessage].size();
+            size_t lineBegin  = messageBegin(iMessage);
+            for (size_t row = _firstRows[iMessage]; lineBegin < size && row < nRows; row++)
+            {
+                const size_t lineBreak = internal::findFirst(data, lineBegin, size, '\n');
+                size_t lineEnd         = lineBreak;
+                while (lineEnd > lineBegin && data[lineEnd - 1] == '\r') --lineEnd;
+
+                const size_t lineLength = lineEnd - lineBegin;
+                if (!lineLength)
+                {
+                    result.emptyRow      = row;
+                    result.resumeMessage = iMessage;
+                    result.resumePos     = (lineBreak < size) ? lineBreak + 1 : size;
+                    result.nStatRows     = nStatRows;
+                    return;
+                }
+
+                if (lineLength + 1 > bufferSize)
+                {
+                    services::daal_free(buffer);
+                    bufferSize = 2 * (lineLength + 1);
+                    buffer     = (char *)services::daal_malloc(bufferSize);
+                    if (!buffer)
+                    {
+                        bufferSize         = 0;
+                        result.isAllocated = false;
+                        return;
+                    }
+                }
+                services::internal::daal_memcpy_s(buffer, bufferSize, data + lineBegin, lineLength);
+                buffer[lineLength] = '\0';
+
+                DAAL_DATA_TYPE * rowPtr = ntBlock.getBlockPtr() + (rowOffset + row) * nCols;
+                services::BufferView<DAAL_DATA_TYPE> rowBuffer(rowPtr, ntBlock.getNumberOfColumns());
+                this->getFeatureManager().parseRowIn(buffer, lineLength, this->_dict.get(), rowBuffer, rowOffset + row);
+
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    const SummaryStatisticsType value = rowPtr[j];
+                    if (!nStatRows || minimum[j] > value) minimum[j] = value;
+                    if (!nStatRows || maximum[j] < value) maximum[j] = value;
+                    sum[j]        = (nStatRows ? sum[j] : 0) + value;
+                    sumSquares[j] = (nStatRows ? sumSquares[j] : 0) + value * value;
+                }
+
+                ++nStatRows;
+                lineBegin = lineBreak + 1;
+            }
+        }
+        result.nStatRows = nStatRows;
+    }
+
+    void combineStatistics(size_t nBlocks, size_t nRows, size_t nCols, NumericTable * nt) const
+    {
+        if (!nRows) return;
+
+        NumericTablePtr ntMin   = nt->basicStatistics.get(NumericTable::minimum);
+        NumericTablePtr ntMax   = nt->basicStatistics.get(NumericTable::maximum);
+        NumericTablePtr ntSum   = nt->basicStatistics.get(NumericTable::sum);
+        NumericTablePtr ntSumSq = nt->basicStatistics.get(NumericTable::sumSquares);
+        if (!ntMin || !ntMax || !ntSum || !ntSumSq) return;
+
+        BlockDescriptor<SummaryStatisticsType> blockMin, blockMax, blockSum, blockSumSq;
+        ntMin->getBlockOfRows(0, 1, writeOnly, blockMin);
+        ntMax->getBlockOfRows(0, 1, writeOnly, blockMax);
+        ntSum->getBlockOfRows(0, 1, writeOnly, blockSum);
+        ntSumSq->getBlockOfRows(0, 1, writeOnly, blockSumSq);
+
+        SummaryStatisticsType * minimum    = blockMin.getBlockPtr();
+        SummaryStatisticsType * maximum    = blockMax.getBlockPtr();
+        SummaryStatisticsType * sum        = blockSum.getBlockPtr();
+        SummaryStatisticsType * sumSquares = blockSumSq.getBlockPtr();
+
+        if (minimum && maximum && sum && sumSquares)
+        {
+            bool bFirst = true;
+            for (size_t i = 0; i < nBlocks; i++)
+            {
+                const BlockResult & result = _blockResults[i];
+                if (result.beginMessage == result.endMessage || !result.nStatRows) continue;
+                if (_firstRows[result.beginMessage] >= nRows) break;
+
+                const SummaryStatisticsType * blockMinimum = _blockStats + i * 4 * nCols;
+                const SummaryStatisticsType * blockMaximum = blockMinimum + nCols;
+                const SummaryStatisticsType * blockSum     = blockMaximum + nCols;
+                const SummaryStatisticsType * blockSq      = blockSum + nCols;
+                for (size_t j = 0; j < nCols; j++)
+                {
+                    if (bFirst || minimum[j] > blockMinimum[j]) minimum[j] = blockMinimum[j];
+                    if (bFirst || maximum[j] < blockMaximum[j]) maximum[j] = blockMaximum[j];
+                    sum[j]        = (bFirst ? 0 : sum[j]) + blockSum[j];
+                    sumSquares[j] = (bFirst ? 0 : sumSquares[j]) + blockSq[j];
+                }
+                bFirst = false;
+            }
+        }
+
+        ntMin->releaseBlockOfRows(blockMin);
+        ntMax->releaseBlockOfRows(blockMax);
+        ntSum->releaseBlockOfRows(blockSum);
+        ntSumSq->releaseBlockOfRows(blockSumSq);
+    }
+
+    StringBatchDataSource(const StringBatchDataSource &);
+    StringBatchDataSource & operator=(const StringBatchDataSource &);
+
+    services::Collection<MessageView> _messages;
+    size_t _nMessages;
+    size_t _messageIndex;
+    size_t _messagePos;
+
+    /* Index of the first unparsed row of every message relative to the current position, valid if _isCounted is set */
+    mutable services::Collection<size_t> _firstRows;
+    bool _isCounted;
+
+    services::Collection<BlockResult> _blockResults;
+    services::Collection<char *> _lineBuffers;
+    services::Collection<size_t> _lineBufferSizes;
+    SummaryStatisticsType * _blockStats; /*!< Minimum, maximum, sum and sum of squares for every block */
+    size_t _nBlockStats;
+
+    services::SharedPtr<DAAL_DATA_TYPE> _tableArray;
+    size_t _tableCapacity;
+    size_t _tableColumns;
+};
+/** @} */
+} // namespace interface1
+using interface1::StringBatchDataSource;
+
+} // namespace data_management
+} // namespace daal
+#endif
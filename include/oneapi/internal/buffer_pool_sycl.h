@@ -0,0 +1,251 @@
+/* file: buffer_pool_sycl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef DAAL_SYCL_INTERFACE
+    #ifndef __DAAL_ONEAPI_INTERNAL_BUFFER_POOL_SYCL_H__
+        #define __DAAL_ONEAPI_INTERNAL_BUFFER_POOL_SYCL_H__
+
+        #include <vector>
+
+        #include "services/buffer.h"
+        #include "oneapi/internal/types_utils_cxx11.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace interface1
+{
+/** @ingroup oneapi_internal
+ * @{
+ */
+
+/**
+ *  <a name="DAAL-STRUCT-ONEAPI-INTERNAL__BUFFERPOOLSTATISTICS"></a>
+ *  \brief Statistics of the buffer pool
+ */
+struct BufferPoolStatistics
+{
+    BufferPoolStatistics() : nHits(0), nMisses(0), nTrimmed(0), nEntries(0), cachedBytes(0), usedBytes(0), peakBytes(0) {}
+
+    size_t nHits;       /*!< Number of allocations served by the cached entries */
+    size_t nMisses;     /*!< Number of allocations that created new buffers */
+    size_t nTrimmed;    /*!< Number of entries released by trim */
+    size_t nEntries;    /*!< Number of entries in the pool */
+    size_t cachedBytes; /*!< Size of all the entries in the pool in bytes */
+    size_t usedBytes;   /*!< Size of the entries that are currently in use in bytes */
+    size_t peakBytes;   /*!< Maximal size of all the entries in the pool in bytes */
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__SYCLBUFFERPOOL"></a>
+ *  \brief Caching allocator of SYCL* buffers for the temporary data of the algorithms.
+ *         Allocations are rounded up to the power-of-two size classes, each size class has its own bucket of entries.
+ *         The allocated UniversalBuffer holds the lease of the entry, the entry is reused when all the copies
+ *         of the buffer and its sub-buffers are destroyed. Buffers are bound to the context of the queue the pool belongs to.
+ */
+class SyclBufferPool
+{
+private:
+    struct Lease : public Base
+    {};
+
+    struct Entry
+    {
+        TypeId type;
+        size_t bytes;
+        UniversalBuffer buffer;
+        services::SharedPtr<Base> lease;
+
+        bool isFree() const { return lease.useCount() == 1; }
+    };
+
+    struct GetTypeSize
+    {
+        size_t typeSize;
+
+        GetTypeSize() : typeSize(0) {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            typeSize = sizeof(T);
+        }
+    };
+
+    struct CreateView
+    {
+        const Entry & entry;
+        size_t size;
+        UniversalBuffer buffer;
+
+        CreateView(const Entry & e, size_t s) : entry(e), size(s) {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            buffer = services::internal::PooledSyclBufferFactory<T>::create(entry.buffer.get<T>().toSycl(), size, entry.lease);
+        }
+    };
+
+public:
+    enum
+    {
+        nBuckets         = 64,
+        minSizeClassLog2 = 8 /* Allocations smaller than 256 bytes share the smallest size class */
+    };
+
+    /* Allocations larger than maxBufferBytes and allocations made while the cached size exceeds maxCachedBytes
+       are not pooled */
+    SyclBufferPool() : _isEnabled(true), _maxCachedBytes(size_t(1) << 30), _maxBufferBytes(size_t(1) << 28) {}
+
+    void setEnabled(bool isEnabled)
+    {
+        _isEnabled = isEnabled;
+        if (!isEnabled) trim();
+    }
+
+    bool isEnabled() const { return _isEnabled; }
+
+    void setMaxCachedBytes(size_t maxCachedBytes)
+    {
+        _maxCachedBytes = maxCachedBytes;
+        trim(maxCachedBytes);
+    }
+
+    UniversalBuffer allocate(TypeId type, size_t bufferSize)
+    {
+        GetTypeSize getTypeSize;
+        TypeDispatcher::dispatch(type, getTypeSize);
+
+        const size_t bytes = bufferSize * getTypeSize.typeSize;
+        if (!_isEnabled || bufferSize == 0 || bytes > _maxBufferBytes || bytes / getTypeSize.typeSize != bufferSize)
+        {
+            return BufferAllocator::allocate(type, bufferSize);
+        }
+
+        const size_t classLog2      = getSizeClass(bytes);
+        std::vector<Entry> & bucket = _buckets[classLog2];
+        for (size_t i = 0; i < bucket.size(); i++)
+        {
+            if (bucket[i].type == type && bucket[i].isFree())
+            {
+                _statistics.nHits++;
+                return createView(bucket[i], bufferSize);
+            }
+        }
+
+        _statistics.nMisses++;
+        const size_t entryBytes = size_t(1) << classLog2;
+        if (_statistics.cachedBytes + entryBytes > _maxCachedBytes)
+        {
+            trim(_maxCachedBytes - minValue(_maxCachedBytes, entryBytes));
+            if (_statistics.cachedBytes + entryBytes > _maxCachedBytes)
+            {
+                return BufferAllocator::allocate(type, bufferSize);
+            }
+        }
+
+        Entry entry;
+        entry.type   = type;
+        entry.bytes  = entryBytes;
+        entry.buffer = BufferAllocator::allocate(type, entryBytes / getTypeSize.typeSize);
+        entry.lease  = services::SharedPtr<Base>(new Lease());
+        bucket.push_back(entry);
+
+        _statistics.nEntries++;
+        _statistics.cachedBytes += entryBytes;
+        if (_statistics.cachedBytes > _statistics.peakBytes) _statistics.peakBytes = _statistics.cachedBytes;
+
+        return createView(bucket.back(), bufferSize);
+    }
+
+    /**
+     *  Releases the free entries, the largest ones first, until the size of the pool does not exceed maxCachedBytes
+     */
+    void trim(size_t maxCachedBytes = 0)
+    {
+        for (size_t c = nBuckets; c > 0 && _statistics.cachedBytes > maxCachedBytes; c--)
+        {
+            std::vector<Entry> & bucket = _buckets[c - 1];
+            for (size_t i = bucket.size(); i > 0 && _statistics.cachedBytes > maxCachedBytes; i--)
+            {
+                if (!bucket[i - 1].isFree()) continue;
+
+                _statistics.cachedBytes -= bucket[i - 1].bytes;
+                _statistics.nEntries--;
+                _statistics.nTrimmed++;
+                bucket.erase(bucket.begin() + (i - 1));
+            }
+        }
+    }
+
+    BufferPoolStatistics getStatistics() const
+    {
+        BufferPoolStatistics statistics = _statistics;
+        statistics.usedBytes            = 0;
+        for (size_t c = 0; c < nBuckets; c++)
+        {
+            for (size_t i = 0; i < _buckets[c].size(); i++)
+            {
+                if (!_buckets[c][i].isFree()) statistics.usedBytes += _buckets[c][i].bytes;
+            }
+        }
+        return statistics;
+    }
+
+private:
+    static size_t getSizeClass(size_t bytes)
+    {
+        size_t classLog2 = minSizeClassLog2;
+        while ((size_t(1) << classLog2) < bytes)
+        {
+            classLog2++;
+        }
+        return classLog2;
+    }
+
+    static size_t minValue(size_t a, size_t b) { return a < b ? a : b; }
+
+    static UniversalBuffer createView(const Entry & entry, size_t bufferSize)
+    {
+        CreateView createViewOp(entry, bufferSize);
+        TypeDispatcher::dispatch(entry.type, createViewOp);
+        return createViewOp.buffer;
+    }
+
+    bool _isEnabled;
+    size_t _maxCachedBytes;
+    size_t _maxBufferBytes;
+    BufferPoolStatistics _statistics;
+    std::vector<Entry> _buckets[nBuckets];
+};
+
+/** @} */
+} // namespace interface1
+
+using interface1::BufferPoolStatistics;
+using interface1::SyclBufferPool;
+
+} // namespace internal
+} // namespace oneapi
+} // namespace daal
+
+    #endif
+#endif // DAAL_SYCL_INTERFACE
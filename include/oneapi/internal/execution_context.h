@@ -336,6 +336,12 @@ public:
                       size_t lda, size_t offsetA, const UniversalBuffer & b_buffer, size_t ldb, size_t offsetB, double beta,
                       UniversalBuffer & c_buffer, size_t ldc, size_t offsetC, services::Status * status = NULL) = 0;
 
+    /* Computes batchSize products, the matrices of the i-th product start at the offsets i * strideA, i * strideB and i * strideC */
+    virtual void gemmBatch(math::Transpose transa, math::Transpose transb, size_t m, size_t n, size_t k, double alpha,
+                           const UniversalBuffer & a_buffer, size_t lda, size_t strideA, const UniversalBuffer & b_buffer, size_t ldb,
+                           size_t strideB, double beta, UniversalBuffer & c_buffer, size_t ldc, size_t strideC, size_t batchSize,
+                           services::Status * status = NULL) = 0;
+
     virtual void syrk(math::UpLo upper_lower, math::Transpose trans, size_t n, size_t k, double alpha, const UniversalBuffer & a_buffer, size_t lda,
                       size_t offsetA, double beta, UniversalBuffer & c_buffer, size_t ldc, size_t offsetC, services::Status * status = NULL) = 0;
 
@@ -347,6 +353,12 @@ public:
     virtual void potrs(math::UpLo uplo, size_t n, size_t ny, UniversalBuffer & a_buffer, size_t lda, UniversalBuffer & b_buffer, size_t ldb,
                        services::Status * status = NULL) = 0;
 
+    virtual void potrfBatch(math::UpLo uplo, size_t n, UniversalBuffer & a_buffer, size_t lda, size_t strideA, size_t batchSize,
+                            services::Status * status = NULL) = 0;
+
+    virtual void potrsBatch(math::UpLo uplo, size_t n, size_t ny, UniversalBuffer & a_buffer, size_t lda, size_t strideA, UniversalBuffer & b_buffer,
+                            size_t ldb, size_t strideB, size_t batchSize, services::Status * status = NULL) = 0;
+
     virtual void copy(UniversalBuffer dest, size_t desOffset, UniversalBuffer src, size_t srcOffset, size_t count, services::Status * status) = 0;
 
     virtual void fill(UniversalBuffer dest, double value, services::Status * status) = 0;
@@ -358,6 +370,9 @@ public:
     virtual InfoDevice & getInfoDevice() = 0;
 
     virtual void copy(UniversalBuffer dest, size_t desOffset, void * src, size_t srcOffset, size_t count, services::Status * status) = 0;
+
+    /* Waits for the completion of the work submitted to the context */
+    virtual void wait(services::Status * status = NULL) = 0;
 };
 
 /**
@@ -411,6 +426,14 @@ public:
         services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
     }
 
+    void gemmBatch(math::Transpose /*transa*/, math::Transpose /*transb*/, size_t /*m*/, size_t /*n*/, size_t /*k*/, double /*alpha*/,
+                   const UniversalBuffer & /*a_buffer*/, size_t /*lda*/, size_t /*strideA*/, const UniversalBuffer & /*b_buffer*/, size_t /*ldb*/,
+                   size_t /*strideB*/, double /*beta*/, UniversalBuffer & /*c_buffer*/, size_t /*ldc*/, size_t /*strideC*/, size_t /*batchSize*/,
+                   services::Status * status = NULL) DAAL_C11_OVERRIDE
+    {
+        services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
+    }
+
     void syrk(math::UpLo /*upper_lower*/, math::Transpose /*trans*/, size_t /*n*/, size_t /*k*/, double /*alpha*/,
               const UniversalBuffer & /*a_buffer*/, size_t /*lda*/, size_t /*offsetA*/, double /*beta*/, UniversalBuffer & /*c_buffer*/,
               size_t /*ldc*/, size_t /*offsetC*/, services::Status * status = NULL) DAAL_C11_OVERRIDE
@@ -435,6 +458,19 @@ public:
         services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
     }
 
+    void potrfBatch(math::UpLo /*uplo*/, size_t /*n*/, UniversalBuffer & /*a_buffer*/, size_t /*lda*/, size_t /*strideA*/, size_t /*batchSize*/,
+                    services::Status * status = NULL) DAAL_C11_OVERRIDE
+    {
+        services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
+    }
+
+    void potrsBatch(math::UpLo /*uplo*/, size_t /*n*/, size_t /*ny*/, UniversalBuffer & /*a_buffer*/, size_t /*lda*/, size_t /*strideA*/,
+                    UniversalBuffer & /*b_buffer*/, size_t /*ldb*/, size_t /*strideB*/, size_t /*batchSize*/,
+                    services::Status * status = NULL) DAAL_C11_OVERRIDE
+    {
+        services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
+    }
+
     void copy(UniversalBuffer /*dest*/, size_t /*desOffset*/, UniversalBuffer /*src*/, size_t /*srcOffset*/, size_t /*count*/,
               services::Status * status = NULL) DAAL_C11_OVERRIDE
     {
@@ -462,6 +498,8 @@ public:
         services::internal::tryAssignStatus(status, services::ErrorMethodNotImplemented);
     }
 
+    void wait(services::Status * /*status = NULL*/) DAAL_C11_OVERRIDE {}
+
 private:
     CpuKernelFactory _factory;
     InfoDevice _infoDevice;
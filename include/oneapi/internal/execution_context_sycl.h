@@ -23,6 +23,8 @@
         #include "services/internal/hash_table.h"
         #include "oneapi/internal/execution_context.h"
         #include "oneapi/internal/kernel_scheduler_sycl.h"
+        #include "oneapi/internal/program_cache_sycl.h"
+        #include "oneapi/internal/buffer_pool_sycl.h"
         #include "oneapi/internal/math/blas_executor.h"
         #include "oneapi/internal/math/lapack_executor.h"
         #include "oneapi/internal/error_handling.h"
@@ -58,8 +60,7 @@ public:
         }
         if (!res)
         {
-            auto programPtr = services::SharedPtr<OpenClProgramRef>(
-                new OpenClProgramRef(_deviceQueue.get_context().get(), _deviceQueue.get_device().get(), name, program, options, &localStatus));
+            auto programPtr = createProgram(name, program, options, localStatus);
             if (!localStatus.ok())
             {
                 services::internal::tryAssignStatus(status, localStatus);
@@ -130,13 +131,92 @@ public:
         }
     }
 
+    /**
+     *  Enables the persistent cache of the binaries of the built programs in the directory,
+     *  the empty or null directory disables the cache
+     */
+    void setProgramCacheDirectory(const char * directory) { _programCache.setDirectory(directory, _deviceQueue.get_device().get()); }
+
+    /**
+     *  Creates all the programs cached for the device, so that the next calls of build() do not access the cache.
+     *  Programs that cannot be created from the cached binaries are skipped and are compiled on first use
+     */
+    void warmUpProgramCache(services::Status * status = nullptr)
+    {
+        const cl_context clContext  = _deviceQueue.get_context().get();
+        const cl_device_id clDevice = _deviceQueue.get_device().get();
+
+        std::vector<OpenClProgramCache::Entry> entries;
+        _programCache.readIndex(entries);
+
+        /* The latest entry of the program name is used if the program was rebuilt with different options */
+        for (size_t i = entries.size(); i > 0; i--)
+        {
+            const OpenClProgramCache::Entry & entry = entries[i - 1];
+            services::Status localStatus;
+            services::String key = entry.programName.c_str();
+            const bool res       = programHashTable.contain(key, localStatus);
+            if (!localStatus.ok())
+            {
+                services::internal::tryAssignStatus(status, localStatus);
+                return;
+            }
+            if (res) continue;
+
+            std::vector<unsigned char> binary;
+            if (!_programCache.load(entry.programKey, binary)) continue;
+
+            auto programPtr = services::SharedPtr<OpenClProgramRef>(
+                new OpenClProgramRef(clContext, clDevice, key.c_str(), binary.data(), binary.size(), entry.options.c_str(), &localStatus));
+            if (!localStatus.ok()) continue;
+
+            programHashTable.add(key, programPtr, localStatus);
+            if (!localStatus.ok())
+            {
+                services::internal::tryAssignStatus(status, localStatus);
+                return;
+            }
+        }
+    }
+
 private:
+    /* Creates the program from the cached binary if it is available and compiles it from the source otherwise */
+    services::SharedPtr<OpenClProgramRef> createProgram(const char * name, const char * program, const char * options, services::Status & status)
+    {
+        const cl_context clContext  = _deviceQueue.get_context().get();
+        const cl_device_id clDevice = _deviceQueue.get_device().get();
+
+        std::string programKey;
+        if (_programCache.isEnabled())
+        {
+            programKey = _programCache.getProgramKey(program, options);
+
+            std::vector<unsigned char> binary;
+            if (_programCache.load(programKey, binary))
+            {
+                services::Status binaryStatus;
+                auto programPtr = services::SharedPtr<OpenClProgramRef>(
+                    new OpenClProgramRef(clContext, clDevice, name, binary.data(), binary.size(), options, &binaryStatus));
+                if (binaryStatus.ok()) return programPtr;
+                /* Binaries rejected by the driver are replaced with the ones compiled from the source */
+            }
+        }
+
+        auto programPtr = services::SharedPtr<OpenClProgramRef>(new OpenClProgramRef(clContext, clDevice, name, program, options, &status));
+        if (status.ok() && _programCache.isEnabled())
+        {
+            _programCache.store(programPtr->get(), programKey, name, options);
+        }
+        return programPtr;
+    }
+
     static const size_t SIZE_HASHTABLE_PROGRAM = 1024;
     static const size_t SIZE_HASHTABLE_KERNEL  = 4096;
     services::internal::HashTable<OpenClProgramRef, SIZE_HASHTABLE_PROGRAM> programHashTable;
     services::internal::HashTable<KernelIface, SIZE_HASHTABLE_KERNEL> kernelHashTable;
 
     OpenClProgramRef * _currentProgramRef;
+    OpenClProgramCache _programCache;
 
     ExecutionTargetId _executionTarget;
     cl::sycl::queue & _deviceQueue;
@@ -187,6 +267,17 @@ public:
                                 offsetC, status);
     }
 
+    void gemmBatch(math::Transpose transa, math::Transpose transb, size_t m, size_t n, size_t k, double alpha, const UniversalBuffer & a_buffer,
+                   size_t lda, size_t strideA, const UniversalBuffer & b_buffer, size_t ldb, size_t strideB, double beta, UniversalBuffer & c_buffer,
+                   size_t ldc, size_t strideC, size_t batchSize, services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(a_buffer.type() == b_buffer.type());
+        DAAL_ASSERT(b_buffer.type() == c_buffer.type());
+
+        math::GemmBatchExecutor::run(_deviceQueue, transa, transb, m, n, k, alpha, a_buffer, lda, strideA, b_buffer, ldb, strideB, beta, c_buffer,
+                                     ldc, strideC, batchSize, status);
+    }
+
     void syrk(math::UpLo upper_lower, math::Transpose trans, size_t n, size_t k, double alpha, const UniversalBuffer & a_buffer, size_t lda,
               size_t offsetA, double beta, UniversalBuffer & c_buffer, size_t ldc, size_t offsetC,
               services::Status * status = nullptr) DAAL_C11_OVERRIDE
@@ -216,12 +307,25 @@ public:
         math::PotrsExecutor::run(_deviceQueue, uplo, n, ny, a_buffer, lda, b_buffer, ldb, status);
     }
 
+    void potrfBatch(math::UpLo uplo, size_t n, UniversalBuffer & a_buffer, size_t lda, size_t strideA, size_t batchSize,
+                    services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        math::PotrfBatchExecutor::run(_deviceQueue, uplo, n, a_buffer, lda, strideA, batchSize, status);
+    }
+
+    void potrsBatch(math::UpLo uplo, size_t n, size_t ny, UniversalBuffer & a_buffer, size_t lda, size_t strideA, UniversalBuffer & b_buffer,
+                    size_t ldb, size_t strideB, size_t batchSize, services::Status * status = nullptr) DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(a_buffer.type() == b_buffer.type());
+        math::PotrsBatchExecutor::run(_deviceQueue, uplo, n, ny, a_buffer, lda, strideA, b_buffer, ldb, strideB, batchSize, status);
+    }
+
     UniversalBuffer allocate(TypeId type, size_t bufferSize, services::Status * status = nullptr) DAAL_C11_OVERRIDE
     {
         // TODO: Thread safe?
         try
         {
-            auto buffer = BufferAllocator::allocate(type, bufferSize);
+            auto buffer = _bufferPool.allocate(type, bufferSize);
             return buffer;
         }
         catch (cl::sycl::exception const & e)
@@ -261,6 +365,19 @@ public:
 
     ClKernelFactoryIface & getClKernelFactory() DAAL_C11_OVERRIDE { return _kernelFactory; }
 
+    void setProgramCacheDirectory(const char * directory) { _kernelFactory.setProgramCacheDirectory(directory); }
+
+    void warmUpProgramCache(services::Status * status = nullptr) { _kernelFactory.warmUpProgramCache(status); }
+
+    void setAsynchronousScheduling(bool isAsynchronous, services::Status * status = nullptr)
+    {
+        _kernelScheduler.setAsynchronous(isAsynchronous, status);
+    }
+
+    void wait(services::Status * status = nullptr) DAAL_C11_OVERRIDE { _kernelScheduler.wait(status); }
+
+    SyclBufferPool & getBufferPool() { return _bufferPool; }
+
     InfoDevice & getInfoDevice() DAAL_C11_OVERRIDE { return _infoDevice; }
 
     void copy(UniversalBuffer dest, size_t desOffset, void * src, size_t srcOffset, size_t count,
@@ -281,6 +398,7 @@ private:
     cl::sycl::queue _deviceQueue;
     OpenClKernelFactory _kernelFactory;
     SyclKernelScheduler _kernelScheduler;
+    SyclBufferPool _bufferPool;
     InfoDevice _infoDevice;
 };
 
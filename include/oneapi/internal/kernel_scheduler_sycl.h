@@ -141,6 +141,21 @@ public:
         DAAL_CHECK_OPENCL(err, status)
     }
 
+    /* Creates the program from the binary returned by clGetProgramInfo() for the same device */
+    explicit OpenClProgramRef(cl_context clContext, cl_device_id clDevice, const char * programName, const unsigned char * binary,
+                              size_t binarySize, const char * options, services::Status * status = nullptr)
+    {
+        _progamName         = programName;
+        cl_int err          = 0;
+        cl_int binaryStatus = 0;
+        reset(clCreateProgramWithBinary(clContext, 1, &clDevice, &binarySize, &binary, &binaryStatus, &err));
+        DAAL_CHECK_OPENCL(err, status)
+        DAAL_CHECK_OPENCL(binaryStatus, status)
+
+        err = clBuildProgram(get(), 1, &clDevice, options, nullptr, nullptr);
+        DAAL_CHECK_OPENCL(err, status)
+    }
+
     const char * getName() const { return _progamName.c_str(); }
 
 private:
@@ -192,14 +207,22 @@ private:
 class SyclBufferStorage
 {
 public:
+    SyclBufferStorage() : _hasTemporaryBuffers(false) {}
+
     template <typename T>
     void add(const cl::sycl::buffer<T, 1> & buffer)
     {
         _buffers.push_back(services::internal::Any(buffer));
     }
 
+    /* Temporary SYCL* buffers write the results back to the host memory only on destruction */
+    void markTemporaryBuffers() { _hasTemporaryBuffers = true; }
+
+    bool hasTemporaryBuffers() const { return _hasTemporaryBuffers; }
+
 private:
     std::vector<services::internal::Any> _buffers;
+    bool _hasTemporaryBuffers;
 };
 
 class SyclKernelSchedulerArgHandler
@@ -226,11 +249,16 @@ private:
     template <typename T>
     void handlePublicBuffer()
     {
-        auto buffer = _argument.get<services::Buffer<T> >().toSycl();
+        const auto & publicBuffer = _argument.get<services::Buffer<T> >();
+        auto buffer               = publicBuffer.toSycl();
 
         // Note: we need this storage to keep all sycl buffers alive
         // while the kernel is running
         _storage.add(buffer);
+        if (!publicBuffer.isSyclBuffer())
+        {
+            _storage.markTemporaryBuffers();
+        }
 
         switch (_argument.accessMode())
         {
@@ -340,7 +368,41 @@ inline cl::sycl::nd_range<3> convertToSyclRange<3>(const KernelNDRange & r)
 class SyclKernelScheduler : public Base, public KernelSchedulerIface
 {
 public:
-    explicit SyclKernelScheduler(cl::sycl::queue & deviceQueue) : _queue(deviceQueue) {}
+    explicit SyclKernelScheduler(cl::sycl::queue & deviceQueue) : _queue(deviceQueue), _isAsynchronous(false), _hasLastEvent(false) {}
+
+    /**
+     *  In the asynchronous mode the kernels are submitted without waiting for their completion, each kernel depends on
+     *  the previous one. Kernels that access memory not backed by SYCL* buffers are still waited for, since their results
+     *  become visible on the host only when the temporary SYCL* buffers are destroyed
+     */
+    void setAsynchronous(bool isAsynchronous, services::Status * status = nullptr)
+    {
+        if (!isAsynchronous) wait(status);
+        _isAsynchronous = isAsynchronous;
+    }
+
+    bool isAsynchronous() const { return _isAsynchronous; }
+
+    /**
+     *  Waits for the completion of all the kernels submitted in the asynchronous mode
+     */
+    void wait(services::Status * status = nullptr)
+    {
+        try
+        {
+            for (size_t i = 0; i < _pendingEvents.size(); i++)
+            {
+                _pendingEvents[i].wait_and_throw();
+            }
+        }
+        catch (const cl::sycl::exception & e)
+        {
+            convertSyclExceptionToStatus(e, status);
+        }
+        _pendingEvents.clear();
+        _pendingStorages.clear();
+        _hasLastEvent = false;
+    }
 
     void schedule(const OpenClKernel & kernel, const KernelRange & range, const KernelArguments & args,
                   services::Status * status = nullptr) DAAL_C11_OVERRIDE
@@ -401,12 +463,26 @@ private:
 
         cl::sycl::kernel syclKernel(kernel.getRef().get(), _queue.get_context());
 
-        auto event = _queue.submit([&](cl::sycl::handler & cgh) {
+        const bool dependsOnLastEvent = _isAsynchronous && _hasLastEvent;
+        auto event                    = _queue.submit([&](cl::sycl::handler & cgh) {
+            if (dependsOnLastEvent) cgh.depends_on(_lastEvent);
             passArguments(cgh, bufferStorage, args);
             cgh.parallel_for(range, syclKernel);
         });
 
-        event.wait_and_throw();
+        if (!_isAsynchronous || bufferStorage.hasTemporaryBuffers())
+        {
+            event.wait_and_throw();
+
+            /* The previous kernels are completed since the kernel depends on them */
+            if (_isAsynchronous) wait(status);
+            return;
+        }
+
+        _lastEvent    = event;
+        _hasLastEvent = true;
+        _pendingEvents.push_back(event);
+        _pendingStorages.push_back(std::move(bufferStorage));
     }
 
     void passArguments(cl::sycl::handler & cgh, SyclBufferStorage & storage, const KernelArguments & args) const
@@ -421,6 +497,11 @@ private:
 
 private:
     cl::sycl::queue & _queue;
+    bool _isAsynchronous;
+    bool _hasLastEvent;
+    cl::sycl::event _lastEvent;
+    std::vector<cl::sycl::event> _pendingEvents;
+    std::vector<SyclBufferStorage> _pendingStorages;
 };
 
 } // namespace interface1
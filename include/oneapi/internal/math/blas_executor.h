@@ -135,6 +135,92 @@ public:
     }
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__GEMMBATCHEXECUTOR"></a>
+ *  \brief Adapter for strided batched GEMM routine
+ */
+class GemmBatchExecutor
+{
+private:
+    struct Execute
+    {
+        cl::sycl::queue & queue;
+        const math::Transpose transa;
+        const math::Transpose transb;
+        const size_t m;
+        const size_t n;
+        const size_t k;
+        const double alpha;
+        const UniversalBuffer & a_buffer;
+        const size_t lda;
+        const size_t strideA;
+        const UniversalBuffer & b_buffer;
+        const size_t ldb;
+        const size_t strideB;
+        const double beta;
+        UniversalBuffer & c_buffer;
+        const size_t ldc;
+        const size_t strideC;
+        const size_t batchSize;
+        services::Status * status;
+
+        explicit Execute(cl::sycl::queue & queue, const math::Transpose transa, const math::Transpose transb, const size_t m, const size_t n,
+                         const size_t k, const double alpha, const UniversalBuffer & a_buffer, const size_t lda, const size_t strideA,
+                         const UniversalBuffer & b_buffer, const size_t ldb, const size_t strideB, const double beta, UniversalBuffer & c_buffer,
+                         const size_t ldc, const size_t strideC, const size_t batchSize, services::Status * status)
+            : queue(queue),
+              transa(transa),
+              transb(transb),
+              m(m),
+              n(n),
+              k(k),
+              alpha(alpha),
+              a_buffer(a_buffer),
+              lda(lda),
+              strideA(strideA),
+              b_buffer(b_buffer),
+              ldb(ldb),
+              strideB(strideB),
+              beta(beta),
+              c_buffer(c_buffer),
+              ldc(ldc),
+              strideC(strideC),
+              batchSize(batchSize),
+              status(status)
+        {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            auto a_buffer_t = a_buffer.template get<T>();
+            auto b_buffer_t = b_buffer.template get<T>();
+            auto c_buffer_t = c_buffer.template get<T>();
+
+#ifdef ONEAPI_DAAL_NO_MKL_GPU_FUNC
+            ReferenceGemmBatch<T> functor;
+#else
+            MKLGemmBatch<T> functor(queue);
+#endif
+
+            services::Status statusGemm = functor(transa, transb, m, n, k, (T)alpha, a_buffer_t, lda, strideA, b_buffer_t, ldb, strideB, (T)beta,
+                                                  c_buffer_t, ldc, strideC, batchSize);
+
+            services::internal::tryAssignStatus(status, statusGemm);
+        }
+    };
+
+public:
+    static void run(cl::sycl::queue & queue, const math::Transpose transa, const math::Transpose transb, const size_t m, const size_t n,
+                    const size_t k, const double alpha, const UniversalBuffer & a_buffer, const size_t lda, const size_t strideA,
+                    const UniversalBuffer & b_buffer, const size_t ldb, const size_t strideB, const double beta, UniversalBuffer & c_buffer,
+                    const size_t ldc, const size_t strideC, const size_t batchSize, services::Status * status)
+    {
+        Execute op(queue, transa, transb, m, n, k, alpha, a_buffer, lda, strideA, b_buffer, ldb, strideB, beta, c_buffer, ldc, strideC, batchSize,
+                   status);
+        TypeDispatcher::floatDispatch(a_buffer.type(), op);
+    }
+};
+
 /**
  *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__SYRKEXECUTOR"></a>
  *  \brief Adapter for SYRK routine
@@ -278,6 +364,7 @@ public:
 } // namespace interface1
 
 using interface1::GemmExecutor;
+using interface1::GemmBatchExecutor;
 using interface1::SyrkExecutor;
 using interface1::AxpyExecutor;
 
@@ -143,11 +143,114 @@ public:
     }
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__POTRFBATCHEXECUTOR"></a>
+ *  \brief Adapter for strided batched POTRF routine
+ */
+class PotrfBatchExecutor
+{
+private:
+    struct Execute
+    {
+        const math::UpLo uplo;
+        const size_t n;
+        UniversalBuffer & a_buffer;
+        const size_t lda;
+        const size_t strideA;
+        const size_t batchSize;
+        services::Status * status;
+
+        explicit Execute(const math::UpLo uplo, const size_t n, UniversalBuffer & a_buffer, const size_t lda, const size_t strideA,
+                         const size_t batchSize, services::Status * status)
+            : uplo(uplo), n(n), a_buffer(a_buffer), lda(lda), strideA(strideA), batchSize(batchSize), status(status)
+        {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            auto a_buffer_t = a_buffer.template get<T>();
+
+            /* Small matrices are factorized by the device kernels in both configurations */
+            ReferencePotrfBatch<T> functor;
+
+            services::internal::tryAssignStatus(status, functor(uplo, n, a_buffer_t, lda, strideA, batchSize));
+        }
+    };
+
+public:
+    static void run(cl::sycl::queue & queue, const math::UpLo uplo, const size_t n, UniversalBuffer & a_buffer, const size_t lda,
+                    const size_t strideA, const size_t batchSize, services::Status * status)
+    {
+        Execute op(uplo, n, a_buffer, lda, strideA, batchSize, status);
+        TypeDispatcher::floatDispatch(a_buffer.type(), op);
+    }
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__POTRSBATCHEXECUTOR"></a>
+ *  \brief Adapter for strided batched POTRS routine
+ */
+class PotrsBatchExecutor
+{
+private:
+    struct Execute
+    {
+        const math::UpLo uplo;
+        const size_t n;
+        const size_t ny;
+        UniversalBuffer & a_buffer;
+        const size_t lda;
+        const size_t strideA;
+        UniversalBuffer & b_buffer;
+        const size_t ldb;
+        const size_t strideB;
+        const size_t batchSize;
+        services::Status * status;
+
+        explicit Execute(const math::UpLo uplo, const size_t n, const size_t ny, UniversalBuffer & a_buffer, const size_t lda, const size_t strideA,
+                         UniversalBuffer & b_buffer, const size_t ldb, const size_t strideB, const size_t batchSize, services::Status * status)
+            : uplo(uplo),
+              n(n),
+              ny(ny),
+              a_buffer(a_buffer),
+              lda(lda),
+              strideA(strideA),
+              b_buffer(b_buffer),
+              ldb(ldb),
+              strideB(strideB),
+              batchSize(batchSize),
+              status(status)
+        {}
+
+        template <typename T>
+        void operator()(Typelist<T>)
+        {
+            auto a_buffer_t = a_buffer.template get<T>();
+            auto b_buffer_t = b_buffer.template get<T>();
+
+            ReferencePotrsBatch<T> functor;
+
+            services::internal::tryAssignStatus(status, functor(uplo, n, ny, a_buffer_t, lda, strideA, b_buffer_t, ldb, strideB, batchSize));
+        }
+    };
+
+public:
+    static void run(cl::sycl::queue & queue, const math::UpLo uplo, const size_t n, const size_t ny, UniversalBuffer & a_buffer, const size_t lda,
+                    const size_t strideA, UniversalBuffer & b_buffer, const size_t ldb, const size_t strideB, const size_t batchSize,
+                    services::Status * status)
+    {
+        Execute op(uplo, n, ny, a_buffer, lda, strideA, b_buffer, ldb, strideB, batchSize, status);
+        TypeDispatcher::floatDispatch(a_buffer.type(), op);
+    }
+};
+
 /** @} */
 } // namespace interface1
 
 using interface1::PotrfExecutor;
 using interface1::PotrsExecutor;
+using interface1::PotrfBatchExecutor;
+using interface1::PotrsBatchExecutor;
 
 } // namespace math
 } // namespace internal
@@ -95,6 +95,66 @@ private:
     cl::sycl::queue & _queue;
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__MKLGEMMBATCH"></a>
+ *  \brief Adapter for MKL strided batched GEMM routine. The products are submitted to the queue one by one
+ *         with the offsets of the matrices, the queue is waited once for the whole batch
+ */
+template <typename algorithmFPType>
+struct MKLGemmBatch
+{
+    MKLGemmBatch(cl::sycl::queue & queue) : _queue(queue) {}
+
+    services::Status operator()(const math::Transpose transa, const math::Transpose transb, const size_t m, const size_t n, const size_t k,
+                                const algorithmFPType alpha, const services::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                const size_t strideA, const services::Buffer<algorithmFPType> & b_buffer, const size_t ldb, const size_t strideB,
+                                const algorithmFPType beta, services::Buffer<algorithmFPType> & c_buffer, const size_t ldc, const size_t strideC,
+                                const size_t batchSize)
+    {
+        services::Status status;
+
+        const MKL_TRANSPOSE transamkl = transa == math::Transpose::Trans ? MKL_TRANS : MKL_NOTRANS;
+        const MKL_TRANSPOSE transbmkl = transb == math::Transpose::Trans ? MKL_TRANS : MKL_NOTRANS;
+
+        cl::sycl::buffer<algorithmFPType, 1> a_sycl_buff = a_buffer.toSycl();
+        cl::sycl::buffer<algorithmFPType, 1> b_sycl_buff = b_buffer.toSycl();
+        cl::sycl::buffer<algorithmFPType, 1> c_sycl_buff = c_buffer.toSycl();
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            innerGemm(transamkl, transbmkl, m, n, k, alpha, a_sycl_buff, lda, b_sycl_buff, ldb, beta, c_sycl_buff, ldc, i * strideA, i * strideB,
+                      i * strideC);
+        }
+
+        _queue.wait();
+        return status;
+    }
+
+private:
+    template <typename T>
+    void innerGemm(MKL_TRANSPOSE transa, MKL_TRANSPOSE transb, int64_t m, int64_t n, int64_t k, T alpha, cl::sycl::buffer<T, 1> a, int64_t lda,
+                   cl::sycl::buffer<T, 1> b, int64_t ldb, T beta, cl::sycl::buffer<T, 1> c, int64_t ldc, int64_t offset_a, int64_t offset_b,
+                   int64_t offset_c);
+
+    template <>
+    void innerGemm<double>(MKL_TRANSPOSE transa, MKL_TRANSPOSE transb, int64_t m, int64_t n, int64_t k, double alpha, cl::sycl::buffer<double, 1> a,
+                           int64_t lda, cl::sycl::buffer<double, 1> b, int64_t ldb, double beta, cl::sycl::buffer<double, 1> c, int64_t ldc,
+                           int64_t offset_a, int64_t offset_b, int64_t offset_c)
+    {
+        fpk::gpu::dgemm_sycl(&_queue, transa, transb, m, n, k, alpha, &a, lda, &b, ldb, beta, &c, ldc, offset_a, offset_b, offset_c);
+    }
+
+    template <>
+    void innerGemm<float>(MKL_TRANSPOSE transa, MKL_TRANSPOSE transb, int64_t m, int64_t n, int64_t k, float alpha, cl::sycl::buffer<float, 1> a,
+                          int64_t lda, cl::sycl::buffer<float, 1> b, int64_t ldb, float beta, cl::sycl::buffer<float, 1> c, int64_t ldc,
+                          int64_t offset_a, int64_t offset_b, int64_t offset_c)
+    {
+        fpk::gpu::sgemm_sycl(&_queue, transa, transb, m, n, k, alpha, &a, lda, &b, ldb, beta, &c, ldc, offset_a, offset_b, offset_c);
+    }
+
+    cl::sycl::queue & _queue;
+};
+
 /**
  *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__MKLSYRK"></a>
  *  \brief Adapter for MKL SYRK routine
@@ -174,6 +234,7 @@ private:
 } // namespace interface1
 
 using interface1::MKLGemm;
+using interface1::MKLGemmBatch;
 using interface1::MKLSyrk;
 
 } // namespace math
@@ -58,10 +58,28 @@ struct DAAL_EXPORT ReferenceGemm
                                 const algorithmFPType beta, services::Buffer<algorithmFPType> & c_buffer, const size_t ldc, const size_t offsetC);
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__REFERENCEGEMMBATCH"></a>
+ *  \brief Adapter for reference strided batched GEMM routine, the matrices of the i-th product
+ *         start at the offsets i * strideA, i * strideB and i * strideC in the buffers
+ */
+template <typename algorithmFPType>
+struct DAAL_EXPORT ReferenceGemmBatch
+{
+    ReferenceGemmBatch() {}
+
+    services::Status operator()(const math::Transpose transa, const math::Transpose transb, const size_t m, const size_t n, const size_t k,
+                                const algorithmFPType alpha, const services::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                const size_t strideA, const services::Buffer<algorithmFPType> & b_buffer, const size_t ldb, const size_t strideB,
+                                const algorithmFPType beta, services::Buffer<algorithmFPType> & c_buffer, const size_t ldc, const size_t strideC,
+                                const size_t batchSize);
+};
+
 /** @} */
 } // namespace interface1
 
 using interface1::ReferenceGemm;
+using interface1::ReferenceGemmBatch;
 
 } // namespace math
 } // namespace internal
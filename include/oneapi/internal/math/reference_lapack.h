@@ -68,11 +68,42 @@ struct DAAL_EXPORT ReferencePotrs
                                 const size_t lda, services::Buffer<algorithmFPType> & b_buffer, const size_t ldb);
 };
 
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__REFERENCEPOTRFBATCH"></a>
+ *  \brief Adapter for reference strided batched POTRF routine, the i-th matrix starts at the offset i * strideA in the buffer.
+ *         The matrices are factorized on the device by one work-group per matrix
+ */
+template <typename algorithmFPType>
+struct DAAL_EXPORT ReferencePotrfBatch
+{
+    ReferencePotrfBatch() {}
+
+    services::Status operator()(const math::UpLo uplo, const size_t n, services::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                const size_t strideA, const size_t batchSize);
+};
+
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__REFERENCEPOTRSBATCH"></a>
+ *  \brief Adapter for reference strided batched POTRS routine, the i-th system uses the factor at the offset i * strideA
+ *         and the right-hand sides at the offset i * strideB
+ */
+template <typename algorithmFPType>
+struct DAAL_EXPORT ReferencePotrsBatch
+{
+    ReferencePotrsBatch() {}
+
+    services::Status operator()(const math::UpLo uplo, const size_t n, const size_t ny, services::Buffer<algorithmFPType> & a_buffer,
+                                const size_t lda, const size_t strideA, services::Buffer<algorithmFPType> & b_buffer, const size_t ldb,
+                                const size_t strideB, const size_t batchSize);
+};
+
 /** @} */
 } // namespace interface1
 
 using interface1::ReferencePotrf;
 using interface1::ReferencePotrs;
+using interface1::ReferencePotrfBatch;
+using interface1::ReferencePotrsBatch;
 
 } // namespace math
 } // namespace internal
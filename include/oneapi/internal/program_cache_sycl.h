@@ -0,0 +1,236 @@
+/* file: program_cache_sycl.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef DAAL_SYCL_INTERFACE
+    #ifndef __DAAL_ONEAPI_INTERNAL_PROGRAM_CACHE_SYCL_H__
+        #define __DAAL_ONEAPI_INTERNAL_PROGRAM_CACHE_SYCL_H__
+
+        #include <CL/cl.h>
+        #include <cstdint>
+        #include <cstdio>
+        #include <cstring>
+        #include <random>
+        #include <string>
+        #include <vector>
+
+        #include "services/library_version_info.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace interface1
+{
+/**
+ *  <a name="DAAL-CLASS-ONEAPI-INTERNAL__OPENCLPROGRAMCACHE"></a>
+ *  \brief Persistent cache of the binaries of the OpenCL* programs built for a device
+ *
+ *  The binary of a program is stored in the file <directory>/<device>_<program>.clbin, where <device> is the hash
+ *  of the name, vendor and driver version of the device and of the version of the library, and <program> is the hash
+ *  of the source and of the build options of the program. The file <directory>/<device>.clidx lists the programs
+ *  cached for the device together with their names in the kernel factory and their build options.
+ *
+ *  Failures to read or to write the files are not reported: the programs are compiled from the sources in that case.
+ */
+class OpenClProgramCache
+{
+public:
+    struct Entry
+    {
+        std::string programKey;
+        std::string programName;
+        std::string options;
+    };
+
+    /**
+     *  Enables the cache in the directory, the empty directory disables the cache
+     *  \param[in] directory  Directory with the cached binaries, it has to exist
+     *  \param[in] clDevice   Device the programs are built for
+     */
+    void setDirectory(const char * directory, cl_device_id clDevice)
+    {
+        _directory = directory ? directory : "";
+        _deviceKey.clear();
+        if (_directory.empty()) return;
+
+        std::string fingerprint = getDeviceInfo(clDevice, CL_DEVICE_NAME);
+        fingerprint += '\n' + getDeviceInfo(clDevice, CL_DEVICE_VENDOR);
+        fingerprint += '\n' + getDeviceInfo(clDevice, CL_DRIVER_VERSION);
+        fingerprint += '\n' + std::to_string(__INTEL_DAAL__) + '.' + std::to_string(__INTEL_DAAL_MINOR__);
+        fingerprint += '.' + std::to_string(__INTEL_DAAL_UPDATE__);
+        _deviceKey = toHex(hash(fingerprint.c_str(), fingerprint.size()));
+    }
+
+    bool isEnabled() const { return !_directory.empty(); }
+
+    std::string getProgramKey(const char * programSrc, const char * options) const
+    {
+        /* The source and the options are separated by the zero byte so that their boundary is part of the key */
+        const uint64_t sourceHash = hash(programSrc, std::strlen(programSrc) + 1);
+        return toHex(hash(options, std::strlen(options), sourceHash));
+    }
+
+    /**
+     *  Reads the binary of the program
+     *  \return false if the binary of the program is not cached
+     */
+    bool load(const std::string & programKey, std::vector<unsigned char> & binary) const
+    {
+        FILE * file = std::fopen(getBinaryFileName(programKey).c_str(), "rb");
+        if (!file) return false;
+
+        bool isRead     = (std::fseek(file, 0, SEEK_END) == 0);
+        const long size = isRead ? std::ftell(file) : 0;
+        isRead          = (size > 0 && std::fseek(file, 0, SEEK_SET) == 0);
+        if (isRead)
+        {
+            binary.resize(size);
+            isRead = (std::fread(binary.data(), 1, binary.size(), file) == binary.size());
+        }
+        std::fclose(file);
+        return isRead;
+    }
+
+    /**
+     *  Writes the binary of the built program to the cache and adds the program to the index of the device
+     */
+    void store(cl_program clProgram, const std::string & programKey, const char * programName, const char * options) const
+    {
+        size_t size = 0;
+        if (clGetProgramInfo(clProgram, CL_PROGRAM_BINARY_SIZES, sizeof(size), &size, nullptr) != CL_SUCCESS || size == 0) return;
+
+        std::vector<unsigned char> binary(size);
+        unsigned char * binaries[] = { binary.data() };
+        if (clGetProgramInfo(clProgram, CL_PROGRAM_BINARIES, sizeof(binaries), binaries, nullptr) != CL_SUCCESS) return;
+
+        /* The binary is renamed after it is written, so that the processes sharing the cache never read a partially written file */
+        std::random_device randomDevice;
+        const std::string fileName    = getBinaryFileName(programKey);
+        const std::string tmpFileName = fileName + '.' + toHex((uint64_t(randomDevice()) << 32) | randomDevice());
+
+        FILE * file = std::fopen(tmpFileName.c_str(), "wb");
+        if (!file) return;
+
+        const bool isWritten = (std::fwrite(binary.data(), 1, size, file) == size);
+        if (std::fclose(file) != 0 || !isWritten || replaceFile(tmpFileName, fileName) != 0)
+        {
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+
+        FILE * index = std::fopen(getIndexFileName().c_str(), "a");
+        if (!index) return;
+        std::fprintf(index, "%s\t%s\t%s\n", programKey.c_str(), programName, options);
+        std::fclose(index);
+    }
+
+    /**
+     *  Reads the index of the programs cached for the device, the later entries for the same program name come last
+     */
+    void readIndex(std::vector<Entry> & entries) const
+    {
+        entries.clear();
+        if (!isEnabled()) return;
+
+        FILE * index = std::fopen(getIndexFileName().c_str(), "r");
+        if (!index) return;
+
+        std::string line;
+        for (int c = std::fgetc(index); c != EOF; c = std::fgetc(index))
+        {
+            if (c != '\n')
+            {
+                line += char(c);
+                continue;
+            }
+
+            const size_t first  = line.find('\t');
+            const size_t second = (first == std::string::npos) ? first : line.find('\t', first + 1);
+            if (second != std::string::npos)
+            {
+                Entry entry;
+                entry.programKey  = line.substr(0, first);
+                entry.programName = line.substr(first + 1, second - first - 1);
+                entry.options     = line.substr(second + 1);
+                entries.push_back(entry);
+            }
+            line.clear();
+        }
+        std::fclose(index);
+    }
+
+private:
+    static std::string getDeviceInfo(cl_device_id clDevice, cl_device_info param)
+    {
+        size_t size = 0;
+        if (clGetDeviceInfo(clDevice, param, 0, nullptr, &size) != CL_SUCCESS || size == 0) return std::string();
+
+        std::vector<char> value(size);
+        if (clGetDeviceInfo(clDevice, param, size, value.data(), nullptr) != CL_SUCCESS) return std::string();
+        return std::string(value.data());
+    }
+
+    /* 64-bit FNV-1a hash */
+    static uint64_t hash(const char * data, size_t size, uint64_t seed = 14695981039346656037ULL)
+    {
+        uint64_t result = seed;
+        for (size_t i = 0; i < size; i++)
+        {
+            result ^= (unsigned char)data[i];
+            result *= 1099511628211ULL;
+        }
+        return result;
+    }
+
+    static std::string toHex(uint64_t value)
+    {
+        char buffer[17];
+        std::snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)value);
+        return std::string(buffer);
+    }
+
+    /* std::rename() does not replace the existing files on Windows*, the file written by another process is as good as ours */
+    static int replaceFile(const std::string & from, const std::string & to)
+    {
+        if (std::rename(from.c_str(), to.c_str()) == 0) return 0;
+        FILE * existing = std::fopen(to.c_str(), "rb");
+        if (!existing) return -1;
+        std::fclose(existing);
+        std::remove(from.c_str());
+        return 0;
+    }
+
+    std::string getBinaryFileName(const std::string & programKey) const { return _directory + '/' + _deviceKey + '_' + programKey + ".clbin"; }
+
+    std::string getIndexFileName() const { return _directory + '/' + _deviceKey + ".clidx"; }
+
+    std::string _directory;
+    std::string _deviceKey;
+};
+
+} // namespace interface1
+
+using interface1::OpenClProgramCache;
+
+} // namespace internal
+} // namespace oneapi
+} // namespace daal
+
+    #endif
+#endif // DAAL_SYCL_INTERFACE
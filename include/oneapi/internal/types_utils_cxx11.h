@@ -127,7 +127,7 @@ private:
         template <typename T>
         void operator()(Typelist<T>)
         {
-            auto src              = (T *)srcArray;
+            auto src              = (T *)srcArray + srcOffset;
             auto dst              = dstUnivers.get<T>().toSycl();
             cl::sycl::event event = queue.submit([&](cl::sycl::handler & cgh) {
                 auto dst_acc = dst.template get_access<cl::sycl::access::mode::write>(cgh, cl::sycl::range<1>(count), cl::sycl::id<1>(dstOffset));
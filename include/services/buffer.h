@@ -143,6 +143,12 @@ public:
         }
         return internal::SyclBufferConverter<T>().toSycl(*_impl);
     }
+
+    /**
+     *  Returns true if the buffer references a SYCL* buffer. For the other buffers toSycl() creates a new SYCL* buffer
+     *  that writes the modified data back to the memory of the buffer only when that SYCL* buffer is destroyed
+     */
+    inline bool isSyclBuffer() const { return _impl && internal::SyclBufferConverter<T>().isSyclBuffer(*_impl); }
 #endif
 
 #ifdef DAAL_SYCL_INTERFACE_USM
@@ -198,6 +204,10 @@ public:
     }
 
 private:
+#ifdef DAAL_SYCL_INTERFACE
+    friend class internal::PooledSyclBufferFactory<T>;
+#endif
+
     explicit Buffer(internal::BufferIface<T> * impl) : _impl(impl) {}
     explicit Buffer(const SharedPtr<internal::BufferIface<T> > & impl) : _impl(impl) {}
 
@@ -209,6 +219,22 @@ private:
 
 using interface1::Buffer;
 
+#ifdef DAAL_SYCL_INTERFACE
+namespace internal
+{
+template <typename T>
+class PooledSyclBufferFactory
+{
+public:
+    /* Creates the buffer of the given size that views the beginning of the pool entry */
+    static Buffer<T> create(const cl::sycl::buffer<T, 1> & entryBuffer, size_t size, const SharedPtr<Base> & lease)
+    {
+        return Buffer<T>(new PooledSyclBuffer<T>(entryBuffer, 0, size, lease));
+    }
+};
+} // namespace internal
+#endif
+
 } // namespace services
 } // namespace daal
 
@@ -0,0 +1,659 @@
+/* file: communicator.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface of the communicator used by the SPMD computations
+//--
+*/
+
+#ifndef __DAAL_COMMUNICATOR_H__
+#define __DAAL_COMMUNICATOR_H__
+
+#include "services/daal_defines.h"
+#include "services/base.h"
+#include "services/collection.h"
+#include "services/daal_shared_ptr.h"
+#include "services/error_handling.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_archive.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+union FloatBits
+{
+    float f;
+    unsigned int u;
+};
+
+/**
+ * Converts the float value to the IEEE 754 half precision with rounding to the nearest even
+ */
+inline unsigned short floatToFloat16(float value)
+{
+    FloatBits x;
+    x.f                     = value;
+    const unsigned int sign = x.u & 0x80000000u;
+    x.u ^= sign;
+
+    unsigned int h;
+    if (x.u >= 0x47800000u)
+    {
+        /* Overflow to infinity or NaN */
+        h = (x.u > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+    }
+    else if (x.u < 0x38800000u)
+    {
+        /* Subnormal half or zero, the addition of 0.5f rounds the mantissa */
+        FloatBits magic;
+        magic.u = 0x3f000000u;
+        x.f += magic.f;
+        h = x.u - magic.u;
+    }
+    else
+    {
+        const unsigned int mantissaOdd = (x.u >> 13) & 1u;
+        x.u += 0xc8000fffu + mantissaOdd;
+        h = x.u >> 13;
+    }
+    return (unsigned short)(h | (sign >> 16));
+}
+
+/**
+ * Converts the IEEE 754 half precision value to float
+ */
+inline float float16ToFloat(unsigned short value)
+{
+    const unsigned int shiftedExponent = 0x7c00u << 13;
+    FloatBits x;
+    x.u                         = (unsigned int)(value & 0x7fffu) << 13;
+    const unsigned int exponent = x.u & shiftedExponent;
+    x.u += (127u - 15u) << 23;
+    if (exponent == shiftedExponent)
+    {
+        /* Infinity or NaN */
+        x.u += (128u - 16u) << 23;
+    }
+    else if (exponent == 0)
+    {
+        /* Zero or subnormal */
+        FloatBits magic;
+        magic.u = 113u << 23;
+        x.u += 1u << 23;
+        x.f -= magic.f;
+    }
+    x.u |= (unsigned int)(value & 0x8000u) << 16;
+    return x.f;
+}
+
+/**
+ * Converts the float value to bfloat16 with rounding to the nearest even
+ */
+inline unsigned short floatToBfloat16(float value)
+{
+    FloatBits x;
+    x.f = value;
+    if ((x.u & 0x7fffffffu) > 0x7f800000u)
+    {
+        return (unsigned short)((x.u >> 16) | 0x40u);
+    }
+    x.u += 0x7fffu + ((x.u >> 16) & 1u);
+    return (unsigned short)(x.u >> 16);
+}
+
+/**
+ * Converts the bfloat16 value to float
+ */
+inline float bfloat16ToFloat(unsigned short value)
+{
+    FloatBits x;
+    x.u = (unsigned int)value << 16;
+    return x.f;
+}
+} // namespace internal
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ *  <a name="DAAL-CLASS-SERVICES__REQUESTIFACE"></a>
+ *  \brief Abstract class which defines the handle of a collective operation posted by a non-blocking method of CommunicatorIface
+ */
+class RequestIface : public Base
+{
+public:
+    virtual ~RequestIface() {}
+
+    /**
+     * Waits for the completion of the operation, the buffers of the operation may be accessed only after this method returns
+     * \return Status of the operation
+     */
+    virtual Status wait() = 0;
+};
+typedef SharedPtr<RequestIface> RequestIfacePtr;
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__COMPLETEDREQUEST"></a>
+ *  \brief Handle of the operation that has completed when it was posted, returned by the default non-blocking methods of CommunicatorIface
+ */
+class CompletedRequest : public RequestIface
+{
+public:
+    CompletedRequest(const Status & status) : _status(status) {}
+
+    Status wait() DAAL_C11_OVERRIDE { return _status; }
+
+private:
+    Status _status;
+};
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__COMMUNICATORIFACE"></a>
+ *  \brief Abstract class which defines the collective operations over the processes that run the SPMD computations.
+ *         Every process runs the same algorithm on its own block of data, the partial results are combined by the collective
+ *         operations on the numeric buffers, so that no process gathers the partial results of the others.
+ *         The implementation is provided by the application, for example on top of MPI
+ */
+class CommunicatorIface : public Base
+{
+public:
+    /**
+     * Operations supported by allreduce()
+     */
+    enum ReduceOp
+    {
+        sum, /*!< Sum of the values */
+        min, /*!< Minimum of the values */
+        max  /*!< Maximum of the values */
+    };
+
+    /**
+     * Precisions of the values sent by the collective operations
+     */
+    enum TransportPrecision
+    {
+        fullPrecision,    /*!< Values are sent in the precision of the computations */
+        float16Precision, /*!< Values are sent in the IEEE 754 half precision, the magnitude of the values must not exceed 65504 */
+        bfloat16Precision /*!< Values are sent in the bfloat16 format with the range of float and 8 bits of the mantissa */
+    };
+
+    virtual ~CommunicatorIface() {}
+
+    /**
+     * Returns the index of the calling process
+     * \return Index of the calling process in the range [0, getSize())
+     */
+    virtual size_t getRank() const = 0;
+
+    /**
+     * Returns the number of processes
+     * \return Number of processes
+     */
+    virtual size_t getSize() const = 0;
+
+    /**
+     * Reduces the buffers of all the processes element-wise and stores the result in the buffer of every process
+     * \param[in,out] buffer  Buffer of count elements
+     * \param[in]     count   Number of elements in the buffer
+     * \param[in]     op      Reduction operation
+     * \return Status of computations
+     */
+    virtual Status allreduce(double * buffer, size_t count, ReduceOp op) = 0;
+
+    /**
+     * \copydoc allreduce(double *, size_t, ReduceOp)
+     */
+    virtual Status allreduce(float * buffer, size_t count, ReduceOp op) = 0;
+
+    /**
+     * Reduces the buffers of the 16-bit values of all the processes element-wise and stores the result in the buffer of every process.
+     * The default implementation widens the values to float and calls allreduce(float *, size_t, ReduceOp), so the amount of the sent data
+     * is not reduced. Override it to reduce the 16-bit values in the transport layer, for example by the user-defined MPI operation
+     * \param[in,out] buffer     Buffer of count 16-bit values
+     * \param[in]     count      Number of elements in the buffer
+     * \param[in]     op         Reduction operation
+     * \param[in]     precision  Format of the values, float16Precision or bfloat16Precision
+     * \return Status of computations
+     */
+    virtual Status allreduce(unsigned short * buffer, size_t count, ReduceOp op, TransportPrecision precision);
+
+    /**
+     * Gathers the buffers of the same size of all the processes in the order of the ranks
+     * \param[in]  sendBuffer  Buffer of the calling process
+     * \param[in]  nBytes      Size of the buffer of one process in bytes
+     * \param[out] recvBuffer  Buffer of size nBytes * getSize() bytes that receives the buffers of all the processes
+     * \return Status of computations
+     */
+    virtual Status allgather(const byte * sendBuffer, size_t nBytes, byte * recvBuffer) = 0;
+
+    /**
+     * Sends the buffer of the root process to all the processes
+     * \param[in,out] buffer  Buffer of nBytes bytes
+     * \param[in]     nBytes  Size of the buffer in bytes
+     * \param[in]     root    Index of the process that sends the buffer
+     * \return Status of computations
+     */
+    virtual Status bcast(byte * buffer, size_t nBytes, size_t root) = 0;
+
+    /**
+     * Sends the parts of the buffer of the calling process to the processes, the part i is sent to the process i.
+     * The parts are stored contiguously in the order of the ranks. The default implementation gathers the whole send buffers
+     * of all the processes by allgather() and keeps the parts addressed to the calling process, override it to send only these parts,
+     * for example by MPI_Alltoallv
+     * \param[in]  sendBuffer  Buffer of the calling process
+     * \param[in]  sendSizes   Array of getSize() sizes in bytes of the parts sent to the processes
+     * \param[out] recvBuffer  Buffer that receives the parts sent to the calling process in the order of the ranks
+     * \param[in]  recvSizes   Array of getSize() sizes in bytes of the parts received from the processes
+     * \return Status of computations
+     */
+    virtual Status alltoallv(const byte * sendBuffer, const size_t * sendSizes, byte * recvBuffer, const size_t * recvSizes);
+
+    /**
+     * Posts the reduction of the buffers of all the processes and returns without waiting for its completion.
+     * The default implementation calls the blocking allreduce(double *, size_t, ReduceOp), override it to overlap
+     * the communication with the computations, for example by MPI_Iallreduce
+     * \param[in,out] buffer  Buffer of count elements, it must not be accessed until the returned request completes
+     * \param[in]     count   Number of elements in the buffer
+     * \param[in]     op      Reduction operation
+     * \return Handle of the posted operation
+     */
+    virtual RequestIfacePtr iallreduce(double * buffer, size_t count, ReduceOp op)
+    {
+        return RequestIfacePtr(new CompletedRequest(allreduce(buffer, count, op)));
+    }
+
+    /**
+     * \copydoc iallreduce(double *, size_t, ReduceOp)
+     */
+    virtual RequestIfacePtr iallreduce(float * buffer, size_t count, ReduceOp op)
+    {
+        return RequestIfacePtr(new CompletedRequest(allreduce(buffer, count, op)));
+    }
+
+    /**
+     * Posts the gathering of the buffers of all the processes and returns without waiting for its completion.
+     * The default implementation calls the blocking allgather()
+     * \param[in]  sendBuffer  Buffer of the calling process
+     * \param[in]  nBytes      Size of the buffer of one process in bytes
+     * \param[out] recvBuffer  Buffer of size nBytes * getSize() bytes, it must not be accessed until the returned request completes
+     * \return Handle of the posted operation
+     */
+    virtual RequestIfacePtr iallgather(const byte * sendBuffer, size_t nBytes, byte * recvBuffer)
+    {
+        return RequestIfacePtr(new CompletedRequest(allgather(sendBuffer, nBytes, recvBuffer)));
+    }
+};
+typedef SharedPtr<CommunicatorIface> CommunicatorIfacePtr;
+
+inline Status CommunicatorIface::allreduce(unsigned short * buffer, size_t count, ReduceOp op, TransportPrecision precision)
+{
+    Collection<float> values(count);
+    DAAL_CHECK_MALLOC(values.data() || !count);
+    for (size_t i = 0; i < count; i++)
+    {
+        values[i] = (precision == float16Precision) ? internal::float16ToFloat(buffer[i]) : internal::bfloat16ToFloat(buffer[i]);
+    }
+    Status s;
+    DAAL_CHECK_STATUS(s, allreduce(values.data(), count, op));
+    for (size_t i = 0; i < count; i++)
+    {
+        buffer[i] = (precision == float16Precision) ? internal::floatToFloat16(values[i]) : internal::floatToBfloat16(values[i]);
+    }
+    return s;
+}
+inline Status CommunicatorIface::alltoallv(const byte * sendBuffer, const size_t * sendSizes, byte * recvBuffer, const size_t * recvSizes)
+{
+    const size_t nProcesses = getSize();
+    const size_t rank       = getRank();
+
+    Collection<size_t> allSendSizes(nProcesses * nProcesses);
+    DAAL_CHECK_MALLOC(allSendSizes.data());
+    Status s;
+    DAAL_CHECK_STATUS(s, allgather((const byte *)sendSizes, nProcesses * sizeof(size_t), (byte *)allSendSizes.data()));
+
+    size_t maxSize = 0;
+    for (size_t i = 0; i < nProcesses; i++)
+    {
+        size_t size = 0;
+        for (size_t j = 0; j < nProcesses; j++)
+        {
+            size += allSendSizes[i * nProcesses + j];
+        }
+        maxSize = (size > maxSize) ? size : maxSize;
+    }
+    if (!maxSize) return s;
+
+    size_t sendSize = 0;
+    for (size_t j = 0; j < nProcesses; j++)
+    {
+        sendSize += sendSizes[j];
+    }
+    Collection<byte> buffer(maxSize);
+    Collection<byte> allBuffers(maxSize * nProcesses);
+    DAAL_CHECK_MALLOC(buffer.data() && allBuffers.data());
+    for (size_t j = 0; j < sendSize; j++)
+    {
+        buffer[j] = sendBuffer[j];
+    }
+    DAAL_CHECK_STATUS(s, allgather(buffer.data(), maxSize, allBuffers.data()));
+
+    size_t recvOffset = 0;
+    for (size_t i = 0; i < nProcesses; i++)
+    {
+        size_t offset = 0;
+        for (size_t j = 0; j < rank; j++)
+        {
+            offset += allSendSizes[i * nProcesses + j];
+        }
+        DAAL_CHECK(allSendSizes[i * nProcesses + rank] == recvSizes[i], ErrorIncorrectSizeOfArray);
+        const byte * part = allBuffers.data() + i * maxSize + offset;
+        for (size_t j = 0; j < recvSizes[i]; j++)
+        {
+            recvBuffer[recvOffset + j] = part[j];
+        }
+        recvOffset += recvSizes[i];
+    }
+    return s;
+}
+} // namespace interface1
+using interface1::RequestIface;
+using interface1::RequestIfacePtr;
+using interface1::CompletedRequest;
+using interface1::CommunicatorIface;
+using interface1::CommunicatorIfacePtr;
+
+namespace internal
+{
+inline unsigned short encodeValue(float value, CommunicatorIface::TransportPrecision precision)
+{
+    return (precision == CommunicatorIface::float16Precision) ? floatToFloat16(value) : floatToBfloat16(value);
+}
+
+inline float decodeValue(unsigned short value, CommunicatorIface::TransportPrecision precision)
+{
+    return (precision == CommunicatorIface::float16Precision) ? float16ToFloat(value) : bfloat16ToFloat(value);
+}
+
+/**
+ * Returns the size in bytes of one value sent in the given precision
+ */
+template <typename algorithmFPType>
+size_t transportValueSize(CommunicatorIface::TransportPrecision precision)
+{
+    return (precision == CommunicatorIface::fullPrecision) ? sizeof(algorithmFPType) : sizeof(unsigned short);
+}
+
+/**
+ * Writes the values in the given precision into the byte buffer of n * transportValueSize() bytes
+ */
+template <typename algorithmFPType>
+void encodeValues(const algorithmFPType * values, size_t n, CommunicatorIface::TransportPrecision precision, byte * dst)
+{
+    if (precision == CommunicatorIface::fullPrecision)
+    {
+        algorithmFPType * dstValues = (algorithmFPType *)dst;
+        for (size_t i = 0; i < n; i++)
+        {
+            dstValues[i] = values[i];
+        }
+        return;
+    }
+    unsigned short * dstValues = (unsigned short *)dst;
+    for (size_t i = 0; i < n; i++)
+    {
+        dstValues[i] = encodeValue((float)values[i], precision);
+    }
+}
+
+/**
+ * Reads the values written by encodeValues()
+ */
+template <typename algorithmFPType>
+void decodeValues(const byte * src, size_t n, CommunicatorIface::TransportPrecision precision, algorithmFPType * values)
+{
+    if (precision == CommunicatorIface::fullPrecision)
+    {
+        const algorithmFPType * srcValues = (const algorithmFPType *)src;
+        for (size_t i = 0; i < n; i++)
+        {
+            values[i] = srcValues[i];
+        }
+        return;
+    }
+    const unsigned short * srcValues = (const unsigned short *)src;
+    for (size_t i = 0; i < n; i++)
+    {
+        values[i] = (algorithmFPType)decodeValue(srcValues[i], precision);
+    }
+}
+
+/**
+ * Rounds the values to the given precision in place, so that the values are not changed by the transport
+ */
+template <typename algorithmFPType>
+void roundValues(algorithmFPType * values, size_t n, CommunicatorIface::TransportPrecision precision)
+{
+    if (precision == CommunicatorIface::fullPrecision) return;
+    for (size_t i = 0; i < n; i++)
+    {
+        values[i] = (algorithmFPType)decodeValue(encodeValue((float)values[i], precision), precision);
+    }
+}
+
+/**
+ * Reduces the buffer over all the processes, the values are sent in the given precision
+ */
+template <typename algorithmFPType>
+Status allreduceBuffer(CommunicatorIface & comm, algorithmFPType * buffer, size_t count, CommunicatorIface::ReduceOp op,
+                       CommunicatorIface::TransportPrecision precision)
+{
+    if (precision == CommunicatorIface::fullPrecision)
+    {
+        return comm.allreduce(buffer, count, op);
+    }
+
+    Collection<unsigned short> encoded(count);
+    DAAL_CHECK_MALLOC(encoded.data() || !count);
+    for (size_t i = 0; i < count; i++)
+    {
+        encoded[i] = encodeValue((float)buffer[i], precision);
+    }
+    Status s;
+    DAAL_CHECK_STATUS(s, comm.allreduce(encoded.data(), count, op, precision));
+    for (size_t i = 0; i < count; i++)
+    {
+        buffer[i] = (algorithmFPType)decodeValue(encoded[i], precision);
+    }
+    return s;
+}
+
+/**
+ * Reduces the values of the numeric tables over all the processes.
+ * The tables are packed into one buffer, so that one collective call is done
+ */
+template <typename algorithmFPType>
+Status allreduceTables(CommunicatorIface & comm, data_management::NumericTable * const * tables, size_t nTables, CommunicatorIface::ReduceOp op,
+                       CommunicatorIface::TransportPrecision precision = CommunicatorIface::fullPrecision)
+{
+    size_t size = 0;
+    for (size_t i = 0; i < nTables; i++)
+    {
+        size += tables[i]->getNumberOfRows() * tables[i]->getNumberOfColumns();
+    }
+
+    Collection<algorithmFPType> buffer(size);
+    DAAL_CHECK_MALLOC(buffer.data() || !size);
+
+    Status s;
+    size_t offset = 0;
+    for (size_t i = 0; i < nTables; i++)
+    {
+        const size_t nRows = tables[i]->getNumberOfRows();
+        const size_t n     = nRows * tables[i]->getNumberOfColumns();
+        data_management::BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(s, tables[i]->getBlockOfRows(0, nRows, data_management::readOnly, block));
+        const algorithmFPType * values = block.getBlockPtr();
+        for (size_t j = 0; j < n; j++)
+        {
+            buffer[offset + j] = values[j];
+        }
+        DAAL_CHECK_STATUS(s, tables[i]->releaseBlockOfRows(block));
+        offset += n;
+    }
+
+    DAAL_CHECK_STATUS(s, allreduceBuffer<algorithmFPType>(comm, buffer.data(), size, op, precision));
+
+    offset = 0;
+    for (size_t i = 0; i < nTables; i++)
+    {
+        const size_t nRows = tables[i]->getNumberOfRows();
+        const size_t n     = nRows * tables[i]->getNumberOfColumns();
+        data_management::BlockDescriptor<algorithmFPType> block;
+        DAAL_CHECK_STATUS(s, tables[i]->getBlockOfRows(0, nRows, data_management::writeOnly, block));
+        algorithmFPType * values = block.getBlockPtr();
+        for (size_t j = 0; j < n; j++)
+        {
+            values[j] = buffer[offset + j];
+        }
+        DAAL_CHECK_STATUS(s, tables[i]->releaseBlockOfRows(block));
+        offset += n;
+    }
+    return s;
+}
+
+/**
+ * Reduces the values of the symmetric square numeric table over all the processes.
+ * Only the upper triangle is sent, the lower triangle of the result is restored from it
+ */
+template <typename algorithmFPType>
+Status allreduceSymmetricTable(CommunicatorIface & comm, data_management::NumericTable & table, CommunicatorIface::ReduceOp op,
+                               CommunicatorIface::TransportPrecision precision = CommunicatorIface::fullPrecision)
+{
+    const size_t n = table.getNumberOfColumns();
+    Collection<algorithmFPType> packed(n * (n + 1) / 2);
+    DAAL_CHECK_MALLOC(packed.data() || !n);
+
+    Status s;
+    data_management::BlockDescriptor<algorithmFPType> block;
+    DAAL_CHECK_STATUS(s, table.getBlockOfRows(0, n, data_management::readWrite, block));
+    algorithmFPType * values = block.getBlockPtr();
+    size_t offset            = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t j = i; j < n; j++)
+        {
+            packed[offset++] = values[i * n + j];
+        }
+    }
+
+    s |= allreduceBuffer<algorithmFPType>(comm, packed.data(), packed.size(), op, precision);
+    if (s)
+    {
+        offset = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t j = i; j < n; j++)
+            {
+                values[i * n + j] = packed[offset];
+                values[j * n + i] = packed[offset];
+                offset++;
+            }
+        }
+    }
+    s |= table.releaseBlockOfRows(block);
+    return s;
+}
+
+/**
+ * Sends the parts of the buffer of the calling process to the processes by alltoallv().
+ * The sizes of the parts are exchanged first, so that the receiver does not need to know them in advance
+ */
+inline Status exchangeParts(CommunicatorIface & comm, const Collection<byte> & sendBuffer, const Collection<size_t> & sendSizes,
+                            Collection<byte> & recvBuffer, Collection<size_t> & recvSizes)
+{
+    const size_t nProcesses = comm.getSize();
+    const size_t rank       = comm.getRank();
+
+    Collection<size_t> allSendSizes(nProcesses * nProcesses);
+    recvSizes.resize(nProcesses);
+    DAAL_CHECK_MALLOC(allSendSizes.data() && recvSizes.data());
+    Status s;
+    DAAL_CHECK_STATUS(s, comm.allgather((const byte *)sendSizes.data(), nProcesses * sizeof(size_t), (byte *)allSendSizes.data()));
+
+    size_t recvSize = 0;
+    for (size_t i = 0; i < nProcesses; i++)
+    {
+        recvSizes[i] = allSendSizes[i * nProcesses + rank];
+        recvSize += recvSizes[i];
+    }
+    recvBuffer.resize(recvSize);
+    DAAL_CHECK_MALLOC(recvBuffer.data() || !recvSize);
+    return comm.alltoallv(sendBuffer.data(), sendSizes.data(), recvBuffer.data(), recvSizes.data());
+}
+
+/**
+ * Gathers the serializable objects of all the processes in the order of the ranks.
+ * The object of every process is serialized into the buffer padded to the size of the largest buffer,
+ * so that one collective call of the same size is done
+ */
+inline Status allgatherSerializable(CommunicatorIface & comm, data_management::SerializationIface & object,
+                                    Collection<SharedPtr<data_management::SerializationIface> > & objects)
+{
+    const size_t nProcesses = comm.getSize();
+
+    data_management::InputDataArchive inArchive;
+    object.serialize(inArchive);
+    size_t size = inArchive.getSizeOfArchive();
+
+    Collection<size_t> sizes(nProcesses);
+    DAAL_CHECK_MALLOC(sizes.data());
+    Status s;
+    DAAL_CHECK_STATUS(s, comm.allgather((const byte *)&size, sizeof(size_t), (byte *)sizes.data()));
+
+    size_t maxSize = 0;
+    for (size_t i = 0; i < nProcesses; i++)
+    {
+        maxSize = (sizes[i] > maxSize) ? sizes[i] : maxSize;
+    }
+
+    Collection<byte> buffer(maxSize);
+    Collection<byte> allBuffers(maxSize * nProcesses);
+    DAAL_CHECK_MALLOC(buffer.data() && allBuffers.data());
+    inArchive.copyArchiveToArray(buffer.data(), size);
+    DAAL_CHECK_STATUS(s, comm.allgather(buffer.data(), maxSize, allBuffers.data()));
+
+    objects.clear();
+    for (size_t i = 0; i < nProcesses; i++)
+    {
+        data_management::OutputDataArchive outArchive(allBuffers.data() + i * maxSize, sizes[i]);
+        SharedPtr<data_management::SerializationIface> ptr = outArchive.getAsSharedPtr();
+        DAAL_CHECK(ptr, ErrorObjectDoesNotSupportSerialization);
+        objects.push_back(ptr);
+    }
+    return s;
+}
+} // namespace internal
+} // namespace services
+} // namespace daal
+
+#endif
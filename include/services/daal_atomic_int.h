@@ -59,6 +59,13 @@ public:
      */
     dataType dec();
 
+    /**
+     * Adds the value to atomic object
+     * \param[in] value    The value to be added
+     * \return The value of atomic object after the addition
+     */
+    dataType add(dataType value);
+
     /**
      * Assigns the value to atomic object
      * \param[in] value    The value to be assigned
@@ -40,6 +40,7 @@
 
 #if (defined(__INTEL_CXX11_MODE__) || __cplusplus > 199711L)
     #define DAAL_C11_OVERRIDE override
+    #define DAAL_C11_RVALUE_REFERENCES
 #else
     #define DAAL_C11_OVERRIDE
 #endif
@@ -189,6 +190,7 @@ const int SERIALIZATION_HOMOGEN_NT_ID             = 1000;
 const int SERIALIZATION_AOS_NT_ID                 = 3000;
 const int SERIALIZATION_SOA_NT_ID                 = 3001;
 const int SERIALIZATION_ARROW_IMMUTABLE_NT_ID     = 3002;
+const int SERIALIZATION_ARROW_MUTABLE_NT_ID       = 3003;
 const int SERIALIZATION_SYCL_SOA_NT_ID            = 3500;
 const int SERIALIZATION_DATACOLLECTION_ID         = 4000;
 const int SERIALIZATION_KEYVALUEDATACOLLECTION_ID = 4010;
@@ -202,6 +204,7 @@ const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID     = 11000;
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID    = 12000;
 const int SERIALIZATION_MERGE_NT_ID               = 13000;
 const int SERIALIZATION_ROWMERGE_NT_ID            = 14000;
+const int SERIALIZATION_SUBSET_NT_ID              = 14500;
 
 const int SERIALIZATION_OPTIONAL_RESULT_ID = 30000;
 const int SERIALIZATION_MEMORY_BLOCK_ID    = 40000;
@@ -269,6 +272,8 @@ const int SERIALIZATION_KMEANS_INIT_STEP5MASTER_PP_PARTIAL_RESULT_ID = 101240;
 
 const int SERIALIZATION_KMEANS_INIT_RESULT_ID = 101300;
 
+const int SERIALIZATION_KMEANS_PREDICTION_RESULT_ID = 101350;
+
 const int SERIALIZATION_CLASSIFIER_TRAINING_PARTIAL_RESULT_ID            = 101400;
 const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_RESULT_ID     = 101410;
 const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID = 101420;
@@ -315,7 +320,8 @@ const int SERIALIZATION_QR_ONLINE_PARTIAL_RESULT_ID            = 102410;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID       = 102420;
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID = 102430;
 
-const int SERIALIZATION_QUANTILES_RESULT_ID = 102500;
+const int SERIALIZATION_QUANTILES_RESULT_ID         = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID = 102600;
 
@@ -346,14 +352,22 @@ const int SERIALIZATION_COORDINATE_DESCENT_RESULT_ID = 103860;
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID = 103900;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID = 103910;
 
-const int SERIALIZATION_RIDGE_REGRESSION_MODELNORMEQ_ID       = 105000;
-const int SERIALIZATION_RIDGE_REGRESSION_PARTIAL_RESULT_ID    = 105010;
-const int SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID   = 105020;
-const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID = 105030;
-
-const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID           = 106000;
-const int SERIALIZATION_K_NEAREST_NEIGHBOR_BF_MODEL_ID        = 106001;
-const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID = 106010;
+const int SERIALIZATION_RIDGE_REGRESSION_MODELNORMEQ_ID             = 105000;
+const int SERIALIZATION_RIDGE_REGRESSION_PARTIAL_RESULT_ID          = 105010;
+const int SERIALIZATION_RIDGE_REGRESSION_TRAINING_RESULT_ID         = 105020;
+const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID       = 105030;
+const int SERIALIZATION_RIDGE_REGRESSION_GROUPED_TRAINING_RESULT_ID = 105040;
+
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID                     = 106000;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_BF_MODEL_ID                  = 106001;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_HNSW_MODEL_ID                = 106002;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_BALL_TREE_MODEL_ID           = 106003;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_IVFPQ_MODEL_ID               = 106004;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID           = 106010;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_HNSW_TRAINING_RESULT_ID      = 106011;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_BALL_TREE_TRAINING_RESULT_ID = 106012;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_IVFPQ_TRAINING_RESULT_ID     = 106013;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_PARTIAL_RESULT_ID            = 106020;
 
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_MODEL_ID             = 107000;
 const int SERIALIZATION_DECISION_FOREST_CLASSIFICATION_TRAINING_RESULT_ID   = 107010;
@@ -533,70 +547,48 @@ const int SERIALIZATION_DBSCAN_DISTRIBUTED_PARTIAL_RESULT_STEP13_ID = 121310;
     }
 #define DAAL_CHECK_BLOCK_STATUS_THR(block) DAAL_CHECK_STATUS_THR((block).status())
 
-#define DAAL_DEFAULT_CREATE_IMPL(Type)                      \
-    {                                                       \
-        services::Status defaultSt;                         \
-        services::Status & st = (stat ? *stat : defaultSt); \
-        services::SharedPtr<Type> result(new Type(st));     \
-        if (!result)                                        \
-        {                                                   \
-            st.add(services::ErrorMemoryAllocationFailed);  \
-        }                                                   \
-        if (!st)                                            \
-        {                                                   \
-            result.reset();                                 \
-        }                                                   \
-        return result;                                      \
+/* The object and its reference counter are created in a single memory block,
+   the block is freed by the guard if the constructor of the object throws */
+#define __DAAL_DEFAULT_CREATE_SHARED_IMPL(ObjectType, ConstructorArgs)                                      \
+    {                                                                                                       \
+        services::Status defaultSt;                                                                         \
+        services::Status & st                              = (stat ? *stat : defaultSt);                    \
+        services::InplaceRefCounter<ObjectType> * refCount = new services::InplaceRefCounter<ObjectType>(); \
+        services::SharedPtr<ObjectType> result;                                                             \
+        if (refCount)                                                                                       \
+        {                                                                                                   \
+            services::InplaceRefCounterGuard<ObjectType> guard(refCount);                                   \
+            ObjectType * object = new (refCount->storage()) ObjectType ConstructorArgs;                     \
+            guard.release();                                                                                \
+            result = refCount->share(object);                                                               \
+        }                                                                                                   \
+        if (!result)                                                                                        \
+        {                                                                                                   \
+            st.add(services::ErrorMemoryAllocationFailed);                                                  \
+        }                                                                                                   \
+        if (!st)                                                                                            \
+        {                                                                                                   \
+            result.reset();                                                                                 \
+        }                                                                                                   \
+        return result;                                                                                      \
     }
 
-#define DAAL_DEFAULT_CREATE_IMPL_EX(Type, ...)                       \
-    {                                                                \
-        services::Status defaultSt;                                  \
-        services::Status & st = (stat ? *stat : defaultSt);          \
-        services::SharedPtr<Type> result(new Type(__VA_ARGS__, st)); \
-        if (!result)                                                 \
-        {                                                            \
-            st.add(services::ErrorMemoryAllocationFailed);           \
-        }                                                            \
-        if (!st)                                                     \
-        {                                                            \
-            result.reset();                                          \
-        }                                                            \
-        return result;                                               \
-    }
+#define DAAL_DEFAULT_CREATE_IMPL(Type) __DAAL_DEFAULT_CREATE_SHARED_IMPL(Type, (st))
+
+#define DAAL_DEFAULT_CREATE_IMPL_EX(Type, ...) __DAAL_DEFAULT_CREATE_SHARED_IMPL(Type, (__VA_ARGS__, st))
 
 #define DAAL_TEMPLATE_ARGUMENTS(...) __VA_ARGS__
 
-#define DAAL_DEFAULT_CREATE_TEMPLATE_IMPL(Type, TemplateArgs)                        \
-    {                                                                                \
-        services::Status defaultSt;                                                  \
-        services::Status & st = (stat ? *stat : defaultSt);                          \
-        services::SharedPtr<Type<TemplateArgs> > result(new Type<TemplateArgs>(st)); \
-        if (!result)                                                                 \
-        {                                                                            \
-            st.add(services::ErrorMemoryAllocationFailed);                           \
-        }                                                                            \
-        if (!st)                                                                     \
-        {                                                                            \
-            result.reset();                                                          \
-        }                                                                            \
-        return result;                                                               \
+#define DAAL_DEFAULT_CREATE_TEMPLATE_IMPL(Type, TemplateArgs) \
+    {                                                         \
+        typedef Type<TemplateArgs> ObjectType;                \
+        __DAAL_DEFAULT_CREATE_SHARED_IMPL(ObjectType, (st))   \
     }
 
-#define DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(Type, TemplateArgs, ...)                             \
-    {                                                                                             \
-        services::Status defaultSt;                                                               \
-        services::Status & st = (stat ? *stat : defaultSt);                                       \
-        services::SharedPtr<Type<TemplateArgs> > result(new Type<TemplateArgs>(__VA_ARGS__, st)); \
-        if (!result)                                                                              \
-        {                                                                                         \
-            st.add(services::ErrorMemoryAllocationFailed);                                        \
-        }                                                                                         \
-        if (!st)                                                                                  \
-        {                                                                                         \
-            result.reset();                                                                       \
-        }                                                                                         \
-        return result;                                                                            \
+#define DAAL_DEFAULT_CREATE_TEMPLATE_IMPL_EX(Type, TemplateArgs, ...)    \
+    {                                                                    \
+        typedef Type<TemplateArgs> ObjectType;                           \
+        __DAAL_DEFAULT_CREATE_SHARED_IMPL(ObjectType, (__VA_ARGS__, st)) \
     }
 
 #define DAAL_CHECK_NUMERIC_TABLE(destVar, ...) DAAL_CHECK_STATUS(destVar, data_management::checkNumericTable(__VA_ARGS__))
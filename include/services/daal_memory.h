@@ -81,6 +81,16 @@ namespace internal
 * \return Status of memory copy, memory copy is successful if zero is returned
 */
 DAAL_EXPORT int daal_memcpy_s(void * dest, size_t destSize, const void * src, size_t srcSize);
+
+/**
+* Allocates an aligned block of memory for the data of a numeric table.
+* Large blocks are first touched by the worker threads in parallel according to Environment::MemoryPlacementPolicy,
+* so their pages are distributed across NUMA nodes like the parallel loops that process the data
+* \param[in] size      Size of the block of memory in bytes
+* \param[in] alignment Alignment constraint. Must be a power of two
+* \return Pointer to the beginning of a newly allocated block of memory
+*/
+DAAL_EXPORT void * daal_malloc_table_data(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
 } // namespace internal
 
 /**
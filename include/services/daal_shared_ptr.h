@@ -24,6 +24,7 @@
 #ifndef __DAAL_SHARED_PTR_H__
 #define __DAAL_SHARED_PTR_H__
 
+#include <new>
 #include "services/base.h"
 #include "services/daal_memory.h"
 #include "services/error_id.h"
@@ -137,6 +138,9 @@ protected:
     Deleter _deleter;
 };
 
+template <class T>
+class InplaceRefCounter;
+
 /**
  * <a name="DAAL-CLASS-SERVICES__SHAREDPTR"></a>
  * \brief Shared pointer that retains shared ownership of an object through a pointer.
@@ -208,6 +212,47 @@ public:
     template <class U>
     SharedPtr(const SharedPtr<U> & r, T * ptr, T * shiftedPtr);
 
+#ifdef DAAL_C11_RVALUE_REFERENCES
+    /**
+     * Constructs a shared pointer that takes the ownership from another shared pointer
+     * without changing the reference count
+     * \param[in] other   Input shared pointer, empty after the call
+     */
+    SharedPtr(SharedPtr<T> && other) : _ownedPtr(other._ownedPtr), _ptr(other._ptr), _refCount(other._refCount) { other._release(); }
+
+    /**
+     * Constructs a shared pointer that takes the ownership from another shared pointer
+     * without changing the reference count
+     * \param[in] other   Input shared pointer, empty after the call
+     */
+    template <class U>
+    SharedPtr(SharedPtr<U> && other) : _ownedPtr(other._ownedPtr), _ptr(other._ptr), _refCount(other._refCount)
+    {
+        other._release();
+    }
+
+    /**
+     * Takes the ownership from an input shared pointer without changing its reference count
+     * \param[in] ptr   Shared pointer to move, empty after the call
+     */
+    SharedPtr<T> & operator=(SharedPtr<T> && ptr)
+    {
+        _move(ptr);
+        return *this;
+    }
+
+    /**
+     * Takes the ownership from an input shared pointer without changing its reference count
+     * \param[in] ptr   Shared pointer to move, empty after the call
+     */
+    template <class U>
+    SharedPtr<T> & operator=(SharedPtr<U> && ptr)
+    {
+        _move(ptr);
+        return *this;
+    }
+#endif
+
     /**
      * Decreases the reference count
      * If the reference count becomes equal to zero, deletes the managed pointer
@@ -314,8 +359,43 @@ protected:
     */
     void _remove();
 
+    /**
+    * Forgets the managed pointer without changing the reference count
+    */
+    void _release()
+    {
+        _ownedPtr = NULL;
+        _ptr      = NULL;
+        _refCount = NULL;
+    }
+
+    /**
+    * Takes the managed pointer of another shared pointer without changing the reference count
+    */
+    template <class U>
+    void _move(SharedPtr<U> & other)
+    {
+        if ((void *)&other == (void *)this) return;
+        T * ownedPtr          = other._ownedPtr;
+        T * ptr               = other._ptr;
+        RefCounter * refCount = other._refCount;
+        other._release();
+        _remove();
+        _ownedPtr = ownedPtr;
+        _ptr      = ptr;
+        _refCount = refCount;
+    }
+
+    /**
+    * Constructs a shared pointer that manages ptr by the reference counter created by the caller
+    */
+    SharedPtr(RefCounter * refCount, T * ptr) : _ownedPtr(ptr), _ptr(ptr), _refCount(refCount) {}
+
     template <class U>
     friend class SharedPtr;
+
+    template <class U>
+    friend class InplaceRefCounter;
 }; // class SharedPtr
 
 template <class T>
@@ -396,6 +476,101 @@ void SharedPtr<T>::reset(U * ptr, const D & deleter)
     }
 }
 
+/**
+ * <a name="DAAL-CLASS-SERVICES__INPLACEREFCOUNTER"></a>
+ * \brief Reference counter that keeps the managed object in the same memory block,
+ * so the object and its reference counter are created by a single memory allocation.
+ * The object is constructed by the placement new in storage() and passed to share()
+ *
+ * \tparam T    Class of the managed object
+ */
+template <class T>
+class InplaceRefCounter : public RefCounter
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     * Default constructor
+     */
+    InplaceRefCounter() : _object(NULL) {}
+    /** Destructor */
+    virtual ~InplaceRefCounter() {}
+
+    /**
+     * Returns the memory to construct the managed object in
+     * \return Pointer to the memory of the size and alignment suitable for the object of class T
+     */
+    void * storage() { return _storage.data; }
+
+    /**
+     * Transfers the ownership of the object and of the reference counter to a shared pointer.
+     * The reference counter is destroyed if the object is NULL
+     * \param[in] object   Pointer to the object constructed in storage()
+     * \return Shared pointer that manages the object
+     */
+    SharedPtr<T> share(T * object)
+    {
+        if (!object)
+        {
+            delete this;
+            return SharedPtr<T>();
+        }
+        _object = object;
+        return SharedPtr<T>(static_cast<RefCounter *>(this), object);
+    }
+
+    /* The object is destroyed in place, its memory is released together with the reference counter */
+    void operator()(const void * /*ptr*/) DAAL_C11_OVERRIDE
+    {
+        if (_object) _object->~T();
+        _object = NULL;
+    }
+
+protected:
+    union Storage
+    {
+        char data[sizeof(T)];
+        long double alignAsLongDouble;
+        DAAL_INT64 alignAsInt64;
+        void * alignAsPointer;
+    };
+
+    Storage _storage;
+    T * _object;
+};
+
+/**
+ * <a name="DAAL-CLASS-SERVICES__INPLACEREFCOUNTERGUARD"></a>
+ * \brief Deletes the reference counter that keeps the managed object in place if the object was not constructed,
+ * e.g. if its constructor throws an exception. The guard is released after the object is passed to InplaceRefCounter::share()
+ *
+ * \tparam T    Class of the managed object
+ */
+template <class T>
+class InplaceRefCounterGuard
+{
+public:
+    /**
+     * Constructs the guard of the reference counter
+     * \param[in] refCount   Reference counter created for the object
+     */
+    explicit InplaceRefCounterGuard(InplaceRefCounter<T> * refCount) : _refCount(refCount) {}
+    /** Destructor */
+    ~InplaceRefCounterGuard() { delete _refCount; }
+
+    /**
+     * Releases the reference counter, so it is not deleted by the guard
+     */
+    void release() { _refCount = NULL; }
+
+private:
+    InplaceRefCounter<T> * _refCount;
+
+    InplaceRefCounterGuard(const InplaceRefCounterGuard &);
+    InplaceRefCounterGuard & operator=(const InplaceRefCounterGuard &);
+};
+
 /**
  * Creates a new instance of SharedPtr whose managed object type is obtained from the type of the managed object of r
  * using a cast expression. Both shared pointers share ownership of the managed object.
@@ -449,6 +624,8 @@ using interface1::EmptyDeleter;
 using interface1::ServiceDeleter;
 using interface1::RefCounter;
 using interface1::RefCounterImp;
+using interface1::InplaceRefCounter;
+using interface1::InplaceRefCounterGuard;
 using interface1::SharedPtr;
 using interface1::staticPointerCast;
 using interface1::dynamicPointerCast;
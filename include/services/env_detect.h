@@ -141,6 +141,53 @@ public:
      */
     void setDynamicLibraryThreadingTypeOnWindows(LibraryThreadingType type);
 
+    /**
+     * <a name="DAAL-ENUM-SERVICES__MEMORYPLACEMENTPOLICY"></a>
+     * Policy of placement of the data of large numeric tables allocated by the library on NUMA nodes
+     */
+    enum MemoryPlacementPolicy
+    {
+        localMemoryPlacement      = 0, /*!< Pages of a buffer are placed on the NUMA node of the thread that allocates it */
+        firstTouchMemoryPlacement = 1, /*!< Pages of a large buffer are first touched by the worker threads in parallel,
+                                            so they are distributed across NUMA nodes like the parallel loops that process the buffer */
+        autoMemoryPlacement       = 2  /*!< firstTouchMemoryPlacement on systems with several processor packages,
+                                            localMemoryPlacement otherwise. Default policy */
+    };
+
+    /**
+     *  Sets the policy of placement of large buffers on NUMA nodes. Affects the data of the numeric tables allocated by the library
+     *  after the call, the other buffers of the library are placed on the NUMA node of the thread that allocates them
+     *  \param[in] policy  The memory placement policy
+     */
+    void setMemoryPlacementPolicy(MemoryPlacementPolicy policy);
+
+    /**
+     * <a name="DAAL-ENUM-SERVICES__HUGEPAGESPOLICY"></a>
+     * Policy of backing of large buffers allocated by the library with huge pages
+     */
+    enum HugePagesPolicy
+    {
+        noHugePages          = 0, /*!< Buffers are backed with the pages chosen by the operating system. Default policy */
+        transparentHugePages = 1  /*!< Large buffers are advised to the operating system to be backed with transparent huge pages,
+                                       which reduces TLB misses of the random accesses to them, e.g. in the training of decision trees */
+    };
+
+    /**
+     *  Sets the policy of backing of large buffers with huge pages. Affects numeric tables and buffers allocated after the call.
+     *  The operating system backs the buffers with regular pages when huge pages are not available
+     *  \param[in] policy   The huge pages policy
+     *  \param[in] minSize  Size in bytes of the smallest buffer backed with huge pages
+     *  \return 0 if the policy is set, -1 if huge pages are not supported on the system
+     */
+    int setHugePagesPolicy(HugePagesPolicy policy, size_t minSize = 32 * 1024 * 1024);
+
+    /**
+     *  Returns the size of the memory advised to be backed with huge pages since the policy was set.
+     *  Only the huge pages that lie entirely within a buffer are advised
+     *  \return The size of the memory in bytes
+     */
+    size_t getHugePagesAdvisedSize();
+
     /**
      *  Sets the number of threads to use
      *  \param[in] numThreads   The number of threads
@@ -153,6 +200,145 @@ public:
      */
     void enableThreadPinning(bool enableThreadPinningFlag = true);
 
+    /**
+     * <a name="DAAL-ENUM-SERVICES__THREADPINNINGPOLICY"></a>
+     * Order of the processors the threads are pinned to when thread pinning is enabled
+     */
+    enum ThreadPinningPolicy
+    {
+        defaultThreadPinning = 0, /*!< Physical cores of all NUMA nodes, then their hyper-threads. Default policy */
+        compactThreadPinning = 1, /*!< Processors of one NUMA node, then processors of the next one, so a small number of threads
+                                       shares the caches and the memory of one node */
+        scatterThreadPinning = 2  /*!< Processors are taken from the NUMA nodes in turn, so a small number of threads
+                                       uses the memory bandwidth of all nodes */
+    };
+
+    /**
+     *  Sets the order of the processors the threads are pinned to. Takes effect for the threads that enter the pinned arena after the call
+     *  \param[in] policy  The thread pinning policy
+     *  \return 0 if the policy is set, -1 if the topology of the system is not available
+     */
+    int setThreadPinningPolicy(ThreadPinningPolicy policy);
+
+    /**
+     * <a name="DAAL-ENUM-SERVICES__THREADSCHEDULINGPOLICY"></a>
+     * Distribution of the iterations of the parallel loops of the library between the threads
+     */
+    enum ThreadSchedulingPolicy
+    {
+        defaultThreadScheduling = 0, /*!< Iterations are split into ranges that are balanced between the threads by work stealing.
+                                          Default policy */
+        dynamicThreadScheduling = 1, /*!< Iterations are split into several small chunks per thread, each chunk is a separate task taken
+                                          by the first free thread, so the threads on the faster cores take more chunks.
+                                          Suits the processors with performance and efficient cores */
+        autoThreadScheduling    = 2  /*!< dynamicThreadScheduling on the processors with the cores of different types,
+                                          defaultThreadScheduling otherwise */
+    };
+
+    /**
+     *  Sets the distribution of the iterations of the parallel loops between the threads. Takes effect for the loops started after the call
+     *  \param[in] policy  The thread scheduling policy
+     */
+    void setThreadSchedulingPolicy(ThreadSchedulingPolicy policy);
+
+    /**
+     *  Enables the deterministic mode of the parallel computations. The iterations of the parallel loops are split into the groups
+     *  that depend on the number of iterations only and the partial results of the groups are reduced in the fixed order,
+     *  so the results do not depend on the number of threads. The parallel tasks and the parallel invocations run one after another
+     *  in the calling thread, only the loops inside them run in parallel. Takes effect for the computations started after the call
+     *  \param[in] enableFlag  True to enable the deterministic mode, false to disable it
+     *  \param[in] nGroups     Maximal number of the groups of iterations of a parallel loop
+     */
+    void enableDeterministicComputations(bool enableFlag = true, size_t nGroups = 64);
+
+    /**
+     *  Returns the number of NUMA nodes the computations can be bound to by NumaNodeScope
+     *  \return The number of NUMA nodes, 0 if the topology of the system is not available
+     */
+    size_t getNumberOfNumaNodes();
+
+    /**
+     *  Enables recording of the tasks executed by the library kernels into the trace buffer.
+     *  Tracing can be also enabled by setting DAAL_KERNEL_TRACE environment variable to the name of the file to write the trace at exit
+     *  \param[in] enableKernelTracingFlag   Flag to enable kernel tracing
+     */
+    void enableKernelTracing(bool enableKernelTracingFlag = true);
+
+    /**
+     *  Writes the tasks recorded since kernel tracing was enabled to the file in Chrome trace event format
+     *  \param[in] fileName  Name of the file
+     *  \return 0 if the trace is written successfully
+     */
+    int writeKernelTrace(const char * fileName);
+
+    /**
+     *  Enables sampling of the hardware performance counters (cycles, instructions and last level cache misses) for each task recorded
+     *  by kernel tracing. The counters are available on Linux when the perf_event_open system call is permitted for the process.
+     *  The counters can be also enabled by setting DAAL_KERNEL_SUMMARY environment variable to the name of the file to write the summary at exit
+     *  \param[in] enableKernelCountersFlag   Flag to enable the counters
+     *  \return true if the counters are available and their state is changed
+     */
+    bool enableKernelCounters(bool enableKernelCountersFlag = true);
+
+    /**
+     *  Writes the tasks recorded since kernel tracing was enabled to the CSV file, one line per task name: number of calls, time,
+     *  bytes read and written, floating-point operations of the BLAS calls, hardware counters, instructions per cycle, achieved bandwidth,
+     *  bandwidth of the memory estimated from the last level cache misses and rate of floating-point operations.
+     *  The time and the counters of a task include the nested tasks
+     *  \param[in] fileName  Name of the file
+     *  \return 0 if the summary is written successfully
+     */
+    int writeKernelSummary(const char * fileName);
+
+    /**
+     *  Enables recording of the CPU branch of the library selected for each call of the algorithm kernels.
+     *  The report can be also enabled by setting DAAL_DISPATCH_REPORT environment variable to the name of the file to write the report at exit
+     *  \param[in] enableDispatchReportFlag   Flag to enable the dispatch report
+     */
+    void enableDispatchReport(bool enableDispatchReportFlag = true);
+
+    /**
+     *  Writes the kernel calls recorded since the dispatch report was enabled to the text file,
+     *  one line per call: sequence number, CPU branch, kernel, source file of the call and thread id
+     *  \param[in] fileName  Name of the file
+     *  \return 0 if the report is written successfully
+     */
+    int writeDispatchReport(const char * fileName);
+
+    /**
+     *  Enables accounting of the memory allocated by the library for the algorithms and the data.
+     *  The accounting adds a lookup to each allocation and deallocation, so it is intended for sizing the jobs
+     *  rather than for production runs. Enabling the accounting resets the counters
+     *  \param[in] enableMemoryAccountingFlag   Flag to enable memory accounting
+     */
+    void enableMemoryAccounting(bool enableMemoryAccountingFlag = true);
+
+    /**
+     *  Returns the size of the memory allocated by the library since memory accounting was enabled and not freed yet
+     *  \return The size of the memory in bytes
+     */
+    size_t getAllocatedMemorySize();
+
+    /**
+     *  Returns the peak size of the memory allocated by the library since memory accounting was enabled
+     *  or since the last call of resetPeakAllocatedMemorySize()
+     *  \return The peak size of the memory in bytes
+     */
+    size_t getPeakAllocatedMemorySize();
+
+    /**
+     *  Sets the peak size of the allocated memory to the size of the memory allocated at the moment
+     */
+    void resetPeakAllocatedMemorySize();
+
+    /**
+     *  Returns the peak size of the memory allocated by the last compute() of an algorithm called by the calling thread,
+     *  above the size allocated at the start of the call. The peak of the calls made concurrently by several threads
+     *  includes the memory allocated by all of them
+     *  \return The peak size of the memory in bytes, 0 if memory accounting is not enabled
+     */
+    size_t getLastComputePeakMemorySize();
+
     /**
      *  Returns the number of used threads
      *  \return The number of used threads
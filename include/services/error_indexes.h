@@ -170,6 +170,7 @@ enum ErrorID
     ErrorSkipAheadUnsupported                         = -3021, /*!< SkipAhead method is not supported by generator */
     ErrorFeatureNamesNotAvailable                     = -3022, /*!< Feature names are not available for feature modifier */
     ErrorEngineNotSupported                           = -3023,
+    ErrorZeroCopyAccessNotAvailable                   = -3024, /*!< Numeric Table cannot provide the block without copying the data */
 
     // Common computation errors: -4000...
     ErrorInputSigmaMatrixHasNonPositiveMinor = -4001, /*!< Input sigma matrix has non positive minor */
@@ -326,6 +327,18 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock      = -9022, /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+
+    ErrorCompressionChunkIndexCorrupted = -9023, /*!< Chunk index of the parallel compressed stream is in wrong format or corrupted */
+    ErrorCompressionIncompleteStream    = -9024, /*!< Input compressed stream does not contain all the chunks listed in its chunk index */
+    ErrorCompressionStreamFinalized     = -9025, /*!< Data cannot be added to the stream after its compressed data were requested */
+
+    ErrorLz4Internal                    = -9026, /*!< LZ4 internal error */
+    ErrorLz4OutputStreamSizeIsNotEnough = -9027, /*!< Size of output stream is not enough to start compression */
+    ErrorLz4DataFormat                  = -9028, /*!< Input compressed stream is in wrong format or corrupted */
+    ErrorLz4DataFormatLessThenHeader    = -9029, /*!< Size of input compressed stream is less then
+                                                                         *   compressed block header size */
+    ErrorLz4DataFormatNotFullBlock      = -9030, /*!< Input compressed stream contains not a whole
+                                                                         *   number of compressed blocks */
     // Min-max normalization errors: -9400..-9499
     ErrorLowerBoundGreaterThanOrEqualToUpperBound = -9400, /*!< Lower bound parameter greater than or equal to upper bound */
 
@@ -383,6 +396,8 @@ enum ErrorID
     ErrorOnFileOpen             = -90045, /*!< Error on file open */
     ErrorOnFileRead             = -90046, /*!< Error on file read */
     ErrorNullByteInjection      = -90047, /*!< Error null byte injection */
+    ErrorOnFileWrite            = -90048, /*!< Error on file write */
+    ErrorIncorrectFileFormat    = -90049, /*!< Content of the file does not match the expected format */
 
     ErrorKDBNoConnection      = -90051, /*!< ErrorKDBNoConnection */
     ErrorKDBWrongCredentials  = -90052, /*!< ErrorKDBWrongCredentials */
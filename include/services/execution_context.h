@@ -107,7 +107,105 @@ public:
      */
     SyclExecutionContext(const cl::sycl::queue & deviceQueue) : ExecutionContext(createContext(deviceQueue)) {}
 
+    /** Constructor from SYCL* queue with the persistent cache of the compiled OpenCL* programs.
+     *  Programs built for the device associated with the queue are stored in the directory,
+     *  other processes that use the same directory load them instead of compiling the programs again
+     *  \param[in] deviceQueue            SYCL* queue object to the device that is selected to perform computations
+     *  \param[in] programCacheDirectory  Existing directory that stores the compiled programs
+     */
+    SyclExecutionContext(const cl::sycl::queue & deviceQueue, const char * programCacheDirectory)
+        : ExecutionContext(createContext(deviceQueue, programCacheDirectory))
+    {}
+
+    /**
+     *  Loads all the programs stored in the program cache for the device, so that the first runs of the algorithms
+     *  do not spend time on building of the programs
+     *  \return Status of the operation
+     */
+    Status warmUpProgramCache()
+    {
+        Status status;
+        daal::oneapi::internal::SyclExecutionContextImpl * impl =
+            dynamic_cast<daal::oneapi::internal::SyclExecutionContextImpl *>(getImplPtr().get());
+        if (impl)
+        {
+            impl->warmUpProgramCache(&status);
+        }
+        return status;
+    }
+
+    /**
+     *  Enables or disables the asynchronous scheduling of the kernels. In the asynchronous mode the kernels of an algorithm
+     *  are chained by events and the host waits for them once at the end of the computation
+     *  \param[in] isAsynchronous   Flag that enables the asynchronous scheduling
+     *  
+eturn Status of the operation
+     */
+    Status setAsynchronousScheduling(bool isAsynchronous)
+    {
+        Status status;
+        daal::oneapi::internal::SyclExecutionContextImpl * impl =
+            dynamic_cast<daal::oneapi::internal::SyclExecutionContextImpl *>(getImplPtr().get());
+        if (impl)
+        {
+            impl->setAsynchronousScheduling(isAsynchronous, &status);
+        }
+        return status;
+    }
+
+    /**
+     *  Enables or disables caching of the temporary buffers of the algorithms in the device memory pool
+     *  \param[in] isEnabled   Flag that enables the memory pool
+     */
+    void setMemoryPoolEnabled(bool isEnabled)
+    {
+        daal::oneapi::internal::SyclExecutionContextImpl * impl = getSyclImpl();
+        if (impl)
+        {
+            impl->getBufferPool().setEnabled(isEnabled);
+        }
+    }
+
+    /**
+     *  Releases the buffers of the device memory pool that are not in use
+     *  \param[in] maxCachedBytes   Size of the pool in bytes to keep
+     */
+    void trimMemoryPool(size_t maxCachedBytes = 0)
+    {
+        daal::oneapi::internal::SyclExecutionContextImpl * impl = getSyclImpl();
+        if (impl)
+        {
+            impl->getBufferPool().trim(maxCachedBytes);
+        }
+    }
+
+    /**
+     *  Returns the statistics of the device memory pool
+     *  \return Statistics of the memory pool
+     */
+    daal::oneapi::internal::BufferPoolStatistics getMemoryPoolStatistics()
+    {
+        daal::oneapi::internal::SyclExecutionContextImpl * impl = getSyclImpl();
+        return impl ? impl->getBufferPool().getStatistics() : daal::oneapi::internal::BufferPoolStatistics();
+    }
+
 private:
+    daal::oneapi::internal::SyclExecutionContextImpl * getSyclImpl()
+    {
+        return dynamic_cast<daal::oneapi::internal::SyclExecutionContextImpl *>(getImplPtr().get());
+    }
+
+    static daal::oneapi::internal::ExecutionContextIface * createContext(const cl::sycl::queue & queue, const char * programCacheDirectory)
+    {
+        daal::oneapi::internal::ExecutionContextIface * context = createContext(queue);
+        daal::oneapi::internal::SyclExecutionContextImpl * impl = dynamic_cast<daal::oneapi::internal::SyclExecutionContextImpl *>(context);
+        if (impl)
+        {
+            impl->setProgramCacheDirectory(programCacheDirectory);
+        }
+        return context;
+    }
+
     static daal::oneapi::internal::ExecutionContextIface * createContext(const cl::sycl::queue & queue)
     {
         /* XXX: Workaround to fix performance on CPU: SYCL* runtime loads one
@@ -55,6 +55,15 @@ public:
      */
     virtual bool isCancelled() = 0;
 
+    /**
+     * This callback is called by compute() methods of the iterative algorithms after each iteration.
+     * The host application can request to stop the computation from isCancelled() based on the reported values
+     * \param[in] nIterations  Number of iterations completed
+     * \param[in] objective    Current value of the objective function or of the convergence criterion of the algorithm,
+     *                         NaN if the algorithm does not compute it
+     */
+    virtual void reportProgress(size_t nIterations, double objective);
+
 private:
     Base * _impl;
 };
@@ -159,8 +159,13 @@ private:
         case readOnly: return buffer.getHostRead(&_status);
         case writeOnly: return buffer.getHostWrite(&_status);
         case readWrite: return buffer.getHostReadWrite(&_status);
+        case readOnlyBorrowed:
+            /* The device memory is not accessible on the host without a copy */
+            _status.add(services::ErrorZeroCopyAccessNotAvailable);
+            return SharedPtr<T>();
         }
         DAAL_ASSERT(!"Unexpected read/write flag");
+        _status.add(services::ErrorIncorrectParameter);
         return SharedPtr<T>();
     }
 
@@ -169,6 +169,49 @@ private:
     BufferType _syclBuffer;
 };
 
+/**
+ *  <a name="DAAL-CLASS-SERVICES-INTERNAL__POOLEDSYCLBUFFER"></a>
+ *  \brief SYCL* buffer that views the memory of a pool entry. The entry is reused by the pool
+ *         only after all the buffers that hold its lease are destroyed
+ */
+template <typename T>
+class PooledSyclBuffer : public SyclBuffer<T>
+{
+private:
+    typedef cl::sycl::buffer<T, 1> BufferType;
+
+public:
+    PooledSyclBuffer(const BufferType & entryBuffer, size_t offset, size_t size, const SharedPtr<Base> & lease)
+        : SyclBuffer<T>(view(entryBuffer, offset, size)), _entryBuffer(entryBuffer), _offset(offset), _lease(lease)
+    {}
+
+    /* Sub-buffers are created from the buffer of the entry, since SYCL* does not support sub-buffers of sub-buffers */
+    PooledSyclBuffer<T> * getSubBuffer(size_t offset, size_t size) const DAAL_C11_OVERRIDE
+    {
+        DAAL_ASSERT(offset + size <= this->size());
+        return new PooledSyclBuffer<T>(_entryBuffer, _offset + offset, size, _lease);
+    }
+
+private:
+    static BufferType view(const BufferType & entryBuffer, size_t offset, size_t size)
+    {
+        if (offset == 0 && size == entryBuffer.get_count())
+        {
+            return entryBuffer;
+        }
+        BufferType & buffer = const_cast<BufferType &>(entryBuffer);
+        return BufferType(buffer, cl::sycl::id<1>(offset), cl::sycl::range<1>(size));
+    }
+
+    BufferType _entryBuffer;
+    size_t _offset;
+    SharedPtr<Base> _lease;
+};
+
+/* Creates services::Buffer objects that hold the pool leases, defined in services/buffer.h */
+template <typename T>
+class PooledSyclBufferFactory;
+
 /**
  *  <a name="DAAL-CLASS-SERVICES-INTERNAL__CONVERTTOSYCL"></a>
  *  \brief BufferVisitor that converters any buffer to SYCL* buffer
@@ -231,6 +274,24 @@ private:
 };
 #endif
 
+/**
+ *  <a name="DAAL-CLASS-SERVICES-INTERNAL__SYCLBUFFERCHECKER"></a>
+ *  \brief BufferVisitor that checks whether the buffer references a SYCL* buffer
+ */
+template <typename T>
+class SyclBufferChecker : public BufferVisitor<T>
+{
+public:
+    SyclBufferChecker() : _isSyclBuffer(false) {}
+
+    void operator()(const SyclBufferIface<T> & /*buffer*/) DAAL_C11_OVERRIDE { _isSyclBuffer = true; }
+
+    bool isSyclBuffer() const { return _isSyclBuffer; }
+
+private:
+    bool _isSyclBuffer;
+};
+
 /**
  *  <a name="DAAL-CLASS-SERVICES-INTERNAL__SYCLBUFFERCONVERTER"></a>
  *  \brief Groups high-level conversion methods for SYCL* buffer and USM
@@ -246,6 +307,13 @@ public:
         return action.get();
     }
 
+    bool isSyclBuffer(const internal::BufferIface<T> & buffer)
+    {
+        SyclBufferChecker<T> action;
+        buffer.apply(action);
+        return action.isSyclBuffer();
+    }
+
 #ifdef DAAL_SYCL_INTERFACE_USM
     SharedPtr<T> toUSM(const internal::BufferIface<T> & buffer)
     {
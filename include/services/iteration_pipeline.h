@@ -0,0 +1,143 @@
+/* file: iteration_pipeline.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Driver of the iterative SPMD computations that overlaps the reduction of
+//  an iteration with the local preparation of the next one
+//--
+*/
+
+#ifndef __DAAL_ITERATION_PIPELINE_H__
+#define __DAAL_ITERATION_PIPELINE_H__
+
+#include "services/communicator.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ *  <a name="DAAL-CLASS-SERVICES__PIPELINEDITERATIONIFACE"></a>
+ *  \brief Abstract class which defines one iteration of an iterative algorithm in the distributed processing mode split into
+ *         the stages run by IterationPipeline. Typically the local stage runs the step1Local algorithm, the reduction is posted
+ *         by the non-blocking methods of CommunicatorIface and the finalization runs the step2Master algorithm on the reduced data
+ */
+class PipelinedIterationIface : public Base
+{
+public:
+    virtual ~PipelinedIterationIface() {}
+
+    /**
+     * Computes the local partial result of the iteration
+     * \param[in] iteration  Index of the iteration
+     * \return Status of computations
+     */
+    virtual Status computeLocal(size_t iteration) = 0;
+
+    /**
+     * Posts the reduction of the local partial result of the iteration
+     * \param[in]  comm      Communicator
+     * \param[in]  iteration Index of the iteration
+     * \param[out] requests  Collection the handles of the posted operations are appended to
+     * \return Status of computations
+     */
+    virtual Status postReduction(CommunicatorIface & comm, size_t iteration, Collection<RequestIfacePtr> & requests) = 0;
+
+    /**
+     * Runs the local work that does not depend on the reduction in flight, for example the norms of the observations or
+     * the shuffling of the blocks for the next iteration, or the allocation of the objects used by finalize()
+     * \param[in] iteration  Index of the iteration whose reduction is in flight
+     * \return Status of computations
+     */
+    virtual Status overlap(size_t /*iteration*/) { return Status(); }
+
+    /**
+     * Computes the result of the iteration from the reduced data
+     * \param[in]  iteration  Index of the iteration
+     * \param[out] converged  Set to true to stop the iterations
+     * \return Status of computations
+     */
+    virtual Status finalize(size_t iteration, bool & converged) = 0;
+};
+
+/**
+ *  <a name="DAAL-CLASS-SERVICES__ITERATIONPIPELINE"></a>
+ *  \brief Runs the iterations of PipelinedIterationIface so that the reduction of an iteration proceeds while the calling process
+ *         runs the overlapped local work. The communication is actually overlapped only if the communicator overrides
+ *         the non-blocking methods of CommunicatorIface
+ */
+class IterationPipeline
+{
+public:
+    /**
+     * Constructs the driver
+     * \param[in] comm  Communicator shared by the processes that run the iterations
+     */
+    IterationPipeline(const CommunicatorIfacePtr & comm) : _comm(comm), _nIterations(0) {}
+
+    /**
+     * Runs the iterations until the iteration reports the convergence or the maximal number of iterations is reached
+     * \param[in] iteration      Iteration to run
+     * \param[in] maxIterations  Maximal number of iterations
+     * \return Status of computations
+     */
+    Status run(PipelinedIterationIface & iteration, size_t maxIterations)
+    {
+        DAAL_CHECK(_comm, ErrorNullPtr);
+        Status s;
+        Collection<RequestIfacePtr> requests;
+        bool converged = false;
+        for (_nIterations = 0; _nIterations < maxIterations && !converged;)
+        {
+            DAAL_CHECK_STATUS(s, iteration.computeLocal(_nIterations));
+
+            requests.clear();
+            s |= iteration.postReduction(*_comm, _nIterations, requests);
+            /* The posted operations are completed even on the failure so that the buffers are not released while in use */
+            if (s) s |= iteration.overlap(_nIterations);
+            for (size_t i = 0; i < requests.size(); i++)
+            {
+                if (requests[i]) s |= requests[i]->wait();
+            }
+            if (!s) return s;
+
+            DAAL_CHECK_STATUS(s, iteration.finalize(_nIterations, converged));
+            _nIterations++;
+        }
+        return s;
+    }
+
+    /**
+     * Returns the number of the iterations done by the last call of run()
+     * \return Number of the iterations
+     */
+    size_t getNumberOfIterations() const { return _nIterations; }
+
+private:
+    CommunicatorIfacePtr _comm;
+    size_t _nIterations;
+};
+} // namespace interface1
+using interface1::PipelinedIterationIface;
+using interface1::IterationPipeline;
+} // namespace services
+} // namespace daal
+
+#endif
@@ -0,0 +1,82 @@
+/* file: numa_node_scope.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Binding of the computations of a thread to one NUMA node.
+//--
+*/
+
+#ifndef __NUMA_NODE_SCOPE_H__
+#define __NUMA_NODE_SCOPE_H__
+
+#include "services/base.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+/**
+ * @ingroup env_detect
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-SERVICES__NUMANODESCOPE"></a>
+ * \brief Binds the calling thread to the processors of one NUMA node for the lifetime of the object.
+ *        The algorithms computed by the thread within the scope run in the arena of the threads pinned to the processors of the node,
+ *        and the memory first touched by the thread or by these algorithms is placed on the node.
+ *        Scopes of different threads are independent, so the algorithms computed concurrently by several threads bound to different nodes
+ *        do not share the caches and the memory bandwidth
+ */
+class DAAL_EXPORT NumaNodeScope : public Base
+{
+public:
+    /**
+     *  Binds the calling thread to the NUMA node
+     *  \param[in] node  Index of the NUMA node, less than Environment::getNumberOfNumaNodes()
+     */
+    NumaNodeScope(size_t node);
+
+    /**
+     *  Restores the binding of the calling thread that was in effect before the scope
+     */
+    ~NumaNodeScope();
+
+    /**
+     *  Returns the status of the binding. If the status is not ok, the computations of the thread are not bound to the node
+     *  \return The status of the binding
+     */
+    const Status & getStatus() const { return _status; }
+
+private:
+    NumaNodeScope(const NumaNodeScope &);
+    NumaNodeScope & operator=(const NumaNodeScope &);
+
+    void * _binding;
+    Status _status;
+};
+/** @} */
+} // namespace interface1
+
+using interface1::NumaNodeScope;
+
+} // namespace services
+} // namespace daal
+#endif
@@ -0,0 +1,85 @@
+/* file: thread_arena.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Interface of the arena of threads used by the computations of an algorithm
+//--
+*/
+
+#ifndef __DAAL_THREAD_ARENA_H__
+#define __DAAL_THREAD_ARENA_H__
+
+#include "services/daal_defines.h"
+#include "services/base.h"
+#include "services/daal_shared_ptr.h"
+
+namespace daal
+{
+namespace services
+{
+namespace internal
+{
+class ThreadArenaAccessor;
+} // namespace internal
+
+namespace interface1
+{
+/**
+ *  <a name="DAAL-CLASS-SERVICES__THREADARENA"></a>
+ *  \brief Arena of threads with limited concurrency that runs the computations of the algorithms it is set to.
+ *         Algorithms with different arenas run concurrently without oversubscription of the threads of the library.
+ *         The arena of one thread runs the computations inline in the calling thread
+ */
+class DAAL_EXPORT ThreadArena : public Base
+{
+public:
+    DAAL_NEW_DELETE();
+
+    /**
+     *  Constructs the arena
+     *  \param[in] nThreads  Maximal number of threads of the arena including the calling thread,
+     *                       0 means the number of threads available to the library
+     */
+    explicit ThreadArena(size_t nThreads = 0);
+
+    virtual ~ThreadArena();
+
+    /**
+     *  Returns the maximal number of threads of the arena
+     *  \return The maximal number of threads of the arena, 0 if the arena uses the number of threads available to the library
+     */
+    size_t getNumberOfThreads() const { return _nThreads; }
+
+private:
+    friend class daal::services::internal::ThreadArenaAccessor;
+
+    ThreadArena(const ThreadArena &);
+    ThreadArena & operator=(const ThreadArena &);
+
+    size_t _nThreads;
+    void * _arena;
+};
+typedef services::SharedPtr<ThreadArena> ThreadArenaPtr;
+
+} // namespace interface1
+using interface1::ThreadArena;
+using interface1::ThreadArenaPtr;
+
+} // namespace services
+} // namespace daal
+#endif //__DAAL_THREAD_ARENA_H__
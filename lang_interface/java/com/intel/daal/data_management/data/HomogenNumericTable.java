@@ -22,6 +22,7 @@
 package com.intel.daal.data_management.data;
 
 import com.intel.daal.utils.*;
+import java.nio.ByteBuffer;
 import java.nio.DoubleBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
@@ -288,6 +289,33 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl = new HomogenNumericTableByteBufferImpl(context, cTable);
     }
 
+    /**
+     * Constructs homogeneous numeric table that uses the memory of the direct byte buffer without copying.
+     * The values are stored in the buffer in the row-major layout and in the native byte order,
+     * the buffer is referenced by the table and must not be changed while the table is in use
+     *
+     * @param context                 Context to manage created homogeneous numeric table
+     * @param cls                     Numeric type of values in the table
+     * @param buffer                  Direct byte buffer with the values of the table
+     * @param nColumns                Number of columns in the table
+     * @param nRows                   Number of rows in the table
+     */
+    public HomogenNumericTable(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long nColumns, long nRows) {
+        super(context);
+        tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, buffer, nColumns, nRows);
+    }
+
+    /**
+     * Constructs homogeneous numeric table from the byte array created by SerializableBase.toByteArray()
+     *
+     * @param context   Context to manage created homogeneous numeric table
+     * @param data      Byte array with the serialized homogeneous numeric table
+     * @return Homogeneous numeric table restored from the byte array
+     */
+    public static HomogenNumericTable fromByteArray(DaalContext context, byte[] data) {
+        return new HomogenNumericTable(context, cDeserializeFromByteArray(data));
+    }
+
     /**
      * Constructs homogeneous numeric table without memory allocation
      *
@@ -488,6 +516,19 @@ public class HomogenNumericTable extends NumericTable {
         tableImpl = new HomogenNumericTableByteBufferImpl(context, cls, dict);
     }
 
+    /**
+     * Returns the direct byte buffer that refers to the memory of the table without copying.
+     * Available for the tables with data stored in the native memory
+     *
+     * @return Direct byte buffer with the values of the table in the row-major layout
+     */
+    public ByteBuffer getDataBuffer() {
+        if (!(tableImpl instanceof HomogenNumericTableByteBufferImpl)) {
+            throw new IllegalArgumentException("data of the table is stored in the Java array");
+        }
+        return ((HomogenNumericTableByteBufferImpl)tableImpl).getDataBuffer();
+    }
+
     /**
      * Fills a numeric table with a constant
      *
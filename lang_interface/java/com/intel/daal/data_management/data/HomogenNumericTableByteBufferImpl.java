@@ -40,6 +40,9 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
 
     private static final long maxBufferSize = 2147483647;
 
+    /* Direct byte buffer that holds the data of the table created without copying, kept to prevent its release */
+    private transient ByteBuffer dataBuffer = null;
+
     /** @private */
     static {
         LibUtils.loadLibrary();
@@ -120,6 +123,43 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         }
     }
 
+    /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,ByteBuffer,long,long) */
+    public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, ByteBuffer buffer, long nColumns, long nRows) {
+        super(context);
+        if (!buffer.isDirect()) {
+            throw new IllegalArgumentException("byte buffer must be direct");
+        }
+        long elementSize;
+        if (cls == Double.class) {
+            elementSize = 8;
+        } else if (cls == Float.class) {
+            elementSize = 4;
+        } else if (cls == Long.class) {
+            elementSize = 8;
+        } else if (cls == Integer.class) {
+            elementSize = 4;
+        } else {
+            throw new IllegalArgumentException("type unsupported");
+        }
+        if (buffer.capacity() < nColumns * nRows * elementSize) {
+            throw new IllegalArgumentException("byte buffer is smaller than the table");
+        }
+
+        if (cls == Double.class) {
+            cObject = dInitFromBuffer(buffer, nColumns, nRows);
+        } else if (cls == Float.class) {
+            cObject = sInitFromBuffer(buffer, nColumns, nRows);
+        } else if (cls == Long.class) {
+            cObject = lInitFromBuffer(buffer, nColumns, nRows);
+        } else {
+            cObject = iInitFromBuffer(buffer, nColumns, nRows);
+        }
+        dict = new DataDictionary(context, (long)0, cGetCDataDictionary(cObject));
+        type = cls;
+        dataAllocatedInJava = false;
+        dataBuffer = buffer;
+    }
+
     /** @copydoc HomogenNumericTable::HomogenNumericTable(DaalContext,Class<? extends Number>,DataDictionary) */
     public HomogenNumericTableByteBufferImpl(DaalContext context, Class<? extends Number> cls, DataDictionary dict) {
         super(context);
@@ -436,6 +476,26 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
         return buffer;
     }
 
+    /** @copydoc HomogenNumericTable::getDataBuffer() */
+    public ByteBuffer getDataBuffer() {
+        checkCObject();
+
+        ByteBuffer byteBuffer;
+        if (type == Double.class) {
+            byteBuffer = getDoubleBuffer(getCObject());
+        } else if (type == Float.class) {
+            byteBuffer = getFloatBuffer(getCObject());
+        } else if (type == Long.class) {
+            byteBuffer = getLongBuffer(getCObject());
+        } else if (type == Integer.class) {
+            byteBuffer = getIntBuffer(getCObject());
+        } else {
+            throw new IllegalArgumentException("type unsupported");
+        }
+        byteBuffer.order(ByteOrder.LITTLE_ENDIAN);
+        return byteBuffer;
+    }
+
     /** @copydoc HomogenNumericTable::getDataObject() */
     @Override
     public Object getDataObject() {
@@ -627,6 +687,11 @@ class HomogenNumericTableByteBufferImpl extends HomogenNumericTableImpl {
     private native long iInit(long nColumns, int featuresEqual);
     private native long dictInit(long cObject);
 
+    private native long dInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows);
+    private native long sInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows);
+    private native long lInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows);
+    private native long iInitFromBuffer(ByteBuffer buffer, long nColumns, long nRows);
+
     private native void cAllocateDataMemoryDouble(long cObject);
     private native void cAllocateDataMemoryFloat(long cObject);
     private native void cAllocateDataMemoryLong(long cObject);
@@ -147,6 +147,16 @@ public class SerializableBase extends ContextClient
         }
     }
 
+    /**
+     * Serializes the native object into the byte array without the Java object streams.
+     * The archive is copied directly to the memory of the array
+     *
+     * @return Byte array that contains the serialized native object
+     */
+    public byte[] toByteArray() {
+        return cSerializeToByteArray(getCObject());
+    }
+
     /**
      * Releases the memory allocated for the native object
      */
@@ -207,6 +217,11 @@ public class SerializableBase extends ContextClient
 
     private native long cDeserializeCObject(byte[][] byteArray);
 
+    private native byte[] cSerializeToByteArray(long cObject);
+
+    /* Returns the address of the native object restored from the byte array created by toByteArray() */
+    protected static native long cDeserializeFromByteArray(byte[] byteArray);
+
     private native void cFreeByteBuffer(ByteBuffer buffer);
 
     private native void cDispose(long parAddr);
@@ -107,6 +107,71 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumeric
     return (jlong)sPtr;
 }
 
+/* Creates the table that uses the memory of the direct byte buffer, the buffer is owned by Java */
+template <typename T>
+static jlong initFromDirectBuffer(JNIEnv * env, jobject byteBuffer, jlong nColumns, jlong nRows)
+{
+    T * data = static_cast<T *>(env->GetDirectBufferAddress(byteBuffer));
+    if (!data)
+    {
+        daal::throwError(env, "byte buffer is not direct");
+        return (jlong)0;
+    }
+
+    services::Status s;
+    NumericTablePtr tbl = HomogenNumericTable<T>::create(services::SharedPtr<T>(data, services::EmptyDeleter()), nColumns, nRows, &s);
+    if (!s)
+    {
+        DAAL_CHECK_THROW(s);
+        return (jlong)0;
+    }
+    return (jlong) new SerializationIfacePtr(tbl);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    dInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_dInitFromBuffer(
+    JNIEnv * env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows)
+{
+    return initFromDirectBuffer<double>(env, byteBuffer, nColumns, nRows);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    sInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_sInitFromBuffer(
+    JNIEnv * env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows)
+{
+    return initFromDirectBuffer<float>(env, byteBuffer, nColumns, nRows);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    lInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_lInitFromBuffer(
+    JNIEnv * env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows)
+{
+    return initFromDirectBuffer<__int64>(env, byteBuffer, nColumns, nRows);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
+ * Method:    iInitFromBuffer
+ * Signature:(Ljava/nio/ByteBuffer;JJ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl_iInitFromBuffer(
+    JNIEnv * env, jobject thisobj, jobject byteBuffer, jlong nColumns, jlong nRows)
+{
+    return initFromDirectBuffer<int>(env, byteBuffer, nColumns, nRows);
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_HomogenNumericTableByteBufferImpl
  * Method:    getDoubleBuffer
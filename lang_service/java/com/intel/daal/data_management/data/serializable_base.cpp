@@ -140,6 +140,75 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_SerializableBa
     return (jlong)sPtr;
 }
 
+/*
+ * Class:     com_intel_daal_data_1management_data_SerializableBase
+ * Method:    cSerializeToByteArray
+ * Signature: (J)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_intel_daal_data_1management_data_SerializableBase_cSerializeToByteArray(JNIEnv * env, jobject thisObj,
+                                                                                                             jlong ptr)
+{
+    SerializationIface * nt = (*(SerializationIfacePtr *)ptr).get();
+    InputDataArchive dataArch;
+    nt->serialize(dataArch);
+
+    if (dataArch.getErrors()->size() > 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), dataArch.getErrors()->getDescription());
+        return NULL;
+    }
+
+    const size_t length = dataArch.getSizeOfArchive();
+    if (length > 2147483647)
+    {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "size of the serialized object cannot exceed 2 gigabytes");
+        return NULL;
+    }
+
+    jbyteArray byteArray = env->NewByteArray((jsize)length);
+    if (!byteArray) return NULL;
+
+    /* The archive is copied directly to the memory of the Java array */
+    void * buffer = env->GetPrimitiveArrayCritical(byteArray, NULL);
+    if (!buffer) return NULL;
+    dataArch.copyArchiveToArray((daal::byte *)buffer, length);
+    env->ReleasePrimitiveArrayCritical(byteArray, buffer, 0);
+
+    return byteArray;
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_SerializableBase
+ * Method:    cDeserializeFromByteArray
+ * Signature: ([B)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_data_1management_data_SerializableBase_cDeserializeFromByteArray(JNIEnv * env, jclass thisClass,
+                                                                                                            jbyteArray byteArray)
+{
+    const size_t length = env->GetArrayLength(byteArray);
+
+    void * buffer = env->GetPrimitiveArrayCritical(byteArray, NULL);
+    if (!buffer) return (jlong)0;
+
+    SerializationIfacePtr * sPtr = new SerializationIfacePtr();
+    SharedPtr<ErrorCollection> errors;
+    {
+        OutputDataArchive dataArch((daal::byte *)buffer, length);
+        *sPtr  = dataArch.getAsSharedPtr();
+        errors = dataArch.getErrors();
+    }
+    env->ReleasePrimitiveArrayCritical(byteArray, buffer, JNI_ABORT);
+
+    if (errors->size() > 0)
+    {
+        env->ThrowNew(env->FindClass("java/lang/Exception"), errors->getDescription());
+        delete sPtr;
+        return (jlong)0;
+    }
+
+    return (jlong)sPtr;
+}
+
 /*
  * Class:     com_intel_daal_data_1management_data_SerializableBase
  * Method:    cDispose
@@ -19,4 +19,4 @@ rem ============================================================================
 ::     Intel(R) Data Analytics Acceleration Library samples list
 ::******************************************************************************
 
-set ARROW=datastructures_arrow
+set ARROW=datastructures_arrow datasource_arrow_stream
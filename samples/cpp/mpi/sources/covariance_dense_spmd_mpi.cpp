@@ -0,0 +1,149 @@
+/* file: covariance_dense_spmd_mpi.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ sample of dense variance-covariance matrix computation in the
+!    SPMD processing mode with the MPI communicator
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-SAMPLE-CPP-COVARIANCE_DENSE_SPMD"></a>
+ * \example covariance_dense_spmd_mpi.cpp
+ */
+
+#include <mpi.h>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+int rankId, comm_size;
+#define mpi_root 0
+
+const string datasetFileNames[] = { "./data/distributed/covcormoments_dense_1.csv", "./data/distributed/covcormoments_dense_2.csv",
+                                    "./data/distributed/covcormoments_dense_3.csv", "./data/distributed/covcormoments_dense_4.csv" };
+
+/* Communicator of the library implemented with the collective operations of MPI */
+class MPICommunicator : public services::CommunicatorIface
+{
+public:
+    MPICommunicator(MPI_Comm comm) : _comm(comm) {}
+
+    size_t getRank() const
+    {
+        int rank;
+        MPI_Comm_rank(_comm, &rank);
+        return (size_t)rank;
+    }
+
+    size_t getSize() const
+    {
+        int size;
+        MPI_Comm_size(_comm, &size);
+        return (size_t)size;
+    }
+
+    services::Status allreduce(double * buffer, size_t count, ReduceOp op) { return allreduceImpl(buffer, count, MPI_DOUBLE, op); }
+
+    services::Status allreduce(float * buffer, size_t count, ReduceOp op) { return allreduceImpl(buffer, count, MPI_FLOAT, op); }
+
+    services::Status allgather(const byte * sendBuffer, size_t nBytes, byte * recvBuffer)
+    {
+        return check(MPI_Allgather(const_cast<byte *>(sendBuffer), (int)nBytes, MPI_CHAR, recvBuffer, (int)nBytes, MPI_CHAR, _comm));
+    }
+
+    services::Status bcast(byte * buffer, size_t nBytes, size_t root) { return check(MPI_Bcast(buffer, (int)nBytes, MPI_CHAR, (int)root, _comm)); }
+
+    services::Status alltoallv(const byte * sendBuffer, const size_t * sendSizes, byte * recvBuffer, const size_t * recvSizes)
+    {
+        const size_t size = getSize();
+        vector<int> sendCounts(size), sendOffsets(size), recvCounts(size), recvOffsets(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            sendCounts[i]  = (int)sendSizes[i];
+            recvCounts[i]  = (int)recvSizes[i];
+            sendOffsets[i] = i ? sendOffsets[i - 1] + sendCounts[i - 1] : 0;
+            recvOffsets[i] = i ? recvOffsets[i - 1] + recvCounts[i - 1] : 0;
+        }
+        return check(MPI_Alltoallv(const_cast<byte *>(sendBuffer), &sendCounts[0], &sendOffsets[0], MPI_CHAR, recvBuffer, &recvCounts[0],
+                                   &recvOffsets[0], MPI_CHAR, _comm));
+    }
+
+private:
+    services::Status allreduceImpl(void * buffer, size_t count, MPI_Datatype type, ReduceOp op)
+    {
+        const MPI_Op mpiOp = (op == sum ? MPI_SUM : (op == min ? MPI_MIN : MPI_MAX));
+        return check(MPI_Allreduce(MPI_IN_PLACE, buffer, (int)count, type, mpiOp, _comm));
+    }
+
+    static services::Status check(int mpiStatus)
+    {
+        return mpiStatus == MPI_SUCCESS ? services::Status() : services::Status(services::ErrorIncorrectParameter);
+    }
+
+    MPI_Comm _comm;
+};
+
+int main(int argc, char * argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rankId);
+
+    {
+        /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+        FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[rankId], DataSource::doAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+        /* Retrieve the input data */
+        dataSource.loadDataBlock();
+
+        /* Create an algorithm to compute a variance-covariance matrix on all the processes */
+        covariance::Spmd<> algorithm(services::CommunicatorIfacePtr(new MPICommunicator(MPI_COMM_WORLD)));
+
+        /* Set the input data set of the process to the algorithm */
+        algorithm.input.set(covariance::data, dataSource.getNumericTable());
+
+        /* Compute a variance-covariance matrix, the partial results are combined by MPI_Allreduce */
+        services::Status status = algorithm.compute();
+        if (!status)
+        {
+            std::cout << "Error: " << status.getDescription() << std::endl;
+            MPI_Abort(MPI_COMM_WORLD, -1);
+        }
+
+        /* The result is the same on every process */
+        if (rankId == mpi_root)
+        {
+            covariance::ResultPtr result = algorithm.getResult();
+
+            /* Print the results */
+            printNumericTable(result->get(covariance::covariance), "Covariance matrix:");
+            printNumericTable(result->get(covariance::mean), "Mean vector:");
+        }
+    }
+
+    MPI_Finalize();
+
+    return 0;
+}
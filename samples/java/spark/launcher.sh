@@ -115,7 +115,7 @@ for sample in ${Spark_samples_list[@]}; do
     hadoop fs -put ./data/${sample}*.csv /Spark/${sample}/data/ >> _results/${sample}/${sample}.log 2>&1
 
     # Building samples
-    javac -d ./_results/${sample} -sourcepath ./ sources/*${sample}.java sources/DistributedHDFSDataSet.java
+    javac -d ./_results/${sample} -sourcepath ./ sources/*${sample}.java sources/DistributedHDFSDataSet.java sources/DistributedTreeReduce.java
     cd _results/${sample}
 
     # Creating jar
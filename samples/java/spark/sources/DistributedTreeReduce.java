@@ -0,0 +1,51 @@
+/* file: DistributedTreeReduce.java */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//  Content:
+//      Hierarchical reduction of the partial results of the distributed
+//      algorithms computed on the partitions of an RDD
+////////////////////////////////////////////////////////////////////////////////
+*/
+
+package DAAL;
+
+import org.apache.spark.api.java.*;
+import org.apache.spark.api.java.function.*;
+
+/**
+ * Reduces the partial results by a tree of merges executed on the executors.
+ * Each merge runs the step2 of the algorithm on two partial results in the native code,
+ * the driver receives only the final partial result and never the archives of all partitions.
+ */
+public class DistributedTreeReduce {
+    /* Maximal number of partial results merged by one task at a level of the tree */
+    private static final int maxFanIn = 8;
+
+    public static <T> T reduce(JavaRDD<T> partsRDD, Function2<T, T, T> merge) {
+        return partsRDD.treeReduce(merge, treeDepth(partsRDD.partitions().size()));
+    }
+
+    /* Returns the depth of the tree with at most maxFanIn partial results merged by a task */
+    public static int treeDepth(int nPartitions) {
+        int depth = 1;
+        for (long nMerged = maxFanIn; nMerged < nPartitions; nMerged *= maxFanIn) {
+            depth++;
+        }
+        return Math.max(depth, 2);
+    }
+}
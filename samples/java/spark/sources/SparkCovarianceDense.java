@@ -78,7 +78,7 @@ public class SparkCovarianceDense {
     }
 
     private static PartialResult reducePartialResults(DaalContext context, JavaRDD<PartialResult> partsRDD) {
-        return partsRDD.reduce(new Function2<PartialResult, PartialResult, PartialResult>() {
+        return DistributedTreeReduce.reduce(partsRDD, new Function2<PartialResult, PartialResult, PartialResult>() {
             public PartialResult call(PartialResult pr1, PartialResult pr2) {
                 DaalContext localContext = new DaalContext();
 
@@ -153,14 +153,30 @@ public class SparkKmeansDense {
         /* Create an algorithm to compute k-means on the master node */
         DistributedStep2Master kmeansMaster = new DistributedStep2Master(context, Double.class, Method.defaultDense, nClusters);
 
-        /* Set the partial result to the master algorithm to compute the final result */
-        List<PartialResult> partResList = partResRDD.collect();
-        for (PartialResult value : partResList) {
-            if(value != null) {
-                value.unpack(context);
-                kmeansMaster.input.add(DistributedStep2MasterInputId.partialResults, value);
+        /* Merge the partial results on the executors, only the reduced partial result is sent to the master node */
+        PartialResult reducedPres = DistributedTreeReduce.reduce(partResRDD, new Function2<PartialResult, PartialResult, PartialResult>() {
+            public PartialResult call(PartialResult pr1, PartialResult pr2) {
+                DaalContext localContext = new DaalContext();
+
+                /* Create an algorithm to compute new partial result from two partial results */
+                DistributedStep2Master kmeansMerge = new DistributedStep2Master(localContext, Double.class, Method.defaultDense, nClusters);
+
+                pr1.unpack(localContext);
+                pr2.unpack(localContext);
+                kmeansMerge.input.add(DistributedStep2MasterInputId.partialResults, pr1);
+                kmeansMerge.input.add(DistributedStep2MasterInputId.partialResults, pr2);
+
+                PartialResult pres = kmeansMerge.compute();
+                pres.pack();
+
+                localContext.dispose();
+                return pres;
             }
-        }
+        });
+
+        /* Set the partial result to the master algorithm to compute the final result */
+        reducedPres.unpack(context);
+        kmeansMaster.input.add(DistributedStep2MasterInputId.partialResults, reducedPres);
 
         /* Compute k-means on the master node */
         kmeansMaster.compute();
@@ -92,7 +92,7 @@ public class SparkLowOrderMomentsCSR {
     }
 
     private static PartialResult reducePartialResults(JavaRDD<PartialResult> partsRDD) {
-        return partsRDD.reduce(new Function2<PartialResult, PartialResult, PartialResult>() {
+        return DistributedTreeReduce.reduce(partsRDD, new Function2<PartialResult, PartialResult, PartialResult>() {
             public PartialResult call(PartialResult p1, PartialResult p2) {
                 DaalContext context = new DaalContext();
 
@@ -101,7 +101,7 @@ public class SparkNaiveBayesCSR {
     }
 
     private static TrainingPartialResult reducePartialResults(JavaRDD<TrainingPartialResult> partsRDD) {
-        return partsRDD.reduce(new Function2<TrainingPartialResult, TrainingPartialResult, TrainingPartialResult>() {
+        return DistributedTreeReduce.reduce(partsRDD, new Function2<TrainingPartialResult, TrainingPartialResult, TrainingPartialResult>() {
             public TrainingPartialResult call(TrainingPartialResult p1, TrainingPartialResult p2) {
                 DaalContext context = new DaalContext();
 
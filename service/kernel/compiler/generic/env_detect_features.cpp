@@ -237,6 +237,79 @@ static int check_ssse3_features()
     return 1;
 }
 
+static int check_avx512_vnni_features()
+{
+    /* CPUID.(EAX=07H, ECX=0H):ECX.AVX512_VNNI[bit 11]==1 */
+    uint32_t avx512_vnni_mask = (1 << 11);
+
+    return check_cpuid(7, 0, 2, avx512_vnni_mask);
+}
+
+static int check_avx512_bf16_features()
+{
+    /* CPUID.(EAX=07H, ECX=0H):EAX.MaxSubleaf >= 1 &&
+       CPUID.(EAX=07H, ECX=1H):EAX.AVX512_BF16[bit 5]==1 */
+    uint32_t abcd[4];
+    run_cpuid(7, 0, abcd);
+    if (abcd[0] < 1)
+    {
+        return 0;
+    }
+
+    uint32_t avx512_bf16_mask = (1 << 5);
+
+    return check_cpuid(7, 1, 0, avx512_bf16_mask);
+}
+
+static int check_amx_features(uint32_t amx_mask)
+{
+    /*
+    60000H - XTILECFG and XTILEDATA state are enabled by OS
+    */
+    uint32_t xtile_mask = 0x60000;
+
+    if (!check_xgetbv_xcr0_ymm(xtile_mask))
+    {
+        return 0;
+    }
+
+    return check_cpuid(7, 0, 3, amx_mask);
+}
+
+int __daal_serv_cpu_feature_detect()
+{
+    int features = daal::internal::cpu_feature_unknown;
+
+    if (!check_avx512_features())
+    {
+        return features;
+    }
+
+    if (check_avx512_vnni_features())
+    {
+        features |= daal::internal::cpu_feature_avx512_vnni;
+    }
+
+    if (check_avx512_bf16_features())
+    {
+        features |= daal::internal::cpu_feature_avx512_bf16;
+    }
+
+    /* CPUID.(EAX=07H, ECX=0H):EDX.AMX_BF16[bit 22]==1 && CPUID.(EAX=07H, ECX=0H):EDX.AMX_TILE[bit 24]==1 */
+    if (check_amx_features((1 << 22) | (1 << 24)))
+    {
+        features |= daal::internal::cpu_feature_amx_bf16;
+    }
+
+    /* CPUID.(EAX=07H, ECX=0H):EDX.AMX_TILE[bit 24]==1 && CPUID.(EAX=07H, ECX=0H):EDX.AMX_INT8[bit 25]==1 */
+    if (check_amx_features((1 << 24) | (1 << 25)))
+    {
+        features |= daal::internal::cpu_feature_amx_int8;
+    }
+
+    return features;
+}
+
 int __daal_serv_cpu_detect(int enable)
 {
     if ((enable & daal::services::Environment::avx512_mic_e1) == daal::services::Environment::avx512_mic_e1)
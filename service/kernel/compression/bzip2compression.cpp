@@ -138,6 +138,13 @@ void Compressor<bzip2>::initialize()
     _isInitialized = true;
 }
 
+Compressor<bzip2> * Compressor<bzip2>::cloneImpl() const
+{
+    Compressor<bzip2> * compressor = new Compressor<bzip2>();
+    compressor->parameter          = parameter;
+    return compressor;
+}
+
 Compressor<bzip2>::~Compressor()
 {
     (void)CompressEnd(((bz_stream *)_strmp));
@@ -344,6 +351,13 @@ Decompressor<bzip2>::Decompressor() : data_management::DecompressorImpl()
     _isInitialized        = true;
 }
 
+Decompressor<bzip2> * Decompressor<bzip2>::cloneImpl() const
+{
+    Decompressor<bzip2> * decompressor = new Decompressor<bzip2>();
+    decompressor->parameter            = parameter;
+    return decompressor;
+}
+
 Decompressor<bzip2>::~Decompressor()
 {
     (void)DecompressEnd(((bz_stream *)_strmp));
@@ -22,6 +22,7 @@
 */
 
 #include "data_management/compression/compression_stream.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -567,5 +568,739 @@ size_t DecompressionStream::getDecompressedDataSize()
     return _decompressedDataSize;
 }
 
+
+/* Layout of the data produced by ParallelCompressionStream:
+   signature, number of chunks, chunk size, then a pair {raw size, compressed size} for each chunk,
+   all stored as 64-bit unsigned integers, followed by the compressed chunks in the order of the raw data */
+static const DAAL_UINT64 chunkIndexSignature = 0x5844494b4e554843ULL;
+static const size_t chunkIndexHeaderWords    = 3;
+
+class ParallelChunk
+{
+public:
+    explicit ParallelChunk(size_t capacity)
+        : raw((byte *)daal::services::daal_malloc(capacity)), rawSize(0), compressed(NULL), compressedSize(0), isCompressed(false)
+    {}
+
+    ~ParallelChunk()
+    {
+        daal::services::daal_free(raw);
+        daal::services::daal_free(compressed);
+    }
+
+    byte * raw;
+    size_t rawSize;
+    byte * compressed;
+    size_t compressedSize;
+    bool isCompressed;
+};
+
+typedef services::SharedPtr<ParallelChunk> ParallelChunkPtr;
+typedef services::Collection<ParallelChunkPtr> ParallelChunkCollection;
+typedef services::Collection<DAAL_UINT64> ChunkIndexWords;
+
+struct ChunkInfo
+{
+    size_t rawOffset;
+    size_t rawSize;
+    size_t dataOffset;
+    size_t dataSize;
+};
+
+typedef services::Collection<ChunkInfo> ChunkInfoCollection;
+
+/* Compresses the raw data of the chunk into the buffer that is grown while the compressor reports it is full.
+   Errors are collected by the compressor */
+static void compressChunk(CompressorImpl & compressor, ParallelChunk & chunk)
+{
+    size_t capacity = chunk.rawSize + chunk.rawSize / 8 + 1024;
+    byte * out      = (byte *)daal::services::daal_malloc(capacity);
+    if (out == NULL)
+    {
+        compressor.getErrors()->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    compressor.setInputDataBlock(chunk.raw, chunk.rawSize, 0);
+    size_t used = 0;
+    while (compressor.getErrors()->size() == 0)
+    {
+        compressor.run(out, capacity - used, used);
+        used += compressor.getUsedOutputDataBlockSize();
+        if (!compressor.isOutputDataBlockFull())
+        {
+            break;
+        }
+
+        byte * grown = (byte *)daal::services::daal_malloc(2 * capacity);
+        if (grown == NULL || (used && daal::services::internal::daal_memcpy_s(grown, 2 * capacity, out, used)))
+        {
+            daal::services::daal_free(grown);
+            compressor.getErrors()->add(services::ErrorMemoryAllocationFailed);
+            break;
+        }
+        daal::services::daal_free(out);
+        out = grown;
+        capacity *= 2;
+    }
+
+    if (compressor.getErrors()->size() != 0)
+    {
+        daal::services::daal_free(out);
+        return;
+    }
+
+    daal::services::daal_free(chunk.raw);
+    chunk.raw            = NULL;
+    chunk.compressed     = out;
+    chunk.compressedSize = used;
+    chunk.isCompressed   = true;
+}
+
+/* Decompresses the chunk into the buffer of outSize bytes and returns the number of the decompressed bytes.
+   The returned value exceeds outSize if the chunk holds more data than the buffer fits */
+static size_t decompressChunk(DecompressorImpl & decompressor, byte * in, size_t inSize, byte * out, size_t outSize)
+{
+    byte scratch[64];
+    decompressor.setInputDataBlock(in, inSize, 0);
+    size_t used = 0;
+    do
+    {
+        if (used < outSize)
+        {
+            decompressor.run(out, outSize - used, used);
+            used += decompressor.getUsedOutputDataBlockSize();
+        }
+        else
+        {
+            decompressor.run(scratch, sizeof(scratch), 0);
+            const size_t extra = decompressor.getUsedOutputDataBlockSize();
+            used += extra;
+            if (extra == 0 || used > outSize)
+            {
+                break;
+            }
+        }
+    } while (decompressor.isOutputDataBlockFull() && decompressor.getErrors()->size() == 0);
+    return used;
+}
+
+//parallel compression stream realization
+ParallelCompressionStream::ParallelCompressionStream(CompressorImpl * compr, size_t chunkSize)
+    : _chunks(NULL),
+      _index(NULL),
+      _compressor(NULL),
+      _chunkSize(0),
+      _nCompressedChunks(0),
+      _isFinalized(false),
+      _readPos(0),
+      _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (compr == NULL)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    if (chunkSize == 0)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _compressor = compr;
+    _chunkSize  = chunkSize;
+    _chunks     = (void *)new ParallelChunkCollection;
+    _index      = (void *)new ChunkIndexWords;
+}
+
+ParallelCompressionStream::~ParallelCompressionStream()
+{
+    delete (ParallelChunkCollection *)_chunks;
+    delete (ChunkIndexWords *)_index;
+    _chunks = NULL;
+    _index  = NULL;
+}
+
+void ParallelCompressionStream::compressChunks(size_t nChunks)
+{
+    if (this->_errors->size() != 0 || nChunks <= _nCompressedChunks)
+    {
+        return;
+    }
+
+    ParallelChunkCollection & chunks = *(ParallelChunkCollection *)_chunks;
+    const size_t first               = _nCompressedChunks;
+    const size_t nNew                = nChunks - first;
+
+    services::Collection<services::SharedPtr<CompressorImpl> > compressors(nNew);
+    if (compressors.size() != nNew)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    compressors[0] = _compressor->clone();
+    if (compressors[0])
+    {
+        daal::threader_for(nNew, nNew, [&](int i) {
+            if (i > 0)
+            {
+                compressors[i] = _compressor->clone();
+            }
+            if (compressors[i])
+            {
+                compressChunk(*compressors[i], *chunks[first + i]);
+            }
+        });
+
+        for (size_t i = 0; i < nNew; i++)
+        {
+            if (!compressors[i])
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            if (compressors[i]->getErrors()->size() != 0)
+            {
+                this->_errors->add(*(compressors[i]->getErrors()));
+                return;
+            }
+        }
+    }
+    else
+    {
+        /* The compressor cannot be copied, the chunks are compressed one by one */
+        for (size_t i = 0; i < nNew; i++)
+        {
+            compressChunk(*_compressor, *chunks[first + i]);
+            if (_compressor->getErrors()->size() != 0)
+            {
+                this->_errors->add(*(_compressor->getErrors()));
+                return;
+            }
+        }
+    }
+    _nCompressedChunks = nChunks;
+}
+
+void ParallelCompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    //checkParams;
+    if (block == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    size_t inSize = block->getSize();
+    if (inSize == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if (_isFinalized)
+    {
+        this->_errors->add(services::ErrorCompressionStreamFinalized);
+        return;
+    }
+    //end checkParams;
+
+    ParallelChunkCollection & chunks = *(ParallelChunkCollection *)_chunks;
+    const size_t nThreads            = daal::threader_get_threads_number();
+
+    byte * inPtr = block->getPtr();
+    while (inSize > 0)
+    {
+        if (chunks.size() == 0 || chunks[chunks.size() - 1]->rawSize == _chunkSize)
+        {
+            ParallelChunkPtr chunk(new ParallelChunk(_chunkSize));
+            if (chunk->raw == NULL)
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            chunks.push_back(chunk);
+        }
+
+        ParallelChunk & chunk = *chunks[chunks.size() - 1];
+        const size_t copySize = inSize > _chunkSize - chunk.rawSize ? _chunkSize - chunk.rawSize : inSize;
+
+        int result = daal::services::internal::daal_memcpy_s((void *)(chunk.raw + chunk.rawSize), copySize, (void *)inPtr, copySize);
+        if (result)
+        {
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        chunk.rawSize += copySize;
+        inPtr += copySize;
+        inSize -= copySize;
+
+        /* Full chunks are compressed in parallel as soon as there are enough of them to occupy all the threads */
+        if (chunk.rawSize == _chunkSize && chunks.size() - _nCompressedChunks >= nThreads)
+        {
+            compressChunks(chunks.size());
+            if (this->_errors->size() != 0)
+            {
+                return;
+            }
+        }
+    }
+}
+
+void ParallelCompressionStream::finalize()
+{
+    if (_isFinalized || this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    ParallelChunkCollection & chunks = *(ParallelChunkCollection *)_chunks;
+    compressChunks(chunks.size());
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    ChunkIndexWords & index = *(ChunkIndexWords *)_index;
+    index.clear();
+    index.push_back(chunkIndexSignature);
+    index.push_back((DAAL_UINT64)chunks.size());
+    index.push_back((DAAL_UINT64)_chunkSize);
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        index.push_back((DAAL_UINT64)chunks[i]->rawSize);
+        index.push_back((DAAL_UINT64)chunks[i]->compressedSize);
+    }
+    if (index.size() != chunkIndexHeaderWords + 2 * chunks.size())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    _isFinalized = true;
+}
+
+size_t ParallelCompressionStream::getNumberOfChunks()
+{
+    finalize();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    return (*(ParallelChunkCollection *)_chunks).size();
+}
+
+size_t ParallelCompressionStream::getCompressedDataSize()
+{
+    finalize();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+
+    ParallelChunkCollection & chunks = *(ParallelChunkCollection *)_chunks;
+    size_t compressedDataSize        = (*(ChunkIndexWords *)_index).size() * sizeof(DAAL_UINT64);
+    for (size_t i = 0; i < chunks.size(); i++)
+    {
+        compressedDataSize += chunks[i]->compressedSize;
+    }
+    return compressedDataSize - _readPos;
+}
+
+size_t ParallelCompressionStream::copyCompressedArray(byte * ptr, size_t size)
+{
+    finalize();
+    if (this->_errors->size() != 0)
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    ParallelChunkCollection & chunks = *(ParallelChunkCollection *)_chunks;
+    ChunkIndexWords & index          = *(ChunkIndexWords *)_index;
+
+    size_t readSize = 0;
+    int result      = 0;
+
+    /* _readPos is the position in the virtual concatenation of the chunk index and the compressed chunks */
+    size_t partBegin = 0;
+    for (size_t part = 0; part <= chunks.size() && readSize < size; part++)
+    {
+        const byte * partPtr  = part == 0 ? (const byte *)index.data() : chunks[part - 1]->compressed;
+        const size_t partSize = part == 0 ? index.size() * sizeof(DAAL_UINT64) : chunks[part - 1]->compressedSize;
+        const size_t partEnd  = partBegin + partSize;
+
+        if (_readPos < partEnd)
+        {
+            const size_t availSize = partEnd - _readPos;
+            const size_t rs        = size - readSize > availSize ? availSize : size - readSize;
+
+            result |= daal::services::internal::daal_memcpy_s((void *)(ptr + readSize), rs, (void *)(partPtr + (_readPos - partBegin)), rs);
+            readSize += rs;
+            _readPos += rs;
+        }
+        partBegin = partEnd;
+    }
+
+    if (result)
+    {
+        this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+    }
+    return readSize;
+}
+
+//parallel decompression stream realization
+ParallelDecompressionStream::ParallelDecompressionStream(DecompressorImpl * decompr)
+    : _data(NULL),
+      _index(NULL),
+      _decompressor(NULL),
+      _dataSize(0),
+      _dataCapacity(0),
+      _nChunks(0),
+      _readPos(0),
+      _errors(new services::ErrorCollection())
+{
+    this->_errors->setCanThrow(false);
+    if (decompr == NULL)
+    {
+        this->_errors->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    _decompressor = decompr;
+}
+
+ParallelDecompressionStream::~ParallelDecompressionStream()
+{
+    daal::services::daal_free(_data);
+    delete (ChunkInfoCollection *)_index;
+    _data  = NULL;
+    _index = NULL;
+}
+
+void ParallelDecompressionStream::push_back(DataBlock * block)
+{
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+    //checkParams;
+    if (block == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if (block->getPtr() == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    size_t inSize = block->getSize();
+    if (inSize == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    if (_index)
+    {
+        this->_errors->add(services::ErrorCompressionStreamFinalized);
+        return;
+    }
+    //end checkParams;
+
+    if (_dataSize + inSize > _dataCapacity)
+    {
+        size_t capacity = _dataCapacity ? 2 * _dataCapacity : inSize;
+        if (capacity < _dataSize + inSize)
+        {
+            capacity = _dataSize + inSize;
+        }
+        byte * grown = (byte *)daal::services::daal_malloc(capacity);
+        if (grown == NULL)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        if (_dataSize && daal::services::internal::daal_memcpy_s(grown, capacity, _data, _dataSize))
+        {
+            daal::services::daal_free(grown);
+            this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+            return;
+        }
+        daal::services::daal_free(_data);
+        _data         = (void *)grown;
+        _dataCapacity = capacity;
+    }
+
+    int result = daal::services::internal::daal_memcpy_s((void *)((byte *)_data + _dataSize), inSize, (void *)block->getPtr(), inSize);
+    if (result)
+    {
+        this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+        return;
+    }
+    _dataSize += inSize;
+}
+
+bool ParallelDecompressionStream::readIndex()
+{
+    if (this->_errors->size() != 0)
+    {
+        return false;
+    }
+    if (_index)
+    {
+        return true;
+    }
+
+    const size_t wordSize = sizeof(DAAL_UINT64);
+    if (_dataSize < chunkIndexHeaderWords * wordSize)
+    {
+        this->_errors->add(services::ErrorCompressionIncompleteStream);
+        return false;
+    }
+
+    DAAL_UINT64 header[chunkIndexHeaderWords];
+    daal::services::internal::daal_memcpy_s(header, sizeof(header), _data, sizeof(header));
+    const DAAL_UINT64 maxChunks = (DAAL_UINT64)(_dataSize / (2 * wordSize));
+    if (header[0] != chunkIndexSignature || header[1] > maxChunks || header[2] == 0)
+    {
+        this->_errors->add(services::ErrorCompressionChunkIndexCorrupted);
+        return false;
+    }
+
+    const size_t nChunks   = (size_t)header[1];
+    const size_t chunkSize = (size_t)header[2];
+    const size_t indexSize = (chunkIndexHeaderWords + 2 * nChunks) * wordSize;
+    if (_dataSize < indexSize)
+    {
+        this->_errors->add(services::ErrorCompressionIncompleteStream);
+        return false;
+    }
+
+    ChunkInfoCollection * index = new ChunkInfoCollection(nChunks);
+    if (index->size() != nChunks)
+    {
+        delete index;
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+
+    const byte * words = (const byte *)_data + chunkIndexHeaderWords * wordSize;
+    size_t rawOffset   = 0;
+    size_t dataOffset  = indexSize;
+    for (size_t i = 0; i < nChunks; i++)
+    {
+        DAAL_UINT64 sizes[2];
+        daal::services::internal::daal_memcpy_s(sizes, sizeof(sizes), words + 2 * i * wordSize, sizeof(sizes));
+        if (sizes[0] == 0 || sizes[0] > chunkSize || sizes[1] == 0)
+        {
+            delete index;
+            this->_errors->add(services::ErrorCompressionChunkIndexCorrupted);
+            return false;
+        }
+        if (sizes[1] > (DAAL_UINT64)(_dataSize - dataOffset))
+        {
+            delete index;
+            this->_errors->add(services::ErrorCompressionIncompleteStream);
+            return false;
+        }
+        ChunkInfo & info = (*index)[i];
+        info.rawOffset   = rawOffset;
+        info.rawSize     = (size_t)sizes[0];
+        info.dataOffset  = dataOffset;
+        info.dataSize    = (size_t)sizes[1];
+        rawOffset += info.rawSize;
+        dataOffset += info.dataSize;
+    }
+    if (dataOffset != _dataSize)
+    {
+        delete index;
+        this->_errors->add(services::ErrorCompressionChunkIndexCorrupted);
+        return false;
+    }
+
+    _index   = (void *)index;
+    _nChunks = nChunks;
+    return true;
+}
+
+size_t ParallelDecompressionStream::getNumberOfChunks()
+{
+    return readIndex() ? _nChunks : 0;
+}
+
+size_t ParallelDecompressionStream::getDecompressedDataSize()
+{
+    if (!readIndex() || _nChunks == 0)
+    {
+        return 0;
+    }
+    const ChunkInfo & last = (*(ChunkInfoCollection *)_index)[_nChunks - 1];
+    return last.rawOffset + last.rawSize;
+}
+
+size_t ParallelDecompressionStream::copyDecompressedArray(byte * ptr, size_t size)
+{
+    const size_t readSize = copyDecompressedArray(_readPos, ptr, size);
+    _readPos += readSize;
+    return readSize;
+}
+
+size_t ParallelDecompressionStream::copyDecompressedArray(size_t offset, byte * ptr, size_t size)
+{
+    if (!readIndex())
+    {
+        return 0;
+    }
+    //checkParams;
+    if (ptr == NULL)
+    {
+        this->_errors->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if (size == 0)
+    {
+        this->_errors->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    const size_t totalSize = getDecompressedDataSize();
+    if (offset >= totalSize)
+    {
+        return 0;
+    }
+    const size_t readSize = size > totalSize - offset ? totalSize - offset : size;
+
+    /* Find the range of the chunks that overlap with [offset, offset + readSize) */
+    ChunkInfoCollection & index = *(ChunkInfoCollection *)_index;
+    size_t first                = 0;
+    size_t last                 = _nChunks;
+    while (last - first > 1)
+    {
+        const size_t middle = (first + last) / 2;
+        if (index[middle].rawOffset <= offset)
+        {
+            first = middle;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    last = first;
+    while (last < _nChunks && index[last].rawOffset < offset + readSize)
+    {
+        last++;
+    }
+    const size_t nRequested = last - first;
+
+    services::Collection<services::SharedPtr<DecompressorImpl> > decompressors(nRequested);
+    services::Collection<size_t> decompressedSizes(nRequested);
+    if (decompressors.size() != nRequested || decompressedSizes.size() != nRequested)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return 0;
+    }
+
+    /* The chunks that lie inside the requested range are decompressed directly into the output array,
+       the chunks on the borders of the range are decompressed into temporary buffers */
+    byte * const data  = (byte *)_data;
+    auto processChunk = [&](DecompressorImpl & decompressor, size_t i) {
+        const ChunkInfo & info = index[first + i];
+        const bool isInside    = info.rawOffset >= offset && info.rawOffset + info.rawSize <= offset + readSize;
+        byte * out             = isInside ? ptr + (info.rawOffset - offset) : (byte *)daal::services::daal_malloc(info.rawSize);
+        if (out == NULL)
+        {
+            decompressor.getErrors()->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        decompressedSizes[i] = decompressChunk(decompressor, data + info.dataOffset, info.dataSize, out, info.rawSize);
+
+        if (!isInside)
+        {
+            const size_t copyBegin = info.rawOffset < offset ? offset : info.rawOffset;
+            const size_t copyEnd   = info.rawOffset + info.rawSize < offset + readSize ? info.rawOffset + info.rawSize : offset + readSize;
+            if (decompressedSizes[i] == info.rawSize
+                && daal::services::internal::daal_memcpy_s(ptr + (copyBegin - offset), copyEnd - copyBegin, out + (copyBegin - info.rawOffset),
+                                                           copyEnd - copyBegin))
+            {
+                decompressor.getErrors()->add(services::ErrorMemoryCopyFailedInternal);
+            }
+            daal::services::daal_free(out);
+        }
+    };
+
+    decompressors[0] = _decompressor->clone();
+    if (decompressors[0])
+    {
+        daal::threader_for(nRequested, nRequested, [&](int i) {
+            if (i > 0)
+            {
+                decompressors[i] = _decompressor->clone();
+            }
+            if (decompressors[i])
+            {
+                processChunk(*decompressors[i], i);
+            }
+        });
+    }
+    else
+    {
+        /* The decompressor cannot be copied, the chunks are decompressed one by one */
+        for (size_t i = 0; i < nRequested; i++)
+        {
+            processChunk(*_decompressor, i);
+            if (_decompressor->getErrors()->size() != 0)
+            {
+                this->_errors->add(*(_decompressor->getErrors()));
+                return 0;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < nRequested; i++)
+    {
+        if (decompressors[0])
+        {
+            if (!decompressors[i])
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return 0;
+            }
+            if (decompressors[i]->getErrors()->size() != 0)
+            {
+                this->_errors->add(*(decompressors[i]->getErrors()));
+                return 0;
+            }
+        }
+        if (decompressedSizes[i] != index[first + i].rawSize)
+        {
+            this->_errors->add(services::ErrorCompressionChunkIndexCorrupted);
+            return 0;
+        }
+    }
+    return readSize;
+}
+
 } //namespace data_management
 } //namespace daal
@@ -0,0 +1,424 @@
+/* file: lz4compression.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of LZ4 (de-)compression method.
+//--
+*/
+
+#include "data_management/compression/lz4compression.h"
+#include "ipp.h"
+#include "services/daal_memory.h"
+
+#if defined(_MSC_VER)
+    #define EXPECT(x, y) (x)
+#else
+    #define EXPECT(x, y) (__builtin_expect((x), (y)))
+#endif
+
+#define BLOCK_HEADER_BYTES 8
+
+/* The largest input block accepted by the LZ4 block format */
+#define MAX_BLOCK_BYTES 0x7E000000
+
+/* The worst-case size of the LZ4 compressed block */
+#define LZ4_BOUND_EXTRA_BYTES 16
+#define LZ4_BOUND(size)       ((size) + (size) / 255 + LZ4_BOUND_EXTRA_BYTES)
+
+namespace daal
+{
+namespace data_management
+{
+Compressor<lz4>::Compressor() : data_management::CompressorImpl()
+{
+    int hashTableSize = 0;
+
+    _preHeadBytes  = parameter.preHeadBytes;
+    _postHeadBytes = parameter.postHeadBytes;
+
+    _next_in      = NULL;
+    _avail_in     = 0;
+    _next_out     = NULL;
+    _avail_out    = 0;
+    _p_hash_table = NULL;
+
+    ippInit();
+    int errCode = ippsEncodeLZ4HashTableGetSize_8u(&hashTableSize);
+    if (errCode != ippStsNoErr)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+    _p_hash_table = (void *)daal::services::daal_calloc((size_t)hashTableSize);
+    if (_p_hash_table == NULL)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    _isInitialized = false;
+}
+
+void Compressor<lz4>::initialize()
+{
+    _preHeadBytes  = parameter.preHeadBytes;
+    _postHeadBytes = parameter.postHeadBytes;
+    _isInitialized = true;
+}
+
+Compressor<lz4> * Compressor<lz4>::cloneImpl() const
+{
+    Compressor<lz4> * compressor = new Compressor<lz4>();
+    compressor->parameter        = parameter;
+    return compressor;
+}
+
+Compressor<lz4>::~Compressor()
+{
+    if (_p_hash_table) daal::services::daal_free(_p_hash_table);
+    _p_hash_table = NULL;
+}
+
+void Compressor<lz4>::finalizeCompression()
+{
+    daal::services::daal_free(_p_hash_table);
+    _p_hash_table         = NULL;
+    this->_isOutBlockFull = 0;
+    _next_in              = NULL;
+    _avail_in             = 0;
+    _next_out             = NULL;
+    _avail_out            = 0;
+}
+
+void Compressor<lz4>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    checkInputParams(in, len);
+    if (this->_errors->size() != 0)
+    {
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Compressor<lz4>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false || _p_hash_table == NULL)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    _avail_out              = outLen;
+    _next_out               = out + off;
+    this->_isOutBlockFull   = 0;
+    this->_usedOutBlockSize = 0;
+
+    const size_t headBytes = BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes;
+    if (_avail_out < headBytes + LZ4_BOUND_EXTRA_BYTES + 2)
+    {
+        finalizeCompression();
+        this->_errors->add(services::ErrorLz4OutputStreamSizeIsNotEnough);
+        return;
+    }
+
+    /* Compress as much of the input as is guaranteed to fit into the output block */
+    size_t blockSize = (_avail_in < MAX_BLOCK_BYTES) ? _avail_in : MAX_BLOCK_BYTES;
+    if (_avail_out < headBytes + LZ4_BOUND(blockSize))
+    {
+        blockSize = ((_avail_out - headBytes - LZ4_BOUND_EXTRA_BYTES) * 255) / 256;
+    }
+
+    int tmp_avail_in  = (int)blockSize;
+    int tmp_avail_out = (int)((_avail_out - headBytes < LZ4_BOUND(MAX_BLOCK_BYTES)) ? _avail_out - headBytes : LZ4_BOUND(MAX_BLOCK_BYTES));
+    int errCode       = ippsEncodeLZ4HashTableInit_8u((Ipp8u *)_p_hash_table, tmp_avail_in);
+    if (errCode == ippStsNoErr)
+    {
+        errCode = ippsEncodeLZ4_8u((const Ipp8u *)(_next_in), tmp_avail_in, (Ipp8u *)((byte *)(_next_out) + headBytes), &tmp_avail_out,
+                                   (Ipp8u *)_p_hash_table);
+    }
+    if (errCode != ippStsNoErr)
+    {
+        finalizeCompression();
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+    _avail_out                                         = _avail_out - tmp_avail_out - headBytes;
+    ((Ipp32u *)((byte *)_next_out + _preHeadBytes))[0] = (Ipp32u)tmp_avail_in;
+    ((Ipp32u *)((byte *)_next_out + _preHeadBytes))[1] = (Ipp32u)tmp_avail_out;
+    this->_usedOutBlockSize += headBytes;
+    this->_usedOutBlockSize += tmp_avail_out;
+    _avail_in = _avail_in - tmp_avail_in;
+    if (_avail_in > 0)
+    {
+        _next_in              = (void *)((byte *)(_next_in) + tmp_avail_in);
+        this->_isOutBlockFull = 1;
+    }
+}
+
+Decompressor<lz4>::Decompressor() : data_management::DecompressorImpl()
+{
+    _next_in              = NULL;
+    _avail_in             = 0;
+    _next_out             = NULL;
+    _avail_out            = 0;
+    this->_isOutBlockFull = 0;
+    _internalBuff         = NULL;
+    _internalBuffOff      = 0;
+    _internalBuffLen      = 0;
+
+    _preHeadBytes  = parameter.preHeadBytes;
+    _postHeadBytes = parameter.postHeadBytes;
+
+    ippInit();
+    _isInitialized = false;
+}
+
+void Decompressor<lz4>::initialize()
+{
+    _preHeadBytes  = parameter.preHeadBytes;
+    _postHeadBytes = parameter.postHeadBytes;
+    _isInitialized = true;
+}
+
+Decompressor<lz4> * Decompressor<lz4>::cloneImpl() const
+{
+    Decompressor<lz4> * decompressor = new Decompressor<lz4>();
+    decompressor->parameter          = parameter;
+    return decompressor;
+}
+
+Decompressor<lz4>::~Decompressor()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+        _internalBuff = NULL;
+    }
+}
+
+void Decompressor<lz4>::finalizeCompression()
+{
+    if (_internalBuff != NULL)
+    {
+        daal::services::daal_free(_internalBuff);
+    }
+    _internalBuff    = NULL;
+    _internalBuffLen = 0;
+    _internalBuffOff = 0;
+}
+
+void Decompressor<lz4>::setInputDataBlock(byte * in, size_t len, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        initialize();
+    }
+
+    checkInputParams(in, len);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    if (len <= BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes)
+    {
+        finalizeCompression();
+        this->_errors->add(services::ErrorLz4DataFormatLessThenHeader);
+        return;
+    }
+
+    _avail_in = len;
+    _next_in  = in + off;
+}
+
+void Decompressor<lz4>::run(byte * out, size_t outLen, size_t off)
+{
+    if (_isInitialized == false)
+    {
+        this->_errors->add(services::ErrorLz4Internal);
+        return;
+    }
+
+    int tmp_avail_out            = 0;
+    Ipp32u uncompressedBlockSize = 0;
+    Ipp32u compressedBlockSize   = 0;
+    this->_isOutBlockFull        = 0;
+    this->_usedOutBlockSize      = 0;
+    int result                   = 0;
+
+    checkOutputParams(out, outLen);
+    if (this->_errors->size() != 0)
+    {
+        finalizeCompression();
+        return;
+    }
+
+    _avail_out = outLen;
+    _next_out  = out + off;
+    if (_internalBuffLen - _internalBuffOff > 0)
+    {
+        if (_avail_out < _internalBuffLen - _internalBuffOff)
+        {
+            result |= daal::services::internal::daal_memcpy_s((void *)(_next_out), _avail_out, (void *)(((byte *)_internalBuff) + _internalBuffOff),
+                                                              _avail_out);
+            if (result)
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return;
+            }
+
+            _internalBuffOff += _avail_out;
+            this->_usedOutBlockSize += _avail_out;
+            _avail_out            = 0;
+            this->_isOutBlockFull = 1;
+            return;
+        }
+        else
+        {
+            result |=
+                daal::services::internal::daal_memcpy_s((void *)(_next_out), _internalBuffLen - _internalBuffOff,
+                                                        (void *)(((byte *)_internalBuff) + _internalBuffOff), _internalBuffLen - _internalBuffOff);
+            if (result)
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return;
+            }
+
+            this->_usedOutBlockSize += _internalBuffLen - _internalBuffOff;
+            _avail_out = _avail_out - (_internalBuffLen - _internalBuffOff);
+            _next_out  = (void *)((byte *)_next_out + (_internalBuffLen - _internalBuffOff));
+            daal::services::daal_free(_internalBuff);
+            _internalBuff    = NULL;
+            _internalBuffLen = 0;
+            _internalBuffOff = 0;
+            if (_avail_in == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    do
+    {
+        if (EXPECT(_avail_in < BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes, 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormatLessThenHeader);
+            return;
+        }
+
+        uncompressedBlockSize = ((Ipp32u *)((byte *)_next_in + _preHeadBytes))[0];
+        compressedBlockSize   = ((Ipp32u *)((byte *)_next_in + _preHeadBytes))[1];
+
+        if (EXPECT(_avail_in < compressedBlockSize + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes, 0))
+        {
+            finalizeCompression();
+            this->_errors->add(services::ErrorLz4DataFormatNotFullBlock);
+            return;
+        }
+        if (_avail_out < uncompressedBlockSize)
+        {
+            _internalBuff = daal::services::daal_calloc(uncompressedBlockSize);
+            if (EXPECT(_internalBuff == NULL, 0))
+            {
+                finalizeCompression();
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+            _internalBuffLen = uncompressedBlockSize;
+            _internalBuffOff = 0;
+            tmp_avail_out    = (int)uncompressedBlockSize;
+            int errCode      = ippsDecodeLZ4_8u((const Ipp8u *)((byte *)_next_in + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes),
+                                           (int)compressedBlockSize, (Ipp8u *)((byte *)_internalBuff), &tmp_avail_out);
+            if (EXPECT(errCode == ippStsNoErr && (Ipp32u)tmp_avail_out != uncompressedBlockSize, 0)) errCode = ippStsSrcSizeLessExpected;
+            if (EXPECT(errCode != ippStsNoErr, 0))
+            {
+                finalizeCompression();
+                switch (errCode)
+                {
+                case ippStsSrcSizeLessExpected:
+                case ippStsDstSizeLessExpected: this->_errors->add(services::ErrorLz4DataFormat); return;
+                default: this->_errors->add(services::ErrorLz4Internal); return;
+                }
+            }
+
+            result |= daal::services::internal::daal_memcpy_s((void *)(_next_out), _avail_out, (void *)(((byte *)_internalBuff) + _internalBuffOff),
+                                                              _avail_out);
+            if (result)
+            {
+                this->_errors->add(services::ErrorMemoryCopyFailedInternal);
+                return;
+            }
+
+            _internalBuffOff += _avail_out;
+            this->_usedOutBlockSize += _avail_out;
+            _avail_out            = 0;
+            this->_isOutBlockFull = 1;
+            _avail_in             = _avail_in - (compressedBlockSize + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes);
+            if (_avail_in > 0)
+            {
+                _next_in = (void *)((byte *)(_next_in) + compressedBlockSize + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes);
+            }
+            return;
+        }
+        tmp_avail_out = (int)uncompressedBlockSize;
+        int errCode   = ippsDecodeLZ4_8u((const Ipp8u *)((byte *)_next_in + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes),
+                                       (int)compressedBlockSize, (Ipp8u *)((byte *)_next_out), &tmp_avail_out);
+        if (EXPECT(errCode == ippStsNoErr && (Ipp32u)tmp_avail_out != uncompressedBlockSize, 0)) errCode = ippStsSrcSizeLessExpected;
+        if (EXPECT(errCode != ippStsNoErr, 0))
+        {
+            finalizeCompression();
+            switch (errCode)
+            {
+            case ippStsSrcSizeLessExpected:
+            case ippStsDstSizeLessExpected: this->_errors->add(services::ErrorLz4DataFormat); return;
+            default: this->_errors->add(services::ErrorLz4Internal); return;
+            }
+        }
+        _avail_in = _avail_in - (compressedBlockSize + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes);
+        if (_avail_in > 0)
+        {
+            _next_in = (void *)((byte *)(_next_in) + compressedBlockSize + BLOCK_HEADER_BYTES + _preHeadBytes + _postHeadBytes);
+        }
+        _avail_out = _avail_out - tmp_avail_out;
+        _next_out  = (byte *)_next_out + tmp_avail_out;
+        this->_usedOutBlockSize += tmp_avail_out;
+    } while (_avail_in > 0 && _avail_out > 0);
+
+    if (_avail_in > 0)
+    {
+        this->_isOutBlockFull = 1;
+    }
+}
+} //namespace data_management
+} //namespace daal
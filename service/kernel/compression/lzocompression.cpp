@@ -96,6 +96,13 @@ void Compressor<lzo>::initialize()
     _isInitialized = true;
 }
 
+Compressor<lzo> * Compressor<lzo>::cloneImpl() const
+{
+    Compressor<lzo> * compressor = new Compressor<lzo>();
+    compressor->parameter        = parameter;
+    return compressor;
+}
+
 Compressor<lzo>::~Compressor()
 {
     if (_p_lzo_state) daal::services::daal_free(_p_lzo_state);
@@ -217,6 +224,13 @@ void Decompressor<lzo>::initialize()
     _isInitialized = true;
 }
 
+Decompressor<lzo> * Decompressor<lzo>::cloneImpl() const
+{
+    Decompressor<lzo> * decompressor = new Decompressor<lzo>();
+    decompressor->parameter          = parameter;
+    return decompressor;
+}
+
 Decompressor<lzo>::~Decompressor()
 {
     if (_internalBuff != NULL)
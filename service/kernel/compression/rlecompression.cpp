@@ -60,6 +60,13 @@ void Compressor<rle>::initialize()
     _isInitialized = true;
 }
 
+Compressor<rle> * Compressor<rle>::cloneImpl() const
+{
+    Compressor<rle> * compressor = new Compressor<rle>();
+    compressor->parameter        = parameter;
+    return compressor;
+}
+
 Compressor<rle>::~Compressor() {}
 
 void Compressor<rle>::finalizeCompression()
@@ -173,6 +180,13 @@ void Decompressor<rle>::initialize()
     }
     _isInitialized = true;
 }
+Decompressor<rle> * Decompressor<rle>::cloneImpl() const
+{
+    Decompressor<rle> * decompressor = new Decompressor<rle>();
+    decompressor->parameter          = parameter;
+    return decompressor;
+}
+
 Decompressor<rle>::~Decompressor()
 {
     if (_internalBuff != NULL)
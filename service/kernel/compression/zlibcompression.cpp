@@ -97,6 +97,13 @@ void Compressor<zlib>::initialize()
     }
 }
 
+Compressor<zlib> * Compressor<zlib>::cloneImpl() const
+{
+    Compressor<zlib> * compressor = new Compressor<zlib>();
+    compressor->parameter         = parameter;
+    return compressor;
+}
+
 Compressor<zlib>::~Compressor()
 {
     (void)deflateEnd(((z_stream *)_strmp));
@@ -268,6 +275,13 @@ void Decompressor<zlib>::initialize()
     }
 }
 
+Decompressor<zlib> * Decompressor<zlib>::cloneImpl() const
+{
+    Decompressor<zlib> * decompressor = new Decompressor<zlib>();
+    decompressor->parameter           = parameter;
+    return decompressor;
+}
+
 Decompressor<zlib>::~Decompressor()
 {
     (void)inflateEnd(((z_stream *)_strmp));
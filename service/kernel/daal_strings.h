@@ -68,13 +68,21 @@
     DECLARE_DAAL_STRING_CONST(dataDimension)                     \
     DECLARE_DAAL_STRING_CONST(correlationDistance)               \
     DECLARE_DAAL_STRING_CONST(cosineDistance)                    \
+    DECLARE_DAAL_STRING_CONST(maxDistance)                       \
+    DECLARE_DAAL_STRING_CONST(referenceData)                     \
+    DECLARE_DAAL_STRING_CONST(inferencePrecision)                \
     DECLARE_DAAL_STRING_CONST(quantiles)                         \
     DECLARE_DAAL_STRING_CONST(quantileOrders)                    \
+    DECLARE_DAAL_STRING_CONST(partialCentroidMeans)              \
+    DECLARE_DAAL_STRING_CONST(partialCentroidWeights)            \
+    DECLARE_DAAL_STRING_CONST(compression)                       \
     DECLARE_DAAL_STRING_CONST(covariance)                        \
     DECLARE_DAAL_STRING_CONST(correlation)                       \
     DECLARE_DAAL_STRING_CONST(mean)                              \
     DECLARE_DAAL_STRING_CONST(minObservationsInLeafNode)         \
     DECLARE_DAAL_STRING_CONST(sum)                               \
+    DECLARE_DAAL_STRING_CONST(coalescedRows)                     \
+    DECLARE_DAAL_STRING_CONST(nCoalescedRows)                    \
     DECLARE_DAAL_STRING_CONST(penaltyL1)                         \
     DECLARE_DAAL_STRING_CONST(penaltyL2)                         \
     DECLARE_DAAL_STRING_CONST(permutationMatrix)                 \
@@ -120,6 +128,9 @@
     DECLARE_DAAL_STRING_CONST(nTransactions)                     \
     DECLARE_DAAL_STRING_CONST(maxBins)                           \
     DECLARE_DAAL_STRING_CONST(minBinSize)                        \
+    DECLARE_DAAL_STRING_CONST(maxLeaves)                         \
+    DECLARE_DAAL_STRING_CONST(gossTopFraction)                   \
+    DECLARE_DAAL_STRING_CONST(gossOtherFraction)                 \
     DECLARE_DAAL_STRING_CONST(maxItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(minItemsetSize)                    \
     DECLARE_DAAL_STRING_CONST(largeItemsets)                     \
@@ -146,6 +157,9 @@
     DECLARE_DAAL_STRING_CONST(kernelFunction)                    \
     DECLARE_DAAL_STRING_CONST(training)                          \
     DECLARE_DAAL_STRING_CONST(prediction)                        \
+    DECLARE_DAAL_STRING_CONST(predictions)                       \
+    DECLARE_DAAL_STRING_CONST(shapContributions)                 \
+    DECLARE_DAAL_STRING_CONST(shapInteractions)                  \
     DECLARE_DAAL_STRING_CONST(labels)                            \
     DECLARE_DAAL_STRING_CONST(predictedLabels)                   \
     DECLARE_DAAL_STRING_CONST(probabilities)                     \
@@ -156,12 +170,15 @@
     DECLARE_DAAL_STRING_CONST(beta)                              \
     DECLARE_DAAL_STRING_CONST(confusionMatrix)                   \
     DECLARE_DAAL_STRING_CONST(binaryMetrics)                     \
+    DECLARE_DAAL_STRING_CONST(predictedScores)                   \
+    DECLARE_DAAL_STRING_CONST(rankingMetrics)                    \
     DECLARE_DAAL_STRING_CONST(multiClassMetrics)                 \
     DECLARE_DAAL_STRING_CONST(learningRate)                      \
     DECLARE_DAAL_STRING_CONST(logProbabilities)                  \
     DECLARE_DAAL_STRING_CONST(means)                             \
     DECLARE_DAAL_STRING_CONST(goalFunction)                      \
     DECLARE_DAAL_STRING_CONST(nIterations)                       \
+    DECLARE_DAAL_STRING_CONST(earlyExitMargin)                   \
     DECLARE_DAAL_STRING_CONST(inputWeights)                      \
     DECLARE_DAAL_STRING_CONST(inputCovariances)                  \
     DECLARE_DAAL_STRING_CONST(inputMeans)                        \
@@ -199,6 +216,9 @@
     DECLARE_DAAL_STRING_CONST(auxSigma)                          \
     DECLARE_DAAL_STRING_CONST(dimension)                         \
     DECLARE_DAAL_STRING_CONST(ridgeParameters)                   \
+    DECLARE_DAAL_STRING_CONST(segments)                          \
+    DECLARE_DAAL_STRING_CONST(nSegments)                         \
+    DECLARE_DAAL_STRING_CONST(models)                            \
     DECLARE_DAAL_STRING_CONST(nClusters)                         \
     DECLARE_DAAL_STRING_CONST(nRounds)                           \
     DECLARE_DAAL_STRING_CONST(nRowsTotal)                        \
@@ -233,6 +253,11 @@
     DECLARE_DAAL_STRING_CONST(featuresPerNode)                   \
     DECLARE_DAAL_STRING_CONST(lambda)                            \
     DECLARE_DAAL_STRING_CONST(preferenceThreshold)               \
+    DECLARE_DAAL_STRING_CONST(solverMethod)                      \
+    DECLARE_DAAL_STRING_CONST(nCGIterations)                     \
+    DECLARE_DAAL_STRING_CONST(nTopItems)                         \
+    DECLARE_DAAL_STRING_CONST(topItems)                          \
+    DECLARE_DAAL_STRING_CONST(topRatings)                        \
     DECLARE_DAAL_STRING_CONST(pyramidHeight)                     \
     DECLARE_DAAL_STRING_CONST(itemsFactors)                      \
     DECLARE_DAAL_STRING_CONST(partialModels)                     \
@@ -245,6 +270,9 @@
     DECLARE_DAAL_STRING_CONST(usersIndices)                      \
     DECLARE_DAAL_STRING_CONST(itemsIndices)                      \
     DECLARE_DAAL_STRING_CONST(nComponents)                       \
+    DECLARE_DAAL_STRING_CONST(nOversamples)                      \
+    DECLARE_DAAL_STRING_CONST(sketchSize)                        \
+    DECLARE_DAAL_STRING_CONST(nPowerIterations)                  \
     DECLARE_DAAL_STRING_CONST(auxInputDimensions)                \
     DECLARE_DAAL_STRING_CONST(auxInvMax)                         \
     DECLARE_DAAL_STRING_CONST(nTrials)                           \
@@ -263,6 +291,25 @@
     DECLARE_DAAL_STRING_CONST(retainRatio)                       \
     DECLARE_DAAL_STRING_CONST(k)                                 \
     DECLARE_DAAL_STRING_CONST(kdTreeTable)                       \
+    DECLARE_DAAL_STRING_CONST(neighborDistances)                 \
+    DECLARE_DAAL_STRING_CONST(neighborLabels)                    \
+    DECLARE_DAAL_STRING_CONST(maxConnections)                    \
+    DECLARE_DAAL_STRING_CONST(efConstruction)                    \
+    DECLARE_DAAL_STRING_CONST(efSearch)                          \
+    DECLARE_DAAL_STRING_CONST(hnswGraph)                         \
+    DECLARE_DAAL_STRING_CONST(nodeLevels)                        \
+    DECLARE_DAAL_STRING_CONST(leafSize)                          \
+    DECLARE_DAAL_STRING_CONST(balls)                             \
+    DECLARE_DAAL_STRING_CONST(nodeRanges)                        \
+    DECLARE_DAAL_STRING_CONST(nLists)                            \
+    DECLARE_DAAL_STRING_CONST(nSubquantizers)                    \
+    DECLARE_DAAL_STRING_CONST(nProbes)                           \
+    DECLARE_DAAL_STRING_CONST(nCandidates)                       \
+    DECLARE_DAAL_STRING_CONST(coarseCentroids)                   \
+    DECLARE_DAAL_STRING_CONST(codebooks)                         \
+    DECLARE_DAAL_STRING_CONST(codes)                             \
+    DECLARE_DAAL_STRING_CONST(listOffsets)                       \
+    DECLARE_DAAL_STRING_CONST(ids)                               \
     DECLARE_DAAL_STRING_CONST(auxRetainMask)                     \
     DECLARE_DAAL_STRING_CONST(auxValue)                          \
     DECLARE_DAAL_STRING_CONST(auxSmBeta)                         \
@@ -278,6 +325,7 @@
     DECLARE_DAAL_STRING_CONST(location)                          \
     DECLARE_DAAL_STRING_CONST(scatter)                           \
     DECLARE_DAAL_STRING_CONST(threshold)                         \
+    DECLARE_DAAL_STRING_CONST(choleskyFactor)                    \
     DECLARE_DAAL_STRING_CONST(conservativeSequence)              \
     DECLARE_DAAL_STRING_CONST(pastUpdateVector)                  \
     DECLARE_DAAL_STRING_CONST(minObservationsInLeafNodes)        \
@@ -290,6 +338,7 @@
     DECLARE_DAAL_STRING_CONST(outputOfInitForComputeStep3)       \
     DECLARE_DAAL_STRING_CONST(offsets)                           \
     DECLARE_DAAL_STRING_CONST(model)                             \
+    DECLARE_DAAL_STRING_CONST(inputModel)                        \
     DECLARE_DAAL_STRING_CONST(logTheta)                          \
     DECLARE_DAAL_STRING_CONST(tableToFill)                       \
     DECLARE_DAAL_STRING_CONST(randomNumbers)                     \
@@ -344,6 +393,8 @@
     DECLARE_DAAL_STRING_CONST(step6Queries)                      \
     DECLARE_DAAL_STRING_CONST(partialFinishedFlags)              \
     DECLARE_DAAL_STRING_CONST(finishedFlag)                      \
+    DECLARE_DAAL_STRING_CONST(forgettingFactor)                  \
+    DECLARE_DAAL_STRING_CONST(featureIndices)                    \
     DECLARE_DAAL_STRING_CONST(step8InputClusterStructure)        \
     DECLARE_DAAL_STRING_CONST(step8InputNClusters)               \
     DECLARE_DAAL_STRING_CONST(step8PartialQueries)               \
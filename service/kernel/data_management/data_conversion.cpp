@@ -32,40 +32,16 @@ namespace data_management
 {
 namespace internal
 {
-/* only for AVX512 architecture with using intrinsics */
-#if defined(__INTEL_COMPILER)
 template <typename T>
-static bool tryToCopyFuncAVX512(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
-{
-    typedef void (*funcType)(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets);
-    static funcType ptr = NULL;
-
-    if (!ptr)
-    {
-        int cpuid = (int)daal::services::Environment::getInstance()->getCpuId();
-
-        switch (cpuid)
-        {
-    #ifdef DAAL_KERNEL_AVX512
-        case avx512: DAAL_KERNEL_AVX512_ONLY_CODE(ptr = vectorCopy<T, avx512>); break;
-    #endif
-    #ifdef DAAL_KERNEL_AVX512_MIC
-        case avx512_mic: DAAL_KERNEL_AVX512_MIC_ONLY_CODE(ptr = vectorCopy<T, avx512_mic>); break;
-    #endif
-        default: return false;
-        }
-    }
+static bool vectorCopyFunc(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
+{
+#define DAAL_VECTOR_COPY_CPU(cpuId, ...) vectorCopy<T, cpuId>(__VA_ARGS__);
+
+    DAAL_DISPATCH_FUNCTION_BY_CPU(DAAL_VECTOR_COPY_CPU, nrows, ncols, dst, ptrMin, arrOffsets);
 
-    ptr(nrows, ncols, dst, ptrMin, arrOffsets);
+#undef DAAL_VECTOR_COPY_CPU
     return true;
 }
-#else
-template <typename T>
-static bool tryToCopyFuncAVX512(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
-{
-    return false;
-}
-#endif
 
 template <typename T1, typename T2>
 static void vectorConvertFunc(size_t n, const void * src, void * dst)
@@ -132,19 +108,19 @@ DAAL_REGISTER_WITH_HOMOGEN_NT_TYPES(DAAL_REGISTER_VECTOR_ASSIGN)
 template <typename T>
 DAAL_EXPORT vectorCopy2vFuncType getVector()
 {
-    return tryToCopyFuncAVX512<T>;
+    return vectorCopyFunc<T>;
 }
 
 template <>
 DAAL_EXPORT vectorCopy2vFuncType getVector<float>()
 {
-    return tryToCopyFuncAVX512<float>;
+    return vectorCopyFunc<float>;
 }
 
 template <>
 DAAL_EXPORT vectorCopy2vFuncType getVector<double>()
 {
-    return tryToCopyFuncAVX512<double>;
+    return vectorCopyFunc<double>;
 }
 
 template <>
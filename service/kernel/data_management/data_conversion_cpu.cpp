@@ -18,6 +18,7 @@
 #include "service/kernel/data_management/data_conversion_cpu.h"
 #include "data_management/data/internal/conversion.h"
 #include "externals/service_memory.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -25,6 +26,27 @@ namespace data_management
 {
 namespace internal
 {
+/* Conversions of the blocks smaller than this number of elements are not threaded */
+const size_t convertThreadingThreshold = 1 << 16;
+/* Number of elements converted by one task of the threaded conversion */
+const size_t convertBlockSize = 1 << 14;
+
+template <typename Func>
+static void convertInBlocks(size_t n, size_t blockSize, const Func & func)
+{
+    const size_t nBlocks = n / blockSize + !!(n % blockSize);
+    if (n < convertThreadingThreshold || nBlocks < 2)
+    {
+        func(0, n);
+        return;
+    }
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock) {
+        const size_t begin = iBlock * blockSize;
+        const size_t end   = (begin + blockSize > n) ? n : begin + blockSize;
+        func(begin, end);
+    });
+}
+
 /* only for AVX512 architecture with using intrinsics */
 #if defined(__INTEL_COMPILER)
 template <typename T>
@@ -81,57 +103,111 @@ void vectorCopyInternal<double>(const size_t nrows, const size_t ncols, void * d
     }
 }
 
+#endif
+
+/* Number of rows transposed at once by a thread, the columns of the rows stay in cache during the transposition */
+const size_t copyRowsBlockSize = 64;
+
+/* Copies the rows [0, nrows) of the columns with the byte offsets arrOffsets from ptrMin into row major dst */
 template <typename T, CpuType cpu>
-void vectorCopy(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
+struct VectorCopyRows
 {
-    vectorCopy<T, cpu>(nrows, ncols, dst, ptrMin, arrOffsets);
-}
+    static void copy(const size_t nrows, const size_t ncols, T * dst, char const * ptrByte, DAAL_INT64 const * arrOffsets)
+    {
+        for (size_t j = 0; j < ncols; ++j)
+        {
+            const T * column = (const T *)(ptrByte + arrOffsets[j]);
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nrows; ++i)
+            {
+                dst[i * ncols + j] = column[i];
+            }
+        }
+    }
+};
 
-/* Convert float to float from columnar to row major format using AVX512 architecture */
-template <>
-void vectorCopy<float, avx512>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
+#if defined(__INTEL_COMPILER)
+template <typename T>
+struct VectorCopyRows<T, avx512>
 {
-    vectorCopyInternal<float>(nrows, ncols, dst, ptrMin, arrOffsets);
-}
+    static void copy(const size_t nrows, const size_t ncols, T * dst, char const * ptrByte, DAAL_INT64 const * arrOffsets)
+    {
+        vectorCopyInternal<T>(nrows, ncols, dst, ptrByte, arrOffsets);
+    }
+};
 
-/* Convert double to double from columnar to row major format using AVX512 architecture */
-template <>
-void vectorCopy<double, avx512>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
+template <typename T>
+struct VectorCopyRows<T, avx512_mic>
 {
-    vectorCopyInternal<double>(nrows, ncols, dst, ptrMin, arrOffsets);
-}
+    static void copy(const size_t nrows, const size_t ncols, T * dst, char const * ptrByte, DAAL_INT64 const * arrOffsets)
+    {
+        vectorCopyInternal<T>(nrows, ncols, dst, ptrByte, arrOffsets);
+    }
+};
+#endif
 
-/* Convert float to float from columnar to row major format using AVX512 architecture */
-template <>
-void vectorCopy<float, avx512_mic>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
+/* Converts the columns of the same type T to the row major format, the blocks of rows are processed in parallel */
+template <typename T, CpuType cpu>
+void vectorCopy(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
 {
-    vectorCopyInternal<float>(nrows, ncols, dst, ptrMin, arrOffsets);
-}
+    if (nrows == 0 || ncols == 0) return;
 
-/* Convert double to double from columnar to row major format using AVX512 architecture */
-template <>
-void vectorCopy<double, avx512_mic>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets)
-{
-    vectorCopyInternal<double>(nrows, ncols, dst, ptrMin, arrOffsets);
+    T * pd               = static_cast<T *>(dst);
+    char const * ptrByte = static_cast<char const *>(ptrMin);
+
+    const size_t rowsPerTask = (ncols < convertBlockSize / copyRowsBlockSize) ? convertBlockSize / ncols : copyRowsBlockSize;
+    const size_t nTasks      = nrows / rowsPerTask + !!(nrows % rowsPerTask);
+
+    auto copyRows = [&](size_t iTask) {
+        const size_t begin = iTask * rowsPerTask;
+        const size_t end   = (begin + rowsPerTask > nrows) ? nrows : begin + rowsPerTask;
+        for (size_t i = begin; i < end; i += copyRowsBlockSize)
+        {
+            const size_t nBlockRows = (i + copyRowsBlockSize > end) ? end - i : copyRowsBlockSize;
+            VectorCopyRows<T, cpu>::copy(nBlockRows, ncols, pd + i * ncols, ptrByte + i * sizeof(T), arrOffsets);
+        }
+    };
+
+    if (nrows * ncols < convertThreadingThreshold || nTasks < 2)
+    {
+        for (size_t iTask = 0; iTask < nTasks; ++iTask) copyRows(iTask);
+    }
+    else
+    {
+        daal::threader_for(nTasks, nTasks, copyRows);
+    }
 }
-#endif
+
+template void vectorCopy<float, DAAL_CPU>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets);
+template void vectorCopy<double, DAAL_CPU>(const size_t nrows, const size_t ncols, void * dst, void const * ptrMin, DAAL_INT64 const * arrOffsets);
 
 template <typename T1, typename T2, CpuType cpu>
 void vectorConvertFuncCpu(size_t n, const void * src, void * dst)
 {
-    for (size_t i = 0; i < n; i++)
-    {
-        ((T2 *)dst)[i] = static_cast<T2>(((T1 *)src)[i]);
-    }
+    const T1 * srcT = (const T1 *)src;
+    T2 * dstT       = (T2 *)dst;
+    convertInBlocks(n, convertBlockSize, [&](size_t begin, size_t end) {
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for (size_t i = begin; i < end; i++)
+        {
+            dstT[i] = static_cast<T2>(srcT[i]);
+        }
+    });
 }
 
 template <typename T1, typename T2, CpuType cpu>
 void vectorStrideConvertFuncCpu(size_t n, const void * src, size_t srcByteStride, void * dst, size_t dstByteStride)
 {
-    for (size_t i = 0; i < n; i++)
-    {
-        *(T2 *)(((char *)dst) + i * dstByteStride) = static_cast<T2>(*(T1 *)(((char *)src) + i * srcByteStride));
-    }
+    /* strided accesses touch a cache line per element, so that the blocks are smaller */
+    convertInBlocks(n, convertBlockSize / 8, [&](size_t begin, size_t end) {
+        PRAGMA_IVDEP
+        for (size_t i = begin; i < end; i++)
+        {
+            *(T2 *)(((char *)dst) + i * dstByteStride) = static_cast<T2>(*(const T1 *)(((const char *)src) + i * srcByteStride));
+        }
+    });
 }
 
 #undef DAAL_FUNCS_UP_ENTRY
@@ -358,6 +358,8 @@ services::Status allValuesAreFiniteImpl(NumericTable & table, bool allowNaN, boo
             else
                 table.releaseBlockOfRows(blockDescrPtr[i]);
         *finiteness = true;
+        /* finite sum means that there are neither infinite nor NaN values */
+        table.setKnownFinite<DataType>(false);
         return s;
     }
 
@@ -370,6 +372,7 @@ services::Status allValuesAreFiniteImpl(NumericTable & table, bool allowNaN, boo
             table.releaseBlockOfRows(blockDescrPtr[i]);
 
     *finiteness = valuesAreFinite;
+    if (valuesAreFinite) table.setKnownFinite<DataType>(allowNaN);
 
     return s;
 }
@@ -377,6 +380,9 @@ services::Status allValuesAreFiniteImpl(NumericTable & table, bool allowNaN, boo
 template <typename DataType>
 DAAL_EXPORT bool allValuesAreFinite(NumericTable & table, bool allowNaN)
 {
+    /* the table was checked or filled by a data source that tracked the finiteness of the values, and was not modified after that */
+    if (table.isKnownFinite<DataType>(allowNaN)) return true;
+
     bool finiteness = false;
 
 #define DAAL_CHECK_FINITENESS(cpuId, ...) allValuesAreFiniteImpl<DataType, cpuId>(__VA_ARGS__);
@@ -391,6 +397,15 @@ DAAL_EXPORT bool allValuesAreFinite(NumericTable & table, bool allowNaN)
 template DAAL_EXPORT bool allValuesAreFinite<float>(NumericTable & table, bool allowNaN);
 template DAAL_EXPORT bool allValuesAreFinite<double>(NumericTable & table, bool allowNaN);
 
+template <typename DataType>
+DAAL_EXPORT bool valuesAreFinite(const DataType * values, size_t n, bool allowNaN)
+{
+    return !valuesAreNotFinite(values, n, allowNaN);
+}
+
+template DAAL_EXPORT bool valuesAreFinite<float>(const float * values, size_t n, bool allowNaN);
+template DAAL_EXPORT bool valuesAreFinite<double>(const double * values, size_t n, bool allowNaN);
+
 } // namespace internal
 } // namespace data_management
 } // namespace daal
@@ -0,0 +1,136 @@
+/** file mapped_file.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data_source/internal/mapped_file.h"
+#include "algorithms/threading/threading.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+MappedFile::MappedFile() : _data(NULL), _size(0), _isOpen(false), _fileHandle(NULL), _mappingHandle(NULL) {}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+services::Status MappedFile::open(const char * fileName, bool copyOnWrite)
+{
+    close();
+    if (!fileName) return services::Status(services::ErrorNullPtr);
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return services::Status(services::ErrorOnFileOpen);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    _fileHandle = (void *)file;
+    _size       = (size_t)fileSize.QuadPart;
+    _isOpen     = true;
+    if (_size == 0) return services::Status();
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+    {
+        close();
+        return services::Status(services::ErrorOnFileRead);
+    }
+    _mappingHandle = (void *)mapping;
+
+    _data = (const char *)MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    if (!_data)
+    {
+        close();
+        return services::Status(services::ErrorOnFileRead);
+    }
+#else
+    const int fd = ::open(fileName, O_RDONLY);
+    if (fd < 0) return services::Status(services::ErrorOnFileOpen);
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        ::close(fd);
+        return services::Status(services::ErrorOnFileRead);
+    }
+
+    _size   = (size_t)fileStat.st_size;
+    _isOpen = true;
+    if (_size == 0)
+    {
+        ::close(fd);
+        return services::Status();
+    }
+
+    void * ptr = mmap(NULL, _size, copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, fd, 0);
+    /* The mapping stays valid after the descriptor is closed */
+    ::close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        _size   = 0;
+        _isOpen = false;
+        return services::Status(services::ErrorOnFileRead);
+    }
+    /* Read-only files are parsed front to back by every worker, let the kernel read ahead aggressively */
+    if (!copyOnWrite) madvise(ptr, _size, MADV_SEQUENTIAL);
+    _data = (const char *)ptr;
+#endif
+    return services::Status();
+}
+
+void MappedFile::close()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (_data) UnmapViewOfFile((LPCVOID)_data);
+    if (_mappingHandle) CloseHandle((HANDLE)_mappingHandle);
+    if (_fileHandle) CloseHandle((HANDLE)_fileHandle);
+#else
+    if (_data) munmap((void *)_data, _size);
+#endif
+    _data          = NULL;
+    _size          = 0;
+    _isOpen        = false;
+    _fileHandle    = NULL;
+    _mappingHandle = NULL;
+}
+
+DAAL_EXPORT void parallelForBlocks(size_t nBlocks, const void * context, ParallelBlockFunctionType func)
+{
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock) { func((size_t)iBlock, context); });
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
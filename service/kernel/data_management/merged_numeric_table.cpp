@@ -16,6 +16,7 @@
 *******************************************************************************/
 
 #include "data_management/data/merged_numeric_table.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -84,5 +85,30 @@ services::SharedPtr<MergedNumericTable> MergedNumericTable::create(const Numeric
 }
 
 } // namespace interface1
+
+namespace internal
+{
+MergedTableCache::MergedTableCache() : _type(features::DAAL_OTHER_T), _isEnabled(false), _mutex(_daal_new_mutex()) {}
+
+MergedTableCache::MergedTableCache(const MergedTableCache & other)
+    : _type(features::DAAL_OTHER_T), _isEnabled(other._isEnabled), _mutex(_daal_new_mutex())
+{}
+
+MergedTableCache::~MergedTableCache()
+{
+    _daal_del_mutex(_mutex);
+}
+
+void MergedTableCache::lock()
+{
+    _daal_lock_mutex(_mutex);
+}
+
+void MergedTableCache::unlock()
+{
+    _daal_unlock_mutex(_mutex);
+}
+
+} // namespace internal
 } // namespace data_management
 } // namespace daal
@@ -24,6 +24,7 @@
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
 #include "data_management/data/row_merged_numeric_table.h"
+#include "data_management/data/subset_numeric_table.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -33,6 +34,7 @@
 #include "data_management/data/internal/base_arrow_numeric_table.h"
 #include "service/kernel/data_management/service_numeric_table.h"
 #include "service/kernel/service_defines.h"
+#include "algorithms/kernel/argument_storage.h"
 
 using namespace daal::services;
 
@@ -117,6 +119,79 @@ namespace daal
 {
 namespace data_management
 {
+namespace
+{
+/* Gives access to the internal storage of the basic statistics that also keeps the state of the table */
+class TableStateAccessor : public algorithms::Argument
+{
+public:
+    static algorithms::internal::ArgumentStorage * get(const NumericTable & table)
+    {
+        return algorithms::internal::ArgumentStorage::cast(getStorage(table.basicStatistics).get());
+    }
+};
+} // namespace
+
+size_t NumericTable::getNumberOfCopiedBytes() const
+{
+    const algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    return state ? state->getCopiedBytes() : 0;
+}
+
+void NumericTable::resetNumberOfCopiedBytes()
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (state) state->resetCopiedBytes();
+}
+
+void NumericTable::addCopiedBytes(size_t nBytes)
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (state) state->addCopiedBytes(nBytes);
+}
+
+void NumericTable::enableFinitenessTracking()
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (state) state->enableFinitenessTracking();
+}
+
+bool NumericTable::hasFinitenessFlags(int flags) const
+{
+    const algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    return state && !state->isDataExposed() && (state->getFinitenessFlags() & flags) == flags;
+}
+
+void NumericTable::addFinitenessFlags(int flags)
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (!state || !state->tracksFiniteness() || _memStatus != internallyAllocated || state->isDataExposed()) return;
+    state->addFinitenessFlags(flags);
+
+    /* the raw pointer might be handed out while the flags were set */
+    if (state->isDataExposed()) state->resetFinitenessFlags();
+}
+
+void NumericTable::resetKnownFiniteness() const
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (state) state->resetFinitenessFlags();
+}
+
+void NumericTable::exposeData() const
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (!state) return;
+    state->setDataExposed(true);
+    state->resetFinitenessFlags();
+}
+
+void NumericTable::resetDataExposure()
+{
+    algorithms::internal::ArgumentStorage * const state = TableStateAccessor::get(*this);
+    if (state) state->setDataExposed(false);
+}
+
 #define DAAL_IMPL_CONVERTTOHOMOGEN_FAST(T)                                                                                                   \
     template <>                                                                                                                              \
     DAAL_EXPORT daal::data_management::NumericTablePtr convertToHomogen<T>(NumericTable & src, daal::MemType type)                           \
@@ -210,10 +285,12 @@ DAAL_INSTANTIATE_SLOW(long)
 IMPLEMENT_SERIALIZABLE_TAG(SOANumericTable, SERIALIZATION_SOA_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(SyclSOANumericTable, SERIALIZATION_SYCL_SOA_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(BaseArrowImmutableNumericTable, SERIALIZATION_ARROW_IMMUTABLE_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(BaseArrowMutableNumericTable, SERIALIZATION_ARROW_MUTABLE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(CSRNumericTable, SERIALIZATION_CSR_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(AOSNumericTable, SERIALIZATION_AOS_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MergedNumericTable, SERIALIZATION_MERGE_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(RowMergedNumericTable, SERIALIZATION_ROWMERGE_NT_ID)
+IMPLEMENT_SERIALIZABLE_TAG(SubsetNumericTable, SERIALIZATION_SUBSET_NT_ID)
 IMPLEMENT_SERIALIZABLE_TAG(DataCollection, SERIALIZATION_DATACOLLECTION_ID)
 IMPLEMENT_SERIALIZABLE_TAG(MemoryBlock, SERIALIZATION_MEMORY_BLOCK_ID)
 
@@ -338,13 +415,15 @@ Status createSparseTableImpl(const NumericTablePtr & inTable, CSRNumericTablePtr
     size_t * inColIndices = inputBlock.getBlockColumnIndicesPtr();
     size_t * inRowIndices = inputBlock.getBlockRowIndicesPtr();
 
+    /* The result is 1-based while the block keeps the indexing of the input table */
+    const size_t shift = 1 - getCSRIndexBase(inputTable.get());
     for (size_t i = 0; i < dataSize; i++)
     {
-        resColIndices[i] = inColIndices[i];
+        resColIndices[i] = inColIndices[i] + shift;
     }
     for (size_t i = 0; i < nObservations + 1; i++)
     {
-        resRowIndices[i] = inRowIndices[i];
+        resRowIndices[i] = inRowIndices[i] + shift;
     }
 
     s = inputTable->releaseSparseBlock(inputBlock);
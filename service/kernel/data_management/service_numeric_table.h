@@ -29,6 +29,7 @@
 #include "data_management/data/symmetric_matrix.h"
 #include "service/kernel/service_defines.h"
 #include "externals/service_memory.h"
+#include "externals/service_profiler.h"
 #include "service/kernel/service_arrays.h"
 
 using namespace daal::data_management;
@@ -385,6 +386,7 @@ private:
     {
         _status        = _data->getBlockOfRows(iStartFrom, nRows, mode, _block);
         _toReleaseFlag = _status.ok();
+        if (_toReleaseFlag) daal::internal::Profiler::addBytes(_block.getNumberOfRows() * _block.getNumberOfColumns() * sizeof(algorithmFPType));
         return _block.getBlockPtr();
     }
 
@@ -404,7 +406,25 @@ using WriteRows = GetRows<algorithmFPType, algorithmFPType, cpu, readWrite, Nume
 template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyRows = GetRows<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
-template <typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode>
+template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
+using BorrowRows = GetRows<algorithmFPType, const algorithmFPType, cpu, readOnlyBorrowed, NumericTableType>;
+
+/**
+ * Returns the index of the first element in the row offsets and column indices of the CSR table, 0 or 1.
+ * Tables that do not report their indexing are treated as 1-based
+ */
+inline size_t getCSRIndexBase(const CSRNumericTableIface * data)
+{
+    const CSRNumericTable * csr = dynamic_cast<const CSRNumericTable *>(data);
+    return (csr && csr->getCSRIndexing() == CSRNumericTableIface::zeroBased) ? 0 : 1;
+}
+
+/**
+ * Provides access to the block of rows of the CSR table.
+ * If nativeIndexing is false, the index arrays of the blocks of 0-based tables are copied with conversion to 1-based indexing.
+ * Otherwise the index arrays are accessed as is and the caller takes the indexing from indexBase()
+ */
+template <typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, bool nativeIndexing = false>
 class GetRowsCSR
 {
 public:
@@ -420,11 +440,12 @@ public:
     ~GetRowsCSR() { release(); }
 
     const algorithmFPAccessType * values() const { return _data ? _block.getBlockValuesPtr() : nullptr; }
-    const size_t * cols() const { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
-    const size_t * rows() const { return _data ? _block.getBlockRowIndicesPtr() : nullptr; }
+    const size_t * cols() const { return _data ? (_cols.get() ? _cols.get() : _block.getBlockColumnIndicesPtr()) : nullptr; }
+    const size_t * rows() const { return _data ? (_rows.get() ? _rows.get() : _block.getBlockRowIndicesPtr()) : nullptr; }
     algorithmFPAccessType * values() { return _data ? _block.getBlockValuesPtr() : nullptr; }
-    size_t * cols() { return _data ? _block.getBlockColumnIndicesPtr() : nullptr; }
-    size_t * rows() { return _data ? _block.getBlockRowIndicesPtr() : nullptr; }
+    size_t * cols() { return _data ? (_cols.get() ? _cols.get() : _block.getBlockColumnIndicesPtr()) : nullptr; }
+    size_t * rows() { return _data ? (_rows.get() ? _rows.get() : _block.getBlockRowIndicesPtr()) : nullptr; }
+    size_t indexBase() const { return _indexBase; }
 
     void next(size_t iStartFrom, size_t nRows)
     {
@@ -465,6 +486,28 @@ private:
     {
         _status        = _data->getSparseBlock(iStartFrom, nRows, mode, _block);
         _toReleaseFlag = _status.ok();
+        _indexBase     = getCSRIndexBase(_data);
+        _cols.reset(0);
+        _rows.reset(0);
+        if (!nativeIndexing && mode != writeOnly && _indexBase == 0 && _status.ok()) convertToOneBased();
+    }
+
+    void convertToOneBased()
+    {
+        const size_t nRows   = _block.getNumberOfRows();
+        const size_t nValues = _block.getDataSize();
+        _rows.reset(nRows + 1);
+        _cols.reset(nValues);
+        if ((nValues && !_cols.get()) || !_rows.get())
+        {
+            _status = services::Status(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        const size_t * blockRows = _block.getBlockRowIndicesPtr();
+        const size_t * blockCols = _block.getBlockColumnIndicesPtr();
+        for (size_t i = 0; i < nRows + 1; i++) _rows.get()[i] = blockRows[i] + 1;
+        for (size_t i = 0; i < nValues; i++) _cols.get()[i] = blockCols[i] + 1;
+        _indexBase = 1;
     }
 
 private:
@@ -472,6 +515,9 @@ private:
     CSRBlockDescriptor<algorithmFPType> _block;
     services::Status _status;
     bool _toReleaseFlag;
+    size_t _indexBase = 1;
+    services::internal::TArray<size_t, cpu> _cols;
+    services::internal::TArray<size_t, cpu> _rows;
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -483,6 +529,79 @@ using WriteRowsCSR = GetRowsCSR<algorithmFPType, algorithmFPType, cpu, readWrite
 template <typename algorithmFPType, CpuType cpu>
 using WriteOnlyRowsCSR = GetRowsCSR<algorithmFPType, algorithmFPType, cpu, writeOnly>;
 
+template <typename algorithmFPType, CpuType cpu>
+using ReadRowsCSRNative = GetRowsCSR<algorithmFPType, const algorithmFPType, cpu, readOnly, true>;
+
+/**
+ * Splits the rows of the CSR data into blocks of approximately equal cost for parallel processing.
+ * The cost of a row is the number of its non-zero values plus rowCost, every block contains at most maxBlockSize rows.
+ * The rows of the data without available row offsets are split into blocks of equal sizes
+ */
+template <CpuType cpu>
+class CSRRowBlocks
+{
+public:
+    CSRRowBlocks() : _nBlocks(0) {}
+
+    /* Takes the row offsets from the table if it is CSRNumericTable */
+    services::Status init(const CSRNumericTableIface * data, size_t nRows, size_t nBlocks, size_t maxBlockSize, size_t rowCost = 0)
+    {
+        const CSRNumericTable * csr = dynamic_cast<const CSRNumericTable *>(data);
+        size_t * rowOffsets         = nullptr;
+        if (csr) csr->getArrays<byte>(nullptr, nullptr, &rowOffsets);
+        return init(rowOffsets, nRows, nBlocks, maxBlockSize, rowCost);
+    }
+
+    services::Status init(const size_t * rowOffsets, size_t nRows, size_t nBlocks, size_t maxBlockSize, size_t rowCost = 0)
+    {
+        _nBlocks = 0;
+        if (!nRows) return services::Status();
+
+        const size_t nBlocksBySize = nRows / maxBlockSize + !!(nRows % maxBlockSize);
+        if (nBlocks < nBlocksBySize) nBlocks = nBlocksBySize;
+        if (nBlocks > nRows) nBlocks = nRows;
+
+        _bounds.reset(nBlocks + nBlocksBySize + 2);
+        DAAL_CHECK_MALLOC(_bounds.get());
+        size_t * bounds = _bounds.get();
+        bounds[0]       = 0;
+
+        if (!rowOffsets || nBlocks == 1)
+        {
+            for (size_t i = 1; i <= nBlocks; i++) bounds[i] = i * nRows / nBlocks;
+            _nBlocks = nBlocks;
+            return services::Status();
+        }
+
+        /* Every block except the last one either reaches the target cost or contains maxBlockSize rows */
+        const size_t totalCost  = rowOffsets[nRows] - rowOffsets[0] + rowCost * nRows;
+        const size_t targetCost = totalCost / nBlocks + 1;
+        for (size_t iStart = 0; iStart < nRows; iStart = bounds[_nBlocks])
+        {
+            size_t lo = iStart + 1;
+            size_t hi = (nRows - iStart > maxBlockSize) ? iStart + maxBlockSize : nRows;
+            while (lo < hi)
+            {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (rowOffsets[mid] - rowOffsets[iStart] + rowCost * (mid - iStart) < targetCost)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            bounds[++_nBlocks] = lo;
+        }
+        return services::Status();
+    }
+
+    size_t nBlocks() const { return _nBlocks; }
+    size_t blockStart(size_t iBlock) const { return _bounds.get()[iBlock]; }
+    size_t blockSize(size_t iBlock) const { return _bounds.get()[iBlock + 1] - _bounds.get()[iBlock]; }
+
+private:
+    size_t _nBlocks;
+    services::internal::TArray<size_t, cpu> _bounds;
+};
+
 template <typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename NumericTableType>
 class GetColumns
 {
@@ -542,6 +661,9 @@ using WriteColumns = GetColumns<algorithmFPType, algorithmFPType, cpu, readWrite
 template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
 using WriteOnlyColumns = GetColumns<algorithmFPType, algorithmFPType, cpu, writeOnly, NumericTableType>;
 
+template <typename algorithmFPType, CpuType cpu, typename NumericTableType = NumericTable>
+using BorrowColumns = GetColumns<algorithmFPType, const algorithmFPType, cpu, readOnlyBorrowed, NumericTableType>;
+
 template <typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename NumericTableType>
 class GetPacked
 {
@@ -616,6 +738,8 @@ using daal::services::internal::TArray;
 using daal::services::internal::TArrayCalloc;
 using daal::services::internal::TArrayScalable;
 using daal::services::internal::TArrayScalableCalloc;
+using daal::services::internal::TArrayScratch;
+using daal::services::internal::TArrayScratchCalloc;
 
 using daal::services::internal::TNArray;
 
@@ -0,0 +1,107 @@
+/** file subset_numeric_table.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "data_management/data/subset_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace interface1
+{
+SubsetNumericTable::SubsetNumericTable() : NumericTable(0, 0) {}
+
+services::SharedPtr<SubsetNumericTable> SubsetNumericTable::create(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows,
+                                                                   services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(SubsetNumericTable, table, rowIndices, nRows, NULL, 0);
+}
+
+services::SharedPtr<SubsetNumericTable> SubsetNumericTable::create(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows,
+                                                                   const size_t * colIndices, size_t nCols, services::Status * stat)
+{
+    DAAL_DEFAULT_CREATE_IMPL_EX(SubsetNumericTable, table, rowIndices, nRows, colIndices, nCols);
+}
+
+SubsetNumericTable::SubsetNumericTable(const NumericTablePtr & table, const size_t * rowIndices, size_t nRows, const size_t * colIndices,
+                                       size_t nCols, services::Status & st)
+    : NumericTable(0, 0), _table(table)
+{
+    if (!table)
+    {
+        st.add(services::ErrorNullNumericTable);
+        this->_status |= st;
+        return;
+    }
+
+    const size_t parentNRows = table->getNumberOfRows();
+    const size_t parentNCols = table->getNumberOfColumns();
+    if (table->getDataLayout() & csrArray)
+    {
+        st.add(services::ErrorIncorrectTypeOfInputNumericTable);
+        this->_status |= st;
+        return;
+    }
+
+    if (!rowIndices) nRows = parentNRows;
+    if (!colIndices) nCols = parentNCols;
+
+    for (size_t i = 0; rowIndices && i < nRows; i++)
+    {
+        if (rowIndices[i] >= parentNRows)
+        {
+            st.add(services::ErrorIncorrectIndex);
+            this->_status |= st;
+            return;
+        }
+    }
+    for (size_t j = 0; colIndices && j < nCols; j++)
+    {
+        if (colIndices[j] >= parentNCols)
+        {
+            st.add(services::ErrorIncorrectIndex);
+            this->_status |= st;
+            return;
+        }
+    }
+
+    if (rowIndices)
+    {
+        _rowIndices = services::Collection<size_t>(nRows, rowIndices);
+        if (_rowIndices.size() != nRows) st.add(services::ErrorMemoryAllocationFailed);
+    }
+    if (colIndices)
+    {
+        _colIndices = services::Collection<size_t>(nCols, colIndices);
+        if (_colIndices.size() != nCols) st.add(services::ErrorMemoryAllocationFailed);
+    }
+
+    /* The features of the subset keep the types of the features of the parent table */
+    NumericTableDictionaryPtr parentDict = table->getDictionarySharedPtr();
+    _ddict                               = NumericTableDictionary::create(nCols, DictionaryIface::notEqual, &st);
+    for (size_t j = 0; st && parentDict && j < nCols; j++)
+    {
+        st |= _ddict->setFeature(parentDict->getFeature(parentColumn(j)), j);
+    }
+
+    if (st) st |= setNumberOfRowsImpl(nRows);
+    this->_status |= st;
+}
+
+} // namespace interface1
+} // namespace data_management
+} // namespace daal
@@ -24,9 +24,12 @@
 #include <immintrin.h>
 
 #include "services/env_detect.h"
+#include "services/numa_node_scope.h"
 #include "services/daal_defines.h"
 #include "service/kernel/service_defines.h"
 #include "externals/service_service.h"
+#include "externals/service_memory.h"
+#include "externals/service_profiler.h"
 #include "algorithms/threading/threading.h"
 #include "services/error_indexes.h"
 
@@ -124,6 +127,76 @@ DAAL_EXPORT void daal::services::Environment::setDynamicLibraryThreadingTypeOnWi
     initNumberOfThreads();
 }
 
+DAAL_EXPORT void daal::services::Environment::enableKernelTracing(const bool enableKernelTracingFlag)
+{
+    daal::internal::Profiler::enable(enableKernelTracingFlag);
+}
+
+DAAL_EXPORT int daal::services::Environment::writeKernelTrace(const char * fileName)
+{
+    return daal::internal::Profiler::writeTrace(fileName);
+}
+
+DAAL_EXPORT bool daal::services::Environment::enableKernelCounters(const bool enableKernelCountersFlag)
+{
+    return daal::internal::Profiler::enableCounters(enableKernelCountersFlag);
+}
+
+DAAL_EXPORT int daal::services::Environment::writeKernelSummary(const char * fileName)
+{
+    return daal::internal::Profiler::writeSummary(fileName);
+}
+
+DAAL_EXPORT void daal::services::Environment::enableDispatchReport(const bool enableDispatchReportFlag)
+{
+    daal::internal::DispatchReport::enable(enableDispatchReportFlag);
+}
+
+DAAL_EXPORT int daal::services::Environment::writeDispatchReport(const char * fileName)
+{
+    return daal::internal::DispatchReport::write(fileName);
+}
+
+DAAL_EXPORT void daal::services::Environment::enableMemoryAccounting(const bool enableMemoryAccountingFlag)
+{
+    daal::services::internal::enableMemoryAccounting(enableMemoryAccountingFlag);
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getAllocatedMemorySize()
+{
+    return daal::services::internal::getAllocatedMemorySize();
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getPeakAllocatedMemorySize()
+{
+    return daal::services::internal::getPeakAllocatedMemorySize();
+}
+
+DAAL_EXPORT void daal::services::Environment::resetPeakAllocatedMemorySize()
+{
+    daal::services::internal::resetPeakAllocatedMemorySize();
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getLastComputePeakMemorySize()
+{
+    return daal::services::internal::getLastComputePeakMemorySize();
+}
+
+DAAL_EXPORT void daal::services::Environment::setMemoryPlacementPolicy(daal::services::Environment::MemoryPlacementPolicy policy)
+{
+    daal::services::internal::setMemoryPlacementPolicy((int)policy);
+}
+
+DAAL_EXPORT int daal::services::Environment::setHugePagesPolicy(daal::services::Environment::HugePagesPolicy policy, size_t minSize)
+{
+    return daal::services::internal::setHugePagesPolicy((int)policy, minSize);
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getHugePagesAdvisedSize()
+{
+    return daal::services::internal::getHugePagesAdvisedSize();
+}
+
 DAAL_EXPORT daal::services::Environment::Environment() : _init(0)
 {
     _env.cpuid_init_flag = false;
@@ -197,3 +270,61 @@ DAAL_EXPORT void daal::services::Environment::enableThreadPinning(const bool ena
 #endif
     return;
 }
+
+DAAL_EXPORT int daal::services::Environment::setThreadPinningPolicy(ThreadPinningPolicy policy)
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return daal::services::internal::setThreadPinningPolicy((daal::services::internal::thread_pinning_policy_t)policy, read_topology,
+                                                            read_topology_nodes, delete_topology);
+#else
+    return -1;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Environment::setThreadSchedulingPolicy(ThreadSchedulingPolicy policy)
+{
+    initNumberOfThreads();
+    bool dynamicScheduling = (policy == dynamicThreadScheduling);
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    if (policy == autoThreadScheduling) dynamicScheduling = is_hybrid_cpu();
+#endif
+    daal::threader_env()->setDynamicScheduling(dynamicScheduling);
+}
+
+DAAL_EXPORT void daal::services::Environment::enableDeterministicComputations(bool enableFlag, size_t nGroups)
+{
+    initNumberOfThreads();
+    daal::threader_env()->setDeterministicGroups(enableFlag ? (nGroups ? nGroups : 1) : 0);
+}
+
+DAAL_EXPORT size_t daal::services::Environment::getNumberOfNumaNodes()
+{
+    initNumberOfThreads();
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    return daal::services::internal::getNumberOfNumaNodes(read_topology, read_topology_nodes, delete_topology);
+#else
+    return 0;
+#endif
+}
+
+DAAL_EXPORT daal::services::NumaNodeScope::NumaNodeScope(size_t node) : _binding(NULL)
+{
+    Environment * env = Environment::getInstance();
+    if (node >= env->getNumberOfNumaNodes())
+    {
+        _status = services::Status(services::ErrorIncorrectIndex);
+        return;
+    }
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    _binding = daal::services::internal::enterNumaNode((int)node, read_topology, read_topology_nodes, delete_topology);
+#endif
+    if (!_binding) _status = services::Status(services::ErrorMethodNotSupported);
+}
+
+DAAL_EXPORT daal::services::NumaNodeScope::~NumaNodeScope()
+{
+#if !(defined DAAL_THREAD_PINNING_DISABLED)
+    if (_binding) daal::services::internal::leaveNumaNode(_binding);
+#endif
+}
@@ -730,6 +730,7 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSkipAheadUnsupported, "SkipAhead method is not supported by generator");
     add(ErrorFeatureNamesNotAvailable, "Feature names are not available for feature modifier");
     add(ErrorEngineNotSupported, "Engine not supported");
+    add(ErrorZeroCopyAccessNotAvailable, "Numeric Table cannot provide the block without copying the data");
 
     // Common computation errors: -4000...
     add(ErrorInputSigmaMatrixHasNonPositiveMinor, "Input sigma matrix has non positive minor");
@@ -864,6 +865,16 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorRleDataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
     add(ErrorRleDataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
 
+    add(ErrorCompressionChunkIndexCorrupted, "Chunk index of the parallel compressed stream is in wrong format or corrupted");
+    add(ErrorCompressionIncompleteStream, "Input compressed stream does not contain all the chunks listed in its chunk index");
+    add(ErrorCompressionStreamFinalized, "Data cannot be added to the stream after its compressed data were requested");
+
+    add(ErrorLz4Internal, "LZ4 internal error");
+    add(ErrorLz4OutputStreamSizeIsNotEnough, "Size of output stream is not enough to start compression");
+    add(ErrorLz4DataFormat, "Input compressed stream is in wrong format or corrupted");
+    add(ErrorLz4DataFormatLessThenHeader, "Size of input compressed stream is less then compressed block header size");
+    add(ErrorLz4DataFormatNotFullBlock, "Input compressed stream contains not a whole number of compressed blocks");
+
     // Min-max normalization errors: -9400..-9499
     add(ErrorLowerBoundGreaterThanOrEqualToUpperBound, "Lower bound parameter greater than or equal to upper bound");
 
@@ -917,6 +928,8 @@ void ErrorMessageCollection::parseResourceFile()
     add(ErrorSQLstmtHandle, "ErrorSQLstmtHandle");
     add(ErrorOnFileOpen, "Error on file open");
     add(ErrorOnFileRead, "Error on file read");
+    add(ErrorOnFileWrite, "Error on file write");
+    add(ErrorIncorrectFileFormat, "Content of the file does not match the expected format");
 
     add(ErrorKDBNoConnection, "ErrorKDBNoConnection");
     add(ErrorKDBWrongCredentials, "ErrorKDBWrongCredentials");
@@ -107,6 +107,56 @@ services::Status ReferenceGemm<algorithmFPType>::operator()(const Transpose tran
 template class ReferenceGemm<float>;
 template class ReferenceGemm<double>;
 
+template <typename algorithmFPType>
+services::Status ReferenceGemmBatch<algorithmFPType>::operator()(const Transpose transa, const Transpose transb, const size_t m, const size_t n,
+                                                                 const size_t k, const algorithmFPType alpha,
+                                                                 const services::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                                                 const size_t strideA, const services::Buffer<algorithmFPType> & b_buffer,
+                                                                 const size_t ldb, const size_t strideB, const algorithmFPType beta,
+                                                                 services::Buffer<algorithmFPType> & c_buffer, const size_t ldc, const size_t strideC,
+                                                                 const size_t batchSize)
+{
+    services::Status status;
+
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+    services::String options       = getKeyFPType<algorithmFPType>();
+    services::String cacheKey      = "__daal_gemm_";
+    cacheKey.add(options);
+
+    factory.build(ExecutionTargetIds::device, cacheKey.c_str(), clKernelGemm, options.c_str());
+
+    KernelPtr kernelGemm = factory.getKernel("blas_sgemm_batch", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    const uint32_t one = uint32_t(1);
+
+    KernelArguments args(14);
+    args.set(0, (uint32_t)k);
+    args.set(1, alpha);
+    args.set(2, a_buffer, AccessModeIds::read);
+    args.set(3, transa == Transpose::Trans ? (uint32_t)lda : one);
+    args.set(4, transa == Transpose::Trans ? one : (uint32_t)lda);
+    args.set(5, (uint32_t)strideA);
+    args.set(6, b_buffer, AccessModeIds::read);
+    args.set(7, transb == Transpose::Trans ? (uint32_t)ldb : one);
+    args.set(8, transb == Transpose::Trans ? one : (uint32_t)ldb);
+    args.set(9, (uint32_t)strideB);
+    args.set(10, beta);
+    args.set(11, c_buffer, AccessModeIds::readwrite);
+    args.set(12, (uint32_t)ldc);
+    args.set(13, (uint32_t)strideC);
+
+    KernelRange range(m, n, batchSize);
+
+    ctx.run(range, kernelGemm, args, &status);
+
+    return status;
+}
+
+template class ReferenceGemmBatch<float>;
+template class ReferenceGemmBatch<double>;
+
 template <typename algorithmFPType>
 services::Status ReferenceAxpy<algorithmFPType>::operator()(const int n, const algorithmFPType a, const services::Buffer<algorithmFPType> & x_buffer,
                                                             const int incx, services::Buffer<algorithmFPType> & y_buffer, const int incy)
@@ -61,6 +61,31 @@ struct BlasGpu
         return status;
     }
 
+    /* Strided batched GEMM, the matrices of the i-th product start at the offsets i * strideA, i * strideB and i * strideC */
+    static services::Status xgemmBatch(const math::Layout layout, const math::Transpose transa, const math::Transpose transb, const uint32_t m,
+                                       const uint32_t n, const uint32_t k, const algorithmFPType alpha, const UniversalBuffer a_buffer,
+                                       const uint32_t lda, const uint32_t strideA, const UniversalBuffer b_buffer, const uint32_t ldb,
+                                       const uint32_t strideB, const algorithmFPType beta, UniversalBuffer c_buffer, const uint32_t ldc,
+                                       const uint32_t strideC, const uint32_t batchSize)
+    {
+        services::Status status;
+
+        ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        if (layout == math::Layout::ColMajor)
+        {
+            ctx.gemmBatch(transa, transb, m, n, k, alpha, a_buffer, lda, strideA, b_buffer, ldb, strideB, beta, c_buffer, ldc, strideC, batchSize,
+                          &status);
+        }
+        else
+        {
+            ctx.gemmBatch(transb, transa, n, m, k, alpha, b_buffer, ldb, strideB, a_buffer, lda, strideA, beta, c_buffer, ldc, strideC, batchSize,
+                          &status);
+        }
+
+        return status;
+    }
+
     static services::Status xsyrk(const math::Layout layout, const math::UpLo upper_lower, const math::Transpose trans, const uint32_t n,
                                   const uint32_t k, const algorithmFPType alpha, const UniversalBuffer a_buffer, const uint32_t lda,
                                   const uint32_t offsetA, const algorithmFPType beta, UniversalBuffer c_buffer, const uint32_t ldc,
@@ -106,6 +106,27 @@ DECLARE_SOURCE(
         c[globalRow * ldc_col + globalCol * ldc_row] = alpha * sum + beta * c[globalRow * ldc_col + globalCol * ldc_row];
     }
 
+    __kernel void blas_sgemm_batch(const uint k, const algorithmFPType alpha, const __global algorithmFPType * a, const uint lda_col,
+                                   const uint lda_row, const uint strideA, const __global algorithmFPType * b, const uint ldb_col, const uint ldb_row,
+                                   const uint strideB, const algorithmFPType beta, __global algorithmFPType * c, const uint ldc, const uint strideC) {
+        const uint rows  = get_global_id(0);
+        const uint cols  = get_global_id(1);
+        const uint batch = get_global_id(2);
+
+        const __global algorithmFPType * aBatch = a + batch * strideA;
+        const __global algorithmFPType * bBatch = b + batch * strideB;
+
+        algorithmFPType sum = (algorithmFPType)0;
+        for (uint i = 0; i < k; i++)
+        {
+            sum += aBatch[i * lda_row + rows * lda_col] * bBatch[cols * ldb_row + i * ldb_col];
+        }
+
+        const uint idx = batch * strideC + cols * ldc + rows;
+        /* C is not read if beta is zero, so that it may be uninitialized */
+        c[idx] = (beta != (algorithmFPType)0) ? alpha * sum + beta * c[idx] : alpha * sum;
+    }
+
 );
 
 DECLARE_SOURCE(
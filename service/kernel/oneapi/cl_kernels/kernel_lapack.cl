@@ -0,0 +1,141 @@
+/* file: kernel_lapack.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of batched LAPACK kernels for small matrices.
+//  Each matrix is processed by one work-group, the matrices are stored
+//  in the column-major layout.
+//--
+*/
+
+#ifndef __LAPACK_KERNELS_CL__
+#define __LAPACK_KERNELS_CL__
+
+#include <string.h>
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    clKernelPotrfBatch,
+
+    /* Index of the element L(i, j), i >= j, of the lower triangular factor A = L * L^T.
+       The upper triangular factor A = U^T * U is stored as U(j, i) = L(i, j) */
+    inline uint factorIndex(const uint i, const uint j, const uint lda, const int isUpper) { return isUpper ? i * lda + j : j * lda + i; }
+
+    __kernel void potrf_batch(__global algorithmFPType * a, const uint n, const uint lda, const uint strideA, const int isUpper,
+                              __global int * info) {
+        const uint batch     = get_group_id(0);
+        const uint localId   = get_local_id(0);
+        const uint localSize = get_local_size(0);
+
+        __global algorithmFPType * m = a + batch * strideA;
+
+        __local int failed;
+        if (localId == 0)
+        {
+            failed = 0;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint j = 0; j < n; j++)
+        {
+            if (localId == 0)
+            {
+                const uint jj           = factorIndex(j, j, lda, isUpper);
+                const algorithmFPType d = m[jj];
+                if (d > (algorithmFPType)0)
+                {
+                    m[jj] = sqrt(d);
+                }
+                else
+                {
+                    failed = j + 1;
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE | CLK_GLOBAL_MEM_FENCE);
+
+            if (failed)
+            {
+                break;
+            }
+
+            const algorithmFPType invDiag = (algorithmFPType)1 / m[factorIndex(j, j, lda, isUpper)];
+            for (uint i = j + 1 + localId; i < n; i += localSize)
+            {
+                m[factorIndex(i, j, lda, isUpper)] *= invDiag;
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+
+            /* Update of the trailing lower triangle */
+            const uint nTrail = n - j - 1;
+            for (uint t = localId; t < nTrail * nTrail; t += localSize)
+            {
+                const uint i = j + 1 + t / nTrail;
+                const uint l = j + 1 + t % nTrail;
+                if (l <= i)
+                {
+                    m[factorIndex(i, l, lda, isUpper)] -= m[factorIndex(i, j, lda, isUpper)] * m[factorIndex(l, j, lda, isUpper)];
+                }
+            }
+            barrier(CLK_GLOBAL_MEM_FENCE);
+        }
+
+        if (localId == 0)
+        {
+            info[batch] = failed;
+        }
+    }
+
+    __kernel void potrs_batch(const __global algorithmFPType * a, const uint n, const uint lda, const uint strideA, const int isUpper,
+                              __global algorithmFPType * b, const uint ny, const uint ldb, const uint strideB) {
+        const uint batch     = get_group_id(0);
+        const uint localId   = get_local_id(0);
+        const uint localSize = get_local_size(0);
+
+        const __global algorithmFPType * m = a + batch * strideA;
+
+        /* Each work-item solves the systems for its right-hand sides: L * y = b, then L^T * x = y */
+        for (uint c = localId; c < ny; c += localSize)
+        {
+            __global algorithmFPType * x = b + batch * strideB + c * ldb;
+
+            for (uint i = 0; i < n; i++)
+            {
+                algorithmFPType sum = x[i];
+                for (uint l = 0; l < i; l++)
+                {
+                    sum -= m[factorIndex(i, l, lda, isUpper)] * x[l];
+                }
+                x[i] = sum / m[factorIndex(i, i, lda, isUpper)];
+            }
+
+            for (uint i = n; i-- > 0;)
+            {
+                algorithmFPType sum = x[i];
+                for (uint l = i + 1; l < n; l++)
+                {
+                    sum -= m[factorIndex(l, i, lda, isUpper)] * x[l];
+                }
+                x[i] = sum / m[factorIndex(i, i, lda, isUpper)];
+            }
+        }
+    }
+
+);
+
+#endif // __LAPACK_KERNELS_CL__
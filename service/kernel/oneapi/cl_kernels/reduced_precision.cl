@@ -0,0 +1,134 @@
+/* file: reduced_precision.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the kernels working with the matrices stored in 16-bit floating-point formats.
+//--
+*/
+
+#ifndef __REDUCED_PRECISION_CL__
+#define __REDUCED_PRECISION_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    reduced_precision,
+
+    float unpackValue(__global const ushort * packed, ulong index, uint isBfloat16) {
+        if (isBfloat16)
+        {
+            return as_float(((uint)packed[index]) << 16);
+        }
+        return vload_half(index, (__global const half *)packed);
+    }
+
+    void packValue(float value, __global ushort * packed, ulong index, uint isBfloat16) {
+        if (isBfloat16)
+        {
+            uint bits = as_uint(value);
+            if (isnan(value))
+            {
+                packed[index] = (ushort)((bits >> 16) | 0x40);
+            }
+            else
+            {
+                bits += 0x7FFF + ((bits >> 16) & 1);
+                packed[index] = (ushort)(bits >> 16);
+            }
+        }
+        else
+        {
+            vstore_half_rte(value, index, (__global half *)packed);
+        }
+    }
+
+    __kernel void pack_rows(__global const algorithmFPType * data, uint nCols, uint isBfloat16, __global ushort * packed, uint packedRowOffset,
+                            __global algorithmFPType * sumOfSquares, algorithmFPType squaresScale) {
+        const uint row       = get_global_id(1);
+        const uint localId   = get_local_id(0);
+        const uint localSize = get_local_size(0);
+
+        __local float partialSums[LOCAL_BUFFER_SIZE];
+
+        const ulong srcOffset = (ulong)row * nCols;
+        const ulong dstOffset = (ulong)(packedRowOffset + row) * nCols;
+
+        float sum = 0.0f;
+        for (uint j = localId; j < nCols; j += localSize)
+        {
+            packValue((float)data[srcOffset + j], packed, dstOffset + j, isBfloat16);
+            const float value = unpackValue(packed, dstOffset + j, isBfloat16);
+            sum += value * value;
+        }
+        partialSums[localId] = sum;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint stride = localSize / 2; stride > 0; stride /= 2)
+        {
+            if (localId < stride)
+            {
+                partialSums[localId] += partialSums[localId + stride];
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if (localId == 0)
+        {
+            sumOfSquares[packedRowOffset + row] = squaresScale * (algorithmFPType)partialSums[0];
+        }
+    }
+
+    __kernel void gemm_packed(__global const ushort * a, uint aRowOffset, uint m, __global const ushort * b, uint bRowOffset, uint n, uint nCols,
+                              uint isBfloat16, algorithmFPType alpha, __global const algorithmFPType * bSq, __global algorithmFPType * c, uint ldcRow,
+                              uint ldcCol) {
+        __local float aTile[TILE_SIZE * TILE_SIZE];
+        __local float bTile[TILE_SIZE * TILE_SIZE];
+
+        const uint li = get_local_id(0);
+        const uint lj = get_local_id(1);
+        const uint i  = get_group_id(0) * TILE_SIZE + li;
+        const uint j  = get_group_id(1) * TILE_SIZE + lj;
+
+        /* Consecutive work-items load consecutive features of the same row */
+        const uint aRow = get_group_id(0) * TILE_SIZE + lj;
+        const uint bRow = get_group_id(1) * TILE_SIZE + lj;
+
+        float acc = 0.0f;
+        for (uint t = 0; t < nCols; t += TILE_SIZE)
+        {
+            const uint col             = t + li;
+            aTile[lj * TILE_SIZE + li] = (aRow < m && col < nCols) ? unpackValue(a, (ulong)(aRowOffset + aRow) * nCols + col, isBfloat16) : 0.0f;
+            bTile[lj * TILE_SIZE + li] = (bRow < n && col < nCols) ? unpackValue(b, (ulong)(bRowOffset + bRow) * nCols + col, isBfloat16) : 0.0f;
+            barrier(CLK_LOCAL_MEM_FENCE);
+
+            for (uint f = 0; f < TILE_SIZE; f++)
+            {
+                acc += aTile[li * TILE_SIZE + f] * bTile[lj * TILE_SIZE + f];
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+
+        if (i < m && j < n)
+        {
+            c[(ulong)i * ldcRow + (ulong)j * ldcCol] = bSq[bRowOffset + j] + alpha * (algorithmFPType)acc;
+        }
+    }
+
+);
+
+#endif
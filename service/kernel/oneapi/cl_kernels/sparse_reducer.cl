@@ -0,0 +1,115 @@
+/* file: sparse_reducer.cl */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of reduction kernels for sparse matrices in the column major (CSC) format.
+//--
+*/
+
+#ifndef __SPARSE_REDUCER_CL__
+#define __SPARSE_REDUCER_CL__
+
+#define DECLARE_SOURCE(name, src) static const char * name = #src;
+
+DECLARE_SOURCE(
+    sparse_reducer,
+
+    __kernel void sparse_column_reduce(__global const algorithmFPType * values, __global const uint * colOffsets, uint nRows, uint nColumns,
+                                       __global algorithmFPType * sums, __global algorithmFPType * sqSums, __global algorithmFPType * minimums,
+                                       __global algorithmFPType * maximums) {
+        const uint col = get_global_id(0);
+        if (col >= nColumns) return;
+
+        const uint begin = colOffsets[col];
+        const uint end   = colOffsets[col + 1];
+
+        algorithmFPType sum   = (algorithmFPType)0;
+        algorithmFPType sqSum = (algorithmFPType)0;
+        algorithmFPType vMin  = (algorithmFPType)0;
+        algorithmFPType vMax  = (algorithmFPType)0;
+
+        if (begin < end)
+        {
+            vMin = values[begin];
+            vMax = values[begin];
+        }
+
+        for (uint k = begin; k < end; k++)
+        {
+            const algorithmFPType el = values[k];
+            sum += el;
+            sqSum += el * el;
+            vMin = fmin(vMin, el);
+            vMax = fmax(vMax, el);
+        }
+
+        /* Implicit zeros of the column take part in the minimum and maximum */
+        if (end - begin < nRows)
+        {
+            vMin = fmin(vMin, (algorithmFPType)0);
+            vMax = fmax(vMax, (algorithmFPType)0);
+        }
+
+        sums[col]     = sum;
+        sqSums[col]   = sqSum;
+        minimums[col] = vMin;
+        maximums[col] = vMax;
+    }
+
+    __kernel void sparse_cross_product(__global const algorithmFPType * values, __global const uint * rowIndices, __global const uint * colOffsets,
+                                       uint nRows, uint nColumns, __global const algorithmFPType * sums, __global algorithmFPType * crossProduct) {
+        const uint i = get_global_id(0);
+        const uint j = get_global_id(1);
+        if (i >= nColumns || j > i) return;
+
+        uint ki         = colOffsets[i];
+        uint kj         = colOffsets[j];
+        const uint endI = colOffsets[i + 1];
+        const uint endJ = colOffsets[j + 1];
+
+        /* Row indices of the columns are sorted, the dot product is computed by merging them */
+        algorithmFPType dot = (algorithmFPType)0;
+        while (ki < endI && kj < endJ)
+        {
+            const uint ri = rowIndices[ki];
+            const uint rj = rowIndices[kj];
+            if (ri == rj)
+            {
+                dot += values[ki] * values[kj];
+                ki++;
+                kj++;
+            }
+            else if (ri < rj)
+            {
+                ki++;
+            }
+            else
+            {
+                kj++;
+            }
+        }
+
+        const algorithmFPType value = dot - sums[i] * sums[j] / (algorithmFPType)nRows;
+
+        crossProduct[i * nColumns + j] = value;
+        crossProduct[j * nColumns + i] = value;
+    }
+
+);
+
+#endif
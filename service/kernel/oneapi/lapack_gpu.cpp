@@ -20,6 +20,7 @@
 #include "services/error_handling.h"
 #include "service/kernel/oneapi/blas_gpu.h"
 #include "service/kernel/oneapi/cl_kernels/kernel_blas.cl"
+#include "service/kernel/oneapi/cl_kernels/kernel_lapack.cl"
 
 namespace daal
 {
@@ -79,12 +80,123 @@ services::Status ReferencePotrs<algorithmFPType>::operator()(const math::UpLo up
     return status;
 }
 
+/* Number of work-items that process one matrix of the batch */
+static const uint32_t batchLocalSize = 32;
+
+template <typename algorithmFPType>
+static void buildPotrfBatchProgram(ClKernelFactoryIface & factory)
+{
+    services::String options  = getKeyFPType<algorithmFPType>();
+    services::String cacheKey = "__daal_potrf_batch_";
+    cacheKey.add(options);
+
+    factory.build(ExecutionTargetIds::device, cacheKey.c_str(), clKernelPotrfBatch, options.c_str());
+}
+
+static services::Status getBatchRange(const size_t batchSize, KernelNDRange & range)
+{
+    services::Status status;
+
+    KernelRange localRange(batchLocalSize);
+    KernelRange globalRange(batchSize * batchLocalSize);
+
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.global(globalRange, &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status ReferencePotrfBatch<algorithmFPType>::operator()(const math::UpLo uplo, const size_t n, services::Buffer<algorithmFPType> & a_buffer,
+                                                                  const size_t lda, const size_t strideA, const size_t batchSize)
+{
+    services::Status status;
+    if (!batchSize) return status;
+
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    buildPotrfBatchProgram<algorithmFPType>(factory);
+
+    KernelPtr kernel = factory.getKernel("potrf_batch", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    UniversalBuffer info = ctx.allocate(TypeIds::id<int>(), batchSize, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(6);
+    args.set(0, a_buffer, AccessModeIds::readwrite);
+    args.set(1, (uint32_t)n);
+    args.set(2, (uint32_t)lda);
+    args.set(3, (uint32_t)strideA);
+    args.set(4, int(uplo == math::UpLo::Upper));
+    args.set(5, info, AccessModeIds::write);
+
+    KernelNDRange range(1);
+    DAAL_CHECK_STATUS(status, getBatchRange(batchSize, range));
+
+    ctx.run(range, kernel, args, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    /* Non-zero info means that the matrix is not positive definite as for the non-batched routine */
+    auto infoHost = info.get<int>().toHost(data_management::ReadWriteMode::readOnly, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    for (size_t i = 0; i < batchSize; i++)
+    {
+        DAAL_CHECK(infoHost.get()[i] == 0, services::ErrorID::ErrorNormEqSystemSolutionFailed);
+    }
+
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status ReferencePotrsBatch<algorithmFPType>::operator()(const math::UpLo uplo, const size_t n, const size_t ny,
+                                                                  services::Buffer<algorithmFPType> & a_buffer, const size_t lda,
+                                                                  const size_t strideA, services::Buffer<algorithmFPType> & b_buffer,
+                                                                  const size_t ldb, const size_t strideB, const size_t batchSize)
+{
+    services::Status status;
+    if (!batchSize) return status;
+
+    ExecutionContextIface & ctx    = services::Environment::getInstance()->getDefaultExecutionContext();
+    ClKernelFactoryIface & factory = ctx.getClKernelFactory();
+
+    buildPotrfBatchProgram<algorithmFPType>(factory);
+
+    KernelPtr kernel = factory.getKernel("potrs_batch", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(9);
+    args.set(0, a_buffer, AccessModeIds::read);
+    args.set(1, (uint32_t)n);
+    args.set(2, (uint32_t)lda);
+    args.set(3, (uint32_t)strideA);
+    args.set(4, int(uplo == math::UpLo::Upper));
+    args.set(5, b_buffer, AccessModeIds::readwrite);
+    args.set(6, (uint32_t)ny);
+    args.set(7, (uint32_t)ldb);
+    args.set(8, (uint32_t)strideB);
+
+    KernelNDRange range(1);
+    DAAL_CHECK_STATUS(status, getBatchRange(batchSize, range));
+
+    ctx.run(range, kernel, args, &status);
+
+    return status;
+}
+
 template class ReferencePotrf<float>;
 template class ReferencePotrf<double>;
 
 template class ReferencePotrs<float>;
 template class ReferencePotrs<double>;
 
+template class ReferencePotrfBatch<float>;
+template class ReferencePotrfBatch<double>;
+
+template class ReferencePotrsBatch<float>;
+template class ReferencePotrsBatch<double>;
+
 } // namespace interface1
 } // namespace math
 } // namespace internal
@@ -62,6 +62,32 @@ struct LapackGpu
 
         return status;
     }
+
+    /* Strided batched POTRF, the i-th matrix starts at the offset i * strideA */
+    static services::Status xpotrfBatch(const math::UpLo uplo, const uint32_t n, UniversalBuffer a_buffer, const uint32_t lda, const uint32_t strideA,
+                                        const uint32_t batchSize)
+    {
+        services::Status status;
+
+        ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        ctx.potrfBatch(uplo, n, a_buffer, lda, strideA, batchSize, &status);
+
+        return status;
+    }
+
+    static services::Status xpotrsBatch(const math::UpLo uplo, const uint32_t n, const uint32_t ny, UniversalBuffer a_buffer, const uint32_t lda,
+                                        const uint32_t strideA, UniversalBuffer b_buffer, const uint32_t ldb, const uint32_t strideB,
+                                        const uint32_t batchSize)
+    {
+        services::Status status;
+
+        ExecutionContextIface & ctx = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        ctx.potrsBatch(uplo, n, ny, a_buffer, lda, strideA, b_buffer, ldb, strideB, batchSize, &status);
+
+        return status;
+    }
 };
 
 } // namespace internal
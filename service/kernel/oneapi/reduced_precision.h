@@ -0,0 +1,74 @@
+/* file: reduced_precision.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __REDUCED_PRECISION_H__
+#define __REDUCED_PRECISION_H__
+
+#include "services/buffer.h"
+#include "oneapi/internal/types.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace math
+{
+/**
+ * 16-bit floating-point formats of the packed matrices
+ */
+enum class PackedType
+{
+    bfloat16,
+    float16
+};
+
+/**
+ * Operations on row-major matrices packed to 16-bit floating-point values.
+ * Packing halves the memory traffic of the distance computations, the inner products are accumulated in single precision.
+ */
+class ReducedPrecision
+{
+public:
+    /* Type of the elements of the packed matrices */
+    static TypeId packedTypeId() { return TypeIds::id<uint16_t>(); }
+
+    /* Packs the rows of the row-major matrix data[nRows x nCols] to the rows of the packed matrix starting from packedRowOffset,
+       sumOfSquares[packedRowOffset + i] is set to squaresScale times the sum of squares of the packed values of the i-th row */
+    template <typename algorithmFPType>
+    static services::Status pack(PackedType type, const services::Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nCols,
+                                 UniversalBuffer & packed, uint32_t packedRowOffset, UniversalBuffer & sumOfSquares, algorithmFPType squaresScale);
+
+    /* Computes c[i * ldcRow + j * ldcCol] = alpha * <a_i, b_j> + bSq[bRowOffset + j] for the rows a_i, i < m, of the packed matrix a
+       starting from aRowOffset and the rows b_j, j < n, of the packed matrix b starting from bRowOffset */
+    template <typename algorithmFPType>
+    static services::Status gemm(PackedType type, const UniversalBuffer & a, uint32_t aRowOffset, uint32_t m, const UniversalBuffer & b,
+                                 uint32_t bRowOffset, uint32_t n, uint32_t nCols, algorithmFPType alpha, const UniversalBuffer & bSq,
+                                 UniversalBuffer & c, uint32_t ldcRow, uint32_t ldcCol);
+
+private:
+    ReducedPrecision();
+};
+
+} // namespace math
+} // namespace internal
+} // namespace oneapi
+} // namespace daal
+
+#endif
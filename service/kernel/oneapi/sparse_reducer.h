@@ -0,0 +1,165 @@
+/* file: sparse_reducer.h */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef __SPARSE_REDUCER_H__
+#define __SPARSE_REDUCER_H__
+
+#include "services/buffer.h"
+#include "services/daal_memory.h"
+#include "services/daal_shared_ptr.h"
+#include "services/env_detect.h"
+#include "services/internal/error_handling_helpers.h"
+#include "service/kernel/oneapi/cl_kernels/sparse_reducer.cl"
+#include "oneapi/internal/types_utils.h"
+#include "oneapi/internal/execution_context.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace math
+{
+/**
+ * Column-wise reductions of a sparse matrix.
+ * The CSR blocks of the numeric tables are kept on the host, so the matrix is transposed to the column major (CSC) layout
+ * while it is uploaded to the device. Each column is then reduced by a single work-item without atomics.
+ */
+class SparseReducer
+{
+public:
+    struct ColumnMajorMatrix
+    {
+        UniversalBuffer values;     /* Non-zero values ordered by columns */
+        UniversalBuffer rowIndices; /* Zero-based row indices of the values, sorted within each column */
+        UniversalBuffer colOffsets; /* Offsets of the columns in the values, nColumns + 1 elements */
+    };
+
+    struct Result
+    {
+        UniversalBuffer sum;
+        UniversalBuffer sumOfSquares;
+        UniversalBuffer minimum;
+        UniversalBuffer maximum;
+
+        Result(ExecutionContextIface & context, uint32_t nColumns, TypeId type, services::Status * status)
+            : sum(context.allocate(type, nColumns, status)),
+              sumOfSquares(context.allocate(type, nColumns, status)),
+              minimum(context.allocate(type, nColumns, status)),
+              maximum(context.allocate(type, nColumns, status))
+        {}
+    };
+
+public:
+    /**
+     * Uploads the block of the CSR table with one-based indices to the device in the column major layout
+     */
+    template <typename algorithmFPType>
+    static ColumnMajorMatrix toColumnMajor(const algorithmFPType * values, const size_t * colIndices, const size_t * rowOffsets, uint32_t nRows,
+                                           uint32_t nColumns, services::Status * status)
+    {
+        ColumnMajorMatrix matrix;
+        auto & context = services::Environment::getInstance()->getDefaultExecutionContext();
+
+        const size_t nNonZeros = rowOffsets[nRows] - rowOffsets[0];
+        if (static_cast<size_t>(static_cast<uint32_t>(nNonZeros)) != nNonZeros)
+        {
+            services::internal::tryAssignStatus(status, services::ErrorBufferSizeIntegerOverflow);
+            return matrix;
+        }
+
+        services::SharedPtr<algorithmFPType> cscValues(
+            static_cast<algorithmFPType *>(services::daal_malloc((nNonZeros ? nNonZeros : 1) * sizeof(algorithmFPType))), services::ServiceDeleter());
+        services::SharedPtr<uint32_t> cscRows(static_cast<uint32_t *>(services::daal_malloc((nNonZeros ? nNonZeros : 1) * sizeof(uint32_t))),
+                                              services::ServiceDeleter());
+        services::SharedPtr<uint32_t> cscOffsets(static_cast<uint32_t *>(services::daal_calloc((nColumns + 1) * sizeof(uint32_t))),
+                                                 services::ServiceDeleter());
+        if (!cscValues || !cscRows || !cscOffsets)
+        {
+            services::internal::tryAssignStatus(status, services::ErrorMemoryAllocationFailed);
+            return matrix;
+        }
+
+        uint32_t * const offsets = cscOffsets.get();
+        for (size_t k = 0; k < nNonZeros; k++)
+        {
+            offsets[colIndices[k]]++;
+        }
+        for (uint32_t col = 0; col < nColumns; col++)
+        {
+            offsets[col + 1] += offsets[col];
+        }
+
+        /* Rows are visited in ascending order, so the row indices are sorted within each column;
+           offsets[col] is advanced to the end of the previous column and restored afterwards */
+        for (uint32_t row = 0; row < nRows; row++)
+        {
+            for (size_t k = rowOffsets[row] - 1; k < rowOffsets[row + 1] - 1; k++)
+            {
+                const uint32_t dst   = offsets[colIndices[k] - 1]++;
+                cscValues.get()[dst] = values[k];
+                cscRows.get()[dst]   = row;
+            }
+        }
+        for (uint32_t col = nColumns; col > 0; col--)
+        {
+            offsets[col] = offsets[col - 1];
+        }
+        offsets[0] = 0;
+
+        matrix.values = context.allocate(TypeIds::id<algorithmFPType>(), nNonZeros ? nNonZeros : 1, status);
+        DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, matrix);
+        matrix.rowIndices = context.allocate(TypeIds::uint32, nNonZeros ? nNonZeros : 1, status);
+        DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, matrix);
+        matrix.colOffsets = context.allocate(TypeIds::uint32, nColumns + 1, status);
+        DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, matrix);
+
+        if (nNonZeros)
+        {
+            context.copy(matrix.values, 0, cscValues.get(), 0, nNonZeros, status);
+            DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, matrix);
+            context.copy(matrix.rowIndices, 0, cscRows.get(), 0, nNonZeros, status);
+            DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, matrix);
+        }
+        context.copy(matrix.colOffsets, 0, offsets, 0, nColumns + 1, status);
+
+        return matrix;
+    }
+
+    /**
+     * Computes sums, sums of squares, minimums and maximums of the columns, implicit zeros are taken into account
+     */
+    static Result reduceColumns(const ColumnMajorMatrix & matrix, TypeId type, uint32_t nRows, uint32_t nColumns, services::Status * status);
+
+    /**
+     * Computes the full nColumns x nColumns cross-product matrix centered with the column sums:
+     * crossProduct[i][j] = sum_k x_ki x_kj - sums[i] * sums[j] / nRows
+     */
+    static void crossProduct(const ColumnMajorMatrix & matrix, TypeId type, uint32_t nRows, uint32_t nColumns, const UniversalBuffer & sums,
+                             const UniversalBuffer & crossProduct, services::Status * status);
+
+private:
+    SparseReducer();
+};
+
+} // namespace math
+} // namespace internal
+} // namespace oneapi
+} // namespace daal
+
+#endif
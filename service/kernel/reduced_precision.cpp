@@ -0,0 +1,152 @@
+/* file: reduced_precision.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "service/kernel/oneapi/reduced_precision.h"
+#include "service/kernel/oneapi/cl_kernels/reduced_precision.cl"
+#include "services/env_detect.h"
+#include "externals/service_ittnotify.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace math
+{
+DAAL_ITTNOTIFY_DOMAIN(daal.oneapi.internal.math.ReducedPrecision);
+
+static const uint32_t packLocalSize = 64;
+static const uint32_t gemmTileSize  = 16;
+
+template <typename algorithmFPType>
+static void buildReducedPrecisionProgram(ClKernelFactoryIface & kernelFactory, services::Status * status)
+{
+    services::String fptype_name = getKeyFPType<algorithmFPType>();
+    auto build_options           = fptype_name;
+    build_options.add("-cl-std=CL1.2 -D LOCAL_BUFFER_SIZE=64 -D TILE_SIZE=16");
+
+    services::String cachekey("__daal_oneapi_internal_math_reduced_precision_");
+    cachekey.add(fptype_name);
+    kernelFactory.build(ExecutionTargetIds::device, cachekey.c_str(), reduced_precision, build_options.c_str(), status);
+}
+
+template <typename algorithmFPType>
+services::Status ReducedPrecision::pack(PackedType type, const services::Buffer<algorithmFPType> & data, uint32_t nRows, uint32_t nCols,
+                                        UniversalBuffer & packed, uint32_t packedRowOffset, UniversalBuffer & sumOfSquares,
+                                        algorithmFPType squaresScale)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(ReducedPrecision.pack);
+
+    services::Status status;
+    if (!nRows) return status;
+
+    auto & context       = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    buildReducedPrecisionProgram<algorithmFPType>(kernelFactory, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    auto kernel = kernelFactory.getKernel("pack_rows", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(7);
+    args.set(0, data, AccessModeIds::read);
+    args.set(1, nCols);
+    args.set(2, uint32_t(type == PackedType::bfloat16));
+    args.set(3, packed, AccessModeIds::write);
+    args.set(4, packedRowOffset);
+    args.set(5, sumOfSquares, AccessModeIds::write);
+    args.set(6, squaresScale);
+
+    KernelRange localRange(packLocalSize, 1);
+    KernelRange globalRange(packLocalSize, nRows);
+
+    KernelNDRange range(2);
+    range.global(globalRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    context.run(range, kernel, args, &status);
+    return status;
+}
+
+template <typename algorithmFPType>
+services::Status ReducedPrecision::gemm(PackedType type, const UniversalBuffer & a, uint32_t aRowOffset, uint32_t m, const UniversalBuffer & b,
+                                        uint32_t bRowOffset, uint32_t n, uint32_t nCols, algorithmFPType alpha, const UniversalBuffer & bSq,
+                                        UniversalBuffer & c, uint32_t ldcRow, uint32_t ldcCol)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(ReducedPrecision.gemm);
+
+    services::Status status;
+    if (!m || !n) return status;
+
+    auto & context       = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    buildReducedPrecisionProgram<algorithmFPType>(kernelFactory, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    auto kernel = kernelFactory.getKernel("gemm_packed", &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    KernelArguments args(13);
+    args.set(0, a, AccessModeIds::read);
+    args.set(1, aRowOffset);
+    args.set(2, m);
+    args.set(3, b, AccessModeIds::read);
+    args.set(4, bRowOffset);
+    args.set(5, n);
+    args.set(6, nCols);
+    args.set(7, uint32_t(type == PackedType::bfloat16));
+    args.set(8, alpha);
+    args.set(9, bSq, AccessModeIds::read);
+    args.set(10, c, AccessModeIds::write);
+    args.set(11, ldcRow);
+    args.set(12, ldcCol);
+
+    const uint32_t nTilesM = m / gemmTileSize + uint32_t(m % gemmTileSize != 0);
+    const uint32_t nTilesN = n / gemmTileSize + uint32_t(n % gemmTileSize != 0);
+
+    KernelRange localRange(gemmTileSize, gemmTileSize);
+    KernelRange globalRange(nTilesM * gemmTileSize, nTilesN * gemmTileSize);
+
+    KernelNDRange range(2);
+    range.global(globalRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+    range.local(localRange, &status);
+    DAAL_CHECK_STATUS_VAR(status);
+
+    context.run(range, kernel, args, &status);
+    return status;
+}
+
+#define INSTANTIATE_REDUCED_PRECISION(algorithmFPType)                                                                                             \
+    template services::Status ReducedPrecision::pack<algorithmFPType>(PackedType, const services::Buffer<algorithmFPType> &, uint32_t, uint32_t, \
+                                                                      UniversalBuffer &, uint32_t, UniversalBuffer &, algorithmFPType);            \
+    template services::Status ReducedPrecision::gemm<algorithmFPType>(PackedType, const UniversalBuffer &, uint32_t, uint32_t,                   \
+                                                                      const UniversalBuffer &, uint32_t, uint32_t, uint32_t, algorithmFPType,     \
+                                                                      const UniversalBuffer &, UniversalBuffer &, uint32_t, uint32_t);
+
+INSTANTIATE_REDUCED_PRECISION(float)
+INSTANTIATE_REDUCED_PRECISION(double)
+
+} // namespace math
+} // namespace internal
+} // namespace oneapi
+} // namespace daal
@@ -24,6 +24,8 @@
 #include "services/error_indexes.h"
 #include "services/error_handling.h"
 #include "service/kernel/service_algo_utils.h"
+#include "service/kernel/service_defines.h"
+#include "algorithms/threading/threading.h"
 
 namespace daal
 {
@@ -38,6 +40,16 @@ HostAppIface::~HostAppIface()
     delete _impl;
     _impl = NULL;
 }
+
+void HostAppIface::reportProgress(size_t nIterations, double objective) {}
+
+ThreadArena::ThreadArena(size_t nThreads) : _nThreads(nThreads), _arena(_daal_new_arena((int)nThreads)) {}
+
+ThreadArena::~ThreadArena()
+{
+    _daal_del_arena(_arena);
+    _arena = NULL;
+}
 } // namespace interface1
 
 namespace internal
@@ -49,6 +61,20 @@ bool isCancelled(services::Status & s, services::HostAppIface * pHostApp)
     return true;
 }
 
+void reportProgress(services::HostAppIface * pHostApp, size_t nIterations, double objective)
+{
+    if (pHostApp) pHostApp->reportProgress(nIterations, objective);
+}
+
+void reportProgress(services::HostAppIface * pHostApp, size_t nIterations)
+{
+    /* Quiet NaN is reported as the objective of the algorithms that do not compute it */
+    _daal_dp_union_t nan;
+    nan.hex[0] = 0;
+    nan.hex[1] = 0x7ff80000u;
+    reportProgress(pHostApp, nIterations, nan.fp);
+}
+
 HostAppHelper::HostAppHelper(HostAppIface * hostApp, size_t maxJobsBeforeCheck)
     : _hostApp(hostApp), _maxJobsBeforeCheck(maxJobsBeforeCheck), _nJobsAfterLastCheck(0)
 {}
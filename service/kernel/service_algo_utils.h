@@ -24,6 +24,7 @@
 #define __SERVICE_ALGO_UTILS_H__
 
 #include "services/host_app.h"
+#include "services/thread_arena.h"
 
 namespace daal
 {
@@ -44,6 +45,24 @@ services::HostAppIface * hostApp(algorithms::interface1::Input & inp);
 void setHostApp(const services::SharedPtr<services::HostAppIface> & pHostApp, algorithms::interface1::Input & inp);
 services::HostAppIfacePtr getHostApp(daal::algorithms::interface1::Input & inp);
 bool isCancelled(services::Status & s, services::HostAppIface * pHostApp);
+void reportProgress(services::HostAppIface * pHostApp, size_t nIterations, double objective);
+void reportProgress(services::HostAppIface * pHostApp, size_t nIterations);
+
+services::ThreadArena * threadArena(algorithms::interface1::Input & inp);
+void setThreadArena(const services::ThreadArenaPtr & pArena, algorithms::interface1::Input & inp);
+services::ThreadArenaPtr getThreadArena(daal::algorithms::interface1::Input & inp);
+
+/* The kernels of an algorithm drop the data cached in the previous computations, e.g. the squared norms of the rows
+   of the input, at the start of each computation unless the reuse is enabled. The reuse is enabled by the algorithms
+   that call the algorithm internally on the data unchanged between the calls, e.g. svm training calls the kernel function */
+bool reusesCachedData(algorithms::interface1::Input & inp);
+void setCachedDataReuse(bool reuse, algorithms::interface1::Input & inp);
+
+class ThreadArenaAccessor
+{
+public:
+    static void * getArena(const ThreadArena & arena) { return arena._arena; }
+};
 
 //////////////////////////////////////////////////////////////////////////////////////////
 // Helper class handling cancellation status depending on the number of jobs to be done
@@ -95,6 +95,22 @@ struct ScalableCalloc
     static void deallocate(T * ptr) { service_scalable_free<T, cpu>(ptr); }
 };
 
+/* Allocators of the temporaries of the kernels from the scratch arena of the calling thread.
+ * The memory must not outlive the compute() call of the algorithm that allocates it */
+template <typename T, CpuType cpu>
+struct ScratchMalloc
+{
+    static T * allocate(size_t n) { return service_scratch_malloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
+template <typename T, CpuType cpu>
+struct ScratchCalloc
+{
+    static T * allocate(size_t n) { return service_scratch_calloc<T, cpu>(n); }
+    static void deallocate(T * ptr) { service_scratch_free<T, cpu>(ptr); }
+};
+
 /* CPU specific deleters */
 
 template <typename T, CpuType cpu>
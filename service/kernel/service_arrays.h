@@ -116,6 +116,12 @@ using TArrayScalable = DynamicArray<T, ScalableMalloc<T, cpu>, ConstructionPolic
 template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
 using TArrayScalableCalloc = DynamicArray<T, ScalableCalloc<T, cpu>, ConstructionPolicy, cpu>;
 
+template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
+using TArrayScratch = DynamicArray<T, ScratchMalloc<T, cpu>, ConstructionPolicy, cpu>;
+
+template <typename T, CpuType cpu, typename ConstructionPolicy = DefaultConstructionPolicy<T, cpu> >
+using TArrayScratchCalloc = DynamicArray<T, ScratchCalloc<T, cpu>, ConstructionPolicy, cpu>;
+
 template <typename T, size_t staticBufferSize, typename Allocator, typename ConstructionPolicy, CpuType cpu>
 class StaticallyBufferedDynamicArray
 {
@@ -125,6 +125,26 @@ struct SignBit<double, cpu>
     static int get(double val) { return ((_daal_dp_union_t *)&val)->bits.sign; }
 };
 
+template <typename T, CpuType cpu>
+struct IsNaN;
+
+template <CpuType cpu>
+struct IsNaN<float, cpu>
+{
+    static int get(float val) { return (((_daal_sp_union_t *)&val)->hex[0] & 0x7fffffffu) > 0x7f800000u; }
+};
+
+template <CpuType cpu>
+struct IsNaN<double, cpu>
+{
+    static int get(double val)
+    {
+        const uint32_t * hex = ((_daal_dp_union_t *)&val)->hex;
+        const uint32_t hi    = hex[1] & 0x7fffffffu;
+        return (hi > 0x7ff00000u) | ((hi == 0x7ff00000u) & (hex[0] != 0));
+    }
+};
+
 template <typename T1, typename T2, CpuType cpu>
 void vectorConvertFuncCpu(size_t n, void * src, void * dst);
 
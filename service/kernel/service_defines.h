@@ -29,6 +29,25 @@
 
 int __daal_serv_cpu_detect(int);
 
+namespace daal
+{
+namespace internal
+{
+/* Instruction set extensions of the avx512 branch that are detected at run time and used by the kernels directly */
+enum CpuFeature
+{
+    cpu_feature_unknown     = 0,
+    cpu_feature_avx512_vnni = 1 << 0, /* Vector neural network instructions on 8-bit integers */
+    cpu_feature_avx512_bf16 = 1 << 1, /* Dot products of bfloat16 pairs */
+    cpu_feature_amx_bf16    = 1 << 2, /* Advanced matrix extensions on bfloat16 tiles */
+    cpu_feature_amx_int8    = 1 << 3  /* Advanced matrix extensions on 8-bit integer tiles */
+};
+} // namespace internal
+} // namespace daal
+
+/* Returns the CpuFeature flags supported by the processor and enabled by OS */
+int __daal_serv_cpu_feature_detect();
+
 #if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
     #define PRAGMA_IVDEP
     #define PRAGMA_NOVECTOR
@@ -1737,6 +1737,26 @@ unsigned _internal_daal_GetEnumerateAPICID(unsigned processor)
     return glbl_obj.pApicAffOrdMapping[processor].APICID;
 }
 
+/*
+ * _internal_daal_GetProcessorPackageOrdinal
+ *
+ * Returns the ordinal of the processor package of the logical processor
+ *
+ * Arguments:
+ *     processor - Os processor number
+ * Return: Package ordinal for the specified processor
+ */
+unsigned _internal_daal_GetProcessorPackageOrdinal(unsigned processor)
+{
+    if (!glbl_obj.isInit) __internal_daal_initCpuTopology();
+
+    if (glbl_obj.error) return 0xffffffff;
+
+    if (processor >= glbl_obj.OSProcessorCount) return 0xffffffff; // allow caller to intercept error
+
+    return glbl_obj.pApicAffOrdMapping[processor].packageORD;
+}
+
 /*
  * _internal_daal_GetEnumeratedCoreCount
  *
@@ -2005,6 +2025,53 @@ void read_topology(int & status, int & nthreads, int & max_threads, int ** cpu_q
     return;
 }
 
+void read_topology_nodes(int & status, int & nnodes, int & max_threads, int ** cpu_node)
+{
+    status      = 0;
+    nnodes      = 0;
+    max_threads = 0;
+    *cpu_node   = NULL;
+
+    /* Processor packages are used as NUMA nodes */
+    max_threads = daal::services::internal::_internal_daal_GetSysLogicalProcessorCount();
+    nnodes      = daal::services::internal::_internal_daal_GetSysProcessorPackageCount();
+    if (!max_threads || !nnodes)
+    {
+        status--;
+        return;
+    }
+
+    *cpu_node = (int *)daal::services::daal_malloc(max_threads * sizeof(int), 64);
+    if (!(*cpu_node))
+    {
+        status--;
+        return;
+    }
+
+    for (int i = 0; i < max_threads; i++)
+    {
+        const unsigned pkg = daal::services::internal::_internal_daal_GetProcessorPackageOrdinal(i);
+        if (pkg >= (unsigned)nnodes)
+        {
+            status--;
+            return;
+        }
+        (*cpu_node)[i] = (int)pkg;
+    }
+
+    return;
+}
+
+bool is_hybrid_cpu()
+{
+    /* CPUID.07H:EDX[15] is set on the processors with the cores of different types, e.g. performance and efficient cores */
+    daal::services::internal::CPUIDinfo info;
+    daal::services::internal::__internal_daal_cpuid(&info, 0);
+    if (info.EAX < 7) return false;
+    daal::services::internal::__internal_daal_cpuid_(&info, 7, 0);
+    return ((info.EDX >> 15) & 1) != 0;
+}
+
 void delete_topology(void * ptr)
 {
     daal::services::daal_free(ptr);
@@ -351,6 +351,7 @@ unsigned _internal_daal_GetLogicalProcessorCount();
 unsigned _internal_daal_GetCoresPerPackageProcessorCount();
 unsigned _internal_daal_GetProcessorPackageCount();
 unsigned _internal_daal_GetEnumerateAPICID(unsigned processor);
+unsigned _internal_daal_GetProcessorPackageOrdinal(unsigned processor);
 unsigned _internal_daal_GetLogicalPerCoreProcessorCount();
 unsigned _internal_daal_GetCoreCount(unsigned long package_ordinal);
 unsigned _internal_daal_GetThreadCount(unsigned long package_ordinal, unsigned long core_ordinal);
@@ -363,6 +364,8 @@ unsigned _internal_daal_GetSysLogicalProcessorCount();
 } // namespace daal
 
 void read_topology(int & status, int & nthreads, int & max_threads, int ** cpu_queue);
+void read_topology_nodes(int & status, int & nnodes, int & max_threads, int ** cpu_node);
+bool is_hybrid_cpu();
 void delete_topology(void * ptr);
 
 #endif /* #if !defined (DAAL_CPU_TOPO_DISABLED) */
@@ -0,0 +1,105 @@
+/* file: sparse_reducer.cpp */
+/*******************************************************************************
+* Copyright 2020 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "service/kernel/oneapi/sparse_reducer.h"
+#include "services/env_detect.h"
+#include "externals/service_ittnotify.h"
+
+namespace daal
+{
+namespace oneapi
+{
+namespace internal
+{
+namespace math
+{
+DAAL_ITTNOTIFY_DOMAIN(daal.oneapi.internal.math.SparseReducer);
+
+static void buildSparseReducerProgram(ClKernelFactoryIface & kernelFactory, const TypeId & vectorTypeId)
+{
+    services::String fptype_name = getKeyFPType(vectorTypeId);
+    auto build_options           = fptype_name;
+    build_options.add("-cl-std=CL1.2");
+
+    services::String cachekey("__daal_oneapi_internal_math_sparse_reducer_");
+    cachekey.add(fptype_name);
+    kernelFactory.build(ExecutionTargetIds::device, cachekey.c_str(), sparse_reducer, build_options.c_str());
+}
+
+SparseReducer::Result SparseReducer::reduceColumns(const ColumnMajorMatrix & matrix, TypeId type, uint32_t nRows, uint32_t nColumns,
+                                                   services::Status * status)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(SparseReducer.reduceColumns);
+
+    auto & context       = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    buildSparseReducerProgram(kernelFactory, type);
+
+    Result result(context, nColumns, type, status);
+    DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+    auto kernel = kernelFactory.getKernel("sparse_column_reduce", status);
+    DAAL_CHECK_STATUS_RETURN_IF_FAIL(status, result);
+
+    KernelArguments args(8);
+    args.set(0, matrix.values, AccessModeIds::read);
+    args.set(1, matrix.colOffsets, AccessModeIds::read);
+    args.set(2, nRows);
+    args.set(3, nColumns);
+    args.set(4, result.sum, AccessModeIds::write);
+    args.set(5, result.sumOfSquares, AccessModeIds::write);
+    args.set(6, result.minimum, AccessModeIds::write);
+    args.set(7, result.maximum, AccessModeIds::write);
+
+    KernelRange range(nColumns);
+    context.run(range, kernel, args, status);
+
+    return result;
+}
+
+void SparseReducer::crossProduct(const ColumnMajorMatrix & matrix, TypeId type, uint32_t nRows, uint32_t nColumns, const UniversalBuffer & sums,
+                                 const UniversalBuffer & crossProduct, services::Status * status)
+{
+    DAAL_ITTNOTIFY_SCOPED_TASK(SparseReducer.crossProduct);
+
+    auto & context       = services::Environment::getInstance()->getDefaultExecutionContext();
+    auto & kernelFactory = context.getClKernelFactory();
+
+    buildSparseReducerProgram(kernelFactory, type);
+
+    auto kernel = kernelFactory.getKernel("sparse_cross_product", status);
+    DAAL_CHECK_STATUS_PTR(status);
+
+    KernelArguments args(7);
+    args.set(0, matrix.values, AccessModeIds::read);
+    args.set(1, matrix.rowIndices, AccessModeIds::read);
+    args.set(2, matrix.colOffsets, AccessModeIds::read);
+    args.set(3, nRows);
+    args.set(4, nColumns);
+    args.set(5, sums, AccessModeIds::read);
+    args.set(6, crossProduct, AccessModeIds::write);
+
+    /* Only the lower triangle does the work, each work-item writes the symmetric pair */
+    KernelRange range(nColumns, nColumns);
+    context.run(range, kernel, args, status);
+}
+
+} // namespace math
+} // namespace internal
+} // namespace oneapi
+} // namespace daal